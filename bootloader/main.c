@@ -149,8 +149,11 @@ int main(int argc, char **argv){
 	printf("kernel entry at %p\n",KernelStart);
 
 
-	//do last after all other allocations
-	uintn_t map_key = get_mem_map(NULL);
+	//do last after all other allocations, so the map handed to the
+	//kernel is the one ExitBootServices is called with
+	static bootinfo info;
+	info.rsdp = rsdp;
+	uintn_t map_key = get_mem_map(&info);
 
 
 	printf("Exiting UEFI boot services and entering kernel\n");
@@ -158,7 +161,7 @@ int main(int argc, char **argv){
 
 	//setup null stack frame
 	asm volatile("xor %rbp, %rbp");
-	KernelStart(rsdp);
+	KernelStart(&info);
 
 	printf("kernel returned unexpectedly\n");
 
@@ -6,6 +6,7 @@
 #include <inc/types.h>
 #include <inc/trap.h>
 #include <inc/memlayout.h>
+#include <inc/ring.h>
 
 typedef int32_t envid_t;
 
@@ -55,9 +56,18 @@ struct Env {
 
 	// Address space
 	pde_t *env_pml4e;		// Kernel virtual address of page dir
+	uint8_t *env_binary;		// ELF image to demand-load pages from
+	uint8_t *env_image_holes;	// Image pages unmapped since, or NULL
 
 	// Exception handling
 	void *env_pgfault_upcall;	// Page fault upcall entry point
+	uintptr_t env_uxstacktop;	// Top of the user exception stack
+
+	// System call ring (see sys_ring_setup)
+	struct Ring *env_ring;		// Kernel virtual address, or NULL
+
+	// FPU/SSE/AVX state (see kern/fpu.c)
+	void *env_fpu;			// XSAVE area, or NULL until first use
 
 	// Lab 4 IPC
 	bool env_ipc_recving;		// Env is blocked receiving
@@ -65,6 +75,6 @@ struct Env {
 	uint32_t env_ipc_value;		// Data value sent to us
 	envid_t env_ipc_from;		// envid of the sender
 	int env_ipc_perm;		// Perm of page mapping received
-};
+} __attribute__((aligned(16)));	// The CPU pushes traps into env_tf (see env_run)
 
 #endif // !JOS_INC_ENV_H
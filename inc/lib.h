@@ -17,6 +17,7 @@
 #include <inc/memlayout.h>
 #include <inc/syscall.h>
 #include <inc/trap.h>
+#include <inc/uinfo.h>
 
 #define USED(x)		(void)(x)
 
@@ -25,13 +26,36 @@ void	umain(int argc, char **argv);
 
 // libmain.c or entry.S
 extern const char *binaryname;
-extern const volatile struct Env *thisenv;
 extern const volatile struct Env envs[NENV];
+extern const volatile struct UInfo uinfo;
 extern const volatile struct PageInfo pages[];
 
+// The running env.  Threads share all of memory, so this can't be a
+// variable: the kernel points the GS base of each env at its own envs[]
+// entry (see env_run), and we read our env_id through it.
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+		     : "=r" (id) : "i" (offsetof(struct Env, env_id)));
+	return &envs[ENVX(id)];
+}
+#define thisenv	(thisenv_get())
+
 // exit.c
 void	exit(void);
 
+// uinfo.c
+int	getcpu(void);
+uint64_t time_nsec(void);
+
+// ring.c
+int	ring_submit(uint32_t num, uint64_t a1, uint64_t a2, uint64_t a3,
+		    uint64_t a4, uint64_t a5, uint64_t data);
+int	ring_reap(struct RingCqe *cqe);
+
 // pgfault.c
 void	set_pgfault_handler(void (*handler)(struct UTrapframe *utf));
 
@@ -48,9 +72,18 @@ static envid_t sys_exofork(void);
 int	sys_env_set_status(envid_t env, int status);
 int	sys_env_set_pgfault_upcall(envid_t env, void *upcall);
 int	sys_page_alloc(envid_t env, void *pg, int perm);
+int	sys_page_alloc_huge(envid_t env, void *pg, int perm);
 int	sys_page_map(envid_t src_env, void *src_pg,
 		     envid_t dst_env, void *dst_pg, int perm);
 int	sys_page_unmap(envid_t env, void *pg);
+int	sys_page_unmap_range(envid_t env, void *pg, size_t len);
+envid_t	sys_fork(void);
+envid_t	sys_spawn(const char *prog, const char **argv);
+envid_t	sys_thread_create(void *entry, uint64_t a1, uint64_t a2);
+int	sys_page_batch(envid_t srcenv, envid_t dstenv,
+		       const struct PageOp *ops, size_t nops);
+int	sys_ring_setup(void *va);
+int	sys_ring_enter(void);
 int	sys_ipc_try_send(envid_t to_env, uint64_t value, void *pg, int perm);
 int	sys_ipc_recv(void *rcv_pg);
 
@@ -71,9 +104,9 @@ int32_t ipc_recv(envid_t *from_env_store, void *pg, int *perm_store);
 envid_t	ipc_find_env(enum EnvType type);
 
 // fork.c
-#define	PTE_SHARE	0x400
 envid_t	fork(void);
-envid_t	sfork(void);	// Challenge!
+envid_t	ufork(void);
+envid_t	sfork(void (*fn)(void *), void *arg);
 
 
 
@@ -14,8 +14,8 @@
 // Global descriptor numbers
 #define GD_KT     0x08     // kernel text
 #define GD_KD     0x10     // kernel data
-#define GD_UT     0x18     // user text
-#define GD_UD     0x20     // user data
+#define GD_UD     0x18     // user data (just below GD_UT, for SYSRET)
+#define GD_UT     0x20     // user text
 #define GD_TSS0   0x28     // Task segment selector for CPU 0
 #define GD_TSS1   0x30     // continued
 
@@ -121,6 +121,8 @@
 #define UPAGES		(ULIM - 25*PTSIZE)
 // Read-only copies of the global env structures
 #define UENVS		(UPAGES - PTSIZE)
+// Read-only kernel info (struct UInfo), in the last page of the UENVS slot
+#define UINFO		(UPAGES - PGSIZE)
 
 /*
  * Top of user VM. User can manipulate VA from UTOP-1 and down!
@@ -134,6 +136,16 @@
 // Top of normal user stack
 #define USTACKTOP	(UTOP - 2*PGSIZE)
 
+// Thread stacks (see sys_thread_create).  Below UTHREADTOP, the env
+// with index i has THREADSLOT bytes of address space for its stacks:
+// from the top, a one-page exception stack, a guard page, and a
+// THREADSTKSIZE stack, with unmapped guard pages below that.
+#define UTHREADTOP		(USTACKTOP - PTSIZE)
+#define THREADSLOT		(16*PGSIZE)
+#define THREADSTKSIZE		(4*PGSIZE)
+#define UTHREADXSTACKTOP(i)	(UTHREADTOP - (i) * THREADSLOT)
+#define UTHREADSTACKTOP(i)	(UTHREADXSTACKTOP(i) - 2*PGSIZE)
+
 // Where user programs generally begin
 #define UTEXT		(4*PTSIZE)
 
@@ -197,8 +209,18 @@ struct PageInfo {
 	// boot_alloc do not have valid reference count fields.
 
 	uint16_t pp_ref;
+
+	// Buddy allocator state (see kern/pmap.c).  A page heading a free
+	// block of 2^pp_order pages has PP_FREE set in pp_flags and is
+	// linked on that order's free list through pp_link and pp_prev.
+	uint8_t pp_order;
+	uint8_t pp_flags;
+	struct PageInfo *pp_prev;
 };
 
+// Values of pp_flags in struct PageInfo
+#define PP_FREE		0x01	// Heads a free block in the buddy allocator
+
 #endif /* !__ASSEMBLER__ */
 #endif /* !JOS_INC_MEMLAYOUT_H */
 
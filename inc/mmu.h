@@ -75,6 +75,9 @@
 #define PTSIZE		(PGSIZE*NPTENTRIES) // bytes mapped by a page directory entry
 #define PTSHIFT		21		// log2(PTSIZE)
 
+#define PDPSIZE		(PTSIZE*NPDENTRIES) // bytes mapped by a page directory pointer entry
+#define PDPSHIFT	30		// log2(PDPSIZE)
+
 #define PTXSHIFT	12		// offset of PTX in a linear address
 #define PDXSHIFT	21		// offset of PDX in a linear address
 #define PDPXSHIFT	30		// offset of PTX in a linear address
@@ -101,12 +104,26 @@
 // hardware, so user processes are allowed to set them arbitrarily.
 #define PTE_AVAIL	0xE00	// Available for software use
 
+// PTE_COW marks copy-on-write page table entries, and PTE_SHARE pages
+// that fork shares writable instead.  Both are PTE_AVAIL bits; the
+// library fork and sys_fork agree on them.
+#define PTE_SHARE	0x400
+#define PTE_COW		0x800
+
 // Flags in PTE_SYSCALL may be used in system calls.  (Others may not.)
 #define PTE_SYSCALL	(PTE_AVAIL | PTE_P | PTE_W | PTE_U)
 
+// CR3 with PCIDs enabled: bits 0-11 hold the PCID, and setting bit 63
+// on a load keeps the TLB entries tagged with that PCID
+#define CR3_PCID(cr3)	((cr3) & 0xFFF)
+#define CR3_NOFLUSH	(1ULL << 63)
+
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)	((physaddr_t) (pte) & ~0xFFF)
 
+// Address in a PTE_PS (large page) entry that maps 'size' bytes
+#define PTE_ADDR_PS(pte, size)	((physaddr_t) (pte) & ~((physaddr_t) (size) - 1))
+
 // Control Register flags
 #define CR0_PE		0x00000001	// Protection Enable
 #define CR0_MP		0x00000002	// Monitor coProcessor
@@ -120,7 +137,12 @@
 #define CR0_CD		0x40000000	// Cache Disable
 #define CR0_PG		0x80000000	// Paging
 
+#define CR4_OSXSAVE	0x00040000	// XSAVE and XCR0 enable
+#define CR4_PCIDE	0x00020000	// Process-context identifiers
+#define CR4_OSXMMEXCPT	0x00000400	// Unmasked SIMD FP exceptions
+#define CR4_OSFXSR	0x00000200	// FXSAVE/FXRSTOR and SSE enable
 #define CR4_PCE		0x00000100	// Performance counter enable
+#define CR4_PGE		0x00000080	// Page Global Enable
 #define CR4_MCE		0x00000040	// Machine Check Enable
 #define CR4_PSE		0x00000010	// Page Size Extensions
 #define CR4_DE		0x00000008	// Debugging Extensions
@@ -132,6 +154,12 @@
 #define CR4_PAE     0x00000020
 #define EFER_MSR    0xC0000080
 #define EFER_LM     0x00000100
+#define EFER_SCE    0x00000001	// SYSCALL/SYSRET enable
+#define STAR_MSR    0xC0000081	// SYSCALL/SYSRET segment selectors
+#define LSTAR_MSR   0xC0000082	// SYSCALL entry point
+#define SFMASK_MSR  0xC0000084	// RFLAGS bits SYSCALL clears
+#define GSBASE_MSR  0xC0000101
+#define KGSBASE_MSR 0xC0000102	// GS base swapgs swaps in
 
 // Eflags register
 #define FL_CF		0x00000001	// Carry Flag
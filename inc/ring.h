@@ -0,0 +1,42 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_INC_RING_H
+#define JOS_INC_RING_H
+
+#include <inc/types.h>
+
+// Entries in each ring; both must be powers of two
+#define RING_SQ_SIZE	32
+#define RING_CQ_SIZE	64
+
+// A request: a system call number and its arguments, as for syscall()
+struct RingSqe {
+	uint32_t sqe_num;	// SYS_*
+	uint32_t sqe_pad;
+	uint64_t sqe_args[5];
+	uint64_t sqe_data;	// Handed back in the completion
+};
+
+// The outcome of a request
+struct RingCqe {
+	uint64_t cqe_data;	// sqe_data of the request
+	int64_t cqe_result;	// What the system call returned
+};
+
+// A page an env shares with the kernel (see sys_ring_setup) to make
+// system calls without entering the kernel for each one.  The env adds
+// requests at r_sq_tail; the kernel carries them out in order whenever
+// it next has the env's attention (on any trap from the env, or from an
+// idle CPU while the env is blocked) and adds a completion for each at
+// r_cq_tail.  Indices run freely and are taken modulo the ring size.
+// Each side only writes its own end of each ring.
+struct Ring {
+	volatile uint32_t r_sq_head;	// Next request the kernel takes
+	volatile uint32_t r_sq_tail;	// Next free request slot
+	volatile uint32_t r_cq_head;	// Next completion the env takes
+	volatile uint32_t r_cq_tail;	// Next free completion slot
+	struct RingSqe r_sq[RING_SQ_SIZE];
+	struct RingCqe r_cq[RING_CQ_SIZE];
+};
+
+#endif	// !JOS_INC_RING_H
@@ -16,7 +16,29 @@ enum {
 	SYS_yield,
 	SYS_ipc_try_send,
 	SYS_ipc_recv,
+	SYS_page_alloc_huge,
+	SYS_page_unmap_range,
+	SYS_fork,
+	SYS_spawn,
+	SYS_thread_create,
+	SYS_page_batch,
+	SYS_ring_setup,
+	SYS_ring_enter,
 	NSYSCALLS
 };
 
+/* sys_page_batch operations */
+enum {
+	PAGEOP_ALLOC = 0,	// Like sys_page_alloc(dstenv, dstva, perm)
+	PAGEOP_MAP,		// Like sys_page_map(srcenv, srcva, dstenv, dstva, perm)
+	PAGEOP_UNMAP,		// Like sys_page_unmap(dstenv, dstva)
+};
+
+struct PageOp {
+	int po_op;		// PAGEOP_*
+	int po_perm;
+	void *po_srcva;		// PAGEOP_MAP only
+	void *po_dstva;
+};
+
 #endif /* !JOS_INC_SYSCALL_H */
@@ -0,0 +1,28 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_INC_UINFO_H
+#define JOS_INC_UINFO_H
+
+#include <inc/types.h>
+
+// CPUs the info page has room for (at least the kernel's NCPU)
+#define UINFO_NCPU	16
+
+struct UInfoCpu {
+	int32_t uc_env;		// envid running on this CPU, 0 if none
+	uint32_t uc_pad;
+	uint64_t uc_runs;	// Envs this CPU has started running
+};
+
+// The page the kernel maps read-only at UINFO in every env, so user code
+// can answer common questions without a system call.  Everything about
+// an env itself is in its struct Env, which is also mapped (envs[]).
+struct UInfo {
+	uint64_t ui_tsc_hz;	// TSC ticks per second; 0 if unknown
+	uint64_t ui_boot_tsc;	// TSC when the kernel booted
+	uint32_t ui_ncpu;	// CPUs in the system
+	uint32_t ui_pad;
+	struct UInfoCpu ui_cpu[UINFO_NCPU];
+};
+
+#endif	// !JOS_INC_UINFO_H
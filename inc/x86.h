@@ -240,12 +240,57 @@ cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *e
 		*edxp = edx;
 }
 
+// cpuid for leaves with subleaves, which are selected by ecx
+static inline void
+cpuid_count(uint32_t info, uint32_t count, uint32_t *eaxp, uint32_t *ebxp,
+	    uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+		     : "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		     : "a" (info), "c" (count));
+	if (eaxp)
+		*eaxp = eax;
+	if (ebxp)
+		*ebxp = ebx;
+	if (ecxp)
+		*ecxp = ecx;
+	if (edxp)
+		*edxp = edx;
+}
+
 static inline uint64_t
 read_tsc(void)
 {
-	uint64_t tsc;
-	asm volatile("rdtsc" : "=A" (tsc));
-	return tsc;
+	uint32_t lo, hi;
+	asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+	return ((uint64_t) hi << 32) | lo;
+}
+
+static inline uint64_t
+rdmsr(uint32_t msr)
+{
+	uint32_t lo, hi;
+	asm volatile("rdmsr" : "=a" (lo), "=d" (hi) : "c" (msr));
+	return ((uint64_t) hi << 32) | lo;
+}
+
+static inline void
+wrmsr(uint32_t msr, uint64_t val)
+{
+	asm volatile("wrmsr" : : "c" (msr), "a" ((uint32_t) val), "d" ((uint32_t) (val >> 32)));
+}
+
+static inline void
+xsetbv(uint32_t reg, uint64_t val)
+{
+	asm volatile("xsetbv" : : "c" (reg), "a" ((uint32_t) val), "d" ((uint32_t) (val >> 32)));
+}
+
+static inline void
+clts(void)
+{
+	asm volatile("clts");
 }
 
 static inline uint32_t
@@ -0,0 +1,49 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_BOOTINFO_H
+#define JOS_KERN_BOOTINFO_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+// Information the UEFI bootloader hands to the kernel entry point.
+// The layout must match the 'bootinfo' typedef in bootloader/main.c.
+// All pointers are physical addresses.
+struct BootInfo {
+	void *bi_mem_map;		// UEFI memory map (array of descriptors)
+	uint64_t bi_map_size;		// Size of bi_mem_map in bytes
+	uint64_t bi_map_desc_size;	// Size of one descriptor in bytes
+	void *bi_rsdp;			// ACPI RSDP
+};
+
+// One UEFI memory map descriptor.  Firmware may use a descriptor size
+// larger than this structure, so step through the map by
+// bi_map_desc_size, not by sizeof(struct EfiMemDesc).
+struct EfiMemDesc {
+	uint32_t md_type;		// One of the EFI_* types below
+	uint32_t md_pad;
+	uint64_t md_phys_start;		// Physical address of the first byte
+	uint64_t md_virt_start;
+	uint64_t md_npages;		// Number of 4KB pages
+	uint64_t md_attribute;
+};
+
+// UEFI memory types (UEFI spec, EFI_MEMORY_TYPE)
+#define EFI_RESERVED_MEMORY		0
+#define EFI_LOADER_CODE			1
+#define EFI_LOADER_DATA			2
+#define EFI_BOOT_SERVICES_CODE		3
+#define EFI_BOOT_SERVICES_DATA		4
+#define EFI_RUNTIME_SERVICES_CODE	5
+#define EFI_RUNTIME_SERVICES_DATA	6
+#define EFI_CONVENTIONAL_MEMORY		7
+#define EFI_UNUSABLE_MEMORY		8
+#define EFI_ACPI_RECLAIM_MEMORY		9
+#define EFI_ACPI_MEMORY_NVS		10
+#define EFI_MEMORY_MAPPED_IO		11
+#define EFI_MEMORY_MAPPED_IO_PORT	12
+#define EFI_PAL_CODE			13
+
+#endif	// !JOS_KERN_BOOTINFO_H
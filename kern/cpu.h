@@ -10,6 +10,9 @@
 // Maximum number of CPUs
 #define NCPU  8
 
+// PCIDs each CPU hands out to address spaces (see pml4e_load)
+#define NPCID_SLOTS  6
+
 // Values of status in struct Cpu
 enum {
 	CPU_UNUSED = 0,
@@ -23,6 +26,20 @@ struct CpuInfo {
 	volatile unsigned cpu_status;   // The status of the CPU
 	struct Env *cpu_env;            // The currently-running environment.
 	struct TSS64 cpu_ts;        // Used by x86 to find stack for interrupt
+	struct PageInfo *cpu_pcp_list;  // Per-CPU cache of free pages
+	int cpu_pcp_count;              // Number of pages in cpu_pcp_list
+	physaddr_t cpu_pcid_root[NPCID_SLOTS]; // pml4 using PCID i+1, or 0
+	int cpu_pcid_next;              // Next PCID slot to recycle
+	physaddr_t cpu_tlb_root;        // pml4 loaded in CR3
+	volatile uint32_t cpu_tlb_user; // May be running user code
+	volatile uint32_t cpu_tlb_pending; // Shootdown waiting for this CPU
+	volatile uint32_t cpu_tlb_stale; // Missed a shootdown; flush all
+	struct Env *cpu_fpu_owner;      // Env whose FPU state is loaded
+	struct {                        // syscall_entry finds this via swapgs
+		uintptr_t sc_kstack;    // Top of this CPU's kernel stack
+		uintptr_t sc_ursp;      // User rsp while switching stacks
+		uintptr_t sc_tf;        // End of curenv->env_tf (see env_run)
+	} cpu_syscall;
 };
 
 // Initialized in mpconfig.c
@@ -42,5 +59,6 @@ void lapic_init(void);
 void lapic_startap(uint8_t apicid, uint32_t addr);
 void lapic_eoi(void);
 void lapic_ipi(int vector);
+void lapic_ipi_cpu(int apicid, int vector);
 
 #endif
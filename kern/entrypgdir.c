@@ -37,8 +37,12 @@ pml4e_t entry_pml4e[NPDENTRIES] = {
 
 __attribute__((__aligned__(PGSIZE)))
 pdpe_t entry_pdpt[NPTENTRIES] = {
-    // Map VA's [0, 1GB) to PA's [0, 1GB) using 1GB pages
+    // Map VA's [0, 3GB) to PA's [0, 3GB) using 1GB pages, so the kernel
+    // can read the bootloader's bootinfo and UEFI memory map wherever
+    // the firmware put them below the PCI hole
     [0] = (0x000000000 | PTE_P | PTE_W | PTE_PS),
+    [1] = (0x040000000 | PTE_P | PTE_W | PTE_PS),
+    [2] = (0x080000000 | PTE_P | PTE_W | PTE_PS),
     // Map VA's [KERNBASE, KERNBASE+1GB) to PA's [0, 1GB) using 1GB pages
     [PDPX(KERNBASE)] = (0x000000000 | PTE_P | PTE_W | PTE_PS)
 };
@@ -9,16 +9,52 @@
 
 #include <kern/env.h>
 #include <kern/pmap.h>
+#include <kern/kmalloc.h>
+#include <kern/fpu.h>
 #include <kern/trap.h>
 #include <kern/monitor.h>
 #include <kern/sched.h>
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
+#include <kern/kclock.h>
 
 struct Env *envs = NULL;		// All environments
+struct UInfo *uinfo = NULL;		// Mapped read-only at UINFO
 static struct Env *env_free_list;	// Free environment list
 					// (linked by Env->env_link)
 
+// A page of a program image, shared by the envs running it (see
+// image_page_get)
+struct ImagePage {
+	uint8_t *ip_binary;		// The image...
+	uintptr_t ip_va;		// ...and the page's va in it
+	struct PageInfo *ip_page;
+	struct ImagePage *ip_next;	// Next in the hash bucket
+};
+static struct KmemCache *image_page_cache;
+
+// Pages an image may span: one bit each in env_image_holes
+#define IMAGE_MAX_PAGES	(PGSIZE * 8)
+
+// Find the page-aligned range [*lo, *hi) the loadable segments of
+// 'binary' cover.  *lo >= *hi if there are none.
+static void
+image_bounds(uint8_t *binary, uintptr_t *lo, uintptr_t *hi)
+{
+	struct Elf *elf = (struct Elf *) binary;
+	struct Proghdr *ph, *eph;
+
+	*lo = UTOP;
+	*hi = 0;
+	ph = (struct Proghdr *) (binary + elf->e_phoff);
+	eph = ph + elf->e_phnum;
+	for (; ph < eph; ph++)
+		if (ph->p_type == ELF_PROG_LOAD) {
+			*lo = MIN(*lo, ROUNDDOWN(ph->p_va, PGSIZE));
+			*hi = MAX(*hi, ROUNDUP(ph->p_va + ph->p_memsz, PGSIZE));
+		}
+}
+
 #define ENVGENSHIFT	12		// >= LOGNENV
 
 // Global descriptor table.
@@ -139,17 +175,35 @@ env_init(void)
         env_free_list = &envs[i];
     }
 
+	if (!(image_page_cache = kmem_cache_create("image_page", sizeof(struct ImagePage))))
+		panic("env_init: out of memory");
+
 	// Per-CPU part of the initialization
 	env_init_percpu();
 }
 
+//
+// Fill in the parts of the info page that don't change.
+// Must be called after mp_init().
+//
+void
+uinfo_init(void)
+{
+	static_assert(NCPU <= UINFO_NCPU);
+
+	uinfo->ui_boot_tsc = read_tsc();
+	uinfo->ui_tsc_hz = tsc_calibrate();
+	uinfo->ui_ncpu = ncpu;
+	cprintf("TSC: %ld kHz\n", uinfo->ui_tsc_hz / 1000);
+}
+
 // Load GDT and segment descriptors.
 void
 env_init_percpu(void)
 {
 	lgdt(&gdt_pd);
-	// The kernel never uses GS or FS, so we leave those set to
-	// the user data segment.
+	// The kernel never uses GS or FS (but for a swapgs in
+	// syscall_entry), so we leave those set to the user data segment.
 	asm volatile("movw %%ax,%%gs" : : "a" (GD_UD|3));
 	asm volatile("movw %%ax,%%fs" : : "a" (GD_UD|3));
 	// The kernel does use ES, DS, and SS.  We'll change between
@@ -181,16 +235,12 @@ env_init_percpu(void)
   we must copy the pages in kernel page directory in a shared area and make them read-only
 - DO NOT use memcpy to copy kern_pml4 into the new environment
 - Instead. copy kernel half
-- Walk virtual addresses in a loop from UTO to KERNBASE-1
-- For each address, loop up existing mapping in kern_pml4 with pml4e_walk
-	- If a page iss found and available (PTE_P), create corresponding entry in environment's page tables
-	  (e->env_pml4e) using pml4e_walk() with create=1
-- Copy page
-- Remainder will remain unmapped; each env will fill it in later as needed
-- After loop, mirror kernel space with:
-	pdpe_t *env_pdpe = KADDR(PTE_ADDR(e->env_pml4e[0]));
-	pde_t *kern_pdpe = KADDR(PTE_ADDR(kern_pml4[0]));
-	env_pdpe[3]= kern_pdpe[3];
+- Give the env its own PDPT (pml4[0]) and the page directory covering
+  UTOP, since user space shares both with the kernel
+- Link, don't copy: the PDEs for [UTOP, KERNBASE) point at the kernel's
+  own page tables, and the PDPT entries from KERNBASE up at the kernel's
+  page directories, so this takes the same time for every env
+- Those shared tables aren't refcounted; env_free stops at UTOP instead
 - Finalize function by setting environment's UVPT page with read-only perms
 	e->env_pml4e[PML4X(UVPT)] = PADDR(e->env_pml4e) | PTE_P | PTE_U;`
 	return 0;
@@ -199,7 +249,9 @@ static int
 env_setup_vm(struct Env *e)
 {
 	int i;
-	struct PageInfo *p = NULL;
+	struct PageInfo *p = NULL, *pdpe_page, *pgdir_page;
+	pdpe_t *env_pdpe, *kern_pdpe;
+	pde_t *env_pgdir, *kern_pgdir;
 
 	// Allocate a page for the page directory
 	if (!(p = page_alloc(ALLOC_ZERO)))
@@ -226,38 +278,37 @@ env_setup_vm(struct Env *e)
 	p->pp_ref++;
 	e->env_pml4e = (pml4e_t *)page2kva(p);
 
-	uintptr_t va;
-    for (va = UTOP; va < KERNBASE; va += PGSIZE) {
-        pte_t *kern_pte = pml4e_walk(kern_pml4, (void *)va, 0);
-        
-        // if mapping already exists in kernel page table
-        if (kern_pte && (*kern_pte & PTE_P)) {
-            // create corresponding entry in env page table
-            pte_t *env_pte = pml4e_walk(e->env_pml4e, (void *)va, 1);
-            
-            if (env_pte == NULL) {
-                page_decref(p);
-                return -E_NO_MEM;
-            }
-            
-            *env_pte = *kern_pte;
-        }
-    }
+	// [UTOP, KERNBASE) must sit in the one page directory below
+	static_assert(PDPX(UTOP) == PDPX(KERNBASE - 1));
+	static_assert(KERNBASE % PDPSIZE == 0);
 
-	if (!(e->env_pml4e[0] & PTE_P)) {
-        struct PageInfo *pdpe_page = page_alloc(ALLOC_ZERO);
-        if (pdpe_page == NULL) {
-            page_decref(p);
-            return -E_NO_MEM;
-        }
-        pdpe_page->pp_ref++;
-        e->env_pml4e[0] = page2pa(pdpe_page) | PTE_P | PTE_U | PTE_W;
-    }
-    
-    // mirror kernel space
-    pdpe_t *env_pdpe = KADDR(PTE_ADDR(e->env_pml4e[0]));
-    pdpe_t *kern_pdpe = KADDR(PTE_ADDR(kern_pml4[0]));
-    env_pdpe[3] = kern_pdpe[3];
+	if (!(pdpe_page = page_alloc(ALLOC_ZERO))) {
+		page_decref(p);
+		return -E_NO_MEM;
+	}
+	pdpe_page->pp_ref++;
+	e->env_pml4e[0] = page2pa(pdpe_page) | PTE_P | PTE_U | PTE_W;
+
+	if (!(pgdir_page = page_alloc(ALLOC_ZERO))) {
+		page_decref(pdpe_page);
+		page_decref(p);
+		return -E_NO_MEM;
+	}
+	pgdir_page->pp_ref++;
+	env_pdpe = page2kva(pdpe_page);
+	env_pdpe[PDPX(UTOP)] = page2pa(pgdir_page) | PTE_P | PTE_U | PTE_W;
+
+	// share the kernel's page tables between UTOP and KERNBASE
+	kern_pdpe = KADDR(PTE_ADDR(kern_pml4[0]));
+	kern_pgdir = KADDR(PTE_ADDR(kern_pdpe[PDPX(UTOP)]));
+	env_pgdir = page2kva(pgdir_page);
+	for (i = PDX(UTOP); i < NPDENTRIES; i++)
+		env_pgdir[i] = kern_pgdir[i];
+
+	// and everything from KERNBASE up, including physical memory
+	// mapped above 4GB
+	for (i = PDPX(KERNBASE); i < NPDENTRIES; i++)
+		env_pdpe[i] = kern_pdpe[i];
 
 	// UVPT maps the env's own page table read-only.
 	// Permissions: kernel R, user R
@@ -265,6 +316,62 @@ env_setup_vm(struct Env *e)
 	return 0;
 }
 
+//
+// Drop e's reference to its address space.  Threads share one (see
+// env_share_vm), counted in the pp_ref of the PML4 page; the last env
+// to let go frees all of it.
+//
+static void
+env_free_vm(struct Env *e)
+{
+	struct PageInfo *pml4_page = pa2page(PADDR(e->env_pml4e));
+	pdpe_t *env_pdpe;
+
+	// shared along with the address space (see env_image_unmap)
+	if (e->env_image_holes) {
+		page_decref(pa2page(PADDR(e->env_image_holes)));
+		e->env_image_holes = NULL;
+	}
+
+	if (pml4_page->pp_ref > 1) {
+		pml4_page->pp_ref--;
+		e->env_pml4e = 0;
+		return;
+	}
+
+	static_assert(UTOP % PTSIZE == 0);
+
+	// Flush all mapped pages in the user portion of the address space,
+	// and the page tables and directories that only map user space
+	page_remove_range(e->env_pml4e, 0, UTOP);
+
+	// free the page directory that is shared with [UTOP, KERNBASE)
+	env_pdpe = KADDR(PTE_ADDR(e->env_pml4e[0]));
+	page_decref(pa2page(PTE_ADDR(env_pdpe[PDPX(UTOP)])));
+	// free the page directory pointer
+	page_decref(pa2page(PTE_ADDR(e->env_pml4e[0])));
+
+	// free the PML4, and make sure no CPU keeps TLB entries tagged
+	// with it for whoever gets the page next
+	pcid_forget(e->env_pml4e);
+	e->env_pml4e = 0;
+	page_decref(pml4_page);
+}
+
+//
+// Make 'e', fresh from env_alloc, a thread of 'owner': give up its own
+// (empty) address space and share owner's instead.
+//
+void
+env_share_vm(struct Env *e, struct Env *owner)
+{
+	env_free_vm(e);
+	e->env_pml4e = owner->env_pml4e;
+	pa2page(PADDR(e->env_pml4e))->pp_ref++;
+	if ((e->env_image_holes = owner->env_image_holes))
+		pa2page(PADDR(e->env_image_holes))->pp_ref++;
+}
+
 //
 // Allocates and initializes a new environment.
 // On success, the new environment is stored in *newenv_store.
@@ -326,6 +433,11 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 
 	// Clear the page fault handler until user installs one.
 	e->env_pgfault_upcall = 0;
+	e->env_uxstacktop = UXSTACKTOP;
+	e->env_binary = NULL;
+	e->env_image_holes = NULL;
+	e->env_ring = NULL;
+	e->env_fpu = NULL;
 
 	// Also clear the IPC receiving flag.
 	e->env_ipc_recving = 0;
@@ -343,10 +455,10 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 // and map it at virtual address va in the environment's address space.
 // Does not zero or otherwise initialize the mapped pages in any way.
 // Pages should be writable by user and kernel.
-// Panic if any allocation attempt fails.
+// Returns 0, or -E_NO_MEM if any allocation attempt fails.
 /*
 */
-static void
+static int
 region_alloc(struct Env *e, void *va, size_t len)
 {
 	// LAB 3: Your code here.
@@ -358,27 +470,32 @@ region_alloc(struct Env *e, void *va, size_t len)
 	//   (Watch out for corner-cases!)
 	void *va_start = ROUNDDOWN(va, PGSIZE);
 	
-    void *addr;
 	void *va_end = ROUNDUP(va + len, PGSIZE);
-    for (addr = va_start; addr < va_end; addr += PGSIZE) {
+    struct PteIter it;
+    int r;
+    
+    // one walk for the whole region; pages already there (say, shared
+    // with the previous segment) are kept
+    pte_iter_init(&it, e->env_pml4e, va_start, va_end - va_start, 1);
+    while ((r = pte_iter_next(&it)) > 0) {
+        if (*it.pi_pte & PTE_P) {
+            continue;
+        }
         struct PageInfo *pp = page_alloc(0); // allocate a page without zeroing
         
         if (pp == NULL) {
-            panic("region_alloc: page_alloc failed");
-        }
-        int r = page_insert(e->env_pml4e, pp, addr, PTE_U | PTE_W); // user + writeable
-        
-        if (r < 0) {
-            panic("region_alloc: page_insert failed");
+            return -E_NO_MEM;
         }
+        pp->pp_ref++;
+        *it.pi_pte = page2pa(pp) | PTE_U | PTE_W | PTE_P; // user + writeable
     }
+    return r;
 }
 
 //
 // Set up the initial program binary, stack, and processor flags
 // for a user process.
-// This function is ONLY called during kernel initialization,
-// before running the first user-mode environment.
+// It is called during kernel initialization, and by env_spawn.
 //
 // This function loads all loadable segments from the ELF binary image
 // into the environment's user memory, starting at the appropriate
@@ -393,12 +510,15 @@ region_alloc(struct Env *e, void *va, size_t len)
 //
 // Finally, this function maps one page for the program's initial stack.
 //
-// load_icode panics if it encounters problems.
+// Returns 0, -E_INVAL if the image is not a valid ELF executable, or
+// -E_NO_MEM if the stack can't be allocated.
 //  - How might load_icode fail?  What might be wrong with the given input?
 //
 /*
 Notes:
-- modify CR3 register to point to env's page directory: lcr3(PADDR(e->env_pml4e))
+- Segments are no longer copied here: load_icode only checks them and
+  records the image in e->env_binary; env_load_page fills each page in
+  on first touch, so no CR3 switch is needed either
 - Receives pointer to binary ELF file 
 - Define ELF struct:
 	struct Elf *elfhdr = (struct Elf *) binary;
@@ -420,7 +540,7 @@ Notes:
 - At end: lcr3(PADDR(kern_pml4)); to switch back to kernel page directory
 
 */
-static void
+static int
 load_icode(struct Env *e, uint8_t *binary)
 {
 	// Hints:
@@ -454,23 +574,30 @@ load_icode(struct Env *e, uint8_t *binary)
 	// LAB 3: Your code here.
 	struct Elf *elfhdr = (struct Elf *)binary;
 	if (elfhdr->e_magic != ELF_MAGIC) {
-        panic("load_icode: not a valid ELF file");
+        return -E_INVAL;
     }
-	lcr3(PADDR(e->env_pml4e));
 
 	struct Proghdr *ph = (struct Proghdr *)(binary + elfhdr->e_phoff);
 	struct Proghdr *eph = ph + elfhdr->e_phnum;
+	uintptr_t lo, hi;
 
+	// The pages of each segment are loaded on demand (env_load_page);
+	// just make sure they stay in user space.
 	 for (; ph < eph; ph++) {
         if (ph->p_type != ELF_PROG_LOAD) {
             continue;
         }
         
-        region_alloc(e, (void *)ph->p_va, ph->p_memsz);
-        memcpy((void *)ph->p_va, binary + ph->p_offset, ph->p_filesz);
-        // p_memsz >= p_filesz, so we zero (p_memsz - p_filesz) bytes
-        memset((void *)(ph->p_va + ph->p_filesz), 0, ph->p_memsz - ph->p_filesz);
+        if (ph->p_filesz > ph->p_memsz || ph->p_va >= UTOP
+            || ph->p_memsz > UTOP - ph->p_va) {
+            return -E_INVAL;
+        }
     }
+	// env_image_holes has a bit for each page of the image
+	image_bounds(binary, &lo, &hi);
+	if (lo < hi && hi - lo > IMAGE_MAX_PAGES * PGSIZE)
+		return -E_INVAL;
+	e->env_binary = binary;
 
 	e->env_tf.tf_rip = elfhdr->e_entry;
 
@@ -478,8 +605,189 @@ load_icode(struct Env *e, uint8_t *binary)
 	// at virtual address USTACKTOP - PGSIZE.
 	
 	// LAB 3: Your code here.
-	region_alloc(e, (void *)(USTACKTOP - PGSIZE), PGSIZE);
-	lcr3(PADDR(kern_pml4));
+	return region_alloc(e, (void *)(USTACKTOP - PGSIZE), PGSIZE);
+}
+
+//
+// Demand loading of the program image.  e->env_binary stays where the
+// kernel linked it (_binary_obj_*), and each page of an ELF_PROG_LOAD
+// segment is copied from there the first time the env touches it.
+// Pages that are never touched are never allocated.  A forked child
+// shares env_binary: any page its parent hadn't loaded yet still holds
+// exactly what is in the image.
+//
+// A page the env unmaps must stay unmapped, though, so the unmap system
+// calls record image pages in env_image_holes (env_image_unmap), and
+// env_load_page leaves those alone.  The bitmap belongs to the address
+// space: threads share it, and a forked child gets a copy.
+//
+// Every env running the same image gets the same page for a given va:
+// the first copy is kept in the image page cache (which holds a
+// reference to it) and mapped into each env.  Pages only of read-only
+// segments are mapped read-only; pages with writable data are mapped
+// copy-on-write, so an env that writes one gets its own copy and the
+// cached page stays as it is in the image.  The images are part of the
+// kernel and never go away, so neither do the cached pages.
+//
+
+#define IMAGE_HASH_SIZE	256
+
+static struct ImagePage *image_pages[IMAGE_HASH_SIZE];
+
+static unsigned
+image_hash(uint8_t *binary, uintptr_t va)
+{
+	return (((uintptr_t) binary >> PGSHIFT) ^ (va >> PGSHIFT)) % IMAGE_HASH_SIZE;
+}
+
+// Return the cached page of 'binary' at 'va', filling it in from the
+// image first if needed.  Returns NULL if out of memory.
+static struct PageInfo *
+image_page_get(uint8_t *binary, uintptr_t va)
+{
+	struct Elf *elf = (struct Elf *) binary;
+	struct ImagePage **bucket = &image_pages[image_hash(binary, va)];
+	struct ImagePage *ip;
+	struct Proghdr *ph, *eph;
+	struct PageInfo *pp;
+	uintptr_t lo, hi;
+
+	for (ip = *bucket; ip; ip = ip->ip_next)
+		if (ip->ip_binary == binary && ip->ip_va == va)
+			return ip->ip_page;
+
+	if (!(ip = kmem_cache_alloc(image_page_cache)))
+		return NULL;
+	if (!(pp = page_alloc(ALLOC_ZERO))) {
+		kmem_cache_free(image_page_cache, ip);
+		return NULL;
+	}
+
+	// Segments may share a page, so copy in every one that overlaps
+	ph = (struct Proghdr *) (binary + elf->e_phoff);
+	eph = ph + elf->e_phnum;
+	for (; ph < eph; ph++) {
+		if (ph->p_type != ELF_PROG_LOAD)
+			continue;
+		lo = MAX(va, ph->p_va);
+		hi = MIN(va + PGSIZE, ph->p_va + ph->p_filesz);
+		if (lo < hi)
+			memcpy((char *) page2kva(pp) + (lo - va),
+			       binary + ph->p_offset + (lo - ph->p_va), hi - lo);
+	}
+
+	pp->pp_ref++;
+	ip->ip_binary = binary;
+	ip->ip_va = va;
+	ip->ip_page = pp;
+	ip->ip_next = *bucket;
+	*bucket = ip;
+	return pp;
+}
+
+//
+// Map a page at 'va' in 'e' with its contents from e's program image,
+// if 'va' lies in a loadable segment, isn't mapped yet and was never
+// unmapped by the env.
+// Returns 0 if it mapped the page, -E_INVAL if 'va' isn't such a
+// page, or -E_NO_MEM.
+//
+int
+env_load_page(struct Env *e, uintptr_t va)
+{
+	struct Elf *elf = (struct Elf *) e->env_binary;
+	struct Proghdr *ph, *eph;
+	struct PageInfo *pp;
+	uintptr_t lo, hi, n;
+	size_t size;
+	bool found = 0, writable = 0;
+	int r;
+
+	va = ROUNDDOWN(va, PGSIZE);
+	if (!elf || va >= UTOP || pml4e_walk_leaf(e->env_pml4e, (void *) va, &size))
+		return -E_INVAL;
+
+	ph = (struct Proghdr *) (e->env_binary + elf->e_phoff);
+	eph = ph + elf->e_phnum;
+	for (; ph < eph; ph++)
+		if (ph->p_type == ELF_PROG_LOAD
+		    && va < ph->p_va + ph->p_memsz
+		    && va + PGSIZE > ROUNDDOWN(ph->p_va, PGSIZE)) {
+			found = 1;
+			if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+				writable = 1;
+		}
+	if (!found)
+		return -E_INVAL;
+	if (e->env_image_holes) {
+		image_bounds(e->env_binary, &lo, &hi);
+		n = (va - lo) >> PGSHIFT;
+		if (e->env_image_holes[n / 8] & (1 << (n % 8)))
+			return -E_INVAL;
+	}
+
+	if (!(pp = image_page_get(e->env_binary, va)))
+		return -E_NO_MEM;
+	return page_insert(e->env_pml4e, pp, (void *) va,
+			   writable ? PTE_U | PTE_COW : PTE_U);
+}
+
+//
+// Record that the env is about to unmap [va, va + len), so that
+// env_load_page doesn't bring back the image pages in that range.
+// The first time, this allocates env_image_holes for every env
+// sharing e's address space.
+// Returns 0, or -E_NO_MEM.
+//
+int
+env_image_unmap(struct Env *e, uintptr_t va, size_t len)
+{
+	struct PageInfo *pp;
+	uintptr_t base, lo, hi, n;
+	int i;
+
+	if (!e->env_binary)
+		return 0;
+	image_bounds(e->env_binary, &base, &hi);
+	lo = MAX(base, ROUNDDOWN(va, PGSIZE));
+	hi = MIN(hi, va + len);
+	if (lo >= hi)
+		return 0;
+
+	if (!e->env_image_holes) {
+		if (!(pp = page_alloc(ALLOC_ZERO)))
+			return -E_NO_MEM;
+		for (i = 0; i < NENV; i++)
+			if (envs[i].env_status != ENV_FREE
+			    && envs[i].env_pml4e == e->env_pml4e) {
+				envs[i].env_image_holes = page2kva(pp);
+				pp->pp_ref++;
+			}
+	}
+
+	for (n = (lo - base) >> PGSHIFT; lo < hi; lo += PGSIZE, n++)
+		e->env_image_holes[n / 8] |= 1 << (n % 8);
+	return 0;
+}
+
+//
+// Give 'child', fresh from env_alloc, a copy of the image pages
+// 'parent' has unmapped, for a child that gets a copy of parent's
+// address space.  Returns 0, or -E_NO_MEM.
+//
+int
+env_image_copy(struct Env *child, struct Env *parent)
+{
+	struct PageInfo *pp;
+
+	if (!parent->env_image_holes)
+		return 0;
+	if (!(pp = page_alloc(0)))
+		return -E_NO_MEM;
+	memcpy(page2kva(pp), parent->env_image_holes, PGSIZE);
+	pp->pp_ref++;
+	child->env_image_holes = page2kva(pp);
+	return 0;
 }
 
 //
@@ -505,74 +813,138 @@ env_create(uint8_t *binary, enum EnvType type)
         panic("env_create: env_alloc failed: %e returned instead of 0", r);
     }
     
-    load_icode(newEnv, binary);
+    if ((r = load_icode(newEnv, binary)) < 0) {
+        panic("env_create: load_icode: %e", r);
+    }
     newEnv->env_type = type;
 }
 
+//
+// Create a new env, with parent 'parent_id', running the program image
+// 'binary' from the start.  Nothing of the parent is copied.
+// On success the new env is runnable and is stored in *newenv_store.
+// Returns 0, or < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_NO_MEM on memory exhaustion.
+//	-E_INVAL if 'binary' is not a valid program image.
+//
+int
+env_spawn(struct Env **newenv_store, uint8_t *binary, envid_t parent_id)
+{
+	struct Env *e;
+	int r;
+
+	if ((r = env_alloc(&e, parent_id)) < 0)
+		return r;
+	if ((r = load_icode(e, binary)) < 0) {
+		env_free(e);
+		return r;
+	}
+	*newenv_store = e;
+	return 0;
+}
+
+//
+// Look up the program image embedded in the kernel as user/'name'.
+// Returns NULL if there is none.
+//
+uint8_t *
+env_binary_lookup(const char *name)
+{
+	const struct EnvBinary *eb;
+
+	for (eb = env_binaries; eb->eb_name; eb++)
+		if (strcmp(eb->eb_name, name) == 0)
+			return eb->eb_image;
+	return NULL;
+}
+
+//
+// Give 'child', fresh from env_alloc, a copy-on-write copy of the user
+// address space of 'parent', in one pass over the parent's page tables:
+//   - pages marked PTE_SHARE are shared as they are,
+//   - writable and copy-on-write pages become copy-on-write in both,
+//   - other pages are shared read-only,
+//   - the user exception stack is not copied; the child gets a new one.
+// 2MB pages are split first, since the copy-on-write fault handler
+// works a page at a time.
+// Returns 0, or -E_NO_MEM; the parent is still fine then, but some of
+// its pages may have become copy-on-write.
+//
+int
+env_copy_cow(struct Env *child, struct Env *parent)
+{
+	struct PteIter pit, cit;
+	struct PageInfo *pp;
+	pte_t perm;
+	int r, downgraded = 0;
+
+	pte_iter_init(&pit, parent->env_pml4e, 0, UTOP, 0);
+	pte_iter_init(&cit, child->env_pml4e, 0, UTOP, 1);
+	while ((r = pte_iter_next(&pit)) > 0) {
+		if (pit.pi_size != PGSIZE) {
+			if ((r = page_split(parent->env_pml4e, (void *) pit.pi_va)) < 0)
+				break;
+			pte_iter_seek(&pit, (void *) pit.pi_va);
+			continue;
+		}
+		if (pit.pi_va == UXSTACKTOP - PGSIZE)
+			continue;
+
+		perm = *pit.pi_pte & PTE_SYSCALL;
+		if (!(perm & PTE_SHARE) && (perm & (PTE_W | PTE_COW))) {
+			perm = (perm & ~PTE_W) | PTE_COW;
+			if (*pit.pi_pte & PTE_W)
+				downgraded = 1;
+			*pit.pi_pte = (*pit.pi_pte & ~PTE_W) | PTE_COW;
+		}
+
+		pte_iter_seek(&cit, (void *) pit.pi_va);
+		if ((r = pte_iter_next(&cit)) < 0)
+			break;
+		pp = pa2page(PTE_ADDR(*pit.pi_pte));
+		pp->pp_ref++;
+		*cit.pi_pte = page2pa(pp) | perm;
+	}
+	// the parent may be running on this CPU with its pages writable
+	if (downgraded)
+		tlb_invalidate_all(parent->env_pml4e);
+	if (r < 0)
+		return r;
+
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+		return -E_NO_MEM;
+	if ((r = page_insert(child->env_pml4e, pp, (void *) (UXSTACKTOP - PGSIZE),
+			     PTE_P | PTE_U | PTE_W)) < 0) {
+		page_free(pp);
+		return r;
+	}
+	return 0;
+}
+
 //
 // Frees env e and all memory it uses.
 //
 void
 env_free(struct Env *e)
 {
-	pte_t *pt;
-	uint64_t pdeno, pteno;
-	physaddr_t pa;
-
 	// If freeing the current environment, switch to kern_pgdir
 	// before freeing the page directory, just in case the page
 	// gets reused.
 	if (e == curenv)
-		lcr3(PADDR(kern_pml4));
+		pml4e_load(kern_pml4);
 
 	// Note the environment's demise.
 	cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
 	// cprintf("ULIM:%x\n",ULIM);
 	// cprintf("UTOP:%x\n",UTOP);
 
-	static_assert(UTOP % PTSIZE == 0);
-
-	// Flush all mapped pages in the user portion of the address space
-	pdpe_t *env_pdpe = KADDR(PTE_ADDR(e->env_pml4e[0]));
-	int pdeno_limit;
-	uint64_t pdpe_index;
-	//using 3 instead of NPDPENTRIES as we only need to deal with first 3gbs
-	for(pdpe_index=0;pdpe_index<3;pdpe_index++){
-		if(!(env_pdpe[pdpe_index] & PTE_P))
-			continue;
-		pde_t *env_pgdir = KADDR(PTE_ADDR(env_pdpe[pdpe_index]));
-		for (pdeno = 0; pdeno < NPDENTRIES; pdeno++) {
-
-			// only look at mapped page tables
-			if (!(env_pgdir[pdeno] & PTE_P))
-				continue;
-			// find the pa and va of the page table
-			pa = PTE_ADDR(env_pgdir[pdeno]);
-			pt = (pte_t*) KADDR(pa);
-
-			// unmap all PTEs in this page table
-			for (pteno = 0; pteno < NPDENTRIES &&PGADDR((uint64_t)0,pdpe_index,pdeno, pteno, 0)<(void*)UTOP; pteno++) {
-				if (pt[pteno] & PTE_P){
-					page_remove(e->env_pml4e, PGADDR((uint64_t)0,pdpe_index,pdeno, pteno, 0));
-				}
-			}
-
-			// free the page table itself
-			env_pgdir[pdeno] = 0;
-			page_decref(pa2page(pa));
-		}
-		// free the page directory
-		pa = PTE_ADDR(env_pdpe[pdpe_index]);
-		env_pdpe[pdpe_index] = 0;
-		page_decref(pa2page(pa));
+	if (e->env_ring) {
+		page_decref(pa2page(PADDR(e->env_ring)));
+		e->env_ring = NULL;
 	}
-	// free the page directory pointer
-	page_decref(pa2page(PTE_ADDR(e->env_pml4e[0])));
-
-	// free the PML4
-	pa = PADDR(e->env_pml4e);
-	e->env_pml4e = 0;
-	page_decref(pa2page(pa));
+	fpu_env_free(e);
+	env_free_vm(e);
 
 	// return the environment to the free list
 	e->env_status = ENV_FREE;
@@ -675,7 +1047,21 @@ env_run(struct Env *e)
     curenv->env_status = ENV_RUNNING;
     curenv->env_runs++;
     
-    lcr3(PADDR(curenv->env_pml4e));
+    tlb_flush();
+    // The FPU registers stay loaded while the same env keeps running
+    // here; anyone else gets them lazily (fpu_trap).
+    if (thiscpu->cpu_fpu_owner != curenv)
+        fpu_release();
+    pml4e_load(curenv->env_pml4e);
+    // traps from user mode build their Trapframe right in e->env_tf,
+    // so trap() needn't copy it there
+    thiscpu->cpu_syscall.sc_tf = (uintptr_t) (&curenv->env_tf + 1);
+    thiscpu->cpu_ts.RSP[0] = thiscpu->cpu_syscall.sc_tf;
+    // user code finds its own Env through the GS base (thisenv)
+    wrmsr(GSBASE_MSR, UENVS + ENVX(curenv->env_id) * sizeof(struct Env));
+    uinfo->ui_cpu[cpunum()].uc_env = curenv->env_id;
+    uinfo->ui_cpu[cpunum()].uc_runs++;
+    xchg(&thiscpu->cpu_tlb_user, 1);
 
 	unlock_kernel();
     env_pop_tf(&curenv->env_tf);
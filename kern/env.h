@@ -4,17 +4,35 @@
 #define JOS_KERN_ENV_H
 
 #include <inc/env.h>
+#include <inc/uinfo.h>
 #include <kern/cpu.h>
 
 extern struct Env *envs;		// All environments
+extern struct UInfo *uinfo;		// Mapped read-only at UINFO
 #define curenv (thiscpu->cpu_env)		// Current environment
 extern struct Segdesc gdt[];
 
+// A program image embedded in the kernel (see KERN_BINFILES in
+// kern/Makefrag, which generates the env_binaries table)
+struct EnvBinary {
+	const char *eb_name;		// File name, without the user/
+	uint8_t *eb_image;		// The ELF image (_binary_obj_*_start)
+};
+extern const struct EnvBinary env_binaries[];	// Ends with a NULL name
+
 void	env_init(void);
 void	env_init_percpu(void);
+void	uinfo_init(void);
 int	env_alloc(struct Env **e, envid_t parent_id);
 void	env_free(struct Env *e);
+int	env_copy_cow(struct Env *child, struct Env *parent);
+void	env_share_vm(struct Env *e, struct Env *owner);
+int	env_load_page(struct Env *e, uintptr_t va);
+int	env_image_unmap(struct Env *e, uintptr_t va, size_t len);
+int	env_image_copy(struct Env *child, struct Env *parent);
 void	env_create(uint8_t *binary, enum EnvType type);
+int	env_spawn(struct Env **newenv_store, uint8_t *binary, envid_t parent_id);
+uint8_t *env_binary_lookup(const char *name);
 void	env_destroy(struct Env *e);	// Does not return if e == curenv
 
 int	envid2env(envid_t envid, struct Env **env_store, bool checkperm);
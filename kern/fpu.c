@@ -0,0 +1,194 @@
+/* See COPYRIGHT for copyright information. */
+
+#include <inc/x86.h>
+#include <inc/mmu.h>
+#include <inc/error.h>
+#include <inc/string.h>
+#include <inc/assert.h>
+
+#include <kern/fpu.h>
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/cpu.h>
+
+// Lazy FPU/SSE/AVX context switching.
+//
+// An env's FPU state is kept in a page of its own (env_fpu), allocated
+// the first time the env uses the FPU, except while the env is some
+// CPU's cpu_fpu_owner: then it is in that CPU's registers.  CR0.TS is
+// set exactly when a CPU has no owner, so the first FPU instruction of
+// any other env traps with T_DEVICE, and fpu_trap() loads its state.
+// An env that never touches the FPU never traps and never has anything
+// saved or restored.
+//
+// env_run leaves the registers alone if it runs the owner again, e.g.
+// after a system call or a timer tick that didn't switch envs.  When
+// it runs a different env, or the CPU goes idle, the owner's state is
+// saved (fpu_release): the owner may run next on another CPU, which
+// can't get at these registers.
+//
+// With XSAVE, the x87, SSE and AVX state is saved, with XSAVEOPT when
+// the CPU has it (it skips what hasn't changed since the XRSTOR that
+// loaded it).  Without XSAVE, FXSAVE saves the x87 and SSE state.
+// The kernel is built with -mno-sse, so it never touches any of it.
+
+// XCR0 state components
+#define XCR0_X87	0x1
+#define XCR0_SSE	0x2
+#define XCR0_AVX	0x4
+
+// Fields of the legacy (FXSAVE) region at the start of the area
+#define FPU_FCW		0	// x87 control word
+#define FPU_MXCSR	24	// SSE control and status
+
+#define FCW_INIT	0x037f	// All x87 exceptions masked
+#define MXCSR_INIT	0x1f80	// All SSE exceptions masked
+
+static uint64_t fpu_xcr0;	// Components XSAVE saves; 0 for FXSAVE
+static bool fpu_xsaveopt;	// The CPU has XSAVEOPT
+
+static void
+fpu_save(void *area)
+{
+	uint32_t lo = fpu_xcr0, hi = fpu_xcr0 >> 32;
+
+	if (fpu_xsaveopt)
+		asm volatile("xsaveopt64 (%0)" : : "r" (area), "a" (lo), "d" (hi) : "memory");
+	else if (fpu_xcr0)
+		asm volatile("xsave64 (%0)" : : "r" (area), "a" (lo), "d" (hi) : "memory");
+	else
+		asm volatile("fxsave64 (%0)" : : "r" (area) : "memory");
+}
+
+static void
+fpu_restore(void *area)
+{
+	uint32_t lo = fpu_xcr0, hi = fpu_xcr0 >> 32;
+
+	if (fpu_xcr0)
+		asm volatile("xrstor64 (%0)" : : "r" (area), "a" (lo), "d" (hi) : "memory");
+	else
+		asm volatile("fxrstor64 (%0)" : : "r" (area) : "memory");
+}
+
+// Allocate a page for an FPU save area, holding the state of a freshly
+// initialized FPU.  With XSAVE, the all-zero header marks every
+// component as in its initial state, but MXCSR is always loaded.
+static void *
+fpu_area_alloc(void)
+{
+	struct PageInfo *pp;
+	uint8_t *area;
+
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+		return NULL;
+	pp->pp_ref++;
+	area = page2kva(pp);
+	*(uint16_t *) (area + FPU_FCW) = FCW_INIT;
+	*(uint32_t *) (area + FPU_MXCSR) = MXCSR_INIT;
+	return area;
+}
+
+//
+// Turn on SSE and, if the CPU has it, XSAVE for x87, SSE and AVX state
+// on this CPU, and set CR0.TS so the first FPU instruction traps.
+// The boot CPU must call this before the others.
+//
+void
+fpu_init(void)
+{
+	uint32_t eax, ebx, ecx, edx;
+
+	if (cpunum() == 0) {
+		cpuid(1, NULL, NULL, &ecx, NULL);
+		if (ecx & (1 << 26)) {		// CPUID.01H:ECX.XSAVE
+			cpuid_count(0xd, 0, &eax, NULL, NULL, &edx);
+			fpu_xcr0 = (((uint64_t) edx << 32) | eax)
+				& (XCR0_X87 | XCR0_SSE | XCR0_AVX);
+			cpuid_count(0xd, 1, &eax, NULL, NULL, NULL);
+			fpu_xsaveopt = eax & 1;	// CPUID.(0DH,1):EAX.XSAVEOPT
+		} else
+			cprintf("FPU: no XSAVE, saving with FXSAVE\n");
+	}
+
+	lcr4(rcr4() | CR4_OSFXSR | CR4_OSXMMEXCPT | (fpu_xcr0 ? CR4_OSXSAVE : 0));
+	if (fpu_xcr0) {
+		xsetbv(0, fpu_xcr0);
+		cpuid_count(0xd, 0, NULL, &ebx, NULL, NULL);
+		assert(ebx <= PGSIZE);		// save area size for XCR0
+	}
+	lcr0((rcr0() & ~CR0_EM) | CR0_MP | CR0_NE | CR0_TS);
+	thiscpu->cpu_fpu_owner = NULL;
+}
+
+//
+// Save this CPU's FPU owner's state to its env_fpu and set CR0.TS,
+// so the next env to use the FPU here traps.
+//
+void
+fpu_release(void)
+{
+	struct Env *owner = thiscpu->cpu_fpu_owner;
+
+	if (!owner)
+		return;
+	fpu_save(owner->env_fpu);
+	thiscpu->cpu_fpu_owner = NULL;
+	lcr0(rcr0() | CR0_TS);
+}
+
+//
+// Handle a T_DEVICE trap from 'e', the current env: it used the FPU
+// while CR0.TS was set.  Load its FPU state (a fresh one, the first
+// time) and make it the owner.  Destroys e if there is no memory for
+// its state.
+//
+void
+fpu_trap(struct Env *e)
+{
+	if (!e->env_fpu && !(e->env_fpu = fpu_area_alloc())) {
+		cprintf("[%08x] no memory for FPU state\n", e->env_id);
+		env_destroy(e);
+		return;
+	}
+	fpu_release();
+	clts();
+	fpu_restore(e->env_fpu);
+	thiscpu->cpu_fpu_owner = e;
+}
+
+//
+// Give 'dst' a copy of the FPU state of 'src', which is curenv, e.g.
+// for fork.  Returns 0 on success, -E_NO_MEM if out of memory.
+//
+int
+fpu_env_copy(struct Env *dst, struct Env *src)
+{
+	if (!src->env_fpu)
+		return 0;
+	if (!dst->env_fpu && !(dst->env_fpu = fpu_area_alloc()))
+		return -E_NO_MEM;
+	if (thiscpu->cpu_fpu_owner == src)
+		fpu_save(src->env_fpu);
+	memcpy(dst->env_fpu, src->env_fpu, PGSIZE);
+	return 0;
+}
+
+//
+// Free e's FPU state.  If its state is loaded on this CPU, just forget
+// it.  (It can't be loaded on another CPU: only the env running there,
+// or the one that last ran before an env_run or sched_halt, is an
+// owner, and a running env is freed by its own CPU.)
+//
+void
+fpu_env_free(struct Env *e)
+{
+	if (thiscpu->cpu_fpu_owner == e) {
+		thiscpu->cpu_fpu_owner = NULL;
+		lcr0(rcr0() | CR0_TS);
+	}
+	if (e->env_fpu) {
+		page_decref(pa2page(PADDR(e->env_fpu)));
+		e->env_fpu = NULL;
+	}
+}
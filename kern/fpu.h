@@ -0,0 +1,17 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_FPU_H
+#define JOS_KERN_FPU_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/env.h>
+
+void	fpu_init(void);
+void	fpu_release(void);
+void	fpu_trap(struct Env *e);
+int	fpu_env_copy(struct Env *dst, struct Env *src);
+void	fpu_env_free(struct Env *e);
+
+#endif	// !JOS_KERN_FPU_H
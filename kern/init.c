@@ -14,13 +14,17 @@
 #include <kern/picirq.h>
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
+#include <kern/bootinfo.h>
+#include <kern/kmalloc.h>
+#include <kern/fpu.h>
 
 static void boot_aps(void);
 
 
 void
-i386_init(void* rsdp)
+i386_init(struct BootInfo *bootinfo)
 {
+	void *rsdp;
 
 	extern char edata[], end[];
 
@@ -35,12 +39,18 @@ i386_init(void* rsdp)
 
 	cprintf("444544 decimal is %o octal!\n", 444544);
 
+	// The bootloader's data is only reachable until mem_init()
+	// switches away from entry_pml4e.
+	rsdp = bootinfo ? bootinfo->bi_rsdp : NULL;
+
 	// Lab 2 memory management initialization functions
-	mem_init();
+	mem_init(bootinfo);
+	kmem_init();
 
 	// Lab 3 user environment initialization functions
 	env_init();
 	trap_init();
+	fpu_init();
 
 	// Lab 4 multiprocessor initialization functions
 	mp_init(rsdp);
@@ -48,6 +58,7 @@ i386_init(void* rsdp)
 
 	// Lab 4 multitasking initialization functions
 	pic_init();
+	uinfo_init();
 
 	// Acquire the big kernel lock before waking up APs
 	// Your code here:
@@ -108,11 +119,13 @@ mp_main(void)
 {
 	// We are in high EIP now, safe to switch to kern_pgdir 
 	lcr3(PADDR(kern_pml4));
+	tlb_init();
 	cprintf("SMP: CPU %d starting\n", cpunum());
 
 	lapic_init();
 	env_init_percpu();
 	trap_init_percpu();
+	fpu_init();
 	xchg(&thiscpu->cpu_status, CPU_STARTED); // tell boot_aps() we're up
 
 	// Now that we have finished some basic setup, call sched_yield()
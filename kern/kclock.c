@@ -20,3 +20,27 @@ mc146818_write(unsigned reg, unsigned datum)
 	outb(IO_RTC, reg);
 	outb(IO_RTC+1, datum);
 }
+
+// Measure the TSC frequency against PIT channel 2 over 10ms.
+// Returns TSC ticks per second, or 0 if the PIT never counted down.
+uint64_t
+tsc_calibrate(void)
+{
+	unsigned count = PIT_HZ / 100;
+	uint64_t t0, t1;
+	int i;
+
+	// gate channel 2 on, speaker off; mode 0, binary, lo then hi byte
+	outb(0x61, (inb(0x61) & ~0x02) | 0x01);
+	outb(IO_PIT+3, 0xb0);
+	outb(IO_PIT+2, count & 0xff);
+	outb(IO_PIT+2, count >> 8);
+
+	// OUT2 (bit 5 of port 0x61) goes high at the terminal count
+	t0 = read_tsc();
+	for (i = 0; !(inb(0x61) & 0x20); i++)
+		if (i == 10000000)
+			return 0;
+	t1 = read_tsc();
+	return (t1 - t0) * 100;
+}
@@ -0,0 +1,362 @@
+/* See COPYRIGHT for copyright information. */
+
+#include <inc/assert.h>
+#include <inc/string.h>
+#include <inc/error.h>
+
+#include <kern/kmalloc.h>
+#include <kern/pmap.h>
+
+// Slab allocator for small kernel objects.
+//
+// Every slab is one page from page_alloc.  It starts with a struct
+// Slab header; the rest of the page is cut into kc_perslab objects.
+// Free objects inside a slab are chained through their first word.
+// Since a slab is exactly one aligned page, the slab (and so the
+// cache) an object belongs to is found by rounding its address down to
+// a page boundary.
+//
+// kmalloc() serves sizes up to KMALLOC_MAX from power-of-two caches.
+// Larger requests get a block of whole pages from page_alloc_order(),
+// which has a header of the same shape with sl_cache == NULL.
+
+struct Slab {
+	struct KmemCache *sl_cache;	// Owning cache; NULL for big kmallocs
+	struct Slab *sl_next;		// Link on the cache's slab lists
+	struct Slab *sl_prev;
+	void *sl_free;			// Free objects in this slab
+	int sl_inuse;			// Objects allocated from this slab
+	int sl_order;			// Big kmalloc: pages are 2^sl_order
+};
+
+#define KMEM_ALIGN	16		// Alignment of every object
+#define SLAB_HDRSIZE	ROUNDUP(sizeof(struct Slab), KMEM_ALIGN)
+
+#define KMALLOC_MIN_SHIFT	4	// Smallest kmalloc cache: 16 bytes
+#define KMALLOC_MAX_SHIFT	10	// Largest kmalloc cache: 1KB
+#define KMALLOC_MAX		(1 << KMALLOC_MAX_SHIFT)
+
+static struct KmemCache kmem_cache_cache;	// Cache of KmemCaches
+static struct KmemCache *kmalloc_caches[KMALLOC_MAX_SHIFT + 1];
+static struct KmemCache *kmem_caches;		// All caches, for stats
+static struct spinlock kmem_caches_lock;	// Protects kmem_caches
+
+static void check_kmalloc(void);
+
+static inline struct Slab *
+obj2slab(void *obj)
+{
+	return (struct Slab *) ROUNDDOWN(obj, PGSIZE);
+}
+
+static void
+slab_list_add(struct Slab **list, struct Slab *sl)
+{
+	sl->sl_prev = NULL;
+	sl->sl_next = *list;
+	if (*list)
+		(*list)->sl_prev = sl;
+	*list = sl;
+}
+
+static void
+slab_list_del(struct Slab **list, struct Slab *sl)
+{
+	if (sl->sl_prev)
+		sl->sl_prev->sl_next = sl->sl_next;
+	else
+		*list = sl->sl_next;
+	if (sl->sl_next)
+		sl->sl_next->sl_prev = sl->sl_prev;
+	sl->sl_next = sl->sl_prev = NULL;
+}
+
+// The list a slab with 'inuse' allocated objects belongs on.
+static struct Slab **
+slab_list_for(struct KmemCache *cache, int inuse)
+{
+	if (inuse == 0)
+		return &cache->kc_empty;
+	if (inuse == cache->kc_perslab)
+		return &cache->kc_full;
+	return &cache->kc_partial;
+}
+
+// Get a page for a new slab and put all its objects on its free list.
+// The caller must hold cache->kc_lock.
+static struct Slab *
+slab_create(struct KmemCache *cache)
+{
+	struct PageInfo *pp;
+	struct Slab *sl;
+	char *obj;
+	int i;
+
+	if (!(pp = page_alloc(0)))
+		return NULL;
+	sl = page2kva(pp);
+	sl->sl_cache = cache;
+	sl->sl_inuse = 0;
+	sl->sl_order = 0;
+	sl->sl_free = NULL;
+	obj = (char *) sl + SLAB_HDRSIZE + (cache->kc_perslab - 1) * cache->kc_objsize;
+	for (i = 0; i < cache->kc_perslab; i++, obj -= cache->kc_objsize) {
+		*(void **) obj = sl->sl_free;
+		sl->sl_free = obj;
+	}
+	cache->kc_nslabs++;
+	slab_list_add(&cache->kc_empty, sl);
+	return sl;
+}
+
+// Move up to 'n' free objects from the cache's slabs into 'objs'.
+// Partially used slabs are drained first, to keep the number of
+// slabs in use low.  Returns the number of objects moved.
+static int
+slab_alloc_batch(struct KmemCache *cache, void **objs, int n)
+{
+	struct Slab *sl;
+	int got = 0;
+
+	spin_lock(&cache->kc_lock);
+	while (got < n) {
+		if (!(sl = cache->kc_partial) && !(sl = cache->kc_empty)
+		    && !(sl = slab_create(cache)))
+			break;
+		slab_list_del(slab_list_for(cache, sl->sl_inuse), sl);
+		while (got < n && sl->sl_free) {
+			objs[got++] = sl->sl_free;
+			sl->sl_free = *(void **) sl->sl_free;
+			sl->sl_inuse++;
+		}
+		slab_list_add(slab_list_for(cache, sl->sl_inuse), sl);
+	}
+	cache->kc_inuse += got;
+	spin_unlock(&cache->kc_lock);
+	return got;
+}
+
+// Give 'n' objects back to their slabs.  Only one completely free slab
+// is kept around per cache; the pages of any others are freed.
+static void
+slab_free_batch(struct KmemCache *cache, void **objs, int n)
+{
+	struct Slab *sl;
+	int i;
+
+	spin_lock(&cache->kc_lock);
+	for (i = 0; i < n; i++) {
+		sl = obj2slab(objs[i]);
+		assert(sl->sl_cache == cache);
+		slab_list_del(slab_list_for(cache, sl->sl_inuse), sl);
+		*(void **) objs[i] = sl->sl_free;
+		sl->sl_free = objs[i];
+		sl->sl_inuse--;
+		if (sl->sl_inuse == 0 && cache->kc_empty) {
+			cache->kc_nslabs--;
+			page_free(pa2page(PADDR(sl)));
+			continue;
+		}
+		slab_list_add(slab_list_for(cache, sl->sl_inuse), sl);
+	}
+	cache->kc_inuse -= n;
+	spin_unlock(&cache->kc_lock);
+}
+
+static void
+kmem_cache_init(struct KmemCache *cache, const char *name, size_t size)
+{
+	memset(cache, 0, sizeof(*cache));
+	cache->kc_name = name;
+	cache->kc_objsize = ROUNDUP(MAX(size, sizeof(void *)), KMEM_ALIGN);
+	cache->kc_perslab = (PGSIZE - SLAB_HDRSIZE) / cache->kc_objsize;
+	spin_initlock(&cache->kc_lock);
+
+	spin_lock(&kmem_caches_lock);
+	cache->kc_next = kmem_caches;
+	kmem_caches = cache;
+	spin_unlock(&kmem_caches_lock);
+}
+
+//
+// Create a cache of objects of 'size' bytes, each aligned to
+// KMEM_ALIGN.  'size' may be at most a little under PGSIZE; use
+// kmalloc() for anything bigger.
+// Returns NULL if out of memory.
+//
+struct KmemCache *
+kmem_cache_create(const char *name, size_t size)
+{
+	struct KmemCache *cache;
+
+	assert(size > 0 && size <= PGSIZE - SLAB_HDRSIZE);
+	if (!(cache = kmem_cache_alloc(&kmem_cache_cache)))
+		return NULL;
+	kmem_cache_init(cache, name, size);
+	return cache;
+}
+
+//
+// Allocate an object from 'cache'.  Its contents are undefined.
+// Returns NULL if out of memory.
+//
+void *
+kmem_cache_alloc(struct KmemCache *cache)
+{
+	int id = cpunum();
+	int n;
+
+	if (cache->kc_cpu[id].count == 0) {
+		n = slab_alloc_batch(cache, cache->kc_cpu[id].objs, KMEM_CPU_BATCH);
+		if (n == 0)
+			return NULL;
+		cache->kc_cpu[id].count = n;
+	}
+	cache->kc_allocs++;
+	return cache->kc_cpu[id].objs[--cache->kc_cpu[id].count];
+}
+
+//
+// Return 'obj', allocated from 'cache', to it.
+//
+void
+kmem_cache_free(struct KmemCache *cache, void *obj)
+{
+	int id = cpunum();
+
+	if (cache->kc_cpu[id].count == KMEM_CPU_MAX) {
+		cache->kc_cpu[id].count -= KMEM_CPU_BATCH;
+		slab_free_batch(cache, &cache->kc_cpu[id].objs[cache->kc_cpu[id].count],
+				KMEM_CPU_BATCH);
+	}
+	cache->kc_cpu[id].objs[cache->kc_cpu[id].count++] = obj;
+}
+
+//
+// Allocate 'size' bytes of kernel memory, aligned to KMEM_ALIGN.
+// Returns NULL if out of memory.
+//
+void *
+kmalloc(size_t size)
+{
+	struct PageInfo *pp;
+	struct Slab *sl;
+	int shift, order;
+
+	if (size <= KMALLOC_MAX) {
+		for (shift = KMALLOC_MIN_SHIFT; (1 << shift) < size; shift++)
+			/* do nothing */;
+		return kmem_cache_alloc(kmalloc_caches[shift]);
+	}
+
+	for (order = 0; (PGSIZE << order) < size + SLAB_HDRSIZE; order++)
+		/* do nothing */;
+	if (!(pp = page_alloc_order(order, 0)))
+		return NULL;
+	sl = page2kva(pp);
+	sl->sl_cache = NULL;
+	sl->sl_order = order;
+	return (char *) sl + SLAB_HDRSIZE;
+}
+
+//
+// Free memory returned by kmalloc().
+//
+void
+kfree(void *obj)
+{
+	struct Slab *sl;
+
+	if (obj == NULL)
+		return;
+	sl = obj2slab(obj);
+	if (sl->sl_cache)
+		kmem_cache_free(sl->sl_cache, obj);
+	else
+		page_free_order(pa2page(PADDR(sl)), sl->sl_order);
+}
+
+//
+// Print object and slab counts for every cache.
+//
+void
+kmem_print_stats(void)
+{
+	struct KmemCache *cache;
+
+	cprintf("cache            objsize  inuse  slabs  allocs\n");
+	spin_lock(&kmem_caches_lock);
+	for (cache = kmem_caches; cache; cache = cache->kc_next)
+		cprintf("%-16s %7d %6ld %6ld %7ld\n", cache->kc_name,
+			cache->kc_objsize, cache->kc_inuse, cache->kc_nslabs,
+			cache->kc_allocs);
+	spin_unlock(&kmem_caches_lock);
+}
+
+//
+// Set up the cache of caches and the kmalloc size classes.
+// Must be called after mem_init().
+//
+void
+kmem_init(void)
+{
+	static const char *names[] = {
+		[4] = "kmalloc-16", [5] = "kmalloc-32", [6] = "kmalloc-64",
+		[7] = "kmalloc-128", [8] = "kmalloc-256", [9] = "kmalloc-512",
+		[10] = "kmalloc-1024",
+	};
+	int shift;
+
+	static_assert(sizeof(names) / sizeof(names[0]) == KMALLOC_MAX_SHIFT + 1);
+
+	spin_initlock(&kmem_caches_lock);
+	kmem_cache_init(&kmem_cache_cache, "kmem_cache", sizeof(struct KmemCache));
+	for (shift = KMALLOC_MIN_SHIFT; shift <= KMALLOC_MAX_SHIFT; shift++)
+		if (!(kmalloc_caches[shift] = kmem_cache_create(names[shift], 1 << shift)))
+			panic("kmem_init: out of memory");
+
+	check_kmalloc();
+}
+
+
+// --------------------------------------------------------------
+// Checking functions.
+// --------------------------------------------------------------
+
+static void
+check_kmalloc(void)
+{
+	static void *objs[200];
+	struct KmemCache *cache;
+	char *big;
+	int i, j;
+
+	// objects are distinct, aligned and usable
+	for (i = 0; i < 200; i++) {
+		assert((objs[i] = kmalloc(24)));
+		assert(((uintptr_t) objs[i] & (KMEM_ALIGN - 1)) == 0);
+		memset(objs[i], i, 24);
+	}
+	for (i = 0; i < 200; i++)
+		for (j = 0; j < 24; j++)
+			assert(((unsigned char *) objs[i])[j] == (unsigned char) i);
+	for (i = 0; i < 200; i++)
+		kfree(objs[i]);
+	assert(kmalloc_caches[5]->kc_inuse <= KMEM_CPU_MAX);
+
+	// big allocations come straight from the page allocator
+	assert((big = kmalloc(3 * PGSIZE)));
+	memset(big, 0xAB, 3 * PGSIZE);
+	kfree(big);
+
+	// typed caches
+	assert((cache = kmem_cache_create("check_kmalloc", 100)));
+	assert(cache->kc_objsize == 112);
+	for (i = 0; i < 100; i++)
+		assert((objs[i] = kmem_cache_alloc(cache)));
+	assert(cache->kc_nslabs >= 100 / cache->kc_perslab);
+	for (i = 0; i < 100; i++)
+		kmem_cache_free(cache, objs[i]);
+
+	cprintf("check_kmalloc() succeeded!\n");
+}
@@ -0,0 +1,51 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_KMALLOC_H
+#define JOS_KERN_KMALLOC_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
+
+// Objects each CPU keeps cached per KmemCache, and how many move
+// between a CPU's cache and the cache's slabs at a time.
+#define KMEM_CPU_MAX	32
+#define KMEM_CPU_BATCH	16
+
+// A cache of equally sized kernel objects, carved out of one-page slabs
+// (see kern/kmalloc.c).  Each CPU keeps a small stack of free objects
+// in front of the slabs, so the common kmem_cache_alloc/free doesn't
+// take kc_lock.
+struct KmemCache {
+	const char *kc_name;
+	size_t kc_objsize;		// Object size, rounded up for alignment
+	int kc_perslab;			// Objects that fit in one slab
+
+	struct spinlock kc_lock;	// Protects everything below
+	struct Slab *kc_partial;	// Slabs with some objects free
+	struct Slab *kc_full;		// Slabs with no objects free
+	struct Slab *kc_empty;		// Slabs with every object free
+	uint64_t kc_nslabs;		// Slabs (pages) this cache owns
+	uint64_t kc_allocs;		// Objects handed out over all time
+	uint64_t kc_inuse;		// Objects not in a slab's free list
+
+	struct {
+		void *objs[KMEM_CPU_MAX];
+		int count;
+	} kc_cpu[NCPU];
+
+	struct KmemCache *kc_next;	// Next cache on kmem_caches
+};
+
+void	kmem_init(void);
+struct KmemCache *kmem_cache_create(const char *name, size_t size);
+void *	kmem_cache_alloc(struct KmemCache *cache);
+void	kmem_cache_free(struct KmemCache *cache, void *obj);
+void *	kmalloc(size_t size);
+void	kfree(void *obj);
+void	kmem_print_stats(void);
+
+#endif	// !JOS_KERN_KMALLOC_H
@@ -13,6 +13,7 @@
 #include <kern/trap.h>
 
 #include <kern/pmap.h>
+#include <kern/kmalloc.h>
 
 #define CMDBUF_SIZE	80	// enough for one VGA text line
 
@@ -29,6 +30,8 @@ static struct Command commands[] = {
 	{ "help", "Display this list of commands", mon_help },
 	{ "kerninfo", "Display information about the kernel", mon_kerninfo },
 	{ "backtrace", "Display a stack backtrace", mon_backtrace },
+	{ "buddyinfo", "Display physical page allocator statistics", mon_buddyinfo },
+	{ "kmeminfo", "Display kernel object cache statistics", mon_kmeminfo },
 };
 
 /***** Implementations of basic kernel monitor commands *****/
@@ -88,6 +91,20 @@ mon_backtrace(int argc, char **argv, struct Trapframe *tf)
 	return 0;
 }
 
+int
+mon_buddyinfo(int argc, char **argv, struct Trapframe *tf)
+{
+	page_print_stats();
+	return 0;
+}
+
+int
+mon_kmeminfo(int argc, char **argv, struct Trapframe *tf)
+{
+	kmem_print_stats();
+	return 0;
+}
+
 
 
 /***** Kernel monitor command interpreter *****/
@@ -10,15 +10,75 @@
 #include <kern/kclock.h>
 #include <kern/env.h>
 #include <kern/cpu.h>
+#include <kern/spinlock.h>
+#include <kern/bootinfo.h>
 
 // These variables are set by i386_detect_memory()
 size_t npages;			// Amount of physical memory (in pages)
-static size_t npages_basemem;	// Amount of base memory (in pages)
+
+// Usable physical memory, as [mr_start, mr_end) byte ranges.  Filled
+// in by i386_detect_memory() from the UEFI memory map (or from CMOS if
+// the bootloader didn't pass one); page_init() frees exactly these
+// pages, minus the ones the kernel itself is using.
+#define MAX_MEM_RANGES	128
+static struct MemRange {
+	physaddr_t mr_start;
+	physaddr_t mr_end;
+} mem_ranges[MAX_MEM_RANGES];
+static int nmem_ranges;
+
+// entry_pml4e (kern/entrypgdir.c) maps only this much physical memory
+// at KERNBASE.  Pages above it aren't handed to the page allocator until
+// mem_init() has switched to kern_pml4, which maps all of them.
+#define BOOTMAP_LIMIT	0x40000000
+
+// Number of 4KB, 2MB and 1GB mappings boot_map_region() has made
+static size_t boot_map_leaves[3];
 
 // These variables are set in mem_init()
 pml4e_t *kern_pml4;		// Kernel's initial page directory
 struct PageInfo *pages;		// Physical page state array
-static struct PageInfo *page_free_list;	// Free list of physical pages
+
+// Free physical memory is managed by a binary buddy allocator.
+// free_area[k] lists the free blocks of 2^k contiguous, naturally
+// aligned pages; a freed block is merged with its buddy whenever the
+// buddy is free too.  All state lives in the 'pages' array itself.
+static struct FreeArea {
+	struct PageInfo *fa_list;	// Free blocks of this order
+	size_t fa_nfree;		// Number of blocks on fa_list
+} free_area[PAGE_MAX_ORDER + 1];
+
+// Allocation statistics, per order, for the buddy allocator.
+static struct BuddyStats {
+	uint64_t bs_allocs;		// Successful allocations
+	uint64_t bs_fails;		// Failed allocations
+	uint64_t bs_cycles;		// TSC cycles spent in all allocations
+	uint64_t bs_max_cycles;		// Slowest single allocation
+} buddy_stats[PAGE_MAX_ORDER + 1];
+
+// Per-CPU page caches (thiscpu->cpu_pcp_list) sit in front of the
+// buddy allocator for single pages.  A CPU refills its cache
+// PCP_BATCH pages at a time, and hands PCP_BATCH pages back once it
+// is holding more than PCP_HIGH, so the common case of page_alloc and
+// page_free never touches free_area or page_lock.
+#define PCP_BATCH	16
+#define PCP_HIGH	64
+
+// Pool of free pages that are already zero-filled.  CPUs with nothing
+// to run top it up from sched_halt() (see page_zero_idle), so that
+// page_alloc(ALLOC_ZERO) can usually just pop a page instead of
+// clearing one on the caller's time.
+#define ZERO_BATCH	32	// Pages zeroed per page_zero_idle() call
+#define ZERO_HIGH	512	// Stop zeroing once the pool holds this many
+
+static struct PageInfo *page_zero_list;	// Zero-filled free pages
+static int page_zero_count;		// Number of pages on page_zero_list
+static uint64_t page_zero_hits;		// ALLOC_ZERO served from the pool
+static uint64_t page_zero_misses;	// ALLOC_ZERO that had to memset
+
+static struct spinlock page_lock;	// Protects free_area, buddy_stats
+					// and page_zero_list
+static bool pcp_enabled;		// Set once the boot checks are done
 
 
 // --------------------------------------------------------------
@@ -31,31 +91,108 @@ nvram_read(int r)
 	return mc146818_read(r) | (mc146818_read(r + 1) << 8);
 }
 
+// Record [start, end) as usable memory, merging it with the previous
+// range when the two are adjacent.
+static void
+mem_range_add(physaddr_t start, physaddr_t end)
+{
+	if (start >= end)
+		return;
+	if (nmem_ranges > 0 && mem_ranges[nmem_ranges - 1].mr_end == start) {
+		mem_ranges[nmem_ranges - 1].mr_end = end;
+		return;
+	}
+	if (nmem_ranges == MAX_MEM_RANGES) {
+		cprintf("mem_range_add: too many ranges, dropping [%lx, %lx)\n",
+			start, end);
+		return;
+	}
+	mem_ranges[nmem_ranges].mr_start = start;
+	mem_ranges[nmem_ranges].mr_end = end;
+	nmem_ranges++;
+}
+
+// Whether memory of UEFI type 'type' is ours once boot services have
+// exited.  Loader code/data hold the bootloader and the memory map,
+// which we're done with once i386_detect_memory() has read it; the
+// kernel image itself is kept out of the free pages by page_init().
+static bool
+efi_type_usable(uint32_t type)
+{
+	switch (type) {
+	case EFI_LOADER_CODE:
+	case EFI_LOADER_DATA:
+	case EFI_BOOT_SERVICES_CODE:
+	case EFI_BOOT_SERVICES_DATA:
+	case EFI_CONVENTIONAL_MEMORY:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
 static void
-i386_detect_memory(void)
+i386_detect_memory(struct BootInfo *bootinfo)
 {
 	size_t basemem, extmem, ext16mem, totalmem;
+	size_t maxpages;
+	struct EfiMemDesc *md;
+	char *map, *map_end;
+	physaddr_t top = 0;
+	int i;
 
-	// Use CMOS calls to measure available base & extended memory.
-	// (CMOS calls return results in kilobytes.)
-	basemem = nvram_read(NVRAM_BASELO);
-	extmem = nvram_read(NVRAM_EXTLO);
-	ext16mem = nvram_read(NVRAM_EXT16LO) * 64;
-
-	// Calculate the number of physical pages available in both base
-	// and extended memory.
-	if (ext16mem)
-		totalmem = 16 * 1024 + ext16mem;
-	else if (extmem)
-		totalmem = 1 * 1024 + extmem;
-	else
-		totalmem = basemem;
+	if (bootinfo && bootinfo->bi_mem_map) {
+		// entry_pml4e identity-maps low memory, which is where the
+		// bootloader left its bootinfo and memory map.
+		map = bootinfo->bi_mem_map;
+		map_end = map + bootinfo->bi_map_size;
+		for (; map < map_end; map += bootinfo->bi_map_desc_size) {
+			md = (struct EfiMemDesc *) map;
+			if (!efi_type_usable(md->md_type))
+				continue;
+			mem_range_add(md->md_phys_start,
+				      md->md_phys_start + md->md_npages * PGSIZE);
+		}
+	} else {
+		// Use CMOS calls to measure available base & extended memory.
+		// (CMOS calls return results in kilobytes.)
+		basemem = nvram_read(NVRAM_BASELO);
+		extmem = nvram_read(NVRAM_EXTLO);
+		ext16mem = nvram_read(NVRAM_EXT16LO) * 64;
+
+		// Calculate the number of physical pages available in both base
+		// and extended memory.
+		if (ext16mem)
+			totalmem = 16 * 1024 + ext16mem;
+		else if (extmem)
+			totalmem = 1 * 1024 + extmem;
+		else
+			totalmem = basemem;
+
+		mem_range_add(0, basemem * 1024);
+		mem_range_add(EXTPHYSMEM, totalmem * 1024);
+	}
 
-	npages = totalmem / (PGSIZE / 1024);
-	npages_basemem = basemem / (PGSIZE / 1024);
+	for (i = 0; i < nmem_ranges; i++)
+		top = MAX(top, mem_ranges[i].mr_end);
+	npages = top / PGSIZE;
+
+	// The pages array has to fit in the UPAGES window.
+	maxpages = (ULIM - UPAGES) / sizeof(struct PageInfo);
+	if (npages > maxpages) {
+		cprintf("Physical memory: ignoring %uK above %uK\n",
+			(npages - maxpages) * (PGSIZE / 1024),
+			maxpages * (PGSIZE / 1024));
+		npages = maxpages;
+	}
 
-	cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
-		totalmem, basemem, totalmem - basemem);
+	totalmem = 0;
+	for (i = 0; i < nmem_ranges; i++)
+		if (mem_ranges[i].mr_start < npages * PGSIZE)
+			totalmem += MIN(mem_ranges[i].mr_end, npages * PGSIZE)
+				- mem_ranges[i].mr_start;
+	cprintf("Physical memory: %uK available in %d ranges, top = %uK\n",
+		totalmem / 1024, nmem_ranges, npages * (PGSIZE / 1024));
 }
 
 
@@ -64,6 +201,9 @@ i386_detect_memory(void)
 // --------------------------------------------------------------
 
 static void mem_init_mp(void);
+static void buddy_free(struct PageInfo *pp, int order);
+static void page_init_high(void);
+static void page_free_range(size_t lo, size_t hi);
 static void boot_map_region(pml4e_t *pml4e, uintptr_t va, size_t size, physaddr_t pa, int perm);
 static void check_page_free_list(bool only_low_memory);
 static void check_page_alloc(void);
@@ -71,6 +211,8 @@ static void check_kern_pml4e(void);
 static physaddr_t check_va2pa(pml4e_t *pml4e, uintptr_t va);
 static void check_page(void);
 static void check_page_installed_pml4e(void);
+static void tlb_shootdown_add(pml4e_t *pml4e, void *va);
+static void tlb_shootdown_all(pml4e_t *pml4e);
 
 // This simple physical memory allocator is used only while JOS is setting
 // up its virtual memory system.  page_alloc() is the real allocator.
@@ -83,7 +225,7 @@ static void check_page_installed_pml4e(void);
 //
 // If we're out of memory, boot_alloc should panic.
 // This function may ONLY be used during initialization,
-// before the page_free_list list has been set up.
+// before the free_area lists have been set up.
 //
 // boot_alloc INVARIANT that we must maintain is:
 // 	The physical page whose kernel-virtual addresses start at nextfree and above remain free for allocation
@@ -117,7 +259,7 @@ boot_alloc(uint32_t n)
     
     nextfree = ROUNDUP(nextfree + n, PGSIZE);
     
-    if (PADDR(nextfree) > npages * PGSIZE) {
+    if (PADDR(nextfree) > MIN(npages * PGSIZE, BOOTMAP_LIMIT)) {
         panic("boot_alloc: out of memory");
     }
     
@@ -139,13 +281,13 @@ boot_alloc(uint32_t n)
 // From UTOP to ULIM, the user is allowed to read but not write.
 // Above ULIM the user cannot read or write.
 void
-mem_init(void)
+mem_init(struct BootInfo *bootinfo)
 {
 	uint32_t cr0;
 	size_t n;
 
-	// Find out how much memory the machine has (npages & npages_basemem).
-	i386_detect_memory();
+	// Find out how much memory the machine has (npages & mem_ranges).
+	i386_detect_memory(bootinfo);
 
 	//////////////////////////////////////////////////////////////////////
 	// create initial page directory.
@@ -184,6 +326,13 @@ mem_init(void)
 	envs = (struct Env *) boot_alloc(NENV * sizeof(struct Env));
 	memset(envs, 0, NENV * sizeof(struct Env));
 
+	// The info page shares the UENVS slot with envs.
+	static_assert(sizeof(struct UInfo) <= PGSIZE);
+	uinfo = (struct UInfo *) boot_alloc(PGSIZE);
+	memset(uinfo, 0, PGSIZE);
+
+	spin_initlock(&page_lock);
+
 	//////////////////////////////////////////////////////////////////////
 	// Now that we've allocated the initial kernel data structures, we set
 	// up the list of free physical pages. Once we've done so, all further
@@ -198,6 +347,9 @@ mem_init(void)
 	check_page_alloc();
 	check_page();
 
+	// The checks above expect every free page to be in free_area, so
+	// only now let pages be cached per CPU.
+	pcp_enabled = 1;
 
 	//////////////////////////////////////////////////////////////////////
 	// Now we set up virtual memory
@@ -222,6 +374,10 @@ mem_init(void)
             PADDR(envs),
             PTE_U | PTE_P);
 
+	// Map the info page read-only by the user at UINFO
+	static_assert(UENVS + NENV * sizeof(struct Env) <= UINFO);
+	boot_map_region(kern_pml4, UINFO, PGSIZE, PADDR(uinfo), PTE_U | PTE_P);
+
 	boot_map_region(kern_pml4,
                 KSTACKTOP - KSTKSIZE,
                 KSTKSIZE,
@@ -229,11 +385,20 @@ mem_init(void)
                 PTE_W | PTE_P);
 
 
+	// Map all of physical memory at KERNBASE, and at least up to 4GB
+	// of virtual address space.  This uses large pages, so report how
+	// many of each size it took.
+	size_t leaves[3];
+	uint64_t tsc = read_tsc();
+	memcpy(leaves, boot_map_leaves, sizeof(leaves));
 	boot_map_region(kern_pml4,
                 KERNBASE,
-                (1ULL << 32) - KERNBASE,   // Full range: 2^32 - KERNBASE
+                MAX((1ULL << 32) - KERNBASE, ROUNDUP(npages * PGSIZE, PTSIZE)),
                 0,
                 PTE_W | PTE_P);
+	cprintf("KERNBASE map: %ld 1GB, %ld 2MB, %ld 4KB pages in %ld cycles\n",
+		boot_map_leaves[2] - leaves[2], boot_map_leaves[1] - leaves[1],
+		boot_map_leaves[0] - leaves[0], read_tsc() - tsc);
 
 
 	// Initialize the SMP-related parts of the memory map
@@ -255,6 +420,11 @@ mem_init(void)
 
 
 	lcr3(PADDR(kern_pml4));
+	tlb_init();
+
+	// Everything is mapped at KERNBASE now, so the allocator can have
+	// the memory entry_pml4e didn't cover.
+	page_init_high();
 
 	// check_page_free_list(0);
 
@@ -316,14 +486,15 @@ mem_init_mp(void)
 // --------------------------------------------------------------
 // Tracking of physical pages.
 // The 'pages' array has one 'struct PageInfo' entry per physical page.
-// Pages are reference counted, and free pages are kept on a linked list.
+// Pages are reference counted, and free pages are kept in the buddy
+// allocator's free_area lists.
 // --------------------------------------------------------------
 
 //
 // Initialize page structure and memory free list.
 // After this is done, NEVER use boot_alloc again.  ONLY use the page
 // allocator functions below to allocate and deallocate physical
-// memory via the page_free_list.
+// memory via the free_area lists.
 //
 void
 page_init(void)
@@ -337,7 +508,7 @@ page_init(void)
 	//  1) Mark physical page 0 as in use.
 	//     This way we preserve the real-mode IDT and BIOS structures
 	//     in case we ever need them.  (Currently we don't, but...)
-	//  2) The rest of base memory, [PGSIZE, npages_basemem * PGSIZE)
+	//  2) The rest of base memory, [PGSIZE, IOPHYSMEM)
 	//     is free.
 	//  3) Then comes the IO hole [IOPHYSMEM, EXTPHYSMEM), which must
 	//     never be allocated.
@@ -354,78 +525,311 @@ page_init(void)
 	- also don't include it in the free list
 	*/
 	size_t i;
-	physaddr_t first_free_addr = PADDR(boot_alloc(0));
-    size_t first_free_page = first_free_addr / PGSIZE;
-	page_free_list = NULL;
 
+	// Every page starts out in use; page_free_range() hands the usable
+	// ones to the allocator.
 	for (i = 0; i < npages; i++) {
-        if (i == 0) {
-            pages[i].pp_ref = 1;
-            pages[i]. pp_link = NULL;
-            continue;
-        }
-        
-        if (i >= 1 && i < npages_basemem) {
-            if (i == MPENTRY_PADDR / PGSIZE) {
-                pages[i].pp_ref = 1;
-                pages[i].pp_link = NULL;
-                continue;
-            }
+		pages[i].pp_ref = 1;
+		pages[i].pp_link = NULL;
+		pages[i].pp_prev = NULL;
+		pages[i].pp_order = 0;
+		pages[i].pp_flags = 0;
+	}
+
+	page_free_range(0, MIN(npages, BOOTMAP_LIMIT / PGSIZE));
+}
+
+// Free the memory above BOOTMAP_LIMIT, once it is mapped at KERNBASE.
+static void
+page_init_high(void)
+{
+	if (npages > BOOTMAP_LIMIT / PGSIZE)
+		page_free_range(BOOTMAP_LIMIT / PGSIZE, npages);
+}
+
+//
+// Give the allocator every usable page in [lo, hi) (page numbers),
+// skipping the pages that are in use even though the memory map says
+// they're usable:
+//  1) Physical page 0, to preserve the real-mode IDT and BIOS
+//     structures in case we ever need them.
+//  2) The AP bootstrap code page at MPENTRY_PADDR.
+//  3) The IO hole [IOPHYSMEM, EXTPHYSMEM).
+//  4) The kernel and everything boot_alloc() has handed out, which
+//     sit in [EXTPHYSMEM, boot_alloc(0)).
+//
+static void
+page_free_range(size_t lo, size_t hi)
+{
+	size_t first_free_page = PADDR(boot_alloc(0)) / PGSIZE;
+	size_t i, start, end;
+	int r;
+
+	for (r = 0; r < nmem_ranges; r++) {
+		start = MAX(lo, ROUNDUP(mem_ranges[r].mr_start, PGSIZE) / PGSIZE);
+		end = MIN(hi, mem_ranges[r].mr_end / PGSIZE);
+		for (i = start; i < end; i++) {
+			if (i == 0 || i == MPENTRY_PADDR / PGSIZE)
+				continue;
+			if (i >= IOPHYSMEM / PGSIZE && i < first_free_page)
+				continue;
+			// Overlapping map entries mustn't free a page twice
+			if (pages[i].pp_ref != 1)
+				continue;
 			pages[i].pp_ref = 0;
-            pages[i]. pp_link = page_free_list;
-            page_free_list = &pages[i];
-            continue;
-        }
-        
-        if (i >= IOPHYSMEM / PGSIZE && i < EXTPHYSMEM / PGSIZE) {
-            pages[i].pp_ref = 1;
-            pages[i].pp_link = NULL;
-            continue;
-        }
-        
-        if (i >= EXTPHYSMEM / PGSIZE && i < first_free_page) {
-            pages[i].pp_ref = 1;
-            pages[i].pp_link = NULL;
-            continue;
-        }
-        
-        if (i >= first_free_page) {
-            pages[i].pp_ref = 0;
-            pages[i]. pp_link = page_free_list;
-            page_free_list = &pages[i];
-        }
+			buddy_free(&pages[i], 0);
+		}
+	}
+}
+
+static void
+free_area_add(struct PageInfo *pp, int order)
+{
+	struct FreeArea *fa = &free_area[order];
+
+	pp->pp_order = order;
+	pp->pp_flags |= PP_FREE;
+	pp->pp_prev = NULL;
+	pp->pp_link = fa->fa_list;
+	if (fa->fa_list)
+		fa->fa_list->pp_prev = pp;
+	fa->fa_list = pp;
+	fa->fa_nfree++;
+}
+
+static void
+free_area_del(struct PageInfo *pp, int order)
+{
+	struct FreeArea *fa = &free_area[order];
+
+	if (pp->pp_prev)
+		pp->pp_prev->pp_link = pp->pp_link;
+	else
+		fa->fa_list = pp->pp_link;
+	if (pp->pp_link)
+		pp->pp_link->pp_prev = pp->pp_prev;
+	pp->pp_link = NULL;
+	pp->pp_prev = NULL;
+	pp->pp_flags &= ~PP_FREE;
+	fa->fa_nfree--;
+}
+
+//
+// Take a block of 2^order pages off the free lists, splitting a
+// larger block if no block of that order is free.
+// Returns NULL if no large enough block exists.
+// The caller must hold page_lock (or be running before SMP is up).
+//
+static struct PageInfo *
+buddy_alloc(int order)
+{
+	struct BuddyStats *bs = &buddy_stats[order];
+	struct PageInfo *pp;
+	uint64_t t0, dt;
+	int k;
+
+	t0 = read_tsc();
+	for (k = order; k <= PAGE_MAX_ORDER; k++)
+		if (free_area[k].fa_list)
+			break;
+	if (k > PAGE_MAX_ORDER) {
+		bs->bs_fails++;
+		return NULL;
+	}
+
+	pp = free_area[k].fa_list;
+	free_area_del(pp, k);
+
+	// Hand the upper halves back until the block is the right size.
+	while (k > order) {
+		k--;
+		free_area_add(pp + (1 << k), k);
+	}
+	pp->pp_order = order;
+
+	dt = read_tsc() - t0;
+	bs->bs_allocs++;
+	bs->bs_cycles += dt;
+	if (dt > bs->bs_max_cycles)
+		bs->bs_max_cycles = dt;
+	return pp;
+}
+
+//
+// Return a block of 2^order pages to the free lists, merging it with
+// its buddy for as long as the buddy is free and of the same order.
+// The caller must hold page_lock (or be running before SMP is up).
+//
+static void
+buddy_free(struct PageInfo *pp, int order)
+{
+	size_t pfn = pp - pages;
+	size_t buddy_pfn;
+	struct PageInfo *buddy;
+
+	while (order < PAGE_MAX_ORDER) {
+		buddy_pfn = pfn ^ (1UL << order);
+		if (buddy_pfn >= npages)
+			break;
+		buddy = &pages[buddy_pfn];
+		if (!(buddy->pp_flags & PP_FREE) || buddy->pp_order != order)
+			break;
+		free_area_del(buddy, order);
+		pfn &= ~(1UL << order);
+		order++;
+	}
+	free_area_add(&pages[pfn], order);
+}
+
+// Move up to 'n' pages from the buddy allocator onto the cache of
+// CPU 'c'.  Returns the number of pages moved.
+static int
+pcp_refill(struct CpuInfo *c, int n)
+{
+	struct PageInfo *pp;
+	int i;
+
+	spin_lock(&page_lock);
+	for (i = 0; i < n && (pp = buddy_alloc(0)); i++) {
+		pp->pp_link = c->cpu_pcp_list;
+		c->cpu_pcp_list = pp;
+	}
+	spin_unlock(&page_lock);
+	c->cpu_pcp_count += i;
+	return i;
+}
+
+// Move up to 'n' pages from the cache of CPU 'c' back to the buddy
+// allocator.
+static void
+pcp_drain(struct CpuInfo *c, int n)
+{
+	struct PageInfo *pp;
+
+	spin_lock(&page_lock);
+	while (n-- > 0 && c->cpu_pcp_list) {
+		pp = c->cpu_pcp_list;
+		c->cpu_pcp_list = pp->pp_link;
+		c->cpu_pcp_count--;
+		pp->pp_link = NULL;
+		buddy_free(pp, 0);
+	}
+	spin_unlock(&page_lock);
+}
+
+// Pop a page off the zeroed pool, or return NULL if it is empty.
+static struct PageInfo *
+page_zero_pop(void)
+{
+	struct PageInfo *pp;
+
+	spin_lock(&page_lock);
+	if ((pp = page_zero_list) != NULL) {
+		page_zero_list = pp->pp_link;
+		page_zero_count--;
+		page_zero_hits++;
+	}
+	spin_unlock(&page_lock);
+	return pp;
+}
+
+//
+// Zero up to ZERO_BATCH free pages and add them to the zeroed pool.
+// Called by CPUs that have nothing to run, after they have released
+// the big kernel lock, so the memsets overlap with other CPUs' work.
+// page_lock is only held to move pages on and off the lists.  Pages
+// are taken one at a time, so at most one free page is off every list
+// (and invisible to page_alloc on other CPUs) while it is zeroed.
+//
+void
+page_zero_idle(void)
+{
+	struct PageInfo *pp;
+	int i;
+
+	if (!pcp_enabled)
+		return;
+
+	for (i = 0; i < ZERO_BATCH; i++) {
+		spin_lock(&page_lock);
+		pp = page_zero_count < ZERO_HIGH ? buddy_alloc(0) : NULL;
+		spin_unlock(&page_lock);
+		if (pp == NULL)
+			return;
+
+		memset(page2kva(pp), 0, PGSIZE);
+
+		spin_lock(&page_lock);
+		pp->pp_link = page_zero_list;
+		page_zero_list = pp;
+		page_zero_count++;
+		spin_unlock(&page_lock);
 	}
 }
 
 /*
-- returns 'struct PageInfo' record of a free page from page_free_list
+- returns 'struct PageInfo' record of a free page
 - That record must be detached from the list and its corresponding page should be zero-filled if caller passed ALLOC_ZERO
-- Check that page_free_list has pages; if empty return null
-- select furst record pointed by page_free_list and separate it
+- If no page is free return null
 - Before returning, page_allog must nullify its pp_link field
 - Also, if ALLOC_ZERO
+- Pages come from this CPU's cache, which is refilled in batches
+- ALLOC_ZERO pages come from the zeroed pool when it has any
 */
 struct PageInfo *
 page_alloc(int alloc_flags)
 {
-	if (page_free_list == NULL) {
-        return NULL;
-    }
-    
-    struct PageInfo *free_page = page_free_list;
-    
-    // remove it from the free list
-    page_free_list = free_page->pp_link;
-    
-    // set pp_link to NULL
-    free_page->pp_link = NULL;
-    
-    // zero the page if requested
-    if (alloc_flags & ALLOC_ZERO) {
-        memset(page2kva(free_page), 0, PGSIZE);
-    }
-    
-    return free_page;
+	struct CpuInfo *c = thiscpu;
+	struct PageInfo *free_page;
+	int i;
+
+	if (!pcp_enabled) {
+		if ((free_page = buddy_alloc(0)) == NULL) {
+			return NULL;
+		}
+		goto found;
+	}
+
+	// a page from the zeroed pool saves the memset below
+	if (alloc_flags & ALLOC_ZERO) {
+		if ((free_page = page_zero_pop()) != NULL) {
+			free_page->pp_link = NULL;
+			return free_page;
+		}
+		page_zero_misses++;
+	}
+
+	if (c->cpu_pcp_count == 0 && pcp_refill(c, PCP_BATCH) == 0) {
+		// The buddy allocator is empty: reclaim whatever the other
+		// CPUs are caching before giving up.
+		for (i = 0; i < ncpu; i++) {
+			if (&cpus[i] != c)
+				pcp_drain(&cpus[i], cpus[i].cpu_pcp_count);
+		}
+		if (pcp_refill(c, PCP_BATCH) == 0) {
+			// last resort: the zeroed pool
+			if ((free_page = page_zero_pop()) == NULL) {
+				return NULL;
+			}
+			goto found;
+		}
+	}
+
+	// remove it from this CPU's cache
+	free_page = c->cpu_pcp_list;
+	c->cpu_pcp_list = free_page->pp_link;
+	c->cpu_pcp_count--;
+
+found:
+	// set pp_link to NULL
+	free_page->pp_link = NULL;
+
+	// zero the page if requested
+	if (alloc_flags & ALLOC_ZERO) {
+		memset(page2kva(free_page), 0, PGSIZE);
+	}
+
+	return free_page;
 }
 
 //
@@ -437,19 +841,133 @@ page_alloc(int alloc_flags)
 - receive a 'struct PageInfo' record and put it back onto the list
 - only done if pp_ref field on that page is zero and not linked to any other list with pp_link
 - If either of these not true, panic
+- The page goes onto this CPU's cache; overflow is drained in batches
 */
 void
 page_free(struct PageInfo *pp)
 {
+	struct CpuInfo *c = thiscpu;
+
 	if (pp->pp_ref != 0) {
-        panic("page_free: pp->pp_ref is nonzero");
-    }
-    if (pp->pp_link != NULL) {
-        panic("page_free: pp->pp_link is not NULL");
-    }
-    
-    pp->pp_link = page_free_list;
-    page_free_list = pp;  
+		panic("page_free: pp->pp_ref is nonzero");
+	}
+	if (pp->pp_link != NULL) {
+		panic("page_free: pp->pp_link is not NULL");
+	}
+
+	if (!pcp_enabled) {
+		buddy_free(pp, 0);
+		return;
+	}
+
+	pp->pp_link = c->cpu_pcp_list;
+	c->cpu_pcp_list = pp;
+	if (++c->cpu_pcp_count > PCP_HIGH) {
+		pcp_drain(c, PCP_BATCH);
+	}
+}
+
+//
+// Allocate 2^order physically contiguous pages, naturally aligned to
+// their size, and return the PageInfo of the first one.  The block is
+// zero-filled if ALLOC_ZERO is set.  Single pages go through the
+// per-CPU caches via page_alloc().
+// Returns NULL if no large enough block is free.
+//
+struct PageInfo *
+page_alloc_order(int order, int alloc_flags)
+{
+	struct PageInfo *pp;
+	int i;
+
+	if (order < 0 || order > PAGE_MAX_ORDER)
+		return NULL;
+	if (order == 0)
+		return page_alloc(alloc_flags);
+
+	spin_lock(&page_lock);
+	pp = buddy_alloc(order);
+	spin_unlock(&page_lock);
+	if (pp == NULL && pcp_enabled) {
+		// Pages sitting in the per-CPU caches or the zeroed pool
+		// can't coalesce; hand them all back and try once more.
+		for (i = 0; i < ncpu; i++)
+			pcp_drain(&cpus[i], cpus[i].cpu_pcp_count);
+		spin_lock(&page_lock);
+		while ((pp = page_zero_list)) {
+			page_zero_list = pp->pp_link;
+			page_zero_count--;
+			pp->pp_link = NULL;
+			buddy_free(pp, 0);
+		}
+		pp = buddy_alloc(order);
+		spin_unlock(&page_lock);
+	}
+	if (pp == NULL)
+		return NULL;
+
+	if (alloc_flags & ALLOC_ZERO)
+		memset(page2kva(pp), 0, PGSIZE << order);
+	return pp;
+}
+
+//
+// Return a block allocated by page_alloc_order() to the allocator.
+// Every page in the block must have a zero pp_ref.
+//
+void
+page_free_order(struct PageInfo *pp, int order)
+{
+	if (order == 0) {
+		page_free(pp);
+		return;
+	}
+	if (pp->pp_ref != 0)
+		panic("page_free_order: pp->pp_ref is nonzero");
+	if (pp->pp_link != NULL)
+		panic("page_free_order: pp->pp_link is not NULL");
+
+	spin_lock(&page_lock);
+	buddy_free(pp, order);
+	spin_unlock(&page_lock);
+}
+
+//
+// Print the buddy allocator's free block counts, how fragmented free
+// memory is, and how long allocations of each order have taken.
+//
+// For each order the fragmentation column is the percentage of free
+// memory sitting in blocks too small to satisfy an allocation of that
+// order (0% means any free page could be part of such a block).
+//
+void
+page_print_stats(void)
+{
+	struct BuddyStats *bs;
+	size_t nfree = 0, usable;
+	int k, j;
+
+	spin_lock(&page_lock);
+	for (k = 0; k <= PAGE_MAX_ORDER; k++)
+		nfree += free_area[k].fa_nfree << k;
+
+	cprintf("order  blocks  frag  allocs  fails  avg-cycles  max-cycles\n");
+	for (k = 0; k <= PAGE_MAX_ORDER; k++) {
+		bs = &buddy_stats[k];
+		usable = 0;
+		for (j = k; j <= PAGE_MAX_ORDER; j++)
+			usable += free_area[j].fa_nfree << j;
+		cprintf("%5d  %6d  %3d%%  %6ld  %5ld  %10ld  %10ld\n",
+			k, free_area[k].fa_nfree,
+			nfree ? (int) (100 - usable * 100 / nfree) : 0,
+			bs->bs_allocs, bs->bs_fails,
+			bs->bs_allocs ? bs->bs_cycles / bs->bs_allocs : 0,
+			bs->bs_max_cycles);
+	}
+	cprintf("free pages: %ld of %ld\n", nfree, npages);
+	cprintf("zeroed pool: %d pages, %ld hits, %ld misses\n",
+		page_zero_count, page_zero_hits, page_zero_misses);
+	spin_unlock(&page_lock);
 }
 
 //
@@ -509,6 +1027,7 @@ Logic is the same with a couple changes:
 - Pointer to pml4 table (pml4e_t *pml4e) is now pointer to PDPT table (pdpe_t *pdpe)
 - Macro is now PDPX(va) instead of PML4X(va)
 - At the end, return pgdir_walk(pgdir, va, create);
+- If the entry maps a 1GB page (PTE_PS), return the entry itself
 */
 pte_t *
 pdpe_walk(pdpe_t *pdpe,const void *va,int create)
@@ -530,6 +1049,10 @@ pdpe_walk(pdpe_t *pdpe,const void *va,int create)
         *pdpe_entry = page2pa(pp) | PTE_P | PTE_W | PTE_U;
     }
     
+    if (*pdpe_entry & PTE_PS) {
+        return (pte_t *)pdpe_entry;
+    }
+    
     pgdir = (pde_t *)KADDR(PTE_ADDR(*pdpe_entry));
     return pgdir_walk(pgdir, va, create);
 }
@@ -539,6 +1062,7 @@ pdpe_walk(pdpe_t *pdpe,const void *va,int create)
 - Macro is now PDX(va)
 - Should finally return the physical address:
   return &page_table[PTX(va)];
+- If the entry maps a 2MB page (PTE_PS), return the entry itself
 */
 pte_t *
 pgdir_walk(pde_t *pgdir, const void *va, int create)
@@ -560,10 +1084,181 @@ pgdir_walk(pde_t *pgdir, const void *va, int create)
         *pde = page2pa(pp) | PTE_P | PTE_W | PTE_U;
     }
     
+    if (*pde & PTE_PS) {
+        return (pte_t *)pde;
+    }
+    
     page_table = (pte_t *)KADDR(PTE_ADDR(*pde));
     return &page_table[PTX(va)];
 }
 
+//
+// Find the entry that maps 'va' in 'pml4e', without creating anything.
+// This is a PTE, or a PDE/PDPE with PTE_PS set if 'va' lies in a large
+// page; *size_store is set to how many bytes that entry maps (PGSIZE,
+// PTSIZE or PDPSIZE).  Returns NULL if 'va' isn't mapped.
+//
+pte_t *
+pml4e_walk_leaf(pml4e_t *pml4e, const void *va, size_t *size_store)
+{
+	pdpe_t *pdpe;
+	pde_t *pde;
+	pte_t *pte;
+
+	if (!(pml4e[PML4X(va)] & PTE_P))
+		return NULL;
+	pdpe = (pdpe_t *) KADDR(PTE_ADDR(pml4e[PML4X(va)])) + PDPX(va);
+	if (!(*pdpe & PTE_P))
+		return NULL;
+	if (*pdpe & PTE_PS) {
+		*size_store = PDPSIZE;
+		return (pte_t *) pdpe;
+	}
+	pde = (pde_t *) KADDR(PTE_ADDR(*pdpe)) + PDX(va);
+	if (!(*pde & PTE_P))
+		return NULL;
+	if (*pde & PTE_PS) {
+		*size_store = PTSIZE;
+		return (pte_t *) pde;
+	}
+	pte = (pte_t *) KADDR(PTE_ADDR(*pde)) + PTX(va);
+	if (!(*pte & PTE_P))
+		return NULL;
+	*size_store = PGSIZE;
+	return pte;
+}
+
+// Return a pointer to the entry for 'va' in the paging structure
+// 'level' levels below the PML4 (1 = PDPT, 2 = page directory),
+// allocating intermediate tables as needed.  Returns NULL if out of
+// memory, or if a large page already covers 'va'.
+static uint64_t *
+pml4e_walk_level(pml4e_t *pml4e, uintptr_t va, int level)
+{
+	static const int shift[] = { PML4XSHIFT, PDPXSHIFT, PDXSHIFT };
+	uint64_t *table = pml4e;
+	uint64_t *entry;
+	struct PageInfo *pp;
+	int l;
+
+	for (l = 0; ; l++) {
+		entry = &table[(va >> shift[l]) & 0x1FF];
+		if (l == level)
+			return entry;
+		if (!(*entry & PTE_P)) {
+			if (!(pp = page_alloc(ALLOC_ZERO)))
+				return NULL;
+			pp->pp_ref++;
+			*entry = page2pa(pp) | PTE_P | PTE_W | PTE_U;
+		} else if (*entry & PTE_PS)
+			return NULL;
+		table = KADDR(PTE_ADDR(*entry));
+	}
+}
+
+//
+// Page table range iterator.
+//
+// pte_iter_next() steps through the leaf entries covering [va, va+len)
+// in order.  It remembers the tables it walked through, so going on to
+// the next entry of the same table is just an index, and without
+// 'create' an absent PDPT, page directory or page table is skipped
+// over in one step, whatever its size.  Typical use:
+//
+//	pte_iter_init(&it, pml4e, va, len, 0);
+//	while ((r = pte_iter_next(&it)) > 0)
+//		... *it.pi_pte maps it.pi_size bytes, it.pi_va is in range ...
+//
+// With 'create', every 4KB page gets an entry (tables are allocated on
+// the way, as by pml4e_walk), present or not, except where a large
+// page covers it; it.pi_va then advances by PGSIZE at a time.
+//
+// Tables the caller frees while iterating must not be walked again.
+//
+
+static const int pte_iter_shift[] = { PML4XSHIFT, PDPXSHIFT, PDXSHIFT, PTXSHIFT };
+
+void
+pte_iter_init(struct PteIter *it, pml4e_t *pml4e, const void *va, size_t len, int create)
+{
+	memset(it, 0, sizeof(*it));
+	it->pi_table[0] = pml4e;
+	it->pi_next = (uintptr_t) va;
+	it->pi_end = (uintptr_t) va + len;
+	it->pi_create = create;
+}
+
+//
+// Move to the next entry.  Fills in pi_pte, pi_va (where in the range
+// the entry starts applying) and pi_size (bytes the entry maps).
+// Returns 1 if there is one, 0 at the end of the range, or -E_NO_MEM
+// if 'create' couldn't allocate a table.
+//
+int
+pte_iter_next(struct PteIter *it)
+{
+	struct PageInfo *pp;
+	uint64_t *entry;
+	uintptr_t va, size;
+	int l;
+
+	while ((va = it->pi_next) < it->pi_end) {
+		// start from the lowest table we already have for va
+		for (l = 3; l > 0; l--)
+			if (it->pi_table[l] && it->pi_base[l]
+			    == ROUNDDOWN(va, (uintptr_t) NPTENTRIES << pte_iter_shift[l]))
+				break;
+
+		for (;; l++) {
+			size = 1ULL << pte_iter_shift[l];
+			entry = &it->pi_table[l][(va >> pte_iter_shift[l]) & 0x1FF];
+			if (!(*entry & PTE_P) && !it->pi_create) {
+				it->pi_next = ROUNDDOWN(va, size) + size;
+				break;
+			}
+			if (l == 3 || (*entry & PTE_PS)) {
+				it->pi_pte = entry;
+				it->pi_va = va;
+				it->pi_size = size;
+				it->pi_next = ROUNDDOWN(va, size) + size;
+				return 1;
+			}
+			if (!(*entry & PTE_P)) {
+				if (!(pp = page_alloc(ALLOC_ZERO)))
+					return -E_NO_MEM;
+				pp->pp_ref++;
+				*entry = page2pa(pp) | PTE_P | PTE_W | PTE_U;
+			}
+			it->pi_table[l + 1] = KADDR(PTE_ADDR(*entry));
+			it->pi_base[l + 1] = ROUNDDOWN(va, size);
+		}
+	}
+	return 0;
+}
+
+//
+// Make the next pte_iter_next() start looking at 'va', which may be
+// anywhere; the tables walked so far are reused if they cover it.
+//
+void
+pte_iter_seek(struct PteIter *it, const void *va)
+{
+	it->pi_next = (uintptr_t) va;
+}
+
+// Whether the CPU supports 1GB pages (CPUID.80000001H:EDX.Page1GB)
+static bool
+cpu_has_1gb_pages(void)
+{
+	uint32_t eax, edx;
+
+	cpuid(0x80000000, &eax, NULL, NULL, NULL);
+	if (eax < 0x80000001)
+		return 0;
+	cpuid(0x80000001, NULL, NULL, NULL, &edx);
+	return (edx >> 26) & 1;
+}
+
 
 /*
 - Loop to visit virtual pages to be allocated
@@ -572,20 +1267,49 @@ pgdir_walk(pde_t *pgdir, const void *va, int create)
   *pte = pa | perm | PTE_P;
 - va and pa must move alone with each iteration of loop
 - DON'T INC pp_ref
+- Where va, pa and the remaining size line up on 1GB (or 2MB)
+  boundaries, map a whole PTE_PS page in the PDPT (or page directory)
+  instead of 512 (or 512*512) PTEs
+- Everything mapped here is kernel memory that looks the same in every
+  address space, so the leaves are PTE_G and survive CR3 switches
 */
 static void
 boot_map_region(pde_t *pml4e, uintptr_t va, size_t size, physaddr_t pa, int perm)
 {
+	static int has_1gb = -1;
 	size_t i;
     pte_t *pte;
+    uint64_t *entry;
+    
+    if (has_1gb < 0) {
+        has_1gb = cpu_has_1gb_pages();
+    }
+    perm |= PTE_G;
     
-    for (i = 0; i < size; i += PGSIZE) {
+    for (i = 0; i < size; ) {
+        if (has_1gb && ((va + i) | (pa + i)) % PDPSIZE == 0 && size - i >= PDPSIZE
+            && (entry = pml4e_walk_level(pml4e, va + i, 1)) && !(*entry & PTE_P)) {
+            *entry = (pa + i) | perm | PTE_P | PTE_PS;
+            boot_map_leaves[2]++;
+            i += PDPSIZE;
+            continue;
+        }
+        if (((va + i) | (pa + i)) % PTSIZE == 0 && size - i >= PTSIZE
+            && (entry = pml4e_walk_level(pml4e, va + i, 2)) && !(*entry & PTE_P)) {
+            *entry = (pa + i) | perm | PTE_P | PTE_PS;
+            boot_map_leaves[1]++;
+            i += PTSIZE;
+            continue;
+        }
+        
         pte = pml4e_walk((pml4e_t *)pml4e, (void *)(va + i), 1);
         
-        if (pte == NULL) {
+        if (pte == NULL || (*pte & PTE_PS)) {
             panic("boot_map_region: pml4e_walk failed");
         }
         *pte = (pa + i) | perm | PTE_P;
+        boot_map_leaves[0]++;
+        i += PGSIZE;
     }
 }
 
@@ -598,12 +1322,20 @@ boot_map_region(pde_t *pml4e, uintptr_t va, size_t size, physaddr_t pa, int perm
 - If page referenced by *pte is valid (*pte&PTE_P), use:
   page_remove(pml4e, va); to remove existing mapping
 - Assign: *pte = page2pa(pp) | perm | PTE_P; return 0;
+- A 2MB page covering va is split first, so only va's 4KB changes
 */
 int
 page_insert(pde_t *pml4e, struct PageInfo *pp, void *va, int perm)
 {
 	pte_t *pte = pml4e_walk((pml4e_t *)pml4e, va, 1);
     
+    if (pte != NULL && (*pte & PTE_PS)) {
+        if (page_split(pml4e, va) < 0) {
+            return -E_NO_MEM;
+        }
+        pte = pml4e_walk((pml4e_t *)pml4e, va, 1);
+    }
+    
     if (pte == NULL) {
         return -E_NO_MEM;
     }
@@ -628,13 +1360,16 @@ page_insert(pde_t *pml4e, struct PageInfo *pp, void *va, int perm)
 - AND return the struct PageInfo record corresponding to the pa in the PTE:
   return pa2page(PTE_ADDR(*p_pte));
 - Otherwise return NULL
+- If va is in a large page, *pte_store is its PDE/PDPE and the page
+  returned is the 4KB page within it that va falls in
 */
 struct PageInfo *
 page_lookup(pde_t *pml4e, void *va, pte_t **pte_store)
 {
-	pte_t *pte = pml4e_walk((pml4e_t *)pml4e, va, 0);
+	size_t size;
+	pte_t *pte = pml4e_walk_leaf((pml4e_t *)pml4e, va, &size);
     
-    if (pte == NULL || ! (*pte & PTE_P)) {
+    if (pte == NULL) {
         return NULL;
     }
     
@@ -642,13 +1377,15 @@ page_lookup(pde_t *pml4e, void *va, pte_t **pte_store)
         *pte_store = pte;
     }
     
-    return pa2page(PTE_ADDR(*pte));
+    return pa2page(PTE_ADDR_PS(*pte, size) + ((uintptr_t)va & (size - 1)));
 }
 
 
 //
 // Unmaps the physical page at virtual address 'va'.
 // If there is no physical page at that address, silently does nothing.
+// Returns 0, or -E_NO_MEM if 'va' is in a 2MB page and there is no
+// memory to split it (then nothing changes).
 //
 // Details:
 //   - The ref count on the physical page should decrement.
@@ -670,19 +1407,111 @@ page_lookup(pde_t *pml4e, void *va, pte_t **pte_store)
   page_decref(pp); decrements the pp_ref field
   tlb_invalidate(pml4e, va); invalidates the page in TLB
 */
-void
+int
 page_remove(pde_t *pml4e, void *va)
 {
 	pte_t *pte = NULL;
     struct PageInfo *pp = page_lookup(pml4e, va, &pte);
     
     if (pp == NULL) {
-        return;
+        return 0;
+    }
+    
+    // Only va's 4KB of a 2MB page goes away
+    if (*pte & PTE_PS) {
+        if (page_split(pml4e, va) < 0) {
+            return -E_NO_MEM;
+        }
+        pp = page_lookup(pml4e, va, &pte);
     }
     
     *pte = 0;
-    page_decref(pp);
     tlb_invalidate(pml4e, va);
+    tlb_release(pp);
+    return 0;
+}
+
+//
+// Map the 2^9 pages starting at 'pp' (a block from page_alloc_order)
+// at the 2MB-aligned 'va' with a single PTE_PS page directory entry.
+// Anything already mapped in [va, va + PTSIZE) is unmapped first.
+// Every 4KB page in the block gets its own pp_ref incremented, so the
+// mapping can later be split into ordinary PTEs (page_split) or
+// partially unmapped without any refcount fix-ups.
+//
+// RETURNS:
+//   0 on success
+//   -E_NO_MEM, if a page directory couldn't be allocated
+//   -E_INVAL, if a 1GB page already covers va
+//
+int
+page_insert_huge(pml4e_t *pml4e, struct PageInfo *pp, void *va, int perm)
+{
+	pde_t *pde, old;
+	pte_t *pt;
+	int i;
+
+	assert(((uintptr_t) va & (PTSIZE - 1)) == 0);
+	if (!(pde = pml4e_walk_level(pml4e, (uintptr_t) va, 2)))
+		return (pml4e_walk(pml4e, va, 0) ? -E_INVAL : -E_NO_MEM);
+
+	for (i = 0; i < NPTENTRIES; i++)
+		pp[i].pp_ref++;
+
+	old = *pde;
+	if ((old & PTE_P) && (old & PTE_PS)) {
+		*pde = 0;
+		tlb_invalidate(pml4e, va);
+		for (i = 0; i < NPTENTRIES; i++)
+			tlb_release(pa2page(PTE_ADDR_PS(old, PTSIZE) + i * PGSIZE));
+	} else if (old & PTE_P) {
+		pt = KADDR(PTE_ADDR(old));
+		for (i = 0; i < NPTENTRIES; i++)
+			if (pt[i] & PTE_P)
+				page_remove(pml4e, (char *) va + i * PGSIZE);
+		*pde = 0;
+		tlb_invalidate(pml4e, va);
+		tlb_release(pa2page(PTE_ADDR(old)));
+	}
+
+	*pde = page2pa(pp) | perm | PTE_P | PTE_PS;
+	tlb_invalidate(pml4e, va);
+	return 0;
+}
+
+//
+// If 'va' is mapped by a 2MB page in 'pml4e', replace that mapping with
+// a page table whose 512 PTEs map the same pages with the same
+// permissions.  Reference counts are already per 4KB page (see
+// page_insert_huge), so they don't change.
+// Returns 0 on success or if there was nothing to split, -E_NO_MEM if
+// no page is free for the page table.
+//
+int
+page_split(pml4e_t *pml4e, void *va)
+{
+	size_t size;
+	pte_t *pde = pml4e_walk_leaf(pml4e, va, &size);
+	struct PageInfo *pp;
+	pte_t *pt;
+	physaddr_t pa;
+	int i, perm;
+
+	if (pde == NULL || size != PTSIZE)
+		return 0;
+	if (!(pp = page_alloc(0)))
+		return -E_NO_MEM;
+	pp->pp_ref++;
+
+	pt = page2kva(pp);
+	pa = PTE_ADDR_PS(*pde, PTSIZE);
+	perm = *pde & 0xFFF & ~PTE_PS;
+	for (i = 0; i < NPTENTRIES; i++)
+		pt[i] = (pa + i * PGSIZE) | perm;
+	*pde = page2pa(pp) | PTE_P | PTE_W | PTE_U;
+	// One invlpg drops the whole 2MB TLB entry
+	tlb_invalidate(pml4e, va);
+	return 0;
 }
 
 //
@@ -693,8 +1522,481 @@ void
 tlb_invalidate(pde_t *pml4e, void *va)
 {
 	// Flush the entry only if we're modifying the current address space.
-	if (!curenv || curenv->env_pml4e == pml4e)
+	// With PCIDs, that is whatever is loaded in CR3, not curenv's.
+	if (PTE_ADDR(rcr3()) == PADDR(pml4e))
 		invlpg(va);
+	// Other CPUs may still cache va under this address space's PCID.
+	pcid_forget(pml4e);
+	// Or be running it right now.
+	tlb_shootdown_add(pml4e, va);
+}
+
+//
+// Invalidate every TLB entry for 'pml4e', on all CPUs.  Cheaper than a
+// tlb_invalidate() per page once many pages of it have changed.
+//
+void
+tlb_invalidate_all(pml4e_t *pml4e)
+{
+	if (PTE_ADDR(rcr3()) == PADDR(pml4e))
+		lcr3(rcr3());
+	pcid_forget(pml4e);
+	tlb_shootdown_all(pml4e);
+}
+
+// --------------------------------------------------------------
+// TLB shootdown.
+//
+// Page tables only change under the big kernel lock, so at most one
+// CPU at a time is ever asking the others to flush.  tlb_invalidate()
+// queues the va in tlb_batch if some other CPU has the address space
+// loaded, and tlb_release() holds back the pages that were mapped
+// there.  tlb_flush() then sends one IPI to each such CPU that is in
+// user mode for the whole batch, waits for them, and frees the pages.  It runs before
+// this CPU lets go of the kernel lock (env_run, sched_halt), i.e. once
+// per system call, or earlier when the batch fills up.
+//
+// A CPU that has the address space loaded but is in the kernel
+// (cpu_tlb_user clear) can't take the IPI until it leaves again, so
+// it isn't waited for but gets cpu_tlb_stale instead, as does a CPU
+// that traps into the kernel while tlb_flush() waits for it.  That CPU
+// flushes its whole TLB once it has the kernel lock (tlb_sync), before
+// it looks at user memory or returns to user mode.  Other CPUs that merely
+// have the address space cached under a PCID are handled by
+// pcid_forget().
+// --------------------------------------------------------------
+
+// Vas batched before the IPIs do a full flush instead of invlpg's
+#define TLB_BATCH	32
+
+static struct {
+	physaddr_t root;		// Address space the batch is for
+	int nva;			// > TLB_BATCH: flush everything
+	uintptr_t va[TLB_BATCH];
+	int nfree;
+	struct PageInfo *free[TLB_BATCH]; // Pages to decref after flushing
+} tlb_batch;
+
+// Whether a CPU other than this one has 'root' loaded.  Those of them
+// in the kernel are marked stale right away.
+static bool
+tlb_remote_cpus(physaddr_t root)
+{
+	struct CpuInfo *c;
+	bool found = 0;
+
+	for (c = cpus; c < cpus + ncpu; c++)
+		if (c != thiscpu && c->cpu_tlb_root == root) {
+			if (!c->cpu_tlb_user)
+				c->cpu_tlb_stale = 1;
+			found = 1;
+		}
+	return found;
+}
+
+static void
+tlb_shootdown_add(pml4e_t *pml4e, void *va)
+{
+	physaddr_t root = PADDR(pml4e);
+
+	if (!tlb_remote_cpus(root))
+		return;
+	if (tlb_batch.nva > 0 && tlb_batch.root != root)
+		tlb_flush();
+	tlb_batch.root = root;
+	if (tlb_batch.nva < TLB_BATCH)
+		tlb_batch.va[tlb_batch.nva] = (uintptr_t) va;
+	tlb_batch.nva++;
+}
+
+// Like tlb_shootdown_add, for every va of the address space.
+static void
+tlb_shootdown_all(pml4e_t *pml4e)
+{
+	physaddr_t root = PADDR(pml4e);
+
+	if (!tlb_remote_cpus(root))
+		return;
+	if (tlb_batch.nva > 0 && tlb_batch.root != root)
+		tlb_flush();
+	tlb_batch.root = root;
+	tlb_batch.nva = TLB_BATCH + 1;
+}
+
+//
+// Drop the reference a just-unmapped page got from its mapping.  If
+// another CPU may still reach the page through its TLB, the page isn't
+// freed before that CPU has flushed (tlb_flush).
+//
+void
+tlb_release(struct PageInfo *pp)
+{
+	if (tlb_batch.nva == 0) {
+		page_decref(pp);
+		return;
+	}
+	if (tlb_batch.nfree == TLB_BATCH)
+		tlb_flush();
+	if (tlb_batch.nva == 0)
+		page_decref(pp);
+	else
+		tlb_batch.free[tlb_batch.nfree++] = pp;
+}
+
+//
+// Make the other CPUs running tlb_batch.root drop the batched vas from
+// their TLBs, or mark them stale if they are in the kernel, then free
+// the pages that were waiting for it.
+// Called with the kernel lock held.
+//
+void
+tlb_flush(void)
+{
+	struct CpuInfo *c;
+	int i;
+
+	if (tlb_batch.nva == 0)
+		return;
+
+	for (c = cpus; c < cpus + ncpu; c++) {
+		if (c == thiscpu || c->cpu_tlb_root != tlb_batch.root)
+			continue;
+		if (c->cpu_tlb_user) {
+			xchg(&c->cpu_tlb_pending, 1);
+			lapic_ipi_cpu(c->cpu_id, T_TLBFLUSH);
+		} else
+			c->cpu_tlb_stale = 1;
+	}
+	for (c = cpus; c < cpus + ncpu; c++) {
+		if (!c->cpu_tlb_pending)
+			continue;
+		while (c->cpu_tlb_pending && c->cpu_tlb_user)
+			asm volatile("pause");
+		if (xchg(&c->cpu_tlb_pending, 0))
+			c->cpu_tlb_stale = 1;
+	}
+
+	for (i = 0; i < tlb_batch.nfree; i++)
+		page_decref(tlb_batch.free[i]);
+	tlb_batch.nva = tlb_batch.nfree = 0;
+}
+
+//
+// Flush everything but global pages from this CPU's TLB if it missed a
+// shootdown while it was entering the kernel.  Called right after
+// taking the kernel lock on a trap from user mode, and again before
+// trap_syscall() returns there without going through env_run.
+//
+void
+tlb_sync(void)
+{
+	if (thiscpu->cpu_tlb_stale) {
+		thiscpu->cpu_tlb_stale = 0;
+		lcr3(rcr3());
+	}
+}
+
+//
+// Handle a T_TLBFLUSH IPI.  Runs without the kernel lock, while the
+// sender waits in tlb_flush().
+//
+void
+tlb_shootdown_ipi(void)
+{
+	struct CpuInfo *c = thiscpu;
+	int i;
+
+	if (c->cpu_tlb_pending) {
+		if (PTE_ADDR(rcr3()) == tlb_batch.root) {
+			if (tlb_batch.nva > TLB_BATCH)
+				lcr3(rcr3());
+			else
+				for (i = 0; i < tlb_batch.nva; i++)
+					invlpg((void *) tlb_batch.va[i]);
+		}
+		c->cpu_tlb_pending = 0;
+	}
+	lapic_eoi();
+}
+
+// --------------------------------------------------------------
+// Range unmapping.
+//
+// page_remove_range() takes down every mapping in a range with one pass
+// over each page-table page, instead of a page_remove() per page with
+// its full walk and invlpg.  Page tables and directories it leaves
+// empty are freed, and the TLB is flushed once at the end.
+// --------------------------------------------------------------
+
+struct UnmapRange {
+	pml4e_t *pml4e;
+	int nva;			// > TLB_BATCH: flush everything
+	uintptr_t va[TLB_BATCH];	// What to invlpg otherwise
+};
+
+// Note that the mapping at 'va' (of any size) is gone.  Must be called
+// before the pages it mapped are passed to tlb_release().
+static void
+unmap_range_note(struct UnmapRange *ur, uintptr_t va)
+{
+	if (ur->nva < TLB_BATCH)
+		ur->va[ur->nva] = va;
+	ur->nva++;
+	tlb_shootdown_add(ur->pml4e, (void *) va);
+}
+
+static bool
+table_empty(uint64_t *table)
+{
+	int i;
+
+	for (i = 0; i < NPTENTRIES; i++)
+		if (table[i] & PTE_P)
+			return 0;
+	return 1;
+}
+
+// Unmap [va, end), which lies within the page table 'pt'.
+static void
+unmap_pt(struct UnmapRange *ur, pte_t *pt, uintptr_t va, uintptr_t end)
+{
+	struct PageInfo *pp;
+
+	for (; va < end; va += PGSIZE) {
+		if (!(pt[PTX(va)] & PTE_P))
+			continue;
+		pp = pa2page(PTE_ADDR(pt[PTX(va)]));
+		pt[PTX(va)] = 0;
+		unmap_range_note(ur, va);
+		tlb_release(pp);
+	}
+}
+
+// Unmap [va, end), which lies within the page directory 'pd', and free
+// the page tables that end up empty.  Returns 0, or -E_NO_MEM if a 2MB
+// page has to be split and there's no memory for that; the pages before
+// it stay unmapped.
+static int
+unmap_pd(struct UnmapRange *ur, pde_t *pd, uintptr_t va, uintptr_t end)
+{
+	uintptr_t next;
+	physaddr_t pa;
+	pte_t *pt;
+	int i;
+
+	for (; va < end; va = next) {
+		next = MIN(ROUNDDOWN(va, PTSIZE) + PTSIZE, end);
+		if (!(pd[PDX(va)] & PTE_P))
+			continue;
+
+		if (pd[PDX(va)] & PTE_PS) {
+			if (next - va == PTSIZE) {
+				pa = PTE_ADDR_PS(pd[PDX(va)], PTSIZE);
+				pd[PDX(va)] = 0;
+				unmap_range_note(ur, va);
+				for (i = 0; i < NPTENTRIES; i++)
+					tlb_release(pa2page(pa + i * PGSIZE));
+				continue;
+			}
+			if (page_split(ur->pml4e, (void *) va) < 0)
+				return -E_NO_MEM;
+		}
+
+		pt = KADDR(PTE_ADDR(pd[PDX(va)]));
+		unmap_pt(ur, pt, va, next);
+		if (table_empty(pt)) {
+			pd[PDX(va)] = 0;
+			unmap_range_note(ur, va);
+			tlb_release(pa2page(PADDR(pt)));
+		}
+	}
+	return 0;
+}
+
+//
+// Unmap every page in [va, va + len) of 'pml4e', which must be page
+// aligned and below UTOP, and free the page tables and page directories
+// this leaves empty.  A 2MB page only partly in the range is split
+// first.  Returns 0, or -E_NO_MEM if there's no memory for a split; the
+// pages before that 2MB page stay unmapped.  A range whose ends are
+// 2MB-aligned never needs a split.
+//
+int
+page_remove_range(pml4e_t *pml4e, void *va, size_t len)
+{
+	struct UnmapRange ur;
+	uintptr_t start = (uintptr_t) va, end = start + len, next;
+	pdpe_t *pdpt;
+	pde_t *pd;
+	int i, r = 0;
+
+	// All of user space is under pml4e[0], which also holds the kernel,
+	// so that PDPT is never freed here
+	static_assert(UTOP <= (1ULL << PML4XSHIFT));
+	assert(start % PGSIZE == 0 && len % PGSIZE == 0);
+	assert(start <= end && end <= UTOP);
+
+	if (!(pml4e[0] & PTE_P))
+		return 0;
+	pdpt = KADDR(PTE_ADDR(pml4e[0]));
+	ur.pml4e = pml4e;
+	ur.nva = 0;
+
+	for (; start < end; start = next) {
+		next = MIN(ROUNDDOWN(start, PDPSIZE) + PDPSIZE, end);
+		if (!(pdpt[PDPX(start)] & PTE_P))
+			continue;
+		assert(!(pdpt[PDPX(start)] & PTE_PS));
+
+		pd = KADDR(PTE_ADDR(pdpt[PDPX(start)]));
+		if ((r = unmap_pd(&ur, pd, start, next)) < 0)
+			break;
+		if (table_empty(pd)) {
+			pdpt[PDPX(start)] = 0;
+			unmap_range_note(&ur, start);
+			tlb_release(pa2page(PADDR(pd)));
+		}
+	}
+
+	if (ur.nva == 0)
+		return r;
+	if (PTE_ADDR(rcr3()) == PADDR(pml4e)) {
+		if (ur.nva > TLB_BATCH)
+			lcr3(rcr3());
+		else
+			for (i = 0; i < ur.nva; i++)
+				invlpg((void *) ur.va[i]);
+	}
+	pcid_forget(pml4e);
+	return r;
+}
+
+// --------------------------------------------------------------
+// Process-context identifiers.
+//
+// With CR4.PCIDE set, TLB entries are tagged with the PCID in CR3, so
+// loading CR3 with CR3_NOFLUSH keeps the entries of every address
+// space instead of flushing them all.  Each CPU hands out PCIDs
+// 1..NPCID_SLOTS to the address spaces (pml4 roots) it has run most
+// recently, recycling them round-robin; PCID 0 is kern_pml4.  A root
+// that loses or never had a PCID on a CPU gets a flushed one there.
+// --------------------------------------------------------------
+
+static bool pcid_enabled;
+
+//
+// Turn on PCIDs on this CPU, if it has them.  Called on each CPU with
+// kern_pml4 loaded, whose PCID is 0 as CR4.PCIDE requires.
+//
+static void
+pcid_init(void)
+{
+	uint32_t ecx;
+
+	cpuid(1, NULL, NULL, &ecx, NULL);
+	if (!(ecx & (1 << 17))) {	// CPUID.01H:ECX.PCID
+		if (cpunum() == 0)
+			cprintf("PCID: not supported\n");
+		return;
+	}
+	if (cpunum() == 0)
+		pcid_enabled = 1;
+	if (pcid_enabled)
+		lcr4(rcr4() | CR4_PCIDE);
+}
+
+//
+// Set up this CPU's TLB once kern_pml4 is loaded: keep the PTE_G
+// kernel mappings from boot_map_region across address space switches,
+// and use PCIDs for the rest.
+//
+// The only leaves with PTE_G are boot_map_region's, and env_setup_vm's
+// copies of them, whose translation is the same everywhere.  Nothing
+// per-environment may be global: the UVPT self-map is a non-leaf
+// pml4 entry without PTE_G, and PTE_SYSCALL keeps PTE_G out of user
+// mappings.
+//
+void
+tlb_init(void)
+{
+	lcr4(rcr4() | CR4_PGE);
+	pcid_init();
+}
+
+//
+// Switch this CPU to the address space 'pml4e', keeping its TLB
+// entries if it still owns a PCID here.
+//
+void
+pml4e_load(pml4e_t *pml4e)
+{
+	struct CpuInfo *c = thiscpu;
+	physaddr_t root = PADDR(pml4e);
+	int i;
+
+	c->cpu_tlb_root = root;
+	if (!pcid_enabled) {
+		lcr3(root);
+		return;
+	}
+	if (pml4e == kern_pml4) {
+		lcr3(root | CR3_NOFLUSH);
+		return;
+	}
+	for (i = 0; i < NPCID_SLOTS; i++)
+		if (c->cpu_pcid_root[i] == root) {
+			lcr3(root | (i + 1) | CR3_NOFLUSH);
+			return;
+		}
+
+	i = c->cpu_pcid_next;
+	c->cpu_pcid_next = (i + 1) % NPCID_SLOTS;
+	c->cpu_pcid_root[i] = root;
+	lcr3(root | (i + 1));
+}
+
+//
+// Whether 'pml4e' is loaded on this CPU with a PCID it still owns, so
+// its TLB entries are up to date.  If pcid_forget() took the PCID away,
+// the address space changed and has to be loaded again.
+//
+bool
+pml4e_loaded(pml4e_t *pml4e)
+{
+	struct CpuInfo *c = thiscpu;
+	physaddr_t root = PADDR(pml4e);
+	int i;
+
+	if (PTE_ADDR(rcr3()) != root)
+		return 0;
+	if (!pcid_enabled)
+		return 1;
+	for (i = 0; i < NPCID_SLOTS; i++)
+		if (c->cpu_pcid_root[i] == root)
+			return 1;
+	return 0;
+}
+
+//
+// Make every CPU flush the TLB entries of 'pml4e' the next time it
+// loads it: take away its PCIDs, except on this CPU if it's loaded here
+// (the caller keeps that TLB up to date with invlpg).  Must be called
+// when page table entries of 'pml4e' change, and when 'pml4e' is freed
+// so a new address space in the same page doesn't inherit its entries.
+//
+void
+pcid_forget(pml4e_t *pml4e)
+{
+	physaddr_t root = PADDR(pml4e);
+	int i, j;
+
+	if (!pcid_enabled || pml4e == kern_pml4)
+		return;
+	for (i = 0; i < ncpu; i++)
+		for (j = 0; j < NPCID_SLOTS; j++)
+			if (cpus[i].cpu_pcid_root[j] == root
+			    && (&cpus[i] != thiscpu || PTE_ADDR(rcr3()) != root))
+				cpus[i].cpu_pcid_root[j] = 0;
 }
 
 //
@@ -768,8 +2070,8 @@ static uintptr_t user_mem_check_addr;
 // and -E_FAULT otherwise.
 //
 /*
-- for every page, obtain a struct PageInfo using page_lookup() and env->env_pml4e
-	- must return -E_FAULT if no PageInfo found, doesn't contain perms, or page is above ULIM
+- walk the pages of the range with a pte_iter over env->env_pml4e
+	- must return -E_FAULT if a page isn't mapped, doesn't contain perms, or page is above ULIM
 - 
 */
 int
@@ -781,24 +2083,33 @@ user_mem_check(struct Env *env, const void *va, size_t len, int perm)
     uintptr_t end_va = start_va + len;
     
     uintptr_t cur_va = ROUNDDOWN(start_va, PGSIZE);
+    uintptr_t check_end = (end_va < start_va) ? ULIM : MIN(end_va, ULIM);
+    struct PteIter it;
+    int r;
     
-    while (cur_va < end_va) {
-        if (cur_va >= ULIM) {
-            user_mem_check_addr = (cur_va < start_va) ? start_va : cur_va;
-            return -E_FAULT;
+    // every page below ULIM must be mapped (the iterator skips holes,
+    // so a hole shows up as an entry starting past cur_va), and the
+    // page table must give permission; a 2MB page is checked all at once
+    pte_iter_init(&it, env->env_pml4e, (void *)cur_va, MAX(check_end, cur_va) - cur_va, 0);
+    while (cur_va < check_end) {
+        r = pte_iter_next(&it);
+        if ((r <= 0 || it.pi_va != cur_va) && env_load_page(env, cur_va) == 0) {
+            // a page of the program image the env hadn't touched yet
+            pte_iter_seek(&it, (void *)cur_va);
+            continue;
         }
-        
-        // page table must give permission
-        pte_t *pte;
-        struct PageInfo *pp = page_lookup(env->env_pml4e, (void *)cur_va, &pte);
-        
-        // Must have a valid page with required permissions
-        if (pp == NULL || (*pte & (perm | PTE_P)) != (perm | PTE_P)) {
+        if (r <= 0 || it.pi_va != cur_va
+            || (*it.pi_pte & (perm | PTE_P)) != (perm | PTE_P)) {
             user_mem_check_addr = (cur_va < start_va) ? start_va : cur_va;
             return -E_FAULT;
         }
-        
-        cur_va += PGSIZE;
+        cur_va = it.pi_next;
+    }
+    
+    if (check_end != end_va) {
+        cur_va = MAX(cur_va, ULIM);
+        user_mem_check_addr = (cur_va < start_va) ? start_va : cur_va;
+        return -E_FAULT;
     }
 
 	return 0;
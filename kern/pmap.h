@@ -9,6 +9,7 @@
 #include <inc/memlayout.h>
 #include <inc/assert.h>
 struct Env;
+struct BootInfo;
 
 extern char bootstacktop[], bootstack[];
 
@@ -51,17 +52,52 @@ enum {
 	ALLOC_ZERO = 1<<0,
 };
 
-void	mem_init(void);
+// Largest block page_alloc_order() can hand out is 2^PAGE_MAX_ORDER pages.
+#define PAGE_MAX_ORDER	10
+
+void	mem_init(struct BootInfo *bootinfo);
 
 void	page_init(void);
 struct PageInfo *page_alloc(int alloc_flags);
 void	page_free(struct PageInfo *pp);
+struct PageInfo *page_alloc_order(int order, int alloc_flags);
+void	page_free_order(struct PageInfo *pp, int order);
+void	page_print_stats(void);
+void	page_zero_idle(void);
 int	page_insert(pml4e_t *pml4e, struct PageInfo *pp, void *va, int perm);
-void	page_remove(pml4e_t *pml4e, void *va);
+int	page_remove(pml4e_t *pml4e, void *va);
+int	page_remove_range(pml4e_t *pml4e, void *va, size_t len);
 struct PageInfo *page_lookup(pml4e_t *pml4e, void *va, pte_t **pte_store);
 void	page_decref(struct PageInfo *pp);
+int	page_insert_huge(pml4e_t *pml4e, struct PageInfo *pp, void *va, int perm);
+int	page_split(pml4e_t *pml4e, void *va);
+
+// Iterates over the page table entries of a range; see pte_iter_next.
+struct PteIter {
+	uintptr_t pi_va;		// Current entry applies from here...
+	size_t pi_size;			// ...and maps this many bytes
+	pte_t *pi_pte;			// Current entry (a PDE/PDPE if PTE_PS)
+	uintptr_t pi_next;		// Where the next entry's search starts
+	uintptr_t pi_end;
+	int pi_create;
+	uint64_t *pi_table[4];		// PML4, PDPT, PD and PT last walked
+	uintptr_t pi_base[4];		// Start of what pi_table[l] maps
+};
+
+void	pte_iter_init(struct PteIter *it, pml4e_t *pml4e, const void *va, size_t len, int create);
+int	pte_iter_next(struct PteIter *it);
+void	pte_iter_seek(struct PteIter *it, const void *va);
 
 void	tlb_invalidate(pml4e_t *pml4e, void *va);
+void	tlb_invalidate_all(pml4e_t *pml4e);
+void	tlb_release(struct PageInfo *pp);
+void	tlb_flush(void);
+void	tlb_sync(void);
+void	tlb_shootdown_ipi(void);
+void	tlb_init(void);
+void	pml4e_load(pml4e_t *pml4e);
+bool	pml4e_loaded(pml4e_t *pml4e);
+void	pcid_forget(pml4e_t *pml4e);
 
 void *	mmio_map_region(physaddr_t pa, size_t size);
 
@@ -90,5 +126,6 @@ page2kva(struct PageInfo *pp)
 pte_t *pml4e_walk(pml4e_t *pml4e, const void *va, int create);
 pte_t *pdpe_walk(pdpe_t *pdpe,const void *va,int create);
 pte_t *pgdir_walk(pde_t *pgdir, const void *va, int create);
+pte_t *pml4e_walk_leaf(pml4e_t *pml4e, const void *va, size_t *size_store);
 
 #endif /* !JOS_KERN_PMAP_H */
@@ -3,60 +3,112 @@
 // --------------------------------------------------------------
 
 //
-// Check that the pages on the page_free_list are reasonable.
+// Take every free block out of the buddy allocator and chain the
+// blocks together through pp_link, so a check can run with no free
+// memory.  Each block keeps its order in pp_order.
+//
+static struct PageInfo *
+steal_free_pages(void)
+{
+	struct PageInfo *pp, *fl = NULL;
+	int k;
+
+	for (k = 0; k <= PAGE_MAX_ORDER; k++)
+		while ((pp = free_area[k].fa_list)) {
+			free_area_del(pp, k);
+			pp->pp_link = fl;
+			fl = pp;
+		}
+	return fl;
+}
+
+//
+// Give back blocks taken by steal_free_pages().
 //
 static void
-check_page_free_list(bool only_low_memory)
+return_free_pages(struct PageInfo *fl)
 {
 	struct PageInfo *pp;
+
+	while ((pp = fl)) {
+		fl = pp->pp_link;
+		pp->pp_link = NULL;
+		buddy_free(pp, pp->pp_order);
+	}
+}
+
+//
+// Count the pages currently free in the buddy allocator.
+//
+static size_t
+count_free_pages(void)
+{
+	size_t nfree = 0;
+	int k;
+
+	for (k = 0; k <= PAGE_MAX_ORDER; k++)
+		nfree += free_area[k].fa_nfree << k;
+	return nfree;
+}
+
+//
+// Check that the pages in the buddy allocator's free lists are
+// reasonable.
+//
+static void
+check_page_free_list(bool only_low_memory)
+{
+	struct PageInfo *blk, *pp;
 	unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
 	uint64_t nfree_basemem = 0, nfree_extmem = 0;
 	char *first_free_page;
+	size_t nblocks;
+	int k, i;
 
-	if (!page_free_list)
-		panic("'page_free_list' is a null pointer!");
-
-	if (only_low_memory) {
-		// Move pages with lower addresses first in the free
-		// list, since entry_pgdir does not map all pages.
-		struct PageInfo *pp1, *pp2;
-		struct PageInfo **tp[2] = { &pp1, &pp2 };
-		for (pp = page_free_list; pp; pp = pp->pp_link) {
-			int pagetype = PDX(page2pa(pp)) >= pdx_limit;
-			*tp[pagetype] = pp;
-			tp[pagetype] = &pp->pp_link;
-		}
-		*tp[1] = 0;
-		*tp[0] = pp2;
-		page_free_list = pp1;
-	}
+	if (count_free_pages() == 0)
+		panic("no free pages in the buddy allocator!");
 
 	// if there's a page that shouldn't be on the free list,
 	// try to make sure it eventually causes trouble.
-	for (pp = page_free_list; pp; pp = pp->pp_link)
-		if (PDX(page2pa(pp)) < pdx_limit)
-			memset(page2kva(pp), 0x97, 128);
+	for (k = 0; k <= PAGE_MAX_ORDER; k++)
+		for (blk = free_area[k].fa_list; blk; blk = blk->pp_link)
+			for (i = 0; i < (1 << k); i++)
+				if (PDX(page2pa(blk + i)) < pdx_limit)
+					memset(page2kva(blk + i), 0x97, 128);
 
 	first_free_page = (char *) boot_alloc(0);
-	for (pp = page_free_list; pp; pp = pp->pp_link) {
-		// check that we didn't corrupt the free list itself
-		assert(pp >= pages);
-		assert(pp < pages + npages);
-		assert(((char *) pp - (char *) pages) % sizeof(*pp) == 0);
-
-		// check a few pages that shouldn't be on the free list
-		assert(page2pa(pp) != 0);
-		assert(page2pa(pp) != IOPHYSMEM);
-		assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
-		assert(page2pa(pp) != EXTPHYSMEM);
-		assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
-		// (new test for lab 4)
-		assert(page2pa(pp) != MPENTRY_PADDR);
-
-		if (page2pa(pp) < EXTPHYSMEM)
-			++nfree_basemem;
-		else
-			++nfree_extmem;
+	for (k = 0; k <= PAGE_MAX_ORDER; k++) {
+		nblocks = 0;
+		for (blk = free_area[k].fa_list; blk; blk = blk->pp_link) {
+			// check that we didn't corrupt the free lists themselves
+			assert(blk >= pages);
+			assert(blk + (1 << k) <= pages + npages);
+			assert(((char *) blk - (char *) pages) % sizeof(*blk) == 0);
+			assert(((blk - pages) & ((1 << k) - 1)) == 0);
+			assert((blk->pp_flags & PP_FREE) && blk->pp_order == k);
+			assert(!blk->pp_link || blk->pp_link->pp_prev == blk);
+			++nblocks;
+
+			for (i = 0; i < (1 << k); i++) {
+				pp = blk + i;
+				assert(pp->pp_ref == 0);
+
+				// check a few pages that shouldn't be on the free list
+				assert(page2pa(pp) != 0);
+				assert(page2pa(pp) != IOPHYSMEM);
+				assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
+				assert(page2pa(pp) != EXTPHYSMEM);
+				assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+				// (new test for lab 4)
+				assert(page2pa(pp) != MPENTRY_PADDR);
+
+				if (page2pa(pp) < EXTPHYSMEM)
+					++nfree_basemem;
+				else
+					++nfree_extmem;
+			}
+		}
+		assert(nblocks == free_area[k].fa_nfree);
 	}
 
 	assert((nfree_basemem > 0)|!only_low_memory);
@@ -82,8 +134,7 @@ check_page_alloc(void)
 		panic("'pages' is a null pointer!");
 
 	// check number of free pages
-	for (pp = page_free_list, nfree = 0; pp; pp = pp->pp_link)
-		++nfree;
+	nfree = count_free_pages();
 
 	// should be able to allocate three pages
 	pp0 = pp1 = pp2 = 0;
@@ -99,8 +150,7 @@ check_page_alloc(void)
 	assert(page2pa(pp2) < npages*PGSIZE);
 
 	// temporarily steal the rest of the free pages
-	fl = page_free_list;
-	page_free_list = 0;
+	fl = steal_free_pages();
 
 	// should be no free memory
 	assert(!page_alloc(0));
@@ -128,7 +178,7 @@ check_page_alloc(void)
 		assert(c[i] == 0);
 
 	// give free list back
-	page_free_list = fl;
+	return_free_pages(fl);
 
 	// free the pages we took
 	page_free(pp0);
@@ -136,9 +186,18 @@ check_page_alloc(void)
 	page_free(pp2);
 
 	// number of free pages should be the same
-	for (pp = page_free_list; pp; pp = pp->pp_link)
-		--nfree;
-	assert(nfree == 0);
+	assert(nfree == count_free_pages());
+
+	// multi-page blocks should be contiguous, aligned and coalesce back
+	assert((pp0 = page_alloc_order(2, ALLOC_ZERO)));
+	assert(((pp0 - pages) & 3) == 0);
+	c = page2kva(pp0);
+	for (i = 0; i < 4 * PGSIZE; i++)
+		assert(c[i] == 0);
+	assert(nfree - 4 == count_free_pages());
+	page_free_order(pp0, 2);
+	assert(nfree == count_free_pages());
+	assert(!page_alloc_order(PAGE_MAX_ORDER + 1, 0));
 
 	cprintf("check_page_alloc() succeeded!\n");
 }
@@ -184,25 +243,27 @@ check_kern_pml4e(void)
 			assert(check_va2pa(pml4e, base + i) == ~0);
 	}
 	pdpe_t *pdpe = KADDR(PTE_ADDR(kern_pml4[PML4X(KERNBASE)]));
-	pde_t  *pgdir = KADDR(PTE_ADDR(pdpe[PDPX(KERNBASE)]));
-	// check PDE permissions
-	for (i = 0; i < NPDENTRIES; i++) {
-		switch (i) {
-		//case PDX(UVPT):??
-		case PDX(KSTACKTOP-1):
-		case PDX(UPAGES):
-		case PDX(UENVS):
-		case PDX(MMIOBASE):
-			assert(pgdir[i] & PTE_P);
-			break;
-		default://changed to handle new memory space
-			if (i >= PDX(KERNBASE)) {
-				if (pgdir[i] & PTE_P)
-					assert(pgdir[i] & PTE_W);
-				else
-					assert(pgdir[i] == 0);
-			} 
-			break;
+	pde_t  *pgdir = KADDR(PTE_ADDR(pdpe[PDPX(KSTACKTOP-1)]));
+	// check PDE permissions below KERNBASE
+	assert(pgdir[PDX(KSTACKTOP-1)] & PTE_P);
+	assert(pgdir[PDX(UPAGES)] & PTE_P);
+	assert(pgdir[PDX(UENVS)] & PTE_P);
+	assert(pgdir[PDX(MMIOBASE)] & PTE_P);
+
+	// the direct map is writable, whether it's mapped with 1GB pages
+	// or through page directories
+	for (n = PDPX(KERNBASE); n < NPDENTRIES; n++) {
+		if (!(pdpe[n] & PTE_P))
+			continue;
+		assert(pdpe[n] & PTE_W);
+		if (pdpe[n] & PTE_PS)
+			continue;
+		pgdir = KADDR(PTE_ADDR(pdpe[n]));
+		for (i = 0; i < NPDENTRIES; i++) {
+			if (pgdir[i] & PTE_P)
+				assert(pgdir[i] & PTE_W);
+			else
+				assert(pgdir[i] == 0);
 		}
 	}
 	cprintf("check_kern_pml4e() succeeded!\n");
@@ -228,12 +289,16 @@ check_va2pa(pml4e_t *pml4e, uintptr_t va)
 	// cprintf(" %x %x " , pdpe, *pdpe);
 	if (!(pdpe[PDPX(va)] & PTE_P))
 		return ~0;
+	if (pdpe[PDPX(va)] & PTE_PS)
+		return PTE_ADDR_PS(pdpe[PDPX(va)], PDPSIZE) + (va & (PDPSIZE - 1) & ~0xFFF);
 
 	pgdir = (pde_t *) KADDR(PTE_ADDR(pdpe[PDPX(va)]));
 
 	pgdir = &pgdir[PDX(va)];
 	if (!(*pgdir & PTE_P))
 		return ~0;
+	if (*pgdir & PTE_PS)
+		return PTE_ADDR_PS(*pgdir, PTSIZE) + (va & (PTSIZE - 1) & ~0xFFF);
 	p = (pte_t*) KADDR(PTE_ADDR(*pgdir));
 	if (!(p[PTX(va)] & PTE_P))
 		return ~0;
@@ -270,8 +335,7 @@ check_page(void)
 	assert(pp5 && pp5 != pp4 && pp5 != pp3 && pp5 != pp2 && pp5 != pp1 && pp5 != pp0);
 
 	// temporarily steal the rest of the free pages
-	fl = page_free_list;
-	page_free_list = NULL;
+	fl = steal_free_pages();
 
 	// should be no free memory
 	assert(!page_alloc(0));
@@ -387,7 +451,7 @@ check_page(void)
 	kern_pml4[0] = 0;
 
 	// give free list back
-	page_free_list = fl;
+	return_free_pages(fl);
 
 	// free the pages we took
 	page_decref(pp0);
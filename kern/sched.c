@@ -4,6 +4,8 @@
 #include <kern/env.h>
 #include <kern/pmap.h>
 #include <kern/monitor.h>
+#include <kern/syscall.h>
+#include <kern/fpu.h>
 
 void sched_halt(void);
 
@@ -75,6 +77,16 @@ sched_halt(void)
 {
 	int i;
 
+	// Another CPU may run this CPU's last env next, so put its FPU
+	// state where that CPU can find it.
+	fpu_release();
+
+	// Before going idle, carry out the ring requests of blocked envs.
+	// That may have woken some env up (sys_ipc_try_send), so look
+	// again for something to run.
+	if (ring_drain_idle())
+		sched_yield();
+
 	// For debugging and testing purposes, if there are no runnable
 	// environments in the system, then drop into the kernel monitor.
 	for (i = 0; i < NENV; i++) {
@@ -91,7 +103,9 @@ sched_halt(void)
 
 	// Mark that no environment is running on this CPU
 	curenv = NULL;
-	lcr3(PADDR(kern_pml4));
+	uinfo->ui_cpu[cpunum()].uc_env = 0;
+	tlb_flush();
+	pml4e_load(kern_pml4);
 
 	// Mark that this CPU is in the HALT state, so that when
 	// timer interupts come in, we know we should re-acquire the
@@ -101,6 +115,10 @@ sched_halt(void)
 	// Release the big kernel lock as if we were "leaving" the kernel
 	unlock_kernel();
 
+	// Put the idle time to use: pre-zero some free pages so that
+	// page_alloc(ALLOC_ZERO) doesn't have to.
+	page_zero_idle();
+
 	// Reset stack pointer, enable interrupts and then halt.
 	asm volatile (
 		"movq $0, %%rbp\n"
@@ -113,6 +131,6 @@ sched_halt(void)
 		"1:\n"
 		"hlt\n"
 		"jmp 1b\n"
-	: : "a" (thiscpu->cpu_ts.RSP[0]));
+	: : "a" (thiscpu->cpu_syscall.sc_kstack));
 }
 
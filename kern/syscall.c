@@ -11,6 +11,7 @@
 #include <kern/syscall.h>
 #include <kern/console.h>
 #include <kern/sched.h>
+#include <kern/fpu.h>
 
 // Print a string to the system console.
 // The string is exactly 'len' characters long.
@@ -103,10 +104,239 @@ sys_exofork(void)
 	e->env_status = ENV_NOT_RUNNABLE;
 	e->env_tf = curenv->env_tf;
 	e->env_tf.tf_regs.reg_rax = 0;
+	e->env_binary = curenv->env_binary;
+	if ((r = fpu_env_copy(e, curenv)) < 0
+	    || (r = env_image_copy(e, curenv)) < 0) {
+		env_free(e);
+		return r;
+	}
 	
 	return e->env_id;
 }
 
+// Fork the current environment in one system call: the child gets a
+// copy-on-write copy of the parent's address space (see env_copy_cow),
+// a fresh user exception stack and the same page fault upcall, and is
+// runnable when this returns.  In the child, sys_fork returns 0.
+//
+// Returns envid of new environment, or < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_NO_MEM on memory exhaustion.
+static envid_t
+sys_fork(void)
+{
+	struct Env *e;
+	int r;
+
+	if ((r = env_alloc(&e, curenv->env_id)) < 0)
+		return r;
+	e->env_tf = curenv->env_tf;
+	e->env_tf.tf_regs.reg_rax = 0;
+	e->env_pgfault_upcall = curenv->env_pgfault_upcall;
+	e->env_binary = curenv->env_binary;
+	if ((r = fpu_env_copy(e, curenv)) < 0
+	    || (r = env_image_copy(e, curenv)) < 0) {
+		env_free(e);
+		return r;
+	}
+
+	if ((r = env_copy_cow(e, curenv)) < 0) {
+		env_free(e);
+		return r;
+	}
+	e->env_status = ENV_RUNNABLE;
+	return e->env_id;
+}
+
+// Check that the current env can read the NUL-terminated string 's',
+// and return its length, or -E_FAULT if it can't.
+static ssize_t
+user_strlen_check(const char *s)
+{
+	size_t len;
+
+	for (len = 0; ; len++) {
+		if (len == 0 || ((uintptr_t) (s + len) & (PGSIZE - 1)) == 0)
+			if (user_mem_check(curenv, s + len, 1, PTE_U) < 0)
+				return -E_FAULT;
+		if (s[len] == '\0')
+			return len;
+	}
+}
+
+// Like user_strlen_check, but destroys the env if it can't read 's'.
+static size_t
+user_strlen_assert(const char *s)
+{
+	ssize_t len;
+
+	if ((len = user_strlen_check(s)) < 0)
+		user_mem_assert(curenv, s, 1, PTE_U);	// doesn't return
+	return len;
+}
+
+#define SPAWN_MAXARGS	32
+
+// Build the initial stack page of a spawned env in 'stack', a kernel
+// page, from the current env's argument vector 'argv' (ending with
+// NULL): the strings go at the top, the argv array right below them.
+// On success, *argcp is argc and *topp is the offset of the argv array,
+// which is also where the stack starts.
+// Returns 0, -E_FAULT if the current env can't read argv or one of the
+// strings, or -E_INVAL if the arguments don't fit in one page.
+static int
+spawn_build_stack(char *stack, const char **argv, int *argcp, size_t *topp)
+{
+	uintptr_t uargv[SPAWN_MAXARGS + 1];
+	uintptr_t stackbase = USTACKTOP - PGSIZE;
+	size_t top = PGSIZE, len;
+	ssize_t slen;
+	int argc;
+
+	// the strings go at the top of the stack page...
+	for (argc = 0; ; argc++) {
+		if (user_mem_check(curenv, &argv[argc], sizeof(argv[argc]), PTE_U) < 0)
+			return -E_FAULT;
+		if (!argv[argc])
+			break;
+		if (argc == SPAWN_MAXARGS)
+			return -E_INVAL;
+		if ((slen = user_strlen_check(argv[argc])) < 0)
+			return slen;
+		len = slen + 1;
+		if (len > top)
+			return -E_INVAL;
+		top -= len;
+		memcpy(stack + top, argv[argc], len);
+		stack[top + len - 1] = '\0';
+		uargv[argc] = stackbase + top;
+	}
+	uargv[argc] = 0;
+
+	// ...and the argv array right below them
+	len = (argc + 1) * sizeof(uargv[0]);
+	if (len > top)
+		return -E_INVAL;
+	top = ROUNDDOWN(top - len, 16);
+	memcpy(stack + top, uargv, len);
+
+	*argcp = argc;
+	*topp = top;
+	return 0;
+}
+
+// Create a new env running the program embedded in the kernel as
+// user/'name', with arguments 'argv' (ending with NULL; argv[0] is
+// conventionally the program name).  Unlike fork, nothing of the
+// current env is copied.  The new env is runnable when this returns.
+//
+// Returns envid of new environment, or < 0 on error.  Errors are:
+//	-E_INVAL if there is no such program, or the arguments are
+//		too big.
+//	-E_FAULT if argv or one of its strings isn't readable.
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_NO_MEM on memory exhaustion.
+static envid_t
+sys_spawn(const char *name, const char **argv)
+{
+	uintptr_t stackbase = USTACKTOP - PGSIZE;
+	struct PageInfo *pp;
+	uint8_t *binary;
+	struct Env *e;
+	size_t top;
+	int argc, r;
+
+	user_strlen_assert(name);
+	if (!(binary = env_binary_lookup(name)))
+		return -E_INVAL;
+
+	// The arguments are checked and copied in before the env exists,
+	// so a bad argv never leaves a half-built env behind.
+	if (!(pp = page_alloc(0)))
+		return -E_NO_MEM;
+	if ((r = spawn_build_stack(page2kva(pp), argv, &argc, &top)) < 0
+	    || (r = env_spawn(&e, binary, curenv->env_id)) < 0) {
+		page_free(pp);
+		return r;
+	}
+
+	// Runnable already, but nobody else runs while we hold the lock
+	memcpy((char *) page2kva(page_lookup(e->env_pml4e, (void *) stackbase, NULL)) + top,
+	       (char *) page2kva(pp) + top, PGSIZE - top);
+	page_free(pp);
+	e->env_tf.tf_regs.reg_rdi = argc;
+	e->env_tf.tf_regs.reg_rsi = stackbase + top;
+	e->env_tf.tf_rsp = stackbase + top;
+	return e->env_id;
+}
+
+// Map fresh zeroed user pages at [va, va + len) in e.
+static int
+thread_stack_alloc(struct Env *e, uintptr_t va, size_t len)
+{
+	struct PageInfo *pp;
+	uintptr_t end = va + len;
+	int r;
+
+	for (; va < end; va += PGSIZE) {
+		if (!(pp = page_alloc(ALLOC_ZERO)))
+			return -E_NO_MEM;
+		if ((r = page_insert(e->env_pml4e, pp, (void *) va, PTE_U | PTE_W)) < 0) {
+			page_free(pp);
+			return r;
+		}
+	}
+	return 0;
+}
+
+// Create a thread: a new env that shares the current env's address
+// space (see env_share_vm) and page fault upcall.  It gets its own
+// stack and user exception stack in the thread slot for its env index
+// (UTHREADSTACKTOP, UTHREADXSTACKTOP), and starts at 'entry' as if it
+// had been called with arguments 'a1' and 'a2'.  It is runnable when
+// this returns, and exits on its own; the address space goes away
+// with the last env using it.
+//
+// Returns envid of new thread, or < 0 on error.  Errors are:
+//	-E_INVAL if entry is not below UTOP.
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_NO_MEM on memory exhaustion.
+static envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	struct Env *e;
+	int i, r;
+
+	if ((uintptr_t) entry >= UTOP)
+		return -E_INVAL;
+	if ((r = env_alloc(&e, curenv->env_id)) < 0)
+		return r;
+	env_share_vm(e, curenv);
+
+	i = ENVX(e->env_id);
+	if ((r = thread_stack_alloc(e, UTHREADXSTACKTOP(i) - PGSIZE, PGSIZE)) < 0
+	    || (r = thread_stack_alloc(e, UTHREADSTACKTOP(i) - THREADSTKSIZE,
+				       THREADSTKSIZE)) < 0) {
+		// the stacks are in the creator's address space too, and
+		// env_free only drops e's reference to it
+		page_remove_range(e->env_pml4e,
+				  (void *) (uintptr_t) (UTHREADSTACKTOP(i) - THREADSTKSIZE),
+				  UTHREADXSTACKTOP(i) - (UTHREADSTACKTOP(i) - THREADSTKSIZE));
+		env_free(e);
+		return r;
+	}
+
+	e->env_tf.tf_rip = (uintptr_t) entry;
+	e->env_tf.tf_regs.reg_rdi = a1;
+	e->env_tf.tf_regs.reg_rsi = a2;
+	// leave room for the return address a call would have pushed
+	e->env_tf.tf_rsp = UTHREADSTACKTOP(i) - 8;
+	e->env_uxstacktop = UTHREADXSTACKTOP(i);
+	e->env_pgfault_upcall = curenv->env_pgfault_upcall;
+	e->env_binary = curenv->env_binary;
+	return e->env_id;
+}
+
 // Set envid's env_status to status, which must be ENV_RUNNABLE
 // or ENV_NOT_RUNNABLE.
 //
@@ -229,6 +459,43 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 	return 0;
 }
 
+// Allocate 2MB of zeroed, physically contiguous memory and map it at
+// 'va' in 'envid's address space with a single large-page mapping.
+// 'va' must be 2MB-aligned; otherwise this behaves like sys_page_alloc,
+// including replacing whatever was mapped in [va, va + 2MB).  The
+// mapping is split into 4KB pages by the kernel as soon as part of it
+// is unmapped or remapped (e.g. copy-on-write by fork).
+//
+// Return 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if va >= UTOP, or va is not 2MB-aligned.
+//	-E_INVAL if perm is inappropriate (see sys_page_alloc).
+//	-E_NO_MEM if there's no 2MB block of free memory or no memory
+//		for the page directory.
+static int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	struct Env *e;
+	struct PageInfo *pp;
+	int r;
+
+	if ((r = envid2env(envid, &e, 1)) < 0)
+		return -E_BAD_ENV;
+	if ((uintptr_t) va % PTSIZE != 0 || (uintptr_t) va + PTSIZE > UTOP)
+		return -E_INVAL;
+	if (perm & ~PTE_SYSCALL)
+		return -E_INVAL;
+
+	if (!(pp = page_alloc_order(PTSHIFT - PGSHIFT, ALLOC_ZERO)))
+		return -E_NO_MEM;
+	if ((r = page_insert_huge(e->env_pml4e, pp, va, perm | PTE_U | PTE_P)) < 0) {
+		page_free_order(pp, PTSHIFT - PGSHIFT);
+		return r;
+	}
+	return 0;
+}
+
 // Map the page of memory at 'srcva' in srcenvid's address space
 // at 'dstva' in dstenvid's address space with permission 'perm'.
 // Perm has the same restrictions as in sys_page_alloc, except
@@ -304,6 +571,7 @@ sys_page_map(envid_t srcenvid, void *srcva,
         return -E_INVAL;
     }
 
+    env_load_page(srcenv, (uintptr_t)srcva);
     p = page_lookup(srcenv->env_pml4e, srcva, &pte);
     if (p == NULL) {
         return -E_INVAL;
@@ -328,6 +596,8 @@ sys_page_map(envid_t srcenvid, void *srcva,
 //	-E_BAD_ENV if environment envid doesn't currently exist,
 //		or the caller doesn't have permission to change envid.
 //	-E_INVAL if va >= UTOP, or va is not page-aligned.
+//	-E_NO_MEM if va is in a 2MB page and there's no memory to split it,
+//		or none to record that va was unmapped (env_image_unmap).
 static int
 sys_page_unmap(envid_t envid, void *va)
 {
@@ -352,7 +622,150 @@ sys_page_unmap(envid_t envid, void *va)
 	if ((uintptr_t)va >= UTOP) {
 		return -E_INVAL;
 	}
-	page_remove(e->env_pml4e, va);
+	if ((r = env_image_unmap(e, (uintptr_t) va, PGSIZE)) < 0) {
+		return r;
+	}
+	return page_remove(e->env_pml4e, va);
+}
+
+// Unmap every page in [va, va + len) in the address space of 'envid',
+// and free the page tables that only mapped that range.  Unmapped pages
+// in the range are skipped silently.
+//
+// Return 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if va or len is not page-aligned, or the range
+//		doesn't lie below UTOP.
+//	-E_NO_MEM if a 2MB page only partly in the range has to be split
+//		and there's no memory for that.  The pages before it in
+//		the range are unmapped.  Also if there's no memory to
+//		record the range as unmapped (env_image_unmap); then
+//		nothing is.
+static int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	struct Env *e;
+	int r;
+
+	if (envid2env(envid, &e, 1) < 0)
+		return -E_BAD_ENV;
+	if ((uintptr_t) va % PGSIZE != 0 || len % PGSIZE != 0)
+		return -E_INVAL;
+	if ((uintptr_t) va >= UTOP || len > UTOP - (uintptr_t) va)
+		return -E_INVAL;
+	if ((r = env_image_unmap(e, (uintptr_t) va, len)) < 0)
+		return r;
+	return page_remove_range(e->env_pml4e, va, len);
+}
+
+// Descriptors sys_page_batch copies in and checks at a time
+#define PAGE_BATCH_CHUNK	32
+
+// Check everything about 'op' that doesn't depend on what is mapped.
+static int
+page_op_check(const struct PageOp *op)
+{
+	if ((uintptr_t) op->po_dstva % PGSIZE != 0 || (uintptr_t) op->po_dstva >= UTOP)
+		return -E_INVAL;
+	switch (op->po_op) {
+	case PAGEOP_ALLOC:
+		if (op->po_perm & ~PTE_SYSCALL)
+			return -E_INVAL;
+		return 0;
+	case PAGEOP_MAP:
+		if ((uintptr_t) op->po_srcva % PGSIZE != 0
+		    || (uintptr_t) op->po_srcva >= UTOP)
+			return -E_INVAL;
+		if ((op->po_perm & ~PTE_SYSCALL)
+		    || (op->po_perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P))
+			return -E_INVAL;
+		return 0;
+	case PAGEOP_UNMAP:
+		return 0;
+	default:
+		return -E_INVAL;
+	}
+}
+
+// Carry out 'op', which passed page_op_check, from srcenv to dstenv.
+static int
+page_op_apply(struct Env *srcenv, struct Env *dstenv, const struct PageOp *op)
+{
+	struct PageInfo *pp;
+	pte_t *pte;
+	int r;
+
+	switch (op->po_op) {
+	case PAGEOP_ALLOC:
+		if (!(pp = page_alloc(ALLOC_ZERO)))
+			return -E_NO_MEM;
+		if ((r = page_insert(dstenv->env_pml4e, pp, op->po_dstva,
+				     op->po_perm | PTE_U | PTE_P)) < 0) {
+			page_free(pp);
+			return r;
+		}
+		return 0;
+	case PAGEOP_MAP:
+		if (env_load_page(srcenv, (uintptr_t) op->po_srcva) == -E_NO_MEM)
+			return -E_NO_MEM;
+		if (!(pp = page_lookup(srcenv->env_pml4e, op->po_srcva, &pte)))
+			return -E_INVAL;
+		if ((op->po_perm & PTE_W) && !(*pte & PTE_W))
+			return -E_INVAL;
+		return page_insert(dstenv->env_pml4e, pp, op->po_dstva, op->po_perm);
+	default:
+		if ((r = env_image_unmap(dstenv, (uintptr_t) op->po_dstva, PGSIZE)) < 0)
+			return r;
+		return page_remove(dstenv->env_pml4e, op->po_dstva);
+	}
+}
+
+// Carry out the 'nops' page operations in 'ops' (see struct PageOp),
+// in order, with one system call: pages are taken from srcenvid and
+// mapped into, allocated in or unmapped from dstenvid.  Each operation
+// has the same restrictions as the system call it stands for.  The envs
+// are looked up once, and other CPUs' TLBs are flushed once at the end.
+// Descriptors are checked PAGE_BATCH_CHUNK at a time before any of
+// them is carried out; on an error, the operations of earlier chunks,
+// and those before the failing one in its chunk, stay done.
+//
+// Return 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if srcenvid and/or dstenvid doesn't currently exist,
+//		or the caller doesn't have permission to change one of them.
+//	-E_INVAL if an operation is invalid (see sys_page_alloc,
+//		sys_page_map and sys_page_unmap).
+//	-E_NO_MEM if there's no memory for a page or page table.
+//	-E_FAULT if an earlier operation unmapped descriptors not yet
+//		copied in.
+static int
+sys_page_batch(envid_t srcenvid, envid_t dstenvid, const struct PageOp *ops, size_t nops)
+{
+	struct PageOp chunk[PAGE_BATCH_CHUNK];
+	struct Env *srcenv, *dstenv;
+	size_t done, n, i;
+	int r;
+
+	if (envid2env(srcenvid, &srcenv, 1) < 0 || envid2env(dstenvid, &dstenv, 1) < 0)
+		return -E_BAD_ENV;
+	if (nops > UTOP / sizeof(*ops))
+		return -E_INVAL;
+	user_mem_assert(curenv, ops, nops * sizeof(*ops), PTE_U);
+
+	for (done = 0; done < nops; done += n) {
+		// copy the descriptors, so they can't change once checked.
+		// The operations so far may have unmapped them.
+		n = MIN(nops - done, PAGE_BATCH_CHUNK);
+		if (user_mem_check(curenv, ops + done, n * sizeof(*ops), PTE_U) < 0)
+			return -E_FAULT;
+		memcpy(chunk, ops + done, n * sizeof(*ops));
+		for (i = 0; i < n; i++)
+			if ((r = page_op_check(&chunk[i])) < 0)
+				return r;
+		for (i = 0; i < n; i++)
+			if ((r = page_op_apply(srcenv, dstenv, &chunk[i])) < 0)
+				return r;
+	}
 	return 0;
 }
 
@@ -457,6 +870,7 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 		}
 		
 		pte_t *pte;
+		env_load_page(curenv, (uintptr_t)srcva);
 		struct PageInfo *pp = page_lookup(curenv->env_pml4e, srcva, &pte);
 		if (!pp) {
 			return -E_INVAL;
@@ -532,6 +946,155 @@ sys_ipc_recv(void *dstva)
 	return 0;
 }
 
+// Make the page at 'va' the caller's system call ring (struct Ring),
+// replacing any ring it had.  The kernel keeps writing to the page
+// itself, and holds a reference to it until the env sets up another
+// ring or exits, so the page must never become copy-on-write: it must
+// be mapped writable and PTE_SHARE, which both forks leave alone.
+// The ring's indices are reset to 0.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if va >= UTOP, or va is not page-aligned.
+//	-E_INVAL if va is not mapped writable and PTE_SHARE in the
+//		caller's address space.
+static int
+sys_ring_setup(void *va)
+{
+	struct PageInfo *pp;
+	pte_t *pte;
+	struct Ring *ring;
+
+	static_assert(sizeof(struct Ring) <= PGSIZE);
+
+	if ((uintptr_t) va >= UTOP || (uintptr_t) va % PGSIZE)
+		return -E_INVAL;
+	if (!(pp = page_lookup(curenv->env_pml4e, va, &pte))
+	    || (*pte & (PTE_W | PTE_SHARE)) != (PTE_W | PTE_SHARE))
+		return -E_INVAL;
+
+	pp->pp_ref++;
+	if (curenv->env_ring)
+		page_decref(pa2page(PADDR(curenv->env_ring)));
+	ring = page2kva(pp);
+	ring->r_sq_head = ring->r_sq_tail = 0;
+	ring->r_cq_head = ring->r_cq_tail = 0;
+	curenv->env_ring = ring;
+	return 0;
+}
+
+// The kernel carries out queued requests on every trap from the env,
+// so by the time this runs they have been.  It is a cheap way for an
+// env to have its ring looked at without doing anything else.
+//
+// Returns the number of completions waiting for the env, or -E_INVAL
+// if it has no ring.
+static int
+sys_ring_enter(void)
+{
+	struct Ring *ring = curenv->env_ring;
+
+	if (!ring)
+		return -E_INVAL;
+	return ring->r_cq_tail - ring->r_cq_head;
+}
+
+// Carry out one ring request for curenv.  Only system calls that always
+// return to their caller may be queued: one that blocks, yields or
+// destroys curenv can't run in the middle of a trap or on an idle CPU.
+// For the same reason a bad string for SYS_cputs fails with -E_FAULT
+// rather than destroying the env.
+static int64_t
+ring_syscall(const struct RingSqe *sqe)
+{
+	const uint64_t *a = sqe->sqe_args;
+
+	switch (sqe->sqe_num) {
+	case SYS_cputs:
+		if (user_mem_check(curenv, (const void *) a[0], a[1], PTE_U|PTE_P) < 0)
+			return -E_FAULT;
+		cprintf("%.*s", (int) a[1], (const char *) a[0]);
+		return 0;
+	case SYS_getenvid:
+	case SYS_env_set_status:
+	case SYS_page_alloc:
+	case SYS_page_map:
+	case SYS_page_unmap:
+	case SYS_page_unmap_range:
+	case SYS_ipc_try_send:
+		return syscall(sqe->sqe_num, a[0], a[1], a[2], a[3], a[4]);
+	default:
+		return -E_INVAL;
+	}
+}
+
+//
+// Carry out the requests on e's ring, in order, posting a completion
+// for each, until the submission ring is empty, the completion ring is
+// full, or RING_SQ_SIZE requests have been done.  e must be curenv,
+// with its address space loaded.
+// Returns the number of requests carried out.
+//
+int
+ring_drain(struct Env *e)
+{
+	struct Ring *ring = e->env_ring;
+	struct RingSqe sqe;
+	struct RingCqe *cqe;
+	uint32_t head, tail, cq;
+	int n;
+
+	assert(e == curenv);
+	if (!ring)
+		return 0;
+	head = ring->r_sq_head;
+	tail = ring->r_sq_tail;
+	for (n = 0; head != tail && n < RING_SQ_SIZE; n++, head++) {
+		cq = ring->r_cq_tail;
+		if (cq - ring->r_cq_head >= RING_CQ_SIZE)
+			break;
+		// copy the request, so the env can't change it under us
+		sqe = ring->r_sq[head % RING_SQ_SIZE];
+		cqe = &ring->r_cq[cq % RING_CQ_SIZE];
+		cqe->cqe_data = sqe.sqe_data;
+		cqe->cqe_result = ring_syscall(&sqe);
+		asm volatile("" ::: "memory");
+		ring->r_cq_tail = cq + 1;
+		ring->r_sq_head = head + 1;
+	}
+	return n;
+}
+
+//
+// From an idle CPU, drain the rings of envs that are blocked (and so
+// won't trap into the kernel to have it done), e.g. a server waiting in
+// sys_ipc_recv.  Envs running on other CPUs drain their own rings on
+// their next trap.  Leaves the kernel's address space loaded if it
+// loaded any other.
+// Returns the number of requests carried out.
+//
+int
+ring_drain_idle(void)
+{
+	struct Env *saved = curenv;
+	struct Env *e;
+	int i, n = 0;
+
+	for (i = 0; i < NENV; i++) {
+		e = &envs[i];
+		if (e->env_status != ENV_NOT_RUNNABLE || !e->env_ring
+		    || e->env_ring->r_sq_head == e->env_ring->r_sq_tail)
+			continue;
+		curenv = e;
+		pml4e_load(e->env_pml4e);
+		n += ring_drain(e);
+	}
+	if (curenv != saved) {
+		curenv = saved;
+		pml4e_load(kern_pml4);
+	}
+	return n;
+}
+
 // Dispatches to the correct kernel function, passing the arguments.
 /*
 - receives 5 unsigned ints
@@ -586,6 +1149,22 @@ syscall(uint64_t syscallno, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4,
 		return sys_ipc_try_send((envid_t)a1, (uint32_t)a2, (void *)a3, (unsigned)a4);
 	case SYS_ipc_recv:
 		return sys_ipc_recv((void *)a1);
+	case SYS_page_alloc_huge:
+		return sys_page_alloc_huge((envid_t)a1, (void *)a2, (int)a3);
+	case SYS_page_unmap_range:
+		return sys_page_unmap_range((envid_t)a1, (void *)a2, (size_t)a3);
+	case SYS_fork:
+		return sys_fork();
+	case SYS_spawn:
+		return sys_spawn((const char *)a1, (const char **)a2);
+	case SYS_thread_create:
+		return sys_thread_create((void *)a1, a2, a3);
+	case SYS_page_batch:
+		return sys_page_batch((envid_t)a1, (envid_t)a2, (const struct PageOp *)a3, (size_t)a4);
+	case SYS_ring_setup:
+		return sys_ring_setup((void *)a1);
+	case SYS_ring_enter:
+		return sys_ring_enter();
 
 	default:
 		return -E_INVAL;
@@ -7,5 +7,7 @@
 #include <inc/syscall.h>
 
 int64_t syscall(uint64_t syscallno, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5);
+int	ring_drain(struct Env *e);
+int	ring_drain_idle(void);
 
 #endif /* !JOS_KERN_SYSCALL_H */
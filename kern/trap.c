@@ -1,6 +1,8 @@
 #include <inc/mmu.h>
 #include <inc/x86.h>
 #include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/string.h>
 
 #include <kern/pmap.h>
 #include <kern/trap.h>
@@ -8,6 +10,7 @@
 #include <kern/monitor.h>
 #include <kern/env.h>
 #include <kern/syscall.h>
+#include <kern/fpu.h>
 #include <kern/sched.h>
 #include <kern/kclock.h>
 #include <kern/picirq.h>
@@ -103,6 +106,7 @@ trap_init(void)
 	SETGATE(idt[T_MCHK],    0, GD_KT, t_mchk,    0);
 	SETGATE(idt[T_SIMDERR], 0, GD_KT, t_simderr, 0);
 	SETGATE(idt[T_SYSCALL], 0, GD_KT, t_syscall, 3);
+	SETGATE(idt[T_TLBFLUSH], 0, GD_KT, t_tlbflush, 0);
 
 	SETGATE(idt[IRQ_OFFSET + IRQ_TIMER], 0, GD_KT, t_irq_timer, 0);
 	SETGATE(idt[IRQ_OFFSET + IRQ_KBD], 0, GD_KT, t_irq_kbd, 0);
@@ -158,8 +162,10 @@ trap_init_percpu(void)
 	// LAB 4: Your code here:
 
 	// Setup a TSS so that we get the right stack
-	// when we trap to the kernel.
-	thiscpu->cpu_ts.RSP[0] = KSTACKTOP - cpunum() * (KSTKSIZE + KSTKGAP);
+	// when we trap to the kernel.  Once an env runs, env_run points
+	// RSP[0] at its Trapframe instead.
+	thiscpu->cpu_syscall.sc_kstack = KSTACKTOP - cpunum() * (KSTKSIZE + KSTKGAP);
+	thiscpu->cpu_ts.RSP[0] = thiscpu->cpu_syscall.sc_kstack;
 
 	// Initialize the TSS slot of the gdt.
 	//todo use TSSO TSS1
@@ -172,6 +178,30 @@ trap_init_percpu(void)
 
 	// Load the IDT
 	lidt(&idt_pd);
+
+	// SYSCALL enters the kernel at syscall_entry with CS = GD_KT and
+	// SS = GD_KT + 8; SYSRET to 64-bit code returns with
+	// SS = STAR[63:48] + 8 and CS = STAR[63:48] + 16.  The entry stub
+	// finds its kernel stack through the GS base swapgs swaps in.
+	static_assert(GD_KD == GD_KT + 8 && GD_UT == GD_UD + 8);
+	static_assert(offsetof(struct CpuInfo, cpu_syscall.sc_ursp)
+		      == offsetof(struct CpuInfo, cpu_syscall) + 8);
+	static_assert(offsetof(struct CpuInfo, cpu_syscall.sc_tf)
+		      == offsetof(struct CpuInfo, cpu_syscall) + 16);
+	static_assert(offsetof(struct Trapframe, tf_rip) == 136
+		      && offsetof(struct Trapframe, tf_cs) == 144
+		      && offsetof(struct Trapframe, tf_eflags) == 152
+		      && offsetof(struct Trapframe, tf_rsp) == 160);
+	// The CPU aligns RSP[0] down to 16 bytes before pushing, so the end
+	// of every env_tf in envs[] must be 16-byte aligned.
+	static_assert(offsetof(struct Env, env_tf) == 0
+		      && sizeof(struct Trapframe) % 16 == 0
+		      && sizeof(struct Env) % 16 == 0);
+	wrmsr(KGSBASE_MSR, (uintptr_t) &thiscpu->cpu_syscall);
+	wrmsr(STAR_MSR, ((uint64_t) (GD_UD - 8) << 48) | ((uint64_t) GD_KT << 32));
+	wrmsr(LSTAR_MSR, (uintptr_t) syscall_entry);
+	wrmsr(SFMASK_MSR, FL_IF | FL_DF | FL_TF | FL_AC);
+	wrmsr(EFER_MSR, rdmsr(EFER_MSR) | EFER_SCE);
 }
 
 void
@@ -267,6 +297,12 @@ trap_dispatch(struct Trapframe *tf)
 	case T_DEBUG:
 		monitor(tf);
 		return;
+	case T_DEVICE:
+		// The kernel never uses the FPU
+		if ((tf->tf_cs & 3) == 0)
+			break;
+		fpu_trap(curenv);
+		return;
 	case T_SYSCALL:
 		tf->tf_regs. reg_rax = syscall(
 			tf->tf_regs.reg_rax,    // syscall number
@@ -299,6 +335,13 @@ trap(struct Trapframe *tf)
 	// of GCC rely on DF being clear
 	asm volatile("cld" ::: "cc");
 
+	// TLB shootdowns are answered without the big kernel lock, since
+	// the CPU asking for one holds it while it waits.
+	if (tf->tf_trapno == T_TLBFLUSH) {
+		tlb_shootdown_ipi();
+		env_pop_tf(tf);
+	}
+
 	// Halt the CPU if some other CPU has called panic()
 	extern char *panicstr;
 	if (panicstr)
@@ -318,7 +361,9 @@ trap(struct Trapframe *tf)
 		// Acquire the big kernel lock before doing any
 		// serious kernel work.
 		// LAB 4: Your code here.
+		xchg(&thiscpu->cpu_tlb_user, 0);
 		lock_kernel();
+		tlb_sync();
 		assert(curenv);
 
 		// Garbage collect if current enviroment is a zombie
@@ -328,12 +373,13 @@ trap(struct Trapframe *tf)
 			sched_yield();
 		}
 
-		// Copy trap frame (which is currently on the stack)
-		// into 'curenv->env_tf', so that running the environment
-		// will restart at the trap point.
-		curenv->env_tf = *tf;
-		// The trapframe on the stack should be ignored from here on.
-		tf = &curenv->env_tf;
+		// The trap entry built the trap frame right in
+		// 'curenv->env_tf' (see env_run), so running the
+		// environment will restart at the trap point.
+		assert(tf == &curenv->env_tf);
+
+		// Carry out whatever the env queued on its system call ring.
+		ring_drain(curenv);
 	}
 
 	// Record that tf is the last real trapframe so
@@ -352,6 +398,92 @@ trap(struct Trapframe *tf)
 		sched_yield();
 }
 
+//
+// A system call made with SYSCALL (see syscall_entry in trapentry.S).
+// 'tf' is curenv->env_tf, with the system call number in rax and
+// the arguments in rdi, rsi, rdx, r10 and r8.  If the env can carry
+// on, this returns the result for syscall_entry to return with SYSRET,
+// skipping the full register reload and iretq of env_run; otherwise
+// it doesn't return.
+//
+uint64_t
+trap_syscall(struct Trapframe *tf)
+{
+	int64_t ret;
+
+	asm volatile("cld" ::: "cc");
+
+	// As in trap(), for a trap from user mode
+	xchg(&thiscpu->cpu_tlb_user, 0);
+	lock_kernel();
+	tlb_sync();
+	assert(curenv);
+	if (curenv->env_status == ENV_DYING) {
+		env_free(curenv);
+		curenv = NULL;
+		sched_yield();
+	}
+	assert(tf == &curenv->env_tf);
+	last_tf = tf;
+	ring_drain(curenv);
+
+	ret = syscall(tf->tf_regs.reg_rax, tf->tf_regs.reg_rdi, tf->tf_regs.reg_rsi,
+		      tf->tf_regs.reg_rdx, tf->tf_regs.reg_r10, tf->tf_regs.reg_r8);
+	tf->tf_regs.reg_rax = ret;
+	if (curenv->env_status != ENV_RUNNING)
+		sched_yield();
+
+	// What env_run would do, minus loading the address space again
+	// unless it changed under this CPU while it was in the kernel
+	// (missed shootdown, or PCID taken away by pcid_forget).
+	tlb_flush();
+	tlb_sync();
+	if (!pml4e_loaded(curenv->env_pml4e))
+		pml4e_load(curenv->env_pml4e);
+	xchg(&thiscpu->cpu_tlb_user, 1);
+	unlock_kernel();
+	return ret;
+}
+
+//
+// Give 'e' a private, writable copy of the copy-on-write page at 'va'.
+// If nobody else maps the page any more, it is simply made writable.
+// Returns 0 on success, -E_INVAL if 'va' isn't a copy-on-write page,
+// or -E_NO_MEM (and then the user's page fault handler gets a try).
+//
+static int
+cow_fault(struct Env *e, uintptr_t va)
+{
+	struct PageInfo *pp, *copy;
+	size_t size;
+	pte_t *pte;
+	int perm;
+
+	va = ROUNDDOWN(va, PGSIZE);
+	if (va >= UTOP)
+		return -E_INVAL;
+	pte = pml4e_walk_leaf(e->env_pml4e, (void *) va, &size);
+	if (!pte || size != PGSIZE || (*pte & (PTE_COW | PTE_U)) != (PTE_COW | PTE_U))
+		return -E_INVAL;
+
+	pp = pa2page(PTE_ADDR(*pte));
+	perm = (*pte & PTE_SYSCALL & ~PTE_COW) | PTE_W;
+	if (pp->pp_ref == 1) {
+		*pte = page2pa(pp) | perm;
+		tlb_invalidate(e->env_pml4e, (void *) va);
+		return 0;
+	}
+
+	if (!(copy = page_alloc(0)))
+		return -E_NO_MEM;
+	memcpy(page2kva(copy), page2kva(pp), PGSIZE);
+	if (page_insert(e->env_pml4e, copy, (void *) va, perm) < 0) {
+		page_free(copy);
+		return -E_NO_MEM;
+	}
+	return 0;
+}
+
 /*
 - to verify tf is in kernel mode: if ((tf->tf_cs & 3)) == 0); if yes panic and print fault_va
 - implement user_mem_check()
@@ -373,6 +505,15 @@ page_fault_handler(struct Trapframe *tf)
 	// We've already handled kernel-mode exceptions, so if we get here,
 	// the page fault happened in user mode.
 
+	// Copy-on-write faults are resolved right here, without a trip
+	// through the user's handler.
+	if ((tf->tf_err & FEC_WR) && cow_fault(curenv, fault_va) == 0)
+		return;
+
+	// So is the first touch of a page of the program image.
+	if (!(tf->tf_err & FEC_PR) && env_load_page(curenv, fault_va) == 0)
+		return;
+
 	// Call the environment's page fault upcall, if one exists.  Set up a
 	// page fault stack frame on the user exception stack (below
 	// UXSTACKTOP), then branch to curenv->env_pgfault_upcall.
@@ -436,10 +577,12 @@ page_fault_handler(struct Trapframe *tf)
 
 	uintptr_t utf_addr;
 
-	if (tf->tf_rsp >= (UXSTACKTOP - PGSIZE) && tf->tf_rsp < UXSTACKTOP) {
+	uintptr_t uxstacktop = curenv->env_uxstacktop;
+
+	if (tf->tf_rsp >= (uxstacktop - PGSIZE) && tf->tf_rsp < uxstacktop) {
 		utf_addr = tf->tf_rsp - sizeof(struct UTrapframe) - 8;
 	} else {
-		utf_addr = UXSTACKTOP - sizeof(struct UTrapframe);
+		utf_addr = uxstacktop - sizeof(struct UTrapframe);
 	}
 
 	user_mem_assert(curenv, (void *)utf_addr, sizeof(struct UTrapframe), PTE_U | PTE_W);
@@ -57,6 +57,8 @@ extern void t_align(); // yes
 extern void t_mchk(); // no
 extern void t_simderr(); // no
 extern void t_syscall();
+extern void t_tlbflush();
+extern void syscall_entry();
 
 extern void t_irq_timer();
 extern void t_irq_kbd();
@@ -80,6 +82,7 @@ void trap_init_percpu(void);
 void print_regs(struct PushRegs *regs);
 void print_trapframe(struct Trapframe *tf);
 void page_fault_handler(struct Trapframe *);
+uint64_t trap_syscall(struct Trapframe *tf);
 void backtrace(struct Trapframe *);
 
 #endif /* JOS_KERN_TRAP_H */
\ No newline at end of file
@@ -3,10 +3,6 @@
 #include <inc/string.h>
 #include <inc/lib.h>
 
-// PTE_COW marks copy-on-write page table entries.
-// It is one of the bits explicitly allocated to user processes (PTE_AVAIL).
-#define PTE_COW		0x800
-
 /*
 Notes
 - JOS uses 4 level page tables, each containing NPTENTRIES=512 entries of type pte_t
@@ -21,6 +17,8 @@ Notes
 //
 // Custom page fault handler - if faulting page is copy-on-write,
 // map in our own private writable copy.
+// The kernel resolves copy-on-write faults itself (cow_fault in
+// kern/trap.c), so this only runs when it had no memory to.
 //
 /*
 - verify that faulting page in UTrapframe is produced by write op, err == ; if not painc
@@ -101,45 +99,85 @@ Steps
 	- map va onto current environment (0) as COW using sys_page_map(); return error code if fails
 - if uvpt[pn] is neither PTE_W nor PTE_COW, copy the mapping of va onto envid using sys_page_map() with PGOFF(uvpt[pn]) as perms; return error code if fails
 */
+//
+// The mappings are queued, and made DUP_BATCH pages at a time with two
+// sys_page_batch calls (dupflush): one for the child, then one for us.
+//
+#define DUP_BATCH	64
+
+static struct PageOp dup_child[DUP_BATCH], dup_self[DUP_BATCH];
+static int ndup_child, ndup_self;
+
 static int
-duppage(envid_t envid, unsigned pn)
+dupflush(envid_t envid)
 {
 	int r;
-	
-	void *va = (void *)((uintptr_t)pn << PGSHIFT);
-	pte_t pte = uvpt[pn];
 
-	// Debug:  uncomment to see what's being mapped
-	cprintf("duppage: pn=%x va=%p pte=%p\n", pn, va, pte);
+	// Map to child first, then remap parent
+	r = sys_page_batch(0, envid, dup_child, ndup_child);
+	if (r < 0) {
+		panic("duppage: child map failed: %e", r);
+		return r;
+	}
+	r = sys_page_batch(0, 0, dup_self, ndup_self);
+	if (r < 0) {
+		panic("duppage: parent remap failed: %e", r);
+		return r;
+	}
+	ndup_child = ndup_self = 0;
+	return 0;
+}
 
-	if ((pte & PTE_W) || (pte & PTE_COW)) {
-		// Map to child first, then remap parent
-		r = sys_page_map(0, va, envid, va, PTE_P | PTE_U | PTE_COW);
-		if (r < 0) {
-			panic("duppage: child map failed: %e, va=%p", r, va);
-			return r;
-		}
+static void
+dupqueue(struct PageOp *op, void *va, int perm)
+{
+	op->po_op = PAGEOP_MAP;
+	op->po_perm = perm;
+	op->po_srcva = op->po_dstva = va;
+}
 
-		r = sys_page_map(0, va, 0, va, PTE_P | PTE_U | PTE_COW);
-		if (r < 0) {
-			panic("duppage: parent remap failed: %e, va=%p", r, va);
-			return r;
-		}
+static int
+duppage(envid_t envid, unsigned pn)
+{
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+	pte_t pte = uvpt[pn];
+
+	if (pte & PTE_SHARE) {
+		// shared pages stay shared, writable or not
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+	} else if ((pte & PTE_W) || (pte & PTE_COW)) {
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U | PTE_COW);
+		dupqueue(&dup_self[ndup_self++], va, PTE_P | PTE_U | PTE_COW);
 	} else {
-		r = sys_page_map(0, va, envid, va, PTE_P | PTE_U);
-		if (r < 0) {
-			panic("duppage: readonly map failed: %e, va=%p", r, va);
-			return r;
-		}
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U);
 	}
 
+	if (ndup_child == DUP_BATCH) {
+		return dupflush(envid);
+	}
 	return 0;
 }
 
 extern void _pgfault_upcall();
 
 //
-// User-level fork with copy-on-write.
+// Fork with copy-on-write.  The kernel copies the address space in one
+// system call (sys_fork); only the copy-on-write faults afterwards are
+// handled here, by pgfault.
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+	set_pgfault_handler(pgfault);
+	return sys_fork();
+}
+
+//
+// User-level fork with copy-on-write, which does the copying itself
+// with a sys_page_map per page.  Kept to compare against fork (see
+// user/forkbench.c).
 // Set up our page fault handler appropriately.
 // Create a child.
 // Copy our address space and page fault handler setup to the child.
@@ -159,7 +197,7 @@ Steps
 - setup page fault handler using set_pgfault_handler() and passing pgfault as param
 - create childenv by calling sys_exofork(); forks environment into parent and child, code must expect both envids:
 	- if envid value returns is negative, panic
-	- if envid is 0: thisenv = &envs[ENVX(sys_getenvid())]; then return 0
+	- if envid is 0: return 0 (thisenv follows by itself)
 - if envid returned is > 0, we are back in the parent env, meaning the envid returned is that of the child env
 - now we must copy address space from parent to child
 	- parent allocates one writeable page at UXSTACKTOP with sys_page_alloc(); return error code if fails
@@ -178,7 +216,7 @@ Loop explained:
 - 
 */
 envid_t
-fork(void)
+ufork(void)
 {
 	// LAB 4: Your code here.
 	int r;
@@ -191,7 +229,6 @@ fork(void)
 	}
 	
 	if (envid == 0) {
-		thisenv = &envs[ENVX(sys_getenvid())];
 		return 0;
 	}
 	
@@ -215,6 +252,20 @@ fork(void)
 				if (!(uvpd[pdeIndex] & PTE_P)) {
 					continue;
 				}
+
+				// uvpt can't see inside a 2MB page; remapping one of
+				// its pages onto itself makes the kernel split it
+				// into an ordinary page table.
+				if (uvpd[pdeIndex] & PTE_PS) {
+					void *va = PGADDR(i, j, k, 0, 0);
+					if ((uintptr_t)va >= UTOP) {
+						goto done;
+					}
+					r = sys_page_map(0, va, 0, va, uvpd[pdeIndex] & PTE_SYSCALL);
+					if (r < 0) {
+						panic("splitting 2MB page at %p failed: %e", va, r);
+					}
+				}
 				
 				for (int l = 0; l < NPTENTRIES; l++) {
 					uint64_t pn = pdeIndex * NPTENTRIES + l;
@@ -241,6 +292,10 @@ fork(void)
 		}
 	}
 done:
+	r = dupflush(envid);
+	if (r < 0) {
+		panic("duppage failed:  %e", r);
+	}
 	
 	r = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
 	if (r < 0) {
@@ -260,10 +315,23 @@ done:
 	return envid;
 }
 
-// Challenge!
-int
-sfork(void)
+static void
+thread_start(void (*fn)(void *), void *arg)
+{
+	fn(arg);
+	exit();
+}
+
+//
+// Start a thread running fn(arg): a new env that shares all of our
+// memory, with its own stack and exception stack (see
+// sys_thread_create).  The thread exits when fn returns.
+// Unlike fork, sfork does not return twice: the two would have to run
+// on one stack, since nothing is private to the child.
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
 {
-	panic("sfork not implemented");
-	return -E_INVAL;
+	return sys_thread_create(thread_start, (uint64_t) fn, (uint64_t) arg);
 }
@@ -0,0 +1,83 @@
+// Queueing system calls on the env's system call ring (see struct Ring
+// in inc/ring.h), so that many calls cost one trap into the kernel.
+
+#include <inc/lib.h>
+
+static uint8_t ring_page[PGSIZE] __attribute__((aligned(PGSIZE)));
+#define ring	((struct Ring *) ring_page)
+
+static envid_t ring_env;	// The env that owns the ring in ring_page
+
+// Give this env a ring, unless it has one.  The page is mapped
+// PTE_SHARE (sys_ring_setup insists), so that neither fork nor ufork
+// makes it copy-on-write under the kernel's feet; a child then gets a
+// page and a ring of its own here.
+// Threads share ring_page, so only one of them can own the ring.
+static int
+ring_init(void)
+{
+	const volatile struct Env *owner = &envs[ENVX(ring_env)];
+	int r;
+
+	if (ring_env == thisenv->env_id)
+		return 0;
+	if (ring_env && owner->env_id == ring_env && owner->env_status != ENV_FREE
+	    && owner->env_pml4e == thisenv->env_pml4e)
+		return -E_BAD_ENV;
+	if ((r = sys_page_alloc(0, ring_page, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+		return r;
+	if ((r = sys_ring_setup(ring_page)) < 0)
+		return r;
+	ring_env = thisenv->env_id;
+	return 0;
+}
+
+// Queue system call 'num' with arguments a1-a5, as for syscall().  Only
+// calls that never block are allowed (see ring_syscall in
+// kern/syscall.c).  Its completion will carry 'data'.  The kernel takes
+// the request on this env's next trap, e.g. sys_ring_enter().
+// Returns 0 on success, -E_NO_MEM if the ring is full, or another
+// error from setting up the ring.
+int
+ring_submit(uint32_t num, uint64_t a1, uint64_t a2, uint64_t a3,
+	    uint64_t a4, uint64_t a5, uint64_t data)
+{
+	struct RingSqe *sqe;
+	uint32_t tail;
+	int r;
+
+	if ((r = ring_init()) < 0)
+		return r;
+	tail = ring->r_sq_tail;
+	if (tail - ring->r_sq_head >= RING_SQ_SIZE)
+		return -E_NO_MEM;
+	sqe = &ring->r_sq[tail % RING_SQ_SIZE];
+	sqe->sqe_num = num;
+	sqe->sqe_args[0] = a1;
+	sqe->sqe_args[1] = a2;
+	sqe->sqe_args[2] = a3;
+	sqe->sqe_args[3] = a4;
+	sqe->sqe_args[4] = a5;
+	sqe->sqe_data = data;
+	asm volatile("" ::: "memory");
+	ring->r_sq_tail = tail + 1;
+	return 0;
+}
+
+// Take the oldest completion off the ring into *cqe.
+// Returns 1 if there was one, 0 if not.
+int
+ring_reap(struct RingCqe *cqe)
+{
+	uint32_t head;
+
+	if (ring_env != thisenv->env_id)
+		return 0;
+	head = ring->r_cq_head;
+	if (head == ring->r_cq_tail)
+		return 0;
+	asm volatile("" ::: "memory");
+	*cqe = ring->r_cq[head % RING_CQ_SIZE];
+	ring->r_cq_head = head + 1;
+	return 1;
+}
@@ -7,31 +7,34 @@ static inline int64_t
 syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
 {
 	int64_t ret;
-
-
+	register uint64_t r10 asm("r10") = a4;
+	register uint64_t r8 asm("r8") = a5;
 
 	// Generic system call: pass system call number in AX,
-	// up to five parameters in RDX, RCX, RBX, RDI, RSI.
-	// Interrupt kernel with T_SYSCALL.
+	// up to five parameters in RDI, RSI, RDX, R10, R8.
+	// Enter the kernel with SYSCALL (see syscall_entry in
+	// kern/trapentry.S); int $T_SYSCALL, which takes the
+	// parameters in RDX, RCX, RBX, RDI, RSI, still works too.
 	//
 	// The "volatile" tells the assembler not to optimize
 	// this instruction away just because we don't use the
 	// return value.
 	//
-	// The last clause tells the assembler that this can
-	// potentially change the condition codes and arbitrary
-	// memory locations.
-
-	asm volatile("int %1\n"
-		     : "=a" (ret)
-		     : "i" (T_SYSCALL),
-		       "a" (num),
-		       "d" (a1),
-		       "c" (a2),
-		       "b" (a3),
-		       "D" (a4),
-		       "S" (a5)
-		     : "cc", "memory");
+	// SYSCALL itself overwrites RCX and R11, and the kernel
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+		     : "=a" (ret),
+		       "+D" (a1),
+		       "+S" (a2),
+		       "+d" (a3),
+		       "+r" (r10),
+		       "+r" (r8)
+		     : "0" (num)
+		     : "rcx", "r9", "r11", "cc", "memory");
 
 	if(check && ret > 0)
 		panic("syscall %d returned %d (> 0)", num, ret);
@@ -57,10 +60,11 @@ sys_env_destroy(envid_t envid)
 	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
 }
 
+// Answered from envs[] without entering the kernel (see thisenv)
 envid_t
 sys_getenvid(void)
 {
-	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+	return thisenv->env_id;
 }
 
 void
@@ -75,6 +79,12 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
 }
 
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+}
+
 int
 sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
 {
@@ -87,6 +97,48 @@ sys_page_unmap(envid_t envid, void *va)
 	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
 }
 
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+}
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+}
+
 // sys_exofork is inlined in lib.h
 
 int
@@ -0,0 +1,28 @@
+// Queries answered from the kernel's read-only info page (UINFO) and
+// envs[], without a system call.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+// The CPU this env is running on.  It may have moved on by the time
+// the caller looks at the answer.
+int
+getcpu(void)
+{
+	return thisenv->env_cpunum;
+}
+
+// Nanoseconds since the kernel booted, from the TSC, which is assumed
+// to tick at the same rate on every CPU.  Returns 0 if the kernel
+// couldn't measure the TSC's rate.
+uint64_t
+time_nsec(void)
+{
+	uint64_t hz = uinfo.ui_tsc_hz;
+	uint64_t t;
+
+	if (hz == 0)
+		return 0;
+	t = read_tsc() - uinfo.ui_boot_tsc;
+	return t / hz * 1000000000 + t % hz * 1000000000 / hz;
+}
@@ -0,0 +1,78 @@
+#include <kern/env.h>
+extern uint8_t _binary_obj_user_hello_start[];
+extern uint8_t _binary_obj_user_buggyhello_start[];
+extern uint8_t _binary_obj_user_buggyhello2_start[];
+extern uint8_t _binary_obj_user_evilhello_start[];
+extern uint8_t _binary_obj_user_testbss_start[];
+extern uint8_t _binary_obj_user_divzero_start[];
+extern uint8_t _binary_obj_user_breakpoint_start[];
+extern uint8_t _binary_obj_user_softint_start[];
+extern uint8_t _binary_obj_user_badsegment_start[];
+extern uint8_t _binary_obj_user_faultread_start[];
+extern uint8_t _binary_obj_user_faultreadkernel_start[];
+extern uint8_t _binary_obj_user_faultwrite_start[];
+extern uint8_t _binary_obj_user_faultwritekernel_start[];
+extern uint8_t _binary_obj_user_idle_start[];
+extern uint8_t _binary_obj_user_yield_start[];
+extern uint8_t _binary_obj_user_dumbfork_start[];
+extern uint8_t _binary_obj_user_stresssched_start[];
+extern uint8_t _binary_obj_user_faultdie_start[];
+extern uint8_t _binary_obj_user_faultregs_start[];
+extern uint8_t _binary_obj_user_faultalloc_start[];
+extern uint8_t _binary_obj_user_faultallocbad_start[];
+extern uint8_t _binary_obj_user_faultnostack_start[];
+extern uint8_t _binary_obj_user_faultbadhandler_start[];
+extern uint8_t _binary_obj_user_faultevilhandler_start[];
+extern uint8_t _binary_obj_user_forktree_start[];
+extern uint8_t _binary_obj_user_sendpage_start[];
+extern uint8_t _binary_obj_user_spin_start[];
+extern uint8_t _binary_obj_user_fairness_start[];
+extern uint8_t _binary_obj_user_pingpong_start[];
+extern uint8_t _binary_obj_user_pingpongs_start[];
+extern uint8_t _binary_obj_user_primes_start[];
+extern uint8_t _binary_obj_user_hugepage_start[];
+extern uint8_t _binary_obj_user_forkbench_start[];
+extern uint8_t _binary_obj_user_spawnargs_start[];
+extern uint8_t _binary_obj_user_nullsyscall_start[];
+extern uint8_t _binary_obj_user_ringtest_start[];
+extern uint8_t _binary_obj_user_fputest_start[];
+const struct EnvBinary env_binaries[] = {
+	{ "hello", _binary_obj_user_hello_start },
+	{ "buggyhello", _binary_obj_user_buggyhello_start },
+	{ "buggyhello2", _binary_obj_user_buggyhello2_start },
+	{ "evilhello", _binary_obj_user_evilhello_start },
+	{ "testbss", _binary_obj_user_testbss_start },
+	{ "divzero", _binary_obj_user_divzero_start },
+	{ "breakpoint", _binary_obj_user_breakpoint_start },
+	{ "softint", _binary_obj_user_softint_start },
+	{ "badsegment", _binary_obj_user_badsegment_start },
+	{ "faultread", _binary_obj_user_faultread_start },
+	{ "faultreadkernel", _binary_obj_user_faultreadkernel_start },
+	{ "faultwrite", _binary_obj_user_faultwrite_start },
+	{ "faultwritekernel", _binary_obj_user_faultwritekernel_start },
+	{ "idle", _binary_obj_user_idle_start },
+	{ "yield", _binary_obj_user_yield_start },
+	{ "dumbfork", _binary_obj_user_dumbfork_start },
+	{ "stresssched", _binary_obj_user_stresssched_start },
+	{ "faultdie", _binary_obj_user_faultdie_start },
+	{ "faultregs", _binary_obj_user_faultregs_start },
+	{ "faultalloc", _binary_obj_user_faultalloc_start },
+	{ "faultallocbad", _binary_obj_user_faultallocbad_start },
+	{ "faultnostack", _binary_obj_user_faultnostack_start },
+	{ "faultbadhandler", _binary_obj_user_faultbadhandler_start },
+	{ "faultevilhandler", _binary_obj_user_faultevilhandler_start },
+	{ "forktree", _binary_obj_user_forktree_start },
+	{ "sendpage", _binary_obj_user_sendpage_start },
+	{ "spin", _binary_obj_user_spin_start },
+	{ "fairness", _binary_obj_user_fairness_start },
+	{ "pingpong", _binary_obj_user_pingpong_start },
+	{ "pingpongs", _binary_obj_user_pingpongs_start },
+	{ "primes", _binary_obj_user_primes_start },
+	{ "hugepage", _binary_obj_user_hugepage_start },
+	{ "forkbench", _binary_obj_user_forkbench_start },
+	{ "spawnargs", _binary_obj_user_spawnargs_start },
+	{ "nullsyscall", _binary_obj_user_nullsyscall_start },
+	{ "ringtest", _binary_obj_user_ringtest_start },
+	{ "fputest", _binary_obj_user_fputest_start },
+	{ NULL, NULL }
+};
@@ -0,0 +1,2243 @@
+
+obj/user/badsegment:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 09 00 00 00       	call   80003a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+	// Try to load the kernel's TSS selector into the DS register.
+	asm volatile("movw $0x28,%ax; movw %ax,%ds");
+  800033:	66 b8 28 00          	mov    $0x28,%ax
+  800037:	8e d8                	mov    %eax,%ds
+}
+  800039:	c3                   	ret
+
+000000000080003a <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  80003a:	55                   	push   %rbp
+  80003b:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80003e:	85 ff                	test   %edi,%edi
+  800040:	7e 0d                	jle    80004f <libmain+0x15>
+		binaryname = argv[0];
+  800042:	48 8b 06             	mov    (%rsi),%rax
+  800045:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  80004c:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  80004f:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  800056:	00 00 00 
+  800059:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  80005b:	48 b8 69 00 80 00 00 	movabs $0x800069,%rax
+  800062:	00 00 00 
+  800065:	ff d0                	call   *%rax
+}
+  800067:	5d                   	pop    %rbp
+  800068:	c3                   	ret
+
+0000000000800069 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800069:	55                   	push   %rbp
+  80006a:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  80006d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800072:	48 b8 b8 00 80 00 00 	movabs $0x8000b8,%rax
+  800079:	00 00 00 
+  80007c:	ff d0                	call   *%rax
+}
+  80007e:	5d                   	pop    %rbp
+  80007f:	c3                   	ret
+
+0000000000800080 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800080:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800086:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  80008c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800091:	b8 00 00 00 00       	mov    $0x0,%eax
+  800096:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800098:	c3                   	ret
+
+0000000000800099 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800099:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80009f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8000a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000af:	48 89 fe             	mov    %rdi,%rsi
+  8000b2:	48 89 fa             	mov    %rdi,%rdx
+  8000b5:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000b7:	c3                   	ret
+
+00000000008000b8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8000b8:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8000bb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8000c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8000cc:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000d1:	48 89 f2             	mov    %rsi,%rdx
+  8000d4:	0f 05                	syscall
+	if(check && ret > 0)
+  8000d6:	48 85 c0             	test   %rax,%rax
+  8000d9:	7f 01                	jg     8000dc <sys_env_destroy+0x24>
+}
+  8000db:	c3                   	ret
+{
+  8000dc:	55                   	push   %rbp
+  8000dd:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8000e0:	49 89 c0             	mov    %rax,%r8
+  8000e3:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8000e8:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  8000ef:	00 00 00 
+  8000f2:	be 28 00 00 00       	mov    $0x28,%esi
+  8000f7:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  8000fe:	00 00 00 
+  800101:	b8 00 00 00 00       	mov    $0x0,%eax
+  800106:	49 b9 3b 05 80 00 00 	movabs $0x80053b,%r9
+  80010d:	00 00 00 
+  800110:	41 ff d1             	call   *%r9
+
+0000000000800113 <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800113:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  80011a:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  80011b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800120:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800124:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800128:	48 c1 e2 04          	shl    $0x4,%rdx
+  80012c:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800133:	00 00 00 
+  800136:	48 01 d0             	add    %rdx,%rax
+  800139:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  80013f:	c3                   	ret
+
+0000000000800140 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800140:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800146:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80014c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800151:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800156:	48 89 fe             	mov    %rdi,%rsi
+  800159:	48 89 fa             	mov    %rdi,%rdx
+  80015c:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80015e:	c3                   	ret
+
+000000000080015f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  80015f:	48 63 d2             	movslq %edx,%rdx
+  800162:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800165:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80016b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800171:	b8 04 00 00 00       	mov    $0x4,%eax
+  800176:	0f 05                	syscall
+	if(check && ret > 0)
+  800178:	48 85 c0             	test   %rax,%rax
+  80017b:	7f 01                	jg     80017e <sys_page_alloc+0x1f>
+}
+  80017d:	c3                   	ret
+{
+  80017e:	55                   	push   %rbp
+  80017f:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800182:	49 89 c0             	mov    %rax,%r8
+  800185:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80018a:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  800191:	00 00 00 
+  800194:	be 28 00 00 00       	mov    $0x28,%esi
+  800199:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  8001a0:	00 00 00 
+  8001a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a8:	49 b9 3b 05 80 00 00 	movabs $0x80053b,%r9
+  8001af:	00 00 00 
+  8001b2:	41 ff d1             	call   *%r9
+
+00000000008001b5 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8001b5:	48 63 d2             	movslq %edx,%rdx
+  8001b8:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8001bb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8001c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8001c7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8001cc:	0f 05                	syscall
+	if(check && ret > 0)
+  8001ce:	48 85 c0             	test   %rax,%rax
+  8001d1:	7f 01                	jg     8001d4 <sys_page_alloc_huge+0x1f>
+}
+  8001d3:	c3                   	ret
+{
+  8001d4:	55                   	push   %rbp
+  8001d5:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001d8:	49 89 c0             	mov    %rax,%r8
+  8001db:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8001e0:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  8001e7:	00 00 00 
+  8001ea:	be 28 00 00 00       	mov    $0x28,%esi
+  8001ef:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  8001f6:	00 00 00 
+  8001f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fe:	49 b9 3b 05 80 00 00 	movabs $0x80053b,%r9
+  800205:	00 00 00 
+  800208:	41 ff d1             	call   *%r9
+
+000000000080020b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80020b:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  80020e:	48 63 d2             	movslq %edx,%rdx
+  800211:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800214:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  800217:	b8 05 00 00 00       	mov    $0x5,%eax
+  80021c:	0f 05                	syscall
+	if(check && ret > 0)
+  80021e:	48 85 c0             	test   %rax,%rax
+  800221:	7f 01                	jg     800224 <sys_page_map+0x19>
+}
+  800223:	c3                   	ret
+{
+  800224:	55                   	push   %rbp
+  800225:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800228:	49 89 c0             	mov    %rax,%r8
+  80022b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800230:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  800237:	00 00 00 
+  80023a:	be 28 00 00 00       	mov    $0x28,%esi
+  80023f:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  800246:	00 00 00 
+  800249:	b8 00 00 00 00       	mov    $0x0,%eax
+  80024e:	49 b9 3b 05 80 00 00 	movabs $0x80053b,%r9
+  800255:	00 00 00 
+  800258:	41 ff d1             	call   *%r9
+
+000000000080025b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  80025b:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80025e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800264:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80026a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80026f:	b8 06 00 00 00       	mov    $0x6,%eax
+  800274:	0f 05                	syscall
+	if(check && ret > 0)
+  800276:	48 85 c0             	test   %rax,%rax
+  800279:	7f 01                	jg     80027c <sys_page_unmap+0x21>
+}
+  80027b:	c3                   	ret
+{
+  80027c:	55                   	push   %rbp
+  80027d:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800280:	49 89 c0             	mov    %rax,%r8
+  800283:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800288:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  80028f:	00 00 00 
+  800292:	be 28 00 00 00       	mov    $0x28,%esi
+  800297:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  80029e:	00 00 00 
+  8002a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a6:	49 b9 3b 05 80 00 00 	movabs $0x80053b,%r9
+  8002ad:	00 00 00 
+  8002b0:	41 ff d1             	call   *%r9
+
+00000000008002b3 <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  8002b3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002c4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8002c9:	48 89 fe             	mov    %rdi,%rsi
+  8002cc:	48 89 fa             	mov    %rdi,%rdx
+  8002cf:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8002d1:	c3                   	ret
+
+00000000008002d2 <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  8002d2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002e3:	b8 10 00 00 00       	mov    $0x10,%eax
+  8002e8:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  8002ea:	c3                   	ret
+
+00000000008002eb <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  8002eb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002f7:	b8 11 00 00 00       	mov    $0x11,%eax
+  8002fc:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  8002fe:	c3                   	ret
+
+00000000008002ff <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  8002ff:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  800302:	48 63 f6             	movslq %esi,%rsi
+  800305:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800308:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80030e:	b8 12 00 00 00       	mov    $0x12,%eax
+  800313:	0f 05                	syscall
+	if(check && ret > 0)
+  800315:	48 85 c0             	test   %rax,%rax
+  800318:	7f 01                	jg     80031b <sys_page_batch+0x1c>
+}
+  80031a:	c3                   	ret
+{
+  80031b:	55                   	push   %rbp
+  80031c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80031f:	49 89 c0             	mov    %rax,%r8
+  800322:	b9 12 00 00 00       	mov    $0x12,%ecx
+  800327:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  80032e:	00 00 00 
+  800331:	be 28 00 00 00       	mov    $0x28,%esi
+  800336:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  80033d:	00 00 00 
+  800340:	b8 00 00 00 00       	mov    $0x0,%eax
+  800345:	49 b9 3b 05 80 00 00 	movabs $0x80053b,%r9
+  80034c:	00 00 00 
+  80034f:	41 ff d1             	call   *%r9
+
+0000000000800352 <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  800352:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800358:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80035e:	be 00 00 00 00       	mov    $0x0,%esi
+  800363:	b8 13 00 00 00       	mov    $0x13,%eax
+  800368:	48 89 f2             	mov    %rsi,%rdx
+  80036b:	0f 05                	syscall
+	if(check && ret > 0)
+  80036d:	48 85 c0             	test   %rax,%rax
+  800370:	7f 01                	jg     800373 <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  800372:	c3                   	ret
+{
+  800373:	55                   	push   %rbp
+  800374:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800377:	49 89 c0             	mov    %rax,%r8
+  80037a:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80037f:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  800386:	00 00 00 
+  800389:	be 28 00 00 00       	mov    $0x28,%esi
+  80038e:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  800395:	00 00 00 
+  800398:	b8 00 00 00 00       	mov    $0x0,%eax
+  80039d:	49 b9 3b 05 80 00 00 	movabs $0x80053b,%r9
+  8003a4:	00 00 00 
+  8003a7:	41 ff d1             	call   *%r9
+
+00000000008003aa <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  8003aa:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8003b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8003b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003bb:	b8 14 00 00 00       	mov    $0x14,%eax
+  8003c0:	48 89 fe             	mov    %rdi,%rsi
+  8003c3:	48 89 fa             	mov    %rdi,%rdx
+  8003c6:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8003c8:	c3                   	ret
+
+00000000008003c9 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  8003c9:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8003cc:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8003d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8003d8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8003dd:	0f 05                	syscall
+	if(check && ret > 0)
+  8003df:	48 85 c0             	test   %rax,%rax
+  8003e2:	7f 01                	jg     8003e5 <sys_page_unmap_range+0x1c>
+}
+  8003e4:	c3                   	ret
+{
+  8003e5:	55                   	push   %rbp
+  8003e6:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003e9:	49 89 c0             	mov    %rax,%r8
+  8003ec:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8003f1:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  8003f8:	00 00 00 
+  8003fb:	be 28 00 00 00       	mov    $0x28,%esi
+  800400:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  800407:	00 00 00 
+  80040a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040f:	49 b9 3b 05 80 00 00 	movabs $0x80053b,%r9
+  800416:	00 00 00 
+  800419:	41 ff d1             	call   *%r9
+
+000000000080041c <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80041c:	48 63 f6             	movslq %esi,%rsi
+  80041f:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800422:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800428:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80042e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800433:	b8 08 00 00 00       	mov    $0x8,%eax
+  800438:	0f 05                	syscall
+	if(check && ret > 0)
+  80043a:	48 85 c0             	test   %rax,%rax
+  80043d:	7f 01                	jg     800440 <sys_env_set_status+0x24>
+}
+  80043f:	c3                   	ret
+{
+  800440:	55                   	push   %rbp
+  800441:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800444:	49 89 c0             	mov    %rax,%r8
+  800447:	b9 08 00 00 00       	mov    $0x8,%ecx
+  80044c:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  800453:	00 00 00 
+  800456:	be 28 00 00 00       	mov    $0x28,%esi
+  80045b:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  800462:	00 00 00 
+  800465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046a:	49 b9 3b 05 80 00 00 	movabs $0x80053b,%r9
+  800471:	00 00 00 
+  800474:	41 ff d1             	call   *%r9
+
+0000000000800477 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  800477:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80047a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800480:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800486:	ba 00 00 00 00       	mov    $0x0,%edx
+  80048b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800490:	0f 05                	syscall
+	if(check && ret > 0)
+  800492:	48 85 c0             	test   %rax,%rax
+  800495:	7f 01                	jg     800498 <sys_env_set_pgfault_upcall+0x21>
+}
+  800497:	c3                   	ret
+{
+  800498:	55                   	push   %rbp
+  800499:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80049c:	49 89 c0             	mov    %rax,%r8
+  80049f:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004a4:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  8004ab:	00 00 00 
+  8004ae:	be 28 00 00 00       	mov    $0x28,%esi
+  8004b3:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  8004ba:	00 00 00 
+  8004bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c2:	49 b9 3b 05 80 00 00 	movabs $0x80053b,%r9
+  8004c9:	00 00 00 
+  8004cc:	41 ff d1             	call   *%r9
+
+00000000008004cf <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8004cf:	48 63 ff             	movslq %edi,%rdi
+  8004d2:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  8004d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8004db:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8004e0:	0f 05                	syscall
+}
+  8004e2:	c3                   	ret
+
+00000000008004e3 <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  8004e3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8004e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8004ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8004f4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8004f9:	48 89 f2             	mov    %rsi,%rdx
+  8004fc:	0f 05                	syscall
+	if(check && ret > 0)
+  8004fe:	48 85 c0             	test   %rax,%rax
+  800501:	7f 01                	jg     800504 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  800503:	c3                   	ret
+{
+  800504:	55                   	push   %rbp
+  800505:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800508:	49 89 c0             	mov    %rax,%r8
+  80050b:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  800510:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  800517:	00 00 00 
+  80051a:	be 28 00 00 00       	mov    $0x28,%esi
+  80051f:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  800526:	00 00 00 
+  800529:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052e:	49 b9 3b 05 80 00 00 	movabs $0x80053b,%r9
+  800535:	00 00 00 
+  800538:	41 ff d1             	call   *%r9
+
+000000000080053b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80053b:	55                   	push   %rbp
+  80053c:	48 89 e5             	mov    %rsp,%rbp
+  80053f:	41 56                	push   %r14
+  800541:	41 55                	push   %r13
+  800543:	41 54                	push   %r12
+  800545:	53                   	push   %rbx
+  800546:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80054d:	49 89 fc             	mov    %rdi,%r12
+  800550:	41 89 f5             	mov    %esi,%r13d
+  800553:	48 89 d3             	mov    %rdx,%rbx
+  800556:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80055d:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800564:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  80056b:	84 c0                	test   %al,%al
+  80056d:	74 26                	je     800595 <_panic+0x5a>
+  80056f:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800576:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80057d:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800581:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800585:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800589:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80058d:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800591:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800595:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  80059c:	00 00 00 
+  80059f:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8005a6:	00 00 00 
+  8005a9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005ad:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8005b4:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8005bb:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005c2:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  8005c9:	00 00 00 
+  8005cc:	4c 8b 30             	mov    (%rax),%r14
+  8005cf:	48 b8 13 01 80 00 00 	movabs $0x800113,%rax
+  8005d6:	00 00 00 
+  8005d9:	ff d0                	call   *%rax
+  8005db:	89 c6                	mov    %eax,%esi
+  8005dd:	45 89 e8             	mov    %r13d,%r8d
+  8005e0:	4c 89 e1             	mov    %r12,%rcx
+  8005e3:	4c 89 f2             	mov    %r14,%rdx
+  8005e6:	48 bf b8 12 80 00 00 	movabs $0x8012b8,%rdi
+  8005ed:	00 00 00 
+  8005f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f5:	49 bc da 06 80 00 00 	movabs $0x8006da,%r12
+  8005fc:	00 00 00 
+  8005ff:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800602:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  800609:	48 89 df             	mov    %rbx,%rdi
+  80060c:	48 b8 76 06 80 00 00 	movabs $0x800676,%rax
+  800613:	00 00 00 
+  800616:	ff d0                	call   *%rax
+	cprintf("\n");
+  800618:	48 bf db 12 80 00 00 	movabs $0x8012db,%rdi
+  80061f:	00 00 00 
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80062a:	cc                   	int3
+	while (1)
+  80062b:	eb fd                	jmp    80062a <_panic+0xef>
+
+000000000080062d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80062d:	55                   	push   %rbp
+  80062e:	48 89 e5             	mov    %rsp,%rbp
+  800631:	53                   	push   %rbx
+  800632:	48 83 ec 08          	sub    $0x8,%rsp
+  800636:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  800639:	8b 06                	mov    (%rsi),%eax
+  80063b:	8d 50 01             	lea    0x1(%rax),%edx
+  80063e:	89 16                	mov    %edx,(%rsi)
+  800640:	48 98                	cltq
+  800642:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  800647:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80064d:	74 0a                	je     800659 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80064f:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800653:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800657:	c9                   	leave
+  800658:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800659:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80065d:	be ff 00 00 00       	mov    $0xff,%esi
+  800662:	48 b8 80 00 80 00 00 	movabs $0x800080,%rax
+  800669:	00 00 00 
+  80066c:	ff d0                	call   *%rax
+		b->idx = 0;
+  80066e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800674:	eb d9                	jmp    80064f <putch+0x22>
+
+0000000000800676 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800676:	55                   	push   %rbp
+  800677:	48 89 e5             	mov    %rsp,%rbp
+  80067a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800681:	48 89 fa             	mov    %rdi,%rdx
+  800684:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  800687:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  80068e:	00 00 00 
+	b.cnt = 0;
+  800691:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800698:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80069b:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  8006a2:	48 bf 2d 06 80 00 00 	movabs $0x80062d,%rdi
+  8006a9:	00 00 00 
+  8006ac:	48 b8 94 08 80 00 00 	movabs $0x800894,%rax
+  8006b3:	00 00 00 
+  8006b6:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8006b8:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  8006bf:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8006c6:	48 b8 80 00 80 00 00 	movabs $0x800080,%rax
+  8006cd:	00 00 00 
+  8006d0:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  8006d2:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  8006d8:	c9                   	leave
+  8006d9:	c3                   	ret
+
+00000000008006da <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8006da:	55                   	push   %rbp
+  8006db:	48 89 e5             	mov    %rsp,%rbp
+  8006de:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8006e5:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8006ec:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8006f3:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8006fa:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800701:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800708:	84 c0                	test   %al,%al
+  80070a:	74 20                	je     80072c <cprintf+0x52>
+  80070c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800710:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800714:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800718:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80071c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800720:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800724:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800728:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80072c:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  800733:	00 00 00 
+  800736:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80073d:	00 00 00 
+  800740:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800744:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80074b:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800752:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  800759:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  800760:	48 b8 76 06 80 00 00 	movabs $0x800676,%rax
+  800767:	00 00 00 
+  80076a:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  80076c:	c9                   	leave
+  80076d:	c3                   	ret
+
+000000000080076e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80076e:	55                   	push   %rbp
+  80076f:	48 89 e5             	mov    %rsp,%rbp
+  800772:	41 57                	push   %r15
+  800774:	41 56                	push   %r14
+  800776:	41 55                	push   %r13
+  800778:	41 54                	push   %r12
+  80077a:	53                   	push   %rbx
+  80077b:	48 83 ec 18          	sub    $0x18,%rsp
+  80077f:	49 89 fc             	mov    %rdi,%r12
+  800782:	49 89 f5             	mov    %rsi,%r13
+  800785:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800789:	44 89 c3             	mov    %r8d,%ebx
+  80078c:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80078f:	41 89 cf             	mov    %ecx,%r15d
+  800792:	4c 39 fa             	cmp    %r15,%rdx
+  800795:	72 29                	jb     8007c0 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800797:	48 89 d0             	mov    %rdx,%rax
+  80079a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80079f:	49 f7 f7             	div    %r15
+  8007a2:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8007a6:	48 89 c2             	mov    %rax,%rdx
+  8007a9:	48 b8 6e 07 80 00 00 	movabs $0x80076e,%rax
+  8007b0:	00 00 00 
+  8007b3:	ff d0                	call   *%rax
+  8007b5:	eb 10                	jmp    8007c7 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8007b7:	4c 89 ee             	mov    %r13,%rsi
+  8007ba:	44 89 f7             	mov    %r14d,%edi
+  8007bd:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  8007c0:	83 eb 01             	sub    $0x1,%ebx
+  8007c3:	85 db                	test   %ebx,%ebx
+  8007c5:	7f f0                	jg     8007b7 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007d0:	49 f7 f7             	div    %r15
+  8007d3:	48 b8 dd 12 80 00 00 	movabs $0x8012dd,%rax
+  8007da:	00 00 00 
+  8007dd:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  8007e1:	4c 89 ee             	mov    %r13,%rsi
+  8007e4:	41 ff d4             	call   *%r12
+}
+  8007e7:	48 83 c4 18          	add    $0x18,%rsp
+  8007eb:	5b                   	pop    %rbx
+  8007ec:	41 5c                	pop    %r12
+  8007ee:	41 5d                	pop    %r13
+  8007f0:	41 5e                	pop    %r14
+  8007f2:	41 5f                	pop    %r15
+  8007f4:	5d                   	pop    %rbp
+  8007f5:	c3                   	ret
+
+00000000008007f6 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  8007f6:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  8007fa:	48 8b 06             	mov    (%rsi),%rax
+  8007fd:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800801:	73 0a                	jae    80080d <sprintputch+0x17>
+		*b->buf++ = ch;
+  800803:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800807:	48 89 16             	mov    %rdx,(%rsi)
+  80080a:	40 88 38             	mov    %dil,(%rax)
+}
+  80080d:	c3                   	ret
+
+000000000080080e <printfmt>:
+{
+  80080e:	55                   	push   %rbp
+  80080f:	48 89 e5             	mov    %rsp,%rbp
+  800812:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800819:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800820:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800827:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80082e:	84 c0                	test   %al,%al
+  800830:	74 20                	je     800852 <printfmt+0x44>
+  800832:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800836:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80083a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80083e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800842:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800846:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80084a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80084e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  800852:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800859:	00 00 00 
+  80085c:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800863:	00 00 00 
+  800866:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80086a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800871:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800878:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80087f:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800886:	48 b8 94 08 80 00 00 	movabs $0x800894,%rax
+  80088d:	00 00 00 
+  800890:	ff d0                	call   *%rax
+}
+  800892:	c9                   	leave
+  800893:	c3                   	ret
+
+0000000000800894 <vprintfmt>:
+{
+  800894:	55                   	push   %rbp
+  800895:	48 89 e5             	mov    %rsp,%rbp
+  800898:	41 57                	push   %r15
+  80089a:	41 56                	push   %r14
+  80089c:	41 55                	push   %r13
+  80089e:	41 54                	push   %r12
+  8008a0:	53                   	push   %rbx
+  8008a1:	48 83 ec 48          	sub    $0x48,%rsp
+  8008a5:	49 89 fe             	mov    %rdi,%r14
+  8008a8:	49 89 f5             	mov    %rsi,%r13
+  8008ab:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  8008ae:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  8008b2:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  8008b6:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8008ba:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8008be:	eb 09                	jmp    8008c9 <vprintfmt+0x35>
+			putch(ch, putdat);
+  8008c0:	4c 89 ee             	mov    %r13,%rsi
+  8008c3:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008c6:	4c 89 e3             	mov    %r12,%rbx
+  8008c9:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8008cd:	0f b6 3b             	movzbl (%rbx),%edi
+  8008d0:	83 ff 25             	cmp    $0x25,%edi
+  8008d3:	74 13                	je     8008e8 <vprintfmt+0x54>
+			if (ch == '\0')
+  8008d5:	85 ff                	test   %edi,%edi
+  8008d7:	75 e7                	jne    8008c0 <vprintfmt+0x2c>
+}
+  8008d9:	48 83 c4 48          	add    $0x48,%rsp
+  8008dd:	5b                   	pop    %rbx
+  8008de:	41 5c                	pop    %r12
+  8008e0:	41 5d                	pop    %r13
+  8008e2:	41 5e                	pop    %r14
+  8008e4:	41 5f                	pop    %r15
+  8008e6:	5d                   	pop    %rbp
+  8008e7:	c3                   	ret
+		padc = ' ';
+  8008e8:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  8008ec:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  8008f3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  8008f9:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  800900:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800905:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80090a:	41 0f b6 14 24       	movzbl (%r12),%edx
+  80090f:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  800912:	3c 55                	cmp    $0x55,%al
+  800914:	0f 87 4f 05 00 00    	ja     800e69 <vprintfmt+0x5d5>
+  80091a:	0f b6 c0             	movzbl %al,%eax
+  80091d:	48 be a0 13 80 00 00 	movabs $0x8013a0,%rsi
+  800924:	00 00 00 
+  800927:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  80092a:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  80092d:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  800931:	eb d2                	jmp    800905 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800933:	49 89 dc             	mov    %rbx,%r12
+  800936:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  80093a:	eb c9                	jmp    800905 <vprintfmt+0x71>
+  80093c:	0f b6 d2             	movzbl %dl,%edx
+  80093f:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  800942:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  800948:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  80094c:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  800951:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  800956:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  800959:	83 f8 09             	cmp    $0x9,%eax
+  80095c:	77 20                	ja     80097e <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  80095e:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  800962:	eb e4                	jmp    800948 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  800964:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800967:	83 f8 2f             	cmp    $0x2f,%eax
+  80096a:	77 27                	ja     800993 <vprintfmt+0xff>
+  80096c:	89 c2                	mov    %eax,%edx
+  80096e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800972:	83 c0 08             	add    $0x8,%eax
+  800975:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800978:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  80097b:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  80097e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800982:	79 81                	jns    800905 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  800984:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  800988:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80098e:	e9 72 ff ff ff       	jmp    800905 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  800993:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800997:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099f:	eb d7                	jmp    800978 <vprintfmt+0xe4>
+			if (width < 0)
+  8009a1:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  8009a4:	85 f6                	test   %esi,%esi
+  8009a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ab:	0f 49 c6             	cmovns %esi,%eax
+  8009ae:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8009b1:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8009b4:	e9 4c ff ff ff       	jmp    800905 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8009b9:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  8009bc:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  8009c3:	e9 3d ff ff ff       	jmp    800905 <vprintfmt+0x71>
+			lflag++;
+  8009c8:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8009cb:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8009ce:	e9 32 ff ff ff       	jmp    800905 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  8009d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d9:	77 19                	ja     8009f4 <vprintfmt+0x160>
+  8009db:	89 c2                	mov    %eax,%edx
+  8009dd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e1:	83 c0 08             	add    $0x8,%eax
+  8009e4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e7:	8b 3a                	mov    (%rdx),%edi
+  8009e9:	4c 89 ee             	mov    %r13,%rsi
+  8009ec:	41 ff d6             	call   *%r14
+			break;
+  8009ef:	e9 d5 fe ff ff       	jmp    8008c9 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  8009f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a00:	eb e5                	jmp    8009e7 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  800a02:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a05:	83 f8 2f             	cmp    $0x2f,%eax
+  800a08:	77 5a                	ja     800a64 <vprintfmt+0x1d0>
+  800a0a:	89 c2                	mov    %eax,%edx
+  800a0c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a10:	83 c0 08             	add    $0x8,%eax
+  800a13:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800a16:	8b 02                	mov    (%rdx),%eax
+  800a18:	89 c1                	mov    %eax,%ecx
+  800a1a:	f7 d9                	neg    %ecx
+  800a1c:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a1f:	83 f9 08             	cmp    $0x8,%ecx
+  800a22:	7f 4e                	jg     800a72 <vprintfmt+0x1de>
+  800a24:	48 63 c1             	movslq %ecx,%rax
+  800a27:	48 ba 60 16 80 00 00 	movabs $0x801660,%rdx
+  800a2e:	00 00 00 
+  800a31:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800a35:	48 85 c0             	test   %rax,%rax
+  800a38:	74 38                	je     800a72 <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800a3a:	48 89 c1             	mov    %rax,%rcx
+  800a3d:	48 ba fe 12 80 00 00 	movabs $0x8012fe,%rdx
+  800a44:	00 00 00 
+  800a47:	4c 89 ee             	mov    %r13,%rsi
+  800a4a:	4c 89 f7             	mov    %r14,%rdi
+  800a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a52:	49 b8 0e 08 80 00 00 	movabs $0x80080e,%r8
+  800a59:	00 00 00 
+  800a5c:	41 ff d0             	call   *%r8
+  800a5f:	e9 65 fe ff ff       	jmp    8008c9 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  800a64:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a68:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a70:	eb a4                	jmp    800a16 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  800a72:	48 ba f5 12 80 00 00 	movabs $0x8012f5,%rdx
+  800a79:	00 00 00 
+  800a7c:	4c 89 ee             	mov    %r13,%rsi
+  800a7f:	4c 89 f7             	mov    %r14,%rdi
+  800a82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a87:	49 b8 0e 08 80 00 00 	movabs $0x80080e,%r8
+  800a8e:	00 00 00 
+  800a91:	41 ff d0             	call   *%r8
+  800a94:	e9 30 fe ff ff       	jmp    8008c9 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800a99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a9c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9f:	77 36                	ja     800ad7 <vprintfmt+0x243>
+  800aa1:	89 c2                	mov    %eax,%edx
+  800aa3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa7:	83 c0 08             	add    $0x8,%eax
+  800aaa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aad:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800ab0:	48 85 c9             	test   %rcx,%rcx
+  800ab3:	48 b8 ee 12 80 00 00 	movabs $0x8012ee,%rax
+  800aba:	00 00 00 
+  800abd:	48 0f 45 c1          	cmovne %rcx,%rax
+  800ac1:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800ac5:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800ac9:	7e 06                	jle    800ad1 <vprintfmt+0x23d>
+  800acb:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800acf:	75 14                	jne    800ae5 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ad1:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ad5:	eb 64                	jmp    800b3b <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800ad7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800adb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800adf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae3:	eb c8                	jmp    800aad <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ae5:	49 63 f7             	movslq %r15d,%rsi
+  800ae8:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800aec:	48 b8 77 0f 80 00 00 	movabs $0x800f77,%rax
+  800af3:	00 00 00 
+  800af6:	ff d0                	call   *%rax
+  800af8:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800afb:	29 c1                	sub    %eax,%ecx
+  800afd:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800b00:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  800b03:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800b07:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b0a:	eb 0d                	jmp    800b19 <vprintfmt+0x285>
+					putch(padc, putdat);
+  800b0c:	4c 89 ee             	mov    %r13,%rsi
+  800b0f:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  800b12:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b15:	41 83 ec 01          	sub    $0x1,%r12d
+  800b19:	45 85 e4             	test   %r12d,%r12d
+  800b1c:	7f ee                	jg     800b0c <vprintfmt+0x278>
+  800b1e:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  800b21:	85 c9                	test   %ecx,%ecx
+  800b23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b28:	0f 49 c1             	cmovns %ecx,%eax
+  800b2b:	29 c1                	sub    %eax,%ecx
+  800b2d:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  800b30:	eb 9f                	jmp    800ad1 <vprintfmt+0x23d>
+					putch(ch, putdat);
+  800b32:	4c 89 ee             	mov    %r13,%rsi
+  800b35:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b38:	4c 89 e2             	mov    %r12,%rdx
+  800b3b:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800b3f:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800b45:	0f be f8             	movsbl %al,%edi
+  800b48:	85 ff                	test   %edi,%edi
+  800b4a:	74 29                	je     800b75 <vprintfmt+0x2e1>
+  800b4c:	45 85 ff             	test   %r15d,%r15d
+  800b4f:	78 06                	js     800b57 <vprintfmt+0x2c3>
+  800b51:	41 83 ef 01          	sub    $0x1,%r15d
+  800b55:	78 1e                	js     800b75 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b57:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800b5b:	74 d5                	je     800b32 <vprintfmt+0x29e>
+  800b5d:	0f be c0             	movsbl %al,%eax
+  800b60:	83 e8 20             	sub    $0x20,%eax
+  800b63:	83 f8 5e             	cmp    $0x5e,%eax
+  800b66:	76 ca                	jbe    800b32 <vprintfmt+0x29e>
+					putch('?', putdat);
+  800b68:	4c 89 ee             	mov    %r13,%rsi
+  800b6b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b70:	41 ff d6             	call   *%r14
+  800b73:	eb c3                	jmp    800b38 <vprintfmt+0x2a4>
+  800b75:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800b79:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800b7c:	41 01 c4             	add    %eax,%r12d
+  800b7f:	41 29 d4             	sub    %edx,%r12d
+  800b82:	eb 0f                	jmp    800b93 <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  800b84:	4c 89 ee             	mov    %r13,%rsi
+  800b87:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b8c:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800b8f:	41 83 ec 01          	sub    $0x1,%r12d
+  800b93:	45 85 e4             	test   %r12d,%r12d
+  800b96:	7f ec                	jg     800b84 <vprintfmt+0x2f0>
+  800b98:	e9 2c fd ff ff       	jmp    8008c9 <vprintfmt+0x35>
+	if (lflag >= 2)
+  800b9d:	83 f9 01             	cmp    $0x1,%ecx
+  800ba0:	7f 1d                	jg     800bbf <vprintfmt+0x32b>
+	else if (lflag)
+  800ba2:	85 c9                	test   %ecx,%ecx
+  800ba4:	74 5e                	je     800c04 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800ba6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba9:	83 f8 2f             	cmp    $0x2f,%eax
+  800bac:	77 48                	ja     800bf6 <vprintfmt+0x362>
+  800bae:	89 c2                	mov    %eax,%edx
+  800bb0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb4:	83 c0 08             	add    $0x8,%eax
+  800bb7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bba:	4c 8b 22             	mov    (%rdx),%r12
+  800bbd:	eb 17                	jmp    800bd6 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800bbf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc2:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc5:	77 21                	ja     800be8 <vprintfmt+0x354>
+  800bc7:	89 c2                	mov    %eax,%edx
+  800bc9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bcd:	83 c0 08             	add    $0x8,%eax
+  800bd0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd3:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800bd6:	4d 85 e4             	test   %r12,%r12
+  800bd9:	78 50                	js     800c2b <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  800bdb:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800bde:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800be3:	e9 b4 01 00 00       	jmp    800d9c <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800be8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf4:	eb dd                	jmp    800bd3 <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800bf6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bfa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bfe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c02:	eb b6                	jmp    800bba <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800c04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c07:	83 f8 2f             	cmp    $0x2f,%eax
+  800c0a:	77 11                	ja     800c1d <vprintfmt+0x389>
+  800c0c:	89 c2                	mov    %eax,%edx
+  800c0e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c12:	83 c0 08             	add    $0x8,%eax
+  800c15:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c18:	4c 63 22             	movslq (%rdx),%r12
+  800c1b:	eb b9                	jmp    800bd6 <vprintfmt+0x342>
+  800c1d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c21:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c29:	eb ed                	jmp    800c18 <vprintfmt+0x384>
+				putch('-', putdat);
+  800c2b:	4c 89 ee             	mov    %r13,%rsi
+  800c2e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c33:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800c36:	4c 89 e2             	mov    %r12,%rdx
+  800c39:	48 f7 da             	neg    %rdx
+			base = 10;
+  800c3c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800c41:	e9 56 01 00 00       	jmp    800d9c <vprintfmt+0x508>
+	if (lflag >= 2)
+  800c46:	83 f9 01             	cmp    $0x1,%ecx
+  800c49:	7f 25                	jg     800c70 <vprintfmt+0x3dc>
+	else if (lflag)
+  800c4b:	85 c9                	test   %ecx,%ecx
+  800c4d:	74 5e                	je     800cad <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800c4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c52:	83 f8 2f             	cmp    $0x2f,%eax
+  800c55:	77 48                	ja     800c9f <vprintfmt+0x40b>
+  800c57:	89 c2                	mov    %eax,%edx
+  800c59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c5d:	83 c0 08             	add    $0x8,%eax
+  800c60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c63:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800c66:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800c6b:	e9 2c 01 00 00       	jmp    800d9c <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800c70:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c73:	83 f8 2f             	cmp    $0x2f,%eax
+  800c76:	77 19                	ja     800c91 <vprintfmt+0x3fd>
+  800c78:	89 c2                	mov    %eax,%edx
+  800c7a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c7e:	83 c0 08             	add    $0x8,%eax
+  800c81:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c84:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800c87:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800c8c:	e9 0b 01 00 00       	jmp    800d9c <vprintfmt+0x508>
+  800c91:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c95:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c9d:	eb e5                	jmp    800c84 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800c9f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cab:	eb b6                	jmp    800c63 <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800cad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cb0:	83 f8 2f             	cmp    $0x2f,%eax
+  800cb3:	77 18                	ja     800ccd <vprintfmt+0x439>
+  800cb5:	89 c2                	mov    %eax,%edx
+  800cb7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cbb:	83 c0 08             	add    $0x8,%eax
+  800cbe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cc1:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800cc3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800cc8:	e9 cf 00 00 00       	jmp    800d9c <vprintfmt+0x508>
+  800ccd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cd1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cd5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd9:	eb e6                	jmp    800cc1 <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800cdb:	83 f9 01             	cmp    $0x1,%ecx
+  800cde:	7f 25                	jg     800d05 <vprintfmt+0x471>
+	else if (lflag)
+  800ce0:	85 c9                	test   %ecx,%ecx
+  800ce2:	74 5b                	je     800d3f <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800ce4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce7:	83 f8 2f             	cmp    $0x2f,%eax
+  800cea:	77 45                	ja     800d31 <vprintfmt+0x49d>
+  800cec:	89 c2                	mov    %eax,%edx
+  800cee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cf2:	83 c0 08             	add    $0x8,%eax
+  800cf5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf8:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800cfb:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800d00:	e9 97 00 00 00       	jmp    800d9c <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800d05:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d08:	83 f8 2f             	cmp    $0x2f,%eax
+  800d0b:	77 16                	ja     800d23 <vprintfmt+0x48f>
+  800d0d:	89 c2                	mov    %eax,%edx
+  800d0f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d13:	83 c0 08             	add    $0x8,%eax
+  800d16:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d19:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800d1c:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800d21:	eb 79                	jmp    800d9c <vprintfmt+0x508>
+  800d23:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d27:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d2f:	eb e8                	jmp    800d19 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800d31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d3d:	eb b9                	jmp    800cf8 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800d3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d42:	83 f8 2f             	cmp    $0x2f,%eax
+  800d45:	77 15                	ja     800d5c <vprintfmt+0x4c8>
+  800d47:	89 c2                	mov    %eax,%edx
+  800d49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d4d:	83 c0 08             	add    $0x8,%eax
+  800d50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d53:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800d55:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800d5a:	eb 40                	jmp    800d9c <vprintfmt+0x508>
+  800d5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d68:	eb e9                	jmp    800d53 <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800d6a:	4c 89 ee             	mov    %r13,%rsi
+  800d6d:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d72:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800d75:	4c 89 ee             	mov    %r13,%rsi
+  800d78:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d7d:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800d80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d83:	83 f8 2f             	cmp    $0x2f,%eax
+  800d86:	77 34                	ja     800dbc <vprintfmt+0x528>
+  800d88:	89 c2                	mov    %eax,%edx
+  800d8a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d8e:	83 c0 08             	add    $0x8,%eax
+  800d91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800d94:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800d97:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800d9c:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800da1:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800da5:	4c 89 ee             	mov    %r13,%rsi
+  800da8:	4c 89 f7             	mov    %r14,%rdi
+  800dab:	48 b8 6e 07 80 00 00 	movabs $0x80076e,%rax
+  800db2:	00 00 00 
+  800db5:	ff d0                	call   *%rax
+			break;
+  800db7:	e9 0d fb ff ff       	jmp    8008c9 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800dbc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dc0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dc4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc8:	eb ca                	jmp    800d94 <vprintfmt+0x500>
+	if (lflag >= 2)
+  800dca:	83 f9 01             	cmp    $0x1,%ecx
+  800dcd:	7f 22                	jg     800df1 <vprintfmt+0x55d>
+	else if (lflag)
+  800dcf:	85 c9                	test   %ecx,%ecx
+  800dd1:	74 58                	je     800e2b <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800dd3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dd6:	83 f8 2f             	cmp    $0x2f,%eax
+  800dd9:	77 42                	ja     800e1d <vprintfmt+0x589>
+  800ddb:	89 c2                	mov    %eax,%edx
+  800ddd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800de1:	83 c0 08             	add    $0x8,%eax
+  800de4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800de7:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800dea:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800def:	eb ab                	jmp    800d9c <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800df1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800df4:	83 f8 2f             	cmp    $0x2f,%eax
+  800df7:	77 16                	ja     800e0f <vprintfmt+0x57b>
+  800df9:	89 c2                	mov    %eax,%edx
+  800dfb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dff:	83 c0 08             	add    $0x8,%eax
+  800e02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e05:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800e08:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800e0d:	eb 8d                	jmp    800d9c <vprintfmt+0x508>
+  800e0f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e13:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e1b:	eb e8                	jmp    800e05 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800e1d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e21:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e29:	eb bc                	jmp    800de7 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800e2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e2e:	83 f8 2f             	cmp    $0x2f,%eax
+  800e31:	77 18                	ja     800e4b <vprintfmt+0x5b7>
+  800e33:	89 c2                	mov    %eax,%edx
+  800e35:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e39:	83 c0 08             	add    $0x8,%eax
+  800e3c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e3f:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800e41:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800e46:	e9 51 ff ff ff       	jmp    800d9c <vprintfmt+0x508>
+  800e4b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e4f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e53:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e57:	eb e6                	jmp    800e3f <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800e59:	4c 89 ee             	mov    %r13,%rsi
+  800e5c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e61:	41 ff d6             	call   *%r14
+			break;
+  800e64:	e9 60 fa ff ff       	jmp    8008c9 <vprintfmt+0x35>
+			putch('%', putdat);
+  800e69:	4c 89 ee             	mov    %r13,%rsi
+  800e6c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e71:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800e74:	4c 89 e3             	mov    %r12,%rbx
+  800e77:	eb 04                	jmp    800e7d <vprintfmt+0x5e9>
+  800e79:	48 83 eb 01          	sub    $0x1,%rbx
+  800e7d:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e81:	75 f6                	jne    800e79 <vprintfmt+0x5e5>
+  800e83:	e9 41 fa ff ff       	jmp    8008c9 <vprintfmt+0x35>
+
+0000000000800e88 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800e88:	55                   	push   %rbp
+  800e89:	48 89 e5             	mov    %rsp,%rbp
+  800e8c:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800e90:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800e94:	48 63 c6             	movslq %esi,%rax
+  800e97:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800e9c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800ea0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800ea7:	48 85 ff             	test   %rdi,%rdi
+  800eaa:	74 2a                	je     800ed6 <vsnprintf+0x4e>
+  800eac:	85 f6                	test   %esi,%esi
+  800eae:	7e 26                	jle    800ed6 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800eb0:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800eb4:	48 bf f6 07 80 00 00 	movabs $0x8007f6,%rdi
+  800ebb:	00 00 00 
+  800ebe:	48 b8 94 08 80 00 00 	movabs $0x800894,%rax
+  800ec5:	00 00 00 
+  800ec8:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800eca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800ece:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800ed1:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800ed4:	c9                   	leave
+  800ed5:	c3                   	ret
+		return -E_INVAL;
+  800ed6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800edb:	eb f7                	jmp    800ed4 <vsnprintf+0x4c>
+
+0000000000800edd <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800edd:	55                   	push   %rbp
+  800ede:	48 89 e5             	mov    %rsp,%rbp
+  800ee1:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800ee8:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800eef:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800ef6:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 20                	je     800f21 <snprintf+0x44>
+  800f01:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f05:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f09:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f0d:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f11:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f15:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f19:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f1d:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800f21:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f28:	00 00 00 
+  800f2b:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f32:	00 00 00 
+  800f35:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f39:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800f40:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f47:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800f4e:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800f55:	48 b8 88 0e 80 00 00 	movabs $0x800e88,%rax
+  800f5c:	00 00 00 
+  800f5f:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800f61:	c9                   	leave
+  800f62:	c3                   	ret
+
+0000000000800f63 <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800f63:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f68:	48 89 d0             	mov    %rdx,%rax
+  800f6b:	48 83 c2 01          	add    $0x1,%rdx
+  800f6f:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800f74:	75 f2                	jne    800f68 <strlen+0x5>
+		n++;
+	return n;
+}
+  800f76:	c3                   	ret
+
+0000000000800f77 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f7c:	eb 03                	jmp    800f81 <strnlen+0xa>
+  800f7e:	48 89 d0             	mov    %rdx,%rax
+  800f81:	48 39 c6             	cmp    %rax,%rsi
+  800f84:	74 0a                	je     800f90 <strnlen+0x19>
+  800f86:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800f8a:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800f8e:	75 ee                	jne    800f7e <strnlen+0x7>
+		n++;
+	return n;
+}
+  800f90:	c3                   	ret
+
+0000000000800f91 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800f91:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800f94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f99:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800f9d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800fa0:	48 83 c2 01          	add    $0x1,%rdx
+  800fa4:	84 c9                	test   %cl,%cl
+  800fa6:	75 f1                	jne    800f99 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800fa8:	c3                   	ret
+
+0000000000800fa9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800fa9:	55                   	push   %rbp
+  800faa:	48 89 e5             	mov    %rsp,%rbp
+  800fad:	41 54                	push   %r12
+  800faf:	53                   	push   %rbx
+  800fb0:	48 89 fb             	mov    %rdi,%rbx
+  800fb3:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800fb6:	48 b8 63 0f 80 00 00 	movabs $0x800f63,%rax
+  800fbd:	00 00 00 
+  800fc0:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800fc2:	48 63 f8             	movslq %eax,%rdi
+  800fc5:	48 01 df             	add    %rbx,%rdi
+  800fc8:	4c 89 e6             	mov    %r12,%rsi
+  800fcb:	48 b8 91 0f 80 00 00 	movabs $0x800f91,%rax
+  800fd2:	00 00 00 
+  800fd5:	ff d0                	call   *%rax
+	return dst;
+}
+  800fd7:	48 89 d8             	mov    %rbx,%rax
+  800fda:	5b                   	pop    %rbx
+  800fdb:	41 5c                	pop    %r12
+  800fdd:	5d                   	pop    %rbp
+  800fde:	c3                   	ret
+
+0000000000800fdf <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800fdf:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800fe2:	48 01 fa             	add    %rdi,%rdx
+  800fe5:	48 89 f9             	mov    %rdi,%rcx
+  800fe8:	eb 14                	jmp    800ffe <strncpy+0x1f>
+		*dst++ = *src;
+  800fea:	48 83 c1 01          	add    $0x1,%rcx
+  800fee:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ff2:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ff6:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ffa:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800ffe:	48 39 d1             	cmp    %rdx,%rcx
+  801001:	75 e7                	jne    800fea <strncpy+0xb>
+	}
+	return ret;
+}
+  801003:	c3                   	ret
+
+0000000000801004 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801004:	48 89 f8             	mov    %rdi,%rax
+  801007:	48 85 d2             	test   %rdx,%rdx
+  80100a:	74 27                	je     801033 <strlcpy+0x2f>
+  80100c:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  801011:	48 89 fa             	mov    %rdi,%rdx
+  801014:	eb 0b                	jmp    801021 <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801016:	48 83 c6 01          	add    $0x1,%rsi
+  80101a:	48 83 c2 01          	add    $0x1,%rdx
+  80101e:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  801021:	48 39 c2             	cmp    %rax,%rdx
+  801024:	74 0a                	je     801030 <strlcpy+0x2c>
+  801026:	0f b6 0e             	movzbl (%rsi),%ecx
+  801029:	84 c9                	test   %cl,%cl
+  80102b:	75 e9                	jne    801016 <strlcpy+0x12>
+  80102d:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  801030:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801033:	48 29 f8             	sub    %rdi,%rax
+}
+  801036:	c3                   	ret
+
+0000000000801037 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  801037:	eb 08                	jmp    801041 <strcmp+0xa>
+		p++, q++;
+  801039:	48 83 c7 01          	add    $0x1,%rdi
+  80103d:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  801041:	0f b6 07             	movzbl (%rdi),%eax
+  801044:	84 c0                	test   %al,%al
+  801046:	74 04                	je     80104c <strcmp+0x15>
+  801048:	3a 06                	cmp    (%rsi),%al
+  80104a:	74 ed                	je     801039 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80104c:	0f b6 c0             	movzbl %al,%eax
+  80104f:	0f b6 16             	movzbl (%rsi),%edx
+  801052:	29 d0                	sub    %edx,%eax
+}
+  801054:	c3                   	ret
+
+0000000000801055 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  801055:	eb 0c                	jmp    801063 <strncmp+0xe>
+		n--, p++, q++;
+  801057:	48 83 ea 01          	sub    $0x1,%rdx
+  80105b:	48 83 c7 01          	add    $0x1,%rdi
+  80105f:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  801063:	48 85 d2             	test   %rdx,%rdx
+  801066:	74 14                	je     80107c <strncmp+0x27>
+  801068:	0f b6 07             	movzbl (%rdi),%eax
+  80106b:	84 c0                	test   %al,%al
+  80106d:	74 04                	je     801073 <strncmp+0x1e>
+  80106f:	3a 06                	cmp    (%rsi),%al
+  801071:	74 e4                	je     801057 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801073:	0f b6 07             	movzbl (%rdi),%eax
+  801076:	0f b6 16             	movzbl (%rsi),%edx
+  801079:	29 d0                	sub    %edx,%eax
+}
+  80107b:	c3                   	ret
+		return 0;
+  80107c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801081:	c3                   	ret
+
+0000000000801082 <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  801082:	eb 04                	jmp    801088 <strchr+0x6>
+  801084:	48 83 c7 01          	add    $0x1,%rdi
+  801088:	0f b6 07             	movzbl (%rdi),%eax
+  80108b:	84 c0                	test   %al,%al
+  80108d:	74 09                	je     801098 <strchr+0x16>
+		if (*s == c)
+  80108f:	40 38 f0             	cmp    %sil,%al
+  801092:	75 f0                	jne    801084 <strchr+0x2>
+  801094:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  801097:	c3                   	ret
+	return 0;
+  801098:	b8 00 00 00 00       	mov    $0x0,%eax
+  80109d:	c3                   	ret
+
+000000000080109e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80109e:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  8010a1:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  8010a4:	40 38 f2             	cmp    %sil,%dl
+  8010a7:	74 0a                	je     8010b3 <strfind+0x15>
+  8010a9:	84 d2                	test   %dl,%dl
+  8010ab:	74 06                	je     8010b3 <strfind+0x15>
+	for (; *s; s++)
+  8010ad:	48 83 c0 01          	add    $0x1,%rax
+  8010b1:	eb ee                	jmp    8010a1 <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  8010b3:	c3                   	ret
+
+00000000008010b4 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  8010b4:	48 85 d2             	test   %rdx,%rdx
+  8010b7:	74 28                	je     8010e1 <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  8010b9:	48 89 f8             	mov    %rdi,%rax
+  8010bc:	48 09 d0             	or     %rdx,%rax
+  8010bf:	a8 03                	test   $0x3,%al
+  8010c1:	75 16                	jne    8010d9 <memset+0x25>
+		c &= 0xFF;
+  8010c3:	40 0f b6 f6          	movzbl %sil,%esi
+  8010c7:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8010cd:	48 89 d1             	mov    %rdx,%rcx
+  8010d0:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  8010d4:	fc                   	cld
+  8010d5:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8010d7:	eb 08                	jmp    8010e1 <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8010d9:	89 f0                	mov    %esi,%eax
+  8010db:	48 89 d1             	mov    %rdx,%rcx
+  8010de:	fc                   	cld
+  8010df:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8010e1:	48 89 f8             	mov    %rdi,%rax
+  8010e4:	c3                   	ret
+
+00000000008010e5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8010e5:	48 89 f8             	mov    %rdi,%rax
+  8010e8:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8010eb:	48 39 fe             	cmp    %rdi,%rsi
+  8010ee:	73 3a                	jae    80112a <memmove+0x45>
+  8010f0:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010f4:	48 39 d7             	cmp    %rdx,%rdi
+  8010f7:	73 31                	jae    80112a <memmove+0x45>
+		s += n;
+		d += n;
+  8010f9:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  8010fd:	48 89 d6             	mov    %rdx,%rsi
+  801100:	48 09 fe             	or     %rdi,%rsi
+  801103:	48 09 ce             	or     %rcx,%rsi
+  801106:	40 f6 c6 03          	test   $0x3,%sil
+  80110a:	75 11                	jne    80111d <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80110c:	48 83 ef 04          	sub    $0x4,%rdi
+  801110:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  801114:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801118:	fd                   	std
+  801119:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80111b:	eb 0b                	jmp    801128 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80111d:	48 83 ef 01          	sub    $0x1,%rdi
+  801121:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  801125:	fd                   	std
+  801126:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801128:	fc                   	cld
+  801129:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  80112a:	48 89 f2             	mov    %rsi,%rdx
+  80112d:	48 09 c2             	or     %rax,%rdx
+  801130:	48 09 ca             	or     %rcx,%rdx
+  801133:	f6 c2 03             	test   $0x3,%dl
+  801136:	75 0b                	jne    801143 <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801138:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  80113c:	48 89 c7             	mov    %rax,%rdi
+  80113f:	fc                   	cld
+  801140:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801142:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  801143:	48 89 c7             	mov    %rax,%rdi
+  801146:	fc                   	cld
+  801147:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801149:	c3                   	ret
+
+000000000080114a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80114a:	55                   	push   %rbp
+  80114b:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  80114e:	48 b8 e5 10 80 00 00 	movabs $0x8010e5,%rax
+  801155:	00 00 00 
+  801158:	ff d0                	call   *%rax
+}
+  80115a:	5d                   	pop    %rbp
+  80115b:	c3                   	ret
+
+000000000080115c <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80115c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801161:	48 39 c2             	cmp    %rax,%rdx
+  801164:	74 1e                	je     801184 <memcmp+0x28>
+		if (*s1 != *s2)
+  801166:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80116a:	48 83 c0 01          	add    $0x1,%rax
+  80116e:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  801174:	44 38 c1             	cmp    %r8b,%cl
+  801177:	74 e8                	je     801161 <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  801179:	0f b6 c1             	movzbl %cl,%eax
+  80117c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801180:	44 29 c0             	sub    %r8d,%eax
+  801183:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  801184:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801189:	c3                   	ret
+
+000000000080118a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80118a:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  80118d:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  801190:	eb 04                	jmp    801196 <memfind+0xc>
+  801192:	48 83 c0 01          	add    $0x1,%rax
+  801196:	48 39 d0             	cmp    %rdx,%rax
+  801199:	73 05                	jae    8011a0 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80119b:	40 38 30             	cmp    %sil,(%rax)
+  80119e:	75 f2                	jne    801192 <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  8011a0:	c3                   	ret
+
+00000000008011a1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8011a1:	48 89 f9             	mov    %rdi,%rcx
+  8011a4:	49 89 f0             	mov    %rsi,%r8
+  8011a7:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8011a9:	eb 04                	jmp    8011af <strtol+0xe>
+		s++;
+  8011ab:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  8011af:	0f b6 01             	movzbl (%rcx),%eax
+  8011b2:	3c 20                	cmp    $0x20,%al
+  8011b4:	74 f5                	je     8011ab <strtol+0xa>
+  8011b6:	3c 09                	cmp    $0x9,%al
+  8011b8:	74 f1                	je     8011ab <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  8011ba:	3c 2b                	cmp    $0x2b,%al
+  8011bc:	74 2b                	je     8011e9 <strtol+0x48>
+	int neg = 0;
+  8011be:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  8011c4:	3c 2d                	cmp    $0x2d,%al
+  8011c6:	74 2d                	je     8011f5 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011c8:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  8011ce:	75 0f                	jne    8011df <strtol+0x3e>
+  8011d0:	80 39 30             	cmpb   $0x30,(%rcx)
+  8011d3:	74 2c                	je     801201 <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8011d5:	85 ff                	test   %edi,%edi
+  8011d7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011dc:	0f 44 f8             	cmove  %eax,%edi
+  8011df:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  8011e4:	4c 63 d7             	movslq %edi,%r10
+  8011e7:	eb 4f                	jmp    801238 <strtol+0x97>
+		s++;
+  8011e9:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  8011ed:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8011f3:	eb d3                	jmp    8011c8 <strtol+0x27>
+		s++, neg = 1;
+  8011f5:	48 83 c1 01          	add    $0x1,%rcx
+  8011f9:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  8011ff:	eb c7                	jmp    8011c8 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801201:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  801205:	74 0f                	je     801216 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  801207:	85 ff                	test   %edi,%edi
+  801209:	75 d4                	jne    8011df <strtol+0x3e>
+		s++, base = 8;
+  80120b:	48 83 c1 01          	add    $0x1,%rcx
+  80120f:	bf 08 00 00 00       	mov    $0x8,%edi
+  801214:	eb c9                	jmp    8011df <strtol+0x3e>
+		s += 2, base = 16;
+  801216:	48 83 c1 02          	add    $0x2,%rcx
+  80121a:	bf 10 00 00 00       	mov    $0x10,%edi
+  80121f:	eb be                	jmp    8011df <strtol+0x3e>
+			dig = *s - '0';
+  801221:	0f be c0             	movsbl %al,%eax
+  801224:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  801227:	39 f8                	cmp    %edi,%eax
+  801229:	7d 3b                	jge    801266 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  80122b:	48 83 c1 01          	add    $0x1,%rcx
+  80122f:	49 0f af d2          	imul   %r10,%rdx
+  801233:	48 98                	cltq
+  801235:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  801238:	0f b6 01             	movzbl (%rcx),%eax
+  80123b:	8d 70 d0             	lea    -0x30(%rax),%esi
+  80123e:	40 80 fe 09          	cmp    $0x9,%sil
+  801242:	76 dd                	jbe    801221 <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  801244:	8d 70 9f             	lea    -0x61(%rax),%esi
+  801247:	40 80 fe 19          	cmp    $0x19,%sil
+  80124b:	77 08                	ja     801255 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  80124d:	0f be c0             	movsbl %al,%eax
+  801250:	83 e8 57             	sub    $0x57,%eax
+  801253:	eb d2                	jmp    801227 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  801255:	8d 70 bf             	lea    -0x41(%rax),%esi
+  801258:	40 80 fe 19          	cmp    $0x19,%sil
+  80125c:	77 08                	ja     801266 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  80125e:	0f be c0             	movsbl %al,%eax
+  801261:	83 e8 37             	sub    $0x37,%eax
+  801264:	eb c1                	jmp    801227 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801266:	4d 85 c0             	test   %r8,%r8
+  801269:	74 03                	je     80126e <strtol+0xcd>
+		*endptr = (char *) s;
+  80126b:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  80126e:	48 89 d0             	mov    %rdx,%rax
+  801271:	48 f7 d8             	neg    %rax
+  801274:	45 85 c9             	test   %r9d,%r9d
+  801277:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  80127b:	48 89 d0             	mov    %rdx,%rax
+  80127e:	c3                   	ret
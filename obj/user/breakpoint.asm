@@ -0,0 +1,2242 @@
+
+obj/user/breakpoint:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 04 00 00 00       	call   800035 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	asm volatile("int $3");
+  800033:	cc                   	int3
+}
+  800034:	c3                   	ret
+
+0000000000800035 <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  800035:	55                   	push   %rbp
+  800036:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800039:	85 ff                	test   %edi,%edi
+  80003b:	7e 0d                	jle    80004a <libmain+0x15>
+		binaryname = argv[0];
+  80003d:	48 8b 06             	mov    (%rsi),%rax
+  800040:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  800047:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  80004a:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  800051:	00 00 00 
+  800054:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800056:	48 b8 64 00 80 00 00 	movabs $0x800064,%rax
+  80005d:	00 00 00 
+  800060:	ff d0                	call   *%rax
+}
+  800062:	5d                   	pop    %rbp
+  800063:	c3                   	ret
+
+0000000000800064 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800064:	55                   	push   %rbp
+  800065:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  800068:	bf 00 00 00 00       	mov    $0x0,%edi
+  80006d:	48 b8 b3 00 80 00 00 	movabs $0x8000b3,%rax
+  800074:	00 00 00 
+  800077:	ff d0                	call   *%rax
+}
+  800079:	5d                   	pop    %rbp
+  80007a:	c3                   	ret
+
+000000000080007b <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  80007b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800081:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800087:	ba 00 00 00 00       	mov    $0x0,%edx
+  80008c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800091:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800093:	c3                   	ret
+
+0000000000800094 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800094:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80009a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8000a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000a5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000aa:	48 89 fe             	mov    %rdi,%rsi
+  8000ad:	48 89 fa             	mov    %rdi,%rdx
+  8000b0:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000b2:	c3                   	ret
+
+00000000008000b3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8000b3:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8000b6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8000c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8000c7:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000cc:	48 89 f2             	mov    %rsi,%rdx
+  8000cf:	0f 05                	syscall
+	if(check && ret > 0)
+  8000d1:	48 85 c0             	test   %rax,%rax
+  8000d4:	7f 01                	jg     8000d7 <sys_env_destroy+0x24>
+}
+  8000d6:	c3                   	ret
+{
+  8000d7:	55                   	push   %rbp
+  8000d8:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8000db:	49 89 c0             	mov    %rax,%r8
+  8000de:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8000e3:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  8000ea:	00 00 00 
+  8000ed:	be 28 00 00 00       	mov    $0x28,%esi
+  8000f2:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  8000f9:	00 00 00 
+  8000fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800101:	49 b9 36 05 80 00 00 	movabs $0x800536,%r9
+  800108:	00 00 00 
+  80010b:	41 ff d1             	call   *%r9
+
+000000000080010e <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  80010e:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800115:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800116:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80011b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80011f:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800123:	48 c1 e2 04          	shl    $0x4,%rdx
+  800127:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  80012e:	00 00 00 
+  800131:	48 01 d0             	add    %rdx,%rax
+  800134:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  80013a:	c3                   	ret
+
+000000000080013b <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  80013b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800141:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800147:	bf 00 00 00 00       	mov    $0x0,%edi
+  80014c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800151:	48 89 fe             	mov    %rdi,%rsi
+  800154:	48 89 fa             	mov    %rdi,%rdx
+  800157:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800159:	c3                   	ret
+
+000000000080015a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  80015a:	48 63 d2             	movslq %edx,%rdx
+  80015d:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800160:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800166:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80016c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800171:	0f 05                	syscall
+	if(check && ret > 0)
+  800173:	48 85 c0             	test   %rax,%rax
+  800176:	7f 01                	jg     800179 <sys_page_alloc+0x1f>
+}
+  800178:	c3                   	ret
+{
+  800179:	55                   	push   %rbp
+  80017a:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80017d:	49 89 c0             	mov    %rax,%r8
+  800180:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800185:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  80018c:	00 00 00 
+  80018f:	be 28 00 00 00       	mov    $0x28,%esi
+  800194:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  80019b:	00 00 00 
+  80019e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a3:	49 b9 36 05 80 00 00 	movabs $0x800536,%r9
+  8001aa:	00 00 00 
+  8001ad:	41 ff d1             	call   *%r9
+
+00000000008001b0 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8001b0:	48 63 d2             	movslq %edx,%rdx
+  8001b3:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8001b6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8001bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8001c2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8001c7:	0f 05                	syscall
+	if(check && ret > 0)
+  8001c9:	48 85 c0             	test   %rax,%rax
+  8001cc:	7f 01                	jg     8001cf <sys_page_alloc_huge+0x1f>
+}
+  8001ce:	c3                   	ret
+{
+  8001cf:	55                   	push   %rbp
+  8001d0:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001d3:	49 89 c0             	mov    %rax,%r8
+  8001d6:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8001db:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  8001e2:	00 00 00 
+  8001e5:	be 28 00 00 00       	mov    $0x28,%esi
+  8001ea:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  8001f1:	00 00 00 
+  8001f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f9:	49 b9 36 05 80 00 00 	movabs $0x800536,%r9
+  800200:	00 00 00 
+  800203:	41 ff d1             	call   *%r9
+
+0000000000800206 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800206:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  800209:	48 63 d2             	movslq %edx,%rdx
+  80020c:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  80020f:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  800212:	b8 05 00 00 00       	mov    $0x5,%eax
+  800217:	0f 05                	syscall
+	if(check && ret > 0)
+  800219:	48 85 c0             	test   %rax,%rax
+  80021c:	7f 01                	jg     80021f <sys_page_map+0x19>
+}
+  80021e:	c3                   	ret
+{
+  80021f:	55                   	push   %rbp
+  800220:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800223:	49 89 c0             	mov    %rax,%r8
+  800226:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80022b:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  800232:	00 00 00 
+  800235:	be 28 00 00 00       	mov    $0x28,%esi
+  80023a:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  800241:	00 00 00 
+  800244:	b8 00 00 00 00       	mov    $0x0,%eax
+  800249:	49 b9 36 05 80 00 00 	movabs $0x800536,%r9
+  800250:	00 00 00 
+  800253:	41 ff d1             	call   *%r9
+
+0000000000800256 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  800256:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800259:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80025f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800265:	ba 00 00 00 00       	mov    $0x0,%edx
+  80026a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80026f:	0f 05                	syscall
+	if(check && ret > 0)
+  800271:	48 85 c0             	test   %rax,%rax
+  800274:	7f 01                	jg     800277 <sys_page_unmap+0x21>
+}
+  800276:	c3                   	ret
+{
+  800277:	55                   	push   %rbp
+  800278:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80027b:	49 89 c0             	mov    %rax,%r8
+  80027e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800283:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  80028a:	00 00 00 
+  80028d:	be 28 00 00 00       	mov    $0x28,%esi
+  800292:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  800299:	00 00 00 
+  80029c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a1:	49 b9 36 05 80 00 00 	movabs $0x800536,%r9
+  8002a8:	00 00 00 
+  8002ab:	41 ff d1             	call   *%r9
+
+00000000008002ae <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  8002ae:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002bf:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8002c4:	48 89 fe             	mov    %rdi,%rsi
+  8002c7:	48 89 fa             	mov    %rdi,%rdx
+  8002ca:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8002cc:	c3                   	ret
+
+00000000008002cd <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  8002cd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002de:	b8 10 00 00 00       	mov    $0x10,%eax
+  8002e3:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  8002e5:	c3                   	ret
+
+00000000008002e6 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  8002e6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002f2:	b8 11 00 00 00       	mov    $0x11,%eax
+  8002f7:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  8002f9:	c3                   	ret
+
+00000000008002fa <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  8002fa:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  8002fd:	48 63 f6             	movslq %esi,%rsi
+  800300:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800303:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800309:	b8 12 00 00 00       	mov    $0x12,%eax
+  80030e:	0f 05                	syscall
+	if(check && ret > 0)
+  800310:	48 85 c0             	test   %rax,%rax
+  800313:	7f 01                	jg     800316 <sys_page_batch+0x1c>
+}
+  800315:	c3                   	ret
+{
+  800316:	55                   	push   %rbp
+  800317:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80031a:	49 89 c0             	mov    %rax,%r8
+  80031d:	b9 12 00 00 00       	mov    $0x12,%ecx
+  800322:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  800329:	00 00 00 
+  80032c:	be 28 00 00 00       	mov    $0x28,%esi
+  800331:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  800338:	00 00 00 
+  80033b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800340:	49 b9 36 05 80 00 00 	movabs $0x800536,%r9
+  800347:	00 00 00 
+  80034a:	41 ff d1             	call   *%r9
+
+000000000080034d <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  80034d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800353:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800359:	be 00 00 00 00       	mov    $0x0,%esi
+  80035e:	b8 13 00 00 00       	mov    $0x13,%eax
+  800363:	48 89 f2             	mov    %rsi,%rdx
+  800366:	0f 05                	syscall
+	if(check && ret > 0)
+  800368:	48 85 c0             	test   %rax,%rax
+  80036b:	7f 01                	jg     80036e <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  80036d:	c3                   	ret
+{
+  80036e:	55                   	push   %rbp
+  80036f:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800372:	49 89 c0             	mov    %rax,%r8
+  800375:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80037a:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  800381:	00 00 00 
+  800384:	be 28 00 00 00       	mov    $0x28,%esi
+  800389:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  800390:	00 00 00 
+  800393:	b8 00 00 00 00       	mov    $0x0,%eax
+  800398:	49 b9 36 05 80 00 00 	movabs $0x800536,%r9
+  80039f:	00 00 00 
+  8003a2:	41 ff d1             	call   *%r9
+
+00000000008003a5 <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  8003a5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8003ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8003b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003b6:	b8 14 00 00 00       	mov    $0x14,%eax
+  8003bb:	48 89 fe             	mov    %rdi,%rsi
+  8003be:	48 89 fa             	mov    %rdi,%rdx
+  8003c1:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8003c3:	c3                   	ret
+
+00000000008003c4 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  8003c4:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8003c7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8003cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8003d3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8003d8:	0f 05                	syscall
+	if(check && ret > 0)
+  8003da:	48 85 c0             	test   %rax,%rax
+  8003dd:	7f 01                	jg     8003e0 <sys_page_unmap_range+0x1c>
+}
+  8003df:	c3                   	ret
+{
+  8003e0:	55                   	push   %rbp
+  8003e1:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003e4:	49 89 c0             	mov    %rax,%r8
+  8003e7:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8003ec:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  8003f3:	00 00 00 
+  8003f6:	be 28 00 00 00       	mov    $0x28,%esi
+  8003fb:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  800402:	00 00 00 
+  800405:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040a:	49 b9 36 05 80 00 00 	movabs $0x800536,%r9
+  800411:	00 00 00 
+  800414:	41 ff d1             	call   *%r9
+
+0000000000800417 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  800417:	48 63 f6             	movslq %esi,%rsi
+  80041a:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80041d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800423:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800429:	ba 00 00 00 00       	mov    $0x0,%edx
+  80042e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800433:	0f 05                	syscall
+	if(check && ret > 0)
+  800435:	48 85 c0             	test   %rax,%rax
+  800438:	7f 01                	jg     80043b <sys_env_set_status+0x24>
+}
+  80043a:	c3                   	ret
+{
+  80043b:	55                   	push   %rbp
+  80043c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80043f:	49 89 c0             	mov    %rax,%r8
+  800442:	b9 08 00 00 00       	mov    $0x8,%ecx
+  800447:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  80044e:	00 00 00 
+  800451:	be 28 00 00 00       	mov    $0x28,%esi
+  800456:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  80045d:	00 00 00 
+  800460:	b8 00 00 00 00       	mov    $0x0,%eax
+  800465:	49 b9 36 05 80 00 00 	movabs $0x800536,%r9
+  80046c:	00 00 00 
+  80046f:	41 ff d1             	call   *%r9
+
+0000000000800472 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  800472:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800475:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80047b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800481:	ba 00 00 00 00       	mov    $0x0,%edx
+  800486:	b8 09 00 00 00       	mov    $0x9,%eax
+  80048b:	0f 05                	syscall
+	if(check && ret > 0)
+  80048d:	48 85 c0             	test   %rax,%rax
+  800490:	7f 01                	jg     800493 <sys_env_set_pgfault_upcall+0x21>
+}
+  800492:	c3                   	ret
+{
+  800493:	55                   	push   %rbp
+  800494:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800497:	49 89 c0             	mov    %rax,%r8
+  80049a:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80049f:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  8004a6:	00 00 00 
+  8004a9:	be 28 00 00 00       	mov    $0x28,%esi
+  8004ae:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  8004b5:	00 00 00 
+  8004b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004bd:	49 b9 36 05 80 00 00 	movabs $0x800536,%r9
+  8004c4:	00 00 00 
+  8004c7:	41 ff d1             	call   *%r9
+
+00000000008004ca <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8004ca:	48 63 ff             	movslq %edi,%rdi
+  8004cd:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  8004d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8004d6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8004db:	0f 05                	syscall
+}
+  8004dd:	c3                   	ret
+
+00000000008004de <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  8004de:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8004e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8004ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8004ef:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8004f4:	48 89 f2             	mov    %rsi,%rdx
+  8004f7:	0f 05                	syscall
+	if(check && ret > 0)
+  8004f9:	48 85 c0             	test   %rax,%rax
+  8004fc:	7f 01                	jg     8004ff <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  8004fe:	c3                   	ret
+{
+  8004ff:	55                   	push   %rbp
+  800500:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800503:	49 89 c0             	mov    %rax,%r8
+  800506:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80050b:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  800512:	00 00 00 
+  800515:	be 28 00 00 00       	mov    $0x28,%esi
+  80051a:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  800521:	00 00 00 
+  800524:	b8 00 00 00 00       	mov    $0x0,%eax
+  800529:	49 b9 36 05 80 00 00 	movabs $0x800536,%r9
+  800530:	00 00 00 
+  800533:	41 ff d1             	call   *%r9
+
+0000000000800536 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800536:	55                   	push   %rbp
+  800537:	48 89 e5             	mov    %rsp,%rbp
+  80053a:	41 56                	push   %r14
+  80053c:	41 55                	push   %r13
+  80053e:	41 54                	push   %r12
+  800540:	53                   	push   %rbx
+  800541:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800548:	49 89 fc             	mov    %rdi,%r12
+  80054b:	41 89 f5             	mov    %esi,%r13d
+  80054e:	48 89 d3             	mov    %rdx,%rbx
+  800551:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800558:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80055f:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800566:	84 c0                	test   %al,%al
+  800568:	74 26                	je     800590 <_panic+0x5a>
+  80056a:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800571:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800578:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  80057c:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800580:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800584:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800588:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  80058c:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800590:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800597:	00 00 00 
+  80059a:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8005a1:	00 00 00 
+  8005a4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005a8:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8005af:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8005b6:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005bd:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  8005c4:	00 00 00 
+  8005c7:	4c 8b 30             	mov    (%rax),%r14
+  8005ca:	48 b8 0e 01 80 00 00 	movabs $0x80010e,%rax
+  8005d1:	00 00 00 
+  8005d4:	ff d0                	call   *%rax
+  8005d6:	89 c6                	mov    %eax,%esi
+  8005d8:	45 89 e8             	mov    %r13d,%r8d
+  8005db:	4c 89 e1             	mov    %r12,%rcx
+  8005de:	4c 89 f2             	mov    %r14,%rdx
+  8005e1:	48 bf b8 12 80 00 00 	movabs $0x8012b8,%rdi
+  8005e8:	00 00 00 
+  8005eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f0:	49 bc d5 06 80 00 00 	movabs $0x8006d5,%r12
+  8005f7:	00 00 00 
+  8005fa:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8005fd:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  800604:	48 89 df             	mov    %rbx,%rdi
+  800607:	48 b8 71 06 80 00 00 	movabs $0x800671,%rax
+  80060e:	00 00 00 
+  800611:	ff d0                	call   *%rax
+	cprintf("\n");
+  800613:	48 bf db 12 80 00 00 	movabs $0x8012db,%rdi
+  80061a:	00 00 00 
+  80061d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800622:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800625:	cc                   	int3
+	while (1)
+  800626:	eb fd                	jmp    800625 <_panic+0xef>
+
+0000000000800628 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800628:	55                   	push   %rbp
+  800629:	48 89 e5             	mov    %rsp,%rbp
+  80062c:	53                   	push   %rbx
+  80062d:	48 83 ec 08          	sub    $0x8,%rsp
+  800631:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  800634:	8b 06                	mov    (%rsi),%eax
+  800636:	8d 50 01             	lea    0x1(%rax),%edx
+  800639:	89 16                	mov    %edx,(%rsi)
+  80063b:	48 98                	cltq
+  80063d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  800642:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800648:	74 0a                	je     800654 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80064a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80064e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800652:	c9                   	leave
+  800653:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800654:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800658:	be ff 00 00 00       	mov    $0xff,%esi
+  80065d:	48 b8 7b 00 80 00 00 	movabs $0x80007b,%rax
+  800664:	00 00 00 
+  800667:	ff d0                	call   *%rax
+		b->idx = 0;
+  800669:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80066f:	eb d9                	jmp    80064a <putch+0x22>
+
+0000000000800671 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800671:	55                   	push   %rbp
+  800672:	48 89 e5             	mov    %rsp,%rbp
+  800675:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80067c:	48 89 fa             	mov    %rdi,%rdx
+  80067f:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  800682:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800689:	00 00 00 
+	b.cnt = 0;
+  80068c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800693:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800696:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  80069d:	48 bf 28 06 80 00 00 	movabs $0x800628,%rdi
+  8006a4:	00 00 00 
+  8006a7:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8006ae:	00 00 00 
+  8006b1:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8006b3:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  8006ba:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8006c1:	48 b8 7b 00 80 00 00 	movabs $0x80007b,%rax
+  8006c8:	00 00 00 
+  8006cb:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  8006cd:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  8006d3:	c9                   	leave
+  8006d4:	c3                   	ret
+
+00000000008006d5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8006d5:	55                   	push   %rbp
+  8006d6:	48 89 e5             	mov    %rsp,%rbp
+  8006d9:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8006e0:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8006e7:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8006ee:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8006f5:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8006fc:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800703:	84 c0                	test   %al,%al
+  800705:	74 20                	je     800727 <cprintf+0x52>
+  800707:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80070b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80070f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800713:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800717:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80071b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80071f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800723:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800727:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  80072e:	00 00 00 
+  800731:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800738:	00 00 00 
+  80073b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80073f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800746:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80074d:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  800754:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  80075b:	48 b8 71 06 80 00 00 	movabs $0x800671,%rax
+  800762:	00 00 00 
+  800765:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  800767:	c9                   	leave
+  800768:	c3                   	ret
+
+0000000000800769 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800769:	55                   	push   %rbp
+  80076a:	48 89 e5             	mov    %rsp,%rbp
+  80076d:	41 57                	push   %r15
+  80076f:	41 56                	push   %r14
+  800771:	41 55                	push   %r13
+  800773:	41 54                	push   %r12
+  800775:	53                   	push   %rbx
+  800776:	48 83 ec 18          	sub    $0x18,%rsp
+  80077a:	49 89 fc             	mov    %rdi,%r12
+  80077d:	49 89 f5             	mov    %rsi,%r13
+  800780:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800784:	44 89 c3             	mov    %r8d,%ebx
+  800787:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80078a:	41 89 cf             	mov    %ecx,%r15d
+  80078d:	4c 39 fa             	cmp    %r15,%rdx
+  800790:	72 29                	jb     8007bb <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800792:	48 89 d0             	mov    %rdx,%rax
+  800795:	ba 00 00 00 00       	mov    $0x0,%edx
+  80079a:	49 f7 f7             	div    %r15
+  80079d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8007a1:	48 89 c2             	mov    %rax,%rdx
+  8007a4:	48 b8 69 07 80 00 00 	movabs $0x800769,%rax
+  8007ab:	00 00 00 
+  8007ae:	ff d0                	call   *%rax
+  8007b0:	eb 10                	jmp    8007c2 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8007b2:	4c 89 ee             	mov    %r13,%rsi
+  8007b5:	44 89 f7             	mov    %r14d,%edi
+  8007b8:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  8007bb:	83 eb 01             	sub    $0x1,%ebx
+  8007be:	85 db                	test   %ebx,%ebx
+  8007c0:	7f f0                	jg     8007b2 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007cb:	49 f7 f7             	div    %r15
+  8007ce:	48 b8 dd 12 80 00 00 	movabs $0x8012dd,%rax
+  8007d5:	00 00 00 
+  8007d8:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  8007dc:	4c 89 ee             	mov    %r13,%rsi
+  8007df:	41 ff d4             	call   *%r12
+}
+  8007e2:	48 83 c4 18          	add    $0x18,%rsp
+  8007e6:	5b                   	pop    %rbx
+  8007e7:	41 5c                	pop    %r12
+  8007e9:	41 5d                	pop    %r13
+  8007eb:	41 5e                	pop    %r14
+  8007ed:	41 5f                	pop    %r15
+  8007ef:	5d                   	pop    %rbp
+  8007f0:	c3                   	ret
+
+00000000008007f1 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  8007f1:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  8007f5:	48 8b 06             	mov    (%rsi),%rax
+  8007f8:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8007fc:	73 0a                	jae    800808 <sprintputch+0x17>
+		*b->buf++ = ch;
+  8007fe:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800802:	48 89 16             	mov    %rdx,(%rsi)
+  800805:	40 88 38             	mov    %dil,(%rax)
+}
+  800808:	c3                   	ret
+
+0000000000800809 <printfmt>:
+{
+  800809:	55                   	push   %rbp
+  80080a:	48 89 e5             	mov    %rsp,%rbp
+  80080d:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800814:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80081b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800822:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800829:	84 c0                	test   %al,%al
+  80082b:	74 20                	je     80084d <printfmt+0x44>
+  80082d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800831:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800835:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800839:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80083d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800841:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800845:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800849:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  80084d:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800854:	00 00 00 
+  800857:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80085e:	00 00 00 
+  800861:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800865:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80086c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800873:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80087a:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800881:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  800888:	00 00 00 
+  80088b:	ff d0                	call   *%rax
+}
+  80088d:	c9                   	leave
+  80088e:	c3                   	ret
+
+000000000080088f <vprintfmt>:
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 83 ec 48          	sub    $0x48,%rsp
+  8008a0:	49 89 fe             	mov    %rdi,%r14
+  8008a3:	49 89 f5             	mov    %rsi,%r13
+  8008a6:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  8008a9:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  8008ad:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  8008b1:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8008b5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8008b9:	eb 09                	jmp    8008c4 <vprintfmt+0x35>
+			putch(ch, putdat);
+  8008bb:	4c 89 ee             	mov    %r13,%rsi
+  8008be:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008c1:	4c 89 e3             	mov    %r12,%rbx
+  8008c4:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8008c8:	0f b6 3b             	movzbl (%rbx),%edi
+  8008cb:	83 ff 25             	cmp    $0x25,%edi
+  8008ce:	74 13                	je     8008e3 <vprintfmt+0x54>
+			if (ch == '\0')
+  8008d0:	85 ff                	test   %edi,%edi
+  8008d2:	75 e7                	jne    8008bb <vprintfmt+0x2c>
+}
+  8008d4:	48 83 c4 48          	add    $0x48,%rsp
+  8008d8:	5b                   	pop    %rbx
+  8008d9:	41 5c                	pop    %r12
+  8008db:	41 5d                	pop    %r13
+  8008dd:	41 5e                	pop    %r14
+  8008df:	41 5f                	pop    %r15
+  8008e1:	5d                   	pop    %rbp
+  8008e2:	c3                   	ret
+		padc = ' ';
+  8008e3:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  8008e7:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  8008ee:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  8008f4:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  8008fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800900:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800905:	41 0f b6 14 24       	movzbl (%r12),%edx
+  80090a:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  80090d:	3c 55                	cmp    $0x55,%al
+  80090f:	0f 87 4f 05 00 00    	ja     800e64 <vprintfmt+0x5d5>
+  800915:	0f b6 c0             	movzbl %al,%eax
+  800918:	48 be a0 13 80 00 00 	movabs $0x8013a0,%rsi
+  80091f:	00 00 00 
+  800922:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  800925:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  800928:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  80092c:	eb d2                	jmp    800900 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  80092e:	49 89 dc             	mov    %rbx,%r12
+  800931:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  800935:	eb c9                	jmp    800900 <vprintfmt+0x71>
+  800937:	0f b6 d2             	movzbl %dl,%edx
+  80093a:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  80093d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  800943:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800947:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  80094c:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  800951:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  800954:	83 f8 09             	cmp    $0x9,%eax
+  800957:	77 20                	ja     800979 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  800959:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  80095d:	eb e4                	jmp    800943 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  80095f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800962:	83 f8 2f             	cmp    $0x2f,%eax
+  800965:	77 27                	ja     80098e <vprintfmt+0xff>
+  800967:	89 c2                	mov    %eax,%edx
+  800969:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096d:	83 c0 08             	add    $0x8,%eax
+  800970:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800973:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  800976:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  800979:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80097d:	79 81                	jns    800900 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  80097f:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  800983:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800989:	e9 72 ff ff ff       	jmp    800900 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  80098e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800992:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800996:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099a:	eb d7                	jmp    800973 <vprintfmt+0xe4>
+			if (width < 0)
+  80099c:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  80099f:	85 f6                	test   %esi,%esi
+  8009a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a6:	0f 49 c6             	cmovns %esi,%eax
+  8009a9:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8009ac:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8009af:	e9 4c ff ff ff       	jmp    800900 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8009b4:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  8009b7:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  8009be:	e9 3d ff ff ff       	jmp    800900 <vprintfmt+0x71>
+			lflag++;
+  8009c3:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8009c6:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8009c9:	e9 32 ff ff ff       	jmp    800900 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  8009ce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d4:	77 19                	ja     8009ef <vprintfmt+0x160>
+  8009d6:	89 c2                	mov    %eax,%edx
+  8009d8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009dc:	83 c0 08             	add    $0x8,%eax
+  8009df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e2:	8b 3a                	mov    (%rdx),%edi
+  8009e4:	4c 89 ee             	mov    %r13,%rsi
+  8009e7:	41 ff d6             	call   *%r14
+			break;
+  8009ea:	e9 d5 fe ff ff       	jmp    8008c4 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  8009ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fb:	eb e5                	jmp    8009e2 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  8009fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a00:	83 f8 2f             	cmp    $0x2f,%eax
+  800a03:	77 5a                	ja     800a5f <vprintfmt+0x1d0>
+  800a05:	89 c2                	mov    %eax,%edx
+  800a07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0b:	83 c0 08             	add    $0x8,%eax
+  800a0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800a11:	8b 02                	mov    (%rdx),%eax
+  800a13:	89 c1                	mov    %eax,%ecx
+  800a15:	f7 d9                	neg    %ecx
+  800a17:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a1a:	83 f9 08             	cmp    $0x8,%ecx
+  800a1d:	7f 4e                	jg     800a6d <vprintfmt+0x1de>
+  800a1f:	48 63 c1             	movslq %ecx,%rax
+  800a22:	48 ba 60 16 80 00 00 	movabs $0x801660,%rdx
+  800a29:	00 00 00 
+  800a2c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800a30:	48 85 c0             	test   %rax,%rax
+  800a33:	74 38                	je     800a6d <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800a35:	48 89 c1             	mov    %rax,%rcx
+  800a38:	48 ba fe 12 80 00 00 	movabs $0x8012fe,%rdx
+  800a3f:	00 00 00 
+  800a42:	4c 89 ee             	mov    %r13,%rsi
+  800a45:	4c 89 f7             	mov    %r14,%rdi
+  800a48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a4d:	49 b8 09 08 80 00 00 	movabs $0x800809,%r8
+  800a54:	00 00 00 
+  800a57:	41 ff d0             	call   *%r8
+  800a5a:	e9 65 fe ff ff       	jmp    8008c4 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  800a5f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a63:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6b:	eb a4                	jmp    800a11 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  800a6d:	48 ba f5 12 80 00 00 	movabs $0x8012f5,%rdx
+  800a74:	00 00 00 
+  800a77:	4c 89 ee             	mov    %r13,%rsi
+  800a7a:	4c 89 f7             	mov    %r14,%rdi
+  800a7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a82:	49 b8 09 08 80 00 00 	movabs $0x800809,%r8
+  800a89:	00 00 00 
+  800a8c:	41 ff d0             	call   *%r8
+  800a8f:	e9 30 fe ff ff       	jmp    8008c4 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800a94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a97:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9a:	77 36                	ja     800ad2 <vprintfmt+0x243>
+  800a9c:	89 c2                	mov    %eax,%edx
+  800a9e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa2:	83 c0 08             	add    $0x8,%eax
+  800aa5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa8:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800aab:	48 85 c9             	test   %rcx,%rcx
+  800aae:	48 b8 ee 12 80 00 00 	movabs $0x8012ee,%rax
+  800ab5:	00 00 00 
+  800ab8:	48 0f 45 c1          	cmovne %rcx,%rax
+  800abc:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800ac0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800ac4:	7e 06                	jle    800acc <vprintfmt+0x23d>
+  800ac6:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800aca:	75 14                	jne    800ae0 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800acc:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ad0:	eb 64                	jmp    800b36 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800ad2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ada:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ade:	eb c8                	jmp    800aa8 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ae0:	49 63 f7             	movslq %r15d,%rsi
+  800ae3:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800ae7:	48 b8 72 0f 80 00 00 	movabs $0x800f72,%rax
+  800aee:	00 00 00 
+  800af1:	ff d0                	call   *%rax
+  800af3:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800af6:	29 c1                	sub    %eax,%ecx
+  800af8:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800afb:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  800afe:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800b02:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b05:	eb 0d                	jmp    800b14 <vprintfmt+0x285>
+					putch(padc, putdat);
+  800b07:	4c 89 ee             	mov    %r13,%rsi
+  800b0a:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  800b0d:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b10:	41 83 ec 01          	sub    $0x1,%r12d
+  800b14:	45 85 e4             	test   %r12d,%r12d
+  800b17:	7f ee                	jg     800b07 <vprintfmt+0x278>
+  800b19:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  800b1c:	85 c9                	test   %ecx,%ecx
+  800b1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b23:	0f 49 c1             	cmovns %ecx,%eax
+  800b26:	29 c1                	sub    %eax,%ecx
+  800b28:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  800b2b:	eb 9f                	jmp    800acc <vprintfmt+0x23d>
+					putch(ch, putdat);
+  800b2d:	4c 89 ee             	mov    %r13,%rsi
+  800b30:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b33:	4c 89 e2             	mov    %r12,%rdx
+  800b36:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800b3a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800b40:	0f be f8             	movsbl %al,%edi
+  800b43:	85 ff                	test   %edi,%edi
+  800b45:	74 29                	je     800b70 <vprintfmt+0x2e1>
+  800b47:	45 85 ff             	test   %r15d,%r15d
+  800b4a:	78 06                	js     800b52 <vprintfmt+0x2c3>
+  800b4c:	41 83 ef 01          	sub    $0x1,%r15d
+  800b50:	78 1e                	js     800b70 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b52:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800b56:	74 d5                	je     800b2d <vprintfmt+0x29e>
+  800b58:	0f be c0             	movsbl %al,%eax
+  800b5b:	83 e8 20             	sub    $0x20,%eax
+  800b5e:	83 f8 5e             	cmp    $0x5e,%eax
+  800b61:	76 ca                	jbe    800b2d <vprintfmt+0x29e>
+					putch('?', putdat);
+  800b63:	4c 89 ee             	mov    %r13,%rsi
+  800b66:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b6b:	41 ff d6             	call   *%r14
+  800b6e:	eb c3                	jmp    800b33 <vprintfmt+0x2a4>
+  800b70:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800b74:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800b77:	41 01 c4             	add    %eax,%r12d
+  800b7a:	41 29 d4             	sub    %edx,%r12d
+  800b7d:	eb 0f                	jmp    800b8e <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  800b7f:	4c 89 ee             	mov    %r13,%rsi
+  800b82:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b87:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800b8a:	41 83 ec 01          	sub    $0x1,%r12d
+  800b8e:	45 85 e4             	test   %r12d,%r12d
+  800b91:	7f ec                	jg     800b7f <vprintfmt+0x2f0>
+  800b93:	e9 2c fd ff ff       	jmp    8008c4 <vprintfmt+0x35>
+	if (lflag >= 2)
+  800b98:	83 f9 01             	cmp    $0x1,%ecx
+  800b9b:	7f 1d                	jg     800bba <vprintfmt+0x32b>
+	else if (lflag)
+  800b9d:	85 c9                	test   %ecx,%ecx
+  800b9f:	74 5e                	je     800bff <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800ba1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba7:	77 48                	ja     800bf1 <vprintfmt+0x362>
+  800ba9:	89 c2                	mov    %eax,%edx
+  800bab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800baf:	83 c0 08             	add    $0x8,%eax
+  800bb2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb5:	4c 8b 22             	mov    (%rdx),%r12
+  800bb8:	eb 17                	jmp    800bd1 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800bba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbd:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc0:	77 21                	ja     800be3 <vprintfmt+0x354>
+  800bc2:	89 c2                	mov    %eax,%edx
+  800bc4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc8:	83 c0 08             	add    $0x8,%eax
+  800bcb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bce:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800bd1:	4d 85 e4             	test   %r12,%r12
+  800bd4:	78 50                	js     800c26 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  800bd6:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800bd9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800bde:	e9 b4 01 00 00       	jmp    800d97 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800be3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800beb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bef:	eb dd                	jmp    800bce <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800bf1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bfd:	eb b6                	jmp    800bb5 <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800bff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c02:	83 f8 2f             	cmp    $0x2f,%eax
+  800c05:	77 11                	ja     800c18 <vprintfmt+0x389>
+  800c07:	89 c2                	mov    %eax,%edx
+  800c09:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0d:	83 c0 08             	add    $0x8,%eax
+  800c10:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c13:	4c 63 22             	movslq (%rdx),%r12
+  800c16:	eb b9                	jmp    800bd1 <vprintfmt+0x342>
+  800c18:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c1c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c24:	eb ed                	jmp    800c13 <vprintfmt+0x384>
+				putch('-', putdat);
+  800c26:	4c 89 ee             	mov    %r13,%rsi
+  800c29:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c2e:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800c31:	4c 89 e2             	mov    %r12,%rdx
+  800c34:	48 f7 da             	neg    %rdx
+			base = 10;
+  800c37:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800c3c:	e9 56 01 00 00       	jmp    800d97 <vprintfmt+0x508>
+	if (lflag >= 2)
+  800c41:	83 f9 01             	cmp    $0x1,%ecx
+  800c44:	7f 25                	jg     800c6b <vprintfmt+0x3dc>
+	else if (lflag)
+  800c46:	85 c9                	test   %ecx,%ecx
+  800c48:	74 5e                	je     800ca8 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800c4a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c4d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c50:	77 48                	ja     800c9a <vprintfmt+0x40b>
+  800c52:	89 c2                	mov    %eax,%edx
+  800c54:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c58:	83 c0 08             	add    $0x8,%eax
+  800c5b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c5e:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800c61:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800c66:	e9 2c 01 00 00       	jmp    800d97 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800c6b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c6e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c71:	77 19                	ja     800c8c <vprintfmt+0x3fd>
+  800c73:	89 c2                	mov    %eax,%edx
+  800c75:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c79:	83 c0 08             	add    $0x8,%eax
+  800c7c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c7f:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800c82:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800c87:	e9 0b 01 00 00       	jmp    800d97 <vprintfmt+0x508>
+  800c8c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c90:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c98:	eb e5                	jmp    800c7f <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800c9a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c9e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca6:	eb b6                	jmp    800c5e <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800ca8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cab:	83 f8 2f             	cmp    $0x2f,%eax
+  800cae:	77 18                	ja     800cc8 <vprintfmt+0x439>
+  800cb0:	89 c2                	mov    %eax,%edx
+  800cb2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb6:	83 c0 08             	add    $0x8,%eax
+  800cb9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cbc:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800cbe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800cc3:	e9 cf 00 00 00       	jmp    800d97 <vprintfmt+0x508>
+  800cc8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ccc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cd0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd4:	eb e6                	jmp    800cbc <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800cd6:	83 f9 01             	cmp    $0x1,%ecx
+  800cd9:	7f 25                	jg     800d00 <vprintfmt+0x471>
+	else if (lflag)
+  800cdb:	85 c9                	test   %ecx,%ecx
+  800cdd:	74 5b                	je     800d3a <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800cdf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce5:	77 45                	ja     800d2c <vprintfmt+0x49d>
+  800ce7:	89 c2                	mov    %eax,%edx
+  800ce9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ced:	83 c0 08             	add    $0x8,%eax
+  800cf0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf3:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800cf6:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800cfb:	e9 97 00 00 00       	jmp    800d97 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800d00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d03:	83 f8 2f             	cmp    $0x2f,%eax
+  800d06:	77 16                	ja     800d1e <vprintfmt+0x48f>
+  800d08:	89 c2                	mov    %eax,%edx
+  800d0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d0e:	83 c0 08             	add    $0x8,%eax
+  800d11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d14:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800d17:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800d1c:	eb 79                	jmp    800d97 <vprintfmt+0x508>
+  800d1e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d22:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d26:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d2a:	eb e8                	jmp    800d14 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800d2c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d30:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d34:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d38:	eb b9                	jmp    800cf3 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800d3a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d3d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d40:	77 15                	ja     800d57 <vprintfmt+0x4c8>
+  800d42:	89 c2                	mov    %eax,%edx
+  800d44:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d48:	83 c0 08             	add    $0x8,%eax
+  800d4b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d4e:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800d50:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800d55:	eb 40                	jmp    800d97 <vprintfmt+0x508>
+  800d57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d63:	eb e9                	jmp    800d4e <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800d65:	4c 89 ee             	mov    %r13,%rsi
+  800d68:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d6d:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800d70:	4c 89 ee             	mov    %r13,%rsi
+  800d73:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d78:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800d7b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d7e:	83 f8 2f             	cmp    $0x2f,%eax
+  800d81:	77 34                	ja     800db7 <vprintfmt+0x528>
+  800d83:	89 c2                	mov    %eax,%edx
+  800d85:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d89:	83 c0 08             	add    $0x8,%eax
+  800d8c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800d8f:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800d92:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800d97:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800d9c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800da0:	4c 89 ee             	mov    %r13,%rsi
+  800da3:	4c 89 f7             	mov    %r14,%rdi
+  800da6:	48 b8 69 07 80 00 00 	movabs $0x800769,%rax
+  800dad:	00 00 00 
+  800db0:	ff d0                	call   *%rax
+			break;
+  800db2:	e9 0d fb ff ff       	jmp    8008c4 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800db7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dbb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dbf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc3:	eb ca                	jmp    800d8f <vprintfmt+0x500>
+	if (lflag >= 2)
+  800dc5:	83 f9 01             	cmp    $0x1,%ecx
+  800dc8:	7f 22                	jg     800dec <vprintfmt+0x55d>
+	else if (lflag)
+  800dca:	85 c9                	test   %ecx,%ecx
+  800dcc:	74 58                	je     800e26 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800dce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dd1:	83 f8 2f             	cmp    $0x2f,%eax
+  800dd4:	77 42                	ja     800e18 <vprintfmt+0x589>
+  800dd6:	89 c2                	mov    %eax,%edx
+  800dd8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ddc:	83 c0 08             	add    $0x8,%eax
+  800ddf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800de2:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800de5:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800dea:	eb ab                	jmp    800d97 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800dec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800def:	83 f8 2f             	cmp    $0x2f,%eax
+  800df2:	77 16                	ja     800e0a <vprintfmt+0x57b>
+  800df4:	89 c2                	mov    %eax,%edx
+  800df6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dfa:	83 c0 08             	add    $0x8,%eax
+  800dfd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e00:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800e03:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800e08:	eb 8d                	jmp    800d97 <vprintfmt+0x508>
+  800e0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e16:	eb e8                	jmp    800e00 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800e18:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e1c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e24:	eb bc                	jmp    800de2 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800e26:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e29:	83 f8 2f             	cmp    $0x2f,%eax
+  800e2c:	77 18                	ja     800e46 <vprintfmt+0x5b7>
+  800e2e:	89 c2                	mov    %eax,%edx
+  800e30:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e34:	83 c0 08             	add    $0x8,%eax
+  800e37:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e3a:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800e3c:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800e41:	e9 51 ff ff ff       	jmp    800d97 <vprintfmt+0x508>
+  800e46:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e4a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e52:	eb e6                	jmp    800e3a <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800e54:	4c 89 ee             	mov    %r13,%rsi
+  800e57:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e5c:	41 ff d6             	call   *%r14
+			break;
+  800e5f:	e9 60 fa ff ff       	jmp    8008c4 <vprintfmt+0x35>
+			putch('%', putdat);
+  800e64:	4c 89 ee             	mov    %r13,%rsi
+  800e67:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e6c:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800e6f:	4c 89 e3             	mov    %r12,%rbx
+  800e72:	eb 04                	jmp    800e78 <vprintfmt+0x5e9>
+  800e74:	48 83 eb 01          	sub    $0x1,%rbx
+  800e78:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e7c:	75 f6                	jne    800e74 <vprintfmt+0x5e5>
+  800e7e:	e9 41 fa ff ff       	jmp    8008c4 <vprintfmt+0x35>
+
+0000000000800e83 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800e83:	55                   	push   %rbp
+  800e84:	48 89 e5             	mov    %rsp,%rbp
+  800e87:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800e8b:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800e8f:	48 63 c6             	movslq %esi,%rax
+  800e92:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800e97:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800e9b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800ea2:	48 85 ff             	test   %rdi,%rdi
+  800ea5:	74 2a                	je     800ed1 <vsnprintf+0x4e>
+  800ea7:	85 f6                	test   %esi,%esi
+  800ea9:	7e 26                	jle    800ed1 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800eab:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800eaf:	48 bf f1 07 80 00 00 	movabs $0x8007f1,%rdi
+  800eb6:	00 00 00 
+  800eb9:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  800ec0:	00 00 00 
+  800ec3:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ec5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800ec9:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800ecc:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800ecf:	c9                   	leave
+  800ed0:	c3                   	ret
+		return -E_INVAL;
+  800ed1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ed6:	eb f7                	jmp    800ecf <vsnprintf+0x4c>
+
+0000000000800ed8 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800ed8:	55                   	push   %rbp
+  800ed9:	48 89 e5             	mov    %rsp,%rbp
+  800edc:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800ee3:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800eea:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800ef1:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800ef8:	84 c0                	test   %al,%al
+  800efa:	74 20                	je     800f1c <snprintf+0x44>
+  800efc:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f00:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f04:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f08:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f0c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f10:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f14:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f18:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800f1c:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f23:	00 00 00 
+  800f26:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f2d:	00 00 00 
+  800f30:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f34:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800f3b:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f42:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800f49:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800f50:	48 b8 83 0e 80 00 00 	movabs $0x800e83,%rax
+  800f57:	00 00 00 
+  800f5a:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800f5c:	c9                   	leave
+  800f5d:	c3                   	ret
+
+0000000000800f5e <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800f5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f63:	48 89 d0             	mov    %rdx,%rax
+  800f66:	48 83 c2 01          	add    $0x1,%rdx
+  800f6a:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800f6f:	75 f2                	jne    800f63 <strlen+0x5>
+		n++;
+	return n;
+}
+  800f71:	c3                   	ret
+
+0000000000800f72 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f77:	eb 03                	jmp    800f7c <strnlen+0xa>
+  800f79:	48 89 d0             	mov    %rdx,%rax
+  800f7c:	48 39 c6             	cmp    %rax,%rsi
+  800f7f:	74 0a                	je     800f8b <strnlen+0x19>
+  800f81:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800f85:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800f89:	75 ee                	jne    800f79 <strnlen+0x7>
+		n++;
+	return n;
+}
+  800f8b:	c3                   	ret
+
+0000000000800f8c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800f8c:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800f8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f94:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800f98:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800f9b:	48 83 c2 01          	add    $0x1,%rdx
+  800f9f:	84 c9                	test   %cl,%cl
+  800fa1:	75 f1                	jne    800f94 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800fa3:	c3                   	ret
+
+0000000000800fa4 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800fa4:	55                   	push   %rbp
+  800fa5:	48 89 e5             	mov    %rsp,%rbp
+  800fa8:	41 54                	push   %r12
+  800faa:	53                   	push   %rbx
+  800fab:	48 89 fb             	mov    %rdi,%rbx
+  800fae:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800fb1:	48 b8 5e 0f 80 00 00 	movabs $0x800f5e,%rax
+  800fb8:	00 00 00 
+  800fbb:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800fbd:	48 63 f8             	movslq %eax,%rdi
+  800fc0:	48 01 df             	add    %rbx,%rdi
+  800fc3:	4c 89 e6             	mov    %r12,%rsi
+  800fc6:	48 b8 8c 0f 80 00 00 	movabs $0x800f8c,%rax
+  800fcd:	00 00 00 
+  800fd0:	ff d0                	call   *%rax
+	return dst;
+}
+  800fd2:	48 89 d8             	mov    %rbx,%rax
+  800fd5:	5b                   	pop    %rbx
+  800fd6:	41 5c                	pop    %r12
+  800fd8:	5d                   	pop    %rbp
+  800fd9:	c3                   	ret
+
+0000000000800fda <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800fda:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800fdd:	48 01 fa             	add    %rdi,%rdx
+  800fe0:	48 89 f9             	mov    %rdi,%rcx
+  800fe3:	eb 14                	jmp    800ff9 <strncpy+0x1f>
+		*dst++ = *src;
+  800fe5:	48 83 c1 01          	add    $0x1,%rcx
+  800fe9:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800fed:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ff1:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ff5:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800ff9:	48 39 d1             	cmp    %rdx,%rcx
+  800ffc:	75 e7                	jne    800fe5 <strncpy+0xb>
+	}
+	return ret;
+}
+  800ffe:	c3                   	ret
+
+0000000000800fff <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800fff:	48 89 f8             	mov    %rdi,%rax
+  801002:	48 85 d2             	test   %rdx,%rdx
+  801005:	74 27                	je     80102e <strlcpy+0x2f>
+  801007:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  80100c:	48 89 fa             	mov    %rdi,%rdx
+  80100f:	eb 0b                	jmp    80101c <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801011:	48 83 c6 01          	add    $0x1,%rsi
+  801015:	48 83 c2 01          	add    $0x1,%rdx
+  801019:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  80101c:	48 39 c2             	cmp    %rax,%rdx
+  80101f:	74 0a                	je     80102b <strlcpy+0x2c>
+  801021:	0f b6 0e             	movzbl (%rsi),%ecx
+  801024:	84 c9                	test   %cl,%cl
+  801026:	75 e9                	jne    801011 <strlcpy+0x12>
+  801028:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  80102b:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  80102e:	48 29 f8             	sub    %rdi,%rax
+}
+  801031:	c3                   	ret
+
+0000000000801032 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  801032:	eb 08                	jmp    80103c <strcmp+0xa>
+		p++, q++;
+  801034:	48 83 c7 01          	add    $0x1,%rdi
+  801038:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  80103c:	0f b6 07             	movzbl (%rdi),%eax
+  80103f:	84 c0                	test   %al,%al
+  801041:	74 04                	je     801047 <strcmp+0x15>
+  801043:	3a 06                	cmp    (%rsi),%al
+  801045:	74 ed                	je     801034 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801047:	0f b6 c0             	movzbl %al,%eax
+  80104a:	0f b6 16             	movzbl (%rsi),%edx
+  80104d:	29 d0                	sub    %edx,%eax
+}
+  80104f:	c3                   	ret
+
+0000000000801050 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  801050:	eb 0c                	jmp    80105e <strncmp+0xe>
+		n--, p++, q++;
+  801052:	48 83 ea 01          	sub    $0x1,%rdx
+  801056:	48 83 c7 01          	add    $0x1,%rdi
+  80105a:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  80105e:	48 85 d2             	test   %rdx,%rdx
+  801061:	74 14                	je     801077 <strncmp+0x27>
+  801063:	0f b6 07             	movzbl (%rdi),%eax
+  801066:	84 c0                	test   %al,%al
+  801068:	74 04                	je     80106e <strncmp+0x1e>
+  80106a:	3a 06                	cmp    (%rsi),%al
+  80106c:	74 e4                	je     801052 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80106e:	0f b6 07             	movzbl (%rdi),%eax
+  801071:	0f b6 16             	movzbl (%rsi),%edx
+  801074:	29 d0                	sub    %edx,%eax
+}
+  801076:	c3                   	ret
+		return 0;
+  801077:	b8 00 00 00 00       	mov    $0x0,%eax
+  80107c:	c3                   	ret
+
+000000000080107d <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  80107d:	eb 04                	jmp    801083 <strchr+0x6>
+  80107f:	48 83 c7 01          	add    $0x1,%rdi
+  801083:	0f b6 07             	movzbl (%rdi),%eax
+  801086:	84 c0                	test   %al,%al
+  801088:	74 09                	je     801093 <strchr+0x16>
+		if (*s == c)
+  80108a:	40 38 f0             	cmp    %sil,%al
+  80108d:	75 f0                	jne    80107f <strchr+0x2>
+  80108f:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  801092:	c3                   	ret
+	return 0;
+  801093:	b8 00 00 00 00       	mov    $0x0,%eax
+  801098:	c3                   	ret
+
+0000000000801099 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801099:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  80109c:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  80109f:	40 38 f2             	cmp    %sil,%dl
+  8010a2:	74 0a                	je     8010ae <strfind+0x15>
+  8010a4:	84 d2                	test   %dl,%dl
+  8010a6:	74 06                	je     8010ae <strfind+0x15>
+	for (; *s; s++)
+  8010a8:	48 83 c0 01          	add    $0x1,%rax
+  8010ac:	eb ee                	jmp    80109c <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  8010ae:	c3                   	ret
+
+00000000008010af <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  8010af:	48 85 d2             	test   %rdx,%rdx
+  8010b2:	74 28                	je     8010dc <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  8010b4:	48 89 f8             	mov    %rdi,%rax
+  8010b7:	48 09 d0             	or     %rdx,%rax
+  8010ba:	a8 03                	test   $0x3,%al
+  8010bc:	75 16                	jne    8010d4 <memset+0x25>
+		c &= 0xFF;
+  8010be:	40 0f b6 f6          	movzbl %sil,%esi
+  8010c2:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8010c8:	48 89 d1             	mov    %rdx,%rcx
+  8010cb:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  8010cf:	fc                   	cld
+  8010d0:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8010d2:	eb 08                	jmp    8010dc <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8010d4:	89 f0                	mov    %esi,%eax
+  8010d6:	48 89 d1             	mov    %rdx,%rcx
+  8010d9:	fc                   	cld
+  8010da:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8010dc:	48 89 f8             	mov    %rdi,%rax
+  8010df:	c3                   	ret
+
+00000000008010e0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8010e0:	48 89 f8             	mov    %rdi,%rax
+  8010e3:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8010e6:	48 39 fe             	cmp    %rdi,%rsi
+  8010e9:	73 3a                	jae    801125 <memmove+0x45>
+  8010eb:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010ef:	48 39 d7             	cmp    %rdx,%rdi
+  8010f2:	73 31                	jae    801125 <memmove+0x45>
+		s += n;
+		d += n;
+  8010f4:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  8010f8:	48 89 d6             	mov    %rdx,%rsi
+  8010fb:	48 09 fe             	or     %rdi,%rsi
+  8010fe:	48 09 ce             	or     %rcx,%rsi
+  801101:	40 f6 c6 03          	test   $0x3,%sil
+  801105:	75 11                	jne    801118 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801107:	48 83 ef 04          	sub    $0x4,%rdi
+  80110b:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  80110f:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801113:	fd                   	std
+  801114:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801116:	eb 0b                	jmp    801123 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801118:	48 83 ef 01          	sub    $0x1,%rdi
+  80111c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  801120:	fd                   	std
+  801121:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801123:	fc                   	cld
+  801124:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  801125:	48 89 f2             	mov    %rsi,%rdx
+  801128:	48 09 c2             	or     %rax,%rdx
+  80112b:	48 09 ca             	or     %rcx,%rdx
+  80112e:	f6 c2 03             	test   $0x3,%dl
+  801131:	75 0b                	jne    80113e <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801133:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  801137:	48 89 c7             	mov    %rax,%rdi
+  80113a:	fc                   	cld
+  80113b:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80113d:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  80113e:	48 89 c7             	mov    %rax,%rdi
+  801141:	fc                   	cld
+  801142:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801144:	c3                   	ret
+
+0000000000801145 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801145:	55                   	push   %rbp
+  801146:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  801149:	48 b8 e0 10 80 00 00 	movabs $0x8010e0,%rax
+  801150:	00 00 00 
+  801153:	ff d0                	call   *%rax
+}
+  801155:	5d                   	pop    %rbp
+  801156:	c3                   	ret
+
+0000000000801157 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801157:	b8 00 00 00 00       	mov    $0x0,%eax
+  80115c:	48 39 c2             	cmp    %rax,%rdx
+  80115f:	74 1e                	je     80117f <memcmp+0x28>
+		if (*s1 != *s2)
+  801161:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801165:	48 83 c0 01          	add    $0x1,%rax
+  801169:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  80116f:	44 38 c1             	cmp    %r8b,%cl
+  801172:	74 e8                	je     80115c <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  801174:	0f b6 c1             	movzbl %cl,%eax
+  801177:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80117b:	44 29 c0             	sub    %r8d,%eax
+  80117e:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  80117f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801184:	c3                   	ret
+
+0000000000801185 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801185:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  801188:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  80118b:	eb 04                	jmp    801191 <memfind+0xc>
+  80118d:	48 83 c0 01          	add    $0x1,%rax
+  801191:	48 39 d0             	cmp    %rdx,%rax
+  801194:	73 05                	jae    80119b <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801196:	40 38 30             	cmp    %sil,(%rax)
+  801199:	75 f2                	jne    80118d <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  80119b:	c3                   	ret
+
+000000000080119c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80119c:	48 89 f9             	mov    %rdi,%rcx
+  80119f:	49 89 f0             	mov    %rsi,%r8
+  8011a2:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8011a4:	eb 04                	jmp    8011aa <strtol+0xe>
+		s++;
+  8011a6:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  8011aa:	0f b6 01             	movzbl (%rcx),%eax
+  8011ad:	3c 20                	cmp    $0x20,%al
+  8011af:	74 f5                	je     8011a6 <strtol+0xa>
+  8011b1:	3c 09                	cmp    $0x9,%al
+  8011b3:	74 f1                	je     8011a6 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  8011b5:	3c 2b                	cmp    $0x2b,%al
+  8011b7:	74 2b                	je     8011e4 <strtol+0x48>
+	int neg = 0;
+  8011b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  8011bf:	3c 2d                	cmp    $0x2d,%al
+  8011c1:	74 2d                	je     8011f0 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011c3:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  8011c9:	75 0f                	jne    8011da <strtol+0x3e>
+  8011cb:	80 39 30             	cmpb   $0x30,(%rcx)
+  8011ce:	74 2c                	je     8011fc <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8011d0:	85 ff                	test   %edi,%edi
+  8011d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011d7:	0f 44 f8             	cmove  %eax,%edi
+  8011da:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  8011df:	4c 63 d7             	movslq %edi,%r10
+  8011e2:	eb 4f                	jmp    801233 <strtol+0x97>
+		s++;
+  8011e4:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  8011e8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8011ee:	eb d3                	jmp    8011c3 <strtol+0x27>
+		s++, neg = 1;
+  8011f0:	48 83 c1 01          	add    $0x1,%rcx
+  8011f4:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  8011fa:	eb c7                	jmp    8011c3 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011fc:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  801200:	74 0f                	je     801211 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  801202:	85 ff                	test   %edi,%edi
+  801204:	75 d4                	jne    8011da <strtol+0x3e>
+		s++, base = 8;
+  801206:	48 83 c1 01          	add    $0x1,%rcx
+  80120a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80120f:	eb c9                	jmp    8011da <strtol+0x3e>
+		s += 2, base = 16;
+  801211:	48 83 c1 02          	add    $0x2,%rcx
+  801215:	bf 10 00 00 00       	mov    $0x10,%edi
+  80121a:	eb be                	jmp    8011da <strtol+0x3e>
+			dig = *s - '0';
+  80121c:	0f be c0             	movsbl %al,%eax
+  80121f:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  801222:	39 f8                	cmp    %edi,%eax
+  801224:	7d 3b                	jge    801261 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  801226:	48 83 c1 01          	add    $0x1,%rcx
+  80122a:	49 0f af d2          	imul   %r10,%rdx
+  80122e:	48 98                	cltq
+  801230:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  801233:	0f b6 01             	movzbl (%rcx),%eax
+  801236:	8d 70 d0             	lea    -0x30(%rax),%esi
+  801239:	40 80 fe 09          	cmp    $0x9,%sil
+  80123d:	76 dd                	jbe    80121c <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  80123f:	8d 70 9f             	lea    -0x61(%rax),%esi
+  801242:	40 80 fe 19          	cmp    $0x19,%sil
+  801246:	77 08                	ja     801250 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  801248:	0f be c0             	movsbl %al,%eax
+  80124b:	83 e8 57             	sub    $0x57,%eax
+  80124e:	eb d2                	jmp    801222 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  801250:	8d 70 bf             	lea    -0x41(%rax),%esi
+  801253:	40 80 fe 19          	cmp    $0x19,%sil
+  801257:	77 08                	ja     801261 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  801259:	0f be c0             	movsbl %al,%eax
+  80125c:	83 e8 37             	sub    $0x37,%eax
+  80125f:	eb c1                	jmp    801222 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801261:	4d 85 c0             	test   %r8,%r8
+  801264:	74 03                	je     801269 <strtol+0xcd>
+		*endptr = (char *) s;
+  801266:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  801269:	48 89 d0             	mov    %rdx,%rax
+  80126c:	48 f7 d8             	neg    %rax
+  80126f:	45 85 c9             	test   %r9d,%r9d
+  801272:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  801276:	48 89 d0             	mov    %rdx,%rax
+  801279:	c3                   	ret
@@ -0,0 +1,2250 @@
+
+obj/user/buggyhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1e 00 00 00       	call   80004f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+	sys_cputs((char*)1, 1);
+  800037:	be 01 00 00 00       	mov    $0x1,%esi
+  80003c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800041:	48 b8 95 00 80 00 00 	movabs $0x800095,%rax
+  800048:	00 00 00 
+  80004b:	ff d0                	call   *%rax
+}
+  80004d:	5d                   	pop    %rbp
+  80004e:	c3                   	ret
+
+000000000080004f <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  80004f:	55                   	push   %rbp
+  800050:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800053:	85 ff                	test   %edi,%edi
+  800055:	7e 0d                	jle    800064 <libmain+0x15>
+		binaryname = argv[0];
+  800057:	48 8b 06             	mov    (%rsi),%rax
+  80005a:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  800061:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  800064:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  80006b:	00 00 00 
+  80006e:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800070:	48 b8 7e 00 80 00 00 	movabs $0x80007e,%rax
+  800077:	00 00 00 
+  80007a:	ff d0                	call   *%rax
+}
+  80007c:	5d                   	pop    %rbp
+  80007d:	c3                   	ret
+
+000000000080007e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80007e:	55                   	push   %rbp
+  80007f:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  800082:	bf 00 00 00 00       	mov    $0x0,%edi
+  800087:	48 b8 cd 00 80 00 00 	movabs $0x8000cd,%rax
+  80008e:	00 00 00 
+  800091:	ff d0                	call   *%rax
+}
+  800093:	5d                   	pop    %rbp
+  800094:	c3                   	ret
+
+0000000000800095 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800095:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80009b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  8000a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ab:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  8000ad:	c3                   	ret
+
+00000000008000ae <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  8000ae:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8000ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000bf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000c4:	48 89 fe             	mov    %rdi,%rsi
+  8000c7:	48 89 fa             	mov    %rdi,%rdx
+  8000ca:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000cc:	c3                   	ret
+
+00000000008000cd <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8000cd:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8000d0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8000dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8000e1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000e6:	48 89 f2             	mov    %rsi,%rdx
+  8000e9:	0f 05                	syscall
+	if(check && ret > 0)
+  8000eb:	48 85 c0             	test   %rax,%rax
+  8000ee:	7f 01                	jg     8000f1 <sys_env_destroy+0x24>
+}
+  8000f0:	c3                   	ret
+{
+  8000f1:	55                   	push   %rbp
+  8000f2:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8000f5:	49 89 c0             	mov    %rax,%r8
+  8000f8:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8000fd:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  800104:	00 00 00 
+  800107:	be 28 00 00 00       	mov    $0x28,%esi
+  80010c:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  800113:	00 00 00 
+  800116:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011b:	49 b9 50 05 80 00 00 	movabs $0x800550,%r9
+  800122:	00 00 00 
+  800125:	41 ff d1             	call   *%r9
+
+0000000000800128 <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800128:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  80012f:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800130:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800135:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800139:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80013d:	48 c1 e2 04          	shl    $0x4,%rdx
+  800141:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800148:	00 00 00 
+  80014b:	48 01 d0             	add    %rdx,%rax
+  80014e:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800154:	c3                   	ret
+
+0000000000800155 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800155:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80015b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800161:	bf 00 00 00 00       	mov    $0x0,%edi
+  800166:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80016b:	48 89 fe             	mov    %rdi,%rsi
+  80016e:	48 89 fa             	mov    %rdi,%rdx
+  800171:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800173:	c3                   	ret
+
+0000000000800174 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  800174:	48 63 d2             	movslq %edx,%rdx
+  800177:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80017a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800180:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800186:	b8 04 00 00 00       	mov    $0x4,%eax
+  80018b:	0f 05                	syscall
+	if(check && ret > 0)
+  80018d:	48 85 c0             	test   %rax,%rax
+  800190:	7f 01                	jg     800193 <sys_page_alloc+0x1f>
+}
+  800192:	c3                   	ret
+{
+  800193:	55                   	push   %rbp
+  800194:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800197:	49 89 c0             	mov    %rax,%r8
+  80019a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80019f:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  8001a6:	00 00 00 
+  8001a9:	be 28 00 00 00       	mov    $0x28,%esi
+  8001ae:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  8001b5:	00 00 00 
+  8001b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bd:	49 b9 50 05 80 00 00 	movabs $0x800550,%r9
+  8001c4:	00 00 00 
+  8001c7:	41 ff d1             	call   *%r9
+
+00000000008001ca <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8001ca:	48 63 d2             	movslq %edx,%rdx
+  8001cd:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8001d0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8001d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8001dc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8001e1:	0f 05                	syscall
+	if(check && ret > 0)
+  8001e3:	48 85 c0             	test   %rax,%rax
+  8001e6:	7f 01                	jg     8001e9 <sys_page_alloc_huge+0x1f>
+}
+  8001e8:	c3                   	ret
+{
+  8001e9:	55                   	push   %rbp
+  8001ea:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001ed:	49 89 c0             	mov    %rax,%r8
+  8001f0:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8001f5:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  8001fc:	00 00 00 
+  8001ff:	be 28 00 00 00       	mov    $0x28,%esi
+  800204:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  80020b:	00 00 00 
+  80020e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800213:	49 b9 50 05 80 00 00 	movabs $0x800550,%r9
+  80021a:	00 00 00 
+  80021d:	41 ff d1             	call   *%r9
+
+0000000000800220 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800220:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  800223:	48 63 d2             	movslq %edx,%rdx
+  800226:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800229:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  80022c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800231:	0f 05                	syscall
+	if(check && ret > 0)
+  800233:	48 85 c0             	test   %rax,%rax
+  800236:	7f 01                	jg     800239 <sys_page_map+0x19>
+}
+  800238:	c3                   	ret
+{
+  800239:	55                   	push   %rbp
+  80023a:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80023d:	49 89 c0             	mov    %rax,%r8
+  800240:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800245:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  80024c:	00 00 00 
+  80024f:	be 28 00 00 00       	mov    $0x28,%esi
+  800254:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  80025b:	00 00 00 
+  80025e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800263:	49 b9 50 05 80 00 00 	movabs $0x800550,%r9
+  80026a:	00 00 00 
+  80026d:	41 ff d1             	call   *%r9
+
+0000000000800270 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  800270:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800273:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800279:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80027f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800284:	b8 06 00 00 00       	mov    $0x6,%eax
+  800289:	0f 05                	syscall
+	if(check && ret > 0)
+  80028b:	48 85 c0             	test   %rax,%rax
+  80028e:	7f 01                	jg     800291 <sys_page_unmap+0x21>
+}
+  800290:	c3                   	ret
+{
+  800291:	55                   	push   %rbp
+  800292:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800295:	49 89 c0             	mov    %rax,%r8
+  800298:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80029d:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  8002a4:	00 00 00 
+  8002a7:	be 28 00 00 00       	mov    $0x28,%esi
+  8002ac:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  8002b3:	00 00 00 
+  8002b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002bb:	49 b9 50 05 80 00 00 	movabs $0x800550,%r9
+  8002c2:	00 00 00 
+  8002c5:	41 ff d1             	call   *%r9
+
+00000000008002c8 <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  8002c8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002d9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8002de:	48 89 fe             	mov    %rdi,%rsi
+  8002e1:	48 89 fa             	mov    %rdi,%rdx
+  8002e4:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8002e6:	c3                   	ret
+
+00000000008002e7 <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  8002e7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002f8:	b8 10 00 00 00       	mov    $0x10,%eax
+  8002fd:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  8002ff:	c3                   	ret
+
+0000000000800300 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  800300:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800306:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80030c:	b8 11 00 00 00       	mov    $0x11,%eax
+  800311:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  800313:	c3                   	ret
+
+0000000000800314 <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  800314:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  800317:	48 63 f6             	movslq %esi,%rsi
+  80031a:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  80031d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800323:	b8 12 00 00 00       	mov    $0x12,%eax
+  800328:	0f 05                	syscall
+	if(check && ret > 0)
+  80032a:	48 85 c0             	test   %rax,%rax
+  80032d:	7f 01                	jg     800330 <sys_page_batch+0x1c>
+}
+  80032f:	c3                   	ret
+{
+  800330:	55                   	push   %rbp
+  800331:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800334:	49 89 c0             	mov    %rax,%r8
+  800337:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80033c:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  800343:	00 00 00 
+  800346:	be 28 00 00 00       	mov    $0x28,%esi
+  80034b:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  800352:	00 00 00 
+  800355:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035a:	49 b9 50 05 80 00 00 	movabs $0x800550,%r9
+  800361:	00 00 00 
+  800364:	41 ff d1             	call   *%r9
+
+0000000000800367 <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  800367:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80036d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800373:	be 00 00 00 00       	mov    $0x0,%esi
+  800378:	b8 13 00 00 00       	mov    $0x13,%eax
+  80037d:	48 89 f2             	mov    %rsi,%rdx
+  800380:	0f 05                	syscall
+	if(check && ret > 0)
+  800382:	48 85 c0             	test   %rax,%rax
+  800385:	7f 01                	jg     800388 <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  800387:	c3                   	ret
+{
+  800388:	55                   	push   %rbp
+  800389:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80038c:	49 89 c0             	mov    %rax,%r8
+  80038f:	b9 13 00 00 00       	mov    $0x13,%ecx
+  800394:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  80039b:	00 00 00 
+  80039e:	be 28 00 00 00       	mov    $0x28,%esi
+  8003a3:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  8003aa:	00 00 00 
+  8003ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b2:	49 b9 50 05 80 00 00 	movabs $0x800550,%r9
+  8003b9:	00 00 00 
+  8003bc:	41 ff d1             	call   *%r9
+
+00000000008003bf <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  8003bf:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8003c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8003cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003d0:	b8 14 00 00 00       	mov    $0x14,%eax
+  8003d5:	48 89 fe             	mov    %rdi,%rsi
+  8003d8:	48 89 fa             	mov    %rdi,%rdx
+  8003db:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8003dd:	c3                   	ret
+
+00000000008003de <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  8003de:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8003e1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8003e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8003ed:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8003f2:	0f 05                	syscall
+	if(check && ret > 0)
+  8003f4:	48 85 c0             	test   %rax,%rax
+  8003f7:	7f 01                	jg     8003fa <sys_page_unmap_range+0x1c>
+}
+  8003f9:	c3                   	ret
+{
+  8003fa:	55                   	push   %rbp
+  8003fb:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003fe:	49 89 c0             	mov    %rax,%r8
+  800401:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800406:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  80040d:	00 00 00 
+  800410:	be 28 00 00 00       	mov    $0x28,%esi
+  800415:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  80041c:	00 00 00 
+  80041f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800424:	49 b9 50 05 80 00 00 	movabs $0x800550,%r9
+  80042b:	00 00 00 
+  80042e:	41 ff d1             	call   *%r9
+
+0000000000800431 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  800431:	48 63 f6             	movslq %esi,%rsi
+  800434:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800437:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80043d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800443:	ba 00 00 00 00       	mov    $0x0,%edx
+  800448:	b8 08 00 00 00       	mov    $0x8,%eax
+  80044d:	0f 05                	syscall
+	if(check && ret > 0)
+  80044f:	48 85 c0             	test   %rax,%rax
+  800452:	7f 01                	jg     800455 <sys_env_set_status+0x24>
+}
+  800454:	c3                   	ret
+{
+  800455:	55                   	push   %rbp
+  800456:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800459:	49 89 c0             	mov    %rax,%r8
+  80045c:	b9 08 00 00 00       	mov    $0x8,%ecx
+  800461:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  800468:	00 00 00 
+  80046b:	be 28 00 00 00       	mov    $0x28,%esi
+  800470:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  800477:	00 00 00 
+  80047a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047f:	49 b9 50 05 80 00 00 	movabs $0x800550,%r9
+  800486:	00 00 00 
+  800489:	41 ff d1             	call   *%r9
+
+000000000080048c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80048c:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80048f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800495:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80049b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004a0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8004a5:	0f 05                	syscall
+	if(check && ret > 0)
+  8004a7:	48 85 c0             	test   %rax,%rax
+  8004aa:	7f 01                	jg     8004ad <sys_env_set_pgfault_upcall+0x21>
+}
+  8004ac:	c3                   	ret
+{
+  8004ad:	55                   	push   %rbp
+  8004ae:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004b1:	49 89 c0             	mov    %rax,%r8
+  8004b4:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004b9:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  8004c0:	00 00 00 
+  8004c3:	be 28 00 00 00       	mov    $0x28,%esi
+  8004c8:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  8004cf:	00 00 00 
+  8004d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d7:	49 b9 50 05 80 00 00 	movabs $0x800550,%r9
+  8004de:	00 00 00 
+  8004e1:	41 ff d1             	call   *%r9
+
+00000000008004e4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8004e4:	48 63 ff             	movslq %edi,%rdi
+  8004e7:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  8004ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8004f0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8004f5:	0f 05                	syscall
+}
+  8004f7:	c3                   	ret
+
+00000000008004f8 <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  8004f8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8004fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800504:	be 00 00 00 00       	mov    $0x0,%esi
+  800509:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80050e:	48 89 f2             	mov    %rsi,%rdx
+  800511:	0f 05                	syscall
+	if(check && ret > 0)
+  800513:	48 85 c0             	test   %rax,%rax
+  800516:	7f 01                	jg     800519 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  800518:	c3                   	ret
+{
+  800519:	55                   	push   %rbp
+  80051a:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80051d:	49 89 c0             	mov    %rax,%r8
+  800520:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  800525:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  80052c:	00 00 00 
+  80052f:	be 28 00 00 00       	mov    $0x28,%esi
+  800534:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  80053b:	00 00 00 
+  80053e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800543:	49 b9 50 05 80 00 00 	movabs $0x800550,%r9
+  80054a:	00 00 00 
+  80054d:	41 ff d1             	call   *%r9
+
+0000000000800550 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800550:	55                   	push   %rbp
+  800551:	48 89 e5             	mov    %rsp,%rbp
+  800554:	41 56                	push   %r14
+  800556:	41 55                	push   %r13
+  800558:	41 54                	push   %r12
+  80055a:	53                   	push   %rbx
+  80055b:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800562:	49 89 fc             	mov    %rdi,%r12
+  800565:	41 89 f5             	mov    %esi,%r13d
+  800568:	48 89 d3             	mov    %rdx,%rbx
+  80056b:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800572:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800579:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800580:	84 c0                	test   %al,%al
+  800582:	74 26                	je     8005aa <_panic+0x5a>
+  800584:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  80058b:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800592:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800596:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  80059a:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  80059e:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8005a2:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8005a6:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8005aa:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8005b1:	00 00 00 
+  8005b4:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8005bb:	00 00 00 
+  8005be:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005c2:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8005c9:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8005d0:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005d7:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  8005de:	00 00 00 
+  8005e1:	4c 8b 30             	mov    (%rax),%r14
+  8005e4:	48 b8 28 01 80 00 00 	movabs $0x800128,%rax
+  8005eb:	00 00 00 
+  8005ee:	ff d0                	call   *%rax
+  8005f0:	89 c6                	mov    %eax,%esi
+  8005f2:	45 89 e8             	mov    %r13d,%r8d
+  8005f5:	4c 89 e1             	mov    %r12,%rcx
+  8005f8:	4c 89 f2             	mov    %r14,%rdx
+  8005fb:	48 bf d8 12 80 00 00 	movabs $0x8012d8,%rdi
+  800602:	00 00 00 
+  800605:	b8 00 00 00 00       	mov    $0x0,%eax
+  80060a:	49 bc ef 06 80 00 00 	movabs $0x8006ef,%r12
+  800611:	00 00 00 
+  800614:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800617:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  80061e:	48 89 df             	mov    %rbx,%rdi
+  800621:	48 b8 8b 06 80 00 00 	movabs $0x80068b,%rax
+  800628:	00 00 00 
+  80062b:	ff d0                	call   *%rax
+	cprintf("\n");
+  80062d:	48 bf fb 12 80 00 00 	movabs $0x8012fb,%rdi
+  800634:	00 00 00 
+  800637:	b8 00 00 00 00       	mov    $0x0,%eax
+  80063c:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80063f:	cc                   	int3
+	while (1)
+  800640:	eb fd                	jmp    80063f <_panic+0xef>
+
+0000000000800642 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800642:	55                   	push   %rbp
+  800643:	48 89 e5             	mov    %rsp,%rbp
+  800646:	53                   	push   %rbx
+  800647:	48 83 ec 08          	sub    $0x8,%rsp
+  80064b:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  80064e:	8b 06                	mov    (%rsi),%eax
+  800650:	8d 50 01             	lea    0x1(%rax),%edx
+  800653:	89 16                	mov    %edx,(%rsi)
+  800655:	48 98                	cltq
+  800657:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  80065c:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800662:	74 0a                	je     80066e <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800664:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800668:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80066c:	c9                   	leave
+  80066d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80066e:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800672:	be ff 00 00 00       	mov    $0xff,%esi
+  800677:	48 b8 95 00 80 00 00 	movabs $0x800095,%rax
+  80067e:	00 00 00 
+  800681:	ff d0                	call   *%rax
+		b->idx = 0;
+  800683:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800689:	eb d9                	jmp    800664 <putch+0x22>
+
+000000000080068b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80068b:	55                   	push   %rbp
+  80068c:	48 89 e5             	mov    %rsp,%rbp
+  80068f:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800696:	48 89 fa             	mov    %rdi,%rdx
+  800699:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  80069c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8006a3:	00 00 00 
+	b.cnt = 0;
+  8006a6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8006ad:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8006b0:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  8006b7:	48 bf 42 06 80 00 00 	movabs $0x800642,%rdi
+  8006be:	00 00 00 
+  8006c1:	48 b8 a9 08 80 00 00 	movabs $0x8008a9,%rax
+  8006c8:	00 00 00 
+  8006cb:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8006cd:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  8006d4:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8006db:	48 b8 95 00 80 00 00 	movabs $0x800095,%rax
+  8006e2:	00 00 00 
+  8006e5:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  8006e7:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  8006ed:	c9                   	leave
+  8006ee:	c3                   	ret
+
+00000000008006ef <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8006ef:	55                   	push   %rbp
+  8006f0:	48 89 e5             	mov    %rsp,%rbp
+  8006f3:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8006fa:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800701:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800708:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80070f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800716:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80071d:	84 c0                	test   %al,%al
+  80071f:	74 20                	je     800741 <cprintf+0x52>
+  800721:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800725:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800729:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80072d:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800731:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800735:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800739:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80073d:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800741:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  800748:	00 00 00 
+  80074b:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800752:	00 00 00 
+  800755:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800759:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800760:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800767:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  80076e:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  800775:	48 b8 8b 06 80 00 00 	movabs $0x80068b,%rax
+  80077c:	00 00 00 
+  80077f:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  800781:	c9                   	leave
+  800782:	c3                   	ret
+
+0000000000800783 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800783:	55                   	push   %rbp
+  800784:	48 89 e5             	mov    %rsp,%rbp
+  800787:	41 57                	push   %r15
+  800789:	41 56                	push   %r14
+  80078b:	41 55                	push   %r13
+  80078d:	41 54                	push   %r12
+  80078f:	53                   	push   %rbx
+  800790:	48 83 ec 18          	sub    $0x18,%rsp
+  800794:	49 89 fc             	mov    %rdi,%r12
+  800797:	49 89 f5             	mov    %rsi,%r13
+  80079a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80079e:	44 89 c3             	mov    %r8d,%ebx
+  8007a1:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8007a4:	41 89 cf             	mov    %ecx,%r15d
+  8007a7:	4c 39 fa             	cmp    %r15,%rdx
+  8007aa:	72 29                	jb     8007d5 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8007ac:	48 89 d0             	mov    %rdx,%rax
+  8007af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007b4:	49 f7 f7             	div    %r15
+  8007b7:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8007bb:	48 89 c2             	mov    %rax,%rdx
+  8007be:	48 b8 83 07 80 00 00 	movabs $0x800783,%rax
+  8007c5:	00 00 00 
+  8007c8:	ff d0                	call   *%rax
+  8007ca:	eb 10                	jmp    8007dc <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8007cc:	4c 89 ee             	mov    %r13,%rsi
+  8007cf:	44 89 f7             	mov    %r14d,%edi
+  8007d2:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  8007d5:	83 eb 01             	sub    $0x1,%ebx
+  8007d8:	85 db                	test   %ebx,%ebx
+  8007da:	7f f0                	jg     8007cc <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007dc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007e5:	49 f7 f7             	div    %r15
+  8007e8:	48 b8 fd 12 80 00 00 	movabs $0x8012fd,%rax
+  8007ef:	00 00 00 
+  8007f2:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  8007f6:	4c 89 ee             	mov    %r13,%rsi
+  8007f9:	41 ff d4             	call   *%r12
+}
+  8007fc:	48 83 c4 18          	add    $0x18,%rsp
+  800800:	5b                   	pop    %rbx
+  800801:	41 5c                	pop    %r12
+  800803:	41 5d                	pop    %r13
+  800805:	41 5e                	pop    %r14
+  800807:	41 5f                	pop    %r15
+  800809:	5d                   	pop    %rbp
+  80080a:	c3                   	ret
+
+000000000080080b <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  80080b:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  80080f:	48 8b 06             	mov    (%rsi),%rax
+  800812:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800816:	73 0a                	jae    800822 <sprintputch+0x17>
+		*b->buf++ = ch;
+  800818:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80081c:	48 89 16             	mov    %rdx,(%rsi)
+  80081f:	40 88 38             	mov    %dil,(%rax)
+}
+  800822:	c3                   	ret
+
+0000000000800823 <printfmt>:
+{
+  800823:	55                   	push   %rbp
+  800824:	48 89 e5             	mov    %rsp,%rbp
+  800827:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80082e:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800835:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80083c:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800843:	84 c0                	test   %al,%al
+  800845:	74 20                	je     800867 <printfmt+0x44>
+  800847:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80084b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80084f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800853:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800857:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80085b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80085f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800863:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  800867:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  80086e:	00 00 00 
+  800871:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800878:	00 00 00 
+  80087b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80087f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800886:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80088d:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800894:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  80089b:	48 b8 a9 08 80 00 00 	movabs $0x8008a9,%rax
+  8008a2:	00 00 00 
+  8008a5:	ff d0                	call   *%rax
+}
+  8008a7:	c9                   	leave
+  8008a8:	c3                   	ret
+
+00000000008008a9 <vprintfmt>:
+{
+  8008a9:	55                   	push   %rbp
+  8008aa:	48 89 e5             	mov    %rsp,%rbp
+  8008ad:	41 57                	push   %r15
+  8008af:	41 56                	push   %r14
+  8008b1:	41 55                	push   %r13
+  8008b3:	41 54                	push   %r12
+  8008b5:	53                   	push   %rbx
+  8008b6:	48 83 ec 48          	sub    $0x48,%rsp
+  8008ba:	49 89 fe             	mov    %rdi,%r14
+  8008bd:	49 89 f5             	mov    %rsi,%r13
+  8008c0:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  8008c3:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  8008c7:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  8008cb:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8008cf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8008d3:	eb 09                	jmp    8008de <vprintfmt+0x35>
+			putch(ch, putdat);
+  8008d5:	4c 89 ee             	mov    %r13,%rsi
+  8008d8:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008db:	4c 89 e3             	mov    %r12,%rbx
+  8008de:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8008e2:	0f b6 3b             	movzbl (%rbx),%edi
+  8008e5:	83 ff 25             	cmp    $0x25,%edi
+  8008e8:	74 13                	je     8008fd <vprintfmt+0x54>
+			if (ch == '\0')
+  8008ea:	85 ff                	test   %edi,%edi
+  8008ec:	75 e7                	jne    8008d5 <vprintfmt+0x2c>
+}
+  8008ee:	48 83 c4 48          	add    $0x48,%rsp
+  8008f2:	5b                   	pop    %rbx
+  8008f3:	41 5c                	pop    %r12
+  8008f5:	41 5d                	pop    %r13
+  8008f7:	41 5e                	pop    %r14
+  8008f9:	41 5f                	pop    %r15
+  8008fb:	5d                   	pop    %rbp
+  8008fc:	c3                   	ret
+		padc = ' ';
+  8008fd:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  800901:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  800908:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  80090e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  800915:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80091a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80091f:	41 0f b6 14 24       	movzbl (%r12),%edx
+  800924:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  800927:	3c 55                	cmp    $0x55,%al
+  800929:	0f 87 4f 05 00 00    	ja     800e7e <vprintfmt+0x5d5>
+  80092f:	0f b6 c0             	movzbl %al,%eax
+  800932:	48 be c0 13 80 00 00 	movabs $0x8013c0,%rsi
+  800939:	00 00 00 
+  80093c:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  80093f:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  800942:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  800946:	eb d2                	jmp    80091a <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800948:	49 89 dc             	mov    %rbx,%r12
+  80094b:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  80094f:	eb c9                	jmp    80091a <vprintfmt+0x71>
+  800951:	0f b6 d2             	movzbl %dl,%edx
+  800954:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  800957:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  80095d:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800961:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  800966:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  80096b:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  80096e:	83 f8 09             	cmp    $0x9,%eax
+  800971:	77 20                	ja     800993 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  800973:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  800977:	eb e4                	jmp    80095d <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  800979:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097c:	83 f8 2f             	cmp    $0x2f,%eax
+  80097f:	77 27                	ja     8009a8 <vprintfmt+0xff>
+  800981:	89 c2                	mov    %eax,%edx
+  800983:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800987:	83 c0 08             	add    $0x8,%eax
+  80098a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098d:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  800990:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  800993:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800997:	79 81                	jns    80091a <vprintfmt+0x71>
+				width = precision, precision = -1;
+  800999:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  80099d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8009a3:	e9 72 ff ff ff       	jmp    80091a <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  8009a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b4:	eb d7                	jmp    80098d <vprintfmt+0xe4>
+			if (width < 0)
+  8009b6:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  8009b9:	85 f6                	test   %esi,%esi
+  8009bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c0:	0f 49 c6             	cmovns %esi,%eax
+  8009c3:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8009c6:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8009c9:	e9 4c ff ff ff       	jmp    80091a <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8009ce:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  8009d1:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  8009d8:	e9 3d ff ff ff       	jmp    80091a <vprintfmt+0x71>
+			lflag++;
+  8009dd:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8009e0:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8009e3:	e9 32 ff ff ff       	jmp    80091a <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  8009e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ee:	77 19                	ja     800a09 <vprintfmt+0x160>
+  8009f0:	89 c2                	mov    %eax,%edx
+  8009f2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f6:	83 c0 08             	add    $0x8,%eax
+  8009f9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fc:	8b 3a                	mov    (%rdx),%edi
+  8009fe:	4c 89 ee             	mov    %r13,%rsi
+  800a01:	41 ff d6             	call   *%r14
+			break;
+  800a04:	e9 d5 fe ff ff       	jmp    8008de <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  800a09:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a15:	eb e5                	jmp    8009fc <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  800a17:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a1d:	77 5a                	ja     800a79 <vprintfmt+0x1d0>
+  800a1f:	89 c2                	mov    %eax,%edx
+  800a21:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a25:	83 c0 08             	add    $0x8,%eax
+  800a28:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800a2b:	8b 02                	mov    (%rdx),%eax
+  800a2d:	89 c1                	mov    %eax,%ecx
+  800a2f:	f7 d9                	neg    %ecx
+  800a31:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a34:	83 f9 08             	cmp    $0x8,%ecx
+  800a37:	7f 4e                	jg     800a87 <vprintfmt+0x1de>
+  800a39:	48 63 c1             	movslq %ecx,%rax
+  800a3c:	48 ba 80 16 80 00 00 	movabs $0x801680,%rdx
+  800a43:	00 00 00 
+  800a46:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800a4a:	48 85 c0             	test   %rax,%rax
+  800a4d:	74 38                	je     800a87 <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800a4f:	48 89 c1             	mov    %rax,%rcx
+  800a52:	48 ba 1e 13 80 00 00 	movabs $0x80131e,%rdx
+  800a59:	00 00 00 
+  800a5c:	4c 89 ee             	mov    %r13,%rsi
+  800a5f:	4c 89 f7             	mov    %r14,%rdi
+  800a62:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a67:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  800a6e:	00 00 00 
+  800a71:	41 ff d0             	call   *%r8
+  800a74:	e9 65 fe ff ff       	jmp    8008de <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  800a79:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a85:	eb a4                	jmp    800a2b <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  800a87:	48 ba 15 13 80 00 00 	movabs $0x801315,%rdx
+  800a8e:	00 00 00 
+  800a91:	4c 89 ee             	mov    %r13,%rsi
+  800a94:	4c 89 f7             	mov    %r14,%rdi
+  800a97:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a9c:	49 b8 23 08 80 00 00 	movabs $0x800823,%r8
+  800aa3:	00 00 00 
+  800aa6:	41 ff d0             	call   *%r8
+  800aa9:	e9 30 fe ff ff       	jmp    8008de <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800aae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab4:	77 36                	ja     800aec <vprintfmt+0x243>
+  800ab6:	89 c2                	mov    %eax,%edx
+  800ab8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800abc:	83 c0 08             	add    $0x8,%eax
+  800abf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac2:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800ac5:	48 85 c9             	test   %rcx,%rcx
+  800ac8:	48 b8 0e 13 80 00 00 	movabs $0x80130e,%rax
+  800acf:	00 00 00 
+  800ad2:	48 0f 45 c1          	cmovne %rcx,%rax
+  800ad6:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800ada:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800ade:	7e 06                	jle    800ae6 <vprintfmt+0x23d>
+  800ae0:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800ae4:	75 14                	jne    800afa <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ae6:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800aea:	eb 64                	jmp    800b50 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800aec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af8:	eb c8                	jmp    800ac2 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800afa:	49 63 f7             	movslq %r15d,%rsi
+  800afd:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800b01:	48 b8 8c 0f 80 00 00 	movabs $0x800f8c,%rax
+  800b08:	00 00 00 
+  800b0b:	ff d0                	call   *%rax
+  800b0d:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800b10:	29 c1                	sub    %eax,%ecx
+  800b12:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800b15:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  800b18:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800b1c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b1f:	eb 0d                	jmp    800b2e <vprintfmt+0x285>
+					putch(padc, putdat);
+  800b21:	4c 89 ee             	mov    %r13,%rsi
+  800b24:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  800b27:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b2a:	41 83 ec 01          	sub    $0x1,%r12d
+  800b2e:	45 85 e4             	test   %r12d,%r12d
+  800b31:	7f ee                	jg     800b21 <vprintfmt+0x278>
+  800b33:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  800b36:	85 c9                	test   %ecx,%ecx
+  800b38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3d:	0f 49 c1             	cmovns %ecx,%eax
+  800b40:	29 c1                	sub    %eax,%ecx
+  800b42:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  800b45:	eb 9f                	jmp    800ae6 <vprintfmt+0x23d>
+					putch(ch, putdat);
+  800b47:	4c 89 ee             	mov    %r13,%rsi
+  800b4a:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b4d:	4c 89 e2             	mov    %r12,%rdx
+  800b50:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800b54:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800b5a:	0f be f8             	movsbl %al,%edi
+  800b5d:	85 ff                	test   %edi,%edi
+  800b5f:	74 29                	je     800b8a <vprintfmt+0x2e1>
+  800b61:	45 85 ff             	test   %r15d,%r15d
+  800b64:	78 06                	js     800b6c <vprintfmt+0x2c3>
+  800b66:	41 83 ef 01          	sub    $0x1,%r15d
+  800b6a:	78 1e                	js     800b8a <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b6c:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800b70:	74 d5                	je     800b47 <vprintfmt+0x29e>
+  800b72:	0f be c0             	movsbl %al,%eax
+  800b75:	83 e8 20             	sub    $0x20,%eax
+  800b78:	83 f8 5e             	cmp    $0x5e,%eax
+  800b7b:	76 ca                	jbe    800b47 <vprintfmt+0x29e>
+					putch('?', putdat);
+  800b7d:	4c 89 ee             	mov    %r13,%rsi
+  800b80:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b85:	41 ff d6             	call   *%r14
+  800b88:	eb c3                	jmp    800b4d <vprintfmt+0x2a4>
+  800b8a:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800b8e:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800b91:	41 01 c4             	add    %eax,%r12d
+  800b94:	41 29 d4             	sub    %edx,%r12d
+  800b97:	eb 0f                	jmp    800ba8 <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  800b99:	4c 89 ee             	mov    %r13,%rsi
+  800b9c:	bf 20 00 00 00       	mov    $0x20,%edi
+  800ba1:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800ba4:	41 83 ec 01          	sub    $0x1,%r12d
+  800ba8:	45 85 e4             	test   %r12d,%r12d
+  800bab:	7f ec                	jg     800b99 <vprintfmt+0x2f0>
+  800bad:	e9 2c fd ff ff       	jmp    8008de <vprintfmt+0x35>
+	if (lflag >= 2)
+  800bb2:	83 f9 01             	cmp    $0x1,%ecx
+  800bb5:	7f 1d                	jg     800bd4 <vprintfmt+0x32b>
+	else if (lflag)
+  800bb7:	85 c9                	test   %ecx,%ecx
+  800bb9:	74 5e                	je     800c19 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800bbb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbe:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc1:	77 48                	ja     800c0b <vprintfmt+0x362>
+  800bc3:	89 c2                	mov    %eax,%edx
+  800bc5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc9:	83 c0 08             	add    $0x8,%eax
+  800bcc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bcf:	4c 8b 22             	mov    (%rdx),%r12
+  800bd2:	eb 17                	jmp    800beb <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800bd4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bd7:	83 f8 2f             	cmp    $0x2f,%eax
+  800bda:	77 21                	ja     800bfd <vprintfmt+0x354>
+  800bdc:	89 c2                	mov    %eax,%edx
+  800bde:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be2:	83 c0 08             	add    $0x8,%eax
+  800be5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800be8:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800beb:	4d 85 e4             	test   %r12,%r12
+  800bee:	78 50                	js     800c40 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  800bf0:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800bf3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800bf8:	e9 b4 01 00 00       	jmp    800db1 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800bfd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c01:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c09:	eb dd                	jmp    800be8 <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800c0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c17:	eb b6                	jmp    800bcf <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800c19:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c1c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c1f:	77 11                	ja     800c32 <vprintfmt+0x389>
+  800c21:	89 c2                	mov    %eax,%edx
+  800c23:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c27:	83 c0 08             	add    $0x8,%eax
+  800c2a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c2d:	4c 63 22             	movslq (%rdx),%r12
+  800c30:	eb b9                	jmp    800beb <vprintfmt+0x342>
+  800c32:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c36:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3e:	eb ed                	jmp    800c2d <vprintfmt+0x384>
+				putch('-', putdat);
+  800c40:	4c 89 ee             	mov    %r13,%rsi
+  800c43:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c48:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800c4b:	4c 89 e2             	mov    %r12,%rdx
+  800c4e:	48 f7 da             	neg    %rdx
+			base = 10;
+  800c51:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800c56:	e9 56 01 00 00       	jmp    800db1 <vprintfmt+0x508>
+	if (lflag >= 2)
+  800c5b:	83 f9 01             	cmp    $0x1,%ecx
+  800c5e:	7f 25                	jg     800c85 <vprintfmt+0x3dc>
+	else if (lflag)
+  800c60:	85 c9                	test   %ecx,%ecx
+  800c62:	74 5e                	je     800cc2 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800c64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c67:	83 f8 2f             	cmp    $0x2f,%eax
+  800c6a:	77 48                	ja     800cb4 <vprintfmt+0x40b>
+  800c6c:	89 c2                	mov    %eax,%edx
+  800c6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c72:	83 c0 08             	add    $0x8,%eax
+  800c75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c78:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800c7b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800c80:	e9 2c 01 00 00       	jmp    800db1 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800c85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c88:	83 f8 2f             	cmp    $0x2f,%eax
+  800c8b:	77 19                	ja     800ca6 <vprintfmt+0x3fd>
+  800c8d:	89 c2                	mov    %eax,%edx
+  800c8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c93:	83 c0 08             	add    $0x8,%eax
+  800c96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c99:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800c9c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800ca1:	e9 0b 01 00 00       	jmp    800db1 <vprintfmt+0x508>
+  800ca6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800caa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb2:	eb e5                	jmp    800c99 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800cb4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cb8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cbc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc0:	eb b6                	jmp    800c78 <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800cc2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cc5:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc8:	77 18                	ja     800ce2 <vprintfmt+0x439>
+  800cca:	89 c2                	mov    %eax,%edx
+  800ccc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cd0:	83 c0 08             	add    $0x8,%eax
+  800cd3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd6:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800cd8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800cdd:	e9 cf 00 00 00       	jmp    800db1 <vprintfmt+0x508>
+  800ce2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ce6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cee:	eb e6                	jmp    800cd6 <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800cf0:	83 f9 01             	cmp    $0x1,%ecx
+  800cf3:	7f 25                	jg     800d1a <vprintfmt+0x471>
+	else if (lflag)
+  800cf5:	85 c9                	test   %ecx,%ecx
+  800cf7:	74 5b                	je     800d54 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800cf9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cfc:	83 f8 2f             	cmp    $0x2f,%eax
+  800cff:	77 45                	ja     800d46 <vprintfmt+0x49d>
+  800d01:	89 c2                	mov    %eax,%edx
+  800d03:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d07:	83 c0 08             	add    $0x8,%eax
+  800d0a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d0d:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800d10:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800d15:	e9 97 00 00 00       	jmp    800db1 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800d1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d20:	77 16                	ja     800d38 <vprintfmt+0x48f>
+  800d22:	89 c2                	mov    %eax,%edx
+  800d24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d28:	83 c0 08             	add    $0x8,%eax
+  800d2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d2e:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800d31:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800d36:	eb 79                	jmp    800db1 <vprintfmt+0x508>
+  800d38:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d3c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d44:	eb e8                	jmp    800d2e <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800d46:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d4a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d52:	eb b9                	jmp    800d0d <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800d54:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d57:	83 f8 2f             	cmp    $0x2f,%eax
+  800d5a:	77 15                	ja     800d71 <vprintfmt+0x4c8>
+  800d5c:	89 c2                	mov    %eax,%edx
+  800d5e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d62:	83 c0 08             	add    $0x8,%eax
+  800d65:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d68:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800d6a:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800d6f:	eb 40                	jmp    800db1 <vprintfmt+0x508>
+  800d71:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d75:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d7d:	eb e9                	jmp    800d68 <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800d7f:	4c 89 ee             	mov    %r13,%rsi
+  800d82:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d87:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800d8a:	4c 89 ee             	mov    %r13,%rsi
+  800d8d:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d92:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800d95:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d98:	83 f8 2f             	cmp    $0x2f,%eax
+  800d9b:	77 34                	ja     800dd1 <vprintfmt+0x528>
+  800d9d:	89 c2                	mov    %eax,%edx
+  800d9f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800da3:	83 c0 08             	add    $0x8,%eax
+  800da6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800da9:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800dac:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800db1:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800db6:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800dba:	4c 89 ee             	mov    %r13,%rsi
+  800dbd:	4c 89 f7             	mov    %r14,%rdi
+  800dc0:	48 b8 83 07 80 00 00 	movabs $0x800783,%rax
+  800dc7:	00 00 00 
+  800dca:	ff d0                	call   *%rax
+			break;
+  800dcc:	e9 0d fb ff ff       	jmp    8008de <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800dd1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dd5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dd9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ddd:	eb ca                	jmp    800da9 <vprintfmt+0x500>
+	if (lflag >= 2)
+  800ddf:	83 f9 01             	cmp    $0x1,%ecx
+  800de2:	7f 22                	jg     800e06 <vprintfmt+0x55d>
+	else if (lflag)
+  800de4:	85 c9                	test   %ecx,%ecx
+  800de6:	74 58                	je     800e40 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800de8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800deb:	83 f8 2f             	cmp    $0x2f,%eax
+  800dee:	77 42                	ja     800e32 <vprintfmt+0x589>
+  800df0:	89 c2                	mov    %eax,%edx
+  800df2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800df6:	83 c0 08             	add    $0x8,%eax
+  800df9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dfc:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800dff:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800e04:	eb ab                	jmp    800db1 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800e06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e09:	83 f8 2f             	cmp    $0x2f,%eax
+  800e0c:	77 16                	ja     800e24 <vprintfmt+0x57b>
+  800e0e:	89 c2                	mov    %eax,%edx
+  800e10:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e14:	83 c0 08             	add    $0x8,%eax
+  800e17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e1a:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800e1d:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800e22:	eb 8d                	jmp    800db1 <vprintfmt+0x508>
+  800e24:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e28:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e30:	eb e8                	jmp    800e1a <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800e32:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e36:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e3e:	eb bc                	jmp    800dfc <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800e40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e43:	83 f8 2f             	cmp    $0x2f,%eax
+  800e46:	77 18                	ja     800e60 <vprintfmt+0x5b7>
+  800e48:	89 c2                	mov    %eax,%edx
+  800e4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e4e:	83 c0 08             	add    $0x8,%eax
+  800e51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e54:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800e56:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800e5b:	e9 51 ff ff ff       	jmp    800db1 <vprintfmt+0x508>
+  800e60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e6c:	eb e6                	jmp    800e54 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800e6e:	4c 89 ee             	mov    %r13,%rsi
+  800e71:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e76:	41 ff d6             	call   *%r14
+			break;
+  800e79:	e9 60 fa ff ff       	jmp    8008de <vprintfmt+0x35>
+			putch('%', putdat);
+  800e7e:	4c 89 ee             	mov    %r13,%rsi
+  800e81:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e86:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800e89:	4c 89 e3             	mov    %r12,%rbx
+  800e8c:	eb 04                	jmp    800e92 <vprintfmt+0x5e9>
+  800e8e:	48 83 eb 01          	sub    $0x1,%rbx
+  800e92:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e96:	75 f6                	jne    800e8e <vprintfmt+0x5e5>
+  800e98:	e9 41 fa ff ff       	jmp    8008de <vprintfmt+0x35>
+
+0000000000800e9d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800e9d:	55                   	push   %rbp
+  800e9e:	48 89 e5             	mov    %rsp,%rbp
+  800ea1:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800ea5:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800ea9:	48 63 c6             	movslq %esi,%rax
+  800eac:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800eb1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800eb5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800ebc:	48 85 ff             	test   %rdi,%rdi
+  800ebf:	74 2a                	je     800eeb <vsnprintf+0x4e>
+  800ec1:	85 f6                	test   %esi,%esi
+  800ec3:	7e 26                	jle    800eeb <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800ec5:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800ec9:	48 bf 0b 08 80 00 00 	movabs $0x80080b,%rdi
+  800ed0:	00 00 00 
+  800ed3:	48 b8 a9 08 80 00 00 	movabs $0x8008a9,%rax
+  800eda:	00 00 00 
+  800edd:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800edf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800ee3:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800ee6:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800ee9:	c9                   	leave
+  800eea:	c3                   	ret
+		return -E_INVAL;
+  800eeb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ef0:	eb f7                	jmp    800ee9 <vsnprintf+0x4c>
+
+0000000000800ef2 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800ef2:	55                   	push   %rbp
+  800ef3:	48 89 e5             	mov    %rsp,%rbp
+  800ef6:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800efd:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f04:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f0b:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f12:	84 c0                	test   %al,%al
+  800f14:	74 20                	je     800f36 <snprintf+0x44>
+  800f16:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f1a:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f1e:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f22:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f26:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f2a:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f2e:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f32:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800f36:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f3d:	00 00 00 
+  800f40:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f47:	00 00 00 
+  800f4a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f4e:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800f55:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f5c:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800f63:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800f6a:	48 b8 9d 0e 80 00 00 	movabs $0x800e9d,%rax
+  800f71:	00 00 00 
+  800f74:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800f76:	c9                   	leave
+  800f77:	c3                   	ret
+
+0000000000800f78 <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800f78:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f7d:	48 89 d0             	mov    %rdx,%rax
+  800f80:	48 83 c2 01          	add    $0x1,%rdx
+  800f84:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800f89:	75 f2                	jne    800f7d <strlen+0x5>
+		n++;
+	return n;
+}
+  800f8b:	c3                   	ret
+
+0000000000800f8c <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f91:	eb 03                	jmp    800f96 <strnlen+0xa>
+  800f93:	48 89 d0             	mov    %rdx,%rax
+  800f96:	48 39 c6             	cmp    %rax,%rsi
+  800f99:	74 0a                	je     800fa5 <strnlen+0x19>
+  800f9b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800f9f:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800fa3:	75 ee                	jne    800f93 <strnlen+0x7>
+		n++;
+	return n;
+}
+  800fa5:	c3                   	ret
+
+0000000000800fa6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800fa6:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800fa9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fae:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800fb2:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800fb5:	48 83 c2 01          	add    $0x1,%rdx
+  800fb9:	84 c9                	test   %cl,%cl
+  800fbb:	75 f1                	jne    800fae <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800fbd:	c3                   	ret
+
+0000000000800fbe <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800fbe:	55                   	push   %rbp
+  800fbf:	48 89 e5             	mov    %rsp,%rbp
+  800fc2:	41 54                	push   %r12
+  800fc4:	53                   	push   %rbx
+  800fc5:	48 89 fb             	mov    %rdi,%rbx
+  800fc8:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800fcb:	48 b8 78 0f 80 00 00 	movabs $0x800f78,%rax
+  800fd2:	00 00 00 
+  800fd5:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800fd7:	48 63 f8             	movslq %eax,%rdi
+  800fda:	48 01 df             	add    %rbx,%rdi
+  800fdd:	4c 89 e6             	mov    %r12,%rsi
+  800fe0:	48 b8 a6 0f 80 00 00 	movabs $0x800fa6,%rax
+  800fe7:	00 00 00 
+  800fea:	ff d0                	call   *%rax
+	return dst;
+}
+  800fec:	48 89 d8             	mov    %rbx,%rax
+  800fef:	5b                   	pop    %rbx
+  800ff0:	41 5c                	pop    %r12
+  800ff2:	5d                   	pop    %rbp
+  800ff3:	c3                   	ret
+
+0000000000800ff4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ff4:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800ff7:	48 01 fa             	add    %rdi,%rdx
+  800ffa:	48 89 f9             	mov    %rdi,%rcx
+  800ffd:	eb 14                	jmp    801013 <strncpy+0x1f>
+		*dst++ = *src;
+  800fff:	48 83 c1 01          	add    $0x1,%rcx
+  801003:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801007:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80100b:	41 80 f8 01          	cmp    $0x1,%r8b
+  80100f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  801013:	48 39 d1             	cmp    %rdx,%rcx
+  801016:	75 e7                	jne    800fff <strncpy+0xb>
+	}
+	return ret;
+}
+  801018:	c3                   	ret
+
+0000000000801019 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801019:	48 89 f8             	mov    %rdi,%rax
+  80101c:	48 85 d2             	test   %rdx,%rdx
+  80101f:	74 27                	je     801048 <strlcpy+0x2f>
+  801021:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  801026:	48 89 fa             	mov    %rdi,%rdx
+  801029:	eb 0b                	jmp    801036 <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80102b:	48 83 c6 01          	add    $0x1,%rsi
+  80102f:	48 83 c2 01          	add    $0x1,%rdx
+  801033:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  801036:	48 39 c2             	cmp    %rax,%rdx
+  801039:	74 0a                	je     801045 <strlcpy+0x2c>
+  80103b:	0f b6 0e             	movzbl (%rsi),%ecx
+  80103e:	84 c9                	test   %cl,%cl
+  801040:	75 e9                	jne    80102b <strlcpy+0x12>
+  801042:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  801045:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801048:	48 29 f8             	sub    %rdi,%rax
+}
+  80104b:	c3                   	ret
+
+000000000080104c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  80104c:	eb 08                	jmp    801056 <strcmp+0xa>
+		p++, q++;
+  80104e:	48 83 c7 01          	add    $0x1,%rdi
+  801052:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  801056:	0f b6 07             	movzbl (%rdi),%eax
+  801059:	84 c0                	test   %al,%al
+  80105b:	74 04                	je     801061 <strcmp+0x15>
+  80105d:	3a 06                	cmp    (%rsi),%al
+  80105f:	74 ed                	je     80104e <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801061:	0f b6 c0             	movzbl %al,%eax
+  801064:	0f b6 16             	movzbl (%rsi),%edx
+  801067:	29 d0                	sub    %edx,%eax
+}
+  801069:	c3                   	ret
+
+000000000080106a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  80106a:	eb 0c                	jmp    801078 <strncmp+0xe>
+		n--, p++, q++;
+  80106c:	48 83 ea 01          	sub    $0x1,%rdx
+  801070:	48 83 c7 01          	add    $0x1,%rdi
+  801074:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  801078:	48 85 d2             	test   %rdx,%rdx
+  80107b:	74 14                	je     801091 <strncmp+0x27>
+  80107d:	0f b6 07             	movzbl (%rdi),%eax
+  801080:	84 c0                	test   %al,%al
+  801082:	74 04                	je     801088 <strncmp+0x1e>
+  801084:	3a 06                	cmp    (%rsi),%al
+  801086:	74 e4                	je     80106c <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801088:	0f b6 07             	movzbl (%rdi),%eax
+  80108b:	0f b6 16             	movzbl (%rsi),%edx
+  80108e:	29 d0                	sub    %edx,%eax
+}
+  801090:	c3                   	ret
+		return 0;
+  801091:	b8 00 00 00 00       	mov    $0x0,%eax
+  801096:	c3                   	ret
+
+0000000000801097 <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  801097:	eb 04                	jmp    80109d <strchr+0x6>
+  801099:	48 83 c7 01          	add    $0x1,%rdi
+  80109d:	0f b6 07             	movzbl (%rdi),%eax
+  8010a0:	84 c0                	test   %al,%al
+  8010a2:	74 09                	je     8010ad <strchr+0x16>
+		if (*s == c)
+  8010a4:	40 38 f0             	cmp    %sil,%al
+  8010a7:	75 f0                	jne    801099 <strchr+0x2>
+  8010a9:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  8010ac:	c3                   	ret
+	return 0;
+  8010ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b2:	c3                   	ret
+
+00000000008010b3 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8010b3:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  8010b6:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  8010b9:	40 38 f2             	cmp    %sil,%dl
+  8010bc:	74 0a                	je     8010c8 <strfind+0x15>
+  8010be:	84 d2                	test   %dl,%dl
+  8010c0:	74 06                	je     8010c8 <strfind+0x15>
+	for (; *s; s++)
+  8010c2:	48 83 c0 01          	add    $0x1,%rax
+  8010c6:	eb ee                	jmp    8010b6 <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  8010c8:	c3                   	ret
+
+00000000008010c9 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  8010c9:	48 85 d2             	test   %rdx,%rdx
+  8010cc:	74 28                	je     8010f6 <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  8010ce:	48 89 f8             	mov    %rdi,%rax
+  8010d1:	48 09 d0             	or     %rdx,%rax
+  8010d4:	a8 03                	test   $0x3,%al
+  8010d6:	75 16                	jne    8010ee <memset+0x25>
+		c &= 0xFF;
+  8010d8:	40 0f b6 f6          	movzbl %sil,%esi
+  8010dc:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8010e2:	48 89 d1             	mov    %rdx,%rcx
+  8010e5:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  8010e9:	fc                   	cld
+  8010ea:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8010ec:	eb 08                	jmp    8010f6 <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8010ee:	89 f0                	mov    %esi,%eax
+  8010f0:	48 89 d1             	mov    %rdx,%rcx
+  8010f3:	fc                   	cld
+  8010f4:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8010f6:	48 89 f8             	mov    %rdi,%rax
+  8010f9:	c3                   	ret
+
+00000000008010fa <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8010fa:	48 89 f8             	mov    %rdi,%rax
+  8010fd:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801100:	48 39 fe             	cmp    %rdi,%rsi
+  801103:	73 3a                	jae    80113f <memmove+0x45>
+  801105:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801109:	48 39 d7             	cmp    %rdx,%rdi
+  80110c:	73 31                	jae    80113f <memmove+0x45>
+		s += n;
+		d += n;
+  80110e:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  801112:	48 89 d6             	mov    %rdx,%rsi
+  801115:	48 09 fe             	or     %rdi,%rsi
+  801118:	48 09 ce             	or     %rcx,%rsi
+  80111b:	40 f6 c6 03          	test   $0x3,%sil
+  80111f:	75 11                	jne    801132 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801121:	48 83 ef 04          	sub    $0x4,%rdi
+  801125:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  801129:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  80112d:	fd                   	std
+  80112e:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801130:	eb 0b                	jmp    80113d <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801132:	48 83 ef 01          	sub    $0x1,%rdi
+  801136:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  80113a:	fd                   	std
+  80113b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80113d:	fc                   	cld
+  80113e:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  80113f:	48 89 f2             	mov    %rsi,%rdx
+  801142:	48 09 c2             	or     %rax,%rdx
+  801145:	48 09 ca             	or     %rcx,%rdx
+  801148:	f6 c2 03             	test   $0x3,%dl
+  80114b:	75 0b                	jne    801158 <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80114d:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  801151:	48 89 c7             	mov    %rax,%rdi
+  801154:	fc                   	cld
+  801155:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801157:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  801158:	48 89 c7             	mov    %rax,%rdi
+  80115b:	fc                   	cld
+  80115c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80115e:	c3                   	ret
+
+000000000080115f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80115f:	55                   	push   %rbp
+  801160:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  801163:	48 b8 fa 10 80 00 00 	movabs $0x8010fa,%rax
+  80116a:	00 00 00 
+  80116d:	ff d0                	call   *%rax
+}
+  80116f:	5d                   	pop    %rbp
+  801170:	c3                   	ret
+
+0000000000801171 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801171:	b8 00 00 00 00       	mov    $0x0,%eax
+  801176:	48 39 c2             	cmp    %rax,%rdx
+  801179:	74 1e                	je     801199 <memcmp+0x28>
+		if (*s1 != *s2)
+  80117b:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80117f:	48 83 c0 01          	add    $0x1,%rax
+  801183:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  801189:	44 38 c1             	cmp    %r8b,%cl
+  80118c:	74 e8                	je     801176 <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  80118e:	0f b6 c1             	movzbl %cl,%eax
+  801191:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801195:	44 29 c0             	sub    %r8d,%eax
+  801198:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  801199:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80119e:	c3                   	ret
+
+000000000080119f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80119f:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  8011a2:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  8011a5:	eb 04                	jmp    8011ab <memfind+0xc>
+  8011a7:	48 83 c0 01          	add    $0x1,%rax
+  8011ab:	48 39 d0             	cmp    %rdx,%rax
+  8011ae:	73 05                	jae    8011b5 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8011b0:	40 38 30             	cmp    %sil,(%rax)
+  8011b3:	75 f2                	jne    8011a7 <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  8011b5:	c3                   	ret
+
+00000000008011b6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8011b6:	48 89 f9             	mov    %rdi,%rcx
+  8011b9:	49 89 f0             	mov    %rsi,%r8
+  8011bc:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8011be:	eb 04                	jmp    8011c4 <strtol+0xe>
+		s++;
+  8011c0:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  8011c4:	0f b6 01             	movzbl (%rcx),%eax
+  8011c7:	3c 20                	cmp    $0x20,%al
+  8011c9:	74 f5                	je     8011c0 <strtol+0xa>
+  8011cb:	3c 09                	cmp    $0x9,%al
+  8011cd:	74 f1                	je     8011c0 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  8011cf:	3c 2b                	cmp    $0x2b,%al
+  8011d1:	74 2b                	je     8011fe <strtol+0x48>
+	int neg = 0;
+  8011d3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  8011d9:	3c 2d                	cmp    $0x2d,%al
+  8011db:	74 2d                	je     80120a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011dd:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  8011e3:	75 0f                	jne    8011f4 <strtol+0x3e>
+  8011e5:	80 39 30             	cmpb   $0x30,(%rcx)
+  8011e8:	74 2c                	je     801216 <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8011ea:	85 ff                	test   %edi,%edi
+  8011ec:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011f1:	0f 44 f8             	cmove  %eax,%edi
+  8011f4:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  8011f9:	4c 63 d7             	movslq %edi,%r10
+  8011fc:	eb 4f                	jmp    80124d <strtol+0x97>
+		s++;
+  8011fe:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  801202:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801208:	eb d3                	jmp    8011dd <strtol+0x27>
+		s++, neg = 1;
+  80120a:	48 83 c1 01          	add    $0x1,%rcx
+  80120e:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  801214:	eb c7                	jmp    8011dd <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801216:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  80121a:	74 0f                	je     80122b <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  80121c:	85 ff                	test   %edi,%edi
+  80121e:	75 d4                	jne    8011f4 <strtol+0x3e>
+		s++, base = 8;
+  801220:	48 83 c1 01          	add    $0x1,%rcx
+  801224:	bf 08 00 00 00       	mov    $0x8,%edi
+  801229:	eb c9                	jmp    8011f4 <strtol+0x3e>
+		s += 2, base = 16;
+  80122b:	48 83 c1 02          	add    $0x2,%rcx
+  80122f:	bf 10 00 00 00       	mov    $0x10,%edi
+  801234:	eb be                	jmp    8011f4 <strtol+0x3e>
+			dig = *s - '0';
+  801236:	0f be c0             	movsbl %al,%eax
+  801239:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  80123c:	39 f8                	cmp    %edi,%eax
+  80123e:	7d 3b                	jge    80127b <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  801240:	48 83 c1 01          	add    $0x1,%rcx
+  801244:	49 0f af d2          	imul   %r10,%rdx
+  801248:	48 98                	cltq
+  80124a:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  80124d:	0f b6 01             	movzbl (%rcx),%eax
+  801250:	8d 70 d0             	lea    -0x30(%rax),%esi
+  801253:	40 80 fe 09          	cmp    $0x9,%sil
+  801257:	76 dd                	jbe    801236 <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  801259:	8d 70 9f             	lea    -0x61(%rax),%esi
+  80125c:	40 80 fe 19          	cmp    $0x19,%sil
+  801260:	77 08                	ja     80126a <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  801262:	0f be c0             	movsbl %al,%eax
+  801265:	83 e8 57             	sub    $0x57,%eax
+  801268:	eb d2                	jmp    80123c <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  80126a:	8d 70 bf             	lea    -0x41(%rax),%esi
+  80126d:	40 80 fe 19          	cmp    $0x19,%sil
+  801271:	77 08                	ja     80127b <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  801273:	0f be c0             	movsbl %al,%eax
+  801276:	83 e8 37             	sub    $0x37,%eax
+  801279:	eb c1                	jmp    80123c <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80127b:	4d 85 c0             	test   %r8,%r8
+  80127e:	74 03                	je     801283 <strtol+0xcd>
+		*endptr = (char *) s;
+  801280:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  801283:	48 89 d0             	mov    %rdx,%rax
+  801286:	48 f7 d8             	neg    %rax
+  801289:	45 85 c9             	test   %r9d,%r9d
+  80128c:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  801290:	48 89 d0             	mov    %rdx,%rax
+  801293:	c3                   	ret
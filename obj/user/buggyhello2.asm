@@ -0,0 +1,2252 @@
+
+obj/user/buggyhello2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 26 00 00 00       	call   800057 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+
+const char *hello = "hello, world\n";
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+	sys_cputs(hello, 1024*1024);
+  800037:	be 00 00 10 00       	mov    $0x100000,%esi
+  80003c:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  800043:	00 00 00 
+  800046:	48 8b 38             	mov    (%rax),%rdi
+  800049:	48 b8 9d 00 80 00 00 	movabs $0x80009d,%rax
+  800050:	00 00 00 
+  800053:	ff d0                	call   *%rax
+}
+  800055:	5d                   	pop    %rbp
+  800056:	c3                   	ret
+
+0000000000800057 <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  800057:	55                   	push   %rbp
+  800058:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80005b:	85 ff                	test   %edi,%edi
+  80005d:	7e 0d                	jle    80006c <libmain+0x15>
+		binaryname = argv[0];
+  80005f:	48 8b 06             	mov    (%rsi),%rax
+  800062:	48 a3 08 20 80 00 00 	movabs %rax,0x802008
+  800069:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  80006c:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  800073:	00 00 00 
+  800076:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800078:	48 b8 86 00 80 00 00 	movabs $0x800086,%rax
+  80007f:	00 00 00 
+  800082:	ff d0                	call   *%rax
+}
+  800084:	5d                   	pop    %rbp
+  800085:	c3                   	ret
+
+0000000000800086 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800086:	55                   	push   %rbp
+  800087:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  80008a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80008f:	48 b8 d5 00 80 00 00 	movabs $0x8000d5,%rax
+  800096:	00 00 00 
+  800099:	ff d0                	call   *%rax
+}
+  80009b:	5d                   	pop    %rbp
+  80009c:	c3                   	ret
+
+000000000080009d <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  80009d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  8000a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b3:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  8000b5:	c3                   	ret
+
+00000000008000b6 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  8000b6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8000c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000c7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000cc:	48 89 fe             	mov    %rdi,%rsi
+  8000cf:	48 89 fa             	mov    %rdi,%rdx
+  8000d2:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000d4:	c3                   	ret
+
+00000000008000d5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8000d5:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8000d8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8000e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8000e9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000ee:	48 89 f2             	mov    %rsi,%rdx
+  8000f1:	0f 05                	syscall
+	if(check && ret > 0)
+  8000f3:	48 85 c0             	test   %rax,%rax
+  8000f6:	7f 01                	jg     8000f9 <sys_env_destroy+0x24>
+}
+  8000f8:	c3                   	ret
+{
+  8000f9:	55                   	push   %rbp
+  8000fa:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8000fd:	49 89 c0             	mov    %rax,%r8
+  800100:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800105:	48 ba b8 12 80 00 00 	movabs $0x8012b8,%rdx
+  80010c:	00 00 00 
+  80010f:	be 28 00 00 00       	mov    $0x28,%esi
+  800114:	48 bf d5 12 80 00 00 	movabs $0x8012d5,%rdi
+  80011b:	00 00 00 
+  80011e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800123:	49 b9 58 05 80 00 00 	movabs $0x800558,%r9
+  80012a:	00 00 00 
+  80012d:	41 ff d1             	call   *%r9
+
+0000000000800130 <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800130:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800137:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800138:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80013d:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800141:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800145:	48 c1 e2 04          	shl    $0x4,%rdx
+  800149:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800150:	00 00 00 
+  800153:	48 01 d0             	add    %rdx,%rax
+  800156:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  80015c:	c3                   	ret
+
+000000000080015d <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  80015d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800163:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800169:	bf 00 00 00 00       	mov    $0x0,%edi
+  80016e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800173:	48 89 fe             	mov    %rdi,%rsi
+  800176:	48 89 fa             	mov    %rdi,%rdx
+  800179:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80017b:	c3                   	ret
+
+000000000080017c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  80017c:	48 63 d2             	movslq %edx,%rdx
+  80017f:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800182:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800188:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80018e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800193:	0f 05                	syscall
+	if(check && ret > 0)
+  800195:	48 85 c0             	test   %rax,%rax
+  800198:	7f 01                	jg     80019b <sys_page_alloc+0x1f>
+}
+  80019a:	c3                   	ret
+{
+  80019b:	55                   	push   %rbp
+  80019c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80019f:	49 89 c0             	mov    %rax,%r8
+  8001a2:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8001a7:	48 ba b8 12 80 00 00 	movabs $0x8012b8,%rdx
+  8001ae:	00 00 00 
+  8001b1:	be 28 00 00 00       	mov    $0x28,%esi
+  8001b6:	48 bf d5 12 80 00 00 	movabs $0x8012d5,%rdi
+  8001bd:	00 00 00 
+  8001c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c5:	49 b9 58 05 80 00 00 	movabs $0x800558,%r9
+  8001cc:	00 00 00 
+  8001cf:	41 ff d1             	call   *%r9
+
+00000000008001d2 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8001d2:	48 63 d2             	movslq %edx,%rdx
+  8001d5:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8001d8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8001de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8001e4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8001e9:	0f 05                	syscall
+	if(check && ret > 0)
+  8001eb:	48 85 c0             	test   %rax,%rax
+  8001ee:	7f 01                	jg     8001f1 <sys_page_alloc_huge+0x1f>
+}
+  8001f0:	c3                   	ret
+{
+  8001f1:	55                   	push   %rbp
+  8001f2:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001f5:	49 89 c0             	mov    %rax,%r8
+  8001f8:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8001fd:	48 ba b8 12 80 00 00 	movabs $0x8012b8,%rdx
+  800204:	00 00 00 
+  800207:	be 28 00 00 00       	mov    $0x28,%esi
+  80020c:	48 bf d5 12 80 00 00 	movabs $0x8012d5,%rdi
+  800213:	00 00 00 
+  800216:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021b:	49 b9 58 05 80 00 00 	movabs $0x800558,%r9
+  800222:	00 00 00 
+  800225:	41 ff d1             	call   *%r9
+
+0000000000800228 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800228:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  80022b:	48 63 d2             	movslq %edx,%rdx
+  80022e:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800231:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  800234:	b8 05 00 00 00       	mov    $0x5,%eax
+  800239:	0f 05                	syscall
+	if(check && ret > 0)
+  80023b:	48 85 c0             	test   %rax,%rax
+  80023e:	7f 01                	jg     800241 <sys_page_map+0x19>
+}
+  800240:	c3                   	ret
+{
+  800241:	55                   	push   %rbp
+  800242:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800245:	49 89 c0             	mov    %rax,%r8
+  800248:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80024d:	48 ba b8 12 80 00 00 	movabs $0x8012b8,%rdx
+  800254:	00 00 00 
+  800257:	be 28 00 00 00       	mov    $0x28,%esi
+  80025c:	48 bf d5 12 80 00 00 	movabs $0x8012d5,%rdi
+  800263:	00 00 00 
+  800266:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026b:	49 b9 58 05 80 00 00 	movabs $0x800558,%r9
+  800272:	00 00 00 
+  800275:	41 ff d1             	call   *%r9
+
+0000000000800278 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  800278:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80027b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800281:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800287:	ba 00 00 00 00       	mov    $0x0,%edx
+  80028c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800291:	0f 05                	syscall
+	if(check && ret > 0)
+  800293:	48 85 c0             	test   %rax,%rax
+  800296:	7f 01                	jg     800299 <sys_page_unmap+0x21>
+}
+  800298:	c3                   	ret
+{
+  800299:	55                   	push   %rbp
+  80029a:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80029d:	49 89 c0             	mov    %rax,%r8
+  8002a0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8002a5:	48 ba b8 12 80 00 00 	movabs $0x8012b8,%rdx
+  8002ac:	00 00 00 
+  8002af:	be 28 00 00 00       	mov    $0x28,%esi
+  8002b4:	48 bf d5 12 80 00 00 	movabs $0x8012d5,%rdi
+  8002bb:	00 00 00 
+  8002be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c3:	49 b9 58 05 80 00 00 	movabs $0x800558,%r9
+  8002ca:	00 00 00 
+  8002cd:	41 ff d1             	call   *%r9
+
+00000000008002d0 <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  8002d0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002e1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8002e6:	48 89 fe             	mov    %rdi,%rsi
+  8002e9:	48 89 fa             	mov    %rdi,%rdx
+  8002ec:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8002ee:	c3                   	ret
+
+00000000008002ef <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  8002ef:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800300:	b8 10 00 00 00       	mov    $0x10,%eax
+  800305:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  800307:	c3                   	ret
+
+0000000000800308 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  800308:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80030e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800314:	b8 11 00 00 00       	mov    $0x11,%eax
+  800319:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  80031b:	c3                   	ret
+
+000000000080031c <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  80031c:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  80031f:	48 63 f6             	movslq %esi,%rsi
+  800322:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800325:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80032b:	b8 12 00 00 00       	mov    $0x12,%eax
+  800330:	0f 05                	syscall
+	if(check && ret > 0)
+  800332:	48 85 c0             	test   %rax,%rax
+  800335:	7f 01                	jg     800338 <sys_page_batch+0x1c>
+}
+  800337:	c3                   	ret
+{
+  800338:	55                   	push   %rbp
+  800339:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80033c:	49 89 c0             	mov    %rax,%r8
+  80033f:	b9 12 00 00 00       	mov    $0x12,%ecx
+  800344:	48 ba b8 12 80 00 00 	movabs $0x8012b8,%rdx
+  80034b:	00 00 00 
+  80034e:	be 28 00 00 00       	mov    $0x28,%esi
+  800353:	48 bf d5 12 80 00 00 	movabs $0x8012d5,%rdi
+  80035a:	00 00 00 
+  80035d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800362:	49 b9 58 05 80 00 00 	movabs $0x800558,%r9
+  800369:	00 00 00 
+  80036c:	41 ff d1             	call   *%r9
+
+000000000080036f <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  80036f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800375:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80037b:	be 00 00 00 00       	mov    $0x0,%esi
+  800380:	b8 13 00 00 00       	mov    $0x13,%eax
+  800385:	48 89 f2             	mov    %rsi,%rdx
+  800388:	0f 05                	syscall
+	if(check && ret > 0)
+  80038a:	48 85 c0             	test   %rax,%rax
+  80038d:	7f 01                	jg     800390 <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  80038f:	c3                   	ret
+{
+  800390:	55                   	push   %rbp
+  800391:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800394:	49 89 c0             	mov    %rax,%r8
+  800397:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80039c:	48 ba b8 12 80 00 00 	movabs $0x8012b8,%rdx
+  8003a3:	00 00 00 
+  8003a6:	be 28 00 00 00       	mov    $0x28,%esi
+  8003ab:	48 bf d5 12 80 00 00 	movabs $0x8012d5,%rdi
+  8003b2:	00 00 00 
+  8003b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ba:	49 b9 58 05 80 00 00 	movabs $0x800558,%r9
+  8003c1:	00 00 00 
+  8003c4:	41 ff d1             	call   *%r9
+
+00000000008003c7 <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  8003c7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8003cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8003d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003d8:	b8 14 00 00 00       	mov    $0x14,%eax
+  8003dd:	48 89 fe             	mov    %rdi,%rsi
+  8003e0:	48 89 fa             	mov    %rdi,%rdx
+  8003e3:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8003e5:	c3                   	ret
+
+00000000008003e6 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  8003e6:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8003e9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8003ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8003f5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8003fa:	0f 05                	syscall
+	if(check && ret > 0)
+  8003fc:	48 85 c0             	test   %rax,%rax
+  8003ff:	7f 01                	jg     800402 <sys_page_unmap_range+0x1c>
+}
+  800401:	c3                   	ret
+{
+  800402:	55                   	push   %rbp
+  800403:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800406:	49 89 c0             	mov    %rax,%r8
+  800409:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80040e:	48 ba b8 12 80 00 00 	movabs $0x8012b8,%rdx
+  800415:	00 00 00 
+  800418:	be 28 00 00 00       	mov    $0x28,%esi
+  80041d:	48 bf d5 12 80 00 00 	movabs $0x8012d5,%rdi
+  800424:	00 00 00 
+  800427:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042c:	49 b9 58 05 80 00 00 	movabs $0x800558,%r9
+  800433:	00 00 00 
+  800436:	41 ff d1             	call   *%r9
+
+0000000000800439 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  800439:	48 63 f6             	movslq %esi,%rsi
+  80043c:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80043f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800445:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80044b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800450:	b8 08 00 00 00       	mov    $0x8,%eax
+  800455:	0f 05                	syscall
+	if(check && ret > 0)
+  800457:	48 85 c0             	test   %rax,%rax
+  80045a:	7f 01                	jg     80045d <sys_env_set_status+0x24>
+}
+  80045c:	c3                   	ret
+{
+  80045d:	55                   	push   %rbp
+  80045e:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800461:	49 89 c0             	mov    %rax,%r8
+  800464:	b9 08 00 00 00       	mov    $0x8,%ecx
+  800469:	48 ba b8 12 80 00 00 	movabs $0x8012b8,%rdx
+  800470:	00 00 00 
+  800473:	be 28 00 00 00       	mov    $0x28,%esi
+  800478:	48 bf d5 12 80 00 00 	movabs $0x8012d5,%rdi
+  80047f:	00 00 00 
+  800482:	b8 00 00 00 00       	mov    $0x0,%eax
+  800487:	49 b9 58 05 80 00 00 	movabs $0x800558,%r9
+  80048e:	00 00 00 
+  800491:	41 ff d1             	call   *%r9
+
+0000000000800494 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  800494:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800497:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80049d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8004a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004a8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8004ad:	0f 05                	syscall
+	if(check && ret > 0)
+  8004af:	48 85 c0             	test   %rax,%rax
+  8004b2:	7f 01                	jg     8004b5 <sys_env_set_pgfault_upcall+0x21>
+}
+  8004b4:	c3                   	ret
+{
+  8004b5:	55                   	push   %rbp
+  8004b6:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004b9:	49 89 c0             	mov    %rax,%r8
+  8004bc:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004c1:	48 ba b8 12 80 00 00 	movabs $0x8012b8,%rdx
+  8004c8:	00 00 00 
+  8004cb:	be 28 00 00 00       	mov    $0x28,%esi
+  8004d0:	48 bf d5 12 80 00 00 	movabs $0x8012d5,%rdi
+  8004d7:	00 00 00 
+  8004da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004df:	49 b9 58 05 80 00 00 	movabs $0x800558,%r9
+  8004e6:	00 00 00 
+  8004e9:	41 ff d1             	call   *%r9
+
+00000000008004ec <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8004ec:	48 63 ff             	movslq %edi,%rdi
+  8004ef:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  8004f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8004f8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8004fd:	0f 05                	syscall
+}
+  8004ff:	c3                   	ret
+
+0000000000800500 <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  800500:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800506:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80050c:	be 00 00 00 00       	mov    $0x0,%esi
+  800511:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800516:	48 89 f2             	mov    %rsi,%rdx
+  800519:	0f 05                	syscall
+	if(check && ret > 0)
+  80051b:	48 85 c0             	test   %rax,%rax
+  80051e:	7f 01                	jg     800521 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  800520:	c3                   	ret
+{
+  800521:	55                   	push   %rbp
+  800522:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800525:	49 89 c0             	mov    %rax,%r8
+  800528:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80052d:	48 ba b8 12 80 00 00 	movabs $0x8012b8,%rdx
+  800534:	00 00 00 
+  800537:	be 28 00 00 00       	mov    $0x28,%esi
+  80053c:	48 bf d5 12 80 00 00 	movabs $0x8012d5,%rdi
+  800543:	00 00 00 
+  800546:	b8 00 00 00 00       	mov    $0x0,%eax
+  80054b:	49 b9 58 05 80 00 00 	movabs $0x800558,%r9
+  800552:	00 00 00 
+  800555:	41 ff d1             	call   *%r9
+
+0000000000800558 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800558:	55                   	push   %rbp
+  800559:	48 89 e5             	mov    %rsp,%rbp
+  80055c:	41 56                	push   %r14
+  80055e:	41 55                	push   %r13
+  800560:	41 54                	push   %r12
+  800562:	53                   	push   %rbx
+  800563:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80056a:	49 89 fc             	mov    %rdi,%r12
+  80056d:	41 89 f5             	mov    %esi,%r13d
+  800570:	48 89 d3             	mov    %rdx,%rbx
+  800573:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80057a:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800581:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800588:	84 c0                	test   %al,%al
+  80058a:	74 26                	je     8005b2 <_panic+0x5a>
+  80058c:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800593:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80059a:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  80059e:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8005a2:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8005a6:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8005aa:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8005ae:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8005b2:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8005b9:	00 00 00 
+  8005bc:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8005c3:	00 00 00 
+  8005c6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005ca:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8005d1:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8005d8:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005df:	48 b8 08 20 80 00 00 	movabs $0x802008,%rax
+  8005e6:	00 00 00 
+  8005e9:	4c 8b 30             	mov    (%rax),%r14
+  8005ec:	48 b8 30 01 80 00 00 	movabs $0x800130,%rax
+  8005f3:	00 00 00 
+  8005f6:	ff d0                	call   *%rax
+  8005f8:	89 c6                	mov    %eax,%esi
+  8005fa:	45 89 e8             	mov    %r13d,%r8d
+  8005fd:	4c 89 e1             	mov    %r12,%rcx
+  800600:	4c 89 f2             	mov    %r14,%rdx
+  800603:	48 bf e8 12 80 00 00 	movabs $0x8012e8,%rdi
+  80060a:	00 00 00 
+  80060d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800612:	49 bc f7 06 80 00 00 	movabs $0x8006f7,%r12
+  800619:	00 00 00 
+  80061c:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80061f:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  800626:	48 89 df             	mov    %rbx,%rdi
+  800629:	48 b8 93 06 80 00 00 	movabs $0x800693,%rax
+  800630:	00 00 00 
+  800633:	ff d0                	call   *%rax
+	cprintf("\n");
+  800635:	48 bf ac 12 80 00 00 	movabs $0x8012ac,%rdi
+  80063c:	00 00 00 
+  80063f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800644:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800647:	cc                   	int3
+	while (1)
+  800648:	eb fd                	jmp    800647 <_panic+0xef>
+
+000000000080064a <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80064a:	55                   	push   %rbp
+  80064b:	48 89 e5             	mov    %rsp,%rbp
+  80064e:	53                   	push   %rbx
+  80064f:	48 83 ec 08          	sub    $0x8,%rsp
+  800653:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  800656:	8b 06                	mov    (%rsi),%eax
+  800658:	8d 50 01             	lea    0x1(%rax),%edx
+  80065b:	89 16                	mov    %edx,(%rsi)
+  80065d:	48 98                	cltq
+  80065f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  800664:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80066a:	74 0a                	je     800676 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80066c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800670:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800674:	c9                   	leave
+  800675:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800676:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80067a:	be ff 00 00 00       	mov    $0xff,%esi
+  80067f:	48 b8 9d 00 80 00 00 	movabs $0x80009d,%rax
+  800686:	00 00 00 
+  800689:	ff d0                	call   *%rax
+		b->idx = 0;
+  80068b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800691:	eb d9                	jmp    80066c <putch+0x22>
+
+0000000000800693 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800693:	55                   	push   %rbp
+  800694:	48 89 e5             	mov    %rsp,%rbp
+  800697:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80069e:	48 89 fa             	mov    %rdi,%rdx
+  8006a1:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  8006a4:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8006ab:	00 00 00 
+	b.cnt = 0;
+  8006ae:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8006b5:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8006b8:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  8006bf:	48 bf 4a 06 80 00 00 	movabs $0x80064a,%rdi
+  8006c6:	00 00 00 
+  8006c9:	48 b8 b1 08 80 00 00 	movabs $0x8008b1,%rax
+  8006d0:	00 00 00 
+  8006d3:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8006d5:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  8006dc:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8006e3:	48 b8 9d 00 80 00 00 	movabs $0x80009d,%rax
+  8006ea:	00 00 00 
+  8006ed:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  8006ef:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  8006f5:	c9                   	leave
+  8006f6:	c3                   	ret
+
+00000000008006f7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8006f7:	55                   	push   %rbp
+  8006f8:	48 89 e5             	mov    %rsp,%rbp
+  8006fb:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800702:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800709:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800710:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800717:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80071e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800725:	84 c0                	test   %al,%al
+  800727:	74 20                	je     800749 <cprintf+0x52>
+  800729:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80072d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800731:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800735:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800739:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80073d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800741:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800745:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800749:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  800750:	00 00 00 
+  800753:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80075a:	00 00 00 
+  80075d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800761:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800768:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80076f:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  800776:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  80077d:	48 b8 93 06 80 00 00 	movabs $0x800693,%rax
+  800784:	00 00 00 
+  800787:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  800789:	c9                   	leave
+  80078a:	c3                   	ret
+
+000000000080078b <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80078b:	55                   	push   %rbp
+  80078c:	48 89 e5             	mov    %rsp,%rbp
+  80078f:	41 57                	push   %r15
+  800791:	41 56                	push   %r14
+  800793:	41 55                	push   %r13
+  800795:	41 54                	push   %r12
+  800797:	53                   	push   %rbx
+  800798:	48 83 ec 18          	sub    $0x18,%rsp
+  80079c:	49 89 fc             	mov    %rdi,%r12
+  80079f:	49 89 f5             	mov    %rsi,%r13
+  8007a2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8007a6:	44 89 c3             	mov    %r8d,%ebx
+  8007a9:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8007ac:	41 89 cf             	mov    %ecx,%r15d
+  8007af:	4c 39 fa             	cmp    %r15,%rdx
+  8007b2:	72 29                	jb     8007dd <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8007b4:	48 89 d0             	mov    %rdx,%rax
+  8007b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007bc:	49 f7 f7             	div    %r15
+  8007bf:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8007c3:	48 89 c2             	mov    %rax,%rdx
+  8007c6:	48 b8 8b 07 80 00 00 	movabs $0x80078b,%rax
+  8007cd:	00 00 00 
+  8007d0:	ff d0                	call   *%rax
+  8007d2:	eb 10                	jmp    8007e4 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8007d4:	4c 89 ee             	mov    %r13,%rsi
+  8007d7:	44 89 f7             	mov    %r14d,%edi
+  8007da:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  8007dd:	83 eb 01             	sub    $0x1,%ebx
+  8007e0:	85 db                	test   %ebx,%ebx
+  8007e2:	7f f0                	jg     8007d4 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007ed:	49 f7 f7             	div    %r15
+  8007f0:	48 b8 0b 13 80 00 00 	movabs $0x80130b,%rax
+  8007f7:	00 00 00 
+  8007fa:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  8007fe:	4c 89 ee             	mov    %r13,%rsi
+  800801:	41 ff d4             	call   *%r12
+}
+  800804:	48 83 c4 18          	add    $0x18,%rsp
+  800808:	5b                   	pop    %rbx
+  800809:	41 5c                	pop    %r12
+  80080b:	41 5d                	pop    %r13
+  80080d:	41 5e                	pop    %r14
+  80080f:	41 5f                	pop    %r15
+  800811:	5d                   	pop    %rbp
+  800812:	c3                   	ret
+
+0000000000800813 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  800813:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  800817:	48 8b 06             	mov    (%rsi),%rax
+  80081a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80081e:	73 0a                	jae    80082a <sprintputch+0x17>
+		*b->buf++ = ch;
+  800820:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800824:	48 89 16             	mov    %rdx,(%rsi)
+  800827:	40 88 38             	mov    %dil,(%rax)
+}
+  80082a:	c3                   	ret
+
+000000000080082b <printfmt>:
+{
+  80082b:	55                   	push   %rbp
+  80082c:	48 89 e5             	mov    %rsp,%rbp
+  80082f:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800836:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80083d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800844:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80084b:	84 c0                	test   %al,%al
+  80084d:	74 20                	je     80086f <printfmt+0x44>
+  80084f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800853:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800857:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80085b:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80085f:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800863:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800867:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80086b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  80086f:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800876:	00 00 00 
+  800879:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800880:	00 00 00 
+  800883:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800887:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80088e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800895:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80089c:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8008a3:	48 b8 b1 08 80 00 00 	movabs $0x8008b1,%rax
+  8008aa:	00 00 00 
+  8008ad:	ff d0                	call   *%rax
+}
+  8008af:	c9                   	leave
+  8008b0:	c3                   	ret
+
+00000000008008b1 <vprintfmt>:
+{
+  8008b1:	55                   	push   %rbp
+  8008b2:	48 89 e5             	mov    %rsp,%rbp
+  8008b5:	41 57                	push   %r15
+  8008b7:	41 56                	push   %r14
+  8008b9:	41 55                	push   %r13
+  8008bb:	41 54                	push   %r12
+  8008bd:	53                   	push   %rbx
+  8008be:	48 83 ec 48          	sub    $0x48,%rsp
+  8008c2:	49 89 fe             	mov    %rdi,%r14
+  8008c5:	49 89 f5             	mov    %rsi,%r13
+  8008c8:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  8008cb:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  8008cf:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  8008d3:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8008d7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8008db:	eb 09                	jmp    8008e6 <vprintfmt+0x35>
+			putch(ch, putdat);
+  8008dd:	4c 89 ee             	mov    %r13,%rsi
+  8008e0:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008e3:	4c 89 e3             	mov    %r12,%rbx
+  8008e6:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8008ea:	0f b6 3b             	movzbl (%rbx),%edi
+  8008ed:	83 ff 25             	cmp    $0x25,%edi
+  8008f0:	74 13                	je     800905 <vprintfmt+0x54>
+			if (ch == '\0')
+  8008f2:	85 ff                	test   %edi,%edi
+  8008f4:	75 e7                	jne    8008dd <vprintfmt+0x2c>
+}
+  8008f6:	48 83 c4 48          	add    $0x48,%rsp
+  8008fa:	5b                   	pop    %rbx
+  8008fb:	41 5c                	pop    %r12
+  8008fd:	41 5d                	pop    %r13
+  8008ff:	41 5e                	pop    %r14
+  800901:	41 5f                	pop    %r15
+  800903:	5d                   	pop    %rbp
+  800904:	c3                   	ret
+		padc = ' ';
+  800905:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  800909:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  800910:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  800916:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  80091d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800922:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800927:	41 0f b6 14 24       	movzbl (%r12),%edx
+  80092c:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  80092f:	3c 55                	cmp    $0x55,%al
+  800931:	0f 87 4f 05 00 00    	ja     800e86 <vprintfmt+0x5d5>
+  800937:	0f b6 c0             	movzbl %al,%eax
+  80093a:	48 be e0 13 80 00 00 	movabs $0x8013e0,%rsi
+  800941:	00 00 00 
+  800944:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  800947:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  80094a:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  80094e:	eb d2                	jmp    800922 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800950:	49 89 dc             	mov    %rbx,%r12
+  800953:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  800957:	eb c9                	jmp    800922 <vprintfmt+0x71>
+  800959:	0f b6 d2             	movzbl %dl,%edx
+  80095c:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  80095f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  800965:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800969:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  80096e:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  800973:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  800976:	83 f8 09             	cmp    $0x9,%eax
+  800979:	77 20                	ja     80099b <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  80097b:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  80097f:	eb e4                	jmp    800965 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  800981:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800984:	83 f8 2f             	cmp    $0x2f,%eax
+  800987:	77 27                	ja     8009b0 <vprintfmt+0xff>
+  800989:	89 c2                	mov    %eax,%edx
+  80098b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098f:	83 c0 08             	add    $0x8,%eax
+  800992:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800995:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  800998:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  80099b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80099f:	79 81                	jns    800922 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  8009a1:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  8009a5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8009ab:	e9 72 ff ff ff       	jmp    800922 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  8009b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bc:	eb d7                	jmp    800995 <vprintfmt+0xe4>
+			if (width < 0)
+  8009be:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  8009c1:	85 f6                	test   %esi,%esi
+  8009c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c8:	0f 49 c6             	cmovns %esi,%eax
+  8009cb:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8009ce:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8009d1:	e9 4c ff ff ff       	jmp    800922 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8009d6:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  8009d9:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  8009e0:	e9 3d ff ff ff       	jmp    800922 <vprintfmt+0x71>
+			lflag++;
+  8009e5:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8009e8:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8009eb:	e9 32 ff ff ff       	jmp    800922 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  8009f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f6:	77 19                	ja     800a11 <vprintfmt+0x160>
+  8009f8:	89 c2                	mov    %eax,%edx
+  8009fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fe:	83 c0 08             	add    $0x8,%eax
+  800a01:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a04:	8b 3a                	mov    (%rdx),%edi
+  800a06:	4c 89 ee             	mov    %r13,%rsi
+  800a09:	41 ff d6             	call   *%r14
+			break;
+  800a0c:	e9 d5 fe ff ff       	jmp    8008e6 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  800a11:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a15:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a19:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1d:	eb e5                	jmp    800a04 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  800a1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a22:	83 f8 2f             	cmp    $0x2f,%eax
+  800a25:	77 5a                	ja     800a81 <vprintfmt+0x1d0>
+  800a27:	89 c2                	mov    %eax,%edx
+  800a29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a2d:	83 c0 08             	add    $0x8,%eax
+  800a30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800a33:	8b 02                	mov    (%rdx),%eax
+  800a35:	89 c1                	mov    %eax,%ecx
+  800a37:	f7 d9                	neg    %ecx
+  800a39:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a3c:	83 f9 08             	cmp    $0x8,%ecx
+  800a3f:	7f 4e                	jg     800a8f <vprintfmt+0x1de>
+  800a41:	48 63 c1             	movslq %ecx,%rax
+  800a44:	48 ba a0 16 80 00 00 	movabs $0x8016a0,%rdx
+  800a4b:	00 00 00 
+  800a4e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800a52:	48 85 c0             	test   %rax,%rax
+  800a55:	74 38                	je     800a8f <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800a57:	48 89 c1             	mov    %rax,%rcx
+  800a5a:	48 ba 2c 13 80 00 00 	movabs $0x80132c,%rdx
+  800a61:	00 00 00 
+  800a64:	4c 89 ee             	mov    %r13,%rsi
+  800a67:	4c 89 f7             	mov    %r14,%rdi
+  800a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6f:	49 b8 2b 08 80 00 00 	movabs $0x80082b,%r8
+  800a76:	00 00 00 
+  800a79:	41 ff d0             	call   *%r8
+  800a7c:	e9 65 fe ff ff       	jmp    8008e6 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  800a81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8d:	eb a4                	jmp    800a33 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  800a8f:	48 ba 23 13 80 00 00 	movabs $0x801323,%rdx
+  800a96:	00 00 00 
+  800a99:	4c 89 ee             	mov    %r13,%rsi
+  800a9c:	4c 89 f7             	mov    %r14,%rdi
+  800a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa4:	49 b8 2b 08 80 00 00 	movabs $0x80082b,%r8
+  800aab:	00 00 00 
+  800aae:	41 ff d0             	call   *%r8
+  800ab1:	e9 30 fe ff ff       	jmp    8008e6 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800ab6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab9:	83 f8 2f             	cmp    $0x2f,%eax
+  800abc:	77 36                	ja     800af4 <vprintfmt+0x243>
+  800abe:	89 c2                	mov    %eax,%edx
+  800ac0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac4:	83 c0 08             	add    $0x8,%eax
+  800ac7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aca:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800acd:	48 85 c9             	test   %rcx,%rcx
+  800ad0:	48 b8 1c 13 80 00 00 	movabs $0x80131c,%rax
+  800ad7:	00 00 00 
+  800ada:	48 0f 45 c1          	cmovne %rcx,%rax
+  800ade:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800ae2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800ae6:	7e 06                	jle    800aee <vprintfmt+0x23d>
+  800ae8:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800aec:	75 14                	jne    800b02 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800aee:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800af2:	eb 64                	jmp    800b58 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800af4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800afc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b00:	eb c8                	jmp    800aca <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b02:	49 63 f7             	movslq %r15d,%rsi
+  800b05:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800b09:	48 b8 94 0f 80 00 00 	movabs $0x800f94,%rax
+  800b10:	00 00 00 
+  800b13:	ff d0                	call   *%rax
+  800b15:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800b18:	29 c1                	sub    %eax,%ecx
+  800b1a:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800b1d:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  800b20:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800b24:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b27:	eb 0d                	jmp    800b36 <vprintfmt+0x285>
+					putch(padc, putdat);
+  800b29:	4c 89 ee             	mov    %r13,%rsi
+  800b2c:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  800b2f:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b32:	41 83 ec 01          	sub    $0x1,%r12d
+  800b36:	45 85 e4             	test   %r12d,%r12d
+  800b39:	7f ee                	jg     800b29 <vprintfmt+0x278>
+  800b3b:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  800b3e:	85 c9                	test   %ecx,%ecx
+  800b40:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b45:	0f 49 c1             	cmovns %ecx,%eax
+  800b48:	29 c1                	sub    %eax,%ecx
+  800b4a:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  800b4d:	eb 9f                	jmp    800aee <vprintfmt+0x23d>
+					putch(ch, putdat);
+  800b4f:	4c 89 ee             	mov    %r13,%rsi
+  800b52:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b55:	4c 89 e2             	mov    %r12,%rdx
+  800b58:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800b5c:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800b62:	0f be f8             	movsbl %al,%edi
+  800b65:	85 ff                	test   %edi,%edi
+  800b67:	74 29                	je     800b92 <vprintfmt+0x2e1>
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	78 06                	js     800b74 <vprintfmt+0x2c3>
+  800b6e:	41 83 ef 01          	sub    $0x1,%r15d
+  800b72:	78 1e                	js     800b92 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b74:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800b78:	74 d5                	je     800b4f <vprintfmt+0x29e>
+  800b7a:	0f be c0             	movsbl %al,%eax
+  800b7d:	83 e8 20             	sub    $0x20,%eax
+  800b80:	83 f8 5e             	cmp    $0x5e,%eax
+  800b83:	76 ca                	jbe    800b4f <vprintfmt+0x29e>
+					putch('?', putdat);
+  800b85:	4c 89 ee             	mov    %r13,%rsi
+  800b88:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b8d:	41 ff d6             	call   *%r14
+  800b90:	eb c3                	jmp    800b55 <vprintfmt+0x2a4>
+  800b92:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800b96:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800b99:	41 01 c4             	add    %eax,%r12d
+  800b9c:	41 29 d4             	sub    %edx,%r12d
+  800b9f:	eb 0f                	jmp    800bb0 <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  800ba1:	4c 89 ee             	mov    %r13,%rsi
+  800ba4:	bf 20 00 00 00       	mov    $0x20,%edi
+  800ba9:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800bac:	41 83 ec 01          	sub    $0x1,%r12d
+  800bb0:	45 85 e4             	test   %r12d,%r12d
+  800bb3:	7f ec                	jg     800ba1 <vprintfmt+0x2f0>
+  800bb5:	e9 2c fd ff ff       	jmp    8008e6 <vprintfmt+0x35>
+	if (lflag >= 2)
+  800bba:	83 f9 01             	cmp    $0x1,%ecx
+  800bbd:	7f 1d                	jg     800bdc <vprintfmt+0x32b>
+	else if (lflag)
+  800bbf:	85 c9                	test   %ecx,%ecx
+  800bc1:	74 5e                	je     800c21 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800bc3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc6:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc9:	77 48                	ja     800c13 <vprintfmt+0x362>
+  800bcb:	89 c2                	mov    %eax,%edx
+  800bcd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd1:	83 c0 08             	add    $0x8,%eax
+  800bd4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd7:	4c 8b 22             	mov    (%rdx),%r12
+  800bda:	eb 17                	jmp    800bf3 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800bdc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bdf:	83 f8 2f             	cmp    $0x2f,%eax
+  800be2:	77 21                	ja     800c05 <vprintfmt+0x354>
+  800be4:	89 c2                	mov    %eax,%edx
+  800be6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bea:	83 c0 08             	add    $0x8,%eax
+  800bed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf0:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800bf3:	4d 85 e4             	test   %r12,%r12
+  800bf6:	78 50                	js     800c48 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  800bf8:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800bfb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800c00:	e9 b4 01 00 00       	jmp    800db9 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800c05:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c09:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c11:	eb dd                	jmp    800bf0 <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800c13:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c17:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c1f:	eb b6                	jmp    800bd7 <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800c21:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c24:	83 f8 2f             	cmp    $0x2f,%eax
+  800c27:	77 11                	ja     800c3a <vprintfmt+0x389>
+  800c29:	89 c2                	mov    %eax,%edx
+  800c2b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c2f:	83 c0 08             	add    $0x8,%eax
+  800c32:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c35:	4c 63 22             	movslq (%rdx),%r12
+  800c38:	eb b9                	jmp    800bf3 <vprintfmt+0x342>
+  800c3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c3e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c46:	eb ed                	jmp    800c35 <vprintfmt+0x384>
+				putch('-', putdat);
+  800c48:	4c 89 ee             	mov    %r13,%rsi
+  800c4b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c50:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800c53:	4c 89 e2             	mov    %r12,%rdx
+  800c56:	48 f7 da             	neg    %rdx
+			base = 10;
+  800c59:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800c5e:	e9 56 01 00 00       	jmp    800db9 <vprintfmt+0x508>
+	if (lflag >= 2)
+  800c63:	83 f9 01             	cmp    $0x1,%ecx
+  800c66:	7f 25                	jg     800c8d <vprintfmt+0x3dc>
+	else if (lflag)
+  800c68:	85 c9                	test   %ecx,%ecx
+  800c6a:	74 5e                	je     800cca <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800c6c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c6f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c72:	77 48                	ja     800cbc <vprintfmt+0x40b>
+  800c74:	89 c2                	mov    %eax,%edx
+  800c76:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c7a:	83 c0 08             	add    $0x8,%eax
+  800c7d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c80:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800c83:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800c88:	e9 2c 01 00 00       	jmp    800db9 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800c8d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c90:	83 f8 2f             	cmp    $0x2f,%eax
+  800c93:	77 19                	ja     800cae <vprintfmt+0x3fd>
+  800c95:	89 c2                	mov    %eax,%edx
+  800c97:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c9b:	83 c0 08             	add    $0x8,%eax
+  800c9e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ca1:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800ca4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800ca9:	e9 0b 01 00 00       	jmp    800db9 <vprintfmt+0x508>
+  800cae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cb2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cb6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cba:	eb e5                	jmp    800ca1 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800cbc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc8:	eb b6                	jmp    800c80 <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800cca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ccd:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd0:	77 18                	ja     800cea <vprintfmt+0x439>
+  800cd2:	89 c2                	mov    %eax,%edx
+  800cd4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cd8:	83 c0 08             	add    $0x8,%eax
+  800cdb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cde:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800ce0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800ce5:	e9 cf 00 00 00       	jmp    800db9 <vprintfmt+0x508>
+  800cea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cf2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf6:	eb e6                	jmp    800cde <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800cf8:	83 f9 01             	cmp    $0x1,%ecx
+  800cfb:	7f 25                	jg     800d22 <vprintfmt+0x471>
+	else if (lflag)
+  800cfd:	85 c9                	test   %ecx,%ecx
+  800cff:	74 5b                	je     800d5c <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800d01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d04:	83 f8 2f             	cmp    $0x2f,%eax
+  800d07:	77 45                	ja     800d4e <vprintfmt+0x49d>
+  800d09:	89 c2                	mov    %eax,%edx
+  800d0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d0f:	83 c0 08             	add    $0x8,%eax
+  800d12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d15:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800d18:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800d1d:	e9 97 00 00 00       	jmp    800db9 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800d22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d25:	83 f8 2f             	cmp    $0x2f,%eax
+  800d28:	77 16                	ja     800d40 <vprintfmt+0x48f>
+  800d2a:	89 c2                	mov    %eax,%edx
+  800d2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d30:	83 c0 08             	add    $0x8,%eax
+  800d33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d36:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800d39:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800d3e:	eb 79                	jmp    800db9 <vprintfmt+0x508>
+  800d40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d4c:	eb e8                	jmp    800d36 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800d4e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d52:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d5a:	eb b9                	jmp    800d15 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800d5c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d62:	77 15                	ja     800d79 <vprintfmt+0x4c8>
+  800d64:	89 c2                	mov    %eax,%edx
+  800d66:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d6a:	83 c0 08             	add    $0x8,%eax
+  800d6d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d70:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800d72:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800d77:	eb 40                	jmp    800db9 <vprintfmt+0x508>
+  800d79:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d7d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d85:	eb e9                	jmp    800d70 <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800d87:	4c 89 ee             	mov    %r13,%rsi
+  800d8a:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d8f:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800d92:	4c 89 ee             	mov    %r13,%rsi
+  800d95:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d9a:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800d9d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800da0:	83 f8 2f             	cmp    $0x2f,%eax
+  800da3:	77 34                	ja     800dd9 <vprintfmt+0x528>
+  800da5:	89 c2                	mov    %eax,%edx
+  800da7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dab:	83 c0 08             	add    $0x8,%eax
+  800dae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800db1:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800db4:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800db9:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800dbe:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800dc2:	4c 89 ee             	mov    %r13,%rsi
+  800dc5:	4c 89 f7             	mov    %r14,%rdi
+  800dc8:	48 b8 8b 07 80 00 00 	movabs $0x80078b,%rax
+  800dcf:	00 00 00 
+  800dd2:	ff d0                	call   *%rax
+			break;
+  800dd4:	e9 0d fb ff ff       	jmp    8008e6 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800dd9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ddd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800de1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800de5:	eb ca                	jmp    800db1 <vprintfmt+0x500>
+	if (lflag >= 2)
+  800de7:	83 f9 01             	cmp    $0x1,%ecx
+  800dea:	7f 22                	jg     800e0e <vprintfmt+0x55d>
+	else if (lflag)
+  800dec:	85 c9                	test   %ecx,%ecx
+  800dee:	74 58                	je     800e48 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800df0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800df3:	83 f8 2f             	cmp    $0x2f,%eax
+  800df6:	77 42                	ja     800e3a <vprintfmt+0x589>
+  800df8:	89 c2                	mov    %eax,%edx
+  800dfa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dfe:	83 c0 08             	add    $0x8,%eax
+  800e01:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e04:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800e07:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800e0c:	eb ab                	jmp    800db9 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800e0e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e11:	83 f8 2f             	cmp    $0x2f,%eax
+  800e14:	77 16                	ja     800e2c <vprintfmt+0x57b>
+  800e16:	89 c2                	mov    %eax,%edx
+  800e18:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e1c:	83 c0 08             	add    $0x8,%eax
+  800e1f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e22:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800e25:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800e2a:	eb 8d                	jmp    800db9 <vprintfmt+0x508>
+  800e2c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e30:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e34:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e38:	eb e8                	jmp    800e22 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800e3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e3e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e46:	eb bc                	jmp    800e04 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800e48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e4b:	83 f8 2f             	cmp    $0x2f,%eax
+  800e4e:	77 18                	ja     800e68 <vprintfmt+0x5b7>
+  800e50:	89 c2                	mov    %eax,%edx
+  800e52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e56:	83 c0 08             	add    $0x8,%eax
+  800e59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e5c:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800e5e:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800e63:	e9 51 ff ff ff       	jmp    800db9 <vprintfmt+0x508>
+  800e68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e74:	eb e6                	jmp    800e5c <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800e76:	4c 89 ee             	mov    %r13,%rsi
+  800e79:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e7e:	41 ff d6             	call   *%r14
+			break;
+  800e81:	e9 60 fa ff ff       	jmp    8008e6 <vprintfmt+0x35>
+			putch('%', putdat);
+  800e86:	4c 89 ee             	mov    %r13,%rsi
+  800e89:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e8e:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800e91:	4c 89 e3             	mov    %r12,%rbx
+  800e94:	eb 04                	jmp    800e9a <vprintfmt+0x5e9>
+  800e96:	48 83 eb 01          	sub    $0x1,%rbx
+  800e9a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e9e:	75 f6                	jne    800e96 <vprintfmt+0x5e5>
+  800ea0:	e9 41 fa ff ff       	jmp    8008e6 <vprintfmt+0x35>
+
+0000000000800ea5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800ea5:	55                   	push   %rbp
+  800ea6:	48 89 e5             	mov    %rsp,%rbp
+  800ea9:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800ead:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800eb1:	48 63 c6             	movslq %esi,%rax
+  800eb4:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800eb9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800ebd:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800ec4:	48 85 ff             	test   %rdi,%rdi
+  800ec7:	74 2a                	je     800ef3 <vsnprintf+0x4e>
+  800ec9:	85 f6                	test   %esi,%esi
+  800ecb:	7e 26                	jle    800ef3 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800ecd:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800ed1:	48 bf 13 08 80 00 00 	movabs $0x800813,%rdi
+  800ed8:	00 00 00 
+  800edb:	48 b8 b1 08 80 00 00 	movabs $0x8008b1,%rax
+  800ee2:	00 00 00 
+  800ee5:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ee7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800eeb:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800eee:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800ef1:	c9                   	leave
+  800ef2:	c3                   	ret
+		return -E_INVAL;
+  800ef3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ef8:	eb f7                	jmp    800ef1 <vsnprintf+0x4c>
+
+0000000000800efa <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800efa:	55                   	push   %rbp
+  800efb:	48 89 e5             	mov    %rsp,%rbp
+  800efe:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800f05:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f0c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f13:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f1a:	84 c0                	test   %al,%al
+  800f1c:	74 20                	je     800f3e <snprintf+0x44>
+  800f1e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f22:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f26:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f2a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f2e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f32:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f36:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f3a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800f3e:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f45:	00 00 00 
+  800f48:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f4f:	00 00 00 
+  800f52:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f56:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800f5d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f64:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800f6b:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800f72:	48 b8 a5 0e 80 00 00 	movabs $0x800ea5,%rax
+  800f79:	00 00 00 
+  800f7c:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800f7e:	c9                   	leave
+  800f7f:	c3                   	ret
+
+0000000000800f80 <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800f80:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f85:	48 89 d0             	mov    %rdx,%rax
+  800f88:	48 83 c2 01          	add    $0x1,%rdx
+  800f8c:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800f91:	75 f2                	jne    800f85 <strlen+0x5>
+		n++;
+	return n;
+}
+  800f93:	c3                   	ret
+
+0000000000800f94 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f94:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f99:	eb 03                	jmp    800f9e <strnlen+0xa>
+  800f9b:	48 89 d0             	mov    %rdx,%rax
+  800f9e:	48 39 c6             	cmp    %rax,%rsi
+  800fa1:	74 0a                	je     800fad <strnlen+0x19>
+  800fa3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800fa7:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800fab:	75 ee                	jne    800f9b <strnlen+0x7>
+		n++;
+	return n;
+}
+  800fad:	c3                   	ret
+
+0000000000800fae <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800fae:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800fb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb6:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800fba:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800fbd:	48 83 c2 01          	add    $0x1,%rdx
+  800fc1:	84 c9                	test   %cl,%cl
+  800fc3:	75 f1                	jne    800fb6 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800fc5:	c3                   	ret
+
+0000000000800fc6 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800fc6:	55                   	push   %rbp
+  800fc7:	48 89 e5             	mov    %rsp,%rbp
+  800fca:	41 54                	push   %r12
+  800fcc:	53                   	push   %rbx
+  800fcd:	48 89 fb             	mov    %rdi,%rbx
+  800fd0:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800fd3:	48 b8 80 0f 80 00 00 	movabs $0x800f80,%rax
+  800fda:	00 00 00 
+  800fdd:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800fdf:	48 63 f8             	movslq %eax,%rdi
+  800fe2:	48 01 df             	add    %rbx,%rdi
+  800fe5:	4c 89 e6             	mov    %r12,%rsi
+  800fe8:	48 b8 ae 0f 80 00 00 	movabs $0x800fae,%rax
+  800fef:	00 00 00 
+  800ff2:	ff d0                	call   *%rax
+	return dst;
+}
+  800ff4:	48 89 d8             	mov    %rbx,%rax
+  800ff7:	5b                   	pop    %rbx
+  800ff8:	41 5c                	pop    %r12
+  800ffa:	5d                   	pop    %rbp
+  800ffb:	c3                   	ret
+
+0000000000800ffc <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ffc:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800fff:	48 01 fa             	add    %rdi,%rdx
+  801002:	48 89 f9             	mov    %rdi,%rcx
+  801005:	eb 14                	jmp    80101b <strncpy+0x1f>
+		*dst++ = *src;
+  801007:	48 83 c1 01          	add    $0x1,%rcx
+  80100b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80100f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801013:	41 80 f8 01          	cmp    $0x1,%r8b
+  801017:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  80101b:	48 39 d1             	cmp    %rdx,%rcx
+  80101e:	75 e7                	jne    801007 <strncpy+0xb>
+	}
+	return ret;
+}
+  801020:	c3                   	ret
+
+0000000000801021 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801021:	48 89 f8             	mov    %rdi,%rax
+  801024:	48 85 d2             	test   %rdx,%rdx
+  801027:	74 27                	je     801050 <strlcpy+0x2f>
+  801029:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  80102e:	48 89 fa             	mov    %rdi,%rdx
+  801031:	eb 0b                	jmp    80103e <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801033:	48 83 c6 01          	add    $0x1,%rsi
+  801037:	48 83 c2 01          	add    $0x1,%rdx
+  80103b:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  80103e:	48 39 c2             	cmp    %rax,%rdx
+  801041:	74 0a                	je     80104d <strlcpy+0x2c>
+  801043:	0f b6 0e             	movzbl (%rsi),%ecx
+  801046:	84 c9                	test   %cl,%cl
+  801048:	75 e9                	jne    801033 <strlcpy+0x12>
+  80104a:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  80104d:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801050:	48 29 f8             	sub    %rdi,%rax
+}
+  801053:	c3                   	ret
+
+0000000000801054 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  801054:	eb 08                	jmp    80105e <strcmp+0xa>
+		p++, q++;
+  801056:	48 83 c7 01          	add    $0x1,%rdi
+  80105a:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  80105e:	0f b6 07             	movzbl (%rdi),%eax
+  801061:	84 c0                	test   %al,%al
+  801063:	74 04                	je     801069 <strcmp+0x15>
+  801065:	3a 06                	cmp    (%rsi),%al
+  801067:	74 ed                	je     801056 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801069:	0f b6 c0             	movzbl %al,%eax
+  80106c:	0f b6 16             	movzbl (%rsi),%edx
+  80106f:	29 d0                	sub    %edx,%eax
+}
+  801071:	c3                   	ret
+
+0000000000801072 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  801072:	eb 0c                	jmp    801080 <strncmp+0xe>
+		n--, p++, q++;
+  801074:	48 83 ea 01          	sub    $0x1,%rdx
+  801078:	48 83 c7 01          	add    $0x1,%rdi
+  80107c:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  801080:	48 85 d2             	test   %rdx,%rdx
+  801083:	74 14                	je     801099 <strncmp+0x27>
+  801085:	0f b6 07             	movzbl (%rdi),%eax
+  801088:	84 c0                	test   %al,%al
+  80108a:	74 04                	je     801090 <strncmp+0x1e>
+  80108c:	3a 06                	cmp    (%rsi),%al
+  80108e:	74 e4                	je     801074 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801090:	0f b6 07             	movzbl (%rdi),%eax
+  801093:	0f b6 16             	movzbl (%rsi),%edx
+  801096:	29 d0                	sub    %edx,%eax
+}
+  801098:	c3                   	ret
+		return 0;
+  801099:	b8 00 00 00 00       	mov    $0x0,%eax
+  80109e:	c3                   	ret
+
+000000000080109f <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  80109f:	eb 04                	jmp    8010a5 <strchr+0x6>
+  8010a1:	48 83 c7 01          	add    $0x1,%rdi
+  8010a5:	0f b6 07             	movzbl (%rdi),%eax
+  8010a8:	84 c0                	test   %al,%al
+  8010aa:	74 09                	je     8010b5 <strchr+0x16>
+		if (*s == c)
+  8010ac:	40 38 f0             	cmp    %sil,%al
+  8010af:	75 f0                	jne    8010a1 <strchr+0x2>
+  8010b1:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  8010b4:	c3                   	ret
+	return 0;
+  8010b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ba:	c3                   	ret
+
+00000000008010bb <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8010bb:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  8010be:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  8010c1:	40 38 f2             	cmp    %sil,%dl
+  8010c4:	74 0a                	je     8010d0 <strfind+0x15>
+  8010c6:	84 d2                	test   %dl,%dl
+  8010c8:	74 06                	je     8010d0 <strfind+0x15>
+	for (; *s; s++)
+  8010ca:	48 83 c0 01          	add    $0x1,%rax
+  8010ce:	eb ee                	jmp    8010be <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  8010d0:	c3                   	ret
+
+00000000008010d1 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  8010d1:	48 85 d2             	test   %rdx,%rdx
+  8010d4:	74 28                	je     8010fe <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  8010d6:	48 89 f8             	mov    %rdi,%rax
+  8010d9:	48 09 d0             	or     %rdx,%rax
+  8010dc:	a8 03                	test   $0x3,%al
+  8010de:	75 16                	jne    8010f6 <memset+0x25>
+		c &= 0xFF;
+  8010e0:	40 0f b6 f6          	movzbl %sil,%esi
+  8010e4:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8010ea:	48 89 d1             	mov    %rdx,%rcx
+  8010ed:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  8010f1:	fc                   	cld
+  8010f2:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8010f4:	eb 08                	jmp    8010fe <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8010f6:	89 f0                	mov    %esi,%eax
+  8010f8:	48 89 d1             	mov    %rdx,%rcx
+  8010fb:	fc                   	cld
+  8010fc:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8010fe:	48 89 f8             	mov    %rdi,%rax
+  801101:	c3                   	ret
+
+0000000000801102 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801102:	48 89 f8             	mov    %rdi,%rax
+  801105:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801108:	48 39 fe             	cmp    %rdi,%rsi
+  80110b:	73 3a                	jae    801147 <memmove+0x45>
+  80110d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801111:	48 39 d7             	cmp    %rdx,%rdi
+  801114:	73 31                	jae    801147 <memmove+0x45>
+		s += n;
+		d += n;
+  801116:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  80111a:	48 89 d6             	mov    %rdx,%rsi
+  80111d:	48 09 fe             	or     %rdi,%rsi
+  801120:	48 09 ce             	or     %rcx,%rsi
+  801123:	40 f6 c6 03          	test   $0x3,%sil
+  801127:	75 11                	jne    80113a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801129:	48 83 ef 04          	sub    $0x4,%rdi
+  80112d:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  801131:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801135:	fd                   	std
+  801136:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801138:	eb 0b                	jmp    801145 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80113a:	48 83 ef 01          	sub    $0x1,%rdi
+  80113e:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  801142:	fd                   	std
+  801143:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801145:	fc                   	cld
+  801146:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  801147:	48 89 f2             	mov    %rsi,%rdx
+  80114a:	48 09 c2             	or     %rax,%rdx
+  80114d:	48 09 ca             	or     %rcx,%rdx
+  801150:	f6 c2 03             	test   $0x3,%dl
+  801153:	75 0b                	jne    801160 <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801155:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  801159:	48 89 c7             	mov    %rax,%rdi
+  80115c:	fc                   	cld
+  80115d:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80115f:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  801160:	48 89 c7             	mov    %rax,%rdi
+  801163:	fc                   	cld
+  801164:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801166:	c3                   	ret
+
+0000000000801167 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801167:	55                   	push   %rbp
+  801168:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  80116b:	48 b8 02 11 80 00 00 	movabs $0x801102,%rax
+  801172:	00 00 00 
+  801175:	ff d0                	call   *%rax
+}
+  801177:	5d                   	pop    %rbp
+  801178:	c3                   	ret
+
+0000000000801179 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801179:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117e:	48 39 c2             	cmp    %rax,%rdx
+  801181:	74 1e                	je     8011a1 <memcmp+0x28>
+		if (*s1 != *s2)
+  801183:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801187:	48 83 c0 01          	add    $0x1,%rax
+  80118b:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  801191:	44 38 c1             	cmp    %r8b,%cl
+  801194:	74 e8                	je     80117e <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  801196:	0f b6 c1             	movzbl %cl,%eax
+  801199:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80119d:	44 29 c0             	sub    %r8d,%eax
+  8011a0:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  8011a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011a6:	c3                   	ret
+
+00000000008011a7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8011a7:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  8011aa:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  8011ad:	eb 04                	jmp    8011b3 <memfind+0xc>
+  8011af:	48 83 c0 01          	add    $0x1,%rax
+  8011b3:	48 39 d0             	cmp    %rdx,%rax
+  8011b6:	73 05                	jae    8011bd <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8011b8:	40 38 30             	cmp    %sil,(%rax)
+  8011bb:	75 f2                	jne    8011af <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  8011bd:	c3                   	ret
+
+00000000008011be <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8011be:	48 89 f9             	mov    %rdi,%rcx
+  8011c1:	49 89 f0             	mov    %rsi,%r8
+  8011c4:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8011c6:	eb 04                	jmp    8011cc <strtol+0xe>
+		s++;
+  8011c8:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  8011cc:	0f b6 01             	movzbl (%rcx),%eax
+  8011cf:	3c 20                	cmp    $0x20,%al
+  8011d1:	74 f5                	je     8011c8 <strtol+0xa>
+  8011d3:	3c 09                	cmp    $0x9,%al
+  8011d5:	74 f1                	je     8011c8 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  8011d7:	3c 2b                	cmp    $0x2b,%al
+  8011d9:	74 2b                	je     801206 <strtol+0x48>
+	int neg = 0;
+  8011db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  8011e1:	3c 2d                	cmp    $0x2d,%al
+  8011e3:	74 2d                	je     801212 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011e5:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  8011eb:	75 0f                	jne    8011fc <strtol+0x3e>
+  8011ed:	80 39 30             	cmpb   $0x30,(%rcx)
+  8011f0:	74 2c                	je     80121e <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8011f2:	85 ff                	test   %edi,%edi
+  8011f4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011f9:	0f 44 f8             	cmove  %eax,%edi
+  8011fc:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  801201:	4c 63 d7             	movslq %edi,%r10
+  801204:	eb 4f                	jmp    801255 <strtol+0x97>
+		s++;
+  801206:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  80120a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801210:	eb d3                	jmp    8011e5 <strtol+0x27>
+		s++, neg = 1;
+  801212:	48 83 c1 01          	add    $0x1,%rcx
+  801216:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  80121c:	eb c7                	jmp    8011e5 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80121e:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  801222:	74 0f                	je     801233 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  801224:	85 ff                	test   %edi,%edi
+  801226:	75 d4                	jne    8011fc <strtol+0x3e>
+		s++, base = 8;
+  801228:	48 83 c1 01          	add    $0x1,%rcx
+  80122c:	bf 08 00 00 00       	mov    $0x8,%edi
+  801231:	eb c9                	jmp    8011fc <strtol+0x3e>
+		s += 2, base = 16;
+  801233:	48 83 c1 02          	add    $0x2,%rcx
+  801237:	bf 10 00 00 00       	mov    $0x10,%edi
+  80123c:	eb be                	jmp    8011fc <strtol+0x3e>
+			dig = *s - '0';
+  80123e:	0f be c0             	movsbl %al,%eax
+  801241:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  801244:	39 f8                	cmp    %edi,%eax
+  801246:	7d 3b                	jge    801283 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  801248:	48 83 c1 01          	add    $0x1,%rcx
+  80124c:	49 0f af d2          	imul   %r10,%rdx
+  801250:	48 98                	cltq
+  801252:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  801255:	0f b6 01             	movzbl (%rcx),%eax
+  801258:	8d 70 d0             	lea    -0x30(%rax),%esi
+  80125b:	40 80 fe 09          	cmp    $0x9,%sil
+  80125f:	76 dd                	jbe    80123e <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  801261:	8d 70 9f             	lea    -0x61(%rax),%esi
+  801264:	40 80 fe 19          	cmp    $0x19,%sil
+  801268:	77 08                	ja     801272 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  80126a:	0f be c0             	movsbl %al,%eax
+  80126d:	83 e8 57             	sub    $0x57,%eax
+  801270:	eb d2                	jmp    801244 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  801272:	8d 70 bf             	lea    -0x41(%rax),%esi
+  801275:	40 80 fe 19          	cmp    $0x19,%sil
+  801279:	77 08                	ja     801283 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  80127b:	0f be c0             	movsbl %al,%eax
+  80127e:	83 e8 37             	sub    $0x37,%eax
+  801281:	eb c1                	jmp    801244 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801283:	4d 85 c0             	test   %r8,%r8
+  801286:	74 03                	je     80128b <strtol+0xcd>
+		*endptr = (char *) s;
+  801288:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  80128b:	48 89 d0             	mov    %rdx,%rax
+  80128e:	48 f7 d8             	neg    %rax
+  801291:	45 85 c9             	test   %r9d,%r9d
+  801294:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  801298:	48 89 d0             	mov    %rdx,%rax
+  80129b:	c3                   	ret
@@ -0,0 +1,2256 @@
+
+obj/user/divzero:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 38 00 00 00       	call   800069 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+
+int zero;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+	zero = 0;
+  800037:	48 b8 08 20 80 00 00 	movabs $0x802008,%rax
+  80003e:	00 00 00 
+  800041:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	cprintf("1/0 is %08x!\n", 1/zero);
+  800047:	be 00 00 00 00       	mov    $0x0,%esi
+  80004c:	48 bf c0 12 80 00 00 	movabs $0x8012c0,%rdi
+  800053:	00 00 00 
+  800056:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005b:	48 ba 5c 01 80 00 00 	movabs $0x80015c,%rdx
+  800062:	00 00 00 
+  800065:	ff d2                	call   *%rdx
+}
+  800067:	5d                   	pop    %rbp
+  800068:	c3                   	ret
+
+0000000000800069 <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  800069:	55                   	push   %rbp
+  80006a:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80006d:	85 ff                	test   %edi,%edi
+  80006f:	7e 0d                	jle    80007e <libmain+0x15>
+		binaryname = argv[0];
+  800071:	48 8b 06             	mov    (%rsi),%rax
+  800074:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  80007b:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  80007e:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  800085:	00 00 00 
+  800088:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  80008a:	48 b8 98 00 80 00 00 	movabs $0x800098,%rax
+  800091:	00 00 00 
+  800094:	ff d0                	call   *%rax
+}
+  800096:	5d                   	pop    %rbp
+  800097:	c3                   	ret
+
+0000000000800098 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800098:	55                   	push   %rbp
+  800099:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  80009c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000a1:	48 b8 39 0d 80 00 00 	movabs $0x800d39,%rax
+  8000a8:	00 00 00 
+  8000ab:	ff d0                	call   *%rax
+}
+  8000ad:	5d                   	pop    %rbp
+  8000ae:	c3                   	ret
+
+00000000008000af <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000af:	55                   	push   %rbp
+  8000b0:	48 89 e5             	mov    %rsp,%rbp
+  8000b3:	53                   	push   %rbx
+  8000b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8000b8:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  8000bb:	8b 06                	mov    (%rsi),%eax
+  8000bd:	8d 50 01             	lea    0x1(%rax),%edx
+  8000c0:	89 16                	mov    %edx,(%rsi)
+  8000c2:	48 98                	cltq
+  8000c4:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  8000c9:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8000cf:	74 0a                	je     8000db <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000d1:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8000d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000d9:	c9                   	leave
+  8000da:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000db:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8000df:	be ff 00 00 00       	mov    $0xff,%esi
+  8000e4:	48 b8 01 0d 80 00 00 	movabs $0x800d01,%rax
+  8000eb:	00 00 00 
+  8000ee:	ff d0                	call   *%rax
+		b->idx = 0;
+  8000f0:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8000f6:	eb d9                	jmp    8000d1 <putch+0x22>
+
+00000000008000f8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8000f8:	55                   	push   %rbp
+  8000f9:	48 89 e5             	mov    %rsp,%rbp
+  8000fc:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800103:	48 89 fa             	mov    %rdi,%rdx
+  800106:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  800109:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800110:	00 00 00 
+	b.cnt = 0;
+  800113:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80011a:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80011d:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  800124:	48 bf af 00 80 00 00 	movabs $0x8000af,%rdi
+  80012b:	00 00 00 
+  80012e:	48 b8 16 03 80 00 00 	movabs $0x800316,%rax
+  800135:	00 00 00 
+  800138:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  80013a:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  800141:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800148:	48 b8 01 0d 80 00 00 	movabs $0x800d01,%rax
+  80014f:	00 00 00 
+  800152:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  800154:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  80015a:	c9                   	leave
+  80015b:	c3                   	ret
+
+000000000080015c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80015c:	55                   	push   %rbp
+  80015d:	48 89 e5             	mov    %rsp,%rbp
+  800160:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800167:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80016e:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800175:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80017c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800183:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80018a:	84 c0                	test   %al,%al
+  80018c:	74 20                	je     8001ae <cprintf+0x52>
+  80018e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800192:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800196:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80019a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80019e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8001a2:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8001a6:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8001aa:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001ae:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  8001b5:	00 00 00 
+  8001b8:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8001bf:	00 00 00 
+  8001c2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001c6:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8001cd:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8001d4:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  8001db:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  8001e2:	48 b8 f8 00 80 00 00 	movabs $0x8000f8,%rax
+  8001e9:	00 00 00 
+  8001ec:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  8001ee:	c9                   	leave
+  8001ef:	c3                   	ret
+
+00000000008001f0 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001f0:	55                   	push   %rbp
+  8001f1:	48 89 e5             	mov    %rsp,%rbp
+  8001f4:	41 57                	push   %r15
+  8001f6:	41 56                	push   %r14
+  8001f8:	41 55                	push   %r13
+  8001fa:	41 54                	push   %r12
+  8001fc:	53                   	push   %rbx
+  8001fd:	48 83 ec 18          	sub    $0x18,%rsp
+  800201:	49 89 fc             	mov    %rdi,%r12
+  800204:	49 89 f5             	mov    %rsi,%r13
+  800207:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80020b:	44 89 c3             	mov    %r8d,%ebx
+  80020e:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800211:	41 89 cf             	mov    %ecx,%r15d
+  800214:	4c 39 fa             	cmp    %r15,%rdx
+  800217:	72 29                	jb     800242 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800219:	48 89 d0             	mov    %rdx,%rax
+  80021c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800221:	49 f7 f7             	div    %r15
+  800224:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800228:	48 89 c2             	mov    %rax,%rdx
+  80022b:	48 b8 f0 01 80 00 00 	movabs $0x8001f0,%rax
+  800232:	00 00 00 
+  800235:	ff d0                	call   *%rax
+  800237:	eb 10                	jmp    800249 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800239:	4c 89 ee             	mov    %r13,%rsi
+  80023c:	44 89 f7             	mov    %r14d,%edi
+  80023f:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  800242:	83 eb 01             	sub    $0x1,%ebx
+  800245:	85 db                	test   %ebx,%ebx
+  800247:	7f f0                	jg     800239 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800249:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80024d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800252:	49 f7 f7             	div    %r15
+  800255:	48 b8 d8 12 80 00 00 	movabs $0x8012d8,%rax
+  80025c:	00 00 00 
+  80025f:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  800263:	4c 89 ee             	mov    %r13,%rsi
+  800266:	41 ff d4             	call   *%r12
+}
+  800269:	48 83 c4 18          	add    $0x18,%rsp
+  80026d:	5b                   	pop    %rbx
+  80026e:	41 5c                	pop    %r12
+  800270:	41 5d                	pop    %r13
+  800272:	41 5e                	pop    %r14
+  800274:	41 5f                	pop    %r15
+  800276:	5d                   	pop    %rbp
+  800277:	c3                   	ret
+
+0000000000800278 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  800278:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  80027c:	48 8b 06             	mov    (%rsi),%rax
+  80027f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800283:	73 0a                	jae    80028f <sprintputch+0x17>
+		*b->buf++ = ch;
+  800285:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800289:	48 89 16             	mov    %rdx,(%rsi)
+  80028c:	40 88 38             	mov    %dil,(%rax)
+}
+  80028f:	c3                   	ret
+
+0000000000800290 <printfmt>:
+{
+  800290:	55                   	push   %rbp
+  800291:	48 89 e5             	mov    %rsp,%rbp
+  800294:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80029b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8002a2:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8002a9:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8002b0:	84 c0                	test   %al,%al
+  8002b2:	74 20                	je     8002d4 <printfmt+0x44>
+  8002b4:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8002b8:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8002bc:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8002c0:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8002c4:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8002c8:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8002cc:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8002d0:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  8002d4:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8002db:	00 00 00 
+  8002de:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8002e5:	00 00 00 
+  8002e8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002ec:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8002f3:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8002fa:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800301:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800308:	48 b8 16 03 80 00 00 	movabs $0x800316,%rax
+  80030f:	00 00 00 
+  800312:	ff d0                	call   *%rax
+}
+  800314:	c9                   	leave
+  800315:	c3                   	ret
+
+0000000000800316 <vprintfmt>:
+{
+  800316:	55                   	push   %rbp
+  800317:	48 89 e5             	mov    %rsp,%rbp
+  80031a:	41 57                	push   %r15
+  80031c:	41 56                	push   %r14
+  80031e:	41 55                	push   %r13
+  800320:	41 54                	push   %r12
+  800322:	53                   	push   %rbx
+  800323:	48 83 ec 48          	sub    $0x48,%rsp
+  800327:	49 89 fe             	mov    %rdi,%r14
+  80032a:	49 89 f5             	mov    %rsi,%r13
+  80032d:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  800330:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  800334:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  800338:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80033c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  800340:	eb 09                	jmp    80034b <vprintfmt+0x35>
+			putch(ch, putdat);
+  800342:	4c 89 ee             	mov    %r13,%rsi
+  800345:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800348:	4c 89 e3             	mov    %r12,%rbx
+  80034b:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80034f:	0f b6 3b             	movzbl (%rbx),%edi
+  800352:	83 ff 25             	cmp    $0x25,%edi
+  800355:	74 13                	je     80036a <vprintfmt+0x54>
+			if (ch == '\0')
+  800357:	85 ff                	test   %edi,%edi
+  800359:	75 e7                	jne    800342 <vprintfmt+0x2c>
+}
+  80035b:	48 83 c4 48          	add    $0x48,%rsp
+  80035f:	5b                   	pop    %rbx
+  800360:	41 5c                	pop    %r12
+  800362:	41 5d                	pop    %r13
+  800364:	41 5e                	pop    %r14
+  800366:	41 5f                	pop    %r15
+  800368:	5d                   	pop    %rbp
+  800369:	c3                   	ret
+		padc = ' ';
+  80036a:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  80036e:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  800375:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  80037b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  800382:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800387:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80038c:	41 0f b6 14 24       	movzbl (%r12),%edx
+  800391:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  800394:	3c 55                	cmp    $0x55,%al
+  800396:	0f 87 4f 05 00 00    	ja     8008eb <vprintfmt+0x5d5>
+  80039c:	0f b6 c0             	movzbl %al,%eax
+  80039f:	48 be a0 13 80 00 00 	movabs $0x8013a0,%rsi
+  8003a6:	00 00 00 
+  8003a9:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  8003ac:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  8003af:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  8003b3:	eb d2                	jmp    800387 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b5:	49 89 dc             	mov    %rbx,%r12
+  8003b8:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  8003bc:	eb c9                	jmp    800387 <vprintfmt+0x71>
+  8003be:	0f b6 d2             	movzbl %dl,%edx
+  8003c1:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  8003c4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  8003ca:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  8003ce:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  8003d3:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  8003d8:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  8003db:	83 f8 09             	cmp    $0x9,%eax
+  8003de:	77 20                	ja     800400 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  8003e0:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  8003e4:	eb e4                	jmp    8003ca <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  8003e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8003ec:	77 27                	ja     800415 <vprintfmt+0xff>
+  8003ee:	89 c2                	mov    %eax,%edx
+  8003f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8003f4:	83 c0 08             	add    $0x8,%eax
+  8003f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003fa:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  8003fd:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  800400:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800404:	79 81                	jns    800387 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  800406:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  80040a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800410:	e9 72 ff ff ff       	jmp    800387 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  800415:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800419:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80041d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800421:	eb d7                	jmp    8003fa <vprintfmt+0xe4>
+			if (width < 0)
+  800423:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  800426:	85 f6                	test   %esi,%esi
+  800428:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042d:	0f 49 c6             	cmovns %esi,%eax
+  800430:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800433:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800436:	e9 4c ff ff ff       	jmp    800387 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  80043b:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  80043e:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  800445:	e9 3d ff ff ff       	jmp    800387 <vprintfmt+0x71>
+			lflag++;
+  80044a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80044d:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800450:	e9 32 ff ff ff       	jmp    800387 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  800455:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800458:	83 f8 2f             	cmp    $0x2f,%eax
+  80045b:	77 19                	ja     800476 <vprintfmt+0x160>
+  80045d:	89 c2                	mov    %eax,%edx
+  80045f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800463:	83 c0 08             	add    $0x8,%eax
+  800466:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800469:	8b 3a                	mov    (%rdx),%edi
+  80046b:	4c 89 ee             	mov    %r13,%rsi
+  80046e:	41 ff d6             	call   *%r14
+			break;
+  800471:	e9 d5 fe ff ff       	jmp    80034b <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  800476:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80047a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80047e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800482:	eb e5                	jmp    800469 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  800484:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800487:	83 f8 2f             	cmp    $0x2f,%eax
+  80048a:	77 5a                	ja     8004e6 <vprintfmt+0x1d0>
+  80048c:	89 c2                	mov    %eax,%edx
+  80048e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800492:	83 c0 08             	add    $0x8,%eax
+  800495:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800498:	8b 02                	mov    (%rdx),%eax
+  80049a:	89 c1                	mov    %eax,%ecx
+  80049c:	f7 d9                	neg    %ecx
+  80049e:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004a1:	83 f9 08             	cmp    $0x8,%ecx
+  8004a4:	7f 4e                	jg     8004f4 <vprintfmt+0x1de>
+  8004a6:	48 63 c1             	movslq %ecx,%rax
+  8004a9:	48 ba 60 16 80 00 00 	movabs $0x801660,%rdx
+  8004b0:	00 00 00 
+  8004b3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004b7:	48 85 c0             	test   %rax,%rax
+  8004ba:	74 38                	je     8004f4 <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  8004bc:	48 89 c1             	mov    %rax,%rcx
+  8004bf:	48 ba f9 12 80 00 00 	movabs $0x8012f9,%rdx
+  8004c6:	00 00 00 
+  8004c9:	4c 89 ee             	mov    %r13,%rsi
+  8004cc:	4c 89 f7             	mov    %r14,%rdi
+  8004cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d4:	49 b8 90 02 80 00 00 	movabs $0x800290,%r8
+  8004db:	00 00 00 
+  8004de:	41 ff d0             	call   *%r8
+  8004e1:	e9 65 fe ff ff       	jmp    80034b <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  8004e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004f2:	eb a4                	jmp    800498 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  8004f4:	48 ba f0 12 80 00 00 	movabs $0x8012f0,%rdx
+  8004fb:	00 00 00 
+  8004fe:	4c 89 ee             	mov    %r13,%rsi
+  800501:	4c 89 f7             	mov    %r14,%rdi
+  800504:	b8 00 00 00 00       	mov    $0x0,%eax
+  800509:	49 b8 90 02 80 00 00 	movabs $0x800290,%r8
+  800510:	00 00 00 
+  800513:	41 ff d0             	call   *%r8
+  800516:	e9 30 fe ff ff       	jmp    80034b <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  80051b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80051e:	83 f8 2f             	cmp    $0x2f,%eax
+  800521:	77 36                	ja     800559 <vprintfmt+0x243>
+  800523:	89 c2                	mov    %eax,%edx
+  800525:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800529:	83 c0 08             	add    $0x8,%eax
+  80052c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80052f:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800532:	48 85 c9             	test   %rcx,%rcx
+  800535:	48 b8 e9 12 80 00 00 	movabs $0x8012e9,%rax
+  80053c:	00 00 00 
+  80053f:	48 0f 45 c1          	cmovne %rcx,%rax
+  800543:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800547:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80054b:	7e 06                	jle    800553 <vprintfmt+0x23d>
+  80054d:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800551:	75 14                	jne    800567 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800553:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800557:	eb 64                	jmp    8005bd <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800559:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80055d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800561:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800565:	eb c8                	jmp    80052f <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800567:	49 63 f7             	movslq %r15d,%rsi
+  80056a:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  80056e:	48 b8 f9 09 80 00 00 	movabs $0x8009f9,%rax
+  800575:	00 00 00 
+  800578:	ff d0                	call   *%rax
+  80057a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80057d:	29 c1                	sub    %eax,%ecx
+  80057f:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800582:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  800585:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800589:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80058c:	eb 0d                	jmp    80059b <vprintfmt+0x285>
+					putch(padc, putdat);
+  80058e:	4c 89 ee             	mov    %r13,%rsi
+  800591:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  800594:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800597:	41 83 ec 01          	sub    $0x1,%r12d
+  80059b:	45 85 e4             	test   %r12d,%r12d
+  80059e:	7f ee                	jg     80058e <vprintfmt+0x278>
+  8005a0:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  8005a3:	85 c9                	test   %ecx,%ecx
+  8005a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005aa:	0f 49 c1             	cmovns %ecx,%eax
+  8005ad:	29 c1                	sub    %eax,%ecx
+  8005af:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  8005b2:	eb 9f                	jmp    800553 <vprintfmt+0x23d>
+					putch(ch, putdat);
+  8005b4:	4c 89 ee             	mov    %r13,%rsi
+  8005b7:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005ba:	4c 89 e2             	mov    %r12,%rdx
+  8005bd:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8005c1:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8005c7:	0f be f8             	movsbl %al,%edi
+  8005ca:	85 ff                	test   %edi,%edi
+  8005cc:	74 29                	je     8005f7 <vprintfmt+0x2e1>
+  8005ce:	45 85 ff             	test   %r15d,%r15d
+  8005d1:	78 06                	js     8005d9 <vprintfmt+0x2c3>
+  8005d3:	41 83 ef 01          	sub    $0x1,%r15d
+  8005d7:	78 1e                	js     8005f7 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005d9:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  8005dd:	74 d5                	je     8005b4 <vprintfmt+0x29e>
+  8005df:	0f be c0             	movsbl %al,%eax
+  8005e2:	83 e8 20             	sub    $0x20,%eax
+  8005e5:	83 f8 5e             	cmp    $0x5e,%eax
+  8005e8:	76 ca                	jbe    8005b4 <vprintfmt+0x29e>
+					putch('?', putdat);
+  8005ea:	4c 89 ee             	mov    %r13,%rsi
+  8005ed:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8005f2:	41 ff d6             	call   *%r14
+  8005f5:	eb c3                	jmp    8005ba <vprintfmt+0x2a4>
+  8005f7:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  8005fb:	8b 45 98             	mov    -0x68(%rbp),%eax
+  8005fe:	41 01 c4             	add    %eax,%r12d
+  800601:	41 29 d4             	sub    %edx,%r12d
+  800604:	eb 0f                	jmp    800615 <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  800606:	4c 89 ee             	mov    %r13,%rsi
+  800609:	bf 20 00 00 00       	mov    $0x20,%edi
+  80060e:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800611:	41 83 ec 01          	sub    $0x1,%r12d
+  800615:	45 85 e4             	test   %r12d,%r12d
+  800618:	7f ec                	jg     800606 <vprintfmt+0x2f0>
+  80061a:	e9 2c fd ff ff       	jmp    80034b <vprintfmt+0x35>
+	if (lflag >= 2)
+  80061f:	83 f9 01             	cmp    $0x1,%ecx
+  800622:	7f 1d                	jg     800641 <vprintfmt+0x32b>
+	else if (lflag)
+  800624:	85 c9                	test   %ecx,%ecx
+  800626:	74 5e                	je     800686 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800628:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80062b:	83 f8 2f             	cmp    $0x2f,%eax
+  80062e:	77 48                	ja     800678 <vprintfmt+0x362>
+  800630:	89 c2                	mov    %eax,%edx
+  800632:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800636:	83 c0 08             	add    $0x8,%eax
+  800639:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80063c:	4c 8b 22             	mov    (%rdx),%r12
+  80063f:	eb 17                	jmp    800658 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800641:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800644:	83 f8 2f             	cmp    $0x2f,%eax
+  800647:	77 21                	ja     80066a <vprintfmt+0x354>
+  800649:	89 c2                	mov    %eax,%edx
+  80064b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80064f:	83 c0 08             	add    $0x8,%eax
+  800652:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800655:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800658:	4d 85 e4             	test   %r12,%r12
+  80065b:	78 50                	js     8006ad <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  80065d:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800660:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800665:	e9 b4 01 00 00       	jmp    80081e <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  80066a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80066e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800672:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800676:	eb dd                	jmp    800655 <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800678:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80067c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800680:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800684:	eb b6                	jmp    80063c <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800686:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800689:	83 f8 2f             	cmp    $0x2f,%eax
+  80068c:	77 11                	ja     80069f <vprintfmt+0x389>
+  80068e:	89 c2                	mov    %eax,%edx
+  800690:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800694:	83 c0 08             	add    $0x8,%eax
+  800697:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80069a:	4c 63 22             	movslq (%rdx),%r12
+  80069d:	eb b9                	jmp    800658 <vprintfmt+0x342>
+  80069f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ab:	eb ed                	jmp    80069a <vprintfmt+0x384>
+				putch('-', putdat);
+  8006ad:	4c 89 ee             	mov    %r13,%rsi
+  8006b0:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8006b5:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  8006b8:	4c 89 e2             	mov    %r12,%rdx
+  8006bb:	48 f7 da             	neg    %rdx
+			base = 10;
+  8006be:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8006c3:	e9 56 01 00 00       	jmp    80081e <vprintfmt+0x508>
+	if (lflag >= 2)
+  8006c8:	83 f9 01             	cmp    $0x1,%ecx
+  8006cb:	7f 25                	jg     8006f2 <vprintfmt+0x3dc>
+	else if (lflag)
+  8006cd:	85 c9                	test   %ecx,%ecx
+  8006cf:	74 5e                	je     80072f <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  8006d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d7:	77 48                	ja     800721 <vprintfmt+0x40b>
+  8006d9:	89 c2                	mov    %eax,%edx
+  8006db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006df:	83 c0 08             	add    $0x8,%eax
+  8006e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006e5:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8006e8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  8006ed:	e9 2c 01 00 00       	jmp    80081e <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8006f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8006f8:	77 19                	ja     800713 <vprintfmt+0x3fd>
+  8006fa:	89 c2                	mov    %eax,%edx
+  8006fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800700:	83 c0 08             	add    $0x8,%eax
+  800703:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800706:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800709:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  80070e:	e9 0b 01 00 00       	jmp    80081e <vprintfmt+0x508>
+  800713:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800717:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80071b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80071f:	eb e5                	jmp    800706 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800721:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800725:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800729:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80072d:	eb b6                	jmp    8006e5 <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  80072f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800732:	83 f8 2f             	cmp    $0x2f,%eax
+  800735:	77 18                	ja     80074f <vprintfmt+0x439>
+  800737:	89 c2                	mov    %eax,%edx
+  800739:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073d:	83 c0 08             	add    $0x8,%eax
+  800740:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800743:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800745:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  80074a:	e9 cf 00 00 00       	jmp    80081e <vprintfmt+0x508>
+  80074f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800753:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800757:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80075b:	eb e6                	jmp    800743 <vprintfmt+0x42d>
+	if (lflag >= 2)
+  80075d:	83 f9 01             	cmp    $0x1,%ecx
+  800760:	7f 25                	jg     800787 <vprintfmt+0x471>
+	else if (lflag)
+  800762:	85 c9                	test   %ecx,%ecx
+  800764:	74 5b                	je     8007c1 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800766:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800769:	83 f8 2f             	cmp    $0x2f,%eax
+  80076c:	77 45                	ja     8007b3 <vprintfmt+0x49d>
+  80076e:	89 c2                	mov    %eax,%edx
+  800770:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800774:	83 c0 08             	add    $0x8,%eax
+  800777:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077a:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  80077d:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800782:	e9 97 00 00 00       	jmp    80081e <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800787:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80078a:	83 f8 2f             	cmp    $0x2f,%eax
+  80078d:	77 16                	ja     8007a5 <vprintfmt+0x48f>
+  80078f:	89 c2                	mov    %eax,%edx
+  800791:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800795:	83 c0 08             	add    $0x8,%eax
+  800798:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80079b:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  80079e:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  8007a3:	eb 79                	jmp    80081e <vprintfmt+0x508>
+  8007a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b1:	eb e8                	jmp    80079b <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  8007b3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007bf:	eb b9                	jmp    80077a <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  8007c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c7:	77 15                	ja     8007de <vprintfmt+0x4c8>
+  8007c9:	89 c2                	mov    %eax,%edx
+  8007cb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007cf:	83 c0 08             	add    $0x8,%eax
+  8007d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d5:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  8007d7:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  8007dc:	eb 40                	jmp    80081e <vprintfmt+0x508>
+  8007de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ea:	eb e9                	jmp    8007d5 <vprintfmt+0x4bf>
+			putch('0', putdat);
+  8007ec:	4c 89 ee             	mov    %r13,%rsi
+  8007ef:	bf 30 00 00 00       	mov    $0x30,%edi
+  8007f4:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  8007f7:	4c 89 ee             	mov    %r13,%rsi
+  8007fa:	bf 78 00 00 00       	mov    $0x78,%edi
+  8007ff:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800802:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800805:	83 f8 2f             	cmp    $0x2f,%eax
+  800808:	77 34                	ja     80083e <vprintfmt+0x528>
+  80080a:	89 c2                	mov    %eax,%edx
+  80080c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800810:	83 c0 08             	add    $0x8,%eax
+  800813:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800816:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800819:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  80081e:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800823:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800827:	4c 89 ee             	mov    %r13,%rsi
+  80082a:	4c 89 f7             	mov    %r14,%rdi
+  80082d:	48 b8 f0 01 80 00 00 	movabs $0x8001f0,%rax
+  800834:	00 00 00 
+  800837:	ff d0                	call   *%rax
+			break;
+  800839:	e9 0d fb ff ff       	jmp    80034b <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  80083e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800842:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800846:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084a:	eb ca                	jmp    800816 <vprintfmt+0x500>
+	if (lflag >= 2)
+  80084c:	83 f9 01             	cmp    $0x1,%ecx
+  80084f:	7f 22                	jg     800873 <vprintfmt+0x55d>
+	else if (lflag)
+  800851:	85 c9                	test   %ecx,%ecx
+  800853:	74 58                	je     8008ad <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800855:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800858:	83 f8 2f             	cmp    $0x2f,%eax
+  80085b:	77 42                	ja     80089f <vprintfmt+0x589>
+  80085d:	89 c2                	mov    %eax,%edx
+  80085f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800863:	83 c0 08             	add    $0x8,%eax
+  800866:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800869:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  80086c:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800871:	eb ab                	jmp    80081e <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800873:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800876:	83 f8 2f             	cmp    $0x2f,%eax
+  800879:	77 16                	ja     800891 <vprintfmt+0x57b>
+  80087b:	89 c2                	mov    %eax,%edx
+  80087d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800881:	83 c0 08             	add    $0x8,%eax
+  800884:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800887:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  80088a:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  80088f:	eb 8d                	jmp    80081e <vprintfmt+0x508>
+  800891:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800895:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800899:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089d:	eb e8                	jmp    800887 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  80089f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ab:	eb bc                	jmp    800869 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  8008ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b3:	77 18                	ja     8008cd <vprintfmt+0x5b7>
+  8008b5:	89 c2                	mov    %eax,%edx
+  8008b7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008bb:	83 c0 08             	add    $0x8,%eax
+  8008be:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c1:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  8008c3:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  8008c8:	e9 51 ff ff ff       	jmp    80081e <vprintfmt+0x508>
+  8008cd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d9:	eb e6                	jmp    8008c1 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  8008db:	4c 89 ee             	mov    %r13,%rsi
+  8008de:	bf 25 00 00 00       	mov    $0x25,%edi
+  8008e3:	41 ff d6             	call   *%r14
+			break;
+  8008e6:	e9 60 fa ff ff       	jmp    80034b <vprintfmt+0x35>
+			putch('%', putdat);
+  8008eb:	4c 89 ee             	mov    %r13,%rsi
+  8008ee:	bf 25 00 00 00       	mov    $0x25,%edi
+  8008f3:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008f6:	4c 89 e3             	mov    %r12,%rbx
+  8008f9:	eb 04                	jmp    8008ff <vprintfmt+0x5e9>
+  8008fb:	48 83 eb 01          	sub    $0x1,%rbx
+  8008ff:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800903:	75 f6                	jne    8008fb <vprintfmt+0x5e5>
+  800905:	e9 41 fa ff ff       	jmp    80034b <vprintfmt+0x35>
+
+000000000080090a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80090a:	55                   	push   %rbp
+  80090b:	48 89 e5             	mov    %rsp,%rbp
+  80090e:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800912:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800916:	48 63 c6             	movslq %esi,%rax
+  800919:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  80091e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800922:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800929:	48 85 ff             	test   %rdi,%rdi
+  80092c:	74 2a                	je     800958 <vsnprintf+0x4e>
+  80092e:	85 f6                	test   %esi,%esi
+  800930:	7e 26                	jle    800958 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800932:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800936:	48 bf 78 02 80 00 00 	movabs $0x800278,%rdi
+  80093d:	00 00 00 
+  800940:	48 b8 16 03 80 00 00 	movabs $0x800316,%rax
+  800947:	00 00 00 
+  80094a:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80094c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800950:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800953:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800956:	c9                   	leave
+  800957:	c3                   	ret
+		return -E_INVAL;
+  800958:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80095d:	eb f7                	jmp    800956 <vsnprintf+0x4c>
+
+000000000080095f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80095f:	55                   	push   %rbp
+  800960:	48 89 e5             	mov    %rsp,%rbp
+  800963:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80096a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800971:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800978:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80097f:	84 c0                	test   %al,%al
+  800981:	74 20                	je     8009a3 <snprintf+0x44>
+  800983:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800987:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80098b:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80098f:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800993:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800997:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80099b:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80099f:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009a3:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8009aa:	00 00 00 
+  8009ad:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8009b4:	00 00 00 
+  8009b7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8009bb:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8009c2:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8009c9:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009d0:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8009d7:	48 b8 0a 09 80 00 00 	movabs $0x80090a,%rax
+  8009de:	00 00 00 
+  8009e1:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  8009e3:	c9                   	leave
+  8009e4:	c3                   	ret
+
+00000000008009e5 <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009ea:	48 89 d0             	mov    %rdx,%rax
+  8009ed:	48 83 c2 01          	add    $0x1,%rdx
+  8009f1:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  8009f6:	75 f2                	jne    8009ea <strlen+0x5>
+		n++;
+	return n;
+}
+  8009f8:	c3                   	ret
+
+00000000008009f9 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009fe:	eb 03                	jmp    800a03 <strnlen+0xa>
+  800a00:	48 89 d0             	mov    %rdx,%rax
+  800a03:	48 39 c6             	cmp    %rax,%rsi
+  800a06:	74 0a                	je     800a12 <strnlen+0x19>
+  800a08:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a0c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800a10:	75 ee                	jne    800a00 <strnlen+0x7>
+		n++;
+	return n;
+}
+  800a12:	c3                   	ret
+
+0000000000800a13 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a13:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a16:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a1b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800a1f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800a22:	48 83 c2 01          	add    $0x1,%rdx
+  800a26:	84 c9                	test   %cl,%cl
+  800a28:	75 f1                	jne    800a1b <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800a2a:	c3                   	ret
+
+0000000000800a2b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a2b:	55                   	push   %rbp
+  800a2c:	48 89 e5             	mov    %rsp,%rbp
+  800a2f:	41 54                	push   %r12
+  800a31:	53                   	push   %rbx
+  800a32:	48 89 fb             	mov    %rdi,%rbx
+  800a35:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800a38:	48 b8 e5 09 80 00 00 	movabs $0x8009e5,%rax
+  800a3f:	00 00 00 
+  800a42:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800a44:	48 63 f8             	movslq %eax,%rdi
+  800a47:	48 01 df             	add    %rbx,%rdi
+  800a4a:	4c 89 e6             	mov    %r12,%rsi
+  800a4d:	48 b8 13 0a 80 00 00 	movabs $0x800a13,%rax
+  800a54:	00 00 00 
+  800a57:	ff d0                	call   *%rax
+	return dst;
+}
+  800a59:	48 89 d8             	mov    %rbx,%rax
+  800a5c:	5b                   	pop    %rbx
+  800a5d:	41 5c                	pop    %r12
+  800a5f:	5d                   	pop    %rbp
+  800a60:	c3                   	ret
+
+0000000000800a61 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a61:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a64:	48 01 fa             	add    %rdi,%rdx
+  800a67:	48 89 f9             	mov    %rdi,%rcx
+  800a6a:	eb 14                	jmp    800a80 <strncpy+0x1f>
+		*dst++ = *src;
+  800a6c:	48 83 c1 01          	add    $0x1,%rcx
+  800a70:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800a74:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a78:	41 80 f8 01          	cmp    $0x1,%r8b
+  800a7c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800a80:	48 39 d1             	cmp    %rdx,%rcx
+  800a83:	75 e7                	jne    800a6c <strncpy+0xb>
+	}
+	return ret;
+}
+  800a85:	c3                   	ret
+
+0000000000800a86 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a86:	48 89 f8             	mov    %rdi,%rax
+  800a89:	48 85 d2             	test   %rdx,%rdx
+  800a8c:	74 27                	je     800ab5 <strlcpy+0x2f>
+  800a8e:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800a93:	48 89 fa             	mov    %rdi,%rdx
+  800a96:	eb 0b                	jmp    800aa3 <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a98:	48 83 c6 01          	add    $0x1,%rsi
+  800a9c:	48 83 c2 01          	add    $0x1,%rdx
+  800aa0:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800aa3:	48 39 c2             	cmp    %rax,%rdx
+  800aa6:	74 0a                	je     800ab2 <strlcpy+0x2c>
+  800aa8:	0f b6 0e             	movzbl (%rsi),%ecx
+  800aab:	84 c9                	test   %cl,%cl
+  800aad:	75 e9                	jne    800a98 <strlcpy+0x12>
+  800aaf:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800ab2:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800ab5:	48 29 f8             	sub    %rdi,%rax
+}
+  800ab8:	c3                   	ret
+
+0000000000800ab9 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800ab9:	eb 08                	jmp    800ac3 <strcmp+0xa>
+		p++, q++;
+  800abb:	48 83 c7 01          	add    $0x1,%rdi
+  800abf:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800ac3:	0f b6 07             	movzbl (%rdi),%eax
+  800ac6:	84 c0                	test   %al,%al
+  800ac8:	74 04                	je     800ace <strcmp+0x15>
+  800aca:	3a 06                	cmp    (%rsi),%al
+  800acc:	74 ed                	je     800abb <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ace:	0f b6 c0             	movzbl %al,%eax
+  800ad1:	0f b6 16             	movzbl (%rsi),%edx
+  800ad4:	29 d0                	sub    %edx,%eax
+}
+  800ad6:	c3                   	ret
+
+0000000000800ad7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800ad7:	eb 0c                	jmp    800ae5 <strncmp+0xe>
+		n--, p++, q++;
+  800ad9:	48 83 ea 01          	sub    $0x1,%rdx
+  800add:	48 83 c7 01          	add    $0x1,%rdi
+  800ae1:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800ae5:	48 85 d2             	test   %rdx,%rdx
+  800ae8:	74 14                	je     800afe <strncmp+0x27>
+  800aea:	0f b6 07             	movzbl (%rdi),%eax
+  800aed:	84 c0                	test   %al,%al
+  800aef:	74 04                	je     800af5 <strncmp+0x1e>
+  800af1:	3a 06                	cmp    (%rsi),%al
+  800af3:	74 e4                	je     800ad9 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800af5:	0f b6 07             	movzbl (%rdi),%eax
+  800af8:	0f b6 16             	movzbl (%rsi),%edx
+  800afb:	29 d0                	sub    %edx,%eax
+}
+  800afd:	c3                   	ret
+		return 0;
+  800afe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b03:	c3                   	ret
+
+0000000000800b04 <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800b04:	eb 04                	jmp    800b0a <strchr+0x6>
+  800b06:	48 83 c7 01          	add    $0x1,%rdi
+  800b0a:	0f b6 07             	movzbl (%rdi),%eax
+  800b0d:	84 c0                	test   %al,%al
+  800b0f:	74 09                	je     800b1a <strchr+0x16>
+		if (*s == c)
+  800b11:	40 38 f0             	cmp    %sil,%al
+  800b14:	75 f0                	jne    800b06 <strchr+0x2>
+  800b16:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800b19:	c3                   	ret
+	return 0;
+  800b1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1f:	c3                   	ret
+
+0000000000800b20 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b20:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800b23:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800b26:	40 38 f2             	cmp    %sil,%dl
+  800b29:	74 0a                	je     800b35 <strfind+0x15>
+  800b2b:	84 d2                	test   %dl,%dl
+  800b2d:	74 06                	je     800b35 <strfind+0x15>
+	for (; *s; s++)
+  800b2f:	48 83 c0 01          	add    $0x1,%rax
+  800b33:	eb ee                	jmp    800b23 <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800b35:	c3                   	ret
+
+0000000000800b36 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800b36:	48 85 d2             	test   %rdx,%rdx
+  800b39:	74 28                	je     800b63 <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800b3b:	48 89 f8             	mov    %rdi,%rax
+  800b3e:	48 09 d0             	or     %rdx,%rax
+  800b41:	a8 03                	test   $0x3,%al
+  800b43:	75 16                	jne    800b5b <memset+0x25>
+		c &= 0xFF;
+  800b45:	40 0f b6 f6          	movzbl %sil,%esi
+  800b49:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b4f:	48 89 d1             	mov    %rdx,%rcx
+  800b52:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800b56:	fc                   	cld
+  800b57:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800b59:	eb 08                	jmp    800b63 <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b5b:	89 f0                	mov    %esi,%eax
+  800b5d:	48 89 d1             	mov    %rdx,%rcx
+  800b60:	fc                   	cld
+  800b61:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b63:	48 89 f8             	mov    %rdi,%rax
+  800b66:	c3                   	ret
+
+0000000000800b67 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b67:	48 89 f8             	mov    %rdi,%rax
+  800b6a:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b6d:	48 39 fe             	cmp    %rdi,%rsi
+  800b70:	73 3a                	jae    800bac <memmove+0x45>
+  800b72:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800b76:	48 39 d7             	cmp    %rdx,%rdi
+  800b79:	73 31                	jae    800bac <memmove+0x45>
+		s += n;
+		d += n;
+  800b7b:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800b7f:	48 89 d6             	mov    %rdx,%rsi
+  800b82:	48 09 fe             	or     %rdi,%rsi
+  800b85:	48 09 ce             	or     %rcx,%rsi
+  800b88:	40 f6 c6 03          	test   $0x3,%sil
+  800b8c:	75 11                	jne    800b9f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b8e:	48 83 ef 04          	sub    $0x4,%rdi
+  800b92:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800b96:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800b9a:	fd                   	std
+  800b9b:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800b9d:	eb 0b                	jmp    800baa <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b9f:	48 83 ef 01          	sub    $0x1,%rdi
+  800ba3:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800ba7:	fd                   	std
+  800ba8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800baa:	fc                   	cld
+  800bab:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800bac:	48 89 f2             	mov    %rsi,%rdx
+  800baf:	48 09 c2             	or     %rax,%rdx
+  800bb2:	48 09 ca             	or     %rcx,%rdx
+  800bb5:	f6 c2 03             	test   $0x3,%dl
+  800bb8:	75 0b                	jne    800bc5 <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bba:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800bbe:	48 89 c7             	mov    %rax,%rdi
+  800bc1:	fc                   	cld
+  800bc2:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800bc4:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800bc5:	48 89 c7             	mov    %rax,%rdi
+  800bc8:	fc                   	cld
+  800bc9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800bcb:	c3                   	ret
+
+0000000000800bcc <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bcc:	55                   	push   %rbp
+  800bcd:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800bd0:	48 b8 67 0b 80 00 00 	movabs $0x800b67,%rax
+  800bd7:	00 00 00 
+  800bda:	ff d0                	call   *%rax
+}
+  800bdc:	5d                   	pop    %rbp
+  800bdd:	c3                   	ret
+
+0000000000800bde <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800bde:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be3:	48 39 c2             	cmp    %rax,%rdx
+  800be6:	74 1e                	je     800c06 <memcmp+0x28>
+		if (*s1 != *s2)
+  800be8:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800bec:	48 83 c0 01          	add    $0x1,%rax
+  800bf0:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800bf6:	44 38 c1             	cmp    %r8b,%cl
+  800bf9:	74 e8                	je     800be3 <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800bfb:	0f b6 c1             	movzbl %cl,%eax
+  800bfe:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800c02:	44 29 c0             	sub    %r8d,%eax
+  800c05:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800c06:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c0b:	c3                   	ret
+
+0000000000800c0c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c0c:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800c0f:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800c12:	eb 04                	jmp    800c18 <memfind+0xc>
+  800c14:	48 83 c0 01          	add    $0x1,%rax
+  800c18:	48 39 d0             	cmp    %rdx,%rax
+  800c1b:	73 05                	jae    800c22 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c1d:	40 38 30             	cmp    %sil,(%rax)
+  800c20:	75 f2                	jne    800c14 <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800c22:	c3                   	ret
+
+0000000000800c23 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c23:	48 89 f9             	mov    %rdi,%rcx
+  800c26:	49 89 f0             	mov    %rsi,%r8
+  800c29:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c2b:	eb 04                	jmp    800c31 <strtol+0xe>
+		s++;
+  800c2d:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800c31:	0f b6 01             	movzbl (%rcx),%eax
+  800c34:	3c 20                	cmp    $0x20,%al
+  800c36:	74 f5                	je     800c2d <strtol+0xa>
+  800c38:	3c 09                	cmp    $0x9,%al
+  800c3a:	74 f1                	je     800c2d <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c3c:	3c 2b                	cmp    $0x2b,%al
+  800c3e:	74 2b                	je     800c6b <strtol+0x48>
+	int neg = 0;
+  800c40:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800c46:	3c 2d                	cmp    $0x2d,%al
+  800c48:	74 2d                	je     800c77 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c4a:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800c50:	75 0f                	jne    800c61 <strtol+0x3e>
+  800c52:	80 39 30             	cmpb   $0x30,(%rcx)
+  800c55:	74 2c                	je     800c83 <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c57:	85 ff                	test   %edi,%edi
+  800c59:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c5e:	0f 44 f8             	cmove  %eax,%edi
+  800c61:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800c66:	4c 63 d7             	movslq %edi,%r10
+  800c69:	eb 4f                	jmp    800cba <strtol+0x97>
+		s++;
+  800c6b:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800c6f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800c75:	eb d3                	jmp    800c4a <strtol+0x27>
+		s++, neg = 1;
+  800c77:	48 83 c1 01          	add    $0x1,%rcx
+  800c7b:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800c81:	eb c7                	jmp    800c4a <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c83:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800c87:	74 0f                	je     800c98 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800c89:	85 ff                	test   %edi,%edi
+  800c8b:	75 d4                	jne    800c61 <strtol+0x3e>
+		s++, base = 8;
+  800c8d:	48 83 c1 01          	add    $0x1,%rcx
+  800c91:	bf 08 00 00 00       	mov    $0x8,%edi
+  800c96:	eb c9                	jmp    800c61 <strtol+0x3e>
+		s += 2, base = 16;
+  800c98:	48 83 c1 02          	add    $0x2,%rcx
+  800c9c:	bf 10 00 00 00       	mov    $0x10,%edi
+  800ca1:	eb be                	jmp    800c61 <strtol+0x3e>
+			dig = *s - '0';
+  800ca3:	0f be c0             	movsbl %al,%eax
+  800ca6:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800ca9:	39 f8                	cmp    %edi,%eax
+  800cab:	7d 3b                	jge    800ce8 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800cad:	48 83 c1 01          	add    $0x1,%rcx
+  800cb1:	49 0f af d2          	imul   %r10,%rdx
+  800cb5:	48 98                	cltq
+  800cb7:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800cba:	0f b6 01             	movzbl (%rcx),%eax
+  800cbd:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800cc0:	40 80 fe 09          	cmp    $0x9,%sil
+  800cc4:	76 dd                	jbe    800ca3 <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800cc6:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800cc9:	40 80 fe 19          	cmp    $0x19,%sil
+  800ccd:	77 08                	ja     800cd7 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800ccf:	0f be c0             	movsbl %al,%eax
+  800cd2:	83 e8 57             	sub    $0x57,%eax
+  800cd5:	eb d2                	jmp    800ca9 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cd7:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800cda:	40 80 fe 19          	cmp    $0x19,%sil
+  800cde:	77 08                	ja     800ce8 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800ce0:	0f be c0             	movsbl %al,%eax
+  800ce3:	83 e8 37             	sub    $0x37,%eax
+  800ce6:	eb c1                	jmp    800ca9 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ce8:	4d 85 c0             	test   %r8,%r8
+  800ceb:	74 03                	je     800cf0 <strtol+0xcd>
+		*endptr = (char *) s;
+  800ced:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800cf0:	48 89 d0             	mov    %rdx,%rax
+  800cf3:	48 f7 d8             	neg    %rax
+  800cf6:	45 85 c9             	test   %r9d,%r9d
+  800cf9:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800cfd:	48 89 d0             	mov    %rdx,%rax
+  800d00:	c3                   	ret
+
+0000000000800d01 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800d01:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800d07:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800d0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d17:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800d19:	c3                   	ret
+
+0000000000800d1a <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800d1a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800d20:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800d26:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d2b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d30:	48 89 fe             	mov    %rdi,%rsi
+  800d33:	48 89 fa             	mov    %rdi,%rdx
+  800d36:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d38:	c3                   	ret
+
+0000000000800d39 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800d39:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800d3c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800d42:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800d48:	be 00 00 00 00       	mov    $0x0,%esi
+  800d4d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d52:	48 89 f2             	mov    %rsi,%rdx
+  800d55:	0f 05                	syscall
+	if(check && ret > 0)
+  800d57:	48 85 c0             	test   %rax,%rax
+  800d5a:	7f 01                	jg     800d5d <sys_env_destroy+0x24>
+}
+  800d5c:	c3                   	ret
+{
+  800d5d:	55                   	push   %rbp
+  800d5e:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d61:	49 89 c0             	mov    %rax,%r8
+  800d64:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800d69:	48 ba a8 16 80 00 00 	movabs $0x8016a8,%rdx
+  800d70:	00 00 00 
+  800d73:	be 28 00 00 00       	mov    $0x28,%esi
+  800d78:	48 bf c5 16 80 00 00 	movabs $0x8016c5,%rdi
+  800d7f:	00 00 00 
+  800d82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d87:	49 b9 bc 11 80 00 00 	movabs $0x8011bc,%r9
+  800d8e:	00 00 00 
+  800d91:	41 ff d1             	call   *%r9
+
+0000000000800d94 <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800d94:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800d9b:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800d9c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800da1:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800da5:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800da9:	48 c1 e2 04          	shl    $0x4,%rdx
+  800dad:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800db4:	00 00 00 
+  800db7:	48 01 d0             	add    %rdx,%rax
+  800dba:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800dc0:	c3                   	ret
+
+0000000000800dc1 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800dc1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800dc7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800dcd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dd2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dd7:	48 89 fe             	mov    %rdi,%rsi
+  800dda:	48 89 fa             	mov    %rdi,%rdx
+  800ddd:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ddf:	c3                   	ret
+
+0000000000800de0 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  800de0:	48 63 d2             	movslq %edx,%rdx
+  800de3:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800de6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800dec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800df2:	b8 04 00 00 00       	mov    $0x4,%eax
+  800df7:	0f 05                	syscall
+	if(check && ret > 0)
+  800df9:	48 85 c0             	test   %rax,%rax
+  800dfc:	7f 01                	jg     800dff <sys_page_alloc+0x1f>
+}
+  800dfe:	c3                   	ret
+{
+  800dff:	55                   	push   %rbp
+  800e00:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e03:	49 89 c0             	mov    %rax,%r8
+  800e06:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800e0b:	48 ba a8 16 80 00 00 	movabs $0x8016a8,%rdx
+  800e12:	00 00 00 
+  800e15:	be 28 00 00 00       	mov    $0x28,%esi
+  800e1a:	48 bf c5 16 80 00 00 	movabs $0x8016c5,%rdi
+  800e21:	00 00 00 
+  800e24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e29:	49 b9 bc 11 80 00 00 	movabs $0x8011bc,%r9
+  800e30:	00 00 00 
+  800e33:	41 ff d1             	call   *%r9
+
+0000000000800e36 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  800e36:	48 63 d2             	movslq %edx,%rdx
+  800e39:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800e3c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800e42:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800e48:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e4d:	0f 05                	syscall
+	if(check && ret > 0)
+  800e4f:	48 85 c0             	test   %rax,%rax
+  800e52:	7f 01                	jg     800e55 <sys_page_alloc_huge+0x1f>
+}
+  800e54:	c3                   	ret
+{
+  800e55:	55                   	push   %rbp
+  800e56:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e59:	49 89 c0             	mov    %rax,%r8
+  800e5c:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800e61:	48 ba a8 16 80 00 00 	movabs $0x8016a8,%rdx
+  800e68:	00 00 00 
+  800e6b:	be 28 00 00 00       	mov    $0x28,%esi
+  800e70:	48 bf c5 16 80 00 00 	movabs $0x8016c5,%rdi
+  800e77:	00 00 00 
+  800e7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e7f:	49 b9 bc 11 80 00 00 	movabs $0x8011bc,%r9
+  800e86:	00 00 00 
+  800e89:	41 ff d1             	call   *%r9
+
+0000000000800e8c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e8c:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  800e8f:	48 63 d2             	movslq %edx,%rdx
+  800e92:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800e95:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  800e98:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e9d:	0f 05                	syscall
+	if(check && ret > 0)
+  800e9f:	48 85 c0             	test   %rax,%rax
+  800ea2:	7f 01                	jg     800ea5 <sys_page_map+0x19>
+}
+  800ea4:	c3                   	ret
+{
+  800ea5:	55                   	push   %rbp
+  800ea6:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ea9:	49 89 c0             	mov    %rax,%r8
+  800eac:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800eb1:	48 ba a8 16 80 00 00 	movabs $0x8016a8,%rdx
+  800eb8:	00 00 00 
+  800ebb:	be 28 00 00 00       	mov    $0x28,%esi
+  800ec0:	48 bf c5 16 80 00 00 	movabs $0x8016c5,%rdi
+  800ec7:	00 00 00 
+  800eca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ecf:	49 b9 bc 11 80 00 00 	movabs $0x8011bc,%r9
+  800ed6:	00 00 00 
+  800ed9:	41 ff d1             	call   *%r9
+
+0000000000800edc <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  800edc:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800edf:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800ee5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800eeb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef0:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ef5:	0f 05                	syscall
+	if(check && ret > 0)
+  800ef7:	48 85 c0             	test   %rax,%rax
+  800efa:	7f 01                	jg     800efd <sys_page_unmap+0x21>
+}
+  800efc:	c3                   	ret
+{
+  800efd:	55                   	push   %rbp
+  800efe:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f01:	49 89 c0             	mov    %rax,%r8
+  800f04:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800f09:	48 ba a8 16 80 00 00 	movabs $0x8016a8,%rdx
+  800f10:	00 00 00 
+  800f13:	be 28 00 00 00       	mov    $0x28,%esi
+  800f18:	48 bf c5 16 80 00 00 	movabs $0x8016c5,%rdi
+  800f1f:	00 00 00 
+  800f22:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f27:	49 b9 bc 11 80 00 00 	movabs $0x8011bc,%r9
+  800f2e:	00 00 00 
+  800f31:	41 ff d1             	call   *%r9
+
+0000000000800f34 <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  800f34:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f3a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f40:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f45:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f4a:	48 89 fe             	mov    %rdi,%rsi
+  800f4d:	48 89 fa             	mov    %rdi,%rdx
+  800f50:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f52:	c3                   	ret
+
+0000000000800f53 <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  800f53:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f59:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f64:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f69:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  800f6b:	c3                   	ret
+
+0000000000800f6c <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  800f6c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f72:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f78:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f7d:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  800f7f:	c3                   	ret
+
+0000000000800f80 <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  800f80:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  800f83:	48 63 f6             	movslq %esi,%rsi
+  800f86:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800f89:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f8f:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f94:	0f 05                	syscall
+	if(check && ret > 0)
+  800f96:	48 85 c0             	test   %rax,%rax
+  800f99:	7f 01                	jg     800f9c <sys_page_batch+0x1c>
+}
+  800f9b:	c3                   	ret
+{
+  800f9c:	55                   	push   %rbp
+  800f9d:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa0:	49 89 c0             	mov    %rax,%r8
+  800fa3:	b9 12 00 00 00       	mov    $0x12,%ecx
+  800fa8:	48 ba a8 16 80 00 00 	movabs $0x8016a8,%rdx
+  800faf:	00 00 00 
+  800fb2:	be 28 00 00 00       	mov    $0x28,%esi
+  800fb7:	48 bf c5 16 80 00 00 	movabs $0x8016c5,%rdi
+  800fbe:	00 00 00 
+  800fc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc6:	49 b9 bc 11 80 00 00 	movabs $0x8011bc,%r9
+  800fcd:	00 00 00 
+  800fd0:	41 ff d1             	call   *%r9
+
+0000000000800fd3 <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  800fd3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fd9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fdf:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe4:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fe9:	48 89 f2             	mov    %rsi,%rdx
+  800fec:	0f 05                	syscall
+	if(check && ret > 0)
+  800fee:	48 85 c0             	test   %rax,%rax
+  800ff1:	7f 01                	jg     800ff4 <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  800ff3:	c3                   	ret
+{
+  800ff4:	55                   	push   %rbp
+  800ff5:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff8:	49 89 c0             	mov    %rax,%r8
+  800ffb:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801000:	48 ba a8 16 80 00 00 	movabs $0x8016a8,%rdx
+  801007:	00 00 00 
+  80100a:	be 28 00 00 00       	mov    $0x28,%esi
+  80100f:	48 bf c5 16 80 00 00 	movabs $0x8016c5,%rdi
+  801016:	00 00 00 
+  801019:	b8 00 00 00 00       	mov    $0x0,%eax
+  80101e:	49 b9 bc 11 80 00 00 	movabs $0x8011bc,%r9
+  801025:	00 00 00 
+  801028:	41 ff d1             	call   *%r9
+
+000000000080102b <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  80102b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801031:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801037:	bf 00 00 00 00       	mov    $0x0,%edi
+  80103c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801041:	48 89 fe             	mov    %rdi,%rsi
+  801044:	48 89 fa             	mov    %rdi,%rdx
+  801047:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801049:	c3                   	ret
+
+000000000080104a <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  80104a:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80104d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801053:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801059:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80105e:	0f 05                	syscall
+	if(check && ret > 0)
+  801060:	48 85 c0             	test   %rax,%rax
+  801063:	7f 01                	jg     801066 <sys_page_unmap_range+0x1c>
+}
+  801065:	c3                   	ret
+{
+  801066:	55                   	push   %rbp
+  801067:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106a:	49 89 c0             	mov    %rax,%r8
+  80106d:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801072:	48 ba a8 16 80 00 00 	movabs $0x8016a8,%rdx
+  801079:	00 00 00 
+  80107c:	be 28 00 00 00       	mov    $0x28,%esi
+  801081:	48 bf c5 16 80 00 00 	movabs $0x8016c5,%rdi
+  801088:	00 00 00 
+  80108b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801090:	49 b9 bc 11 80 00 00 	movabs $0x8011bc,%r9
+  801097:	00 00 00 
+  80109a:	41 ff d1             	call   *%r9
+
+000000000080109d <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80109d:	48 63 f6             	movslq %esi,%rsi
+  8010a0:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8010a3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b4:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010b9:	0f 05                	syscall
+	if(check && ret > 0)
+  8010bb:	48 85 c0             	test   %rax,%rax
+  8010be:	7f 01                	jg     8010c1 <sys_env_set_status+0x24>
+}
+  8010c0:	c3                   	ret
+{
+  8010c1:	55                   	push   %rbp
+  8010c2:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010c5:	49 89 c0             	mov    %rax,%r8
+  8010c8:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8010cd:	48 ba a8 16 80 00 00 	movabs $0x8016a8,%rdx
+  8010d4:	00 00 00 
+  8010d7:	be 28 00 00 00       	mov    $0x28,%esi
+  8010dc:	48 bf c5 16 80 00 00 	movabs $0x8016c5,%rdi
+  8010e3:	00 00 00 
+  8010e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010eb:	49 b9 bc 11 80 00 00 	movabs $0x8011bc,%r9
+  8010f2:	00 00 00 
+  8010f5:	41 ff d1             	call   *%r9
+
+00000000008010f8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8010f8:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8010fb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801101:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801107:	ba 00 00 00 00       	mov    $0x0,%edx
+  80110c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801111:	0f 05                	syscall
+	if(check && ret > 0)
+  801113:	48 85 c0             	test   %rax,%rax
+  801116:	7f 01                	jg     801119 <sys_env_set_pgfault_upcall+0x21>
+}
+  801118:	c3                   	ret
+{
+  801119:	55                   	push   %rbp
+  80111a:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80111d:	49 89 c0             	mov    %rax,%r8
+  801120:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801125:	48 ba a8 16 80 00 00 	movabs $0x8016a8,%rdx
+  80112c:	00 00 00 
+  80112f:	be 28 00 00 00       	mov    $0x28,%esi
+  801134:	48 bf c5 16 80 00 00 	movabs $0x8016c5,%rdi
+  80113b:	00 00 00 
+  80113e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801143:	49 b9 bc 11 80 00 00 	movabs $0x8011bc,%r9
+  80114a:	00 00 00 
+  80114d:	41 ff d1             	call   *%r9
+
+0000000000801150 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  801150:	48 63 ff             	movslq %edi,%rdi
+  801153:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  801156:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80115c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801161:	0f 05                	syscall
+}
+  801163:	c3                   	ret
+
+0000000000801164 <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  801164:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80116a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801170:	be 00 00 00 00       	mov    $0x0,%esi
+  801175:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80117a:	48 89 f2             	mov    %rsi,%rdx
+  80117d:	0f 05                	syscall
+	if(check && ret > 0)
+  80117f:	48 85 c0             	test   %rax,%rax
+  801182:	7f 01                	jg     801185 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  801184:	c3                   	ret
+{
+  801185:	55                   	push   %rbp
+  801186:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801189:	49 89 c0             	mov    %rax,%r8
+  80118c:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801191:	48 ba a8 16 80 00 00 	movabs $0x8016a8,%rdx
+  801198:	00 00 00 
+  80119b:	be 28 00 00 00       	mov    $0x28,%esi
+  8011a0:	48 bf c5 16 80 00 00 	movabs $0x8016c5,%rdi
+  8011a7:	00 00 00 
+  8011aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011af:	49 b9 bc 11 80 00 00 	movabs $0x8011bc,%r9
+  8011b6:	00 00 00 
+  8011b9:	41 ff d1             	call   *%r9
+
+00000000008011bc <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8011bc:	55                   	push   %rbp
+  8011bd:	48 89 e5             	mov    %rsp,%rbp
+  8011c0:	41 56                	push   %r14
+  8011c2:	41 55                	push   %r13
+  8011c4:	41 54                	push   %r12
+  8011c6:	53                   	push   %rbx
+  8011c7:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8011ce:	49 89 fc             	mov    %rdi,%r12
+  8011d1:	41 89 f5             	mov    %esi,%r13d
+  8011d4:	48 89 d3             	mov    %rdx,%rbx
+  8011d7:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8011de:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8011e5:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8011ec:	84 c0                	test   %al,%al
+  8011ee:	74 26                	je     801216 <_panic+0x5a>
+  8011f0:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8011f7:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8011fe:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  801202:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  801206:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  80120a:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80120e:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  801212:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801216:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  80121d:	00 00 00 
+  801220:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  801227:	00 00 00 
+  80122a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80122e:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  801235:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  80123c:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801243:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  80124a:	00 00 00 
+  80124d:	4c 8b 30             	mov    (%rax),%r14
+  801250:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  801257:	00 00 00 
+  80125a:	ff d0                	call   *%rax
+  80125c:	89 c6                	mov    %eax,%esi
+  80125e:	45 89 e8             	mov    %r13d,%r8d
+  801261:	4c 89 e1             	mov    %r12,%rcx
+  801264:	4c 89 f2             	mov    %r14,%rdx
+  801267:	48 bf d8 16 80 00 00 	movabs $0x8016d8,%rdi
+  80126e:	00 00 00 
+  801271:	b8 00 00 00 00       	mov    $0x0,%eax
+  801276:	49 bc 5c 01 80 00 00 	movabs $0x80015c,%r12
+  80127d:	00 00 00 
+  801280:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801283:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  80128a:	48 89 df             	mov    %rbx,%rdi
+  80128d:	48 b8 f8 00 80 00 00 	movabs $0x8000f8,%rax
+  801294:	00 00 00 
+  801297:	ff d0                	call   *%rax
+	cprintf("\n");
+  801299:	48 bf cc 12 80 00 00 	movabs $0x8012cc,%rdi
+  8012a0:	00 00 00 
+  8012a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a8:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8012ab:	cc                   	int3
+	while (1)
+  8012ac:	eb fd                	jmp    8012ab <_panic+0xef>
@@ -0,0 +1,2490 @@
+
+obj/user/dumbfork:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a1 02 00 00       	call   8002d2 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <duppage>:
+	}
+}
+
+void
+duppage(envid_t dstenv, void *addr)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	41 54                	push   %r12
+  800039:	53                   	push   %rbx
+  80003a:	41 89 fc             	mov    %edi,%r12d
+  80003d:	48 89 f3             	mov    %rsi,%rbx
+	int r;
+
+	// This is NOT what you should do in your fork.
+	if ((r = sys_page_alloc(dstenv, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  800040:	ba 07 00 00 00       	mov    $0x7,%edx
+  800045:	48 b8 3b 11 80 00 00 	movabs $0x80113b,%rax
+  80004c:	00 00 00 
+  80004f:	ff d0                	call   *%rax
+  800051:	85 c0                	test   %eax,%eax
+  800053:	78 5e                	js     8000b3 <duppage+0x80>
+		panic("sys_page_alloc: %e", r);
+	if ((r = sys_page_map(dstenv, addr, 0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  800055:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  80005b:	b9 00 00 40 00       	mov    $0x400000,%ecx
+  800060:	ba 00 00 00 00       	mov    $0x0,%edx
+  800065:	48 89 de             	mov    %rbx,%rsi
+  800068:	44 89 e7             	mov    %r12d,%edi
+  80006b:	48 b8 e7 11 80 00 00 	movabs $0x8011e7,%rax
+  800072:	00 00 00 
+  800075:	ff d0                	call   *%rax
+  800077:	85 c0                	test   %eax,%eax
+  800079:	78 65                	js     8000e0 <duppage+0xad>
+		panic("sys_page_map: %e", r);
+	memmove(UTEMP, addr, PGSIZE);
+  80007b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800080:	48 89 de             	mov    %rbx,%rsi
+  800083:	bf 00 00 40 00       	mov    $0x400000,%edi
+  800088:	48 b8 c2 0e 80 00 00 	movabs $0x800ec2,%rax
+  80008f:	00 00 00 
+  800092:	ff d0                	call   *%rax
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  800094:	be 00 00 40 00       	mov    $0x400000,%esi
+  800099:	bf 00 00 00 00       	mov    $0x0,%edi
+  80009e:	48 b8 37 12 80 00 00 	movabs $0x801237,%rax
+  8000a5:	00 00 00 
+  8000a8:	ff d0                	call   *%rax
+  8000aa:	85 c0                	test   %eax,%eax
+  8000ac:	78 5f                	js     80010d <duppage+0xda>
+		panic("sys_page_unmap: %e", r);
+}
+  8000ae:	5b                   	pop    %rbx
+  8000af:	41 5c                	pop    %r12
+  8000b1:	5d                   	pop    %rbp
+  8000b2:	c3                   	ret
+		panic("sys_page_alloc: %e", r);
+  8000b3:	89 c1                	mov    %eax,%ecx
+  8000b5:	48 ba 20 15 80 00 00 	movabs $0x801520,%rdx
+  8000bc:	00 00 00 
+  8000bf:	be 20 00 00 00       	mov    $0x20,%esi
+  8000c4:	48 bf 33 15 80 00 00 	movabs $0x801533,%rdi
+  8000cb:	00 00 00 
+  8000ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d3:	49 b8 18 03 80 00 00 	movabs $0x800318,%r8
+  8000da:	00 00 00 
+  8000dd:	41 ff d0             	call   *%r8
+		panic("sys_page_map: %e", r);
+  8000e0:	89 c1                	mov    %eax,%ecx
+  8000e2:	48 ba 43 15 80 00 00 	movabs $0x801543,%rdx
+  8000e9:	00 00 00 
+  8000ec:	be 22 00 00 00       	mov    $0x22,%esi
+  8000f1:	48 bf 33 15 80 00 00 	movabs $0x801533,%rdi
+  8000f8:	00 00 00 
+  8000fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800100:	49 b8 18 03 80 00 00 	movabs $0x800318,%r8
+  800107:	00 00 00 
+  80010a:	41 ff d0             	call   *%r8
+		panic("sys_page_unmap: %e", r);
+  80010d:	89 c1                	mov    %eax,%ecx
+  80010f:	48 ba 54 15 80 00 00 	movabs $0x801554,%rdx
+  800116:	00 00 00 
+  800119:	be 25 00 00 00       	mov    $0x25,%esi
+  80011e:	48 bf 33 15 80 00 00 	movabs $0x801533,%rdi
+  800125:	00 00 00 
+  800128:	b8 00 00 00 00       	mov    $0x0,%eax
+  80012d:	49 b8 18 03 80 00 00 	movabs $0x800318,%r8
+  800134:	00 00 00 
+  800137:	41 ff d0             	call   *%r8
+
+000000000080013a <dumbfork>:
+
+envid_t
+dumbfork(void)
+{
+  80013a:	55                   	push   %rbp
+  80013b:	48 89 e5             	mov    %rsp,%rbp
+  80013e:	41 55                	push   %r13
+  800140:	41 54                	push   %r12
+  800142:	53                   	push   %rbx
+  800143:	48 83 ec 18          	sub    $0x18,%rsp
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  800147:	b8 07 00 00 00       	mov    $0x7,%eax
+  80014c:	cd 30                	int    $0x30
+  80014e:	89 c3                	mov    %eax,%ebx
+	// The kernel will initialize it with a copy of our register state,
+	// so that the child will appear to have called sys_exofork() too -
+	// except that in the child, this "fake" call to sys_exofork()
+	// will return 0 instead of the envid of the child.
+	envid = sys_exofork();
+	cprintf("envid:%x\n",envid);
+  800150:	89 c6                	mov    %eax,%esi
+  800152:	48 bf 67 15 80 00 00 	movabs $0x801567,%rdi
+  800159:	00 00 00 
+  80015c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800161:	48 ba b7 04 80 00 00 	movabs $0x8004b7,%rdx
+  800168:	00 00 00 
+  80016b:	ff d2                	call   *%rdx
+
+	if (envid < 0)
+  80016d:	85 db                	test   %ebx,%ebx
+  80016f:	78 21                	js     800192 <dumbfork+0x58>
+		panic("sys_exofork: %e", envid);
+	if (envid == 0) {
+  800171:	0f 84 91 00 00 00    	je     800208 <dumbfork+0xce>
+  800177:	be 00 00 80 00       	mov    $0x800000,%esi
+	}
+
+	// We're the parent.
+	// Eagerly copy our entire address space into the child.
+	// This is NOT what you should do in your fork implementation.
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+  80017c:	49 bc 08 20 80 00 00 	movabs $0x802008,%r12
+  800183:	00 00 00 
+		duppage(envid, addr);
+  800186:	49 bd 33 00 80 00 00 	movabs $0x800033,%r13
+  80018d:	00 00 00 
+  800190:	eb 3d                	jmp    8001cf <dumbfork+0x95>
+		panic("sys_exofork: %e", envid);
+  800192:	89 d9                	mov    %ebx,%ecx
+  800194:	48 ba 71 15 80 00 00 	movabs $0x801571,%rdx
+  80019b:	00 00 00 
+  80019e:	be 39 00 00 00       	mov    $0x39,%esi
+  8001a3:	48 bf 33 15 80 00 00 	movabs $0x801533,%rdi
+  8001aa:	00 00 00 
+  8001ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b2:	49 b8 18 03 80 00 00 	movabs $0x800318,%r8
+  8001b9:	00 00 00 
+  8001bc:	41 ff d0             	call   *%r8
+		duppage(envid, addr);
+  8001bf:	89 df                	mov    %ebx,%edi
+  8001c1:	41 ff d5             	call   *%r13
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+  8001c4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8001c8:	48 8d b0 00 10 00 00 	lea    0x1000(%rax),%rsi
+  8001cf:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001d3:	4c 39 e6             	cmp    %r12,%rsi
+  8001d6:	72 e7                	jb     8001bf <dumbfork+0x85>
+
+	// Also copy the stack we are currently running on.
+	duppage(envid, ROUNDDOWN(&addr, PGSIZE));
+  8001d8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8001dc:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8001e3:	89 df                	mov    %ebx,%edi
+  8001e5:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  8001ec:	00 00 00 
+  8001ef:	ff d0                	call   *%rax
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8001f1:	be 02 00 00 00       	mov    $0x2,%esi
+  8001f6:	89 df                	mov    %ebx,%edi
+  8001f8:	48 b8 f8 13 80 00 00 	movabs $0x8013f8,%rax
+  8001ff:	00 00 00 
+  800202:	ff d0                	call   *%rax
+  800204:	85 c0                	test   %eax,%eax
+  800206:	78 0d                	js     800215 <dumbfork+0xdb>
+		panic("sys_env_set_status: %e", r);
+
+	return envid;
+}
+  800208:	89 d8                	mov    %ebx,%eax
+  80020a:	48 83 c4 18          	add    $0x18,%rsp
+  80020e:	5b                   	pop    %rbx
+  80020f:	41 5c                	pop    %r12
+  800211:	41 5d                	pop    %r13
+  800213:	5d                   	pop    %rbp
+  800214:	c3                   	ret
+		panic("sys_env_set_status: %e", r);
+  800215:	89 c1                	mov    %eax,%ecx
+  800217:	48 ba 81 15 80 00 00 	movabs $0x801581,%rdx
+  80021e:	00 00 00 
+  800221:	be 4a 00 00 00       	mov    $0x4a,%esi
+  800226:	48 bf 33 15 80 00 00 	movabs $0x801533,%rdi
+  80022d:	00 00 00 
+  800230:	b8 00 00 00 00       	mov    $0x0,%eax
+  800235:	49 b8 18 03 80 00 00 	movabs $0x800318,%r8
+  80023c:	00 00 00 
+  80023f:	41 ff d0             	call   *%r8
+
+0000000000800242 <umain>:
+{
+  800242:	55                   	push   %rbp
+  800243:	48 89 e5             	mov    %rsp,%rbp
+  800246:	41 57                	push   %r15
+  800248:	41 56                	push   %r14
+  80024a:	41 55                	push   %r13
+  80024c:	41 54                	push   %r12
+  80024e:	53                   	push   %rbx
+  80024f:	48 83 ec 08          	sub    $0x8,%rsp
+	who = dumbfork();
+  800253:	48 b8 3a 01 80 00 00 	movabs $0x80013a,%rax
+  80025a:	00 00 00 
+  80025d:	ff d0                	call   *%rax
+  80025f:	41 89 c4             	mov    %eax,%r12d
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  800262:	85 c0                	test   %eax,%eax
+  800264:	49 bd 98 15 80 00 00 	movabs $0x801598,%r13
+  80026b:	00 00 00 
+  80026e:	48 b8 9f 15 80 00 00 	movabs $0x80159f,%rax
+  800275:	00 00 00 
+  800278:	4c 0f 44 e8          	cmove  %rax,%r13
+  80027c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  800281:	49 bf b7 04 80 00 00 	movabs $0x8004b7,%r15
+  800288:	00 00 00 
+		sys_yield();
+  80028b:	49 be 1c 11 80 00 00 	movabs $0x80111c,%r14
+  800292:	00 00 00 
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  800295:	eb 22                	jmp    8002b9 <umain+0x77>
+  800297:	83 fb 13             	cmp    $0x13,%ebx
+  80029a:	7f 27                	jg     8002c3 <umain+0x81>
+		cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  80029c:	4c 89 ea             	mov    %r13,%rdx
+  80029f:	89 de                	mov    %ebx,%esi
+  8002a1:	48 bf a5 15 80 00 00 	movabs $0x8015a5,%rdi
+  8002a8:	00 00 00 
+  8002ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b0:	41 ff d7             	call   *%r15
+		sys_yield();
+  8002b3:	41 ff d6             	call   *%r14
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  8002b6:	83 c3 01             	add    $0x1,%ebx
+  8002b9:	45 85 e4             	test   %r12d,%r12d
+  8002bc:	74 d9                	je     800297 <umain+0x55>
+  8002be:	83 fb 09             	cmp    $0x9,%ebx
+  8002c1:	7e d9                	jle    80029c <umain+0x5a>
+}
+  8002c3:	48 83 c4 08          	add    $0x8,%rsp
+  8002c7:	5b                   	pop    %rbx
+  8002c8:	41 5c                	pop    %r12
+  8002ca:	41 5d                	pop    %r13
+  8002cc:	41 5e                	pop    %r14
+  8002ce:	41 5f                	pop    %r15
+  8002d0:	5d                   	pop    %rbp
+  8002d1:	c3                   	ret
+
+00000000008002d2 <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  8002d2:	55                   	push   %rbp
+  8002d3:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002d6:	85 ff                	test   %edi,%edi
+  8002d8:	7e 0d                	jle    8002e7 <libmain+0x15>
+		binaryname = argv[0];
+  8002da:	48 8b 06             	mov    (%rsi),%rax
+  8002dd:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  8002e4:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  8002e7:	48 b8 42 02 80 00 00 	movabs $0x800242,%rax
+  8002ee:	00 00 00 
+  8002f1:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8002f3:	48 b8 01 03 80 00 00 	movabs $0x800301,%rax
+  8002fa:	00 00 00 
+  8002fd:	ff d0                	call   *%rax
+}
+  8002ff:	5d                   	pop    %rbp
+  800300:	c3                   	ret
+
+0000000000800301 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800301:	55                   	push   %rbp
+  800302:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  800305:	bf 00 00 00 00       	mov    $0x0,%edi
+  80030a:	48 b8 94 10 80 00 00 	movabs $0x801094,%rax
+  800311:	00 00 00 
+  800314:	ff d0                	call   *%rax
+}
+  800316:	5d                   	pop    %rbp
+  800317:	c3                   	ret
+
+0000000000800318 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800318:	55                   	push   %rbp
+  800319:	48 89 e5             	mov    %rsp,%rbp
+  80031c:	41 56                	push   %r14
+  80031e:	41 55                	push   %r13
+  800320:	41 54                	push   %r12
+  800322:	53                   	push   %rbx
+  800323:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80032a:	49 89 fc             	mov    %rdi,%r12
+  80032d:	41 89 f5             	mov    %esi,%r13d
+  800330:	48 89 d3             	mov    %rdx,%rbx
+  800333:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80033a:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800341:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800348:	84 c0                	test   %al,%al
+  80034a:	74 26                	je     800372 <_panic+0x5a>
+  80034c:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800353:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80035a:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  80035e:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800362:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800366:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80036a:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  80036e:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800372:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800379:	00 00 00 
+  80037c:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800383:	00 00 00 
+  800386:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80038a:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800391:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800398:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80039f:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  8003a6:	00 00 00 
+  8003a9:	4c 8b 30             	mov    (%rax),%r14
+  8003ac:	48 b8 ef 10 80 00 00 	movabs $0x8010ef,%rax
+  8003b3:	00 00 00 
+  8003b6:	ff d0                	call   *%rax
+  8003b8:	89 c6                	mov    %eax,%esi
+  8003ba:	45 89 e8             	mov    %r13d,%r8d
+  8003bd:	4c 89 e1             	mov    %r12,%rcx
+  8003c0:	4c 89 f2             	mov    %r14,%rdx
+  8003c3:	48 bf c8 15 80 00 00 	movabs $0x8015c8,%rdi
+  8003ca:	00 00 00 
+  8003cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d2:	49 bc b7 04 80 00 00 	movabs $0x8004b7,%r12
+  8003d9:	00 00 00 
+  8003dc:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8003df:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  8003e6:	48 89 df             	mov    %rbx,%rdi
+  8003e9:	48 b8 53 04 80 00 00 	movabs $0x800453,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+	cprintf("\n");
+  8003f5:	48 bf b5 15 80 00 00 	movabs $0x8015b5,%rdi
+  8003fc:	00 00 00 
+  8003ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800404:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800407:	cc                   	int3
+	while (1)
+  800408:	eb fd                	jmp    800407 <_panic+0xef>
+
+000000000080040a <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80040a:	55                   	push   %rbp
+  80040b:	48 89 e5             	mov    %rsp,%rbp
+  80040e:	53                   	push   %rbx
+  80040f:	48 83 ec 08          	sub    $0x8,%rsp
+  800413:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  800416:	8b 06                	mov    (%rsi),%eax
+  800418:	8d 50 01             	lea    0x1(%rax),%edx
+  80041b:	89 16                	mov    %edx,(%rsi)
+  80041d:	48 98                	cltq
+  80041f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  800424:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80042a:	74 0a                	je     800436 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80042c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800430:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800434:	c9                   	leave
+  800435:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800436:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80043a:	be ff 00 00 00       	mov    $0xff,%esi
+  80043f:	48 b8 5c 10 80 00 00 	movabs $0x80105c,%rax
+  800446:	00 00 00 
+  800449:	ff d0                	call   *%rax
+		b->idx = 0;
+  80044b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800451:	eb d9                	jmp    80042c <putch+0x22>
+
+0000000000800453 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800453:	55                   	push   %rbp
+  800454:	48 89 e5             	mov    %rsp,%rbp
+  800457:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80045e:	48 89 fa             	mov    %rdi,%rdx
+  800461:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  800464:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  80046b:	00 00 00 
+	b.cnt = 0;
+  80046e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800475:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800478:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  80047f:	48 bf 0a 04 80 00 00 	movabs $0x80040a,%rdi
+  800486:	00 00 00 
+  800489:	48 b8 71 06 80 00 00 	movabs $0x800671,%rax
+  800490:	00 00 00 
+  800493:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  800495:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  80049c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004a3:	48 b8 5c 10 80 00 00 	movabs $0x80105c,%rax
+  8004aa:	00 00 00 
+  8004ad:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  8004af:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  8004b5:	c9                   	leave
+  8004b6:	c3                   	ret
+
+00000000008004b7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004b7:	55                   	push   %rbp
+  8004b8:	48 89 e5             	mov    %rsp,%rbp
+  8004bb:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8004c2:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8004c9:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8004d0:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8004d7:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8004de:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8004e5:	84 c0                	test   %al,%al
+  8004e7:	74 20                	je     800509 <cprintf+0x52>
+  8004e9:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8004ed:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8004f1:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8004f5:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8004f9:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8004fd:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800501:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800505:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800509:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  800510:	00 00 00 
+  800513:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80051a:	00 00 00 
+  80051d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800521:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800528:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80052f:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  800536:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  80053d:	48 b8 53 04 80 00 00 	movabs $0x800453,%rax
+  800544:	00 00 00 
+  800547:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  800549:	c9                   	leave
+  80054a:	c3                   	ret
+
+000000000080054b <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80054b:	55                   	push   %rbp
+  80054c:	48 89 e5             	mov    %rsp,%rbp
+  80054f:	41 57                	push   %r15
+  800551:	41 56                	push   %r14
+  800553:	41 55                	push   %r13
+  800555:	41 54                	push   %r12
+  800557:	53                   	push   %rbx
+  800558:	48 83 ec 18          	sub    $0x18,%rsp
+  80055c:	49 89 fc             	mov    %rdi,%r12
+  80055f:	49 89 f5             	mov    %rsi,%r13
+  800562:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800566:	44 89 c3             	mov    %r8d,%ebx
+  800569:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80056c:	41 89 cf             	mov    %ecx,%r15d
+  80056f:	4c 39 fa             	cmp    %r15,%rdx
+  800572:	72 29                	jb     80059d <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800574:	48 89 d0             	mov    %rdx,%rax
+  800577:	ba 00 00 00 00       	mov    $0x0,%edx
+  80057c:	49 f7 f7             	div    %r15
+  80057f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800583:	48 89 c2             	mov    %rax,%rdx
+  800586:	48 b8 4b 05 80 00 00 	movabs $0x80054b,%rax
+  80058d:	00 00 00 
+  800590:	ff d0                	call   *%rax
+  800592:	eb 10                	jmp    8005a4 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800594:	4c 89 ee             	mov    %r13,%rsi
+  800597:	44 89 f7             	mov    %r14d,%edi
+  80059a:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  80059d:	83 eb 01             	sub    $0x1,%ebx
+  8005a0:	85 db                	test   %ebx,%ebx
+  8005a2:	7f f0                	jg     800594 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8005a4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ad:	49 f7 f7             	div    %r15
+  8005b0:	48 b8 eb 15 80 00 00 	movabs $0x8015eb,%rax
+  8005b7:	00 00 00 
+  8005ba:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  8005be:	4c 89 ee             	mov    %r13,%rsi
+  8005c1:	41 ff d4             	call   *%r12
+}
+  8005c4:	48 83 c4 18          	add    $0x18,%rsp
+  8005c8:	5b                   	pop    %rbx
+  8005c9:	41 5c                	pop    %r12
+  8005cb:	41 5d                	pop    %r13
+  8005cd:	41 5e                	pop    %r14
+  8005cf:	41 5f                	pop    %r15
+  8005d1:	5d                   	pop    %rbp
+  8005d2:	c3                   	ret
+
+00000000008005d3 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  8005d3:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  8005d7:	48 8b 06             	mov    (%rsi),%rax
+  8005da:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8005de:	73 0a                	jae    8005ea <sprintputch+0x17>
+		*b->buf++ = ch;
+  8005e0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8005e4:	48 89 16             	mov    %rdx,(%rsi)
+  8005e7:	40 88 38             	mov    %dil,(%rax)
+}
+  8005ea:	c3                   	ret
+
+00000000008005eb <printfmt>:
+{
+  8005eb:	55                   	push   %rbp
+  8005ec:	48 89 e5             	mov    %rsp,%rbp
+  8005ef:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8005f6:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8005fd:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800604:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80060b:	84 c0                	test   %al,%al
+  80060d:	74 20                	je     80062f <printfmt+0x44>
+  80060f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800613:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800617:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80061b:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80061f:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800623:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800627:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80062b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  80062f:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800636:	00 00 00 
+  800639:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800640:	00 00 00 
+  800643:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800647:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80064e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800655:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80065c:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800663:	48 b8 71 06 80 00 00 	movabs $0x800671,%rax
+  80066a:	00 00 00 
+  80066d:	ff d0                	call   *%rax
+}
+  80066f:	c9                   	leave
+  800670:	c3                   	ret
+
+0000000000800671 <vprintfmt>:
+{
+  800671:	55                   	push   %rbp
+  800672:	48 89 e5             	mov    %rsp,%rbp
+  800675:	41 57                	push   %r15
+  800677:	41 56                	push   %r14
+  800679:	41 55                	push   %r13
+  80067b:	41 54                	push   %r12
+  80067d:	53                   	push   %rbx
+  80067e:	48 83 ec 48          	sub    $0x48,%rsp
+  800682:	49 89 fe             	mov    %rdi,%r14
+  800685:	49 89 f5             	mov    %rsi,%r13
+  800688:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  80068b:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  80068f:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  800693:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800697:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80069b:	eb 09                	jmp    8006a6 <vprintfmt+0x35>
+			putch(ch, putdat);
+  80069d:	4c 89 ee             	mov    %r13,%rsi
+  8006a0:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006a3:	4c 89 e3             	mov    %r12,%rbx
+  8006a6:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8006aa:	0f b6 3b             	movzbl (%rbx),%edi
+  8006ad:	83 ff 25             	cmp    $0x25,%edi
+  8006b0:	74 13                	je     8006c5 <vprintfmt+0x54>
+			if (ch == '\0')
+  8006b2:	85 ff                	test   %edi,%edi
+  8006b4:	75 e7                	jne    80069d <vprintfmt+0x2c>
+}
+  8006b6:	48 83 c4 48          	add    $0x48,%rsp
+  8006ba:	5b                   	pop    %rbx
+  8006bb:	41 5c                	pop    %r12
+  8006bd:	41 5d                	pop    %r13
+  8006bf:	41 5e                	pop    %r14
+  8006c1:	41 5f                	pop    %r15
+  8006c3:	5d                   	pop    %rbp
+  8006c4:	c3                   	ret
+		padc = ' ';
+  8006c5:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  8006c9:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  8006d0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  8006d6:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  8006dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8006e2:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006e7:	41 0f b6 14 24       	movzbl (%r12),%edx
+  8006ec:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  8006ef:	3c 55                	cmp    $0x55,%al
+  8006f1:	0f 87 4f 05 00 00    	ja     800c46 <vprintfmt+0x5d5>
+  8006f7:	0f b6 c0             	movzbl %al,%eax
+  8006fa:	48 be c0 16 80 00 00 	movabs $0x8016c0,%rsi
+  800701:	00 00 00 
+  800704:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  800707:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  80070a:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  80070e:	eb d2                	jmp    8006e2 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800710:	49 89 dc             	mov    %rbx,%r12
+  800713:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  800717:	eb c9                	jmp    8006e2 <vprintfmt+0x71>
+  800719:	0f b6 d2             	movzbl %dl,%edx
+  80071c:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  80071f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  800725:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800729:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  80072e:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  800733:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  800736:	83 f8 09             	cmp    $0x9,%eax
+  800739:	77 20                	ja     80075b <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  80073b:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  80073f:	eb e4                	jmp    800725 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  800741:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800744:	83 f8 2f             	cmp    $0x2f,%eax
+  800747:	77 27                	ja     800770 <vprintfmt+0xff>
+  800749:	89 c2                	mov    %eax,%edx
+  80074b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80074f:	83 c0 08             	add    $0x8,%eax
+  800752:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800755:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  800758:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  80075b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80075f:	79 81                	jns    8006e2 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  800761:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  800765:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80076b:	e9 72 ff ff ff       	jmp    8006e2 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  800770:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800774:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800778:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80077c:	eb d7                	jmp    800755 <vprintfmt+0xe4>
+			if (width < 0)
+  80077e:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  800781:	85 f6                	test   %esi,%esi
+  800783:	b8 00 00 00 00       	mov    $0x0,%eax
+  800788:	0f 49 c6             	cmovns %esi,%eax
+  80078b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80078e:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800791:	e9 4c ff ff ff       	jmp    8006e2 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800796:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  800799:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  8007a0:	e9 3d ff ff ff       	jmp    8006e2 <vprintfmt+0x71>
+			lflag++;
+  8007a5:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8007a8:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8007ab:	e9 32 ff ff ff       	jmp    8006e2 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  8007b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b6:	77 19                	ja     8007d1 <vprintfmt+0x160>
+  8007b8:	89 c2                	mov    %eax,%edx
+  8007ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007be:	83 c0 08             	add    $0x8,%eax
+  8007c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c4:	8b 3a                	mov    (%rdx),%edi
+  8007c6:	4c 89 ee             	mov    %r13,%rsi
+  8007c9:	41 ff d6             	call   *%r14
+			break;
+  8007cc:	e9 d5 fe ff ff       	jmp    8006a6 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  8007d1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007dd:	eb e5                	jmp    8007c4 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  8007df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e5:	77 5a                	ja     800841 <vprintfmt+0x1d0>
+  8007e7:	89 c2                	mov    %eax,%edx
+  8007e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ed:	83 c0 08             	add    $0x8,%eax
+  8007f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  8007f3:	8b 02                	mov    (%rdx),%eax
+  8007f5:	89 c1                	mov    %eax,%ecx
+  8007f7:	f7 d9                	neg    %ecx
+  8007f9:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8007fc:	83 f9 08             	cmp    $0x8,%ecx
+  8007ff:	7f 4e                	jg     80084f <vprintfmt+0x1de>
+  800801:	48 63 c1             	movslq %ecx,%rax
+  800804:	48 ba 80 19 80 00 00 	movabs $0x801980,%rdx
+  80080b:	00 00 00 
+  80080e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800812:	48 85 c0             	test   %rax,%rax
+  800815:	74 38                	je     80084f <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800817:	48 89 c1             	mov    %rax,%rcx
+  80081a:	48 ba 0c 16 80 00 00 	movabs $0x80160c,%rdx
+  800821:	00 00 00 
+  800824:	4c 89 ee             	mov    %r13,%rsi
+  800827:	4c 89 f7             	mov    %r14,%rdi
+  80082a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082f:	49 b8 eb 05 80 00 00 	movabs $0x8005eb,%r8
+  800836:	00 00 00 
+  800839:	41 ff d0             	call   *%r8
+  80083c:	e9 65 fe ff ff       	jmp    8006a6 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  800841:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800845:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800849:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084d:	eb a4                	jmp    8007f3 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  80084f:	48 ba 03 16 80 00 00 	movabs $0x801603,%rdx
+  800856:	00 00 00 
+  800859:	4c 89 ee             	mov    %r13,%rsi
+  80085c:	4c 89 f7             	mov    %r14,%rdi
+  80085f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800864:	49 b8 eb 05 80 00 00 	movabs $0x8005eb,%r8
+  80086b:	00 00 00 
+  80086e:	41 ff d0             	call   *%r8
+  800871:	e9 30 fe ff ff       	jmp    8006a6 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800876:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800879:	83 f8 2f             	cmp    $0x2f,%eax
+  80087c:	77 36                	ja     8008b4 <vprintfmt+0x243>
+  80087e:	89 c2                	mov    %eax,%edx
+  800880:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800884:	83 c0 08             	add    $0x8,%eax
+  800887:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088a:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  80088d:	48 85 c9             	test   %rcx,%rcx
+  800890:	48 b8 fc 15 80 00 00 	movabs $0x8015fc,%rax
+  800897:	00 00 00 
+  80089a:	48 0f 45 c1          	cmovne %rcx,%rax
+  80089e:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  8008a2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008a6:	7e 06                	jle    8008ae <vprintfmt+0x23d>
+  8008a8:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  8008ac:	75 14                	jne    8008c2 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008ae:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8008b2:	eb 64                	jmp    800918 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  8008b4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c0:	eb c8                	jmp    80088a <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008c2:	49 63 f7             	movslq %r15d,%rsi
+  8008c5:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  8008c9:	48 b8 54 0d 80 00 00 	movabs $0x800d54,%rax
+  8008d0:	00 00 00 
+  8008d3:	ff d0                	call   *%rax
+  8008d5:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8008d8:	29 c1                	sub    %eax,%ecx
+  8008da:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  8008dd:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  8008e0:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  8008e4:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008e7:	eb 0d                	jmp    8008f6 <vprintfmt+0x285>
+					putch(padc, putdat);
+  8008e9:	4c 89 ee             	mov    %r13,%rsi
+  8008ec:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  8008ef:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008f2:	41 83 ec 01          	sub    $0x1,%r12d
+  8008f6:	45 85 e4             	test   %r12d,%r12d
+  8008f9:	7f ee                	jg     8008e9 <vprintfmt+0x278>
+  8008fb:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  8008fe:	85 c9                	test   %ecx,%ecx
+  800900:	b8 00 00 00 00       	mov    $0x0,%eax
+  800905:	0f 49 c1             	cmovns %ecx,%eax
+  800908:	29 c1                	sub    %eax,%ecx
+  80090a:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  80090d:	eb 9f                	jmp    8008ae <vprintfmt+0x23d>
+					putch(ch, putdat);
+  80090f:	4c 89 ee             	mov    %r13,%rsi
+  800912:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800915:	4c 89 e2             	mov    %r12,%rdx
+  800918:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  80091c:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800922:	0f be f8             	movsbl %al,%edi
+  800925:	85 ff                	test   %edi,%edi
+  800927:	74 29                	je     800952 <vprintfmt+0x2e1>
+  800929:	45 85 ff             	test   %r15d,%r15d
+  80092c:	78 06                	js     800934 <vprintfmt+0x2c3>
+  80092e:	41 83 ef 01          	sub    $0x1,%r15d
+  800932:	78 1e                	js     800952 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800934:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800938:	74 d5                	je     80090f <vprintfmt+0x29e>
+  80093a:	0f be c0             	movsbl %al,%eax
+  80093d:	83 e8 20             	sub    $0x20,%eax
+  800940:	83 f8 5e             	cmp    $0x5e,%eax
+  800943:	76 ca                	jbe    80090f <vprintfmt+0x29e>
+					putch('?', putdat);
+  800945:	4c 89 ee             	mov    %r13,%rsi
+  800948:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80094d:	41 ff d6             	call   *%r14
+  800950:	eb c3                	jmp    800915 <vprintfmt+0x2a4>
+  800952:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800956:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800959:	41 01 c4             	add    %eax,%r12d
+  80095c:	41 29 d4             	sub    %edx,%r12d
+  80095f:	eb 0f                	jmp    800970 <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  800961:	4c 89 ee             	mov    %r13,%rsi
+  800964:	bf 20 00 00 00       	mov    $0x20,%edi
+  800969:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  80096c:	41 83 ec 01          	sub    $0x1,%r12d
+  800970:	45 85 e4             	test   %r12d,%r12d
+  800973:	7f ec                	jg     800961 <vprintfmt+0x2f0>
+  800975:	e9 2c fd ff ff       	jmp    8006a6 <vprintfmt+0x35>
+	if (lflag >= 2)
+  80097a:	83 f9 01             	cmp    $0x1,%ecx
+  80097d:	7f 1d                	jg     80099c <vprintfmt+0x32b>
+	else if (lflag)
+  80097f:	85 c9                	test   %ecx,%ecx
+  800981:	74 5e                	je     8009e1 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800983:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800986:	83 f8 2f             	cmp    $0x2f,%eax
+  800989:	77 48                	ja     8009d3 <vprintfmt+0x362>
+  80098b:	89 c2                	mov    %eax,%edx
+  80098d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800991:	83 c0 08             	add    $0x8,%eax
+  800994:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800997:	4c 8b 22             	mov    (%rdx),%r12
+  80099a:	eb 17                	jmp    8009b3 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  80099c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099f:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a2:	77 21                	ja     8009c5 <vprintfmt+0x354>
+  8009a4:	89 c2                	mov    %eax,%edx
+  8009a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009aa:	83 c0 08             	add    $0x8,%eax
+  8009ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b0:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  8009b3:	4d 85 e4             	test   %r12,%r12
+  8009b6:	78 50                	js     800a08 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  8009b8:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  8009bb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8009c0:	e9 b4 01 00 00       	jmp    800b79 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  8009c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d1:	eb dd                	jmp    8009b0 <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  8009d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009df:	eb b6                	jmp    800997 <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  8009e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e7:	77 11                	ja     8009fa <vprintfmt+0x389>
+  8009e9:	89 c2                	mov    %eax,%edx
+  8009eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ef:	83 c0 08             	add    $0x8,%eax
+  8009f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f5:	4c 63 22             	movslq (%rdx),%r12
+  8009f8:	eb b9                	jmp    8009b3 <vprintfmt+0x342>
+  8009fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a06:	eb ed                	jmp    8009f5 <vprintfmt+0x384>
+				putch('-', putdat);
+  800a08:	4c 89 ee             	mov    %r13,%rsi
+  800a0b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a10:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800a13:	4c 89 e2             	mov    %r12,%rdx
+  800a16:	48 f7 da             	neg    %rdx
+			base = 10;
+  800a19:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800a1e:	e9 56 01 00 00       	jmp    800b79 <vprintfmt+0x508>
+	if (lflag >= 2)
+  800a23:	83 f9 01             	cmp    $0x1,%ecx
+  800a26:	7f 25                	jg     800a4d <vprintfmt+0x3dc>
+	else if (lflag)
+  800a28:	85 c9                	test   %ecx,%ecx
+  800a2a:	74 5e                	je     800a8a <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800a2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a32:	77 48                	ja     800a7c <vprintfmt+0x40b>
+  800a34:	89 c2                	mov    %eax,%edx
+  800a36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3a:	83 c0 08             	add    $0x8,%eax
+  800a3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a40:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800a43:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800a48:	e9 2c 01 00 00       	jmp    800b79 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800a4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a50:	83 f8 2f             	cmp    $0x2f,%eax
+  800a53:	77 19                	ja     800a6e <vprintfmt+0x3fd>
+  800a55:	89 c2                	mov    %eax,%edx
+  800a57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5b:	83 c0 08             	add    $0x8,%eax
+  800a5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a61:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800a64:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800a69:	e9 0b 01 00 00       	jmp    800b79 <vprintfmt+0x508>
+  800a6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7a:	eb e5                	jmp    800a61 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800a7c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a80:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a88:	eb b6                	jmp    800a40 <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800a8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a90:	77 18                	ja     800aaa <vprintfmt+0x439>
+  800a92:	89 c2                	mov    %eax,%edx
+  800a94:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a98:	83 c0 08             	add    $0x8,%eax
+  800a9b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a9e:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800aa0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800aa5:	e9 cf 00 00 00       	jmp    800b79 <vprintfmt+0x508>
+  800aaa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab6:	eb e6                	jmp    800a9e <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800ab8:	83 f9 01             	cmp    $0x1,%ecx
+  800abb:	7f 25                	jg     800ae2 <vprintfmt+0x471>
+	else if (lflag)
+  800abd:	85 c9                	test   %ecx,%ecx
+  800abf:	74 5b                	je     800b1c <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800ac1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac7:	77 45                	ja     800b0e <vprintfmt+0x49d>
+  800ac9:	89 c2                	mov    %eax,%edx
+  800acb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800acf:	83 c0 08             	add    $0x8,%eax
+  800ad2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad5:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800ad8:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800add:	e9 97 00 00 00       	jmp    800b79 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800ae2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae8:	77 16                	ja     800b00 <vprintfmt+0x48f>
+  800aea:	89 c2                	mov    %eax,%edx
+  800aec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af0:	83 c0 08             	add    $0x8,%eax
+  800af3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af6:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800af9:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800afe:	eb 79                	jmp    800b79 <vprintfmt+0x508>
+  800b00:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b04:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0c:	eb e8                	jmp    800af6 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800b0e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b12:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b1a:	eb b9                	jmp    800ad5 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800b1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b1f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b22:	77 15                	ja     800b39 <vprintfmt+0x4c8>
+  800b24:	89 c2                	mov    %eax,%edx
+  800b26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b2a:	83 c0 08             	add    $0x8,%eax
+  800b2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b30:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800b32:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800b37:	eb 40                	jmp    800b79 <vprintfmt+0x508>
+  800b39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b3d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b45:	eb e9                	jmp    800b30 <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800b47:	4c 89 ee             	mov    %r13,%rsi
+  800b4a:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b4f:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800b52:	4c 89 ee             	mov    %r13,%rsi
+  800b55:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b5a:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800b5d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b60:	83 f8 2f             	cmp    $0x2f,%eax
+  800b63:	77 34                	ja     800b99 <vprintfmt+0x528>
+  800b65:	89 c2                	mov    %eax,%edx
+  800b67:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b6b:	83 c0 08             	add    $0x8,%eax
+  800b6e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800b71:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800b74:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800b79:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800b7e:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b82:	4c 89 ee             	mov    %r13,%rsi
+  800b85:	4c 89 f7             	mov    %r14,%rdi
+  800b88:	48 b8 4b 05 80 00 00 	movabs $0x80054b,%rax
+  800b8f:	00 00 00 
+  800b92:	ff d0                	call   *%rax
+			break;
+  800b94:	e9 0d fb ff ff       	jmp    8006a6 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800b99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba5:	eb ca                	jmp    800b71 <vprintfmt+0x500>
+	if (lflag >= 2)
+  800ba7:	83 f9 01             	cmp    $0x1,%ecx
+  800baa:	7f 22                	jg     800bce <vprintfmt+0x55d>
+	else if (lflag)
+  800bac:	85 c9                	test   %ecx,%ecx
+  800bae:	74 58                	je     800c08 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800bb0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb3:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb6:	77 42                	ja     800bfa <vprintfmt+0x589>
+  800bb8:	89 c2                	mov    %eax,%edx
+  800bba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bbe:	83 c0 08             	add    $0x8,%eax
+  800bc1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bc4:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800bc7:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800bcc:	eb ab                	jmp    800b79 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800bce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bd1:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd4:	77 16                	ja     800bec <vprintfmt+0x57b>
+  800bd6:	89 c2                	mov    %eax,%edx
+  800bd8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bdc:	83 c0 08             	add    $0x8,%eax
+  800bdf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800be2:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800be5:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800bea:	eb 8d                	jmp    800b79 <vprintfmt+0x508>
+  800bec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf8:	eb e8                	jmp    800be2 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800bfa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bfe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c06:	eb bc                	jmp    800bc4 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800c08:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c0b:	83 f8 2f             	cmp    $0x2f,%eax
+  800c0e:	77 18                	ja     800c28 <vprintfmt+0x5b7>
+  800c10:	89 c2                	mov    %eax,%edx
+  800c12:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c16:	83 c0 08             	add    $0x8,%eax
+  800c19:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c1c:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800c1e:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800c23:	e9 51 ff ff ff       	jmp    800b79 <vprintfmt+0x508>
+  800c28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c34:	eb e6                	jmp    800c1c <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800c36:	4c 89 ee             	mov    %r13,%rsi
+  800c39:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c3e:	41 ff d6             	call   *%r14
+			break;
+  800c41:	e9 60 fa ff ff       	jmp    8006a6 <vprintfmt+0x35>
+			putch('%', putdat);
+  800c46:	4c 89 ee             	mov    %r13,%rsi
+  800c49:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c4e:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800c51:	4c 89 e3             	mov    %r12,%rbx
+  800c54:	eb 04                	jmp    800c5a <vprintfmt+0x5e9>
+  800c56:	48 83 eb 01          	sub    $0x1,%rbx
+  800c5a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c5e:	75 f6                	jne    800c56 <vprintfmt+0x5e5>
+  800c60:	e9 41 fa ff ff       	jmp    8006a6 <vprintfmt+0x35>
+
+0000000000800c65 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800c65:	55                   	push   %rbp
+  800c66:	48 89 e5             	mov    %rsp,%rbp
+  800c69:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800c6d:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800c71:	48 63 c6             	movslq %esi,%rax
+  800c74:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800c79:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800c7d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800c84:	48 85 ff             	test   %rdi,%rdi
+  800c87:	74 2a                	je     800cb3 <vsnprintf+0x4e>
+  800c89:	85 f6                	test   %esi,%esi
+  800c8b:	7e 26                	jle    800cb3 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800c8d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800c91:	48 bf d3 05 80 00 00 	movabs $0x8005d3,%rdi
+  800c98:	00 00 00 
+  800c9b:	48 b8 71 06 80 00 00 	movabs $0x800671,%rax
+  800ca2:	00 00 00 
+  800ca5:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ca7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800cab:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800cae:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800cb1:	c9                   	leave
+  800cb2:	c3                   	ret
+		return -E_INVAL;
+  800cb3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cb8:	eb f7                	jmp    800cb1 <vsnprintf+0x4c>
+
+0000000000800cba <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800cba:	55                   	push   %rbp
+  800cbb:	48 89 e5             	mov    %rsp,%rbp
+  800cbe:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800cc5:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800ccc:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800cd3:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800cda:	84 c0                	test   %al,%al
+  800cdc:	74 20                	je     800cfe <snprintf+0x44>
+  800cde:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800ce2:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800ce6:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800cea:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800cee:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800cf2:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800cf6:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800cfa:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800cfe:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800d05:	00 00 00 
+  800d08:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800d0f:	00 00 00 
+  800d12:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d16:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800d1d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800d24:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800d2b:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800d32:	48 b8 65 0c 80 00 00 	movabs $0x800c65,%rax
+  800d39:	00 00 00 
+  800d3c:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800d3e:	c9                   	leave
+  800d3f:	c3                   	ret
+
+0000000000800d40 <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800d40:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d45:	48 89 d0             	mov    %rdx,%rax
+  800d48:	48 83 c2 01          	add    $0x1,%rdx
+  800d4c:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800d51:	75 f2                	jne    800d45 <strlen+0x5>
+		n++;
+	return n;
+}
+  800d53:	c3                   	ret
+
+0000000000800d54 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d54:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d59:	eb 03                	jmp    800d5e <strnlen+0xa>
+  800d5b:	48 89 d0             	mov    %rdx,%rax
+  800d5e:	48 39 c6             	cmp    %rax,%rsi
+  800d61:	74 0a                	je     800d6d <strnlen+0x19>
+  800d63:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800d67:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d6b:	75 ee                	jne    800d5b <strnlen+0x7>
+		n++;
+	return n;
+}
+  800d6d:	c3                   	ret
+
+0000000000800d6e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800d6e:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800d71:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d76:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d7a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d7d:	48 83 c2 01          	add    $0x1,%rdx
+  800d81:	84 c9                	test   %cl,%cl
+  800d83:	75 f1                	jne    800d76 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800d85:	c3                   	ret
+
+0000000000800d86 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800d86:	55                   	push   %rbp
+  800d87:	48 89 e5             	mov    %rsp,%rbp
+  800d8a:	41 54                	push   %r12
+  800d8c:	53                   	push   %rbx
+  800d8d:	48 89 fb             	mov    %rdi,%rbx
+  800d90:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800d93:	48 b8 40 0d 80 00 00 	movabs $0x800d40,%rax
+  800d9a:	00 00 00 
+  800d9d:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800d9f:	48 63 f8             	movslq %eax,%rdi
+  800da2:	48 01 df             	add    %rbx,%rdi
+  800da5:	4c 89 e6             	mov    %r12,%rsi
+  800da8:	48 b8 6e 0d 80 00 00 	movabs $0x800d6e,%rax
+  800daf:	00 00 00 
+  800db2:	ff d0                	call   *%rax
+	return dst;
+}
+  800db4:	48 89 d8             	mov    %rbx,%rax
+  800db7:	5b                   	pop    %rbx
+  800db8:	41 5c                	pop    %r12
+  800dba:	5d                   	pop    %rbp
+  800dbb:	c3                   	ret
+
+0000000000800dbc <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800dbc:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800dbf:	48 01 fa             	add    %rdi,%rdx
+  800dc2:	48 89 f9             	mov    %rdi,%rcx
+  800dc5:	eb 14                	jmp    800ddb <strncpy+0x1f>
+		*dst++ = *src;
+  800dc7:	48 83 c1 01          	add    $0x1,%rcx
+  800dcb:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800dcf:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800dd3:	41 80 f8 01          	cmp    $0x1,%r8b
+  800dd7:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800ddb:	48 39 d1             	cmp    %rdx,%rcx
+  800dde:	75 e7                	jne    800dc7 <strncpy+0xb>
+	}
+	return ret;
+}
+  800de0:	c3                   	ret
+
+0000000000800de1 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800de1:	48 89 f8             	mov    %rdi,%rax
+  800de4:	48 85 d2             	test   %rdx,%rdx
+  800de7:	74 27                	je     800e10 <strlcpy+0x2f>
+  800de9:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800dee:	48 89 fa             	mov    %rdi,%rdx
+  800df1:	eb 0b                	jmp    800dfe <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800df3:	48 83 c6 01          	add    $0x1,%rsi
+  800df7:	48 83 c2 01          	add    $0x1,%rdx
+  800dfb:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800dfe:	48 39 c2             	cmp    %rax,%rdx
+  800e01:	74 0a                	je     800e0d <strlcpy+0x2c>
+  800e03:	0f b6 0e             	movzbl (%rsi),%ecx
+  800e06:	84 c9                	test   %cl,%cl
+  800e08:	75 e9                	jne    800df3 <strlcpy+0x12>
+  800e0a:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800e0d:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800e10:	48 29 f8             	sub    %rdi,%rax
+}
+  800e13:	c3                   	ret
+
+0000000000800e14 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800e14:	eb 08                	jmp    800e1e <strcmp+0xa>
+		p++, q++;
+  800e16:	48 83 c7 01          	add    $0x1,%rdi
+  800e1a:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800e1e:	0f b6 07             	movzbl (%rdi),%eax
+  800e21:	84 c0                	test   %al,%al
+  800e23:	74 04                	je     800e29 <strcmp+0x15>
+  800e25:	3a 06                	cmp    (%rsi),%al
+  800e27:	74 ed                	je     800e16 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e29:	0f b6 c0             	movzbl %al,%eax
+  800e2c:	0f b6 16             	movzbl (%rsi),%edx
+  800e2f:	29 d0                	sub    %edx,%eax
+}
+  800e31:	c3                   	ret
+
+0000000000800e32 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800e32:	eb 0c                	jmp    800e40 <strncmp+0xe>
+		n--, p++, q++;
+  800e34:	48 83 ea 01          	sub    $0x1,%rdx
+  800e38:	48 83 c7 01          	add    $0x1,%rdi
+  800e3c:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800e40:	48 85 d2             	test   %rdx,%rdx
+  800e43:	74 14                	je     800e59 <strncmp+0x27>
+  800e45:	0f b6 07             	movzbl (%rdi),%eax
+  800e48:	84 c0                	test   %al,%al
+  800e4a:	74 04                	je     800e50 <strncmp+0x1e>
+  800e4c:	3a 06                	cmp    (%rsi),%al
+  800e4e:	74 e4                	je     800e34 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e50:	0f b6 07             	movzbl (%rdi),%eax
+  800e53:	0f b6 16             	movzbl (%rsi),%edx
+  800e56:	29 d0                	sub    %edx,%eax
+}
+  800e58:	c3                   	ret
+		return 0;
+  800e59:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5e:	c3                   	ret
+
+0000000000800e5f <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800e5f:	eb 04                	jmp    800e65 <strchr+0x6>
+  800e61:	48 83 c7 01          	add    $0x1,%rdi
+  800e65:	0f b6 07             	movzbl (%rdi),%eax
+  800e68:	84 c0                	test   %al,%al
+  800e6a:	74 09                	je     800e75 <strchr+0x16>
+		if (*s == c)
+  800e6c:	40 38 f0             	cmp    %sil,%al
+  800e6f:	75 f0                	jne    800e61 <strchr+0x2>
+  800e71:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800e74:	c3                   	ret
+	return 0;
+  800e75:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e7a:	c3                   	ret
+
+0000000000800e7b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800e7b:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800e7e:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800e81:	40 38 f2             	cmp    %sil,%dl
+  800e84:	74 0a                	je     800e90 <strfind+0x15>
+  800e86:	84 d2                	test   %dl,%dl
+  800e88:	74 06                	je     800e90 <strfind+0x15>
+	for (; *s; s++)
+  800e8a:	48 83 c0 01          	add    $0x1,%rax
+  800e8e:	eb ee                	jmp    800e7e <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800e90:	c3                   	ret
+
+0000000000800e91 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800e91:	48 85 d2             	test   %rdx,%rdx
+  800e94:	74 28                	je     800ebe <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800e96:	48 89 f8             	mov    %rdi,%rax
+  800e99:	48 09 d0             	or     %rdx,%rax
+  800e9c:	a8 03                	test   $0x3,%al
+  800e9e:	75 16                	jne    800eb6 <memset+0x25>
+		c &= 0xFF;
+  800ea0:	40 0f b6 f6          	movzbl %sil,%esi
+  800ea4:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800eaa:	48 89 d1             	mov    %rdx,%rcx
+  800ead:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800eb1:	fc                   	cld
+  800eb2:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800eb4:	eb 08                	jmp    800ebe <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800eb6:	89 f0                	mov    %esi,%eax
+  800eb8:	48 89 d1             	mov    %rdx,%rcx
+  800ebb:	fc                   	cld
+  800ebc:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ebe:	48 89 f8             	mov    %rdi,%rax
+  800ec1:	c3                   	ret
+
+0000000000800ec2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ec2:	48 89 f8             	mov    %rdi,%rax
+  800ec5:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ec8:	48 39 fe             	cmp    %rdi,%rsi
+  800ecb:	73 3a                	jae    800f07 <memmove+0x45>
+  800ecd:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ed1:	48 39 d7             	cmp    %rdx,%rdi
+  800ed4:	73 31                	jae    800f07 <memmove+0x45>
+		s += n;
+		d += n;
+  800ed6:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800eda:	48 89 d6             	mov    %rdx,%rsi
+  800edd:	48 09 fe             	or     %rdi,%rsi
+  800ee0:	48 09 ce             	or     %rcx,%rsi
+  800ee3:	40 f6 c6 03          	test   $0x3,%sil
+  800ee7:	75 11                	jne    800efa <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ee9:	48 83 ef 04          	sub    $0x4,%rdi
+  800eed:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800ef1:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800ef5:	fd                   	std
+  800ef6:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800ef8:	eb 0b                	jmp    800f05 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800efa:	48 83 ef 01          	sub    $0x1,%rdi
+  800efe:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800f02:	fd                   	std
+  800f03:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800f05:	fc                   	cld
+  800f06:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800f07:	48 89 f2             	mov    %rsi,%rdx
+  800f0a:	48 09 c2             	or     %rax,%rdx
+  800f0d:	48 09 ca             	or     %rcx,%rdx
+  800f10:	f6 c2 03             	test   $0x3,%dl
+  800f13:	75 0b                	jne    800f20 <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800f15:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800f19:	48 89 c7             	mov    %rax,%rdi
+  800f1c:	fc                   	cld
+  800f1d:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800f1f:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800f20:	48 89 c7             	mov    %rax,%rdi
+  800f23:	fc                   	cld
+  800f24:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800f26:	c3                   	ret
+
+0000000000800f27 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800f27:	55                   	push   %rbp
+  800f28:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800f2b:	48 b8 c2 0e 80 00 00 	movabs $0x800ec2,%rax
+  800f32:	00 00 00 
+  800f35:	ff d0                	call   *%rax
+}
+  800f37:	5d                   	pop    %rbp
+  800f38:	c3                   	ret
+
+0000000000800f39 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800f39:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f3e:	48 39 c2             	cmp    %rax,%rdx
+  800f41:	74 1e                	je     800f61 <memcmp+0x28>
+		if (*s1 != *s2)
+  800f43:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f47:	48 83 c0 01          	add    $0x1,%rax
+  800f4b:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800f51:	44 38 c1             	cmp    %r8b,%cl
+  800f54:	74 e8                	je     800f3e <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800f56:	0f b6 c1             	movzbl %cl,%eax
+  800f59:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f5d:	44 29 c0             	sub    %r8d,%eax
+  800f60:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800f61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f66:	c3                   	ret
+
+0000000000800f67 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800f67:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800f6a:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800f6d:	eb 04                	jmp    800f73 <memfind+0xc>
+  800f6f:	48 83 c0 01          	add    $0x1,%rax
+  800f73:	48 39 d0             	cmp    %rdx,%rax
+  800f76:	73 05                	jae    800f7d <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800f78:	40 38 30             	cmp    %sil,(%rax)
+  800f7b:	75 f2                	jne    800f6f <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800f7d:	c3                   	ret
+
+0000000000800f7e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800f7e:	48 89 f9             	mov    %rdi,%rcx
+  800f81:	49 89 f0             	mov    %rsi,%r8
+  800f84:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800f86:	eb 04                	jmp    800f8c <strtol+0xe>
+		s++;
+  800f88:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800f8c:	0f b6 01             	movzbl (%rcx),%eax
+  800f8f:	3c 20                	cmp    $0x20,%al
+  800f91:	74 f5                	je     800f88 <strtol+0xa>
+  800f93:	3c 09                	cmp    $0x9,%al
+  800f95:	74 f1                	je     800f88 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800f97:	3c 2b                	cmp    $0x2b,%al
+  800f99:	74 2b                	je     800fc6 <strtol+0x48>
+	int neg = 0;
+  800f9b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800fa1:	3c 2d                	cmp    $0x2d,%al
+  800fa3:	74 2d                	je     800fd2 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800fa5:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800fab:	75 0f                	jne    800fbc <strtol+0x3e>
+  800fad:	80 39 30             	cmpb   $0x30,(%rcx)
+  800fb0:	74 2c                	je     800fde <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800fb2:	85 ff                	test   %edi,%edi
+  800fb4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fb9:	0f 44 f8             	cmove  %eax,%edi
+  800fbc:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800fc1:	4c 63 d7             	movslq %edi,%r10
+  800fc4:	eb 4f                	jmp    801015 <strtol+0x97>
+		s++;
+  800fc6:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800fca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800fd0:	eb d3                	jmp    800fa5 <strtol+0x27>
+		s++, neg = 1;
+  800fd2:	48 83 c1 01          	add    $0x1,%rcx
+  800fd6:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800fdc:	eb c7                	jmp    800fa5 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800fde:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800fe2:	74 0f                	je     800ff3 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800fe4:	85 ff                	test   %edi,%edi
+  800fe6:	75 d4                	jne    800fbc <strtol+0x3e>
+		s++, base = 8;
+  800fe8:	48 83 c1 01          	add    $0x1,%rcx
+  800fec:	bf 08 00 00 00       	mov    $0x8,%edi
+  800ff1:	eb c9                	jmp    800fbc <strtol+0x3e>
+		s += 2, base = 16;
+  800ff3:	48 83 c1 02          	add    $0x2,%rcx
+  800ff7:	bf 10 00 00 00       	mov    $0x10,%edi
+  800ffc:	eb be                	jmp    800fbc <strtol+0x3e>
+			dig = *s - '0';
+  800ffe:	0f be c0             	movsbl %al,%eax
+  801001:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  801004:	39 f8                	cmp    %edi,%eax
+  801006:	7d 3b                	jge    801043 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  801008:	48 83 c1 01          	add    $0x1,%rcx
+  80100c:	49 0f af d2          	imul   %r10,%rdx
+  801010:	48 98                	cltq
+  801012:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  801015:	0f b6 01             	movzbl (%rcx),%eax
+  801018:	8d 70 d0             	lea    -0x30(%rax),%esi
+  80101b:	40 80 fe 09          	cmp    $0x9,%sil
+  80101f:	76 dd                	jbe    800ffe <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  801021:	8d 70 9f             	lea    -0x61(%rax),%esi
+  801024:	40 80 fe 19          	cmp    $0x19,%sil
+  801028:	77 08                	ja     801032 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  80102a:	0f be c0             	movsbl %al,%eax
+  80102d:	83 e8 57             	sub    $0x57,%eax
+  801030:	eb d2                	jmp    801004 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  801032:	8d 70 bf             	lea    -0x41(%rax),%esi
+  801035:	40 80 fe 19          	cmp    $0x19,%sil
+  801039:	77 08                	ja     801043 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  80103b:	0f be c0             	movsbl %al,%eax
+  80103e:	83 e8 37             	sub    $0x37,%eax
+  801041:	eb c1                	jmp    801004 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801043:	4d 85 c0             	test   %r8,%r8
+  801046:	74 03                	je     80104b <strtol+0xcd>
+		*endptr = (char *) s;
+  801048:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  80104b:	48 89 d0             	mov    %rdx,%rax
+  80104e:	48 f7 d8             	neg    %rax
+  801051:	45 85 c9             	test   %r9d,%r9d
+  801054:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  801058:	48 89 d0             	mov    %rdx,%rax
+  80105b:	c3                   	ret
+
+000000000080105c <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  80105c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801062:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  801068:	ba 00 00 00 00       	mov    $0x0,%edx
+  80106d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801072:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  801074:	c3                   	ret
+
+0000000000801075 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  801075:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80107b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801081:	bf 00 00 00 00       	mov    $0x0,%edi
+  801086:	b8 01 00 00 00       	mov    $0x1,%eax
+  80108b:	48 89 fe             	mov    %rdi,%rsi
+  80108e:	48 89 fa             	mov    %rdi,%rdx
+  801091:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801093:	c3                   	ret
+
+0000000000801094 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801094:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801097:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80109d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010ad:	48 89 f2             	mov    %rsi,%rdx
+  8010b0:	0f 05                	syscall
+	if(check && ret > 0)
+  8010b2:	48 85 c0             	test   %rax,%rax
+  8010b5:	7f 01                	jg     8010b8 <sys_env_destroy+0x24>
+}
+  8010b7:	c3                   	ret
+{
+  8010b8:	55                   	push   %rbp
+  8010b9:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010bc:	49 89 c0             	mov    %rax,%r8
+  8010bf:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8010c4:	48 ba c8 19 80 00 00 	movabs $0x8019c8,%rdx
+  8010cb:	00 00 00 
+  8010ce:	be 28 00 00 00       	mov    $0x28,%esi
+  8010d3:	48 bf e5 19 80 00 00 	movabs $0x8019e5,%rdi
+  8010da:	00 00 00 
+  8010dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e2:	49 b9 18 03 80 00 00 	movabs $0x800318,%r9
+  8010e9:	00 00 00 
+  8010ec:	41 ff d1             	call   *%r9
+
+00000000008010ef <sys_getenvid>:
+	asm volatile("movl %%gs:%c1, %0"
+  8010ef:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  8010f6:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  8010f7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8010fc:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801100:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801104:	48 c1 e2 04          	shl    $0x4,%rdx
+  801108:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  80110f:	00 00 00 
+  801112:	48 01 d0             	add    %rdx,%rax
+  801115:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  80111b:	c3                   	ret
+
+000000000080111c <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  80111c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801122:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801128:	bf 00 00 00 00       	mov    $0x0,%edi
+  80112d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801132:	48 89 fe             	mov    %rdi,%rsi
+  801135:	48 89 fa             	mov    %rdi,%rdx
+  801138:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80113a:	c3                   	ret
+
+000000000080113b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  80113b:	48 63 d2             	movslq %edx,%rdx
+  80113e:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801141:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801147:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80114d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801152:	0f 05                	syscall
+	if(check && ret > 0)
+  801154:	48 85 c0             	test   %rax,%rax
+  801157:	7f 01                	jg     80115a <sys_page_alloc+0x1f>
+}
+  801159:	c3                   	ret
+{
+  80115a:	55                   	push   %rbp
+  80115b:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80115e:	49 89 c0             	mov    %rax,%r8
+  801161:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801166:	48 ba c8 19 80 00 00 	movabs $0x8019c8,%rdx
+  80116d:	00 00 00 
+  801170:	be 28 00 00 00       	mov    $0x28,%esi
+  801175:	48 bf e5 19 80 00 00 	movabs $0x8019e5,%rdi
+  80117c:	00 00 00 
+  80117f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801184:	49 b9 18 03 80 00 00 	movabs $0x800318,%r9
+  80118b:	00 00 00 
+  80118e:	41 ff d1             	call   *%r9
+
+0000000000801191 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  801191:	48 63 d2             	movslq %edx,%rdx
+  801194:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801197:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80119d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011a8:	0f 05                	syscall
+	if(check && ret > 0)
+  8011aa:	48 85 c0             	test   %rax,%rax
+  8011ad:	7f 01                	jg     8011b0 <sys_page_alloc_huge+0x1f>
+}
+  8011af:	c3                   	ret
+{
+  8011b0:	55                   	push   %rbp
+  8011b1:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b4:	49 89 c0             	mov    %rax,%r8
+  8011b7:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8011bc:	48 ba c8 19 80 00 00 	movabs $0x8019c8,%rdx
+  8011c3:	00 00 00 
+  8011c6:	be 28 00 00 00       	mov    $0x28,%esi
+  8011cb:	48 bf e5 19 80 00 00 	movabs $0x8019e5,%rdi
+  8011d2:	00 00 00 
+  8011d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011da:	49 b9 18 03 80 00 00 	movabs $0x800318,%r9
+  8011e1:	00 00 00 
+  8011e4:	41 ff d1             	call   *%r9
+
+00000000008011e7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8011e7:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  8011ea:	48 63 d2             	movslq %edx,%rdx
+  8011ed:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  8011f0:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  8011f3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011f8:	0f 05                	syscall
+	if(check && ret > 0)
+  8011fa:	48 85 c0             	test   %rax,%rax
+  8011fd:	7f 01                	jg     801200 <sys_page_map+0x19>
+}
+  8011ff:	c3                   	ret
+{
+  801200:	55                   	push   %rbp
+  801201:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801204:	49 89 c0             	mov    %rax,%r8
+  801207:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80120c:	48 ba c8 19 80 00 00 	movabs $0x8019c8,%rdx
+  801213:	00 00 00 
+  801216:	be 28 00 00 00       	mov    $0x28,%esi
+  80121b:	48 bf e5 19 80 00 00 	movabs $0x8019e5,%rdi
+  801222:	00 00 00 
+  801225:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122a:	49 b9 18 03 80 00 00 	movabs $0x800318,%r9
+  801231:	00 00 00 
+  801234:	41 ff d1             	call   *%r9
+
+0000000000801237 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  801237:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80123a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801240:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801246:	ba 00 00 00 00       	mov    $0x0,%edx
+  80124b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801250:	0f 05                	syscall
+	if(check && ret > 0)
+  801252:	48 85 c0             	test   %rax,%rax
+  801255:	7f 01                	jg     801258 <sys_page_unmap+0x21>
+}
+  801257:	c3                   	ret
+{
+  801258:	55                   	push   %rbp
+  801259:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80125c:	49 89 c0             	mov    %rax,%r8
+  80125f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801264:	48 ba c8 19 80 00 00 	movabs $0x8019c8,%rdx
+  80126b:	00 00 00 
+  80126e:	be 28 00 00 00       	mov    $0x28,%esi
+  801273:	48 bf e5 19 80 00 00 	movabs $0x8019e5,%rdi
+  80127a:	00 00 00 
+  80127d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801282:	49 b9 18 03 80 00 00 	movabs $0x800318,%r9
+  801289:	00 00 00 
+  80128c:	41 ff d1             	call   *%r9
+
+000000000080128f <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  80128f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801295:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80129b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012a0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8012a5:	48 89 fe             	mov    %rdi,%rsi
+  8012a8:	48 89 fa             	mov    %rdi,%rdx
+  8012ab:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8012ad:	c3                   	ret
+
+00000000008012ae <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  8012ae:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8012b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8012ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012bf:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012c4:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  8012c6:	c3                   	ret
+
+00000000008012c7 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  8012c7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8012cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8012d3:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012d8:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  8012da:	c3                   	ret
+
+00000000008012db <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  8012db:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  8012de:	48 63 f6             	movslq %esi,%rsi
+  8012e1:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  8012e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8012ea:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012ef:	0f 05                	syscall
+	if(check && ret > 0)
+  8012f1:	48 85 c0             	test   %rax,%rax
+  8012f4:	7f 01                	jg     8012f7 <sys_page_batch+0x1c>
+}
+  8012f6:	c3                   	ret
+{
+  8012f7:	55                   	push   %rbp
+  8012f8:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012fb:	49 89 c0             	mov    %rax,%r8
+  8012fe:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801303:	48 ba c8 19 80 00 00 	movabs $0x8019c8,%rdx
+  80130a:	00 00 00 
+  80130d:	be 28 00 00 00       	mov    $0x28,%esi
+  801312:	48 bf e5 19 80 00 00 	movabs $0x8019e5,%rdi
+  801319:	00 00 00 
+  80131c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801321:	49 b9 18 03 80 00 00 	movabs $0x800318,%r9
+  801328:	00 00 00 
+  80132b:	41 ff d1             	call   *%r9
+
+000000000080132e <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  80132e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801334:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80133a:	be 00 00 00 00       	mov    $0x0,%esi
+  80133f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801344:	48 89 f2             	mov    %rsi,%rdx
+  801347:	0f 05                	syscall
+	if(check && ret > 0)
+  801349:	48 85 c0             	test   %rax,%rax
+  80134c:	7f 01                	jg     80134f <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  80134e:	c3                   	ret
+{
+  80134f:	55                   	push   %rbp
+  801350:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801353:	49 89 c0             	mov    %rax,%r8
+  801356:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80135b:	48 ba c8 19 80 00 00 	movabs $0x8019c8,%rdx
+  801362:	00 00 00 
+  801365:	be 28 00 00 00       	mov    $0x28,%esi
+  80136a:	48 bf e5 19 80 00 00 	movabs $0x8019e5,%rdi
+  801371:	00 00 00 
+  801374:	b8 00 00 00 00       	mov    $0x0,%eax
+  801379:	49 b9 18 03 80 00 00 	movabs $0x800318,%r9
+  801380:	00 00 00 
+  801383:	41 ff d1             	call   *%r9
+
+0000000000801386 <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  801386:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80138c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801392:	bf 00 00 00 00       	mov    $0x0,%edi
+  801397:	b8 14 00 00 00       	mov    $0x14,%eax
+  80139c:	48 89 fe             	mov    %rdi,%rsi
+  80139f:	48 89 fa             	mov    %rdi,%rdx
+  8013a2:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8013a4:	c3                   	ret
+
+00000000008013a5 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  8013a5:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8013a8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8013ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8013b4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013b9:	0f 05                	syscall
+	if(check && ret > 0)
+  8013bb:	48 85 c0             	test   %rax,%rax
+  8013be:	7f 01                	jg     8013c1 <sys_page_unmap_range+0x1c>
+}
+  8013c0:	c3                   	ret
+{
+  8013c1:	55                   	push   %rbp
+  8013c2:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013c5:	49 89 c0             	mov    %rax,%r8
+  8013c8:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8013cd:	48 ba c8 19 80 00 00 	movabs $0x8019c8,%rdx
+  8013d4:	00 00 00 
+  8013d7:	be 28 00 00 00       	mov    $0x28,%esi
+  8013dc:	48 bf e5 19 80 00 00 	movabs $0x8019e5,%rdi
+  8013e3:	00 00 00 
+  8013e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013eb:	49 b9 18 03 80 00 00 	movabs $0x800318,%r9
+  8013f2:	00 00 00 
+  8013f5:	41 ff d1             	call   *%r9
+
+00000000008013f8 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8013f8:	48 63 f6             	movslq %esi,%rsi
+  8013fb:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8013fe:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801404:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80140a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80140f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801414:	0f 05                	syscall
+	if(check && ret > 0)
+  801416:	48 85 c0             	test   %rax,%rax
+  801419:	7f 01                	jg     80141c <sys_env_set_status+0x24>
+}
+  80141b:	c3                   	ret
+{
+  80141c:	55                   	push   %rbp
+  80141d:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801420:	49 89 c0             	mov    %rax,%r8
+  801423:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801428:	48 ba c8 19 80 00 00 	movabs $0x8019c8,%rdx
+  80142f:	00 00 00 
+  801432:	be 28 00 00 00       	mov    $0x28,%esi
+  801437:	48 bf e5 19 80 00 00 	movabs $0x8019e5,%rdi
+  80143e:	00 00 00 
+  801441:	b8 00 00 00 00       	mov    $0x0,%eax
+  801446:	49 b9 18 03 80 00 00 	movabs $0x800318,%r9
+  80144d:	00 00 00 
+  801450:	41 ff d1             	call   *%r9
+
+0000000000801453 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  801453:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801456:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80145c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801462:	ba 00 00 00 00       	mov    $0x0,%edx
+  801467:	b8 09 00 00 00       	mov    $0x9,%eax
+  80146c:	0f 05                	syscall
+	if(check && ret > 0)
+  80146e:	48 85 c0             	test   %rax,%rax
+  801471:	7f 01                	jg     801474 <sys_env_set_pgfault_upcall+0x21>
+}
+  801473:	c3                   	ret
+{
+  801474:	55                   	push   %rbp
+  801475:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801478:	49 89 c0             	mov    %rax,%r8
+  80147b:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801480:	48 ba c8 19 80 00 00 	movabs $0x8019c8,%rdx
+  801487:	00 00 00 
+  80148a:	be 28 00 00 00       	mov    $0x28,%esi
+  80148f:	48 bf e5 19 80 00 00 	movabs $0x8019e5,%rdi
+  801496:	00 00 00 
+  801499:	b8 00 00 00 00       	mov    $0x0,%eax
+  80149e:	49 b9 18 03 80 00 00 	movabs $0x800318,%r9
+  8014a5:	00 00 00 
+  8014a8:	41 ff d1             	call   *%r9
+
+00000000008014ab <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8014ab:	48 63 ff             	movslq %edi,%rdi
+  8014ae:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  8014b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8014b7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014bc:	0f 05                	syscall
+}
+  8014be:	c3                   	ret
+
+00000000008014bf <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  8014bf:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8014c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8014cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8014d5:	48 89 f2             	mov    %rsi,%rdx
+  8014d8:	0f 05                	syscall
+	if(check && ret > 0)
+  8014da:	48 85 c0             	test   %rax,%rax
+  8014dd:	7f 01                	jg     8014e0 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  8014df:	c3                   	ret
+{
+  8014e0:	55                   	push   %rbp
+  8014e1:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014e4:	49 89 c0             	mov    %rax,%r8
+  8014e7:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8014ec:	48 ba c8 19 80 00 00 	movabs $0x8019c8,%rdx
+  8014f3:	00 00 00 
+  8014f6:	be 28 00 00 00       	mov    $0x28,%esi
+  8014fb:	48 bf e5 19 80 00 00 	movabs $0x8019e5,%rdi
+  801502:	00 00 00 
+  801505:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150a:	49 b9 18 03 80 00 00 	movabs $0x800318,%r9
+  801511:	00 00 00 
+  801514:	41 ff d1             	call   *%r9
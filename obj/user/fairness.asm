@@ -0,0 +1,2537 @@
+
+obj/user/fairness:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ea 00 00 00       	call   80011b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	41 56                	push   %r14
+  800039:	41 55                	push   %r13
+  80003b:	41 54                	push   %r12
+  80003d:	53                   	push   %rbx
+  80003e:	48 83 ec 10          	sub    $0x10,%rsp
+	envid_t who, id;
+
+	id = sys_getenvid();
+  800042:	48 b8 46 0e 80 00 00 	movabs $0x800e46,%rax
+  800049:	00 00 00 
+  80004c:	ff d0                	call   *%rax
+  80004e:	89 c3                	mov    %eax,%ebx
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800050:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800057:	00 
+		     : "=r" (id) : "i" (offsetof(struct Env, env_id)));
+	return &envs[ENVX(id)];
+  800058:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80005d:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800061:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800065:	48 c1 e0 04          	shl    $0x4,%rax
+  800069:	48 ba 00 00 80 bc 00 	movabs $0xbc800000,%rdx
+  800070:	00 00 00 
+  800073:	48 01 d0             	add    %rdx,%rax
+
+	if (thisenv == &envs[1]) {
+  800076:	48 8d 92 30 01 00 00 	lea    0x130(%rdx),%rdx
+  80007d:	48 39 d0             	cmp    %rdx,%rax
+  800080:	74 58                	je     8000da <umain+0xa7>
+		while (1) {
+			ipc_recv(&who, 0, 0);
+			cprintf("%x recv from %x\n", id, who);
+		}
+	} else {
+		cprintf("%x loop sending to %x\n", id, envs[1].env_id);
+  800082:	48 b8 e8 01 80 bc 00 	movabs $0xbc8001e8,%rax
+  800089:	00 00 00 
+  80008c:	8b 10                	mov    (%rax),%edx
+  80008e:	89 de                	mov    %ebx,%esi
+  800090:	48 bf 51 15 80 00 00 	movabs $0x801551,%rdi
+  800097:	00 00 00 
+  80009a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009f:	48 b9 0e 02 80 00 00 	movabs $0x80020e,%rcx
+  8000a6:	00 00 00 
+  8000a9:	ff d1                	call   *%rcx
+		while (1)
+			ipc_send(envs[1].env_id, 0, 0, 0);
+  8000ab:	49 bc 00 00 80 bc 00 	movabs $0xbc800000,%r12
+  8000b2:	00 00 00 
+  8000b5:	48 bb 51 13 80 00 00 	movabs $0x801351,%rbx
+  8000bc:	00 00 00 
+  8000bf:	41 8b bc 24 e8 01 00 	mov    0x1e8(%r12),%edi
+  8000c6:	00 
+  8000c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8000d6:	ff d3                	call   *%rbx
+		while (1)
+  8000d8:	eb e5                	jmp    8000bf <umain+0x8c>
+			ipc_recv(&who, 0, 0);
+  8000da:	49 be 6e 12 80 00 00 	movabs $0x80126e,%r14
+  8000e1:	00 00 00 
+			cprintf("%x recv from %x\n", id, who);
+  8000e4:	49 bd 40 15 80 00 00 	movabs $0x801540,%r13
+  8000eb:	00 00 00 
+  8000ee:	49 bc 0e 02 80 00 00 	movabs $0x80020e,%r12
+  8000f5:	00 00 00 
+			ipc_recv(&who, 0, 0);
+  8000f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000fd:	be 00 00 00 00       	mov    $0x0,%esi
+  800102:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  800106:	41 ff d6             	call   *%r14
+			cprintf("%x recv from %x\n", id, who);
+  800109:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80010c:	89 de                	mov    %ebx,%esi
+  80010e:	4c 89 ef             	mov    %r13,%rdi
+  800111:	b8 00 00 00 00       	mov    $0x0,%eax
+  800116:	41 ff d4             	call   *%r12
+		while (1) {
+  800119:	eb dd                	jmp    8000f8 <umain+0xc5>
+
+000000000080011b <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  80011b:	55                   	push   %rbp
+  80011c:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80011f:	85 ff                	test   %edi,%edi
+  800121:	7e 0d                	jle    800130 <libmain+0x15>
+		binaryname = argv[0];
+  800123:	48 8b 06             	mov    (%rsi),%rax
+  800126:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  80012d:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  800130:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  800137:	00 00 00 
+  80013a:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  80013c:	48 b8 4a 01 80 00 00 	movabs $0x80014a,%rax
+  800143:	00 00 00 
+  800146:	ff d0                	call   *%rax
+}
+  800148:	5d                   	pop    %rbp
+  800149:	c3                   	ret
+
+000000000080014a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80014a:	55                   	push   %rbp
+  80014b:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  80014e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800153:	48 b8 eb 0d 80 00 00 	movabs $0x800deb,%rax
+  80015a:	00 00 00 
+  80015d:	ff d0                	call   *%rax
+}
+  80015f:	5d                   	pop    %rbp
+  800160:	c3                   	ret
+
+0000000000800161 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800161:	55                   	push   %rbp
+  800162:	48 89 e5             	mov    %rsp,%rbp
+  800165:	53                   	push   %rbx
+  800166:	48 83 ec 08          	sub    $0x8,%rsp
+  80016a:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  80016d:	8b 06                	mov    (%rsi),%eax
+  80016f:	8d 50 01             	lea    0x1(%rax),%edx
+  800172:	89 16                	mov    %edx,(%rsi)
+  800174:	48 98                	cltq
+  800176:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  80017b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800181:	74 0a                	je     80018d <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800183:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800187:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80018b:	c9                   	leave
+  80018c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80018d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800191:	be ff 00 00 00       	mov    $0xff,%esi
+  800196:	48 b8 b3 0d 80 00 00 	movabs $0x800db3,%rax
+  80019d:	00 00 00 
+  8001a0:	ff d0                	call   *%rax
+		b->idx = 0;
+  8001a2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001a8:	eb d9                	jmp    800183 <putch+0x22>
+
+00000000008001aa <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001aa:	55                   	push   %rbp
+  8001ab:	48 89 e5             	mov    %rsp,%rbp
+  8001ae:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8001b5:	48 89 fa             	mov    %rdi,%rdx
+  8001b8:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  8001bb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8001c2:	00 00 00 
+	b.cnt = 0;
+  8001c5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8001cc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001cf:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  8001d6:	48 bf 61 01 80 00 00 	movabs $0x800161,%rdi
+  8001dd:	00 00 00 
+  8001e0:	48 b8 c8 03 80 00 00 	movabs $0x8003c8,%rax
+  8001e7:	00 00 00 
+  8001ea:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8001ec:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  8001f3:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8001fa:	48 b8 b3 0d 80 00 00 	movabs $0x800db3,%rax
+  800201:	00 00 00 
+  800204:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  800206:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  80020c:	c9                   	leave
+  80020d:	c3                   	ret
+
+000000000080020e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80020e:	55                   	push   %rbp
+  80020f:	48 89 e5             	mov    %rsp,%rbp
+  800212:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800219:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800220:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800227:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80022e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800235:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80023c:	84 c0                	test   %al,%al
+  80023e:	74 20                	je     800260 <cprintf+0x52>
+  800240:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800244:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800248:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80024c:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800250:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800254:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800258:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80025c:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800260:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  800267:	00 00 00 
+  80026a:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800271:	00 00 00 
+  800274:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800278:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80027f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800286:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  80028d:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  800294:	48 b8 aa 01 80 00 00 	movabs $0x8001aa,%rax
+  80029b:	00 00 00 
+  80029e:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  8002a0:	c9                   	leave
+  8002a1:	c3                   	ret
+
+00000000008002a2 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002a2:	55                   	push   %rbp
+  8002a3:	48 89 e5             	mov    %rsp,%rbp
+  8002a6:	41 57                	push   %r15
+  8002a8:	41 56                	push   %r14
+  8002aa:	41 55                	push   %r13
+  8002ac:	41 54                	push   %r12
+  8002ae:	53                   	push   %rbx
+  8002af:	48 83 ec 18          	sub    $0x18,%rsp
+  8002b3:	49 89 fc             	mov    %rdi,%r12
+  8002b6:	49 89 f5             	mov    %rsi,%r13
+  8002b9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002bd:	44 89 c3             	mov    %r8d,%ebx
+  8002c0:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002c3:	41 89 cf             	mov    %ecx,%r15d
+  8002c6:	4c 39 fa             	cmp    %r15,%rdx
+  8002c9:	72 29                	jb     8002f4 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002cb:	48 89 d0             	mov    %rdx,%rax
+  8002ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002d3:	49 f7 f7             	div    %r15
+  8002d6:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002da:	48 89 c2             	mov    %rax,%rdx
+  8002dd:	48 b8 a2 02 80 00 00 	movabs $0x8002a2,%rax
+  8002e4:	00 00 00 
+  8002e7:	ff d0                	call   *%rax
+  8002e9:	eb 10                	jmp    8002fb <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002eb:	4c 89 ee             	mov    %r13,%rsi
+  8002ee:	44 89 f7             	mov    %r14d,%edi
+  8002f1:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  8002f4:	83 eb 01             	sub    $0x1,%ebx
+  8002f7:	85 db                	test   %ebx,%ebx
+  8002f9:	7f f0                	jg     8002eb <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002fb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800304:	49 f7 f7             	div    %r15
+  800307:	48 b8 72 15 80 00 00 	movabs $0x801572,%rax
+  80030e:	00 00 00 
+  800311:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  800315:	4c 89 ee             	mov    %r13,%rsi
+  800318:	41 ff d4             	call   *%r12
+}
+  80031b:	48 83 c4 18          	add    $0x18,%rsp
+  80031f:	5b                   	pop    %rbx
+  800320:	41 5c                	pop    %r12
+  800322:	41 5d                	pop    %r13
+  800324:	41 5e                	pop    %r14
+  800326:	41 5f                	pop    %r15
+  800328:	5d                   	pop    %rbp
+  800329:	c3                   	ret
+
+000000000080032a <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  80032a:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  80032e:	48 8b 06             	mov    (%rsi),%rax
+  800331:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800335:	73 0a                	jae    800341 <sprintputch+0x17>
+		*b->buf++ = ch;
+  800337:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80033b:	48 89 16             	mov    %rdx,(%rsi)
+  80033e:	40 88 38             	mov    %dil,(%rax)
+}
+  800341:	c3                   	ret
+
+0000000000800342 <printfmt>:
+{
+  800342:	55                   	push   %rbp
+  800343:	48 89 e5             	mov    %rsp,%rbp
+  800346:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80034d:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800354:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80035b:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800362:	84 c0                	test   %al,%al
+  800364:	74 20                	je     800386 <printfmt+0x44>
+  800366:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80036a:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80036e:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800372:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800376:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80037a:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80037e:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800382:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  800386:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  80038d:	00 00 00 
+  800390:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800397:	00 00 00 
+  80039a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80039e:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8003a5:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8003ac:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8003b3:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8003ba:	48 b8 c8 03 80 00 00 	movabs $0x8003c8,%rax
+  8003c1:	00 00 00 
+  8003c4:	ff d0                	call   *%rax
+}
+  8003c6:	c9                   	leave
+  8003c7:	c3                   	ret
+
+00000000008003c8 <vprintfmt>:
+{
+  8003c8:	55                   	push   %rbp
+  8003c9:	48 89 e5             	mov    %rsp,%rbp
+  8003cc:	41 57                	push   %r15
+  8003ce:	41 56                	push   %r14
+  8003d0:	41 55                	push   %r13
+  8003d2:	41 54                	push   %r12
+  8003d4:	53                   	push   %rbx
+  8003d5:	48 83 ec 48          	sub    $0x48,%rsp
+  8003d9:	49 89 fe             	mov    %rdi,%r14
+  8003dc:	49 89 f5             	mov    %rsi,%r13
+  8003df:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  8003e2:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  8003e6:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  8003ea:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003ee:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8003f2:	eb 09                	jmp    8003fd <vprintfmt+0x35>
+			putch(ch, putdat);
+  8003f4:	4c 89 ee             	mov    %r13,%rsi
+  8003f7:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003fa:	4c 89 e3             	mov    %r12,%rbx
+  8003fd:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800401:	0f b6 3b             	movzbl (%rbx),%edi
+  800404:	83 ff 25             	cmp    $0x25,%edi
+  800407:	74 13                	je     80041c <vprintfmt+0x54>
+			if (ch == '\0')
+  800409:	85 ff                	test   %edi,%edi
+  80040b:	75 e7                	jne    8003f4 <vprintfmt+0x2c>
+}
+  80040d:	48 83 c4 48          	add    $0x48,%rsp
+  800411:	5b                   	pop    %rbx
+  800412:	41 5c                	pop    %r12
+  800414:	41 5d                	pop    %r13
+  800416:	41 5e                	pop    %r14
+  800418:	41 5f                	pop    %r15
+  80041a:	5d                   	pop    %rbp
+  80041b:	c3                   	ret
+		padc = ' ';
+  80041c:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  800420:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  800427:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  80042d:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  800434:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800439:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80043e:	41 0f b6 14 24       	movzbl (%r12),%edx
+  800443:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  800446:	3c 55                	cmp    $0x55,%al
+  800448:	0f 87 4f 05 00 00    	ja     80099d <vprintfmt+0x5d5>
+  80044e:	0f b6 c0             	movzbl %al,%eax
+  800451:	48 be 40 16 80 00 00 	movabs $0x801640,%rsi
+  800458:	00 00 00 
+  80045b:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  80045e:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  800461:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  800465:	eb d2                	jmp    800439 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800467:	49 89 dc             	mov    %rbx,%r12
+  80046a:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  80046e:	eb c9                	jmp    800439 <vprintfmt+0x71>
+  800470:	0f b6 d2             	movzbl %dl,%edx
+  800473:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  800476:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  80047c:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800480:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  800485:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  80048a:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  80048d:	83 f8 09             	cmp    $0x9,%eax
+  800490:	77 20                	ja     8004b2 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  800492:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  800496:	eb e4                	jmp    80047c <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  800498:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80049b:	83 f8 2f             	cmp    $0x2f,%eax
+  80049e:	77 27                	ja     8004c7 <vprintfmt+0xff>
+  8004a0:	89 c2                	mov    %eax,%edx
+  8004a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004a6:	83 c0 08             	add    $0x8,%eax
+  8004a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004ac:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  8004af:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  8004b2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004b6:	79 81                	jns    800439 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  8004b8:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  8004bc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004c2:	e9 72 ff ff ff       	jmp    800439 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  8004c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004d3:	eb d7                	jmp    8004ac <vprintfmt+0xe4>
+			if (width < 0)
+  8004d5:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  8004d8:	85 f6                	test   %esi,%esi
+  8004da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004df:	0f 49 c6             	cmovns %esi,%eax
+  8004e2:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e5:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8004e8:	e9 4c ff ff ff       	jmp    800439 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ed:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  8004f0:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  8004f7:	e9 3d ff ff ff       	jmp    800439 <vprintfmt+0x71>
+			lflag++;
+  8004fc:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ff:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800502:	e9 32 ff ff ff       	jmp    800439 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  800507:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80050a:	83 f8 2f             	cmp    $0x2f,%eax
+  80050d:	77 19                	ja     800528 <vprintfmt+0x160>
+  80050f:	89 c2                	mov    %eax,%edx
+  800511:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800515:	83 c0 08             	add    $0x8,%eax
+  800518:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80051b:	8b 3a                	mov    (%rdx),%edi
+  80051d:	4c 89 ee             	mov    %r13,%rsi
+  800520:	41 ff d6             	call   *%r14
+			break;
+  800523:	e9 d5 fe ff ff       	jmp    8003fd <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  800528:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80052c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800530:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800534:	eb e5                	jmp    80051b <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  800536:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800539:	83 f8 2f             	cmp    $0x2f,%eax
+  80053c:	77 5a                	ja     800598 <vprintfmt+0x1d0>
+  80053e:	89 c2                	mov    %eax,%edx
+  800540:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800544:	83 c0 08             	add    $0x8,%eax
+  800547:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  80054a:	8b 02                	mov    (%rdx),%eax
+  80054c:	89 c1                	mov    %eax,%ecx
+  80054e:	f7 d9                	neg    %ecx
+  800550:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800553:	83 f9 08             	cmp    $0x8,%ecx
+  800556:	7f 4e                	jg     8005a6 <vprintfmt+0x1de>
+  800558:	48 63 c1             	movslq %ecx,%rax
+  80055b:	48 ba 00 19 80 00 00 	movabs $0x801900,%rdx
+  800562:	00 00 00 
+  800565:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800569:	48 85 c0             	test   %rax,%rax
+  80056c:	74 38                	je     8005a6 <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  80056e:	48 89 c1             	mov    %rax,%rcx
+  800571:	48 ba 93 15 80 00 00 	movabs $0x801593,%rdx
+  800578:	00 00 00 
+  80057b:	4c 89 ee             	mov    %r13,%rsi
+  80057e:	4c 89 f7             	mov    %r14,%rdi
+  800581:	b8 00 00 00 00       	mov    $0x0,%eax
+  800586:	49 b8 42 03 80 00 00 	movabs $0x800342,%r8
+  80058d:	00 00 00 
+  800590:	41 ff d0             	call   *%r8
+  800593:	e9 65 fe ff ff       	jmp    8003fd <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  800598:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80059c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005a4:	eb a4                	jmp    80054a <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  8005a6:	48 ba 8a 15 80 00 00 	movabs $0x80158a,%rdx
+  8005ad:	00 00 00 
+  8005b0:	4c 89 ee             	mov    %r13,%rsi
+  8005b3:	4c 89 f7             	mov    %r14,%rdi
+  8005b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005bb:	49 b8 42 03 80 00 00 	movabs $0x800342,%r8
+  8005c2:	00 00 00 
+  8005c5:	41 ff d0             	call   *%r8
+  8005c8:	e9 30 fe ff ff       	jmp    8003fd <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  8005cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8005d3:	77 36                	ja     80060b <vprintfmt+0x243>
+  8005d5:	89 c2                	mov    %eax,%edx
+  8005d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005db:	83 c0 08             	add    $0x8,%eax
+  8005de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005e1:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  8005e4:	48 85 c9             	test   %rcx,%rcx
+  8005e7:	48 b8 83 15 80 00 00 	movabs $0x801583,%rax
+  8005ee:	00 00 00 
+  8005f1:	48 0f 45 c1          	cmovne %rcx,%rax
+  8005f5:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  8005f9:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005fd:	7e 06                	jle    800605 <vprintfmt+0x23d>
+  8005ff:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800603:	75 14                	jne    800619 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800605:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800609:	eb 64                	jmp    80066f <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  80060b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80060f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800613:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800617:	eb c8                	jmp    8005e1 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800619:	49 63 f7             	movslq %r15d,%rsi
+  80061c:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800620:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  800627:	00 00 00 
+  80062a:	ff d0                	call   *%rax
+  80062c:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80062f:	29 c1                	sub    %eax,%ecx
+  800631:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800634:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  800637:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  80063b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80063e:	eb 0d                	jmp    80064d <vprintfmt+0x285>
+					putch(padc, putdat);
+  800640:	4c 89 ee             	mov    %r13,%rsi
+  800643:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  800646:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800649:	41 83 ec 01          	sub    $0x1,%r12d
+  80064d:	45 85 e4             	test   %r12d,%r12d
+  800650:	7f ee                	jg     800640 <vprintfmt+0x278>
+  800652:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  800655:	85 c9                	test   %ecx,%ecx
+  800657:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065c:	0f 49 c1             	cmovns %ecx,%eax
+  80065f:	29 c1                	sub    %eax,%ecx
+  800661:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  800664:	eb 9f                	jmp    800605 <vprintfmt+0x23d>
+					putch(ch, putdat);
+  800666:	4c 89 ee             	mov    %r13,%rsi
+  800669:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80066c:	4c 89 e2             	mov    %r12,%rdx
+  80066f:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800673:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800679:	0f be f8             	movsbl %al,%edi
+  80067c:	85 ff                	test   %edi,%edi
+  80067e:	74 29                	je     8006a9 <vprintfmt+0x2e1>
+  800680:	45 85 ff             	test   %r15d,%r15d
+  800683:	78 06                	js     80068b <vprintfmt+0x2c3>
+  800685:	41 83 ef 01          	sub    $0x1,%r15d
+  800689:	78 1e                	js     8006a9 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80068b:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  80068f:	74 d5                	je     800666 <vprintfmt+0x29e>
+  800691:	0f be c0             	movsbl %al,%eax
+  800694:	83 e8 20             	sub    $0x20,%eax
+  800697:	83 f8 5e             	cmp    $0x5e,%eax
+  80069a:	76 ca                	jbe    800666 <vprintfmt+0x29e>
+					putch('?', putdat);
+  80069c:	4c 89 ee             	mov    %r13,%rsi
+  80069f:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006a4:	41 ff d6             	call   *%r14
+  8006a7:	eb c3                	jmp    80066c <vprintfmt+0x2a4>
+  8006a9:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  8006ad:	8b 45 98             	mov    -0x68(%rbp),%eax
+  8006b0:	41 01 c4             	add    %eax,%r12d
+  8006b3:	41 29 d4             	sub    %edx,%r12d
+  8006b6:	eb 0f                	jmp    8006c7 <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  8006b8:	4c 89 ee             	mov    %r13,%rsi
+  8006bb:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006c0:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  8006c3:	41 83 ec 01          	sub    $0x1,%r12d
+  8006c7:	45 85 e4             	test   %r12d,%r12d
+  8006ca:	7f ec                	jg     8006b8 <vprintfmt+0x2f0>
+  8006cc:	e9 2c fd ff ff       	jmp    8003fd <vprintfmt+0x35>
+	if (lflag >= 2)
+  8006d1:	83 f9 01             	cmp    $0x1,%ecx
+  8006d4:	7f 1d                	jg     8006f3 <vprintfmt+0x32b>
+	else if (lflag)
+  8006d6:	85 c9                	test   %ecx,%ecx
+  8006d8:	74 5e                	je     800738 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  8006da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e0:	77 48                	ja     80072a <vprintfmt+0x362>
+  8006e2:	89 c2                	mov    %eax,%edx
+  8006e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e8:	83 c0 08             	add    $0x8,%eax
+  8006eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ee:	4c 8b 22             	mov    (%rdx),%r12
+  8006f1:	eb 17                	jmp    80070a <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  8006f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8006f9:	77 21                	ja     80071c <vprintfmt+0x354>
+  8006fb:	89 c2                	mov    %eax,%edx
+  8006fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800701:	83 c0 08             	add    $0x8,%eax
+  800704:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800707:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  80070a:	4d 85 e4             	test   %r12,%r12
+  80070d:	78 50                	js     80075f <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  80070f:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800712:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800717:	e9 b4 01 00 00       	jmp    8008d0 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  80071c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800720:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800724:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800728:	eb dd                	jmp    800707 <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  80072a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80072e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800732:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800736:	eb b6                	jmp    8006ee <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800738:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80073b:	83 f8 2f             	cmp    $0x2f,%eax
+  80073e:	77 11                	ja     800751 <vprintfmt+0x389>
+  800740:	89 c2                	mov    %eax,%edx
+  800742:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800746:	83 c0 08             	add    $0x8,%eax
+  800749:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80074c:	4c 63 22             	movslq (%rdx),%r12
+  80074f:	eb b9                	jmp    80070a <vprintfmt+0x342>
+  800751:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800755:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800759:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80075d:	eb ed                	jmp    80074c <vprintfmt+0x384>
+				putch('-', putdat);
+  80075f:	4c 89 ee             	mov    %r13,%rsi
+  800762:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800767:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  80076a:	4c 89 e2             	mov    %r12,%rdx
+  80076d:	48 f7 da             	neg    %rdx
+			base = 10;
+  800770:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800775:	e9 56 01 00 00       	jmp    8008d0 <vprintfmt+0x508>
+	if (lflag >= 2)
+  80077a:	83 f9 01             	cmp    $0x1,%ecx
+  80077d:	7f 25                	jg     8007a4 <vprintfmt+0x3dc>
+	else if (lflag)
+  80077f:	85 c9                	test   %ecx,%ecx
+  800781:	74 5e                	je     8007e1 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800783:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800786:	83 f8 2f             	cmp    $0x2f,%eax
+  800789:	77 48                	ja     8007d3 <vprintfmt+0x40b>
+  80078b:	89 c2                	mov    %eax,%edx
+  80078d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800791:	83 c0 08             	add    $0x8,%eax
+  800794:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800797:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  80079a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  80079f:	e9 2c 01 00 00       	jmp    8008d0 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8007a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007aa:	77 19                	ja     8007c5 <vprintfmt+0x3fd>
+  8007ac:	89 c2                	mov    %eax,%edx
+  8007ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b2:	83 c0 08             	add    $0x8,%eax
+  8007b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b8:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8007bb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  8007c0:	e9 0b 01 00 00       	jmp    8008d0 <vprintfmt+0x508>
+  8007c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d1:	eb e5                	jmp    8007b8 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  8007d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007df:	eb b6                	jmp    800797 <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  8007e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e7:	77 18                	ja     800801 <vprintfmt+0x439>
+  8007e9:	89 c2                	mov    %eax,%edx
+  8007eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ef:	83 c0 08             	add    $0x8,%eax
+  8007f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f5:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  8007f7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  8007fc:	e9 cf 00 00 00       	jmp    8008d0 <vprintfmt+0x508>
+  800801:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800805:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800809:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80080d:	eb e6                	jmp    8007f5 <vprintfmt+0x42d>
+	if (lflag >= 2)
+  80080f:	83 f9 01             	cmp    $0x1,%ecx
+  800812:	7f 25                	jg     800839 <vprintfmt+0x471>
+	else if (lflag)
+  800814:	85 c9                	test   %ecx,%ecx
+  800816:	74 5b                	je     800873 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800818:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081b:	83 f8 2f             	cmp    $0x2f,%eax
+  80081e:	77 45                	ja     800865 <vprintfmt+0x49d>
+  800820:	89 c2                	mov    %eax,%edx
+  800822:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800826:	83 c0 08             	add    $0x8,%eax
+  800829:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80082c:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  80082f:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800834:	e9 97 00 00 00       	jmp    8008d0 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800839:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083c:	83 f8 2f             	cmp    $0x2f,%eax
+  80083f:	77 16                	ja     800857 <vprintfmt+0x48f>
+  800841:	89 c2                	mov    %eax,%edx
+  800843:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800847:	83 c0 08             	add    $0x8,%eax
+  80084a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084d:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800850:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800855:	eb 79                	jmp    8008d0 <vprintfmt+0x508>
+  800857:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80085f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800863:	eb e8                	jmp    80084d <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800865:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800869:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800871:	eb b9                	jmp    80082c <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800873:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800876:	83 f8 2f             	cmp    $0x2f,%eax
+  800879:	77 15                	ja     800890 <vprintfmt+0x4c8>
+  80087b:	89 c2                	mov    %eax,%edx
+  80087d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800881:	83 c0 08             	add    $0x8,%eax
+  800884:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800887:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800889:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  80088e:	eb 40                	jmp    8008d0 <vprintfmt+0x508>
+  800890:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800894:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800898:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089c:	eb e9                	jmp    800887 <vprintfmt+0x4bf>
+			putch('0', putdat);
+  80089e:	4c 89 ee             	mov    %r13,%rsi
+  8008a1:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008a6:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  8008a9:	4c 89 ee             	mov    %r13,%rsi
+  8008ac:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008b1:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  8008b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ba:	77 34                	ja     8008f0 <vprintfmt+0x528>
+  8008bc:	89 c2                	mov    %eax,%edx
+  8008be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c2:	83 c0 08             	add    $0x8,%eax
+  8008c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  8008c8:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  8008cb:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  8008d0:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  8008d5:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008d9:	4c 89 ee             	mov    %r13,%rsi
+  8008dc:	4c 89 f7             	mov    %r14,%rdi
+  8008df:	48 b8 a2 02 80 00 00 	movabs $0x8002a2,%rax
+  8008e6:	00 00 00 
+  8008e9:	ff d0                	call   *%rax
+			break;
+  8008eb:	e9 0d fb ff ff       	jmp    8003fd <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  8008f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fc:	eb ca                	jmp    8008c8 <vprintfmt+0x500>
+	if (lflag >= 2)
+  8008fe:	83 f9 01             	cmp    $0x1,%ecx
+  800901:	7f 22                	jg     800925 <vprintfmt+0x55d>
+	else if (lflag)
+  800903:	85 c9                	test   %ecx,%ecx
+  800905:	74 58                	je     80095f <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800907:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090a:	83 f8 2f             	cmp    $0x2f,%eax
+  80090d:	77 42                	ja     800951 <vprintfmt+0x589>
+  80090f:	89 c2                	mov    %eax,%edx
+  800911:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800915:	83 c0 08             	add    $0x8,%eax
+  800918:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091b:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  80091e:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800923:	eb ab                	jmp    8008d0 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800925:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800928:	83 f8 2f             	cmp    $0x2f,%eax
+  80092b:	77 16                	ja     800943 <vprintfmt+0x57b>
+  80092d:	89 c2                	mov    %eax,%edx
+  80092f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800933:	83 c0 08             	add    $0x8,%eax
+  800936:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800939:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  80093c:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800941:	eb 8d                	jmp    8008d0 <vprintfmt+0x508>
+  800943:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800947:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094f:	eb e8                	jmp    800939 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800951:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800955:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800959:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095d:	eb bc                	jmp    80091b <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  80095f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800962:	83 f8 2f             	cmp    $0x2f,%eax
+  800965:	77 18                	ja     80097f <vprintfmt+0x5b7>
+  800967:	89 c2                	mov    %eax,%edx
+  800969:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096d:	83 c0 08             	add    $0x8,%eax
+  800970:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800973:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800975:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  80097a:	e9 51 ff ff ff       	jmp    8008d0 <vprintfmt+0x508>
+  80097f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800983:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800987:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098b:	eb e6                	jmp    800973 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  80098d:	4c 89 ee             	mov    %r13,%rsi
+  800990:	bf 25 00 00 00       	mov    $0x25,%edi
+  800995:	41 ff d6             	call   *%r14
+			break;
+  800998:	e9 60 fa ff ff       	jmp    8003fd <vprintfmt+0x35>
+			putch('%', putdat);
+  80099d:	4c 89 ee             	mov    %r13,%rsi
+  8009a0:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009a5:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8009a8:	4c 89 e3             	mov    %r12,%rbx
+  8009ab:	eb 04                	jmp    8009b1 <vprintfmt+0x5e9>
+  8009ad:	48 83 eb 01          	sub    $0x1,%rbx
+  8009b1:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8009b5:	75 f6                	jne    8009ad <vprintfmt+0x5e5>
+  8009b7:	e9 41 fa ff ff       	jmp    8003fd <vprintfmt+0x35>
+
+00000000008009bc <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009bc:	55                   	push   %rbp
+  8009bd:	48 89 e5             	mov    %rsp,%rbp
+  8009c0:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009c4:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8009c8:	48 63 c6             	movslq %esi,%rax
+  8009cb:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  8009d0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  8009d4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  8009db:	48 85 ff             	test   %rdi,%rdi
+  8009de:	74 2a                	je     800a0a <vsnprintf+0x4e>
+  8009e0:	85 f6                	test   %esi,%esi
+  8009e2:	7e 26                	jle    800a0a <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009e4:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8009e8:	48 bf 2a 03 80 00 00 	movabs $0x80032a,%rdi
+  8009ef:	00 00 00 
+  8009f2:	48 b8 c8 03 80 00 00 	movabs $0x8003c8,%rax
+  8009f9:	00 00 00 
+  8009fc:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800a02:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800a05:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800a08:	c9                   	leave
+  800a09:	c3                   	ret
+		return -E_INVAL;
+  800a0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a0f:	eb f7                	jmp    800a08 <vsnprintf+0x4c>
+
+0000000000800a11 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a11:	55                   	push   %rbp
+  800a12:	48 89 e5             	mov    %rsp,%rbp
+  800a15:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800a1c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800a23:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800a2a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800a31:	84 c0                	test   %al,%al
+  800a33:	74 20                	je     800a55 <snprintf+0x44>
+  800a35:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800a39:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800a3d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800a41:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800a45:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800a49:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800a4d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800a51:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a55:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800a5c:	00 00 00 
+  800a5f:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800a66:	00 00 00 
+  800a69:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a6d:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800a74:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800a7b:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a82:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800a89:	48 b8 bc 09 80 00 00 	movabs $0x8009bc,%rax
+  800a90:	00 00 00 
+  800a93:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800a95:	c9                   	leave
+  800a96:	c3                   	ret
+
+0000000000800a97 <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a97:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a9c:	48 89 d0             	mov    %rdx,%rax
+  800a9f:	48 83 c2 01          	add    $0x1,%rdx
+  800aa3:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800aa8:	75 f2                	jne    800a9c <strlen+0x5>
+		n++;
+	return n;
+}
+  800aaa:	c3                   	ret
+
+0000000000800aab <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800aab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab0:	eb 03                	jmp    800ab5 <strnlen+0xa>
+  800ab2:	48 89 d0             	mov    %rdx,%rax
+  800ab5:	48 39 c6             	cmp    %rax,%rsi
+  800ab8:	74 0a                	je     800ac4 <strnlen+0x19>
+  800aba:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800abe:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ac2:	75 ee                	jne    800ab2 <strnlen+0x7>
+		n++;
+	return n;
+}
+  800ac4:	c3                   	ret
+
+0000000000800ac5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800ac5:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800ac8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800acd:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ad1:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ad4:	48 83 c2 01          	add    $0x1,%rdx
+  800ad8:	84 c9                	test   %cl,%cl
+  800ada:	75 f1                	jne    800acd <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800adc:	c3                   	ret
+
+0000000000800add <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800add:	55                   	push   %rbp
+  800ade:	48 89 e5             	mov    %rsp,%rbp
+  800ae1:	41 54                	push   %r12
+  800ae3:	53                   	push   %rbx
+  800ae4:	48 89 fb             	mov    %rdi,%rbx
+  800ae7:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800aea:	48 b8 97 0a 80 00 00 	movabs $0x800a97,%rax
+  800af1:	00 00 00 
+  800af4:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800af6:	48 63 f8             	movslq %eax,%rdi
+  800af9:	48 01 df             	add    %rbx,%rdi
+  800afc:	4c 89 e6             	mov    %r12,%rsi
+  800aff:	48 b8 c5 0a 80 00 00 	movabs $0x800ac5,%rax
+  800b06:	00 00 00 
+  800b09:	ff d0                	call   *%rax
+	return dst;
+}
+  800b0b:	48 89 d8             	mov    %rbx,%rax
+  800b0e:	5b                   	pop    %rbx
+  800b0f:	41 5c                	pop    %r12
+  800b11:	5d                   	pop    %rbp
+  800b12:	c3                   	ret
+
+0000000000800b13 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b13:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b16:	48 01 fa             	add    %rdi,%rdx
+  800b19:	48 89 f9             	mov    %rdi,%rcx
+  800b1c:	eb 14                	jmp    800b32 <strncpy+0x1f>
+		*dst++ = *src;
+  800b1e:	48 83 c1 01          	add    $0x1,%rcx
+  800b22:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b26:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b2a:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b2e:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800b32:	48 39 d1             	cmp    %rdx,%rcx
+  800b35:	75 e7                	jne    800b1e <strncpy+0xb>
+	}
+	return ret;
+}
+  800b37:	c3                   	ret
+
+0000000000800b38 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b38:	48 89 f8             	mov    %rdi,%rax
+  800b3b:	48 85 d2             	test   %rdx,%rdx
+  800b3e:	74 27                	je     800b67 <strlcpy+0x2f>
+  800b40:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800b45:	48 89 fa             	mov    %rdi,%rdx
+  800b48:	eb 0b                	jmp    800b55 <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b4a:	48 83 c6 01          	add    $0x1,%rsi
+  800b4e:	48 83 c2 01          	add    $0x1,%rdx
+  800b52:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800b55:	48 39 c2             	cmp    %rax,%rdx
+  800b58:	74 0a                	je     800b64 <strlcpy+0x2c>
+  800b5a:	0f b6 0e             	movzbl (%rsi),%ecx
+  800b5d:	84 c9                	test   %cl,%cl
+  800b5f:	75 e9                	jne    800b4a <strlcpy+0x12>
+  800b61:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800b64:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800b67:	48 29 f8             	sub    %rdi,%rax
+}
+  800b6a:	c3                   	ret
+
+0000000000800b6b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800b6b:	eb 08                	jmp    800b75 <strcmp+0xa>
+		p++, q++;
+  800b6d:	48 83 c7 01          	add    $0x1,%rdi
+  800b71:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800b75:	0f b6 07             	movzbl (%rdi),%eax
+  800b78:	84 c0                	test   %al,%al
+  800b7a:	74 04                	je     800b80 <strcmp+0x15>
+  800b7c:	3a 06                	cmp    (%rsi),%al
+  800b7e:	74 ed                	je     800b6d <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b80:	0f b6 c0             	movzbl %al,%eax
+  800b83:	0f b6 16             	movzbl (%rsi),%edx
+  800b86:	29 d0                	sub    %edx,%eax
+}
+  800b88:	c3                   	ret
+
+0000000000800b89 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800b89:	eb 0c                	jmp    800b97 <strncmp+0xe>
+		n--, p++, q++;
+  800b8b:	48 83 ea 01          	sub    $0x1,%rdx
+  800b8f:	48 83 c7 01          	add    $0x1,%rdi
+  800b93:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800b97:	48 85 d2             	test   %rdx,%rdx
+  800b9a:	74 14                	je     800bb0 <strncmp+0x27>
+  800b9c:	0f b6 07             	movzbl (%rdi),%eax
+  800b9f:	84 c0                	test   %al,%al
+  800ba1:	74 04                	je     800ba7 <strncmp+0x1e>
+  800ba3:	3a 06                	cmp    (%rsi),%al
+  800ba5:	74 e4                	je     800b8b <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ba7:	0f b6 07             	movzbl (%rdi),%eax
+  800baa:	0f b6 16             	movzbl (%rsi),%edx
+  800bad:	29 d0                	sub    %edx,%eax
+}
+  800baf:	c3                   	ret
+		return 0;
+  800bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb5:	c3                   	ret
+
+0000000000800bb6 <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800bb6:	eb 04                	jmp    800bbc <strchr+0x6>
+  800bb8:	48 83 c7 01          	add    $0x1,%rdi
+  800bbc:	0f b6 07             	movzbl (%rdi),%eax
+  800bbf:	84 c0                	test   %al,%al
+  800bc1:	74 09                	je     800bcc <strchr+0x16>
+		if (*s == c)
+  800bc3:	40 38 f0             	cmp    %sil,%al
+  800bc6:	75 f0                	jne    800bb8 <strchr+0x2>
+  800bc8:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800bcb:	c3                   	ret
+	return 0;
+  800bcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd1:	c3                   	ret
+
+0000000000800bd2 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bd2:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800bd5:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800bd8:	40 38 f2             	cmp    %sil,%dl
+  800bdb:	74 0a                	je     800be7 <strfind+0x15>
+  800bdd:	84 d2                	test   %dl,%dl
+  800bdf:	74 06                	je     800be7 <strfind+0x15>
+	for (; *s; s++)
+  800be1:	48 83 c0 01          	add    $0x1,%rax
+  800be5:	eb ee                	jmp    800bd5 <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800be7:	c3                   	ret
+
+0000000000800be8 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800be8:	48 85 d2             	test   %rdx,%rdx
+  800beb:	74 28                	je     800c15 <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800bed:	48 89 f8             	mov    %rdi,%rax
+  800bf0:	48 09 d0             	or     %rdx,%rax
+  800bf3:	a8 03                	test   $0x3,%al
+  800bf5:	75 16                	jne    800c0d <memset+0x25>
+		c &= 0xFF;
+  800bf7:	40 0f b6 f6          	movzbl %sil,%esi
+  800bfb:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c01:	48 89 d1             	mov    %rdx,%rcx
+  800c04:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800c08:	fc                   	cld
+  800c09:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800c0b:	eb 08                	jmp    800c15 <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c0d:	89 f0                	mov    %esi,%eax
+  800c0f:	48 89 d1             	mov    %rdx,%rcx
+  800c12:	fc                   	cld
+  800c13:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c15:	48 89 f8             	mov    %rdi,%rax
+  800c18:	c3                   	ret
+
+0000000000800c19 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c19:	48 89 f8             	mov    %rdi,%rax
+  800c1c:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c1f:	48 39 fe             	cmp    %rdi,%rsi
+  800c22:	73 3a                	jae    800c5e <memmove+0x45>
+  800c24:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800c28:	48 39 d7             	cmp    %rdx,%rdi
+  800c2b:	73 31                	jae    800c5e <memmove+0x45>
+		s += n;
+		d += n;
+  800c2d:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800c31:	48 89 d6             	mov    %rdx,%rsi
+  800c34:	48 09 fe             	or     %rdi,%rsi
+  800c37:	48 09 ce             	or     %rcx,%rsi
+  800c3a:	40 f6 c6 03          	test   $0x3,%sil
+  800c3e:	75 11                	jne    800c51 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c40:	48 83 ef 04          	sub    $0x4,%rdi
+  800c44:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800c48:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800c4c:	fd                   	std
+  800c4d:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800c4f:	eb 0b                	jmp    800c5c <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c51:	48 83 ef 01          	sub    $0x1,%rdi
+  800c55:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800c59:	fd                   	std
+  800c5a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c5c:	fc                   	cld
+  800c5d:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800c5e:	48 89 f2             	mov    %rsi,%rdx
+  800c61:	48 09 c2             	or     %rax,%rdx
+  800c64:	48 09 ca             	or     %rcx,%rdx
+  800c67:	f6 c2 03             	test   $0x3,%dl
+  800c6a:	75 0b                	jne    800c77 <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c6c:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800c70:	48 89 c7             	mov    %rax,%rdi
+  800c73:	fc                   	cld
+  800c74:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800c76:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800c77:	48 89 c7             	mov    %rax,%rdi
+  800c7a:	fc                   	cld
+  800c7b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c7d:	c3                   	ret
+
+0000000000800c7e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c7e:	55                   	push   %rbp
+  800c7f:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800c82:	48 b8 19 0c 80 00 00 	movabs $0x800c19,%rax
+  800c89:	00 00 00 
+  800c8c:	ff d0                	call   *%rax
+}
+  800c8e:	5d                   	pop    %rbp
+  800c8f:	c3                   	ret
+
+0000000000800c90 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c90:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c95:	48 39 c2             	cmp    %rax,%rdx
+  800c98:	74 1e                	je     800cb8 <memcmp+0x28>
+		if (*s1 != *s2)
+  800c9a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800c9e:	48 83 c0 01          	add    $0x1,%rax
+  800ca2:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800ca8:	44 38 c1             	cmp    %r8b,%cl
+  800cab:	74 e8                	je     800c95 <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800cad:	0f b6 c1             	movzbl %cl,%eax
+  800cb0:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800cb4:	44 29 c0             	sub    %r8d,%eax
+  800cb7:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800cb8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cbd:	c3                   	ret
+
+0000000000800cbe <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cbe:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800cc1:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800cc4:	eb 04                	jmp    800cca <memfind+0xc>
+  800cc6:	48 83 c0 01          	add    $0x1,%rax
+  800cca:	48 39 d0             	cmp    %rdx,%rax
+  800ccd:	73 05                	jae    800cd4 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ccf:	40 38 30             	cmp    %sil,(%rax)
+  800cd2:	75 f2                	jne    800cc6 <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800cd4:	c3                   	ret
+
+0000000000800cd5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800cd5:	48 89 f9             	mov    %rdi,%rcx
+  800cd8:	49 89 f0             	mov    %rsi,%r8
+  800cdb:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cdd:	eb 04                	jmp    800ce3 <strtol+0xe>
+		s++;
+  800cdf:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800ce3:	0f b6 01             	movzbl (%rcx),%eax
+  800ce6:	3c 20                	cmp    $0x20,%al
+  800ce8:	74 f5                	je     800cdf <strtol+0xa>
+  800cea:	3c 09                	cmp    $0x9,%al
+  800cec:	74 f1                	je     800cdf <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800cee:	3c 2b                	cmp    $0x2b,%al
+  800cf0:	74 2b                	je     800d1d <strtol+0x48>
+	int neg = 0;
+  800cf2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800cf8:	3c 2d                	cmp    $0x2d,%al
+  800cfa:	74 2d                	je     800d29 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cfc:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800d02:	75 0f                	jne    800d13 <strtol+0x3e>
+  800d04:	80 39 30             	cmpb   $0x30,(%rcx)
+  800d07:	74 2c                	je     800d35 <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d09:	85 ff                	test   %edi,%edi
+  800d0b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d10:	0f 44 f8             	cmove  %eax,%edi
+  800d13:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800d18:	4c 63 d7             	movslq %edi,%r10
+  800d1b:	eb 4f                	jmp    800d6c <strtol+0x97>
+		s++;
+  800d1d:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800d21:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800d27:	eb d3                	jmp    800cfc <strtol+0x27>
+		s++, neg = 1;
+  800d29:	48 83 c1 01          	add    $0x1,%rcx
+  800d2d:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800d33:	eb c7                	jmp    800cfc <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d35:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800d39:	74 0f                	je     800d4a <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800d3b:	85 ff                	test   %edi,%edi
+  800d3d:	75 d4                	jne    800d13 <strtol+0x3e>
+		s++, base = 8;
+  800d3f:	48 83 c1 01          	add    $0x1,%rcx
+  800d43:	bf 08 00 00 00       	mov    $0x8,%edi
+  800d48:	eb c9                	jmp    800d13 <strtol+0x3e>
+		s += 2, base = 16;
+  800d4a:	48 83 c1 02          	add    $0x2,%rcx
+  800d4e:	bf 10 00 00 00       	mov    $0x10,%edi
+  800d53:	eb be                	jmp    800d13 <strtol+0x3e>
+			dig = *s - '0';
+  800d55:	0f be c0             	movsbl %al,%eax
+  800d58:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800d5b:	39 f8                	cmp    %edi,%eax
+  800d5d:	7d 3b                	jge    800d9a <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800d5f:	48 83 c1 01          	add    $0x1,%rcx
+  800d63:	49 0f af d2          	imul   %r10,%rdx
+  800d67:	48 98                	cltq
+  800d69:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800d6c:	0f b6 01             	movzbl (%rcx),%eax
+  800d6f:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800d72:	40 80 fe 09          	cmp    $0x9,%sil
+  800d76:	76 dd                	jbe    800d55 <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800d78:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800d7b:	40 80 fe 19          	cmp    $0x19,%sil
+  800d7f:	77 08                	ja     800d89 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800d81:	0f be c0             	movsbl %al,%eax
+  800d84:	83 e8 57             	sub    $0x57,%eax
+  800d87:	eb d2                	jmp    800d5b <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d89:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800d8c:	40 80 fe 19          	cmp    $0x19,%sil
+  800d90:	77 08                	ja     800d9a <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800d92:	0f be c0             	movsbl %al,%eax
+  800d95:	83 e8 37             	sub    $0x37,%eax
+  800d98:	eb c1                	jmp    800d5b <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d9a:	4d 85 c0             	test   %r8,%r8
+  800d9d:	74 03                	je     800da2 <strtol+0xcd>
+		*endptr = (char *) s;
+  800d9f:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800da2:	48 89 d0             	mov    %rdx,%rax
+  800da5:	48 f7 d8             	neg    %rax
+  800da8:	45 85 c9             	test   %r9d,%r9d
+  800dab:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800daf:	48 89 d0             	mov    %rdx,%rax
+  800db2:	c3                   	ret
+
+0000000000800db3 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800db3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800db9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800dbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc9:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800dcb:	c3                   	ret
+
+0000000000800dcc <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800dcc:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800dd2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800dd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ddd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800de2:	48 89 fe             	mov    %rdi,%rsi
+  800de5:	48 89 fa             	mov    %rdi,%rdx
+  800de8:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dea:	c3                   	ret
+
+0000000000800deb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800deb:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800dee:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800df4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800dfa:	be 00 00 00 00       	mov    $0x0,%esi
+  800dff:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e04:	48 89 f2             	mov    %rsi,%rdx
+  800e07:	0f 05                	syscall
+	if(check && ret > 0)
+  800e09:	48 85 c0             	test   %rax,%rax
+  800e0c:	7f 01                	jg     800e0f <sys_env_destroy+0x24>
+}
+  800e0e:	c3                   	ret
+{
+  800e0f:	55                   	push   %rbp
+  800e10:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e13:	49 89 c0             	mov    %rax,%r8
+  800e16:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800e1b:	48 ba 48 19 80 00 00 	movabs $0x801948,%rdx
+  800e22:	00 00 00 
+  800e25:	be 28 00 00 00       	mov    $0x28,%esi
+  800e2a:	48 bf 65 19 80 00 00 	movabs $0x801965,%rdi
+  800e31:	00 00 00 
+  800e34:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e39:	49 b9 42 14 80 00 00 	movabs $0x801442,%r9
+  800e40:	00 00 00 
+  800e43:	41 ff d1             	call   *%r9
+
+0000000000800e46 <sys_getenvid>:
+	asm volatile("movl %%gs:%c1, %0"
+  800e46:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800e4d:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800e4e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800e53:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800e57:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800e5b:	48 c1 e2 04          	shl    $0x4,%rdx
+  800e5f:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800e66:	00 00 00 
+  800e69:	48 01 d0             	add    %rdx,%rax
+  800e6c:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800e72:	c3                   	ret
+
+0000000000800e73 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800e73:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800e79:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800e7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e84:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e89:	48 89 fe             	mov    %rdi,%rsi
+  800e8c:	48 89 fa             	mov    %rdi,%rdx
+  800e8f:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e91:	c3                   	ret
+
+0000000000800e92 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  800e92:	48 63 d2             	movslq %edx,%rdx
+  800e95:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800e98:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800e9e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800ea4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ea9:	0f 05                	syscall
+	if(check && ret > 0)
+  800eab:	48 85 c0             	test   %rax,%rax
+  800eae:	7f 01                	jg     800eb1 <sys_page_alloc+0x1f>
+}
+  800eb0:	c3                   	ret
+{
+  800eb1:	55                   	push   %rbp
+  800eb2:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb5:	49 89 c0             	mov    %rax,%r8
+  800eb8:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800ebd:	48 ba 48 19 80 00 00 	movabs $0x801948,%rdx
+  800ec4:	00 00 00 
+  800ec7:	be 28 00 00 00       	mov    $0x28,%esi
+  800ecc:	48 bf 65 19 80 00 00 	movabs $0x801965,%rdi
+  800ed3:	00 00 00 
+  800ed6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800edb:	49 b9 42 14 80 00 00 	movabs $0x801442,%r9
+  800ee2:	00 00 00 
+  800ee5:	41 ff d1             	call   *%r9
+
+0000000000800ee8 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  800ee8:	48 63 d2             	movslq %edx,%rdx
+  800eeb:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800eee:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800ef4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800efa:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800eff:	0f 05                	syscall
+	if(check && ret > 0)
+  800f01:	48 85 c0             	test   %rax,%rax
+  800f04:	7f 01                	jg     800f07 <sys_page_alloc_huge+0x1f>
+}
+  800f06:	c3                   	ret
+{
+  800f07:	55                   	push   %rbp
+  800f08:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f0b:	49 89 c0             	mov    %rax,%r8
+  800f0e:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800f13:	48 ba 48 19 80 00 00 	movabs $0x801948,%rdx
+  800f1a:	00 00 00 
+  800f1d:	be 28 00 00 00       	mov    $0x28,%esi
+  800f22:	48 bf 65 19 80 00 00 	movabs $0x801965,%rdi
+  800f29:	00 00 00 
+  800f2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f31:	49 b9 42 14 80 00 00 	movabs $0x801442,%r9
+  800f38:	00 00 00 
+  800f3b:	41 ff d1             	call   *%r9
+
+0000000000800f3e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f3e:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  800f41:	48 63 d2             	movslq %edx,%rdx
+  800f44:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800f47:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  800f4a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f4f:	0f 05                	syscall
+	if(check && ret > 0)
+  800f51:	48 85 c0             	test   %rax,%rax
+  800f54:	7f 01                	jg     800f57 <sys_page_map+0x19>
+}
+  800f56:	c3                   	ret
+{
+  800f57:	55                   	push   %rbp
+  800f58:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f5b:	49 89 c0             	mov    %rax,%r8
+  800f5e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800f63:	48 ba 48 19 80 00 00 	movabs $0x801948,%rdx
+  800f6a:	00 00 00 
+  800f6d:	be 28 00 00 00       	mov    $0x28,%esi
+  800f72:	48 bf 65 19 80 00 00 	movabs $0x801965,%rdi
+  800f79:	00 00 00 
+  800f7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f81:	49 b9 42 14 80 00 00 	movabs $0x801442,%r9
+  800f88:	00 00 00 
+  800f8b:	41 ff d1             	call   *%r9
+
+0000000000800f8e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  800f8e:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800f91:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f97:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa2:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fa7:	0f 05                	syscall
+	if(check && ret > 0)
+  800fa9:	48 85 c0             	test   %rax,%rax
+  800fac:	7f 01                	jg     800faf <sys_page_unmap+0x21>
+}
+  800fae:	c3                   	ret
+{
+  800faf:	55                   	push   %rbp
+  800fb0:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb3:	49 89 c0             	mov    %rax,%r8
+  800fb6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800fbb:	48 ba 48 19 80 00 00 	movabs $0x801948,%rdx
+  800fc2:	00 00 00 
+  800fc5:	be 28 00 00 00       	mov    $0x28,%esi
+  800fca:	48 bf 65 19 80 00 00 	movabs $0x801965,%rdi
+  800fd1:	00 00 00 
+  800fd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd9:	49 b9 42 14 80 00 00 	movabs $0x801442,%r9
+  800fe0:	00 00 00 
+  800fe3:	41 ff d1             	call   *%r9
+
+0000000000800fe6 <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  800fe6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800ff2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ff7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ffc:	48 89 fe             	mov    %rdi,%rsi
+  800fff:	48 89 fa             	mov    %rdi,%rdx
+  801002:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801004:	c3                   	ret
+
+0000000000801005 <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  801005:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80100b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801011:	ba 00 00 00 00       	mov    $0x0,%edx
+  801016:	b8 10 00 00 00       	mov    $0x10,%eax
+  80101b:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  80101d:	c3                   	ret
+
+000000000080101e <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  80101e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801024:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80102a:	b8 11 00 00 00       	mov    $0x11,%eax
+  80102f:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  801031:	c3                   	ret
+
+0000000000801032 <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  801032:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  801035:	48 63 f6             	movslq %esi,%rsi
+  801038:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  80103b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801041:	b8 12 00 00 00       	mov    $0x12,%eax
+  801046:	0f 05                	syscall
+	if(check && ret > 0)
+  801048:	48 85 c0             	test   %rax,%rax
+  80104b:	7f 01                	jg     80104e <sys_page_batch+0x1c>
+}
+  80104d:	c3                   	ret
+{
+  80104e:	55                   	push   %rbp
+  80104f:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801052:	49 89 c0             	mov    %rax,%r8
+  801055:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80105a:	48 ba 48 19 80 00 00 	movabs $0x801948,%rdx
+  801061:	00 00 00 
+  801064:	be 28 00 00 00       	mov    $0x28,%esi
+  801069:	48 bf 65 19 80 00 00 	movabs $0x801965,%rdi
+  801070:	00 00 00 
+  801073:	b8 00 00 00 00       	mov    $0x0,%eax
+  801078:	49 b9 42 14 80 00 00 	movabs $0x801442,%r9
+  80107f:	00 00 00 
+  801082:	41 ff d1             	call   *%r9
+
+0000000000801085 <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  801085:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80108b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801091:	be 00 00 00 00       	mov    $0x0,%esi
+  801096:	b8 13 00 00 00       	mov    $0x13,%eax
+  80109b:	48 89 f2             	mov    %rsi,%rdx
+  80109e:	0f 05                	syscall
+	if(check && ret > 0)
+  8010a0:	48 85 c0             	test   %rax,%rax
+  8010a3:	7f 01                	jg     8010a6 <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  8010a5:	c3                   	ret
+{
+  8010a6:	55                   	push   %rbp
+  8010a7:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010aa:	49 89 c0             	mov    %rax,%r8
+  8010ad:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8010b2:	48 ba 48 19 80 00 00 	movabs $0x801948,%rdx
+  8010b9:	00 00 00 
+  8010bc:	be 28 00 00 00       	mov    $0x28,%esi
+  8010c1:	48 bf 65 19 80 00 00 	movabs $0x801965,%rdi
+  8010c8:	00 00 00 
+  8010cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d0:	49 b9 42 14 80 00 00 	movabs $0x801442,%r9
+  8010d7:	00 00 00 
+  8010da:	41 ff d1             	call   *%r9
+
+00000000008010dd <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  8010dd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010ee:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010f3:	48 89 fe             	mov    %rdi,%rsi
+  8010f6:	48 89 fa             	mov    %rdi,%rdx
+  8010f9:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8010fb:	c3                   	ret
+
+00000000008010fc <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  8010fc:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8010ff:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801105:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80110b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801110:	0f 05                	syscall
+	if(check && ret > 0)
+  801112:	48 85 c0             	test   %rax,%rax
+  801115:	7f 01                	jg     801118 <sys_page_unmap_range+0x1c>
+}
+  801117:	c3                   	ret
+{
+  801118:	55                   	push   %rbp
+  801119:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80111c:	49 89 c0             	mov    %rax,%r8
+  80111f:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801124:	48 ba 48 19 80 00 00 	movabs $0x801948,%rdx
+  80112b:	00 00 00 
+  80112e:	be 28 00 00 00       	mov    $0x28,%esi
+  801133:	48 bf 65 19 80 00 00 	movabs $0x801965,%rdi
+  80113a:	00 00 00 
+  80113d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801142:	49 b9 42 14 80 00 00 	movabs $0x801442,%r9
+  801149:	00 00 00 
+  80114c:	41 ff d1             	call   *%r9
+
+000000000080114f <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80114f:	48 63 f6             	movslq %esi,%rsi
+  801152:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801155:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80115b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801161:	ba 00 00 00 00       	mov    $0x0,%edx
+  801166:	b8 08 00 00 00       	mov    $0x8,%eax
+  80116b:	0f 05                	syscall
+	if(check && ret > 0)
+  80116d:	48 85 c0             	test   %rax,%rax
+  801170:	7f 01                	jg     801173 <sys_env_set_status+0x24>
+}
+  801172:	c3                   	ret
+{
+  801173:	55                   	push   %rbp
+  801174:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801177:	49 89 c0             	mov    %rax,%r8
+  80117a:	b9 08 00 00 00       	mov    $0x8,%ecx
+  80117f:	48 ba 48 19 80 00 00 	movabs $0x801948,%rdx
+  801186:	00 00 00 
+  801189:	be 28 00 00 00       	mov    $0x28,%esi
+  80118e:	48 bf 65 19 80 00 00 	movabs $0x801965,%rdi
+  801195:	00 00 00 
+  801198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80119d:	49 b9 42 14 80 00 00 	movabs $0x801442,%r9
+  8011a4:	00 00 00 
+  8011a7:	41 ff d1             	call   *%r9
+
+00000000008011aa <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8011aa:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8011ad:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011be:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011c3:	0f 05                	syscall
+	if(check && ret > 0)
+  8011c5:	48 85 c0             	test   %rax,%rax
+  8011c8:	7f 01                	jg     8011cb <sys_env_set_pgfault_upcall+0x21>
+}
+  8011ca:	c3                   	ret
+{
+  8011cb:	55                   	push   %rbp
+  8011cc:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011cf:	49 89 c0             	mov    %rax,%r8
+  8011d2:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8011d7:	48 ba 48 19 80 00 00 	movabs $0x801948,%rdx
+  8011de:	00 00 00 
+  8011e1:	be 28 00 00 00       	mov    $0x28,%esi
+  8011e6:	48 bf 65 19 80 00 00 	movabs $0x801965,%rdi
+  8011ed:	00 00 00 
+  8011f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f5:	49 b9 42 14 80 00 00 	movabs $0x801442,%r9
+  8011fc:	00 00 00 
+  8011ff:	41 ff d1             	call   *%r9
+
+0000000000801202 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  801202:	48 63 ff             	movslq %edi,%rdi
+  801205:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  801208:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80120e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801213:	0f 05                	syscall
+}
+  801215:	c3                   	ret
+
+0000000000801216 <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  801216:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80121c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801222:	be 00 00 00 00       	mov    $0x0,%esi
+  801227:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80122c:	48 89 f2             	mov    %rsi,%rdx
+  80122f:	0f 05                	syscall
+	if(check && ret > 0)
+  801231:	48 85 c0             	test   %rax,%rax
+  801234:	7f 01                	jg     801237 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  801236:	c3                   	ret
+{
+  801237:	55                   	push   %rbp
+  801238:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80123b:	49 89 c0             	mov    %rax,%r8
+  80123e:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801243:	48 ba 48 19 80 00 00 	movabs $0x801948,%rdx
+  80124a:	00 00 00 
+  80124d:	be 28 00 00 00       	mov    $0x28,%esi
+  801252:	48 bf 65 19 80 00 00 	movabs $0x801965,%rdi
+  801259:	00 00 00 
+  80125c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801261:	49 b9 42 14 80 00 00 	movabs $0x801442,%r9
+  801268:	00 00 00 
+  80126b:	41 ff d1             	call   *%r9
+
+000000000080126e <ipc_recv>:
+	- if perm_store non null, contents should be bitwise OR with thisenv->env_ipc_perm
+	- return the value sent by the sender: thisenv->env_ipc_value
+*/
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80126e:	55                   	push   %rbp
+  80126f:	48 89 e5             	mov    %rsp,%rbp
+  801272:	41 54                	push   %r12
+  801274:	53                   	push   %rbx
+  801275:	48 89 fb             	mov    %rdi,%rbx
+  801278:	48 89 f7             	mov    %rsi,%rdi
+  80127b:	49 89 d4             	mov    %rdx,%r12
+	// LAB 4: Your code here.
+	int r;
+	
+	if (pg == NULL) pg = (void *)UTOP;
+  80127e:	48 85 f6             	test   %rsi,%rsi
+  801281:	b8 00 00 80 bc       	mov    $0xbc800000,%eax
+  801286:	48 0f 44 f8          	cmove  %rax,%rdi
+	
+	r = sys_ipc_recv(pg);
+  80128a:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  801291:	00 00 00 
+  801294:	ff d0                	call   *%rax
+	
+	if (r < 0) {
+  801296:	85 c0                	test   %eax,%eax
+  801298:	0f 88 99 00 00 00    	js     801337 <ipc_recv+0xc9>
+			*perm_store = 0;
+		}
+		return r;
+	}
+	
+	if (from_env_store) {
+  80129e:	48 85 db             	test   %rbx,%rbx
+  8012a1:	74 2e                	je     8012d1 <ipc_recv+0x63>
+  8012a3:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  8012aa:	00 
+		*from_env_store = thisenv->env_ipc_from;
+  8012ab:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8012b0:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8012b4:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8012b8:	48 c1 e2 04          	shl    $0x4,%rdx
+  8012bc:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  8012c3:	00 00 00 
+  8012c6:	48 01 d0             	add    %rdx,%rax
+  8012c9:	8b 80 1c 01 00 00    	mov    0x11c(%rax),%eax
+  8012cf:	89 03                	mov    %eax,(%rbx)
+	}
+	if (perm_store) {
+  8012d1:	4d 85 e4             	test   %r12,%r12
+  8012d4:	74 30                	je     801306 <ipc_recv+0x98>
+  8012d6:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  8012dd:	00 
+		*perm_store = thisenv->env_ipc_perm;
+  8012de:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8012e3:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8012e7:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8012eb:	48 c1 e2 04          	shl    $0x4,%rdx
+  8012ef:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  8012f6:	00 00 00 
+  8012f9:	48 01 d0             	add    %rdx,%rax
+  8012fc:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+  801302:	41 89 04 24          	mov    %eax,(%r12)
+  801306:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  80130d:	00 
+	}
+	
+	return thisenv->env_ipc_value;
+  80130e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801313:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801317:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80131b:	48 c1 e2 04          	shl    $0x4,%rdx
+  80131f:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801326:	00 00 00 
+  801329:	48 01 d0             	add    %rdx,%rax
+  80132c:	8b 80 18 01 00 00    	mov    0x118(%rax),%eax
+}
+  801332:	5b                   	pop    %rbx
+  801333:	41 5c                	pop    %r12
+  801335:	5d                   	pop    %rbp
+  801336:	c3                   	ret
+		if (from_env_store) {
+  801337:	48 85 db             	test   %rbx,%rbx
+  80133a:	74 06                	je     801342 <ipc_recv+0xd4>
+			*from_env_store = 0;
+  80133c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+		if (perm_store) {
+  801342:	4d 85 e4             	test   %r12,%r12
+  801345:	74 eb                	je     801332 <ipc_recv+0xc4>
+			*perm_store = 0;
+  801347:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80134e:	00 
+  80134f:	eb e1                	jmp    801332 <ipc_recv+0xc4>
+
+0000000000801351 <ipc_send>:
+	- if a diff negative value, panic
+	- otherwise, body of loop should call sys_yield() to be allow JOS to schedule another env
+*/
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801351:	55                   	push   %rbp
+  801352:	48 89 e5             	mov    %rsp,%rbp
+  801355:	41 57                	push   %r15
+  801357:	41 56                	push   %r14
+  801359:	41 55                	push   %r13
+  80135b:	41 54                	push   %r12
+  80135d:	53                   	push   %rbx
+  80135e:	48 83 ec 18          	sub    $0x18,%rsp
+  801362:	41 89 fd             	mov    %edi,%r13d
+  801365:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  801368:	48 89 d3             	mov    %rdx,%rbx
+  80136b:	41 89 cc             	mov    %ecx,%r12d
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80136e:	48 85 d2             	test   %rdx,%rdx
+  801371:	b8 00 00 80 bc       	mov    $0xbc800000,%eax
+  801376:	48 0f 44 d8          	cmove  %rax,%rbx
+	}
+	
+	// keep trying until success
+	while (1) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  80137a:	49 be 02 12 80 00 00 	movabs $0x801202,%r14
+  801381:	00 00 00 
+		if (r == 0) {
+			return;
+		}
+		
+		if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  801384:	49 bf 73 0e 80 00 00 	movabs $0x800e73,%r15
+  80138b:	00 00 00 
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  80138e:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  801391:	44 89 e1             	mov    %r12d,%ecx
+  801394:	48 89 da             	mov    %rbx,%rdx
+  801397:	44 89 ef             	mov    %r13d,%edi
+  80139a:	41 ff d6             	call   *%r14
+		if (r == 0) {
+  80139d:	85 c0                	test   %eax,%eax
+  80139f:	74 37                	je     8013d8 <ipc_send+0x87>
+		if (r == -E_IPC_NOT_RECV) {
+  8013a1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8013a4:	75 05                	jne    8013ab <ipc_send+0x5a>
+			sys_yield();
+  8013a6:	41 ff d7             	call   *%r15
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  8013a9:	eb e3                	jmp    80138e <ipc_send+0x3d>
+		} else {
+			panic("ipc_send - %e", r);
+  8013ab:	89 c1                	mov    %eax,%ecx
+  8013ad:	48 ba 73 19 80 00 00 	movabs $0x801973,%rdx
+  8013b4:	00 00 00 
+  8013b7:	be 67 00 00 00       	mov    $0x67,%esi
+  8013bc:	48 bf 81 19 80 00 00 	movabs $0x801981,%rdi
+  8013c3:	00 00 00 
+  8013c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013cb:	49 b8 42 14 80 00 00 	movabs $0x801442,%r8
+  8013d2:	00 00 00 
+  8013d5:	41 ff d0             	call   *%r8
+		}
+	}
+}
+  8013d8:	48 83 c4 18          	add    $0x18,%rsp
+  8013dc:	5b                   	pop    %rbx
+  8013dd:	41 5c                	pop    %r12
+  8013df:	41 5d                	pop    %r13
+  8013e1:	41 5e                	pop    %r14
+  8013e3:	41 5f                	pop    %r15
+  8013e5:	5d                   	pop    %rbp
+  8013e6:	c3                   	ret
+
+00000000008013e7 <ipc_find_env>:
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+	int i;
+	for (i = 0; i < NENV; i++)
+  8013e7:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8013ec:	48 be 00 00 80 bc 00 	movabs $0xbc800000,%rsi
+  8013f3:	00 00 00 
+  8013f6:	48 63 c2             	movslq %edx,%rax
+  8013f9:	48 8d 0c c0          	lea    (%rax,%rax,8),%rcx
+  8013fd:	48 8d 04 48          	lea    (%rax,%rcx,2),%rax
+  801401:	48 c1 e0 04          	shl    $0x4,%rax
+  801405:	48 01 f0             	add    %rsi,%rax
+  801408:	8b 80 c0 00 00 00    	mov    0xc0(%rax),%eax
+  80140e:	39 f8                	cmp    %edi,%eax
+  801410:	74 11                	je     801423 <ipc_find_env+0x3c>
+	for (i = 0; i < NENV; i++)
+  801412:	83 c2 01             	add    $0x1,%edx
+  801415:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80141b:	75 d9                	jne    8013f6 <ipc_find_env+0xf>
+			return envs[i].env_id;
+	return 0;
+  80141d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801422:	c3                   	ret
+			return envs[i].env_id;
+  801423:	48 63 d2             	movslq %edx,%rdx
+  801426:	48 8d 14 4a          	lea    (%rdx,%rcx,2),%rdx
+  80142a:	48 c1 e2 04          	shl    $0x4,%rdx
+  80142e:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801435:	00 00 00 
+  801438:	48 01 d0             	add    %rdx,%rax
+  80143b:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+  801441:	c3                   	ret
+
+0000000000801442 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801442:	55                   	push   %rbp
+  801443:	48 89 e5             	mov    %rsp,%rbp
+  801446:	41 56                	push   %r14
+  801448:	41 55                	push   %r13
+  80144a:	41 54                	push   %r12
+  80144c:	53                   	push   %rbx
+  80144d:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  801454:	49 89 fc             	mov    %rdi,%r12
+  801457:	41 89 f5             	mov    %esi,%r13d
+  80145a:	48 89 d3             	mov    %rdx,%rbx
+  80145d:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  801464:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80146b:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  801472:	84 c0                	test   %al,%al
+  801474:	74 26                	je     80149c <_panic+0x5a>
+  801476:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  80147d:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  801484:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  801488:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  80148c:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  801490:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  801494:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  801498:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80149c:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8014a3:	00 00 00 
+  8014a6:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8014ad:	00 00 00 
+  8014b0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014b4:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8014bb:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8014c2:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8014c9:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  8014d0:	00 00 00 
+  8014d3:	4c 8b 30             	mov    (%rax),%r14
+  8014d6:	48 b8 46 0e 80 00 00 	movabs $0x800e46,%rax
+  8014dd:	00 00 00 
+  8014e0:	ff d0                	call   *%rax
+  8014e2:	89 c6                	mov    %eax,%esi
+  8014e4:	45 89 e8             	mov    %r13d,%r8d
+  8014e7:	4c 89 e1             	mov    %r12,%rcx
+  8014ea:	4c 89 f2             	mov    %r14,%rdx
+  8014ed:	48 bf 90 19 80 00 00 	movabs $0x801990,%rdi
+  8014f4:	00 00 00 
+  8014f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014fc:	49 bc 0e 02 80 00 00 	movabs $0x80020e,%r12
+  801503:	00 00 00 
+  801506:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801509:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  801510:	48 89 df             	mov    %rbx,%rdi
+  801513:	48 b8 aa 01 80 00 00 	movabs $0x8001aa,%rax
+  80151a:	00 00 00 
+  80151d:	ff d0                	call   *%rax
+	cprintf("\n");
+  80151f:	48 bf 4f 15 80 00 00 	movabs $0x80154f,%rdi
+  801526:	00 00 00 
+  801529:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152e:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801531:	cc                   	int3
+	while (1)
+  801532:	eb fd                	jmp    801531 <_panic+0xef>
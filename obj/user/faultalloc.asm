@@ -0,0 +1,2509 @@
+
+obj/user/faultalloc:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1e 01 00 00       	call   80014f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	53                   	push   %rbx
+  800038:	48 83 ec 08          	sub    $0x8,%rsp
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  80003c:	48 8b 1f             	mov    (%rdi),%rbx
+
+	cprintf("fault %x\n", addr);
+  80003f:	48 89 de             	mov    %rbx,%rsi
+  800042:	48 bf c0 14 80 00 00 	movabs $0x8014c0,%rdi
+  800049:	00 00 00 
+  80004c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800051:	48 ba 34 03 80 00 00 	movabs $0x800334,%rdx
+  800058:	00 00 00 
+  80005b:	ff d2                	call   *%rdx
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80005d:	48 89 de             	mov    %rbx,%rsi
+  800060:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  800067:	ba 07 00 00 00       	mov    $0x7,%edx
+  80006c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800071:	48 b8 b8 0f 80 00 00 	movabs $0x800fb8,%rax
+  800078:	00 00 00 
+  80007b:	ff d0                	call   *%rax
+  80007d:	85 c0                	test   %eax,%eax
+  80007f:	78 2d                	js     8000ae <handler+0x7b>
+				PTE_P|PTE_U|PTE_W)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800081:	48 89 d9             	mov    %rbx,%rcx
+  800084:	48 ba 10 15 80 00 00 	movabs $0x801510,%rdx
+  80008b:	00 00 00 
+  80008e:	be 64 00 00 00       	mov    $0x64,%esi
+  800093:	48 89 df             	mov    %rbx,%rdi
+  800096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009b:	49 b8 37 0b 80 00 00 	movabs $0x800b37,%r8
+  8000a2:	00 00 00 
+  8000a5:	41 ff d0             	call   *%r8
+}
+  8000a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000ac:	c9                   	leave
+  8000ad:	c3                   	ret
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  8000ae:	41 89 c0             	mov    %eax,%r8d
+  8000b1:	48 89 d9             	mov    %rbx,%rcx
+  8000b4:	48 ba e0 14 80 00 00 	movabs $0x8014e0,%rdx
+  8000bb:	00 00 00 
+  8000be:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000c3:	48 bf ca 14 80 00 00 	movabs $0x8014ca,%rdi
+  8000ca:	00 00 00 
+  8000cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d2:	49 b9 95 01 80 00 00 	movabs $0x800195,%r9
+  8000d9:	00 00 00 
+  8000dc:	41 ff d1             	call   *%r9
+
+00000000008000df <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000df:	55                   	push   %rbp
+  8000e0:	48 89 e5             	mov    %rsp,%rbp
+  8000e3:	41 54                	push   %r12
+  8000e5:	53                   	push   %rbx
+    unsigned long value = 0x1234567812345678; 
+    __asm__ volatile (
+  8000e6:	48 b8 78 56 34 12 78 	movabs $0x1234567812345678,%rax
+  8000ed:	56 34 12 
+  8000f0:	49 89 c1             	mov    %rax,%r9
+  8000f3:	49 89 c2             	mov    %rax,%r10
+  8000f6:	49 89 c3             	mov    %rax,%r11
+  8000f9:	49 89 c4             	mov    %rax,%r12
+  8000fc:	49 89 c5             	mov    %rax,%r13
+  8000ff:	49 89 c6             	mov    %rax,%r14
+        "mov %0, %%r14\n"
+        : // No output operands
+        : "r" (value) // Input operand
+        : // Clobbers
+    );	
+    set_pgfault_handler(handler);
+  800102:	48 bf 33 00 80 00 00 	movabs $0x800033,%rdi
+  800109:	00 00 00 
+  80010c:	48 b8 94 13 80 00 00 	movabs $0x801394,%rax
+  800113:	00 00 00 
+  800116:	ff d0                	call   *%rax
+	cprintf("%s\n", (char*)0x6eadBeef);
+  800118:	be ef be ad 6e       	mov    $0x6eadbeef,%esi
+  80011d:	49 bc dc 14 80 00 00 	movabs $0x8014dc,%r12
+  800124:	00 00 00 
+  800127:	4c 89 e7             	mov    %r12,%rdi
+  80012a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80012f:	48 bb 34 03 80 00 00 	movabs $0x800334,%rbx
+  800136:	00 00 00 
+  800139:	ff d3                	call   *%rbx
+	cprintf("%s\n", (char*)0x6afeBffe);
+  80013b:	be fe bf fe 6a       	mov    $0x6afebffe,%esi
+  800140:	4c 89 e7             	mov    %r12,%rdi
+  800143:	b8 00 00 00 00       	mov    $0x0,%eax
+  800148:	ff d3                	call   *%rbx
+}
+  80014a:	5b                   	pop    %rbx
+  80014b:	41 5c                	pop    %r12
+  80014d:	5d                   	pop    %rbp
+  80014e:	c3                   	ret
+
+000000000080014f <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  80014f:	55                   	push   %rbp
+  800150:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800153:	85 ff                	test   %edi,%edi
+  800155:	7e 0d                	jle    800164 <libmain+0x15>
+		binaryname = argv[0];
+  800157:	48 8b 06             	mov    (%rsi),%rax
+  80015a:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  800161:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  800164:	48 b8 df 00 80 00 00 	movabs $0x8000df,%rax
+  80016b:	00 00 00 
+  80016e:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800170:	48 b8 7e 01 80 00 00 	movabs $0x80017e,%rax
+  800177:	00 00 00 
+  80017a:	ff d0                	call   *%rax
+}
+  80017c:	5d                   	pop    %rbp
+  80017d:	c3                   	ret
+
+000000000080017e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80017e:	55                   	push   %rbp
+  80017f:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  800182:	bf 00 00 00 00       	mov    $0x0,%edi
+  800187:	48 b8 11 0f 80 00 00 	movabs $0x800f11,%rax
+  80018e:	00 00 00 
+  800191:	ff d0                	call   *%rax
+}
+  800193:	5d                   	pop    %rbp
+  800194:	c3                   	ret
+
+0000000000800195 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800195:	55                   	push   %rbp
+  800196:	48 89 e5             	mov    %rsp,%rbp
+  800199:	41 56                	push   %r14
+  80019b:	41 55                	push   %r13
+  80019d:	41 54                	push   %r12
+  80019f:	53                   	push   %rbx
+  8001a0:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8001a7:	49 89 fc             	mov    %rdi,%r12
+  8001aa:	41 89 f5             	mov    %esi,%r13d
+  8001ad:	48 89 d3             	mov    %rdx,%rbx
+  8001b0:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8001b7:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8001be:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8001c5:	84 c0                	test   %al,%al
+  8001c7:	74 26                	je     8001ef <_panic+0x5a>
+  8001c9:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8001d0:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8001d7:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8001db:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8001df:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8001e3:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8001e7:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8001eb:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001ef:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8001f6:	00 00 00 
+  8001f9:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800200:	00 00 00 
+  800203:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800207:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  80020e:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800215:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80021c:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  800223:	00 00 00 
+  800226:	4c 8b 30             	mov    (%rax),%r14
+  800229:	48 b8 6c 0f 80 00 00 	movabs $0x800f6c,%rax
+  800230:	00 00 00 
+  800233:	ff d0                	call   *%rax
+  800235:	89 c6                	mov    %eax,%esi
+  800237:	45 89 e8             	mov    %r13d,%r8d
+  80023a:	4c 89 e1             	mov    %r12,%rcx
+  80023d:	4c 89 f2             	mov    %r14,%rdx
+  800240:	48 bf 40 15 80 00 00 	movabs $0x801540,%rdi
+  800247:	00 00 00 
+  80024a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80024f:	49 bc 34 03 80 00 00 	movabs $0x800334,%r12
+  800256:	00 00 00 
+  800259:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80025c:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  800263:	48 89 df             	mov    %rbx,%rdi
+  800266:	48 b8 d0 02 80 00 00 	movabs $0x8002d0,%rax
+  80026d:	00 00 00 
+  800270:	ff d0                	call   *%rax
+	cprintf("\n");
+  800272:	48 bf de 14 80 00 00 	movabs $0x8014de,%rdi
+  800279:	00 00 00 
+  80027c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800281:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800284:	cc                   	int3
+	while (1)
+  800285:	eb fd                	jmp    800284 <_panic+0xef>
+
+0000000000800287 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800287:	55                   	push   %rbp
+  800288:	48 89 e5             	mov    %rsp,%rbp
+  80028b:	53                   	push   %rbx
+  80028c:	48 83 ec 08          	sub    $0x8,%rsp
+  800290:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  800293:	8b 06                	mov    (%rsi),%eax
+  800295:	8d 50 01             	lea    0x1(%rax),%edx
+  800298:	89 16                	mov    %edx,(%rsi)
+  80029a:	48 98                	cltq
+  80029c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  8002a1:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002a7:	74 0a                	je     8002b3 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002a9:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002b1:	c9                   	leave
+  8002b2:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002b3:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002b7:	be ff 00 00 00       	mov    $0xff,%esi
+  8002bc:	48 b8 d9 0e 80 00 00 	movabs $0x800ed9,%rax
+  8002c3:	00 00 00 
+  8002c6:	ff d0                	call   *%rax
+		b->idx = 0;
+  8002c8:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002ce:	eb d9                	jmp    8002a9 <putch+0x22>
+
+00000000008002d0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002d0:	55                   	push   %rbp
+  8002d1:	48 89 e5             	mov    %rsp,%rbp
+  8002d4:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002db:	48 89 fa             	mov    %rdi,%rdx
+  8002de:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  8002e1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8002e8:	00 00 00 
+	b.cnt = 0;
+  8002eb:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8002f2:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002f5:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  8002fc:	48 bf 87 02 80 00 00 	movabs $0x800287,%rdi
+  800303:	00 00 00 
+  800306:	48 b8 ee 04 80 00 00 	movabs $0x8004ee,%rax
+  80030d:	00 00 00 
+  800310:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  800312:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  800319:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800320:	48 b8 d9 0e 80 00 00 	movabs $0x800ed9,%rax
+  800327:	00 00 00 
+  80032a:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  80032c:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  800332:	c9                   	leave
+  800333:	c3                   	ret
+
+0000000000800334 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800334:	55                   	push   %rbp
+  800335:	48 89 e5             	mov    %rsp,%rbp
+  800338:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80033f:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800346:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80034d:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800354:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80035b:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800362:	84 c0                	test   %al,%al
+  800364:	74 20                	je     800386 <cprintf+0x52>
+  800366:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80036a:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80036e:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800372:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800376:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80037a:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80037e:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800382:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800386:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  80038d:	00 00 00 
+  800390:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800397:	00 00 00 
+  80039a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80039e:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8003a5:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8003ac:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  8003b3:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  8003ba:	48 b8 d0 02 80 00 00 	movabs $0x8002d0,%rax
+  8003c1:	00 00 00 
+  8003c4:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  8003c6:	c9                   	leave
+  8003c7:	c3                   	ret
+
+00000000008003c8 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8003c8:	55                   	push   %rbp
+  8003c9:	48 89 e5             	mov    %rsp,%rbp
+  8003cc:	41 57                	push   %r15
+  8003ce:	41 56                	push   %r14
+  8003d0:	41 55                	push   %r13
+  8003d2:	41 54                	push   %r12
+  8003d4:	53                   	push   %rbx
+  8003d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8003d9:	49 89 fc             	mov    %rdi,%r12
+  8003dc:	49 89 f5             	mov    %rsi,%r13
+  8003df:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003e3:	44 89 c3             	mov    %r8d,%ebx
+  8003e6:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003e9:	41 89 cf             	mov    %ecx,%r15d
+  8003ec:	4c 39 fa             	cmp    %r15,%rdx
+  8003ef:	72 29                	jb     80041a <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003f1:	48 89 d0             	mov    %rdx,%rax
+  8003f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003f9:	49 f7 f7             	div    %r15
+  8003fc:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800400:	48 89 c2             	mov    %rax,%rdx
+  800403:	48 b8 c8 03 80 00 00 	movabs $0x8003c8,%rax
+  80040a:	00 00 00 
+  80040d:	ff d0                	call   *%rax
+  80040f:	eb 10                	jmp    800421 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800411:	4c 89 ee             	mov    %r13,%rsi
+  800414:	44 89 f7             	mov    %r14d,%edi
+  800417:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  80041a:	83 eb 01             	sub    $0x1,%ebx
+  80041d:	85 db                	test   %ebx,%ebx
+  80041f:	7f f0                	jg     800411 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800421:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800425:	ba 00 00 00 00       	mov    $0x0,%edx
+  80042a:	49 f7 f7             	div    %r15
+  80042d:	48 b8 63 15 80 00 00 	movabs $0x801563,%rax
+  800434:	00 00 00 
+  800437:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  80043b:	4c 89 ee             	mov    %r13,%rsi
+  80043e:	41 ff d4             	call   *%r12
+}
+  800441:	48 83 c4 18          	add    $0x18,%rsp
+  800445:	5b                   	pop    %rbx
+  800446:	41 5c                	pop    %r12
+  800448:	41 5d                	pop    %r13
+  80044a:	41 5e                	pop    %r14
+  80044c:	41 5f                	pop    %r15
+  80044e:	5d                   	pop    %rbp
+  80044f:	c3                   	ret
+
+0000000000800450 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  800450:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  800454:	48 8b 06             	mov    (%rsi),%rax
+  800457:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80045b:	73 0a                	jae    800467 <sprintputch+0x17>
+		*b->buf++ = ch;
+  80045d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800461:	48 89 16             	mov    %rdx,(%rsi)
+  800464:	40 88 38             	mov    %dil,(%rax)
+}
+  800467:	c3                   	ret
+
+0000000000800468 <printfmt>:
+{
+  800468:	55                   	push   %rbp
+  800469:	48 89 e5             	mov    %rsp,%rbp
+  80046c:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800473:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80047a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800481:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800488:	84 c0                	test   %al,%al
+  80048a:	74 20                	je     8004ac <printfmt+0x44>
+  80048c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800490:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800494:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800498:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80049c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8004a0:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8004a4:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8004a8:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  8004ac:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8004b3:	00 00 00 
+  8004b6:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8004bd:	00 00 00 
+  8004c0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004c4:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8004cb:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8004d2:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8004d9:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8004e0:	48 b8 ee 04 80 00 00 	movabs $0x8004ee,%rax
+  8004e7:	00 00 00 
+  8004ea:	ff d0                	call   *%rax
+}
+  8004ec:	c9                   	leave
+  8004ed:	c3                   	ret
+
+00000000008004ee <vprintfmt>:
+{
+  8004ee:	55                   	push   %rbp
+  8004ef:	48 89 e5             	mov    %rsp,%rbp
+  8004f2:	41 57                	push   %r15
+  8004f4:	41 56                	push   %r14
+  8004f6:	41 55                	push   %r13
+  8004f8:	41 54                	push   %r12
+  8004fa:	53                   	push   %rbx
+  8004fb:	48 83 ec 48          	sub    $0x48,%rsp
+  8004ff:	49 89 fe             	mov    %rdi,%r14
+  800502:	49 89 f5             	mov    %rsi,%r13
+  800505:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  800508:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  80050c:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  800510:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  800518:	eb 09                	jmp    800523 <vprintfmt+0x35>
+			putch(ch, putdat);
+  80051a:	4c 89 ee             	mov    %r13,%rsi
+  80051d:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800520:	4c 89 e3             	mov    %r12,%rbx
+  800523:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800527:	0f b6 3b             	movzbl (%rbx),%edi
+  80052a:	83 ff 25             	cmp    $0x25,%edi
+  80052d:	74 13                	je     800542 <vprintfmt+0x54>
+			if (ch == '\0')
+  80052f:	85 ff                	test   %edi,%edi
+  800531:	75 e7                	jne    80051a <vprintfmt+0x2c>
+}
+  800533:	48 83 c4 48          	add    $0x48,%rsp
+  800537:	5b                   	pop    %rbx
+  800538:	41 5c                	pop    %r12
+  80053a:	41 5d                	pop    %r13
+  80053c:	41 5e                	pop    %r14
+  80053e:	41 5f                	pop    %r15
+  800540:	5d                   	pop    %rbp
+  800541:	c3                   	ret
+		padc = ' ';
+  800542:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  800546:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  80054d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  800553:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  80055a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80055f:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800564:	41 0f b6 14 24       	movzbl (%r12),%edx
+  800569:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  80056c:	3c 55                	cmp    $0x55,%al
+  80056e:	0f 87 4f 05 00 00    	ja     800ac3 <vprintfmt+0x5d5>
+  800574:	0f b6 c0             	movzbl %al,%eax
+  800577:	48 be 20 16 80 00 00 	movabs $0x801620,%rsi
+  80057e:	00 00 00 
+  800581:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  800584:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  800587:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  80058b:	eb d2                	jmp    80055f <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  80058d:	49 89 dc             	mov    %rbx,%r12
+  800590:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  800594:	eb c9                	jmp    80055f <vprintfmt+0x71>
+  800596:	0f b6 d2             	movzbl %dl,%edx
+  800599:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  80059c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  8005a2:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  8005a6:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  8005ab:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  8005b0:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  8005b3:	83 f8 09             	cmp    $0x9,%eax
+  8005b6:	77 20                	ja     8005d8 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  8005b8:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  8005bc:	eb e4                	jmp    8005a2 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  8005be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8005c4:	77 27                	ja     8005ed <vprintfmt+0xff>
+  8005c6:	89 c2                	mov    %eax,%edx
+  8005c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005cc:	83 c0 08             	add    $0x8,%eax
+  8005cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005d2:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  8005d5:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  8005d8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005dc:	79 81                	jns    80055f <vprintfmt+0x71>
+				width = precision, precision = -1;
+  8005de:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  8005e2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005e8:	e9 72 ff ff ff       	jmp    80055f <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  8005ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005f1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005f9:	eb d7                	jmp    8005d2 <vprintfmt+0xe4>
+			if (width < 0)
+  8005fb:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  8005fe:	85 f6                	test   %esi,%esi
+  800600:	b8 00 00 00 00       	mov    $0x0,%eax
+  800605:	0f 49 c6             	cmovns %esi,%eax
+  800608:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80060b:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  80060e:	e9 4c ff ff ff       	jmp    80055f <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800613:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  800616:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  80061d:	e9 3d ff ff ff       	jmp    80055f <vprintfmt+0x71>
+			lflag++;
+  800622:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800625:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800628:	e9 32 ff ff ff       	jmp    80055f <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  80062d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800630:	83 f8 2f             	cmp    $0x2f,%eax
+  800633:	77 19                	ja     80064e <vprintfmt+0x160>
+  800635:	89 c2                	mov    %eax,%edx
+  800637:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80063b:	83 c0 08             	add    $0x8,%eax
+  80063e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800641:	8b 3a                	mov    (%rdx),%edi
+  800643:	4c 89 ee             	mov    %r13,%rsi
+  800646:	41 ff d6             	call   *%r14
+			break;
+  800649:	e9 d5 fe ff ff       	jmp    800523 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  80064e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800652:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800656:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80065a:	eb e5                	jmp    800641 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  80065c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80065f:	83 f8 2f             	cmp    $0x2f,%eax
+  800662:	77 5a                	ja     8006be <vprintfmt+0x1d0>
+  800664:	89 c2                	mov    %eax,%edx
+  800666:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80066a:	83 c0 08             	add    $0x8,%eax
+  80066d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800670:	8b 02                	mov    (%rdx),%eax
+  800672:	89 c1                	mov    %eax,%ecx
+  800674:	f7 d9                	neg    %ecx
+  800676:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800679:	83 f9 08             	cmp    $0x8,%ecx
+  80067c:	7f 4e                	jg     8006cc <vprintfmt+0x1de>
+  80067e:	48 63 c1             	movslq %ecx,%rax
+  800681:	48 ba e0 18 80 00 00 	movabs $0x8018e0,%rdx
+  800688:	00 00 00 
+  80068b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80068f:	48 85 c0             	test   %rax,%rax
+  800692:	74 38                	je     8006cc <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800694:	48 89 c1             	mov    %rax,%rcx
+  800697:	48 ba 84 15 80 00 00 	movabs $0x801584,%rdx
+  80069e:	00 00 00 
+  8006a1:	4c 89 ee             	mov    %r13,%rsi
+  8006a4:	4c 89 f7             	mov    %r14,%rdi
+  8006a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ac:	49 b8 68 04 80 00 00 	movabs $0x800468,%r8
+  8006b3:	00 00 00 
+  8006b6:	41 ff d0             	call   *%r8
+  8006b9:	e9 65 fe ff ff       	jmp    800523 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  8006be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ca:	eb a4                	jmp    800670 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  8006cc:	48 ba 7b 15 80 00 00 	movabs $0x80157b,%rdx
+  8006d3:	00 00 00 
+  8006d6:	4c 89 ee             	mov    %r13,%rsi
+  8006d9:	4c 89 f7             	mov    %r14,%rdi
+  8006dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e1:	49 b8 68 04 80 00 00 	movabs $0x800468,%r8
+  8006e8:	00 00 00 
+  8006eb:	41 ff d0             	call   *%r8
+  8006ee:	e9 30 fe ff ff       	jmp    800523 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  8006f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8006f9:	77 36                	ja     800731 <vprintfmt+0x243>
+  8006fb:	89 c2                	mov    %eax,%edx
+  8006fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800701:	83 c0 08             	add    $0x8,%eax
+  800704:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800707:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  80070a:	48 85 c9             	test   %rcx,%rcx
+  80070d:	48 b8 74 15 80 00 00 	movabs $0x801574,%rax
+  800714:	00 00 00 
+  800717:	48 0f 45 c1          	cmovne %rcx,%rax
+  80071b:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  80071f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800723:	7e 06                	jle    80072b <vprintfmt+0x23d>
+  800725:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800729:	75 14                	jne    80073f <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80072b:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80072f:	eb 64                	jmp    800795 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800731:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800735:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800739:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80073d:	eb c8                	jmp    800707 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80073f:	49 63 f7             	movslq %r15d,%rsi
+  800742:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800746:	48 b8 d1 0b 80 00 00 	movabs $0x800bd1,%rax
+  80074d:	00 00 00 
+  800750:	ff d0                	call   *%rax
+  800752:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800755:	29 c1                	sub    %eax,%ecx
+  800757:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  80075a:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  80075d:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800761:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800764:	eb 0d                	jmp    800773 <vprintfmt+0x285>
+					putch(padc, putdat);
+  800766:	4c 89 ee             	mov    %r13,%rsi
+  800769:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  80076c:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80076f:	41 83 ec 01          	sub    $0x1,%r12d
+  800773:	45 85 e4             	test   %r12d,%r12d
+  800776:	7f ee                	jg     800766 <vprintfmt+0x278>
+  800778:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  80077b:	85 c9                	test   %ecx,%ecx
+  80077d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800782:	0f 49 c1             	cmovns %ecx,%eax
+  800785:	29 c1                	sub    %eax,%ecx
+  800787:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  80078a:	eb 9f                	jmp    80072b <vprintfmt+0x23d>
+					putch(ch, putdat);
+  80078c:	4c 89 ee             	mov    %r13,%rsi
+  80078f:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800792:	4c 89 e2             	mov    %r12,%rdx
+  800795:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800799:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80079f:	0f be f8             	movsbl %al,%edi
+  8007a2:	85 ff                	test   %edi,%edi
+  8007a4:	74 29                	je     8007cf <vprintfmt+0x2e1>
+  8007a6:	45 85 ff             	test   %r15d,%r15d
+  8007a9:	78 06                	js     8007b1 <vprintfmt+0x2c3>
+  8007ab:	41 83 ef 01          	sub    $0x1,%r15d
+  8007af:	78 1e                	js     8007cf <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007b1:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  8007b5:	74 d5                	je     80078c <vprintfmt+0x29e>
+  8007b7:	0f be c0             	movsbl %al,%eax
+  8007ba:	83 e8 20             	sub    $0x20,%eax
+  8007bd:	83 f8 5e             	cmp    $0x5e,%eax
+  8007c0:	76 ca                	jbe    80078c <vprintfmt+0x29e>
+					putch('?', putdat);
+  8007c2:	4c 89 ee             	mov    %r13,%rsi
+  8007c5:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007ca:	41 ff d6             	call   *%r14
+  8007cd:	eb c3                	jmp    800792 <vprintfmt+0x2a4>
+  8007cf:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  8007d3:	8b 45 98             	mov    -0x68(%rbp),%eax
+  8007d6:	41 01 c4             	add    %eax,%r12d
+  8007d9:	41 29 d4             	sub    %edx,%r12d
+  8007dc:	eb 0f                	jmp    8007ed <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  8007de:	4c 89 ee             	mov    %r13,%rsi
+  8007e1:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007e6:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  8007e9:	41 83 ec 01          	sub    $0x1,%r12d
+  8007ed:	45 85 e4             	test   %r12d,%r12d
+  8007f0:	7f ec                	jg     8007de <vprintfmt+0x2f0>
+  8007f2:	e9 2c fd ff ff       	jmp    800523 <vprintfmt+0x35>
+	if (lflag >= 2)
+  8007f7:	83 f9 01             	cmp    $0x1,%ecx
+  8007fa:	7f 1d                	jg     800819 <vprintfmt+0x32b>
+	else if (lflag)
+  8007fc:	85 c9                	test   %ecx,%ecx
+  8007fe:	74 5e                	je     80085e <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800800:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800803:	83 f8 2f             	cmp    $0x2f,%eax
+  800806:	77 48                	ja     800850 <vprintfmt+0x362>
+  800808:	89 c2                	mov    %eax,%edx
+  80080a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80080e:	83 c0 08             	add    $0x8,%eax
+  800811:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800814:	4c 8b 22             	mov    (%rdx),%r12
+  800817:	eb 17                	jmp    800830 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800819:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081c:	83 f8 2f             	cmp    $0x2f,%eax
+  80081f:	77 21                	ja     800842 <vprintfmt+0x354>
+  800821:	89 c2                	mov    %eax,%edx
+  800823:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800827:	83 c0 08             	add    $0x8,%eax
+  80082a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80082d:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800830:	4d 85 e4             	test   %r12,%r12
+  800833:	78 50                	js     800885 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  800835:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800838:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80083d:	e9 b4 01 00 00       	jmp    8009f6 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800842:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800846:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80084a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084e:	eb dd                	jmp    80082d <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800850:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800854:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800858:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80085c:	eb b6                	jmp    800814 <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  80085e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800861:	83 f8 2f             	cmp    $0x2f,%eax
+  800864:	77 11                	ja     800877 <vprintfmt+0x389>
+  800866:	89 c2                	mov    %eax,%edx
+  800868:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086c:	83 c0 08             	add    $0x8,%eax
+  80086f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800872:	4c 63 22             	movslq (%rdx),%r12
+  800875:	eb b9                	jmp    800830 <vprintfmt+0x342>
+  800877:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800883:	eb ed                	jmp    800872 <vprintfmt+0x384>
+				putch('-', putdat);
+  800885:	4c 89 ee             	mov    %r13,%rsi
+  800888:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80088d:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800890:	4c 89 e2             	mov    %r12,%rdx
+  800893:	48 f7 da             	neg    %rdx
+			base = 10;
+  800896:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80089b:	e9 56 01 00 00       	jmp    8009f6 <vprintfmt+0x508>
+	if (lflag >= 2)
+  8008a0:	83 f9 01             	cmp    $0x1,%ecx
+  8008a3:	7f 25                	jg     8008ca <vprintfmt+0x3dc>
+	else if (lflag)
+  8008a5:	85 c9                	test   %ecx,%ecx
+  8008a7:	74 5e                	je     800907 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  8008a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8008af:	77 48                	ja     8008f9 <vprintfmt+0x40b>
+  8008b1:	89 c2                	mov    %eax,%edx
+  8008b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b7:	83 c0 08             	add    $0x8,%eax
+  8008ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008bd:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8008c0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  8008c5:	e9 2c 01 00 00       	jmp    8009f6 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8008ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d0:	77 19                	ja     8008eb <vprintfmt+0x3fd>
+  8008d2:	89 c2                	mov    %eax,%edx
+  8008d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d8:	83 c0 08             	add    $0x8,%eax
+  8008db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008de:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8008e1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  8008e6:	e9 0b 01 00 00       	jmp    8009f6 <vprintfmt+0x508>
+  8008eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f7:	eb e5                	jmp    8008de <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  8008f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800901:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800905:	eb b6                	jmp    8008bd <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800907:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090a:	83 f8 2f             	cmp    $0x2f,%eax
+  80090d:	77 18                	ja     800927 <vprintfmt+0x439>
+  80090f:	89 c2                	mov    %eax,%edx
+  800911:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800915:	83 c0 08             	add    $0x8,%eax
+  800918:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091b:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  80091d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800922:	e9 cf 00 00 00       	jmp    8009f6 <vprintfmt+0x508>
+  800927:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800933:	eb e6                	jmp    80091b <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800935:	83 f9 01             	cmp    $0x1,%ecx
+  800938:	7f 25                	jg     80095f <vprintfmt+0x471>
+	else if (lflag)
+  80093a:	85 c9                	test   %ecx,%ecx
+  80093c:	74 5b                	je     800999 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  80093e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800941:	83 f8 2f             	cmp    $0x2f,%eax
+  800944:	77 45                	ja     80098b <vprintfmt+0x49d>
+  800946:	89 c2                	mov    %eax,%edx
+  800948:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80094c:	83 c0 08             	add    $0x8,%eax
+  80094f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800952:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800955:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  80095a:	e9 97 00 00 00       	jmp    8009f6 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  80095f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800962:	83 f8 2f             	cmp    $0x2f,%eax
+  800965:	77 16                	ja     80097d <vprintfmt+0x48f>
+  800967:	89 c2                	mov    %eax,%edx
+  800969:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096d:	83 c0 08             	add    $0x8,%eax
+  800970:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800973:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800976:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  80097b:	eb 79                	jmp    8009f6 <vprintfmt+0x508>
+  80097d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800981:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800985:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800989:	eb e8                	jmp    800973 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  80098b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80098f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800993:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800997:	eb b9                	jmp    800952 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800999:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099c:	83 f8 2f             	cmp    $0x2f,%eax
+  80099f:	77 15                	ja     8009b6 <vprintfmt+0x4c8>
+  8009a1:	89 c2                	mov    %eax,%edx
+  8009a3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a7:	83 c0 08             	add    $0x8,%eax
+  8009aa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ad:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  8009af:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  8009b4:	eb 40                	jmp    8009f6 <vprintfmt+0x508>
+  8009b6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c2:	eb e9                	jmp    8009ad <vprintfmt+0x4bf>
+			putch('0', putdat);
+  8009c4:	4c 89 ee             	mov    %r13,%rsi
+  8009c7:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009cc:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  8009cf:	4c 89 ee             	mov    %r13,%rsi
+  8009d2:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009d7:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  8009da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e0:	77 34                	ja     800a16 <vprintfmt+0x528>
+  8009e2:	89 c2                	mov    %eax,%edx
+  8009e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e8:	83 c0 08             	add    $0x8,%eax
+  8009eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  8009ee:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  8009f1:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  8009f6:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  8009fb:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009ff:	4c 89 ee             	mov    %r13,%rsi
+  800a02:	4c 89 f7             	mov    %r14,%rdi
+  800a05:	48 b8 c8 03 80 00 00 	movabs $0x8003c8,%rax
+  800a0c:	00 00 00 
+  800a0f:	ff d0                	call   *%rax
+			break;
+  800a11:	e9 0d fb ff ff       	jmp    800523 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800a16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a22:	eb ca                	jmp    8009ee <vprintfmt+0x500>
+	if (lflag >= 2)
+  800a24:	83 f9 01             	cmp    $0x1,%ecx
+  800a27:	7f 22                	jg     800a4b <vprintfmt+0x55d>
+	else if (lflag)
+  800a29:	85 c9                	test   %ecx,%ecx
+  800a2b:	74 58                	je     800a85 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800a2d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a30:	83 f8 2f             	cmp    $0x2f,%eax
+  800a33:	77 42                	ja     800a77 <vprintfmt+0x589>
+  800a35:	89 c2                	mov    %eax,%edx
+  800a37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3b:	83 c0 08             	add    $0x8,%eax
+  800a3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a41:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800a44:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800a49:	eb ab                	jmp    8009f6 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800a4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a51:	77 16                	ja     800a69 <vprintfmt+0x57b>
+  800a53:	89 c2                	mov    %eax,%edx
+  800a55:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a59:	83 c0 08             	add    $0x8,%eax
+  800a5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5f:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800a62:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800a67:	eb 8d                	jmp    8009f6 <vprintfmt+0x508>
+  800a69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a75:	eb e8                	jmp    800a5f <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800a77:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a83:	eb bc                	jmp    800a41 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800a85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a88:	83 f8 2f             	cmp    $0x2f,%eax
+  800a8b:	77 18                	ja     800aa5 <vprintfmt+0x5b7>
+  800a8d:	89 c2                	mov    %eax,%edx
+  800a8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a93:	83 c0 08             	add    $0x8,%eax
+  800a96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a99:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800a9b:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800aa0:	e9 51 ff ff ff       	jmp    8009f6 <vprintfmt+0x508>
+  800aa5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab1:	eb e6                	jmp    800a99 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800ab3:	4c 89 ee             	mov    %r13,%rsi
+  800ab6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800abb:	41 ff d6             	call   *%r14
+			break;
+  800abe:	e9 60 fa ff ff       	jmp    800523 <vprintfmt+0x35>
+			putch('%', putdat);
+  800ac3:	4c 89 ee             	mov    %r13,%rsi
+  800ac6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800acb:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800ace:	4c 89 e3             	mov    %r12,%rbx
+  800ad1:	eb 04                	jmp    800ad7 <vprintfmt+0x5e9>
+  800ad3:	48 83 eb 01          	sub    $0x1,%rbx
+  800ad7:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800adb:	75 f6                	jne    800ad3 <vprintfmt+0x5e5>
+  800add:	e9 41 fa ff ff       	jmp    800523 <vprintfmt+0x35>
+
+0000000000800ae2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800ae2:	55                   	push   %rbp
+  800ae3:	48 89 e5             	mov    %rsp,%rbp
+  800ae6:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800aea:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800aee:	48 63 c6             	movslq %esi,%rax
+  800af1:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800af6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800afa:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800b01:	48 85 ff             	test   %rdi,%rdi
+  800b04:	74 2a                	je     800b30 <vsnprintf+0x4e>
+  800b06:	85 f6                	test   %esi,%esi
+  800b08:	7e 26                	jle    800b30 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b0a:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800b0e:	48 bf 50 04 80 00 00 	movabs $0x800450,%rdi
+  800b15:	00 00 00 
+  800b18:	48 b8 ee 04 80 00 00 	movabs $0x8004ee,%rax
+  800b1f:	00 00 00 
+  800b22:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b24:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800b28:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800b2b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800b2e:	c9                   	leave
+  800b2f:	c3                   	ret
+		return -E_INVAL;
+  800b30:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b35:	eb f7                	jmp    800b2e <vsnprintf+0x4c>
+
+0000000000800b37 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b37:	55                   	push   %rbp
+  800b38:	48 89 e5             	mov    %rsp,%rbp
+  800b3b:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800b42:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800b49:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800b50:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800b57:	84 c0                	test   %al,%al
+  800b59:	74 20                	je     800b7b <snprintf+0x44>
+  800b5b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800b5f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800b63:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800b67:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800b6b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800b6f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800b73:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800b77:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b7b:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800b82:	00 00 00 
+  800b85:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800b8c:	00 00 00 
+  800b8f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b93:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800b9a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800ba1:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800ba8:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800baf:	48 b8 e2 0a 80 00 00 	movabs $0x800ae2,%rax
+  800bb6:	00 00 00 
+  800bb9:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800bbb:	c9                   	leave
+  800bbc:	c3                   	ret
+
+0000000000800bbd <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800bbd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bc2:	48 89 d0             	mov    %rdx,%rax
+  800bc5:	48 83 c2 01          	add    $0x1,%rdx
+  800bc9:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800bce:	75 f2                	jne    800bc2 <strlen+0x5>
+		n++;
+	return n;
+}
+  800bd0:	c3                   	ret
+
+0000000000800bd1 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd6:	eb 03                	jmp    800bdb <strnlen+0xa>
+  800bd8:	48 89 d0             	mov    %rdx,%rax
+  800bdb:	48 39 c6             	cmp    %rax,%rsi
+  800bde:	74 0a                	je     800bea <strnlen+0x19>
+  800be0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800be4:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800be8:	75 ee                	jne    800bd8 <strnlen+0x7>
+		n++;
+	return n;
+}
+  800bea:	c3                   	ret
+
+0000000000800beb <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800beb:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800bee:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf3:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bf7:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800bfa:	48 83 c2 01          	add    $0x1,%rdx
+  800bfe:	84 c9                	test   %cl,%cl
+  800c00:	75 f1                	jne    800bf3 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800c02:	c3                   	ret
+
+0000000000800c03 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c03:	55                   	push   %rbp
+  800c04:	48 89 e5             	mov    %rsp,%rbp
+  800c07:	41 54                	push   %r12
+  800c09:	53                   	push   %rbx
+  800c0a:	48 89 fb             	mov    %rdi,%rbx
+  800c0d:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800c10:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  800c17:	00 00 00 
+  800c1a:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800c1c:	48 63 f8             	movslq %eax,%rdi
+  800c1f:	48 01 df             	add    %rbx,%rdi
+  800c22:	4c 89 e6             	mov    %r12,%rsi
+  800c25:	48 b8 eb 0b 80 00 00 	movabs $0x800beb,%rax
+  800c2c:	00 00 00 
+  800c2f:	ff d0                	call   *%rax
+	return dst;
+}
+  800c31:	48 89 d8             	mov    %rbx,%rax
+  800c34:	5b                   	pop    %rbx
+  800c35:	41 5c                	pop    %r12
+  800c37:	5d                   	pop    %rbp
+  800c38:	c3                   	ret
+
+0000000000800c39 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c39:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c3c:	48 01 fa             	add    %rdi,%rdx
+  800c3f:	48 89 f9             	mov    %rdi,%rcx
+  800c42:	eb 14                	jmp    800c58 <strncpy+0x1f>
+		*dst++ = *src;
+  800c44:	48 83 c1 01          	add    $0x1,%rcx
+  800c48:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c4c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c50:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c54:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800c58:	48 39 d1             	cmp    %rdx,%rcx
+  800c5b:	75 e7                	jne    800c44 <strncpy+0xb>
+	}
+	return ret;
+}
+  800c5d:	c3                   	ret
+
+0000000000800c5e <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c5e:	48 89 f8             	mov    %rdi,%rax
+  800c61:	48 85 d2             	test   %rdx,%rdx
+  800c64:	74 27                	je     800c8d <strlcpy+0x2f>
+  800c66:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800c6b:	48 89 fa             	mov    %rdi,%rdx
+  800c6e:	eb 0b                	jmp    800c7b <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c70:	48 83 c6 01          	add    $0x1,%rsi
+  800c74:	48 83 c2 01          	add    $0x1,%rdx
+  800c78:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800c7b:	48 39 c2             	cmp    %rax,%rdx
+  800c7e:	74 0a                	je     800c8a <strlcpy+0x2c>
+  800c80:	0f b6 0e             	movzbl (%rsi),%ecx
+  800c83:	84 c9                	test   %cl,%cl
+  800c85:	75 e9                	jne    800c70 <strlcpy+0x12>
+  800c87:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800c8a:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800c8d:	48 29 f8             	sub    %rdi,%rax
+}
+  800c90:	c3                   	ret
+
+0000000000800c91 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800c91:	eb 08                	jmp    800c9b <strcmp+0xa>
+		p++, q++;
+  800c93:	48 83 c7 01          	add    $0x1,%rdi
+  800c97:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800c9b:	0f b6 07             	movzbl (%rdi),%eax
+  800c9e:	84 c0                	test   %al,%al
+  800ca0:	74 04                	je     800ca6 <strcmp+0x15>
+  800ca2:	3a 06                	cmp    (%rsi),%al
+  800ca4:	74 ed                	je     800c93 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ca6:	0f b6 c0             	movzbl %al,%eax
+  800ca9:	0f b6 16             	movzbl (%rsi),%edx
+  800cac:	29 d0                	sub    %edx,%eax
+}
+  800cae:	c3                   	ret
+
+0000000000800caf <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800caf:	eb 0c                	jmp    800cbd <strncmp+0xe>
+		n--, p++, q++;
+  800cb1:	48 83 ea 01          	sub    $0x1,%rdx
+  800cb5:	48 83 c7 01          	add    $0x1,%rdi
+  800cb9:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800cbd:	48 85 d2             	test   %rdx,%rdx
+  800cc0:	74 14                	je     800cd6 <strncmp+0x27>
+  800cc2:	0f b6 07             	movzbl (%rdi),%eax
+  800cc5:	84 c0                	test   %al,%al
+  800cc7:	74 04                	je     800ccd <strncmp+0x1e>
+  800cc9:	3a 06                	cmp    (%rsi),%al
+  800ccb:	74 e4                	je     800cb1 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ccd:	0f b6 07             	movzbl (%rdi),%eax
+  800cd0:	0f b6 16             	movzbl (%rsi),%edx
+  800cd3:	29 d0                	sub    %edx,%eax
+}
+  800cd5:	c3                   	ret
+		return 0;
+  800cd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cdb:	c3                   	ret
+
+0000000000800cdc <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800cdc:	eb 04                	jmp    800ce2 <strchr+0x6>
+  800cde:	48 83 c7 01          	add    $0x1,%rdi
+  800ce2:	0f b6 07             	movzbl (%rdi),%eax
+  800ce5:	84 c0                	test   %al,%al
+  800ce7:	74 09                	je     800cf2 <strchr+0x16>
+		if (*s == c)
+  800ce9:	40 38 f0             	cmp    %sil,%al
+  800cec:	75 f0                	jne    800cde <strchr+0x2>
+  800cee:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800cf1:	c3                   	ret
+	return 0;
+  800cf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf7:	c3                   	ret
+
+0000000000800cf8 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800cf8:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800cfb:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800cfe:	40 38 f2             	cmp    %sil,%dl
+  800d01:	74 0a                	je     800d0d <strfind+0x15>
+  800d03:	84 d2                	test   %dl,%dl
+  800d05:	74 06                	je     800d0d <strfind+0x15>
+	for (; *s; s++)
+  800d07:	48 83 c0 01          	add    $0x1,%rax
+  800d0b:	eb ee                	jmp    800cfb <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800d0d:	c3                   	ret
+
+0000000000800d0e <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800d0e:	48 85 d2             	test   %rdx,%rdx
+  800d11:	74 28                	je     800d3b <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800d13:	48 89 f8             	mov    %rdi,%rax
+  800d16:	48 09 d0             	or     %rdx,%rax
+  800d19:	a8 03                	test   $0x3,%al
+  800d1b:	75 16                	jne    800d33 <memset+0x25>
+		c &= 0xFF;
+  800d1d:	40 0f b6 f6          	movzbl %sil,%esi
+  800d21:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d27:	48 89 d1             	mov    %rdx,%rcx
+  800d2a:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800d2e:	fc                   	cld
+  800d2f:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800d31:	eb 08                	jmp    800d3b <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d33:	89 f0                	mov    %esi,%eax
+  800d35:	48 89 d1             	mov    %rdx,%rcx
+  800d38:	fc                   	cld
+  800d39:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d3b:	48 89 f8             	mov    %rdi,%rax
+  800d3e:	c3                   	ret
+
+0000000000800d3f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d3f:	48 89 f8             	mov    %rdi,%rax
+  800d42:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d45:	48 39 fe             	cmp    %rdi,%rsi
+  800d48:	73 3a                	jae    800d84 <memmove+0x45>
+  800d4a:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d4e:	48 39 d7             	cmp    %rdx,%rdi
+  800d51:	73 31                	jae    800d84 <memmove+0x45>
+		s += n;
+		d += n;
+  800d53:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800d57:	48 89 d6             	mov    %rdx,%rsi
+  800d5a:	48 09 fe             	or     %rdi,%rsi
+  800d5d:	48 09 ce             	or     %rcx,%rsi
+  800d60:	40 f6 c6 03          	test   $0x3,%sil
+  800d64:	75 11                	jne    800d77 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d66:	48 83 ef 04          	sub    $0x4,%rdi
+  800d6a:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800d6e:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800d72:	fd                   	std
+  800d73:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800d75:	eb 0b                	jmp    800d82 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d77:	48 83 ef 01          	sub    $0x1,%rdi
+  800d7b:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800d7f:	fd                   	std
+  800d80:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d82:	fc                   	cld
+  800d83:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800d84:	48 89 f2             	mov    %rsi,%rdx
+  800d87:	48 09 c2             	or     %rax,%rdx
+  800d8a:	48 09 ca             	or     %rcx,%rdx
+  800d8d:	f6 c2 03             	test   $0x3,%dl
+  800d90:	75 0b                	jne    800d9d <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d92:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800d96:	48 89 c7             	mov    %rax,%rdi
+  800d99:	fc                   	cld
+  800d9a:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800d9c:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800d9d:	48 89 c7             	mov    %rax,%rdi
+  800da0:	fc                   	cld
+  800da1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800da3:	c3                   	ret
+
+0000000000800da4 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800da4:	55                   	push   %rbp
+  800da5:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800da8:	48 b8 3f 0d 80 00 00 	movabs $0x800d3f,%rax
+  800daf:	00 00 00 
+  800db2:	ff d0                	call   *%rax
+}
+  800db4:	5d                   	pop    %rbp
+  800db5:	c3                   	ret
+
+0000000000800db6 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800db6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbb:	48 39 c2             	cmp    %rax,%rdx
+  800dbe:	74 1e                	je     800dde <memcmp+0x28>
+		if (*s1 != *s2)
+  800dc0:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800dc4:	48 83 c0 01          	add    $0x1,%rax
+  800dc8:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800dce:	44 38 c1             	cmp    %r8b,%cl
+  800dd1:	74 e8                	je     800dbb <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800dd3:	0f b6 c1             	movzbl %cl,%eax
+  800dd6:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800dda:	44 29 c0             	sub    %r8d,%eax
+  800ddd:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800dde:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800de3:	c3                   	ret
+
+0000000000800de4 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800de4:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800de7:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800dea:	eb 04                	jmp    800df0 <memfind+0xc>
+  800dec:	48 83 c0 01          	add    $0x1,%rax
+  800df0:	48 39 d0             	cmp    %rdx,%rax
+  800df3:	73 05                	jae    800dfa <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800df5:	40 38 30             	cmp    %sil,(%rax)
+  800df8:	75 f2                	jne    800dec <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800dfa:	c3                   	ret
+
+0000000000800dfb <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800dfb:	48 89 f9             	mov    %rdi,%rcx
+  800dfe:	49 89 f0             	mov    %rsi,%r8
+  800e01:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e03:	eb 04                	jmp    800e09 <strtol+0xe>
+		s++;
+  800e05:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800e09:	0f b6 01             	movzbl (%rcx),%eax
+  800e0c:	3c 20                	cmp    $0x20,%al
+  800e0e:	74 f5                	je     800e05 <strtol+0xa>
+  800e10:	3c 09                	cmp    $0x9,%al
+  800e12:	74 f1                	je     800e05 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e14:	3c 2b                	cmp    $0x2b,%al
+  800e16:	74 2b                	je     800e43 <strtol+0x48>
+	int neg = 0;
+  800e18:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800e1e:	3c 2d                	cmp    $0x2d,%al
+  800e20:	74 2d                	je     800e4f <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e22:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800e28:	75 0f                	jne    800e39 <strtol+0x3e>
+  800e2a:	80 39 30             	cmpb   $0x30,(%rcx)
+  800e2d:	74 2c                	je     800e5b <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e2f:	85 ff                	test   %edi,%edi
+  800e31:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e36:	0f 44 f8             	cmove  %eax,%edi
+  800e39:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800e3e:	4c 63 d7             	movslq %edi,%r10
+  800e41:	eb 4f                	jmp    800e92 <strtol+0x97>
+		s++;
+  800e43:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800e47:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800e4d:	eb d3                	jmp    800e22 <strtol+0x27>
+		s++, neg = 1;
+  800e4f:	48 83 c1 01          	add    $0x1,%rcx
+  800e53:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800e59:	eb c7                	jmp    800e22 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e5b:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800e5f:	74 0f                	je     800e70 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800e61:	85 ff                	test   %edi,%edi
+  800e63:	75 d4                	jne    800e39 <strtol+0x3e>
+		s++, base = 8;
+  800e65:	48 83 c1 01          	add    $0x1,%rcx
+  800e69:	bf 08 00 00 00       	mov    $0x8,%edi
+  800e6e:	eb c9                	jmp    800e39 <strtol+0x3e>
+		s += 2, base = 16;
+  800e70:	48 83 c1 02          	add    $0x2,%rcx
+  800e74:	bf 10 00 00 00       	mov    $0x10,%edi
+  800e79:	eb be                	jmp    800e39 <strtol+0x3e>
+			dig = *s - '0';
+  800e7b:	0f be c0             	movsbl %al,%eax
+  800e7e:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800e81:	39 f8                	cmp    %edi,%eax
+  800e83:	7d 3b                	jge    800ec0 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800e85:	48 83 c1 01          	add    $0x1,%rcx
+  800e89:	49 0f af d2          	imul   %r10,%rdx
+  800e8d:	48 98                	cltq
+  800e8f:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800e92:	0f b6 01             	movzbl (%rcx),%eax
+  800e95:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800e98:	40 80 fe 09          	cmp    $0x9,%sil
+  800e9c:	76 dd                	jbe    800e7b <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800e9e:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800ea1:	40 80 fe 19          	cmp    $0x19,%sil
+  800ea5:	77 08                	ja     800eaf <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800ea7:	0f be c0             	movsbl %al,%eax
+  800eaa:	83 e8 57             	sub    $0x57,%eax
+  800ead:	eb d2                	jmp    800e81 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800eaf:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800eb2:	40 80 fe 19          	cmp    $0x19,%sil
+  800eb6:	77 08                	ja     800ec0 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800eb8:	0f be c0             	movsbl %al,%eax
+  800ebb:	83 e8 37             	sub    $0x37,%eax
+  800ebe:	eb c1                	jmp    800e81 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ec0:	4d 85 c0             	test   %r8,%r8
+  800ec3:	74 03                	je     800ec8 <strtol+0xcd>
+		*endptr = (char *) s;
+  800ec5:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800ec8:	48 89 d0             	mov    %rdx,%rax
+  800ecb:	48 f7 d8             	neg    %rax
+  800ece:	45 85 c9             	test   %r9d,%r9d
+  800ed1:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800ed5:	48 89 d0             	mov    %rdx,%rax
+  800ed8:	c3                   	ret
+
+0000000000800ed9 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800ed9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800edf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800ee5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eea:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eef:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800ef1:	c3                   	ret
+
+0000000000800ef2 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800ef2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800ef8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800efe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f03:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f08:	48 89 fe             	mov    %rdi,%rsi
+  800f0b:	48 89 fa             	mov    %rdi,%rdx
+  800f0e:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f10:	c3                   	ret
+
+0000000000800f11 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800f11:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800f14:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f1a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f20:	be 00 00 00 00       	mov    $0x0,%esi
+  800f25:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f2a:	48 89 f2             	mov    %rsi,%rdx
+  800f2d:	0f 05                	syscall
+	if(check && ret > 0)
+  800f2f:	48 85 c0             	test   %rax,%rax
+  800f32:	7f 01                	jg     800f35 <sys_env_destroy+0x24>
+}
+  800f34:	c3                   	ret
+{
+  800f35:	55                   	push   %rbp
+  800f36:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f39:	49 89 c0             	mov    %rax,%r8
+  800f3c:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800f41:	48 ba 28 19 80 00 00 	movabs $0x801928,%rdx
+  800f48:	00 00 00 
+  800f4b:	be 28 00 00 00       	mov    $0x28,%esi
+  800f50:	48 bf 45 19 80 00 00 	movabs $0x801945,%rdi
+  800f57:	00 00 00 
+  800f5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f5f:	49 b9 95 01 80 00 00 	movabs $0x800195,%r9
+  800f66:	00 00 00 
+  800f69:	41 ff d1             	call   *%r9
+
+0000000000800f6c <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800f6c:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800f73:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800f74:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800f79:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800f7d:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800f81:	48 c1 e2 04          	shl    $0x4,%rdx
+  800f85:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800f8c:	00 00 00 
+  800f8f:	48 01 d0             	add    %rdx,%rax
+  800f92:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800f98:	c3                   	ret
+
+0000000000800f99 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800f99:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f9f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fa5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800faa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800faf:	48 89 fe             	mov    %rdi,%rsi
+  800fb2:	48 89 fa             	mov    %rdi,%rdx
+  800fb5:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800fb7:	c3                   	ret
+
+0000000000800fb8 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  800fb8:	48 63 d2             	movslq %edx,%rdx
+  800fbb:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800fbe:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fc4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fca:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fcf:	0f 05                	syscall
+	if(check && ret > 0)
+  800fd1:	48 85 c0             	test   %rax,%rax
+  800fd4:	7f 01                	jg     800fd7 <sys_page_alloc+0x1f>
+}
+  800fd6:	c3                   	ret
+{
+  800fd7:	55                   	push   %rbp
+  800fd8:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fdb:	49 89 c0             	mov    %rax,%r8
+  800fde:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800fe3:	48 ba 28 19 80 00 00 	movabs $0x801928,%rdx
+  800fea:	00 00 00 
+  800fed:	be 28 00 00 00       	mov    $0x28,%esi
+  800ff2:	48 bf 45 19 80 00 00 	movabs $0x801945,%rdi
+  800ff9:	00 00 00 
+  800ffc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801001:	49 b9 95 01 80 00 00 	movabs $0x800195,%r9
+  801008:	00 00 00 
+  80100b:	41 ff d1             	call   *%r9
+
+000000000080100e <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  80100e:	48 63 d2             	movslq %edx,%rdx
+  801011:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801014:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80101a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801020:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801025:	0f 05                	syscall
+	if(check && ret > 0)
+  801027:	48 85 c0             	test   %rax,%rax
+  80102a:	7f 01                	jg     80102d <sys_page_alloc_huge+0x1f>
+}
+  80102c:	c3                   	ret
+{
+  80102d:	55                   	push   %rbp
+  80102e:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801031:	49 89 c0             	mov    %rax,%r8
+  801034:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801039:	48 ba 28 19 80 00 00 	movabs $0x801928,%rdx
+  801040:	00 00 00 
+  801043:	be 28 00 00 00       	mov    $0x28,%esi
+  801048:	48 bf 45 19 80 00 00 	movabs $0x801945,%rdi
+  80104f:	00 00 00 
+  801052:	b8 00 00 00 00       	mov    $0x0,%eax
+  801057:	49 b9 95 01 80 00 00 	movabs $0x800195,%r9
+  80105e:	00 00 00 
+  801061:	41 ff d1             	call   *%r9
+
+0000000000801064 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801064:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  801067:	48 63 d2             	movslq %edx,%rdx
+  80106a:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  80106d:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  801070:	b8 05 00 00 00       	mov    $0x5,%eax
+  801075:	0f 05                	syscall
+	if(check && ret > 0)
+  801077:	48 85 c0             	test   %rax,%rax
+  80107a:	7f 01                	jg     80107d <sys_page_map+0x19>
+}
+  80107c:	c3                   	ret
+{
+  80107d:	55                   	push   %rbp
+  80107e:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801081:	49 89 c0             	mov    %rax,%r8
+  801084:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801089:	48 ba 28 19 80 00 00 	movabs $0x801928,%rdx
+  801090:	00 00 00 
+  801093:	be 28 00 00 00       	mov    $0x28,%esi
+  801098:	48 bf 45 19 80 00 00 	movabs $0x801945,%rdi
+  80109f:	00 00 00 
+  8010a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a7:	49 b9 95 01 80 00 00 	movabs $0x800195,%r9
+  8010ae:	00 00 00 
+  8010b1:	41 ff d1             	call   *%r9
+
+00000000008010b4 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8010b4:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8010b7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010cd:	0f 05                	syscall
+	if(check && ret > 0)
+  8010cf:	48 85 c0             	test   %rax,%rax
+  8010d2:	7f 01                	jg     8010d5 <sys_page_unmap+0x21>
+}
+  8010d4:	c3                   	ret
+{
+  8010d5:	55                   	push   %rbp
+  8010d6:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d9:	49 89 c0             	mov    %rax,%r8
+  8010dc:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8010e1:	48 ba 28 19 80 00 00 	movabs $0x801928,%rdx
+  8010e8:	00 00 00 
+  8010eb:	be 28 00 00 00       	mov    $0x28,%esi
+  8010f0:	48 bf 45 19 80 00 00 	movabs $0x801945,%rdi
+  8010f7:	00 00 00 
+  8010fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ff:	49 b9 95 01 80 00 00 	movabs $0x800195,%r9
+  801106:	00 00 00 
+  801109:	41 ff d1             	call   *%r9
+
+000000000080110c <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  80110c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801112:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801118:	bf 00 00 00 00       	mov    $0x0,%edi
+  80111d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801122:	48 89 fe             	mov    %rdi,%rsi
+  801125:	48 89 fa             	mov    %rdi,%rdx
+  801128:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80112a:	c3                   	ret
+
+000000000080112b <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  80112b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801131:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801137:	ba 00 00 00 00       	mov    $0x0,%edx
+  80113c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801141:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  801143:	c3                   	ret
+
+0000000000801144 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  801144:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80114a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801150:	b8 11 00 00 00       	mov    $0x11,%eax
+  801155:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  801157:	c3                   	ret
+
+0000000000801158 <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  801158:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  80115b:	48 63 f6             	movslq %esi,%rsi
+  80115e:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  801161:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801167:	b8 12 00 00 00       	mov    $0x12,%eax
+  80116c:	0f 05                	syscall
+	if(check && ret > 0)
+  80116e:	48 85 c0             	test   %rax,%rax
+  801171:	7f 01                	jg     801174 <sys_page_batch+0x1c>
+}
+  801173:	c3                   	ret
+{
+  801174:	55                   	push   %rbp
+  801175:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801178:	49 89 c0             	mov    %rax,%r8
+  80117b:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801180:	48 ba 28 19 80 00 00 	movabs $0x801928,%rdx
+  801187:	00 00 00 
+  80118a:	be 28 00 00 00       	mov    $0x28,%esi
+  80118f:	48 bf 45 19 80 00 00 	movabs $0x801945,%rdi
+  801196:	00 00 00 
+  801199:	b8 00 00 00 00       	mov    $0x0,%eax
+  80119e:	49 b9 95 01 80 00 00 	movabs $0x800195,%r9
+  8011a5:	00 00 00 
+  8011a8:	41 ff d1             	call   *%r9
+
+00000000008011ab <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  8011ab:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011bc:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011c1:	48 89 f2             	mov    %rsi,%rdx
+  8011c4:	0f 05                	syscall
+	if(check && ret > 0)
+  8011c6:	48 85 c0             	test   %rax,%rax
+  8011c9:	7f 01                	jg     8011cc <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  8011cb:	c3                   	ret
+{
+  8011cc:	55                   	push   %rbp
+  8011cd:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011d0:	49 89 c0             	mov    %rax,%r8
+  8011d3:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8011d8:	48 ba 28 19 80 00 00 	movabs $0x801928,%rdx
+  8011df:	00 00 00 
+  8011e2:	be 28 00 00 00       	mov    $0x28,%esi
+  8011e7:	48 bf 45 19 80 00 00 	movabs $0x801945,%rdi
+  8011ee:	00 00 00 
+  8011f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f6:	49 b9 95 01 80 00 00 	movabs $0x800195,%r9
+  8011fd:	00 00 00 
+  801200:	41 ff d1             	call   *%r9
+
+0000000000801203 <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  801203:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801209:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80120f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801214:	b8 14 00 00 00       	mov    $0x14,%eax
+  801219:	48 89 fe             	mov    %rdi,%rsi
+  80121c:	48 89 fa             	mov    %rdi,%rdx
+  80121f:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801221:	c3                   	ret
+
+0000000000801222 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  801222:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801225:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80122b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801231:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801236:	0f 05                	syscall
+	if(check && ret > 0)
+  801238:	48 85 c0             	test   %rax,%rax
+  80123b:	7f 01                	jg     80123e <sys_page_unmap_range+0x1c>
+}
+  80123d:	c3                   	ret
+{
+  80123e:	55                   	push   %rbp
+  80123f:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801242:	49 89 c0             	mov    %rax,%r8
+  801245:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80124a:	48 ba 28 19 80 00 00 	movabs $0x801928,%rdx
+  801251:	00 00 00 
+  801254:	be 28 00 00 00       	mov    $0x28,%esi
+  801259:	48 bf 45 19 80 00 00 	movabs $0x801945,%rdi
+  801260:	00 00 00 
+  801263:	b8 00 00 00 00       	mov    $0x0,%eax
+  801268:	49 b9 95 01 80 00 00 	movabs $0x800195,%r9
+  80126f:	00 00 00 
+  801272:	41 ff d1             	call   *%r9
+
+0000000000801275 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801275:	48 63 f6             	movslq %esi,%rsi
+  801278:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80127b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801281:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801287:	ba 00 00 00 00       	mov    $0x0,%edx
+  80128c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801291:	0f 05                	syscall
+	if(check && ret > 0)
+  801293:	48 85 c0             	test   %rax,%rax
+  801296:	7f 01                	jg     801299 <sys_env_set_status+0x24>
+}
+  801298:	c3                   	ret
+{
+  801299:	55                   	push   %rbp
+  80129a:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80129d:	49 89 c0             	mov    %rax,%r8
+  8012a0:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8012a5:	48 ba 28 19 80 00 00 	movabs $0x801928,%rdx
+  8012ac:	00 00 00 
+  8012af:	be 28 00 00 00       	mov    $0x28,%esi
+  8012b4:	48 bf 45 19 80 00 00 	movabs $0x801945,%rdi
+  8012bb:	00 00 00 
+  8012be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c3:	49 b9 95 01 80 00 00 	movabs $0x800195,%r9
+  8012ca:	00 00 00 
+  8012cd:	41 ff d1             	call   *%r9
+
+00000000008012d0 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8012d0:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8012d3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8012d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8012df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e4:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012e9:	0f 05                	syscall
+	if(check && ret > 0)
+  8012eb:	48 85 c0             	test   %rax,%rax
+  8012ee:	7f 01                	jg     8012f1 <sys_env_set_pgfault_upcall+0x21>
+}
+  8012f0:	c3                   	ret
+{
+  8012f1:	55                   	push   %rbp
+  8012f2:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012f5:	49 89 c0             	mov    %rax,%r8
+  8012f8:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8012fd:	48 ba 28 19 80 00 00 	movabs $0x801928,%rdx
+  801304:	00 00 00 
+  801307:	be 28 00 00 00       	mov    $0x28,%esi
+  80130c:	48 bf 45 19 80 00 00 	movabs $0x801945,%rdi
+  801313:	00 00 00 
+  801316:	b8 00 00 00 00       	mov    $0x0,%eax
+  80131b:	49 b9 95 01 80 00 00 	movabs $0x800195,%r9
+  801322:	00 00 00 
+  801325:	41 ff d1             	call   *%r9
+
+0000000000801328 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  801328:	48 63 ff             	movslq %edi,%rdi
+  80132b:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  80132e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801334:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801339:	0f 05                	syscall
+}
+  80133b:	c3                   	ret
+
+000000000080133c <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  80133c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801342:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801348:	be 00 00 00 00       	mov    $0x0,%esi
+  80134d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801352:	48 89 f2             	mov    %rsi,%rdx
+  801355:	0f 05                	syscall
+	if(check && ret > 0)
+  801357:	48 85 c0             	test   %rax,%rax
+  80135a:	7f 01                	jg     80135d <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  80135c:	c3                   	ret
+{
+  80135d:	55                   	push   %rbp
+  80135e:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801361:	49 89 c0             	mov    %rax,%r8
+  801364:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801369:	48 ba 28 19 80 00 00 	movabs $0x801928,%rdx
+  801370:	00 00 00 
+  801373:	be 28 00 00 00       	mov    $0x28,%esi
+  801378:	48 bf 45 19 80 00 00 	movabs $0x801945,%rdi
+  80137f:	00 00 00 
+  801382:	b8 00 00 00 00       	mov    $0x0,%eax
+  801387:	49 b9 95 01 80 00 00 	movabs $0x800195,%r9
+  80138e:	00 00 00 
+  801391:	41 ff d1             	call   *%r9
+
+0000000000801394 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801394:	55                   	push   %rbp
+  801395:	48 89 e5             	mov    %rsp,%rbp
+  801398:	53                   	push   %rbx
+  801399:	48 83 ec 08          	sub    $0x8,%rsp
+  80139d:	48 89 fb             	mov    %rdi,%rbx
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8013a0:	48 ba 08 20 80 00 00 	movabs $0x802008,%rdx
+  8013a7:	00 00 00 
+  8013aa:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8013ae:	74 13                	je     8013c3 <set_pgfault_handler+0x2f>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8013b0:	48 89 d8             	mov    %rbx,%rax
+  8013b3:	48 a3 08 20 80 00 00 	movabs %rax,0x802008
+  8013ba:	00 00 00 
+}
+  8013bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c1:	c9                   	leave
+  8013c2:	c3                   	ret
+		r = sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  8013c3:	ba 07 00 00 00       	mov    $0x7,%edx
+  8013c8:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  8013cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013d2:	48 b8 b8 0f 80 00 00 	movabs $0x800fb8,%rax
+  8013d9:	00 00 00 
+  8013dc:	ff d0                	call   *%rax
+		if (r < 0) {
+  8013de:	85 c0                	test   %eax,%eax
+  8013e0:	78 4c                	js     80142e <set_pgfault_handler+0x9a>
+		r = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8013e2:	48 be 5b 14 80 00 00 	movabs $0x80145b,%rsi
+  8013e9:	00 00 00 
+  8013ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013f1:	48 b8 d0 12 80 00 00 	movabs $0x8012d0,%rax
+  8013f8:	00 00 00 
+  8013fb:	ff d0                	call   *%rax
+		if (r < 0) {
+  8013fd:	85 c0                	test   %eax,%eax
+  8013ff:	79 af                	jns    8013b0 <set_pgfault_handler+0x1c>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+  801401:	89 c1                	mov    %eax,%ecx
+  801403:	48 ba 80 19 80 00 00 	movabs $0x801980,%rdx
+  80140a:	00 00 00 
+  80140d:	be 2c 00 00 00       	mov    $0x2c,%esi
+  801412:	48 bf 6e 19 80 00 00 	movabs $0x80196e,%rdi
+  801419:	00 00 00 
+  80141c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801421:	49 b8 95 01 80 00 00 	movabs $0x800195,%r8
+  801428:	00 00 00 
+  80142b:	41 ff d0             	call   *%r8
+			panic("sys_page_alloc failed:  %e", r);
+  80142e:	89 c1                	mov    %eax,%ecx
+  801430:	48 ba 53 19 80 00 00 	movabs $0x801953,%rdx
+  801437:	00 00 00 
+  80143a:	be 28 00 00 00       	mov    $0x28,%esi
+  80143f:	48 bf 6e 19 80 00 00 	movabs $0x80196e,%rdi
+  801446:	00 00 00 
+  801449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144e:	49 b8 95 01 80 00 00 	movabs $0x800195,%r8
+  801455:	00 00 00 
+  801458:	41 ff d0             	call   *%r8
+
+000000000080145b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi		// function argument: pointer to UTF
+  80145b:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  80145e:	48 a1 08 20 80 00 00 	movabs 0x802008,%rax
+  801465:	00 00 00 
+	call *%rax
+  801468:	ff d0                	call   *%rax
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here. (Hint. You need to modify the trap time rsp to make room for the return rip ) */
+
+	movq  152(%rsp), %rax
+  80146a:	48 8b 84 24 98 00 00 	mov    0x98(%rsp),%rax
+  801471:	00 
+	subq $8, %rax
+  801472:	48 83 e8 08          	sub    $0x8,%rax
+	movq %rax, 152(%rsp)
+  801476:	48 89 84 24 98 00 00 	mov    %rax,0x98(%rsp)
+  80147d:	00 
+
+	movq 136(%rsp), %rbx
+  80147e:	48 8b 9c 24 88 00 00 	mov    0x88(%rsp),%rbx
+  801485:	00 
+	movq %rbx, (%rax)
+  801486:	48 89 18             	mov    %rbx,(%rax)
+
+	/* Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here. (Hint, the oposite of _alltraps) */
+
+	addq $16, %rsp
+  801489:	48 83 c4 10          	add    $0x10,%rsp
+	
+	popq %r15
+  80148d:	41 5f                	pop    %r15
+	popq %r14
+  80148f:	41 5e                	pop    %r14
+	popq %r13
+  801491:	41 5d                	pop    %r13
+	popq %r12
+  801493:	41 5c                	pop    %r12
+	popq %r11
+  801495:	41 5b                	pop    %r11
+	popq %r10
+  801497:	41 5a                	pop    %r10
+	popq %r9
+  801499:	41 59                	pop    %r9
+	popq %r8
+  80149b:	41 58                	pop    %r8
+	popq %rsi
+  80149d:	5e                   	pop    %rsi
+	popq %rdi
+  80149e:	5f                   	pop    %rdi
+	popq %rbp
+  80149f:	5d                   	pop    %rbp
+	popq %rdx
+  8014a0:	5a                   	pop    %rdx
+	popq %rcx
+  8014a1:	59                   	pop    %rcx
+	popq %rbx
+  8014a2:	5b                   	pop    %rbx
+	popq %rax
+  8014a3:	58                   	pop    %rax
+
+	addq $8, %rsp
+  8014a4:	48 83 c4 08          	add    $0x8,%rsp
+	/* Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 4: Your code here. */
+
+	popfq
+  8014a8:	9d                   	popf
+
+	/* Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here. */
+
+	popq %rsp
+  8014a9:	5c                   	pop    %rsp
+
+	/* Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here. */
+  8014aa:	c3                   	ret
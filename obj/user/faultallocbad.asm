@@ -0,0 +1,2482 @@
+
+obj/user/faultallocbad:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 e0 00 00 00       	call   800111 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	53                   	push   %rbx
+  800038:	48 83 ec 08          	sub    $0x8,%rsp
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  80003c:	48 8b 1f             	mov    (%rdi),%rbx
+
+	cprintf("fault %x\n", addr);
+  80003f:	48 89 de             	mov    %rbx,%rsi
+  800042:	48 bf 80 14 80 00 00 	movabs $0x801480,%rdi
+  800049:	00 00 00 
+  80004c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800051:	48 ba f6 02 80 00 00 	movabs $0x8002f6,%rdx
+  800058:	00 00 00 
+  80005b:	ff d2                	call   *%rdx
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80005d:	48 89 de             	mov    %rbx,%rsi
+  800060:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  800067:	ba 07 00 00 00       	mov    $0x7,%edx
+  80006c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800071:	48 b8 7a 0f 80 00 00 	movabs $0x800f7a,%rax
+  800078:	00 00 00 
+  80007b:	ff d0                	call   *%rax
+  80007d:	85 c0                	test   %eax,%eax
+  80007f:	78 2d                	js     8000ae <handler+0x7b>
+				PTE_P|PTE_U|PTE_W)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800081:	48 89 d9             	mov    %rbx,%rcx
+  800084:	48 ba d0 14 80 00 00 	movabs $0x8014d0,%rdx
+  80008b:	00 00 00 
+  80008e:	be 64 00 00 00       	mov    $0x64,%esi
+  800093:	48 89 df             	mov    %rbx,%rdi
+  800096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009b:	49 b8 f9 0a 80 00 00 	movabs $0x800af9,%r8
+  8000a2:	00 00 00 
+  8000a5:	41 ff d0             	call   *%r8
+}
+  8000a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000ac:	c9                   	leave
+  8000ad:	c3                   	ret
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  8000ae:	41 89 c0             	mov    %eax,%r8d
+  8000b1:	48 89 d9             	mov    %rbx,%rcx
+  8000b4:	48 ba a0 14 80 00 00 	movabs $0x8014a0,%rdx
+  8000bb:	00 00 00 
+  8000be:	be 0f 00 00 00       	mov    $0xf,%esi
+  8000c3:	48 bf 8a 14 80 00 00 	movabs $0x80148a,%rdi
+  8000ca:	00 00 00 
+  8000cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d2:	49 b9 57 01 80 00 00 	movabs $0x800157,%r9
+  8000d9:	00 00 00 
+  8000dc:	41 ff d1             	call   *%r9
+
+00000000008000df <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000df:	55                   	push   %rbp
+  8000e0:	48 89 e5             	mov    %rsp,%rbp
+	set_pgfault_handler(handler);
+  8000e3:	48 bf 33 00 80 00 00 	movabs $0x800033,%rdi
+  8000ea:	00 00 00 
+  8000ed:	48 b8 56 13 80 00 00 	movabs $0x801356,%rax
+  8000f4:	00 00 00 
+  8000f7:	ff d0                	call   *%rax
+	sys_cputs((char*)0x6EADBEEF, 4);
+  8000f9:	be 04 00 00 00       	mov    $0x4,%esi
+  8000fe:	bf ef be ad 6e       	mov    $0x6eadbeef,%edi
+  800103:	48 b8 9b 0e 80 00 00 	movabs $0x800e9b,%rax
+  80010a:	00 00 00 
+  80010d:	ff d0                	call   *%rax
+}
+  80010f:	5d                   	pop    %rbp
+  800110:	c3                   	ret
+
+0000000000800111 <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  800111:	55                   	push   %rbp
+  800112:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800115:	85 ff                	test   %edi,%edi
+  800117:	7e 0d                	jle    800126 <libmain+0x15>
+		binaryname = argv[0];
+  800119:	48 8b 06             	mov    (%rsi),%rax
+  80011c:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  800123:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  800126:	48 b8 df 00 80 00 00 	movabs $0x8000df,%rax
+  80012d:	00 00 00 
+  800130:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800132:	48 b8 40 01 80 00 00 	movabs $0x800140,%rax
+  800139:	00 00 00 
+  80013c:	ff d0                	call   *%rax
+}
+  80013e:	5d                   	pop    %rbp
+  80013f:	c3                   	ret
+
+0000000000800140 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800140:	55                   	push   %rbp
+  800141:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  800144:	bf 00 00 00 00       	mov    $0x0,%edi
+  800149:	48 b8 d3 0e 80 00 00 	movabs $0x800ed3,%rax
+  800150:	00 00 00 
+  800153:	ff d0                	call   *%rax
+}
+  800155:	5d                   	pop    %rbp
+  800156:	c3                   	ret
+
+0000000000800157 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800157:	55                   	push   %rbp
+  800158:	48 89 e5             	mov    %rsp,%rbp
+  80015b:	41 56                	push   %r14
+  80015d:	41 55                	push   %r13
+  80015f:	41 54                	push   %r12
+  800161:	53                   	push   %rbx
+  800162:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800169:	49 89 fc             	mov    %rdi,%r12
+  80016c:	41 89 f5             	mov    %esi,%r13d
+  80016f:	48 89 d3             	mov    %rdx,%rbx
+  800172:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800179:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800180:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800187:	84 c0                	test   %al,%al
+  800189:	74 26                	je     8001b1 <_panic+0x5a>
+  80018b:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800192:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800199:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  80019d:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8001a1:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8001a5:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8001a9:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8001ad:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001b1:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8001b8:	00 00 00 
+  8001bb:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8001c2:	00 00 00 
+  8001c5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001c9:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8001d0:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8001d7:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001de:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  8001e5:	00 00 00 
+  8001e8:	4c 8b 30             	mov    (%rax),%r14
+  8001eb:	48 b8 2e 0f 80 00 00 	movabs $0x800f2e,%rax
+  8001f2:	00 00 00 
+  8001f5:	ff d0                	call   *%rax
+  8001f7:	89 c6                	mov    %eax,%esi
+  8001f9:	45 89 e8             	mov    %r13d,%r8d
+  8001fc:	4c 89 e1             	mov    %r12,%rcx
+  8001ff:	4c 89 f2             	mov    %r14,%rdx
+  800202:	48 bf 00 15 80 00 00 	movabs $0x801500,%rdi
+  800209:	00 00 00 
+  80020c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800211:	49 bc f6 02 80 00 00 	movabs $0x8002f6,%r12
+  800218:	00 00 00 
+  80021b:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80021e:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  800225:	48 89 df             	mov    %rbx,%rdi
+  800228:	48 b8 92 02 80 00 00 	movabs $0x800292,%rax
+  80022f:	00 00 00 
+  800232:	ff d0                	call   *%rax
+	cprintf("\n");
+  800234:	48 bf 88 14 80 00 00 	movabs $0x801488,%rdi
+  80023b:	00 00 00 
+  80023e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800243:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800246:	cc                   	int3
+	while (1)
+  800247:	eb fd                	jmp    800246 <_panic+0xef>
+
+0000000000800249 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800249:	55                   	push   %rbp
+  80024a:	48 89 e5             	mov    %rsp,%rbp
+  80024d:	53                   	push   %rbx
+  80024e:	48 83 ec 08          	sub    $0x8,%rsp
+  800252:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  800255:	8b 06                	mov    (%rsi),%eax
+  800257:	8d 50 01             	lea    0x1(%rax),%edx
+  80025a:	89 16                	mov    %edx,(%rsi)
+  80025c:	48 98                	cltq
+  80025e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  800263:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800269:	74 0a                	je     800275 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80026b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80026f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800273:	c9                   	leave
+  800274:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800275:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800279:	be ff 00 00 00       	mov    $0xff,%esi
+  80027e:	48 b8 9b 0e 80 00 00 	movabs $0x800e9b,%rax
+  800285:	00 00 00 
+  800288:	ff d0                	call   *%rax
+		b->idx = 0;
+  80028a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800290:	eb d9                	jmp    80026b <putch+0x22>
+
+0000000000800292 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800292:	55                   	push   %rbp
+  800293:	48 89 e5             	mov    %rsp,%rbp
+  800296:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80029d:	48 89 fa             	mov    %rdi,%rdx
+  8002a0:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  8002a3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8002aa:	00 00 00 
+	b.cnt = 0;
+  8002ad:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8002b4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002b7:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  8002be:	48 bf 49 02 80 00 00 	movabs $0x800249,%rdi
+  8002c5:	00 00 00 
+  8002c8:	48 b8 b0 04 80 00 00 	movabs $0x8004b0,%rax
+  8002cf:	00 00 00 
+  8002d2:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8002d4:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  8002db:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002e2:	48 b8 9b 0e 80 00 00 	movabs $0x800e9b,%rax
+  8002e9:	00 00 00 
+  8002ec:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  8002ee:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  8002f4:	c9                   	leave
+  8002f5:	c3                   	ret
+
+00000000008002f6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002f6:	55                   	push   %rbp
+  8002f7:	48 89 e5             	mov    %rsp,%rbp
+  8002fa:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800301:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800308:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80030f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800316:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80031d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800324:	84 c0                	test   %al,%al
+  800326:	74 20                	je     800348 <cprintf+0x52>
+  800328:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80032c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800330:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800334:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800338:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80033c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800340:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800344:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800348:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  80034f:	00 00 00 
+  800352:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800359:	00 00 00 
+  80035c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800360:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800367:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80036e:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  800375:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  80037c:	48 b8 92 02 80 00 00 	movabs $0x800292,%rax
+  800383:	00 00 00 
+  800386:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  800388:	c9                   	leave
+  800389:	c3                   	ret
+
+000000000080038a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80038a:	55                   	push   %rbp
+  80038b:	48 89 e5             	mov    %rsp,%rbp
+  80038e:	41 57                	push   %r15
+  800390:	41 56                	push   %r14
+  800392:	41 55                	push   %r13
+  800394:	41 54                	push   %r12
+  800396:	53                   	push   %rbx
+  800397:	48 83 ec 18          	sub    $0x18,%rsp
+  80039b:	49 89 fc             	mov    %rdi,%r12
+  80039e:	49 89 f5             	mov    %rsi,%r13
+  8003a1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003a5:	44 89 c3             	mov    %r8d,%ebx
+  8003a8:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003ab:	41 89 cf             	mov    %ecx,%r15d
+  8003ae:	4c 39 fa             	cmp    %r15,%rdx
+  8003b1:	72 29                	jb     8003dc <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003b3:	48 89 d0             	mov    %rdx,%rax
+  8003b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003bb:	49 f7 f7             	div    %r15
+  8003be:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003c2:	48 89 c2             	mov    %rax,%rdx
+  8003c5:	48 b8 8a 03 80 00 00 	movabs $0x80038a,%rax
+  8003cc:	00 00 00 
+  8003cf:	ff d0                	call   *%rax
+  8003d1:	eb 10                	jmp    8003e3 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003d3:	4c 89 ee             	mov    %r13,%rsi
+  8003d6:	44 89 f7             	mov    %r14d,%edi
+  8003d9:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  8003dc:	83 eb 01             	sub    $0x1,%ebx
+  8003df:	85 db                	test   %ebx,%ebx
+  8003e1:	7f f0                	jg     8003d3 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003ec:	49 f7 f7             	div    %r15
+  8003ef:	48 b8 23 15 80 00 00 	movabs $0x801523,%rax
+  8003f6:	00 00 00 
+  8003f9:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  8003fd:	4c 89 ee             	mov    %r13,%rsi
+  800400:	41 ff d4             	call   *%r12
+}
+  800403:	48 83 c4 18          	add    $0x18,%rsp
+  800407:	5b                   	pop    %rbx
+  800408:	41 5c                	pop    %r12
+  80040a:	41 5d                	pop    %r13
+  80040c:	41 5e                	pop    %r14
+  80040e:	41 5f                	pop    %r15
+  800410:	5d                   	pop    %rbp
+  800411:	c3                   	ret
+
+0000000000800412 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  800412:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  800416:	48 8b 06             	mov    (%rsi),%rax
+  800419:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80041d:	73 0a                	jae    800429 <sprintputch+0x17>
+		*b->buf++ = ch;
+  80041f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800423:	48 89 16             	mov    %rdx,(%rsi)
+  800426:	40 88 38             	mov    %dil,(%rax)
+}
+  800429:	c3                   	ret
+
+000000000080042a <printfmt>:
+{
+  80042a:	55                   	push   %rbp
+  80042b:	48 89 e5             	mov    %rsp,%rbp
+  80042e:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800435:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80043c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800443:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80044a:	84 c0                	test   %al,%al
+  80044c:	74 20                	je     80046e <printfmt+0x44>
+  80044e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800452:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800456:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80045a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80045e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800462:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800466:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80046a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  80046e:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800475:	00 00 00 
+  800478:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80047f:	00 00 00 
+  800482:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800486:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80048d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800494:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80049b:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8004a2:	48 b8 b0 04 80 00 00 	movabs $0x8004b0,%rax
+  8004a9:	00 00 00 
+  8004ac:	ff d0                	call   *%rax
+}
+  8004ae:	c9                   	leave
+  8004af:	c3                   	ret
+
+00000000008004b0 <vprintfmt>:
+{
+  8004b0:	55                   	push   %rbp
+  8004b1:	48 89 e5             	mov    %rsp,%rbp
+  8004b4:	41 57                	push   %r15
+  8004b6:	41 56                	push   %r14
+  8004b8:	41 55                	push   %r13
+  8004ba:	41 54                	push   %r12
+  8004bc:	53                   	push   %rbx
+  8004bd:	48 83 ec 48          	sub    $0x48,%rsp
+  8004c1:	49 89 fe             	mov    %rdi,%r14
+  8004c4:	49 89 f5             	mov    %rsi,%r13
+  8004c7:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  8004ca:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  8004ce:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  8004d2:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004d6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8004da:	eb 09                	jmp    8004e5 <vprintfmt+0x35>
+			putch(ch, putdat);
+  8004dc:	4c 89 ee             	mov    %r13,%rsi
+  8004df:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8004e2:	4c 89 e3             	mov    %r12,%rbx
+  8004e5:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004e9:	0f b6 3b             	movzbl (%rbx),%edi
+  8004ec:	83 ff 25             	cmp    $0x25,%edi
+  8004ef:	74 13                	je     800504 <vprintfmt+0x54>
+			if (ch == '\0')
+  8004f1:	85 ff                	test   %edi,%edi
+  8004f3:	75 e7                	jne    8004dc <vprintfmt+0x2c>
+}
+  8004f5:	48 83 c4 48          	add    $0x48,%rsp
+  8004f9:	5b                   	pop    %rbx
+  8004fa:	41 5c                	pop    %r12
+  8004fc:	41 5d                	pop    %r13
+  8004fe:	41 5e                	pop    %r14
+  800500:	41 5f                	pop    %r15
+  800502:	5d                   	pop    %rbp
+  800503:	c3                   	ret
+		padc = ' ';
+  800504:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  800508:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  80050f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  800515:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  80051c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800521:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800526:	41 0f b6 14 24       	movzbl (%r12),%edx
+  80052b:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  80052e:	3c 55                	cmp    $0x55,%al
+  800530:	0f 87 4f 05 00 00    	ja     800a85 <vprintfmt+0x5d5>
+  800536:	0f b6 c0             	movzbl %al,%eax
+  800539:	48 be e0 15 80 00 00 	movabs $0x8015e0,%rsi
+  800540:	00 00 00 
+  800543:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  800546:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  800549:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  80054d:	eb d2                	jmp    800521 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  80054f:	49 89 dc             	mov    %rbx,%r12
+  800552:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  800556:	eb c9                	jmp    800521 <vprintfmt+0x71>
+  800558:	0f b6 d2             	movzbl %dl,%edx
+  80055b:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  80055e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  800564:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800568:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  80056d:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  800572:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  800575:	83 f8 09             	cmp    $0x9,%eax
+  800578:	77 20                	ja     80059a <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  80057a:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  80057e:	eb e4                	jmp    800564 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  800580:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800583:	83 f8 2f             	cmp    $0x2f,%eax
+  800586:	77 27                	ja     8005af <vprintfmt+0xff>
+  800588:	89 c2                	mov    %eax,%edx
+  80058a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80058e:	83 c0 08             	add    $0x8,%eax
+  800591:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800594:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  800597:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  80059a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80059e:	79 81                	jns    800521 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  8005a0:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  8005a4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005aa:	e9 72 ff ff ff       	jmp    800521 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  8005af:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005b3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005bb:	eb d7                	jmp    800594 <vprintfmt+0xe4>
+			if (width < 0)
+  8005bd:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  8005c0:	85 f6                	test   %esi,%esi
+  8005c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c7:	0f 49 c6             	cmovns %esi,%eax
+  8005ca:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005cd:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8005d0:	e9 4c ff ff ff       	jmp    800521 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005d5:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  8005d8:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  8005df:	e9 3d ff ff ff       	jmp    800521 <vprintfmt+0x71>
+			lflag++;
+  8005e4:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005e7:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8005ea:	e9 32 ff ff ff       	jmp    800521 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  8005ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8005f5:	77 19                	ja     800610 <vprintfmt+0x160>
+  8005f7:	89 c2                	mov    %eax,%edx
+  8005f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005fd:	83 c0 08             	add    $0x8,%eax
+  800600:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800603:	8b 3a                	mov    (%rdx),%edi
+  800605:	4c 89 ee             	mov    %r13,%rsi
+  800608:	41 ff d6             	call   *%r14
+			break;
+  80060b:	e9 d5 fe ff ff       	jmp    8004e5 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  800610:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800614:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800618:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80061c:	eb e5                	jmp    800603 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  80061e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800621:	83 f8 2f             	cmp    $0x2f,%eax
+  800624:	77 5a                	ja     800680 <vprintfmt+0x1d0>
+  800626:	89 c2                	mov    %eax,%edx
+  800628:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80062c:	83 c0 08             	add    $0x8,%eax
+  80062f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800632:	8b 02                	mov    (%rdx),%eax
+  800634:	89 c1                	mov    %eax,%ecx
+  800636:	f7 d9                	neg    %ecx
+  800638:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80063b:	83 f9 08             	cmp    $0x8,%ecx
+  80063e:	7f 4e                	jg     80068e <vprintfmt+0x1de>
+  800640:	48 63 c1             	movslq %ecx,%rax
+  800643:	48 ba a0 18 80 00 00 	movabs $0x8018a0,%rdx
+  80064a:	00 00 00 
+  80064d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800651:	48 85 c0             	test   %rax,%rax
+  800654:	74 38                	je     80068e <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800656:	48 89 c1             	mov    %rax,%rcx
+  800659:	48 ba 44 15 80 00 00 	movabs $0x801544,%rdx
+  800660:	00 00 00 
+  800663:	4c 89 ee             	mov    %r13,%rsi
+  800666:	4c 89 f7             	mov    %r14,%rdi
+  800669:	b8 00 00 00 00       	mov    $0x0,%eax
+  80066e:	49 b8 2a 04 80 00 00 	movabs $0x80042a,%r8
+  800675:	00 00 00 
+  800678:	41 ff d0             	call   *%r8
+  80067b:	e9 65 fe ff ff       	jmp    8004e5 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  800680:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800684:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800688:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80068c:	eb a4                	jmp    800632 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  80068e:	48 ba 3b 15 80 00 00 	movabs $0x80153b,%rdx
+  800695:	00 00 00 
+  800698:	4c 89 ee             	mov    %r13,%rsi
+  80069b:	4c 89 f7             	mov    %r14,%rdi
+  80069e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a3:	49 b8 2a 04 80 00 00 	movabs $0x80042a,%r8
+  8006aa:	00 00 00 
+  8006ad:	41 ff d0             	call   *%r8
+  8006b0:	e9 30 fe ff ff       	jmp    8004e5 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  8006b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006bb:	77 36                	ja     8006f3 <vprintfmt+0x243>
+  8006bd:	89 c2                	mov    %eax,%edx
+  8006bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c3:	83 c0 08             	add    $0x8,%eax
+  8006c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c9:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  8006cc:	48 85 c9             	test   %rcx,%rcx
+  8006cf:	48 b8 34 15 80 00 00 	movabs $0x801534,%rax
+  8006d6:	00 00 00 
+  8006d9:	48 0f 45 c1          	cmovne %rcx,%rax
+  8006dd:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  8006e1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006e5:	7e 06                	jle    8006ed <vprintfmt+0x23d>
+  8006e7:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  8006eb:	75 14                	jne    800701 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006ed:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8006f1:	eb 64                	jmp    800757 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  8006f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ff:	eb c8                	jmp    8006c9 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800701:	49 63 f7             	movslq %r15d,%rsi
+  800704:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800708:	48 b8 93 0b 80 00 00 	movabs $0x800b93,%rax
+  80070f:	00 00 00 
+  800712:	ff d0                	call   *%rax
+  800714:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800717:	29 c1                	sub    %eax,%ecx
+  800719:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  80071c:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  80071f:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800723:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800726:	eb 0d                	jmp    800735 <vprintfmt+0x285>
+					putch(padc, putdat);
+  800728:	4c 89 ee             	mov    %r13,%rsi
+  80072b:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  80072e:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800731:	41 83 ec 01          	sub    $0x1,%r12d
+  800735:	45 85 e4             	test   %r12d,%r12d
+  800738:	7f ee                	jg     800728 <vprintfmt+0x278>
+  80073a:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  80073d:	85 c9                	test   %ecx,%ecx
+  80073f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800744:	0f 49 c1             	cmovns %ecx,%eax
+  800747:	29 c1                	sub    %eax,%ecx
+  800749:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  80074c:	eb 9f                	jmp    8006ed <vprintfmt+0x23d>
+					putch(ch, putdat);
+  80074e:	4c 89 ee             	mov    %r13,%rsi
+  800751:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800754:	4c 89 e2             	mov    %r12,%rdx
+  800757:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  80075b:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800761:	0f be f8             	movsbl %al,%edi
+  800764:	85 ff                	test   %edi,%edi
+  800766:	74 29                	je     800791 <vprintfmt+0x2e1>
+  800768:	45 85 ff             	test   %r15d,%r15d
+  80076b:	78 06                	js     800773 <vprintfmt+0x2c3>
+  80076d:	41 83 ef 01          	sub    $0x1,%r15d
+  800771:	78 1e                	js     800791 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800773:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800777:	74 d5                	je     80074e <vprintfmt+0x29e>
+  800779:	0f be c0             	movsbl %al,%eax
+  80077c:	83 e8 20             	sub    $0x20,%eax
+  80077f:	83 f8 5e             	cmp    $0x5e,%eax
+  800782:	76 ca                	jbe    80074e <vprintfmt+0x29e>
+					putch('?', putdat);
+  800784:	4c 89 ee             	mov    %r13,%rsi
+  800787:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80078c:	41 ff d6             	call   *%r14
+  80078f:	eb c3                	jmp    800754 <vprintfmt+0x2a4>
+  800791:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800795:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800798:	41 01 c4             	add    %eax,%r12d
+  80079b:	41 29 d4             	sub    %edx,%r12d
+  80079e:	eb 0f                	jmp    8007af <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  8007a0:	4c 89 ee             	mov    %r13,%rsi
+  8007a3:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007a8:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  8007ab:	41 83 ec 01          	sub    $0x1,%r12d
+  8007af:	45 85 e4             	test   %r12d,%r12d
+  8007b2:	7f ec                	jg     8007a0 <vprintfmt+0x2f0>
+  8007b4:	e9 2c fd ff ff       	jmp    8004e5 <vprintfmt+0x35>
+	if (lflag >= 2)
+  8007b9:	83 f9 01             	cmp    $0x1,%ecx
+  8007bc:	7f 1d                	jg     8007db <vprintfmt+0x32b>
+	else if (lflag)
+  8007be:	85 c9                	test   %ecx,%ecx
+  8007c0:	74 5e                	je     800820 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  8007c2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c8:	77 48                	ja     800812 <vprintfmt+0x362>
+  8007ca:	89 c2                	mov    %eax,%edx
+  8007cc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d0:	83 c0 08             	add    $0x8,%eax
+  8007d3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d6:	4c 8b 22             	mov    (%rdx),%r12
+  8007d9:	eb 17                	jmp    8007f2 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  8007db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007de:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e1:	77 21                	ja     800804 <vprintfmt+0x354>
+  8007e3:	89 c2                	mov    %eax,%edx
+  8007e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e9:	83 c0 08             	add    $0x8,%eax
+  8007ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ef:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  8007f2:	4d 85 e4             	test   %r12,%r12
+  8007f5:	78 50                	js     800847 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  8007f7:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  8007fa:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8007ff:	e9 b4 01 00 00       	jmp    8009b8 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800804:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800808:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80080c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800810:	eb dd                	jmp    8007ef <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800812:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800816:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80081a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081e:	eb b6                	jmp    8007d6 <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800820:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800823:	83 f8 2f             	cmp    $0x2f,%eax
+  800826:	77 11                	ja     800839 <vprintfmt+0x389>
+  800828:	89 c2                	mov    %eax,%edx
+  80082a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082e:	83 c0 08             	add    $0x8,%eax
+  800831:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800834:	4c 63 22             	movslq (%rdx),%r12
+  800837:	eb b9                	jmp    8007f2 <vprintfmt+0x342>
+  800839:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800841:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800845:	eb ed                	jmp    800834 <vprintfmt+0x384>
+				putch('-', putdat);
+  800847:	4c 89 ee             	mov    %r13,%rsi
+  80084a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80084f:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800852:	4c 89 e2             	mov    %r12,%rdx
+  800855:	48 f7 da             	neg    %rdx
+			base = 10;
+  800858:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80085d:	e9 56 01 00 00       	jmp    8009b8 <vprintfmt+0x508>
+	if (lflag >= 2)
+  800862:	83 f9 01             	cmp    $0x1,%ecx
+  800865:	7f 25                	jg     80088c <vprintfmt+0x3dc>
+	else if (lflag)
+  800867:	85 c9                	test   %ecx,%ecx
+  800869:	74 5e                	je     8008c9 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  80086b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086e:	83 f8 2f             	cmp    $0x2f,%eax
+  800871:	77 48                	ja     8008bb <vprintfmt+0x40b>
+  800873:	89 c2                	mov    %eax,%edx
+  800875:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800879:	83 c0 08             	add    $0x8,%eax
+  80087c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087f:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800882:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800887:	e9 2c 01 00 00       	jmp    8009b8 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  80088c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088f:	83 f8 2f             	cmp    $0x2f,%eax
+  800892:	77 19                	ja     8008ad <vprintfmt+0x3fd>
+  800894:	89 c2                	mov    %eax,%edx
+  800896:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80089a:	83 c0 08             	add    $0x8,%eax
+  80089d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a0:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8008a3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  8008a8:	e9 0b 01 00 00       	jmp    8009b8 <vprintfmt+0x508>
+  8008ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b9:	eb e5                	jmp    8008a0 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  8008bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008bf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c7:	eb b6                	jmp    80087f <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  8008c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008cf:	77 18                	ja     8008e9 <vprintfmt+0x439>
+  8008d1:	89 c2                	mov    %eax,%edx
+  8008d3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d7:	83 c0 08             	add    $0x8,%eax
+  8008da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008dd:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  8008df:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  8008e4:	e9 cf 00 00 00       	jmp    8009b8 <vprintfmt+0x508>
+  8008e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f5:	eb e6                	jmp    8008dd <vprintfmt+0x42d>
+	if (lflag >= 2)
+  8008f7:	83 f9 01             	cmp    $0x1,%ecx
+  8008fa:	7f 25                	jg     800921 <vprintfmt+0x471>
+	else if (lflag)
+  8008fc:	85 c9                	test   %ecx,%ecx
+  8008fe:	74 5b                	je     80095b <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800900:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800903:	83 f8 2f             	cmp    $0x2f,%eax
+  800906:	77 45                	ja     80094d <vprintfmt+0x49d>
+  800908:	89 c2                	mov    %eax,%edx
+  80090a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090e:	83 c0 08             	add    $0x8,%eax
+  800911:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800914:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800917:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  80091c:	e9 97 00 00 00       	jmp    8009b8 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800921:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800924:	83 f8 2f             	cmp    $0x2f,%eax
+  800927:	77 16                	ja     80093f <vprintfmt+0x48f>
+  800929:	89 c2                	mov    %eax,%edx
+  80092b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092f:	83 c0 08             	add    $0x8,%eax
+  800932:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800935:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800938:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  80093d:	eb 79                	jmp    8009b8 <vprintfmt+0x508>
+  80093f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800943:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800947:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094b:	eb e8                	jmp    800935 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  80094d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800951:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800955:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800959:	eb b9                	jmp    800914 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  80095b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095e:	83 f8 2f             	cmp    $0x2f,%eax
+  800961:	77 15                	ja     800978 <vprintfmt+0x4c8>
+  800963:	89 c2                	mov    %eax,%edx
+  800965:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800969:	83 c0 08             	add    $0x8,%eax
+  80096c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096f:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800971:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800976:	eb 40                	jmp    8009b8 <vprintfmt+0x508>
+  800978:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800980:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800984:	eb e9                	jmp    80096f <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800986:	4c 89 ee             	mov    %r13,%rsi
+  800989:	bf 30 00 00 00       	mov    $0x30,%edi
+  80098e:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800991:	4c 89 ee             	mov    %r13,%rsi
+  800994:	bf 78 00 00 00       	mov    $0x78,%edi
+  800999:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  80099c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099f:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a2:	77 34                	ja     8009d8 <vprintfmt+0x528>
+  8009a4:	89 c2                	mov    %eax,%edx
+  8009a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009aa:	83 c0 08             	add    $0x8,%eax
+  8009ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  8009b0:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  8009b3:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  8009b8:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  8009bd:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009c1:	4c 89 ee             	mov    %r13,%rsi
+  8009c4:	4c 89 f7             	mov    %r14,%rdi
+  8009c7:	48 b8 8a 03 80 00 00 	movabs $0x80038a,%rax
+  8009ce:	00 00 00 
+  8009d1:	ff d0                	call   *%rax
+			break;
+  8009d3:	e9 0d fb ff ff       	jmp    8004e5 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  8009d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e4:	eb ca                	jmp    8009b0 <vprintfmt+0x500>
+	if (lflag >= 2)
+  8009e6:	83 f9 01             	cmp    $0x1,%ecx
+  8009e9:	7f 22                	jg     800a0d <vprintfmt+0x55d>
+	else if (lflag)
+  8009eb:	85 c9                	test   %ecx,%ecx
+  8009ed:	74 58                	je     800a47 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  8009ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f5:	77 42                	ja     800a39 <vprintfmt+0x589>
+  8009f7:	89 c2                	mov    %eax,%edx
+  8009f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fd:	83 c0 08             	add    $0x8,%eax
+  800a00:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a03:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800a06:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800a0b:	eb ab                	jmp    8009b8 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800a0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a10:	83 f8 2f             	cmp    $0x2f,%eax
+  800a13:	77 16                	ja     800a2b <vprintfmt+0x57b>
+  800a15:	89 c2                	mov    %eax,%edx
+  800a17:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1b:	83 c0 08             	add    $0x8,%eax
+  800a1e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a21:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800a24:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800a29:	eb 8d                	jmp    8009b8 <vprintfmt+0x508>
+  800a2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a37:	eb e8                	jmp    800a21 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800a39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a45:	eb bc                	jmp    800a03 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800a47:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4d:	77 18                	ja     800a67 <vprintfmt+0x5b7>
+  800a4f:	89 c2                	mov    %eax,%edx
+  800a51:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a55:	83 c0 08             	add    $0x8,%eax
+  800a58:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5b:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800a5d:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800a62:	e9 51 ff ff ff       	jmp    8009b8 <vprintfmt+0x508>
+  800a67:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a73:	eb e6                	jmp    800a5b <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800a75:	4c 89 ee             	mov    %r13,%rsi
+  800a78:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a7d:	41 ff d6             	call   *%r14
+			break;
+  800a80:	e9 60 fa ff ff       	jmp    8004e5 <vprintfmt+0x35>
+			putch('%', putdat);
+  800a85:	4c 89 ee             	mov    %r13,%rsi
+  800a88:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a8d:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a90:	4c 89 e3             	mov    %r12,%rbx
+  800a93:	eb 04                	jmp    800a99 <vprintfmt+0x5e9>
+  800a95:	48 83 eb 01          	sub    $0x1,%rbx
+  800a99:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a9d:	75 f6                	jne    800a95 <vprintfmt+0x5e5>
+  800a9f:	e9 41 fa ff ff       	jmp    8004e5 <vprintfmt+0x35>
+
+0000000000800aa4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800aa4:	55                   	push   %rbp
+  800aa5:	48 89 e5             	mov    %rsp,%rbp
+  800aa8:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800aac:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800ab0:	48 63 c6             	movslq %esi,%rax
+  800ab3:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800ab8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800abc:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800ac3:	48 85 ff             	test   %rdi,%rdi
+  800ac6:	74 2a                	je     800af2 <vsnprintf+0x4e>
+  800ac8:	85 f6                	test   %esi,%esi
+  800aca:	7e 26                	jle    800af2 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800acc:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800ad0:	48 bf 12 04 80 00 00 	movabs $0x800412,%rdi
+  800ad7:	00 00 00 
+  800ada:	48 b8 b0 04 80 00 00 	movabs $0x8004b0,%rax
+  800ae1:	00 00 00 
+  800ae4:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ae6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800aea:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800aed:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800af0:	c9                   	leave
+  800af1:	c3                   	ret
+		return -E_INVAL;
+  800af2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800af7:	eb f7                	jmp    800af0 <vsnprintf+0x4c>
+
+0000000000800af9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800af9:	55                   	push   %rbp
+  800afa:	48 89 e5             	mov    %rsp,%rbp
+  800afd:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800b04:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800b0b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800b12:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800b19:	84 c0                	test   %al,%al
+  800b1b:	74 20                	je     800b3d <snprintf+0x44>
+  800b1d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800b21:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800b25:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800b29:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800b2d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800b31:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800b35:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800b39:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b3d:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800b44:	00 00 00 
+  800b47:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800b4e:	00 00 00 
+  800b51:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b55:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800b5c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800b63:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b6a:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800b71:	48 b8 a4 0a 80 00 00 	movabs $0x800aa4,%rax
+  800b78:	00 00 00 
+  800b7b:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800b7d:	c9                   	leave
+  800b7e:	c3                   	ret
+
+0000000000800b7f <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b84:	48 89 d0             	mov    %rdx,%rax
+  800b87:	48 83 c2 01          	add    $0x1,%rdx
+  800b8b:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800b90:	75 f2                	jne    800b84 <strlen+0x5>
+		n++;
+	return n;
+}
+  800b92:	c3                   	ret
+
+0000000000800b93 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b93:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b98:	eb 03                	jmp    800b9d <strnlen+0xa>
+  800b9a:	48 89 d0             	mov    %rdx,%rax
+  800b9d:	48 39 c6             	cmp    %rax,%rsi
+  800ba0:	74 0a                	je     800bac <strnlen+0x19>
+  800ba2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800ba6:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800baa:	75 ee                	jne    800b9a <strnlen+0x7>
+		n++;
+	return n;
+}
+  800bac:	c3                   	ret
+
+0000000000800bad <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800bad:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800bb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bb5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bb9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800bbc:	48 83 c2 01          	add    $0x1,%rdx
+  800bc0:	84 c9                	test   %cl,%cl
+  800bc2:	75 f1                	jne    800bb5 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800bc4:	c3                   	ret
+
+0000000000800bc5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800bc5:	55                   	push   %rbp
+  800bc6:	48 89 e5             	mov    %rsp,%rbp
+  800bc9:	41 54                	push   %r12
+  800bcb:	53                   	push   %rbx
+  800bcc:	48 89 fb             	mov    %rdi,%rbx
+  800bcf:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800bd2:	48 b8 7f 0b 80 00 00 	movabs $0x800b7f,%rax
+  800bd9:	00 00 00 
+  800bdc:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800bde:	48 63 f8             	movslq %eax,%rdi
+  800be1:	48 01 df             	add    %rbx,%rdi
+  800be4:	4c 89 e6             	mov    %r12,%rsi
+  800be7:	48 b8 ad 0b 80 00 00 	movabs $0x800bad,%rax
+  800bee:	00 00 00 
+  800bf1:	ff d0                	call   *%rax
+	return dst;
+}
+  800bf3:	48 89 d8             	mov    %rbx,%rax
+  800bf6:	5b                   	pop    %rbx
+  800bf7:	41 5c                	pop    %r12
+  800bf9:	5d                   	pop    %rbp
+  800bfa:	c3                   	ret
+
+0000000000800bfb <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bfb:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800bfe:	48 01 fa             	add    %rdi,%rdx
+  800c01:	48 89 f9             	mov    %rdi,%rcx
+  800c04:	eb 14                	jmp    800c1a <strncpy+0x1f>
+		*dst++ = *src;
+  800c06:	48 83 c1 01          	add    $0x1,%rcx
+  800c0a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c0e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c12:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c16:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800c1a:	48 39 d1             	cmp    %rdx,%rcx
+  800c1d:	75 e7                	jne    800c06 <strncpy+0xb>
+	}
+	return ret;
+}
+  800c1f:	c3                   	ret
+
+0000000000800c20 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c20:	48 89 f8             	mov    %rdi,%rax
+  800c23:	48 85 d2             	test   %rdx,%rdx
+  800c26:	74 27                	je     800c4f <strlcpy+0x2f>
+  800c28:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800c2d:	48 89 fa             	mov    %rdi,%rdx
+  800c30:	eb 0b                	jmp    800c3d <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c32:	48 83 c6 01          	add    $0x1,%rsi
+  800c36:	48 83 c2 01          	add    $0x1,%rdx
+  800c3a:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800c3d:	48 39 c2             	cmp    %rax,%rdx
+  800c40:	74 0a                	je     800c4c <strlcpy+0x2c>
+  800c42:	0f b6 0e             	movzbl (%rsi),%ecx
+  800c45:	84 c9                	test   %cl,%cl
+  800c47:	75 e9                	jne    800c32 <strlcpy+0x12>
+  800c49:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800c4c:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800c4f:	48 29 f8             	sub    %rdi,%rax
+}
+  800c52:	c3                   	ret
+
+0000000000800c53 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800c53:	eb 08                	jmp    800c5d <strcmp+0xa>
+		p++, q++;
+  800c55:	48 83 c7 01          	add    $0x1,%rdi
+  800c59:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800c5d:	0f b6 07             	movzbl (%rdi),%eax
+  800c60:	84 c0                	test   %al,%al
+  800c62:	74 04                	je     800c68 <strcmp+0x15>
+  800c64:	3a 06                	cmp    (%rsi),%al
+  800c66:	74 ed                	je     800c55 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c68:	0f b6 c0             	movzbl %al,%eax
+  800c6b:	0f b6 16             	movzbl (%rsi),%edx
+  800c6e:	29 d0                	sub    %edx,%eax
+}
+  800c70:	c3                   	ret
+
+0000000000800c71 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800c71:	eb 0c                	jmp    800c7f <strncmp+0xe>
+		n--, p++, q++;
+  800c73:	48 83 ea 01          	sub    $0x1,%rdx
+  800c77:	48 83 c7 01          	add    $0x1,%rdi
+  800c7b:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800c7f:	48 85 d2             	test   %rdx,%rdx
+  800c82:	74 14                	je     800c98 <strncmp+0x27>
+  800c84:	0f b6 07             	movzbl (%rdi),%eax
+  800c87:	84 c0                	test   %al,%al
+  800c89:	74 04                	je     800c8f <strncmp+0x1e>
+  800c8b:	3a 06                	cmp    (%rsi),%al
+  800c8d:	74 e4                	je     800c73 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c8f:	0f b6 07             	movzbl (%rdi),%eax
+  800c92:	0f b6 16             	movzbl (%rsi),%edx
+  800c95:	29 d0                	sub    %edx,%eax
+}
+  800c97:	c3                   	ret
+		return 0;
+  800c98:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c9d:	c3                   	ret
+
+0000000000800c9e <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800c9e:	eb 04                	jmp    800ca4 <strchr+0x6>
+  800ca0:	48 83 c7 01          	add    $0x1,%rdi
+  800ca4:	0f b6 07             	movzbl (%rdi),%eax
+  800ca7:	84 c0                	test   %al,%al
+  800ca9:	74 09                	je     800cb4 <strchr+0x16>
+		if (*s == c)
+  800cab:	40 38 f0             	cmp    %sil,%al
+  800cae:	75 f0                	jne    800ca0 <strchr+0x2>
+  800cb0:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800cb3:	c3                   	ret
+	return 0;
+  800cb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb9:	c3                   	ret
+
+0000000000800cba <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800cba:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800cbd:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800cc0:	40 38 f2             	cmp    %sil,%dl
+  800cc3:	74 0a                	je     800ccf <strfind+0x15>
+  800cc5:	84 d2                	test   %dl,%dl
+  800cc7:	74 06                	je     800ccf <strfind+0x15>
+	for (; *s; s++)
+  800cc9:	48 83 c0 01          	add    $0x1,%rax
+  800ccd:	eb ee                	jmp    800cbd <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800ccf:	c3                   	ret
+
+0000000000800cd0 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800cd0:	48 85 d2             	test   %rdx,%rdx
+  800cd3:	74 28                	je     800cfd <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800cd5:	48 89 f8             	mov    %rdi,%rax
+  800cd8:	48 09 d0             	or     %rdx,%rax
+  800cdb:	a8 03                	test   $0x3,%al
+  800cdd:	75 16                	jne    800cf5 <memset+0x25>
+		c &= 0xFF;
+  800cdf:	40 0f b6 f6          	movzbl %sil,%esi
+  800ce3:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ce9:	48 89 d1             	mov    %rdx,%rcx
+  800cec:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800cf0:	fc                   	cld
+  800cf1:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800cf3:	eb 08                	jmp    800cfd <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800cf5:	89 f0                	mov    %esi,%eax
+  800cf7:	48 89 d1             	mov    %rdx,%rcx
+  800cfa:	fc                   	cld
+  800cfb:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800cfd:	48 89 f8             	mov    %rdi,%rax
+  800d00:	c3                   	ret
+
+0000000000800d01 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d01:	48 89 f8             	mov    %rdi,%rax
+  800d04:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d07:	48 39 fe             	cmp    %rdi,%rsi
+  800d0a:	73 3a                	jae    800d46 <memmove+0x45>
+  800d0c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d10:	48 39 d7             	cmp    %rdx,%rdi
+  800d13:	73 31                	jae    800d46 <memmove+0x45>
+		s += n;
+		d += n;
+  800d15:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800d19:	48 89 d6             	mov    %rdx,%rsi
+  800d1c:	48 09 fe             	or     %rdi,%rsi
+  800d1f:	48 09 ce             	or     %rcx,%rsi
+  800d22:	40 f6 c6 03          	test   $0x3,%sil
+  800d26:	75 11                	jne    800d39 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d28:	48 83 ef 04          	sub    $0x4,%rdi
+  800d2c:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800d30:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800d34:	fd                   	std
+  800d35:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800d37:	eb 0b                	jmp    800d44 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d39:	48 83 ef 01          	sub    $0x1,%rdi
+  800d3d:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800d41:	fd                   	std
+  800d42:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d44:	fc                   	cld
+  800d45:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800d46:	48 89 f2             	mov    %rsi,%rdx
+  800d49:	48 09 c2             	or     %rax,%rdx
+  800d4c:	48 09 ca             	or     %rcx,%rdx
+  800d4f:	f6 c2 03             	test   $0x3,%dl
+  800d52:	75 0b                	jne    800d5f <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d54:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800d58:	48 89 c7             	mov    %rax,%rdi
+  800d5b:	fc                   	cld
+  800d5c:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800d5e:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800d5f:	48 89 c7             	mov    %rax,%rdi
+  800d62:	fc                   	cld
+  800d63:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d65:	c3                   	ret
+
+0000000000800d66 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800d66:	55                   	push   %rbp
+  800d67:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800d6a:	48 b8 01 0d 80 00 00 	movabs $0x800d01,%rax
+  800d71:	00 00 00 
+  800d74:	ff d0                	call   *%rax
+}
+  800d76:	5d                   	pop    %rbp
+  800d77:	c3                   	ret
+
+0000000000800d78 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800d78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d7d:	48 39 c2             	cmp    %rax,%rdx
+  800d80:	74 1e                	je     800da0 <memcmp+0x28>
+		if (*s1 != *s2)
+  800d82:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800d86:	48 83 c0 01          	add    $0x1,%rax
+  800d8a:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800d90:	44 38 c1             	cmp    %r8b,%cl
+  800d93:	74 e8                	je     800d7d <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800d95:	0f b6 c1             	movzbl %cl,%eax
+  800d98:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800d9c:	44 29 c0             	sub    %r8d,%eax
+  800d9f:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800da0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800da5:	c3                   	ret
+
+0000000000800da6 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800da6:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800da9:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800dac:	eb 04                	jmp    800db2 <memfind+0xc>
+  800dae:	48 83 c0 01          	add    $0x1,%rax
+  800db2:	48 39 d0             	cmp    %rdx,%rax
+  800db5:	73 05                	jae    800dbc <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800db7:	40 38 30             	cmp    %sil,(%rax)
+  800dba:	75 f2                	jne    800dae <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800dbc:	c3                   	ret
+
+0000000000800dbd <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800dbd:	48 89 f9             	mov    %rdi,%rcx
+  800dc0:	49 89 f0             	mov    %rsi,%r8
+  800dc3:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800dc5:	eb 04                	jmp    800dcb <strtol+0xe>
+		s++;
+  800dc7:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800dcb:	0f b6 01             	movzbl (%rcx),%eax
+  800dce:	3c 20                	cmp    $0x20,%al
+  800dd0:	74 f5                	je     800dc7 <strtol+0xa>
+  800dd2:	3c 09                	cmp    $0x9,%al
+  800dd4:	74 f1                	je     800dc7 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800dd6:	3c 2b                	cmp    $0x2b,%al
+  800dd8:	74 2b                	je     800e05 <strtol+0x48>
+	int neg = 0;
+  800dda:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800de0:	3c 2d                	cmp    $0x2d,%al
+  800de2:	74 2d                	je     800e11 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800de4:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800dea:	75 0f                	jne    800dfb <strtol+0x3e>
+  800dec:	80 39 30             	cmpb   $0x30,(%rcx)
+  800def:	74 2c                	je     800e1d <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800df1:	85 ff                	test   %edi,%edi
+  800df3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800df8:	0f 44 f8             	cmove  %eax,%edi
+  800dfb:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800e00:	4c 63 d7             	movslq %edi,%r10
+  800e03:	eb 4f                	jmp    800e54 <strtol+0x97>
+		s++;
+  800e05:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800e09:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800e0f:	eb d3                	jmp    800de4 <strtol+0x27>
+		s++, neg = 1;
+  800e11:	48 83 c1 01          	add    $0x1,%rcx
+  800e15:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800e1b:	eb c7                	jmp    800de4 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e1d:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800e21:	74 0f                	je     800e32 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800e23:	85 ff                	test   %edi,%edi
+  800e25:	75 d4                	jne    800dfb <strtol+0x3e>
+		s++, base = 8;
+  800e27:	48 83 c1 01          	add    $0x1,%rcx
+  800e2b:	bf 08 00 00 00       	mov    $0x8,%edi
+  800e30:	eb c9                	jmp    800dfb <strtol+0x3e>
+		s += 2, base = 16;
+  800e32:	48 83 c1 02          	add    $0x2,%rcx
+  800e36:	bf 10 00 00 00       	mov    $0x10,%edi
+  800e3b:	eb be                	jmp    800dfb <strtol+0x3e>
+			dig = *s - '0';
+  800e3d:	0f be c0             	movsbl %al,%eax
+  800e40:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800e43:	39 f8                	cmp    %edi,%eax
+  800e45:	7d 3b                	jge    800e82 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800e47:	48 83 c1 01          	add    $0x1,%rcx
+  800e4b:	49 0f af d2          	imul   %r10,%rdx
+  800e4f:	48 98                	cltq
+  800e51:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800e54:	0f b6 01             	movzbl (%rcx),%eax
+  800e57:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800e5a:	40 80 fe 09          	cmp    $0x9,%sil
+  800e5e:	76 dd                	jbe    800e3d <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800e60:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800e63:	40 80 fe 19          	cmp    $0x19,%sil
+  800e67:	77 08                	ja     800e71 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800e69:	0f be c0             	movsbl %al,%eax
+  800e6c:	83 e8 57             	sub    $0x57,%eax
+  800e6f:	eb d2                	jmp    800e43 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800e71:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800e74:	40 80 fe 19          	cmp    $0x19,%sil
+  800e78:	77 08                	ja     800e82 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800e7a:	0f be c0             	movsbl %al,%eax
+  800e7d:	83 e8 37             	sub    $0x37,%eax
+  800e80:	eb c1                	jmp    800e43 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800e82:	4d 85 c0             	test   %r8,%r8
+  800e85:	74 03                	je     800e8a <strtol+0xcd>
+		*endptr = (char *) s;
+  800e87:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800e8a:	48 89 d0             	mov    %rdx,%rax
+  800e8d:	48 f7 d8             	neg    %rax
+  800e90:	45 85 c9             	test   %r9d,%r9d
+  800e93:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800e97:	48 89 d0             	mov    %rdx,%rax
+  800e9a:	c3                   	ret
+
+0000000000800e9b <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800e9b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800ea1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800ea7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb1:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800eb3:	c3                   	ret
+
+0000000000800eb4 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800eb4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800eba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800ec0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ec5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eca:	48 89 fe             	mov    %rdi,%rsi
+  800ecd:	48 89 fa             	mov    %rdi,%rdx
+  800ed0:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ed2:	c3                   	ret
+
+0000000000800ed3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800ed3:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800ed6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800edc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800ee2:	be 00 00 00 00       	mov    $0x0,%esi
+  800ee7:	b8 03 00 00 00       	mov    $0x3,%eax
+  800eec:	48 89 f2             	mov    %rsi,%rdx
+  800eef:	0f 05                	syscall
+	if(check && ret > 0)
+  800ef1:	48 85 c0             	test   %rax,%rax
+  800ef4:	7f 01                	jg     800ef7 <sys_env_destroy+0x24>
+}
+  800ef6:	c3                   	ret
+{
+  800ef7:	55                   	push   %rbp
+  800ef8:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800efb:	49 89 c0             	mov    %rax,%r8
+  800efe:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800f03:	48 ba e8 18 80 00 00 	movabs $0x8018e8,%rdx
+  800f0a:	00 00 00 
+  800f0d:	be 28 00 00 00       	mov    $0x28,%esi
+  800f12:	48 bf 05 19 80 00 00 	movabs $0x801905,%rdi
+  800f19:	00 00 00 
+  800f1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f21:	49 b9 57 01 80 00 00 	movabs $0x800157,%r9
+  800f28:	00 00 00 
+  800f2b:	41 ff d1             	call   *%r9
+
+0000000000800f2e <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800f2e:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800f35:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800f36:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800f3b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800f3f:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800f43:	48 c1 e2 04          	shl    $0x4,%rdx
+  800f47:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800f4e:	00 00 00 
+  800f51:	48 01 d0             	add    %rdx,%rax
+  800f54:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800f5a:	c3                   	ret
+
+0000000000800f5b <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800f5b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f61:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f67:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f6c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f71:	48 89 fe             	mov    %rdi,%rsi
+  800f74:	48 89 fa             	mov    %rdi,%rdx
+  800f77:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f79:	c3                   	ret
+
+0000000000800f7a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  800f7a:	48 63 d2             	movslq %edx,%rdx
+  800f7d:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800f80:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f86:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f8c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f91:	0f 05                	syscall
+	if(check && ret > 0)
+  800f93:	48 85 c0             	test   %rax,%rax
+  800f96:	7f 01                	jg     800f99 <sys_page_alloc+0x1f>
+}
+  800f98:	c3                   	ret
+{
+  800f99:	55                   	push   %rbp
+  800f9a:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f9d:	49 89 c0             	mov    %rax,%r8
+  800fa0:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800fa5:	48 ba e8 18 80 00 00 	movabs $0x8018e8,%rdx
+  800fac:	00 00 00 
+  800faf:	be 28 00 00 00       	mov    $0x28,%esi
+  800fb4:	48 bf 05 19 80 00 00 	movabs $0x801905,%rdi
+  800fbb:	00 00 00 
+  800fbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc3:	49 b9 57 01 80 00 00 	movabs $0x800157,%r9
+  800fca:	00 00 00 
+  800fcd:	41 ff d1             	call   *%r9
+
+0000000000800fd0 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  800fd0:	48 63 d2             	movslq %edx,%rdx
+  800fd3:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800fd6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fdc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fe2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fe7:	0f 05                	syscall
+	if(check && ret > 0)
+  800fe9:	48 85 c0             	test   %rax,%rax
+  800fec:	7f 01                	jg     800fef <sys_page_alloc_huge+0x1f>
+}
+  800fee:	c3                   	ret
+{
+  800fef:	55                   	push   %rbp
+  800ff0:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff3:	49 89 c0             	mov    %rax,%r8
+  800ff6:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800ffb:	48 ba e8 18 80 00 00 	movabs $0x8018e8,%rdx
+  801002:	00 00 00 
+  801005:	be 28 00 00 00       	mov    $0x28,%esi
+  80100a:	48 bf 05 19 80 00 00 	movabs $0x801905,%rdi
+  801011:	00 00 00 
+  801014:	b8 00 00 00 00       	mov    $0x0,%eax
+  801019:	49 b9 57 01 80 00 00 	movabs $0x800157,%r9
+  801020:	00 00 00 
+  801023:	41 ff d1             	call   *%r9
+
+0000000000801026 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801026:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  801029:	48 63 d2             	movslq %edx,%rdx
+  80102c:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  80102f:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  801032:	b8 05 00 00 00       	mov    $0x5,%eax
+  801037:	0f 05                	syscall
+	if(check && ret > 0)
+  801039:	48 85 c0             	test   %rax,%rax
+  80103c:	7f 01                	jg     80103f <sys_page_map+0x19>
+}
+  80103e:	c3                   	ret
+{
+  80103f:	55                   	push   %rbp
+  801040:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801043:	49 89 c0             	mov    %rax,%r8
+  801046:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80104b:	48 ba e8 18 80 00 00 	movabs $0x8018e8,%rdx
+  801052:	00 00 00 
+  801055:	be 28 00 00 00       	mov    $0x28,%esi
+  80105a:	48 bf 05 19 80 00 00 	movabs $0x801905,%rdi
+  801061:	00 00 00 
+  801064:	b8 00 00 00 00       	mov    $0x0,%eax
+  801069:	49 b9 57 01 80 00 00 	movabs $0x800157,%r9
+  801070:	00 00 00 
+  801073:	41 ff d1             	call   *%r9
+
+0000000000801076 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  801076:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801079:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80107f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801085:	ba 00 00 00 00       	mov    $0x0,%edx
+  80108a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80108f:	0f 05                	syscall
+	if(check && ret > 0)
+  801091:	48 85 c0             	test   %rax,%rax
+  801094:	7f 01                	jg     801097 <sys_page_unmap+0x21>
+}
+  801096:	c3                   	ret
+{
+  801097:	55                   	push   %rbp
+  801098:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80109b:	49 89 c0             	mov    %rax,%r8
+  80109e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8010a3:	48 ba e8 18 80 00 00 	movabs $0x8018e8,%rdx
+  8010aa:	00 00 00 
+  8010ad:	be 28 00 00 00       	mov    $0x28,%esi
+  8010b2:	48 bf 05 19 80 00 00 	movabs $0x801905,%rdi
+  8010b9:	00 00 00 
+  8010bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c1:	49 b9 57 01 80 00 00 	movabs $0x800157,%r9
+  8010c8:	00 00 00 
+  8010cb:	41 ff d1             	call   *%r9
+
+00000000008010ce <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  8010ce:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010df:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8010e4:	48 89 fe             	mov    %rdi,%rsi
+  8010e7:	48 89 fa             	mov    %rdi,%rdx
+  8010ea:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8010ec:	c3                   	ret
+
+00000000008010ed <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  8010ed:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010fe:	b8 10 00 00 00       	mov    $0x10,%eax
+  801103:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  801105:	c3                   	ret
+
+0000000000801106 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  801106:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80110c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801112:	b8 11 00 00 00       	mov    $0x11,%eax
+  801117:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  801119:	c3                   	ret
+
+000000000080111a <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  80111a:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  80111d:	48 63 f6             	movslq %esi,%rsi
+  801120:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  801123:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801129:	b8 12 00 00 00       	mov    $0x12,%eax
+  80112e:	0f 05                	syscall
+	if(check && ret > 0)
+  801130:	48 85 c0             	test   %rax,%rax
+  801133:	7f 01                	jg     801136 <sys_page_batch+0x1c>
+}
+  801135:	c3                   	ret
+{
+  801136:	55                   	push   %rbp
+  801137:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80113a:	49 89 c0             	mov    %rax,%r8
+  80113d:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801142:	48 ba e8 18 80 00 00 	movabs $0x8018e8,%rdx
+  801149:	00 00 00 
+  80114c:	be 28 00 00 00       	mov    $0x28,%esi
+  801151:	48 bf 05 19 80 00 00 	movabs $0x801905,%rdi
+  801158:	00 00 00 
+  80115b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801160:	49 b9 57 01 80 00 00 	movabs $0x800157,%r9
+  801167:	00 00 00 
+  80116a:	41 ff d1             	call   *%r9
+
+000000000080116d <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  80116d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801173:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801179:	be 00 00 00 00       	mov    $0x0,%esi
+  80117e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801183:	48 89 f2             	mov    %rsi,%rdx
+  801186:	0f 05                	syscall
+	if(check && ret > 0)
+  801188:	48 85 c0             	test   %rax,%rax
+  80118b:	7f 01                	jg     80118e <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  80118d:	c3                   	ret
+{
+  80118e:	55                   	push   %rbp
+  80118f:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801192:	49 89 c0             	mov    %rax,%r8
+  801195:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80119a:	48 ba e8 18 80 00 00 	movabs $0x8018e8,%rdx
+  8011a1:	00 00 00 
+  8011a4:	be 28 00 00 00       	mov    $0x28,%esi
+  8011a9:	48 bf 05 19 80 00 00 	movabs $0x801905,%rdi
+  8011b0:	00 00 00 
+  8011b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b8:	49 b9 57 01 80 00 00 	movabs $0x800157,%r9
+  8011bf:	00 00 00 
+  8011c2:	41 ff d1             	call   *%r9
+
+00000000008011c5 <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  8011c5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011d6:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011db:	48 89 fe             	mov    %rdi,%rsi
+  8011de:	48 89 fa             	mov    %rdi,%rdx
+  8011e1:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8011e3:	c3                   	ret
+
+00000000008011e4 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  8011e4:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8011e7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011f3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011f8:	0f 05                	syscall
+	if(check && ret > 0)
+  8011fa:	48 85 c0             	test   %rax,%rax
+  8011fd:	7f 01                	jg     801200 <sys_page_unmap_range+0x1c>
+}
+  8011ff:	c3                   	ret
+{
+  801200:	55                   	push   %rbp
+  801201:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801204:	49 89 c0             	mov    %rax,%r8
+  801207:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80120c:	48 ba e8 18 80 00 00 	movabs $0x8018e8,%rdx
+  801213:	00 00 00 
+  801216:	be 28 00 00 00       	mov    $0x28,%esi
+  80121b:	48 bf 05 19 80 00 00 	movabs $0x801905,%rdi
+  801222:	00 00 00 
+  801225:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122a:	49 b9 57 01 80 00 00 	movabs $0x800157,%r9
+  801231:	00 00 00 
+  801234:	41 ff d1             	call   *%r9
+
+0000000000801237 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801237:	48 63 f6             	movslq %esi,%rsi
+  80123a:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80123d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801243:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801249:	ba 00 00 00 00       	mov    $0x0,%edx
+  80124e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801253:	0f 05                	syscall
+	if(check && ret > 0)
+  801255:	48 85 c0             	test   %rax,%rax
+  801258:	7f 01                	jg     80125b <sys_env_set_status+0x24>
+}
+  80125a:	c3                   	ret
+{
+  80125b:	55                   	push   %rbp
+  80125c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80125f:	49 89 c0             	mov    %rax,%r8
+  801262:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801267:	48 ba e8 18 80 00 00 	movabs $0x8018e8,%rdx
+  80126e:	00 00 00 
+  801271:	be 28 00 00 00       	mov    $0x28,%esi
+  801276:	48 bf 05 19 80 00 00 	movabs $0x801905,%rdi
+  80127d:	00 00 00 
+  801280:	b8 00 00 00 00       	mov    $0x0,%eax
+  801285:	49 b9 57 01 80 00 00 	movabs $0x800157,%r9
+  80128c:	00 00 00 
+  80128f:	41 ff d1             	call   *%r9
+
+0000000000801292 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  801292:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801295:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80129b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8012a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012ab:	0f 05                	syscall
+	if(check && ret > 0)
+  8012ad:	48 85 c0             	test   %rax,%rax
+  8012b0:	7f 01                	jg     8012b3 <sys_env_set_pgfault_upcall+0x21>
+}
+  8012b2:	c3                   	ret
+{
+  8012b3:	55                   	push   %rbp
+  8012b4:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012b7:	49 89 c0             	mov    %rax,%r8
+  8012ba:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8012bf:	48 ba e8 18 80 00 00 	movabs $0x8018e8,%rdx
+  8012c6:	00 00 00 
+  8012c9:	be 28 00 00 00       	mov    $0x28,%esi
+  8012ce:	48 bf 05 19 80 00 00 	movabs $0x801905,%rdi
+  8012d5:	00 00 00 
+  8012d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012dd:	49 b9 57 01 80 00 00 	movabs $0x800157,%r9
+  8012e4:	00 00 00 
+  8012e7:	41 ff d1             	call   *%r9
+
+00000000008012ea <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8012ea:	48 63 ff             	movslq %edi,%rdi
+  8012ed:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  8012f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8012f6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8012fb:	0f 05                	syscall
+}
+  8012fd:	c3                   	ret
+
+00000000008012fe <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  8012fe:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801304:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80130a:	be 00 00 00 00       	mov    $0x0,%esi
+  80130f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801314:	48 89 f2             	mov    %rsi,%rdx
+  801317:	0f 05                	syscall
+	if(check && ret > 0)
+  801319:	48 85 c0             	test   %rax,%rax
+  80131c:	7f 01                	jg     80131f <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  80131e:	c3                   	ret
+{
+  80131f:	55                   	push   %rbp
+  801320:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801323:	49 89 c0             	mov    %rax,%r8
+  801326:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80132b:	48 ba e8 18 80 00 00 	movabs $0x8018e8,%rdx
+  801332:	00 00 00 
+  801335:	be 28 00 00 00       	mov    $0x28,%esi
+  80133a:	48 bf 05 19 80 00 00 	movabs $0x801905,%rdi
+  801341:	00 00 00 
+  801344:	b8 00 00 00 00       	mov    $0x0,%eax
+  801349:	49 b9 57 01 80 00 00 	movabs $0x800157,%r9
+  801350:	00 00 00 
+  801353:	41 ff d1             	call   *%r9
+
+0000000000801356 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801356:	55                   	push   %rbp
+  801357:	48 89 e5             	mov    %rsp,%rbp
+  80135a:	53                   	push   %rbx
+  80135b:	48 83 ec 08          	sub    $0x8,%rsp
+  80135f:	48 89 fb             	mov    %rdi,%rbx
+	int r;
+
+	if (_pgfault_handler == 0) {
+  801362:	48 ba 08 20 80 00 00 	movabs $0x802008,%rdx
+  801369:	00 00 00 
+  80136c:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801370:	74 13                	je     801385 <set_pgfault_handler+0x2f>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801372:	48 89 d8             	mov    %rbx,%rax
+  801375:	48 a3 08 20 80 00 00 	movabs %rax,0x802008
+  80137c:	00 00 00 
+}
+  80137f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801383:	c9                   	leave
+  801384:	c3                   	ret
+		r = sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801385:	ba 07 00 00 00       	mov    $0x7,%edx
+  80138a:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  80138f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801394:	48 b8 7a 0f 80 00 00 	movabs $0x800f7a,%rax
+  80139b:	00 00 00 
+  80139e:	ff d0                	call   *%rax
+		if (r < 0) {
+  8013a0:	85 c0                	test   %eax,%eax
+  8013a2:	78 4c                	js     8013f0 <set_pgfault_handler+0x9a>
+		r = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8013a4:	48 be 1d 14 80 00 00 	movabs $0x80141d,%rsi
+  8013ab:	00 00 00 
+  8013ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013b3:	48 b8 92 12 80 00 00 	movabs $0x801292,%rax
+  8013ba:	00 00 00 
+  8013bd:	ff d0                	call   *%rax
+		if (r < 0) {
+  8013bf:	85 c0                	test   %eax,%eax
+  8013c1:	79 af                	jns    801372 <set_pgfault_handler+0x1c>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+  8013c3:	89 c1                	mov    %eax,%ecx
+  8013c5:	48 ba 40 19 80 00 00 	movabs $0x801940,%rdx
+  8013cc:	00 00 00 
+  8013cf:	be 2c 00 00 00       	mov    $0x2c,%esi
+  8013d4:	48 bf 2e 19 80 00 00 	movabs $0x80192e,%rdi
+  8013db:	00 00 00 
+  8013de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e3:	49 b8 57 01 80 00 00 	movabs $0x800157,%r8
+  8013ea:	00 00 00 
+  8013ed:	41 ff d0             	call   *%r8
+			panic("sys_page_alloc failed:  %e", r);
+  8013f0:	89 c1                	mov    %eax,%ecx
+  8013f2:	48 ba 13 19 80 00 00 	movabs $0x801913,%rdx
+  8013f9:	00 00 00 
+  8013fc:	be 28 00 00 00       	mov    $0x28,%esi
+  801401:	48 bf 2e 19 80 00 00 	movabs $0x80192e,%rdi
+  801408:	00 00 00 
+  80140b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801410:	49 b8 57 01 80 00 00 	movabs $0x800157,%r8
+  801417:	00 00 00 
+  80141a:	41 ff d0             	call   *%r8
+
+000000000080141d <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi		// function argument: pointer to UTF
+  80141d:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  801420:	48 a1 08 20 80 00 00 	movabs 0x802008,%rax
+  801427:	00 00 00 
+	call *%rax
+  80142a:	ff d0                	call   *%rax
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here. (Hint. You need to modify the trap time rsp to make room for the return rip ) */
+
+	movq  152(%rsp), %rax
+  80142c:	48 8b 84 24 98 00 00 	mov    0x98(%rsp),%rax
+  801433:	00 
+	subq $8, %rax
+  801434:	48 83 e8 08          	sub    $0x8,%rax
+	movq %rax, 152(%rsp)
+  801438:	48 89 84 24 98 00 00 	mov    %rax,0x98(%rsp)
+  80143f:	00 
+
+	movq 136(%rsp), %rbx
+  801440:	48 8b 9c 24 88 00 00 	mov    0x88(%rsp),%rbx
+  801447:	00 
+	movq %rbx, (%rax)
+  801448:	48 89 18             	mov    %rbx,(%rax)
+
+	/* Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here. (Hint, the oposite of _alltraps) */
+
+	addq $16, %rsp
+  80144b:	48 83 c4 10          	add    $0x10,%rsp
+	
+	popq %r15
+  80144f:	41 5f                	pop    %r15
+	popq %r14
+  801451:	41 5e                	pop    %r14
+	popq %r13
+  801453:	41 5d                	pop    %r13
+	popq %r12
+  801455:	41 5c                	pop    %r12
+	popq %r11
+  801457:	41 5b                	pop    %r11
+	popq %r10
+  801459:	41 5a                	pop    %r10
+	popq %r9
+  80145b:	41 59                	pop    %r9
+	popq %r8
+  80145d:	41 58                	pop    %r8
+	popq %rsi
+  80145f:	5e                   	pop    %rsi
+	popq %rdi
+  801460:	5f                   	pop    %rdi
+	popq %rbp
+  801461:	5d                   	pop    %rbp
+	popq %rdx
+  801462:	5a                   	pop    %rdx
+	popq %rcx
+  801463:	59                   	pop    %rcx
+	popq %rbx
+  801464:	5b                   	pop    %rbx
+	popq %rax
+  801465:	58                   	pop    %rax
+
+	addq $8, %rsp
+  801466:	48 83 c4 08          	add    $0x8,%rsp
+	/* Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 4: Your code here. */
+
+	popfq
+  80146a:	9d                   	popf
+
+	/* Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here. */
+
+	popq %rsp
+  80146b:	5c                   	pop    %rsp
+
+	/* Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here. */
+  80146c:	c3                   	ret
@@ -0,0 +1,2260 @@
+
+obj/user/faultbadhandler:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 44 00 00 00       	call   800075 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+	sys_page_alloc(0, (void*) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W);
+  800037:	ba 07 00 00 00       	mov    $0x7,%edx
+  80003c:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  800041:	bf 00 00 00 00       	mov    $0x0,%edi
+  800046:	48 b8 9a 01 80 00 00 	movabs $0x80019a,%rax
+  80004d:	00 00 00 
+  800050:	ff d0                	call   *%rax
+	sys_env_set_pgfault_upcall(0, (void*) 0x6eadBeef);
+  800052:	be ef be ad 6e       	mov    $0x6eadbeef,%esi
+  800057:	bf 00 00 00 00       	mov    $0x0,%edi
+  80005c:	48 b8 b2 04 80 00 00 	movabs $0x8004b2,%rax
+  800063:	00 00 00 
+  800066:	ff d0                	call   *%rax
+	*(int*)0 = 0;
+  800068:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80006f:	00 00 00 00 
+}
+  800073:	5d                   	pop    %rbp
+  800074:	c3                   	ret
+
+0000000000800075 <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  800075:	55                   	push   %rbp
+  800076:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800079:	85 ff                	test   %edi,%edi
+  80007b:	7e 0d                	jle    80008a <libmain+0x15>
+		binaryname = argv[0];
+  80007d:	48 8b 06             	mov    (%rsi),%rax
+  800080:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  800087:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  80008a:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  800091:	00 00 00 
+  800094:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800096:	48 b8 a4 00 80 00 00 	movabs $0x8000a4,%rax
+  80009d:	00 00 00 
+  8000a0:	ff d0                	call   *%rax
+}
+  8000a2:	5d                   	pop    %rbp
+  8000a3:	c3                   	ret
+
+00000000008000a4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000a4:	55                   	push   %rbp
+  8000a5:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  8000a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ad:	48 b8 f3 00 80 00 00 	movabs $0x8000f3,%rax
+  8000b4:	00 00 00 
+  8000b7:	ff d0                	call   *%rax
+}
+  8000b9:	5d                   	pop    %rbp
+  8000ba:	c3                   	ret
+
+00000000008000bb <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  8000bb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  8000c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d1:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  8000d3:	c3                   	ret
+
+00000000008000d4 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  8000d4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8000e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000e5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000ea:	48 89 fe             	mov    %rdi,%rsi
+  8000ed:	48 89 fa             	mov    %rdi,%rdx
+  8000f0:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000f2:	c3                   	ret
+
+00000000008000f3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8000f3:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8000f6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800102:	be 00 00 00 00       	mov    $0x0,%esi
+  800107:	b8 03 00 00 00       	mov    $0x3,%eax
+  80010c:	48 89 f2             	mov    %rsi,%rdx
+  80010f:	0f 05                	syscall
+	if(check && ret > 0)
+  800111:	48 85 c0             	test   %rax,%rax
+  800114:	7f 01                	jg     800117 <sys_env_destroy+0x24>
+}
+  800116:	c3                   	ret
+{
+  800117:	55                   	push   %rbp
+  800118:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80011b:	49 89 c0             	mov    %rax,%r8
+  80011e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800123:	48 ba ca 12 80 00 00 	movabs $0x8012ca,%rdx
+  80012a:	00 00 00 
+  80012d:	be 28 00 00 00       	mov    $0x28,%esi
+  800132:	48 bf e7 12 80 00 00 	movabs $0x8012e7,%rdi
+  800139:	00 00 00 
+  80013c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800141:	49 b9 76 05 80 00 00 	movabs $0x800576,%r9
+  800148:	00 00 00 
+  80014b:	41 ff d1             	call   *%r9
+
+000000000080014e <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  80014e:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800155:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800156:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80015b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80015f:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800163:	48 c1 e2 04          	shl    $0x4,%rdx
+  800167:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  80016e:	00 00 00 
+  800171:	48 01 d0             	add    %rdx,%rax
+  800174:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  80017a:	c3                   	ret
+
+000000000080017b <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  80017b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800181:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800187:	bf 00 00 00 00       	mov    $0x0,%edi
+  80018c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800191:	48 89 fe             	mov    %rdi,%rsi
+  800194:	48 89 fa             	mov    %rdi,%rdx
+  800197:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800199:	c3                   	ret
+
+000000000080019a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  80019a:	48 63 d2             	movslq %edx,%rdx
+  80019d:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8001a0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8001a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8001ac:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001b1:	0f 05                	syscall
+	if(check && ret > 0)
+  8001b3:	48 85 c0             	test   %rax,%rax
+  8001b6:	7f 01                	jg     8001b9 <sys_page_alloc+0x1f>
+}
+  8001b8:	c3                   	ret
+{
+  8001b9:	55                   	push   %rbp
+  8001ba:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001bd:	49 89 c0             	mov    %rax,%r8
+  8001c0:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8001c5:	48 ba ca 12 80 00 00 	movabs $0x8012ca,%rdx
+  8001cc:	00 00 00 
+  8001cf:	be 28 00 00 00       	mov    $0x28,%esi
+  8001d4:	48 bf e7 12 80 00 00 	movabs $0x8012e7,%rdi
+  8001db:	00 00 00 
+  8001de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e3:	49 b9 76 05 80 00 00 	movabs $0x800576,%r9
+  8001ea:	00 00 00 
+  8001ed:	41 ff d1             	call   *%r9
+
+00000000008001f0 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8001f0:	48 63 d2             	movslq %edx,%rdx
+  8001f3:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8001f6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8001fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800202:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800207:	0f 05                	syscall
+	if(check && ret > 0)
+  800209:	48 85 c0             	test   %rax,%rax
+  80020c:	7f 01                	jg     80020f <sys_page_alloc_huge+0x1f>
+}
+  80020e:	c3                   	ret
+{
+  80020f:	55                   	push   %rbp
+  800210:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800213:	49 89 c0             	mov    %rax,%r8
+  800216:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80021b:	48 ba ca 12 80 00 00 	movabs $0x8012ca,%rdx
+  800222:	00 00 00 
+  800225:	be 28 00 00 00       	mov    $0x28,%esi
+  80022a:	48 bf e7 12 80 00 00 	movabs $0x8012e7,%rdi
+  800231:	00 00 00 
+  800234:	b8 00 00 00 00       	mov    $0x0,%eax
+  800239:	49 b9 76 05 80 00 00 	movabs $0x800576,%r9
+  800240:	00 00 00 
+  800243:	41 ff d1             	call   *%r9
+
+0000000000800246 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800246:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  800249:	48 63 d2             	movslq %edx,%rdx
+  80024c:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  80024f:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  800252:	b8 05 00 00 00       	mov    $0x5,%eax
+  800257:	0f 05                	syscall
+	if(check && ret > 0)
+  800259:	48 85 c0             	test   %rax,%rax
+  80025c:	7f 01                	jg     80025f <sys_page_map+0x19>
+}
+  80025e:	c3                   	ret
+{
+  80025f:	55                   	push   %rbp
+  800260:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800263:	49 89 c0             	mov    %rax,%r8
+  800266:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80026b:	48 ba ca 12 80 00 00 	movabs $0x8012ca,%rdx
+  800272:	00 00 00 
+  800275:	be 28 00 00 00       	mov    $0x28,%esi
+  80027a:	48 bf e7 12 80 00 00 	movabs $0x8012e7,%rdi
+  800281:	00 00 00 
+  800284:	b8 00 00 00 00       	mov    $0x0,%eax
+  800289:	49 b9 76 05 80 00 00 	movabs $0x800576,%r9
+  800290:	00 00 00 
+  800293:	41 ff d1             	call   *%r9
+
+0000000000800296 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  800296:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800299:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80029f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002aa:	b8 06 00 00 00       	mov    $0x6,%eax
+  8002af:	0f 05                	syscall
+	if(check && ret > 0)
+  8002b1:	48 85 c0             	test   %rax,%rax
+  8002b4:	7f 01                	jg     8002b7 <sys_page_unmap+0x21>
+}
+  8002b6:	c3                   	ret
+{
+  8002b7:	55                   	push   %rbp
+  8002b8:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002bb:	49 89 c0             	mov    %rax,%r8
+  8002be:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8002c3:	48 ba ca 12 80 00 00 	movabs $0x8012ca,%rdx
+  8002ca:	00 00 00 
+  8002cd:	be 28 00 00 00       	mov    $0x28,%esi
+  8002d2:	48 bf e7 12 80 00 00 	movabs $0x8012e7,%rdi
+  8002d9:	00 00 00 
+  8002dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e1:	49 b9 76 05 80 00 00 	movabs $0x800576,%r9
+  8002e8:	00 00 00 
+  8002eb:	41 ff d1             	call   *%r9
+
+00000000008002ee <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  8002ee:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002ff:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800304:	48 89 fe             	mov    %rdi,%rsi
+  800307:	48 89 fa             	mov    %rdi,%rdx
+  80030a:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80030c:	c3                   	ret
+
+000000000080030d <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  80030d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800313:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800319:	ba 00 00 00 00       	mov    $0x0,%edx
+  80031e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800323:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  800325:	c3                   	ret
+
+0000000000800326 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  800326:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80032c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800332:	b8 11 00 00 00       	mov    $0x11,%eax
+  800337:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  800339:	c3                   	ret
+
+000000000080033a <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  80033a:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  80033d:	48 63 f6             	movslq %esi,%rsi
+  800340:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800343:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800349:	b8 12 00 00 00       	mov    $0x12,%eax
+  80034e:	0f 05                	syscall
+	if(check && ret > 0)
+  800350:	48 85 c0             	test   %rax,%rax
+  800353:	7f 01                	jg     800356 <sys_page_batch+0x1c>
+}
+  800355:	c3                   	ret
+{
+  800356:	55                   	push   %rbp
+  800357:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80035a:	49 89 c0             	mov    %rax,%r8
+  80035d:	b9 12 00 00 00       	mov    $0x12,%ecx
+  800362:	48 ba ca 12 80 00 00 	movabs $0x8012ca,%rdx
+  800369:	00 00 00 
+  80036c:	be 28 00 00 00       	mov    $0x28,%esi
+  800371:	48 bf e7 12 80 00 00 	movabs $0x8012e7,%rdi
+  800378:	00 00 00 
+  80037b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800380:	49 b9 76 05 80 00 00 	movabs $0x800576,%r9
+  800387:	00 00 00 
+  80038a:	41 ff d1             	call   *%r9
+
+000000000080038d <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  80038d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800393:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800399:	be 00 00 00 00       	mov    $0x0,%esi
+  80039e:	b8 13 00 00 00       	mov    $0x13,%eax
+  8003a3:	48 89 f2             	mov    %rsi,%rdx
+  8003a6:	0f 05                	syscall
+	if(check && ret > 0)
+  8003a8:	48 85 c0             	test   %rax,%rax
+  8003ab:	7f 01                	jg     8003ae <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  8003ad:	c3                   	ret
+{
+  8003ae:	55                   	push   %rbp
+  8003af:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003b2:	49 89 c0             	mov    %rax,%r8
+  8003b5:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8003ba:	48 ba ca 12 80 00 00 	movabs $0x8012ca,%rdx
+  8003c1:	00 00 00 
+  8003c4:	be 28 00 00 00       	mov    $0x28,%esi
+  8003c9:	48 bf e7 12 80 00 00 	movabs $0x8012e7,%rdi
+  8003d0:	00 00 00 
+  8003d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d8:	49 b9 76 05 80 00 00 	movabs $0x800576,%r9
+  8003df:	00 00 00 
+  8003e2:	41 ff d1             	call   *%r9
+
+00000000008003e5 <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  8003e5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8003eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8003f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003f6:	b8 14 00 00 00       	mov    $0x14,%eax
+  8003fb:	48 89 fe             	mov    %rdi,%rsi
+  8003fe:	48 89 fa             	mov    %rdi,%rdx
+  800401:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  800403:	c3                   	ret
+
+0000000000800404 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  800404:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800407:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80040d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800413:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800418:	0f 05                	syscall
+	if(check && ret > 0)
+  80041a:	48 85 c0             	test   %rax,%rax
+  80041d:	7f 01                	jg     800420 <sys_page_unmap_range+0x1c>
+}
+  80041f:	c3                   	ret
+{
+  800420:	55                   	push   %rbp
+  800421:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800424:	49 89 c0             	mov    %rax,%r8
+  800427:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80042c:	48 ba ca 12 80 00 00 	movabs $0x8012ca,%rdx
+  800433:	00 00 00 
+  800436:	be 28 00 00 00       	mov    $0x28,%esi
+  80043b:	48 bf e7 12 80 00 00 	movabs $0x8012e7,%rdi
+  800442:	00 00 00 
+  800445:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044a:	49 b9 76 05 80 00 00 	movabs $0x800576,%r9
+  800451:	00 00 00 
+  800454:	41 ff d1             	call   *%r9
+
+0000000000800457 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  800457:	48 63 f6             	movslq %esi,%rsi
+  80045a:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80045d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800463:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800469:	ba 00 00 00 00       	mov    $0x0,%edx
+  80046e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800473:	0f 05                	syscall
+	if(check && ret > 0)
+  800475:	48 85 c0             	test   %rax,%rax
+  800478:	7f 01                	jg     80047b <sys_env_set_status+0x24>
+}
+  80047a:	c3                   	ret
+{
+  80047b:	55                   	push   %rbp
+  80047c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80047f:	49 89 c0             	mov    %rax,%r8
+  800482:	b9 08 00 00 00       	mov    $0x8,%ecx
+  800487:	48 ba ca 12 80 00 00 	movabs $0x8012ca,%rdx
+  80048e:	00 00 00 
+  800491:	be 28 00 00 00       	mov    $0x28,%esi
+  800496:	48 bf e7 12 80 00 00 	movabs $0x8012e7,%rdi
+  80049d:	00 00 00 
+  8004a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a5:	49 b9 76 05 80 00 00 	movabs $0x800576,%r9
+  8004ac:	00 00 00 
+  8004af:	41 ff d1             	call   *%r9
+
+00000000008004b2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8004b2:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8004b5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8004bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8004c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004c6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8004cb:	0f 05                	syscall
+	if(check && ret > 0)
+  8004cd:	48 85 c0             	test   %rax,%rax
+  8004d0:	7f 01                	jg     8004d3 <sys_env_set_pgfault_upcall+0x21>
+}
+  8004d2:	c3                   	ret
+{
+  8004d3:	55                   	push   %rbp
+  8004d4:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004d7:	49 89 c0             	mov    %rax,%r8
+  8004da:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004df:	48 ba ca 12 80 00 00 	movabs $0x8012ca,%rdx
+  8004e6:	00 00 00 
+  8004e9:	be 28 00 00 00       	mov    $0x28,%esi
+  8004ee:	48 bf e7 12 80 00 00 	movabs $0x8012e7,%rdi
+  8004f5:	00 00 00 
+  8004f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fd:	49 b9 76 05 80 00 00 	movabs $0x800576,%r9
+  800504:	00 00 00 
+  800507:	41 ff d1             	call   *%r9
+
+000000000080050a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80050a:	48 63 ff             	movslq %edi,%rdi
+  80050d:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  800510:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800516:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80051b:	0f 05                	syscall
+}
+  80051d:	c3                   	ret
+
+000000000080051e <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  80051e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800524:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80052a:	be 00 00 00 00       	mov    $0x0,%esi
+  80052f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800534:	48 89 f2             	mov    %rsi,%rdx
+  800537:	0f 05                	syscall
+	if(check && ret > 0)
+  800539:	48 85 c0             	test   %rax,%rax
+  80053c:	7f 01                	jg     80053f <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  80053e:	c3                   	ret
+{
+  80053f:	55                   	push   %rbp
+  800540:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800543:	49 89 c0             	mov    %rax,%r8
+  800546:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80054b:	48 ba ca 12 80 00 00 	movabs $0x8012ca,%rdx
+  800552:	00 00 00 
+  800555:	be 28 00 00 00       	mov    $0x28,%esi
+  80055a:	48 bf e7 12 80 00 00 	movabs $0x8012e7,%rdi
+  800561:	00 00 00 
+  800564:	b8 00 00 00 00       	mov    $0x0,%eax
+  800569:	49 b9 76 05 80 00 00 	movabs $0x800576,%r9
+  800570:	00 00 00 
+  800573:	41 ff d1             	call   *%r9
+
+0000000000800576 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800576:	55                   	push   %rbp
+  800577:	48 89 e5             	mov    %rsp,%rbp
+  80057a:	41 56                	push   %r14
+  80057c:	41 55                	push   %r13
+  80057e:	41 54                	push   %r12
+  800580:	53                   	push   %rbx
+  800581:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800588:	49 89 fc             	mov    %rdi,%r12
+  80058b:	41 89 f5             	mov    %esi,%r13d
+  80058e:	48 89 d3             	mov    %rdx,%rbx
+  800591:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800598:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80059f:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8005a6:	84 c0                	test   %al,%al
+  8005a8:	74 26                	je     8005d0 <_panic+0x5a>
+  8005aa:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8005b1:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8005b8:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8005bc:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8005c0:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8005c4:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8005c8:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8005cc:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8005d0:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8005d7:	00 00 00 
+  8005da:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8005e1:	00 00 00 
+  8005e4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005e8:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8005ef:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8005f6:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005fd:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  800604:	00 00 00 
+  800607:	4c 8b 30             	mov    (%rax),%r14
+  80060a:	48 b8 4e 01 80 00 00 	movabs $0x80014e,%rax
+  800611:	00 00 00 
+  800614:	ff d0                	call   *%rax
+  800616:	89 c6                	mov    %eax,%esi
+  800618:	45 89 e8             	mov    %r13d,%r8d
+  80061b:	4c 89 e1             	mov    %r12,%rcx
+  80061e:	4c 89 f2             	mov    %r14,%rdx
+  800621:	48 bf f8 12 80 00 00 	movabs $0x8012f8,%rdi
+  800628:	00 00 00 
+  80062b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800630:	49 bc 15 07 80 00 00 	movabs $0x800715,%r12
+  800637:	00 00 00 
+  80063a:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80063d:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  800644:	48 89 df             	mov    %rbx,%rdi
+  800647:	48 b8 b1 06 80 00 00 	movabs $0x8006b1,%rax
+  80064e:	00 00 00 
+  800651:	ff d0                	call   *%rax
+	cprintf("\n");
+  800653:	48 bf 1b 13 80 00 00 	movabs $0x80131b,%rdi
+  80065a:	00 00 00 
+  80065d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800662:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800665:	cc                   	int3
+	while (1)
+  800666:	eb fd                	jmp    800665 <_panic+0xef>
+
+0000000000800668 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800668:	55                   	push   %rbp
+  800669:	48 89 e5             	mov    %rsp,%rbp
+  80066c:	53                   	push   %rbx
+  80066d:	48 83 ec 08          	sub    $0x8,%rsp
+  800671:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  800674:	8b 06                	mov    (%rsi),%eax
+  800676:	8d 50 01             	lea    0x1(%rax),%edx
+  800679:	89 16                	mov    %edx,(%rsi)
+  80067b:	48 98                	cltq
+  80067d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  800682:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800688:	74 0a                	je     800694 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80068a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80068e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800692:	c9                   	leave
+  800693:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800694:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800698:	be ff 00 00 00       	mov    $0xff,%esi
+  80069d:	48 b8 bb 00 80 00 00 	movabs $0x8000bb,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+		b->idx = 0;
+  8006a9:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8006af:	eb d9                	jmp    80068a <putch+0x22>
+
+00000000008006b1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8006b1:	55                   	push   %rbp
+  8006b2:	48 89 e5             	mov    %rsp,%rbp
+  8006b5:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8006bc:	48 89 fa             	mov    %rdi,%rdx
+  8006bf:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  8006c2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8006c9:	00 00 00 
+	b.cnt = 0;
+  8006cc:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8006d3:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8006d6:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  8006dd:	48 bf 68 06 80 00 00 	movabs $0x800668,%rdi
+  8006e4:	00 00 00 
+  8006e7:	48 b8 cf 08 80 00 00 	movabs $0x8008cf,%rax
+  8006ee:	00 00 00 
+  8006f1:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8006f3:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  8006fa:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800701:	48 b8 bb 00 80 00 00 	movabs $0x8000bb,%rax
+  800708:	00 00 00 
+  80070b:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  80070d:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  800713:	c9                   	leave
+  800714:	c3                   	ret
+
+0000000000800715 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800715:	55                   	push   %rbp
+  800716:	48 89 e5             	mov    %rsp,%rbp
+  800719:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800720:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800727:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80072e:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800735:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80073c:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800743:	84 c0                	test   %al,%al
+  800745:	74 20                	je     800767 <cprintf+0x52>
+  800747:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80074b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80074f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800753:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800757:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80075b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80075f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800763:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800767:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  80076e:	00 00 00 
+  800771:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800778:	00 00 00 
+  80077b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80077f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800786:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80078d:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  800794:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  80079b:	48 b8 b1 06 80 00 00 	movabs $0x8006b1,%rax
+  8007a2:	00 00 00 
+  8007a5:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  8007a7:	c9                   	leave
+  8007a8:	c3                   	ret
+
+00000000008007a9 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8007a9:	55                   	push   %rbp
+  8007aa:	48 89 e5             	mov    %rsp,%rbp
+  8007ad:	41 57                	push   %r15
+  8007af:	41 56                	push   %r14
+  8007b1:	41 55                	push   %r13
+  8007b3:	41 54                	push   %r12
+  8007b5:	53                   	push   %rbx
+  8007b6:	48 83 ec 18          	sub    $0x18,%rsp
+  8007ba:	49 89 fc             	mov    %rdi,%r12
+  8007bd:	49 89 f5             	mov    %rsi,%r13
+  8007c0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8007c4:	44 89 c3             	mov    %r8d,%ebx
+  8007c7:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8007ca:	41 89 cf             	mov    %ecx,%r15d
+  8007cd:	4c 39 fa             	cmp    %r15,%rdx
+  8007d0:	72 29                	jb     8007fb <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8007d2:	48 89 d0             	mov    %rdx,%rax
+  8007d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007da:	49 f7 f7             	div    %r15
+  8007dd:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8007e1:	48 89 c2             	mov    %rax,%rdx
+  8007e4:	48 b8 a9 07 80 00 00 	movabs $0x8007a9,%rax
+  8007eb:	00 00 00 
+  8007ee:	ff d0                	call   *%rax
+  8007f0:	eb 10                	jmp    800802 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8007f2:	4c 89 ee             	mov    %r13,%rsi
+  8007f5:	44 89 f7             	mov    %r14d,%edi
+  8007f8:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  8007fb:	83 eb 01             	sub    $0x1,%ebx
+  8007fe:	85 db                	test   %ebx,%ebx
+  800800:	7f f0                	jg     8007f2 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800802:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800806:	ba 00 00 00 00       	mov    $0x0,%edx
+  80080b:	49 f7 f7             	div    %r15
+  80080e:	48 b8 1d 13 80 00 00 	movabs $0x80131d,%rax
+  800815:	00 00 00 
+  800818:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  80081c:	4c 89 ee             	mov    %r13,%rsi
+  80081f:	41 ff d4             	call   *%r12
+}
+  800822:	48 83 c4 18          	add    $0x18,%rsp
+  800826:	5b                   	pop    %rbx
+  800827:	41 5c                	pop    %r12
+  800829:	41 5d                	pop    %r13
+  80082b:	41 5e                	pop    %r14
+  80082d:	41 5f                	pop    %r15
+  80082f:	5d                   	pop    %rbp
+  800830:	c3                   	ret
+
+0000000000800831 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  800831:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  800835:	48 8b 06             	mov    (%rsi),%rax
+  800838:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80083c:	73 0a                	jae    800848 <sprintputch+0x17>
+		*b->buf++ = ch;
+  80083e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800842:	48 89 16             	mov    %rdx,(%rsi)
+  800845:	40 88 38             	mov    %dil,(%rax)
+}
+  800848:	c3                   	ret
+
+0000000000800849 <printfmt>:
+{
+  800849:	55                   	push   %rbp
+  80084a:	48 89 e5             	mov    %rsp,%rbp
+  80084d:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800854:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80085b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800862:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800869:	84 c0                	test   %al,%al
+  80086b:	74 20                	je     80088d <printfmt+0x44>
+  80086d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800871:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800875:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800879:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80087d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800881:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800885:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800889:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  80088d:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800894:	00 00 00 
+  800897:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80089e:	00 00 00 
+  8008a1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8008a5:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8008ac:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8008b3:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8008ba:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8008c1:	48 b8 cf 08 80 00 00 	movabs $0x8008cf,%rax
+  8008c8:	00 00 00 
+  8008cb:	ff d0                	call   *%rax
+}
+  8008cd:	c9                   	leave
+  8008ce:	c3                   	ret
+
+00000000008008cf <vprintfmt>:
+{
+  8008cf:	55                   	push   %rbp
+  8008d0:	48 89 e5             	mov    %rsp,%rbp
+  8008d3:	41 57                	push   %r15
+  8008d5:	41 56                	push   %r14
+  8008d7:	41 55                	push   %r13
+  8008d9:	41 54                	push   %r12
+  8008db:	53                   	push   %rbx
+  8008dc:	48 83 ec 48          	sub    $0x48,%rsp
+  8008e0:	49 89 fe             	mov    %rdi,%r14
+  8008e3:	49 89 f5             	mov    %rsi,%r13
+  8008e6:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  8008e9:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  8008ed:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  8008f1:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8008f5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8008f9:	eb 09                	jmp    800904 <vprintfmt+0x35>
+			putch(ch, putdat);
+  8008fb:	4c 89 ee             	mov    %r13,%rsi
+  8008fe:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800901:	4c 89 e3             	mov    %r12,%rbx
+  800904:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800908:	0f b6 3b             	movzbl (%rbx),%edi
+  80090b:	83 ff 25             	cmp    $0x25,%edi
+  80090e:	74 13                	je     800923 <vprintfmt+0x54>
+			if (ch == '\0')
+  800910:	85 ff                	test   %edi,%edi
+  800912:	75 e7                	jne    8008fb <vprintfmt+0x2c>
+}
+  800914:	48 83 c4 48          	add    $0x48,%rsp
+  800918:	5b                   	pop    %rbx
+  800919:	41 5c                	pop    %r12
+  80091b:	41 5d                	pop    %r13
+  80091d:	41 5e                	pop    %r14
+  80091f:	41 5f                	pop    %r15
+  800921:	5d                   	pop    %rbp
+  800922:	c3                   	ret
+		padc = ' ';
+  800923:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  800927:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  80092e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  800934:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  80093b:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800940:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800945:	41 0f b6 14 24       	movzbl (%r12),%edx
+  80094a:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  80094d:	3c 55                	cmp    $0x55,%al
+  80094f:	0f 87 4f 05 00 00    	ja     800ea4 <vprintfmt+0x5d5>
+  800955:	0f b6 c0             	movzbl %al,%eax
+  800958:	48 be e0 13 80 00 00 	movabs $0x8013e0,%rsi
+  80095f:	00 00 00 
+  800962:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  800965:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  800968:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  80096c:	eb d2                	jmp    800940 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  80096e:	49 89 dc             	mov    %rbx,%r12
+  800971:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  800975:	eb c9                	jmp    800940 <vprintfmt+0x71>
+  800977:	0f b6 d2             	movzbl %dl,%edx
+  80097a:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  80097d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  800983:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800987:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  80098c:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  800991:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  800994:	83 f8 09             	cmp    $0x9,%eax
+  800997:	77 20                	ja     8009b9 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  800999:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  80099d:	eb e4                	jmp    800983 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  80099f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a5:	77 27                	ja     8009ce <vprintfmt+0xff>
+  8009a7:	89 c2                	mov    %eax,%edx
+  8009a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ad:	83 c0 08             	add    $0x8,%eax
+  8009b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b3:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  8009b6:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  8009b9:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009bd:	79 81                	jns    800940 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  8009bf:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  8009c3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8009c9:	e9 72 ff ff ff       	jmp    800940 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  8009ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009da:	eb d7                	jmp    8009b3 <vprintfmt+0xe4>
+			if (width < 0)
+  8009dc:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  8009df:	85 f6                	test   %esi,%esi
+  8009e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e6:	0f 49 c6             	cmovns %esi,%eax
+  8009e9:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8009ec:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8009ef:	e9 4c ff ff ff       	jmp    800940 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8009f4:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  8009f7:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  8009fe:	e9 3d ff ff ff       	jmp    800940 <vprintfmt+0x71>
+			lflag++;
+  800a03:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800a06:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800a09:	e9 32 ff ff ff       	jmp    800940 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  800a0e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a11:	83 f8 2f             	cmp    $0x2f,%eax
+  800a14:	77 19                	ja     800a2f <vprintfmt+0x160>
+  800a16:	89 c2                	mov    %eax,%edx
+  800a18:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1c:	83 c0 08             	add    $0x8,%eax
+  800a1f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a22:	8b 3a                	mov    (%rdx),%edi
+  800a24:	4c 89 ee             	mov    %r13,%rsi
+  800a27:	41 ff d6             	call   *%r14
+			break;
+  800a2a:	e9 d5 fe ff ff       	jmp    800904 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  800a2f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a33:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a37:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3b:	eb e5                	jmp    800a22 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  800a3d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a40:	83 f8 2f             	cmp    $0x2f,%eax
+  800a43:	77 5a                	ja     800a9f <vprintfmt+0x1d0>
+  800a45:	89 c2                	mov    %eax,%edx
+  800a47:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a4b:	83 c0 08             	add    $0x8,%eax
+  800a4e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800a51:	8b 02                	mov    (%rdx),%eax
+  800a53:	89 c1                	mov    %eax,%ecx
+  800a55:	f7 d9                	neg    %ecx
+  800a57:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a5a:	83 f9 08             	cmp    $0x8,%ecx
+  800a5d:	7f 4e                	jg     800aad <vprintfmt+0x1de>
+  800a5f:	48 63 c1             	movslq %ecx,%rax
+  800a62:	48 ba a0 16 80 00 00 	movabs $0x8016a0,%rdx
+  800a69:	00 00 00 
+  800a6c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800a70:	48 85 c0             	test   %rax,%rax
+  800a73:	74 38                	je     800aad <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800a75:	48 89 c1             	mov    %rax,%rcx
+  800a78:	48 ba 3e 13 80 00 00 	movabs $0x80133e,%rdx
+  800a7f:	00 00 00 
+  800a82:	4c 89 ee             	mov    %r13,%rsi
+  800a85:	4c 89 f7             	mov    %r14,%rdi
+  800a88:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8d:	49 b8 49 08 80 00 00 	movabs $0x800849,%r8
+  800a94:	00 00 00 
+  800a97:	41 ff d0             	call   *%r8
+  800a9a:	e9 65 fe ff ff       	jmp    800904 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  800a9f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aab:	eb a4                	jmp    800a51 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  800aad:	48 ba 35 13 80 00 00 	movabs $0x801335,%rdx
+  800ab4:	00 00 00 
+  800ab7:	4c 89 ee             	mov    %r13,%rsi
+  800aba:	4c 89 f7             	mov    %r14,%rdi
+  800abd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac2:	49 b8 49 08 80 00 00 	movabs $0x800849,%r8
+  800ac9:	00 00 00 
+  800acc:	41 ff d0             	call   *%r8
+  800acf:	e9 30 fe ff ff       	jmp    800904 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800ad4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad7:	83 f8 2f             	cmp    $0x2f,%eax
+  800ada:	77 36                	ja     800b12 <vprintfmt+0x243>
+  800adc:	89 c2                	mov    %eax,%edx
+  800ade:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae2:	83 c0 08             	add    $0x8,%eax
+  800ae5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae8:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800aeb:	48 85 c9             	test   %rcx,%rcx
+  800aee:	48 b8 2e 13 80 00 00 	movabs $0x80132e,%rax
+  800af5:	00 00 00 
+  800af8:	48 0f 45 c1          	cmovne %rcx,%rax
+  800afc:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800b00:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b04:	7e 06                	jle    800b0c <vprintfmt+0x23d>
+  800b06:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800b0a:	75 14                	jne    800b20 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b0c:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800b10:	eb 64                	jmp    800b76 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800b12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b1e:	eb c8                	jmp    800ae8 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b20:	49 63 f7             	movslq %r15d,%rsi
+  800b23:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800b27:	48 b8 b2 0f 80 00 00 	movabs $0x800fb2,%rax
+  800b2e:	00 00 00 
+  800b31:	ff d0                	call   *%rax
+  800b33:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800b36:	29 c1                	sub    %eax,%ecx
+  800b38:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800b3b:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  800b3e:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800b42:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b45:	eb 0d                	jmp    800b54 <vprintfmt+0x285>
+					putch(padc, putdat);
+  800b47:	4c 89 ee             	mov    %r13,%rsi
+  800b4a:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  800b4d:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b50:	41 83 ec 01          	sub    $0x1,%r12d
+  800b54:	45 85 e4             	test   %r12d,%r12d
+  800b57:	7f ee                	jg     800b47 <vprintfmt+0x278>
+  800b59:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  800b5c:	85 c9                	test   %ecx,%ecx
+  800b5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b63:	0f 49 c1             	cmovns %ecx,%eax
+  800b66:	29 c1                	sub    %eax,%ecx
+  800b68:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  800b6b:	eb 9f                	jmp    800b0c <vprintfmt+0x23d>
+					putch(ch, putdat);
+  800b6d:	4c 89 ee             	mov    %r13,%rsi
+  800b70:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b73:	4c 89 e2             	mov    %r12,%rdx
+  800b76:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800b7a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800b80:	0f be f8             	movsbl %al,%edi
+  800b83:	85 ff                	test   %edi,%edi
+  800b85:	74 29                	je     800bb0 <vprintfmt+0x2e1>
+  800b87:	45 85 ff             	test   %r15d,%r15d
+  800b8a:	78 06                	js     800b92 <vprintfmt+0x2c3>
+  800b8c:	41 83 ef 01          	sub    $0x1,%r15d
+  800b90:	78 1e                	js     800bb0 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b92:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800b96:	74 d5                	je     800b6d <vprintfmt+0x29e>
+  800b98:	0f be c0             	movsbl %al,%eax
+  800b9b:	83 e8 20             	sub    $0x20,%eax
+  800b9e:	83 f8 5e             	cmp    $0x5e,%eax
+  800ba1:	76 ca                	jbe    800b6d <vprintfmt+0x29e>
+					putch('?', putdat);
+  800ba3:	4c 89 ee             	mov    %r13,%rsi
+  800ba6:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800bab:	41 ff d6             	call   *%r14
+  800bae:	eb c3                	jmp    800b73 <vprintfmt+0x2a4>
+  800bb0:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800bb4:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800bb7:	41 01 c4             	add    %eax,%r12d
+  800bba:	41 29 d4             	sub    %edx,%r12d
+  800bbd:	eb 0f                	jmp    800bce <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  800bbf:	4c 89 ee             	mov    %r13,%rsi
+  800bc2:	bf 20 00 00 00       	mov    $0x20,%edi
+  800bc7:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800bca:	41 83 ec 01          	sub    $0x1,%r12d
+  800bce:	45 85 e4             	test   %r12d,%r12d
+  800bd1:	7f ec                	jg     800bbf <vprintfmt+0x2f0>
+  800bd3:	e9 2c fd ff ff       	jmp    800904 <vprintfmt+0x35>
+	if (lflag >= 2)
+  800bd8:	83 f9 01             	cmp    $0x1,%ecx
+  800bdb:	7f 1d                	jg     800bfa <vprintfmt+0x32b>
+	else if (lflag)
+  800bdd:	85 c9                	test   %ecx,%ecx
+  800bdf:	74 5e                	je     800c3f <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800be1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be4:	83 f8 2f             	cmp    $0x2f,%eax
+  800be7:	77 48                	ja     800c31 <vprintfmt+0x362>
+  800be9:	89 c2                	mov    %eax,%edx
+  800beb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bef:	83 c0 08             	add    $0x8,%eax
+  800bf2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf5:	4c 8b 22             	mov    (%rdx),%r12
+  800bf8:	eb 17                	jmp    800c11 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800bfa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bfd:	83 f8 2f             	cmp    $0x2f,%eax
+  800c00:	77 21                	ja     800c23 <vprintfmt+0x354>
+  800c02:	89 c2                	mov    %eax,%edx
+  800c04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c08:	83 c0 08             	add    $0x8,%eax
+  800c0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c0e:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800c11:	4d 85 e4             	test   %r12,%r12
+  800c14:	78 50                	js     800c66 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  800c16:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800c19:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800c1e:	e9 b4 01 00 00       	jmp    800dd7 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800c23:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c27:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c2f:	eb dd                	jmp    800c0e <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800c31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3d:	eb b6                	jmp    800bf5 <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800c3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c42:	83 f8 2f             	cmp    $0x2f,%eax
+  800c45:	77 11                	ja     800c58 <vprintfmt+0x389>
+  800c47:	89 c2                	mov    %eax,%edx
+  800c49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c4d:	83 c0 08             	add    $0x8,%eax
+  800c50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c53:	4c 63 22             	movslq (%rdx),%r12
+  800c56:	eb b9                	jmp    800c11 <vprintfmt+0x342>
+  800c58:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c5c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c64:	eb ed                	jmp    800c53 <vprintfmt+0x384>
+				putch('-', putdat);
+  800c66:	4c 89 ee             	mov    %r13,%rsi
+  800c69:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c6e:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800c71:	4c 89 e2             	mov    %r12,%rdx
+  800c74:	48 f7 da             	neg    %rdx
+			base = 10;
+  800c77:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800c7c:	e9 56 01 00 00       	jmp    800dd7 <vprintfmt+0x508>
+	if (lflag >= 2)
+  800c81:	83 f9 01             	cmp    $0x1,%ecx
+  800c84:	7f 25                	jg     800cab <vprintfmt+0x3dc>
+	else if (lflag)
+  800c86:	85 c9                	test   %ecx,%ecx
+  800c88:	74 5e                	je     800ce8 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800c8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c90:	77 48                	ja     800cda <vprintfmt+0x40b>
+  800c92:	89 c2                	mov    %eax,%edx
+  800c94:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c98:	83 c0 08             	add    $0x8,%eax
+  800c9b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c9e:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800ca1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800ca6:	e9 2c 01 00 00       	jmp    800dd7 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800cab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cae:	83 f8 2f             	cmp    $0x2f,%eax
+  800cb1:	77 19                	ja     800ccc <vprintfmt+0x3fd>
+  800cb3:	89 c2                	mov    %eax,%edx
+  800cb5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb9:	83 c0 08             	add    $0x8,%eax
+  800cbc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cbf:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800cc2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800cc7:	e9 0b 01 00 00       	jmp    800dd7 <vprintfmt+0x508>
+  800ccc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cd0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cd4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd8:	eb e5                	jmp    800cbf <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800cda:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cde:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ce2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ce6:	eb b6                	jmp    800c9e <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800ce8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ceb:	83 f8 2f             	cmp    $0x2f,%eax
+  800cee:	77 18                	ja     800d08 <vprintfmt+0x439>
+  800cf0:	89 c2                	mov    %eax,%edx
+  800cf2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cf6:	83 c0 08             	add    $0x8,%eax
+  800cf9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cfc:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800cfe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800d03:	e9 cf 00 00 00       	jmp    800dd7 <vprintfmt+0x508>
+  800d08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d14:	eb e6                	jmp    800cfc <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800d16:	83 f9 01             	cmp    $0x1,%ecx
+  800d19:	7f 25                	jg     800d40 <vprintfmt+0x471>
+	else if (lflag)
+  800d1b:	85 c9                	test   %ecx,%ecx
+  800d1d:	74 5b                	je     800d7a <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800d1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d22:	83 f8 2f             	cmp    $0x2f,%eax
+  800d25:	77 45                	ja     800d6c <vprintfmt+0x49d>
+  800d27:	89 c2                	mov    %eax,%edx
+  800d29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d2d:	83 c0 08             	add    $0x8,%eax
+  800d30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d33:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800d36:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800d3b:	e9 97 00 00 00       	jmp    800dd7 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800d40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d43:	83 f8 2f             	cmp    $0x2f,%eax
+  800d46:	77 16                	ja     800d5e <vprintfmt+0x48f>
+  800d48:	89 c2                	mov    %eax,%edx
+  800d4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d4e:	83 c0 08             	add    $0x8,%eax
+  800d51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d54:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800d57:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800d5c:	eb 79                	jmp    800dd7 <vprintfmt+0x508>
+  800d5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d62:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d6a:	eb e8                	jmp    800d54 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800d6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d70:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d78:	eb b9                	jmp    800d33 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800d7a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d7d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d80:	77 15                	ja     800d97 <vprintfmt+0x4c8>
+  800d82:	89 c2                	mov    %eax,%edx
+  800d84:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d88:	83 c0 08             	add    $0x8,%eax
+  800d8b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d8e:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800d90:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800d95:	eb 40                	jmp    800dd7 <vprintfmt+0x508>
+  800d97:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d9b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800da3:	eb e9                	jmp    800d8e <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800da5:	4c 89 ee             	mov    %r13,%rsi
+  800da8:	bf 30 00 00 00       	mov    $0x30,%edi
+  800dad:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800db0:	4c 89 ee             	mov    %r13,%rsi
+  800db3:	bf 78 00 00 00       	mov    $0x78,%edi
+  800db8:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800dbb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dbe:	83 f8 2f             	cmp    $0x2f,%eax
+  800dc1:	77 34                	ja     800df7 <vprintfmt+0x528>
+  800dc3:	89 c2                	mov    %eax,%edx
+  800dc5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dc9:	83 c0 08             	add    $0x8,%eax
+  800dcc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800dcf:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800dd2:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800dd7:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800ddc:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800de0:	4c 89 ee             	mov    %r13,%rsi
+  800de3:	4c 89 f7             	mov    %r14,%rdi
+  800de6:	48 b8 a9 07 80 00 00 	movabs $0x8007a9,%rax
+  800ded:	00 00 00 
+  800df0:	ff d0                	call   *%rax
+			break;
+  800df2:	e9 0d fb ff ff       	jmp    800904 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800df7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dfb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e03:	eb ca                	jmp    800dcf <vprintfmt+0x500>
+	if (lflag >= 2)
+  800e05:	83 f9 01             	cmp    $0x1,%ecx
+  800e08:	7f 22                	jg     800e2c <vprintfmt+0x55d>
+	else if (lflag)
+  800e0a:	85 c9                	test   %ecx,%ecx
+  800e0c:	74 58                	je     800e66 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800e0e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e11:	83 f8 2f             	cmp    $0x2f,%eax
+  800e14:	77 42                	ja     800e58 <vprintfmt+0x589>
+  800e16:	89 c2                	mov    %eax,%edx
+  800e18:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e1c:	83 c0 08             	add    $0x8,%eax
+  800e1f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e22:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800e25:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800e2a:	eb ab                	jmp    800dd7 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800e2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e2f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e32:	77 16                	ja     800e4a <vprintfmt+0x57b>
+  800e34:	89 c2                	mov    %eax,%edx
+  800e36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e3a:	83 c0 08             	add    $0x8,%eax
+  800e3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e40:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800e43:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800e48:	eb 8d                	jmp    800dd7 <vprintfmt+0x508>
+  800e4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e56:	eb e8                	jmp    800e40 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800e58:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e5c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e64:	eb bc                	jmp    800e22 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800e66:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e69:	83 f8 2f             	cmp    $0x2f,%eax
+  800e6c:	77 18                	ja     800e86 <vprintfmt+0x5b7>
+  800e6e:	89 c2                	mov    %eax,%edx
+  800e70:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e74:	83 c0 08             	add    $0x8,%eax
+  800e77:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e7a:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800e7c:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800e81:	e9 51 ff ff ff       	jmp    800dd7 <vprintfmt+0x508>
+  800e86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e92:	eb e6                	jmp    800e7a <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800e94:	4c 89 ee             	mov    %r13,%rsi
+  800e97:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e9c:	41 ff d6             	call   *%r14
+			break;
+  800e9f:	e9 60 fa ff ff       	jmp    800904 <vprintfmt+0x35>
+			putch('%', putdat);
+  800ea4:	4c 89 ee             	mov    %r13,%rsi
+  800ea7:	bf 25 00 00 00       	mov    $0x25,%edi
+  800eac:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800eaf:	4c 89 e3             	mov    %r12,%rbx
+  800eb2:	eb 04                	jmp    800eb8 <vprintfmt+0x5e9>
+  800eb4:	48 83 eb 01          	sub    $0x1,%rbx
+  800eb8:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ebc:	75 f6                	jne    800eb4 <vprintfmt+0x5e5>
+  800ebe:	e9 41 fa ff ff       	jmp    800904 <vprintfmt+0x35>
+
+0000000000800ec3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800ec3:	55                   	push   %rbp
+  800ec4:	48 89 e5             	mov    %rsp,%rbp
+  800ec7:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800ecb:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800ecf:	48 63 c6             	movslq %esi,%rax
+  800ed2:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800ed7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800edb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800ee2:	48 85 ff             	test   %rdi,%rdi
+  800ee5:	74 2a                	je     800f11 <vsnprintf+0x4e>
+  800ee7:	85 f6                	test   %esi,%esi
+  800ee9:	7e 26                	jle    800f11 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800eeb:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800eef:	48 bf 31 08 80 00 00 	movabs $0x800831,%rdi
+  800ef6:	00 00 00 
+  800ef9:	48 b8 cf 08 80 00 00 	movabs $0x8008cf,%rax
+  800f00:	00 00 00 
+  800f03:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800f05:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800f09:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800f0c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800f0f:	c9                   	leave
+  800f10:	c3                   	ret
+		return -E_INVAL;
+  800f11:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f16:	eb f7                	jmp    800f0f <vsnprintf+0x4c>
+
+0000000000800f18 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800f18:	55                   	push   %rbp
+  800f19:	48 89 e5             	mov    %rsp,%rbp
+  800f1c:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800f23:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f2a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f31:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f38:	84 c0                	test   %al,%al
+  800f3a:	74 20                	je     800f5c <snprintf+0x44>
+  800f3c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f40:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f44:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f48:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f4c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f50:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f54:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f58:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800f5c:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f63:	00 00 00 
+  800f66:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f6d:	00 00 00 
+  800f70:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f74:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800f7b:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f82:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800f89:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800f90:	48 b8 c3 0e 80 00 00 	movabs $0x800ec3,%rax
+  800f97:	00 00 00 
+  800f9a:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800f9c:	c9                   	leave
+  800f9d:	c3                   	ret
+
+0000000000800f9e <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800f9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa3:	48 89 d0             	mov    %rdx,%rax
+  800fa6:	48 83 c2 01          	add    $0x1,%rdx
+  800faa:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800faf:	75 f2                	jne    800fa3 <strlen+0x5>
+		n++;
+	return n;
+}
+  800fb1:	c3                   	ret
+
+0000000000800fb2 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800fb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb7:	eb 03                	jmp    800fbc <strnlen+0xa>
+  800fb9:	48 89 d0             	mov    %rdx,%rax
+  800fbc:	48 39 c6             	cmp    %rax,%rsi
+  800fbf:	74 0a                	je     800fcb <strnlen+0x19>
+  800fc1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800fc5:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800fc9:	75 ee                	jne    800fb9 <strnlen+0x7>
+		n++;
+	return n;
+}
+  800fcb:	c3                   	ret
+
+0000000000800fcc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800fcc:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800fcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd4:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800fd8:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800fdb:	48 83 c2 01          	add    $0x1,%rdx
+  800fdf:	84 c9                	test   %cl,%cl
+  800fe1:	75 f1                	jne    800fd4 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800fe3:	c3                   	ret
+
+0000000000800fe4 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800fe4:	55                   	push   %rbp
+  800fe5:	48 89 e5             	mov    %rsp,%rbp
+  800fe8:	41 54                	push   %r12
+  800fea:	53                   	push   %rbx
+  800feb:	48 89 fb             	mov    %rdi,%rbx
+  800fee:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800ff1:	48 b8 9e 0f 80 00 00 	movabs $0x800f9e,%rax
+  800ff8:	00 00 00 
+  800ffb:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800ffd:	48 63 f8             	movslq %eax,%rdi
+  801000:	48 01 df             	add    %rbx,%rdi
+  801003:	4c 89 e6             	mov    %r12,%rsi
+  801006:	48 b8 cc 0f 80 00 00 	movabs $0x800fcc,%rax
+  80100d:	00 00 00 
+  801010:	ff d0                	call   *%rax
+	return dst;
+}
+  801012:	48 89 d8             	mov    %rbx,%rax
+  801015:	5b                   	pop    %rbx
+  801016:	41 5c                	pop    %r12
+  801018:	5d                   	pop    %rbp
+  801019:	c3                   	ret
+
+000000000080101a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80101a:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80101d:	48 01 fa             	add    %rdi,%rdx
+  801020:	48 89 f9             	mov    %rdi,%rcx
+  801023:	eb 14                	jmp    801039 <strncpy+0x1f>
+		*dst++ = *src;
+  801025:	48 83 c1 01          	add    $0x1,%rcx
+  801029:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80102d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801031:	41 80 f8 01          	cmp    $0x1,%r8b
+  801035:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  801039:	48 39 d1             	cmp    %rdx,%rcx
+  80103c:	75 e7                	jne    801025 <strncpy+0xb>
+	}
+	return ret;
+}
+  80103e:	c3                   	ret
+
+000000000080103f <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80103f:	48 89 f8             	mov    %rdi,%rax
+  801042:	48 85 d2             	test   %rdx,%rdx
+  801045:	74 27                	je     80106e <strlcpy+0x2f>
+  801047:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  80104c:	48 89 fa             	mov    %rdi,%rdx
+  80104f:	eb 0b                	jmp    80105c <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801051:	48 83 c6 01          	add    $0x1,%rsi
+  801055:	48 83 c2 01          	add    $0x1,%rdx
+  801059:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  80105c:	48 39 c2             	cmp    %rax,%rdx
+  80105f:	74 0a                	je     80106b <strlcpy+0x2c>
+  801061:	0f b6 0e             	movzbl (%rsi),%ecx
+  801064:	84 c9                	test   %cl,%cl
+  801066:	75 e9                	jne    801051 <strlcpy+0x12>
+  801068:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  80106b:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  80106e:	48 29 f8             	sub    %rdi,%rax
+}
+  801071:	c3                   	ret
+
+0000000000801072 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  801072:	eb 08                	jmp    80107c <strcmp+0xa>
+		p++, q++;
+  801074:	48 83 c7 01          	add    $0x1,%rdi
+  801078:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  80107c:	0f b6 07             	movzbl (%rdi),%eax
+  80107f:	84 c0                	test   %al,%al
+  801081:	74 04                	je     801087 <strcmp+0x15>
+  801083:	3a 06                	cmp    (%rsi),%al
+  801085:	74 ed                	je     801074 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801087:	0f b6 c0             	movzbl %al,%eax
+  80108a:	0f b6 16             	movzbl (%rsi),%edx
+  80108d:	29 d0                	sub    %edx,%eax
+}
+  80108f:	c3                   	ret
+
+0000000000801090 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  801090:	eb 0c                	jmp    80109e <strncmp+0xe>
+		n--, p++, q++;
+  801092:	48 83 ea 01          	sub    $0x1,%rdx
+  801096:	48 83 c7 01          	add    $0x1,%rdi
+  80109a:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  80109e:	48 85 d2             	test   %rdx,%rdx
+  8010a1:	74 14                	je     8010b7 <strncmp+0x27>
+  8010a3:	0f b6 07             	movzbl (%rdi),%eax
+  8010a6:	84 c0                	test   %al,%al
+  8010a8:	74 04                	je     8010ae <strncmp+0x1e>
+  8010aa:	3a 06                	cmp    (%rsi),%al
+  8010ac:	74 e4                	je     801092 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8010ae:	0f b6 07             	movzbl (%rdi),%eax
+  8010b1:	0f b6 16             	movzbl (%rsi),%edx
+  8010b4:	29 d0                	sub    %edx,%eax
+}
+  8010b6:	c3                   	ret
+		return 0;
+  8010b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010bc:	c3                   	ret
+
+00000000008010bd <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  8010bd:	eb 04                	jmp    8010c3 <strchr+0x6>
+  8010bf:	48 83 c7 01          	add    $0x1,%rdi
+  8010c3:	0f b6 07             	movzbl (%rdi),%eax
+  8010c6:	84 c0                	test   %al,%al
+  8010c8:	74 09                	je     8010d3 <strchr+0x16>
+		if (*s == c)
+  8010ca:	40 38 f0             	cmp    %sil,%al
+  8010cd:	75 f0                	jne    8010bf <strchr+0x2>
+  8010cf:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  8010d2:	c3                   	ret
+	return 0;
+  8010d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d8:	c3                   	ret
+
+00000000008010d9 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8010d9:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  8010dc:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  8010df:	40 38 f2             	cmp    %sil,%dl
+  8010e2:	74 0a                	je     8010ee <strfind+0x15>
+  8010e4:	84 d2                	test   %dl,%dl
+  8010e6:	74 06                	je     8010ee <strfind+0x15>
+	for (; *s; s++)
+  8010e8:	48 83 c0 01          	add    $0x1,%rax
+  8010ec:	eb ee                	jmp    8010dc <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  8010ee:	c3                   	ret
+
+00000000008010ef <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  8010ef:	48 85 d2             	test   %rdx,%rdx
+  8010f2:	74 28                	je     80111c <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  8010f4:	48 89 f8             	mov    %rdi,%rax
+  8010f7:	48 09 d0             	or     %rdx,%rax
+  8010fa:	a8 03                	test   $0x3,%al
+  8010fc:	75 16                	jne    801114 <memset+0x25>
+		c &= 0xFF;
+  8010fe:	40 0f b6 f6          	movzbl %sil,%esi
+  801102:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801108:	48 89 d1             	mov    %rdx,%rcx
+  80110b:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  80110f:	fc                   	cld
+  801110:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801112:	eb 08                	jmp    80111c <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801114:	89 f0                	mov    %esi,%eax
+  801116:	48 89 d1             	mov    %rdx,%rcx
+  801119:	fc                   	cld
+  80111a:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80111c:	48 89 f8             	mov    %rdi,%rax
+  80111f:	c3                   	ret
+
+0000000000801120 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801120:	48 89 f8             	mov    %rdi,%rax
+  801123:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801126:	48 39 fe             	cmp    %rdi,%rsi
+  801129:	73 3a                	jae    801165 <memmove+0x45>
+  80112b:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80112f:	48 39 d7             	cmp    %rdx,%rdi
+  801132:	73 31                	jae    801165 <memmove+0x45>
+		s += n;
+		d += n;
+  801134:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  801138:	48 89 d6             	mov    %rdx,%rsi
+  80113b:	48 09 fe             	or     %rdi,%rsi
+  80113e:	48 09 ce             	or     %rcx,%rsi
+  801141:	40 f6 c6 03          	test   $0x3,%sil
+  801145:	75 11                	jne    801158 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801147:	48 83 ef 04          	sub    $0x4,%rdi
+  80114b:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  80114f:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801153:	fd                   	std
+  801154:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801156:	eb 0b                	jmp    801163 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801158:	48 83 ef 01          	sub    $0x1,%rdi
+  80115c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  801160:	fd                   	std
+  801161:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801163:	fc                   	cld
+  801164:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  801165:	48 89 f2             	mov    %rsi,%rdx
+  801168:	48 09 c2             	or     %rax,%rdx
+  80116b:	48 09 ca             	or     %rcx,%rdx
+  80116e:	f6 c2 03             	test   $0x3,%dl
+  801171:	75 0b                	jne    80117e <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801173:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  801177:	48 89 c7             	mov    %rax,%rdi
+  80117a:	fc                   	cld
+  80117b:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80117d:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  80117e:	48 89 c7             	mov    %rax,%rdi
+  801181:	fc                   	cld
+  801182:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801184:	c3                   	ret
+
+0000000000801185 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801185:	55                   	push   %rbp
+  801186:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  801189:	48 b8 20 11 80 00 00 	movabs $0x801120,%rax
+  801190:	00 00 00 
+  801193:	ff d0                	call   *%rax
+}
+  801195:	5d                   	pop    %rbp
+  801196:	c3                   	ret
+
+0000000000801197 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801197:	b8 00 00 00 00       	mov    $0x0,%eax
+  80119c:	48 39 c2             	cmp    %rax,%rdx
+  80119f:	74 1e                	je     8011bf <memcmp+0x28>
+		if (*s1 != *s2)
+  8011a1:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011a5:	48 83 c0 01          	add    $0x1,%rax
+  8011a9:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  8011af:	44 38 c1             	cmp    %r8b,%cl
+  8011b2:	74 e8                	je     80119c <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  8011b4:	0f b6 c1             	movzbl %cl,%eax
+  8011b7:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011bb:	44 29 c0             	sub    %r8d,%eax
+  8011be:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  8011bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011c4:	c3                   	ret
+
+00000000008011c5 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8011c5:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  8011c8:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  8011cb:	eb 04                	jmp    8011d1 <memfind+0xc>
+  8011cd:	48 83 c0 01          	add    $0x1,%rax
+  8011d1:	48 39 d0             	cmp    %rdx,%rax
+  8011d4:	73 05                	jae    8011db <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8011d6:	40 38 30             	cmp    %sil,(%rax)
+  8011d9:	75 f2                	jne    8011cd <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  8011db:	c3                   	ret
+
+00000000008011dc <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8011dc:	48 89 f9             	mov    %rdi,%rcx
+  8011df:	49 89 f0             	mov    %rsi,%r8
+  8011e2:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8011e4:	eb 04                	jmp    8011ea <strtol+0xe>
+		s++;
+  8011e6:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  8011ea:	0f b6 01             	movzbl (%rcx),%eax
+  8011ed:	3c 20                	cmp    $0x20,%al
+  8011ef:	74 f5                	je     8011e6 <strtol+0xa>
+  8011f1:	3c 09                	cmp    $0x9,%al
+  8011f3:	74 f1                	je     8011e6 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  8011f5:	3c 2b                	cmp    $0x2b,%al
+  8011f7:	74 2b                	je     801224 <strtol+0x48>
+	int neg = 0;
+  8011f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  8011ff:	3c 2d                	cmp    $0x2d,%al
+  801201:	74 2d                	je     801230 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801203:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  801209:	75 0f                	jne    80121a <strtol+0x3e>
+  80120b:	80 39 30             	cmpb   $0x30,(%rcx)
+  80120e:	74 2c                	je     80123c <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801210:	85 ff                	test   %edi,%edi
+  801212:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801217:	0f 44 f8             	cmove  %eax,%edi
+  80121a:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  80121f:	4c 63 d7             	movslq %edi,%r10
+  801222:	eb 4f                	jmp    801273 <strtol+0x97>
+		s++;
+  801224:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  801228:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80122e:	eb d3                	jmp    801203 <strtol+0x27>
+		s++, neg = 1;
+  801230:	48 83 c1 01          	add    $0x1,%rcx
+  801234:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  80123a:	eb c7                	jmp    801203 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80123c:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  801240:	74 0f                	je     801251 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  801242:	85 ff                	test   %edi,%edi
+  801244:	75 d4                	jne    80121a <strtol+0x3e>
+		s++, base = 8;
+  801246:	48 83 c1 01          	add    $0x1,%rcx
+  80124a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80124f:	eb c9                	jmp    80121a <strtol+0x3e>
+		s += 2, base = 16;
+  801251:	48 83 c1 02          	add    $0x2,%rcx
+  801255:	bf 10 00 00 00       	mov    $0x10,%edi
+  80125a:	eb be                	jmp    80121a <strtol+0x3e>
+			dig = *s - '0';
+  80125c:	0f be c0             	movsbl %al,%eax
+  80125f:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  801262:	39 f8                	cmp    %edi,%eax
+  801264:	7d 3b                	jge    8012a1 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  801266:	48 83 c1 01          	add    $0x1,%rcx
+  80126a:	49 0f af d2          	imul   %r10,%rdx
+  80126e:	48 98                	cltq
+  801270:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  801273:	0f b6 01             	movzbl (%rcx),%eax
+  801276:	8d 70 d0             	lea    -0x30(%rax),%esi
+  801279:	40 80 fe 09          	cmp    $0x9,%sil
+  80127d:	76 dd                	jbe    80125c <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  80127f:	8d 70 9f             	lea    -0x61(%rax),%esi
+  801282:	40 80 fe 19          	cmp    $0x19,%sil
+  801286:	77 08                	ja     801290 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  801288:	0f be c0             	movsbl %al,%eax
+  80128b:	83 e8 57             	sub    $0x57,%eax
+  80128e:	eb d2                	jmp    801262 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  801290:	8d 70 bf             	lea    -0x41(%rax),%esi
+  801293:	40 80 fe 19          	cmp    $0x19,%sil
+  801297:	77 08                	ja     8012a1 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  801299:	0f be c0             	movsbl %al,%eax
+  80129c:	83 e8 37             	sub    $0x37,%eax
+  80129f:	eb c1                	jmp    801262 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8012a1:	4d 85 c0             	test   %r8,%r8
+  8012a4:	74 03                	je     8012a9 <strtol+0xcd>
+		*endptr = (char *) s;
+  8012a6:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  8012a9:	48 89 d0             	mov    %rdx,%rax
+  8012ac:	48 f7 d8             	neg    %rax
+  8012af:	45 85 c9             	test   %r9d,%r9d
+  8012b2:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  8012b6:	48 89 d0             	mov    %rdx,%rax
+  8012b9:	c3                   	ret
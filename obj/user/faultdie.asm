@@ -0,0 +1,2450 @@
+
+obj/user/faultdie:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 6d 00 00 00       	call   80009e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+	void *addr = (void*)utf->utf_fault_va;
+	uint32_t err = utf->utf_err;
+	cprintf("i faulted at va %lx, err %x\n", addr, err & 7);
+  800037:	8b 57 08             	mov    0x8(%rdi),%edx
+  80003a:	83 e2 07             	and    $0x7,%edx
+  80003d:	48 8b 37             	mov    (%rdi),%rsi
+  800040:	48 bf 00 14 80 00 00 	movabs $0x801400,%rdi
+  800047:	00 00 00 
+  80004a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004f:	48 b9 91 01 80 00 00 	movabs $0x800191,%rcx
+  800056:	00 00 00 
+  800059:	ff d1                	call   *%rcx
+	sys_env_destroy(sys_getenvid());
+  80005b:	48 b8 c9 0d 80 00 00 	movabs $0x800dc9,%rax
+  800062:	00 00 00 
+  800065:	ff d0                	call   *%rax
+  800067:	89 c7                	mov    %eax,%edi
+  800069:	48 b8 6e 0d 80 00 00 	movabs $0x800d6e,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+}
+  800075:	5d                   	pop    %rbp
+  800076:	c3                   	ret
+
+0000000000800077 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800077:	55                   	push   %rbp
+  800078:	48 89 e5             	mov    %rsp,%rbp
+	set_pgfault_handler(handler);
+  80007b:	48 bf 33 00 80 00 00 	movabs $0x800033,%rdi
+  800082:	00 00 00 
+  800085:	48 b8 f1 11 80 00 00 	movabs $0x8011f1,%rax
+  80008c:	00 00 00 
+  80008f:	ff d0                	call   *%rax
+	*(int*)0xDeadBeef = 0;
+  800091:	b8 ef be ad de       	mov    $0xdeadbeef,%eax
+  800096:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  80009c:	5d                   	pop    %rbp
+  80009d:	c3                   	ret
+
+000000000080009e <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  80009e:	55                   	push   %rbp
+  80009f:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000a2:	85 ff                	test   %edi,%edi
+  8000a4:	7e 0d                	jle    8000b3 <libmain+0x15>
+		binaryname = argv[0];
+  8000a6:	48 8b 06             	mov    (%rsi),%rax
+  8000a9:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  8000b0:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  8000b3:	48 b8 77 00 80 00 00 	movabs $0x800077,%rax
+  8000ba:	00 00 00 
+  8000bd:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8000bf:	48 b8 cd 00 80 00 00 	movabs $0x8000cd,%rax
+  8000c6:	00 00 00 
+  8000c9:	ff d0                	call   *%rax
+}
+  8000cb:	5d                   	pop    %rbp
+  8000cc:	c3                   	ret
+
+00000000008000cd <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000cd:	55                   	push   %rbp
+  8000ce:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  8000d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000d6:	48 b8 6e 0d 80 00 00 	movabs $0x800d6e,%rax
+  8000dd:	00 00 00 
+  8000e0:	ff d0                	call   *%rax
+}
+  8000e2:	5d                   	pop    %rbp
+  8000e3:	c3                   	ret
+
+00000000008000e4 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000e4:	55                   	push   %rbp
+  8000e5:	48 89 e5             	mov    %rsp,%rbp
+  8000e8:	53                   	push   %rbx
+  8000e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8000ed:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  8000f0:	8b 06                	mov    (%rsi),%eax
+  8000f2:	8d 50 01             	lea    0x1(%rax),%edx
+  8000f5:	89 16                	mov    %edx,(%rsi)
+  8000f7:	48 98                	cltq
+  8000f9:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  8000fe:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800104:	74 0a                	je     800110 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800106:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80010a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80010e:	c9                   	leave
+  80010f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800110:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800114:	be ff 00 00 00       	mov    $0xff,%esi
+  800119:	48 b8 36 0d 80 00 00 	movabs $0x800d36,%rax
+  800120:	00 00 00 
+  800123:	ff d0                	call   *%rax
+		b->idx = 0;
+  800125:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80012b:	eb d9                	jmp    800106 <putch+0x22>
+
+000000000080012d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80012d:	55                   	push   %rbp
+  80012e:	48 89 e5             	mov    %rsp,%rbp
+  800131:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800138:	48 89 fa             	mov    %rdi,%rdx
+  80013b:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  80013e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800145:	00 00 00 
+	b.cnt = 0;
+  800148:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80014f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800152:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  800159:	48 bf e4 00 80 00 00 	movabs $0x8000e4,%rdi
+  800160:	00 00 00 
+  800163:	48 b8 4b 03 80 00 00 	movabs $0x80034b,%rax
+  80016a:	00 00 00 
+  80016d:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  80016f:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  800176:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80017d:	48 b8 36 0d 80 00 00 	movabs $0x800d36,%rax
+  800184:	00 00 00 
+  800187:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  800189:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  80018f:	c9                   	leave
+  800190:	c3                   	ret
+
+0000000000800191 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800191:	55                   	push   %rbp
+  800192:	48 89 e5             	mov    %rsp,%rbp
+  800195:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80019c:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8001a3:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8001aa:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8001b1:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8001b8:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8001bf:	84 c0                	test   %al,%al
+  8001c1:	74 20                	je     8001e3 <cprintf+0x52>
+  8001c3:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8001c7:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8001cb:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8001cf:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8001d3:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8001d7:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8001db:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8001df:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001e3:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  8001ea:	00 00 00 
+  8001ed:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8001f4:	00 00 00 
+  8001f7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001fb:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800202:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800209:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  800210:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  800217:	48 b8 2d 01 80 00 00 	movabs $0x80012d,%rax
+  80021e:	00 00 00 
+  800221:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  800223:	c9                   	leave
+  800224:	c3                   	ret
+
+0000000000800225 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800225:	55                   	push   %rbp
+  800226:	48 89 e5             	mov    %rsp,%rbp
+  800229:	41 57                	push   %r15
+  80022b:	41 56                	push   %r14
+  80022d:	41 55                	push   %r13
+  80022f:	41 54                	push   %r12
+  800231:	53                   	push   %rbx
+  800232:	48 83 ec 18          	sub    $0x18,%rsp
+  800236:	49 89 fc             	mov    %rdi,%r12
+  800239:	49 89 f5             	mov    %rsi,%r13
+  80023c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800240:	44 89 c3             	mov    %r8d,%ebx
+  800243:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800246:	41 89 cf             	mov    %ecx,%r15d
+  800249:	4c 39 fa             	cmp    %r15,%rdx
+  80024c:	72 29                	jb     800277 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80024e:	48 89 d0             	mov    %rdx,%rax
+  800251:	ba 00 00 00 00       	mov    $0x0,%edx
+  800256:	49 f7 f7             	div    %r15
+  800259:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80025d:	48 89 c2             	mov    %rax,%rdx
+  800260:	48 b8 25 02 80 00 00 	movabs $0x800225,%rax
+  800267:	00 00 00 
+  80026a:	ff d0                	call   *%rax
+  80026c:	eb 10                	jmp    80027e <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80026e:	4c 89 ee             	mov    %r13,%rsi
+  800271:	44 89 f7             	mov    %r14d,%edi
+  800274:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  800277:	83 eb 01             	sub    $0x1,%ebx
+  80027a:	85 db                	test   %ebx,%ebx
+  80027c:	7f f0                	jg     80026e <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80027e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800282:	ba 00 00 00 00       	mov    $0x0,%edx
+  800287:	49 f7 f7             	div    %r15
+  80028a:	48 b8 27 14 80 00 00 	movabs $0x801427,%rax
+  800291:	00 00 00 
+  800294:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  800298:	4c 89 ee             	mov    %r13,%rsi
+  80029b:	41 ff d4             	call   *%r12
+}
+  80029e:	48 83 c4 18          	add    $0x18,%rsp
+  8002a2:	5b                   	pop    %rbx
+  8002a3:	41 5c                	pop    %r12
+  8002a5:	41 5d                	pop    %r13
+  8002a7:	41 5e                	pop    %r14
+  8002a9:	41 5f                	pop    %r15
+  8002ab:	5d                   	pop    %rbp
+  8002ac:	c3                   	ret
+
+00000000008002ad <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  8002ad:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  8002b1:	48 8b 06             	mov    (%rsi),%rax
+  8002b4:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002b8:	73 0a                	jae    8002c4 <sprintputch+0x17>
+		*b->buf++ = ch;
+  8002ba:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002be:	48 89 16             	mov    %rdx,(%rsi)
+  8002c1:	40 88 38             	mov    %dil,(%rax)
+}
+  8002c4:	c3                   	ret
+
+00000000008002c5 <printfmt>:
+{
+  8002c5:	55                   	push   %rbp
+  8002c6:	48 89 e5             	mov    %rsp,%rbp
+  8002c9:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8002d0:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8002d7:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8002de:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8002e5:	84 c0                	test   %al,%al
+  8002e7:	74 20                	je     800309 <printfmt+0x44>
+  8002e9:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8002ed:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8002f1:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8002f5:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8002f9:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8002fd:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800301:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800305:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  800309:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800310:	00 00 00 
+  800313:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80031a:	00 00 00 
+  80031d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800321:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800328:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80032f:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800336:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  80033d:	48 b8 4b 03 80 00 00 	movabs $0x80034b,%rax
+  800344:	00 00 00 
+  800347:	ff d0                	call   *%rax
+}
+  800349:	c9                   	leave
+  80034a:	c3                   	ret
+
+000000000080034b <vprintfmt>:
+{
+  80034b:	55                   	push   %rbp
+  80034c:	48 89 e5             	mov    %rsp,%rbp
+  80034f:	41 57                	push   %r15
+  800351:	41 56                	push   %r14
+  800353:	41 55                	push   %r13
+  800355:	41 54                	push   %r12
+  800357:	53                   	push   %rbx
+  800358:	48 83 ec 48          	sub    $0x48,%rsp
+  80035c:	49 89 fe             	mov    %rdi,%r14
+  80035f:	49 89 f5             	mov    %rsi,%r13
+  800362:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  800365:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  800369:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  80036d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800371:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  800375:	eb 09                	jmp    800380 <vprintfmt+0x35>
+			putch(ch, putdat);
+  800377:	4c 89 ee             	mov    %r13,%rsi
+  80037a:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80037d:	4c 89 e3             	mov    %r12,%rbx
+  800380:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800384:	0f b6 3b             	movzbl (%rbx),%edi
+  800387:	83 ff 25             	cmp    $0x25,%edi
+  80038a:	74 13                	je     80039f <vprintfmt+0x54>
+			if (ch == '\0')
+  80038c:	85 ff                	test   %edi,%edi
+  80038e:	75 e7                	jne    800377 <vprintfmt+0x2c>
+}
+  800390:	48 83 c4 48          	add    $0x48,%rsp
+  800394:	5b                   	pop    %rbx
+  800395:	41 5c                	pop    %r12
+  800397:	41 5d                	pop    %r13
+  800399:	41 5e                	pop    %r14
+  80039b:	41 5f                	pop    %r15
+  80039d:	5d                   	pop    %rbp
+  80039e:	c3                   	ret
+		padc = ' ';
+  80039f:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  8003a3:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  8003aa:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  8003b0:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  8003b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003bc:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003c1:	41 0f b6 14 24       	movzbl (%r12),%edx
+  8003c6:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  8003c9:	3c 55                	cmp    $0x55,%al
+  8003cb:	0f 87 4f 05 00 00    	ja     800920 <vprintfmt+0x5d5>
+  8003d1:	0f b6 c0             	movzbl %al,%eax
+  8003d4:	48 be e0 14 80 00 00 	movabs $0x8014e0,%rsi
+  8003db:	00 00 00 
+  8003de:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  8003e1:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  8003e4:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  8003e8:	eb d2                	jmp    8003bc <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ea:	49 89 dc             	mov    %rbx,%r12
+  8003ed:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  8003f1:	eb c9                	jmp    8003bc <vprintfmt+0x71>
+  8003f3:	0f b6 d2             	movzbl %dl,%edx
+  8003f6:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  8003f9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  8003ff:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800403:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  800408:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  80040d:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  800410:	83 f8 09             	cmp    $0x9,%eax
+  800413:	77 20                	ja     800435 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  800415:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  800419:	eb e4                	jmp    8003ff <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  80041b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80041e:	83 f8 2f             	cmp    $0x2f,%eax
+  800421:	77 27                	ja     80044a <vprintfmt+0xff>
+  800423:	89 c2                	mov    %eax,%edx
+  800425:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800429:	83 c0 08             	add    $0x8,%eax
+  80042c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80042f:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  800432:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  800435:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800439:	79 81                	jns    8003bc <vprintfmt+0x71>
+				width = precision, precision = -1;
+  80043b:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  80043f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800445:	e9 72 ff ff ff       	jmp    8003bc <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  80044a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80044e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800452:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800456:	eb d7                	jmp    80042f <vprintfmt+0xe4>
+			if (width < 0)
+  800458:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  80045b:	85 f6                	test   %esi,%esi
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	0f 49 c6             	cmovns %esi,%eax
+  800465:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800468:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  80046b:	e9 4c ff ff ff       	jmp    8003bc <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800470:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  800473:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  80047a:	e9 3d ff ff ff       	jmp    8003bc <vprintfmt+0x71>
+			lflag++;
+  80047f:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800482:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800485:	e9 32 ff ff ff       	jmp    8003bc <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  80048a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80048d:	83 f8 2f             	cmp    $0x2f,%eax
+  800490:	77 19                	ja     8004ab <vprintfmt+0x160>
+  800492:	89 c2                	mov    %eax,%edx
+  800494:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800498:	83 c0 08             	add    $0x8,%eax
+  80049b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80049e:	8b 3a                	mov    (%rdx),%edi
+  8004a0:	4c 89 ee             	mov    %r13,%rsi
+  8004a3:	41 ff d6             	call   *%r14
+			break;
+  8004a6:	e9 d5 fe ff ff       	jmp    800380 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  8004ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004b7:	eb e5                	jmp    80049e <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  8004b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8004bf:	77 5a                	ja     80051b <vprintfmt+0x1d0>
+  8004c1:	89 c2                	mov    %eax,%edx
+  8004c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004c7:	83 c0 08             	add    $0x8,%eax
+  8004ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  8004cd:	8b 02                	mov    (%rdx),%eax
+  8004cf:	89 c1                	mov    %eax,%ecx
+  8004d1:	f7 d9                	neg    %ecx
+  8004d3:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004d6:	83 f9 08             	cmp    $0x8,%ecx
+  8004d9:	7f 4e                	jg     800529 <vprintfmt+0x1de>
+  8004db:	48 63 c1             	movslq %ecx,%rax
+  8004de:	48 ba a0 17 80 00 00 	movabs $0x8017a0,%rdx
+  8004e5:	00 00 00 
+  8004e8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004ec:	48 85 c0             	test   %rax,%rax
+  8004ef:	74 38                	je     800529 <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  8004f1:	48 89 c1             	mov    %rax,%rcx
+  8004f4:	48 ba 48 14 80 00 00 	movabs $0x801448,%rdx
+  8004fb:	00 00 00 
+  8004fe:	4c 89 ee             	mov    %r13,%rsi
+  800501:	4c 89 f7             	mov    %r14,%rdi
+  800504:	b8 00 00 00 00       	mov    $0x0,%eax
+  800509:	49 b8 c5 02 80 00 00 	movabs $0x8002c5,%r8
+  800510:	00 00 00 
+  800513:	41 ff d0             	call   *%r8
+  800516:	e9 65 fe ff ff       	jmp    800380 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  80051b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80051f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800523:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800527:	eb a4                	jmp    8004cd <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  800529:	48 ba 3f 14 80 00 00 	movabs $0x80143f,%rdx
+  800530:	00 00 00 
+  800533:	4c 89 ee             	mov    %r13,%rsi
+  800536:	4c 89 f7             	mov    %r14,%rdi
+  800539:	b8 00 00 00 00       	mov    $0x0,%eax
+  80053e:	49 b8 c5 02 80 00 00 	movabs $0x8002c5,%r8
+  800545:	00 00 00 
+  800548:	41 ff d0             	call   *%r8
+  80054b:	e9 30 fe ff ff       	jmp    800380 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800550:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800553:	83 f8 2f             	cmp    $0x2f,%eax
+  800556:	77 36                	ja     80058e <vprintfmt+0x243>
+  800558:	89 c2                	mov    %eax,%edx
+  80055a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80055e:	83 c0 08             	add    $0x8,%eax
+  800561:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800564:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800567:	48 85 c9             	test   %rcx,%rcx
+  80056a:	48 b8 38 14 80 00 00 	movabs $0x801438,%rax
+  800571:	00 00 00 
+  800574:	48 0f 45 c1          	cmovne %rcx,%rax
+  800578:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  80057c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800580:	7e 06                	jle    800588 <vprintfmt+0x23d>
+  800582:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800586:	75 14                	jne    80059c <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800588:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80058c:	eb 64                	jmp    8005f2 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  80058e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800592:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800596:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80059a:	eb c8                	jmp    800564 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059c:	49 63 f7             	movslq %r15d,%rsi
+  80059f:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  8005a3:	48 b8 2e 0a 80 00 00 	movabs $0x800a2e,%rax
+  8005aa:	00 00 00 
+  8005ad:	ff d0                	call   *%rax
+  8005af:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005b2:	29 c1                	sub    %eax,%ecx
+  8005b4:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  8005b7:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  8005ba:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  8005be:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005c1:	eb 0d                	jmp    8005d0 <vprintfmt+0x285>
+					putch(padc, putdat);
+  8005c3:	4c 89 ee             	mov    %r13,%rsi
+  8005c6:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  8005c9:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005cc:	41 83 ec 01          	sub    $0x1,%r12d
+  8005d0:	45 85 e4             	test   %r12d,%r12d
+  8005d3:	7f ee                	jg     8005c3 <vprintfmt+0x278>
+  8005d5:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  8005d8:	85 c9                	test   %ecx,%ecx
+  8005da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005df:	0f 49 c1             	cmovns %ecx,%eax
+  8005e2:	29 c1                	sub    %eax,%ecx
+  8005e4:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  8005e7:	eb 9f                	jmp    800588 <vprintfmt+0x23d>
+					putch(ch, putdat);
+  8005e9:	4c 89 ee             	mov    %r13,%rsi
+  8005ec:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005ef:	4c 89 e2             	mov    %r12,%rdx
+  8005f2:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8005f6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8005fc:	0f be f8             	movsbl %al,%edi
+  8005ff:	85 ff                	test   %edi,%edi
+  800601:	74 29                	je     80062c <vprintfmt+0x2e1>
+  800603:	45 85 ff             	test   %r15d,%r15d
+  800606:	78 06                	js     80060e <vprintfmt+0x2c3>
+  800608:	41 83 ef 01          	sub    $0x1,%r15d
+  80060c:	78 1e                	js     80062c <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80060e:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800612:	74 d5                	je     8005e9 <vprintfmt+0x29e>
+  800614:	0f be c0             	movsbl %al,%eax
+  800617:	83 e8 20             	sub    $0x20,%eax
+  80061a:	83 f8 5e             	cmp    $0x5e,%eax
+  80061d:	76 ca                	jbe    8005e9 <vprintfmt+0x29e>
+					putch('?', putdat);
+  80061f:	4c 89 ee             	mov    %r13,%rsi
+  800622:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800627:	41 ff d6             	call   *%r14
+  80062a:	eb c3                	jmp    8005ef <vprintfmt+0x2a4>
+  80062c:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800630:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800633:	41 01 c4             	add    %eax,%r12d
+  800636:	41 29 d4             	sub    %edx,%r12d
+  800639:	eb 0f                	jmp    80064a <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  80063b:	4c 89 ee             	mov    %r13,%rsi
+  80063e:	bf 20 00 00 00       	mov    $0x20,%edi
+  800643:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800646:	41 83 ec 01          	sub    $0x1,%r12d
+  80064a:	45 85 e4             	test   %r12d,%r12d
+  80064d:	7f ec                	jg     80063b <vprintfmt+0x2f0>
+  80064f:	e9 2c fd ff ff       	jmp    800380 <vprintfmt+0x35>
+	if (lflag >= 2)
+  800654:	83 f9 01             	cmp    $0x1,%ecx
+  800657:	7f 1d                	jg     800676 <vprintfmt+0x32b>
+	else if (lflag)
+  800659:	85 c9                	test   %ecx,%ecx
+  80065b:	74 5e                	je     8006bb <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  80065d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800660:	83 f8 2f             	cmp    $0x2f,%eax
+  800663:	77 48                	ja     8006ad <vprintfmt+0x362>
+  800665:	89 c2                	mov    %eax,%edx
+  800667:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80066b:	83 c0 08             	add    $0x8,%eax
+  80066e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800671:	4c 8b 22             	mov    (%rdx),%r12
+  800674:	eb 17                	jmp    80068d <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800676:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800679:	83 f8 2f             	cmp    $0x2f,%eax
+  80067c:	77 21                	ja     80069f <vprintfmt+0x354>
+  80067e:	89 c2                	mov    %eax,%edx
+  800680:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800684:	83 c0 08             	add    $0x8,%eax
+  800687:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80068a:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  80068d:	4d 85 e4             	test   %r12,%r12
+  800690:	78 50                	js     8006e2 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  800692:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800695:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80069a:	e9 b4 01 00 00       	jmp    800853 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  80069f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ab:	eb dd                	jmp    80068a <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  8006ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b9:	eb b6                	jmp    800671 <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  8006bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006be:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c1:	77 11                	ja     8006d4 <vprintfmt+0x389>
+  8006c3:	89 c2                	mov    %eax,%edx
+  8006c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c9:	83 c0 08             	add    $0x8,%eax
+  8006cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006cf:	4c 63 22             	movslq (%rdx),%r12
+  8006d2:	eb b9                	jmp    80068d <vprintfmt+0x342>
+  8006d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e0:	eb ed                	jmp    8006cf <vprintfmt+0x384>
+				putch('-', putdat);
+  8006e2:	4c 89 ee             	mov    %r13,%rsi
+  8006e5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8006ea:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  8006ed:	4c 89 e2             	mov    %r12,%rdx
+  8006f0:	48 f7 da             	neg    %rdx
+			base = 10;
+  8006f3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8006f8:	e9 56 01 00 00       	jmp    800853 <vprintfmt+0x508>
+	if (lflag >= 2)
+  8006fd:	83 f9 01             	cmp    $0x1,%ecx
+  800700:	7f 25                	jg     800727 <vprintfmt+0x3dc>
+	else if (lflag)
+  800702:	85 c9                	test   %ecx,%ecx
+  800704:	74 5e                	je     800764 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800706:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800709:	83 f8 2f             	cmp    $0x2f,%eax
+  80070c:	77 48                	ja     800756 <vprintfmt+0x40b>
+  80070e:	89 c2                	mov    %eax,%edx
+  800710:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800714:	83 c0 08             	add    $0x8,%eax
+  800717:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80071a:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  80071d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800722:	e9 2c 01 00 00       	jmp    800853 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800727:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80072a:	83 f8 2f             	cmp    $0x2f,%eax
+  80072d:	77 19                	ja     800748 <vprintfmt+0x3fd>
+  80072f:	89 c2                	mov    %eax,%edx
+  800731:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800735:	83 c0 08             	add    $0x8,%eax
+  800738:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80073b:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  80073e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800743:	e9 0b 01 00 00       	jmp    800853 <vprintfmt+0x508>
+  800748:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80074c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800750:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800754:	eb e5                	jmp    80073b <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800756:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80075a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80075e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800762:	eb b6                	jmp    80071a <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800764:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800767:	83 f8 2f             	cmp    $0x2f,%eax
+  80076a:	77 18                	ja     800784 <vprintfmt+0x439>
+  80076c:	89 c2                	mov    %eax,%edx
+  80076e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800772:	83 c0 08             	add    $0x8,%eax
+  800775:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800778:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  80077a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  80077f:	e9 cf 00 00 00       	jmp    800853 <vprintfmt+0x508>
+  800784:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800788:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800790:	eb e6                	jmp    800778 <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800792:	83 f9 01             	cmp    $0x1,%ecx
+  800795:	7f 25                	jg     8007bc <vprintfmt+0x471>
+	else if (lflag)
+  800797:	85 c9                	test   %ecx,%ecx
+  800799:	74 5b                	je     8007f6 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  80079b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80079e:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a1:	77 45                	ja     8007e8 <vprintfmt+0x49d>
+  8007a3:	89 c2                	mov    %eax,%edx
+  8007a5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a9:	83 c0 08             	add    $0x8,%eax
+  8007ac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007af:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  8007b2:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  8007b7:	e9 97 00 00 00       	jmp    800853 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8007bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c2:	77 16                	ja     8007da <vprintfmt+0x48f>
+  8007c4:	89 c2                	mov    %eax,%edx
+  8007c6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ca:	83 c0 08             	add    $0x8,%eax
+  8007cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d0:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  8007d3:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  8007d8:	eb 79                	jmp    800853 <vprintfmt+0x508>
+  8007da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e6:	eb e8                	jmp    8007d0 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  8007e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f4:	eb b9                	jmp    8007af <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  8007f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fc:	77 15                	ja     800813 <vprintfmt+0x4c8>
+  8007fe:	89 c2                	mov    %eax,%edx
+  800800:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800804:	83 c0 08             	add    $0x8,%eax
+  800807:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080a:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  80080c:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800811:	eb 40                	jmp    800853 <vprintfmt+0x508>
+  800813:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800817:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80081b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081f:	eb e9                	jmp    80080a <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800821:	4c 89 ee             	mov    %r13,%rsi
+  800824:	bf 30 00 00 00       	mov    $0x30,%edi
+  800829:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  80082c:	4c 89 ee             	mov    %r13,%rsi
+  80082f:	bf 78 00 00 00       	mov    $0x78,%edi
+  800834:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800837:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083a:	83 f8 2f             	cmp    $0x2f,%eax
+  80083d:	77 34                	ja     800873 <vprintfmt+0x528>
+  80083f:	89 c2                	mov    %eax,%edx
+  800841:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800845:	83 c0 08             	add    $0x8,%eax
+  800848:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  80084b:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  80084e:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800853:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800858:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80085c:	4c 89 ee             	mov    %r13,%rsi
+  80085f:	4c 89 f7             	mov    %r14,%rdi
+  800862:	48 b8 25 02 80 00 00 	movabs $0x800225,%rax
+  800869:	00 00 00 
+  80086c:	ff d0                	call   *%rax
+			break;
+  80086e:	e9 0d fb ff ff       	jmp    800380 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800873:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800877:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087f:	eb ca                	jmp    80084b <vprintfmt+0x500>
+	if (lflag >= 2)
+  800881:	83 f9 01             	cmp    $0x1,%ecx
+  800884:	7f 22                	jg     8008a8 <vprintfmt+0x55d>
+	else if (lflag)
+  800886:	85 c9                	test   %ecx,%ecx
+  800888:	74 58                	je     8008e2 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  80088a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088d:	83 f8 2f             	cmp    $0x2f,%eax
+  800890:	77 42                	ja     8008d4 <vprintfmt+0x589>
+  800892:	89 c2                	mov    %eax,%edx
+  800894:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800898:	83 c0 08             	add    $0x8,%eax
+  80089b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089e:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  8008a1:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  8008a6:	eb ab                	jmp    800853 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8008a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ae:	77 16                	ja     8008c6 <vprintfmt+0x57b>
+  8008b0:	89 c2                	mov    %eax,%edx
+  8008b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b6:	83 c0 08             	add    $0x8,%eax
+  8008b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008bc:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  8008bf:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  8008c4:	eb 8d                	jmp    800853 <vprintfmt+0x508>
+  8008c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d2:	eb e8                	jmp    8008bc <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  8008d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e0:	eb bc                	jmp    80089e <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  8008e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e8:	77 18                	ja     800902 <vprintfmt+0x5b7>
+  8008ea:	89 c2                	mov    %eax,%edx
+  8008ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f0:	83 c0 08             	add    $0x8,%eax
+  8008f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f6:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  8008f8:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  8008fd:	e9 51 ff ff ff       	jmp    800853 <vprintfmt+0x508>
+  800902:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800906:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80090a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80090e:	eb e6                	jmp    8008f6 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800910:	4c 89 ee             	mov    %r13,%rsi
+  800913:	bf 25 00 00 00       	mov    $0x25,%edi
+  800918:	41 ff d6             	call   *%r14
+			break;
+  80091b:	e9 60 fa ff ff       	jmp    800380 <vprintfmt+0x35>
+			putch('%', putdat);
+  800920:	4c 89 ee             	mov    %r13,%rsi
+  800923:	bf 25 00 00 00       	mov    $0x25,%edi
+  800928:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80092b:	4c 89 e3             	mov    %r12,%rbx
+  80092e:	eb 04                	jmp    800934 <vprintfmt+0x5e9>
+  800930:	48 83 eb 01          	sub    $0x1,%rbx
+  800934:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800938:	75 f6                	jne    800930 <vprintfmt+0x5e5>
+  80093a:	e9 41 fa ff ff       	jmp    800380 <vprintfmt+0x35>
+
+000000000080093f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80093f:	55                   	push   %rbp
+  800940:	48 89 e5             	mov    %rsp,%rbp
+  800943:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800947:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  80094b:	48 63 c6             	movslq %esi,%rax
+  80094e:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800953:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800957:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  80095e:	48 85 ff             	test   %rdi,%rdi
+  800961:	74 2a                	je     80098d <vsnprintf+0x4e>
+  800963:	85 f6                	test   %esi,%esi
+  800965:	7e 26                	jle    80098d <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800967:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80096b:	48 bf ad 02 80 00 00 	movabs $0x8002ad,%rdi
+  800972:	00 00 00 
+  800975:	48 b8 4b 03 80 00 00 	movabs $0x80034b,%rax
+  80097c:	00 00 00 
+  80097f:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800981:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800985:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800988:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  80098b:	c9                   	leave
+  80098c:	c3                   	ret
+		return -E_INVAL;
+  80098d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800992:	eb f7                	jmp    80098b <vsnprintf+0x4c>
+
+0000000000800994 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800994:	55                   	push   %rbp
+  800995:	48 89 e5             	mov    %rsp,%rbp
+  800998:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80099f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8009a6:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8009ad:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8009b4:	84 c0                	test   %al,%al
+  8009b6:	74 20                	je     8009d8 <snprintf+0x44>
+  8009b8:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8009bc:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8009c0:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8009c4:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8009c8:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8009cc:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8009d0:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8009d4:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009d8:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8009df:	00 00 00 
+  8009e2:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8009e9:	00 00 00 
+  8009ec:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8009f0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8009f7:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8009fe:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a05:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800a0c:	48 b8 3f 09 80 00 00 	movabs $0x80093f,%rax
+  800a13:	00 00 00 
+  800a16:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800a18:	c9                   	leave
+  800a19:	c3                   	ret
+
+0000000000800a1a <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a1f:	48 89 d0             	mov    %rdx,%rax
+  800a22:	48 83 c2 01          	add    $0x1,%rdx
+  800a26:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800a2b:	75 f2                	jne    800a1f <strlen+0x5>
+		n++;
+	return n;
+}
+  800a2d:	c3                   	ret
+
+0000000000800a2e <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a33:	eb 03                	jmp    800a38 <strnlen+0xa>
+  800a35:	48 89 d0             	mov    %rdx,%rax
+  800a38:	48 39 c6             	cmp    %rax,%rsi
+  800a3b:	74 0a                	je     800a47 <strnlen+0x19>
+  800a3d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a41:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800a45:	75 ee                	jne    800a35 <strnlen+0x7>
+		n++;
+	return n;
+}
+  800a47:	c3                   	ret
+
+0000000000800a48 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a48:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a50:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800a54:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800a57:	48 83 c2 01          	add    $0x1,%rdx
+  800a5b:	84 c9                	test   %cl,%cl
+  800a5d:	75 f1                	jne    800a50 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800a5f:	c3                   	ret
+
+0000000000800a60 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a60:	55                   	push   %rbp
+  800a61:	48 89 e5             	mov    %rsp,%rbp
+  800a64:	41 54                	push   %r12
+  800a66:	53                   	push   %rbx
+  800a67:	48 89 fb             	mov    %rdi,%rbx
+  800a6a:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800a6d:	48 b8 1a 0a 80 00 00 	movabs $0x800a1a,%rax
+  800a74:	00 00 00 
+  800a77:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800a79:	48 63 f8             	movslq %eax,%rdi
+  800a7c:	48 01 df             	add    %rbx,%rdi
+  800a7f:	4c 89 e6             	mov    %r12,%rsi
+  800a82:	48 b8 48 0a 80 00 00 	movabs $0x800a48,%rax
+  800a89:	00 00 00 
+  800a8c:	ff d0                	call   *%rax
+	return dst;
+}
+  800a8e:	48 89 d8             	mov    %rbx,%rax
+  800a91:	5b                   	pop    %rbx
+  800a92:	41 5c                	pop    %r12
+  800a94:	5d                   	pop    %rbp
+  800a95:	c3                   	ret
+
+0000000000800a96 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a96:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a99:	48 01 fa             	add    %rdi,%rdx
+  800a9c:	48 89 f9             	mov    %rdi,%rcx
+  800a9f:	eb 14                	jmp    800ab5 <strncpy+0x1f>
+		*dst++ = *src;
+  800aa1:	48 83 c1 01          	add    $0x1,%rcx
+  800aa5:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800aa9:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800aad:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ab1:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800ab5:	48 39 d1             	cmp    %rdx,%rcx
+  800ab8:	75 e7                	jne    800aa1 <strncpy+0xb>
+	}
+	return ret;
+}
+  800aba:	c3                   	ret
+
+0000000000800abb <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800abb:	48 89 f8             	mov    %rdi,%rax
+  800abe:	48 85 d2             	test   %rdx,%rdx
+  800ac1:	74 27                	je     800aea <strlcpy+0x2f>
+  800ac3:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800ac8:	48 89 fa             	mov    %rdi,%rdx
+  800acb:	eb 0b                	jmp    800ad8 <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800acd:	48 83 c6 01          	add    $0x1,%rsi
+  800ad1:	48 83 c2 01          	add    $0x1,%rdx
+  800ad5:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800ad8:	48 39 c2             	cmp    %rax,%rdx
+  800adb:	74 0a                	je     800ae7 <strlcpy+0x2c>
+  800add:	0f b6 0e             	movzbl (%rsi),%ecx
+  800ae0:	84 c9                	test   %cl,%cl
+  800ae2:	75 e9                	jne    800acd <strlcpy+0x12>
+  800ae4:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800ae7:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800aea:	48 29 f8             	sub    %rdi,%rax
+}
+  800aed:	c3                   	ret
+
+0000000000800aee <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800aee:	eb 08                	jmp    800af8 <strcmp+0xa>
+		p++, q++;
+  800af0:	48 83 c7 01          	add    $0x1,%rdi
+  800af4:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800af8:	0f b6 07             	movzbl (%rdi),%eax
+  800afb:	84 c0                	test   %al,%al
+  800afd:	74 04                	je     800b03 <strcmp+0x15>
+  800aff:	3a 06                	cmp    (%rsi),%al
+  800b01:	74 ed                	je     800af0 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b03:	0f b6 c0             	movzbl %al,%eax
+  800b06:	0f b6 16             	movzbl (%rsi),%edx
+  800b09:	29 d0                	sub    %edx,%eax
+}
+  800b0b:	c3                   	ret
+
+0000000000800b0c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800b0c:	eb 0c                	jmp    800b1a <strncmp+0xe>
+		n--, p++, q++;
+  800b0e:	48 83 ea 01          	sub    $0x1,%rdx
+  800b12:	48 83 c7 01          	add    $0x1,%rdi
+  800b16:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800b1a:	48 85 d2             	test   %rdx,%rdx
+  800b1d:	74 14                	je     800b33 <strncmp+0x27>
+  800b1f:	0f b6 07             	movzbl (%rdi),%eax
+  800b22:	84 c0                	test   %al,%al
+  800b24:	74 04                	je     800b2a <strncmp+0x1e>
+  800b26:	3a 06                	cmp    (%rsi),%al
+  800b28:	74 e4                	je     800b0e <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b2a:	0f b6 07             	movzbl (%rdi),%eax
+  800b2d:	0f b6 16             	movzbl (%rsi),%edx
+  800b30:	29 d0                	sub    %edx,%eax
+}
+  800b32:	c3                   	ret
+		return 0;
+  800b33:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b38:	c3                   	ret
+
+0000000000800b39 <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800b39:	eb 04                	jmp    800b3f <strchr+0x6>
+  800b3b:	48 83 c7 01          	add    $0x1,%rdi
+  800b3f:	0f b6 07             	movzbl (%rdi),%eax
+  800b42:	84 c0                	test   %al,%al
+  800b44:	74 09                	je     800b4f <strchr+0x16>
+		if (*s == c)
+  800b46:	40 38 f0             	cmp    %sil,%al
+  800b49:	75 f0                	jne    800b3b <strchr+0x2>
+  800b4b:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800b4e:	c3                   	ret
+	return 0;
+  800b4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b54:	c3                   	ret
+
+0000000000800b55 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b55:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800b58:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800b5b:	40 38 f2             	cmp    %sil,%dl
+  800b5e:	74 0a                	je     800b6a <strfind+0x15>
+  800b60:	84 d2                	test   %dl,%dl
+  800b62:	74 06                	je     800b6a <strfind+0x15>
+	for (; *s; s++)
+  800b64:	48 83 c0 01          	add    $0x1,%rax
+  800b68:	eb ee                	jmp    800b58 <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800b6a:	c3                   	ret
+
+0000000000800b6b <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800b6b:	48 85 d2             	test   %rdx,%rdx
+  800b6e:	74 28                	je     800b98 <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800b70:	48 89 f8             	mov    %rdi,%rax
+  800b73:	48 09 d0             	or     %rdx,%rax
+  800b76:	a8 03                	test   $0x3,%al
+  800b78:	75 16                	jne    800b90 <memset+0x25>
+		c &= 0xFF;
+  800b7a:	40 0f b6 f6          	movzbl %sil,%esi
+  800b7e:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b84:	48 89 d1             	mov    %rdx,%rcx
+  800b87:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800b8b:	fc                   	cld
+  800b8c:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800b8e:	eb 08                	jmp    800b98 <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b90:	89 f0                	mov    %esi,%eax
+  800b92:	48 89 d1             	mov    %rdx,%rcx
+  800b95:	fc                   	cld
+  800b96:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b98:	48 89 f8             	mov    %rdi,%rax
+  800b9b:	c3                   	ret
+
+0000000000800b9c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b9c:	48 89 f8             	mov    %rdi,%rax
+  800b9f:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ba2:	48 39 fe             	cmp    %rdi,%rsi
+  800ba5:	73 3a                	jae    800be1 <memmove+0x45>
+  800ba7:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800bab:	48 39 d7             	cmp    %rdx,%rdi
+  800bae:	73 31                	jae    800be1 <memmove+0x45>
+		s += n;
+		d += n;
+  800bb0:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800bb4:	48 89 d6             	mov    %rdx,%rsi
+  800bb7:	48 09 fe             	or     %rdi,%rsi
+  800bba:	48 09 ce             	or     %rcx,%rsi
+  800bbd:	40 f6 c6 03          	test   $0x3,%sil
+  800bc1:	75 11                	jne    800bd4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bc3:	48 83 ef 04          	sub    $0x4,%rdi
+  800bc7:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800bcb:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800bcf:	fd                   	std
+  800bd0:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800bd2:	eb 0b                	jmp    800bdf <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bd4:	48 83 ef 01          	sub    $0x1,%rdi
+  800bd8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800bdc:	fd                   	std
+  800bdd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800bdf:	fc                   	cld
+  800be0:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800be1:	48 89 f2             	mov    %rsi,%rdx
+  800be4:	48 09 c2             	or     %rax,%rdx
+  800be7:	48 09 ca             	or     %rcx,%rdx
+  800bea:	f6 c2 03             	test   $0x3,%dl
+  800bed:	75 0b                	jne    800bfa <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bef:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800bf3:	48 89 c7             	mov    %rax,%rdi
+  800bf6:	fc                   	cld
+  800bf7:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800bf9:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800bfa:	48 89 c7             	mov    %rax,%rdi
+  800bfd:	fc                   	cld
+  800bfe:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c00:	c3                   	ret
+
+0000000000800c01 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c01:	55                   	push   %rbp
+  800c02:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800c05:	48 b8 9c 0b 80 00 00 	movabs $0x800b9c,%rax
+  800c0c:	00 00 00 
+  800c0f:	ff d0                	call   *%rax
+}
+  800c11:	5d                   	pop    %rbp
+  800c12:	c3                   	ret
+
+0000000000800c13 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c18:	48 39 c2             	cmp    %rax,%rdx
+  800c1b:	74 1e                	je     800c3b <memcmp+0x28>
+		if (*s1 != *s2)
+  800c1d:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800c21:	48 83 c0 01          	add    $0x1,%rax
+  800c25:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800c2b:	44 38 c1             	cmp    %r8b,%cl
+  800c2e:	74 e8                	je     800c18 <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800c30:	0f b6 c1             	movzbl %cl,%eax
+  800c33:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800c37:	44 29 c0             	sub    %r8d,%eax
+  800c3a:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c40:	c3                   	ret
+
+0000000000800c41 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c41:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800c44:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800c47:	eb 04                	jmp    800c4d <memfind+0xc>
+  800c49:	48 83 c0 01          	add    $0x1,%rax
+  800c4d:	48 39 d0             	cmp    %rdx,%rax
+  800c50:	73 05                	jae    800c57 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c52:	40 38 30             	cmp    %sil,(%rax)
+  800c55:	75 f2                	jne    800c49 <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800c57:	c3                   	ret
+
+0000000000800c58 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c58:	48 89 f9             	mov    %rdi,%rcx
+  800c5b:	49 89 f0             	mov    %rsi,%r8
+  800c5e:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c60:	eb 04                	jmp    800c66 <strtol+0xe>
+		s++;
+  800c62:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800c66:	0f b6 01             	movzbl (%rcx),%eax
+  800c69:	3c 20                	cmp    $0x20,%al
+  800c6b:	74 f5                	je     800c62 <strtol+0xa>
+  800c6d:	3c 09                	cmp    $0x9,%al
+  800c6f:	74 f1                	je     800c62 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c71:	3c 2b                	cmp    $0x2b,%al
+  800c73:	74 2b                	je     800ca0 <strtol+0x48>
+	int neg = 0;
+  800c75:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800c7b:	3c 2d                	cmp    $0x2d,%al
+  800c7d:	74 2d                	je     800cac <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c7f:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800c85:	75 0f                	jne    800c96 <strtol+0x3e>
+  800c87:	80 39 30             	cmpb   $0x30,(%rcx)
+  800c8a:	74 2c                	je     800cb8 <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c8c:	85 ff                	test   %edi,%edi
+  800c8e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c93:	0f 44 f8             	cmove  %eax,%edi
+  800c96:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800c9b:	4c 63 d7             	movslq %edi,%r10
+  800c9e:	eb 4f                	jmp    800cef <strtol+0x97>
+		s++;
+  800ca0:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800ca4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800caa:	eb d3                	jmp    800c7f <strtol+0x27>
+		s++, neg = 1;
+  800cac:	48 83 c1 01          	add    $0x1,%rcx
+  800cb0:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800cb6:	eb c7                	jmp    800c7f <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cb8:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800cbc:	74 0f                	je     800ccd <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800cbe:	85 ff                	test   %edi,%edi
+  800cc0:	75 d4                	jne    800c96 <strtol+0x3e>
+		s++, base = 8;
+  800cc2:	48 83 c1 01          	add    $0x1,%rcx
+  800cc6:	bf 08 00 00 00       	mov    $0x8,%edi
+  800ccb:	eb c9                	jmp    800c96 <strtol+0x3e>
+		s += 2, base = 16;
+  800ccd:	48 83 c1 02          	add    $0x2,%rcx
+  800cd1:	bf 10 00 00 00       	mov    $0x10,%edi
+  800cd6:	eb be                	jmp    800c96 <strtol+0x3e>
+			dig = *s - '0';
+  800cd8:	0f be c0             	movsbl %al,%eax
+  800cdb:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800cde:	39 f8                	cmp    %edi,%eax
+  800ce0:	7d 3b                	jge    800d1d <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800ce2:	48 83 c1 01          	add    $0x1,%rcx
+  800ce6:	49 0f af d2          	imul   %r10,%rdx
+  800cea:	48 98                	cltq
+  800cec:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800cef:	0f b6 01             	movzbl (%rcx),%eax
+  800cf2:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800cf5:	40 80 fe 09          	cmp    $0x9,%sil
+  800cf9:	76 dd                	jbe    800cd8 <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800cfb:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800cfe:	40 80 fe 19          	cmp    $0x19,%sil
+  800d02:	77 08                	ja     800d0c <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800d04:	0f be c0             	movsbl %al,%eax
+  800d07:	83 e8 57             	sub    $0x57,%eax
+  800d0a:	eb d2                	jmp    800cde <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d0c:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800d0f:	40 80 fe 19          	cmp    $0x19,%sil
+  800d13:	77 08                	ja     800d1d <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800d15:	0f be c0             	movsbl %al,%eax
+  800d18:	83 e8 37             	sub    $0x37,%eax
+  800d1b:	eb c1                	jmp    800cde <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d1d:	4d 85 c0             	test   %r8,%r8
+  800d20:	74 03                	je     800d25 <strtol+0xcd>
+		*endptr = (char *) s;
+  800d22:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800d25:	48 89 d0             	mov    %rdx,%rax
+  800d28:	48 f7 d8             	neg    %rax
+  800d2b:	45 85 c9             	test   %r9d,%r9d
+  800d2e:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800d32:	48 89 d0             	mov    %rdx,%rax
+  800d35:	c3                   	ret
+
+0000000000800d36 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800d36:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800d3c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800d42:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d4c:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800d4e:	c3                   	ret
+
+0000000000800d4f <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800d4f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800d55:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800d5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d60:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d65:	48 89 fe             	mov    %rdi,%rsi
+  800d68:	48 89 fa             	mov    %rdi,%rdx
+  800d6b:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d6d:	c3                   	ret
+
+0000000000800d6e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800d6e:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800d71:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800d77:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800d7d:	be 00 00 00 00       	mov    $0x0,%esi
+  800d82:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d87:	48 89 f2             	mov    %rsi,%rdx
+  800d8a:	0f 05                	syscall
+	if(check && ret > 0)
+  800d8c:	48 85 c0             	test   %rax,%rax
+  800d8f:	7f 01                	jg     800d92 <sys_env_destroy+0x24>
+}
+  800d91:	c3                   	ret
+{
+  800d92:	55                   	push   %rbp
+  800d93:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d96:	49 89 c0             	mov    %rax,%r8
+  800d99:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800d9e:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  800da5:	00 00 00 
+  800da8:	be 28 00 00 00       	mov    $0x28,%esi
+  800dad:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  800db4:	00 00 00 
+  800db7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbc:	49 b9 08 13 80 00 00 	movabs $0x801308,%r9
+  800dc3:	00 00 00 
+  800dc6:	41 ff d1             	call   *%r9
+
+0000000000800dc9 <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800dc9:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800dd0:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800dd1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800dd6:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800dda:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800dde:	48 c1 e2 04          	shl    $0x4,%rdx
+  800de2:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800de9:	00 00 00 
+  800dec:	48 01 d0             	add    %rdx,%rax
+  800def:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800df5:	c3                   	ret
+
+0000000000800df6 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800df6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800dfc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800e02:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e07:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e0c:	48 89 fe             	mov    %rdi,%rsi
+  800e0f:	48 89 fa             	mov    %rdi,%rdx
+  800e12:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e14:	c3                   	ret
+
+0000000000800e15 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  800e15:	48 63 d2             	movslq %edx,%rdx
+  800e18:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800e1b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800e21:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800e27:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e2c:	0f 05                	syscall
+	if(check && ret > 0)
+  800e2e:	48 85 c0             	test   %rax,%rax
+  800e31:	7f 01                	jg     800e34 <sys_page_alloc+0x1f>
+}
+  800e33:	c3                   	ret
+{
+  800e34:	55                   	push   %rbp
+  800e35:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e38:	49 89 c0             	mov    %rax,%r8
+  800e3b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800e40:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  800e47:	00 00 00 
+  800e4a:	be 28 00 00 00       	mov    $0x28,%esi
+  800e4f:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  800e56:	00 00 00 
+  800e59:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5e:	49 b9 08 13 80 00 00 	movabs $0x801308,%r9
+  800e65:	00 00 00 
+  800e68:	41 ff d1             	call   *%r9
+
+0000000000800e6b <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  800e6b:	48 63 d2             	movslq %edx,%rdx
+  800e6e:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800e71:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800e77:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800e7d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e82:	0f 05                	syscall
+	if(check && ret > 0)
+  800e84:	48 85 c0             	test   %rax,%rax
+  800e87:	7f 01                	jg     800e8a <sys_page_alloc_huge+0x1f>
+}
+  800e89:	c3                   	ret
+{
+  800e8a:	55                   	push   %rbp
+  800e8b:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8e:	49 89 c0             	mov    %rax,%r8
+  800e91:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800e96:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  800e9d:	00 00 00 
+  800ea0:	be 28 00 00 00       	mov    $0x28,%esi
+  800ea5:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  800eac:	00 00 00 
+  800eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb4:	49 b9 08 13 80 00 00 	movabs $0x801308,%r9
+  800ebb:	00 00 00 
+  800ebe:	41 ff d1             	call   *%r9
+
+0000000000800ec1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ec1:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  800ec4:	48 63 d2             	movslq %edx,%rdx
+  800ec7:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800eca:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  800ecd:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ed2:	0f 05                	syscall
+	if(check && ret > 0)
+  800ed4:	48 85 c0             	test   %rax,%rax
+  800ed7:	7f 01                	jg     800eda <sys_page_map+0x19>
+}
+  800ed9:	c3                   	ret
+{
+  800eda:	55                   	push   %rbp
+  800edb:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ede:	49 89 c0             	mov    %rax,%r8
+  800ee1:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800ee6:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  800eed:	00 00 00 
+  800ef0:	be 28 00 00 00       	mov    $0x28,%esi
+  800ef5:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  800efc:	00 00 00 
+  800eff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f04:	49 b9 08 13 80 00 00 	movabs $0x801308,%r9
+  800f0b:	00 00 00 
+  800f0e:	41 ff d1             	call   *%r9
+
+0000000000800f11 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  800f11:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800f14:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f1a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f20:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f25:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f2a:	0f 05                	syscall
+	if(check && ret > 0)
+  800f2c:	48 85 c0             	test   %rax,%rax
+  800f2f:	7f 01                	jg     800f32 <sys_page_unmap+0x21>
+}
+  800f31:	c3                   	ret
+{
+  800f32:	55                   	push   %rbp
+  800f33:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f36:	49 89 c0             	mov    %rax,%r8
+  800f39:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800f3e:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  800f45:	00 00 00 
+  800f48:	be 28 00 00 00       	mov    $0x28,%esi
+  800f4d:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  800f54:	00 00 00 
+  800f57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f5c:	49 b9 08 13 80 00 00 	movabs $0x801308,%r9
+  800f63:	00 00 00 
+  800f66:	41 ff d1             	call   *%r9
+
+0000000000800f69 <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  800f69:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f6f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f75:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f7a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f7f:	48 89 fe             	mov    %rdi,%rsi
+  800f82:	48 89 fa             	mov    %rdi,%rdx
+  800f85:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f87:	c3                   	ret
+
+0000000000800f88 <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  800f88:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f8e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f99:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f9e:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  800fa0:	c3                   	ret
+
+0000000000800fa1 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  800fa1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fa7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fad:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fb2:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  800fb4:	c3                   	ret
+
+0000000000800fb5 <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  800fb5:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  800fb8:	48 63 f6             	movslq %esi,%rsi
+  800fbb:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800fbe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fc4:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fc9:	0f 05                	syscall
+	if(check && ret > 0)
+  800fcb:	48 85 c0             	test   %rax,%rax
+  800fce:	7f 01                	jg     800fd1 <sys_page_batch+0x1c>
+}
+  800fd0:	c3                   	ret
+{
+  800fd1:	55                   	push   %rbp
+  800fd2:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd5:	49 89 c0             	mov    %rax,%r8
+  800fd8:	b9 12 00 00 00       	mov    $0x12,%ecx
+  800fdd:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  800fe4:	00 00 00 
+  800fe7:	be 28 00 00 00       	mov    $0x28,%esi
+  800fec:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  800ff3:	00 00 00 
+  800ff6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ffb:	49 b9 08 13 80 00 00 	movabs $0x801308,%r9
+  801002:	00 00 00 
+  801005:	41 ff d1             	call   *%r9
+
+0000000000801008 <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  801008:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80100e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801014:	be 00 00 00 00       	mov    $0x0,%esi
+  801019:	b8 13 00 00 00       	mov    $0x13,%eax
+  80101e:	48 89 f2             	mov    %rsi,%rdx
+  801021:	0f 05                	syscall
+	if(check && ret > 0)
+  801023:	48 85 c0             	test   %rax,%rax
+  801026:	7f 01                	jg     801029 <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  801028:	c3                   	ret
+{
+  801029:	55                   	push   %rbp
+  80102a:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80102d:	49 89 c0             	mov    %rax,%r8
+  801030:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801035:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  80103c:	00 00 00 
+  80103f:	be 28 00 00 00       	mov    $0x28,%esi
+  801044:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  80104b:	00 00 00 
+  80104e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801053:	49 b9 08 13 80 00 00 	movabs $0x801308,%r9
+  80105a:	00 00 00 
+  80105d:	41 ff d1             	call   *%r9
+
+0000000000801060 <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  801060:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801066:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80106c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801071:	b8 14 00 00 00       	mov    $0x14,%eax
+  801076:	48 89 fe             	mov    %rdi,%rsi
+  801079:	48 89 fa             	mov    %rdi,%rdx
+  80107c:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80107e:	c3                   	ret
+
+000000000080107f <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  80107f:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801082:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801088:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80108e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801093:	0f 05                	syscall
+	if(check && ret > 0)
+  801095:	48 85 c0             	test   %rax,%rax
+  801098:	7f 01                	jg     80109b <sys_page_unmap_range+0x1c>
+}
+  80109a:	c3                   	ret
+{
+  80109b:	55                   	push   %rbp
+  80109c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80109f:	49 89 c0             	mov    %rax,%r8
+  8010a2:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8010a7:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  8010ae:	00 00 00 
+  8010b1:	be 28 00 00 00       	mov    $0x28,%esi
+  8010b6:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  8010bd:	00 00 00 
+  8010c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c5:	49 b9 08 13 80 00 00 	movabs $0x801308,%r9
+  8010cc:	00 00 00 
+  8010cf:	41 ff d1             	call   *%r9
+
+00000000008010d2 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8010d2:	48 63 f6             	movslq %esi,%rsi
+  8010d5:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8010d8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010e9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010ee:	0f 05                	syscall
+	if(check && ret > 0)
+  8010f0:	48 85 c0             	test   %rax,%rax
+  8010f3:	7f 01                	jg     8010f6 <sys_env_set_status+0x24>
+}
+  8010f5:	c3                   	ret
+{
+  8010f6:	55                   	push   %rbp
+  8010f7:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010fa:	49 89 c0             	mov    %rax,%r8
+  8010fd:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801102:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  801109:	00 00 00 
+  80110c:	be 28 00 00 00       	mov    $0x28,%esi
+  801111:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  801118:	00 00 00 
+  80111b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801120:	49 b9 08 13 80 00 00 	movabs $0x801308,%r9
+  801127:	00 00 00 
+  80112a:	41 ff d1             	call   *%r9
+
+000000000080112d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80112d:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801130:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801136:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80113c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801141:	b8 09 00 00 00       	mov    $0x9,%eax
+  801146:	0f 05                	syscall
+	if(check && ret > 0)
+  801148:	48 85 c0             	test   %rax,%rax
+  80114b:	7f 01                	jg     80114e <sys_env_set_pgfault_upcall+0x21>
+}
+  80114d:	c3                   	ret
+{
+  80114e:	55                   	push   %rbp
+  80114f:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801152:	49 89 c0             	mov    %rax,%r8
+  801155:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80115a:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  801161:	00 00 00 
+  801164:	be 28 00 00 00       	mov    $0x28,%esi
+  801169:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  801170:	00 00 00 
+  801173:	b8 00 00 00 00       	mov    $0x0,%eax
+  801178:	49 b9 08 13 80 00 00 	movabs $0x801308,%r9
+  80117f:	00 00 00 
+  801182:	41 ff d1             	call   *%r9
+
+0000000000801185 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  801185:	48 63 ff             	movslq %edi,%rdi
+  801188:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  80118b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801191:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801196:	0f 05                	syscall
+}
+  801198:	c3                   	ret
+
+0000000000801199 <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  801199:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80119f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8011aa:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011af:	48 89 f2             	mov    %rsi,%rdx
+  8011b2:	0f 05                	syscall
+	if(check && ret > 0)
+  8011b4:	48 85 c0             	test   %rax,%rax
+  8011b7:	7f 01                	jg     8011ba <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  8011b9:	c3                   	ret
+{
+  8011ba:	55                   	push   %rbp
+  8011bb:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011be:	49 89 c0             	mov    %rax,%r8
+  8011c1:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8011c6:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  8011cd:	00 00 00 
+  8011d0:	be 28 00 00 00       	mov    $0x28,%esi
+  8011d5:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  8011dc:	00 00 00 
+  8011df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e4:	49 b9 08 13 80 00 00 	movabs $0x801308,%r9
+  8011eb:	00 00 00 
+  8011ee:	41 ff d1             	call   *%r9
+
+00000000008011f1 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8011f1:	55                   	push   %rbp
+  8011f2:	48 89 e5             	mov    %rsp,%rbp
+  8011f5:	53                   	push   %rbx
+  8011f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8011fa:	48 89 fb             	mov    %rdi,%rbx
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8011fd:	48 ba 08 20 80 00 00 	movabs $0x802008,%rdx
+  801204:	00 00 00 
+  801207:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  80120b:	74 13                	je     801220 <set_pgfault_handler+0x2f>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80120d:	48 89 d8             	mov    %rbx,%rax
+  801210:	48 a3 08 20 80 00 00 	movabs %rax,0x802008
+  801217:	00 00 00 
+}
+  80121a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80121e:	c9                   	leave
+  80121f:	c3                   	ret
+		r = sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801220:	ba 07 00 00 00       	mov    $0x7,%edx
+  801225:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  80122a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80122f:	48 b8 15 0e 80 00 00 	movabs $0x800e15,%rax
+  801236:	00 00 00 
+  801239:	ff d0                	call   *%rax
+		if (r < 0) {
+  80123b:	85 c0                	test   %eax,%eax
+  80123d:	78 4c                	js     80128b <set_pgfault_handler+0x9a>
+		r = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80123f:	48 be b8 12 80 00 00 	movabs $0x8012b8,%rsi
+  801246:	00 00 00 
+  801249:	bf 00 00 00 00       	mov    $0x0,%edi
+  80124e:	48 b8 2d 11 80 00 00 	movabs $0x80112d,%rax
+  801255:	00 00 00 
+  801258:	ff d0                	call   *%rax
+		if (r < 0) {
+  80125a:	85 c0                	test   %eax,%eax
+  80125c:	79 af                	jns    80120d <set_pgfault_handler+0x1c>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+  80125e:	89 c1                	mov    %eax,%ecx
+  801260:	48 ba 40 18 80 00 00 	movabs $0x801840,%rdx
+  801267:	00 00 00 
+  80126a:	be 2c 00 00 00       	mov    $0x2c,%esi
+  80126f:	48 bf 2e 18 80 00 00 	movabs $0x80182e,%rdi
+  801276:	00 00 00 
+  801279:	b8 00 00 00 00       	mov    $0x0,%eax
+  80127e:	49 b8 08 13 80 00 00 	movabs $0x801308,%r8
+  801285:	00 00 00 
+  801288:	41 ff d0             	call   *%r8
+			panic("sys_page_alloc failed:  %e", r);
+  80128b:	89 c1                	mov    %eax,%ecx
+  80128d:	48 ba 13 18 80 00 00 	movabs $0x801813,%rdx
+  801294:	00 00 00 
+  801297:	be 28 00 00 00       	mov    $0x28,%esi
+  80129c:	48 bf 2e 18 80 00 00 	movabs $0x80182e,%rdi
+  8012a3:	00 00 00 
+  8012a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ab:	49 b8 08 13 80 00 00 	movabs $0x801308,%r8
+  8012b2:	00 00 00 
+  8012b5:	41 ff d0             	call   *%r8
+
+00000000008012b8 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi		// function argument: pointer to UTF
+  8012b8:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  8012bb:	48 a1 08 20 80 00 00 	movabs 0x802008,%rax
+  8012c2:	00 00 00 
+	call *%rax
+  8012c5:	ff d0                	call   *%rax
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here. (Hint. You need to modify the trap time rsp to make room for the return rip ) */
+
+	movq  152(%rsp), %rax
+  8012c7:	48 8b 84 24 98 00 00 	mov    0x98(%rsp),%rax
+  8012ce:	00 
+	subq $8, %rax
+  8012cf:	48 83 e8 08          	sub    $0x8,%rax
+	movq %rax, 152(%rsp)
+  8012d3:	48 89 84 24 98 00 00 	mov    %rax,0x98(%rsp)
+  8012da:	00 
+
+	movq 136(%rsp), %rbx
+  8012db:	48 8b 9c 24 88 00 00 	mov    0x88(%rsp),%rbx
+  8012e2:	00 
+	movq %rbx, (%rax)
+  8012e3:	48 89 18             	mov    %rbx,(%rax)
+
+	/* Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here. (Hint, the oposite of _alltraps) */
+
+	addq $16, %rsp
+  8012e6:	48 83 c4 10          	add    $0x10,%rsp
+	
+	popq %r15
+  8012ea:	41 5f                	pop    %r15
+	popq %r14
+  8012ec:	41 5e                	pop    %r14
+	popq %r13
+  8012ee:	41 5d                	pop    %r13
+	popq %r12
+  8012f0:	41 5c                	pop    %r12
+	popq %r11
+  8012f2:	41 5b                	pop    %r11
+	popq %r10
+  8012f4:	41 5a                	pop    %r10
+	popq %r9
+  8012f6:	41 59                	pop    %r9
+	popq %r8
+  8012f8:	41 58                	pop    %r8
+	popq %rsi
+  8012fa:	5e                   	pop    %rsi
+	popq %rdi
+  8012fb:	5f                   	pop    %rdi
+	popq %rbp
+  8012fc:	5d                   	pop    %rbp
+	popq %rdx
+  8012fd:	5a                   	pop    %rdx
+	popq %rcx
+  8012fe:	59                   	pop    %rcx
+	popq %rbx
+  8012ff:	5b                   	pop    %rbx
+	popq %rax
+  801300:	58                   	pop    %rax
+
+	addq $8, %rsp
+  801301:	48 83 c4 08          	add    $0x8,%rsp
+	/* Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 4: Your code here. */
+
+	popfq
+  801305:	9d                   	popf
+
+	/* Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here. */
+
+	popq %rsp
+  801306:	5c                   	pop    %rsp
+
+	/* Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here. */
+  801307:	c3                   	ret
+
+0000000000801308 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801308:	55                   	push   %rbp
+  801309:	48 89 e5             	mov    %rsp,%rbp
+  80130c:	41 56                	push   %r14
+  80130e:	41 55                	push   %r13
+  801310:	41 54                	push   %r12
+  801312:	53                   	push   %rbx
+  801313:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80131a:	49 89 fc             	mov    %rdi,%r12
+  80131d:	41 89 f5             	mov    %esi,%r13d
+  801320:	48 89 d3             	mov    %rdx,%rbx
+  801323:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80132a:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  801331:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  801338:	84 c0                	test   %al,%al
+  80133a:	74 26                	je     801362 <_panic+0x5a>
+  80133c:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  801343:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80134a:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  80134e:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  801352:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  801356:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80135a:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  80135e:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801362:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  801369:	00 00 00 
+  80136c:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  801373:	00 00 00 
+  801376:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80137a:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  801381:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  801388:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80138f:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  801396:	00 00 00 
+  801399:	4c 8b 30             	mov    (%rax),%r14
+  80139c:	48 b8 c9 0d 80 00 00 	movabs $0x800dc9,%rax
+  8013a3:	00 00 00 
+  8013a6:	ff d0                	call   *%rax
+  8013a8:	89 c6                	mov    %eax,%esi
+  8013aa:	45 89 e8             	mov    %r13d,%r8d
+  8013ad:	4c 89 e1             	mov    %r12,%rcx
+  8013b0:	4c 89 f2             	mov    %r14,%rdx
+  8013b3:	48 bf 68 18 80 00 00 	movabs $0x801868,%rdi
+  8013ba:	00 00 00 
+  8013bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c2:	49 bc 91 01 80 00 00 	movabs $0x800191,%r12
+  8013c9:	00 00 00 
+  8013cc:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8013cf:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  8013d6:	48 89 df             	mov    %rbx,%rdi
+  8013d9:	48 b8 2d 01 80 00 00 	movabs $0x80012d,%rax
+  8013e0:	00 00 00 
+  8013e3:	ff d0                	call   *%rax
+	cprintf("\n");
+  8013e5:	48 bf 1b 14 80 00 00 	movabs $0x80141b,%rdi
+  8013ec:	00 00 00 
+  8013ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f4:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8013f7:	cc                   	int3
+	while (1)
+  8013f8:	eb fd                	jmp    8013f7 <_panic+0xef>
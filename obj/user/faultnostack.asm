@@ -0,0 +1,2420 @@
+
+obj/user/faultnostack:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 2e 00 00 00       	call   80005f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_set_pgfault_upcall(0, (void*) _pgfault_upcall);
+  800037:	48 be 60 05 80 00 00 	movabs $0x800560,%rsi
+  80003e:	00 00 00 
+  800041:	bf 00 00 00 00       	mov    $0x0,%edi
+  800046:	48 b8 9c 04 80 00 00 	movabs $0x80049c,%rax
+  80004d:	00 00 00 
+  800050:	ff d0                	call   *%rax
+	*(int*)0 = 0;
+  800052:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  800059:	00 00 00 00 
+}
+  80005d:	5d                   	pop    %rbp
+  80005e:	c3                   	ret
+
+000000000080005f <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  80005f:	55                   	push   %rbp
+  800060:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800063:	85 ff                	test   %edi,%edi
+  800065:	7e 0d                	jle    800074 <libmain+0x15>
+		binaryname = argv[0];
+  800067:	48 8b 06             	mov    (%rsi),%rax
+  80006a:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  800071:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  800074:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  80007b:	00 00 00 
+  80007e:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800080:	48 b8 8e 00 80 00 00 	movabs $0x80008e,%rax
+  800087:	00 00 00 
+  80008a:	ff d0                	call   *%rax
+}
+  80008c:	5d                   	pop    %rbp
+  80008d:	c3                   	ret
+
+000000000080008e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80008e:	55                   	push   %rbp
+  80008f:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  800092:	bf 00 00 00 00       	mov    $0x0,%edi
+  800097:	48 b8 dd 00 80 00 00 	movabs $0x8000dd,%rax
+  80009e:	00 00 00 
+  8000a1:	ff d0                	call   *%rax
+}
+  8000a3:	5d                   	pop    %rbp
+  8000a4:	c3                   	ret
+
+00000000008000a5 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  8000a5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  8000b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bb:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  8000bd:	c3                   	ret
+
+00000000008000be <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  8000be:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8000ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000cf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000d4:	48 89 fe             	mov    %rdi,%rsi
+  8000d7:	48 89 fa             	mov    %rdi,%rdx
+  8000da:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000dc:	c3                   	ret
+
+00000000008000dd <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8000dd:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8000e0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8000ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8000f1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000f6:	48 89 f2             	mov    %rsi,%rdx
+  8000f9:	0f 05                	syscall
+	if(check && ret > 0)
+  8000fb:	48 85 c0             	test   %rax,%rax
+  8000fe:	7f 01                	jg     800101 <sys_env_destroy+0x24>
+}
+  800100:	c3                   	ret
+{
+  800101:	55                   	push   %rbp
+  800102:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800105:	49 89 c0             	mov    %rax,%r8
+  800108:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80010d:	48 ba ca 13 80 00 00 	movabs $0x8013ca,%rdx
+  800114:	00 00 00 
+  800117:	be 28 00 00 00       	mov    $0x28,%esi
+  80011c:	48 bf e7 13 80 00 00 	movabs $0x8013e7,%rdi
+  800123:	00 00 00 
+  800126:	b8 00 00 00 00       	mov    $0x0,%eax
+  80012b:	49 b9 b0 05 80 00 00 	movabs $0x8005b0,%r9
+  800132:	00 00 00 
+  800135:	41 ff d1             	call   *%r9
+
+0000000000800138 <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800138:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  80013f:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800140:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800145:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800149:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80014d:	48 c1 e2 04          	shl    $0x4,%rdx
+  800151:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800158:	00 00 00 
+  80015b:	48 01 d0             	add    %rdx,%rax
+  80015e:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800164:	c3                   	ret
+
+0000000000800165 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800165:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80016b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800171:	bf 00 00 00 00       	mov    $0x0,%edi
+  800176:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80017b:	48 89 fe             	mov    %rdi,%rsi
+  80017e:	48 89 fa             	mov    %rdi,%rdx
+  800181:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800183:	c3                   	ret
+
+0000000000800184 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  800184:	48 63 d2             	movslq %edx,%rdx
+  800187:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80018a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800190:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800196:	b8 04 00 00 00       	mov    $0x4,%eax
+  80019b:	0f 05                	syscall
+	if(check && ret > 0)
+  80019d:	48 85 c0             	test   %rax,%rax
+  8001a0:	7f 01                	jg     8001a3 <sys_page_alloc+0x1f>
+}
+  8001a2:	c3                   	ret
+{
+  8001a3:	55                   	push   %rbp
+  8001a4:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001a7:	49 89 c0             	mov    %rax,%r8
+  8001aa:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8001af:	48 ba ca 13 80 00 00 	movabs $0x8013ca,%rdx
+  8001b6:	00 00 00 
+  8001b9:	be 28 00 00 00       	mov    $0x28,%esi
+  8001be:	48 bf e7 13 80 00 00 	movabs $0x8013e7,%rdi
+  8001c5:	00 00 00 
+  8001c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001cd:	49 b9 b0 05 80 00 00 	movabs $0x8005b0,%r9
+  8001d4:	00 00 00 
+  8001d7:	41 ff d1             	call   *%r9
+
+00000000008001da <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8001da:	48 63 d2             	movslq %edx,%rdx
+  8001dd:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8001e0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8001e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8001ec:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8001f1:	0f 05                	syscall
+	if(check && ret > 0)
+  8001f3:	48 85 c0             	test   %rax,%rax
+  8001f6:	7f 01                	jg     8001f9 <sys_page_alloc_huge+0x1f>
+}
+  8001f8:	c3                   	ret
+{
+  8001f9:	55                   	push   %rbp
+  8001fa:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001fd:	49 89 c0             	mov    %rax,%r8
+  800200:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800205:	48 ba ca 13 80 00 00 	movabs $0x8013ca,%rdx
+  80020c:	00 00 00 
+  80020f:	be 28 00 00 00       	mov    $0x28,%esi
+  800214:	48 bf e7 13 80 00 00 	movabs $0x8013e7,%rdi
+  80021b:	00 00 00 
+  80021e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800223:	49 b9 b0 05 80 00 00 	movabs $0x8005b0,%r9
+  80022a:	00 00 00 
+  80022d:	41 ff d1             	call   *%r9
+
+0000000000800230 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800230:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  800233:	48 63 d2             	movslq %edx,%rdx
+  800236:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800239:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  80023c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800241:	0f 05                	syscall
+	if(check && ret > 0)
+  800243:	48 85 c0             	test   %rax,%rax
+  800246:	7f 01                	jg     800249 <sys_page_map+0x19>
+}
+  800248:	c3                   	ret
+{
+  800249:	55                   	push   %rbp
+  80024a:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80024d:	49 89 c0             	mov    %rax,%r8
+  800250:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800255:	48 ba ca 13 80 00 00 	movabs $0x8013ca,%rdx
+  80025c:	00 00 00 
+  80025f:	be 28 00 00 00       	mov    $0x28,%esi
+  800264:	48 bf e7 13 80 00 00 	movabs $0x8013e7,%rdi
+  80026b:	00 00 00 
+  80026e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800273:	49 b9 b0 05 80 00 00 	movabs $0x8005b0,%r9
+  80027a:	00 00 00 
+  80027d:	41 ff d1             	call   *%r9
+
+0000000000800280 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  800280:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800283:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800289:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80028f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800294:	b8 06 00 00 00       	mov    $0x6,%eax
+  800299:	0f 05                	syscall
+	if(check && ret > 0)
+  80029b:	48 85 c0             	test   %rax,%rax
+  80029e:	7f 01                	jg     8002a1 <sys_page_unmap+0x21>
+}
+  8002a0:	c3                   	ret
+{
+  8002a1:	55                   	push   %rbp
+  8002a2:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002a5:	49 89 c0             	mov    %rax,%r8
+  8002a8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8002ad:	48 ba ca 13 80 00 00 	movabs $0x8013ca,%rdx
+  8002b4:	00 00 00 
+  8002b7:	be 28 00 00 00       	mov    $0x28,%esi
+  8002bc:	48 bf e7 13 80 00 00 	movabs $0x8013e7,%rdi
+  8002c3:	00 00 00 
+  8002c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cb:	49 b9 b0 05 80 00 00 	movabs $0x8005b0,%r9
+  8002d2:	00 00 00 
+  8002d5:	41 ff d1             	call   *%r9
+
+00000000008002d8 <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  8002d8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002e9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8002ee:	48 89 fe             	mov    %rdi,%rsi
+  8002f1:	48 89 fa             	mov    %rdi,%rdx
+  8002f4:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8002f6:	c3                   	ret
+
+00000000008002f7 <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  8002f7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800303:	ba 00 00 00 00       	mov    $0x0,%edx
+  800308:	b8 10 00 00 00       	mov    $0x10,%eax
+  80030d:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  80030f:	c3                   	ret
+
+0000000000800310 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  800310:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800316:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80031c:	b8 11 00 00 00       	mov    $0x11,%eax
+  800321:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  800323:	c3                   	ret
+
+0000000000800324 <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  800324:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  800327:	48 63 f6             	movslq %esi,%rsi
+  80032a:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  80032d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800333:	b8 12 00 00 00       	mov    $0x12,%eax
+  800338:	0f 05                	syscall
+	if(check && ret > 0)
+  80033a:	48 85 c0             	test   %rax,%rax
+  80033d:	7f 01                	jg     800340 <sys_page_batch+0x1c>
+}
+  80033f:	c3                   	ret
+{
+  800340:	55                   	push   %rbp
+  800341:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800344:	49 89 c0             	mov    %rax,%r8
+  800347:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80034c:	48 ba ca 13 80 00 00 	movabs $0x8013ca,%rdx
+  800353:	00 00 00 
+  800356:	be 28 00 00 00       	mov    $0x28,%esi
+  80035b:	48 bf e7 13 80 00 00 	movabs $0x8013e7,%rdi
+  800362:	00 00 00 
+  800365:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036a:	49 b9 b0 05 80 00 00 	movabs $0x8005b0,%r9
+  800371:	00 00 00 
+  800374:	41 ff d1             	call   *%r9
+
+0000000000800377 <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  800377:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80037d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800383:	be 00 00 00 00       	mov    $0x0,%esi
+  800388:	b8 13 00 00 00       	mov    $0x13,%eax
+  80038d:	48 89 f2             	mov    %rsi,%rdx
+  800390:	0f 05                	syscall
+	if(check && ret > 0)
+  800392:	48 85 c0             	test   %rax,%rax
+  800395:	7f 01                	jg     800398 <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  800397:	c3                   	ret
+{
+  800398:	55                   	push   %rbp
+  800399:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80039c:	49 89 c0             	mov    %rax,%r8
+  80039f:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8003a4:	48 ba ca 13 80 00 00 	movabs $0x8013ca,%rdx
+  8003ab:	00 00 00 
+  8003ae:	be 28 00 00 00       	mov    $0x28,%esi
+  8003b3:	48 bf e7 13 80 00 00 	movabs $0x8013e7,%rdi
+  8003ba:	00 00 00 
+  8003bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c2:	49 b9 b0 05 80 00 00 	movabs $0x8005b0,%r9
+  8003c9:	00 00 00 
+  8003cc:	41 ff d1             	call   *%r9
+
+00000000008003cf <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  8003cf:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8003d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8003db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003e0:	b8 14 00 00 00       	mov    $0x14,%eax
+  8003e5:	48 89 fe             	mov    %rdi,%rsi
+  8003e8:	48 89 fa             	mov    %rdi,%rdx
+  8003eb:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8003ed:	c3                   	ret
+
+00000000008003ee <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  8003ee:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8003f1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8003f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8003fd:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800402:	0f 05                	syscall
+	if(check && ret > 0)
+  800404:	48 85 c0             	test   %rax,%rax
+  800407:	7f 01                	jg     80040a <sys_page_unmap_range+0x1c>
+}
+  800409:	c3                   	ret
+{
+  80040a:	55                   	push   %rbp
+  80040b:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80040e:	49 89 c0             	mov    %rax,%r8
+  800411:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800416:	48 ba ca 13 80 00 00 	movabs $0x8013ca,%rdx
+  80041d:	00 00 00 
+  800420:	be 28 00 00 00       	mov    $0x28,%esi
+  800425:	48 bf e7 13 80 00 00 	movabs $0x8013e7,%rdi
+  80042c:	00 00 00 
+  80042f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800434:	49 b9 b0 05 80 00 00 	movabs $0x8005b0,%r9
+  80043b:	00 00 00 
+  80043e:	41 ff d1             	call   *%r9
+
+0000000000800441 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  800441:	48 63 f6             	movslq %esi,%rsi
+  800444:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800447:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80044d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800453:	ba 00 00 00 00       	mov    $0x0,%edx
+  800458:	b8 08 00 00 00       	mov    $0x8,%eax
+  80045d:	0f 05                	syscall
+	if(check && ret > 0)
+  80045f:	48 85 c0             	test   %rax,%rax
+  800462:	7f 01                	jg     800465 <sys_env_set_status+0x24>
+}
+  800464:	c3                   	ret
+{
+  800465:	55                   	push   %rbp
+  800466:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800469:	49 89 c0             	mov    %rax,%r8
+  80046c:	b9 08 00 00 00       	mov    $0x8,%ecx
+  800471:	48 ba ca 13 80 00 00 	movabs $0x8013ca,%rdx
+  800478:	00 00 00 
+  80047b:	be 28 00 00 00       	mov    $0x28,%esi
+  800480:	48 bf e7 13 80 00 00 	movabs $0x8013e7,%rdi
+  800487:	00 00 00 
+  80048a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048f:	49 b9 b0 05 80 00 00 	movabs $0x8005b0,%r9
+  800496:	00 00 00 
+  800499:	41 ff d1             	call   *%r9
+
+000000000080049c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80049c:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80049f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8004a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8004ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004b0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8004b5:	0f 05                	syscall
+	if(check && ret > 0)
+  8004b7:	48 85 c0             	test   %rax,%rax
+  8004ba:	7f 01                	jg     8004bd <sys_env_set_pgfault_upcall+0x21>
+}
+  8004bc:	c3                   	ret
+{
+  8004bd:	55                   	push   %rbp
+  8004be:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004c1:	49 89 c0             	mov    %rax,%r8
+  8004c4:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004c9:	48 ba ca 13 80 00 00 	movabs $0x8013ca,%rdx
+  8004d0:	00 00 00 
+  8004d3:	be 28 00 00 00       	mov    $0x28,%esi
+  8004d8:	48 bf e7 13 80 00 00 	movabs $0x8013e7,%rdi
+  8004df:	00 00 00 
+  8004e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e7:	49 b9 b0 05 80 00 00 	movabs $0x8005b0,%r9
+  8004ee:	00 00 00 
+  8004f1:	41 ff d1             	call   *%r9
+
+00000000008004f4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8004f4:	48 63 ff             	movslq %edi,%rdi
+  8004f7:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  8004fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800500:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800505:	0f 05                	syscall
+}
+  800507:	c3                   	ret
+
+0000000000800508 <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  800508:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80050e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800514:	be 00 00 00 00       	mov    $0x0,%esi
+  800519:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80051e:	48 89 f2             	mov    %rsi,%rdx
+  800521:	0f 05                	syscall
+	if(check && ret > 0)
+  800523:	48 85 c0             	test   %rax,%rax
+  800526:	7f 01                	jg     800529 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  800528:	c3                   	ret
+{
+  800529:	55                   	push   %rbp
+  80052a:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80052d:	49 89 c0             	mov    %rax,%r8
+  800530:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  800535:	48 ba ca 13 80 00 00 	movabs $0x8013ca,%rdx
+  80053c:	00 00 00 
+  80053f:	be 28 00 00 00       	mov    $0x28,%esi
+  800544:	48 bf e7 13 80 00 00 	movabs $0x8013e7,%rdi
+  80054b:	00 00 00 
+  80054e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800553:	49 b9 b0 05 80 00 00 	movabs $0x8005b0,%r9
+  80055a:	00 00 00 
+  80055d:	41 ff d1             	call   *%r9
+
+0000000000800560 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi		// function argument: pointer to UTF
+  800560:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  800563:	48 a1 08 20 80 00 00 	movabs 0x802008,%rax
+  80056a:	00 00 00 
+	call *%rax
+  80056d:	ff d0                	call   *%rax
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here. (Hint. You need to modify the trap time rsp to make room for the return rip ) */
+
+	movq  152(%rsp), %rax
+  80056f:	48 8b 84 24 98 00 00 	mov    0x98(%rsp),%rax
+  800576:	00 
+	subq $8, %rax
+  800577:	48 83 e8 08          	sub    $0x8,%rax
+	movq %rax, 152(%rsp)
+  80057b:	48 89 84 24 98 00 00 	mov    %rax,0x98(%rsp)
+  800582:	00 
+
+	movq 136(%rsp), %rbx
+  800583:	48 8b 9c 24 88 00 00 	mov    0x88(%rsp),%rbx
+  80058a:	00 
+	movq %rbx, (%rax)
+  80058b:	48 89 18             	mov    %rbx,(%rax)
+
+	/* Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here. (Hint, the oposite of _alltraps) */
+
+	addq $16, %rsp
+  80058e:	48 83 c4 10          	add    $0x10,%rsp
+	
+	popq %r15
+  800592:	41 5f                	pop    %r15
+	popq %r14
+  800594:	41 5e                	pop    %r14
+	popq %r13
+  800596:	41 5d                	pop    %r13
+	popq %r12
+  800598:	41 5c                	pop    %r12
+	popq %r11
+  80059a:	41 5b                	pop    %r11
+	popq %r10
+  80059c:	41 5a                	pop    %r10
+	popq %r9
+  80059e:	41 59                	pop    %r9
+	popq %r8
+  8005a0:	41 58                	pop    %r8
+	popq %rsi
+  8005a2:	5e                   	pop    %rsi
+	popq %rdi
+  8005a3:	5f                   	pop    %rdi
+	popq %rbp
+  8005a4:	5d                   	pop    %rbp
+	popq %rdx
+  8005a5:	5a                   	pop    %rdx
+	popq %rcx
+  8005a6:	59                   	pop    %rcx
+	popq %rbx
+  8005a7:	5b                   	pop    %rbx
+	popq %rax
+  8005a8:	58                   	pop    %rax
+
+	addq $8, %rsp
+  8005a9:	48 83 c4 08          	add    $0x8,%rsp
+	/* Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 4: Your code here. */
+
+	popfq
+  8005ad:	9d                   	popf
+
+	/* Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here. */
+
+	popq %rsp
+  8005ae:	5c                   	pop    %rsp
+
+	/* Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here. */
+  8005af:	c3                   	ret
+
+00000000008005b0 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8005b0:	55                   	push   %rbp
+  8005b1:	48 89 e5             	mov    %rsp,%rbp
+  8005b4:	41 56                	push   %r14
+  8005b6:	41 55                	push   %r13
+  8005b8:	41 54                	push   %r12
+  8005ba:	53                   	push   %rbx
+  8005bb:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8005c2:	49 89 fc             	mov    %rdi,%r12
+  8005c5:	41 89 f5             	mov    %esi,%r13d
+  8005c8:	48 89 d3             	mov    %rdx,%rbx
+  8005cb:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8005d2:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8005d9:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8005e0:	84 c0                	test   %al,%al
+  8005e2:	74 26                	je     80060a <_panic+0x5a>
+  8005e4:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8005eb:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8005f2:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8005f6:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8005fa:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8005fe:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800602:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800606:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80060a:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800611:	00 00 00 
+  800614:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  80061b:	00 00 00 
+  80061e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800622:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800629:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800630:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800637:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  80063e:	00 00 00 
+  800641:	4c 8b 30             	mov    (%rax),%r14
+  800644:	48 b8 38 01 80 00 00 	movabs $0x800138,%rax
+  80064b:	00 00 00 
+  80064e:	ff d0                	call   *%rax
+  800650:	89 c6                	mov    %eax,%esi
+  800652:	45 89 e8             	mov    %r13d,%r8d
+  800655:	4c 89 e1             	mov    %r12,%rcx
+  800658:	4c 89 f2             	mov    %r14,%rdx
+  80065b:	48 bf f8 13 80 00 00 	movabs $0x8013f8,%rdi
+  800662:	00 00 00 
+  800665:	b8 00 00 00 00       	mov    $0x0,%eax
+  80066a:	49 bc 4f 07 80 00 00 	movabs $0x80074f,%r12
+  800671:	00 00 00 
+  800674:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800677:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  80067e:	48 89 df             	mov    %rbx,%rdi
+  800681:	48 b8 eb 06 80 00 00 	movabs $0x8006eb,%rax
+  800688:	00 00 00 
+  80068b:	ff d0                	call   *%rax
+	cprintf("\n");
+  80068d:	48 bf 1b 14 80 00 00 	movabs $0x80141b,%rdi
+  800694:	00 00 00 
+  800697:	b8 00 00 00 00       	mov    $0x0,%eax
+  80069c:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80069f:	cc                   	int3
+	while (1)
+  8006a0:	eb fd                	jmp    80069f <_panic+0xef>
+
+00000000008006a2 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8006a2:	55                   	push   %rbp
+  8006a3:	48 89 e5             	mov    %rsp,%rbp
+  8006a6:	53                   	push   %rbx
+  8006a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8006ab:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  8006ae:	8b 06                	mov    (%rsi),%eax
+  8006b0:	8d 50 01             	lea    0x1(%rax),%edx
+  8006b3:	89 16                	mov    %edx,(%rsi)
+  8006b5:	48 98                	cltq
+  8006b7:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  8006bc:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8006c2:	74 0a                	je     8006ce <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8006c4:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8006c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006cc:	c9                   	leave
+  8006cd:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8006ce:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8006d2:	be ff 00 00 00       	mov    $0xff,%esi
+  8006d7:	48 b8 a5 00 80 00 00 	movabs $0x8000a5,%rax
+  8006de:	00 00 00 
+  8006e1:	ff d0                	call   *%rax
+		b->idx = 0;
+  8006e3:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8006e9:	eb d9                	jmp    8006c4 <putch+0x22>
+
+00000000008006eb <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8006eb:	55                   	push   %rbp
+  8006ec:	48 89 e5             	mov    %rsp,%rbp
+  8006ef:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8006f6:	48 89 fa             	mov    %rdi,%rdx
+  8006f9:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  8006fc:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800703:	00 00 00 
+	b.cnt = 0;
+  800706:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80070d:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800710:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  800717:	48 bf a2 06 80 00 00 	movabs $0x8006a2,%rdi
+  80071e:	00 00 00 
+  800721:	48 b8 09 09 80 00 00 	movabs $0x800909,%rax
+  800728:	00 00 00 
+  80072b:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  80072d:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  800734:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80073b:	48 b8 a5 00 80 00 00 	movabs $0x8000a5,%rax
+  800742:	00 00 00 
+  800745:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  800747:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  80074d:	c9                   	leave
+  80074e:	c3                   	ret
+
+000000000080074f <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80074f:	55                   	push   %rbp
+  800750:	48 89 e5             	mov    %rsp,%rbp
+  800753:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80075a:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800761:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800768:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80076f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800776:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80077d:	84 c0                	test   %al,%al
+  80077f:	74 20                	je     8007a1 <cprintf+0x52>
+  800781:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800785:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800789:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80078d:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800791:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800795:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800799:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80079d:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8007a1:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  8007a8:	00 00 00 
+  8007ab:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8007b2:	00 00 00 
+  8007b5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007b9:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8007c0:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8007c7:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  8007ce:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  8007d5:	48 b8 eb 06 80 00 00 	movabs $0x8006eb,%rax
+  8007dc:	00 00 00 
+  8007df:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  8007e1:	c9                   	leave
+  8007e2:	c3                   	ret
+
+00000000008007e3 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8007e3:	55                   	push   %rbp
+  8007e4:	48 89 e5             	mov    %rsp,%rbp
+  8007e7:	41 57                	push   %r15
+  8007e9:	41 56                	push   %r14
+  8007eb:	41 55                	push   %r13
+  8007ed:	41 54                	push   %r12
+  8007ef:	53                   	push   %rbx
+  8007f0:	48 83 ec 18          	sub    $0x18,%rsp
+  8007f4:	49 89 fc             	mov    %rdi,%r12
+  8007f7:	49 89 f5             	mov    %rsi,%r13
+  8007fa:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8007fe:	44 89 c3             	mov    %r8d,%ebx
+  800801:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800804:	41 89 cf             	mov    %ecx,%r15d
+  800807:	4c 39 fa             	cmp    %r15,%rdx
+  80080a:	72 29                	jb     800835 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80080c:	48 89 d0             	mov    %rdx,%rax
+  80080f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800814:	49 f7 f7             	div    %r15
+  800817:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80081b:	48 89 c2             	mov    %rax,%rdx
+  80081e:	48 b8 e3 07 80 00 00 	movabs $0x8007e3,%rax
+  800825:	00 00 00 
+  800828:	ff d0                	call   *%rax
+  80082a:	eb 10                	jmp    80083c <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80082c:	4c 89 ee             	mov    %r13,%rsi
+  80082f:	44 89 f7             	mov    %r14d,%edi
+  800832:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  800835:	83 eb 01             	sub    $0x1,%ebx
+  800838:	85 db                	test   %ebx,%ebx
+  80083a:	7f f0                	jg     80082c <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80083c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800840:	ba 00 00 00 00       	mov    $0x0,%edx
+  800845:	49 f7 f7             	div    %r15
+  800848:	48 b8 1d 14 80 00 00 	movabs $0x80141d,%rax
+  80084f:	00 00 00 
+  800852:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  800856:	4c 89 ee             	mov    %r13,%rsi
+  800859:	41 ff d4             	call   *%r12
+}
+  80085c:	48 83 c4 18          	add    $0x18,%rsp
+  800860:	5b                   	pop    %rbx
+  800861:	41 5c                	pop    %r12
+  800863:	41 5d                	pop    %r13
+  800865:	41 5e                	pop    %r14
+  800867:	41 5f                	pop    %r15
+  800869:	5d                   	pop    %rbp
+  80086a:	c3                   	ret
+
+000000000080086b <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  80086b:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  80086f:	48 8b 06             	mov    (%rsi),%rax
+  800872:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800876:	73 0a                	jae    800882 <sprintputch+0x17>
+		*b->buf++ = ch;
+  800878:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80087c:	48 89 16             	mov    %rdx,(%rsi)
+  80087f:	40 88 38             	mov    %dil,(%rax)
+}
+  800882:	c3                   	ret
+
+0000000000800883 <printfmt>:
+{
+  800883:	55                   	push   %rbp
+  800884:	48 89 e5             	mov    %rsp,%rbp
+  800887:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80088e:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800895:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80089c:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8008a3:	84 c0                	test   %al,%al
+  8008a5:	74 20                	je     8008c7 <printfmt+0x44>
+  8008a7:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8008ab:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8008af:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8008b3:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8008b7:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8008bb:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8008bf:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8008c3:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  8008c7:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8008ce:	00 00 00 
+  8008d1:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8008d8:	00 00 00 
+  8008db:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8008df:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8008e6:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8008ed:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8008f4:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8008fb:	48 b8 09 09 80 00 00 	movabs $0x800909,%rax
+  800902:	00 00 00 
+  800905:	ff d0                	call   *%rax
+}
+  800907:	c9                   	leave
+  800908:	c3                   	ret
+
+0000000000800909 <vprintfmt>:
+{
+  800909:	55                   	push   %rbp
+  80090a:	48 89 e5             	mov    %rsp,%rbp
+  80090d:	41 57                	push   %r15
+  80090f:	41 56                	push   %r14
+  800911:	41 55                	push   %r13
+  800913:	41 54                	push   %r12
+  800915:	53                   	push   %rbx
+  800916:	48 83 ec 48          	sub    $0x48,%rsp
+  80091a:	49 89 fe             	mov    %rdi,%r14
+  80091d:	49 89 f5             	mov    %rsi,%r13
+  800920:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  800923:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  800927:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  80092b:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80092f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  800933:	eb 09                	jmp    80093e <vprintfmt+0x35>
+			putch(ch, putdat);
+  800935:	4c 89 ee             	mov    %r13,%rsi
+  800938:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80093b:	4c 89 e3             	mov    %r12,%rbx
+  80093e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800942:	0f b6 3b             	movzbl (%rbx),%edi
+  800945:	83 ff 25             	cmp    $0x25,%edi
+  800948:	74 13                	je     80095d <vprintfmt+0x54>
+			if (ch == '\0')
+  80094a:	85 ff                	test   %edi,%edi
+  80094c:	75 e7                	jne    800935 <vprintfmt+0x2c>
+}
+  80094e:	48 83 c4 48          	add    $0x48,%rsp
+  800952:	5b                   	pop    %rbx
+  800953:	41 5c                	pop    %r12
+  800955:	41 5d                	pop    %r13
+  800957:	41 5e                	pop    %r14
+  800959:	41 5f                	pop    %r15
+  80095b:	5d                   	pop    %rbp
+  80095c:	c3                   	ret
+		padc = ' ';
+  80095d:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  800961:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  800968:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  80096e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  800975:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80097a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80097f:	41 0f b6 14 24       	movzbl (%r12),%edx
+  800984:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  800987:	3c 55                	cmp    $0x55,%al
+  800989:	0f 87 4f 05 00 00    	ja     800ede <vprintfmt+0x5d5>
+  80098f:	0f b6 c0             	movzbl %al,%eax
+  800992:	48 be e0 14 80 00 00 	movabs $0x8014e0,%rsi
+  800999:	00 00 00 
+  80099c:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  80099f:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  8009a2:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  8009a6:	eb d2                	jmp    80097a <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8009a8:	49 89 dc             	mov    %rbx,%r12
+  8009ab:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  8009af:	eb c9                	jmp    80097a <vprintfmt+0x71>
+  8009b1:	0f b6 d2             	movzbl %dl,%edx
+  8009b4:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  8009b7:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  8009bd:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  8009c1:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  8009c6:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  8009cb:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  8009ce:	83 f8 09             	cmp    $0x9,%eax
+  8009d1:	77 20                	ja     8009f3 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  8009d3:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  8009d7:	eb e4                	jmp    8009bd <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  8009d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009df:	77 27                	ja     800a08 <vprintfmt+0xff>
+  8009e1:	89 c2                	mov    %eax,%edx
+  8009e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e7:	83 c0 08             	add    $0x8,%eax
+  8009ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ed:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  8009f0:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  8009f3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009f7:	79 81                	jns    80097a <vprintfmt+0x71>
+				width = precision, precision = -1;
+  8009f9:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  8009fd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800a03:	e9 72 ff ff ff       	jmp    80097a <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  800a08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a14:	eb d7                	jmp    8009ed <vprintfmt+0xe4>
+			if (width < 0)
+  800a16:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  800a19:	85 f6                	test   %esi,%esi
+  800a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a20:	0f 49 c6             	cmovns %esi,%eax
+  800a23:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800a26:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800a29:	e9 4c ff ff ff       	jmp    80097a <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800a2e:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  800a31:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  800a38:	e9 3d ff ff ff       	jmp    80097a <vprintfmt+0x71>
+			lflag++;
+  800a3d:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800a40:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800a43:	e9 32 ff ff ff       	jmp    80097a <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  800a48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4e:	77 19                	ja     800a69 <vprintfmt+0x160>
+  800a50:	89 c2                	mov    %eax,%edx
+  800a52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a56:	83 c0 08             	add    $0x8,%eax
+  800a59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5c:	8b 3a                	mov    (%rdx),%edi
+  800a5e:	4c 89 ee             	mov    %r13,%rsi
+  800a61:	41 ff d6             	call   *%r14
+			break;
+  800a64:	e9 d5 fe ff ff       	jmp    80093e <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  800a69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a75:	eb e5                	jmp    800a5c <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  800a77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a7a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7d:	77 5a                	ja     800ad9 <vprintfmt+0x1d0>
+  800a7f:	89 c2                	mov    %eax,%edx
+  800a81:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a85:	83 c0 08             	add    $0x8,%eax
+  800a88:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800a8b:	8b 02                	mov    (%rdx),%eax
+  800a8d:	89 c1                	mov    %eax,%ecx
+  800a8f:	f7 d9                	neg    %ecx
+  800a91:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a94:	83 f9 08             	cmp    $0x8,%ecx
+  800a97:	7f 4e                	jg     800ae7 <vprintfmt+0x1de>
+  800a99:	48 63 c1             	movslq %ecx,%rax
+  800a9c:	48 ba a0 17 80 00 00 	movabs $0x8017a0,%rdx
+  800aa3:	00 00 00 
+  800aa6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800aaa:	48 85 c0             	test   %rax,%rax
+  800aad:	74 38                	je     800ae7 <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800aaf:	48 89 c1             	mov    %rax,%rcx
+  800ab2:	48 ba 3e 14 80 00 00 	movabs $0x80143e,%rdx
+  800ab9:	00 00 00 
+  800abc:	4c 89 ee             	mov    %r13,%rsi
+  800abf:	4c 89 f7             	mov    %r14,%rdi
+  800ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac7:	49 b8 83 08 80 00 00 	movabs $0x800883,%r8
+  800ace:	00 00 00 
+  800ad1:	41 ff d0             	call   *%r8
+  800ad4:	e9 65 fe ff ff       	jmp    80093e <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  800ad9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800add:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae5:	eb a4                	jmp    800a8b <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  800ae7:	48 ba 35 14 80 00 00 	movabs $0x801435,%rdx
+  800aee:	00 00 00 
+  800af1:	4c 89 ee             	mov    %r13,%rsi
+  800af4:	4c 89 f7             	mov    %r14,%rdi
+  800af7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800afc:	49 b8 83 08 80 00 00 	movabs $0x800883,%r8
+  800b03:	00 00 00 
+  800b06:	41 ff d0             	call   *%r8
+  800b09:	e9 30 fe ff ff       	jmp    80093e <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800b0e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b11:	83 f8 2f             	cmp    $0x2f,%eax
+  800b14:	77 36                	ja     800b4c <vprintfmt+0x243>
+  800b16:	89 c2                	mov    %eax,%edx
+  800b18:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b1c:	83 c0 08             	add    $0x8,%eax
+  800b1f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b22:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800b25:	48 85 c9             	test   %rcx,%rcx
+  800b28:	48 b8 2e 14 80 00 00 	movabs $0x80142e,%rax
+  800b2f:	00 00 00 
+  800b32:	48 0f 45 c1          	cmovne %rcx,%rax
+  800b36:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800b3a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b3e:	7e 06                	jle    800b46 <vprintfmt+0x23d>
+  800b40:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800b44:	75 14                	jne    800b5a <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b46:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800b4a:	eb 64                	jmp    800bb0 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800b4c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b50:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b58:	eb c8                	jmp    800b22 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b5a:	49 63 f7             	movslq %r15d,%rsi
+  800b5d:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800b61:	48 b8 ec 0f 80 00 00 	movabs $0x800fec,%rax
+  800b68:	00 00 00 
+  800b6b:	ff d0                	call   *%rax
+  800b6d:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800b70:	29 c1                	sub    %eax,%ecx
+  800b72:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800b75:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  800b78:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800b7c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b7f:	eb 0d                	jmp    800b8e <vprintfmt+0x285>
+					putch(padc, putdat);
+  800b81:	4c 89 ee             	mov    %r13,%rsi
+  800b84:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  800b87:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b8a:	41 83 ec 01          	sub    $0x1,%r12d
+  800b8e:	45 85 e4             	test   %r12d,%r12d
+  800b91:	7f ee                	jg     800b81 <vprintfmt+0x278>
+  800b93:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  800b96:	85 c9                	test   %ecx,%ecx
+  800b98:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9d:	0f 49 c1             	cmovns %ecx,%eax
+  800ba0:	29 c1                	sub    %eax,%ecx
+  800ba2:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  800ba5:	eb 9f                	jmp    800b46 <vprintfmt+0x23d>
+					putch(ch, putdat);
+  800ba7:	4c 89 ee             	mov    %r13,%rsi
+  800baa:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800bad:	4c 89 e2             	mov    %r12,%rdx
+  800bb0:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800bb4:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800bba:	0f be f8             	movsbl %al,%edi
+  800bbd:	85 ff                	test   %edi,%edi
+  800bbf:	74 29                	je     800bea <vprintfmt+0x2e1>
+  800bc1:	45 85 ff             	test   %r15d,%r15d
+  800bc4:	78 06                	js     800bcc <vprintfmt+0x2c3>
+  800bc6:	41 83 ef 01          	sub    $0x1,%r15d
+  800bca:	78 1e                	js     800bea <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800bcc:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800bd0:	74 d5                	je     800ba7 <vprintfmt+0x29e>
+  800bd2:	0f be c0             	movsbl %al,%eax
+  800bd5:	83 e8 20             	sub    $0x20,%eax
+  800bd8:	83 f8 5e             	cmp    $0x5e,%eax
+  800bdb:	76 ca                	jbe    800ba7 <vprintfmt+0x29e>
+					putch('?', putdat);
+  800bdd:	4c 89 ee             	mov    %r13,%rsi
+  800be0:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800be5:	41 ff d6             	call   *%r14
+  800be8:	eb c3                	jmp    800bad <vprintfmt+0x2a4>
+  800bea:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800bee:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800bf1:	41 01 c4             	add    %eax,%r12d
+  800bf4:	41 29 d4             	sub    %edx,%r12d
+  800bf7:	eb 0f                	jmp    800c08 <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  800bf9:	4c 89 ee             	mov    %r13,%rsi
+  800bfc:	bf 20 00 00 00       	mov    $0x20,%edi
+  800c01:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800c04:	41 83 ec 01          	sub    $0x1,%r12d
+  800c08:	45 85 e4             	test   %r12d,%r12d
+  800c0b:	7f ec                	jg     800bf9 <vprintfmt+0x2f0>
+  800c0d:	e9 2c fd ff ff       	jmp    80093e <vprintfmt+0x35>
+	if (lflag >= 2)
+  800c12:	83 f9 01             	cmp    $0x1,%ecx
+  800c15:	7f 1d                	jg     800c34 <vprintfmt+0x32b>
+	else if (lflag)
+  800c17:	85 c9                	test   %ecx,%ecx
+  800c19:	74 5e                	je     800c79 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800c1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c21:	77 48                	ja     800c6b <vprintfmt+0x362>
+  800c23:	89 c2                	mov    %eax,%edx
+  800c25:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c29:	83 c0 08             	add    $0x8,%eax
+  800c2c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c2f:	4c 8b 22             	mov    (%rdx),%r12
+  800c32:	eb 17                	jmp    800c4b <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800c34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c37:	83 f8 2f             	cmp    $0x2f,%eax
+  800c3a:	77 21                	ja     800c5d <vprintfmt+0x354>
+  800c3c:	89 c2                	mov    %eax,%edx
+  800c3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c42:	83 c0 08             	add    $0x8,%eax
+  800c45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c48:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800c4b:	4d 85 e4             	test   %r12,%r12
+  800c4e:	78 50                	js     800ca0 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  800c50:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800c53:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800c58:	e9 b4 01 00 00       	jmp    800e11 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800c5d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c61:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c69:	eb dd                	jmp    800c48 <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800c6b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c6f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c77:	eb b6                	jmp    800c2f <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800c79:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c7c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7f:	77 11                	ja     800c92 <vprintfmt+0x389>
+  800c81:	89 c2                	mov    %eax,%edx
+  800c83:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c87:	83 c0 08             	add    $0x8,%eax
+  800c8a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c8d:	4c 63 22             	movslq (%rdx),%r12
+  800c90:	eb b9                	jmp    800c4b <vprintfmt+0x342>
+  800c92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c9e:	eb ed                	jmp    800c8d <vprintfmt+0x384>
+				putch('-', putdat);
+  800ca0:	4c 89 ee             	mov    %r13,%rsi
+  800ca3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ca8:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800cab:	4c 89 e2             	mov    %r12,%rdx
+  800cae:	48 f7 da             	neg    %rdx
+			base = 10;
+  800cb1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800cb6:	e9 56 01 00 00       	jmp    800e11 <vprintfmt+0x508>
+	if (lflag >= 2)
+  800cbb:	83 f9 01             	cmp    $0x1,%ecx
+  800cbe:	7f 25                	jg     800ce5 <vprintfmt+0x3dc>
+	else if (lflag)
+  800cc0:	85 c9                	test   %ecx,%ecx
+  800cc2:	74 5e                	je     800d22 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800cc4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cc7:	83 f8 2f             	cmp    $0x2f,%eax
+  800cca:	77 48                	ja     800d14 <vprintfmt+0x40b>
+  800ccc:	89 c2                	mov    %eax,%edx
+  800cce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cd2:	83 c0 08             	add    $0x8,%eax
+  800cd5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd8:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800cdb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800ce0:	e9 2c 01 00 00       	jmp    800e11 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800ce5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce8:	83 f8 2f             	cmp    $0x2f,%eax
+  800ceb:	77 19                	ja     800d06 <vprintfmt+0x3fd>
+  800ced:	89 c2                	mov    %eax,%edx
+  800cef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cf3:	83 c0 08             	add    $0x8,%eax
+  800cf6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf9:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800cfc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800d01:	e9 0b 01 00 00       	jmp    800e11 <vprintfmt+0x508>
+  800d06:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d0a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d0e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d12:	eb e5                	jmp    800cf9 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800d14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d20:	eb b6                	jmp    800cd8 <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800d22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d25:	83 f8 2f             	cmp    $0x2f,%eax
+  800d28:	77 18                	ja     800d42 <vprintfmt+0x439>
+  800d2a:	89 c2                	mov    %eax,%edx
+  800d2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d30:	83 c0 08             	add    $0x8,%eax
+  800d33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d36:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800d38:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800d3d:	e9 cf 00 00 00       	jmp    800e11 <vprintfmt+0x508>
+  800d42:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d46:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d4a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d4e:	eb e6                	jmp    800d36 <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800d50:	83 f9 01             	cmp    $0x1,%ecx
+  800d53:	7f 25                	jg     800d7a <vprintfmt+0x471>
+	else if (lflag)
+  800d55:	85 c9                	test   %ecx,%ecx
+  800d57:	74 5b                	je     800db4 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800d59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d5c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d5f:	77 45                	ja     800da6 <vprintfmt+0x49d>
+  800d61:	89 c2                	mov    %eax,%edx
+  800d63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d67:	83 c0 08             	add    $0x8,%eax
+  800d6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d6d:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800d70:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800d75:	e9 97 00 00 00       	jmp    800e11 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800d7a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d7d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d80:	77 16                	ja     800d98 <vprintfmt+0x48f>
+  800d82:	89 c2                	mov    %eax,%edx
+  800d84:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d88:	83 c0 08             	add    $0x8,%eax
+  800d8b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d8e:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800d91:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800d96:	eb 79                	jmp    800e11 <vprintfmt+0x508>
+  800d98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800da0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800da4:	eb e8                	jmp    800d8e <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800da6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800daa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800db2:	eb b9                	jmp    800d6d <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800db4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800db7:	83 f8 2f             	cmp    $0x2f,%eax
+  800dba:	77 15                	ja     800dd1 <vprintfmt+0x4c8>
+  800dbc:	89 c2                	mov    %eax,%edx
+  800dbe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dc2:	83 c0 08             	add    $0x8,%eax
+  800dc5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dc8:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800dca:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800dcf:	eb 40                	jmp    800e11 <vprintfmt+0x508>
+  800dd1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dd5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dd9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ddd:	eb e9                	jmp    800dc8 <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800ddf:	4c 89 ee             	mov    %r13,%rsi
+  800de2:	bf 30 00 00 00       	mov    $0x30,%edi
+  800de7:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800dea:	4c 89 ee             	mov    %r13,%rsi
+  800ded:	bf 78 00 00 00       	mov    $0x78,%edi
+  800df2:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800df5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800df8:	83 f8 2f             	cmp    $0x2f,%eax
+  800dfb:	77 34                	ja     800e31 <vprintfmt+0x528>
+  800dfd:	89 c2                	mov    %eax,%edx
+  800dff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e03:	83 c0 08             	add    $0x8,%eax
+  800e06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800e09:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800e0c:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800e11:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800e16:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800e1a:	4c 89 ee             	mov    %r13,%rsi
+  800e1d:	4c 89 f7             	mov    %r14,%rdi
+  800e20:	48 b8 e3 07 80 00 00 	movabs $0x8007e3,%rax
+  800e27:	00 00 00 
+  800e2a:	ff d0                	call   *%rax
+			break;
+  800e2c:	e9 0d fb ff ff       	jmp    80093e <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800e31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e3d:	eb ca                	jmp    800e09 <vprintfmt+0x500>
+	if (lflag >= 2)
+  800e3f:	83 f9 01             	cmp    $0x1,%ecx
+  800e42:	7f 22                	jg     800e66 <vprintfmt+0x55d>
+	else if (lflag)
+  800e44:	85 c9                	test   %ecx,%ecx
+  800e46:	74 58                	je     800ea0 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800e48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e4b:	83 f8 2f             	cmp    $0x2f,%eax
+  800e4e:	77 42                	ja     800e92 <vprintfmt+0x589>
+  800e50:	89 c2                	mov    %eax,%edx
+  800e52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e56:	83 c0 08             	add    $0x8,%eax
+  800e59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e5c:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800e5f:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800e64:	eb ab                	jmp    800e11 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800e66:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e69:	83 f8 2f             	cmp    $0x2f,%eax
+  800e6c:	77 16                	ja     800e84 <vprintfmt+0x57b>
+  800e6e:	89 c2                	mov    %eax,%edx
+  800e70:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e74:	83 c0 08             	add    $0x8,%eax
+  800e77:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e7a:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800e7d:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800e82:	eb 8d                	jmp    800e11 <vprintfmt+0x508>
+  800e84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e88:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e8c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e90:	eb e8                	jmp    800e7a <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800e92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e9e:	eb bc                	jmp    800e5c <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800ea0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ea3:	83 f8 2f             	cmp    $0x2f,%eax
+  800ea6:	77 18                	ja     800ec0 <vprintfmt+0x5b7>
+  800ea8:	89 c2                	mov    %eax,%edx
+  800eaa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800eae:	83 c0 08             	add    $0x8,%eax
+  800eb1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800eb4:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800eb6:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800ebb:	e9 51 ff ff ff       	jmp    800e11 <vprintfmt+0x508>
+  800ec0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ec4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ec8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ecc:	eb e6                	jmp    800eb4 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800ece:	4c 89 ee             	mov    %r13,%rsi
+  800ed1:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ed6:	41 ff d6             	call   *%r14
+			break;
+  800ed9:	e9 60 fa ff ff       	jmp    80093e <vprintfmt+0x35>
+			putch('%', putdat);
+  800ede:	4c 89 ee             	mov    %r13,%rsi
+  800ee1:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ee6:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800ee9:	4c 89 e3             	mov    %r12,%rbx
+  800eec:	eb 04                	jmp    800ef2 <vprintfmt+0x5e9>
+  800eee:	48 83 eb 01          	sub    $0x1,%rbx
+  800ef2:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ef6:	75 f6                	jne    800eee <vprintfmt+0x5e5>
+  800ef8:	e9 41 fa ff ff       	jmp    80093e <vprintfmt+0x35>
+
+0000000000800efd <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800efd:	55                   	push   %rbp
+  800efe:	48 89 e5             	mov    %rsp,%rbp
+  800f01:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800f05:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800f09:	48 63 c6             	movslq %esi,%rax
+  800f0c:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800f11:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800f15:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800f1c:	48 85 ff             	test   %rdi,%rdi
+  800f1f:	74 2a                	je     800f4b <vsnprintf+0x4e>
+  800f21:	85 f6                	test   %esi,%esi
+  800f23:	7e 26                	jle    800f4b <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800f25:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800f29:	48 bf 6b 08 80 00 00 	movabs $0x80086b,%rdi
+  800f30:	00 00 00 
+  800f33:	48 b8 09 09 80 00 00 	movabs $0x800909,%rax
+  800f3a:	00 00 00 
+  800f3d:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800f3f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800f43:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800f46:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800f49:	c9                   	leave
+  800f4a:	c3                   	ret
+		return -E_INVAL;
+  800f4b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f50:	eb f7                	jmp    800f49 <vsnprintf+0x4c>
+
+0000000000800f52 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800f52:	55                   	push   %rbp
+  800f53:	48 89 e5             	mov    %rsp,%rbp
+  800f56:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800f5d:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f64:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f6b:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f72:	84 c0                	test   %al,%al
+  800f74:	74 20                	je     800f96 <snprintf+0x44>
+  800f76:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f7a:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f7e:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f82:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f86:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f8a:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f8e:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f92:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800f96:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f9d:	00 00 00 
+  800fa0:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800fa7:	00 00 00 
+  800faa:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800fae:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800fb5:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800fbc:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800fc3:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800fca:	48 b8 fd 0e 80 00 00 	movabs $0x800efd,%rax
+  800fd1:	00 00 00 
+  800fd4:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800fd6:	c9                   	leave
+  800fd7:	c3                   	ret
+
+0000000000800fd8 <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800fd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fdd:	48 89 d0             	mov    %rdx,%rax
+  800fe0:	48 83 c2 01          	add    $0x1,%rdx
+  800fe4:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800fe9:	75 f2                	jne    800fdd <strlen+0x5>
+		n++;
+	return n;
+}
+  800feb:	c3                   	ret
+
+0000000000800fec <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800fec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff1:	eb 03                	jmp    800ff6 <strnlen+0xa>
+  800ff3:	48 89 d0             	mov    %rdx,%rax
+  800ff6:	48 39 c6             	cmp    %rax,%rsi
+  800ff9:	74 0a                	je     801005 <strnlen+0x19>
+  800ffb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800fff:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801003:	75 ee                	jne    800ff3 <strnlen+0x7>
+		n++;
+	return n;
+}
+  801005:	c3                   	ret
+
+0000000000801006 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801006:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801009:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100e:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801012:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801015:	48 83 c2 01          	add    $0x1,%rdx
+  801019:	84 c9                	test   %cl,%cl
+  80101b:	75 f1                	jne    80100e <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  80101d:	c3                   	ret
+
+000000000080101e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80101e:	55                   	push   %rbp
+  80101f:	48 89 e5             	mov    %rsp,%rbp
+  801022:	41 54                	push   %r12
+  801024:	53                   	push   %rbx
+  801025:	48 89 fb             	mov    %rdi,%rbx
+  801028:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  80102b:	48 b8 d8 0f 80 00 00 	movabs $0x800fd8,%rax
+  801032:	00 00 00 
+  801035:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  801037:	48 63 f8             	movslq %eax,%rdi
+  80103a:	48 01 df             	add    %rbx,%rdi
+  80103d:	4c 89 e6             	mov    %r12,%rsi
+  801040:	48 b8 06 10 80 00 00 	movabs $0x801006,%rax
+  801047:	00 00 00 
+  80104a:	ff d0                	call   *%rax
+	return dst;
+}
+  80104c:	48 89 d8             	mov    %rbx,%rax
+  80104f:	5b                   	pop    %rbx
+  801050:	41 5c                	pop    %r12
+  801052:	5d                   	pop    %rbp
+  801053:	c3                   	ret
+
+0000000000801054 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801054:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801057:	48 01 fa             	add    %rdi,%rdx
+  80105a:	48 89 f9             	mov    %rdi,%rcx
+  80105d:	eb 14                	jmp    801073 <strncpy+0x1f>
+		*dst++ = *src;
+  80105f:	48 83 c1 01          	add    $0x1,%rcx
+  801063:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801067:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80106b:	41 80 f8 01          	cmp    $0x1,%r8b
+  80106f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  801073:	48 39 d1             	cmp    %rdx,%rcx
+  801076:	75 e7                	jne    80105f <strncpy+0xb>
+	}
+	return ret;
+}
+  801078:	c3                   	ret
+
+0000000000801079 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801079:	48 89 f8             	mov    %rdi,%rax
+  80107c:	48 85 d2             	test   %rdx,%rdx
+  80107f:	74 27                	je     8010a8 <strlcpy+0x2f>
+  801081:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  801086:	48 89 fa             	mov    %rdi,%rdx
+  801089:	eb 0b                	jmp    801096 <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80108b:	48 83 c6 01          	add    $0x1,%rsi
+  80108f:	48 83 c2 01          	add    $0x1,%rdx
+  801093:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  801096:	48 39 c2             	cmp    %rax,%rdx
+  801099:	74 0a                	je     8010a5 <strlcpy+0x2c>
+  80109b:	0f b6 0e             	movzbl (%rsi),%ecx
+  80109e:	84 c9                	test   %cl,%cl
+  8010a0:	75 e9                	jne    80108b <strlcpy+0x12>
+  8010a2:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  8010a5:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8010a8:	48 29 f8             	sub    %rdi,%rax
+}
+  8010ab:	c3                   	ret
+
+00000000008010ac <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  8010ac:	eb 08                	jmp    8010b6 <strcmp+0xa>
+		p++, q++;
+  8010ae:	48 83 c7 01          	add    $0x1,%rdi
+  8010b2:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  8010b6:	0f b6 07             	movzbl (%rdi),%eax
+  8010b9:	84 c0                	test   %al,%al
+  8010bb:	74 04                	je     8010c1 <strcmp+0x15>
+  8010bd:	3a 06                	cmp    (%rsi),%al
+  8010bf:	74 ed                	je     8010ae <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8010c1:	0f b6 c0             	movzbl %al,%eax
+  8010c4:	0f b6 16             	movzbl (%rsi),%edx
+  8010c7:	29 d0                	sub    %edx,%eax
+}
+  8010c9:	c3                   	ret
+
+00000000008010ca <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  8010ca:	eb 0c                	jmp    8010d8 <strncmp+0xe>
+		n--, p++, q++;
+  8010cc:	48 83 ea 01          	sub    $0x1,%rdx
+  8010d0:	48 83 c7 01          	add    $0x1,%rdi
+  8010d4:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  8010d8:	48 85 d2             	test   %rdx,%rdx
+  8010db:	74 14                	je     8010f1 <strncmp+0x27>
+  8010dd:	0f b6 07             	movzbl (%rdi),%eax
+  8010e0:	84 c0                	test   %al,%al
+  8010e2:	74 04                	je     8010e8 <strncmp+0x1e>
+  8010e4:	3a 06                	cmp    (%rsi),%al
+  8010e6:	74 e4                	je     8010cc <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8010e8:	0f b6 07             	movzbl (%rdi),%eax
+  8010eb:	0f b6 16             	movzbl (%rsi),%edx
+  8010ee:	29 d0                	sub    %edx,%eax
+}
+  8010f0:	c3                   	ret
+		return 0;
+  8010f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f6:	c3                   	ret
+
+00000000008010f7 <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  8010f7:	eb 04                	jmp    8010fd <strchr+0x6>
+  8010f9:	48 83 c7 01          	add    $0x1,%rdi
+  8010fd:	0f b6 07             	movzbl (%rdi),%eax
+  801100:	84 c0                	test   %al,%al
+  801102:	74 09                	je     80110d <strchr+0x16>
+		if (*s == c)
+  801104:	40 38 f0             	cmp    %sil,%al
+  801107:	75 f0                	jne    8010f9 <strchr+0x2>
+  801109:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  80110c:	c3                   	ret
+	return 0;
+  80110d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801112:	c3                   	ret
+
+0000000000801113 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801113:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  801116:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  801119:	40 38 f2             	cmp    %sil,%dl
+  80111c:	74 0a                	je     801128 <strfind+0x15>
+  80111e:	84 d2                	test   %dl,%dl
+  801120:	74 06                	je     801128 <strfind+0x15>
+	for (; *s; s++)
+  801122:	48 83 c0 01          	add    $0x1,%rax
+  801126:	eb ee                	jmp    801116 <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  801128:	c3                   	ret
+
+0000000000801129 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  801129:	48 85 d2             	test   %rdx,%rdx
+  80112c:	74 28                	je     801156 <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  80112e:	48 89 f8             	mov    %rdi,%rax
+  801131:	48 09 d0             	or     %rdx,%rax
+  801134:	a8 03                	test   $0x3,%al
+  801136:	75 16                	jne    80114e <memset+0x25>
+		c &= 0xFF;
+  801138:	40 0f b6 f6          	movzbl %sil,%esi
+  80113c:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801142:	48 89 d1             	mov    %rdx,%rcx
+  801145:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  801149:	fc                   	cld
+  80114a:	f3 ab                	rep stos %eax,%es:(%rdi)
+  80114c:	eb 08                	jmp    801156 <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80114e:	89 f0                	mov    %esi,%eax
+  801150:	48 89 d1             	mov    %rdx,%rcx
+  801153:	fc                   	cld
+  801154:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801156:	48 89 f8             	mov    %rdi,%rax
+  801159:	c3                   	ret
+
+000000000080115a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80115a:	48 89 f8             	mov    %rdi,%rax
+  80115d:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801160:	48 39 fe             	cmp    %rdi,%rsi
+  801163:	73 3a                	jae    80119f <memmove+0x45>
+  801165:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801169:	48 39 d7             	cmp    %rdx,%rdi
+  80116c:	73 31                	jae    80119f <memmove+0x45>
+		s += n;
+		d += n;
+  80116e:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  801172:	48 89 d6             	mov    %rdx,%rsi
+  801175:	48 09 fe             	or     %rdi,%rsi
+  801178:	48 09 ce             	or     %rcx,%rsi
+  80117b:	40 f6 c6 03          	test   $0x3,%sil
+  80117f:	75 11                	jne    801192 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801181:	48 83 ef 04          	sub    $0x4,%rdi
+  801185:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  801189:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  80118d:	fd                   	std
+  80118e:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801190:	eb 0b                	jmp    80119d <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801192:	48 83 ef 01          	sub    $0x1,%rdi
+  801196:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  80119a:	fd                   	std
+  80119b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80119d:	fc                   	cld
+  80119e:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  80119f:	48 89 f2             	mov    %rsi,%rdx
+  8011a2:	48 09 c2             	or     %rax,%rdx
+  8011a5:	48 09 ca             	or     %rcx,%rdx
+  8011a8:	f6 c2 03             	test   $0x3,%dl
+  8011ab:	75 0b                	jne    8011b8 <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8011ad:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  8011b1:	48 89 c7             	mov    %rax,%rdi
+  8011b4:	fc                   	cld
+  8011b5:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8011b7:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  8011b8:	48 89 c7             	mov    %rax,%rdi
+  8011bb:	fc                   	cld
+  8011bc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8011be:	c3                   	ret
+
+00000000008011bf <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8011bf:	55                   	push   %rbp
+  8011c0:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  8011c3:	48 b8 5a 11 80 00 00 	movabs $0x80115a,%rax
+  8011ca:	00 00 00 
+  8011cd:	ff d0                	call   *%rax
+}
+  8011cf:	5d                   	pop    %rbp
+  8011d0:	c3                   	ret
+
+00000000008011d1 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8011d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d6:	48 39 c2             	cmp    %rax,%rdx
+  8011d9:	74 1e                	je     8011f9 <memcmp+0x28>
+		if (*s1 != *s2)
+  8011db:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011df:	48 83 c0 01          	add    $0x1,%rax
+  8011e3:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  8011e9:	44 38 c1             	cmp    %r8b,%cl
+  8011ec:	74 e8                	je     8011d6 <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  8011ee:	0f b6 c1             	movzbl %cl,%eax
+  8011f1:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011f5:	44 29 c0             	sub    %r8d,%eax
+  8011f8:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  8011f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011fe:	c3                   	ret
+
+00000000008011ff <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8011ff:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  801202:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  801205:	eb 04                	jmp    80120b <memfind+0xc>
+  801207:	48 83 c0 01          	add    $0x1,%rax
+  80120b:	48 39 d0             	cmp    %rdx,%rax
+  80120e:	73 05                	jae    801215 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801210:	40 38 30             	cmp    %sil,(%rax)
+  801213:	75 f2                	jne    801207 <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  801215:	c3                   	ret
+
+0000000000801216 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801216:	48 89 f9             	mov    %rdi,%rcx
+  801219:	49 89 f0             	mov    %rsi,%r8
+  80121c:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80121e:	eb 04                	jmp    801224 <strtol+0xe>
+		s++;
+  801220:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  801224:	0f b6 01             	movzbl (%rcx),%eax
+  801227:	3c 20                	cmp    $0x20,%al
+  801229:	74 f5                	je     801220 <strtol+0xa>
+  80122b:	3c 09                	cmp    $0x9,%al
+  80122d:	74 f1                	je     801220 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  80122f:	3c 2b                	cmp    $0x2b,%al
+  801231:	74 2b                	je     80125e <strtol+0x48>
+	int neg = 0;
+  801233:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  801239:	3c 2d                	cmp    $0x2d,%al
+  80123b:	74 2d                	je     80126a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80123d:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  801243:	75 0f                	jne    801254 <strtol+0x3e>
+  801245:	80 39 30             	cmpb   $0x30,(%rcx)
+  801248:	74 2c                	je     801276 <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80124a:	85 ff                	test   %edi,%edi
+  80124c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801251:	0f 44 f8             	cmove  %eax,%edi
+  801254:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  801259:	4c 63 d7             	movslq %edi,%r10
+  80125c:	eb 4f                	jmp    8012ad <strtol+0x97>
+		s++;
+  80125e:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  801262:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801268:	eb d3                	jmp    80123d <strtol+0x27>
+		s++, neg = 1;
+  80126a:	48 83 c1 01          	add    $0x1,%rcx
+  80126e:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  801274:	eb c7                	jmp    80123d <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801276:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  80127a:	74 0f                	je     80128b <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  80127c:	85 ff                	test   %edi,%edi
+  80127e:	75 d4                	jne    801254 <strtol+0x3e>
+		s++, base = 8;
+  801280:	48 83 c1 01          	add    $0x1,%rcx
+  801284:	bf 08 00 00 00       	mov    $0x8,%edi
+  801289:	eb c9                	jmp    801254 <strtol+0x3e>
+		s += 2, base = 16;
+  80128b:	48 83 c1 02          	add    $0x2,%rcx
+  80128f:	bf 10 00 00 00       	mov    $0x10,%edi
+  801294:	eb be                	jmp    801254 <strtol+0x3e>
+			dig = *s - '0';
+  801296:	0f be c0             	movsbl %al,%eax
+  801299:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  80129c:	39 f8                	cmp    %edi,%eax
+  80129e:	7d 3b                	jge    8012db <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  8012a0:	48 83 c1 01          	add    $0x1,%rcx
+  8012a4:	49 0f af d2          	imul   %r10,%rdx
+  8012a8:	48 98                	cltq
+  8012aa:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  8012ad:	0f b6 01             	movzbl (%rcx),%eax
+  8012b0:	8d 70 d0             	lea    -0x30(%rax),%esi
+  8012b3:	40 80 fe 09          	cmp    $0x9,%sil
+  8012b7:	76 dd                	jbe    801296 <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  8012b9:	8d 70 9f             	lea    -0x61(%rax),%esi
+  8012bc:	40 80 fe 19          	cmp    $0x19,%sil
+  8012c0:	77 08                	ja     8012ca <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  8012c2:	0f be c0             	movsbl %al,%eax
+  8012c5:	83 e8 57             	sub    $0x57,%eax
+  8012c8:	eb d2                	jmp    80129c <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  8012ca:	8d 70 bf             	lea    -0x41(%rax),%esi
+  8012cd:	40 80 fe 19          	cmp    $0x19,%sil
+  8012d1:	77 08                	ja     8012db <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  8012d3:	0f be c0             	movsbl %al,%eax
+  8012d6:	83 e8 37             	sub    $0x37,%eax
+  8012d9:	eb c1                	jmp    80129c <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8012db:	4d 85 c0             	test   %r8,%r8
+  8012de:	74 03                	je     8012e3 <strtol+0xcd>
+		*endptr = (char *) s;
+  8012e0:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  8012e3:	48 89 d0             	mov    %rdx,%rax
+  8012e6:	48 f7 d8             	neg    %rax
+  8012e9:	45 85 c9             	test   %r9d,%r9d
+  8012ec:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  8012f0:	48 89 d0             	mov    %rdx,%rax
+  8012f3:	c3                   	ret
+
+00000000008012f4 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8012f4:	55                   	push   %rbp
+  8012f5:	48 89 e5             	mov    %rsp,%rbp
+  8012f8:	53                   	push   %rbx
+  8012f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8012fd:	48 89 fb             	mov    %rdi,%rbx
+	int r;
+
+	if (_pgfault_handler == 0) {
+  801300:	48 ba 08 20 80 00 00 	movabs $0x802008,%rdx
+  801307:	00 00 00 
+  80130a:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  80130e:	74 13                	je     801323 <set_pgfault_handler+0x2f>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801310:	48 89 d8             	mov    %rbx,%rax
+  801313:	48 a3 08 20 80 00 00 	movabs %rax,0x802008
+  80131a:	00 00 00 
+}
+  80131d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801321:	c9                   	leave
+  801322:	c3                   	ret
+		r = sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801323:	ba 07 00 00 00       	mov    $0x7,%edx
+  801328:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  80132d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801332:	48 b8 84 01 80 00 00 	movabs $0x800184,%rax
+  801339:	00 00 00 
+  80133c:	ff d0                	call   *%rax
+		if (r < 0) {
+  80133e:	85 c0                	test   %eax,%eax
+  801340:	78 4c                	js     80138e <set_pgfault_handler+0x9a>
+		r = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801342:	48 be 60 05 80 00 00 	movabs $0x800560,%rsi
+  801349:	00 00 00 
+  80134c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801351:	48 b8 9c 04 80 00 00 	movabs $0x80049c,%rax
+  801358:	00 00 00 
+  80135b:	ff d0                	call   *%rax
+		if (r < 0) {
+  80135d:	85 c0                	test   %eax,%eax
+  80135f:	79 af                	jns    801310 <set_pgfault_handler+0x1c>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+  801361:	89 c1                	mov    %eax,%ecx
+  801363:	48 ba 18 18 80 00 00 	movabs $0x801818,%rdx
+  80136a:	00 00 00 
+  80136d:	be 2c 00 00 00       	mov    $0x2c,%esi
+  801372:	48 bf 03 18 80 00 00 	movabs $0x801803,%rdi
+  801379:	00 00 00 
+  80137c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801381:	49 b8 b0 05 80 00 00 	movabs $0x8005b0,%r8
+  801388:	00 00 00 
+  80138b:	41 ff d0             	call   *%r8
+			panic("sys_page_alloc failed:  %e", r);
+  80138e:	89 c1                	mov    %eax,%ecx
+  801390:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  801397:	00 00 00 
+  80139a:	be 28 00 00 00       	mov    $0x28,%esi
+  80139f:	48 bf 03 18 80 00 00 	movabs $0x801803,%rdi
+  8013a6:	00 00 00 
+  8013a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ae:	49 b8 b0 05 80 00 00 	movabs $0x8005b0,%r8
+  8013b5:	00 00 00 
+  8013b8:	41 ff d0             	call   *%r8
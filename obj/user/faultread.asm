@@ -0,0 +1,2252 @@
+
+obj/user/faultread:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 2a 00 00 00       	call   80005b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+	cprintf("I read %08x from location 0!\n", *(unsigned*)0);
+  800037:	8b 34 25 00 00 00 00 	mov    0x0,%esi
+  80003e:	48 bf a0 12 80 00 00 	movabs $0x8012a0,%rdi
+  800045:	00 00 00 
+  800048:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004d:	48 ba 4e 01 80 00 00 	movabs $0x80014e,%rdx
+  800054:	00 00 00 
+  800057:	ff d2                	call   *%rdx
+}
+  800059:	5d                   	pop    %rbp
+  80005a:	c3                   	ret
+
+000000000080005b <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  80005b:	55                   	push   %rbp
+  80005c:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80005f:	85 ff                	test   %edi,%edi
+  800061:	7e 0d                	jle    800070 <libmain+0x15>
+		binaryname = argv[0];
+  800063:	48 8b 06             	mov    (%rsi),%rax
+  800066:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  80006d:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  800070:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  800077:	00 00 00 
+  80007a:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  80007c:	48 b8 8a 00 80 00 00 	movabs $0x80008a,%rax
+  800083:	00 00 00 
+  800086:	ff d0                	call   *%rax
+}
+  800088:	5d                   	pop    %rbp
+  800089:	c3                   	ret
+
+000000000080008a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80008a:	55                   	push   %rbp
+  80008b:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  80008e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800093:	48 b8 2b 0d 80 00 00 	movabs $0x800d2b,%rax
+  80009a:	00 00 00 
+  80009d:	ff d0                	call   *%rax
+}
+  80009f:	5d                   	pop    %rbp
+  8000a0:	c3                   	ret
+
+00000000008000a1 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000a1:	55                   	push   %rbp
+  8000a2:	48 89 e5             	mov    %rsp,%rbp
+  8000a5:	53                   	push   %rbx
+  8000a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8000aa:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  8000ad:	8b 06                	mov    (%rsi),%eax
+  8000af:	8d 50 01             	lea    0x1(%rax),%edx
+  8000b2:	89 16                	mov    %edx,(%rsi)
+  8000b4:	48 98                	cltq
+  8000b6:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  8000bb:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8000c1:	74 0a                	je     8000cd <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000c3:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8000c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000cb:	c9                   	leave
+  8000cc:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000cd:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8000d1:	be ff 00 00 00       	mov    $0xff,%esi
+  8000d6:	48 b8 f3 0c 80 00 00 	movabs $0x800cf3,%rax
+  8000dd:	00 00 00 
+  8000e0:	ff d0                	call   *%rax
+		b->idx = 0;
+  8000e2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8000e8:	eb d9                	jmp    8000c3 <putch+0x22>
+
+00000000008000ea <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8000ea:	55                   	push   %rbp
+  8000eb:	48 89 e5             	mov    %rsp,%rbp
+  8000ee:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8000f5:	48 89 fa             	mov    %rdi,%rdx
+  8000f8:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  8000fb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800102:	00 00 00 
+	b.cnt = 0;
+  800105:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80010c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80010f:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  800116:	48 bf a1 00 80 00 00 	movabs $0x8000a1,%rdi
+  80011d:	00 00 00 
+  800120:	48 b8 08 03 80 00 00 	movabs $0x800308,%rax
+  800127:	00 00 00 
+  80012a:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  80012c:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  800133:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80013a:	48 b8 f3 0c 80 00 00 	movabs $0x800cf3,%rax
+  800141:	00 00 00 
+  800144:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  800146:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  80014c:	c9                   	leave
+  80014d:	c3                   	ret
+
+000000000080014e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80014e:	55                   	push   %rbp
+  80014f:	48 89 e5             	mov    %rsp,%rbp
+  800152:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800159:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800160:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800167:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80016e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800175:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80017c:	84 c0                	test   %al,%al
+  80017e:	74 20                	je     8001a0 <cprintf+0x52>
+  800180:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800184:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800188:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80018c:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800190:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800194:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800198:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80019c:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001a0:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  8001a7:	00 00 00 
+  8001aa:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8001b1:	00 00 00 
+  8001b4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001b8:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8001bf:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8001c6:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  8001cd:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  8001d4:	48 b8 ea 00 80 00 00 	movabs $0x8000ea,%rax
+  8001db:	00 00 00 
+  8001de:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  8001e0:	c9                   	leave
+  8001e1:	c3                   	ret
+
+00000000008001e2 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001e2:	55                   	push   %rbp
+  8001e3:	48 89 e5             	mov    %rsp,%rbp
+  8001e6:	41 57                	push   %r15
+  8001e8:	41 56                	push   %r14
+  8001ea:	41 55                	push   %r13
+  8001ec:	41 54                	push   %r12
+  8001ee:	53                   	push   %rbx
+  8001ef:	48 83 ec 18          	sub    $0x18,%rsp
+  8001f3:	49 89 fc             	mov    %rdi,%r12
+  8001f6:	49 89 f5             	mov    %rsi,%r13
+  8001f9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8001fd:	44 89 c3             	mov    %r8d,%ebx
+  800200:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800203:	41 89 cf             	mov    %ecx,%r15d
+  800206:	4c 39 fa             	cmp    %r15,%rdx
+  800209:	72 29                	jb     800234 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80020b:	48 89 d0             	mov    %rdx,%rax
+  80020e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800213:	49 f7 f7             	div    %r15
+  800216:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80021a:	48 89 c2             	mov    %rax,%rdx
+  80021d:	48 b8 e2 01 80 00 00 	movabs $0x8001e2,%rax
+  800224:	00 00 00 
+  800227:	ff d0                	call   *%rax
+  800229:	eb 10                	jmp    80023b <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80022b:	4c 89 ee             	mov    %r13,%rsi
+  80022e:	44 89 f7             	mov    %r14d,%edi
+  800231:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  800234:	83 eb 01             	sub    $0x1,%ebx
+  800237:	85 db                	test   %ebx,%ebx
+  800239:	7f f0                	jg     80022b <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80023b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80023f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800244:	49 f7 f7             	div    %r15
+  800247:	48 b8 c8 12 80 00 00 	movabs $0x8012c8,%rax
+  80024e:	00 00 00 
+  800251:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  800255:	4c 89 ee             	mov    %r13,%rsi
+  800258:	41 ff d4             	call   *%r12
+}
+  80025b:	48 83 c4 18          	add    $0x18,%rsp
+  80025f:	5b                   	pop    %rbx
+  800260:	41 5c                	pop    %r12
+  800262:	41 5d                	pop    %r13
+  800264:	41 5e                	pop    %r14
+  800266:	41 5f                	pop    %r15
+  800268:	5d                   	pop    %rbp
+  800269:	c3                   	ret
+
+000000000080026a <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  80026a:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  80026e:	48 8b 06             	mov    (%rsi),%rax
+  800271:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800275:	73 0a                	jae    800281 <sprintputch+0x17>
+		*b->buf++ = ch;
+  800277:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80027b:	48 89 16             	mov    %rdx,(%rsi)
+  80027e:	40 88 38             	mov    %dil,(%rax)
+}
+  800281:	c3                   	ret
+
+0000000000800282 <printfmt>:
+{
+  800282:	55                   	push   %rbp
+  800283:	48 89 e5             	mov    %rsp,%rbp
+  800286:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80028d:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800294:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80029b:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8002a2:	84 c0                	test   %al,%al
+  8002a4:	74 20                	je     8002c6 <printfmt+0x44>
+  8002a6:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8002aa:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8002ae:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8002b2:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8002b6:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8002ba:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8002be:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8002c2:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  8002c6:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8002cd:	00 00 00 
+  8002d0:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8002d7:	00 00 00 
+  8002da:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002de:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8002e5:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8002ec:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8002f3:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8002fa:	48 b8 08 03 80 00 00 	movabs $0x800308,%rax
+  800301:	00 00 00 
+  800304:	ff d0                	call   *%rax
+}
+  800306:	c9                   	leave
+  800307:	c3                   	ret
+
+0000000000800308 <vprintfmt>:
+{
+  800308:	55                   	push   %rbp
+  800309:	48 89 e5             	mov    %rsp,%rbp
+  80030c:	41 57                	push   %r15
+  80030e:	41 56                	push   %r14
+  800310:	41 55                	push   %r13
+  800312:	41 54                	push   %r12
+  800314:	53                   	push   %rbx
+  800315:	48 83 ec 48          	sub    $0x48,%rsp
+  800319:	49 89 fe             	mov    %rdi,%r14
+  80031c:	49 89 f5             	mov    %rsi,%r13
+  80031f:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  800322:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  800326:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  80032a:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80032e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  800332:	eb 09                	jmp    80033d <vprintfmt+0x35>
+			putch(ch, putdat);
+  800334:	4c 89 ee             	mov    %r13,%rsi
+  800337:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80033a:	4c 89 e3             	mov    %r12,%rbx
+  80033d:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800341:	0f b6 3b             	movzbl (%rbx),%edi
+  800344:	83 ff 25             	cmp    $0x25,%edi
+  800347:	74 13                	je     80035c <vprintfmt+0x54>
+			if (ch == '\0')
+  800349:	85 ff                	test   %edi,%edi
+  80034b:	75 e7                	jne    800334 <vprintfmt+0x2c>
+}
+  80034d:	48 83 c4 48          	add    $0x48,%rsp
+  800351:	5b                   	pop    %rbx
+  800352:	41 5c                	pop    %r12
+  800354:	41 5d                	pop    %r13
+  800356:	41 5e                	pop    %r14
+  800358:	41 5f                	pop    %r15
+  80035a:	5d                   	pop    %rbp
+  80035b:	c3                   	ret
+		padc = ' ';
+  80035c:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  800360:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  800367:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  80036d:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  800374:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800379:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80037e:	41 0f b6 14 24       	movzbl (%r12),%edx
+  800383:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  800386:	3c 55                	cmp    $0x55,%al
+  800388:	0f 87 4f 05 00 00    	ja     8008dd <vprintfmt+0x5d5>
+  80038e:	0f b6 c0             	movzbl %al,%eax
+  800391:	48 be 80 13 80 00 00 	movabs $0x801380,%rsi
+  800398:	00 00 00 
+  80039b:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  80039e:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  8003a1:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  8003a5:	eb d2                	jmp    800379 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a7:	49 89 dc             	mov    %rbx,%r12
+  8003aa:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  8003ae:	eb c9                	jmp    800379 <vprintfmt+0x71>
+  8003b0:	0f b6 d2             	movzbl %dl,%edx
+  8003b3:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  8003b6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  8003bc:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  8003c0:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  8003c5:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  8003ca:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  8003cd:	83 f8 09             	cmp    $0x9,%eax
+  8003d0:	77 20                	ja     8003f2 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  8003d2:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  8003d6:	eb e4                	jmp    8003bc <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  8003d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003db:	83 f8 2f             	cmp    $0x2f,%eax
+  8003de:	77 27                	ja     800407 <vprintfmt+0xff>
+  8003e0:	89 c2                	mov    %eax,%edx
+  8003e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8003e6:	83 c0 08             	add    $0x8,%eax
+  8003e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003ec:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ef:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  8003f2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8003f6:	79 81                	jns    800379 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  8003f8:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  8003fc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800402:	e9 72 ff ff ff       	jmp    800379 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  800407:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80040b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80040f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800413:	eb d7                	jmp    8003ec <vprintfmt+0xe4>
+			if (width < 0)
+  800415:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  800418:	85 f6                	test   %esi,%esi
+  80041a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80041f:	0f 49 c6             	cmovns %esi,%eax
+  800422:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800425:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800428:	e9 4c ff ff ff       	jmp    800379 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  80042d:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  800430:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  800437:	e9 3d ff ff ff       	jmp    800379 <vprintfmt+0x71>
+			lflag++;
+  80043c:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80043f:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800442:	e9 32 ff ff ff       	jmp    800379 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  800447:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80044a:	83 f8 2f             	cmp    $0x2f,%eax
+  80044d:	77 19                	ja     800468 <vprintfmt+0x160>
+  80044f:	89 c2                	mov    %eax,%edx
+  800451:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800455:	83 c0 08             	add    $0x8,%eax
+  800458:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80045b:	8b 3a                	mov    (%rdx),%edi
+  80045d:	4c 89 ee             	mov    %r13,%rsi
+  800460:	41 ff d6             	call   *%r14
+			break;
+  800463:	e9 d5 fe ff ff       	jmp    80033d <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  800468:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80046c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800470:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800474:	eb e5                	jmp    80045b <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  800476:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800479:	83 f8 2f             	cmp    $0x2f,%eax
+  80047c:	77 5a                	ja     8004d8 <vprintfmt+0x1d0>
+  80047e:	89 c2                	mov    %eax,%edx
+  800480:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800484:	83 c0 08             	add    $0x8,%eax
+  800487:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  80048a:	8b 02                	mov    (%rdx),%eax
+  80048c:	89 c1                	mov    %eax,%ecx
+  80048e:	f7 d9                	neg    %ecx
+  800490:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800493:	83 f9 08             	cmp    $0x8,%ecx
+  800496:	7f 4e                	jg     8004e6 <vprintfmt+0x1de>
+  800498:	48 63 c1             	movslq %ecx,%rax
+  80049b:	48 ba 40 16 80 00 00 	movabs $0x801640,%rdx
+  8004a2:	00 00 00 
+  8004a5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004a9:	48 85 c0             	test   %rax,%rax
+  8004ac:	74 38                	je     8004e6 <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  8004ae:	48 89 c1             	mov    %rax,%rcx
+  8004b1:	48 ba e9 12 80 00 00 	movabs $0x8012e9,%rdx
+  8004b8:	00 00 00 
+  8004bb:	4c 89 ee             	mov    %r13,%rsi
+  8004be:	4c 89 f7             	mov    %r14,%rdi
+  8004c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c6:	49 b8 82 02 80 00 00 	movabs $0x800282,%r8
+  8004cd:	00 00 00 
+  8004d0:	41 ff d0             	call   *%r8
+  8004d3:	e9 65 fe ff ff       	jmp    80033d <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  8004d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004e4:	eb a4                	jmp    80048a <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  8004e6:	48 ba e0 12 80 00 00 	movabs $0x8012e0,%rdx
+  8004ed:	00 00 00 
+  8004f0:	4c 89 ee             	mov    %r13,%rsi
+  8004f3:	4c 89 f7             	mov    %r14,%rdi
+  8004f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fb:	49 b8 82 02 80 00 00 	movabs $0x800282,%r8
+  800502:	00 00 00 
+  800505:	41 ff d0             	call   *%r8
+  800508:	e9 30 fe ff ff       	jmp    80033d <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  80050d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800510:	83 f8 2f             	cmp    $0x2f,%eax
+  800513:	77 36                	ja     80054b <vprintfmt+0x243>
+  800515:	89 c2                	mov    %eax,%edx
+  800517:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80051b:	83 c0 08             	add    $0x8,%eax
+  80051e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800521:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800524:	48 85 c9             	test   %rcx,%rcx
+  800527:	48 b8 d9 12 80 00 00 	movabs $0x8012d9,%rax
+  80052e:	00 00 00 
+  800531:	48 0f 45 c1          	cmovne %rcx,%rax
+  800535:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800539:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80053d:	7e 06                	jle    800545 <vprintfmt+0x23d>
+  80053f:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800543:	75 14                	jne    800559 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800545:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800549:	eb 64                	jmp    8005af <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  80054b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80054f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800553:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800557:	eb c8                	jmp    800521 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800559:	49 63 f7             	movslq %r15d,%rsi
+  80055c:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800560:	48 b8 eb 09 80 00 00 	movabs $0x8009eb,%rax
+  800567:	00 00 00 
+  80056a:	ff d0                	call   *%rax
+  80056c:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80056f:	29 c1                	sub    %eax,%ecx
+  800571:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800574:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  800577:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  80057b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80057e:	eb 0d                	jmp    80058d <vprintfmt+0x285>
+					putch(padc, putdat);
+  800580:	4c 89 ee             	mov    %r13,%rsi
+  800583:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  800586:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800589:	41 83 ec 01          	sub    $0x1,%r12d
+  80058d:	45 85 e4             	test   %r12d,%r12d
+  800590:	7f ee                	jg     800580 <vprintfmt+0x278>
+  800592:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  800595:	85 c9                	test   %ecx,%ecx
+  800597:	b8 00 00 00 00       	mov    $0x0,%eax
+  80059c:	0f 49 c1             	cmovns %ecx,%eax
+  80059f:	29 c1                	sub    %eax,%ecx
+  8005a1:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  8005a4:	eb 9f                	jmp    800545 <vprintfmt+0x23d>
+					putch(ch, putdat);
+  8005a6:	4c 89 ee             	mov    %r13,%rsi
+  8005a9:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005ac:	4c 89 e2             	mov    %r12,%rdx
+  8005af:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8005b3:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8005b9:	0f be f8             	movsbl %al,%edi
+  8005bc:	85 ff                	test   %edi,%edi
+  8005be:	74 29                	je     8005e9 <vprintfmt+0x2e1>
+  8005c0:	45 85 ff             	test   %r15d,%r15d
+  8005c3:	78 06                	js     8005cb <vprintfmt+0x2c3>
+  8005c5:	41 83 ef 01          	sub    $0x1,%r15d
+  8005c9:	78 1e                	js     8005e9 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005cb:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  8005cf:	74 d5                	je     8005a6 <vprintfmt+0x29e>
+  8005d1:	0f be c0             	movsbl %al,%eax
+  8005d4:	83 e8 20             	sub    $0x20,%eax
+  8005d7:	83 f8 5e             	cmp    $0x5e,%eax
+  8005da:	76 ca                	jbe    8005a6 <vprintfmt+0x29e>
+					putch('?', putdat);
+  8005dc:	4c 89 ee             	mov    %r13,%rsi
+  8005df:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8005e4:	41 ff d6             	call   *%r14
+  8005e7:	eb c3                	jmp    8005ac <vprintfmt+0x2a4>
+  8005e9:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  8005ed:	8b 45 98             	mov    -0x68(%rbp),%eax
+  8005f0:	41 01 c4             	add    %eax,%r12d
+  8005f3:	41 29 d4             	sub    %edx,%r12d
+  8005f6:	eb 0f                	jmp    800607 <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  8005f8:	4c 89 ee             	mov    %r13,%rsi
+  8005fb:	bf 20 00 00 00       	mov    $0x20,%edi
+  800600:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800603:	41 83 ec 01          	sub    $0x1,%r12d
+  800607:	45 85 e4             	test   %r12d,%r12d
+  80060a:	7f ec                	jg     8005f8 <vprintfmt+0x2f0>
+  80060c:	e9 2c fd ff ff       	jmp    80033d <vprintfmt+0x35>
+	if (lflag >= 2)
+  800611:	83 f9 01             	cmp    $0x1,%ecx
+  800614:	7f 1d                	jg     800633 <vprintfmt+0x32b>
+	else if (lflag)
+  800616:	85 c9                	test   %ecx,%ecx
+  800618:	74 5e                	je     800678 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  80061a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80061d:	83 f8 2f             	cmp    $0x2f,%eax
+  800620:	77 48                	ja     80066a <vprintfmt+0x362>
+  800622:	89 c2                	mov    %eax,%edx
+  800624:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800628:	83 c0 08             	add    $0x8,%eax
+  80062b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80062e:	4c 8b 22             	mov    (%rdx),%r12
+  800631:	eb 17                	jmp    80064a <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800633:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800636:	83 f8 2f             	cmp    $0x2f,%eax
+  800639:	77 21                	ja     80065c <vprintfmt+0x354>
+  80063b:	89 c2                	mov    %eax,%edx
+  80063d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800641:	83 c0 08             	add    $0x8,%eax
+  800644:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800647:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  80064a:	4d 85 e4             	test   %r12,%r12
+  80064d:	78 50                	js     80069f <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  80064f:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800652:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800657:	e9 b4 01 00 00       	jmp    800810 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  80065c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800660:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800664:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800668:	eb dd                	jmp    800647 <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  80066a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80066e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800672:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800676:	eb b6                	jmp    80062e <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800678:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80067b:	83 f8 2f             	cmp    $0x2f,%eax
+  80067e:	77 11                	ja     800691 <vprintfmt+0x389>
+  800680:	89 c2                	mov    %eax,%edx
+  800682:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800686:	83 c0 08             	add    $0x8,%eax
+  800689:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80068c:	4c 63 22             	movslq (%rdx),%r12
+  80068f:	eb b9                	jmp    80064a <vprintfmt+0x342>
+  800691:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800695:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800699:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80069d:	eb ed                	jmp    80068c <vprintfmt+0x384>
+				putch('-', putdat);
+  80069f:	4c 89 ee             	mov    %r13,%rsi
+  8006a2:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8006a7:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  8006aa:	4c 89 e2             	mov    %r12,%rdx
+  8006ad:	48 f7 da             	neg    %rdx
+			base = 10;
+  8006b0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8006b5:	e9 56 01 00 00       	jmp    800810 <vprintfmt+0x508>
+	if (lflag >= 2)
+  8006ba:	83 f9 01             	cmp    $0x1,%ecx
+  8006bd:	7f 25                	jg     8006e4 <vprintfmt+0x3dc>
+	else if (lflag)
+  8006bf:	85 c9                	test   %ecx,%ecx
+  8006c1:	74 5e                	je     800721 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  8006c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c9:	77 48                	ja     800713 <vprintfmt+0x40b>
+  8006cb:	89 c2                	mov    %eax,%edx
+  8006cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006d1:	83 c0 08             	add    $0x8,%eax
+  8006d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006d7:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8006da:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  8006df:	e9 2c 01 00 00       	jmp    800810 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8006e4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006e7:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ea:	77 19                	ja     800705 <vprintfmt+0x3fd>
+  8006ec:	89 c2                	mov    %eax,%edx
+  8006ee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006f2:	83 c0 08             	add    $0x8,%eax
+  8006f5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f8:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8006fb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800700:	e9 0b 01 00 00       	jmp    800810 <vprintfmt+0x508>
+  800705:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800709:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80070d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800711:	eb e5                	jmp    8006f8 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800713:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800717:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80071b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80071f:	eb b6                	jmp    8006d7 <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800721:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800724:	83 f8 2f             	cmp    $0x2f,%eax
+  800727:	77 18                	ja     800741 <vprintfmt+0x439>
+  800729:	89 c2                	mov    %eax,%edx
+  80072b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80072f:	83 c0 08             	add    $0x8,%eax
+  800732:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800735:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800737:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  80073c:	e9 cf 00 00 00       	jmp    800810 <vprintfmt+0x508>
+  800741:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800745:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800749:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80074d:	eb e6                	jmp    800735 <vprintfmt+0x42d>
+	if (lflag >= 2)
+  80074f:	83 f9 01             	cmp    $0x1,%ecx
+  800752:	7f 25                	jg     800779 <vprintfmt+0x471>
+	else if (lflag)
+  800754:	85 c9                	test   %ecx,%ecx
+  800756:	74 5b                	je     8007b3 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800758:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80075b:	83 f8 2f             	cmp    $0x2f,%eax
+  80075e:	77 45                	ja     8007a5 <vprintfmt+0x49d>
+  800760:	89 c2                	mov    %eax,%edx
+  800762:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800766:	83 c0 08             	add    $0x8,%eax
+  800769:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80076c:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  80076f:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800774:	e9 97 00 00 00       	jmp    800810 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800779:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80077c:	83 f8 2f             	cmp    $0x2f,%eax
+  80077f:	77 16                	ja     800797 <vprintfmt+0x48f>
+  800781:	89 c2                	mov    %eax,%edx
+  800783:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800787:	83 c0 08             	add    $0x8,%eax
+  80078a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80078d:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800790:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800795:	eb 79                	jmp    800810 <vprintfmt+0x508>
+  800797:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80079b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80079f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a3:	eb e8                	jmp    80078d <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  8007a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b1:	eb b9                	jmp    80076c <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  8007b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b9:	77 15                	ja     8007d0 <vprintfmt+0x4c8>
+  8007bb:	89 c2                	mov    %eax,%edx
+  8007bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c1:	83 c0 08             	add    $0x8,%eax
+  8007c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c7:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  8007c9:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  8007ce:	eb 40                	jmp    800810 <vprintfmt+0x508>
+  8007d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007dc:	eb e9                	jmp    8007c7 <vprintfmt+0x4bf>
+			putch('0', putdat);
+  8007de:	4c 89 ee             	mov    %r13,%rsi
+  8007e1:	bf 30 00 00 00       	mov    $0x30,%edi
+  8007e6:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  8007e9:	4c 89 ee             	mov    %r13,%rsi
+  8007ec:	bf 78 00 00 00       	mov    $0x78,%edi
+  8007f1:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  8007f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fa:	77 34                	ja     800830 <vprintfmt+0x528>
+  8007fc:	89 c2                	mov    %eax,%edx
+  8007fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800802:	83 c0 08             	add    $0x8,%eax
+  800805:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800808:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  80080b:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800810:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800815:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800819:	4c 89 ee             	mov    %r13,%rsi
+  80081c:	4c 89 f7             	mov    %r14,%rdi
+  80081f:	48 b8 e2 01 80 00 00 	movabs $0x8001e2,%rax
+  800826:	00 00 00 
+  800829:	ff d0                	call   *%rax
+			break;
+  80082b:	e9 0d fb ff ff       	jmp    80033d <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800830:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800834:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800838:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083c:	eb ca                	jmp    800808 <vprintfmt+0x500>
+	if (lflag >= 2)
+  80083e:	83 f9 01             	cmp    $0x1,%ecx
+  800841:	7f 22                	jg     800865 <vprintfmt+0x55d>
+	else if (lflag)
+  800843:	85 c9                	test   %ecx,%ecx
+  800845:	74 58                	je     80089f <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800847:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084a:	83 f8 2f             	cmp    $0x2f,%eax
+  80084d:	77 42                	ja     800891 <vprintfmt+0x589>
+  80084f:	89 c2                	mov    %eax,%edx
+  800851:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800855:	83 c0 08             	add    $0x8,%eax
+  800858:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085b:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  80085e:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800863:	eb ab                	jmp    800810 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800865:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800868:	83 f8 2f             	cmp    $0x2f,%eax
+  80086b:	77 16                	ja     800883 <vprintfmt+0x57b>
+  80086d:	89 c2                	mov    %eax,%edx
+  80086f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800873:	83 c0 08             	add    $0x8,%eax
+  800876:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800879:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  80087c:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800881:	eb 8d                	jmp    800810 <vprintfmt+0x508>
+  800883:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800887:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80088b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088f:	eb e8                	jmp    800879 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800891:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800895:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800899:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089d:	eb bc                	jmp    80085b <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  80089f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a5:	77 18                	ja     8008bf <vprintfmt+0x5b7>
+  8008a7:	89 c2                	mov    %eax,%edx
+  8008a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ad:	83 c0 08             	add    $0x8,%eax
+  8008b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b3:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  8008b5:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  8008ba:	e9 51 ff ff ff       	jmp    800810 <vprintfmt+0x508>
+  8008bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008cb:	eb e6                	jmp    8008b3 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  8008cd:	4c 89 ee             	mov    %r13,%rsi
+  8008d0:	bf 25 00 00 00       	mov    $0x25,%edi
+  8008d5:	41 ff d6             	call   *%r14
+			break;
+  8008d8:	e9 60 fa ff ff       	jmp    80033d <vprintfmt+0x35>
+			putch('%', putdat);
+  8008dd:	4c 89 ee             	mov    %r13,%rsi
+  8008e0:	bf 25 00 00 00       	mov    $0x25,%edi
+  8008e5:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008e8:	4c 89 e3             	mov    %r12,%rbx
+  8008eb:	eb 04                	jmp    8008f1 <vprintfmt+0x5e9>
+  8008ed:	48 83 eb 01          	sub    $0x1,%rbx
+  8008f1:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8008f5:	75 f6                	jne    8008ed <vprintfmt+0x5e5>
+  8008f7:	e9 41 fa ff ff       	jmp    80033d <vprintfmt+0x35>
+
+00000000008008fc <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008fc:	55                   	push   %rbp
+  8008fd:	48 89 e5             	mov    %rsp,%rbp
+  800900:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800904:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800908:	48 63 c6             	movslq %esi,%rax
+  80090b:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800910:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800914:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  80091b:	48 85 ff             	test   %rdi,%rdi
+  80091e:	74 2a                	je     80094a <vsnprintf+0x4e>
+  800920:	85 f6                	test   %esi,%esi
+  800922:	7e 26                	jle    80094a <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800924:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800928:	48 bf 6a 02 80 00 00 	movabs $0x80026a,%rdi
+  80092f:	00 00 00 
+  800932:	48 b8 08 03 80 00 00 	movabs $0x800308,%rax
+  800939:	00 00 00 
+  80093c:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80093e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800942:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800945:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800948:	c9                   	leave
+  800949:	c3                   	ret
+		return -E_INVAL;
+  80094a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80094f:	eb f7                	jmp    800948 <vsnprintf+0x4c>
+
+0000000000800951 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800951:	55                   	push   %rbp
+  800952:	48 89 e5             	mov    %rsp,%rbp
+  800955:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80095c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800963:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80096a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800971:	84 c0                	test   %al,%al
+  800973:	74 20                	je     800995 <snprintf+0x44>
+  800975:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800979:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80097d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800981:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800985:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800989:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80098d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800991:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800995:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  80099c:	00 00 00 
+  80099f:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8009a6:	00 00 00 
+  8009a9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8009ad:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8009b4:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8009bb:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009c2:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8009c9:	48 b8 fc 08 80 00 00 	movabs $0x8008fc,%rax
+  8009d0:	00 00 00 
+  8009d3:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  8009d5:	c9                   	leave
+  8009d6:	c3                   	ret
+
+00000000008009d7 <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009dc:	48 89 d0             	mov    %rdx,%rax
+  8009df:	48 83 c2 01          	add    $0x1,%rdx
+  8009e3:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  8009e8:	75 f2                	jne    8009dc <strlen+0x5>
+		n++;
+	return n;
+}
+  8009ea:	c3                   	ret
+
+00000000008009eb <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f0:	eb 03                	jmp    8009f5 <strnlen+0xa>
+  8009f2:	48 89 d0             	mov    %rdx,%rax
+  8009f5:	48 39 c6             	cmp    %rax,%rsi
+  8009f8:	74 0a                	je     800a04 <strnlen+0x19>
+  8009fa:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8009fe:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800a02:	75 ee                	jne    8009f2 <strnlen+0x7>
+		n++;
+	return n;
+}
+  800a04:	c3                   	ret
+
+0000000000800a05 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a05:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a08:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a0d:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800a11:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800a14:	48 83 c2 01          	add    $0x1,%rdx
+  800a18:	84 c9                	test   %cl,%cl
+  800a1a:	75 f1                	jne    800a0d <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800a1c:	c3                   	ret
+
+0000000000800a1d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a1d:	55                   	push   %rbp
+  800a1e:	48 89 e5             	mov    %rsp,%rbp
+  800a21:	41 54                	push   %r12
+  800a23:	53                   	push   %rbx
+  800a24:	48 89 fb             	mov    %rdi,%rbx
+  800a27:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800a2a:	48 b8 d7 09 80 00 00 	movabs $0x8009d7,%rax
+  800a31:	00 00 00 
+  800a34:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800a36:	48 63 f8             	movslq %eax,%rdi
+  800a39:	48 01 df             	add    %rbx,%rdi
+  800a3c:	4c 89 e6             	mov    %r12,%rsi
+  800a3f:	48 b8 05 0a 80 00 00 	movabs $0x800a05,%rax
+  800a46:	00 00 00 
+  800a49:	ff d0                	call   *%rax
+	return dst;
+}
+  800a4b:	48 89 d8             	mov    %rbx,%rax
+  800a4e:	5b                   	pop    %rbx
+  800a4f:	41 5c                	pop    %r12
+  800a51:	5d                   	pop    %rbp
+  800a52:	c3                   	ret
+
+0000000000800a53 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a53:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a56:	48 01 fa             	add    %rdi,%rdx
+  800a59:	48 89 f9             	mov    %rdi,%rcx
+  800a5c:	eb 14                	jmp    800a72 <strncpy+0x1f>
+		*dst++ = *src;
+  800a5e:	48 83 c1 01          	add    $0x1,%rcx
+  800a62:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800a66:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a6a:	41 80 f8 01          	cmp    $0x1,%r8b
+  800a6e:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800a72:	48 39 d1             	cmp    %rdx,%rcx
+  800a75:	75 e7                	jne    800a5e <strncpy+0xb>
+	}
+	return ret;
+}
+  800a77:	c3                   	ret
+
+0000000000800a78 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a78:	48 89 f8             	mov    %rdi,%rax
+  800a7b:	48 85 d2             	test   %rdx,%rdx
+  800a7e:	74 27                	je     800aa7 <strlcpy+0x2f>
+  800a80:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800a85:	48 89 fa             	mov    %rdi,%rdx
+  800a88:	eb 0b                	jmp    800a95 <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a8a:	48 83 c6 01          	add    $0x1,%rsi
+  800a8e:	48 83 c2 01          	add    $0x1,%rdx
+  800a92:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800a95:	48 39 c2             	cmp    %rax,%rdx
+  800a98:	74 0a                	je     800aa4 <strlcpy+0x2c>
+  800a9a:	0f b6 0e             	movzbl (%rsi),%ecx
+  800a9d:	84 c9                	test   %cl,%cl
+  800a9f:	75 e9                	jne    800a8a <strlcpy+0x12>
+  800aa1:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800aa4:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800aa7:	48 29 f8             	sub    %rdi,%rax
+}
+  800aaa:	c3                   	ret
+
+0000000000800aab <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800aab:	eb 08                	jmp    800ab5 <strcmp+0xa>
+		p++, q++;
+  800aad:	48 83 c7 01          	add    $0x1,%rdi
+  800ab1:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800ab5:	0f b6 07             	movzbl (%rdi),%eax
+  800ab8:	84 c0                	test   %al,%al
+  800aba:	74 04                	je     800ac0 <strcmp+0x15>
+  800abc:	3a 06                	cmp    (%rsi),%al
+  800abe:	74 ed                	je     800aad <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ac0:	0f b6 c0             	movzbl %al,%eax
+  800ac3:	0f b6 16             	movzbl (%rsi),%edx
+  800ac6:	29 d0                	sub    %edx,%eax
+}
+  800ac8:	c3                   	ret
+
+0000000000800ac9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800ac9:	eb 0c                	jmp    800ad7 <strncmp+0xe>
+		n--, p++, q++;
+  800acb:	48 83 ea 01          	sub    $0x1,%rdx
+  800acf:	48 83 c7 01          	add    $0x1,%rdi
+  800ad3:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800ad7:	48 85 d2             	test   %rdx,%rdx
+  800ada:	74 14                	je     800af0 <strncmp+0x27>
+  800adc:	0f b6 07             	movzbl (%rdi),%eax
+  800adf:	84 c0                	test   %al,%al
+  800ae1:	74 04                	je     800ae7 <strncmp+0x1e>
+  800ae3:	3a 06                	cmp    (%rsi),%al
+  800ae5:	74 e4                	je     800acb <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ae7:	0f b6 07             	movzbl (%rdi),%eax
+  800aea:	0f b6 16             	movzbl (%rsi),%edx
+  800aed:	29 d0                	sub    %edx,%eax
+}
+  800aef:	c3                   	ret
+		return 0;
+  800af0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af5:	c3                   	ret
+
+0000000000800af6 <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800af6:	eb 04                	jmp    800afc <strchr+0x6>
+  800af8:	48 83 c7 01          	add    $0x1,%rdi
+  800afc:	0f b6 07             	movzbl (%rdi),%eax
+  800aff:	84 c0                	test   %al,%al
+  800b01:	74 09                	je     800b0c <strchr+0x16>
+		if (*s == c)
+  800b03:	40 38 f0             	cmp    %sil,%al
+  800b06:	75 f0                	jne    800af8 <strchr+0x2>
+  800b08:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800b0b:	c3                   	ret
+	return 0;
+  800b0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b11:	c3                   	ret
+
+0000000000800b12 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b12:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800b15:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800b18:	40 38 f2             	cmp    %sil,%dl
+  800b1b:	74 0a                	je     800b27 <strfind+0x15>
+  800b1d:	84 d2                	test   %dl,%dl
+  800b1f:	74 06                	je     800b27 <strfind+0x15>
+	for (; *s; s++)
+  800b21:	48 83 c0 01          	add    $0x1,%rax
+  800b25:	eb ee                	jmp    800b15 <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800b27:	c3                   	ret
+
+0000000000800b28 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800b28:	48 85 d2             	test   %rdx,%rdx
+  800b2b:	74 28                	je     800b55 <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800b2d:	48 89 f8             	mov    %rdi,%rax
+  800b30:	48 09 d0             	or     %rdx,%rax
+  800b33:	a8 03                	test   $0x3,%al
+  800b35:	75 16                	jne    800b4d <memset+0x25>
+		c &= 0xFF;
+  800b37:	40 0f b6 f6          	movzbl %sil,%esi
+  800b3b:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b41:	48 89 d1             	mov    %rdx,%rcx
+  800b44:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800b48:	fc                   	cld
+  800b49:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800b4b:	eb 08                	jmp    800b55 <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b4d:	89 f0                	mov    %esi,%eax
+  800b4f:	48 89 d1             	mov    %rdx,%rcx
+  800b52:	fc                   	cld
+  800b53:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b55:	48 89 f8             	mov    %rdi,%rax
+  800b58:	c3                   	ret
+
+0000000000800b59 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b59:	48 89 f8             	mov    %rdi,%rax
+  800b5c:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b5f:	48 39 fe             	cmp    %rdi,%rsi
+  800b62:	73 3a                	jae    800b9e <memmove+0x45>
+  800b64:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800b68:	48 39 d7             	cmp    %rdx,%rdi
+  800b6b:	73 31                	jae    800b9e <memmove+0x45>
+		s += n;
+		d += n;
+  800b6d:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800b71:	48 89 d6             	mov    %rdx,%rsi
+  800b74:	48 09 fe             	or     %rdi,%rsi
+  800b77:	48 09 ce             	or     %rcx,%rsi
+  800b7a:	40 f6 c6 03          	test   $0x3,%sil
+  800b7e:	75 11                	jne    800b91 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b80:	48 83 ef 04          	sub    $0x4,%rdi
+  800b84:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800b88:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800b8c:	fd                   	std
+  800b8d:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800b8f:	eb 0b                	jmp    800b9c <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b91:	48 83 ef 01          	sub    $0x1,%rdi
+  800b95:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800b99:	fd                   	std
+  800b9a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b9c:	fc                   	cld
+  800b9d:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800b9e:	48 89 f2             	mov    %rsi,%rdx
+  800ba1:	48 09 c2             	or     %rax,%rdx
+  800ba4:	48 09 ca             	or     %rcx,%rdx
+  800ba7:	f6 c2 03             	test   $0x3,%dl
+  800baa:	75 0b                	jne    800bb7 <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bac:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800bb0:	48 89 c7             	mov    %rax,%rdi
+  800bb3:	fc                   	cld
+  800bb4:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800bb6:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800bb7:	48 89 c7             	mov    %rax,%rdi
+  800bba:	fc                   	cld
+  800bbb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800bbd:	c3                   	ret
+
+0000000000800bbe <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bbe:	55                   	push   %rbp
+  800bbf:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800bc2:	48 b8 59 0b 80 00 00 	movabs $0x800b59,%rax
+  800bc9:	00 00 00 
+  800bcc:	ff d0                	call   *%rax
+}
+  800bce:	5d                   	pop    %rbp
+  800bcf:	c3                   	ret
+
+0000000000800bd0 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800bd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd5:	48 39 c2             	cmp    %rax,%rdx
+  800bd8:	74 1e                	je     800bf8 <memcmp+0x28>
+		if (*s1 != *s2)
+  800bda:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800bde:	48 83 c0 01          	add    $0x1,%rax
+  800be2:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800be8:	44 38 c1             	cmp    %r8b,%cl
+  800beb:	74 e8                	je     800bd5 <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800bed:	0f b6 c1             	movzbl %cl,%eax
+  800bf0:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800bf4:	44 29 c0             	sub    %r8d,%eax
+  800bf7:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bfd:	c3                   	ret
+
+0000000000800bfe <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800bfe:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800c01:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800c04:	eb 04                	jmp    800c0a <memfind+0xc>
+  800c06:	48 83 c0 01          	add    $0x1,%rax
+  800c0a:	48 39 d0             	cmp    %rdx,%rax
+  800c0d:	73 05                	jae    800c14 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c0f:	40 38 30             	cmp    %sil,(%rax)
+  800c12:	75 f2                	jne    800c06 <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800c14:	c3                   	ret
+
+0000000000800c15 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c15:	48 89 f9             	mov    %rdi,%rcx
+  800c18:	49 89 f0             	mov    %rsi,%r8
+  800c1b:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c1d:	eb 04                	jmp    800c23 <strtol+0xe>
+		s++;
+  800c1f:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800c23:	0f b6 01             	movzbl (%rcx),%eax
+  800c26:	3c 20                	cmp    $0x20,%al
+  800c28:	74 f5                	je     800c1f <strtol+0xa>
+  800c2a:	3c 09                	cmp    $0x9,%al
+  800c2c:	74 f1                	je     800c1f <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c2e:	3c 2b                	cmp    $0x2b,%al
+  800c30:	74 2b                	je     800c5d <strtol+0x48>
+	int neg = 0;
+  800c32:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800c38:	3c 2d                	cmp    $0x2d,%al
+  800c3a:	74 2d                	je     800c69 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c3c:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800c42:	75 0f                	jne    800c53 <strtol+0x3e>
+  800c44:	80 39 30             	cmpb   $0x30,(%rcx)
+  800c47:	74 2c                	je     800c75 <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c49:	85 ff                	test   %edi,%edi
+  800c4b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c50:	0f 44 f8             	cmove  %eax,%edi
+  800c53:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800c58:	4c 63 d7             	movslq %edi,%r10
+  800c5b:	eb 4f                	jmp    800cac <strtol+0x97>
+		s++;
+  800c5d:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800c61:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800c67:	eb d3                	jmp    800c3c <strtol+0x27>
+		s++, neg = 1;
+  800c69:	48 83 c1 01          	add    $0x1,%rcx
+  800c6d:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800c73:	eb c7                	jmp    800c3c <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c75:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800c79:	74 0f                	je     800c8a <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800c7b:	85 ff                	test   %edi,%edi
+  800c7d:	75 d4                	jne    800c53 <strtol+0x3e>
+		s++, base = 8;
+  800c7f:	48 83 c1 01          	add    $0x1,%rcx
+  800c83:	bf 08 00 00 00       	mov    $0x8,%edi
+  800c88:	eb c9                	jmp    800c53 <strtol+0x3e>
+		s += 2, base = 16;
+  800c8a:	48 83 c1 02          	add    $0x2,%rcx
+  800c8e:	bf 10 00 00 00       	mov    $0x10,%edi
+  800c93:	eb be                	jmp    800c53 <strtol+0x3e>
+			dig = *s - '0';
+  800c95:	0f be c0             	movsbl %al,%eax
+  800c98:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800c9b:	39 f8                	cmp    %edi,%eax
+  800c9d:	7d 3b                	jge    800cda <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800c9f:	48 83 c1 01          	add    $0x1,%rcx
+  800ca3:	49 0f af d2          	imul   %r10,%rdx
+  800ca7:	48 98                	cltq
+  800ca9:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800cac:	0f b6 01             	movzbl (%rcx),%eax
+  800caf:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800cb2:	40 80 fe 09          	cmp    $0x9,%sil
+  800cb6:	76 dd                	jbe    800c95 <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800cb8:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800cbb:	40 80 fe 19          	cmp    $0x19,%sil
+  800cbf:	77 08                	ja     800cc9 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800cc1:	0f be c0             	movsbl %al,%eax
+  800cc4:	83 e8 57             	sub    $0x57,%eax
+  800cc7:	eb d2                	jmp    800c9b <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cc9:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800ccc:	40 80 fe 19          	cmp    $0x19,%sil
+  800cd0:	77 08                	ja     800cda <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800cd2:	0f be c0             	movsbl %al,%eax
+  800cd5:	83 e8 37             	sub    $0x37,%eax
+  800cd8:	eb c1                	jmp    800c9b <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800cda:	4d 85 c0             	test   %r8,%r8
+  800cdd:	74 03                	je     800ce2 <strtol+0xcd>
+		*endptr = (char *) s;
+  800cdf:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800ce2:	48 89 d0             	mov    %rdx,%rax
+  800ce5:	48 f7 d8             	neg    %rax
+  800ce8:	45 85 c9             	test   %r9d,%r9d
+  800ceb:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800cef:	48 89 d0             	mov    %rdx,%rax
+  800cf2:	c3                   	ret
+
+0000000000800cf3 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800cf3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800cf9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800cff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d04:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d09:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800d0b:	c3                   	ret
+
+0000000000800d0c <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800d0c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800d12:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800d18:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d1d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d22:	48 89 fe             	mov    %rdi,%rsi
+  800d25:	48 89 fa             	mov    %rdi,%rdx
+  800d28:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d2a:	c3                   	ret
+
+0000000000800d2b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800d2b:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800d2e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800d34:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800d3a:	be 00 00 00 00       	mov    $0x0,%esi
+  800d3f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d44:	48 89 f2             	mov    %rsi,%rdx
+  800d47:	0f 05                	syscall
+	if(check && ret > 0)
+  800d49:	48 85 c0             	test   %rax,%rax
+  800d4c:	7f 01                	jg     800d4f <sys_env_destroy+0x24>
+}
+  800d4e:	c3                   	ret
+{
+  800d4f:	55                   	push   %rbp
+  800d50:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d53:	49 89 c0             	mov    %rax,%r8
+  800d56:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800d5b:	48 ba 88 16 80 00 00 	movabs $0x801688,%rdx
+  800d62:	00 00 00 
+  800d65:	be 28 00 00 00       	mov    $0x28,%esi
+  800d6a:	48 bf a5 16 80 00 00 	movabs $0x8016a5,%rdi
+  800d71:	00 00 00 
+  800d74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d79:	49 b9 ae 11 80 00 00 	movabs $0x8011ae,%r9
+  800d80:	00 00 00 
+  800d83:	41 ff d1             	call   *%r9
+
+0000000000800d86 <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800d86:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800d8d:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800d8e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800d93:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800d97:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800d9b:	48 c1 e2 04          	shl    $0x4,%rdx
+  800d9f:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800da6:	00 00 00 
+  800da9:	48 01 d0             	add    %rdx,%rax
+  800dac:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800db2:	c3                   	ret
+
+0000000000800db3 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800db3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800db9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800dbf:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dc4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dc9:	48 89 fe             	mov    %rdi,%rsi
+  800dcc:	48 89 fa             	mov    %rdi,%rdx
+  800dcf:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800dd1:	c3                   	ret
+
+0000000000800dd2 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  800dd2:	48 63 d2             	movslq %edx,%rdx
+  800dd5:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800dd8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800dde:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800de4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800de9:	0f 05                	syscall
+	if(check && ret > 0)
+  800deb:	48 85 c0             	test   %rax,%rax
+  800dee:	7f 01                	jg     800df1 <sys_page_alloc+0x1f>
+}
+  800df0:	c3                   	ret
+{
+  800df1:	55                   	push   %rbp
+  800df2:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df5:	49 89 c0             	mov    %rax,%r8
+  800df8:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800dfd:	48 ba 88 16 80 00 00 	movabs $0x801688,%rdx
+  800e04:	00 00 00 
+  800e07:	be 28 00 00 00       	mov    $0x28,%esi
+  800e0c:	48 bf a5 16 80 00 00 	movabs $0x8016a5,%rdi
+  800e13:	00 00 00 
+  800e16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1b:	49 b9 ae 11 80 00 00 	movabs $0x8011ae,%r9
+  800e22:	00 00 00 
+  800e25:	41 ff d1             	call   *%r9
+
+0000000000800e28 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  800e28:	48 63 d2             	movslq %edx,%rdx
+  800e2b:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800e2e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800e34:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800e3a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e3f:	0f 05                	syscall
+	if(check && ret > 0)
+  800e41:	48 85 c0             	test   %rax,%rax
+  800e44:	7f 01                	jg     800e47 <sys_page_alloc_huge+0x1f>
+}
+  800e46:	c3                   	ret
+{
+  800e47:	55                   	push   %rbp
+  800e48:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e4b:	49 89 c0             	mov    %rax,%r8
+  800e4e:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800e53:	48 ba 88 16 80 00 00 	movabs $0x801688,%rdx
+  800e5a:	00 00 00 
+  800e5d:	be 28 00 00 00       	mov    $0x28,%esi
+  800e62:	48 bf a5 16 80 00 00 	movabs $0x8016a5,%rdi
+  800e69:	00 00 00 
+  800e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e71:	49 b9 ae 11 80 00 00 	movabs $0x8011ae,%r9
+  800e78:	00 00 00 
+  800e7b:	41 ff d1             	call   *%r9
+
+0000000000800e7e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e7e:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  800e81:	48 63 d2             	movslq %edx,%rdx
+  800e84:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800e87:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  800e8a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e8f:	0f 05                	syscall
+	if(check && ret > 0)
+  800e91:	48 85 c0             	test   %rax,%rax
+  800e94:	7f 01                	jg     800e97 <sys_page_map+0x19>
+}
+  800e96:	c3                   	ret
+{
+  800e97:	55                   	push   %rbp
+  800e98:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e9b:	49 89 c0             	mov    %rax,%r8
+  800e9e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800ea3:	48 ba 88 16 80 00 00 	movabs $0x801688,%rdx
+  800eaa:	00 00 00 
+  800ead:	be 28 00 00 00       	mov    $0x28,%esi
+  800eb2:	48 bf a5 16 80 00 00 	movabs $0x8016a5,%rdi
+  800eb9:	00 00 00 
+  800ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec1:	49 b9 ae 11 80 00 00 	movabs $0x8011ae,%r9
+  800ec8:	00 00 00 
+  800ecb:	41 ff d1             	call   *%r9
+
+0000000000800ece <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  800ece:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800ed1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800ed7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800edd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee2:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ee7:	0f 05                	syscall
+	if(check && ret > 0)
+  800ee9:	48 85 c0             	test   %rax,%rax
+  800eec:	7f 01                	jg     800eef <sys_page_unmap+0x21>
+}
+  800eee:	c3                   	ret
+{
+  800eef:	55                   	push   %rbp
+  800ef0:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef3:	49 89 c0             	mov    %rax,%r8
+  800ef6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800efb:	48 ba 88 16 80 00 00 	movabs $0x801688,%rdx
+  800f02:	00 00 00 
+  800f05:	be 28 00 00 00       	mov    $0x28,%esi
+  800f0a:	48 bf a5 16 80 00 00 	movabs $0x8016a5,%rdi
+  800f11:	00 00 00 
+  800f14:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f19:	49 b9 ae 11 80 00 00 	movabs $0x8011ae,%r9
+  800f20:	00 00 00 
+  800f23:	41 ff d1             	call   *%r9
+
+0000000000800f26 <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  800f26:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f2c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f32:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f37:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f3c:	48 89 fe             	mov    %rdi,%rsi
+  800f3f:	48 89 fa             	mov    %rdi,%rdx
+  800f42:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f44:	c3                   	ret
+
+0000000000800f45 <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  800f45:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f4b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f51:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f56:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f5b:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  800f5d:	c3                   	ret
+
+0000000000800f5e <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  800f5e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f64:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f6a:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f6f:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  800f71:	c3                   	ret
+
+0000000000800f72 <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  800f72:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  800f75:	48 63 f6             	movslq %esi,%rsi
+  800f78:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800f7b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f81:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f86:	0f 05                	syscall
+	if(check && ret > 0)
+  800f88:	48 85 c0             	test   %rax,%rax
+  800f8b:	7f 01                	jg     800f8e <sys_page_batch+0x1c>
+}
+  800f8d:	c3                   	ret
+{
+  800f8e:	55                   	push   %rbp
+  800f8f:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f92:	49 89 c0             	mov    %rax,%r8
+  800f95:	b9 12 00 00 00       	mov    $0x12,%ecx
+  800f9a:	48 ba 88 16 80 00 00 	movabs $0x801688,%rdx
+  800fa1:	00 00 00 
+  800fa4:	be 28 00 00 00       	mov    $0x28,%esi
+  800fa9:	48 bf a5 16 80 00 00 	movabs $0x8016a5,%rdi
+  800fb0:	00 00 00 
+  800fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb8:	49 b9 ae 11 80 00 00 	movabs $0x8011ae,%r9
+  800fbf:	00 00 00 
+  800fc2:	41 ff d1             	call   *%r9
+
+0000000000800fc5 <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  800fc5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fcb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fd1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fd6:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fdb:	48 89 f2             	mov    %rsi,%rdx
+  800fde:	0f 05                	syscall
+	if(check && ret > 0)
+  800fe0:	48 85 c0             	test   %rax,%rax
+  800fe3:	7f 01                	jg     800fe6 <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  800fe5:	c3                   	ret
+{
+  800fe6:	55                   	push   %rbp
+  800fe7:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fea:	49 89 c0             	mov    %rax,%r8
+  800fed:	b9 13 00 00 00       	mov    $0x13,%ecx
+  800ff2:	48 ba 88 16 80 00 00 	movabs $0x801688,%rdx
+  800ff9:	00 00 00 
+  800ffc:	be 28 00 00 00       	mov    $0x28,%esi
+  801001:	48 bf a5 16 80 00 00 	movabs $0x8016a5,%rdi
+  801008:	00 00 00 
+  80100b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801010:	49 b9 ae 11 80 00 00 	movabs $0x8011ae,%r9
+  801017:	00 00 00 
+  80101a:	41 ff d1             	call   *%r9
+
+000000000080101d <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  80101d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801023:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801029:	bf 00 00 00 00       	mov    $0x0,%edi
+  80102e:	b8 14 00 00 00       	mov    $0x14,%eax
+  801033:	48 89 fe             	mov    %rdi,%rsi
+  801036:	48 89 fa             	mov    %rdi,%rdx
+  801039:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80103b:	c3                   	ret
+
+000000000080103c <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  80103c:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80103f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801045:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80104b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801050:	0f 05                	syscall
+	if(check && ret > 0)
+  801052:	48 85 c0             	test   %rax,%rax
+  801055:	7f 01                	jg     801058 <sys_page_unmap_range+0x1c>
+}
+  801057:	c3                   	ret
+{
+  801058:	55                   	push   %rbp
+  801059:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80105c:	49 89 c0             	mov    %rax,%r8
+  80105f:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801064:	48 ba 88 16 80 00 00 	movabs $0x801688,%rdx
+  80106b:	00 00 00 
+  80106e:	be 28 00 00 00       	mov    $0x28,%esi
+  801073:	48 bf a5 16 80 00 00 	movabs $0x8016a5,%rdi
+  80107a:	00 00 00 
+  80107d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801082:	49 b9 ae 11 80 00 00 	movabs $0x8011ae,%r9
+  801089:	00 00 00 
+  80108c:	41 ff d1             	call   *%r9
+
+000000000080108f <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80108f:	48 63 f6             	movslq %esi,%rsi
+  801092:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801095:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80109b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010ab:	0f 05                	syscall
+	if(check && ret > 0)
+  8010ad:	48 85 c0             	test   %rax,%rax
+  8010b0:	7f 01                	jg     8010b3 <sys_env_set_status+0x24>
+}
+  8010b2:	c3                   	ret
+{
+  8010b3:	55                   	push   %rbp
+  8010b4:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010b7:	49 89 c0             	mov    %rax,%r8
+  8010ba:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8010bf:	48 ba 88 16 80 00 00 	movabs $0x801688,%rdx
+  8010c6:	00 00 00 
+  8010c9:	be 28 00 00 00       	mov    $0x28,%esi
+  8010ce:	48 bf a5 16 80 00 00 	movabs $0x8016a5,%rdi
+  8010d5:	00 00 00 
+  8010d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010dd:	49 b9 ae 11 80 00 00 	movabs $0x8011ae,%r9
+  8010e4:	00 00 00 
+  8010e7:	41 ff d1             	call   *%r9
+
+00000000008010ea <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8010ea:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8010ed:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010fe:	b8 09 00 00 00       	mov    $0x9,%eax
+  801103:	0f 05                	syscall
+	if(check && ret > 0)
+  801105:	48 85 c0             	test   %rax,%rax
+  801108:	7f 01                	jg     80110b <sys_env_set_pgfault_upcall+0x21>
+}
+  80110a:	c3                   	ret
+{
+  80110b:	55                   	push   %rbp
+  80110c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80110f:	49 89 c0             	mov    %rax,%r8
+  801112:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801117:	48 ba 88 16 80 00 00 	movabs $0x801688,%rdx
+  80111e:	00 00 00 
+  801121:	be 28 00 00 00       	mov    $0x28,%esi
+  801126:	48 bf a5 16 80 00 00 	movabs $0x8016a5,%rdi
+  80112d:	00 00 00 
+  801130:	b8 00 00 00 00       	mov    $0x0,%eax
+  801135:	49 b9 ae 11 80 00 00 	movabs $0x8011ae,%r9
+  80113c:	00 00 00 
+  80113f:	41 ff d1             	call   *%r9
+
+0000000000801142 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  801142:	48 63 ff             	movslq %edi,%rdi
+  801145:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  801148:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80114e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801153:	0f 05                	syscall
+}
+  801155:	c3                   	ret
+
+0000000000801156 <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  801156:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80115c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801162:	be 00 00 00 00       	mov    $0x0,%esi
+  801167:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80116c:	48 89 f2             	mov    %rsi,%rdx
+  80116f:	0f 05                	syscall
+	if(check && ret > 0)
+  801171:	48 85 c0             	test   %rax,%rax
+  801174:	7f 01                	jg     801177 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  801176:	c3                   	ret
+{
+  801177:	55                   	push   %rbp
+  801178:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80117b:	49 89 c0             	mov    %rax,%r8
+  80117e:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801183:	48 ba 88 16 80 00 00 	movabs $0x801688,%rdx
+  80118a:	00 00 00 
+  80118d:	be 28 00 00 00       	mov    $0x28,%esi
+  801192:	48 bf a5 16 80 00 00 	movabs $0x8016a5,%rdi
+  801199:	00 00 00 
+  80119c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a1:	49 b9 ae 11 80 00 00 	movabs $0x8011ae,%r9
+  8011a8:	00 00 00 
+  8011ab:	41 ff d1             	call   *%r9
+
+00000000008011ae <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8011ae:	55                   	push   %rbp
+  8011af:	48 89 e5             	mov    %rsp,%rbp
+  8011b2:	41 56                	push   %r14
+  8011b4:	41 55                	push   %r13
+  8011b6:	41 54                	push   %r12
+  8011b8:	53                   	push   %rbx
+  8011b9:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8011c0:	49 89 fc             	mov    %rdi,%r12
+  8011c3:	41 89 f5             	mov    %esi,%r13d
+  8011c6:	48 89 d3             	mov    %rdx,%rbx
+  8011c9:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8011d0:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8011d7:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8011de:	84 c0                	test   %al,%al
+  8011e0:	74 26                	je     801208 <_panic+0x5a>
+  8011e2:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8011e9:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8011f0:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8011f4:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8011f8:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8011fc:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  801200:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  801204:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801208:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  80120f:	00 00 00 
+  801212:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  801219:	00 00 00 
+  80121c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801220:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  801227:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  80122e:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801235:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  80123c:	00 00 00 
+  80123f:	4c 8b 30             	mov    (%rax),%r14
+  801242:	48 b8 86 0d 80 00 00 	movabs $0x800d86,%rax
+  801249:	00 00 00 
+  80124c:	ff d0                	call   *%rax
+  80124e:	89 c6                	mov    %eax,%esi
+  801250:	45 89 e8             	mov    %r13d,%r8d
+  801253:	4c 89 e1             	mov    %r12,%rcx
+  801256:	4c 89 f2             	mov    %r14,%rdx
+  801259:	48 bf b8 16 80 00 00 	movabs $0x8016b8,%rdi
+  801260:	00 00 00 
+  801263:	b8 00 00 00 00       	mov    $0x0,%eax
+  801268:	49 bc 4e 01 80 00 00 	movabs $0x80014e,%r12
+  80126f:	00 00 00 
+  801272:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801275:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  80127c:	48 89 df             	mov    %rbx,%rdi
+  80127f:	48 b8 ea 00 80 00 00 	movabs $0x8000ea,%rax
+  801286:	00 00 00 
+  801289:	ff d0                	call   *%rax
+	cprintf("\n");
+  80128b:	48 bf bc 12 80 00 00 	movabs $0x8012bc,%rdi
+  801292:	00 00 00 
+  801295:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129a:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80129d:	cc                   	int3
+	while (1)
+  80129e:	eb fd                	jmp    80129d <_panic+0xef>
@@ -0,0 +1,3251 @@
+
+obj/user/faultregs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 f5 0c 00 00       	call   800d26 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <check_regs>:
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs* a, const char *an, struct regs* b, const char *bn,
+	   const char *testname)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	41 57                	push   %r15
+  800039:	41 56                	push   %r14
+  80003b:	41 55                	push   %r13
+  80003d:	41 54                	push   %r12
+  80003f:	53                   	push   %rbx
+  800040:	48 83 ec 08          	sub    $0x8,%rsp
+  800044:	49 89 fc             	mov    %rdi,%r12
+  800047:	48 89 d3             	mov    %rdx,%rbx
+  80004a:	4d 89 c6             	mov    %r8,%r14
+	int mismatch = 0;
+
+	cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  80004d:	48 89 f2             	mov    %rsi,%rdx
+  800050:	48 be d3 20 80 00 00 	movabs $0x8020d3,%rsi
+  800057:	00 00 00 
+  80005a:	48 bf a0 20 80 00 00 	movabs $0x8020a0,%rdi
+  800061:	00 00 00 
+  800064:	b8 00 00 00 00       	mov    $0x0,%eax
+  800069:	49 bd 0b 0f 80 00 00 	movabs $0x800f0b,%r13
+  800070:	00 00 00 
+  800073:	41 ff d5             	call   *%r13
+			cprintf("MISMATCH\n");				\
+			mismatch = 1;					\
+		}							\
+	} while (0)
+
+	CHECK(r15, regs.reg_r15);
+  800076:	48 8b 0b             	mov    (%rbx),%rcx
+  800079:	49 8b 14 24          	mov    (%r12),%rdx
+  80007d:	48 be b0 20 80 00 00 	movabs $0x8020b0,%rsi
+  800084:	00 00 00 
+  800087:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  80008e:	00 00 00 
+  800091:	b8 00 00 00 00       	mov    $0x0,%eax
+  800096:	41 ff d5             	call   *%r13
+  800099:	48 8b 03             	mov    (%rbx),%rax
+  80009c:	49 39 04 24          	cmp    %rax,(%r12)
+  8000a0:	0f 84 a7 06 00 00    	je     80074d <check_regs+0x71a>
+  8000a6:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  8000ad:	00 00 00 
+  8000b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b5:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  8000bc:	00 00 00 
+  8000bf:	ff d2                	call   *%rdx
+  8000c1:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+	CHECK(r14, regs.reg_r14);
+  8000c7:	48 8b 4b 08          	mov    0x8(%rbx),%rcx
+  8000cb:	49 8b 54 24 08       	mov    0x8(%r12),%rdx
+  8000d0:	48 be d4 20 80 00 00 	movabs $0x8020d4,%rsi
+  8000d7:	00 00 00 
+  8000da:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  8000e1:	00 00 00 
+  8000e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e9:	49 b8 0b 0f 80 00 00 	movabs $0x800f0b,%r8
+  8000f0:	00 00 00 
+  8000f3:	41 ff d0             	call   *%r8
+  8000f6:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8000fa:	49 39 44 24 08       	cmp    %rax,0x8(%r12)
+  8000ff:	0f 84 65 06 00 00    	je     80076a <check_regs+0x737>
+  800105:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  80010c:	00 00 00 
+  80010f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800114:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  80011b:	00 00 00 
+  80011e:	ff d2                	call   *%rdx
+  800120:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+	CHECK(r13, regs.reg_r13);
+  800126:	48 8b 4b 10          	mov    0x10(%rbx),%rcx
+  80012a:	49 8b 54 24 10       	mov    0x10(%r12),%rdx
+  80012f:	48 be d8 20 80 00 00 	movabs $0x8020d8,%rsi
+  800136:	00 00 00 
+  800139:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  800140:	00 00 00 
+  800143:	b8 00 00 00 00       	mov    $0x0,%eax
+  800148:	49 b8 0b 0f 80 00 00 	movabs $0x800f0b,%r8
+  80014f:	00 00 00 
+  800152:	41 ff d0             	call   *%r8
+  800155:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  800159:	49 39 44 24 10       	cmp    %rax,0x10(%r12)
+  80015e:	0f 84 26 06 00 00    	je     80078a <check_regs+0x757>
+  800164:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  80016b:	00 00 00 
+  80016e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800173:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  80017a:	00 00 00 
+  80017d:	ff d2                	call   *%rdx
+  80017f:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+	CHECK(r12, regs.reg_r12);
+  800185:	48 8b 4b 18          	mov    0x18(%rbx),%rcx
+  800189:	49 8b 54 24 18       	mov    0x18(%r12),%rdx
+  80018e:	48 be dc 20 80 00 00 	movabs $0x8020dc,%rsi
+  800195:	00 00 00 
+  800198:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  80019f:	00 00 00 
+  8001a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a7:	49 b8 0b 0f 80 00 00 	movabs $0x800f0b,%r8
+  8001ae:	00 00 00 
+  8001b1:	41 ff d0             	call   *%r8
+  8001b4:	48 8b 43 18          	mov    0x18(%rbx),%rax
+  8001b8:	49 39 44 24 18       	cmp    %rax,0x18(%r12)
+  8001bd:	0f 84 e7 05 00 00    	je     8007aa <check_regs+0x777>
+  8001c3:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  8001ca:	00 00 00 
+  8001cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d2:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  8001d9:	00 00 00 
+  8001dc:	ff d2                	call   *%rdx
+  8001de:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+	CHECK(r11, regs.reg_r11);
+  8001e4:	48 8b 4b 20          	mov    0x20(%rbx),%rcx
+  8001e8:	49 8b 54 24 20       	mov    0x20(%r12),%rdx
+  8001ed:	48 be e0 20 80 00 00 	movabs $0x8020e0,%rsi
+  8001f4:	00 00 00 
+  8001f7:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  8001fe:	00 00 00 
+  800201:	b8 00 00 00 00       	mov    $0x0,%eax
+  800206:	49 b8 0b 0f 80 00 00 	movabs $0x800f0b,%r8
+  80020d:	00 00 00 
+  800210:	41 ff d0             	call   *%r8
+  800213:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  800217:	49 39 44 24 20       	cmp    %rax,0x20(%r12)
+  80021c:	0f 84 a8 05 00 00    	je     8007ca <check_regs+0x797>
+  800222:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  800229:	00 00 00 
+  80022c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800231:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  800238:	00 00 00 
+  80023b:	ff d2                	call   *%rdx
+  80023d:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+	CHECK(r10, regs.reg_r10);
+  800243:	48 8b 4b 28          	mov    0x28(%rbx),%rcx
+  800247:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  80024c:	48 be e4 20 80 00 00 	movabs $0x8020e4,%rsi
+  800253:	00 00 00 
+  800256:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  80025d:	00 00 00 
+  800260:	b8 00 00 00 00       	mov    $0x0,%eax
+  800265:	49 b8 0b 0f 80 00 00 	movabs $0x800f0b,%r8
+  80026c:	00 00 00 
+  80026f:	41 ff d0             	call   *%r8
+  800272:	48 8b 43 28          	mov    0x28(%rbx),%rax
+  800276:	49 39 44 24 28       	cmp    %rax,0x28(%r12)
+  80027b:	0f 84 69 05 00 00    	je     8007ea <check_regs+0x7b7>
+  800281:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  800288:	00 00 00 
+  80028b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800290:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  800297:	00 00 00 
+  80029a:	ff d2                	call   *%rdx
+  80029c:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+	CHECK(r9, regs.reg_r9);
+  8002a2:	48 8b 4b 30          	mov    0x30(%rbx),%rcx
+  8002a6:	49 8b 54 24 30       	mov    0x30(%r12),%rdx
+  8002ab:	48 be e8 20 80 00 00 	movabs $0x8020e8,%rsi
+  8002b2:	00 00 00 
+  8002b5:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  8002bc:	00 00 00 
+  8002bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c4:	49 b8 0b 0f 80 00 00 	movabs $0x800f0b,%r8
+  8002cb:	00 00 00 
+  8002ce:	41 ff d0             	call   *%r8
+  8002d1:	48 8b 43 30          	mov    0x30(%rbx),%rax
+  8002d5:	49 39 44 24 30       	cmp    %rax,0x30(%r12)
+  8002da:	0f 84 2a 05 00 00    	je     80080a <check_regs+0x7d7>
+  8002e0:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  8002e7:	00 00 00 
+  8002ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ef:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  8002f6:	00 00 00 
+  8002f9:	ff d2                	call   *%rdx
+  8002fb:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+	CHECK(r8, regs.reg_r8);
+  800301:	48 8b 4b 38          	mov    0x38(%rbx),%rcx
+  800305:	49 8b 54 24 38       	mov    0x38(%r12),%rdx
+  80030a:	48 be eb 20 80 00 00 	movabs $0x8020eb,%rsi
+  800311:	00 00 00 
+  800314:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  80031b:	00 00 00 
+  80031e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800323:	49 b8 0b 0f 80 00 00 	movabs $0x800f0b,%r8
+  80032a:	00 00 00 
+  80032d:	41 ff d0             	call   *%r8
+  800330:	48 8b 43 38          	mov    0x38(%rbx),%rax
+  800334:	49 39 44 24 38       	cmp    %rax,0x38(%r12)
+  800339:	0f 84 eb 04 00 00    	je     80082a <check_regs+0x7f7>
+  80033f:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  800346:	00 00 00 
+  800349:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034e:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  800355:	00 00 00 
+  800358:	ff d2                	call   *%rdx
+  80035a:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+
+	CHECK(rbp, regs.reg_rbp);
+  800360:	48 8b 4b 50          	mov    0x50(%rbx),%rcx
+  800364:	49 8b 54 24 50       	mov    0x50(%r12),%rdx
+  800369:	48 be ee 20 80 00 00 	movabs $0x8020ee,%rsi
+  800370:	00 00 00 
+  800373:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  80037a:	00 00 00 
+  80037d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800382:	49 b8 0b 0f 80 00 00 	movabs $0x800f0b,%r8
+  800389:	00 00 00 
+  80038c:	41 ff d0             	call   *%r8
+  80038f:	48 8b 43 50          	mov    0x50(%rbx),%rax
+  800393:	49 39 44 24 50       	cmp    %rax,0x50(%r12)
+  800398:	0f 84 ac 04 00 00    	je     80084a <check_regs+0x817>
+  80039e:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  8003a5:	00 00 00 
+  8003a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ad:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  8003b4:	00 00 00 
+  8003b7:	ff d2                	call   *%rdx
+  8003b9:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+	CHECK(rdi, regs.reg_rdi);
+  8003bf:	48 8b 4b 48          	mov    0x48(%rbx),%rcx
+  8003c3:	49 8b 54 24 48       	mov    0x48(%r12),%rdx
+  8003c8:	48 be f2 20 80 00 00 	movabs $0x8020f2,%rsi
+  8003cf:	00 00 00 
+  8003d2:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  8003d9:	00 00 00 
+  8003dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e1:	49 b8 0b 0f 80 00 00 	movabs $0x800f0b,%r8
+  8003e8:	00 00 00 
+  8003eb:	41 ff d0             	call   *%r8
+  8003ee:	48 8b 43 48          	mov    0x48(%rbx),%rax
+  8003f2:	49 39 44 24 48       	cmp    %rax,0x48(%r12)
+  8003f7:	0f 84 6d 04 00 00    	je     80086a <check_regs+0x837>
+  8003fd:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  800404:	00 00 00 
+  800407:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040c:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  800413:	00 00 00 
+  800416:	ff d2                	call   *%rdx
+  800418:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+	CHECK(rsi, regs.reg_rsi);
+  80041e:	48 8b 4b 40          	mov    0x40(%rbx),%rcx
+  800422:	49 8b 54 24 40       	mov    0x40(%r12),%rdx
+  800427:	48 be f6 20 80 00 00 	movabs $0x8020f6,%rsi
+  80042e:	00 00 00 
+  800431:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  800438:	00 00 00 
+  80043b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800440:	49 b8 0b 0f 80 00 00 	movabs $0x800f0b,%r8
+  800447:	00 00 00 
+  80044a:	41 ff d0             	call   *%r8
+  80044d:	48 8b 43 40          	mov    0x40(%rbx),%rax
+  800451:	49 39 44 24 40       	cmp    %rax,0x40(%r12)
+  800456:	0f 84 2e 04 00 00    	je     80088a <check_regs+0x857>
+  80045c:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  800463:	00 00 00 
+  800466:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046b:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  800472:	00 00 00 
+  800475:	ff d2                	call   *%rdx
+  800477:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+	CHECK(rdx, regs.reg_rdx);
+  80047d:	48 8b 4b 58          	mov    0x58(%rbx),%rcx
+  800481:	49 8b 54 24 58       	mov    0x58(%r12),%rdx
+  800486:	48 be fa 20 80 00 00 	movabs $0x8020fa,%rsi
+  80048d:	00 00 00 
+  800490:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  800497:	00 00 00 
+  80049a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80049f:	49 b8 0b 0f 80 00 00 	movabs $0x800f0b,%r8
+  8004a6:	00 00 00 
+  8004a9:	41 ff d0             	call   *%r8
+  8004ac:	48 8b 43 58          	mov    0x58(%rbx),%rax
+  8004b0:	49 39 44 24 58       	cmp    %rax,0x58(%r12)
+  8004b5:	0f 84 ef 03 00 00    	je     8008aa <check_regs+0x877>
+  8004bb:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  8004c2:	00 00 00 
+  8004c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ca:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  8004d1:	00 00 00 
+  8004d4:	ff d2                	call   *%rdx
+  8004d6:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+	CHECK(rcx, regs.reg_rcx);
+  8004dc:	48 8b 4b 60          	mov    0x60(%rbx),%rcx
+  8004e0:	49 8b 54 24 60       	mov    0x60(%r12),%rdx
+  8004e5:	48 be fe 20 80 00 00 	movabs $0x8020fe,%rsi
+  8004ec:	00 00 00 
+  8004ef:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  8004f6:	00 00 00 
+  8004f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fe:	49 b8 0b 0f 80 00 00 	movabs $0x800f0b,%r8
+  800505:	00 00 00 
+  800508:	41 ff d0             	call   *%r8
+  80050b:	48 8b 43 60          	mov    0x60(%rbx),%rax
+  80050f:	49 39 44 24 60       	cmp    %rax,0x60(%r12)
+  800514:	0f 84 b0 03 00 00    	je     8008ca <check_regs+0x897>
+  80051a:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  800521:	00 00 00 
+  800524:	b8 00 00 00 00       	mov    $0x0,%eax
+  800529:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  800530:	00 00 00 
+  800533:	ff d2                	call   *%rdx
+  800535:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+	CHECK(rbx, regs.reg_rbx);
+  80053b:	48 8b 4b 68          	mov    0x68(%rbx),%rcx
+  80053f:	49 8b 54 24 68       	mov    0x68(%r12),%rdx
+  800544:	48 be 02 21 80 00 00 	movabs $0x802102,%rsi
+  80054b:	00 00 00 
+  80054e:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  800555:	00 00 00 
+  800558:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055d:	49 b8 0b 0f 80 00 00 	movabs $0x800f0b,%r8
+  800564:	00 00 00 
+  800567:	41 ff d0             	call   *%r8
+  80056a:	48 8b 43 68          	mov    0x68(%rbx),%rax
+  80056e:	49 39 44 24 68       	cmp    %rax,0x68(%r12)
+  800573:	0f 84 71 03 00 00    	je     8008ea <check_regs+0x8b7>
+  800579:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  800580:	00 00 00 
+  800583:	b8 00 00 00 00       	mov    $0x0,%eax
+  800588:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  80058f:	00 00 00 
+  800592:	ff d2                	call   *%rdx
+  800594:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+	CHECK(rax, regs.reg_rax);
+  80059a:	48 8b 4b 70          	mov    0x70(%rbx),%rcx
+  80059e:	49 8b 54 24 70       	mov    0x70(%r12),%rdx
+  8005a3:	48 be 06 21 80 00 00 	movabs $0x802106,%rsi
+  8005aa:	00 00 00 
+  8005ad:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  8005b4:	00 00 00 
+  8005b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005bc:	49 b8 0b 0f 80 00 00 	movabs $0x800f0b,%r8
+  8005c3:	00 00 00 
+  8005c6:	41 ff d0             	call   *%r8
+  8005c9:	48 8b 43 70          	mov    0x70(%rbx),%rax
+  8005cd:	49 39 44 24 70       	cmp    %rax,0x70(%r12)
+  8005d2:	0f 84 32 03 00 00    	je     80090a <check_regs+0x8d7>
+  8005d8:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  8005df:	00 00 00 
+  8005e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e7:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  8005ee:	00 00 00 
+  8005f1:	ff d2                	call   *%rdx
+  8005f3:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+
+	CHECK(rip, rip);
+  8005f9:	48 8b 4b 78          	mov    0x78(%rbx),%rcx
+  8005fd:	49 8b 54 24 78       	mov    0x78(%r12),%rdx
+  800602:	48 be 0a 21 80 00 00 	movabs $0x80210a,%rsi
+  800609:	00 00 00 
+  80060c:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  800613:	00 00 00 
+  800616:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061b:	49 b8 0b 0f 80 00 00 	movabs $0x800f0b,%r8
+  800622:	00 00 00 
+  800625:	41 ff d0             	call   *%r8
+  800628:	48 8b 43 78          	mov    0x78(%rbx),%rax
+  80062c:	49 39 44 24 78       	cmp    %rax,0x78(%r12)
+  800631:	0f 84 f3 02 00 00    	je     80092a <check_regs+0x8f7>
+  800637:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  80063e:	00 00 00 
+  800641:	b8 00 00 00 00       	mov    $0x0,%eax
+  800646:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  80064d:	00 00 00 
+  800650:	ff d2                	call   *%rdx
+  800652:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+	CHECK(eflags, eflags);
+  800658:	48 8b 8b 80 00 00 00 	mov    0x80(%rbx),%rcx
+  80065f:	49 8b 94 24 80 00 00 	mov    0x80(%r12),%rdx
+  800666:	00 
+  800667:	48 be 0e 21 80 00 00 	movabs $0x80210e,%rsi
+  80066e:	00 00 00 
+  800671:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  800678:	00 00 00 
+  80067b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800680:	49 b8 0b 0f 80 00 00 	movabs $0x800f0b,%r8
+  800687:	00 00 00 
+  80068a:	41 ff d0             	call   *%r8
+  80068d:	48 8b 83 80 00 00 00 	mov    0x80(%rbx),%rax
+  800694:	49 39 84 24 80 00 00 	cmp    %rax,0x80(%r12)
+  80069b:	00 
+  80069c:	0f 84 a8 02 00 00    	je     80094a <check_regs+0x917>
+  8006a2:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  8006a9:	00 00 00 
+  8006ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006b1:	49 bd 0b 0f 80 00 00 	movabs $0x800f0b,%r13
+  8006b8:	00 00 00 
+  8006bb:	41 ff d5             	call   *%r13
+	CHECK(rsp, rsp);
+  8006be:	48 8b 8b 88 00 00 00 	mov    0x88(%rbx),%rcx
+  8006c5:	49 8b 94 24 88 00 00 	mov    0x88(%r12),%rdx
+  8006cc:	00 
+  8006cd:	48 be 15 21 80 00 00 	movabs $0x802115,%rsi
+  8006d4:	00 00 00 
+  8006d7:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  8006de:	00 00 00 
+  8006e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e6:	41 ff d5             	call   *%r13
+  8006e9:	48 8b 83 88 00 00 00 	mov    0x88(%rbx),%rax
+  8006f0:	49 39 84 24 88 00 00 	cmp    %rax,0x88(%r12)
+  8006f7:	00 
+  8006f8:	0f 84 0a 03 00 00    	je     800a08 <check_regs+0x9d5>
+  8006fe:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  800705:	00 00 00 
+  800708:	b8 00 00 00 00       	mov    $0x0,%eax
+  80070d:	48 bb 0b 0f 80 00 00 	movabs $0x800f0b,%rbx
+  800714:	00 00 00 
+  800717:	ff d3                	call   *%rbx
+
+#undef CHECK
+
+	cprintf("Registers %s ", testname);
+  800719:	4c 89 f6             	mov    %r14,%rsi
+  80071c:	48 bf 19 21 80 00 00 	movabs $0x802119,%rdi
+  800723:	00 00 00 
+  800726:	b8 00 00 00 00       	mov    $0x0,%eax
+  80072b:	ff d3                	call   *%rbx
+	if (!mismatch)
+		cprintf("OK\n");
+	else
+		cprintf("MISMATCH\n");
+  80072d:	48 bf ca 20 80 00 00 	movabs $0x8020ca,%rdi
+  800734:	00 00 00 
+  800737:	b8 00 00 00 00       	mov    $0x0,%eax
+  80073c:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  800743:	00 00 00 
+  800746:	ff d2                	call   *%rdx
+}
+  800748:	e9 ac 02 00 00       	jmp    8009f9 <check_regs+0x9c6>
+	CHECK(r15, regs.reg_r15);
+  80074d:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  800754:	00 00 00 
+  800757:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075c:	41 ff d5             	call   *%r13
+	int mismatch = 0;
+  80075f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800765:	e9 5d f9 ff ff       	jmp    8000c7 <check_regs+0x94>
+	CHECK(r14, regs.reg_r14);
+  80076a:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  800771:	00 00 00 
+  800774:	b8 00 00 00 00       	mov    $0x0,%eax
+  800779:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  800780:	00 00 00 
+  800783:	ff d2                	call   *%rdx
+  800785:	e9 9c f9 ff ff       	jmp    800126 <check_regs+0xf3>
+	CHECK(r13, regs.reg_r13);
+  80078a:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  800791:	00 00 00 
+  800794:	b8 00 00 00 00       	mov    $0x0,%eax
+  800799:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  8007a0:	00 00 00 
+  8007a3:	ff d2                	call   *%rdx
+  8007a5:	e9 db f9 ff ff       	jmp    800185 <check_regs+0x152>
+	CHECK(r12, regs.reg_r12);
+  8007aa:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  8007b1:	00 00 00 
+  8007b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b9:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  8007c0:	00 00 00 
+  8007c3:	ff d2                	call   *%rdx
+  8007c5:	e9 1a fa ff ff       	jmp    8001e4 <check_regs+0x1b1>
+	CHECK(r11, regs.reg_r11);
+  8007ca:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  8007d1:	00 00 00 
+  8007d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d9:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  8007e0:	00 00 00 
+  8007e3:	ff d2                	call   *%rdx
+  8007e5:	e9 59 fa ff ff       	jmp    800243 <check_regs+0x210>
+	CHECK(r10, regs.reg_r10);
+  8007ea:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  8007f1:	00 00 00 
+  8007f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f9:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  800800:	00 00 00 
+  800803:	ff d2                	call   *%rdx
+  800805:	e9 98 fa ff ff       	jmp    8002a2 <check_regs+0x26f>
+	CHECK(r9, regs.reg_r9);
+  80080a:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  800811:	00 00 00 
+  800814:	b8 00 00 00 00       	mov    $0x0,%eax
+  800819:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  800820:	00 00 00 
+  800823:	ff d2                	call   *%rdx
+  800825:	e9 d7 fa ff ff       	jmp    800301 <check_regs+0x2ce>
+	CHECK(r8, regs.reg_r8);
+  80082a:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  800831:	00 00 00 
+  800834:	b8 00 00 00 00       	mov    $0x0,%eax
+  800839:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  800840:	00 00 00 
+  800843:	ff d2                	call   *%rdx
+  800845:	e9 16 fb ff ff       	jmp    800360 <check_regs+0x32d>
+	CHECK(rbp, regs.reg_rbp);
+  80084a:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  800851:	00 00 00 
+  800854:	b8 00 00 00 00       	mov    $0x0,%eax
+  800859:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  800860:	00 00 00 
+  800863:	ff d2                	call   *%rdx
+  800865:	e9 55 fb ff ff       	jmp    8003bf <check_regs+0x38c>
+	CHECK(rdi, regs.reg_rdi);
+  80086a:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  800871:	00 00 00 
+  800874:	b8 00 00 00 00       	mov    $0x0,%eax
+  800879:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  800880:	00 00 00 
+  800883:	ff d2                	call   *%rdx
+  800885:	e9 94 fb ff ff       	jmp    80041e <check_regs+0x3eb>
+	CHECK(rsi, regs.reg_rsi);
+  80088a:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  800891:	00 00 00 
+  800894:	b8 00 00 00 00       	mov    $0x0,%eax
+  800899:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  8008a0:	00 00 00 
+  8008a3:	ff d2                	call   *%rdx
+  8008a5:	e9 d3 fb ff ff       	jmp    80047d <check_regs+0x44a>
+	CHECK(rdx, regs.reg_rdx);
+  8008aa:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  8008b1:	00 00 00 
+  8008b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b9:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  8008c0:	00 00 00 
+  8008c3:	ff d2                	call   *%rdx
+  8008c5:	e9 12 fc ff ff       	jmp    8004dc <check_regs+0x4a9>
+	CHECK(rcx, regs.reg_rcx);
+  8008ca:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  8008d1:	00 00 00 
+  8008d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d9:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  8008e0:	00 00 00 
+  8008e3:	ff d2                	call   *%rdx
+  8008e5:	e9 51 fc ff ff       	jmp    80053b <check_regs+0x508>
+	CHECK(rbx, regs.reg_rbx);
+  8008ea:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  8008f1:	00 00 00 
+  8008f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f9:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  800900:	00 00 00 
+  800903:	ff d2                	call   *%rdx
+  800905:	e9 90 fc ff ff       	jmp    80059a <check_regs+0x567>
+	CHECK(rax, regs.reg_rax);
+  80090a:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  800911:	00 00 00 
+  800914:	b8 00 00 00 00       	mov    $0x0,%eax
+  800919:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  800920:	00 00 00 
+  800923:	ff d2                	call   *%rdx
+  800925:	e9 cf fc ff ff       	jmp    8005f9 <check_regs+0x5c6>
+	CHECK(rip, rip);
+  80092a:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  800931:	00 00 00 
+  800934:	b8 00 00 00 00       	mov    $0x0,%eax
+  800939:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  800940:	00 00 00 
+  800943:	ff d2                	call   *%rdx
+  800945:	e9 0e fd ff ff       	jmp    800658 <check_regs+0x625>
+	CHECK(eflags, eflags);
+  80094a:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  800951:	00 00 00 
+  800954:	b8 00 00 00 00       	mov    $0x0,%eax
+  800959:	49 bf 0b 0f 80 00 00 	movabs $0x800f0b,%r15
+  800960:	00 00 00 
+  800963:	41 ff d7             	call   *%r15
+	CHECK(rsp, rsp);
+  800966:	48 8b 8b 88 00 00 00 	mov    0x88(%rbx),%rcx
+  80096d:	49 8b 94 24 88 00 00 	mov    0x88(%r12),%rdx
+  800974:	00 
+  800975:	48 be 15 21 80 00 00 	movabs $0x802115,%rsi
+  80097c:	00 00 00 
+  80097f:	48 bf b4 20 80 00 00 	movabs $0x8020b4,%rdi
+  800986:	00 00 00 
+  800989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098e:	41 ff d7             	call   *%r15
+  800991:	48 8b 83 88 00 00 00 	mov    0x88(%rbx),%rax
+  800998:	49 39 84 24 88 00 00 	cmp    %rax,0x88(%r12)
+  80099f:	00 
+  8009a0:	0f 85 58 fd ff ff    	jne    8006fe <check_regs+0x6cb>
+  8009a6:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  8009ad:	00 00 00 
+  8009b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b5:	48 bb 0b 0f 80 00 00 	movabs $0x800f0b,%rbx
+  8009bc:	00 00 00 
+  8009bf:	ff d3                	call   *%rbx
+	cprintf("Registers %s ", testname);
+  8009c1:	4c 89 f6             	mov    %r14,%rsi
+  8009c4:	48 bf 19 21 80 00 00 	movabs $0x802119,%rdi
+  8009cb:	00 00 00 
+  8009ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d3:	ff d3                	call   *%rbx
+	if (!mismatch)
+  8009d5:	45 85 ed             	test   %r13d,%r13d
+  8009d8:	0f 85 4f fd ff ff    	jne    80072d <check_regs+0x6fa>
+		cprintf("OK\n");
+  8009de:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  8009e5:	00 00 00 
+  8009e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ed:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  8009f4:	00 00 00 
+  8009f7:	ff d2                	call   *%rdx
+}
+  8009f9:	48 83 c4 08          	add    $0x8,%rsp
+  8009fd:	5b                   	pop    %rbx
+  8009fe:	41 5c                	pop    %r12
+  800a00:	41 5d                	pop    %r13
+  800a02:	41 5e                	pop    %r14
+  800a04:	41 5f                	pop    %r15
+  800a06:	5d                   	pop    %rbp
+  800a07:	c3                   	ret
+	CHECK(rsp, rsp);
+  800a08:	48 bf c6 20 80 00 00 	movabs $0x8020c6,%rdi
+  800a0f:	00 00 00 
+  800a12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a17:	48 bb 0b 0f 80 00 00 	movabs $0x800f0b,%rbx
+  800a1e:	00 00 00 
+  800a21:	ff d3                	call   *%rbx
+	cprintf("Registers %s ", testname);
+  800a23:	4c 89 f6             	mov    %r14,%rsi
+  800a26:	48 bf 19 21 80 00 00 	movabs $0x802119,%rdi
+  800a2d:	00 00 00 
+  800a30:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a35:	ff d3                	call   *%rbx
+	if (!mismatch)
+  800a37:	e9 f1 fc ff ff       	jmp    80072d <check_regs+0x6fa>
+
+0000000000800a3c <pgfault>:
+
+static void
+pgfault(struct UTrapframe *utf)
+{
+  800a3c:	55                   	push   %rbp
+  800a3d:	48 89 e5             	mov    %rsp,%rbp
+	int r;
+
+	if (utf->utf_fault_va != (uint64_t)UTEMP)
+  800a40:	48 8b 0f             	mov    (%rdi),%rcx
+  800a43:	48 81 f9 00 00 40 00 	cmp    $0x400000,%rcx
+  800a4a:	0f 85 d5 00 00 00    	jne    800b25 <pgfault+0xe9>
+		panic("pgfault expected at UTEMP, got 0x%016x (rip %016x)",
+		      utf->utf_fault_va, utf->utf_rip);
+
+	// Check registers in UTrapframe
+	during.regs = utf->utf_regs;
+  800a50:	48 ba c0 30 80 00 00 	movabs $0x8030c0,%rdx
+  800a57:	00 00 00 
+  800a5a:	f3 0f 6f 47 10       	movdqu 0x10(%rdi),%xmm0
+  800a5f:	0f 29 02             	movaps %xmm0,(%rdx)
+  800a62:	f3 0f 6f 4f 20       	movdqu 0x20(%rdi),%xmm1
+  800a67:	0f 29 4a 10          	movaps %xmm1,0x10(%rdx)
+  800a6b:	f3 0f 6f 57 30       	movdqu 0x30(%rdi),%xmm2
+  800a70:	0f 29 52 20          	movaps %xmm2,0x20(%rdx)
+  800a74:	f3 0f 6f 5f 40       	movdqu 0x40(%rdi),%xmm3
+  800a79:	0f 29 5a 30          	movaps %xmm3,0x30(%rdx)
+  800a7d:	f3 0f 6f 67 50       	movdqu 0x50(%rdi),%xmm4
+  800a82:	0f 29 62 40          	movaps %xmm4,0x40(%rdx)
+  800a86:	f3 0f 6f 6f 60       	movdqu 0x60(%rdi),%xmm5
+  800a8b:	0f 29 6a 50          	movaps %xmm5,0x50(%rdx)
+  800a8f:	f3 0f 6f 77 70       	movdqu 0x70(%rdi),%xmm6
+  800a94:	0f 29 72 60          	movaps %xmm6,0x60(%rdx)
+  800a98:	48 8b 87 80 00 00 00 	mov    0x80(%rdi),%rax
+  800a9f:	48 89 42 70          	mov    %rax,0x70(%rdx)
+	during.rip = utf->utf_rip;
+  800aa3:	48 8b 87 88 00 00 00 	mov    0x88(%rdi),%rax
+  800aaa:	48 89 42 78          	mov    %rax,0x78(%rdx)
+	during.eflags = utf->utf_eflags & ~FL_RF;
+  800aae:	48 8b 87 90 00 00 00 	mov    0x90(%rdi),%rax
+  800ab5:	48 25 ff ff fe ff    	and    $0xfffffffffffeffff,%rax
+  800abb:	48 89 82 80 00 00 00 	mov    %rax,0x80(%rdx)
+	during.rsp = utf->utf_rsp;
+  800ac2:	48 8b 87 98 00 00 00 	mov    0x98(%rdi),%rax
+  800ac9:	48 89 82 88 00 00 00 	mov    %rax,0x88(%rdx)
+	check_regs(&before, "before", &during, "during", "in UTrapframe");
+  800ad0:	49 b8 38 21 80 00 00 	movabs $0x802138,%r8
+  800ad7:	00 00 00 
+  800ada:	48 b9 46 21 80 00 00 	movabs $0x802146,%rcx
+  800ae1:	00 00 00 
+  800ae4:	48 be 4d 21 80 00 00 	movabs $0x80214d,%rsi
+  800aeb:	00 00 00 
+  800aee:	48 bf 60 31 80 00 00 	movabs $0x803160,%rdi
+  800af5:	00 00 00 
+  800af8:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  800aff:	00 00 00 
+  800b02:	ff d0                	call   *%rax
+
+	// Map UTEMP so the write succeeds
+	if ((r = sys_page_alloc(0, UTEMP, PTE_U|PTE_P|PTE_W)) < 0)
+  800b04:	ba 07 00 00 00       	mov    $0x7,%edx
+  800b09:	be 00 00 40 00       	mov    $0x400000,%esi
+  800b0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b13:	48 b8 8f 1b 80 00 00 	movabs $0x801b8f,%rax
+  800b1a:	00 00 00 
+  800b1d:	ff d0                	call   *%rax
+  800b1f:	85 c0                	test   %eax,%eax
+  800b21:	78 34                	js     800b57 <pgfault+0x11b>
+		panic("sys_page_alloc: %e", r);
+}
+  800b23:	5d                   	pop    %rbp
+  800b24:	c3                   	ret
+		panic("pgfault expected at UTEMP, got 0x%016x (rip %016x)",
+  800b25:	4c 8b 87 88 00 00 00 	mov    0x88(%rdi),%r8
+  800b2c:	48 ba 80 21 80 00 00 	movabs $0x802180,%rdx
+  800b33:	00 00 00 
+  800b36:	be 6b 00 00 00       	mov    $0x6b,%esi
+  800b3b:	48 bf 27 21 80 00 00 	movabs $0x802127,%rdi
+  800b42:	00 00 00 
+  800b45:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4a:	49 b9 6c 0d 80 00 00 	movabs $0x800d6c,%r9
+  800b51:	00 00 00 
+  800b54:	41 ff d1             	call   *%r9
+		panic("sys_page_alloc: %e", r);
+  800b57:	89 c1                	mov    %eax,%ecx
+  800b59:	48 ba 54 21 80 00 00 	movabs $0x802154,%rdx
+  800b60:	00 00 00 
+  800b63:	be 77 00 00 00       	mov    $0x77,%esi
+  800b68:	48 bf 27 21 80 00 00 	movabs $0x802127,%rdi
+  800b6f:	00 00 00 
+  800b72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b77:	49 b8 6c 0d 80 00 00 	movabs $0x800d6c,%r8
+  800b7e:	00 00 00 
+  800b81:	41 ff d0             	call   *%r8
+
+0000000000800b84 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800b84:	55                   	push   %rbp
+  800b85:	48 89 e5             	mov    %rsp,%rbp
+  800b88:	41 57                	push   %r15
+  800b8a:	48 83 ec 08          	sub    $0x8,%rsp
+	set_pgfault_handler(pgfault);
+  800b8e:	48 bf 3c 0a 80 00 00 	movabs $0x800a3c,%rdi
+  800b95:	00 00 00 
+  800b98:	48 b8 6b 1f 80 00 00 	movabs $0x801f6b,%rax
+  800b9f:	00 00 00 
+  800ba2:	ff d0                	call   *%rax
+
+	asm volatile(
+  800ba4:	48 ba 60 31 80 00 00 	movabs $0x803160,%rdx
+  800bab:	00 00 00 
+  800bae:	48 b9 20 30 80 00 00 	movabs $0x803020,%rcx
+  800bb5:	00 00 00 
+  800bb8:	50                   	push   %rax
+  800bb9:	9c                   	pushf
+  800bba:	58                   	pop    %rax
+  800bbb:	48 0d d4 08 00 00    	or     $0x8d4,%rax
+  800bc1:	50                   	push   %rax
+  800bc2:	9d                   	popf
+  800bc3:	48 89 82 80 00 00 00 	mov    %rax,0x80(%rdx)
+  800bca:	48 8d 04 25 19 0c 80 	lea    0x800c19,%rax
+  800bd1:	00 
+  800bd2:	48 89 42 78          	mov    %rax,0x78(%rdx)
+  800bd6:	58                   	pop    %rax
+  800bd7:	4c 89 3a             	mov    %r15,(%rdx)
+  800bda:	4c 89 72 08          	mov    %r14,0x8(%rdx)
+  800bde:	4c 89 6a 10          	mov    %r13,0x10(%rdx)
+  800be2:	4c 89 62 18          	mov    %r12,0x18(%rdx)
+  800be6:	4c 89 5a 20          	mov    %r11,0x20(%rdx)
+  800bea:	4c 89 52 28          	mov    %r10,0x28(%rdx)
+  800bee:	4c 89 4a 30          	mov    %r9,0x30(%rdx)
+  800bf2:	4c 89 42 38          	mov    %r8,0x38(%rdx)
+  800bf6:	48 89 72 40          	mov    %rsi,0x40(%rdx)
+  800bfa:	48 89 7a 48          	mov    %rdi,0x48(%rdx)
+  800bfe:	48 89 6a 50          	mov    %rbp,0x50(%rdx)
+  800c02:	48 89 52 58          	mov    %rdx,0x58(%rdx)
+  800c06:	48 89 4a 60          	mov    %rcx,0x60(%rdx)
+  800c0a:	48 89 5a 68          	mov    %rbx,0x68(%rdx)
+  800c0e:	48 89 42 70          	mov    %rax,0x70(%rdx)
+  800c12:	48 89 a2 88 00 00 00 	mov    %rsp,0x88(%rdx)
+  800c19:	c7 04 25 00 00 40 00 	movl   $0x2a,0x400000
+  800c20:	2a 00 00 00 
+  800c24:	4c 89 39             	mov    %r15,(%rcx)
+  800c27:	4c 89 71 08          	mov    %r14,0x8(%rcx)
+  800c2b:	4c 89 69 10          	mov    %r13,0x10(%rcx)
+  800c2f:	4c 89 61 18          	mov    %r12,0x18(%rcx)
+  800c33:	4c 89 59 20          	mov    %r11,0x20(%rcx)
+  800c37:	4c 89 51 28          	mov    %r10,0x28(%rcx)
+  800c3b:	4c 89 49 30          	mov    %r9,0x30(%rcx)
+  800c3f:	4c 89 41 38          	mov    %r8,0x38(%rcx)
+  800c43:	48 89 71 40          	mov    %rsi,0x40(%rcx)
+  800c47:	48 89 79 48          	mov    %rdi,0x48(%rcx)
+  800c4b:	48 89 69 50          	mov    %rbp,0x50(%rcx)
+  800c4f:	48 89 51 58          	mov    %rdx,0x58(%rcx)
+  800c53:	48 89 49 60          	mov    %rcx,0x60(%rcx)
+  800c57:	48 89 59 68          	mov    %rbx,0x68(%rcx)
+  800c5b:	48 89 41 70          	mov    %rax,0x70(%rcx)
+  800c5f:	48 89 a1 88 00 00 00 	mov    %rsp,0x88(%rcx)
+  800c66:	4c 8b 39             	mov    (%rcx),%r15
+  800c69:	4c 8b 71 08          	mov    0x8(%rcx),%r14
+  800c6d:	4c 8b 69 10          	mov    0x10(%rcx),%r13
+  800c71:	4c 8b 61 18          	mov    0x18(%rcx),%r12
+  800c75:	4c 8b 59 20          	mov    0x20(%rcx),%r11
+  800c79:	4c 8b 51 28          	mov    0x28(%rcx),%r10
+  800c7d:	4c 8b 49 30          	mov    0x30(%rcx),%r9
+  800c81:	4c 8b 41 38          	mov    0x38(%rcx),%r8
+  800c85:	48 8b 71 40          	mov    0x40(%rcx),%rsi
+  800c89:	48 8b 79 48          	mov    0x48(%rcx),%rdi
+  800c8d:	48 8b 69 50          	mov    0x50(%rcx),%rbp
+  800c91:	48 8b 51 58          	mov    0x58(%rcx),%rdx
+  800c95:	48 8b 49 60          	mov    0x60(%rcx),%rcx
+  800c99:	48 8b 59 68          	mov    0x68(%rcx),%rbx
+  800c9d:	48 8b 41 70          	mov    0x70(%rcx),%rax
+  800ca1:	48 8b a1 88 00 00 00 	mov    0x88(%rcx),%rsp
+  800ca8:	50                   	push   %rax
+  800ca9:	9c                   	pushf
+  800caa:	58                   	pop    %rax
+  800cab:	48 89 81 80 00 00 00 	mov    %rax,0x80(%rcx)
+  800cb2:	58                   	pop    %rax
+		: : "r" (&before), "r" (&after) : "memory", "cc", "r15", "rax");
+
+	// Check UTEMP to roughly determine that EIP was restored
+	// correctly (of course, we probably wouldn't get this far if
+	// it weren't)
+	if (*(int*)UTEMP != 42)
+  800cb3:	83 3c 25 00 00 40 00 	cmpl   $0x2a,0x400000
+  800cba:	2a 
+  800cbb:	75 4c                	jne    800d09 <umain+0x185>
+		cprintf("RIP after page-fault MISMATCH\n");
+	after.rip = before.rip;
+  800cbd:	48 ba 20 30 80 00 00 	movabs $0x803020,%rdx
+  800cc4:	00 00 00 
+  800cc7:	48 bf 60 31 80 00 00 	movabs $0x803160,%rdi
+  800cce:	00 00 00 
+  800cd1:	48 8b 47 78          	mov    0x78(%rdi),%rax
+  800cd5:	48 89 42 78          	mov    %rax,0x78(%rdx)
+
+	check_regs(&before, "before", &after, "after", "after page-fault");
+  800cd9:	49 b8 67 21 80 00 00 	movabs $0x802167,%r8
+  800ce0:	00 00 00 
+  800ce3:	48 b9 78 21 80 00 00 	movabs $0x802178,%rcx
+  800cea:	00 00 00 
+  800ced:	48 be 4d 21 80 00 00 	movabs $0x80214d,%rsi
+  800cf4:	00 00 00 
+  800cf7:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  800cfe:	00 00 00 
+  800d01:	ff d0                	call   *%rax
+}
+  800d03:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800d07:	c9                   	leave
+  800d08:	c3                   	ret
+		cprintf("RIP after page-fault MISMATCH\n");
+  800d09:	48 bf b8 21 80 00 00 	movabs $0x8021b8,%rdi
+  800d10:	00 00 00 
+  800d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d18:	48 ba 0b 0f 80 00 00 	movabs $0x800f0b,%rdx
+  800d1f:	00 00 00 
+  800d22:	ff d2                	call   *%rdx
+  800d24:	eb 97                	jmp    800cbd <umain+0x139>
+
+0000000000800d26 <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  800d26:	55                   	push   %rbp
+  800d27:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800d2a:	85 ff                	test   %edi,%edi
+  800d2c:	7e 0d                	jle    800d3b <libmain+0x15>
+		binaryname = argv[0];
+  800d2e:	48 8b 06             	mov    (%rsi),%rax
+  800d31:	48 a3 00 30 80 00 00 	movabs %rax,0x803000
+  800d38:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  800d3b:	48 b8 84 0b 80 00 00 	movabs $0x800b84,%rax
+  800d42:	00 00 00 
+  800d45:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800d47:	48 b8 55 0d 80 00 00 	movabs $0x800d55,%rax
+  800d4e:	00 00 00 
+  800d51:	ff d0                	call   *%rax
+}
+  800d53:	5d                   	pop    %rbp
+  800d54:	c3                   	ret
+
+0000000000800d55 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800d55:	55                   	push   %rbp
+  800d56:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  800d59:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d5e:	48 b8 e8 1a 80 00 00 	movabs $0x801ae8,%rax
+  800d65:	00 00 00 
+  800d68:	ff d0                	call   *%rax
+}
+  800d6a:	5d                   	pop    %rbp
+  800d6b:	c3                   	ret
+
+0000000000800d6c <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800d6c:	55                   	push   %rbp
+  800d6d:	48 89 e5             	mov    %rsp,%rbp
+  800d70:	41 56                	push   %r14
+  800d72:	41 55                	push   %r13
+  800d74:	41 54                	push   %r12
+  800d76:	53                   	push   %rbx
+  800d77:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800d7e:	49 89 fc             	mov    %rdi,%r12
+  800d81:	41 89 f5             	mov    %esi,%r13d
+  800d84:	48 89 d3             	mov    %rdx,%rbx
+  800d87:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800d8e:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800d95:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800d9c:	84 c0                	test   %al,%al
+  800d9e:	74 26                	je     800dc6 <_panic+0x5a>
+  800da0:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800da7:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800dae:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800db2:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800db6:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800dba:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800dbe:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800dc2:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800dc6:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800dcd:	00 00 00 
+  800dd0:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800dd7:	00 00 00 
+  800dda:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dde:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800de5:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800dec:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800df3:	48 b8 00 30 80 00 00 	movabs $0x803000,%rax
+  800dfa:	00 00 00 
+  800dfd:	4c 8b 30             	mov    (%rax),%r14
+  800e00:	48 b8 43 1b 80 00 00 	movabs $0x801b43,%rax
+  800e07:	00 00 00 
+  800e0a:	ff d0                	call   *%rax
+  800e0c:	89 c6                	mov    %eax,%esi
+  800e0e:	45 89 e8             	mov    %r13d,%r8d
+  800e11:	4c 89 e1             	mov    %r12,%rcx
+  800e14:	4c 89 f2             	mov    %r14,%rdx
+  800e17:	48 bf e8 21 80 00 00 	movabs $0x8021e8,%rdi
+  800e1e:	00 00 00 
+  800e21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e26:	49 bc 0b 0f 80 00 00 	movabs $0x800f0b,%r12
+  800e2d:	00 00 00 
+  800e30:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800e33:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  800e3a:	48 89 df             	mov    %rbx,%rdi
+  800e3d:	48 b8 a7 0e 80 00 00 	movabs $0x800ea7,%rax
+  800e44:	00 00 00 
+  800e47:	ff d0                	call   *%rax
+	cprintf("\n");
+  800e49:	48 bf d2 20 80 00 00 	movabs $0x8020d2,%rdi
+  800e50:	00 00 00 
+  800e53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e58:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800e5b:	cc                   	int3
+	while (1)
+  800e5c:	eb fd                	jmp    800e5b <_panic+0xef>
+
+0000000000800e5e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800e5e:	55                   	push   %rbp
+  800e5f:	48 89 e5             	mov    %rsp,%rbp
+  800e62:	53                   	push   %rbx
+  800e63:	48 83 ec 08          	sub    $0x8,%rsp
+  800e67:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  800e6a:	8b 06                	mov    (%rsi),%eax
+  800e6c:	8d 50 01             	lea    0x1(%rax),%edx
+  800e6f:	89 16                	mov    %edx,(%rsi)
+  800e71:	48 98                	cltq
+  800e73:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  800e78:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800e7e:	74 0a                	je     800e8a <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800e80:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800e84:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e88:	c9                   	leave
+  800e89:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800e8a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800e8e:	be ff 00 00 00       	mov    $0xff,%esi
+  800e93:	48 b8 b0 1a 80 00 00 	movabs $0x801ab0,%rax
+  800e9a:	00 00 00 
+  800e9d:	ff d0                	call   *%rax
+		b->idx = 0;
+  800e9f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800ea5:	eb d9                	jmp    800e80 <putch+0x22>
+
+0000000000800ea7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800ea7:	55                   	push   %rbp
+  800ea8:	48 89 e5             	mov    %rsp,%rbp
+  800eab:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800eb2:	48 89 fa             	mov    %rdi,%rdx
+  800eb5:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  800eb8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800ebf:	00 00 00 
+	b.cnt = 0;
+  800ec2:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800ec9:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800ecc:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  800ed3:	48 bf 5e 0e 80 00 00 	movabs $0x800e5e,%rdi
+  800eda:	00 00 00 
+  800edd:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  800ee4:	00 00 00 
+  800ee7:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  800ee9:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  800ef0:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800ef7:	48 b8 b0 1a 80 00 00 	movabs $0x801ab0,%rax
+  800efe:	00 00 00 
+  800f01:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  800f03:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  800f09:	c9                   	leave
+  800f0a:	c3                   	ret
+
+0000000000800f0b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800f0b:	55                   	push   %rbp
+  800f0c:	48 89 e5             	mov    %rsp,%rbp
+  800f0f:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800f16:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800f1d:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800f24:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f2b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f32:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f39:	84 c0                	test   %al,%al
+  800f3b:	74 20                	je     800f5d <cprintf+0x52>
+  800f3d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f41:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f45:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f49:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f4d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f51:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f55:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f59:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800f5d:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  800f64:	00 00 00 
+  800f67:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f6e:	00 00 00 
+  800f71:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f75:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800f7c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f83:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  800f8a:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  800f91:	48 b8 a7 0e 80 00 00 	movabs $0x800ea7,%rax
+  800f98:	00 00 00 
+  800f9b:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  800f9d:	c9                   	leave
+  800f9e:	c3                   	ret
+
+0000000000800f9f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800f9f:	55                   	push   %rbp
+  800fa0:	48 89 e5             	mov    %rsp,%rbp
+  800fa3:	41 57                	push   %r15
+  800fa5:	41 56                	push   %r14
+  800fa7:	41 55                	push   %r13
+  800fa9:	41 54                	push   %r12
+  800fab:	53                   	push   %rbx
+  800fac:	48 83 ec 18          	sub    $0x18,%rsp
+  800fb0:	49 89 fc             	mov    %rdi,%r12
+  800fb3:	49 89 f5             	mov    %rsi,%r13
+  800fb6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800fba:	44 89 c3             	mov    %r8d,%ebx
+  800fbd:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800fc0:	41 89 cf             	mov    %ecx,%r15d
+  800fc3:	4c 39 fa             	cmp    %r15,%rdx
+  800fc6:	72 29                	jb     800ff1 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800fc8:	48 89 d0             	mov    %rdx,%rax
+  800fcb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd0:	49 f7 f7             	div    %r15
+  800fd3:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800fd7:	48 89 c2             	mov    %rax,%rdx
+  800fda:	48 b8 9f 0f 80 00 00 	movabs $0x800f9f,%rax
+  800fe1:	00 00 00 
+  800fe4:	ff d0                	call   *%rax
+  800fe6:	eb 10                	jmp    800ff8 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800fe8:	4c 89 ee             	mov    %r13,%rsi
+  800feb:	44 89 f7             	mov    %r14d,%edi
+  800fee:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  800ff1:	83 eb 01             	sub    $0x1,%ebx
+  800ff4:	85 db                	test   %ebx,%ebx
+  800ff6:	7f f0                	jg     800fe8 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800ff8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ffc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801001:	49 f7 f7             	div    %r15
+  801004:	48 b8 0b 22 80 00 00 	movabs $0x80220b,%rax
+  80100b:	00 00 00 
+  80100e:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  801012:	4c 89 ee             	mov    %r13,%rsi
+  801015:	41 ff d4             	call   *%r12
+}
+  801018:	48 83 c4 18          	add    $0x18,%rsp
+  80101c:	5b                   	pop    %rbx
+  80101d:	41 5c                	pop    %r12
+  80101f:	41 5d                	pop    %r13
+  801021:	41 5e                	pop    %r14
+  801023:	41 5f                	pop    %r15
+  801025:	5d                   	pop    %rbp
+  801026:	c3                   	ret
+
+0000000000801027 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  801027:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  80102b:	48 8b 06             	mov    (%rsi),%rax
+  80102e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801032:	73 0a                	jae    80103e <sprintputch+0x17>
+		*b->buf++ = ch;
+  801034:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801038:	48 89 16             	mov    %rdx,(%rsi)
+  80103b:	40 88 38             	mov    %dil,(%rax)
+}
+  80103e:	c3                   	ret
+
+000000000080103f <printfmt>:
+{
+  80103f:	55                   	push   %rbp
+  801040:	48 89 e5             	mov    %rsp,%rbp
+  801043:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80104a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801051:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801058:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80105f:	84 c0                	test   %al,%al
+  801061:	74 20                	je     801083 <printfmt+0x44>
+  801063:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801067:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80106b:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80106f:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801073:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801077:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80107b:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80107f:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  801083:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  80108a:	00 00 00 
+  80108d:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801094:	00 00 00 
+  801097:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80109b:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8010a2:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8010a9:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8010b0:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8010b7:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  8010be:	00 00 00 
+  8010c1:	ff d0                	call   *%rax
+}
+  8010c3:	c9                   	leave
+  8010c4:	c3                   	ret
+
+00000000008010c5 <vprintfmt>:
+{
+  8010c5:	55                   	push   %rbp
+  8010c6:	48 89 e5             	mov    %rsp,%rbp
+  8010c9:	41 57                	push   %r15
+  8010cb:	41 56                	push   %r14
+  8010cd:	41 55                	push   %r13
+  8010cf:	41 54                	push   %r12
+  8010d1:	53                   	push   %rbx
+  8010d2:	48 83 ec 48          	sub    $0x48,%rsp
+  8010d6:	49 89 fe             	mov    %rdi,%r14
+  8010d9:	49 89 f5             	mov    %rsi,%r13
+  8010dc:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  8010df:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  8010e3:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  8010e7:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8010eb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8010ef:	eb 09                	jmp    8010fa <vprintfmt+0x35>
+			putch(ch, putdat);
+  8010f1:	4c 89 ee             	mov    %r13,%rsi
+  8010f4:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8010f7:	4c 89 e3             	mov    %r12,%rbx
+  8010fa:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8010fe:	0f b6 3b             	movzbl (%rbx),%edi
+  801101:	83 ff 25             	cmp    $0x25,%edi
+  801104:	74 13                	je     801119 <vprintfmt+0x54>
+			if (ch == '\0')
+  801106:	85 ff                	test   %edi,%edi
+  801108:	75 e7                	jne    8010f1 <vprintfmt+0x2c>
+}
+  80110a:	48 83 c4 48          	add    $0x48,%rsp
+  80110e:	5b                   	pop    %rbx
+  80110f:	41 5c                	pop    %r12
+  801111:	41 5d                	pop    %r13
+  801113:	41 5e                	pop    %r14
+  801115:	41 5f                	pop    %r15
+  801117:	5d                   	pop    %rbp
+  801118:	c3                   	ret
+		padc = ' ';
+  801119:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  80111d:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  801124:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  80112a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  801131:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801136:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80113b:	41 0f b6 14 24       	movzbl (%r12),%edx
+  801140:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  801143:	3c 55                	cmp    $0x55,%al
+  801145:	0f 87 4f 05 00 00    	ja     80169a <vprintfmt+0x5d5>
+  80114b:	0f b6 c0             	movzbl %al,%eax
+  80114e:	48 be e0 22 80 00 00 	movabs $0x8022e0,%rsi
+  801155:	00 00 00 
+  801158:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  80115b:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  80115e:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  801162:	eb d2                	jmp    801136 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  801164:	49 89 dc             	mov    %rbx,%r12
+  801167:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  80116b:	eb c9                	jmp    801136 <vprintfmt+0x71>
+  80116d:	0f b6 d2             	movzbl %dl,%edx
+  801170:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  801173:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  801179:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  80117d:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  801182:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  801187:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  80118a:	83 f8 09             	cmp    $0x9,%eax
+  80118d:	77 20                	ja     8011af <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  80118f:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  801193:	eb e4                	jmp    801179 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  801195:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801198:	83 f8 2f             	cmp    $0x2f,%eax
+  80119b:	77 27                	ja     8011c4 <vprintfmt+0xff>
+  80119d:	89 c2                	mov    %eax,%edx
+  80119f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011a3:	83 c0 08             	add    $0x8,%eax
+  8011a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011a9:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  8011ac:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  8011af:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8011b3:	79 81                	jns    801136 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  8011b5:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  8011b9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8011bf:	e9 72 ff ff ff       	jmp    801136 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  8011c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011d0:	eb d7                	jmp    8011a9 <vprintfmt+0xe4>
+			if (width < 0)
+  8011d2:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  8011d5:	85 f6                	test   %esi,%esi
+  8011d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011dc:	0f 49 c6             	cmovns %esi,%eax
+  8011df:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8011e2:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8011e5:	e9 4c ff ff ff       	jmp    801136 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8011ea:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  8011ed:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  8011f4:	e9 3d ff ff ff       	jmp    801136 <vprintfmt+0x71>
+			lflag++;
+  8011f9:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8011fc:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8011ff:	e9 32 ff ff ff       	jmp    801136 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  801204:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801207:	83 f8 2f             	cmp    $0x2f,%eax
+  80120a:	77 19                	ja     801225 <vprintfmt+0x160>
+  80120c:	89 c2                	mov    %eax,%edx
+  80120e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801212:	83 c0 08             	add    $0x8,%eax
+  801215:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801218:	8b 3a                	mov    (%rdx),%edi
+  80121a:	4c 89 ee             	mov    %r13,%rsi
+  80121d:	41 ff d6             	call   *%r14
+			break;
+  801220:	e9 d5 fe ff ff       	jmp    8010fa <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  801225:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801229:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80122d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801231:	eb e5                	jmp    801218 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  801233:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801236:	83 f8 2f             	cmp    $0x2f,%eax
+  801239:	77 5a                	ja     801295 <vprintfmt+0x1d0>
+  80123b:	89 c2                	mov    %eax,%edx
+  80123d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801241:	83 c0 08             	add    $0x8,%eax
+  801244:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  801247:	8b 02                	mov    (%rdx),%eax
+  801249:	89 c1                	mov    %eax,%ecx
+  80124b:	f7 d9                	neg    %ecx
+  80124d:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801250:	83 f9 08             	cmp    $0x8,%ecx
+  801253:	7f 4e                	jg     8012a3 <vprintfmt+0x1de>
+  801255:	48 63 c1             	movslq %ecx,%rax
+  801258:	48 ba a0 25 80 00 00 	movabs $0x8025a0,%rdx
+  80125f:	00 00 00 
+  801262:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801266:	48 85 c0             	test   %rax,%rax
+  801269:	74 38                	je     8012a3 <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  80126b:	48 89 c1             	mov    %rax,%rcx
+  80126e:	48 ba 2c 22 80 00 00 	movabs $0x80222c,%rdx
+  801275:	00 00 00 
+  801278:	4c 89 ee             	mov    %r13,%rsi
+  80127b:	4c 89 f7             	mov    %r14,%rdi
+  80127e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801283:	49 b8 3f 10 80 00 00 	movabs $0x80103f,%r8
+  80128a:	00 00 00 
+  80128d:	41 ff d0             	call   *%r8
+  801290:	e9 65 fe ff ff       	jmp    8010fa <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  801295:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801299:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80129d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012a1:	eb a4                	jmp    801247 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  8012a3:	48 ba 23 22 80 00 00 	movabs $0x802223,%rdx
+  8012aa:	00 00 00 
+  8012ad:	4c 89 ee             	mov    %r13,%rsi
+  8012b0:	4c 89 f7             	mov    %r14,%rdi
+  8012b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b8:	49 b8 3f 10 80 00 00 	movabs $0x80103f,%r8
+  8012bf:	00 00 00 
+  8012c2:	41 ff d0             	call   *%r8
+  8012c5:	e9 30 fe ff ff       	jmp    8010fa <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  8012ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8012d0:	77 36                	ja     801308 <vprintfmt+0x243>
+  8012d2:	89 c2                	mov    %eax,%edx
+  8012d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012d8:	83 c0 08             	add    $0x8,%eax
+  8012db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012de:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  8012e1:	48 85 c9             	test   %rcx,%rcx
+  8012e4:	48 b8 1c 22 80 00 00 	movabs $0x80221c,%rax
+  8012eb:	00 00 00 
+  8012ee:	48 0f 45 c1          	cmovne %rcx,%rax
+  8012f2:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  8012f6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8012fa:	7e 06                	jle    801302 <vprintfmt+0x23d>
+  8012fc:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  801300:	75 14                	jne    801316 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801302:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801306:	eb 64                	jmp    80136c <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  801308:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80130c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801310:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801314:	eb c8                	jmp    8012de <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801316:	49 63 f7             	movslq %r15d,%rsi
+  801319:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  80131d:	48 b8 a8 17 80 00 00 	movabs $0x8017a8,%rax
+  801324:	00 00 00 
+  801327:	ff d0                	call   *%rax
+  801329:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80132c:	29 c1                	sub    %eax,%ecx
+  80132e:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  801331:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  801334:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  801338:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80133b:	eb 0d                	jmp    80134a <vprintfmt+0x285>
+					putch(padc, putdat);
+  80133d:	4c 89 ee             	mov    %r13,%rsi
+  801340:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  801343:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801346:	41 83 ec 01          	sub    $0x1,%r12d
+  80134a:	45 85 e4             	test   %r12d,%r12d
+  80134d:	7f ee                	jg     80133d <vprintfmt+0x278>
+  80134f:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  801352:	85 c9                	test   %ecx,%ecx
+  801354:	b8 00 00 00 00       	mov    $0x0,%eax
+  801359:	0f 49 c1             	cmovns %ecx,%eax
+  80135c:	29 c1                	sub    %eax,%ecx
+  80135e:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  801361:	eb 9f                	jmp    801302 <vprintfmt+0x23d>
+					putch(ch, putdat);
+  801363:	4c 89 ee             	mov    %r13,%rsi
+  801366:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801369:	4c 89 e2             	mov    %r12,%rdx
+  80136c:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  801370:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801376:	0f be f8             	movsbl %al,%edi
+  801379:	85 ff                	test   %edi,%edi
+  80137b:	74 29                	je     8013a6 <vprintfmt+0x2e1>
+  80137d:	45 85 ff             	test   %r15d,%r15d
+  801380:	78 06                	js     801388 <vprintfmt+0x2c3>
+  801382:	41 83 ef 01          	sub    $0x1,%r15d
+  801386:	78 1e                	js     8013a6 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801388:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  80138c:	74 d5                	je     801363 <vprintfmt+0x29e>
+  80138e:	0f be c0             	movsbl %al,%eax
+  801391:	83 e8 20             	sub    $0x20,%eax
+  801394:	83 f8 5e             	cmp    $0x5e,%eax
+  801397:	76 ca                	jbe    801363 <vprintfmt+0x29e>
+					putch('?', putdat);
+  801399:	4c 89 ee             	mov    %r13,%rsi
+  80139c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8013a1:	41 ff d6             	call   *%r14
+  8013a4:	eb c3                	jmp    801369 <vprintfmt+0x2a4>
+  8013a6:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  8013aa:	8b 45 98             	mov    -0x68(%rbp),%eax
+  8013ad:	41 01 c4             	add    %eax,%r12d
+  8013b0:	41 29 d4             	sub    %edx,%r12d
+  8013b3:	eb 0f                	jmp    8013c4 <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  8013b5:	4c 89 ee             	mov    %r13,%rsi
+  8013b8:	bf 20 00 00 00       	mov    $0x20,%edi
+  8013bd:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  8013c0:	41 83 ec 01          	sub    $0x1,%r12d
+  8013c4:	45 85 e4             	test   %r12d,%r12d
+  8013c7:	7f ec                	jg     8013b5 <vprintfmt+0x2f0>
+  8013c9:	e9 2c fd ff ff       	jmp    8010fa <vprintfmt+0x35>
+	if (lflag >= 2)
+  8013ce:	83 f9 01             	cmp    $0x1,%ecx
+  8013d1:	7f 1d                	jg     8013f0 <vprintfmt+0x32b>
+	else if (lflag)
+  8013d3:	85 c9                	test   %ecx,%ecx
+  8013d5:	74 5e                	je     801435 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  8013d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013da:	83 f8 2f             	cmp    $0x2f,%eax
+  8013dd:	77 48                	ja     801427 <vprintfmt+0x362>
+  8013df:	89 c2                	mov    %eax,%edx
+  8013e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013e5:	83 c0 08             	add    $0x8,%eax
+  8013e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013eb:	4c 8b 22             	mov    (%rdx),%r12
+  8013ee:	eb 17                	jmp    801407 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  8013f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8013f6:	77 21                	ja     801419 <vprintfmt+0x354>
+  8013f8:	89 c2                	mov    %eax,%edx
+  8013fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013fe:	83 c0 08             	add    $0x8,%eax
+  801401:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801404:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  801407:	4d 85 e4             	test   %r12,%r12
+  80140a:	78 50                	js     80145c <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  80140c:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  80140f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801414:	e9 b4 01 00 00       	jmp    8015cd <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  801419:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80141d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801421:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801425:	eb dd                	jmp    801404 <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  801427:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80142b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80142f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801433:	eb b6                	jmp    8013eb <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  801435:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801438:	83 f8 2f             	cmp    $0x2f,%eax
+  80143b:	77 11                	ja     80144e <vprintfmt+0x389>
+  80143d:	89 c2                	mov    %eax,%edx
+  80143f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801443:	83 c0 08             	add    $0x8,%eax
+  801446:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801449:	4c 63 22             	movslq (%rdx),%r12
+  80144c:	eb b9                	jmp    801407 <vprintfmt+0x342>
+  80144e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801452:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801456:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80145a:	eb ed                	jmp    801449 <vprintfmt+0x384>
+				putch('-', putdat);
+  80145c:	4c 89 ee             	mov    %r13,%rsi
+  80145f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801464:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  801467:	4c 89 e2             	mov    %r12,%rdx
+  80146a:	48 f7 da             	neg    %rdx
+			base = 10;
+  80146d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801472:	e9 56 01 00 00       	jmp    8015cd <vprintfmt+0x508>
+	if (lflag >= 2)
+  801477:	83 f9 01             	cmp    $0x1,%ecx
+  80147a:	7f 25                	jg     8014a1 <vprintfmt+0x3dc>
+	else if (lflag)
+  80147c:	85 c9                	test   %ecx,%ecx
+  80147e:	74 5e                	je     8014de <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  801480:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801483:	83 f8 2f             	cmp    $0x2f,%eax
+  801486:	77 48                	ja     8014d0 <vprintfmt+0x40b>
+  801488:	89 c2                	mov    %eax,%edx
+  80148a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80148e:	83 c0 08             	add    $0x8,%eax
+  801491:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801494:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  801497:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  80149c:	e9 2c 01 00 00       	jmp    8015cd <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8014a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8014a7:	77 19                	ja     8014c2 <vprintfmt+0x3fd>
+  8014a9:	89 c2                	mov    %eax,%edx
+  8014ab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014af:	83 c0 08             	add    $0x8,%eax
+  8014b2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014b5:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8014b8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  8014bd:	e9 0b 01 00 00       	jmp    8015cd <vprintfmt+0x508>
+  8014c2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014c6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014ce:	eb e5                	jmp    8014b5 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  8014d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014dc:	eb b6                	jmp    801494 <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  8014de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8014e4:	77 18                	ja     8014fe <vprintfmt+0x439>
+  8014e6:	89 c2                	mov    %eax,%edx
+  8014e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014ec:	83 c0 08             	add    $0x8,%eax
+  8014ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014f2:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  8014f4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  8014f9:	e9 cf 00 00 00       	jmp    8015cd <vprintfmt+0x508>
+  8014fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801502:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801506:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80150a:	eb e6                	jmp    8014f2 <vprintfmt+0x42d>
+	if (lflag >= 2)
+  80150c:	83 f9 01             	cmp    $0x1,%ecx
+  80150f:	7f 25                	jg     801536 <vprintfmt+0x471>
+	else if (lflag)
+  801511:	85 c9                	test   %ecx,%ecx
+  801513:	74 5b                	je     801570 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  801515:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801518:	83 f8 2f             	cmp    $0x2f,%eax
+  80151b:	77 45                	ja     801562 <vprintfmt+0x49d>
+  80151d:	89 c2                	mov    %eax,%edx
+  80151f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801523:	83 c0 08             	add    $0x8,%eax
+  801526:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801529:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  80152c:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  801531:	e9 97 00 00 00       	jmp    8015cd <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  801536:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801539:	83 f8 2f             	cmp    $0x2f,%eax
+  80153c:	77 16                	ja     801554 <vprintfmt+0x48f>
+  80153e:	89 c2                	mov    %eax,%edx
+  801540:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801544:	83 c0 08             	add    $0x8,%eax
+  801547:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80154a:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  80154d:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  801552:	eb 79                	jmp    8015cd <vprintfmt+0x508>
+  801554:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801558:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80155c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801560:	eb e8                	jmp    80154a <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  801562:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801566:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80156a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80156e:	eb b9                	jmp    801529 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  801570:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801573:	83 f8 2f             	cmp    $0x2f,%eax
+  801576:	77 15                	ja     80158d <vprintfmt+0x4c8>
+  801578:	89 c2                	mov    %eax,%edx
+  80157a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80157e:	83 c0 08             	add    $0x8,%eax
+  801581:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801584:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  801586:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  80158b:	eb 40                	jmp    8015cd <vprintfmt+0x508>
+  80158d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801591:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801595:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801599:	eb e9                	jmp    801584 <vprintfmt+0x4bf>
+			putch('0', putdat);
+  80159b:	4c 89 ee             	mov    %r13,%rsi
+  80159e:	bf 30 00 00 00       	mov    $0x30,%edi
+  8015a3:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  8015a6:	4c 89 ee             	mov    %r13,%rsi
+  8015a9:	bf 78 00 00 00       	mov    $0x78,%edi
+  8015ae:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  8015b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8015b7:	77 34                	ja     8015ed <vprintfmt+0x528>
+  8015b9:	89 c2                	mov    %eax,%edx
+  8015bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015bf:	83 c0 08             	add    $0x8,%eax
+  8015c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  8015c5:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  8015c8:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  8015cd:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  8015d2:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8015d6:	4c 89 ee             	mov    %r13,%rsi
+  8015d9:	4c 89 f7             	mov    %r14,%rdi
+  8015dc:	48 b8 9f 0f 80 00 00 	movabs $0x800f9f,%rax
+  8015e3:	00 00 00 
+  8015e6:	ff d0                	call   *%rax
+			break;
+  8015e8:	e9 0d fb ff ff       	jmp    8010fa <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  8015ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015f1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015f9:	eb ca                	jmp    8015c5 <vprintfmt+0x500>
+	if (lflag >= 2)
+  8015fb:	83 f9 01             	cmp    $0x1,%ecx
+  8015fe:	7f 22                	jg     801622 <vprintfmt+0x55d>
+	else if (lflag)
+  801600:	85 c9                	test   %ecx,%ecx
+  801602:	74 58                	je     80165c <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  801604:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801607:	83 f8 2f             	cmp    $0x2f,%eax
+  80160a:	77 42                	ja     80164e <vprintfmt+0x589>
+  80160c:	89 c2                	mov    %eax,%edx
+  80160e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801612:	83 c0 08             	add    $0x8,%eax
+  801615:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801618:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  80161b:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  801620:	eb ab                	jmp    8015cd <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  801622:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801625:	83 f8 2f             	cmp    $0x2f,%eax
+  801628:	77 16                	ja     801640 <vprintfmt+0x57b>
+  80162a:	89 c2                	mov    %eax,%edx
+  80162c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801630:	83 c0 08             	add    $0x8,%eax
+  801633:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801636:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  801639:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  80163e:	eb 8d                	jmp    8015cd <vprintfmt+0x508>
+  801640:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801644:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801648:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80164c:	eb e8                	jmp    801636 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  80164e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801652:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801656:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80165a:	eb bc                	jmp    801618 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  80165c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80165f:	83 f8 2f             	cmp    $0x2f,%eax
+  801662:	77 18                	ja     80167c <vprintfmt+0x5b7>
+  801664:	89 c2                	mov    %eax,%edx
+  801666:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80166a:	83 c0 08             	add    $0x8,%eax
+  80166d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801670:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  801672:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  801677:	e9 51 ff ff ff       	jmp    8015cd <vprintfmt+0x508>
+  80167c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801680:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801684:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801688:	eb e6                	jmp    801670 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  80168a:	4c 89 ee             	mov    %r13,%rsi
+  80168d:	bf 25 00 00 00       	mov    $0x25,%edi
+  801692:	41 ff d6             	call   *%r14
+			break;
+  801695:	e9 60 fa ff ff       	jmp    8010fa <vprintfmt+0x35>
+			putch('%', putdat);
+  80169a:	4c 89 ee             	mov    %r13,%rsi
+  80169d:	bf 25 00 00 00       	mov    $0x25,%edi
+  8016a2:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8016a5:	4c 89 e3             	mov    %r12,%rbx
+  8016a8:	eb 04                	jmp    8016ae <vprintfmt+0x5e9>
+  8016aa:	48 83 eb 01          	sub    $0x1,%rbx
+  8016ae:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8016b2:	75 f6                	jne    8016aa <vprintfmt+0x5e5>
+  8016b4:	e9 41 fa ff ff       	jmp    8010fa <vprintfmt+0x35>
+
+00000000008016b9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8016b9:	55                   	push   %rbp
+  8016ba:	48 89 e5             	mov    %rsp,%rbp
+  8016bd:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8016c1:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8016c5:	48 63 c6             	movslq %esi,%rax
+  8016c8:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  8016cd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  8016d1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  8016d8:	48 85 ff             	test   %rdi,%rdi
+  8016db:	74 2a                	je     801707 <vsnprintf+0x4e>
+  8016dd:	85 f6                	test   %esi,%esi
+  8016df:	7e 26                	jle    801707 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8016e1:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8016e5:	48 bf 27 10 80 00 00 	movabs $0x801027,%rdi
+  8016ec:	00 00 00 
+  8016ef:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  8016f6:	00 00 00 
+  8016f9:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8016fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016ff:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801702:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  801705:	c9                   	leave
+  801706:	c3                   	ret
+		return -E_INVAL;
+  801707:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80170c:	eb f7                	jmp    801705 <vsnprintf+0x4c>
+
+000000000080170e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80170e:	55                   	push   %rbp
+  80170f:	48 89 e5             	mov    %rsp,%rbp
+  801712:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  801719:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801720:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801727:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80172e:	84 c0                	test   %al,%al
+  801730:	74 20                	je     801752 <snprintf+0x44>
+  801732:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801736:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80173a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80173e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801742:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801746:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80174a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80174e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801752:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801759:	00 00 00 
+  80175c:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801763:	00 00 00 
+  801766:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80176a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801771:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801778:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  80177f:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801786:	48 b8 b9 16 80 00 00 	movabs $0x8016b9,%rax
+  80178d:	00 00 00 
+  801790:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  801792:	c9                   	leave
+  801793:	c3                   	ret
+
+0000000000801794 <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801794:	ba 00 00 00 00       	mov    $0x0,%edx
+  801799:	48 89 d0             	mov    %rdx,%rax
+  80179c:	48 83 c2 01          	add    $0x1,%rdx
+  8017a0:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  8017a5:	75 f2                	jne    801799 <strlen+0x5>
+		n++;
+	return n;
+}
+  8017a7:	c3                   	ret
+
+00000000008017a8 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8017a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ad:	eb 03                	jmp    8017b2 <strnlen+0xa>
+  8017af:	48 89 d0             	mov    %rdx,%rax
+  8017b2:	48 39 c6             	cmp    %rax,%rsi
+  8017b5:	74 0a                	je     8017c1 <strnlen+0x19>
+  8017b7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017bb:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8017bf:	75 ee                	jne    8017af <strnlen+0x7>
+		n++;
+	return n;
+}
+  8017c1:	c3                   	ret
+
+00000000008017c2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8017c2:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8017c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ca:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8017ce:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8017d1:	48 83 c2 01          	add    $0x1,%rdx
+  8017d5:	84 c9                	test   %cl,%cl
+  8017d7:	75 f1                	jne    8017ca <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  8017d9:	c3                   	ret
+
+00000000008017da <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8017da:	55                   	push   %rbp
+  8017db:	48 89 e5             	mov    %rsp,%rbp
+  8017de:	41 54                	push   %r12
+  8017e0:	53                   	push   %rbx
+  8017e1:	48 89 fb             	mov    %rdi,%rbx
+  8017e4:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  8017e7:	48 b8 94 17 80 00 00 	movabs $0x801794,%rax
+  8017ee:	00 00 00 
+  8017f1:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  8017f3:	48 63 f8             	movslq %eax,%rdi
+  8017f6:	48 01 df             	add    %rbx,%rdi
+  8017f9:	4c 89 e6             	mov    %r12,%rsi
+  8017fc:	48 b8 c2 17 80 00 00 	movabs $0x8017c2,%rax
+  801803:	00 00 00 
+  801806:	ff d0                	call   *%rax
+	return dst;
+}
+  801808:	48 89 d8             	mov    %rbx,%rax
+  80180b:	5b                   	pop    %rbx
+  80180c:	41 5c                	pop    %r12
+  80180e:	5d                   	pop    %rbp
+  80180f:	c3                   	ret
+
+0000000000801810 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801810:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801813:	48 01 fa             	add    %rdi,%rdx
+  801816:	48 89 f9             	mov    %rdi,%rcx
+  801819:	eb 14                	jmp    80182f <strncpy+0x1f>
+		*dst++ = *src;
+  80181b:	48 83 c1 01          	add    $0x1,%rcx
+  80181f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801823:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801827:	41 80 f8 01          	cmp    $0x1,%r8b
+  80182b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  80182f:	48 39 d1             	cmp    %rdx,%rcx
+  801832:	75 e7                	jne    80181b <strncpy+0xb>
+	}
+	return ret;
+}
+  801834:	c3                   	ret
+
+0000000000801835 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801835:	48 89 f8             	mov    %rdi,%rax
+  801838:	48 85 d2             	test   %rdx,%rdx
+  80183b:	74 27                	je     801864 <strlcpy+0x2f>
+  80183d:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  801842:	48 89 fa             	mov    %rdi,%rdx
+  801845:	eb 0b                	jmp    801852 <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801847:	48 83 c6 01          	add    $0x1,%rsi
+  80184b:	48 83 c2 01          	add    $0x1,%rdx
+  80184f:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  801852:	48 39 c2             	cmp    %rax,%rdx
+  801855:	74 0a                	je     801861 <strlcpy+0x2c>
+  801857:	0f b6 0e             	movzbl (%rsi),%ecx
+  80185a:	84 c9                	test   %cl,%cl
+  80185c:	75 e9                	jne    801847 <strlcpy+0x12>
+  80185e:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  801861:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801864:	48 29 f8             	sub    %rdi,%rax
+}
+  801867:	c3                   	ret
+
+0000000000801868 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  801868:	eb 08                	jmp    801872 <strcmp+0xa>
+		p++, q++;
+  80186a:	48 83 c7 01          	add    $0x1,%rdi
+  80186e:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  801872:	0f b6 07             	movzbl (%rdi),%eax
+  801875:	84 c0                	test   %al,%al
+  801877:	74 04                	je     80187d <strcmp+0x15>
+  801879:	3a 06                	cmp    (%rsi),%al
+  80187b:	74 ed                	je     80186a <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80187d:	0f b6 c0             	movzbl %al,%eax
+  801880:	0f b6 16             	movzbl (%rsi),%edx
+  801883:	29 d0                	sub    %edx,%eax
+}
+  801885:	c3                   	ret
+
+0000000000801886 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  801886:	eb 0c                	jmp    801894 <strncmp+0xe>
+		n--, p++, q++;
+  801888:	48 83 ea 01          	sub    $0x1,%rdx
+  80188c:	48 83 c7 01          	add    $0x1,%rdi
+  801890:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  801894:	48 85 d2             	test   %rdx,%rdx
+  801897:	74 14                	je     8018ad <strncmp+0x27>
+  801899:	0f b6 07             	movzbl (%rdi),%eax
+  80189c:	84 c0                	test   %al,%al
+  80189e:	74 04                	je     8018a4 <strncmp+0x1e>
+  8018a0:	3a 06                	cmp    (%rsi),%al
+  8018a2:	74 e4                	je     801888 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8018a4:	0f b6 07             	movzbl (%rdi),%eax
+  8018a7:	0f b6 16             	movzbl (%rsi),%edx
+  8018aa:	29 d0                	sub    %edx,%eax
+}
+  8018ac:	c3                   	ret
+		return 0;
+  8018ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b2:	c3                   	ret
+
+00000000008018b3 <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  8018b3:	eb 04                	jmp    8018b9 <strchr+0x6>
+  8018b5:	48 83 c7 01          	add    $0x1,%rdi
+  8018b9:	0f b6 07             	movzbl (%rdi),%eax
+  8018bc:	84 c0                	test   %al,%al
+  8018be:	74 09                	je     8018c9 <strchr+0x16>
+		if (*s == c)
+  8018c0:	40 38 f0             	cmp    %sil,%al
+  8018c3:	75 f0                	jne    8018b5 <strchr+0x2>
+  8018c5:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  8018c8:	c3                   	ret
+	return 0;
+  8018c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ce:	c3                   	ret
+
+00000000008018cf <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8018cf:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  8018d2:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  8018d5:	40 38 f2             	cmp    %sil,%dl
+  8018d8:	74 0a                	je     8018e4 <strfind+0x15>
+  8018da:	84 d2                	test   %dl,%dl
+  8018dc:	74 06                	je     8018e4 <strfind+0x15>
+	for (; *s; s++)
+  8018de:	48 83 c0 01          	add    $0x1,%rax
+  8018e2:	eb ee                	jmp    8018d2 <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  8018e4:	c3                   	ret
+
+00000000008018e5 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  8018e5:	48 85 d2             	test   %rdx,%rdx
+  8018e8:	74 28                	je     801912 <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  8018ea:	48 89 f8             	mov    %rdi,%rax
+  8018ed:	48 09 d0             	or     %rdx,%rax
+  8018f0:	a8 03                	test   $0x3,%al
+  8018f2:	75 16                	jne    80190a <memset+0x25>
+		c &= 0xFF;
+  8018f4:	40 0f b6 f6          	movzbl %sil,%esi
+  8018f8:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8018fe:	48 89 d1             	mov    %rdx,%rcx
+  801901:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  801905:	fc                   	cld
+  801906:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801908:	eb 08                	jmp    801912 <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80190a:	89 f0                	mov    %esi,%eax
+  80190c:	48 89 d1             	mov    %rdx,%rcx
+  80190f:	fc                   	cld
+  801910:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801912:	48 89 f8             	mov    %rdi,%rax
+  801915:	c3                   	ret
+
+0000000000801916 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801916:	48 89 f8             	mov    %rdi,%rax
+  801919:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80191c:	48 39 fe             	cmp    %rdi,%rsi
+  80191f:	73 3a                	jae    80195b <memmove+0x45>
+  801921:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801925:	48 39 d7             	cmp    %rdx,%rdi
+  801928:	73 31                	jae    80195b <memmove+0x45>
+		s += n;
+		d += n;
+  80192a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  80192e:	48 89 d6             	mov    %rdx,%rsi
+  801931:	48 09 fe             	or     %rdi,%rsi
+  801934:	48 09 ce             	or     %rcx,%rsi
+  801937:	40 f6 c6 03          	test   $0x3,%sil
+  80193b:	75 11                	jne    80194e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80193d:	48 83 ef 04          	sub    $0x4,%rdi
+  801941:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  801945:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801949:	fd                   	std
+  80194a:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80194c:	eb 0b                	jmp    801959 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80194e:	48 83 ef 01          	sub    $0x1,%rdi
+  801952:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  801956:	fd                   	std
+  801957:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801959:	fc                   	cld
+  80195a:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  80195b:	48 89 f2             	mov    %rsi,%rdx
+  80195e:	48 09 c2             	or     %rax,%rdx
+  801961:	48 09 ca             	or     %rcx,%rdx
+  801964:	f6 c2 03             	test   $0x3,%dl
+  801967:	75 0b                	jne    801974 <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801969:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  80196d:	48 89 c7             	mov    %rax,%rdi
+  801970:	fc                   	cld
+  801971:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801973:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  801974:	48 89 c7             	mov    %rax,%rdi
+  801977:	fc                   	cld
+  801978:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80197a:	c3                   	ret
+
+000000000080197b <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80197b:	55                   	push   %rbp
+  80197c:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  80197f:	48 b8 16 19 80 00 00 	movabs $0x801916,%rax
+  801986:	00 00 00 
+  801989:	ff d0                	call   *%rax
+}
+  80198b:	5d                   	pop    %rbp
+  80198c:	c3                   	ret
+
+000000000080198d <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80198d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801992:	48 39 c2             	cmp    %rax,%rdx
+  801995:	74 1e                	je     8019b5 <memcmp+0x28>
+		if (*s1 != *s2)
+  801997:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80199b:	48 83 c0 01          	add    $0x1,%rax
+  80199f:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  8019a5:	44 38 c1             	cmp    %r8b,%cl
+  8019a8:	74 e8                	je     801992 <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  8019aa:	0f b6 c1             	movzbl %cl,%eax
+  8019ad:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8019b1:	44 29 c0             	sub    %r8d,%eax
+  8019b4:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  8019b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019ba:	c3                   	ret
+
+00000000008019bb <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8019bb:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  8019be:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  8019c1:	eb 04                	jmp    8019c7 <memfind+0xc>
+  8019c3:	48 83 c0 01          	add    $0x1,%rax
+  8019c7:	48 39 d0             	cmp    %rdx,%rax
+  8019ca:	73 05                	jae    8019d1 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8019cc:	40 38 30             	cmp    %sil,(%rax)
+  8019cf:	75 f2                	jne    8019c3 <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  8019d1:	c3                   	ret
+
+00000000008019d2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8019d2:	48 89 f9             	mov    %rdi,%rcx
+  8019d5:	49 89 f0             	mov    %rsi,%r8
+  8019d8:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8019da:	eb 04                	jmp    8019e0 <strtol+0xe>
+		s++;
+  8019dc:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  8019e0:	0f b6 01             	movzbl (%rcx),%eax
+  8019e3:	3c 20                	cmp    $0x20,%al
+  8019e5:	74 f5                	je     8019dc <strtol+0xa>
+  8019e7:	3c 09                	cmp    $0x9,%al
+  8019e9:	74 f1                	je     8019dc <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  8019eb:	3c 2b                	cmp    $0x2b,%al
+  8019ed:	74 2b                	je     801a1a <strtol+0x48>
+	int neg = 0;
+  8019ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  8019f5:	3c 2d                	cmp    $0x2d,%al
+  8019f7:	74 2d                	je     801a26 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8019f9:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  8019ff:	75 0f                	jne    801a10 <strtol+0x3e>
+  801a01:	80 39 30             	cmpb   $0x30,(%rcx)
+  801a04:	74 2c                	je     801a32 <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801a06:	85 ff                	test   %edi,%edi
+  801a08:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801a0d:	0f 44 f8             	cmove  %eax,%edi
+  801a10:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  801a15:	4c 63 d7             	movslq %edi,%r10
+  801a18:	eb 4f                	jmp    801a69 <strtol+0x97>
+		s++;
+  801a1a:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  801a1e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801a24:	eb d3                	jmp    8019f9 <strtol+0x27>
+		s++, neg = 1;
+  801a26:	48 83 c1 01          	add    $0x1,%rcx
+  801a2a:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  801a30:	eb c7                	jmp    8019f9 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801a32:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  801a36:	74 0f                	je     801a47 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  801a38:	85 ff                	test   %edi,%edi
+  801a3a:	75 d4                	jne    801a10 <strtol+0x3e>
+		s++, base = 8;
+  801a3c:	48 83 c1 01          	add    $0x1,%rcx
+  801a40:	bf 08 00 00 00       	mov    $0x8,%edi
+  801a45:	eb c9                	jmp    801a10 <strtol+0x3e>
+		s += 2, base = 16;
+  801a47:	48 83 c1 02          	add    $0x2,%rcx
+  801a4b:	bf 10 00 00 00       	mov    $0x10,%edi
+  801a50:	eb be                	jmp    801a10 <strtol+0x3e>
+			dig = *s - '0';
+  801a52:	0f be c0             	movsbl %al,%eax
+  801a55:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  801a58:	39 f8                	cmp    %edi,%eax
+  801a5a:	7d 3b                	jge    801a97 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  801a5c:	48 83 c1 01          	add    $0x1,%rcx
+  801a60:	49 0f af d2          	imul   %r10,%rdx
+  801a64:	48 98                	cltq
+  801a66:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  801a69:	0f b6 01             	movzbl (%rcx),%eax
+  801a6c:	8d 70 d0             	lea    -0x30(%rax),%esi
+  801a6f:	40 80 fe 09          	cmp    $0x9,%sil
+  801a73:	76 dd                	jbe    801a52 <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  801a75:	8d 70 9f             	lea    -0x61(%rax),%esi
+  801a78:	40 80 fe 19          	cmp    $0x19,%sil
+  801a7c:	77 08                	ja     801a86 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  801a7e:	0f be c0             	movsbl %al,%eax
+  801a81:	83 e8 57             	sub    $0x57,%eax
+  801a84:	eb d2                	jmp    801a58 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  801a86:	8d 70 bf             	lea    -0x41(%rax),%esi
+  801a89:	40 80 fe 19          	cmp    $0x19,%sil
+  801a8d:	77 08                	ja     801a97 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  801a8f:	0f be c0             	movsbl %al,%eax
+  801a92:	83 e8 37             	sub    $0x37,%eax
+  801a95:	eb c1                	jmp    801a58 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801a97:	4d 85 c0             	test   %r8,%r8
+  801a9a:	74 03                	je     801a9f <strtol+0xcd>
+		*endptr = (char *) s;
+  801a9c:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  801a9f:	48 89 d0             	mov    %rdx,%rax
+  801aa2:	48 f7 d8             	neg    %rax
+  801aa5:	45 85 c9             	test   %r9d,%r9d
+  801aa8:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  801aac:	48 89 d0             	mov    %rdx,%rax
+  801aaf:	c3                   	ret
+
+0000000000801ab0 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  801ab0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801ab6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  801abc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac6:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  801ac8:	c3                   	ret
+
+0000000000801ac9 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  801ac9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801acf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801ad5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ada:	b8 01 00 00 00       	mov    $0x1,%eax
+  801adf:	48 89 fe             	mov    %rdi,%rsi
+  801ae2:	48 89 fa             	mov    %rdi,%rdx
+  801ae5:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801ae7:	c3                   	ret
+
+0000000000801ae8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801ae8:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801aeb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801af1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801af7:	be 00 00 00 00       	mov    $0x0,%esi
+  801afc:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b01:	48 89 f2             	mov    %rsi,%rdx
+  801b04:	0f 05                	syscall
+	if(check && ret > 0)
+  801b06:	48 85 c0             	test   %rax,%rax
+  801b09:	7f 01                	jg     801b0c <sys_env_destroy+0x24>
+}
+  801b0b:	c3                   	ret
+{
+  801b0c:	55                   	push   %rbp
+  801b0d:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b10:	49 89 c0             	mov    %rax,%r8
+  801b13:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801b18:	48 ba e8 25 80 00 00 	movabs $0x8025e8,%rdx
+  801b1f:	00 00 00 
+  801b22:	be 28 00 00 00       	mov    $0x28,%esi
+  801b27:	48 bf 05 26 80 00 00 	movabs $0x802605,%rdi
+  801b2e:	00 00 00 
+  801b31:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b36:	49 b9 6c 0d 80 00 00 	movabs $0x800d6c,%r9
+  801b3d:	00 00 00 
+  801b40:	41 ff d1             	call   *%r9
+
+0000000000801b43 <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  801b43:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  801b4a:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  801b4b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b50:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801b54:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801b58:	48 c1 e2 04          	shl    $0x4,%rdx
+  801b5c:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801b63:	00 00 00 
+  801b66:	48 01 d0             	add    %rdx,%rax
+  801b69:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  801b6f:	c3                   	ret
+
+0000000000801b70 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  801b70:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801b76:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801b7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b81:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801b86:	48 89 fe             	mov    %rdi,%rsi
+  801b89:	48 89 fa             	mov    %rdi,%rdx
+  801b8c:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801b8e:	c3                   	ret
+
+0000000000801b8f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  801b8f:	48 63 d2             	movslq %edx,%rdx
+  801b92:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801b95:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801b9b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801ba1:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ba6:	0f 05                	syscall
+	if(check && ret > 0)
+  801ba8:	48 85 c0             	test   %rax,%rax
+  801bab:	7f 01                	jg     801bae <sys_page_alloc+0x1f>
+}
+  801bad:	c3                   	ret
+{
+  801bae:	55                   	push   %rbp
+  801baf:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801bb2:	49 89 c0             	mov    %rax,%r8
+  801bb5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801bba:	48 ba e8 25 80 00 00 	movabs $0x8025e8,%rdx
+  801bc1:	00 00 00 
+  801bc4:	be 28 00 00 00       	mov    $0x28,%esi
+  801bc9:	48 bf 05 26 80 00 00 	movabs $0x802605,%rdi
+  801bd0:	00 00 00 
+  801bd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd8:	49 b9 6c 0d 80 00 00 	movabs $0x800d6c,%r9
+  801bdf:	00 00 00 
+  801be2:	41 ff d1             	call   *%r9
+
+0000000000801be5 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  801be5:	48 63 d2             	movslq %edx,%rdx
+  801be8:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801beb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801bf1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801bf7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801bfc:	0f 05                	syscall
+	if(check && ret > 0)
+  801bfe:	48 85 c0             	test   %rax,%rax
+  801c01:	7f 01                	jg     801c04 <sys_page_alloc_huge+0x1f>
+}
+  801c03:	c3                   	ret
+{
+  801c04:	55                   	push   %rbp
+  801c05:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c08:	49 89 c0             	mov    %rax,%r8
+  801c0b:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801c10:	48 ba e8 25 80 00 00 	movabs $0x8025e8,%rdx
+  801c17:	00 00 00 
+  801c1a:	be 28 00 00 00       	mov    $0x28,%esi
+  801c1f:	48 bf 05 26 80 00 00 	movabs $0x802605,%rdi
+  801c26:	00 00 00 
+  801c29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2e:	49 b9 6c 0d 80 00 00 	movabs $0x800d6c,%r9
+  801c35:	00 00 00 
+  801c38:	41 ff d1             	call   *%r9
+
+0000000000801c3b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801c3b:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  801c3e:	48 63 d2             	movslq %edx,%rdx
+  801c41:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  801c44:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  801c47:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c4c:	0f 05                	syscall
+	if(check && ret > 0)
+  801c4e:	48 85 c0             	test   %rax,%rax
+  801c51:	7f 01                	jg     801c54 <sys_page_map+0x19>
+}
+  801c53:	c3                   	ret
+{
+  801c54:	55                   	push   %rbp
+  801c55:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c58:	49 89 c0             	mov    %rax,%r8
+  801c5b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801c60:	48 ba e8 25 80 00 00 	movabs $0x8025e8,%rdx
+  801c67:	00 00 00 
+  801c6a:	be 28 00 00 00       	mov    $0x28,%esi
+  801c6f:	48 bf 05 26 80 00 00 	movabs $0x802605,%rdi
+  801c76:	00 00 00 
+  801c79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7e:	49 b9 6c 0d 80 00 00 	movabs $0x800d6c,%r9
+  801c85:	00 00 00 
+  801c88:	41 ff d1             	call   *%r9
+
+0000000000801c8b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  801c8b:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801c8e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801c94:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801c9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c9f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ca4:	0f 05                	syscall
+	if(check && ret > 0)
+  801ca6:	48 85 c0             	test   %rax,%rax
+  801ca9:	7f 01                	jg     801cac <sys_page_unmap+0x21>
+}
+  801cab:	c3                   	ret
+{
+  801cac:	55                   	push   %rbp
+  801cad:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801cb0:	49 89 c0             	mov    %rax,%r8
+  801cb3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801cb8:	48 ba e8 25 80 00 00 	movabs $0x8025e8,%rdx
+  801cbf:	00 00 00 
+  801cc2:	be 28 00 00 00       	mov    $0x28,%esi
+  801cc7:	48 bf 05 26 80 00 00 	movabs $0x802605,%rdi
+  801cce:	00 00 00 
+  801cd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd6:	49 b9 6c 0d 80 00 00 	movabs $0x800d6c,%r9
+  801cdd:	00 00 00 
+  801ce0:	41 ff d1             	call   *%r9
+
+0000000000801ce3 <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  801ce3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801ce9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801cef:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cf4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801cf9:	48 89 fe             	mov    %rdi,%rsi
+  801cfc:	48 89 fa             	mov    %rdi,%rdx
+  801cff:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801d01:	c3                   	ret
+
+0000000000801d02 <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  801d02:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801d08:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801d0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d13:	b8 10 00 00 00       	mov    $0x10,%eax
+  801d18:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  801d1a:	c3                   	ret
+
+0000000000801d1b <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  801d1b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801d21:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801d27:	b8 11 00 00 00       	mov    $0x11,%eax
+  801d2c:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  801d2e:	c3                   	ret
+
+0000000000801d2f <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  801d2f:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  801d32:	48 63 f6             	movslq %esi,%rsi
+  801d35:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  801d38:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801d3e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801d43:	0f 05                	syscall
+	if(check && ret > 0)
+  801d45:	48 85 c0             	test   %rax,%rax
+  801d48:	7f 01                	jg     801d4b <sys_page_batch+0x1c>
+}
+  801d4a:	c3                   	ret
+{
+  801d4b:	55                   	push   %rbp
+  801d4c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801d4f:	49 89 c0             	mov    %rax,%r8
+  801d52:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801d57:	48 ba e8 25 80 00 00 	movabs $0x8025e8,%rdx
+  801d5e:	00 00 00 
+  801d61:	be 28 00 00 00       	mov    $0x28,%esi
+  801d66:	48 bf 05 26 80 00 00 	movabs $0x802605,%rdi
+  801d6d:	00 00 00 
+  801d70:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d75:	49 b9 6c 0d 80 00 00 	movabs $0x800d6c,%r9
+  801d7c:	00 00 00 
+  801d7f:	41 ff d1             	call   *%r9
+
+0000000000801d82 <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  801d82:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801d88:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801d8e:	be 00 00 00 00       	mov    $0x0,%esi
+  801d93:	b8 13 00 00 00       	mov    $0x13,%eax
+  801d98:	48 89 f2             	mov    %rsi,%rdx
+  801d9b:	0f 05                	syscall
+	if(check && ret > 0)
+  801d9d:	48 85 c0             	test   %rax,%rax
+  801da0:	7f 01                	jg     801da3 <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  801da2:	c3                   	ret
+{
+  801da3:	55                   	push   %rbp
+  801da4:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801da7:	49 89 c0             	mov    %rax,%r8
+  801daa:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801daf:	48 ba e8 25 80 00 00 	movabs $0x8025e8,%rdx
+  801db6:	00 00 00 
+  801db9:	be 28 00 00 00       	mov    $0x28,%esi
+  801dbe:	48 bf 05 26 80 00 00 	movabs $0x802605,%rdi
+  801dc5:	00 00 00 
+  801dc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dcd:	49 b9 6c 0d 80 00 00 	movabs $0x800d6c,%r9
+  801dd4:	00 00 00 
+  801dd7:	41 ff d1             	call   *%r9
+
+0000000000801dda <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  801dda:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801de0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801de6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801deb:	b8 14 00 00 00       	mov    $0x14,%eax
+  801df0:	48 89 fe             	mov    %rdi,%rsi
+  801df3:	48 89 fa             	mov    %rdi,%rdx
+  801df6:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801df8:	c3                   	ret
+
+0000000000801df9 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  801df9:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801dfc:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801e02:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801e08:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e0d:	0f 05                	syscall
+	if(check && ret > 0)
+  801e0f:	48 85 c0             	test   %rax,%rax
+  801e12:	7f 01                	jg     801e15 <sys_page_unmap_range+0x1c>
+}
+  801e14:	c3                   	ret
+{
+  801e15:	55                   	push   %rbp
+  801e16:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e19:	49 89 c0             	mov    %rax,%r8
+  801e1c:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801e21:	48 ba e8 25 80 00 00 	movabs $0x8025e8,%rdx
+  801e28:	00 00 00 
+  801e2b:	be 28 00 00 00       	mov    $0x28,%esi
+  801e30:	48 bf 05 26 80 00 00 	movabs $0x802605,%rdi
+  801e37:	00 00 00 
+  801e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e3f:	49 b9 6c 0d 80 00 00 	movabs $0x800d6c,%r9
+  801e46:	00 00 00 
+  801e49:	41 ff d1             	call   *%r9
+
+0000000000801e4c <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801e4c:	48 63 f6             	movslq %esi,%rsi
+  801e4f:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801e52:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801e58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801e5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e63:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e68:	0f 05                	syscall
+	if(check && ret > 0)
+  801e6a:	48 85 c0             	test   %rax,%rax
+  801e6d:	7f 01                	jg     801e70 <sys_env_set_status+0x24>
+}
+  801e6f:	c3                   	ret
+{
+  801e70:	55                   	push   %rbp
+  801e71:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e74:	49 89 c0             	mov    %rax,%r8
+  801e77:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801e7c:	48 ba e8 25 80 00 00 	movabs $0x8025e8,%rdx
+  801e83:	00 00 00 
+  801e86:	be 28 00 00 00       	mov    $0x28,%esi
+  801e8b:	48 bf 05 26 80 00 00 	movabs $0x802605,%rdi
+  801e92:	00 00 00 
+  801e95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e9a:	49 b9 6c 0d 80 00 00 	movabs $0x800d6c,%r9
+  801ea1:	00 00 00 
+  801ea4:	41 ff d1             	call   *%r9
+
+0000000000801ea7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  801ea7:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801eaa:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801eb0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801eb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ebb:	b8 09 00 00 00       	mov    $0x9,%eax
+  801ec0:	0f 05                	syscall
+	if(check && ret > 0)
+  801ec2:	48 85 c0             	test   %rax,%rax
+  801ec5:	7f 01                	jg     801ec8 <sys_env_set_pgfault_upcall+0x21>
+}
+  801ec7:	c3                   	ret
+{
+  801ec8:	55                   	push   %rbp
+  801ec9:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801ecc:	49 89 c0             	mov    %rax,%r8
+  801ecf:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801ed4:	48 ba e8 25 80 00 00 	movabs $0x8025e8,%rdx
+  801edb:	00 00 00 
+  801ede:	be 28 00 00 00       	mov    $0x28,%esi
+  801ee3:	48 bf 05 26 80 00 00 	movabs $0x802605,%rdi
+  801eea:	00 00 00 
+  801eed:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef2:	49 b9 6c 0d 80 00 00 	movabs $0x800d6c,%r9
+  801ef9:	00 00 00 
+  801efc:	41 ff d1             	call   *%r9
+
+0000000000801eff <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  801eff:	48 63 ff             	movslq %edi,%rdi
+  801f02:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  801f05:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801f0b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801f10:	0f 05                	syscall
+}
+  801f12:	c3                   	ret
+
+0000000000801f13 <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  801f13:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801f19:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801f1f:	be 00 00 00 00       	mov    $0x0,%esi
+  801f24:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801f29:	48 89 f2             	mov    %rsi,%rdx
+  801f2c:	0f 05                	syscall
+	if(check && ret > 0)
+  801f2e:	48 85 c0             	test   %rax,%rax
+  801f31:	7f 01                	jg     801f34 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  801f33:	c3                   	ret
+{
+  801f34:	55                   	push   %rbp
+  801f35:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f38:	49 89 c0             	mov    %rax,%r8
+  801f3b:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801f40:	48 ba e8 25 80 00 00 	movabs $0x8025e8,%rdx
+  801f47:	00 00 00 
+  801f4a:	be 28 00 00 00       	mov    $0x28,%esi
+  801f4f:	48 bf 05 26 80 00 00 	movabs $0x802605,%rdi
+  801f56:	00 00 00 
+  801f59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f5e:	49 b9 6c 0d 80 00 00 	movabs $0x800d6c,%r9
+  801f65:	00 00 00 
+  801f68:	41 ff d1             	call   *%r9
+
+0000000000801f6b <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801f6b:	55                   	push   %rbp
+  801f6c:	48 89 e5             	mov    %rsp,%rbp
+  801f6f:	53                   	push   %rbx
+  801f70:	48 83 ec 08          	sub    $0x8,%rsp
+  801f74:	48 89 fb             	mov    %rdi,%rbx
+	int r;
+
+	if (_pgfault_handler == 0) {
+  801f77:	48 ba f0 31 80 00 00 	movabs $0x8031f0,%rdx
+  801f7e:	00 00 00 
+  801f81:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801f85:	74 13                	je     801f9a <set_pgfault_handler+0x2f>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801f87:	48 89 d8             	mov    %rbx,%rax
+  801f8a:	48 a3 f0 31 80 00 00 	movabs %rax,0x8031f0
+  801f91:	00 00 00 
+}
+  801f94:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f98:	c9                   	leave
+  801f99:	c3                   	ret
+		r = sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801f9a:	ba 07 00 00 00       	mov    $0x7,%edx
+  801f9f:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801fa4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fa9:	48 b8 8f 1b 80 00 00 	movabs $0x801b8f,%rax
+  801fb0:	00 00 00 
+  801fb3:	ff d0                	call   *%rax
+		if (r < 0) {
+  801fb5:	85 c0                	test   %eax,%eax
+  801fb7:	78 4c                	js     802005 <set_pgfault_handler+0x9a>
+		r = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801fb9:	48 be 32 20 80 00 00 	movabs $0x802032,%rsi
+  801fc0:	00 00 00 
+  801fc3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fc8:	48 b8 a7 1e 80 00 00 	movabs $0x801ea7,%rax
+  801fcf:	00 00 00 
+  801fd2:	ff d0                	call   *%rax
+		if (r < 0) {
+  801fd4:	85 c0                	test   %eax,%eax
+  801fd6:	79 af                	jns    801f87 <set_pgfault_handler+0x1c>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+  801fd8:	89 c1                	mov    %eax,%ecx
+  801fda:	48 ba 40 26 80 00 00 	movabs $0x802640,%rdx
+  801fe1:	00 00 00 
+  801fe4:	be 2c 00 00 00       	mov    $0x2c,%esi
+  801fe9:	48 bf 2e 26 80 00 00 	movabs $0x80262e,%rdi
+  801ff0:	00 00 00 
+  801ff3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff8:	49 b8 6c 0d 80 00 00 	movabs $0x800d6c,%r8
+  801fff:	00 00 00 
+  802002:	41 ff d0             	call   *%r8
+			panic("sys_page_alloc failed:  %e", r);
+  802005:	89 c1                	mov    %eax,%ecx
+  802007:	48 ba 13 26 80 00 00 	movabs $0x802613,%rdx
+  80200e:	00 00 00 
+  802011:	be 28 00 00 00       	mov    $0x28,%esi
+  802016:	48 bf 2e 26 80 00 00 	movabs $0x80262e,%rdi
+  80201d:	00 00 00 
+  802020:	b8 00 00 00 00       	mov    $0x0,%eax
+  802025:	49 b8 6c 0d 80 00 00 	movabs $0x800d6c,%r8
+  80202c:	00 00 00 
+  80202f:	41 ff d0             	call   *%r8
+
+0000000000802032 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi		// function argument: pointer to UTF
+  802032:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  802035:	48 a1 f0 31 80 00 00 	movabs 0x8031f0,%rax
+  80203c:	00 00 00 
+	call *%rax
+  80203f:	ff d0                	call   *%rax
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here. (Hint. You need to modify the trap time rsp to make room for the return rip ) */
+
+	movq  152(%rsp), %rax
+  802041:	48 8b 84 24 98 00 00 	mov    0x98(%rsp),%rax
+  802048:	00 
+	subq $8, %rax
+  802049:	48 83 e8 08          	sub    $0x8,%rax
+	movq %rax, 152(%rsp)
+  80204d:	48 89 84 24 98 00 00 	mov    %rax,0x98(%rsp)
+  802054:	00 
+
+	movq 136(%rsp), %rbx
+  802055:	48 8b 9c 24 88 00 00 	mov    0x88(%rsp),%rbx
+  80205c:	00 
+	movq %rbx, (%rax)
+  80205d:	48 89 18             	mov    %rbx,(%rax)
+
+	/* Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here. (Hint, the oposite of _alltraps) */
+
+	addq $16, %rsp
+  802060:	48 83 c4 10          	add    $0x10,%rsp
+	
+	popq %r15
+  802064:	41 5f                	pop    %r15
+	popq %r14
+  802066:	41 5e                	pop    %r14
+	popq %r13
+  802068:	41 5d                	pop    %r13
+	popq %r12
+  80206a:	41 5c                	pop    %r12
+	popq %r11
+  80206c:	41 5b                	pop    %r11
+	popq %r10
+  80206e:	41 5a                	pop    %r10
+	popq %r9
+  802070:	41 59                	pop    %r9
+	popq %r8
+  802072:	41 58                	pop    %r8
+	popq %rsi
+  802074:	5e                   	pop    %rsi
+	popq %rdi
+  802075:	5f                   	pop    %rdi
+	popq %rbp
+  802076:	5d                   	pop    %rbp
+	popq %rdx
+  802077:	5a                   	pop    %rdx
+	popq %rcx
+  802078:	59                   	pop    %rcx
+	popq %rbx
+  802079:	5b                   	pop    %rbx
+	popq %rax
+  80207a:	58                   	pop    %rax
+
+	addq $8, %rsp
+  80207b:	48 83 c4 08          	add    $0x8,%rsp
+	/* Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 4: Your code here. */
+
+	popfq
+  80207f:	9d                   	popf
+
+	/* Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here. */
+
+	popq %rsp
+  802080:	5c                   	pop    %rsp
+
+	/* Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here. */
+  802081:	c3                   	ret
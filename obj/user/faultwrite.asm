@@ -0,0 +1,2243 @@
+
+obj/user/faultwrite:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 0e 00 00 00       	call   80003f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	*(unsigned*)0 = 0;
+  800033:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80003a:	00 00 00 00 
+}
+  80003e:	c3                   	ret
+
+000000000080003f <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  80003f:	55                   	push   %rbp
+  800040:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800043:	85 ff                	test   %edi,%edi
+  800045:	7e 0d                	jle    800054 <libmain+0x15>
+		binaryname = argv[0];
+  800047:	48 8b 06             	mov    (%rsi),%rax
+  80004a:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  800051:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  800054:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  80005b:	00 00 00 
+  80005e:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800060:	48 b8 6e 00 80 00 00 	movabs $0x80006e,%rax
+  800067:	00 00 00 
+  80006a:	ff d0                	call   *%rax
+}
+  80006c:	5d                   	pop    %rbp
+  80006d:	c3                   	ret
+
+000000000080006e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80006e:	55                   	push   %rbp
+  80006f:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  800072:	bf 00 00 00 00       	mov    $0x0,%edi
+  800077:	48 b8 bd 00 80 00 00 	movabs $0x8000bd,%rax
+  80007e:	00 00 00 
+  800081:	ff d0                	call   *%rax
+}
+  800083:	5d                   	pop    %rbp
+  800084:	c3                   	ret
+
+0000000000800085 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800085:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80008b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800091:	ba 00 00 00 00       	mov    $0x0,%edx
+  800096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009b:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  80009d:	c3                   	ret
+
+000000000080009e <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  80009e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8000aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000af:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000b4:	48 89 fe             	mov    %rdi,%rsi
+  8000b7:	48 89 fa             	mov    %rdi,%rdx
+  8000ba:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000bc:	c3                   	ret
+
+00000000008000bd <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8000bd:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8000c0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8000cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8000d1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000d6:	48 89 f2             	mov    %rsi,%rdx
+  8000d9:	0f 05                	syscall
+	if(check && ret > 0)
+  8000db:	48 85 c0             	test   %rax,%rax
+  8000de:	7f 01                	jg     8000e1 <sys_env_destroy+0x24>
+}
+  8000e0:	c3                   	ret
+{
+  8000e1:	55                   	push   %rbp
+  8000e2:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8000e5:	49 89 c0             	mov    %rax,%r8
+  8000e8:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8000ed:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  8000f4:	00 00 00 
+  8000f7:	be 28 00 00 00       	mov    $0x28,%esi
+  8000fc:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  800103:	00 00 00 
+  800106:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010b:	49 b9 40 05 80 00 00 	movabs $0x800540,%r9
+  800112:	00 00 00 
+  800115:	41 ff d1             	call   *%r9
+
+0000000000800118 <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800118:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  80011f:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800120:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800125:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800129:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80012d:	48 c1 e2 04          	shl    $0x4,%rdx
+  800131:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800138:	00 00 00 
+  80013b:	48 01 d0             	add    %rdx,%rax
+  80013e:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800144:	c3                   	ret
+
+0000000000800145 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800145:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80014b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800151:	bf 00 00 00 00       	mov    $0x0,%edi
+  800156:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80015b:	48 89 fe             	mov    %rdi,%rsi
+  80015e:	48 89 fa             	mov    %rdi,%rdx
+  800161:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800163:	c3                   	ret
+
+0000000000800164 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  800164:	48 63 d2             	movslq %edx,%rdx
+  800167:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80016a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800170:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800176:	b8 04 00 00 00       	mov    $0x4,%eax
+  80017b:	0f 05                	syscall
+	if(check && ret > 0)
+  80017d:	48 85 c0             	test   %rax,%rax
+  800180:	7f 01                	jg     800183 <sys_page_alloc+0x1f>
+}
+  800182:	c3                   	ret
+{
+  800183:	55                   	push   %rbp
+  800184:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800187:	49 89 c0             	mov    %rax,%r8
+  80018a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80018f:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  800196:	00 00 00 
+  800199:	be 28 00 00 00       	mov    $0x28,%esi
+  80019e:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  8001a5:	00 00 00 
+  8001a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ad:	49 b9 40 05 80 00 00 	movabs $0x800540,%r9
+  8001b4:	00 00 00 
+  8001b7:	41 ff d1             	call   *%r9
+
+00000000008001ba <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8001ba:	48 63 d2             	movslq %edx,%rdx
+  8001bd:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8001c0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8001c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8001cc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8001d1:	0f 05                	syscall
+	if(check && ret > 0)
+  8001d3:	48 85 c0             	test   %rax,%rax
+  8001d6:	7f 01                	jg     8001d9 <sys_page_alloc_huge+0x1f>
+}
+  8001d8:	c3                   	ret
+{
+  8001d9:	55                   	push   %rbp
+  8001da:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001dd:	49 89 c0             	mov    %rax,%r8
+  8001e0:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8001e5:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  8001ec:	00 00 00 
+  8001ef:	be 28 00 00 00       	mov    $0x28,%esi
+  8001f4:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  8001fb:	00 00 00 
+  8001fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800203:	49 b9 40 05 80 00 00 	movabs $0x800540,%r9
+  80020a:	00 00 00 
+  80020d:	41 ff d1             	call   *%r9
+
+0000000000800210 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800210:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  800213:	48 63 d2             	movslq %edx,%rdx
+  800216:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800219:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  80021c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800221:	0f 05                	syscall
+	if(check && ret > 0)
+  800223:	48 85 c0             	test   %rax,%rax
+  800226:	7f 01                	jg     800229 <sys_page_map+0x19>
+}
+  800228:	c3                   	ret
+{
+  800229:	55                   	push   %rbp
+  80022a:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80022d:	49 89 c0             	mov    %rax,%r8
+  800230:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800235:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  80023c:	00 00 00 
+  80023f:	be 28 00 00 00       	mov    $0x28,%esi
+  800244:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  80024b:	00 00 00 
+  80024e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800253:	49 b9 40 05 80 00 00 	movabs $0x800540,%r9
+  80025a:	00 00 00 
+  80025d:	41 ff d1             	call   *%r9
+
+0000000000800260 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  800260:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800263:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800269:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80026f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800274:	b8 06 00 00 00       	mov    $0x6,%eax
+  800279:	0f 05                	syscall
+	if(check && ret > 0)
+  80027b:	48 85 c0             	test   %rax,%rax
+  80027e:	7f 01                	jg     800281 <sys_page_unmap+0x21>
+}
+  800280:	c3                   	ret
+{
+  800281:	55                   	push   %rbp
+  800282:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800285:	49 89 c0             	mov    %rax,%r8
+  800288:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80028d:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  800294:	00 00 00 
+  800297:	be 28 00 00 00       	mov    $0x28,%esi
+  80029c:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  8002a3:	00 00 00 
+  8002a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ab:	49 b9 40 05 80 00 00 	movabs $0x800540,%r9
+  8002b2:	00 00 00 
+  8002b5:	41 ff d1             	call   *%r9
+
+00000000008002b8 <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  8002b8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002c9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8002ce:	48 89 fe             	mov    %rdi,%rsi
+  8002d1:	48 89 fa             	mov    %rdi,%rdx
+  8002d4:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8002d6:	c3                   	ret
+
+00000000008002d7 <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  8002d7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002e8:	b8 10 00 00 00       	mov    $0x10,%eax
+  8002ed:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  8002ef:	c3                   	ret
+
+00000000008002f0 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  8002f0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002fc:	b8 11 00 00 00       	mov    $0x11,%eax
+  800301:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  800303:	c3                   	ret
+
+0000000000800304 <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  800304:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  800307:	48 63 f6             	movslq %esi,%rsi
+  80030a:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  80030d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800313:	b8 12 00 00 00       	mov    $0x12,%eax
+  800318:	0f 05                	syscall
+	if(check && ret > 0)
+  80031a:	48 85 c0             	test   %rax,%rax
+  80031d:	7f 01                	jg     800320 <sys_page_batch+0x1c>
+}
+  80031f:	c3                   	ret
+{
+  800320:	55                   	push   %rbp
+  800321:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800324:	49 89 c0             	mov    %rax,%r8
+  800327:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80032c:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  800333:	00 00 00 
+  800336:	be 28 00 00 00       	mov    $0x28,%esi
+  80033b:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  800342:	00 00 00 
+  800345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034a:	49 b9 40 05 80 00 00 	movabs $0x800540,%r9
+  800351:	00 00 00 
+  800354:	41 ff d1             	call   *%r9
+
+0000000000800357 <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  800357:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80035d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800363:	be 00 00 00 00       	mov    $0x0,%esi
+  800368:	b8 13 00 00 00       	mov    $0x13,%eax
+  80036d:	48 89 f2             	mov    %rsi,%rdx
+  800370:	0f 05                	syscall
+	if(check && ret > 0)
+  800372:	48 85 c0             	test   %rax,%rax
+  800375:	7f 01                	jg     800378 <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  800377:	c3                   	ret
+{
+  800378:	55                   	push   %rbp
+  800379:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80037c:	49 89 c0             	mov    %rax,%r8
+  80037f:	b9 13 00 00 00       	mov    $0x13,%ecx
+  800384:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  80038b:	00 00 00 
+  80038e:	be 28 00 00 00       	mov    $0x28,%esi
+  800393:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  80039a:	00 00 00 
+  80039d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a2:	49 b9 40 05 80 00 00 	movabs $0x800540,%r9
+  8003a9:	00 00 00 
+  8003ac:	41 ff d1             	call   *%r9
+
+00000000008003af <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  8003af:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8003b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8003bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003c0:	b8 14 00 00 00       	mov    $0x14,%eax
+  8003c5:	48 89 fe             	mov    %rdi,%rsi
+  8003c8:	48 89 fa             	mov    %rdi,%rdx
+  8003cb:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8003cd:	c3                   	ret
+
+00000000008003ce <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  8003ce:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8003d1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8003d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8003dd:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8003e2:	0f 05                	syscall
+	if(check && ret > 0)
+  8003e4:	48 85 c0             	test   %rax,%rax
+  8003e7:	7f 01                	jg     8003ea <sys_page_unmap_range+0x1c>
+}
+  8003e9:	c3                   	ret
+{
+  8003ea:	55                   	push   %rbp
+  8003eb:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003ee:	49 89 c0             	mov    %rax,%r8
+  8003f1:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8003f6:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  8003fd:	00 00 00 
+  800400:	be 28 00 00 00       	mov    $0x28,%esi
+  800405:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  80040c:	00 00 00 
+  80040f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800414:	49 b9 40 05 80 00 00 	movabs $0x800540,%r9
+  80041b:	00 00 00 
+  80041e:	41 ff d1             	call   *%r9
+
+0000000000800421 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  800421:	48 63 f6             	movslq %esi,%rsi
+  800424:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800427:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80042d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800433:	ba 00 00 00 00       	mov    $0x0,%edx
+  800438:	b8 08 00 00 00       	mov    $0x8,%eax
+  80043d:	0f 05                	syscall
+	if(check && ret > 0)
+  80043f:	48 85 c0             	test   %rax,%rax
+  800442:	7f 01                	jg     800445 <sys_env_set_status+0x24>
+}
+  800444:	c3                   	ret
+{
+  800445:	55                   	push   %rbp
+  800446:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800449:	49 89 c0             	mov    %rax,%r8
+  80044c:	b9 08 00 00 00       	mov    $0x8,%ecx
+  800451:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  800458:	00 00 00 
+  80045b:	be 28 00 00 00       	mov    $0x28,%esi
+  800460:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  800467:	00 00 00 
+  80046a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046f:	49 b9 40 05 80 00 00 	movabs $0x800540,%r9
+  800476:	00 00 00 
+  800479:	41 ff d1             	call   *%r9
+
+000000000080047c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80047c:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80047f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800485:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80048b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800490:	b8 09 00 00 00       	mov    $0x9,%eax
+  800495:	0f 05                	syscall
+	if(check && ret > 0)
+  800497:	48 85 c0             	test   %rax,%rax
+  80049a:	7f 01                	jg     80049d <sys_env_set_pgfault_upcall+0x21>
+}
+  80049c:	c3                   	ret
+{
+  80049d:	55                   	push   %rbp
+  80049e:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004a1:	49 89 c0             	mov    %rax,%r8
+  8004a4:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004a9:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  8004b0:	00 00 00 
+  8004b3:	be 28 00 00 00       	mov    $0x28,%esi
+  8004b8:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  8004bf:	00 00 00 
+  8004c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c7:	49 b9 40 05 80 00 00 	movabs $0x800540,%r9
+  8004ce:	00 00 00 
+  8004d1:	41 ff d1             	call   *%r9
+
+00000000008004d4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8004d4:	48 63 ff             	movslq %edi,%rdi
+  8004d7:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  8004da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8004e0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8004e5:	0f 05                	syscall
+}
+  8004e7:	c3                   	ret
+
+00000000008004e8 <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  8004e8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8004ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8004f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8004f9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8004fe:	48 89 f2             	mov    %rsi,%rdx
+  800501:	0f 05                	syscall
+	if(check && ret > 0)
+  800503:	48 85 c0             	test   %rax,%rax
+  800506:	7f 01                	jg     800509 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  800508:	c3                   	ret
+{
+  800509:	55                   	push   %rbp
+  80050a:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80050d:	49 89 c0             	mov    %rax,%r8
+  800510:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  800515:	48 ba aa 12 80 00 00 	movabs $0x8012aa,%rdx
+  80051c:	00 00 00 
+  80051f:	be 28 00 00 00       	mov    $0x28,%esi
+  800524:	48 bf c7 12 80 00 00 	movabs $0x8012c7,%rdi
+  80052b:	00 00 00 
+  80052e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800533:	49 b9 40 05 80 00 00 	movabs $0x800540,%r9
+  80053a:	00 00 00 
+  80053d:	41 ff d1             	call   *%r9
+
+0000000000800540 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800540:	55                   	push   %rbp
+  800541:	48 89 e5             	mov    %rsp,%rbp
+  800544:	41 56                	push   %r14
+  800546:	41 55                	push   %r13
+  800548:	41 54                	push   %r12
+  80054a:	53                   	push   %rbx
+  80054b:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800552:	49 89 fc             	mov    %rdi,%r12
+  800555:	41 89 f5             	mov    %esi,%r13d
+  800558:	48 89 d3             	mov    %rdx,%rbx
+  80055b:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800562:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800569:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800570:	84 c0                	test   %al,%al
+  800572:	74 26                	je     80059a <_panic+0x5a>
+  800574:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  80057b:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800582:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800586:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  80058a:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  80058e:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800592:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800596:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80059a:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8005a1:	00 00 00 
+  8005a4:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8005ab:	00 00 00 
+  8005ae:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005b2:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8005b9:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8005c0:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005c7:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  8005ce:	00 00 00 
+  8005d1:	4c 8b 30             	mov    (%rax),%r14
+  8005d4:	48 b8 18 01 80 00 00 	movabs $0x800118,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+  8005e0:	89 c6                	mov    %eax,%esi
+  8005e2:	45 89 e8             	mov    %r13d,%r8d
+  8005e5:	4c 89 e1             	mov    %r12,%rcx
+  8005e8:	4c 89 f2             	mov    %r14,%rdx
+  8005eb:	48 bf d8 12 80 00 00 	movabs $0x8012d8,%rdi
+  8005f2:	00 00 00 
+  8005f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005fa:	49 bc df 06 80 00 00 	movabs $0x8006df,%r12
+  800601:	00 00 00 
+  800604:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800607:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  80060e:	48 89 df             	mov    %rbx,%rdi
+  800611:	48 b8 7b 06 80 00 00 	movabs $0x80067b,%rax
+  800618:	00 00 00 
+  80061b:	ff d0                	call   *%rax
+	cprintf("\n");
+  80061d:	48 bf fb 12 80 00 00 	movabs $0x8012fb,%rdi
+  800624:	00 00 00 
+  800627:	b8 00 00 00 00       	mov    $0x0,%eax
+  80062c:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80062f:	cc                   	int3
+	while (1)
+  800630:	eb fd                	jmp    80062f <_panic+0xef>
+
+0000000000800632 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800632:	55                   	push   %rbp
+  800633:	48 89 e5             	mov    %rsp,%rbp
+  800636:	53                   	push   %rbx
+  800637:	48 83 ec 08          	sub    $0x8,%rsp
+  80063b:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  80063e:	8b 06                	mov    (%rsi),%eax
+  800640:	8d 50 01             	lea    0x1(%rax),%edx
+  800643:	89 16                	mov    %edx,(%rsi)
+  800645:	48 98                	cltq
+  800647:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  80064c:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800652:	74 0a                	je     80065e <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800654:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800658:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80065c:	c9                   	leave
+  80065d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80065e:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800662:	be ff 00 00 00       	mov    $0xff,%esi
+  800667:	48 b8 85 00 80 00 00 	movabs $0x800085,%rax
+  80066e:	00 00 00 
+  800671:	ff d0                	call   *%rax
+		b->idx = 0;
+  800673:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800679:	eb d9                	jmp    800654 <putch+0x22>
+
+000000000080067b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80067b:	55                   	push   %rbp
+  80067c:	48 89 e5             	mov    %rsp,%rbp
+  80067f:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800686:	48 89 fa             	mov    %rdi,%rdx
+  800689:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  80068c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800693:	00 00 00 
+	b.cnt = 0;
+  800696:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80069d:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8006a0:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  8006a7:	48 bf 32 06 80 00 00 	movabs $0x800632,%rdi
+  8006ae:	00 00 00 
+  8006b1:	48 b8 99 08 80 00 00 	movabs $0x800899,%rax
+  8006b8:	00 00 00 
+  8006bb:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8006bd:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  8006c4:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8006cb:	48 b8 85 00 80 00 00 	movabs $0x800085,%rax
+  8006d2:	00 00 00 
+  8006d5:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  8006d7:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  8006dd:	c9                   	leave
+  8006de:	c3                   	ret
+
+00000000008006df <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8006df:	55                   	push   %rbp
+  8006e0:	48 89 e5             	mov    %rsp,%rbp
+  8006e3:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8006ea:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8006f1:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8006f8:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8006ff:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800706:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80070d:	84 c0                	test   %al,%al
+  80070f:	74 20                	je     800731 <cprintf+0x52>
+  800711:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800715:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800719:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80071d:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800721:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800725:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800729:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80072d:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800731:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  800738:	00 00 00 
+  80073b:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800742:	00 00 00 
+  800745:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800749:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800750:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800757:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  80075e:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  800765:	48 b8 7b 06 80 00 00 	movabs $0x80067b,%rax
+  80076c:	00 00 00 
+  80076f:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  800771:	c9                   	leave
+  800772:	c3                   	ret
+
+0000000000800773 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800773:	55                   	push   %rbp
+  800774:	48 89 e5             	mov    %rsp,%rbp
+  800777:	41 57                	push   %r15
+  800779:	41 56                	push   %r14
+  80077b:	41 55                	push   %r13
+  80077d:	41 54                	push   %r12
+  80077f:	53                   	push   %rbx
+  800780:	48 83 ec 18          	sub    $0x18,%rsp
+  800784:	49 89 fc             	mov    %rdi,%r12
+  800787:	49 89 f5             	mov    %rsi,%r13
+  80078a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80078e:	44 89 c3             	mov    %r8d,%ebx
+  800791:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800794:	41 89 cf             	mov    %ecx,%r15d
+  800797:	4c 39 fa             	cmp    %r15,%rdx
+  80079a:	72 29                	jb     8007c5 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80079c:	48 89 d0             	mov    %rdx,%rax
+  80079f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007a4:	49 f7 f7             	div    %r15
+  8007a7:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8007ab:	48 89 c2             	mov    %rax,%rdx
+  8007ae:	48 b8 73 07 80 00 00 	movabs $0x800773,%rax
+  8007b5:	00 00 00 
+  8007b8:	ff d0                	call   *%rax
+  8007ba:	eb 10                	jmp    8007cc <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8007bc:	4c 89 ee             	mov    %r13,%rsi
+  8007bf:	44 89 f7             	mov    %r14d,%edi
+  8007c2:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  8007c5:	83 eb 01             	sub    $0x1,%ebx
+  8007c8:	85 db                	test   %ebx,%ebx
+  8007ca:	7f f0                	jg     8007bc <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007cc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007d5:	49 f7 f7             	div    %r15
+  8007d8:	48 b8 fd 12 80 00 00 	movabs $0x8012fd,%rax
+  8007df:	00 00 00 
+  8007e2:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  8007e6:	4c 89 ee             	mov    %r13,%rsi
+  8007e9:	41 ff d4             	call   *%r12
+}
+  8007ec:	48 83 c4 18          	add    $0x18,%rsp
+  8007f0:	5b                   	pop    %rbx
+  8007f1:	41 5c                	pop    %r12
+  8007f3:	41 5d                	pop    %r13
+  8007f5:	41 5e                	pop    %r14
+  8007f7:	41 5f                	pop    %r15
+  8007f9:	5d                   	pop    %rbp
+  8007fa:	c3                   	ret
+
+00000000008007fb <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  8007fb:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  8007ff:	48 8b 06             	mov    (%rsi),%rax
+  800802:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800806:	73 0a                	jae    800812 <sprintputch+0x17>
+		*b->buf++ = ch;
+  800808:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80080c:	48 89 16             	mov    %rdx,(%rsi)
+  80080f:	40 88 38             	mov    %dil,(%rax)
+}
+  800812:	c3                   	ret
+
+0000000000800813 <printfmt>:
+{
+  800813:	55                   	push   %rbp
+  800814:	48 89 e5             	mov    %rsp,%rbp
+  800817:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80081e:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800825:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80082c:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800833:	84 c0                	test   %al,%al
+  800835:	74 20                	je     800857 <printfmt+0x44>
+  800837:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80083b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80083f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800843:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800847:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80084b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80084f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800853:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  800857:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  80085e:	00 00 00 
+  800861:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800868:	00 00 00 
+  80086b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80086f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800876:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80087d:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800884:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  80088b:	48 b8 99 08 80 00 00 	movabs $0x800899,%rax
+  800892:	00 00 00 
+  800895:	ff d0                	call   *%rax
+}
+  800897:	c9                   	leave
+  800898:	c3                   	ret
+
+0000000000800899 <vprintfmt>:
+{
+  800899:	55                   	push   %rbp
+  80089a:	48 89 e5             	mov    %rsp,%rbp
+  80089d:	41 57                	push   %r15
+  80089f:	41 56                	push   %r14
+  8008a1:	41 55                	push   %r13
+  8008a3:	41 54                	push   %r12
+  8008a5:	53                   	push   %rbx
+  8008a6:	48 83 ec 48          	sub    $0x48,%rsp
+  8008aa:	49 89 fe             	mov    %rdi,%r14
+  8008ad:	49 89 f5             	mov    %rsi,%r13
+  8008b0:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  8008b3:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  8008b7:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  8008bb:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8008bf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8008c3:	eb 09                	jmp    8008ce <vprintfmt+0x35>
+			putch(ch, putdat);
+  8008c5:	4c 89 ee             	mov    %r13,%rsi
+  8008c8:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008cb:	4c 89 e3             	mov    %r12,%rbx
+  8008ce:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8008d2:	0f b6 3b             	movzbl (%rbx),%edi
+  8008d5:	83 ff 25             	cmp    $0x25,%edi
+  8008d8:	74 13                	je     8008ed <vprintfmt+0x54>
+			if (ch == '\0')
+  8008da:	85 ff                	test   %edi,%edi
+  8008dc:	75 e7                	jne    8008c5 <vprintfmt+0x2c>
+}
+  8008de:	48 83 c4 48          	add    $0x48,%rsp
+  8008e2:	5b                   	pop    %rbx
+  8008e3:	41 5c                	pop    %r12
+  8008e5:	41 5d                	pop    %r13
+  8008e7:	41 5e                	pop    %r14
+  8008e9:	41 5f                	pop    %r15
+  8008eb:	5d                   	pop    %rbp
+  8008ec:	c3                   	ret
+		padc = ' ';
+  8008ed:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  8008f1:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  8008f8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  8008fe:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  800905:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80090a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80090f:	41 0f b6 14 24       	movzbl (%r12),%edx
+  800914:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  800917:	3c 55                	cmp    $0x55,%al
+  800919:	0f 87 4f 05 00 00    	ja     800e6e <vprintfmt+0x5d5>
+  80091f:	0f b6 c0             	movzbl %al,%eax
+  800922:	48 be c0 13 80 00 00 	movabs $0x8013c0,%rsi
+  800929:	00 00 00 
+  80092c:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  80092f:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  800932:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  800936:	eb d2                	jmp    80090a <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800938:	49 89 dc             	mov    %rbx,%r12
+  80093b:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  80093f:	eb c9                	jmp    80090a <vprintfmt+0x71>
+  800941:	0f b6 d2             	movzbl %dl,%edx
+  800944:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  800947:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  80094d:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800951:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  800956:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  80095b:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  80095e:	83 f8 09             	cmp    $0x9,%eax
+  800961:	77 20                	ja     800983 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  800963:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  800967:	eb e4                	jmp    80094d <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  800969:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096c:	83 f8 2f             	cmp    $0x2f,%eax
+  80096f:	77 27                	ja     800998 <vprintfmt+0xff>
+  800971:	89 c2                	mov    %eax,%edx
+  800973:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800977:	83 c0 08             	add    $0x8,%eax
+  80097a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097d:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  800980:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  800983:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800987:	79 81                	jns    80090a <vprintfmt+0x71>
+				width = precision, precision = -1;
+  800989:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  80098d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800993:	e9 72 ff ff ff       	jmp    80090a <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  800998:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a4:	eb d7                	jmp    80097d <vprintfmt+0xe4>
+			if (width < 0)
+  8009a6:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  8009a9:	85 f6                	test   %esi,%esi
+  8009ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b0:	0f 49 c6             	cmovns %esi,%eax
+  8009b3:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8009b6:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8009b9:	e9 4c ff ff ff       	jmp    80090a <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8009be:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  8009c1:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  8009c8:	e9 3d ff ff ff       	jmp    80090a <vprintfmt+0x71>
+			lflag++;
+  8009cd:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8009d0:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8009d3:	e9 32 ff ff ff       	jmp    80090a <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  8009d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009db:	83 f8 2f             	cmp    $0x2f,%eax
+  8009de:	77 19                	ja     8009f9 <vprintfmt+0x160>
+  8009e0:	89 c2                	mov    %eax,%edx
+  8009e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e6:	83 c0 08             	add    $0x8,%eax
+  8009e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ec:	8b 3a                	mov    (%rdx),%edi
+  8009ee:	4c 89 ee             	mov    %r13,%rsi
+  8009f1:	41 ff d6             	call   *%r14
+			break;
+  8009f4:	e9 d5 fe ff ff       	jmp    8008ce <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  8009f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a05:	eb e5                	jmp    8009ec <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  800a07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0d:	77 5a                	ja     800a69 <vprintfmt+0x1d0>
+  800a0f:	89 c2                	mov    %eax,%edx
+  800a11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a15:	83 c0 08             	add    $0x8,%eax
+  800a18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800a1b:	8b 02                	mov    (%rdx),%eax
+  800a1d:	89 c1                	mov    %eax,%ecx
+  800a1f:	f7 d9                	neg    %ecx
+  800a21:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a24:	83 f9 08             	cmp    $0x8,%ecx
+  800a27:	7f 4e                	jg     800a77 <vprintfmt+0x1de>
+  800a29:	48 63 c1             	movslq %ecx,%rax
+  800a2c:	48 ba 80 16 80 00 00 	movabs $0x801680,%rdx
+  800a33:	00 00 00 
+  800a36:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800a3a:	48 85 c0             	test   %rax,%rax
+  800a3d:	74 38                	je     800a77 <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800a3f:	48 89 c1             	mov    %rax,%rcx
+  800a42:	48 ba 1e 13 80 00 00 	movabs $0x80131e,%rdx
+  800a49:	00 00 00 
+  800a4c:	4c 89 ee             	mov    %r13,%rsi
+  800a4f:	4c 89 f7             	mov    %r14,%rdi
+  800a52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a57:	49 b8 13 08 80 00 00 	movabs $0x800813,%r8
+  800a5e:	00 00 00 
+  800a61:	41 ff d0             	call   *%r8
+  800a64:	e9 65 fe ff ff       	jmp    8008ce <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  800a69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a75:	eb a4                	jmp    800a1b <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  800a77:	48 ba 15 13 80 00 00 	movabs $0x801315,%rdx
+  800a7e:	00 00 00 
+  800a81:	4c 89 ee             	mov    %r13,%rsi
+  800a84:	4c 89 f7             	mov    %r14,%rdi
+  800a87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8c:	49 b8 13 08 80 00 00 	movabs $0x800813,%r8
+  800a93:	00 00 00 
+  800a96:	41 ff d0             	call   *%r8
+  800a99:	e9 30 fe ff ff       	jmp    8008ce <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800a9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa1:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa4:	77 36                	ja     800adc <vprintfmt+0x243>
+  800aa6:	89 c2                	mov    %eax,%edx
+  800aa8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aac:	83 c0 08             	add    $0x8,%eax
+  800aaf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab2:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800ab5:	48 85 c9             	test   %rcx,%rcx
+  800ab8:	48 b8 0e 13 80 00 00 	movabs $0x80130e,%rax
+  800abf:	00 00 00 
+  800ac2:	48 0f 45 c1          	cmovne %rcx,%rax
+  800ac6:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800aca:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800ace:	7e 06                	jle    800ad6 <vprintfmt+0x23d>
+  800ad0:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800ad4:	75 14                	jne    800aea <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ad6:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ada:	eb 64                	jmp    800b40 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800adc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae8:	eb c8                	jmp    800ab2 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800aea:	49 63 f7             	movslq %r15d,%rsi
+  800aed:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800af1:	48 b8 7c 0f 80 00 00 	movabs $0x800f7c,%rax
+  800af8:	00 00 00 
+  800afb:	ff d0                	call   *%rax
+  800afd:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800b00:	29 c1                	sub    %eax,%ecx
+  800b02:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800b05:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  800b08:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800b0c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b0f:	eb 0d                	jmp    800b1e <vprintfmt+0x285>
+					putch(padc, putdat);
+  800b11:	4c 89 ee             	mov    %r13,%rsi
+  800b14:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  800b17:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b1a:	41 83 ec 01          	sub    $0x1,%r12d
+  800b1e:	45 85 e4             	test   %r12d,%r12d
+  800b21:	7f ee                	jg     800b11 <vprintfmt+0x278>
+  800b23:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  800b26:	85 c9                	test   %ecx,%ecx
+  800b28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2d:	0f 49 c1             	cmovns %ecx,%eax
+  800b30:	29 c1                	sub    %eax,%ecx
+  800b32:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  800b35:	eb 9f                	jmp    800ad6 <vprintfmt+0x23d>
+					putch(ch, putdat);
+  800b37:	4c 89 ee             	mov    %r13,%rsi
+  800b3a:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b3d:	4c 89 e2             	mov    %r12,%rdx
+  800b40:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800b44:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800b4a:	0f be f8             	movsbl %al,%edi
+  800b4d:	85 ff                	test   %edi,%edi
+  800b4f:	74 29                	je     800b7a <vprintfmt+0x2e1>
+  800b51:	45 85 ff             	test   %r15d,%r15d
+  800b54:	78 06                	js     800b5c <vprintfmt+0x2c3>
+  800b56:	41 83 ef 01          	sub    $0x1,%r15d
+  800b5a:	78 1e                	js     800b7a <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b5c:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800b60:	74 d5                	je     800b37 <vprintfmt+0x29e>
+  800b62:	0f be c0             	movsbl %al,%eax
+  800b65:	83 e8 20             	sub    $0x20,%eax
+  800b68:	83 f8 5e             	cmp    $0x5e,%eax
+  800b6b:	76 ca                	jbe    800b37 <vprintfmt+0x29e>
+					putch('?', putdat);
+  800b6d:	4c 89 ee             	mov    %r13,%rsi
+  800b70:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b75:	41 ff d6             	call   *%r14
+  800b78:	eb c3                	jmp    800b3d <vprintfmt+0x2a4>
+  800b7a:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800b7e:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800b81:	41 01 c4             	add    %eax,%r12d
+  800b84:	41 29 d4             	sub    %edx,%r12d
+  800b87:	eb 0f                	jmp    800b98 <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  800b89:	4c 89 ee             	mov    %r13,%rsi
+  800b8c:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b91:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800b94:	41 83 ec 01          	sub    $0x1,%r12d
+  800b98:	45 85 e4             	test   %r12d,%r12d
+  800b9b:	7f ec                	jg     800b89 <vprintfmt+0x2f0>
+  800b9d:	e9 2c fd ff ff       	jmp    8008ce <vprintfmt+0x35>
+	if (lflag >= 2)
+  800ba2:	83 f9 01             	cmp    $0x1,%ecx
+  800ba5:	7f 1d                	jg     800bc4 <vprintfmt+0x32b>
+	else if (lflag)
+  800ba7:	85 c9                	test   %ecx,%ecx
+  800ba9:	74 5e                	je     800c09 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800bab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bae:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb1:	77 48                	ja     800bfb <vprintfmt+0x362>
+  800bb3:	89 c2                	mov    %eax,%edx
+  800bb5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb9:	83 c0 08             	add    $0x8,%eax
+  800bbc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bbf:	4c 8b 22             	mov    (%rdx),%r12
+  800bc2:	eb 17                	jmp    800bdb <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800bc4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc7:	83 f8 2f             	cmp    $0x2f,%eax
+  800bca:	77 21                	ja     800bed <vprintfmt+0x354>
+  800bcc:	89 c2                	mov    %eax,%edx
+  800bce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd2:	83 c0 08             	add    $0x8,%eax
+  800bd5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd8:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800bdb:	4d 85 e4             	test   %r12,%r12
+  800bde:	78 50                	js     800c30 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  800be0:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800be3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800be8:	e9 b4 01 00 00       	jmp    800da1 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800bed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf9:	eb dd                	jmp    800bd8 <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800bfb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c07:	eb b6                	jmp    800bbf <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800c09:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c0c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c0f:	77 11                	ja     800c22 <vprintfmt+0x389>
+  800c11:	89 c2                	mov    %eax,%edx
+  800c13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c17:	83 c0 08             	add    $0x8,%eax
+  800c1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c1d:	4c 63 22             	movslq (%rdx),%r12
+  800c20:	eb b9                	jmp    800bdb <vprintfmt+0x342>
+  800c22:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c26:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c2e:	eb ed                	jmp    800c1d <vprintfmt+0x384>
+				putch('-', putdat);
+  800c30:	4c 89 ee             	mov    %r13,%rsi
+  800c33:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c38:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800c3b:	4c 89 e2             	mov    %r12,%rdx
+  800c3e:	48 f7 da             	neg    %rdx
+			base = 10;
+  800c41:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800c46:	e9 56 01 00 00       	jmp    800da1 <vprintfmt+0x508>
+	if (lflag >= 2)
+  800c4b:	83 f9 01             	cmp    $0x1,%ecx
+  800c4e:	7f 25                	jg     800c75 <vprintfmt+0x3dc>
+	else if (lflag)
+  800c50:	85 c9                	test   %ecx,%ecx
+  800c52:	74 5e                	je     800cb2 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800c54:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c57:	83 f8 2f             	cmp    $0x2f,%eax
+  800c5a:	77 48                	ja     800ca4 <vprintfmt+0x40b>
+  800c5c:	89 c2                	mov    %eax,%edx
+  800c5e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c62:	83 c0 08             	add    $0x8,%eax
+  800c65:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c68:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800c6b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800c70:	e9 2c 01 00 00       	jmp    800da1 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800c75:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c78:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7b:	77 19                	ja     800c96 <vprintfmt+0x3fd>
+  800c7d:	89 c2                	mov    %eax,%edx
+  800c7f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c83:	83 c0 08             	add    $0x8,%eax
+  800c86:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c89:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800c8c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800c91:	e9 0b 01 00 00       	jmp    800da1 <vprintfmt+0x508>
+  800c96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca2:	eb e5                	jmp    800c89 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800ca4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb0:	eb b6                	jmp    800c68 <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800cb2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cb5:	83 f8 2f             	cmp    $0x2f,%eax
+  800cb8:	77 18                	ja     800cd2 <vprintfmt+0x439>
+  800cba:	89 c2                	mov    %eax,%edx
+  800cbc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cc0:	83 c0 08             	add    $0x8,%eax
+  800cc3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cc6:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800cc8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800ccd:	e9 cf 00 00 00       	jmp    800da1 <vprintfmt+0x508>
+  800cd2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cd6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cda:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cde:	eb e6                	jmp    800cc6 <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800ce0:	83 f9 01             	cmp    $0x1,%ecx
+  800ce3:	7f 25                	jg     800d0a <vprintfmt+0x471>
+	else if (lflag)
+  800ce5:	85 c9                	test   %ecx,%ecx
+  800ce7:	74 5b                	je     800d44 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800ce9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cec:	83 f8 2f             	cmp    $0x2f,%eax
+  800cef:	77 45                	ja     800d36 <vprintfmt+0x49d>
+  800cf1:	89 c2                	mov    %eax,%edx
+  800cf3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cf7:	83 c0 08             	add    $0x8,%eax
+  800cfa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cfd:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800d00:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800d05:	e9 97 00 00 00       	jmp    800da1 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800d0a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d0d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d10:	77 16                	ja     800d28 <vprintfmt+0x48f>
+  800d12:	89 c2                	mov    %eax,%edx
+  800d14:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d18:	83 c0 08             	add    $0x8,%eax
+  800d1b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d1e:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800d21:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800d26:	eb 79                	jmp    800da1 <vprintfmt+0x508>
+  800d28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d34:	eb e8                	jmp    800d1e <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800d36:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d3a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d3e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d42:	eb b9                	jmp    800cfd <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800d44:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d47:	83 f8 2f             	cmp    $0x2f,%eax
+  800d4a:	77 15                	ja     800d61 <vprintfmt+0x4c8>
+  800d4c:	89 c2                	mov    %eax,%edx
+  800d4e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d52:	83 c0 08             	add    $0x8,%eax
+  800d55:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d58:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800d5a:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800d5f:	eb 40                	jmp    800da1 <vprintfmt+0x508>
+  800d61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d6d:	eb e9                	jmp    800d58 <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800d6f:	4c 89 ee             	mov    %r13,%rsi
+  800d72:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d77:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800d7a:	4c 89 ee             	mov    %r13,%rsi
+  800d7d:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d82:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800d85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d88:	83 f8 2f             	cmp    $0x2f,%eax
+  800d8b:	77 34                	ja     800dc1 <vprintfmt+0x528>
+  800d8d:	89 c2                	mov    %eax,%edx
+  800d8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d93:	83 c0 08             	add    $0x8,%eax
+  800d96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800d99:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800d9c:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800da1:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800da6:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800daa:	4c 89 ee             	mov    %r13,%rsi
+  800dad:	4c 89 f7             	mov    %r14,%rdi
+  800db0:	48 b8 73 07 80 00 00 	movabs $0x800773,%rax
+  800db7:	00 00 00 
+  800dba:	ff d0                	call   *%rax
+			break;
+  800dbc:	e9 0d fb ff ff       	jmp    8008ce <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800dc1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dc5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dc9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dcd:	eb ca                	jmp    800d99 <vprintfmt+0x500>
+	if (lflag >= 2)
+  800dcf:	83 f9 01             	cmp    $0x1,%ecx
+  800dd2:	7f 22                	jg     800df6 <vprintfmt+0x55d>
+	else if (lflag)
+  800dd4:	85 c9                	test   %ecx,%ecx
+  800dd6:	74 58                	je     800e30 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800dd8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ddb:	83 f8 2f             	cmp    $0x2f,%eax
+  800dde:	77 42                	ja     800e22 <vprintfmt+0x589>
+  800de0:	89 c2                	mov    %eax,%edx
+  800de2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800de6:	83 c0 08             	add    $0x8,%eax
+  800de9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dec:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800def:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800df4:	eb ab                	jmp    800da1 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800df6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800df9:	83 f8 2f             	cmp    $0x2f,%eax
+  800dfc:	77 16                	ja     800e14 <vprintfmt+0x57b>
+  800dfe:	89 c2                	mov    %eax,%edx
+  800e00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e04:	83 c0 08             	add    $0x8,%eax
+  800e07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e0a:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800e0d:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800e12:	eb 8d                	jmp    800da1 <vprintfmt+0x508>
+  800e14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e20:	eb e8                	jmp    800e0a <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800e22:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e26:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e2e:	eb bc                	jmp    800dec <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800e30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e33:	83 f8 2f             	cmp    $0x2f,%eax
+  800e36:	77 18                	ja     800e50 <vprintfmt+0x5b7>
+  800e38:	89 c2                	mov    %eax,%edx
+  800e3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e3e:	83 c0 08             	add    $0x8,%eax
+  800e41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e44:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800e46:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800e4b:	e9 51 ff ff ff       	jmp    800da1 <vprintfmt+0x508>
+  800e50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e5c:	eb e6                	jmp    800e44 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800e5e:	4c 89 ee             	mov    %r13,%rsi
+  800e61:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e66:	41 ff d6             	call   *%r14
+			break;
+  800e69:	e9 60 fa ff ff       	jmp    8008ce <vprintfmt+0x35>
+			putch('%', putdat);
+  800e6e:	4c 89 ee             	mov    %r13,%rsi
+  800e71:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e76:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800e79:	4c 89 e3             	mov    %r12,%rbx
+  800e7c:	eb 04                	jmp    800e82 <vprintfmt+0x5e9>
+  800e7e:	48 83 eb 01          	sub    $0x1,%rbx
+  800e82:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e86:	75 f6                	jne    800e7e <vprintfmt+0x5e5>
+  800e88:	e9 41 fa ff ff       	jmp    8008ce <vprintfmt+0x35>
+
+0000000000800e8d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800e8d:	55                   	push   %rbp
+  800e8e:	48 89 e5             	mov    %rsp,%rbp
+  800e91:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800e95:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800e99:	48 63 c6             	movslq %esi,%rax
+  800e9c:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800ea1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800ea5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800eac:	48 85 ff             	test   %rdi,%rdi
+  800eaf:	74 2a                	je     800edb <vsnprintf+0x4e>
+  800eb1:	85 f6                	test   %esi,%esi
+  800eb3:	7e 26                	jle    800edb <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800eb5:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800eb9:	48 bf fb 07 80 00 00 	movabs $0x8007fb,%rdi
+  800ec0:	00 00 00 
+  800ec3:	48 b8 99 08 80 00 00 	movabs $0x800899,%rax
+  800eca:	00 00 00 
+  800ecd:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ecf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800ed3:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800ed6:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800ed9:	c9                   	leave
+  800eda:	c3                   	ret
+		return -E_INVAL;
+  800edb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ee0:	eb f7                	jmp    800ed9 <vsnprintf+0x4c>
+
+0000000000800ee2 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800ee2:	55                   	push   %rbp
+  800ee3:	48 89 e5             	mov    %rsp,%rbp
+  800ee6:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800eed:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800ef4:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800efb:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f02:	84 c0                	test   %al,%al
+  800f04:	74 20                	je     800f26 <snprintf+0x44>
+  800f06:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f0a:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f0e:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f12:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f16:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f1a:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f1e:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f22:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800f26:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f2d:	00 00 00 
+  800f30:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f37:	00 00 00 
+  800f3a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f3e:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800f45:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f4c:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800f53:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800f5a:	48 b8 8d 0e 80 00 00 	movabs $0x800e8d,%rax
+  800f61:	00 00 00 
+  800f64:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800f66:	c9                   	leave
+  800f67:	c3                   	ret
+
+0000000000800f68 <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800f68:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6d:	48 89 d0             	mov    %rdx,%rax
+  800f70:	48 83 c2 01          	add    $0x1,%rdx
+  800f74:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800f79:	75 f2                	jne    800f6d <strlen+0x5>
+		n++;
+	return n;
+}
+  800f7b:	c3                   	ret
+
+0000000000800f7c <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f81:	eb 03                	jmp    800f86 <strnlen+0xa>
+  800f83:	48 89 d0             	mov    %rdx,%rax
+  800f86:	48 39 c6             	cmp    %rax,%rsi
+  800f89:	74 0a                	je     800f95 <strnlen+0x19>
+  800f8b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800f8f:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800f93:	75 ee                	jne    800f83 <strnlen+0x7>
+		n++;
+	return n;
+}
+  800f95:	c3                   	ret
+
+0000000000800f96 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800f96:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800f99:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f9e:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800fa2:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800fa5:	48 83 c2 01          	add    $0x1,%rdx
+  800fa9:	84 c9                	test   %cl,%cl
+  800fab:	75 f1                	jne    800f9e <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800fad:	c3                   	ret
+
+0000000000800fae <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800fae:	55                   	push   %rbp
+  800faf:	48 89 e5             	mov    %rsp,%rbp
+  800fb2:	41 54                	push   %r12
+  800fb4:	53                   	push   %rbx
+  800fb5:	48 89 fb             	mov    %rdi,%rbx
+  800fb8:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800fbb:	48 b8 68 0f 80 00 00 	movabs $0x800f68,%rax
+  800fc2:	00 00 00 
+  800fc5:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800fc7:	48 63 f8             	movslq %eax,%rdi
+  800fca:	48 01 df             	add    %rbx,%rdi
+  800fcd:	4c 89 e6             	mov    %r12,%rsi
+  800fd0:	48 b8 96 0f 80 00 00 	movabs $0x800f96,%rax
+  800fd7:	00 00 00 
+  800fda:	ff d0                	call   *%rax
+	return dst;
+}
+  800fdc:	48 89 d8             	mov    %rbx,%rax
+  800fdf:	5b                   	pop    %rbx
+  800fe0:	41 5c                	pop    %r12
+  800fe2:	5d                   	pop    %rbp
+  800fe3:	c3                   	ret
+
+0000000000800fe4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800fe4:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800fe7:	48 01 fa             	add    %rdi,%rdx
+  800fea:	48 89 f9             	mov    %rdi,%rcx
+  800fed:	eb 14                	jmp    801003 <strncpy+0x1f>
+		*dst++ = *src;
+  800fef:	48 83 c1 01          	add    $0x1,%rcx
+  800ff3:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ff7:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ffb:	41 80 f8 01          	cmp    $0x1,%r8b
+  800fff:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  801003:	48 39 d1             	cmp    %rdx,%rcx
+  801006:	75 e7                	jne    800fef <strncpy+0xb>
+	}
+	return ret;
+}
+  801008:	c3                   	ret
+
+0000000000801009 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801009:	48 89 f8             	mov    %rdi,%rax
+  80100c:	48 85 d2             	test   %rdx,%rdx
+  80100f:	74 27                	je     801038 <strlcpy+0x2f>
+  801011:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  801016:	48 89 fa             	mov    %rdi,%rdx
+  801019:	eb 0b                	jmp    801026 <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80101b:	48 83 c6 01          	add    $0x1,%rsi
+  80101f:	48 83 c2 01          	add    $0x1,%rdx
+  801023:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  801026:	48 39 c2             	cmp    %rax,%rdx
+  801029:	74 0a                	je     801035 <strlcpy+0x2c>
+  80102b:	0f b6 0e             	movzbl (%rsi),%ecx
+  80102e:	84 c9                	test   %cl,%cl
+  801030:	75 e9                	jne    80101b <strlcpy+0x12>
+  801032:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  801035:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801038:	48 29 f8             	sub    %rdi,%rax
+}
+  80103b:	c3                   	ret
+
+000000000080103c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  80103c:	eb 08                	jmp    801046 <strcmp+0xa>
+		p++, q++;
+  80103e:	48 83 c7 01          	add    $0x1,%rdi
+  801042:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  801046:	0f b6 07             	movzbl (%rdi),%eax
+  801049:	84 c0                	test   %al,%al
+  80104b:	74 04                	je     801051 <strcmp+0x15>
+  80104d:	3a 06                	cmp    (%rsi),%al
+  80104f:	74 ed                	je     80103e <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801051:	0f b6 c0             	movzbl %al,%eax
+  801054:	0f b6 16             	movzbl (%rsi),%edx
+  801057:	29 d0                	sub    %edx,%eax
+}
+  801059:	c3                   	ret
+
+000000000080105a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  80105a:	eb 0c                	jmp    801068 <strncmp+0xe>
+		n--, p++, q++;
+  80105c:	48 83 ea 01          	sub    $0x1,%rdx
+  801060:	48 83 c7 01          	add    $0x1,%rdi
+  801064:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  801068:	48 85 d2             	test   %rdx,%rdx
+  80106b:	74 14                	je     801081 <strncmp+0x27>
+  80106d:	0f b6 07             	movzbl (%rdi),%eax
+  801070:	84 c0                	test   %al,%al
+  801072:	74 04                	je     801078 <strncmp+0x1e>
+  801074:	3a 06                	cmp    (%rsi),%al
+  801076:	74 e4                	je     80105c <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801078:	0f b6 07             	movzbl (%rdi),%eax
+  80107b:	0f b6 16             	movzbl (%rsi),%edx
+  80107e:	29 d0                	sub    %edx,%eax
+}
+  801080:	c3                   	ret
+		return 0;
+  801081:	b8 00 00 00 00       	mov    $0x0,%eax
+  801086:	c3                   	ret
+
+0000000000801087 <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  801087:	eb 04                	jmp    80108d <strchr+0x6>
+  801089:	48 83 c7 01          	add    $0x1,%rdi
+  80108d:	0f b6 07             	movzbl (%rdi),%eax
+  801090:	84 c0                	test   %al,%al
+  801092:	74 09                	je     80109d <strchr+0x16>
+		if (*s == c)
+  801094:	40 38 f0             	cmp    %sil,%al
+  801097:	75 f0                	jne    801089 <strchr+0x2>
+  801099:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  80109c:	c3                   	ret
+	return 0;
+  80109d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a2:	c3                   	ret
+
+00000000008010a3 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8010a3:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  8010a6:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  8010a9:	40 38 f2             	cmp    %sil,%dl
+  8010ac:	74 0a                	je     8010b8 <strfind+0x15>
+  8010ae:	84 d2                	test   %dl,%dl
+  8010b0:	74 06                	je     8010b8 <strfind+0x15>
+	for (; *s; s++)
+  8010b2:	48 83 c0 01          	add    $0x1,%rax
+  8010b6:	eb ee                	jmp    8010a6 <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  8010b8:	c3                   	ret
+
+00000000008010b9 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  8010b9:	48 85 d2             	test   %rdx,%rdx
+  8010bc:	74 28                	je     8010e6 <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  8010be:	48 89 f8             	mov    %rdi,%rax
+  8010c1:	48 09 d0             	or     %rdx,%rax
+  8010c4:	a8 03                	test   $0x3,%al
+  8010c6:	75 16                	jne    8010de <memset+0x25>
+		c &= 0xFF;
+  8010c8:	40 0f b6 f6          	movzbl %sil,%esi
+  8010cc:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8010d2:	48 89 d1             	mov    %rdx,%rcx
+  8010d5:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  8010d9:	fc                   	cld
+  8010da:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8010dc:	eb 08                	jmp    8010e6 <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8010de:	89 f0                	mov    %esi,%eax
+  8010e0:	48 89 d1             	mov    %rdx,%rcx
+  8010e3:	fc                   	cld
+  8010e4:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8010e6:	48 89 f8             	mov    %rdi,%rax
+  8010e9:	c3                   	ret
+
+00000000008010ea <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8010ea:	48 89 f8             	mov    %rdi,%rax
+  8010ed:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8010f0:	48 39 fe             	cmp    %rdi,%rsi
+  8010f3:	73 3a                	jae    80112f <memmove+0x45>
+  8010f5:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010f9:	48 39 d7             	cmp    %rdx,%rdi
+  8010fc:	73 31                	jae    80112f <memmove+0x45>
+		s += n;
+		d += n;
+  8010fe:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  801102:	48 89 d6             	mov    %rdx,%rsi
+  801105:	48 09 fe             	or     %rdi,%rsi
+  801108:	48 09 ce             	or     %rcx,%rsi
+  80110b:	40 f6 c6 03          	test   $0x3,%sil
+  80110f:	75 11                	jne    801122 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801111:	48 83 ef 04          	sub    $0x4,%rdi
+  801115:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  801119:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  80111d:	fd                   	std
+  80111e:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801120:	eb 0b                	jmp    80112d <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801122:	48 83 ef 01          	sub    $0x1,%rdi
+  801126:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  80112a:	fd                   	std
+  80112b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80112d:	fc                   	cld
+  80112e:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  80112f:	48 89 f2             	mov    %rsi,%rdx
+  801132:	48 09 c2             	or     %rax,%rdx
+  801135:	48 09 ca             	or     %rcx,%rdx
+  801138:	f6 c2 03             	test   $0x3,%dl
+  80113b:	75 0b                	jne    801148 <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80113d:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  801141:	48 89 c7             	mov    %rax,%rdi
+  801144:	fc                   	cld
+  801145:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801147:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  801148:	48 89 c7             	mov    %rax,%rdi
+  80114b:	fc                   	cld
+  80114c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80114e:	c3                   	ret
+
+000000000080114f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80114f:	55                   	push   %rbp
+  801150:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  801153:	48 b8 ea 10 80 00 00 	movabs $0x8010ea,%rax
+  80115a:	00 00 00 
+  80115d:	ff d0                	call   *%rax
+}
+  80115f:	5d                   	pop    %rbp
+  801160:	c3                   	ret
+
+0000000000801161 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801161:	b8 00 00 00 00       	mov    $0x0,%eax
+  801166:	48 39 c2             	cmp    %rax,%rdx
+  801169:	74 1e                	je     801189 <memcmp+0x28>
+		if (*s1 != *s2)
+  80116b:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80116f:	48 83 c0 01          	add    $0x1,%rax
+  801173:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  801179:	44 38 c1             	cmp    %r8b,%cl
+  80117c:	74 e8                	je     801166 <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  80117e:	0f b6 c1             	movzbl %cl,%eax
+  801181:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801185:	44 29 c0             	sub    %r8d,%eax
+  801188:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  801189:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80118e:	c3                   	ret
+
+000000000080118f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80118f:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  801192:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  801195:	eb 04                	jmp    80119b <memfind+0xc>
+  801197:	48 83 c0 01          	add    $0x1,%rax
+  80119b:	48 39 d0             	cmp    %rdx,%rax
+  80119e:	73 05                	jae    8011a5 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8011a0:	40 38 30             	cmp    %sil,(%rax)
+  8011a3:	75 f2                	jne    801197 <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  8011a5:	c3                   	ret
+
+00000000008011a6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8011a6:	48 89 f9             	mov    %rdi,%rcx
+  8011a9:	49 89 f0             	mov    %rsi,%r8
+  8011ac:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8011ae:	eb 04                	jmp    8011b4 <strtol+0xe>
+		s++;
+  8011b0:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  8011b4:	0f b6 01             	movzbl (%rcx),%eax
+  8011b7:	3c 20                	cmp    $0x20,%al
+  8011b9:	74 f5                	je     8011b0 <strtol+0xa>
+  8011bb:	3c 09                	cmp    $0x9,%al
+  8011bd:	74 f1                	je     8011b0 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  8011bf:	3c 2b                	cmp    $0x2b,%al
+  8011c1:	74 2b                	je     8011ee <strtol+0x48>
+	int neg = 0;
+  8011c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  8011c9:	3c 2d                	cmp    $0x2d,%al
+  8011cb:	74 2d                	je     8011fa <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011cd:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  8011d3:	75 0f                	jne    8011e4 <strtol+0x3e>
+  8011d5:	80 39 30             	cmpb   $0x30,(%rcx)
+  8011d8:	74 2c                	je     801206 <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8011da:	85 ff                	test   %edi,%edi
+  8011dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011e1:	0f 44 f8             	cmove  %eax,%edi
+  8011e4:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  8011e9:	4c 63 d7             	movslq %edi,%r10
+  8011ec:	eb 4f                	jmp    80123d <strtol+0x97>
+		s++;
+  8011ee:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  8011f2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8011f8:	eb d3                	jmp    8011cd <strtol+0x27>
+		s++, neg = 1;
+  8011fa:	48 83 c1 01          	add    $0x1,%rcx
+  8011fe:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  801204:	eb c7                	jmp    8011cd <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801206:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  80120a:	74 0f                	je     80121b <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  80120c:	85 ff                	test   %edi,%edi
+  80120e:	75 d4                	jne    8011e4 <strtol+0x3e>
+		s++, base = 8;
+  801210:	48 83 c1 01          	add    $0x1,%rcx
+  801214:	bf 08 00 00 00       	mov    $0x8,%edi
+  801219:	eb c9                	jmp    8011e4 <strtol+0x3e>
+		s += 2, base = 16;
+  80121b:	48 83 c1 02          	add    $0x2,%rcx
+  80121f:	bf 10 00 00 00       	mov    $0x10,%edi
+  801224:	eb be                	jmp    8011e4 <strtol+0x3e>
+			dig = *s - '0';
+  801226:	0f be c0             	movsbl %al,%eax
+  801229:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  80122c:	39 f8                	cmp    %edi,%eax
+  80122e:	7d 3b                	jge    80126b <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  801230:	48 83 c1 01          	add    $0x1,%rcx
+  801234:	49 0f af d2          	imul   %r10,%rdx
+  801238:	48 98                	cltq
+  80123a:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  80123d:	0f b6 01             	movzbl (%rcx),%eax
+  801240:	8d 70 d0             	lea    -0x30(%rax),%esi
+  801243:	40 80 fe 09          	cmp    $0x9,%sil
+  801247:	76 dd                	jbe    801226 <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  801249:	8d 70 9f             	lea    -0x61(%rax),%esi
+  80124c:	40 80 fe 19          	cmp    $0x19,%sil
+  801250:	77 08                	ja     80125a <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  801252:	0f be c0             	movsbl %al,%eax
+  801255:	83 e8 57             	sub    $0x57,%eax
+  801258:	eb d2                	jmp    80122c <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  80125a:	8d 70 bf             	lea    -0x41(%rax),%esi
+  80125d:	40 80 fe 19          	cmp    $0x19,%sil
+  801261:	77 08                	ja     80126b <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  801263:	0f be c0             	movsbl %al,%eax
+  801266:	83 e8 37             	sub    $0x37,%eax
+  801269:	eb c1                	jmp    80122c <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80126b:	4d 85 c0             	test   %r8,%r8
+  80126e:	74 03                	je     801273 <strtol+0xcd>
+		*endptr = (char *) s;
+  801270:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  801273:	48 89 d0             	mov    %rdx,%rax
+  801276:	48 f7 d8             	neg    %rax
+  801279:	45 85 c9             	test   %r9d,%r9d
+  80127c:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  801280:	48 89 d0             	mov    %rdx,%rax
+  801283:	c3                   	ret
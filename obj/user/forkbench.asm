@@ -0,0 +1,3275 @@
+
+obj/user/forkbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 e6 01 00 00       	call   800217 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <bench>:
+
+static char buf[NPAGES * PGSIZE] __attribute__((aligned(PGSIZE)));
+
+static uint64_t
+bench(const char *name, envid_t (*forkfn)(void))
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	41 57                	push   %r15
+  800039:	41 56                	push   %r14
+  80003b:	41 55                	push   %r13
+  80003d:	41 54                	push   %r12
+  80003f:	53                   	push   %rbx
+  800040:	48 83 ec 18          	sub    $0x18,%rsp
+  800044:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  800048:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	uint64_t start, total = 0;
+	envid_t who;
+	int i;
+
+	for (i = 0; i < NFORKS; i++) {
+  80004c:	41 be 0b 00 00 00    	mov    $0xb,%r14d
+	uint64_t start, total = 0;
+  800052:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			panic("%s: %e", name, who);
+		if (who == 0)
+			exit();
+		total += read_tsc() - start;
+		while (envs[ENVX(who)].env_status != ENV_FREE)
+			sys_yield();
+  800058:	49 bc 61 10 80 00 00 	movabs $0x801061,%r12
+  80005f:	00 00 00 
+	for (i = 0; i < NFORKS; i++) {
+  800062:	eb 4d                	jmp    8000b1 <bench+0x7e>
+			panic("%s: %e", name, who);
+  800064:	41 89 c0             	mov    %eax,%r8d
+  800067:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80006b:	48 ba 60 1d 80 00 00 	movabs $0x801d60,%rdx
+  800072:	00 00 00 
+  800075:	be 16 00 00 00       	mov    $0x16,%esi
+  80007a:	48 bf 67 1d 80 00 00 	movabs $0x801d67,%rdi
+  800081:	00 00 00 
+  800084:	b8 00 00 00 00       	mov    $0x0,%eax
+  800089:	49 b9 5d 02 80 00 00 	movabs $0x80025d,%r9
+  800090:	00 00 00 
+  800093:	41 ff d1             	call   *%r9
+			exit();
+  800096:	48 b8 46 02 80 00 00 	movabs $0x800246,%rax
+  80009d:	00 00 00 
+  8000a0:	ff d0                	call   *%rax
+  8000a2:	eb 2f                	jmp    8000d3 <bench+0xa0>
+			sys_yield();
+  8000a4:	41 ff d4             	call   *%r12
+		while (envs[ENVX(who)].env_status != ENV_FREE)
+  8000a7:	8b 83 c4 00 00 00    	mov    0xc4(%rbx),%eax
+  8000ad:	85 c0                	test   %eax,%eax
+  8000af:	75 f3                	jne    8000a4 <bench+0x71>
+	for (i = 0; i < NFORKS; i++) {
+  8000b1:	41 83 ee 01          	sub    $0x1,%r14d
+  8000b5:	74 4e                	je     800105 <bench+0xd2>
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint32_t lo, hi;
+	asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  8000b7:	0f 31                	rdtsc
+	return ((uint64_t) hi << 32) | lo;
+  8000b9:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000bd:	89 c0                	mov    %eax,%eax
+  8000bf:	48 09 c2             	or     %rax,%rdx
+  8000c2:	49 89 d5             	mov    %rdx,%r13
+		if ((who = forkfn()) < 0)
+  8000c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8000c9:	ff d0                	call   *%rax
+  8000cb:	89 c3                	mov    %eax,%ebx
+  8000cd:	85 c0                	test   %eax,%eax
+  8000cf:	78 93                	js     800064 <bench+0x31>
+		if (who == 0)
+  8000d1:	74 c3                	je     800096 <bench+0x63>
+	asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  8000d3:	0f 31                	rdtsc
+	return ((uint64_t) hi << 32) | lo;
+  8000d5:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000d9:	89 c0                	mov    %eax,%eax
+  8000db:	48 09 c2             	or     %rax,%rdx
+		total += read_tsc() - start;
+  8000de:	4c 29 ea             	sub    %r13,%rdx
+  8000e1:	49 01 d7             	add    %rdx,%r15
+		while (envs[ENVX(who)].env_status != ENV_FREE)
+  8000e4:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8000ea:	48 8d 04 db          	lea    (%rbx,%rbx,8),%rax
+  8000ee:	48 8d 1c 43          	lea    (%rbx,%rax,2),%rbx
+  8000f2:	48 c1 e3 04          	shl    $0x4,%rbx
+  8000f6:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  8000fd:	00 00 00 
+  800100:	48 01 c3             	add    %rax,%rbx
+  800103:	eb a2                	jmp    8000a7 <bench+0x74>
+	}
+	cprintf("forkbench: %s: %ld cycles per fork\n", name, total / NFORKS);
+  800105:	48 ba cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rdx
+  80010c:	cc cc cc 
+  80010f:	4c 89 f8             	mov    %r15,%rax
+  800112:	48 f7 e2             	mul    %rdx
+  800115:	49 89 d7             	mov    %rdx,%r15
+  800118:	49 c1 ef 03          	shr    $0x3,%r15
+  80011c:	4c 89 fa             	mov    %r15,%rdx
+  80011f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  800123:	48 bf 80 1d 80 00 00 	movabs $0x801d80,%rdi
+  80012a:	00 00 00 
+  80012d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800132:	48 b9 fc 03 80 00 00 	movabs $0x8003fc,%rcx
+  800139:	00 00 00 
+  80013c:	ff d1                	call   *%rcx
+	return total / NFORKS;
+}
+  80013e:	4c 89 f8             	mov    %r15,%rax
+  800141:	48 83 c4 18          	add    $0x18,%rsp
+  800145:	5b                   	pop    %rbx
+  800146:	41 5c                	pop    %r12
+  800148:	41 5d                	pop    %r13
+  80014a:	41 5e                	pop    %r14
+  80014c:	41 5f                	pop    %r15
+  80014e:	5d                   	pop    %rbp
+  80014f:	c3                   	ret
+
+0000000000800150 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800150:	55                   	push   %rbp
+  800151:	48 89 e5             	mov    %rsp,%rbp
+  800154:	41 54                	push   %r12
+  800156:	53                   	push   %rbx
+	uint64_t k, u;
+	int i;
+
+	// touch every page so there is something to copy
+	for (i = 0; i < NPAGES; i++)
+  800157:	b8 01 01 00 00       	mov    $0x101,%eax
+  80015c:	83 e8 01             	sub    $0x1,%eax
+  80015f:	75 fb                	jne    80015c <umain+0xc>
+		buf[i * PGSIZE] = i;
+
+	u = bench("ufork", ufork);
+  800161:	48 be 2e 17 80 00 00 	movabs $0x80172e,%rsi
+  800168:	00 00 00 
+  80016b:	48 bf 78 1d 80 00 00 	movabs $0x801d78,%rdi
+  800172:	00 00 00 
+  800175:	49 bc 33 00 80 00 00 	movabs $0x800033,%r12
+  80017c:	00 00 00 
+  80017f:	41 ff d4             	call   *%r12
+  800182:	48 89 c3             	mov    %rax,%rbx
+	k = bench("fork", fork);
+  800185:	48 be 06 17 80 00 00 	movabs $0x801706,%rsi
+  80018c:	00 00 00 
+  80018f:	48 bf 79 1d 80 00 00 	movabs $0x801d79,%rdi
+  800196:	00 00 00 
+  800199:	41 ff d4             	call   *%r12
+  80019c:	48 89 c6             	mov    %rax,%rsi
+	cprintf("forkbench: fork is %ld.%02ldx as fast as ufork\n",
+		u / k, (u * 100 / k) % 100);
+  80019f:	48 8d 04 9b          	lea    (%rbx,%rbx,4),%rax
+  8001a3:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  8001a7:	48 c1 e0 02          	shl    $0x2,%rax
+  8001ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001b0:	48 f7 f6             	div    %rsi
+  8001b3:	48 89 c1             	mov    %rax,%rcx
+	cprintf("forkbench: fork is %ld.%02ldx as fast as ufork\n",
+  8001b6:	48 89 c2             	mov    %rax,%rdx
+  8001b9:	48 c1 ea 02          	shr    $0x2,%rdx
+  8001bd:	48 bf c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rdi
+  8001c4:	c2 f5 28 
+  8001c7:	48 89 d0             	mov    %rdx,%rax
+  8001ca:	48 f7 e7             	mul    %rdi
+  8001cd:	48 89 d0             	mov    %rdx,%rax
+  8001d0:	48 c1 e8 02          	shr    $0x2,%rax
+  8001d4:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  8001d8:	48 01 c2             	add    %rax,%rdx
+  8001db:	48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+  8001df:	48 c1 e0 02          	shl    $0x2,%rax
+  8001e3:	48 29 c1             	sub    %rax,%rcx
+  8001e6:	48 89 d8             	mov    %rbx,%rax
+  8001e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001ee:	48 f7 f6             	div    %rsi
+  8001f1:	48 89 c6             	mov    %rax,%rsi
+  8001f4:	48 89 ca             	mov    %rcx,%rdx
+  8001f7:	48 bf a8 1d 80 00 00 	movabs $0x801da8,%rdi
+  8001fe:	00 00 00 
+  800201:	b8 00 00 00 00       	mov    $0x0,%eax
+  800206:	48 b9 fc 03 80 00 00 	movabs $0x8003fc,%rcx
+  80020d:	00 00 00 
+  800210:	ff d1                	call   *%rcx
+}
+  800212:	5b                   	pop    %rbx
+  800213:	41 5c                	pop    %r12
+  800215:	5d                   	pop    %rbp
+  800216:	c3                   	ret
+
+0000000000800217 <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  800217:	55                   	push   %rbp
+  800218:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80021b:	85 ff                	test   %edi,%edi
+  80021d:	7e 0d                	jle    80022c <libmain+0x15>
+		binaryname = argv[0];
+  80021f:	48 8b 06             	mov    (%rsi),%rax
+  800222:	48 a3 00 30 80 00 00 	movabs %rax,0x803000
+  800229:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  80022c:	48 b8 50 01 80 00 00 	movabs $0x800150,%rax
+  800233:	00 00 00 
+  800236:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800238:	48 b8 46 02 80 00 00 	movabs $0x800246,%rax
+  80023f:	00 00 00 
+  800242:	ff d0                	call   *%rax
+}
+  800244:	5d                   	pop    %rbp
+  800245:	c3                   	ret
+
+0000000000800246 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800246:	55                   	push   %rbp
+  800247:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  80024a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80024f:	48 b8 d9 0f 80 00 00 	movabs $0x800fd9,%rax
+  800256:	00 00 00 
+  800259:	ff d0                	call   *%rax
+}
+  80025b:	5d                   	pop    %rbp
+  80025c:	c3                   	ret
+
+000000000080025d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80025d:	55                   	push   %rbp
+  80025e:	48 89 e5             	mov    %rsp,%rbp
+  800261:	41 56                	push   %r14
+  800263:	41 55                	push   %r13
+  800265:	41 54                	push   %r12
+  800267:	53                   	push   %rbx
+  800268:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80026f:	49 89 fc             	mov    %rdi,%r12
+  800272:	41 89 f5             	mov    %esi,%r13d
+  800275:	48 89 d3             	mov    %rdx,%rbx
+  800278:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80027f:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800286:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  80028d:	84 c0                	test   %al,%al
+  80028f:	74 26                	je     8002b7 <_panic+0x5a>
+  800291:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800298:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80029f:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8002a3:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8002a7:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8002ab:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8002af:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8002b3:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002b7:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8002be:	00 00 00 
+  8002c1:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8002c8:	00 00 00 
+  8002cb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002cf:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8002d6:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8002dd:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002e4:	48 b8 00 30 80 00 00 	movabs $0x803000,%rax
+  8002eb:	00 00 00 
+  8002ee:	4c 8b 30             	mov    (%rax),%r14
+  8002f1:	48 b8 34 10 80 00 00 	movabs $0x801034,%rax
+  8002f8:	00 00 00 
+  8002fb:	ff d0                	call   *%rax
+  8002fd:	89 c6                	mov    %eax,%esi
+  8002ff:	45 89 e8             	mov    %r13d,%r8d
+  800302:	4c 89 e1             	mov    %r12,%rcx
+  800305:	4c 89 f2             	mov    %r14,%rdx
+  800308:	48 bf e8 1d 80 00 00 	movabs $0x801de8,%rdi
+  80030f:	00 00 00 
+  800312:	b8 00 00 00 00       	mov    $0x0,%eax
+  800317:	49 bc fc 03 80 00 00 	movabs $0x8003fc,%r12
+  80031e:	00 00 00 
+  800321:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800324:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  80032b:	48 89 df             	mov    %rbx,%rdi
+  80032e:	48 b8 98 03 80 00 00 	movabs $0x800398,%rax
+  800335:	00 00 00 
+  800338:	ff d0                	call   *%rax
+	cprintf("\n");
+  80033a:	48 bf 0b 1e 80 00 00 	movabs $0x801e0b,%rdi
+  800341:	00 00 00 
+  800344:	b8 00 00 00 00       	mov    $0x0,%eax
+  800349:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80034c:	cc                   	int3
+	while (1)
+  80034d:	eb fd                	jmp    80034c <_panic+0xef>
+
+000000000080034f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80034f:	55                   	push   %rbp
+  800350:	48 89 e5             	mov    %rsp,%rbp
+  800353:	53                   	push   %rbx
+  800354:	48 83 ec 08          	sub    $0x8,%rsp
+  800358:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  80035b:	8b 06                	mov    (%rsi),%eax
+  80035d:	8d 50 01             	lea    0x1(%rax),%edx
+  800360:	89 16                	mov    %edx,(%rsi)
+  800362:	48 98                	cltq
+  800364:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  800369:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80036f:	74 0a                	je     80037b <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800371:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800375:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800379:	c9                   	leave
+  80037a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80037b:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80037f:	be ff 00 00 00       	mov    $0xff,%esi
+  800384:	48 b8 a1 0f 80 00 00 	movabs $0x800fa1,%rax
+  80038b:	00 00 00 
+  80038e:	ff d0                	call   *%rax
+		b->idx = 0;
+  800390:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800396:	eb d9                	jmp    800371 <putch+0x22>
+
+0000000000800398 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800398:	55                   	push   %rbp
+  800399:	48 89 e5             	mov    %rsp,%rbp
+  80039c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8003a3:	48 89 fa             	mov    %rdi,%rdx
+  8003a6:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  8003a9:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8003b0:	00 00 00 
+	b.cnt = 0;
+  8003b3:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8003ba:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8003bd:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  8003c4:	48 bf 4f 03 80 00 00 	movabs $0x80034f,%rdi
+  8003cb:	00 00 00 
+  8003ce:	48 b8 b6 05 80 00 00 	movabs $0x8005b6,%rax
+  8003d5:	00 00 00 
+  8003d8:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8003da:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  8003e1:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8003e8:	48 b8 a1 0f 80 00 00 	movabs $0x800fa1,%rax
+  8003ef:	00 00 00 
+  8003f2:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  8003f4:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  8003fa:	c9                   	leave
+  8003fb:	c3                   	ret
+
+00000000008003fc <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8003fc:	55                   	push   %rbp
+  8003fd:	48 89 e5             	mov    %rsp,%rbp
+  800400:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800407:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80040e:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800415:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80041c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800423:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80042a:	84 c0                	test   %al,%al
+  80042c:	74 20                	je     80044e <cprintf+0x52>
+  80042e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800432:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800436:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80043a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80043e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800442:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800446:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80044a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80044e:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  800455:	00 00 00 
+  800458:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80045f:	00 00 00 
+  800462:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800466:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80046d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800474:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  80047b:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  800482:	48 b8 98 03 80 00 00 	movabs $0x800398,%rax
+  800489:	00 00 00 
+  80048c:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  80048e:	c9                   	leave
+  80048f:	c3                   	ret
+
+0000000000800490 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800490:	55                   	push   %rbp
+  800491:	48 89 e5             	mov    %rsp,%rbp
+  800494:	41 57                	push   %r15
+  800496:	41 56                	push   %r14
+  800498:	41 55                	push   %r13
+  80049a:	41 54                	push   %r12
+  80049c:	53                   	push   %rbx
+  80049d:	48 83 ec 18          	sub    $0x18,%rsp
+  8004a1:	49 89 fc             	mov    %rdi,%r12
+  8004a4:	49 89 f5             	mov    %rsi,%r13
+  8004a7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004ab:	44 89 c3             	mov    %r8d,%ebx
+  8004ae:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8004b1:	41 89 cf             	mov    %ecx,%r15d
+  8004b4:	4c 39 fa             	cmp    %r15,%rdx
+  8004b7:	72 29                	jb     8004e2 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004b9:	48 89 d0             	mov    %rdx,%rax
+  8004bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004c1:	49 f7 f7             	div    %r15
+  8004c4:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004c8:	48 89 c2             	mov    %rax,%rdx
+  8004cb:	48 b8 90 04 80 00 00 	movabs $0x800490,%rax
+  8004d2:	00 00 00 
+  8004d5:	ff d0                	call   *%rax
+  8004d7:	eb 10                	jmp    8004e9 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8004d9:	4c 89 ee             	mov    %r13,%rsi
+  8004dc:	44 89 f7             	mov    %r14d,%edi
+  8004df:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  8004e2:	83 eb 01             	sub    $0x1,%ebx
+  8004e5:	85 db                	test   %ebx,%ebx
+  8004e7:	7f f0                	jg     8004d9 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004e9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004f2:	49 f7 f7             	div    %r15
+  8004f5:	48 b8 0d 1e 80 00 00 	movabs $0x801e0d,%rax
+  8004fc:	00 00 00 
+  8004ff:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  800503:	4c 89 ee             	mov    %r13,%rsi
+  800506:	41 ff d4             	call   *%r12
+}
+  800509:	48 83 c4 18          	add    $0x18,%rsp
+  80050d:	5b                   	pop    %rbx
+  80050e:	41 5c                	pop    %r12
+  800510:	41 5d                	pop    %r13
+  800512:	41 5e                	pop    %r14
+  800514:	41 5f                	pop    %r15
+  800516:	5d                   	pop    %rbp
+  800517:	c3                   	ret
+
+0000000000800518 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  800518:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  80051c:	48 8b 06             	mov    (%rsi),%rax
+  80051f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800523:	73 0a                	jae    80052f <sprintputch+0x17>
+		*b->buf++ = ch;
+  800525:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800529:	48 89 16             	mov    %rdx,(%rsi)
+  80052c:	40 88 38             	mov    %dil,(%rax)
+}
+  80052f:	c3                   	ret
+
+0000000000800530 <printfmt>:
+{
+  800530:	55                   	push   %rbp
+  800531:	48 89 e5             	mov    %rsp,%rbp
+  800534:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80053b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800542:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800549:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800550:	84 c0                	test   %al,%al
+  800552:	74 20                	je     800574 <printfmt+0x44>
+  800554:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800558:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80055c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800560:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800564:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800568:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80056c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800570:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  800574:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  80057b:	00 00 00 
+  80057e:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800585:	00 00 00 
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800593:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80059a:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8005a1:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8005a8:	48 b8 b6 05 80 00 00 	movabs $0x8005b6,%rax
+  8005af:	00 00 00 
+  8005b2:	ff d0                	call   *%rax
+}
+  8005b4:	c9                   	leave
+  8005b5:	c3                   	ret
+
+00000000008005b6 <vprintfmt>:
+{
+  8005b6:	55                   	push   %rbp
+  8005b7:	48 89 e5             	mov    %rsp,%rbp
+  8005ba:	41 57                	push   %r15
+  8005bc:	41 56                	push   %r14
+  8005be:	41 55                	push   %r13
+  8005c0:	41 54                	push   %r12
+  8005c2:	53                   	push   %rbx
+  8005c3:	48 83 ec 48          	sub    $0x48,%rsp
+  8005c7:	49 89 fe             	mov    %rdi,%r14
+  8005ca:	49 89 f5             	mov    %rsi,%r13
+  8005cd:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  8005d0:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  8005d4:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  8005d8:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8005dc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8005e0:	eb 09                	jmp    8005eb <vprintfmt+0x35>
+			putch(ch, putdat);
+  8005e2:	4c 89 ee             	mov    %r13,%rsi
+  8005e5:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005e8:	4c 89 e3             	mov    %r12,%rbx
+  8005eb:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8005ef:	0f b6 3b             	movzbl (%rbx),%edi
+  8005f2:	83 ff 25             	cmp    $0x25,%edi
+  8005f5:	74 13                	je     80060a <vprintfmt+0x54>
+			if (ch == '\0')
+  8005f7:	85 ff                	test   %edi,%edi
+  8005f9:	75 e7                	jne    8005e2 <vprintfmt+0x2c>
+}
+  8005fb:	48 83 c4 48          	add    $0x48,%rsp
+  8005ff:	5b                   	pop    %rbx
+  800600:	41 5c                	pop    %r12
+  800602:	41 5d                	pop    %r13
+  800604:	41 5e                	pop    %r14
+  800606:	41 5f                	pop    %r15
+  800608:	5d                   	pop    %rbp
+  800609:	c3                   	ret
+		padc = ' ';
+  80060a:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  80060e:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  800615:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  80061b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  800622:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800627:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80062c:	41 0f b6 14 24       	movzbl (%r12),%edx
+  800631:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  800634:	3c 55                	cmp    $0x55,%al
+  800636:	0f 87 4f 05 00 00    	ja     800b8b <vprintfmt+0x5d5>
+  80063c:	0f b6 c0             	movzbl %al,%eax
+  80063f:	48 be e0 1e 80 00 00 	movabs $0x801ee0,%rsi
+  800646:	00 00 00 
+  800649:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  80064c:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  80064f:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  800653:	eb d2                	jmp    800627 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800655:	49 89 dc             	mov    %rbx,%r12
+  800658:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  80065c:	eb c9                	jmp    800627 <vprintfmt+0x71>
+  80065e:	0f b6 d2             	movzbl %dl,%edx
+  800661:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  800664:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  80066a:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  80066e:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  800673:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  800678:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  80067b:	83 f8 09             	cmp    $0x9,%eax
+  80067e:	77 20                	ja     8006a0 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  800680:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  800684:	eb e4                	jmp    80066a <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  800686:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800689:	83 f8 2f             	cmp    $0x2f,%eax
+  80068c:	77 27                	ja     8006b5 <vprintfmt+0xff>
+  80068e:	89 c2                	mov    %eax,%edx
+  800690:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800694:	83 c0 08             	add    $0x8,%eax
+  800697:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80069a:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  80069d:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  8006a0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006a4:	79 81                	jns    800627 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  8006a6:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  8006aa:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006b0:	e9 72 ff ff ff       	jmp    800627 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  8006b5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006b9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c1:	eb d7                	jmp    80069a <vprintfmt+0xe4>
+			if (width < 0)
+  8006c3:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  8006c6:	85 f6                	test   %esi,%esi
+  8006c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006cd:	0f 49 c6             	cmovns %esi,%eax
+  8006d0:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006d3:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8006d6:	e9 4c ff ff ff       	jmp    800627 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006db:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  8006de:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  8006e5:	e9 3d ff ff ff       	jmp    800627 <vprintfmt+0x71>
+			lflag++;
+  8006ea:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8006ed:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8006f0:	e9 32 ff ff ff       	jmp    800627 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  8006f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006fb:	77 19                	ja     800716 <vprintfmt+0x160>
+  8006fd:	89 c2                	mov    %eax,%edx
+  8006ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800703:	83 c0 08             	add    $0x8,%eax
+  800706:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800709:	8b 3a                	mov    (%rdx),%edi
+  80070b:	4c 89 ee             	mov    %r13,%rsi
+  80070e:	41 ff d6             	call   *%r14
+			break;
+  800711:	e9 d5 fe ff ff       	jmp    8005eb <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  800716:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80071a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80071e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800722:	eb e5                	jmp    800709 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  800724:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800727:	83 f8 2f             	cmp    $0x2f,%eax
+  80072a:	77 5a                	ja     800786 <vprintfmt+0x1d0>
+  80072c:	89 c2                	mov    %eax,%edx
+  80072e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800732:	83 c0 08             	add    $0x8,%eax
+  800735:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800738:	8b 02                	mov    (%rdx),%eax
+  80073a:	89 c1                	mov    %eax,%ecx
+  80073c:	f7 d9                	neg    %ecx
+  80073e:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800741:	83 f9 08             	cmp    $0x8,%ecx
+  800744:	7f 4e                	jg     800794 <vprintfmt+0x1de>
+  800746:	48 63 c1             	movslq %ecx,%rax
+  800749:	48 ba a0 21 80 00 00 	movabs $0x8021a0,%rdx
+  800750:	00 00 00 
+  800753:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800757:	48 85 c0             	test   %rax,%rax
+  80075a:	74 38                	je     800794 <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  80075c:	48 89 c1             	mov    %rax,%rcx
+  80075f:	48 ba 2e 1e 80 00 00 	movabs $0x801e2e,%rdx
+  800766:	00 00 00 
+  800769:	4c 89 ee             	mov    %r13,%rsi
+  80076c:	4c 89 f7             	mov    %r14,%rdi
+  80076f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800774:	49 b8 30 05 80 00 00 	movabs $0x800530,%r8
+  80077b:	00 00 00 
+  80077e:	41 ff d0             	call   *%r8
+  800781:	e9 65 fe ff ff       	jmp    8005eb <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  800786:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800792:	eb a4                	jmp    800738 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  800794:	48 ba 25 1e 80 00 00 	movabs $0x801e25,%rdx
+  80079b:	00 00 00 
+  80079e:	4c 89 ee             	mov    %r13,%rsi
+  8007a1:	4c 89 f7             	mov    %r14,%rdi
+  8007a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a9:	49 b8 30 05 80 00 00 	movabs $0x800530,%r8
+  8007b0:	00 00 00 
+  8007b3:	41 ff d0             	call   *%r8
+  8007b6:	e9 30 fe ff ff       	jmp    8005eb <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  8007bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007be:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c1:	77 36                	ja     8007f9 <vprintfmt+0x243>
+  8007c3:	89 c2                	mov    %eax,%edx
+  8007c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c9:	83 c0 08             	add    $0x8,%eax
+  8007cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007cf:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  8007d2:	48 85 c9             	test   %rcx,%rcx
+  8007d5:	48 b8 1e 1e 80 00 00 	movabs $0x801e1e,%rax
+  8007dc:	00 00 00 
+  8007df:	48 0f 45 c1          	cmovne %rcx,%rax
+  8007e3:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  8007e7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007eb:	7e 06                	jle    8007f3 <vprintfmt+0x23d>
+  8007ed:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  8007f1:	75 14                	jne    800807 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007f3:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8007f7:	eb 64                	jmp    80085d <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  8007f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800801:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800805:	eb c8                	jmp    8007cf <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800807:	49 63 f7             	movslq %r15d,%rsi
+  80080a:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  80080e:	48 b8 99 0c 80 00 00 	movabs $0x800c99,%rax
+  800815:	00 00 00 
+  800818:	ff d0                	call   *%rax
+  80081a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80081d:	29 c1                	sub    %eax,%ecx
+  80081f:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800822:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  800825:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800829:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80082c:	eb 0d                	jmp    80083b <vprintfmt+0x285>
+					putch(padc, putdat);
+  80082e:	4c 89 ee             	mov    %r13,%rsi
+  800831:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  800834:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800837:	41 83 ec 01          	sub    $0x1,%r12d
+  80083b:	45 85 e4             	test   %r12d,%r12d
+  80083e:	7f ee                	jg     80082e <vprintfmt+0x278>
+  800840:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  800843:	85 c9                	test   %ecx,%ecx
+  800845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084a:	0f 49 c1             	cmovns %ecx,%eax
+  80084d:	29 c1                	sub    %eax,%ecx
+  80084f:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  800852:	eb 9f                	jmp    8007f3 <vprintfmt+0x23d>
+					putch(ch, putdat);
+  800854:	4c 89 ee             	mov    %r13,%rsi
+  800857:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80085a:	4c 89 e2             	mov    %r12,%rdx
+  80085d:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800861:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800867:	0f be f8             	movsbl %al,%edi
+  80086a:	85 ff                	test   %edi,%edi
+  80086c:	74 29                	je     800897 <vprintfmt+0x2e1>
+  80086e:	45 85 ff             	test   %r15d,%r15d
+  800871:	78 06                	js     800879 <vprintfmt+0x2c3>
+  800873:	41 83 ef 01          	sub    $0x1,%r15d
+  800877:	78 1e                	js     800897 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800879:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  80087d:	74 d5                	je     800854 <vprintfmt+0x29e>
+  80087f:	0f be c0             	movsbl %al,%eax
+  800882:	83 e8 20             	sub    $0x20,%eax
+  800885:	83 f8 5e             	cmp    $0x5e,%eax
+  800888:	76 ca                	jbe    800854 <vprintfmt+0x29e>
+					putch('?', putdat);
+  80088a:	4c 89 ee             	mov    %r13,%rsi
+  80088d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800892:	41 ff d6             	call   *%r14
+  800895:	eb c3                	jmp    80085a <vprintfmt+0x2a4>
+  800897:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  80089b:	8b 45 98             	mov    -0x68(%rbp),%eax
+  80089e:	41 01 c4             	add    %eax,%r12d
+  8008a1:	41 29 d4             	sub    %edx,%r12d
+  8008a4:	eb 0f                	jmp    8008b5 <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  8008a6:	4c 89 ee             	mov    %r13,%rsi
+  8008a9:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008ae:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  8008b1:	41 83 ec 01          	sub    $0x1,%r12d
+  8008b5:	45 85 e4             	test   %r12d,%r12d
+  8008b8:	7f ec                	jg     8008a6 <vprintfmt+0x2f0>
+  8008ba:	e9 2c fd ff ff       	jmp    8005eb <vprintfmt+0x35>
+	if (lflag >= 2)
+  8008bf:	83 f9 01             	cmp    $0x1,%ecx
+  8008c2:	7f 1d                	jg     8008e1 <vprintfmt+0x32b>
+	else if (lflag)
+  8008c4:	85 c9                	test   %ecx,%ecx
+  8008c6:	74 5e                	je     800926 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  8008c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ce:	77 48                	ja     800918 <vprintfmt+0x362>
+  8008d0:	89 c2                	mov    %eax,%edx
+  8008d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d6:	83 c0 08             	add    $0x8,%eax
+  8008d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008dc:	4c 8b 22             	mov    (%rdx),%r12
+  8008df:	eb 17                	jmp    8008f8 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  8008e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e7:	77 21                	ja     80090a <vprintfmt+0x354>
+  8008e9:	89 c2                	mov    %eax,%edx
+  8008eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ef:	83 c0 08             	add    $0x8,%eax
+  8008f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f5:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  8008f8:	4d 85 e4             	test   %r12,%r12
+  8008fb:	78 50                	js     80094d <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  8008fd:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800900:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800905:	e9 b4 01 00 00       	jmp    800abe <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  80090a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80090e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800912:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800916:	eb dd                	jmp    8008f5 <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800918:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800920:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800924:	eb b6                	jmp    8008dc <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800926:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800929:	83 f8 2f             	cmp    $0x2f,%eax
+  80092c:	77 11                	ja     80093f <vprintfmt+0x389>
+  80092e:	89 c2                	mov    %eax,%edx
+  800930:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800934:	83 c0 08             	add    $0x8,%eax
+  800937:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093a:	4c 63 22             	movslq (%rdx),%r12
+  80093d:	eb b9                	jmp    8008f8 <vprintfmt+0x342>
+  80093f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800943:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800947:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094b:	eb ed                	jmp    80093a <vprintfmt+0x384>
+				putch('-', putdat);
+  80094d:	4c 89 ee             	mov    %r13,%rsi
+  800950:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800955:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800958:	4c 89 e2             	mov    %r12,%rdx
+  80095b:	48 f7 da             	neg    %rdx
+			base = 10;
+  80095e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800963:	e9 56 01 00 00       	jmp    800abe <vprintfmt+0x508>
+	if (lflag >= 2)
+  800968:	83 f9 01             	cmp    $0x1,%ecx
+  80096b:	7f 25                	jg     800992 <vprintfmt+0x3dc>
+	else if (lflag)
+  80096d:	85 c9                	test   %ecx,%ecx
+  80096f:	74 5e                	je     8009cf <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800971:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800974:	83 f8 2f             	cmp    $0x2f,%eax
+  800977:	77 48                	ja     8009c1 <vprintfmt+0x40b>
+  800979:	89 c2                	mov    %eax,%edx
+  80097b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097f:	83 c0 08             	add    $0x8,%eax
+  800982:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800985:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800988:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  80098d:	e9 2c 01 00 00       	jmp    800abe <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800992:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800995:	83 f8 2f             	cmp    $0x2f,%eax
+  800998:	77 19                	ja     8009b3 <vprintfmt+0x3fd>
+  80099a:	89 c2                	mov    %eax,%edx
+  80099c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a0:	83 c0 08             	add    $0x8,%eax
+  8009a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a6:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8009a9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  8009ae:	e9 0b 01 00 00       	jmp    800abe <vprintfmt+0x508>
+  8009b3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bf:	eb e5                	jmp    8009a6 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  8009c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009cd:	eb b6                	jmp    800985 <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  8009cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d5:	77 18                	ja     8009ef <vprintfmt+0x439>
+  8009d7:	89 c2                	mov    %eax,%edx
+  8009d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009dd:	83 c0 08             	add    $0x8,%eax
+  8009e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e3:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  8009e5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  8009ea:	e9 cf 00 00 00       	jmp    800abe <vprintfmt+0x508>
+  8009ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fb:	eb e6                	jmp    8009e3 <vprintfmt+0x42d>
+	if (lflag >= 2)
+  8009fd:	83 f9 01             	cmp    $0x1,%ecx
+  800a00:	7f 25                	jg     800a27 <vprintfmt+0x471>
+	else if (lflag)
+  800a02:	85 c9                	test   %ecx,%ecx
+  800a04:	74 5b                	je     800a61 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800a06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a09:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0c:	77 45                	ja     800a53 <vprintfmt+0x49d>
+  800a0e:	89 c2                	mov    %eax,%edx
+  800a10:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a14:	83 c0 08             	add    $0x8,%eax
+  800a17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a1a:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800a1d:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800a22:	e9 97 00 00 00       	jmp    800abe <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800a27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2d:	77 16                	ja     800a45 <vprintfmt+0x48f>
+  800a2f:	89 c2                	mov    %eax,%edx
+  800a31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a35:	83 c0 08             	add    $0x8,%eax
+  800a38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3b:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800a3e:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800a43:	eb 79                	jmp    800abe <vprintfmt+0x508>
+  800a45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a51:	eb e8                	jmp    800a3b <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800a53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a57:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5f:	eb b9                	jmp    800a1a <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800a61:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a64:	83 f8 2f             	cmp    $0x2f,%eax
+  800a67:	77 15                	ja     800a7e <vprintfmt+0x4c8>
+  800a69:	89 c2                	mov    %eax,%edx
+  800a6b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6f:	83 c0 08             	add    $0x8,%eax
+  800a72:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a75:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800a77:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800a7c:	eb 40                	jmp    800abe <vprintfmt+0x508>
+  800a7e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a82:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8a:	eb e9                	jmp    800a75 <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800a8c:	4c 89 ee             	mov    %r13,%rsi
+  800a8f:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a94:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800a97:	4c 89 ee             	mov    %r13,%rsi
+  800a9a:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a9f:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800aa2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa5:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa8:	77 34                	ja     800ade <vprintfmt+0x528>
+  800aaa:	89 c2                	mov    %eax,%edx
+  800aac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab0:	83 c0 08             	add    $0x8,%eax
+  800ab3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800ab6:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800ab9:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800abe:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800ac3:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ac7:	4c 89 ee             	mov    %r13,%rsi
+  800aca:	4c 89 f7             	mov    %r14,%rdi
+  800acd:	48 b8 90 04 80 00 00 	movabs $0x800490,%rax
+  800ad4:	00 00 00 
+  800ad7:	ff d0                	call   *%rax
+			break;
+  800ad9:	e9 0d fb ff ff       	jmp    8005eb <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800ade:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aea:	eb ca                	jmp    800ab6 <vprintfmt+0x500>
+	if (lflag >= 2)
+  800aec:	83 f9 01             	cmp    $0x1,%ecx
+  800aef:	7f 22                	jg     800b13 <vprintfmt+0x55d>
+	else if (lflag)
+  800af1:	85 c9                	test   %ecx,%ecx
+  800af3:	74 58                	je     800b4d <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800af5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af8:	83 f8 2f             	cmp    $0x2f,%eax
+  800afb:	77 42                	ja     800b3f <vprintfmt+0x589>
+  800afd:	89 c2                	mov    %eax,%edx
+  800aff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b03:	83 c0 08             	add    $0x8,%eax
+  800b06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b09:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800b0c:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800b11:	eb ab                	jmp    800abe <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800b13:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b16:	83 f8 2f             	cmp    $0x2f,%eax
+  800b19:	77 16                	ja     800b31 <vprintfmt+0x57b>
+  800b1b:	89 c2                	mov    %eax,%edx
+  800b1d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b21:	83 c0 08             	add    $0x8,%eax
+  800b24:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b27:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800b2a:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800b2f:	eb 8d                	jmp    800abe <vprintfmt+0x508>
+  800b31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b3d:	eb e8                	jmp    800b27 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800b3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b43:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b4b:	eb bc                	jmp    800b09 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800b4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b50:	83 f8 2f             	cmp    $0x2f,%eax
+  800b53:	77 18                	ja     800b6d <vprintfmt+0x5b7>
+  800b55:	89 c2                	mov    %eax,%edx
+  800b57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b5b:	83 c0 08             	add    $0x8,%eax
+  800b5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b61:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800b63:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800b68:	e9 51 ff ff ff       	jmp    800abe <vprintfmt+0x508>
+  800b6d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b71:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b79:	eb e6                	jmp    800b61 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800b7b:	4c 89 ee             	mov    %r13,%rsi
+  800b7e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b83:	41 ff d6             	call   *%r14
+			break;
+  800b86:	e9 60 fa ff ff       	jmp    8005eb <vprintfmt+0x35>
+			putch('%', putdat);
+  800b8b:	4c 89 ee             	mov    %r13,%rsi
+  800b8e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b93:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b96:	4c 89 e3             	mov    %r12,%rbx
+  800b99:	eb 04                	jmp    800b9f <vprintfmt+0x5e9>
+  800b9b:	48 83 eb 01          	sub    $0x1,%rbx
+  800b9f:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ba3:	75 f6                	jne    800b9b <vprintfmt+0x5e5>
+  800ba5:	e9 41 fa ff ff       	jmp    8005eb <vprintfmt+0x35>
+
+0000000000800baa <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800baa:	55                   	push   %rbp
+  800bab:	48 89 e5             	mov    %rsp,%rbp
+  800bae:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800bb2:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800bb6:	48 63 c6             	movslq %esi,%rax
+  800bb9:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800bbe:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800bc2:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800bc9:	48 85 ff             	test   %rdi,%rdi
+  800bcc:	74 2a                	je     800bf8 <vsnprintf+0x4e>
+  800bce:	85 f6                	test   %esi,%esi
+  800bd0:	7e 26                	jle    800bf8 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800bd2:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800bd6:	48 bf 18 05 80 00 00 	movabs $0x800518,%rdi
+  800bdd:	00 00 00 
+  800be0:	48 b8 b6 05 80 00 00 	movabs $0x8005b6,%rax
+  800be7:	00 00 00 
+  800bea:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800bec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800bf0:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800bf3:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800bf6:	c9                   	leave
+  800bf7:	c3                   	ret
+		return -E_INVAL;
+  800bf8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bfd:	eb f7                	jmp    800bf6 <vsnprintf+0x4c>
+
+0000000000800bff <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800bff:	55                   	push   %rbp
+  800c00:	48 89 e5             	mov    %rsp,%rbp
+  800c03:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800c0a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800c11:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800c18:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800c1f:	84 c0                	test   %al,%al
+  800c21:	74 20                	je     800c43 <snprintf+0x44>
+  800c23:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800c27:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800c2b:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800c2f:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800c33:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800c37:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800c3b:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800c3f:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800c43:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800c4a:	00 00 00 
+  800c4d:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800c54:	00 00 00 
+  800c57:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c5b:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800c62:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800c69:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800c70:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800c77:	48 b8 aa 0b 80 00 00 	movabs $0x800baa,%rax
+  800c7e:	00 00 00 
+  800c81:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800c83:	c9                   	leave
+  800c84:	c3                   	ret
+
+0000000000800c85 <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800c85:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c8a:	48 89 d0             	mov    %rdx,%rax
+  800c8d:	48 83 c2 01          	add    $0x1,%rdx
+  800c91:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800c96:	75 f2                	jne    800c8a <strlen+0x5>
+		n++;
+	return n;
+}
+  800c98:	c3                   	ret
+
+0000000000800c99 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c9e:	eb 03                	jmp    800ca3 <strnlen+0xa>
+  800ca0:	48 89 d0             	mov    %rdx,%rax
+  800ca3:	48 39 c6             	cmp    %rax,%rsi
+  800ca6:	74 0a                	je     800cb2 <strnlen+0x19>
+  800ca8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800cac:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800cb0:	75 ee                	jne    800ca0 <strnlen+0x7>
+		n++;
+	return n;
+}
+  800cb2:	c3                   	ret
+
+0000000000800cb3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800cb3:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800cb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cbb:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800cbf:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cc2:	48 83 c2 01          	add    $0x1,%rdx
+  800cc6:	84 c9                	test   %cl,%cl
+  800cc8:	75 f1                	jne    800cbb <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800cca:	c3                   	ret
+
+0000000000800ccb <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800ccb:	55                   	push   %rbp
+  800ccc:	48 89 e5             	mov    %rsp,%rbp
+  800ccf:	41 54                	push   %r12
+  800cd1:	53                   	push   %rbx
+  800cd2:	48 89 fb             	mov    %rdi,%rbx
+  800cd5:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800cd8:	48 b8 85 0c 80 00 00 	movabs $0x800c85,%rax
+  800cdf:	00 00 00 
+  800ce2:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800ce4:	48 63 f8             	movslq %eax,%rdi
+  800ce7:	48 01 df             	add    %rbx,%rdi
+  800cea:	4c 89 e6             	mov    %r12,%rsi
+  800ced:	48 b8 b3 0c 80 00 00 	movabs $0x800cb3,%rax
+  800cf4:	00 00 00 
+  800cf7:	ff d0                	call   *%rax
+	return dst;
+}
+  800cf9:	48 89 d8             	mov    %rbx,%rax
+  800cfc:	5b                   	pop    %rbx
+  800cfd:	41 5c                	pop    %r12
+  800cff:	5d                   	pop    %rbp
+  800d00:	c3                   	ret
+
+0000000000800d01 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d01:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800d04:	48 01 fa             	add    %rdi,%rdx
+  800d07:	48 89 f9             	mov    %rdi,%rcx
+  800d0a:	eb 14                	jmp    800d20 <strncpy+0x1f>
+		*dst++ = *src;
+  800d0c:	48 83 c1 01          	add    $0x1,%rcx
+  800d10:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d14:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800d18:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d1c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800d20:	48 39 d1             	cmp    %rdx,%rcx
+  800d23:	75 e7                	jne    800d0c <strncpy+0xb>
+	}
+	return ret;
+}
+  800d25:	c3                   	ret
+
+0000000000800d26 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800d26:	48 89 f8             	mov    %rdi,%rax
+  800d29:	48 85 d2             	test   %rdx,%rdx
+  800d2c:	74 27                	je     800d55 <strlcpy+0x2f>
+  800d2e:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800d33:	48 89 fa             	mov    %rdi,%rdx
+  800d36:	eb 0b                	jmp    800d43 <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800d38:	48 83 c6 01          	add    $0x1,%rsi
+  800d3c:	48 83 c2 01          	add    $0x1,%rdx
+  800d40:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800d43:	48 39 c2             	cmp    %rax,%rdx
+  800d46:	74 0a                	je     800d52 <strlcpy+0x2c>
+  800d48:	0f b6 0e             	movzbl (%rsi),%ecx
+  800d4b:	84 c9                	test   %cl,%cl
+  800d4d:	75 e9                	jne    800d38 <strlcpy+0x12>
+  800d4f:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800d52:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800d55:	48 29 f8             	sub    %rdi,%rax
+}
+  800d58:	c3                   	ret
+
+0000000000800d59 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800d59:	eb 08                	jmp    800d63 <strcmp+0xa>
+		p++, q++;
+  800d5b:	48 83 c7 01          	add    $0x1,%rdi
+  800d5f:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800d63:	0f b6 07             	movzbl (%rdi),%eax
+  800d66:	84 c0                	test   %al,%al
+  800d68:	74 04                	je     800d6e <strcmp+0x15>
+  800d6a:	3a 06                	cmp    (%rsi),%al
+  800d6c:	74 ed                	je     800d5b <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d6e:	0f b6 c0             	movzbl %al,%eax
+  800d71:	0f b6 16             	movzbl (%rsi),%edx
+  800d74:	29 d0                	sub    %edx,%eax
+}
+  800d76:	c3                   	ret
+
+0000000000800d77 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800d77:	eb 0c                	jmp    800d85 <strncmp+0xe>
+		n--, p++, q++;
+  800d79:	48 83 ea 01          	sub    $0x1,%rdx
+  800d7d:	48 83 c7 01          	add    $0x1,%rdi
+  800d81:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800d85:	48 85 d2             	test   %rdx,%rdx
+  800d88:	74 14                	je     800d9e <strncmp+0x27>
+  800d8a:	0f b6 07             	movzbl (%rdi),%eax
+  800d8d:	84 c0                	test   %al,%al
+  800d8f:	74 04                	je     800d95 <strncmp+0x1e>
+  800d91:	3a 06                	cmp    (%rsi),%al
+  800d93:	74 e4                	je     800d79 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d95:	0f b6 07             	movzbl (%rdi),%eax
+  800d98:	0f b6 16             	movzbl (%rsi),%edx
+  800d9b:	29 d0                	sub    %edx,%eax
+}
+  800d9d:	c3                   	ret
+		return 0;
+  800d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da3:	c3                   	ret
+
+0000000000800da4 <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800da4:	eb 04                	jmp    800daa <strchr+0x6>
+  800da6:	48 83 c7 01          	add    $0x1,%rdi
+  800daa:	0f b6 07             	movzbl (%rdi),%eax
+  800dad:	84 c0                	test   %al,%al
+  800daf:	74 09                	je     800dba <strchr+0x16>
+		if (*s == c)
+  800db1:	40 38 f0             	cmp    %sil,%al
+  800db4:	75 f0                	jne    800da6 <strchr+0x2>
+  800db6:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800db9:	c3                   	ret
+	return 0;
+  800dba:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbf:	c3                   	ret
+
+0000000000800dc0 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800dc0:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800dc3:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800dc6:	40 38 f2             	cmp    %sil,%dl
+  800dc9:	74 0a                	je     800dd5 <strfind+0x15>
+  800dcb:	84 d2                	test   %dl,%dl
+  800dcd:	74 06                	je     800dd5 <strfind+0x15>
+	for (; *s; s++)
+  800dcf:	48 83 c0 01          	add    $0x1,%rax
+  800dd3:	eb ee                	jmp    800dc3 <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800dd5:	c3                   	ret
+
+0000000000800dd6 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800dd6:	48 85 d2             	test   %rdx,%rdx
+  800dd9:	74 28                	je     800e03 <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800ddb:	48 89 f8             	mov    %rdi,%rax
+  800dde:	48 09 d0             	or     %rdx,%rax
+  800de1:	a8 03                	test   $0x3,%al
+  800de3:	75 16                	jne    800dfb <memset+0x25>
+		c &= 0xFF;
+  800de5:	40 0f b6 f6          	movzbl %sil,%esi
+  800de9:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800def:	48 89 d1             	mov    %rdx,%rcx
+  800df2:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800df6:	fc                   	cld
+  800df7:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800df9:	eb 08                	jmp    800e03 <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800dfb:	89 f0                	mov    %esi,%eax
+  800dfd:	48 89 d1             	mov    %rdx,%rcx
+  800e00:	fc                   	cld
+  800e01:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800e03:	48 89 f8             	mov    %rdi,%rax
+  800e06:	c3                   	ret
+
+0000000000800e07 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800e07:	48 89 f8             	mov    %rdi,%rax
+  800e0a:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800e0d:	48 39 fe             	cmp    %rdi,%rsi
+  800e10:	73 3a                	jae    800e4c <memmove+0x45>
+  800e12:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e16:	48 39 d7             	cmp    %rdx,%rdi
+  800e19:	73 31                	jae    800e4c <memmove+0x45>
+		s += n;
+		d += n;
+  800e1b:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800e1f:	48 89 d6             	mov    %rdx,%rsi
+  800e22:	48 09 fe             	or     %rdi,%rsi
+  800e25:	48 09 ce             	or     %rcx,%rsi
+  800e28:	40 f6 c6 03          	test   $0x3,%sil
+  800e2c:	75 11                	jne    800e3f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800e2e:	48 83 ef 04          	sub    $0x4,%rdi
+  800e32:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800e36:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800e3a:	fd                   	std
+  800e3b:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800e3d:	eb 0b                	jmp    800e4a <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800e3f:	48 83 ef 01          	sub    $0x1,%rdi
+  800e43:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800e47:	fd                   	std
+  800e48:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800e4a:	fc                   	cld
+  800e4b:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800e4c:	48 89 f2             	mov    %rsi,%rdx
+  800e4f:	48 09 c2             	or     %rax,%rdx
+  800e52:	48 09 ca             	or     %rcx,%rdx
+  800e55:	f6 c2 03             	test   $0x3,%dl
+  800e58:	75 0b                	jne    800e65 <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800e5a:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800e5e:	48 89 c7             	mov    %rax,%rdi
+  800e61:	fc                   	cld
+  800e62:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800e64:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800e65:	48 89 c7             	mov    %rax,%rdi
+  800e68:	fc                   	cld
+  800e69:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800e6b:	c3                   	ret
+
+0000000000800e6c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800e6c:	55                   	push   %rbp
+  800e6d:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800e70:	48 b8 07 0e 80 00 00 	movabs $0x800e07,%rax
+  800e77:	00 00 00 
+  800e7a:	ff d0                	call   *%rax
+}
+  800e7c:	5d                   	pop    %rbp
+  800e7d:	c3                   	ret
+
+0000000000800e7e <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800e7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e83:	48 39 c2             	cmp    %rax,%rdx
+  800e86:	74 1e                	je     800ea6 <memcmp+0x28>
+		if (*s1 != *s2)
+  800e88:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e8c:	48 83 c0 01          	add    $0x1,%rax
+  800e90:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800e96:	44 38 c1             	cmp    %r8b,%cl
+  800e99:	74 e8                	je     800e83 <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800e9b:	0f b6 c1             	movzbl %cl,%eax
+  800e9e:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ea2:	44 29 c0             	sub    %r8d,%eax
+  800ea5:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800eab:	c3                   	ret
+
+0000000000800eac <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800eac:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800eaf:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800eb2:	eb 04                	jmp    800eb8 <memfind+0xc>
+  800eb4:	48 83 c0 01          	add    $0x1,%rax
+  800eb8:	48 39 d0             	cmp    %rdx,%rax
+  800ebb:	73 05                	jae    800ec2 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ebd:	40 38 30             	cmp    %sil,(%rax)
+  800ec0:	75 f2                	jne    800eb4 <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800ec2:	c3                   	ret
+
+0000000000800ec3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ec3:	48 89 f9             	mov    %rdi,%rcx
+  800ec6:	49 89 f0             	mov    %rsi,%r8
+  800ec9:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ecb:	eb 04                	jmp    800ed1 <strtol+0xe>
+		s++;
+  800ecd:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800ed1:	0f b6 01             	movzbl (%rcx),%eax
+  800ed4:	3c 20                	cmp    $0x20,%al
+  800ed6:	74 f5                	je     800ecd <strtol+0xa>
+  800ed8:	3c 09                	cmp    $0x9,%al
+  800eda:	74 f1                	je     800ecd <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800edc:	3c 2b                	cmp    $0x2b,%al
+  800ede:	74 2b                	je     800f0b <strtol+0x48>
+	int neg = 0;
+  800ee0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800ee6:	3c 2d                	cmp    $0x2d,%al
+  800ee8:	74 2d                	je     800f17 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800eea:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800ef0:	75 0f                	jne    800f01 <strtol+0x3e>
+  800ef2:	80 39 30             	cmpb   $0x30,(%rcx)
+  800ef5:	74 2c                	je     800f23 <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ef7:	85 ff                	test   %edi,%edi
+  800ef9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800efe:	0f 44 f8             	cmove  %eax,%edi
+  800f01:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800f06:	4c 63 d7             	movslq %edi,%r10
+  800f09:	eb 4f                	jmp    800f5a <strtol+0x97>
+		s++;
+  800f0b:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800f0f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800f15:	eb d3                	jmp    800eea <strtol+0x27>
+		s++, neg = 1;
+  800f17:	48 83 c1 01          	add    $0x1,%rcx
+  800f1b:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800f21:	eb c7                	jmp    800eea <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f23:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800f27:	74 0f                	je     800f38 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800f29:	85 ff                	test   %edi,%edi
+  800f2b:	75 d4                	jne    800f01 <strtol+0x3e>
+		s++, base = 8;
+  800f2d:	48 83 c1 01          	add    $0x1,%rcx
+  800f31:	bf 08 00 00 00       	mov    $0x8,%edi
+  800f36:	eb c9                	jmp    800f01 <strtol+0x3e>
+		s += 2, base = 16;
+  800f38:	48 83 c1 02          	add    $0x2,%rcx
+  800f3c:	bf 10 00 00 00       	mov    $0x10,%edi
+  800f41:	eb be                	jmp    800f01 <strtol+0x3e>
+			dig = *s - '0';
+  800f43:	0f be c0             	movsbl %al,%eax
+  800f46:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800f49:	39 f8                	cmp    %edi,%eax
+  800f4b:	7d 3b                	jge    800f88 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800f4d:	48 83 c1 01          	add    $0x1,%rcx
+  800f51:	49 0f af d2          	imul   %r10,%rdx
+  800f55:	48 98                	cltq
+  800f57:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800f5a:	0f b6 01             	movzbl (%rcx),%eax
+  800f5d:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800f60:	40 80 fe 09          	cmp    $0x9,%sil
+  800f64:	76 dd                	jbe    800f43 <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800f66:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800f69:	40 80 fe 19          	cmp    $0x19,%sil
+  800f6d:	77 08                	ja     800f77 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800f6f:	0f be c0             	movsbl %al,%eax
+  800f72:	83 e8 57             	sub    $0x57,%eax
+  800f75:	eb d2                	jmp    800f49 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f77:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800f7a:	40 80 fe 19          	cmp    $0x19,%sil
+  800f7e:	77 08                	ja     800f88 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800f80:	0f be c0             	movsbl %al,%eax
+  800f83:	83 e8 37             	sub    $0x37,%eax
+  800f86:	eb c1                	jmp    800f49 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800f88:	4d 85 c0             	test   %r8,%r8
+  800f8b:	74 03                	je     800f90 <strtol+0xcd>
+		*endptr = (char *) s;
+  800f8d:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800f90:	48 89 d0             	mov    %rdx,%rax
+  800f93:	48 f7 d8             	neg    %rax
+  800f96:	45 85 c9             	test   %r9d,%r9d
+  800f99:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800f9d:	48 89 d0             	mov    %rdx,%rax
+  800fa0:	c3                   	ret
+
+0000000000800fa1 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800fa1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fa7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800fad:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb7:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800fb9:	c3                   	ret
+
+0000000000800fba <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800fba:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fc0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fc6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fcb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fd0:	48 89 fe             	mov    %rdi,%rsi
+  800fd3:	48 89 fa             	mov    %rdi,%rdx
+  800fd6:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800fd8:	c3                   	ret
+
+0000000000800fd9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800fd9:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800fdc:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fe2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fe8:	be 00 00 00 00       	mov    $0x0,%esi
+  800fed:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ff2:	48 89 f2             	mov    %rsi,%rdx
+  800ff5:	0f 05                	syscall
+	if(check && ret > 0)
+  800ff7:	48 85 c0             	test   %rax,%rax
+  800ffa:	7f 01                	jg     800ffd <sys_env_destroy+0x24>
+}
+  800ffc:	c3                   	ret
+{
+  800ffd:	55                   	push   %rbp
+  800ffe:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801001:	49 89 c0             	mov    %rax,%r8
+  801004:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801009:	48 ba e8 21 80 00 00 	movabs $0x8021e8,%rdx
+  801010:	00 00 00 
+  801013:	be 28 00 00 00       	mov    $0x28,%esi
+  801018:	48 bf 05 22 80 00 00 	movabs $0x802205,%rdi
+  80101f:	00 00 00 
+  801022:	b8 00 00 00 00       	mov    $0x0,%eax
+  801027:	49 b9 5d 02 80 00 00 	movabs $0x80025d,%r9
+  80102e:	00 00 00 
+  801031:	41 ff d1             	call   *%r9
+
+0000000000801034 <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  801034:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  80103b:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  80103c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801041:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801045:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801049:	48 c1 e2 04          	shl    $0x4,%rdx
+  80104d:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801054:	00 00 00 
+  801057:	48 01 d0             	add    %rdx,%rax
+  80105a:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  801060:	c3                   	ret
+
+0000000000801061 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  801061:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801067:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80106d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801072:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801077:	48 89 fe             	mov    %rdi,%rsi
+  80107a:	48 89 fa             	mov    %rdi,%rdx
+  80107d:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80107f:	c3                   	ret
+
+0000000000801080 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  801080:	48 63 d2             	movslq %edx,%rdx
+  801083:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801086:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80108c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801092:	b8 04 00 00 00       	mov    $0x4,%eax
+  801097:	0f 05                	syscall
+	if(check && ret > 0)
+  801099:	48 85 c0             	test   %rax,%rax
+  80109c:	7f 01                	jg     80109f <sys_page_alloc+0x1f>
+}
+  80109e:	c3                   	ret
+{
+  80109f:	55                   	push   %rbp
+  8010a0:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a3:	49 89 c0             	mov    %rax,%r8
+  8010a6:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8010ab:	48 ba e8 21 80 00 00 	movabs $0x8021e8,%rdx
+  8010b2:	00 00 00 
+  8010b5:	be 28 00 00 00       	mov    $0x28,%esi
+  8010ba:	48 bf 05 22 80 00 00 	movabs $0x802205,%rdi
+  8010c1:	00 00 00 
+  8010c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c9:	49 b9 5d 02 80 00 00 	movabs $0x80025d,%r9
+  8010d0:	00 00 00 
+  8010d3:	41 ff d1             	call   *%r9
+
+00000000008010d6 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8010d6:	48 63 d2             	movslq %edx,%rdx
+  8010d9:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8010dc:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010e8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010ed:	0f 05                	syscall
+	if(check && ret > 0)
+  8010ef:	48 85 c0             	test   %rax,%rax
+  8010f2:	7f 01                	jg     8010f5 <sys_page_alloc_huge+0x1f>
+}
+  8010f4:	c3                   	ret
+{
+  8010f5:	55                   	push   %rbp
+  8010f6:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010f9:	49 89 c0             	mov    %rax,%r8
+  8010fc:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801101:	48 ba e8 21 80 00 00 	movabs $0x8021e8,%rdx
+  801108:	00 00 00 
+  80110b:	be 28 00 00 00       	mov    $0x28,%esi
+  801110:	48 bf 05 22 80 00 00 	movabs $0x802205,%rdi
+  801117:	00 00 00 
+  80111a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80111f:	49 b9 5d 02 80 00 00 	movabs $0x80025d,%r9
+  801126:	00 00 00 
+  801129:	41 ff d1             	call   *%r9
+
+000000000080112c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80112c:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  80112f:	48 63 d2             	movslq %edx,%rdx
+  801132:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  801135:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  801138:	b8 05 00 00 00       	mov    $0x5,%eax
+  80113d:	0f 05                	syscall
+	if(check && ret > 0)
+  80113f:	48 85 c0             	test   %rax,%rax
+  801142:	7f 01                	jg     801145 <sys_page_map+0x19>
+}
+  801144:	c3                   	ret
+{
+  801145:	55                   	push   %rbp
+  801146:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801149:	49 89 c0             	mov    %rax,%r8
+  80114c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801151:	48 ba e8 21 80 00 00 	movabs $0x8021e8,%rdx
+  801158:	00 00 00 
+  80115b:	be 28 00 00 00       	mov    $0x28,%esi
+  801160:	48 bf 05 22 80 00 00 	movabs $0x802205,%rdi
+  801167:	00 00 00 
+  80116a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80116f:	49 b9 5d 02 80 00 00 	movabs $0x80025d,%r9
+  801176:	00 00 00 
+  801179:	41 ff d1             	call   *%r9
+
+000000000080117c <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  80117c:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80117f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801185:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80118b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801190:	b8 06 00 00 00       	mov    $0x6,%eax
+  801195:	0f 05                	syscall
+	if(check && ret > 0)
+  801197:	48 85 c0             	test   %rax,%rax
+  80119a:	7f 01                	jg     80119d <sys_page_unmap+0x21>
+}
+  80119c:	c3                   	ret
+{
+  80119d:	55                   	push   %rbp
+  80119e:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a1:	49 89 c0             	mov    %rax,%r8
+  8011a4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011a9:	48 ba e8 21 80 00 00 	movabs $0x8021e8,%rdx
+  8011b0:	00 00 00 
+  8011b3:	be 28 00 00 00       	mov    $0x28,%esi
+  8011b8:	48 bf 05 22 80 00 00 	movabs $0x802205,%rdi
+  8011bf:	00 00 00 
+  8011c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c7:	49 b9 5d 02 80 00 00 	movabs $0x80025d,%r9
+  8011ce:	00 00 00 
+  8011d1:	41 ff d1             	call   *%r9
+
+00000000008011d4 <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  8011d4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011e5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011ea:	48 89 fe             	mov    %rdi,%rsi
+  8011ed:	48 89 fa             	mov    %rdi,%rdx
+  8011f0:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8011f2:	c3                   	ret
+
+00000000008011f3 <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  8011f3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801204:	b8 10 00 00 00       	mov    $0x10,%eax
+  801209:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  80120b:	c3                   	ret
+
+000000000080120c <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  80120c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801212:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801218:	b8 11 00 00 00       	mov    $0x11,%eax
+  80121d:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  80121f:	c3                   	ret
+
+0000000000801220 <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  801220:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  801223:	48 63 f6             	movslq %esi,%rsi
+  801226:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  801229:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80122f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801234:	0f 05                	syscall
+	if(check && ret > 0)
+  801236:	48 85 c0             	test   %rax,%rax
+  801239:	7f 01                	jg     80123c <sys_page_batch+0x1c>
+}
+  80123b:	c3                   	ret
+{
+  80123c:	55                   	push   %rbp
+  80123d:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801240:	49 89 c0             	mov    %rax,%r8
+  801243:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801248:	48 ba e8 21 80 00 00 	movabs $0x8021e8,%rdx
+  80124f:	00 00 00 
+  801252:	be 28 00 00 00       	mov    $0x28,%esi
+  801257:	48 bf 05 22 80 00 00 	movabs $0x802205,%rdi
+  80125e:	00 00 00 
+  801261:	b8 00 00 00 00       	mov    $0x0,%eax
+  801266:	49 b9 5d 02 80 00 00 	movabs $0x80025d,%r9
+  80126d:	00 00 00 
+  801270:	41 ff d1             	call   *%r9
+
+0000000000801273 <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  801273:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801279:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80127f:	be 00 00 00 00       	mov    $0x0,%esi
+  801284:	b8 13 00 00 00       	mov    $0x13,%eax
+  801289:	48 89 f2             	mov    %rsi,%rdx
+  80128c:	0f 05                	syscall
+	if(check && ret > 0)
+  80128e:	48 85 c0             	test   %rax,%rax
+  801291:	7f 01                	jg     801294 <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  801293:	c3                   	ret
+{
+  801294:	55                   	push   %rbp
+  801295:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801298:	49 89 c0             	mov    %rax,%r8
+  80129b:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8012a0:	48 ba e8 21 80 00 00 	movabs $0x8021e8,%rdx
+  8012a7:	00 00 00 
+  8012aa:	be 28 00 00 00       	mov    $0x28,%esi
+  8012af:	48 bf 05 22 80 00 00 	movabs $0x802205,%rdi
+  8012b6:	00 00 00 
+  8012b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012be:	49 b9 5d 02 80 00 00 	movabs $0x80025d,%r9
+  8012c5:	00 00 00 
+  8012c8:	41 ff d1             	call   *%r9
+
+00000000008012cb <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  8012cb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8012d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8012d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012dc:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012e1:	48 89 fe             	mov    %rdi,%rsi
+  8012e4:	48 89 fa             	mov    %rdi,%rdx
+  8012e7:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8012e9:	c3                   	ret
+
+00000000008012ea <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  8012ea:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8012ed:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8012f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8012f9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012fe:	0f 05                	syscall
+	if(check && ret > 0)
+  801300:	48 85 c0             	test   %rax,%rax
+  801303:	7f 01                	jg     801306 <sys_page_unmap_range+0x1c>
+}
+  801305:	c3                   	ret
+{
+  801306:	55                   	push   %rbp
+  801307:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80130a:	49 89 c0             	mov    %rax,%r8
+  80130d:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801312:	48 ba e8 21 80 00 00 	movabs $0x8021e8,%rdx
+  801319:	00 00 00 
+  80131c:	be 28 00 00 00       	mov    $0x28,%esi
+  801321:	48 bf 05 22 80 00 00 	movabs $0x802205,%rdi
+  801328:	00 00 00 
+  80132b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801330:	49 b9 5d 02 80 00 00 	movabs $0x80025d,%r9
+  801337:	00 00 00 
+  80133a:	41 ff d1             	call   *%r9
+
+000000000080133d <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80133d:	48 63 f6             	movslq %esi,%rsi
+  801340:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801343:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801349:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80134f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801354:	b8 08 00 00 00       	mov    $0x8,%eax
+  801359:	0f 05                	syscall
+	if(check && ret > 0)
+  80135b:	48 85 c0             	test   %rax,%rax
+  80135e:	7f 01                	jg     801361 <sys_env_set_status+0x24>
+}
+  801360:	c3                   	ret
+{
+  801361:	55                   	push   %rbp
+  801362:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801365:	49 89 c0             	mov    %rax,%r8
+  801368:	b9 08 00 00 00       	mov    $0x8,%ecx
+  80136d:	48 ba e8 21 80 00 00 	movabs $0x8021e8,%rdx
+  801374:	00 00 00 
+  801377:	be 28 00 00 00       	mov    $0x28,%esi
+  80137c:	48 bf 05 22 80 00 00 	movabs $0x802205,%rdi
+  801383:	00 00 00 
+  801386:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138b:	49 b9 5d 02 80 00 00 	movabs $0x80025d,%r9
+  801392:	00 00 00 
+  801395:	41 ff d1             	call   *%r9
+
+0000000000801398 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  801398:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80139b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8013a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8013a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ac:	b8 09 00 00 00       	mov    $0x9,%eax
+  8013b1:	0f 05                	syscall
+	if(check && ret > 0)
+  8013b3:	48 85 c0             	test   %rax,%rax
+  8013b6:	7f 01                	jg     8013b9 <sys_env_set_pgfault_upcall+0x21>
+}
+  8013b8:	c3                   	ret
+{
+  8013b9:	55                   	push   %rbp
+  8013ba:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013bd:	49 89 c0             	mov    %rax,%r8
+  8013c0:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8013c5:	48 ba e8 21 80 00 00 	movabs $0x8021e8,%rdx
+  8013cc:	00 00 00 
+  8013cf:	be 28 00 00 00       	mov    $0x28,%esi
+  8013d4:	48 bf 05 22 80 00 00 	movabs $0x802205,%rdi
+  8013db:	00 00 00 
+  8013de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e3:	49 b9 5d 02 80 00 00 	movabs $0x80025d,%r9
+  8013ea:	00 00 00 
+  8013ed:	41 ff d1             	call   *%r9
+
+00000000008013f0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8013f0:	48 63 ff             	movslq %edi,%rdi
+  8013f3:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  8013f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8013fc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801401:	0f 05                	syscall
+}
+  801403:	c3                   	ret
+
+0000000000801404 <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  801404:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80140a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801410:	be 00 00 00 00       	mov    $0x0,%esi
+  801415:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80141a:	48 89 f2             	mov    %rsi,%rdx
+  80141d:	0f 05                	syscall
+	if(check && ret > 0)
+  80141f:	48 85 c0             	test   %rax,%rax
+  801422:	7f 01                	jg     801425 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  801424:	c3                   	ret
+{
+  801425:	55                   	push   %rbp
+  801426:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801429:	49 89 c0             	mov    %rax,%r8
+  80142c:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801431:	48 ba e8 21 80 00 00 	movabs $0x8021e8,%rdx
+  801438:	00 00 00 
+  80143b:	be 28 00 00 00       	mov    $0x28,%esi
+  801440:	48 bf 05 22 80 00 00 	movabs $0x802205,%rdi
+  801447:	00 00 00 
+  80144a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144f:	49 b9 5d 02 80 00 00 	movabs $0x80025d,%r9
+  801456:	00 00 00 
+  801459:	41 ff d1             	call   *%r9
+
+000000000080145c <pgfault>:
+- unmap PFTEMP using sys_page_unmap()
+- panic if any step fails
+*/
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80145c:	55                   	push   %rbp
+  80145d:	48 89 e5             	mov    %rsp,%rbp
+  801460:	53                   	push   %rbx
+  801461:	48 83 ec 08          	sub    $0x8,%rsp
+	void *addr = (void *) utf->utf_fault_va;
+  801465:	48 8b 1f             	mov    (%rdi),%rbx
+	uint32_t err = utf->utf_err;
+  801468:	48 8b 47 08          	mov    0x8(%rdi),%rax
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+
+	if (!(err & FEC_WR)) {
+  80146c:	a8 02                	test   $0x2,%al
+  80146e:	0f 84 b1 00 00 00    	je     801525 <pgfault+0xc9>
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+	}
+	pte_t pte = uvpt[PGNUM(addr)];
+  801474:	48 89 da             	mov    %rbx,%rdx
+  801477:	48 c1 ea 0c          	shr    $0xc,%rdx
+  80147b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801482:	01 00 00 
+  801485:	48 8b 0c d0          	mov    (%rax,%rdx,8),%rcx
+	if (!(pte & PTE_COW)) {
+  801489:	f6 c5 08             	test   $0x8,%ch
+  80148c:	0f 84 c3 00 00 00    	je     801555 <pgfault+0xf9>
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+
+	void *pg_addr = ROUNDDOWN(addr, PGSIZE);
+  801492:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  801499:	ba 07 00 00 00       	mov    $0x7,%edx
+  80149e:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8014a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014a8:	48 b8 80 10 80 00 00 	movabs $0x801080,%rax
+  8014af:	00 00 00 
+  8014b2:	ff d0                	call   *%rax
+	if (r < 0) {
+  8014b4:	85 c0                	test   %eax,%eax
+  8014b6:	0f 88 c7 00 00 00    	js     801583 <pgfault+0x127>
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+	}
+	memmove(PFTEMP, pg_addr, PGSIZE);
+  8014bc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8014c1:	48 89 de             	mov    %rbx,%rsi
+  8014c4:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  8014c9:	48 b8 07 0e 80 00 00 	movabs $0x800e07,%rax
+  8014d0:	00 00 00 
+  8014d3:	ff d0                	call   *%rax
+	r = sys_page_map(0, PFTEMP, 0, pg_addr, PTE_P | PTE_U | PTE_W);
+  8014d5:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8014db:	48 89 d9             	mov    %rbx,%rcx
+  8014de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e3:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8014e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014ed:	48 b8 2c 11 80 00 00 	movabs $0x80112c,%rax
+  8014f4:	00 00 00 
+  8014f7:	ff d0                	call   *%rax
+	if (r < 0) {
+  8014f9:	85 c0                	test   %eax,%eax
+  8014fb:	0f 88 af 00 00 00    	js     8015b0 <pgfault+0x154>
+		panic("pgfault: sys_page_map failed:  %e", r);
+	}
+	r = sys_page_unmap(0, PFTEMP);
+  801501:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  801506:	bf 00 00 00 00       	mov    $0x0,%edi
+  80150b:	48 b8 7c 11 80 00 00 	movabs $0x80117c,%rax
+  801512:	00 00 00 
+  801515:	ff d0                	call   *%rax
+	if (r < 0) {
+  801517:	85 c0                	test   %eax,%eax
+  801519:	0f 88 be 00 00 00    	js     8015dd <pgfault+0x181>
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+	}
+}
+  80151f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801523:	c9                   	leave
+  801524:	c3                   	ret
+  801525:	89 c1                	mov    %eax,%ecx
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+  801527:	49 89 d8             	mov    %rbx,%r8
+  80152a:	48 ba 18 22 80 00 00 	movabs $0x802218,%rdx
+  801531:	00 00 00 
+  801534:	be 32 00 00 00       	mov    $0x32,%esi
+  801539:	48 bf c7 23 80 00 00 	movabs $0x8023c7,%rdi
+  801540:	00 00 00 
+  801543:	b8 00 00 00 00       	mov    $0x0,%eax
+  801548:	49 b9 5d 02 80 00 00 	movabs $0x80025d,%r9
+  80154f:	00 00 00 
+  801552:	41 ff d1             	call   *%r9
+		panic("pgfault: page is not marked copy-on-write (pte=%p, va=%p)", pte, addr);
+  801555:	49 89 d8             	mov    %rbx,%r8
+  801558:	48 ba 40 22 80 00 00 	movabs $0x802240,%rdx
+  80155f:	00 00 00 
+  801562:	be 36 00 00 00       	mov    $0x36,%esi
+  801567:	48 bf c7 23 80 00 00 	movabs $0x8023c7,%rdi
+  80156e:	00 00 00 
+  801571:	b8 00 00 00 00       	mov    $0x0,%eax
+  801576:	49 b9 5d 02 80 00 00 	movabs $0x80025d,%r9
+  80157d:	00 00 00 
+  801580:	41 ff d1             	call   *%r9
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+  801583:	89 c1                	mov    %eax,%ecx
+  801585:	48 ba 80 22 80 00 00 	movabs $0x802280,%rdx
+  80158c:	00 00 00 
+  80158f:	be 44 00 00 00       	mov    $0x44,%esi
+  801594:	48 bf c7 23 80 00 00 	movabs $0x8023c7,%rdi
+  80159b:	00 00 00 
+  80159e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a3:	49 b8 5d 02 80 00 00 	movabs $0x80025d,%r8
+  8015aa:	00 00 00 
+  8015ad:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_map failed:  %e", r);
+  8015b0:	89 c1                	mov    %eax,%ecx
+  8015b2:	48 ba a8 22 80 00 00 	movabs $0x8022a8,%rdx
+  8015b9:	00 00 00 
+  8015bc:	be 49 00 00 00       	mov    $0x49,%esi
+  8015c1:	48 bf c7 23 80 00 00 	movabs $0x8023c7,%rdi
+  8015c8:	00 00 00 
+  8015cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d0:	49 b8 5d 02 80 00 00 	movabs $0x80025d,%r8
+  8015d7:	00 00 00 
+  8015da:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+  8015dd:	89 c1                	mov    %eax,%ecx
+  8015df:	48 ba d0 22 80 00 00 	movabs $0x8022d0,%rdx
+  8015e6:	00 00 00 
+  8015e9:	be 4d 00 00 00       	mov    $0x4d,%esi
+  8015ee:	48 bf c7 23 80 00 00 	movabs $0x8023c7,%rdi
+  8015f5:	00 00 00 
+  8015f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fd:	49 b8 5d 02 80 00 00 	movabs $0x80025d,%r8
+  801604:	00 00 00 
+  801607:	41 ff d0             	call   *%r8
+
+000000000080160a <dupflush>:
+static struct PageOp dup_child[DUP_BATCH], dup_self[DUP_BATCH];
+static int ndup_child, ndup_self;
+
+static int
+dupflush(envid_t envid)
+{
+  80160a:	55                   	push   %rbp
+  80160b:	48 89 e5             	mov    %rsp,%rbp
+  80160e:	89 fe                	mov    %edi,%esi
+	int r;
+
+	// Map to child first, then remap parent
+	r = sys_page_batch(0, envid, dup_child, ndup_child);
+  801610:	a1 24 30 80 00 00 00 	movabs 0x803024,%eax
+  801617:	00 00 
+  801619:	48 63 c8             	movslq %eax,%rcx
+  80161c:	48 ba 40 36 80 00 00 	movabs $0x803640,%rdx
+  801623:	00 00 00 
+  801626:	bf 00 00 00 00       	mov    $0x0,%edi
+  80162b:	48 b8 20 12 80 00 00 	movabs $0x801220,%rax
+  801632:	00 00 00 
+  801635:	ff d0                	call   *%rax
+	if (r < 0) {
+  801637:	85 c0                	test   %eax,%eax
+  801639:	78 57                	js     801692 <dupflush+0x88>
+		panic("duppage: child map failed: %e", r);
+		return r;
+	}
+	r = sys_page_batch(0, 0, dup_self, ndup_self);
+  80163b:	a1 20 30 80 00 00 00 	movabs 0x803020,%eax
+  801642:	00 00 
+  801644:	48 63 c8             	movslq %eax,%rcx
+  801647:	48 ba 40 30 80 00 00 	movabs $0x803040,%rdx
+  80164e:	00 00 00 
+  801651:	be 00 00 00 00       	mov    $0x0,%esi
+  801656:	bf 00 00 00 00       	mov    $0x0,%edi
+  80165b:	48 b8 20 12 80 00 00 	movabs $0x801220,%rax
+  801662:	00 00 00 
+  801665:	ff d0                	call   *%rax
+	if (r < 0) {
+  801667:	85 c0                	test   %eax,%eax
+  801669:	78 54                	js     8016bf <dupflush+0xb5>
+		panic("duppage: parent remap failed: %e", r);
+		return r;
+	}
+	ndup_child = ndup_self = 0;
+  80166b:	48 b8 20 30 80 00 00 	movabs $0x803020,%rax
+  801672:	00 00 00 
+  801675:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  80167b:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  801682:	00 00 00 
+  801685:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	return 0;
+}
+  80168b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801690:	5d                   	pop    %rbp
+  801691:	c3                   	ret
+		panic("duppage: child map failed: %e", r);
+  801692:	89 c1                	mov    %eax,%ecx
+  801694:	48 ba d2 23 80 00 00 	movabs $0x8023d2,%rdx
+  80169b:	00 00 00 
+  80169e:	be 77 00 00 00       	mov    $0x77,%esi
+  8016a3:	48 bf c7 23 80 00 00 	movabs $0x8023c7,%rdi
+  8016aa:	00 00 00 
+  8016ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b2:	49 b8 5d 02 80 00 00 	movabs $0x80025d,%r8
+  8016b9:	00 00 00 
+  8016bc:	41 ff d0             	call   *%r8
+		panic("duppage: parent remap failed: %e", r);
+  8016bf:	89 c1                	mov    %eax,%ecx
+  8016c1:	48 ba f8 22 80 00 00 	movabs $0x8022f8,%rdx
+  8016c8:	00 00 00 
+  8016cb:	be 7c 00 00 00       	mov    $0x7c,%esi
+  8016d0:	48 bf c7 23 80 00 00 	movabs $0x8023c7,%rdi
+  8016d7:	00 00 00 
+  8016da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016df:	49 b8 5d 02 80 00 00 	movabs $0x80025d,%r8
+  8016e6:	00 00 00 
+  8016e9:	41 ff d0             	call   *%r8
+
+00000000008016ec <thread_start>:
+	return envid;
+}
+
+static void
+thread_start(void (*fn)(void *), void *arg)
+{
+  8016ec:	55                   	push   %rbp
+  8016ed:	48 89 e5             	mov    %rsp,%rbp
+  8016f0:	48 89 f8             	mov    %rdi,%rax
+  8016f3:	48 89 f7             	mov    %rsi,%rdi
+	fn(arg);
+  8016f6:	ff d0                	call   *%rax
+	exit();
+  8016f8:	48 b8 46 02 80 00 00 	movabs $0x800246,%rax
+  8016ff:	00 00 00 
+  801702:	ff d0                	call   *%rax
+}
+  801704:	5d                   	pop    %rbp
+  801705:	c3                   	ret
+
+0000000000801706 <fork>:
+{
+  801706:	55                   	push   %rbp
+  801707:	48 89 e5             	mov    %rsp,%rbp
+	set_pgfault_handler(pgfault);
+  80170a:	48 bf 5c 14 80 00 00 	movabs $0x80145c,%rdi
+  801711:	00 00 00 
+  801714:	48 b8 39 1c 80 00 00 	movabs $0x801c39,%rax
+  80171b:	00 00 00 
+  80171e:	ff d0                	call   *%rax
+	return sys_fork();
+  801720:	48 b8 d4 11 80 00 00 	movabs $0x8011d4,%rax
+  801727:	00 00 00 
+  80172a:	ff d0                	call   *%rax
+}
+  80172c:	5d                   	pop    %rbp
+  80172d:	c3                   	ret
+
+000000000080172e <ufork>:
+{
+  80172e:	55                   	push   %rbp
+  80172f:	48 89 e5             	mov    %rsp,%rbp
+  801732:	41 57                	push   %r15
+  801734:	41 56                	push   %r14
+  801736:	41 55                	push   %r13
+  801738:	41 54                	push   %r12
+  80173a:	53                   	push   %rbx
+  80173b:	48 83 ec 38          	sub    $0x38,%rsp
+	set_pgfault_handler(pgfault);
+  80173f:	48 bf 5c 14 80 00 00 	movabs $0x80145c,%rdi
+  801746:	00 00 00 
+  801749:	48 b8 39 1c 80 00 00 	movabs $0x801c39,%rax
+  801750:	00 00 00 
+  801753:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801755:	b8 07 00 00 00       	mov    $0x7,%eax
+  80175a:	cd 30                	int    $0x30
+  80175c:	89 45 cc             	mov    %eax,-0x34(%rbp)
+	if (envid < 0) {
+  80175f:	85 c0                	test   %eax,%eax
+  801761:	78 21                	js     801784 <ufork+0x56>
+	if (envid == 0) {
+  801763:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801767:	0f 84 e4 03 00 00    	je     801b51 <ufork+0x423>
+  80176d:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801774:	00 
+	op->po_op = PAGEOP_MAP;
+  801775:	49 bf 40 36 80 00 00 	movabs $0x803640,%r15
+  80177c:	00 00 00 
+  80177f:	e9 e7 02 00 00       	jmp    801a6b <ufork+0x33d>
+		panic("sys_exofork failed: %e", envid);
+  801784:	89 c1                	mov    %eax,%ecx
+  801786:	48 ba f0 23 80 00 00 	movabs $0x8023f0,%rdx
+  80178d:	00 00 00 
+  801790:	be e4 00 00 00       	mov    $0xe4,%esi
+  801795:	48 bf c7 23 80 00 00 	movabs $0x8023c7,%rdi
+  80179c:	00 00 00 
+  80179f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a4:	49 b8 5d 02 80 00 00 	movabs $0x80025d,%r8
+  8017ab:	00 00 00 
+  8017ae:	41 ff d0             	call   *%r8
+  8017b1:	44 89 e8             	mov    %r13d,%eax
+  8017b4:	c1 e0 09             	shl    $0x9,%eax
+  8017b7:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  8017ba:	44 89 e8             	mov    %r13d,%eax
+  8017bd:	c1 e0 12             	shl    $0x12,%eax
+  8017c0:	89 45 ac             	mov    %eax,-0x54(%rbp)
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  8017c3:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8017ca:	00 
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  8017cb:	44 89 6d a8          	mov    %r13d,-0x58(%rbp)
+				int pdeIndex = pdpeIndex * NPTENTRIES + k;
+  8017cf:	8b 75 c8             	mov    -0x38(%rbp),%esi
+				if (!(uvpd[pdeIndex] & PTE_P)) {
+  8017d2:	48 63 c6             	movslq %esi,%rax
+  8017d5:	48 bf 00 00 00 80 00 	movabs $0x10080000000,%rdi
+  8017dc:	01 00 00 
+  8017df:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8017e3:	a8 01                	test   $0x1,%al
+  8017e5:	0f 84 52 02 00 00    	je     801a3d <ufork+0x30f>
+				if (uvpd[pdeIndex] & PTE_PS) {
+  8017eb:	48 63 c6             	movslq %esi,%rax
+  8017ee:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8017f2:	a8 80                	test   $0x80,%al
+  8017f4:	74 52                	je     801848 <ufork+0x11a>
+					void *va = PGADDR(i, j, k, 0, 0);
+  8017f6:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  8017fa:	48 c1 e3 27          	shl    $0x27,%rbx
+  8017fe:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801802:	48 09 c3             	or     %rax,%rbx
+  801805:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801809:	48 09 c3             	or     %rax,%rbx
+					if ((uintptr_t)va >= UTOP) {
+  80180c:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  801811:	48 39 d8             	cmp    %rbx,%rax
+  801814:	0f 82 ca 02 00 00    	jb     801ae4 <ufork+0x3b6>
+					r = sys_page_map(0, va, 0, va, uvpd[pdeIndex] & PTE_SYSCALL);
+  80181a:	48 63 d6             	movslq %esi,%rdx
+  80181d:	4c 8b 04 d7          	mov    (%rdi,%rdx,8),%r8
+  801821:	41 81 e0 07 0e 00 00 	and    $0xe07,%r8d
+  801828:	48 89 d9             	mov    %rbx,%rcx
+  80182b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801830:	48 89 de             	mov    %rbx,%rsi
+  801833:	bf 00 00 00 00       	mov    $0x0,%edi
+  801838:	48 b8 2c 11 80 00 00 	movabs $0x80112c,%rax
+  80183f:	00 00 00 
+  801842:	ff d0                	call   *%rax
+					if (r < 0) {
+  801844:	85 c0                	test   %eax,%eax
+  801846:	78 18                	js     801860 <ufork+0x132>
+  801848:	4c 63 65 ac          	movslq -0x54(%rbp),%r12
+  80184c:	4c 89 e3             	mov    %r12,%rbx
+  80184f:	48 c1 e3 0c          	shl    $0xc,%rbx
+  801853:	4d 8d ac 24 00 02 00 	lea    0x200(%r12),%r13
+  80185a:	00 
+  80185b:	e9 00 01 00 00       	jmp    801960 <ufork+0x232>
+						panic("splitting 2MB page at %p failed: %e", va, r);
+  801860:	41 89 c0             	mov    %eax,%r8d
+  801863:	48 89 d9             	mov    %rbx,%rcx
+  801866:	48 ba 20 23 80 00 00 	movabs $0x802320,%rdx
+  80186d:	00 00 00 
+  801870:	be 0a 01 00 00       	mov    $0x10a,%esi
+  801875:	48 bf c7 23 80 00 00 	movabs $0x8023c7,%rdi
+  80187c:	00 00 00 
+  80187f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801884:	49 b9 5d 02 80 00 00 	movabs $0x80025d,%r9
+  80188b:	00 00 00 
+  80188e:	41 ff d1             	call   *%r9
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  801891:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  801898:	00 00 00 
+  80189b:	8b 0f                	mov    (%rdi),%ecx
+  80189d:	8d 71 01             	lea    0x1(%rcx),%esi
+  8018a0:	89 37                	mov    %esi,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  8018a2:	48 63 c9             	movslq %ecx,%rcx
+  8018a5:	48 8d 34 09          	lea    (%rcx,%rcx,1),%rsi
+  8018a9:	48 8d 3c 0e          	lea    (%rsi,%rcx,1),%rdi
+  8018ad:	41 c7 04 ff 01 00 00 	movl   $0x1,(%r15,%rdi,8)
+  8018b4:	00 
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  8018b5:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  8018bb:	41 89 54 ff 04       	mov    %edx,0x4(%r15,%rdi,8)
+	op->po_srcva = op->po_dstva = va;
+  8018c0:	49 89 44 ff 10       	mov    %rax,0x10(%r15,%rdi,8)
+  8018c5:	49 89 44 ff 08       	mov    %rax,0x8(%r15,%rdi,8)
+}
+  8018ca:	eb 76                	jmp    801942 <ufork+0x214>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U | PTE_COW);
+  8018cc:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  8018d3:	00 00 00 
+  8018d6:	8b 17                	mov    (%rdi),%edx
+  8018d8:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  8018db:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  8018dd:	48 63 d2             	movslq %edx,%rdx
+  8018e0:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  8018e4:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8018e8:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  8018ef:	00 
+	op->po_perm = perm;
+  8018f0:	41 c7 44 f7 04 05 08 	movl   $0x805,0x4(%r15,%rsi,8)
+  8018f7:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  8018f9:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  8018fe:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+		dupqueue(&dup_self[ndup_self++], va, PTE_P | PTE_U | PTE_COW);
+  801903:	48 b9 20 30 80 00 00 	movabs $0x803020,%rcx
+  80190a:	00 00 00 
+  80190d:	8b 11                	mov    (%rcx),%edx
+  80190f:	8d 72 01             	lea    0x1(%rdx),%esi
+  801912:	89 31                	mov    %esi,(%rcx)
+	op->po_op = PAGEOP_MAP;
+  801914:	48 be 40 30 80 00 00 	movabs $0x803040,%rsi
+  80191b:	00 00 00 
+  80191e:	48 63 d2             	movslq %edx,%rdx
+  801921:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  801925:	48 8d 3c 11          	lea    (%rcx,%rdx,1),%rdi
+  801929:	c7 04 fe 01 00 00 00 	movl   $0x1,(%rsi,%rdi,8)
+	op->po_perm = perm;
+  801930:	c7 44 fe 04 05 08 00 	movl   $0x805,0x4(%rsi,%rdi,8)
+  801937:	00 
+	op->po_srcva = op->po_dstva = va;
+  801938:	48 89 44 fe 10       	mov    %rax,0x10(%rsi,%rdi,8)
+  80193d:	48 89 44 fe 08       	mov    %rax,0x8(%rsi,%rdi,8)
+	if (ndup_child == DUP_BATCH) {
+  801942:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  801949:	00 00 00 
+  80194c:	83 38 40             	cmpl   $0x40,(%rax)
+  80194f:	0f 84 a4 00 00 00    	je     8019f9 <ufork+0x2cb>
+				for (int l = 0; l < NPTENTRIES; l++) {
+  801955:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80195c:	49 83 c4 01          	add    $0x1,%r12
+  801960:	4d 39 ec             	cmp    %r13,%r12
+  801963:	0f 84 d4 00 00 00    	je     801a3d <ufork+0x30f>
+					if (va >= UTOP) {
+  801969:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  80196e:	48 39 d8             	cmp    %rbx,%rax
+  801971:	0f 82 6d 01 00 00    	jb     801ae4 <ufork+0x3b6>
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  801977:	48 b8 00 10 80 43 ff 	movabs $0xffffffff43801000,%rax
+  80197e:	ff ff ff 
+  801981:	48 01 d8             	add    %rbx,%rax
+  801984:	48 3d ff 0f 00 00    	cmp    $0xfff,%rax
+  80198a:	76 c9                	jbe    801955 <ufork+0x227>
+					if (!(uvpt[pn] & PTE_P)) {
+  80198c:	4b 8b 04 e6          	mov    (%r14,%r12,8),%rax
+  801990:	a8 01                	test   $0x1,%al
+  801992:	74 c1                	je     801955 <ufork+0x227>
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  801994:	48 b8 00 f0 ff ff ff 	movabs $0xffffffff000,%rax
+  80199b:	0f 00 00 
+  80199e:	48 21 d8             	and    %rbx,%rax
+	pte_t pte = uvpt[pn];
+  8019a1:	44 89 e2             	mov    %r12d,%edx
+  8019a4:	49 8b 14 d6          	mov    (%r14,%rdx,8),%rdx
+	if (pte & PTE_SHARE) {
+  8019a8:	f6 c6 04             	test   $0x4,%dh
+  8019ab:	0f 85 e0 fe ff ff    	jne    801891 <ufork+0x163>
+	} else if ((pte & PTE_W) || (pte & PTE_COW)) {
+  8019b1:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  8019b7:	0f 85 0f ff ff ff    	jne    8018cc <ufork+0x19e>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U);
+  8019bd:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  8019c4:	00 00 00 
+  8019c7:	8b 17                	mov    (%rdi),%edx
+  8019c9:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  8019cc:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  8019ce:	48 63 d2             	movslq %edx,%rdx
+  8019d1:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  8019d5:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8019d9:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  8019e0:	00 
+	op->po_perm = perm;
+  8019e1:	41 c7 44 f7 04 05 00 	movl   $0x5,0x4(%r15,%rsi,8)
+  8019e8:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  8019ea:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  8019ef:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+}
+  8019f4:	e9 49 ff ff ff       	jmp    801942 <ufork+0x214>
+		return dupflush(envid);
+  8019f9:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8019fc:	48 b8 0a 16 80 00 00 	movabs $0x80160a,%rax
+  801a03:	00 00 00 
+  801a06:	ff d0                	call   *%rax
+					if (r < 0) {
+  801a08:	85 c0                	test   %eax,%eax
+  801a0a:	0f 89 45 ff ff ff    	jns    801955 <ufork+0x227>
+						panic("duppage failed:  %e", r);
+  801a10:	89 c1                	mov    %eax,%ecx
+  801a12:	48 ba 07 24 80 00 00 	movabs $0x802407,%rdx
+  801a19:	00 00 00 
+  801a1c:	be 20 01 00 00       	mov    $0x120,%esi
+  801a21:	48 bf c7 23 80 00 00 	movabs $0x8023c7,%rdi
+  801a28:	00 00 00 
+  801a2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a30:	49 b8 5d 02 80 00 00 	movabs $0x80025d,%r8
+  801a37:	00 00 00 
+  801a3a:	41 ff d0             	call   *%r8
+			for (int k = 0; k < NPTENTRIES; k++) {
+  801a3d:	81 45 ac 00 02 00 00 	addl   $0x200,-0x54(%rbp)
+  801a44:	83 45 c8 01          	addl   $0x1,-0x38(%rbp)
+  801a48:	48 81 45 b0 00 00 20 	addq   $0x200000,-0x50(%rbp)
+  801a4f:	00 
+  801a50:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a54:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  801a5a:	0f 85 6f fd ff ff    	jne    8017cf <ufork+0xa1>
+  801a60:	44 8b 6d a8          	mov    -0x58(%rbp),%r13d
+  801a64:	eb 5d                	jmp    801ac3 <ufork+0x395>
+	for (int i = 0; i < NPTENTRIES; i++) {
+  801a66:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  801a6b:	48 81 7d c0 00 02 00 	cmpq   $0x200,-0x40(%rbp)
+  801a72:	00 
+  801a73:	74 6f                	je     801ae4 <ufork+0x3b6>
+		if (!(uvpml4e[i] & PTE_P)) {
+  801a75:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  801a79:	48 63 c3             	movslq %ebx,%rax
+  801a7c:	48 be 00 20 40 80 00 	movabs $0x10080402000,%rsi
+  801a83:	01 00 00 
+  801a86:	48 8b 04 c6          	mov    (%rsi,%rax,8),%rax
+  801a8a:	a8 01                	test   $0x1,%al
+  801a8c:	74 d8                	je     801a66 <ufork+0x338>
+  801a8e:	41 89 dc             	mov    %ebx,%r12d
+  801a91:	41 c1 e4 09          	shl    $0x9,%r12d
+  801a95:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801a9c:	00 
+					if (!(uvpt[pn] & PTE_P)) {
+  801a9d:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  801aa4:	01 00 00 
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  801aa7:	45 89 e5             	mov    %r12d,%r13d
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  801aaa:	49 63 c5             	movslq %r13d,%rax
+  801aad:	48 bb 00 00 40 80 00 	movabs $0x10080400000,%rbx
+  801ab4:	01 00 00 
+  801ab7:	48 8b 04 c3          	mov    (%rbx,%rax,8),%rax
+  801abb:	a8 01                	test   $0x1,%al
+  801abd:	0f 85 ee fc ff ff    	jne    8017b1 <ufork+0x83>
+		for (int j = 0; j < NPTENTRIES; j++) {
+  801ac3:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  801aca:	40 
+  801acb:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801acf:	41 83 c5 01          	add    $0x1,%r13d
+  801ad3:	48 b9 00 00 00 00 80 	movabs $0x8000000000,%rcx
+  801ada:	00 00 00 
+  801add:	48 39 c8             	cmp    %rcx,%rax
+  801ae0:	75 c8                	jne    801aaa <ufork+0x37c>
+  801ae2:	eb 82                	jmp    801a66 <ufork+0x338>
+	r = dupflush(envid);
+  801ae4:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801ae7:	48 b8 0a 16 80 00 00 	movabs $0x80160a,%rax
+  801aee:	00 00 00 
+  801af1:	ff d0                	call   *%rax
+	if (r < 0) {
+  801af3:	85 c0                	test   %eax,%eax
+  801af5:	78 6c                	js     801b63 <ufork+0x435>
+	r = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801af7:	ba 07 00 00 00       	mov    $0x7,%edx
+  801afc:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801b01:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801b04:	48 b8 80 10 80 00 00 	movabs $0x801080,%rax
+  801b0b:	00 00 00 
+  801b0e:	ff d0                	call   *%rax
+	if (r < 0) {
+  801b10:	85 c0                	test   %eax,%eax
+  801b12:	78 7c                	js     801b90 <ufork+0x462>
+	r = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  801b14:	48 be 00 1d 80 00 00 	movabs $0x801d00,%rsi
+  801b1b:	00 00 00 
+  801b1e:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801b21:	48 b8 98 13 80 00 00 	movabs $0x801398,%rax
+  801b28:	00 00 00 
+  801b2b:	ff d0                	call   *%rax
+	if (r < 0) {
+  801b2d:	85 c0                	test   %eax,%eax
+  801b2f:	0f 88 88 00 00 00    	js     801bbd <ufork+0x48f>
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  801b35:	be 02 00 00 00       	mov    $0x2,%esi
+  801b3a:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801b3d:	48 b8 3d 13 80 00 00 	movabs $0x80133d,%rax
+  801b44:	00 00 00 
+  801b47:	ff d0                	call   *%rax
+	if (r < 0) {
+  801b49:	85 c0                	test   %eax,%eax
+  801b4b:	0f 88 99 00 00 00    	js     801bea <ufork+0x4bc>
+}
+  801b51:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801b54:	48 83 c4 38          	add    $0x38,%rsp
+  801b58:	5b                   	pop    %rbx
+  801b59:	41 5c                	pop    %r12
+  801b5b:	41 5d                	pop    %r13
+  801b5d:	41 5e                	pop    %r14
+  801b5f:	41 5f                	pop    %r15
+  801b61:	5d                   	pop    %rbp
+  801b62:	c3                   	ret
+		panic("duppage failed:  %e", r);
+  801b63:	89 c1                	mov    %eax,%ecx
+  801b65:	48 ba 07 24 80 00 00 	movabs $0x802407,%rdx
+  801b6c:	00 00 00 
+  801b6f:	be 29 01 00 00       	mov    $0x129,%esi
+  801b74:	48 bf c7 23 80 00 00 	movabs $0x8023c7,%rdi
+  801b7b:	00 00 00 
+  801b7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b83:	49 b8 5d 02 80 00 00 	movabs $0x80025d,%r8
+  801b8a:	00 00 00 
+  801b8d:	41 ff d0             	call   *%r8
+		panic("sys_page_alloc for child exception stack failed: %e", r);
+  801b90:	89 c1                	mov    %eax,%ecx
+  801b92:	48 ba 48 23 80 00 00 	movabs $0x802348,%rdx
+  801b99:	00 00 00 
+  801b9c:	be 2e 01 00 00       	mov    $0x12e,%esi
+  801ba1:	48 bf c7 23 80 00 00 	movabs $0x8023c7,%rdi
+  801ba8:	00 00 00 
+  801bab:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb0:	49 b8 5d 02 80 00 00 	movabs $0x80025d,%r8
+  801bb7:	00 00 00 
+  801bba:	41 ff d0             	call   *%r8
+		panic("sys_env_set_pgfault_upcall failed:  %e", r);
+  801bbd:	89 c1                	mov    %eax,%ecx
+  801bbf:	48 ba 80 23 80 00 00 	movabs $0x802380,%rdx
+  801bc6:	00 00 00 
+  801bc9:	be 33 01 00 00       	mov    $0x133,%esi
+  801bce:	48 bf c7 23 80 00 00 	movabs $0x8023c7,%rdi
+  801bd5:	00 00 00 
+  801bd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bdd:	49 b8 5d 02 80 00 00 	movabs $0x80025d,%r8
+  801be4:	00 00 00 
+  801be7:	41 ff d0             	call   *%r8
+		panic("sys_env_set_status failed:  %e", r);
+  801bea:	89 c1                	mov    %eax,%ecx
+  801bec:	48 ba a8 23 80 00 00 	movabs $0x8023a8,%rdx
+  801bf3:	00 00 00 
+  801bf6:	be 38 01 00 00       	mov    $0x138,%esi
+  801bfb:	48 bf c7 23 80 00 00 	movabs $0x8023c7,%rdi
+  801c02:	00 00 00 
+  801c05:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c0a:	49 b8 5d 02 80 00 00 	movabs $0x80025d,%r8
+  801c11:	00 00 00 
+  801c14:	41 ff d0             	call   *%r8
+
+0000000000801c17 <sfork>:
+// on one stack, since nothing is private to the child.
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801c17:	55                   	push   %rbp
+  801c18:	48 89 e5             	mov    %rsp,%rbp
+  801c1b:	48 89 f2             	mov    %rsi,%rdx
+	return sys_thread_create(thread_start, (uint64_t) fn, (uint64_t) arg);
+  801c1e:	48 89 fe             	mov    %rdi,%rsi
+  801c21:	48 bf ec 16 80 00 00 	movabs $0x8016ec,%rdi
+  801c28:	00 00 00 
+  801c2b:	48 b8 0c 12 80 00 00 	movabs $0x80120c,%rax
+  801c32:	00 00 00 
+  801c35:	ff d0                	call   *%rax
+}
+  801c37:	5d                   	pop    %rbp
+  801c38:	c3                   	ret
+
+0000000000801c39 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801c39:	55                   	push   %rbp
+  801c3a:	48 89 e5             	mov    %rsp,%rbp
+  801c3d:	53                   	push   %rbx
+  801c3e:	48 83 ec 08          	sub    $0x8,%rsp
+  801c42:	48 89 fb             	mov    %rdi,%rbx
+	int r;
+
+	if (_pgfault_handler == 0) {
+  801c45:	48 ba 40 3c 80 00 00 	movabs $0x803c40,%rdx
+  801c4c:	00 00 00 
+  801c4f:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801c53:	74 13                	je     801c68 <set_pgfault_handler+0x2f>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801c55:	48 89 d8             	mov    %rbx,%rax
+  801c58:	48 a3 40 3c 80 00 00 	movabs %rax,0x803c40
+  801c5f:	00 00 00 
+}
+  801c62:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c66:	c9                   	leave
+  801c67:	c3                   	ret
+		r = sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801c68:	ba 07 00 00 00       	mov    $0x7,%edx
+  801c6d:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801c72:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c77:	48 b8 80 10 80 00 00 	movabs $0x801080,%rax
+  801c7e:	00 00 00 
+  801c81:	ff d0                	call   *%rax
+		if (r < 0) {
+  801c83:	85 c0                	test   %eax,%eax
+  801c85:	78 4c                	js     801cd3 <set_pgfault_handler+0x9a>
+		r = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801c87:	48 be 00 1d 80 00 00 	movabs $0x801d00,%rsi
+  801c8e:	00 00 00 
+  801c91:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c96:	48 b8 98 13 80 00 00 	movabs $0x801398,%rax
+  801c9d:	00 00 00 
+  801ca0:	ff d0                	call   *%rax
+		if (r < 0) {
+  801ca2:	85 c0                	test   %eax,%eax
+  801ca4:	79 af                	jns    801c55 <set_pgfault_handler+0x1c>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+  801ca6:	89 c1                	mov    %eax,%ecx
+  801ca8:	48 ba 48 24 80 00 00 	movabs $0x802448,%rdx
+  801caf:	00 00 00 
+  801cb2:	be 2c 00 00 00       	mov    $0x2c,%esi
+  801cb7:	48 bf 36 24 80 00 00 	movabs $0x802436,%rdi
+  801cbe:	00 00 00 
+  801cc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc6:	49 b8 5d 02 80 00 00 	movabs $0x80025d,%r8
+  801ccd:	00 00 00 
+  801cd0:	41 ff d0             	call   *%r8
+			panic("sys_page_alloc failed:  %e", r);
+  801cd3:	89 c1                	mov    %eax,%ecx
+  801cd5:	48 ba 1b 24 80 00 00 	movabs $0x80241b,%rdx
+  801cdc:	00 00 00 
+  801cdf:	be 28 00 00 00       	mov    $0x28,%esi
+  801ce4:	48 bf 36 24 80 00 00 	movabs $0x802436,%rdi
+  801ceb:	00 00 00 
+  801cee:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf3:	49 b8 5d 02 80 00 00 	movabs $0x80025d,%r8
+  801cfa:	00 00 00 
+  801cfd:	41 ff d0             	call   *%r8
+
+0000000000801d00 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi		// function argument: pointer to UTF
+  801d00:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  801d03:	48 a1 40 3c 80 00 00 	movabs 0x803c40,%rax
+  801d0a:	00 00 00 
+	call *%rax
+  801d0d:	ff d0                	call   *%rax
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here. (Hint. You need to modify the trap time rsp to make room for the return rip ) */
+
+	movq  152(%rsp), %rax
+  801d0f:	48 8b 84 24 98 00 00 	mov    0x98(%rsp),%rax
+  801d16:	00 
+	subq $8, %rax
+  801d17:	48 83 e8 08          	sub    $0x8,%rax
+	movq %rax, 152(%rsp)
+  801d1b:	48 89 84 24 98 00 00 	mov    %rax,0x98(%rsp)
+  801d22:	00 
+
+	movq 136(%rsp), %rbx
+  801d23:	48 8b 9c 24 88 00 00 	mov    0x88(%rsp),%rbx
+  801d2a:	00 
+	movq %rbx, (%rax)
+  801d2b:	48 89 18             	mov    %rbx,(%rax)
+
+	/* Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here. (Hint, the oposite of _alltraps) */
+
+	addq $16, %rsp
+  801d2e:	48 83 c4 10          	add    $0x10,%rsp
+	
+	popq %r15
+  801d32:	41 5f                	pop    %r15
+	popq %r14
+  801d34:	41 5e                	pop    %r14
+	popq %r13
+  801d36:	41 5d                	pop    %r13
+	popq %r12
+  801d38:	41 5c                	pop    %r12
+	popq %r11
+  801d3a:	41 5b                	pop    %r11
+	popq %r10
+  801d3c:	41 5a                	pop    %r10
+	popq %r9
+  801d3e:	41 59                	pop    %r9
+	popq %r8
+  801d40:	41 58                	pop    %r8
+	popq %rsi
+  801d42:	5e                   	pop    %rsi
+	popq %rdi
+  801d43:	5f                   	pop    %rdi
+	popq %rbp
+  801d44:	5d                   	pop    %rbp
+	popq %rdx
+  801d45:	5a                   	pop    %rdx
+	popq %rcx
+  801d46:	59                   	pop    %rcx
+	popq %rbx
+  801d47:	5b                   	pop    %rbx
+	popq %rax
+  801d48:	58                   	pop    %rax
+
+	addq $8, %rsp
+  801d49:	48 83 c4 08          	add    $0x8,%rsp
+	/* Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 4: Your code here. */
+
+	popfq
+  801d4d:	9d                   	popf
+
+	/* Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here. */
+
+	popq %rsp
+  801d4e:	5c                   	pop    %rsp
+
+	/* Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here. */
+  801d4f:	c3                   	ret
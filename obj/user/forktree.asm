@@ -0,0 +1,3181 @@
+
+obj/user/forktree:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 fe 00 00 00       	call   80012f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <forktree>:
+	}
+}
+
+void
+forktree(const char *cur)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	41 54                	push   %r12
+  800039:	53                   	push   %rbx
+  80003a:	48 89 fb             	mov    %rdi,%rbx
+	cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  80003d:	48 b8 5a 0e 80 00 00 	movabs $0x800e5a,%rax
+  800044:	00 00 00 
+  800047:	ff d0                	call   *%rax
+  800049:	89 c6                	mov    %eax,%esi
+  80004b:	48 89 da             	mov    %rbx,%rdx
+  80004e:	48 bf 80 1c 80 00 00 	movabs $0x801c80,%rdi
+  800055:	00 00 00 
+  800058:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005d:	48 b9 22 02 80 00 00 	movabs $0x800222,%rcx
+  800064:	00 00 00 
+  800067:	ff d1                	call   *%rcx
+
+	forkchild(cur, '0');
+  800069:	be 30 00 00 00       	mov    $0x30,%esi
+  80006e:	48 89 df             	mov    %rbx,%rdi
+  800071:	49 bc 8e 00 80 00 00 	movabs $0x80008e,%r12
+  800078:	00 00 00 
+  80007b:	41 ff d4             	call   *%r12
+	forkchild(cur, '1');
+  80007e:	be 31 00 00 00       	mov    $0x31,%esi
+  800083:	48 89 df             	mov    %rbx,%rdi
+  800086:	41 ff d4             	call   *%r12
+}
+  800089:	5b                   	pop    %rbx
+  80008a:	41 5c                	pop    %r12
+  80008c:	5d                   	pop    %rbp
+  80008d:	c3                   	ret
+
+000000000080008e <forkchild>:
+{
+  80008e:	55                   	push   %rbp
+  80008f:	48 89 e5             	mov    %rsp,%rbp
+  800092:	41 54                	push   %r12
+  800094:	53                   	push   %rbx
+  800095:	48 83 ec 10          	sub    $0x10,%rsp
+  800099:	48 89 fb             	mov    %rdi,%rbx
+  80009c:	41 89 f4             	mov    %esi,%r12d
+	if (strlen(cur) >= DEPTH)
+  80009f:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  8000a6:	00 00 00 
+  8000a9:	ff d0                	call   *%rax
+  8000ab:	83 f8 02             	cmp    $0x2,%eax
+  8000ae:	7e 09                	jle    8000b9 <forkchild+0x2b>
+}
+  8000b0:	48 83 c4 10          	add    $0x10,%rsp
+  8000b4:	5b                   	pop    %rbx
+  8000b5:	41 5c                	pop    %r12
+  8000b7:	5d                   	pop    %rbp
+  8000b8:	c3                   	ret
+	snprintf(nxt, DEPTH+1, "%s%c", cur, branch);
+  8000b9:	45 0f be c4          	movsbl %r12b,%r8d
+  8000bd:	48 89 d9             	mov    %rbx,%rcx
+  8000c0:	48 ba 91 1c 80 00 00 	movabs $0x801c91,%rdx
+  8000c7:	00 00 00 
+  8000ca:	be 04 00 00 00       	mov    $0x4,%esi
+  8000cf:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8000d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d8:	49 b9 25 0a 80 00 00 	movabs $0x800a25,%r9
+  8000df:	00 00 00 
+  8000e2:	41 ff d1             	call   *%r9
+	if (fork() == 0) {
+  8000e5:	48 b8 2c 15 80 00 00 	movabs $0x80152c,%rax
+  8000ec:	00 00 00 
+  8000ef:	ff d0                	call   *%rax
+  8000f1:	85 c0                	test   %eax,%eax
+  8000f3:	75 bb                	jne    8000b0 <forkchild+0x22>
+		forktree(nxt);
+  8000f5:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8000f9:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  800100:	00 00 00 
+  800103:	ff d0                	call   *%rax
+		exit();
+  800105:	48 b8 5e 01 80 00 00 	movabs $0x80015e,%rax
+  80010c:	00 00 00 
+  80010f:	ff d0                	call   *%rax
+  800111:	eb 9d                	jmp    8000b0 <forkchild+0x22>
+
+0000000000800113 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800113:	55                   	push   %rbp
+  800114:	48 89 e5             	mov    %rsp,%rbp
+	forktree("");
+  800117:	48 bf 90 1c 80 00 00 	movabs $0x801c90,%rdi
+  80011e:	00 00 00 
+  800121:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  800128:	00 00 00 
+  80012b:	ff d0                	call   *%rax
+}
+  80012d:	5d                   	pop    %rbp
+  80012e:	c3                   	ret
+
+000000000080012f <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  80012f:	55                   	push   %rbp
+  800130:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800133:	85 ff                	test   %edi,%edi
+  800135:	7e 0d                	jle    800144 <libmain+0x15>
+		binaryname = argv[0];
+  800137:	48 8b 06             	mov    (%rsi),%rax
+  80013a:	48 a3 00 30 80 00 00 	movabs %rax,0x803000
+  800141:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  800144:	48 b8 13 01 80 00 00 	movabs $0x800113,%rax
+  80014b:	00 00 00 
+  80014e:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800150:	48 b8 5e 01 80 00 00 	movabs $0x80015e,%rax
+  800157:	00 00 00 
+  80015a:	ff d0                	call   *%rax
+}
+  80015c:	5d                   	pop    %rbp
+  80015d:	c3                   	ret
+
+000000000080015e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80015e:	55                   	push   %rbp
+  80015f:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  800162:	bf 00 00 00 00       	mov    $0x0,%edi
+  800167:	48 b8 ff 0d 80 00 00 	movabs $0x800dff,%rax
+  80016e:	00 00 00 
+  800171:	ff d0                	call   *%rax
+}
+  800173:	5d                   	pop    %rbp
+  800174:	c3                   	ret
+
+0000000000800175 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800175:	55                   	push   %rbp
+  800176:	48 89 e5             	mov    %rsp,%rbp
+  800179:	53                   	push   %rbx
+  80017a:	48 83 ec 08          	sub    $0x8,%rsp
+  80017e:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  800181:	8b 06                	mov    (%rsi),%eax
+  800183:	8d 50 01             	lea    0x1(%rax),%edx
+  800186:	89 16                	mov    %edx,(%rsi)
+  800188:	48 98                	cltq
+  80018a:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  80018f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800195:	74 0a                	je     8001a1 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800197:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80019b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80019f:	c9                   	leave
+  8001a0:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001a1:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001a5:	be ff 00 00 00       	mov    $0xff,%esi
+  8001aa:	48 b8 c7 0d 80 00 00 	movabs $0x800dc7,%rax
+  8001b1:	00 00 00 
+  8001b4:	ff d0                	call   *%rax
+		b->idx = 0;
+  8001b6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001bc:	eb d9                	jmp    800197 <putch+0x22>
+
+00000000008001be <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001be:	55                   	push   %rbp
+  8001bf:	48 89 e5             	mov    %rsp,%rbp
+  8001c2:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8001c9:	48 89 fa             	mov    %rdi,%rdx
+  8001cc:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  8001cf:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8001d6:	00 00 00 
+	b.cnt = 0;
+  8001d9:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8001e0:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001e3:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  8001ea:	48 bf 75 01 80 00 00 	movabs $0x800175,%rdi
+  8001f1:	00 00 00 
+  8001f4:	48 b8 dc 03 80 00 00 	movabs $0x8003dc,%rax
+  8001fb:	00 00 00 
+  8001fe:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  800200:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  800207:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80020e:	48 b8 c7 0d 80 00 00 	movabs $0x800dc7,%rax
+  800215:	00 00 00 
+  800218:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  80021a:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  800220:	c9                   	leave
+  800221:	c3                   	ret
+
+0000000000800222 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800222:	55                   	push   %rbp
+  800223:	48 89 e5             	mov    %rsp,%rbp
+  800226:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80022d:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800234:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80023b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800242:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800249:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800250:	84 c0                	test   %al,%al
+  800252:	74 20                	je     800274 <cprintf+0x52>
+  800254:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800258:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80025c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800260:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800264:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800268:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80026c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800270:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800274:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  80027b:	00 00 00 
+  80027e:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800285:	00 00 00 
+  800288:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80028c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800293:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80029a:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  8002a1:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  8002a8:	48 b8 be 01 80 00 00 	movabs $0x8001be,%rax
+  8002af:	00 00 00 
+  8002b2:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  8002b4:	c9                   	leave
+  8002b5:	c3                   	ret
+
+00000000008002b6 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002b6:	55                   	push   %rbp
+  8002b7:	48 89 e5             	mov    %rsp,%rbp
+  8002ba:	41 57                	push   %r15
+  8002bc:	41 56                	push   %r14
+  8002be:	41 55                	push   %r13
+  8002c0:	41 54                	push   %r12
+  8002c2:	53                   	push   %rbx
+  8002c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8002c7:	49 89 fc             	mov    %rdi,%r12
+  8002ca:	49 89 f5             	mov    %rsi,%r13
+  8002cd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002d1:	44 89 c3             	mov    %r8d,%ebx
+  8002d4:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002d7:	41 89 cf             	mov    %ecx,%r15d
+  8002da:	4c 39 fa             	cmp    %r15,%rdx
+  8002dd:	72 29                	jb     800308 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002df:	48 89 d0             	mov    %rdx,%rax
+  8002e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002e7:	49 f7 f7             	div    %r15
+  8002ea:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002ee:	48 89 c2             	mov    %rax,%rdx
+  8002f1:	48 b8 b6 02 80 00 00 	movabs $0x8002b6,%rax
+  8002f8:	00 00 00 
+  8002fb:	ff d0                	call   *%rax
+  8002fd:	eb 10                	jmp    80030f <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002ff:	4c 89 ee             	mov    %r13,%rsi
+  800302:	44 89 f7             	mov    %r14d,%edi
+  800305:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  800308:	83 eb 01             	sub    $0x1,%ebx
+  80030b:	85 db                	test   %ebx,%ebx
+  80030d:	7f f0                	jg     8002ff <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80030f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800313:	ba 00 00 00 00       	mov    $0x0,%edx
+  800318:	49 f7 f7             	div    %r15
+  80031b:	48 b8 a0 1c 80 00 00 	movabs $0x801ca0,%rax
+  800322:	00 00 00 
+  800325:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  800329:	4c 89 ee             	mov    %r13,%rsi
+  80032c:	41 ff d4             	call   *%r12
+}
+  80032f:	48 83 c4 18          	add    $0x18,%rsp
+  800333:	5b                   	pop    %rbx
+  800334:	41 5c                	pop    %r12
+  800336:	41 5d                	pop    %r13
+  800338:	41 5e                	pop    %r14
+  80033a:	41 5f                	pop    %r15
+  80033c:	5d                   	pop    %rbp
+  80033d:	c3                   	ret
+
+000000000080033e <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  80033e:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  800342:	48 8b 06             	mov    (%rsi),%rax
+  800345:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800349:	73 0a                	jae    800355 <sprintputch+0x17>
+		*b->buf++ = ch;
+  80034b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80034f:	48 89 16             	mov    %rdx,(%rsi)
+  800352:	40 88 38             	mov    %dil,(%rax)
+}
+  800355:	c3                   	ret
+
+0000000000800356 <printfmt>:
+{
+  800356:	55                   	push   %rbp
+  800357:	48 89 e5             	mov    %rsp,%rbp
+  80035a:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800361:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800368:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80036f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800376:	84 c0                	test   %al,%al
+  800378:	74 20                	je     80039a <printfmt+0x44>
+  80037a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80037e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800382:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800386:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80038a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80038e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800392:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800396:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  80039a:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8003a1:	00 00 00 
+  8003a4:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8003ab:	00 00 00 
+  8003ae:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003b2:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8003b9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8003c0:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8003c7:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8003ce:	48 b8 dc 03 80 00 00 	movabs $0x8003dc,%rax
+  8003d5:	00 00 00 
+  8003d8:	ff d0                	call   *%rax
+}
+  8003da:	c9                   	leave
+  8003db:	c3                   	ret
+
+00000000008003dc <vprintfmt>:
+{
+  8003dc:	55                   	push   %rbp
+  8003dd:	48 89 e5             	mov    %rsp,%rbp
+  8003e0:	41 57                	push   %r15
+  8003e2:	41 56                	push   %r14
+  8003e4:	41 55                	push   %r13
+  8003e6:	41 54                	push   %r12
+  8003e8:	53                   	push   %rbx
+  8003e9:	48 83 ec 48          	sub    $0x48,%rsp
+  8003ed:	49 89 fe             	mov    %rdi,%r14
+  8003f0:	49 89 f5             	mov    %rsi,%r13
+  8003f3:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  8003f6:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  8003fa:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  8003fe:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800402:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  800406:	eb 09                	jmp    800411 <vprintfmt+0x35>
+			putch(ch, putdat);
+  800408:	4c 89 ee             	mov    %r13,%rsi
+  80040b:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80040e:	4c 89 e3             	mov    %r12,%rbx
+  800411:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800415:	0f b6 3b             	movzbl (%rbx),%edi
+  800418:	83 ff 25             	cmp    $0x25,%edi
+  80041b:	74 13                	je     800430 <vprintfmt+0x54>
+			if (ch == '\0')
+  80041d:	85 ff                	test   %edi,%edi
+  80041f:	75 e7                	jne    800408 <vprintfmt+0x2c>
+}
+  800421:	48 83 c4 48          	add    $0x48,%rsp
+  800425:	5b                   	pop    %rbx
+  800426:	41 5c                	pop    %r12
+  800428:	41 5d                	pop    %r13
+  80042a:	41 5e                	pop    %r14
+  80042c:	41 5f                	pop    %r15
+  80042e:	5d                   	pop    %rbp
+  80042f:	c3                   	ret
+		padc = ' ';
+  800430:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  800434:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  80043b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  800441:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  800448:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80044d:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800452:	41 0f b6 14 24       	movzbl (%r12),%edx
+  800457:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  80045a:	3c 55                	cmp    $0x55,%al
+  80045c:	0f 87 4f 05 00 00    	ja     8009b1 <vprintfmt+0x5d5>
+  800462:	0f b6 c0             	movzbl %al,%eax
+  800465:	48 be 60 1d 80 00 00 	movabs $0x801d60,%rsi
+  80046c:	00 00 00 
+  80046f:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  800472:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  800475:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  800479:	eb d2                	jmp    80044d <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  80047b:	49 89 dc             	mov    %rbx,%r12
+  80047e:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  800482:	eb c9                	jmp    80044d <vprintfmt+0x71>
+  800484:	0f b6 d2             	movzbl %dl,%edx
+  800487:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  80048a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  800490:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800494:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  800499:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  80049e:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  8004a1:	83 f8 09             	cmp    $0x9,%eax
+  8004a4:	77 20                	ja     8004c6 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  8004a6:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  8004aa:	eb e4                	jmp    800490 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  8004ac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004af:	83 f8 2f             	cmp    $0x2f,%eax
+  8004b2:	77 27                	ja     8004db <vprintfmt+0xff>
+  8004b4:	89 c2                	mov    %eax,%edx
+  8004b6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004ba:	83 c0 08             	add    $0x8,%eax
+  8004bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004c0:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  8004c3:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  8004c6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004ca:	79 81                	jns    80044d <vprintfmt+0x71>
+				width = precision, precision = -1;
+  8004cc:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  8004d0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004d6:	e9 72 ff ff ff       	jmp    80044d <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  8004db:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004df:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004e7:	eb d7                	jmp    8004c0 <vprintfmt+0xe4>
+			if (width < 0)
+  8004e9:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  8004ec:	85 f6                	test   %esi,%esi
+  8004ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f3:	0f 49 c6             	cmovns %esi,%eax
+  8004f6:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004f9:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8004fc:	e9 4c ff ff ff       	jmp    80044d <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800501:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  800504:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  80050b:	e9 3d ff ff ff       	jmp    80044d <vprintfmt+0x71>
+			lflag++;
+  800510:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800513:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800516:	e9 32 ff ff ff       	jmp    80044d <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  80051b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80051e:	83 f8 2f             	cmp    $0x2f,%eax
+  800521:	77 19                	ja     80053c <vprintfmt+0x160>
+  800523:	89 c2                	mov    %eax,%edx
+  800525:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800529:	83 c0 08             	add    $0x8,%eax
+  80052c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80052f:	8b 3a                	mov    (%rdx),%edi
+  800531:	4c 89 ee             	mov    %r13,%rsi
+  800534:	41 ff d6             	call   *%r14
+			break;
+  800537:	e9 d5 fe ff ff       	jmp    800411 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  80053c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800540:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800544:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800548:	eb e5                	jmp    80052f <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  80054a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80054d:	83 f8 2f             	cmp    $0x2f,%eax
+  800550:	77 5a                	ja     8005ac <vprintfmt+0x1d0>
+  800552:	89 c2                	mov    %eax,%edx
+  800554:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800558:	83 c0 08             	add    $0x8,%eax
+  80055b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  80055e:	8b 02                	mov    (%rdx),%eax
+  800560:	89 c1                	mov    %eax,%ecx
+  800562:	f7 d9                	neg    %ecx
+  800564:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800567:	83 f9 08             	cmp    $0x8,%ecx
+  80056a:	7f 4e                	jg     8005ba <vprintfmt+0x1de>
+  80056c:	48 63 c1             	movslq %ecx,%rax
+  80056f:	48 ba 20 20 80 00 00 	movabs $0x802020,%rdx
+  800576:	00 00 00 
+  800579:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80057d:	48 85 c0             	test   %rax,%rax
+  800580:	74 38                	je     8005ba <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800582:	48 89 c1             	mov    %rax,%rcx
+  800585:	48 ba c1 1c 80 00 00 	movabs $0x801cc1,%rdx
+  80058c:	00 00 00 
+  80058f:	4c 89 ee             	mov    %r13,%rsi
+  800592:	4c 89 f7             	mov    %r14,%rdi
+  800595:	b8 00 00 00 00       	mov    $0x0,%eax
+  80059a:	49 b8 56 03 80 00 00 	movabs $0x800356,%r8
+  8005a1:	00 00 00 
+  8005a4:	41 ff d0             	call   *%r8
+  8005a7:	e9 65 fe ff ff       	jmp    800411 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  8005ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b8:	eb a4                	jmp    80055e <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  8005ba:	48 ba b8 1c 80 00 00 	movabs $0x801cb8,%rdx
+  8005c1:	00 00 00 
+  8005c4:	4c 89 ee             	mov    %r13,%rsi
+  8005c7:	4c 89 f7             	mov    %r14,%rdi
+  8005ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005cf:	49 b8 56 03 80 00 00 	movabs $0x800356,%r8
+  8005d6:	00 00 00 
+  8005d9:	41 ff d0             	call   *%r8
+  8005dc:	e9 30 fe ff ff       	jmp    800411 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  8005e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8005e7:	77 36                	ja     80061f <vprintfmt+0x243>
+  8005e9:	89 c2                	mov    %eax,%edx
+  8005eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005ef:	83 c0 08             	add    $0x8,%eax
+  8005f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005f5:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  8005f8:	48 85 c9             	test   %rcx,%rcx
+  8005fb:	48 b8 b1 1c 80 00 00 	movabs $0x801cb1,%rax
+  800602:	00 00 00 
+  800605:	48 0f 45 c1          	cmovne %rcx,%rax
+  800609:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  80060d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800611:	7e 06                	jle    800619 <vprintfmt+0x23d>
+  800613:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800617:	75 14                	jne    80062d <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800619:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80061d:	eb 64                	jmp    800683 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  80061f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800623:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800627:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80062b:	eb c8                	jmp    8005f5 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80062d:	49 63 f7             	movslq %r15d,%rsi
+  800630:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800634:	48 b8 bf 0a 80 00 00 	movabs $0x800abf,%rax
+  80063b:	00 00 00 
+  80063e:	ff d0                	call   *%rax
+  800640:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800643:	29 c1                	sub    %eax,%ecx
+  800645:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800648:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  80064b:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  80064f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800652:	eb 0d                	jmp    800661 <vprintfmt+0x285>
+					putch(padc, putdat);
+  800654:	4c 89 ee             	mov    %r13,%rsi
+  800657:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  80065a:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80065d:	41 83 ec 01          	sub    $0x1,%r12d
+  800661:	45 85 e4             	test   %r12d,%r12d
+  800664:	7f ee                	jg     800654 <vprintfmt+0x278>
+  800666:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  800669:	85 c9                	test   %ecx,%ecx
+  80066b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800670:	0f 49 c1             	cmovns %ecx,%eax
+  800673:	29 c1                	sub    %eax,%ecx
+  800675:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  800678:	eb 9f                	jmp    800619 <vprintfmt+0x23d>
+					putch(ch, putdat);
+  80067a:	4c 89 ee             	mov    %r13,%rsi
+  80067d:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800680:	4c 89 e2             	mov    %r12,%rdx
+  800683:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800687:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80068d:	0f be f8             	movsbl %al,%edi
+  800690:	85 ff                	test   %edi,%edi
+  800692:	74 29                	je     8006bd <vprintfmt+0x2e1>
+  800694:	45 85 ff             	test   %r15d,%r15d
+  800697:	78 06                	js     80069f <vprintfmt+0x2c3>
+  800699:	41 83 ef 01          	sub    $0x1,%r15d
+  80069d:	78 1e                	js     8006bd <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80069f:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  8006a3:	74 d5                	je     80067a <vprintfmt+0x29e>
+  8006a5:	0f be c0             	movsbl %al,%eax
+  8006a8:	83 e8 20             	sub    $0x20,%eax
+  8006ab:	83 f8 5e             	cmp    $0x5e,%eax
+  8006ae:	76 ca                	jbe    80067a <vprintfmt+0x29e>
+					putch('?', putdat);
+  8006b0:	4c 89 ee             	mov    %r13,%rsi
+  8006b3:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006b8:	41 ff d6             	call   *%r14
+  8006bb:	eb c3                	jmp    800680 <vprintfmt+0x2a4>
+  8006bd:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  8006c1:	8b 45 98             	mov    -0x68(%rbp),%eax
+  8006c4:	41 01 c4             	add    %eax,%r12d
+  8006c7:	41 29 d4             	sub    %edx,%r12d
+  8006ca:	eb 0f                	jmp    8006db <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  8006cc:	4c 89 ee             	mov    %r13,%rsi
+  8006cf:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006d4:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  8006d7:	41 83 ec 01          	sub    $0x1,%r12d
+  8006db:	45 85 e4             	test   %r12d,%r12d
+  8006de:	7f ec                	jg     8006cc <vprintfmt+0x2f0>
+  8006e0:	e9 2c fd ff ff       	jmp    800411 <vprintfmt+0x35>
+	if (lflag >= 2)
+  8006e5:	83 f9 01             	cmp    $0x1,%ecx
+  8006e8:	7f 1d                	jg     800707 <vprintfmt+0x32b>
+	else if (lflag)
+  8006ea:	85 c9                	test   %ecx,%ecx
+  8006ec:	74 5e                	je     80074c <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  8006ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8006f4:	77 48                	ja     80073e <vprintfmt+0x362>
+  8006f6:	89 c2                	mov    %eax,%edx
+  8006f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006fc:	83 c0 08             	add    $0x8,%eax
+  8006ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800702:	4c 8b 22             	mov    (%rdx),%r12
+  800705:	eb 17                	jmp    80071e <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800707:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80070a:	83 f8 2f             	cmp    $0x2f,%eax
+  80070d:	77 21                	ja     800730 <vprintfmt+0x354>
+  80070f:	89 c2                	mov    %eax,%edx
+  800711:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800715:	83 c0 08             	add    $0x8,%eax
+  800718:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80071b:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  80071e:	4d 85 e4             	test   %r12,%r12
+  800721:	78 50                	js     800773 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  800723:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800726:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80072b:	e9 b4 01 00 00       	jmp    8008e4 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800730:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800734:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800738:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80073c:	eb dd                	jmp    80071b <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  80073e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800742:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800746:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80074a:	eb b6                	jmp    800702 <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  80074c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80074f:	83 f8 2f             	cmp    $0x2f,%eax
+  800752:	77 11                	ja     800765 <vprintfmt+0x389>
+  800754:	89 c2                	mov    %eax,%edx
+  800756:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80075a:	83 c0 08             	add    $0x8,%eax
+  80075d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800760:	4c 63 22             	movslq (%rdx),%r12
+  800763:	eb b9                	jmp    80071e <vprintfmt+0x342>
+  800765:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800769:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80076d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800771:	eb ed                	jmp    800760 <vprintfmt+0x384>
+				putch('-', putdat);
+  800773:	4c 89 ee             	mov    %r13,%rsi
+  800776:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80077b:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  80077e:	4c 89 e2             	mov    %r12,%rdx
+  800781:	48 f7 da             	neg    %rdx
+			base = 10;
+  800784:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800789:	e9 56 01 00 00       	jmp    8008e4 <vprintfmt+0x508>
+	if (lflag >= 2)
+  80078e:	83 f9 01             	cmp    $0x1,%ecx
+  800791:	7f 25                	jg     8007b8 <vprintfmt+0x3dc>
+	else if (lflag)
+  800793:	85 c9                	test   %ecx,%ecx
+  800795:	74 5e                	je     8007f5 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800797:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80079a:	83 f8 2f             	cmp    $0x2f,%eax
+  80079d:	77 48                	ja     8007e7 <vprintfmt+0x40b>
+  80079f:	89 c2                	mov    %eax,%edx
+  8007a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a5:	83 c0 08             	add    $0x8,%eax
+  8007a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ab:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8007ae:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  8007b3:	e9 2c 01 00 00       	jmp    8008e4 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8007b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8007be:	77 19                	ja     8007d9 <vprintfmt+0x3fd>
+  8007c0:	89 c2                	mov    %eax,%edx
+  8007c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c6:	83 c0 08             	add    $0x8,%eax
+  8007c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007cc:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8007cf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  8007d4:	e9 0b 01 00 00       	jmp    8008e4 <vprintfmt+0x508>
+  8007d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007dd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e5:	eb e5                	jmp    8007cc <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  8007e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007eb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f3:	eb b6                	jmp    8007ab <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  8007f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fb:	77 18                	ja     800815 <vprintfmt+0x439>
+  8007fd:	89 c2                	mov    %eax,%edx
+  8007ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800803:	83 c0 08             	add    $0x8,%eax
+  800806:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800809:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  80080b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800810:	e9 cf 00 00 00       	jmp    8008e4 <vprintfmt+0x508>
+  800815:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800819:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80081d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800821:	eb e6                	jmp    800809 <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800823:	83 f9 01             	cmp    $0x1,%ecx
+  800826:	7f 25                	jg     80084d <vprintfmt+0x471>
+	else if (lflag)
+  800828:	85 c9                	test   %ecx,%ecx
+  80082a:	74 5b                	je     800887 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  80082c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082f:	83 f8 2f             	cmp    $0x2f,%eax
+  800832:	77 45                	ja     800879 <vprintfmt+0x49d>
+  800834:	89 c2                	mov    %eax,%edx
+  800836:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083a:	83 c0 08             	add    $0x8,%eax
+  80083d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800840:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800843:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800848:	e9 97 00 00 00       	jmp    8008e4 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  80084d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800850:	83 f8 2f             	cmp    $0x2f,%eax
+  800853:	77 16                	ja     80086b <vprintfmt+0x48f>
+  800855:	89 c2                	mov    %eax,%edx
+  800857:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085b:	83 c0 08             	add    $0x8,%eax
+  80085e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800861:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800864:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800869:	eb 79                	jmp    8008e4 <vprintfmt+0x508>
+  80086b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800873:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800877:	eb e8                	jmp    800861 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800879:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800881:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800885:	eb b9                	jmp    800840 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800887:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088a:	83 f8 2f             	cmp    $0x2f,%eax
+  80088d:	77 15                	ja     8008a4 <vprintfmt+0x4c8>
+  80088f:	89 c2                	mov    %eax,%edx
+  800891:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800895:	83 c0 08             	add    $0x8,%eax
+  800898:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089b:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  80089d:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  8008a2:	eb 40                	jmp    8008e4 <vprintfmt+0x508>
+  8008a4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b0:	eb e9                	jmp    80089b <vprintfmt+0x4bf>
+			putch('0', putdat);
+  8008b2:	4c 89 ee             	mov    %r13,%rsi
+  8008b5:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008ba:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  8008bd:	4c 89 ee             	mov    %r13,%rsi
+  8008c0:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008c5:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  8008c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ce:	77 34                	ja     800904 <vprintfmt+0x528>
+  8008d0:	89 c2                	mov    %eax,%edx
+  8008d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d6:	83 c0 08             	add    $0x8,%eax
+  8008d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  8008dc:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  8008df:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  8008e4:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  8008e9:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008ed:	4c 89 ee             	mov    %r13,%rsi
+  8008f0:	4c 89 f7             	mov    %r14,%rdi
+  8008f3:	48 b8 b6 02 80 00 00 	movabs $0x8002b6,%rax
+  8008fa:	00 00 00 
+  8008fd:	ff d0                	call   *%rax
+			break;
+  8008ff:	e9 0d fb ff ff       	jmp    800411 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800904:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800908:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80090c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800910:	eb ca                	jmp    8008dc <vprintfmt+0x500>
+	if (lflag >= 2)
+  800912:	83 f9 01             	cmp    $0x1,%ecx
+  800915:	7f 22                	jg     800939 <vprintfmt+0x55d>
+	else if (lflag)
+  800917:	85 c9                	test   %ecx,%ecx
+  800919:	74 58                	je     800973 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  80091b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091e:	83 f8 2f             	cmp    $0x2f,%eax
+  800921:	77 42                	ja     800965 <vprintfmt+0x589>
+  800923:	89 c2                	mov    %eax,%edx
+  800925:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800929:	83 c0 08             	add    $0x8,%eax
+  80092c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092f:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800932:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800937:	eb ab                	jmp    8008e4 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800939:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80093c:	83 f8 2f             	cmp    $0x2f,%eax
+  80093f:	77 16                	ja     800957 <vprintfmt+0x57b>
+  800941:	89 c2                	mov    %eax,%edx
+  800943:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800947:	83 c0 08             	add    $0x8,%eax
+  80094a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094d:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800950:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800955:	eb 8d                	jmp    8008e4 <vprintfmt+0x508>
+  800957:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800963:	eb e8                	jmp    80094d <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800965:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800969:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800971:	eb bc                	jmp    80092f <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800973:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800976:	83 f8 2f             	cmp    $0x2f,%eax
+  800979:	77 18                	ja     800993 <vprintfmt+0x5b7>
+  80097b:	89 c2                	mov    %eax,%edx
+  80097d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800981:	83 c0 08             	add    $0x8,%eax
+  800984:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800987:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800989:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  80098e:	e9 51 ff ff ff       	jmp    8008e4 <vprintfmt+0x508>
+  800993:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800997:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099f:	eb e6                	jmp    800987 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  8009a1:	4c 89 ee             	mov    %r13,%rsi
+  8009a4:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009a9:	41 ff d6             	call   *%r14
+			break;
+  8009ac:	e9 60 fa ff ff       	jmp    800411 <vprintfmt+0x35>
+			putch('%', putdat);
+  8009b1:	4c 89 ee             	mov    %r13,%rsi
+  8009b4:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009b9:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8009bc:	4c 89 e3             	mov    %r12,%rbx
+  8009bf:	eb 04                	jmp    8009c5 <vprintfmt+0x5e9>
+  8009c1:	48 83 eb 01          	sub    $0x1,%rbx
+  8009c5:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8009c9:	75 f6                	jne    8009c1 <vprintfmt+0x5e5>
+  8009cb:	e9 41 fa ff ff       	jmp    800411 <vprintfmt+0x35>
+
+00000000008009d0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009d0:	55                   	push   %rbp
+  8009d1:	48 89 e5             	mov    %rsp,%rbp
+  8009d4:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009d8:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8009dc:	48 63 c6             	movslq %esi,%rax
+  8009df:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  8009e4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  8009e8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  8009ef:	48 85 ff             	test   %rdi,%rdi
+  8009f2:	74 2a                	je     800a1e <vsnprintf+0x4e>
+  8009f4:	85 f6                	test   %esi,%esi
+  8009f6:	7e 26                	jle    800a1e <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009f8:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8009fc:	48 bf 3e 03 80 00 00 	movabs $0x80033e,%rdi
+  800a03:	00 00 00 
+  800a06:	48 b8 dc 03 80 00 00 	movabs $0x8003dc,%rax
+  800a0d:	00 00 00 
+  800a10:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a12:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800a16:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800a19:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800a1c:	c9                   	leave
+  800a1d:	c3                   	ret
+		return -E_INVAL;
+  800a1e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a23:	eb f7                	jmp    800a1c <vsnprintf+0x4c>
+
+0000000000800a25 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a25:	55                   	push   %rbp
+  800a26:	48 89 e5             	mov    %rsp,%rbp
+  800a29:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800a30:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800a37:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800a3e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800a45:	84 c0                	test   %al,%al
+  800a47:	74 20                	je     800a69 <snprintf+0x44>
+  800a49:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800a4d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800a51:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800a55:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800a59:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800a5d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800a61:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800a65:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a69:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800a70:	00 00 00 
+  800a73:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800a7a:	00 00 00 
+  800a7d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a81:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800a88:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800a8f:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a96:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800a9d:	48 b8 d0 09 80 00 00 	movabs $0x8009d0,%rax
+  800aa4:	00 00 00 
+  800aa7:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800aa9:	c9                   	leave
+  800aaa:	c3                   	ret
+
+0000000000800aab <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800aab:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ab0:	48 89 d0             	mov    %rdx,%rax
+  800ab3:	48 83 c2 01          	add    $0x1,%rdx
+  800ab7:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800abc:	75 f2                	jne    800ab0 <strlen+0x5>
+		n++;
+	return n;
+}
+  800abe:	c3                   	ret
+
+0000000000800abf <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800abf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac4:	eb 03                	jmp    800ac9 <strnlen+0xa>
+  800ac6:	48 89 d0             	mov    %rdx,%rax
+  800ac9:	48 39 c6             	cmp    %rax,%rsi
+  800acc:	74 0a                	je     800ad8 <strnlen+0x19>
+  800ace:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800ad2:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ad6:	75 ee                	jne    800ac6 <strnlen+0x7>
+		n++;
+	return n;
+}
+  800ad8:	c3                   	ret
+
+0000000000800ad9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800ad9:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800adc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ae1:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ae5:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ae8:	48 83 c2 01          	add    $0x1,%rdx
+  800aec:	84 c9                	test   %cl,%cl
+  800aee:	75 f1                	jne    800ae1 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800af0:	c3                   	ret
+
+0000000000800af1 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800af1:	55                   	push   %rbp
+  800af2:	48 89 e5             	mov    %rsp,%rbp
+  800af5:	41 54                	push   %r12
+  800af7:	53                   	push   %rbx
+  800af8:	48 89 fb             	mov    %rdi,%rbx
+  800afb:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800afe:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  800b05:	00 00 00 
+  800b08:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800b0a:	48 63 f8             	movslq %eax,%rdi
+  800b0d:	48 01 df             	add    %rbx,%rdi
+  800b10:	4c 89 e6             	mov    %r12,%rsi
+  800b13:	48 b8 d9 0a 80 00 00 	movabs $0x800ad9,%rax
+  800b1a:	00 00 00 
+  800b1d:	ff d0                	call   *%rax
+	return dst;
+}
+  800b1f:	48 89 d8             	mov    %rbx,%rax
+  800b22:	5b                   	pop    %rbx
+  800b23:	41 5c                	pop    %r12
+  800b25:	5d                   	pop    %rbp
+  800b26:	c3                   	ret
+
+0000000000800b27 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b27:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b2a:	48 01 fa             	add    %rdi,%rdx
+  800b2d:	48 89 f9             	mov    %rdi,%rcx
+  800b30:	eb 14                	jmp    800b46 <strncpy+0x1f>
+		*dst++ = *src;
+  800b32:	48 83 c1 01          	add    $0x1,%rcx
+  800b36:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b3a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b3e:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b42:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800b46:	48 39 d1             	cmp    %rdx,%rcx
+  800b49:	75 e7                	jne    800b32 <strncpy+0xb>
+	}
+	return ret;
+}
+  800b4b:	c3                   	ret
+
+0000000000800b4c <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b4c:	48 89 f8             	mov    %rdi,%rax
+  800b4f:	48 85 d2             	test   %rdx,%rdx
+  800b52:	74 27                	je     800b7b <strlcpy+0x2f>
+  800b54:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800b59:	48 89 fa             	mov    %rdi,%rdx
+  800b5c:	eb 0b                	jmp    800b69 <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b5e:	48 83 c6 01          	add    $0x1,%rsi
+  800b62:	48 83 c2 01          	add    $0x1,%rdx
+  800b66:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800b69:	48 39 c2             	cmp    %rax,%rdx
+  800b6c:	74 0a                	je     800b78 <strlcpy+0x2c>
+  800b6e:	0f b6 0e             	movzbl (%rsi),%ecx
+  800b71:	84 c9                	test   %cl,%cl
+  800b73:	75 e9                	jne    800b5e <strlcpy+0x12>
+  800b75:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800b78:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800b7b:	48 29 f8             	sub    %rdi,%rax
+}
+  800b7e:	c3                   	ret
+
+0000000000800b7f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800b7f:	eb 08                	jmp    800b89 <strcmp+0xa>
+		p++, q++;
+  800b81:	48 83 c7 01          	add    $0x1,%rdi
+  800b85:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800b89:	0f b6 07             	movzbl (%rdi),%eax
+  800b8c:	84 c0                	test   %al,%al
+  800b8e:	74 04                	je     800b94 <strcmp+0x15>
+  800b90:	3a 06                	cmp    (%rsi),%al
+  800b92:	74 ed                	je     800b81 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b94:	0f b6 c0             	movzbl %al,%eax
+  800b97:	0f b6 16             	movzbl (%rsi),%edx
+  800b9a:	29 d0                	sub    %edx,%eax
+}
+  800b9c:	c3                   	ret
+
+0000000000800b9d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800b9d:	eb 0c                	jmp    800bab <strncmp+0xe>
+		n--, p++, q++;
+  800b9f:	48 83 ea 01          	sub    $0x1,%rdx
+  800ba3:	48 83 c7 01          	add    $0x1,%rdi
+  800ba7:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800bab:	48 85 d2             	test   %rdx,%rdx
+  800bae:	74 14                	je     800bc4 <strncmp+0x27>
+  800bb0:	0f b6 07             	movzbl (%rdi),%eax
+  800bb3:	84 c0                	test   %al,%al
+  800bb5:	74 04                	je     800bbb <strncmp+0x1e>
+  800bb7:	3a 06                	cmp    (%rsi),%al
+  800bb9:	74 e4                	je     800b9f <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bbb:	0f b6 07             	movzbl (%rdi),%eax
+  800bbe:	0f b6 16             	movzbl (%rsi),%edx
+  800bc1:	29 d0                	sub    %edx,%eax
+}
+  800bc3:	c3                   	ret
+		return 0;
+  800bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc9:	c3                   	ret
+
+0000000000800bca <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800bca:	eb 04                	jmp    800bd0 <strchr+0x6>
+  800bcc:	48 83 c7 01          	add    $0x1,%rdi
+  800bd0:	0f b6 07             	movzbl (%rdi),%eax
+  800bd3:	84 c0                	test   %al,%al
+  800bd5:	74 09                	je     800be0 <strchr+0x16>
+		if (*s == c)
+  800bd7:	40 38 f0             	cmp    %sil,%al
+  800bda:	75 f0                	jne    800bcc <strchr+0x2>
+  800bdc:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800bdf:	c3                   	ret
+	return 0;
+  800be0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be5:	c3                   	ret
+
+0000000000800be6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800be6:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800be9:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800bec:	40 38 f2             	cmp    %sil,%dl
+  800bef:	74 0a                	je     800bfb <strfind+0x15>
+  800bf1:	84 d2                	test   %dl,%dl
+  800bf3:	74 06                	je     800bfb <strfind+0x15>
+	for (; *s; s++)
+  800bf5:	48 83 c0 01          	add    $0x1,%rax
+  800bf9:	eb ee                	jmp    800be9 <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800bfb:	c3                   	ret
+
+0000000000800bfc <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800bfc:	48 85 d2             	test   %rdx,%rdx
+  800bff:	74 28                	je     800c29 <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800c01:	48 89 f8             	mov    %rdi,%rax
+  800c04:	48 09 d0             	or     %rdx,%rax
+  800c07:	a8 03                	test   $0x3,%al
+  800c09:	75 16                	jne    800c21 <memset+0x25>
+		c &= 0xFF;
+  800c0b:	40 0f b6 f6          	movzbl %sil,%esi
+  800c0f:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c15:	48 89 d1             	mov    %rdx,%rcx
+  800c18:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800c1c:	fc                   	cld
+  800c1d:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800c1f:	eb 08                	jmp    800c29 <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c21:	89 f0                	mov    %esi,%eax
+  800c23:	48 89 d1             	mov    %rdx,%rcx
+  800c26:	fc                   	cld
+  800c27:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c29:	48 89 f8             	mov    %rdi,%rax
+  800c2c:	c3                   	ret
+
+0000000000800c2d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c2d:	48 89 f8             	mov    %rdi,%rax
+  800c30:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c33:	48 39 fe             	cmp    %rdi,%rsi
+  800c36:	73 3a                	jae    800c72 <memmove+0x45>
+  800c38:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800c3c:	48 39 d7             	cmp    %rdx,%rdi
+  800c3f:	73 31                	jae    800c72 <memmove+0x45>
+		s += n;
+		d += n;
+  800c41:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800c45:	48 89 d6             	mov    %rdx,%rsi
+  800c48:	48 09 fe             	or     %rdi,%rsi
+  800c4b:	48 09 ce             	or     %rcx,%rsi
+  800c4e:	40 f6 c6 03          	test   $0x3,%sil
+  800c52:	75 11                	jne    800c65 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c54:	48 83 ef 04          	sub    $0x4,%rdi
+  800c58:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800c5c:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800c60:	fd                   	std
+  800c61:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800c63:	eb 0b                	jmp    800c70 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c65:	48 83 ef 01          	sub    $0x1,%rdi
+  800c69:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800c6d:	fd                   	std
+  800c6e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c70:	fc                   	cld
+  800c71:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800c72:	48 89 f2             	mov    %rsi,%rdx
+  800c75:	48 09 c2             	or     %rax,%rdx
+  800c78:	48 09 ca             	or     %rcx,%rdx
+  800c7b:	f6 c2 03             	test   $0x3,%dl
+  800c7e:	75 0b                	jne    800c8b <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c80:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800c84:	48 89 c7             	mov    %rax,%rdi
+  800c87:	fc                   	cld
+  800c88:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800c8a:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800c8b:	48 89 c7             	mov    %rax,%rdi
+  800c8e:	fc                   	cld
+  800c8f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c91:	c3                   	ret
+
+0000000000800c92 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c92:	55                   	push   %rbp
+  800c93:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800c96:	48 b8 2d 0c 80 00 00 	movabs $0x800c2d,%rax
+  800c9d:	00 00 00 
+  800ca0:	ff d0                	call   *%rax
+}
+  800ca2:	5d                   	pop    %rbp
+  800ca3:	c3                   	ret
+
+0000000000800ca4 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca9:	48 39 c2             	cmp    %rax,%rdx
+  800cac:	74 1e                	je     800ccc <memcmp+0x28>
+		if (*s1 != *s2)
+  800cae:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800cb2:	48 83 c0 01          	add    $0x1,%rax
+  800cb6:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800cbc:	44 38 c1             	cmp    %r8b,%cl
+  800cbf:	74 e8                	je     800ca9 <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800cc1:	0f b6 c1             	movzbl %cl,%eax
+  800cc4:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800cc8:	44 29 c0             	sub    %r8d,%eax
+  800ccb:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800ccc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cd1:	c3                   	ret
+
+0000000000800cd2 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cd2:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800cd5:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800cd8:	eb 04                	jmp    800cde <memfind+0xc>
+  800cda:	48 83 c0 01          	add    $0x1,%rax
+  800cde:	48 39 d0             	cmp    %rdx,%rax
+  800ce1:	73 05                	jae    800ce8 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ce3:	40 38 30             	cmp    %sil,(%rax)
+  800ce6:	75 f2                	jne    800cda <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800ce8:	c3                   	ret
+
+0000000000800ce9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ce9:	48 89 f9             	mov    %rdi,%rcx
+  800cec:	49 89 f0             	mov    %rsi,%r8
+  800cef:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cf1:	eb 04                	jmp    800cf7 <strtol+0xe>
+		s++;
+  800cf3:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800cf7:	0f b6 01             	movzbl (%rcx),%eax
+  800cfa:	3c 20                	cmp    $0x20,%al
+  800cfc:	74 f5                	je     800cf3 <strtol+0xa>
+  800cfe:	3c 09                	cmp    $0x9,%al
+  800d00:	74 f1                	je     800cf3 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d02:	3c 2b                	cmp    $0x2b,%al
+  800d04:	74 2b                	je     800d31 <strtol+0x48>
+	int neg = 0;
+  800d06:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800d0c:	3c 2d                	cmp    $0x2d,%al
+  800d0e:	74 2d                	je     800d3d <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d10:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800d16:	75 0f                	jne    800d27 <strtol+0x3e>
+  800d18:	80 39 30             	cmpb   $0x30,(%rcx)
+  800d1b:	74 2c                	je     800d49 <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d1d:	85 ff                	test   %edi,%edi
+  800d1f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d24:	0f 44 f8             	cmove  %eax,%edi
+  800d27:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800d2c:	4c 63 d7             	movslq %edi,%r10
+  800d2f:	eb 4f                	jmp    800d80 <strtol+0x97>
+		s++;
+  800d31:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800d35:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800d3b:	eb d3                	jmp    800d10 <strtol+0x27>
+		s++, neg = 1;
+  800d3d:	48 83 c1 01          	add    $0x1,%rcx
+  800d41:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800d47:	eb c7                	jmp    800d10 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d49:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800d4d:	74 0f                	je     800d5e <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800d4f:	85 ff                	test   %edi,%edi
+  800d51:	75 d4                	jne    800d27 <strtol+0x3e>
+		s++, base = 8;
+  800d53:	48 83 c1 01          	add    $0x1,%rcx
+  800d57:	bf 08 00 00 00       	mov    $0x8,%edi
+  800d5c:	eb c9                	jmp    800d27 <strtol+0x3e>
+		s += 2, base = 16;
+  800d5e:	48 83 c1 02          	add    $0x2,%rcx
+  800d62:	bf 10 00 00 00       	mov    $0x10,%edi
+  800d67:	eb be                	jmp    800d27 <strtol+0x3e>
+			dig = *s - '0';
+  800d69:	0f be c0             	movsbl %al,%eax
+  800d6c:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800d6f:	39 f8                	cmp    %edi,%eax
+  800d71:	7d 3b                	jge    800dae <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800d73:	48 83 c1 01          	add    $0x1,%rcx
+  800d77:	49 0f af d2          	imul   %r10,%rdx
+  800d7b:	48 98                	cltq
+  800d7d:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800d80:	0f b6 01             	movzbl (%rcx),%eax
+  800d83:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800d86:	40 80 fe 09          	cmp    $0x9,%sil
+  800d8a:	76 dd                	jbe    800d69 <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800d8c:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800d8f:	40 80 fe 19          	cmp    $0x19,%sil
+  800d93:	77 08                	ja     800d9d <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800d95:	0f be c0             	movsbl %al,%eax
+  800d98:	83 e8 57             	sub    $0x57,%eax
+  800d9b:	eb d2                	jmp    800d6f <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d9d:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800da0:	40 80 fe 19          	cmp    $0x19,%sil
+  800da4:	77 08                	ja     800dae <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800da6:	0f be c0             	movsbl %al,%eax
+  800da9:	83 e8 37             	sub    $0x37,%eax
+  800dac:	eb c1                	jmp    800d6f <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800dae:	4d 85 c0             	test   %r8,%r8
+  800db1:	74 03                	je     800db6 <strtol+0xcd>
+		*endptr = (char *) s;
+  800db3:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800db6:	48 89 d0             	mov    %rdx,%rax
+  800db9:	48 f7 d8             	neg    %rax
+  800dbc:	45 85 c9             	test   %r9d,%r9d
+  800dbf:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800dc3:	48 89 d0             	mov    %rdx,%rax
+  800dc6:	c3                   	ret
+
+0000000000800dc7 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800dc7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800dcd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800dd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ddd:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800ddf:	c3                   	ret
+
+0000000000800de0 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800de0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800de6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800dec:	bf 00 00 00 00       	mov    $0x0,%edi
+  800df1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800df6:	48 89 fe             	mov    %rdi,%rsi
+  800df9:	48 89 fa             	mov    %rdi,%rdx
+  800dfc:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dfe:	c3                   	ret
+
+0000000000800dff <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800dff:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800e02:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800e08:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800e0e:	be 00 00 00 00       	mov    $0x0,%esi
+  800e13:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e18:	48 89 f2             	mov    %rsi,%rdx
+  800e1b:	0f 05                	syscall
+	if(check && ret > 0)
+  800e1d:	48 85 c0             	test   %rax,%rax
+  800e20:	7f 01                	jg     800e23 <sys_env_destroy+0x24>
+}
+  800e22:	c3                   	ret
+{
+  800e23:	55                   	push   %rbp
+  800e24:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e27:	49 89 c0             	mov    %rax,%r8
+  800e2a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800e2f:	48 ba 68 20 80 00 00 	movabs $0x802068,%rdx
+  800e36:	00 00 00 
+  800e39:	be 28 00 00 00       	mov    $0x28,%esi
+  800e3e:	48 bf 85 20 80 00 00 	movabs $0x802085,%rdi
+  800e45:	00 00 00 
+  800e48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4d:	49 b9 5f 1a 80 00 00 	movabs $0x801a5f,%r9
+  800e54:	00 00 00 
+  800e57:	41 ff d1             	call   *%r9
+
+0000000000800e5a <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800e5a:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800e61:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800e62:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800e67:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800e6b:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800e6f:	48 c1 e2 04          	shl    $0x4,%rdx
+  800e73:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800e7a:	00 00 00 
+  800e7d:	48 01 d0             	add    %rdx,%rax
+  800e80:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800e86:	c3                   	ret
+
+0000000000800e87 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800e87:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800e8d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800e93:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e98:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e9d:	48 89 fe             	mov    %rdi,%rsi
+  800ea0:	48 89 fa             	mov    %rdi,%rdx
+  800ea3:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ea5:	c3                   	ret
+
+0000000000800ea6 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  800ea6:	48 63 d2             	movslq %edx,%rdx
+  800ea9:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800eac:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800eb2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800eb8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ebd:	0f 05                	syscall
+	if(check && ret > 0)
+  800ebf:	48 85 c0             	test   %rax,%rax
+  800ec2:	7f 01                	jg     800ec5 <sys_page_alloc+0x1f>
+}
+  800ec4:	c3                   	ret
+{
+  800ec5:	55                   	push   %rbp
+  800ec6:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec9:	49 89 c0             	mov    %rax,%r8
+  800ecc:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800ed1:	48 ba 68 20 80 00 00 	movabs $0x802068,%rdx
+  800ed8:	00 00 00 
+  800edb:	be 28 00 00 00       	mov    $0x28,%esi
+  800ee0:	48 bf 85 20 80 00 00 	movabs $0x802085,%rdi
+  800ee7:	00 00 00 
+  800eea:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eef:	49 b9 5f 1a 80 00 00 	movabs $0x801a5f,%r9
+  800ef6:	00 00 00 
+  800ef9:	41 ff d1             	call   *%r9
+
+0000000000800efc <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  800efc:	48 63 d2             	movslq %edx,%rdx
+  800eff:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800f02:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f08:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f0e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f13:	0f 05                	syscall
+	if(check && ret > 0)
+  800f15:	48 85 c0             	test   %rax,%rax
+  800f18:	7f 01                	jg     800f1b <sys_page_alloc_huge+0x1f>
+}
+  800f1a:	c3                   	ret
+{
+  800f1b:	55                   	push   %rbp
+  800f1c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f1f:	49 89 c0             	mov    %rax,%r8
+  800f22:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800f27:	48 ba 68 20 80 00 00 	movabs $0x802068,%rdx
+  800f2e:	00 00 00 
+  800f31:	be 28 00 00 00       	mov    $0x28,%esi
+  800f36:	48 bf 85 20 80 00 00 	movabs $0x802085,%rdi
+  800f3d:	00 00 00 
+  800f40:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f45:	49 b9 5f 1a 80 00 00 	movabs $0x801a5f,%r9
+  800f4c:	00 00 00 
+  800f4f:	41 ff d1             	call   *%r9
+
+0000000000800f52 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f52:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  800f55:	48 63 d2             	movslq %edx,%rdx
+  800f58:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800f5b:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  800f5e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f63:	0f 05                	syscall
+	if(check && ret > 0)
+  800f65:	48 85 c0             	test   %rax,%rax
+  800f68:	7f 01                	jg     800f6b <sys_page_map+0x19>
+}
+  800f6a:	c3                   	ret
+{
+  800f6b:	55                   	push   %rbp
+  800f6c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6f:	49 89 c0             	mov    %rax,%r8
+  800f72:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800f77:	48 ba 68 20 80 00 00 	movabs $0x802068,%rdx
+  800f7e:	00 00 00 
+  800f81:	be 28 00 00 00       	mov    $0x28,%esi
+  800f86:	48 bf 85 20 80 00 00 	movabs $0x802085,%rdi
+  800f8d:	00 00 00 
+  800f90:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f95:	49 b9 5f 1a 80 00 00 	movabs $0x801a5f,%r9
+  800f9c:	00 00 00 
+  800f9f:	41 ff d1             	call   *%r9
+
+0000000000800fa2 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  800fa2:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800fa5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb6:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fbb:	0f 05                	syscall
+	if(check && ret > 0)
+  800fbd:	48 85 c0             	test   %rax,%rax
+  800fc0:	7f 01                	jg     800fc3 <sys_page_unmap+0x21>
+}
+  800fc2:	c3                   	ret
+{
+  800fc3:	55                   	push   %rbp
+  800fc4:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc7:	49 89 c0             	mov    %rax,%r8
+  800fca:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800fcf:	48 ba 68 20 80 00 00 	movabs $0x802068,%rdx
+  800fd6:	00 00 00 
+  800fd9:	be 28 00 00 00       	mov    $0x28,%esi
+  800fde:	48 bf 85 20 80 00 00 	movabs $0x802085,%rdi
+  800fe5:	00 00 00 
+  800fe8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fed:	49 b9 5f 1a 80 00 00 	movabs $0x801a5f,%r9
+  800ff4:	00 00 00 
+  800ff7:	41 ff d1             	call   *%r9
+
+0000000000800ffa <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  800ffa:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801000:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801006:	bf 00 00 00 00       	mov    $0x0,%edi
+  80100b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801010:	48 89 fe             	mov    %rdi,%rsi
+  801013:	48 89 fa             	mov    %rdi,%rdx
+  801016:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801018:	c3                   	ret
+
+0000000000801019 <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  801019:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80101f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801025:	ba 00 00 00 00       	mov    $0x0,%edx
+  80102a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80102f:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  801031:	c3                   	ret
+
+0000000000801032 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  801032:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801038:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80103e:	b8 11 00 00 00       	mov    $0x11,%eax
+  801043:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  801045:	c3                   	ret
+
+0000000000801046 <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  801046:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  801049:	48 63 f6             	movslq %esi,%rsi
+  80104c:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  80104f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801055:	b8 12 00 00 00       	mov    $0x12,%eax
+  80105a:	0f 05                	syscall
+	if(check && ret > 0)
+  80105c:	48 85 c0             	test   %rax,%rax
+  80105f:	7f 01                	jg     801062 <sys_page_batch+0x1c>
+}
+  801061:	c3                   	ret
+{
+  801062:	55                   	push   %rbp
+  801063:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801066:	49 89 c0             	mov    %rax,%r8
+  801069:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80106e:	48 ba 68 20 80 00 00 	movabs $0x802068,%rdx
+  801075:	00 00 00 
+  801078:	be 28 00 00 00       	mov    $0x28,%esi
+  80107d:	48 bf 85 20 80 00 00 	movabs $0x802085,%rdi
+  801084:	00 00 00 
+  801087:	b8 00 00 00 00       	mov    $0x0,%eax
+  80108c:	49 b9 5f 1a 80 00 00 	movabs $0x801a5f,%r9
+  801093:	00 00 00 
+  801096:	41 ff d1             	call   *%r9
+
+0000000000801099 <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  801099:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80109f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010aa:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010af:	48 89 f2             	mov    %rsi,%rdx
+  8010b2:	0f 05                	syscall
+	if(check && ret > 0)
+  8010b4:	48 85 c0             	test   %rax,%rax
+  8010b7:	7f 01                	jg     8010ba <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  8010b9:	c3                   	ret
+{
+  8010ba:	55                   	push   %rbp
+  8010bb:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010be:	49 89 c0             	mov    %rax,%r8
+  8010c1:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8010c6:	48 ba 68 20 80 00 00 	movabs $0x802068,%rdx
+  8010cd:	00 00 00 
+  8010d0:	be 28 00 00 00       	mov    $0x28,%esi
+  8010d5:	48 bf 85 20 80 00 00 	movabs $0x802085,%rdi
+  8010dc:	00 00 00 
+  8010df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e4:	49 b9 5f 1a 80 00 00 	movabs $0x801a5f,%r9
+  8010eb:	00 00 00 
+  8010ee:	41 ff d1             	call   *%r9
+
+00000000008010f1 <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  8010f1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801102:	b8 14 00 00 00       	mov    $0x14,%eax
+  801107:	48 89 fe             	mov    %rdi,%rsi
+  80110a:	48 89 fa             	mov    %rdi,%rdx
+  80110d:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80110f:	c3                   	ret
+
+0000000000801110 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  801110:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801113:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801119:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80111f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801124:	0f 05                	syscall
+	if(check && ret > 0)
+  801126:	48 85 c0             	test   %rax,%rax
+  801129:	7f 01                	jg     80112c <sys_page_unmap_range+0x1c>
+}
+  80112b:	c3                   	ret
+{
+  80112c:	55                   	push   %rbp
+  80112d:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801130:	49 89 c0             	mov    %rax,%r8
+  801133:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801138:	48 ba 68 20 80 00 00 	movabs $0x802068,%rdx
+  80113f:	00 00 00 
+  801142:	be 28 00 00 00       	mov    $0x28,%esi
+  801147:	48 bf 85 20 80 00 00 	movabs $0x802085,%rdi
+  80114e:	00 00 00 
+  801151:	b8 00 00 00 00       	mov    $0x0,%eax
+  801156:	49 b9 5f 1a 80 00 00 	movabs $0x801a5f,%r9
+  80115d:	00 00 00 
+  801160:	41 ff d1             	call   *%r9
+
+0000000000801163 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801163:	48 63 f6             	movslq %esi,%rsi
+  801166:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801169:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80116f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801175:	ba 00 00 00 00       	mov    $0x0,%edx
+  80117a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80117f:	0f 05                	syscall
+	if(check && ret > 0)
+  801181:	48 85 c0             	test   %rax,%rax
+  801184:	7f 01                	jg     801187 <sys_env_set_status+0x24>
+}
+  801186:	c3                   	ret
+{
+  801187:	55                   	push   %rbp
+  801188:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80118b:	49 89 c0             	mov    %rax,%r8
+  80118e:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801193:	48 ba 68 20 80 00 00 	movabs $0x802068,%rdx
+  80119a:	00 00 00 
+  80119d:	be 28 00 00 00       	mov    $0x28,%esi
+  8011a2:	48 bf 85 20 80 00 00 	movabs $0x802085,%rdi
+  8011a9:	00 00 00 
+  8011ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b1:	49 b9 5f 1a 80 00 00 	movabs $0x801a5f,%r9
+  8011b8:	00 00 00 
+  8011bb:	41 ff d1             	call   *%r9
+
+00000000008011be <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8011be:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8011c1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011d2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011d7:	0f 05                	syscall
+	if(check && ret > 0)
+  8011d9:	48 85 c0             	test   %rax,%rax
+  8011dc:	7f 01                	jg     8011df <sys_env_set_pgfault_upcall+0x21>
+}
+  8011de:	c3                   	ret
+{
+  8011df:	55                   	push   %rbp
+  8011e0:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e3:	49 89 c0             	mov    %rax,%r8
+  8011e6:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8011eb:	48 ba 68 20 80 00 00 	movabs $0x802068,%rdx
+  8011f2:	00 00 00 
+  8011f5:	be 28 00 00 00       	mov    $0x28,%esi
+  8011fa:	48 bf 85 20 80 00 00 	movabs $0x802085,%rdi
+  801201:	00 00 00 
+  801204:	b8 00 00 00 00       	mov    $0x0,%eax
+  801209:	49 b9 5f 1a 80 00 00 	movabs $0x801a5f,%r9
+  801210:	00 00 00 
+  801213:	41 ff d1             	call   *%r9
+
+0000000000801216 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  801216:	48 63 ff             	movslq %edi,%rdi
+  801219:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  80121c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801222:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801227:	0f 05                	syscall
+}
+  801229:	c3                   	ret
+
+000000000080122a <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  80122a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801230:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801236:	be 00 00 00 00       	mov    $0x0,%esi
+  80123b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801240:	48 89 f2             	mov    %rsi,%rdx
+  801243:	0f 05                	syscall
+	if(check && ret > 0)
+  801245:	48 85 c0             	test   %rax,%rax
+  801248:	7f 01                	jg     80124b <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  80124a:	c3                   	ret
+{
+  80124b:	55                   	push   %rbp
+  80124c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80124f:	49 89 c0             	mov    %rax,%r8
+  801252:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801257:	48 ba 68 20 80 00 00 	movabs $0x802068,%rdx
+  80125e:	00 00 00 
+  801261:	be 28 00 00 00       	mov    $0x28,%esi
+  801266:	48 bf 85 20 80 00 00 	movabs $0x802085,%rdi
+  80126d:	00 00 00 
+  801270:	b8 00 00 00 00       	mov    $0x0,%eax
+  801275:	49 b9 5f 1a 80 00 00 	movabs $0x801a5f,%r9
+  80127c:	00 00 00 
+  80127f:	41 ff d1             	call   *%r9
+
+0000000000801282 <pgfault>:
+- unmap PFTEMP using sys_page_unmap()
+- panic if any step fails
+*/
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801282:	55                   	push   %rbp
+  801283:	48 89 e5             	mov    %rsp,%rbp
+  801286:	53                   	push   %rbx
+  801287:	48 83 ec 08          	sub    $0x8,%rsp
+	void *addr = (void *) utf->utf_fault_va;
+  80128b:	48 8b 1f             	mov    (%rdi),%rbx
+	uint32_t err = utf->utf_err;
+  80128e:	48 8b 47 08          	mov    0x8(%rdi),%rax
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+
+	if (!(err & FEC_WR)) {
+  801292:	a8 02                	test   $0x2,%al
+  801294:	0f 84 b1 00 00 00    	je     80134b <pgfault+0xc9>
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+	}
+	pte_t pte = uvpt[PGNUM(addr)];
+  80129a:	48 89 da             	mov    %rbx,%rdx
+  80129d:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8012a1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8012a8:	01 00 00 
+  8012ab:	48 8b 0c d0          	mov    (%rax,%rdx,8),%rcx
+	if (!(pte & PTE_COW)) {
+  8012af:	f6 c5 08             	test   $0x8,%ch
+  8012b2:	0f 84 c3 00 00 00    	je     80137b <pgfault+0xf9>
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+
+	void *pg_addr = ROUNDDOWN(addr, PGSIZE);
+  8012b8:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  8012bf:	ba 07 00 00 00       	mov    $0x7,%edx
+  8012c4:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8012c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012ce:	48 b8 a6 0e 80 00 00 	movabs $0x800ea6,%rax
+  8012d5:	00 00 00 
+  8012d8:	ff d0                	call   *%rax
+	if (r < 0) {
+  8012da:	85 c0                	test   %eax,%eax
+  8012dc:	0f 88 c7 00 00 00    	js     8013a9 <pgfault+0x127>
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+	}
+	memmove(PFTEMP, pg_addr, PGSIZE);
+  8012e2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012e7:	48 89 de             	mov    %rbx,%rsi
+  8012ea:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  8012ef:	48 b8 2d 0c 80 00 00 	movabs $0x800c2d,%rax
+  8012f6:	00 00 00 
+  8012f9:	ff d0                	call   *%rax
+	r = sys_page_map(0, PFTEMP, 0, pg_addr, PTE_P | PTE_U | PTE_W);
+  8012fb:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  801301:	48 89 d9             	mov    %rbx,%rcx
+  801304:	ba 00 00 00 00       	mov    $0x0,%edx
+  801309:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  80130e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801313:	48 b8 52 0f 80 00 00 	movabs $0x800f52,%rax
+  80131a:	00 00 00 
+  80131d:	ff d0                	call   *%rax
+	if (r < 0) {
+  80131f:	85 c0                	test   %eax,%eax
+  801321:	0f 88 af 00 00 00    	js     8013d6 <pgfault+0x154>
+		panic("pgfault: sys_page_map failed:  %e", r);
+	}
+	r = sys_page_unmap(0, PFTEMP);
+  801327:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  80132c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801331:	48 b8 a2 0f 80 00 00 	movabs $0x800fa2,%rax
+  801338:	00 00 00 
+  80133b:	ff d0                	call   *%rax
+	if (r < 0) {
+  80133d:	85 c0                	test   %eax,%eax
+  80133f:	0f 88 be 00 00 00    	js     801403 <pgfault+0x181>
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+	}
+}
+  801345:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801349:	c9                   	leave
+  80134a:	c3                   	ret
+  80134b:	89 c1                	mov    %eax,%ecx
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+  80134d:	49 89 d8             	mov    %rbx,%r8
+  801350:	48 ba 98 20 80 00 00 	movabs $0x802098,%rdx
+  801357:	00 00 00 
+  80135a:	be 32 00 00 00       	mov    $0x32,%esi
+  80135f:	48 bf 47 22 80 00 00 	movabs $0x802247,%rdi
+  801366:	00 00 00 
+  801369:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136e:	49 b9 5f 1a 80 00 00 	movabs $0x801a5f,%r9
+  801375:	00 00 00 
+  801378:	41 ff d1             	call   *%r9
+		panic("pgfault: page is not marked copy-on-write (pte=%p, va=%p)", pte, addr);
+  80137b:	49 89 d8             	mov    %rbx,%r8
+  80137e:	48 ba c0 20 80 00 00 	movabs $0x8020c0,%rdx
+  801385:	00 00 00 
+  801388:	be 36 00 00 00       	mov    $0x36,%esi
+  80138d:	48 bf 47 22 80 00 00 	movabs $0x802247,%rdi
+  801394:	00 00 00 
+  801397:	b8 00 00 00 00       	mov    $0x0,%eax
+  80139c:	49 b9 5f 1a 80 00 00 	movabs $0x801a5f,%r9
+  8013a3:	00 00 00 
+  8013a6:	41 ff d1             	call   *%r9
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+  8013a9:	89 c1                	mov    %eax,%ecx
+  8013ab:	48 ba 00 21 80 00 00 	movabs $0x802100,%rdx
+  8013b2:	00 00 00 
+  8013b5:	be 44 00 00 00       	mov    $0x44,%esi
+  8013ba:	48 bf 47 22 80 00 00 	movabs $0x802247,%rdi
+  8013c1:	00 00 00 
+  8013c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c9:	49 b8 5f 1a 80 00 00 	movabs $0x801a5f,%r8
+  8013d0:	00 00 00 
+  8013d3:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_map failed:  %e", r);
+  8013d6:	89 c1                	mov    %eax,%ecx
+  8013d8:	48 ba 28 21 80 00 00 	movabs $0x802128,%rdx
+  8013df:	00 00 00 
+  8013e2:	be 49 00 00 00       	mov    $0x49,%esi
+  8013e7:	48 bf 47 22 80 00 00 	movabs $0x802247,%rdi
+  8013ee:	00 00 00 
+  8013f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f6:	49 b8 5f 1a 80 00 00 	movabs $0x801a5f,%r8
+  8013fd:	00 00 00 
+  801400:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+  801403:	89 c1                	mov    %eax,%ecx
+  801405:	48 ba 50 21 80 00 00 	movabs $0x802150,%rdx
+  80140c:	00 00 00 
+  80140f:	be 4d 00 00 00       	mov    $0x4d,%esi
+  801414:	48 bf 47 22 80 00 00 	movabs $0x802247,%rdi
+  80141b:	00 00 00 
+  80141e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801423:	49 b8 5f 1a 80 00 00 	movabs $0x801a5f,%r8
+  80142a:	00 00 00 
+  80142d:	41 ff d0             	call   *%r8
+
+0000000000801430 <dupflush>:
+static struct PageOp dup_child[DUP_BATCH], dup_self[DUP_BATCH];
+static int ndup_child, ndup_self;
+
+static int
+dupflush(envid_t envid)
+{
+  801430:	55                   	push   %rbp
+  801431:	48 89 e5             	mov    %rsp,%rbp
+  801434:	89 fe                	mov    %edi,%esi
+	int r;
+
+	// Map to child first, then remap parent
+	r = sys_page_batch(0, envid, dup_child, ndup_child);
+  801436:	a1 24 30 80 00 00 00 	movabs 0x803024,%eax
+  80143d:	00 00 
+  80143f:	48 63 c8             	movslq %eax,%rcx
+  801442:	48 ba 40 36 80 00 00 	movabs $0x803640,%rdx
+  801449:	00 00 00 
+  80144c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801451:	48 b8 46 10 80 00 00 	movabs $0x801046,%rax
+  801458:	00 00 00 
+  80145b:	ff d0                	call   *%rax
+	if (r < 0) {
+  80145d:	85 c0                	test   %eax,%eax
+  80145f:	78 57                	js     8014b8 <dupflush+0x88>
+		panic("duppage: child map failed: %e", r);
+		return r;
+	}
+	r = sys_page_batch(0, 0, dup_self, ndup_self);
+  801461:	a1 20 30 80 00 00 00 	movabs 0x803020,%eax
+  801468:	00 00 
+  80146a:	48 63 c8             	movslq %eax,%rcx
+  80146d:	48 ba 40 30 80 00 00 	movabs $0x803040,%rdx
+  801474:	00 00 00 
+  801477:	be 00 00 00 00       	mov    $0x0,%esi
+  80147c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801481:	48 b8 46 10 80 00 00 	movabs $0x801046,%rax
+  801488:	00 00 00 
+  80148b:	ff d0                	call   *%rax
+	if (r < 0) {
+  80148d:	85 c0                	test   %eax,%eax
+  80148f:	78 54                	js     8014e5 <dupflush+0xb5>
+		panic("duppage: parent remap failed: %e", r);
+		return r;
+	}
+	ndup_child = ndup_self = 0;
+  801491:	48 b8 20 30 80 00 00 	movabs $0x803020,%rax
+  801498:	00 00 00 
+  80149b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  8014a1:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  8014a8:	00 00 00 
+  8014ab:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	return 0;
+}
+  8014b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b6:	5d                   	pop    %rbp
+  8014b7:	c3                   	ret
+		panic("duppage: child map failed: %e", r);
+  8014b8:	89 c1                	mov    %eax,%ecx
+  8014ba:	48 ba 52 22 80 00 00 	movabs $0x802252,%rdx
+  8014c1:	00 00 00 
+  8014c4:	be 77 00 00 00       	mov    $0x77,%esi
+  8014c9:	48 bf 47 22 80 00 00 	movabs $0x802247,%rdi
+  8014d0:	00 00 00 
+  8014d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d8:	49 b8 5f 1a 80 00 00 	movabs $0x801a5f,%r8
+  8014df:	00 00 00 
+  8014e2:	41 ff d0             	call   *%r8
+		panic("duppage: parent remap failed: %e", r);
+  8014e5:	89 c1                	mov    %eax,%ecx
+  8014e7:	48 ba 78 21 80 00 00 	movabs $0x802178,%rdx
+  8014ee:	00 00 00 
+  8014f1:	be 7c 00 00 00       	mov    $0x7c,%esi
+  8014f6:	48 bf 47 22 80 00 00 	movabs $0x802247,%rdi
+  8014fd:	00 00 00 
+  801500:	b8 00 00 00 00       	mov    $0x0,%eax
+  801505:	49 b8 5f 1a 80 00 00 	movabs $0x801a5f,%r8
+  80150c:	00 00 00 
+  80150f:	41 ff d0             	call   *%r8
+
+0000000000801512 <thread_start>:
+	return envid;
+}
+
+static void
+thread_start(void (*fn)(void *), void *arg)
+{
+  801512:	55                   	push   %rbp
+  801513:	48 89 e5             	mov    %rsp,%rbp
+  801516:	48 89 f8             	mov    %rdi,%rax
+  801519:	48 89 f7             	mov    %rsi,%rdi
+	fn(arg);
+  80151c:	ff d0                	call   *%rax
+	exit();
+  80151e:	48 b8 5e 01 80 00 00 	movabs $0x80015e,%rax
+  801525:	00 00 00 
+  801528:	ff d0                	call   *%rax
+}
+  80152a:	5d                   	pop    %rbp
+  80152b:	c3                   	ret
+
+000000000080152c <fork>:
+{
+  80152c:	55                   	push   %rbp
+  80152d:	48 89 e5             	mov    %rsp,%rbp
+	set_pgfault_handler(pgfault);
+  801530:	48 bf 82 12 80 00 00 	movabs $0x801282,%rdi
+  801537:	00 00 00 
+  80153a:	48 b8 51 1b 80 00 00 	movabs $0x801b51,%rax
+  801541:	00 00 00 
+  801544:	ff d0                	call   *%rax
+	return sys_fork();
+  801546:	48 b8 fa 0f 80 00 00 	movabs $0x800ffa,%rax
+  80154d:	00 00 00 
+  801550:	ff d0                	call   *%rax
+}
+  801552:	5d                   	pop    %rbp
+  801553:	c3                   	ret
+
+0000000000801554 <ufork>:
+{
+  801554:	55                   	push   %rbp
+  801555:	48 89 e5             	mov    %rsp,%rbp
+  801558:	41 57                	push   %r15
+  80155a:	41 56                	push   %r14
+  80155c:	41 55                	push   %r13
+  80155e:	41 54                	push   %r12
+  801560:	53                   	push   %rbx
+  801561:	48 83 ec 38          	sub    $0x38,%rsp
+	set_pgfault_handler(pgfault);
+  801565:	48 bf 82 12 80 00 00 	movabs $0x801282,%rdi
+  80156c:	00 00 00 
+  80156f:	48 b8 51 1b 80 00 00 	movabs $0x801b51,%rax
+  801576:	00 00 00 
+  801579:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80157b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801580:	cd 30                	int    $0x30
+  801582:	89 45 cc             	mov    %eax,-0x34(%rbp)
+	if (envid < 0) {
+  801585:	85 c0                	test   %eax,%eax
+  801587:	78 21                	js     8015aa <ufork+0x56>
+	if (envid == 0) {
+  801589:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80158d:	0f 84 e4 03 00 00    	je     801977 <ufork+0x423>
+  801593:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80159a:	00 
+	op->po_op = PAGEOP_MAP;
+  80159b:	49 bf 40 36 80 00 00 	movabs $0x803640,%r15
+  8015a2:	00 00 00 
+  8015a5:	e9 e7 02 00 00       	jmp    801891 <ufork+0x33d>
+		panic("sys_exofork failed: %e", envid);
+  8015aa:	89 c1                	mov    %eax,%ecx
+  8015ac:	48 ba 70 22 80 00 00 	movabs $0x802270,%rdx
+  8015b3:	00 00 00 
+  8015b6:	be e4 00 00 00       	mov    $0xe4,%esi
+  8015bb:	48 bf 47 22 80 00 00 	movabs $0x802247,%rdi
+  8015c2:	00 00 00 
+  8015c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ca:	49 b8 5f 1a 80 00 00 	movabs $0x801a5f,%r8
+  8015d1:	00 00 00 
+  8015d4:	41 ff d0             	call   *%r8
+  8015d7:	44 89 e8             	mov    %r13d,%eax
+  8015da:	c1 e0 09             	shl    $0x9,%eax
+  8015dd:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  8015e0:	44 89 e8             	mov    %r13d,%eax
+  8015e3:	c1 e0 12             	shl    $0x12,%eax
+  8015e6:	89 45 ac             	mov    %eax,-0x54(%rbp)
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  8015e9:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8015f0:	00 
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  8015f1:	44 89 6d a8          	mov    %r13d,-0x58(%rbp)
+				int pdeIndex = pdpeIndex * NPTENTRIES + k;
+  8015f5:	8b 75 c8             	mov    -0x38(%rbp),%esi
+				if (!(uvpd[pdeIndex] & PTE_P)) {
+  8015f8:	48 63 c6             	movslq %esi,%rax
+  8015fb:	48 bf 00 00 00 80 00 	movabs $0x10080000000,%rdi
+  801602:	01 00 00 
+  801605:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  801609:	a8 01                	test   $0x1,%al
+  80160b:	0f 84 52 02 00 00    	je     801863 <ufork+0x30f>
+				if (uvpd[pdeIndex] & PTE_PS) {
+  801611:	48 63 c6             	movslq %esi,%rax
+  801614:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  801618:	a8 80                	test   $0x80,%al
+  80161a:	74 52                	je     80166e <ufork+0x11a>
+					void *va = PGADDR(i, j, k, 0, 0);
+  80161c:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  801620:	48 c1 e3 27          	shl    $0x27,%rbx
+  801624:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801628:	48 09 c3             	or     %rax,%rbx
+  80162b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80162f:	48 09 c3             	or     %rax,%rbx
+					if ((uintptr_t)va >= UTOP) {
+  801632:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  801637:	48 39 d8             	cmp    %rbx,%rax
+  80163a:	0f 82 ca 02 00 00    	jb     80190a <ufork+0x3b6>
+					r = sys_page_map(0, va, 0, va, uvpd[pdeIndex] & PTE_SYSCALL);
+  801640:	48 63 d6             	movslq %esi,%rdx
+  801643:	4c 8b 04 d7          	mov    (%rdi,%rdx,8),%r8
+  801647:	41 81 e0 07 0e 00 00 	and    $0xe07,%r8d
+  80164e:	48 89 d9             	mov    %rbx,%rcx
+  801651:	ba 00 00 00 00       	mov    $0x0,%edx
+  801656:	48 89 de             	mov    %rbx,%rsi
+  801659:	bf 00 00 00 00       	mov    $0x0,%edi
+  80165e:	48 b8 52 0f 80 00 00 	movabs $0x800f52,%rax
+  801665:	00 00 00 
+  801668:	ff d0                	call   *%rax
+					if (r < 0) {
+  80166a:	85 c0                	test   %eax,%eax
+  80166c:	78 18                	js     801686 <ufork+0x132>
+  80166e:	4c 63 65 ac          	movslq -0x54(%rbp),%r12
+  801672:	4c 89 e3             	mov    %r12,%rbx
+  801675:	48 c1 e3 0c          	shl    $0xc,%rbx
+  801679:	4d 8d ac 24 00 02 00 	lea    0x200(%r12),%r13
+  801680:	00 
+  801681:	e9 00 01 00 00       	jmp    801786 <ufork+0x232>
+						panic("splitting 2MB page at %p failed: %e", va, r);
+  801686:	41 89 c0             	mov    %eax,%r8d
+  801689:	48 89 d9             	mov    %rbx,%rcx
+  80168c:	48 ba a0 21 80 00 00 	movabs $0x8021a0,%rdx
+  801693:	00 00 00 
+  801696:	be 0a 01 00 00       	mov    $0x10a,%esi
+  80169b:	48 bf 47 22 80 00 00 	movabs $0x802247,%rdi
+  8016a2:	00 00 00 
+  8016a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016aa:	49 b9 5f 1a 80 00 00 	movabs $0x801a5f,%r9
+  8016b1:	00 00 00 
+  8016b4:	41 ff d1             	call   *%r9
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  8016b7:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  8016be:	00 00 00 
+  8016c1:	8b 0f                	mov    (%rdi),%ecx
+  8016c3:	8d 71 01             	lea    0x1(%rcx),%esi
+  8016c6:	89 37                	mov    %esi,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  8016c8:	48 63 c9             	movslq %ecx,%rcx
+  8016cb:	48 8d 34 09          	lea    (%rcx,%rcx,1),%rsi
+  8016cf:	48 8d 3c 0e          	lea    (%rsi,%rcx,1),%rdi
+  8016d3:	41 c7 04 ff 01 00 00 	movl   $0x1,(%r15,%rdi,8)
+  8016da:	00 
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  8016db:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  8016e1:	41 89 54 ff 04       	mov    %edx,0x4(%r15,%rdi,8)
+	op->po_srcva = op->po_dstva = va;
+  8016e6:	49 89 44 ff 10       	mov    %rax,0x10(%r15,%rdi,8)
+  8016eb:	49 89 44 ff 08       	mov    %rax,0x8(%r15,%rdi,8)
+}
+  8016f0:	eb 76                	jmp    801768 <ufork+0x214>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U | PTE_COW);
+  8016f2:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  8016f9:	00 00 00 
+  8016fc:	8b 17                	mov    (%rdi),%edx
+  8016fe:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  801701:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  801703:	48 63 d2             	movslq %edx,%rdx
+  801706:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  80170a:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  80170e:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  801715:	00 
+	op->po_perm = perm;
+  801716:	41 c7 44 f7 04 05 08 	movl   $0x805,0x4(%r15,%rsi,8)
+  80171d:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  80171f:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  801724:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+		dupqueue(&dup_self[ndup_self++], va, PTE_P | PTE_U | PTE_COW);
+  801729:	48 b9 20 30 80 00 00 	movabs $0x803020,%rcx
+  801730:	00 00 00 
+  801733:	8b 11                	mov    (%rcx),%edx
+  801735:	8d 72 01             	lea    0x1(%rdx),%esi
+  801738:	89 31                	mov    %esi,(%rcx)
+	op->po_op = PAGEOP_MAP;
+  80173a:	48 be 40 30 80 00 00 	movabs $0x803040,%rsi
+  801741:	00 00 00 
+  801744:	48 63 d2             	movslq %edx,%rdx
+  801747:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  80174b:	48 8d 3c 11          	lea    (%rcx,%rdx,1),%rdi
+  80174f:	c7 04 fe 01 00 00 00 	movl   $0x1,(%rsi,%rdi,8)
+	op->po_perm = perm;
+  801756:	c7 44 fe 04 05 08 00 	movl   $0x805,0x4(%rsi,%rdi,8)
+  80175d:	00 
+	op->po_srcva = op->po_dstva = va;
+  80175e:	48 89 44 fe 10       	mov    %rax,0x10(%rsi,%rdi,8)
+  801763:	48 89 44 fe 08       	mov    %rax,0x8(%rsi,%rdi,8)
+	if (ndup_child == DUP_BATCH) {
+  801768:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  80176f:	00 00 00 
+  801772:	83 38 40             	cmpl   $0x40,(%rax)
+  801775:	0f 84 a4 00 00 00    	je     80181f <ufork+0x2cb>
+				for (int l = 0; l < NPTENTRIES; l++) {
+  80177b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801782:	49 83 c4 01          	add    $0x1,%r12
+  801786:	4d 39 ec             	cmp    %r13,%r12
+  801789:	0f 84 d4 00 00 00    	je     801863 <ufork+0x30f>
+					if (va >= UTOP) {
+  80178f:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  801794:	48 39 d8             	cmp    %rbx,%rax
+  801797:	0f 82 6d 01 00 00    	jb     80190a <ufork+0x3b6>
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  80179d:	48 b8 00 10 80 43 ff 	movabs $0xffffffff43801000,%rax
+  8017a4:	ff ff ff 
+  8017a7:	48 01 d8             	add    %rbx,%rax
+  8017aa:	48 3d ff 0f 00 00    	cmp    $0xfff,%rax
+  8017b0:	76 c9                	jbe    80177b <ufork+0x227>
+					if (!(uvpt[pn] & PTE_P)) {
+  8017b2:	4b 8b 04 e6          	mov    (%r14,%r12,8),%rax
+  8017b6:	a8 01                	test   $0x1,%al
+  8017b8:	74 c1                	je     80177b <ufork+0x227>
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  8017ba:	48 b8 00 f0 ff ff ff 	movabs $0xffffffff000,%rax
+  8017c1:	0f 00 00 
+  8017c4:	48 21 d8             	and    %rbx,%rax
+	pte_t pte = uvpt[pn];
+  8017c7:	44 89 e2             	mov    %r12d,%edx
+  8017ca:	49 8b 14 d6          	mov    (%r14,%rdx,8),%rdx
+	if (pte & PTE_SHARE) {
+  8017ce:	f6 c6 04             	test   $0x4,%dh
+  8017d1:	0f 85 e0 fe ff ff    	jne    8016b7 <ufork+0x163>
+	} else if ((pte & PTE_W) || (pte & PTE_COW)) {
+  8017d7:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  8017dd:	0f 85 0f ff ff ff    	jne    8016f2 <ufork+0x19e>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U);
+  8017e3:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  8017ea:	00 00 00 
+  8017ed:	8b 17                	mov    (%rdi),%edx
+  8017ef:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  8017f2:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  8017f4:	48 63 d2             	movslq %edx,%rdx
+  8017f7:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  8017fb:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8017ff:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  801806:	00 
+	op->po_perm = perm;
+  801807:	41 c7 44 f7 04 05 00 	movl   $0x5,0x4(%r15,%rsi,8)
+  80180e:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  801810:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  801815:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+}
+  80181a:	e9 49 ff ff ff       	jmp    801768 <ufork+0x214>
+		return dupflush(envid);
+  80181f:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801822:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  801829:	00 00 00 
+  80182c:	ff d0                	call   *%rax
+					if (r < 0) {
+  80182e:	85 c0                	test   %eax,%eax
+  801830:	0f 89 45 ff ff ff    	jns    80177b <ufork+0x227>
+						panic("duppage failed:  %e", r);
+  801836:	89 c1                	mov    %eax,%ecx
+  801838:	48 ba 87 22 80 00 00 	movabs $0x802287,%rdx
+  80183f:	00 00 00 
+  801842:	be 20 01 00 00       	mov    $0x120,%esi
+  801847:	48 bf 47 22 80 00 00 	movabs $0x802247,%rdi
+  80184e:	00 00 00 
+  801851:	b8 00 00 00 00       	mov    $0x0,%eax
+  801856:	49 b8 5f 1a 80 00 00 	movabs $0x801a5f,%r8
+  80185d:	00 00 00 
+  801860:	41 ff d0             	call   *%r8
+			for (int k = 0; k < NPTENTRIES; k++) {
+  801863:	81 45 ac 00 02 00 00 	addl   $0x200,-0x54(%rbp)
+  80186a:	83 45 c8 01          	addl   $0x1,-0x38(%rbp)
+  80186e:	48 81 45 b0 00 00 20 	addq   $0x200000,-0x50(%rbp)
+  801875:	00 
+  801876:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80187a:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  801880:	0f 85 6f fd ff ff    	jne    8015f5 <ufork+0xa1>
+  801886:	44 8b 6d a8          	mov    -0x58(%rbp),%r13d
+  80188a:	eb 5d                	jmp    8018e9 <ufork+0x395>
+	for (int i = 0; i < NPTENTRIES; i++) {
+  80188c:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  801891:	48 81 7d c0 00 02 00 	cmpq   $0x200,-0x40(%rbp)
+  801898:	00 
+  801899:	74 6f                	je     80190a <ufork+0x3b6>
+		if (!(uvpml4e[i] & PTE_P)) {
+  80189b:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  80189f:	48 63 c3             	movslq %ebx,%rax
+  8018a2:	48 be 00 20 40 80 00 	movabs $0x10080402000,%rsi
+  8018a9:	01 00 00 
+  8018ac:	48 8b 04 c6          	mov    (%rsi,%rax,8),%rax
+  8018b0:	a8 01                	test   $0x1,%al
+  8018b2:	74 d8                	je     80188c <ufork+0x338>
+  8018b4:	41 89 dc             	mov    %ebx,%r12d
+  8018b7:	41 c1 e4 09          	shl    $0x9,%r12d
+  8018bb:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8018c2:	00 
+					if (!(uvpt[pn] & PTE_P)) {
+  8018c3:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8018ca:	01 00 00 
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  8018cd:	45 89 e5             	mov    %r12d,%r13d
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  8018d0:	49 63 c5             	movslq %r13d,%rax
+  8018d3:	48 bb 00 00 40 80 00 	movabs $0x10080400000,%rbx
+  8018da:	01 00 00 
+  8018dd:	48 8b 04 c3          	mov    (%rbx,%rax,8),%rax
+  8018e1:	a8 01                	test   $0x1,%al
+  8018e3:	0f 85 ee fc ff ff    	jne    8015d7 <ufork+0x83>
+		for (int j = 0; j < NPTENTRIES; j++) {
+  8018e9:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8018f0:	40 
+  8018f1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8018f5:	41 83 c5 01          	add    $0x1,%r13d
+  8018f9:	48 b9 00 00 00 00 80 	movabs $0x8000000000,%rcx
+  801900:	00 00 00 
+  801903:	48 39 c8             	cmp    %rcx,%rax
+  801906:	75 c8                	jne    8018d0 <ufork+0x37c>
+  801908:	eb 82                	jmp    80188c <ufork+0x338>
+	r = dupflush(envid);
+  80190a:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80190d:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  801914:	00 00 00 
+  801917:	ff d0                	call   *%rax
+	if (r < 0) {
+  801919:	85 c0                	test   %eax,%eax
+  80191b:	78 6c                	js     801989 <ufork+0x435>
+	r = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  80191d:	ba 07 00 00 00       	mov    $0x7,%edx
+  801922:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801927:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80192a:	48 b8 a6 0e 80 00 00 	movabs $0x800ea6,%rax
+  801931:	00 00 00 
+  801934:	ff d0                	call   *%rax
+	if (r < 0) {
+  801936:	85 c0                	test   %eax,%eax
+  801938:	78 7c                	js     8019b6 <ufork+0x462>
+	r = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  80193a:	48 be 18 1c 80 00 00 	movabs $0x801c18,%rsi
+  801941:	00 00 00 
+  801944:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801947:	48 b8 be 11 80 00 00 	movabs $0x8011be,%rax
+  80194e:	00 00 00 
+  801951:	ff d0                	call   *%rax
+	if (r < 0) {
+  801953:	85 c0                	test   %eax,%eax
+  801955:	0f 88 88 00 00 00    	js     8019e3 <ufork+0x48f>
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  80195b:	be 02 00 00 00       	mov    $0x2,%esi
+  801960:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801963:	48 b8 63 11 80 00 00 	movabs $0x801163,%rax
+  80196a:	00 00 00 
+  80196d:	ff d0                	call   *%rax
+	if (r < 0) {
+  80196f:	85 c0                	test   %eax,%eax
+  801971:	0f 88 99 00 00 00    	js     801a10 <ufork+0x4bc>
+}
+  801977:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80197a:	48 83 c4 38          	add    $0x38,%rsp
+  80197e:	5b                   	pop    %rbx
+  80197f:	41 5c                	pop    %r12
+  801981:	41 5d                	pop    %r13
+  801983:	41 5e                	pop    %r14
+  801985:	41 5f                	pop    %r15
+  801987:	5d                   	pop    %rbp
+  801988:	c3                   	ret
+		panic("duppage failed:  %e", r);
+  801989:	89 c1                	mov    %eax,%ecx
+  80198b:	48 ba 87 22 80 00 00 	movabs $0x802287,%rdx
+  801992:	00 00 00 
+  801995:	be 29 01 00 00       	mov    $0x129,%esi
+  80199a:	48 bf 47 22 80 00 00 	movabs $0x802247,%rdi
+  8019a1:	00 00 00 
+  8019a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a9:	49 b8 5f 1a 80 00 00 	movabs $0x801a5f,%r8
+  8019b0:	00 00 00 
+  8019b3:	41 ff d0             	call   *%r8
+		panic("sys_page_alloc for child exception stack failed: %e", r);
+  8019b6:	89 c1                	mov    %eax,%ecx
+  8019b8:	48 ba c8 21 80 00 00 	movabs $0x8021c8,%rdx
+  8019bf:	00 00 00 
+  8019c2:	be 2e 01 00 00       	mov    $0x12e,%esi
+  8019c7:	48 bf 47 22 80 00 00 	movabs $0x802247,%rdi
+  8019ce:	00 00 00 
+  8019d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d6:	49 b8 5f 1a 80 00 00 	movabs $0x801a5f,%r8
+  8019dd:	00 00 00 
+  8019e0:	41 ff d0             	call   *%r8
+		panic("sys_env_set_pgfault_upcall failed:  %e", r);
+  8019e3:	89 c1                	mov    %eax,%ecx
+  8019e5:	48 ba 00 22 80 00 00 	movabs $0x802200,%rdx
+  8019ec:	00 00 00 
+  8019ef:	be 33 01 00 00       	mov    $0x133,%esi
+  8019f4:	48 bf 47 22 80 00 00 	movabs $0x802247,%rdi
+  8019fb:	00 00 00 
+  8019fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a03:	49 b8 5f 1a 80 00 00 	movabs $0x801a5f,%r8
+  801a0a:	00 00 00 
+  801a0d:	41 ff d0             	call   *%r8
+		panic("sys_env_set_status failed:  %e", r);
+  801a10:	89 c1                	mov    %eax,%ecx
+  801a12:	48 ba 28 22 80 00 00 	movabs $0x802228,%rdx
+  801a19:	00 00 00 
+  801a1c:	be 38 01 00 00       	mov    $0x138,%esi
+  801a21:	48 bf 47 22 80 00 00 	movabs $0x802247,%rdi
+  801a28:	00 00 00 
+  801a2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a30:	49 b8 5f 1a 80 00 00 	movabs $0x801a5f,%r8
+  801a37:	00 00 00 
+  801a3a:	41 ff d0             	call   *%r8
+
+0000000000801a3d <sfork>:
+// on one stack, since nothing is private to the child.
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801a3d:	55                   	push   %rbp
+  801a3e:	48 89 e5             	mov    %rsp,%rbp
+  801a41:	48 89 f2             	mov    %rsi,%rdx
+	return sys_thread_create(thread_start, (uint64_t) fn, (uint64_t) arg);
+  801a44:	48 89 fe             	mov    %rdi,%rsi
+  801a47:	48 bf 12 15 80 00 00 	movabs $0x801512,%rdi
+  801a4e:	00 00 00 
+  801a51:	48 b8 32 10 80 00 00 	movabs $0x801032,%rax
+  801a58:	00 00 00 
+  801a5b:	ff d0                	call   *%rax
+}
+  801a5d:	5d                   	pop    %rbp
+  801a5e:	c3                   	ret
+
+0000000000801a5f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801a5f:	55                   	push   %rbp
+  801a60:	48 89 e5             	mov    %rsp,%rbp
+  801a63:	41 56                	push   %r14
+  801a65:	41 55                	push   %r13
+  801a67:	41 54                	push   %r12
+  801a69:	53                   	push   %rbx
+  801a6a:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  801a71:	49 89 fc             	mov    %rdi,%r12
+  801a74:	41 89 f5             	mov    %esi,%r13d
+  801a77:	48 89 d3             	mov    %rdx,%rbx
+  801a7a:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  801a81:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  801a88:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  801a8f:	84 c0                	test   %al,%al
+  801a91:	74 26                	je     801ab9 <_panic+0x5a>
+  801a93:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  801a9a:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  801aa1:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  801aa5:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  801aa9:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  801aad:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  801ab1:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  801ab5:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801ab9:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  801ac0:	00 00 00 
+  801ac3:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  801aca:	00 00 00 
+  801acd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801ad1:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  801ad8:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  801adf:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801ae6:	48 b8 00 30 80 00 00 	movabs $0x803000,%rax
+  801aed:	00 00 00 
+  801af0:	4c 8b 30             	mov    (%rax),%r14
+  801af3:	48 b8 5a 0e 80 00 00 	movabs $0x800e5a,%rax
+  801afa:	00 00 00 
+  801afd:	ff d0                	call   *%rax
+  801aff:	89 c6                	mov    %eax,%esi
+  801b01:	45 89 e8             	mov    %r13d,%r8d
+  801b04:	4c 89 e1             	mov    %r12,%rcx
+  801b07:	4c 89 f2             	mov    %r14,%rdx
+  801b0a:	48 bf a0 22 80 00 00 	movabs $0x8022a0,%rdi
+  801b11:	00 00 00 
+  801b14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b19:	49 bc 22 02 80 00 00 	movabs $0x800222,%r12
+  801b20:	00 00 00 
+  801b23:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801b26:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  801b2d:	48 89 df             	mov    %rbx,%rdi
+  801b30:	48 b8 be 01 80 00 00 	movabs $0x8001be,%rax
+  801b37:	00 00 00 
+  801b3a:	ff d0                	call   *%rax
+	cprintf("\n");
+  801b3c:	48 bf 8f 1c 80 00 00 	movabs $0x801c8f,%rdi
+  801b43:	00 00 00 
+  801b46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b4b:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801b4e:	cc                   	int3
+	while (1)
+  801b4f:	eb fd                	jmp    801b4e <_panic+0xef>
+
+0000000000801b51 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801b51:	55                   	push   %rbp
+  801b52:	48 89 e5             	mov    %rsp,%rbp
+  801b55:	53                   	push   %rbx
+  801b56:	48 83 ec 08          	sub    $0x8,%rsp
+  801b5a:	48 89 fb             	mov    %rdi,%rbx
+	int r;
+
+	if (_pgfault_handler == 0) {
+  801b5d:	48 ba 40 3c 80 00 00 	movabs $0x803c40,%rdx
+  801b64:	00 00 00 
+  801b67:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801b6b:	74 13                	je     801b80 <set_pgfault_handler+0x2f>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801b6d:	48 89 d8             	mov    %rbx,%rax
+  801b70:	48 a3 40 3c 80 00 00 	movabs %rax,0x803c40
+  801b77:	00 00 00 
+}
+  801b7a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b7e:	c9                   	leave
+  801b7f:	c3                   	ret
+		r = sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801b80:	ba 07 00 00 00       	mov    $0x7,%edx
+  801b85:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801b8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b8f:	48 b8 a6 0e 80 00 00 	movabs $0x800ea6,%rax
+  801b96:	00 00 00 
+  801b99:	ff d0                	call   *%rax
+		if (r < 0) {
+  801b9b:	85 c0                	test   %eax,%eax
+  801b9d:	78 4c                	js     801beb <set_pgfault_handler+0x9a>
+		r = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801b9f:	48 be 18 1c 80 00 00 	movabs $0x801c18,%rsi
+  801ba6:	00 00 00 
+  801ba9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bae:	48 b8 be 11 80 00 00 	movabs $0x8011be,%rax
+  801bb5:	00 00 00 
+  801bb8:	ff d0                	call   *%rax
+		if (r < 0) {
+  801bba:	85 c0                	test   %eax,%eax
+  801bbc:	79 af                	jns    801b6d <set_pgfault_handler+0x1c>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+  801bbe:	89 c1                	mov    %eax,%ecx
+  801bc0:	48 ba f0 22 80 00 00 	movabs $0x8022f0,%rdx
+  801bc7:	00 00 00 
+  801bca:	be 2c 00 00 00       	mov    $0x2c,%esi
+  801bcf:	48 bf de 22 80 00 00 	movabs $0x8022de,%rdi
+  801bd6:	00 00 00 
+  801bd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bde:	49 b8 5f 1a 80 00 00 	movabs $0x801a5f,%r8
+  801be5:	00 00 00 
+  801be8:	41 ff d0             	call   *%r8
+			panic("sys_page_alloc failed:  %e", r);
+  801beb:	89 c1                	mov    %eax,%ecx
+  801bed:	48 ba c3 22 80 00 00 	movabs $0x8022c3,%rdx
+  801bf4:	00 00 00 
+  801bf7:	be 28 00 00 00       	mov    $0x28,%esi
+  801bfc:	48 bf de 22 80 00 00 	movabs $0x8022de,%rdi
+  801c03:	00 00 00 
+  801c06:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c0b:	49 b8 5f 1a 80 00 00 	movabs $0x801a5f,%r8
+  801c12:	00 00 00 
+  801c15:	41 ff d0             	call   *%r8
+
+0000000000801c18 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi		// function argument: pointer to UTF
+  801c18:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  801c1b:	48 a1 40 3c 80 00 00 	movabs 0x803c40,%rax
+  801c22:	00 00 00 
+	call *%rax
+  801c25:	ff d0                	call   *%rax
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here. (Hint. You need to modify the trap time rsp to make room for the return rip ) */
+
+	movq  152(%rsp), %rax
+  801c27:	48 8b 84 24 98 00 00 	mov    0x98(%rsp),%rax
+  801c2e:	00 
+	subq $8, %rax
+  801c2f:	48 83 e8 08          	sub    $0x8,%rax
+	movq %rax, 152(%rsp)
+  801c33:	48 89 84 24 98 00 00 	mov    %rax,0x98(%rsp)
+  801c3a:	00 
+
+	movq 136(%rsp), %rbx
+  801c3b:	48 8b 9c 24 88 00 00 	mov    0x88(%rsp),%rbx
+  801c42:	00 
+	movq %rbx, (%rax)
+  801c43:	48 89 18             	mov    %rbx,(%rax)
+
+	/* Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here. (Hint, the oposite of _alltraps) */
+
+	addq $16, %rsp
+  801c46:	48 83 c4 10          	add    $0x10,%rsp
+	
+	popq %r15
+  801c4a:	41 5f                	pop    %r15
+	popq %r14
+  801c4c:	41 5e                	pop    %r14
+	popq %r13
+  801c4e:	41 5d                	pop    %r13
+	popq %r12
+  801c50:	41 5c                	pop    %r12
+	popq %r11
+  801c52:	41 5b                	pop    %r11
+	popq %r10
+  801c54:	41 5a                	pop    %r10
+	popq %r9
+  801c56:	41 59                	pop    %r9
+	popq %r8
+  801c58:	41 58                	pop    %r8
+	popq %rsi
+  801c5a:	5e                   	pop    %rsi
+	popq %rdi
+  801c5b:	5f                   	pop    %rdi
+	popq %rbp
+  801c5c:	5d                   	pop    %rbp
+	popq %rdx
+  801c5d:	5a                   	pop    %rdx
+	popq %rcx
+  801c5e:	59                   	pop    %rcx
+	popq %rbx
+  801c5f:	5b                   	pop    %rbx
+	popq %rax
+  801c60:	58                   	pop    %rax
+
+	addq $8, %rsp
+  801c61:	48 83 c4 08          	add    $0x8,%rsp
+	/* Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 4: Your code here. */
+
+	popfq
+  801c65:	9d                   	popf
+
+	/* Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here. */
+
+	popq %rsp
+  801c66:	5c                   	pop    %rsp
+
+	/* Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here. */
+  801c67:	c3                   	ret
@@ -0,0 +1,3215 @@
+
+obj/user/fputest:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9d 01 00 00       	call   8001ce <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+	return x;
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	48 83 ec 10          	sub    $0x10,%rsp
+	uint64_t v, tag;
+	envid_t who;
+	int i;
+
+	who = fork();
+  80003b:	48 b8 bd 16 80 00 00 	movabs $0x8016bd,%rax
+  800042:	00 00 00 
+  800045:	ff d0                	call   *%rax
+  800047:	41 89 c1             	mov    %eax,%r9d
+	if (who < 0)
+  80004a:	85 c0                	test   %eax,%eax
+  80004c:	78 77                	js     8000c5 <umain+0x92>
+		panic("fork: %e", who);
+	tag = (uint64_t) (who == 0 ? 2 : 1) << 32;
+  80004e:	48 be 00 00 00 00 01 	movabs $0x100000000,%rsi
+  800055:	00 00 00 
+  800058:	48 b8 00 00 00 00 02 	movabs $0x200000000,%rax
+  80005f:	00 00 00 
+  800062:	48 0f 44 f0          	cmove  %rax,%rsi
+  800066:	ba 00 00 00 00       	mov    $0x0,%edx
+	asm volatile("movq %2, %%xmm0\n"
+  80006b:	bf 0a 00 00 00       	mov    $0xa,%edi
+
+	for (i = 0; i < NROUNDS; i++)
+		if ((v = xmm0_across_yield(tag | i)) != (tag | i))
+  800070:	49 89 d0             	mov    %rdx,%r8
+  800073:	49 09 f0             	or     %rsi,%r8
+	asm volatile("movq %2, %%xmm0\n"
+  800076:	48 89 f8             	mov    %rdi,%rax
+  800079:	66 49 0f 6e c0       	movq   %r8,%xmm0
+  80007e:	cd 30                	int    $0x30
+  800080:	66 48 0f 7e c1       	movq   %xmm0,%rcx
+		if ((v = xmm0_across_yield(tag | i)) != (tag | i))
+  800085:	48 83 c2 01          	add    $0x1,%rdx
+  800089:	49 39 c8             	cmp    %rcx,%r8
+  80008c:	75 64                	jne    8000f2 <umain+0xbf>
+	for (i = 0; i < NROUNDS; i++)
+  80008e:	48 83 fa 64          	cmp    $0x64,%rdx
+  800092:	75 dc                	jne    800070 <umain+0x3d>
+			panic("xmm0 is %lx, not %lx", v, tag | i);
+	if (sum(1 << 20, who == 0 ? 0.5 : 0.25) != (who == 0 ? 524288.0 : 262144.0))
+  800094:	45 85 c9             	test   %r9d,%r9d
+  800097:	0f 85 80 00 00 00    	jne    80011d <umain+0xea>
+  80009d:	48 b8 88 1d 80 00 00 	movabs $0x801d88,%rax
+  8000a4:	00 00 00 
+  8000a7:	f2 0f 10 08          	movsd  (%rax),%xmm1
+	volatile double x = 0;
+  8000ab:	48 b8 98 1d 80 00 00 	movabs $0x801d98,%rax
+  8000b2:	00 00 00 
+  8000b5:	f2 0f 10 00          	movsd  (%rax),%xmm0
+  8000b9:	f2 0f 11 45 f8       	movsd  %xmm0,-0x8(%rbp)
+	for (i = 0; i < n; i++)
+  8000be:	b8 01 00 10 00       	mov    $0x100001,%eax
+  8000c3:	eb 79                	jmp    80013e <umain+0x10b>
+		panic("fork: %e", who);
+  8000c5:	89 c1                	mov    %eax,%ecx
+  8000c7:	48 ba 2d 1d 80 00 00 	movabs $0x801d2d,%rdx
+  8000ce:	00 00 00 
+  8000d1:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8000d6:	48 bf 36 1d 80 00 00 	movabs $0x801d36,%rdi
+  8000dd:	00 00 00 
+  8000e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e5:	49 b8 14 02 80 00 00 	movabs $0x800214,%r8
+  8000ec:	00 00 00 
+  8000ef:	41 ff d0             	call   *%r8
+			panic("xmm0 is %lx, not %lx", v, tag | i);
+  8000f2:	48 ba 45 1d 80 00 00 	movabs $0x801d45,%rdx
+  8000f9:	00 00 00 
+  8000fc:	be 32 00 00 00       	mov    $0x32,%esi
+  800101:	48 bf 36 1d 80 00 00 	movabs $0x801d36,%rdi
+  800108:	00 00 00 
+  80010b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800110:	49 b9 14 02 80 00 00 	movabs $0x800214,%r9
+  800117:	00 00 00 
+  80011a:	41 ff d1             	call   *%r9
+	if (sum(1 << 20, who == 0 ? 0.5 : 0.25) != (who == 0 ? 524288.0 : 262144.0))
+  80011d:	48 b8 90 1d 80 00 00 	movabs $0x801d90,%rax
+  800124:	00 00 00 
+  800127:	f2 0f 10 08          	movsd  (%rax),%xmm1
+  80012b:	e9 7b ff ff ff       	jmp    8000ab <umain+0x78>
+		x += step;
+  800130:	f2 0f 10 45 f8       	movsd  -0x8(%rbp),%xmm0
+  800135:	f2 0f 58 c1          	addsd  %xmm1,%xmm0
+  800139:	f2 0f 11 45 f8       	movsd  %xmm0,-0x8(%rbp)
+	for (i = 0; i < n; i++)
+  80013e:	83 e8 01             	sub    $0x1,%eax
+  800141:	75 ed                	jne    800130 <umain+0xfd>
+	return x;
+  800143:	f2 0f 10 45 f8       	movsd  -0x8(%rbp),%xmm0
+	if (sum(1 << 20, who == 0 ? 0.5 : 0.25) != (who == 0 ? 524288.0 : 262144.0))
+  800148:	45 85 c9             	test   %r9d,%r9d
+  80014b:	74 63                	je     8001b0 <umain+0x17d>
+  80014d:	48 b8 a8 1d 80 00 00 	movabs $0x801da8,%rax
+  800154:	00 00 00 
+  800157:	66 0f 2e 00          	ucomisd (%rax),%xmm0
+  80015b:	7a 29                	jp     800186 <umain+0x153>
+  80015d:	75 27                	jne    800186 <umain+0x153>
+		panic("wrong floating point sum");
+	cprintf("fputest: %s OK\n", who == 0 ? "child" : "parent");
+  80015f:	48 be 26 1d 80 00 00 	movabs $0x801d26,%rsi
+  800166:	00 00 00 
+  800169:	48 bf 73 1d 80 00 00 	movabs $0x801d73,%rdi
+  800170:	00 00 00 
+  800173:	b8 00 00 00 00       	mov    $0x0,%eax
+  800178:	48 ba b3 03 80 00 00 	movabs $0x8003b3,%rdx
+  80017f:	00 00 00 
+  800182:	ff d2                	call   *%rdx
+}
+  800184:	c9                   	leave
+  800185:	c3                   	ret
+		panic("wrong floating point sum");
+  800186:	48 ba 5a 1d 80 00 00 	movabs $0x801d5a,%rdx
+  80018d:	00 00 00 
+  800190:	be 34 00 00 00       	mov    $0x34,%esi
+  800195:	48 bf 36 1d 80 00 00 	movabs $0x801d36,%rdi
+  80019c:	00 00 00 
+  80019f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a4:	48 b9 14 02 80 00 00 	movabs $0x800214,%rcx
+  8001ab:	00 00 00 
+  8001ae:	ff d1                	call   *%rcx
+	if (sum(1 << 20, who == 0 ? 0.5 : 0.25) != (who == 0 ? 524288.0 : 262144.0))
+  8001b0:	48 b8 a0 1d 80 00 00 	movabs $0x801da0,%rax
+  8001b7:	00 00 00 
+  8001ba:	66 0f 2e 00          	ucomisd (%rax),%xmm0
+  8001be:	7a c6                	jp     800186 <umain+0x153>
+  8001c0:	75 c4                	jne    800186 <umain+0x153>
+	cprintf("fputest: %s OK\n", who == 0 ? "child" : "parent");
+  8001c2:	48 be 20 1d 80 00 00 	movabs $0x801d20,%rsi
+  8001c9:	00 00 00 
+  8001cc:	eb 9b                	jmp    800169 <umain+0x136>
+
+00000000008001ce <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  8001ce:	55                   	push   %rbp
+  8001cf:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001d2:	85 ff                	test   %edi,%edi
+  8001d4:	7e 0d                	jle    8001e3 <libmain+0x15>
+		binaryname = argv[0];
+  8001d6:	48 8b 06             	mov    (%rsi),%rax
+  8001d9:	48 a3 00 30 80 00 00 	movabs %rax,0x803000
+  8001e0:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  8001e3:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  8001ea:	00 00 00 
+  8001ed:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8001ef:	48 b8 fd 01 80 00 00 	movabs $0x8001fd,%rax
+  8001f6:	00 00 00 
+  8001f9:	ff d0                	call   *%rax
+}
+  8001fb:	5d                   	pop    %rbp
+  8001fc:	c3                   	ret
+
+00000000008001fd <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001fd:	55                   	push   %rbp
+  8001fe:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  800201:	bf 00 00 00 00       	mov    $0x0,%edi
+  800206:	48 b8 90 0f 80 00 00 	movabs $0x800f90,%rax
+  80020d:	00 00 00 
+  800210:	ff d0                	call   *%rax
+}
+  800212:	5d                   	pop    %rbp
+  800213:	c3                   	ret
+
+0000000000800214 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800214:	55                   	push   %rbp
+  800215:	48 89 e5             	mov    %rsp,%rbp
+  800218:	41 56                	push   %r14
+  80021a:	41 55                	push   %r13
+  80021c:	41 54                	push   %r12
+  80021e:	53                   	push   %rbx
+  80021f:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800226:	49 89 fc             	mov    %rdi,%r12
+  800229:	41 89 f5             	mov    %esi,%r13d
+  80022c:	48 89 d3             	mov    %rdx,%rbx
+  80022f:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800236:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80023d:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800244:	84 c0                	test   %al,%al
+  800246:	74 26                	je     80026e <_panic+0x5a>
+  800248:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  80024f:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800256:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  80025a:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  80025e:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800262:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800266:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  80026a:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80026e:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800275:	00 00 00 
+  800278:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  80027f:	00 00 00 
+  800282:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800286:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  80028d:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800294:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80029b:	48 b8 00 30 80 00 00 	movabs $0x803000,%rax
+  8002a2:	00 00 00 
+  8002a5:	4c 8b 30             	mov    (%rax),%r14
+  8002a8:	48 b8 eb 0f 80 00 00 	movabs $0x800feb,%rax
+  8002af:	00 00 00 
+  8002b2:	ff d0                	call   *%rax
+  8002b4:	89 c6                	mov    %eax,%esi
+  8002b6:	45 89 e8             	mov    %r13d,%r8d
+  8002b9:	4c 89 e1             	mov    %r12,%rcx
+  8002bc:	4c 89 f2             	mov    %r14,%rdx
+  8002bf:	48 bf c0 1d 80 00 00 	movabs $0x801dc0,%rdi
+  8002c6:	00 00 00 
+  8002c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ce:	49 bc b3 03 80 00 00 	movabs $0x8003b3,%r12
+  8002d5:	00 00 00 
+  8002d8:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002db:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  8002e2:	48 89 df             	mov    %rbx,%rdi
+  8002e5:	48 b8 4f 03 80 00 00 	movabs $0x80034f,%rax
+  8002ec:	00 00 00 
+  8002ef:	ff d0                	call   *%rax
+	cprintf("\n");
+  8002f1:	48 bf 81 1d 80 00 00 	movabs $0x801d81,%rdi
+  8002f8:	00 00 00 
+  8002fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800300:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800303:	cc                   	int3
+	while (1)
+  800304:	eb fd                	jmp    800303 <_panic+0xef>
+
+0000000000800306 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800306:	55                   	push   %rbp
+  800307:	48 89 e5             	mov    %rsp,%rbp
+  80030a:	53                   	push   %rbx
+  80030b:	48 83 ec 08          	sub    $0x8,%rsp
+  80030f:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  800312:	8b 06                	mov    (%rsi),%eax
+  800314:	8d 50 01             	lea    0x1(%rax),%edx
+  800317:	89 16                	mov    %edx,(%rsi)
+  800319:	48 98                	cltq
+  80031b:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  800320:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800326:	74 0a                	je     800332 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800328:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80032c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800330:	c9                   	leave
+  800331:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800332:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800336:	be ff 00 00 00       	mov    $0xff,%esi
+  80033b:	48 b8 58 0f 80 00 00 	movabs $0x800f58,%rax
+  800342:	00 00 00 
+  800345:	ff d0                	call   *%rax
+		b->idx = 0;
+  800347:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80034d:	eb d9                	jmp    800328 <putch+0x22>
+
+000000000080034f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80034f:	55                   	push   %rbp
+  800350:	48 89 e5             	mov    %rsp,%rbp
+  800353:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80035a:	48 89 fa             	mov    %rdi,%rdx
+  80035d:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  800360:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800367:	00 00 00 
+	b.cnt = 0;
+  80036a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800371:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800374:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  80037b:	48 bf 06 03 80 00 00 	movabs $0x800306,%rdi
+  800382:	00 00 00 
+  800385:	48 b8 6d 05 80 00 00 	movabs $0x80056d,%rax
+  80038c:	00 00 00 
+  80038f:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  800391:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  800398:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80039f:	48 b8 58 0f 80 00 00 	movabs $0x800f58,%rax
+  8003a6:	00 00 00 
+  8003a9:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  8003ab:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  8003b1:	c9                   	leave
+  8003b2:	c3                   	ret
+
+00000000008003b3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8003b3:	55                   	push   %rbp
+  8003b4:	48 89 e5             	mov    %rsp,%rbp
+  8003b7:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8003be:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8003c5:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8003cc:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8003d3:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8003da:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8003e1:	84 c0                	test   %al,%al
+  8003e3:	74 20                	je     800405 <cprintf+0x52>
+  8003e5:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8003e9:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8003ed:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8003f1:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8003f5:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8003f9:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8003fd:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800401:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800405:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  80040c:	00 00 00 
+  80040f:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800416:	00 00 00 
+  800419:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80041d:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800424:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80042b:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  800432:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  800439:	48 b8 4f 03 80 00 00 	movabs $0x80034f,%rax
+  800440:	00 00 00 
+  800443:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  800445:	c9                   	leave
+  800446:	c3                   	ret
+
+0000000000800447 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800447:	55                   	push   %rbp
+  800448:	48 89 e5             	mov    %rsp,%rbp
+  80044b:	41 57                	push   %r15
+  80044d:	41 56                	push   %r14
+  80044f:	41 55                	push   %r13
+  800451:	41 54                	push   %r12
+  800453:	53                   	push   %rbx
+  800454:	48 83 ec 18          	sub    $0x18,%rsp
+  800458:	49 89 fc             	mov    %rdi,%r12
+  80045b:	49 89 f5             	mov    %rsi,%r13
+  80045e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800462:	44 89 c3             	mov    %r8d,%ebx
+  800465:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800468:	41 89 cf             	mov    %ecx,%r15d
+  80046b:	4c 39 fa             	cmp    %r15,%rdx
+  80046e:	72 29                	jb     800499 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800470:	48 89 d0             	mov    %rdx,%rax
+  800473:	ba 00 00 00 00       	mov    $0x0,%edx
+  800478:	49 f7 f7             	div    %r15
+  80047b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80047f:	48 89 c2             	mov    %rax,%rdx
+  800482:	48 b8 47 04 80 00 00 	movabs $0x800447,%rax
+  800489:	00 00 00 
+  80048c:	ff d0                	call   *%rax
+  80048e:	eb 10                	jmp    8004a0 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800490:	4c 89 ee             	mov    %r13,%rsi
+  800493:	44 89 f7             	mov    %r14d,%edi
+  800496:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  800499:	83 eb 01             	sub    $0x1,%ebx
+  80049c:	85 db                	test   %ebx,%ebx
+  80049e:	7f f0                	jg     800490 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004a9:	49 f7 f7             	div    %r15
+  8004ac:	48 b8 e3 1d 80 00 00 	movabs $0x801de3,%rax
+  8004b3:	00 00 00 
+  8004b6:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  8004ba:	4c 89 ee             	mov    %r13,%rsi
+  8004bd:	41 ff d4             	call   *%r12
+}
+  8004c0:	48 83 c4 18          	add    $0x18,%rsp
+  8004c4:	5b                   	pop    %rbx
+  8004c5:	41 5c                	pop    %r12
+  8004c7:	41 5d                	pop    %r13
+  8004c9:	41 5e                	pop    %r14
+  8004cb:	41 5f                	pop    %r15
+  8004cd:	5d                   	pop    %rbp
+  8004ce:	c3                   	ret
+
+00000000008004cf <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  8004cf:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  8004d3:	48 8b 06             	mov    (%rsi),%rax
+  8004d6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004da:	73 0a                	jae    8004e6 <sprintputch+0x17>
+		*b->buf++ = ch;
+  8004dc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004e0:	48 89 16             	mov    %rdx,(%rsi)
+  8004e3:	40 88 38             	mov    %dil,(%rax)
+}
+  8004e6:	c3                   	ret
+
+00000000008004e7 <printfmt>:
+{
+  8004e7:	55                   	push   %rbp
+  8004e8:	48 89 e5             	mov    %rsp,%rbp
+  8004eb:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8004f2:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8004f9:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800500:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800507:	84 c0                	test   %al,%al
+  800509:	74 20                	je     80052b <printfmt+0x44>
+  80050b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80050f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800513:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800517:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80051b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80051f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800523:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800527:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  80052b:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800532:	00 00 00 
+  800535:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80053c:	00 00 00 
+  80053f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800543:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80054a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800551:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800558:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  80055f:	48 b8 6d 05 80 00 00 	movabs $0x80056d,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <vprintfmt>:
+{
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	41 57                	push   %r15
+  800573:	41 56                	push   %r14
+  800575:	41 55                	push   %r13
+  800577:	41 54                	push   %r12
+  800579:	53                   	push   %rbx
+  80057a:	48 83 ec 48          	sub    $0x48,%rsp
+  80057e:	49 89 fe             	mov    %rdi,%r14
+  800581:	49 89 f5             	mov    %rsi,%r13
+  800584:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  800587:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  80058b:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  80058f:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800593:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  800597:	eb 09                	jmp    8005a2 <vprintfmt+0x35>
+			putch(ch, putdat);
+  800599:	4c 89 ee             	mov    %r13,%rsi
+  80059c:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80059f:	4c 89 e3             	mov    %r12,%rbx
+  8005a2:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8005a6:	0f b6 3b             	movzbl (%rbx),%edi
+  8005a9:	83 ff 25             	cmp    $0x25,%edi
+  8005ac:	74 13                	je     8005c1 <vprintfmt+0x54>
+			if (ch == '\0')
+  8005ae:	85 ff                	test   %edi,%edi
+  8005b0:	75 e7                	jne    800599 <vprintfmt+0x2c>
+}
+  8005b2:	48 83 c4 48          	add    $0x48,%rsp
+  8005b6:	5b                   	pop    %rbx
+  8005b7:	41 5c                	pop    %r12
+  8005b9:	41 5d                	pop    %r13
+  8005bb:	41 5e                	pop    %r14
+  8005bd:	41 5f                	pop    %r15
+  8005bf:	5d                   	pop    %rbp
+  8005c0:	c3                   	ret
+		padc = ' ';
+  8005c1:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  8005c5:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  8005cc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  8005d2:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  8005d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005de:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005e3:	41 0f b6 14 24       	movzbl (%r12),%edx
+  8005e8:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  8005eb:	3c 55                	cmp    $0x55,%al
+  8005ed:	0f 87 4f 05 00 00    	ja     800b42 <vprintfmt+0x5d5>
+  8005f3:	0f b6 c0             	movzbl %al,%eax
+  8005f6:	48 be a0 1e 80 00 00 	movabs $0x801ea0,%rsi
+  8005fd:	00 00 00 
+  800600:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  800603:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  800606:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  80060a:	eb d2                	jmp    8005de <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  80060c:	49 89 dc             	mov    %rbx,%r12
+  80060f:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  800613:	eb c9                	jmp    8005de <vprintfmt+0x71>
+  800615:	0f b6 d2             	movzbl %dl,%edx
+  800618:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  80061b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  800621:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800625:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  80062a:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  80062f:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  800632:	83 f8 09             	cmp    $0x9,%eax
+  800635:	77 20                	ja     800657 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  800637:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  80063b:	eb e4                	jmp    800621 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  80063d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800640:	83 f8 2f             	cmp    $0x2f,%eax
+  800643:	77 27                	ja     80066c <vprintfmt+0xff>
+  800645:	89 c2                	mov    %eax,%edx
+  800647:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80064b:	83 c0 08             	add    $0x8,%eax
+  80064e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800651:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  800654:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  800657:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80065b:	79 81                	jns    8005de <vprintfmt+0x71>
+				width = precision, precision = -1;
+  80065d:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  800661:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800667:	e9 72 ff ff ff       	jmp    8005de <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  80066c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800670:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800674:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800678:	eb d7                	jmp    800651 <vprintfmt+0xe4>
+			if (width < 0)
+  80067a:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  80067d:	85 f6                	test   %esi,%esi
+  80067f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800684:	0f 49 c6             	cmovns %esi,%eax
+  800687:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80068a:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  80068d:	e9 4c ff ff ff       	jmp    8005de <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800692:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  800695:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  80069c:	e9 3d ff ff ff       	jmp    8005de <vprintfmt+0x71>
+			lflag++;
+  8006a1:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8006a4:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8006a7:	e9 32 ff ff ff       	jmp    8005de <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  8006ac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006af:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b2:	77 19                	ja     8006cd <vprintfmt+0x160>
+  8006b4:	89 c2                	mov    %eax,%edx
+  8006b6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ba:	83 c0 08             	add    $0x8,%eax
+  8006bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c0:	8b 3a                	mov    (%rdx),%edi
+  8006c2:	4c 89 ee             	mov    %r13,%rsi
+  8006c5:	41 ff d6             	call   *%r14
+			break;
+  8006c8:	e9 d5 fe ff ff       	jmp    8005a2 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  8006cd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d9:	eb e5                	jmp    8006c0 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  8006db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006de:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e1:	77 5a                	ja     80073d <vprintfmt+0x1d0>
+  8006e3:	89 c2                	mov    %eax,%edx
+  8006e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e9:	83 c0 08             	add    $0x8,%eax
+  8006ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  8006ef:	8b 02                	mov    (%rdx),%eax
+  8006f1:	89 c1                	mov    %eax,%ecx
+  8006f3:	f7 d9                	neg    %ecx
+  8006f5:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006f8:	83 f9 08             	cmp    $0x8,%ecx
+  8006fb:	7f 4e                	jg     80074b <vprintfmt+0x1de>
+  8006fd:	48 63 c1             	movslq %ecx,%rax
+  800700:	48 ba 60 21 80 00 00 	movabs $0x802160,%rdx
+  800707:	00 00 00 
+  80070a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80070e:	48 85 c0             	test   %rax,%rax
+  800711:	74 38                	je     80074b <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800713:	48 89 c1             	mov    %rax,%rcx
+  800716:	48 ba 04 1e 80 00 00 	movabs $0x801e04,%rdx
+  80071d:	00 00 00 
+  800720:	4c 89 ee             	mov    %r13,%rsi
+  800723:	4c 89 f7             	mov    %r14,%rdi
+  800726:	b8 00 00 00 00       	mov    $0x0,%eax
+  80072b:	49 b8 e7 04 80 00 00 	movabs $0x8004e7,%r8
+  800732:	00 00 00 
+  800735:	41 ff d0             	call   *%r8
+  800738:	e9 65 fe ff ff       	jmp    8005a2 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  80073d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800741:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800745:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800749:	eb a4                	jmp    8006ef <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  80074b:	48 ba fb 1d 80 00 00 	movabs $0x801dfb,%rdx
+  800752:	00 00 00 
+  800755:	4c 89 ee             	mov    %r13,%rsi
+  800758:	4c 89 f7             	mov    %r14,%rdi
+  80075b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800760:	49 b8 e7 04 80 00 00 	movabs $0x8004e7,%r8
+  800767:	00 00 00 
+  80076a:	41 ff d0             	call   *%r8
+  80076d:	e9 30 fe ff ff       	jmp    8005a2 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800772:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800775:	83 f8 2f             	cmp    $0x2f,%eax
+  800778:	77 36                	ja     8007b0 <vprintfmt+0x243>
+  80077a:	89 c2                	mov    %eax,%edx
+  80077c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800780:	83 c0 08             	add    $0x8,%eax
+  800783:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800786:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800789:	48 85 c9             	test   %rcx,%rcx
+  80078c:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  800793:	00 00 00 
+  800796:	48 0f 45 c1          	cmovne %rcx,%rax
+  80079a:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  80079e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007a2:	7e 06                	jle    8007aa <vprintfmt+0x23d>
+  8007a4:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  8007a8:	75 14                	jne    8007be <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007aa:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8007ae:	eb 64                	jmp    800814 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  8007b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007bc:	eb c8                	jmp    800786 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007be:	49 63 f7             	movslq %r15d,%rsi
+  8007c1:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  8007c5:	48 b8 50 0c 80 00 00 	movabs $0x800c50,%rax
+  8007cc:	00 00 00 
+  8007cf:	ff d0                	call   *%rax
+  8007d1:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007d4:	29 c1                	sub    %eax,%ecx
+  8007d6:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  8007d9:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  8007dc:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  8007e0:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007e3:	eb 0d                	jmp    8007f2 <vprintfmt+0x285>
+					putch(padc, putdat);
+  8007e5:	4c 89 ee             	mov    %r13,%rsi
+  8007e8:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  8007eb:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007ee:	41 83 ec 01          	sub    $0x1,%r12d
+  8007f2:	45 85 e4             	test   %r12d,%r12d
+  8007f5:	7f ee                	jg     8007e5 <vprintfmt+0x278>
+  8007f7:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  8007fa:	85 c9                	test   %ecx,%ecx
+  8007fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800801:	0f 49 c1             	cmovns %ecx,%eax
+  800804:	29 c1                	sub    %eax,%ecx
+  800806:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  800809:	eb 9f                	jmp    8007aa <vprintfmt+0x23d>
+					putch(ch, putdat);
+  80080b:	4c 89 ee             	mov    %r13,%rsi
+  80080e:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800811:	4c 89 e2             	mov    %r12,%rdx
+  800814:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800818:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80081e:	0f be f8             	movsbl %al,%edi
+  800821:	85 ff                	test   %edi,%edi
+  800823:	74 29                	je     80084e <vprintfmt+0x2e1>
+  800825:	45 85 ff             	test   %r15d,%r15d
+  800828:	78 06                	js     800830 <vprintfmt+0x2c3>
+  80082a:	41 83 ef 01          	sub    $0x1,%r15d
+  80082e:	78 1e                	js     80084e <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800830:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800834:	74 d5                	je     80080b <vprintfmt+0x29e>
+  800836:	0f be c0             	movsbl %al,%eax
+  800839:	83 e8 20             	sub    $0x20,%eax
+  80083c:	83 f8 5e             	cmp    $0x5e,%eax
+  80083f:	76 ca                	jbe    80080b <vprintfmt+0x29e>
+					putch('?', putdat);
+  800841:	4c 89 ee             	mov    %r13,%rsi
+  800844:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800849:	41 ff d6             	call   *%r14
+  80084c:	eb c3                	jmp    800811 <vprintfmt+0x2a4>
+  80084e:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800852:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800855:	41 01 c4             	add    %eax,%r12d
+  800858:	41 29 d4             	sub    %edx,%r12d
+  80085b:	eb 0f                	jmp    80086c <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  80085d:	4c 89 ee             	mov    %r13,%rsi
+  800860:	bf 20 00 00 00       	mov    $0x20,%edi
+  800865:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800868:	41 83 ec 01          	sub    $0x1,%r12d
+  80086c:	45 85 e4             	test   %r12d,%r12d
+  80086f:	7f ec                	jg     80085d <vprintfmt+0x2f0>
+  800871:	e9 2c fd ff ff       	jmp    8005a2 <vprintfmt+0x35>
+	if (lflag >= 2)
+  800876:	83 f9 01             	cmp    $0x1,%ecx
+  800879:	7f 1d                	jg     800898 <vprintfmt+0x32b>
+	else if (lflag)
+  80087b:	85 c9                	test   %ecx,%ecx
+  80087d:	74 5e                	je     8008dd <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  80087f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800882:	83 f8 2f             	cmp    $0x2f,%eax
+  800885:	77 48                	ja     8008cf <vprintfmt+0x362>
+  800887:	89 c2                	mov    %eax,%edx
+  800889:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088d:	83 c0 08             	add    $0x8,%eax
+  800890:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800893:	4c 8b 22             	mov    (%rdx),%r12
+  800896:	eb 17                	jmp    8008af <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800898:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089b:	83 f8 2f             	cmp    $0x2f,%eax
+  80089e:	77 21                	ja     8008c1 <vprintfmt+0x354>
+  8008a0:	89 c2                	mov    %eax,%edx
+  8008a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a6:	83 c0 08             	add    $0x8,%eax
+  8008a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ac:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  8008af:	4d 85 e4             	test   %r12,%r12
+  8008b2:	78 50                	js     800904 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  8008b4:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  8008b7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8008bc:	e9 b4 01 00 00       	jmp    800a75 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  8008c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008cd:	eb dd                	jmp    8008ac <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  8008cf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008db:	eb b6                	jmp    800893 <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  8008dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e3:	77 11                	ja     8008f6 <vprintfmt+0x389>
+  8008e5:	89 c2                	mov    %eax,%edx
+  8008e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008eb:	83 c0 08             	add    $0x8,%eax
+  8008ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f1:	4c 63 22             	movslq (%rdx),%r12
+  8008f4:	eb b9                	jmp    8008af <vprintfmt+0x342>
+  8008f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008fa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800902:	eb ed                	jmp    8008f1 <vprintfmt+0x384>
+				putch('-', putdat);
+  800904:	4c 89 ee             	mov    %r13,%rsi
+  800907:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80090c:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  80090f:	4c 89 e2             	mov    %r12,%rdx
+  800912:	48 f7 da             	neg    %rdx
+			base = 10;
+  800915:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80091a:	e9 56 01 00 00       	jmp    800a75 <vprintfmt+0x508>
+	if (lflag >= 2)
+  80091f:	83 f9 01             	cmp    $0x1,%ecx
+  800922:	7f 25                	jg     800949 <vprintfmt+0x3dc>
+	else if (lflag)
+  800924:	85 c9                	test   %ecx,%ecx
+  800926:	74 5e                	je     800986 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800928:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092b:	83 f8 2f             	cmp    $0x2f,%eax
+  80092e:	77 48                	ja     800978 <vprintfmt+0x40b>
+  800930:	89 c2                	mov    %eax,%edx
+  800932:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800936:	83 c0 08             	add    $0x8,%eax
+  800939:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093c:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  80093f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800944:	e9 2c 01 00 00       	jmp    800a75 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800949:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094c:	83 f8 2f             	cmp    $0x2f,%eax
+  80094f:	77 19                	ja     80096a <vprintfmt+0x3fd>
+  800951:	89 c2                	mov    %eax,%edx
+  800953:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800957:	83 c0 08             	add    $0x8,%eax
+  80095a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095d:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800960:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800965:	e9 0b 01 00 00       	jmp    800a75 <vprintfmt+0x508>
+  80096a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800972:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800976:	eb e5                	jmp    80095d <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800978:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800980:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800984:	eb b6                	jmp    80093c <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800986:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800989:	83 f8 2f             	cmp    $0x2f,%eax
+  80098c:	77 18                	ja     8009a6 <vprintfmt+0x439>
+  80098e:	89 c2                	mov    %eax,%edx
+  800990:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800994:	83 c0 08             	add    $0x8,%eax
+  800997:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099a:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  80099c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  8009a1:	e9 cf 00 00 00       	jmp    800a75 <vprintfmt+0x508>
+  8009a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009aa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b2:	eb e6                	jmp    80099a <vprintfmt+0x42d>
+	if (lflag >= 2)
+  8009b4:	83 f9 01             	cmp    $0x1,%ecx
+  8009b7:	7f 25                	jg     8009de <vprintfmt+0x471>
+	else if (lflag)
+  8009b9:	85 c9                	test   %ecx,%ecx
+  8009bb:	74 5b                	je     800a18 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  8009bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c3:	77 45                	ja     800a0a <vprintfmt+0x49d>
+  8009c5:	89 c2                	mov    %eax,%edx
+  8009c7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cb:	83 c0 08             	add    $0x8,%eax
+  8009ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d1:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  8009d4:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  8009d9:	e9 97 00 00 00       	jmp    800a75 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8009de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e4:	77 16                	ja     8009fc <vprintfmt+0x48f>
+  8009e6:	89 c2                	mov    %eax,%edx
+  8009e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ec:	83 c0 08             	add    $0x8,%eax
+  8009ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f2:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  8009f5:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  8009fa:	eb 79                	jmp    800a75 <vprintfmt+0x508>
+  8009fc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a00:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a08:	eb e8                	jmp    8009f2 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800a0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a16:	eb b9                	jmp    8009d1 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800a18:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a1e:	77 15                	ja     800a35 <vprintfmt+0x4c8>
+  800a20:	89 c2                	mov    %eax,%edx
+  800a22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a26:	83 c0 08             	add    $0x8,%eax
+  800a29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2c:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800a2e:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800a33:	eb 40                	jmp    800a75 <vprintfmt+0x508>
+  800a35:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a39:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a41:	eb e9                	jmp    800a2c <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800a43:	4c 89 ee             	mov    %r13,%rsi
+  800a46:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a4b:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800a4e:	4c 89 ee             	mov    %r13,%rsi
+  800a51:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a56:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800a59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a5c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5f:	77 34                	ja     800a95 <vprintfmt+0x528>
+  800a61:	89 c2                	mov    %eax,%edx
+  800a63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a67:	83 c0 08             	add    $0x8,%eax
+  800a6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800a6d:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800a70:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800a75:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800a7a:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a7e:	4c 89 ee             	mov    %r13,%rsi
+  800a81:	4c 89 f7             	mov    %r14,%rdi
+  800a84:	48 b8 47 04 80 00 00 	movabs $0x800447,%rax
+  800a8b:	00 00 00 
+  800a8e:	ff d0                	call   *%rax
+			break;
+  800a90:	e9 0d fb ff ff       	jmp    8005a2 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800a95:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a99:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa1:	eb ca                	jmp    800a6d <vprintfmt+0x500>
+	if (lflag >= 2)
+  800aa3:	83 f9 01             	cmp    $0x1,%ecx
+  800aa6:	7f 22                	jg     800aca <vprintfmt+0x55d>
+	else if (lflag)
+  800aa8:	85 c9                	test   %ecx,%ecx
+  800aaa:	74 58                	je     800b04 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800aac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aaf:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab2:	77 42                	ja     800af6 <vprintfmt+0x589>
+  800ab4:	89 c2                	mov    %eax,%edx
+  800ab6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aba:	83 c0 08             	add    $0x8,%eax
+  800abd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac0:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800ac3:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800ac8:	eb ab                	jmp    800a75 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800aca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acd:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad0:	77 16                	ja     800ae8 <vprintfmt+0x57b>
+  800ad2:	89 c2                	mov    %eax,%edx
+  800ad4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad8:	83 c0 08             	add    $0x8,%eax
+  800adb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ade:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800ae1:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800ae6:	eb 8d                	jmp    800a75 <vprintfmt+0x508>
+  800ae8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af4:	eb e8                	jmp    800ade <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800af6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800afa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800afe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b02:	eb bc                	jmp    800ac0 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800b04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b07:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0a:	77 18                	ja     800b24 <vprintfmt+0x5b7>
+  800b0c:	89 c2                	mov    %eax,%edx
+  800b0e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b12:	83 c0 08             	add    $0x8,%eax
+  800b15:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b18:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800b1a:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800b1f:	e9 51 ff ff ff       	jmp    800a75 <vprintfmt+0x508>
+  800b24:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b28:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b30:	eb e6                	jmp    800b18 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800b32:	4c 89 ee             	mov    %r13,%rsi
+  800b35:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b3a:	41 ff d6             	call   *%r14
+			break;
+  800b3d:	e9 60 fa ff ff       	jmp    8005a2 <vprintfmt+0x35>
+			putch('%', putdat);
+  800b42:	4c 89 ee             	mov    %r13,%rsi
+  800b45:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b4a:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b4d:	4c 89 e3             	mov    %r12,%rbx
+  800b50:	eb 04                	jmp    800b56 <vprintfmt+0x5e9>
+  800b52:	48 83 eb 01          	sub    $0x1,%rbx
+  800b56:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b5a:	75 f6                	jne    800b52 <vprintfmt+0x5e5>
+  800b5c:	e9 41 fa ff ff       	jmp    8005a2 <vprintfmt+0x35>
+
+0000000000800b61 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b61:	55                   	push   %rbp
+  800b62:	48 89 e5             	mov    %rsp,%rbp
+  800b65:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b69:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800b6d:	48 63 c6             	movslq %esi,%rax
+  800b70:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800b75:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800b79:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800b80:	48 85 ff             	test   %rdi,%rdi
+  800b83:	74 2a                	je     800baf <vsnprintf+0x4e>
+  800b85:	85 f6                	test   %esi,%esi
+  800b87:	7e 26                	jle    800baf <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b89:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800b8d:	48 bf cf 04 80 00 00 	movabs $0x8004cf,%rdi
+  800b94:	00 00 00 
+  800b97:	48 b8 6d 05 80 00 00 	movabs $0x80056d,%rax
+  800b9e:	00 00 00 
+  800ba1:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ba3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800ba7:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800baa:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800bad:	c9                   	leave
+  800bae:	c3                   	ret
+		return -E_INVAL;
+  800baf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bb4:	eb f7                	jmp    800bad <vsnprintf+0x4c>
+
+0000000000800bb6 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800bb6:	55                   	push   %rbp
+  800bb7:	48 89 e5             	mov    %rsp,%rbp
+  800bba:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800bc1:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800bc8:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800bcf:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800bd6:	84 c0                	test   %al,%al
+  800bd8:	74 20                	je     800bfa <snprintf+0x44>
+  800bda:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800bde:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800be2:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800be6:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800bea:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800bee:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800bf2:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800bf6:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800bfa:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800c01:	00 00 00 
+  800c04:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800c0b:	00 00 00 
+  800c0e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c12:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800c19:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800c20:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800c27:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800c2e:	48 b8 61 0b 80 00 00 	movabs $0x800b61,%rax
+  800c35:	00 00 00 
+  800c38:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800c3a:	c9                   	leave
+  800c3b:	c3                   	ret
+
+0000000000800c3c <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800c3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c41:	48 89 d0             	mov    %rdx,%rax
+  800c44:	48 83 c2 01          	add    $0x1,%rdx
+  800c48:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800c4d:	75 f2                	jne    800c41 <strlen+0x5>
+		n++;
+	return n;
+}
+  800c4f:	c3                   	ret
+
+0000000000800c50 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c55:	eb 03                	jmp    800c5a <strnlen+0xa>
+  800c57:	48 89 d0             	mov    %rdx,%rax
+  800c5a:	48 39 c6             	cmp    %rax,%rsi
+  800c5d:	74 0a                	je     800c69 <strnlen+0x19>
+  800c5f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c63:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c67:	75 ee                	jne    800c57 <strnlen+0x7>
+		n++;
+	return n;
+}
+  800c69:	c3                   	ret
+
+0000000000800c6a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800c6a:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800c6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c72:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c76:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c79:	48 83 c2 01          	add    $0x1,%rdx
+  800c7d:	84 c9                	test   %cl,%cl
+  800c7f:	75 f1                	jne    800c72 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800c81:	c3                   	ret
+
+0000000000800c82 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c82:	55                   	push   %rbp
+  800c83:	48 89 e5             	mov    %rsp,%rbp
+  800c86:	41 54                	push   %r12
+  800c88:	53                   	push   %rbx
+  800c89:	48 89 fb             	mov    %rdi,%rbx
+  800c8c:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800c8f:	48 b8 3c 0c 80 00 00 	movabs $0x800c3c,%rax
+  800c96:	00 00 00 
+  800c99:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800c9b:	48 63 f8             	movslq %eax,%rdi
+  800c9e:	48 01 df             	add    %rbx,%rdi
+  800ca1:	4c 89 e6             	mov    %r12,%rsi
+  800ca4:	48 b8 6a 0c 80 00 00 	movabs $0x800c6a,%rax
+  800cab:	00 00 00 
+  800cae:	ff d0                	call   *%rax
+	return dst;
+}
+  800cb0:	48 89 d8             	mov    %rbx,%rax
+  800cb3:	5b                   	pop    %rbx
+  800cb4:	41 5c                	pop    %r12
+  800cb6:	5d                   	pop    %rbp
+  800cb7:	c3                   	ret
+
+0000000000800cb8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cb8:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800cbb:	48 01 fa             	add    %rdi,%rdx
+  800cbe:	48 89 f9             	mov    %rdi,%rcx
+  800cc1:	eb 14                	jmp    800cd7 <strncpy+0x1f>
+		*dst++ = *src;
+  800cc3:	48 83 c1 01          	add    $0x1,%rcx
+  800cc7:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ccb:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ccf:	41 80 f8 01          	cmp    $0x1,%r8b
+  800cd3:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800cd7:	48 39 d1             	cmp    %rdx,%rcx
+  800cda:	75 e7                	jne    800cc3 <strncpy+0xb>
+	}
+	return ret;
+}
+  800cdc:	c3                   	ret
+
+0000000000800cdd <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800cdd:	48 89 f8             	mov    %rdi,%rax
+  800ce0:	48 85 d2             	test   %rdx,%rdx
+  800ce3:	74 27                	je     800d0c <strlcpy+0x2f>
+  800ce5:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800cea:	48 89 fa             	mov    %rdi,%rdx
+  800ced:	eb 0b                	jmp    800cfa <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800cef:	48 83 c6 01          	add    $0x1,%rsi
+  800cf3:	48 83 c2 01          	add    $0x1,%rdx
+  800cf7:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800cfa:	48 39 c2             	cmp    %rax,%rdx
+  800cfd:	74 0a                	je     800d09 <strlcpy+0x2c>
+  800cff:	0f b6 0e             	movzbl (%rsi),%ecx
+  800d02:	84 c9                	test   %cl,%cl
+  800d04:	75 e9                	jne    800cef <strlcpy+0x12>
+  800d06:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800d09:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800d0c:	48 29 f8             	sub    %rdi,%rax
+}
+  800d0f:	c3                   	ret
+
+0000000000800d10 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800d10:	eb 08                	jmp    800d1a <strcmp+0xa>
+		p++, q++;
+  800d12:	48 83 c7 01          	add    $0x1,%rdi
+  800d16:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800d1a:	0f b6 07             	movzbl (%rdi),%eax
+  800d1d:	84 c0                	test   %al,%al
+  800d1f:	74 04                	je     800d25 <strcmp+0x15>
+  800d21:	3a 06                	cmp    (%rsi),%al
+  800d23:	74 ed                	je     800d12 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d25:	0f b6 c0             	movzbl %al,%eax
+  800d28:	0f b6 16             	movzbl (%rsi),%edx
+  800d2b:	29 d0                	sub    %edx,%eax
+}
+  800d2d:	c3                   	ret
+
+0000000000800d2e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800d2e:	eb 0c                	jmp    800d3c <strncmp+0xe>
+		n--, p++, q++;
+  800d30:	48 83 ea 01          	sub    $0x1,%rdx
+  800d34:	48 83 c7 01          	add    $0x1,%rdi
+  800d38:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800d3c:	48 85 d2             	test   %rdx,%rdx
+  800d3f:	74 14                	je     800d55 <strncmp+0x27>
+  800d41:	0f b6 07             	movzbl (%rdi),%eax
+  800d44:	84 c0                	test   %al,%al
+  800d46:	74 04                	je     800d4c <strncmp+0x1e>
+  800d48:	3a 06                	cmp    (%rsi),%al
+  800d4a:	74 e4                	je     800d30 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d4c:	0f b6 07             	movzbl (%rdi),%eax
+  800d4f:	0f b6 16             	movzbl (%rsi),%edx
+  800d52:	29 d0                	sub    %edx,%eax
+}
+  800d54:	c3                   	ret
+		return 0;
+  800d55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d5a:	c3                   	ret
+
+0000000000800d5b <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800d5b:	eb 04                	jmp    800d61 <strchr+0x6>
+  800d5d:	48 83 c7 01          	add    $0x1,%rdi
+  800d61:	0f b6 07             	movzbl (%rdi),%eax
+  800d64:	84 c0                	test   %al,%al
+  800d66:	74 09                	je     800d71 <strchr+0x16>
+		if (*s == c)
+  800d68:	40 38 f0             	cmp    %sil,%al
+  800d6b:	75 f0                	jne    800d5d <strchr+0x2>
+  800d6d:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800d70:	c3                   	ret
+	return 0;
+  800d71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d76:	c3                   	ret
+
+0000000000800d77 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d77:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800d7a:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800d7d:	40 38 f2             	cmp    %sil,%dl
+  800d80:	74 0a                	je     800d8c <strfind+0x15>
+  800d82:	84 d2                	test   %dl,%dl
+  800d84:	74 06                	je     800d8c <strfind+0x15>
+	for (; *s; s++)
+  800d86:	48 83 c0 01          	add    $0x1,%rax
+  800d8a:	eb ee                	jmp    800d7a <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800d8c:	c3                   	ret
+
+0000000000800d8d <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800d8d:	48 85 d2             	test   %rdx,%rdx
+  800d90:	74 28                	je     800dba <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800d92:	48 89 f8             	mov    %rdi,%rax
+  800d95:	48 09 d0             	or     %rdx,%rax
+  800d98:	a8 03                	test   $0x3,%al
+  800d9a:	75 16                	jne    800db2 <memset+0x25>
+		c &= 0xFF;
+  800d9c:	40 0f b6 f6          	movzbl %sil,%esi
+  800da0:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800da6:	48 89 d1             	mov    %rdx,%rcx
+  800da9:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800dad:	fc                   	cld
+  800dae:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800db0:	eb 08                	jmp    800dba <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800db2:	89 f0                	mov    %esi,%eax
+  800db4:	48 89 d1             	mov    %rdx,%rcx
+  800db7:	fc                   	cld
+  800db8:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800dba:	48 89 f8             	mov    %rdi,%rax
+  800dbd:	c3                   	ret
+
+0000000000800dbe <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800dbe:	48 89 f8             	mov    %rdi,%rax
+  800dc1:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800dc4:	48 39 fe             	cmp    %rdi,%rsi
+  800dc7:	73 3a                	jae    800e03 <memmove+0x45>
+  800dc9:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800dcd:	48 39 d7             	cmp    %rdx,%rdi
+  800dd0:	73 31                	jae    800e03 <memmove+0x45>
+		s += n;
+		d += n;
+  800dd2:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800dd6:	48 89 d6             	mov    %rdx,%rsi
+  800dd9:	48 09 fe             	or     %rdi,%rsi
+  800ddc:	48 09 ce             	or     %rcx,%rsi
+  800ddf:	40 f6 c6 03          	test   $0x3,%sil
+  800de3:	75 11                	jne    800df6 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800de5:	48 83 ef 04          	sub    $0x4,%rdi
+  800de9:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800ded:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800df1:	fd                   	std
+  800df2:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800df4:	eb 0b                	jmp    800e01 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800df6:	48 83 ef 01          	sub    $0x1,%rdi
+  800dfa:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800dfe:	fd                   	std
+  800dff:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800e01:	fc                   	cld
+  800e02:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800e03:	48 89 f2             	mov    %rsi,%rdx
+  800e06:	48 09 c2             	or     %rax,%rdx
+  800e09:	48 09 ca             	or     %rcx,%rdx
+  800e0c:	f6 c2 03             	test   $0x3,%dl
+  800e0f:	75 0b                	jne    800e1c <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800e11:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800e15:	48 89 c7             	mov    %rax,%rdi
+  800e18:	fc                   	cld
+  800e19:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800e1b:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800e1c:	48 89 c7             	mov    %rax,%rdi
+  800e1f:	fc                   	cld
+  800e20:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800e22:	c3                   	ret
+
+0000000000800e23 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800e23:	55                   	push   %rbp
+  800e24:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800e27:	48 b8 be 0d 80 00 00 	movabs $0x800dbe,%rax
+  800e2e:	00 00 00 
+  800e31:	ff d0                	call   *%rax
+}
+  800e33:	5d                   	pop    %rbp
+  800e34:	c3                   	ret
+
+0000000000800e35 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800e35:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3a:	48 39 c2             	cmp    %rax,%rdx
+  800e3d:	74 1e                	je     800e5d <memcmp+0x28>
+		if (*s1 != *s2)
+  800e3f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e43:	48 83 c0 01          	add    $0x1,%rax
+  800e47:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800e4d:	44 38 c1             	cmp    %r8b,%cl
+  800e50:	74 e8                	je     800e3a <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800e52:	0f b6 c1             	movzbl %cl,%eax
+  800e55:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e59:	44 29 c0             	sub    %r8d,%eax
+  800e5c:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800e5d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e62:	c3                   	ret
+
+0000000000800e63 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e63:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800e66:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800e69:	eb 04                	jmp    800e6f <memfind+0xc>
+  800e6b:	48 83 c0 01          	add    $0x1,%rax
+  800e6f:	48 39 d0             	cmp    %rdx,%rax
+  800e72:	73 05                	jae    800e79 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e74:	40 38 30             	cmp    %sil,(%rax)
+  800e77:	75 f2                	jne    800e6b <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800e79:	c3                   	ret
+
+0000000000800e7a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e7a:	48 89 f9             	mov    %rdi,%rcx
+  800e7d:	49 89 f0             	mov    %rsi,%r8
+  800e80:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e82:	eb 04                	jmp    800e88 <strtol+0xe>
+		s++;
+  800e84:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800e88:	0f b6 01             	movzbl (%rcx),%eax
+  800e8b:	3c 20                	cmp    $0x20,%al
+  800e8d:	74 f5                	je     800e84 <strtol+0xa>
+  800e8f:	3c 09                	cmp    $0x9,%al
+  800e91:	74 f1                	je     800e84 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e93:	3c 2b                	cmp    $0x2b,%al
+  800e95:	74 2b                	je     800ec2 <strtol+0x48>
+	int neg = 0;
+  800e97:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800e9d:	3c 2d                	cmp    $0x2d,%al
+  800e9f:	74 2d                	je     800ece <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ea1:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800ea7:	75 0f                	jne    800eb8 <strtol+0x3e>
+  800ea9:	80 39 30             	cmpb   $0x30,(%rcx)
+  800eac:	74 2c                	je     800eda <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800eae:	85 ff                	test   %edi,%edi
+  800eb0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eb5:	0f 44 f8             	cmove  %eax,%edi
+  800eb8:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800ebd:	4c 63 d7             	movslq %edi,%r10
+  800ec0:	eb 4f                	jmp    800f11 <strtol+0x97>
+		s++;
+  800ec2:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800ec6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800ecc:	eb d3                	jmp    800ea1 <strtol+0x27>
+		s++, neg = 1;
+  800ece:	48 83 c1 01          	add    $0x1,%rcx
+  800ed2:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800ed8:	eb c7                	jmp    800ea1 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800eda:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800ede:	74 0f                	je     800eef <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800ee0:	85 ff                	test   %edi,%edi
+  800ee2:	75 d4                	jne    800eb8 <strtol+0x3e>
+		s++, base = 8;
+  800ee4:	48 83 c1 01          	add    $0x1,%rcx
+  800ee8:	bf 08 00 00 00       	mov    $0x8,%edi
+  800eed:	eb c9                	jmp    800eb8 <strtol+0x3e>
+		s += 2, base = 16;
+  800eef:	48 83 c1 02          	add    $0x2,%rcx
+  800ef3:	bf 10 00 00 00       	mov    $0x10,%edi
+  800ef8:	eb be                	jmp    800eb8 <strtol+0x3e>
+			dig = *s - '0';
+  800efa:	0f be c0             	movsbl %al,%eax
+  800efd:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800f00:	39 f8                	cmp    %edi,%eax
+  800f02:	7d 3b                	jge    800f3f <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800f04:	48 83 c1 01          	add    $0x1,%rcx
+  800f08:	49 0f af d2          	imul   %r10,%rdx
+  800f0c:	48 98                	cltq
+  800f0e:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800f11:	0f b6 01             	movzbl (%rcx),%eax
+  800f14:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800f17:	40 80 fe 09          	cmp    $0x9,%sil
+  800f1b:	76 dd                	jbe    800efa <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800f1d:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800f20:	40 80 fe 19          	cmp    $0x19,%sil
+  800f24:	77 08                	ja     800f2e <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800f26:	0f be c0             	movsbl %al,%eax
+  800f29:	83 e8 57             	sub    $0x57,%eax
+  800f2c:	eb d2                	jmp    800f00 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f2e:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800f31:	40 80 fe 19          	cmp    $0x19,%sil
+  800f35:	77 08                	ja     800f3f <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800f37:	0f be c0             	movsbl %al,%eax
+  800f3a:	83 e8 37             	sub    $0x37,%eax
+  800f3d:	eb c1                	jmp    800f00 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800f3f:	4d 85 c0             	test   %r8,%r8
+  800f42:	74 03                	je     800f47 <strtol+0xcd>
+		*endptr = (char *) s;
+  800f44:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800f47:	48 89 d0             	mov    %rdx,%rax
+  800f4a:	48 f7 d8             	neg    %rax
+  800f4d:	45 85 c9             	test   %r9d,%r9d
+  800f50:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800f54:	48 89 d0             	mov    %rdx,%rax
+  800f57:	c3                   	ret
+
+0000000000800f58 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800f58:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f5e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800f64:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6e:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800f70:	c3                   	ret
+
+0000000000800f71 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800f71:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f77:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f82:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f87:	48 89 fe             	mov    %rdi,%rsi
+  800f8a:	48 89 fa             	mov    %rdi,%rdx
+  800f8d:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f8f:	c3                   	ret
+
+0000000000800f90 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800f90:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800f93:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f99:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f9f:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800fa9:	48 89 f2             	mov    %rsi,%rdx
+  800fac:	0f 05                	syscall
+	if(check && ret > 0)
+  800fae:	48 85 c0             	test   %rax,%rax
+  800fb1:	7f 01                	jg     800fb4 <sys_env_destroy+0x24>
+}
+  800fb3:	c3                   	ret
+{
+  800fb4:	55                   	push   %rbp
+  800fb5:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb8:	49 89 c0             	mov    %rax,%r8
+  800fbb:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fc0:	48 ba a8 21 80 00 00 	movabs $0x8021a8,%rdx
+  800fc7:	00 00 00 
+  800fca:	be 28 00 00 00       	mov    $0x28,%esi
+  800fcf:	48 bf c5 21 80 00 00 	movabs $0x8021c5,%rdi
+  800fd6:	00 00 00 
+  800fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fde:	49 b9 14 02 80 00 00 	movabs $0x800214,%r9
+  800fe5:	00 00 00 
+  800fe8:	41 ff d1             	call   *%r9
+
+0000000000800feb <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800feb:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800ff2:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800ff3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800ff8:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800ffc:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801000:	48 c1 e2 04          	shl    $0x4,%rdx
+  801004:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  80100b:	00 00 00 
+  80100e:	48 01 d0             	add    %rdx,%rax
+  801011:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  801017:	c3                   	ret
+
+0000000000801018 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  801018:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80101e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801024:	bf 00 00 00 00       	mov    $0x0,%edi
+  801029:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80102e:	48 89 fe             	mov    %rdi,%rsi
+  801031:	48 89 fa             	mov    %rdi,%rdx
+  801034:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801036:	c3                   	ret
+
+0000000000801037 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  801037:	48 63 d2             	movslq %edx,%rdx
+  80103a:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80103d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801043:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801049:	b8 04 00 00 00       	mov    $0x4,%eax
+  80104e:	0f 05                	syscall
+	if(check && ret > 0)
+  801050:	48 85 c0             	test   %rax,%rax
+  801053:	7f 01                	jg     801056 <sys_page_alloc+0x1f>
+}
+  801055:	c3                   	ret
+{
+  801056:	55                   	push   %rbp
+  801057:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80105a:	49 89 c0             	mov    %rax,%r8
+  80105d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801062:	48 ba a8 21 80 00 00 	movabs $0x8021a8,%rdx
+  801069:	00 00 00 
+  80106c:	be 28 00 00 00       	mov    $0x28,%esi
+  801071:	48 bf c5 21 80 00 00 	movabs $0x8021c5,%rdi
+  801078:	00 00 00 
+  80107b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801080:	49 b9 14 02 80 00 00 	movabs $0x800214,%r9
+  801087:	00 00 00 
+  80108a:	41 ff d1             	call   *%r9
+
+000000000080108d <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  80108d:	48 63 d2             	movslq %edx,%rdx
+  801090:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801093:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801099:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80109f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010a4:	0f 05                	syscall
+	if(check && ret > 0)
+  8010a6:	48 85 c0             	test   %rax,%rax
+  8010a9:	7f 01                	jg     8010ac <sys_page_alloc_huge+0x1f>
+}
+  8010ab:	c3                   	ret
+{
+  8010ac:	55                   	push   %rbp
+  8010ad:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010b0:	49 89 c0             	mov    %rax,%r8
+  8010b3:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8010b8:	48 ba a8 21 80 00 00 	movabs $0x8021a8,%rdx
+  8010bf:	00 00 00 
+  8010c2:	be 28 00 00 00       	mov    $0x28,%esi
+  8010c7:	48 bf c5 21 80 00 00 	movabs $0x8021c5,%rdi
+  8010ce:	00 00 00 
+  8010d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d6:	49 b9 14 02 80 00 00 	movabs $0x800214,%r9
+  8010dd:	00 00 00 
+  8010e0:	41 ff d1             	call   *%r9
+
+00000000008010e3 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8010e3:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  8010e6:	48 63 d2             	movslq %edx,%rdx
+  8010e9:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  8010ec:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  8010ef:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010f4:	0f 05                	syscall
+	if(check && ret > 0)
+  8010f6:	48 85 c0             	test   %rax,%rax
+  8010f9:	7f 01                	jg     8010fc <sys_page_map+0x19>
+}
+  8010fb:	c3                   	ret
+{
+  8010fc:	55                   	push   %rbp
+  8010fd:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801100:	49 89 c0             	mov    %rax,%r8
+  801103:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801108:	48 ba a8 21 80 00 00 	movabs $0x8021a8,%rdx
+  80110f:	00 00 00 
+  801112:	be 28 00 00 00       	mov    $0x28,%esi
+  801117:	48 bf c5 21 80 00 00 	movabs $0x8021c5,%rdi
+  80111e:	00 00 00 
+  801121:	b8 00 00 00 00       	mov    $0x0,%eax
+  801126:	49 b9 14 02 80 00 00 	movabs $0x800214,%r9
+  80112d:	00 00 00 
+  801130:	41 ff d1             	call   *%r9
+
+0000000000801133 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  801133:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801136:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80113c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801142:	ba 00 00 00 00       	mov    $0x0,%edx
+  801147:	b8 06 00 00 00       	mov    $0x6,%eax
+  80114c:	0f 05                	syscall
+	if(check && ret > 0)
+  80114e:	48 85 c0             	test   %rax,%rax
+  801151:	7f 01                	jg     801154 <sys_page_unmap+0x21>
+}
+  801153:	c3                   	ret
+{
+  801154:	55                   	push   %rbp
+  801155:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801158:	49 89 c0             	mov    %rax,%r8
+  80115b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801160:	48 ba a8 21 80 00 00 	movabs $0x8021a8,%rdx
+  801167:	00 00 00 
+  80116a:	be 28 00 00 00       	mov    $0x28,%esi
+  80116f:	48 bf c5 21 80 00 00 	movabs $0x8021c5,%rdi
+  801176:	00 00 00 
+  801179:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117e:	49 b9 14 02 80 00 00 	movabs $0x800214,%r9
+  801185:	00 00 00 
+  801188:	41 ff d1             	call   *%r9
+
+000000000080118b <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  80118b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801191:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801197:	bf 00 00 00 00       	mov    $0x0,%edi
+  80119c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011a1:	48 89 fe             	mov    %rdi,%rsi
+  8011a4:	48 89 fa             	mov    %rdi,%rdx
+  8011a7:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8011a9:	c3                   	ret
+
+00000000008011aa <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  8011aa:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011bb:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011c0:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  8011c2:	c3                   	ret
+
+00000000008011c3 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  8011c3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011cf:	b8 11 00 00 00       	mov    $0x11,%eax
+  8011d4:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  8011d6:	c3                   	ret
+
+00000000008011d7 <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  8011d7:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  8011da:	48 63 f6             	movslq %esi,%rsi
+  8011dd:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  8011e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011e6:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011eb:	0f 05                	syscall
+	if(check && ret > 0)
+  8011ed:	48 85 c0             	test   %rax,%rax
+  8011f0:	7f 01                	jg     8011f3 <sys_page_batch+0x1c>
+}
+  8011f2:	c3                   	ret
+{
+  8011f3:	55                   	push   %rbp
+  8011f4:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f7:	49 89 c0             	mov    %rax,%r8
+  8011fa:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8011ff:	48 ba a8 21 80 00 00 	movabs $0x8021a8,%rdx
+  801206:	00 00 00 
+  801209:	be 28 00 00 00       	mov    $0x28,%esi
+  80120e:	48 bf c5 21 80 00 00 	movabs $0x8021c5,%rdi
+  801215:	00 00 00 
+  801218:	b8 00 00 00 00       	mov    $0x0,%eax
+  80121d:	49 b9 14 02 80 00 00 	movabs $0x800214,%r9
+  801224:	00 00 00 
+  801227:	41 ff d1             	call   *%r9
+
+000000000080122a <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  80122a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801230:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801236:	be 00 00 00 00       	mov    $0x0,%esi
+  80123b:	b8 13 00 00 00       	mov    $0x13,%eax
+  801240:	48 89 f2             	mov    %rsi,%rdx
+  801243:	0f 05                	syscall
+	if(check && ret > 0)
+  801245:	48 85 c0             	test   %rax,%rax
+  801248:	7f 01                	jg     80124b <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  80124a:	c3                   	ret
+{
+  80124b:	55                   	push   %rbp
+  80124c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80124f:	49 89 c0             	mov    %rax,%r8
+  801252:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801257:	48 ba a8 21 80 00 00 	movabs $0x8021a8,%rdx
+  80125e:	00 00 00 
+  801261:	be 28 00 00 00       	mov    $0x28,%esi
+  801266:	48 bf c5 21 80 00 00 	movabs $0x8021c5,%rdi
+  80126d:	00 00 00 
+  801270:	b8 00 00 00 00       	mov    $0x0,%eax
+  801275:	49 b9 14 02 80 00 00 	movabs $0x800214,%r9
+  80127c:	00 00 00 
+  80127f:	41 ff d1             	call   *%r9
+
+0000000000801282 <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  801282:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801288:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80128e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801293:	b8 14 00 00 00       	mov    $0x14,%eax
+  801298:	48 89 fe             	mov    %rdi,%rsi
+  80129b:	48 89 fa             	mov    %rdi,%rdx
+  80129e:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8012a0:	c3                   	ret
+
+00000000008012a1 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  8012a1:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8012a4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8012aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8012b0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012b5:	0f 05                	syscall
+	if(check && ret > 0)
+  8012b7:	48 85 c0             	test   %rax,%rax
+  8012ba:	7f 01                	jg     8012bd <sys_page_unmap_range+0x1c>
+}
+  8012bc:	c3                   	ret
+{
+  8012bd:	55                   	push   %rbp
+  8012be:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012c1:	49 89 c0             	mov    %rax,%r8
+  8012c4:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8012c9:	48 ba a8 21 80 00 00 	movabs $0x8021a8,%rdx
+  8012d0:	00 00 00 
+  8012d3:	be 28 00 00 00       	mov    $0x28,%esi
+  8012d8:	48 bf c5 21 80 00 00 	movabs $0x8021c5,%rdi
+  8012df:	00 00 00 
+  8012e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e7:	49 b9 14 02 80 00 00 	movabs $0x800214,%r9
+  8012ee:	00 00 00 
+  8012f1:	41 ff d1             	call   *%r9
+
+00000000008012f4 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8012f4:	48 63 f6             	movslq %esi,%rsi
+  8012f7:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8012fa:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801300:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801306:	ba 00 00 00 00       	mov    $0x0,%edx
+  80130b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801310:	0f 05                	syscall
+	if(check && ret > 0)
+  801312:	48 85 c0             	test   %rax,%rax
+  801315:	7f 01                	jg     801318 <sys_env_set_status+0x24>
+}
+  801317:	c3                   	ret
+{
+  801318:	55                   	push   %rbp
+  801319:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80131c:	49 89 c0             	mov    %rax,%r8
+  80131f:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801324:	48 ba a8 21 80 00 00 	movabs $0x8021a8,%rdx
+  80132b:	00 00 00 
+  80132e:	be 28 00 00 00       	mov    $0x28,%esi
+  801333:	48 bf c5 21 80 00 00 	movabs $0x8021c5,%rdi
+  80133a:	00 00 00 
+  80133d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801342:	49 b9 14 02 80 00 00 	movabs $0x800214,%r9
+  801349:	00 00 00 
+  80134c:	41 ff d1             	call   *%r9
+
+000000000080134f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80134f:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801352:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801358:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80135e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801363:	b8 09 00 00 00       	mov    $0x9,%eax
+  801368:	0f 05                	syscall
+	if(check && ret > 0)
+  80136a:	48 85 c0             	test   %rax,%rax
+  80136d:	7f 01                	jg     801370 <sys_env_set_pgfault_upcall+0x21>
+}
+  80136f:	c3                   	ret
+{
+  801370:	55                   	push   %rbp
+  801371:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801374:	49 89 c0             	mov    %rax,%r8
+  801377:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80137c:	48 ba a8 21 80 00 00 	movabs $0x8021a8,%rdx
+  801383:	00 00 00 
+  801386:	be 28 00 00 00       	mov    $0x28,%esi
+  80138b:	48 bf c5 21 80 00 00 	movabs $0x8021c5,%rdi
+  801392:	00 00 00 
+  801395:	b8 00 00 00 00       	mov    $0x0,%eax
+  80139a:	49 b9 14 02 80 00 00 	movabs $0x800214,%r9
+  8013a1:	00 00 00 
+  8013a4:	41 ff d1             	call   *%r9
+
+00000000008013a7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8013a7:	48 63 ff             	movslq %edi,%rdi
+  8013aa:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  8013ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8013b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8013b8:	0f 05                	syscall
+}
+  8013ba:	c3                   	ret
+
+00000000008013bb <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  8013bb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8013c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8013c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8013cc:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013d1:	48 89 f2             	mov    %rsi,%rdx
+  8013d4:	0f 05                	syscall
+	if(check && ret > 0)
+  8013d6:	48 85 c0             	test   %rax,%rax
+  8013d9:	7f 01                	jg     8013dc <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  8013db:	c3                   	ret
+{
+  8013dc:	55                   	push   %rbp
+  8013dd:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013e0:	49 89 c0             	mov    %rax,%r8
+  8013e3:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8013e8:	48 ba a8 21 80 00 00 	movabs $0x8021a8,%rdx
+  8013ef:	00 00 00 
+  8013f2:	be 28 00 00 00       	mov    $0x28,%esi
+  8013f7:	48 bf c5 21 80 00 00 	movabs $0x8021c5,%rdi
+  8013fe:	00 00 00 
+  801401:	b8 00 00 00 00       	mov    $0x0,%eax
+  801406:	49 b9 14 02 80 00 00 	movabs $0x800214,%r9
+  80140d:	00 00 00 
+  801410:	41 ff d1             	call   *%r9
+
+0000000000801413 <pgfault>:
+- unmap PFTEMP using sys_page_unmap()
+- panic if any step fails
+*/
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801413:	55                   	push   %rbp
+  801414:	48 89 e5             	mov    %rsp,%rbp
+  801417:	53                   	push   %rbx
+  801418:	48 83 ec 08          	sub    $0x8,%rsp
+	void *addr = (void *) utf->utf_fault_va;
+  80141c:	48 8b 1f             	mov    (%rdi),%rbx
+	uint32_t err = utf->utf_err;
+  80141f:	48 8b 47 08          	mov    0x8(%rdi),%rax
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+
+	if (!(err & FEC_WR)) {
+  801423:	a8 02                	test   $0x2,%al
+  801425:	0f 84 b1 00 00 00    	je     8014dc <pgfault+0xc9>
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+	}
+	pte_t pte = uvpt[PGNUM(addr)];
+  80142b:	48 89 da             	mov    %rbx,%rdx
+  80142e:	48 c1 ea 0c          	shr    $0xc,%rdx
+  801432:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801439:	01 00 00 
+  80143c:	48 8b 0c d0          	mov    (%rax,%rdx,8),%rcx
+	if (!(pte & PTE_COW)) {
+  801440:	f6 c5 08             	test   $0x8,%ch
+  801443:	0f 84 c3 00 00 00    	je     80150c <pgfault+0xf9>
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+
+	void *pg_addr = ROUNDDOWN(addr, PGSIZE);
+  801449:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  801450:	ba 07 00 00 00       	mov    $0x7,%edx
+  801455:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  80145a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80145f:	48 b8 37 10 80 00 00 	movabs $0x801037,%rax
+  801466:	00 00 00 
+  801469:	ff d0                	call   *%rax
+	if (r < 0) {
+  80146b:	85 c0                	test   %eax,%eax
+  80146d:	0f 88 c7 00 00 00    	js     80153a <pgfault+0x127>
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+	}
+	memmove(PFTEMP, pg_addr, PGSIZE);
+  801473:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801478:	48 89 de             	mov    %rbx,%rsi
+  80147b:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  801480:	48 b8 be 0d 80 00 00 	movabs $0x800dbe,%rax
+  801487:	00 00 00 
+  80148a:	ff d0                	call   *%rax
+	r = sys_page_map(0, PFTEMP, 0, pg_addr, PTE_P | PTE_U | PTE_W);
+  80148c:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  801492:	48 89 d9             	mov    %rbx,%rcx
+  801495:	ba 00 00 00 00       	mov    $0x0,%edx
+  80149a:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  80149f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014a4:	48 b8 e3 10 80 00 00 	movabs $0x8010e3,%rax
+  8014ab:	00 00 00 
+  8014ae:	ff d0                	call   *%rax
+	if (r < 0) {
+  8014b0:	85 c0                	test   %eax,%eax
+  8014b2:	0f 88 af 00 00 00    	js     801567 <pgfault+0x154>
+		panic("pgfault: sys_page_map failed:  %e", r);
+	}
+	r = sys_page_unmap(0, PFTEMP);
+  8014b8:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8014bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014c2:	48 b8 33 11 80 00 00 	movabs $0x801133,%rax
+  8014c9:	00 00 00 
+  8014cc:	ff d0                	call   *%rax
+	if (r < 0) {
+  8014ce:	85 c0                	test   %eax,%eax
+  8014d0:	0f 88 be 00 00 00    	js     801594 <pgfault+0x181>
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+	}
+}
+  8014d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+  8014dc:	89 c1                	mov    %eax,%ecx
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+  8014de:	49 89 d8             	mov    %rbx,%r8
+  8014e1:	48 ba d8 21 80 00 00 	movabs $0x8021d8,%rdx
+  8014e8:	00 00 00 
+  8014eb:	be 32 00 00 00       	mov    $0x32,%esi
+  8014f0:	48 bf 87 23 80 00 00 	movabs $0x802387,%rdi
+  8014f7:	00 00 00 
+  8014fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ff:	49 b9 14 02 80 00 00 	movabs $0x800214,%r9
+  801506:	00 00 00 
+  801509:	41 ff d1             	call   *%r9
+		panic("pgfault: page is not marked copy-on-write (pte=%p, va=%p)", pte, addr);
+  80150c:	49 89 d8             	mov    %rbx,%r8
+  80150f:	48 ba 00 22 80 00 00 	movabs $0x802200,%rdx
+  801516:	00 00 00 
+  801519:	be 36 00 00 00       	mov    $0x36,%esi
+  80151e:	48 bf 87 23 80 00 00 	movabs $0x802387,%rdi
+  801525:	00 00 00 
+  801528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152d:	49 b9 14 02 80 00 00 	movabs $0x800214,%r9
+  801534:	00 00 00 
+  801537:	41 ff d1             	call   *%r9
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+  80153a:	89 c1                	mov    %eax,%ecx
+  80153c:	48 ba 40 22 80 00 00 	movabs $0x802240,%rdx
+  801543:	00 00 00 
+  801546:	be 44 00 00 00       	mov    $0x44,%esi
+  80154b:	48 bf 87 23 80 00 00 	movabs $0x802387,%rdi
+  801552:	00 00 00 
+  801555:	b8 00 00 00 00       	mov    $0x0,%eax
+  80155a:	49 b8 14 02 80 00 00 	movabs $0x800214,%r8
+  801561:	00 00 00 
+  801564:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_map failed:  %e", r);
+  801567:	89 c1                	mov    %eax,%ecx
+  801569:	48 ba 68 22 80 00 00 	movabs $0x802268,%rdx
+  801570:	00 00 00 
+  801573:	be 49 00 00 00       	mov    $0x49,%esi
+  801578:	48 bf 87 23 80 00 00 	movabs $0x802387,%rdi
+  80157f:	00 00 00 
+  801582:	b8 00 00 00 00       	mov    $0x0,%eax
+  801587:	49 b8 14 02 80 00 00 	movabs $0x800214,%r8
+  80158e:	00 00 00 
+  801591:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+  801594:	89 c1                	mov    %eax,%ecx
+  801596:	48 ba 90 22 80 00 00 	movabs $0x802290,%rdx
+  80159d:	00 00 00 
+  8015a0:	be 4d 00 00 00       	mov    $0x4d,%esi
+  8015a5:	48 bf 87 23 80 00 00 	movabs $0x802387,%rdi
+  8015ac:	00 00 00 
+  8015af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b4:	49 b8 14 02 80 00 00 	movabs $0x800214,%r8
+  8015bb:	00 00 00 
+  8015be:	41 ff d0             	call   *%r8
+
+00000000008015c1 <dupflush>:
+static struct PageOp dup_child[DUP_BATCH], dup_self[DUP_BATCH];
+static int ndup_child, ndup_self;
+
+static int
+dupflush(envid_t envid)
+{
+  8015c1:	55                   	push   %rbp
+  8015c2:	48 89 e5             	mov    %rsp,%rbp
+  8015c5:	89 fe                	mov    %edi,%esi
+	int r;
+
+	// Map to child first, then remap parent
+	r = sys_page_batch(0, envid, dup_child, ndup_child);
+  8015c7:	a1 24 30 80 00 00 00 	movabs 0x803024,%eax
+  8015ce:	00 00 
+  8015d0:	48 63 c8             	movslq %eax,%rcx
+  8015d3:	48 ba 40 36 80 00 00 	movabs $0x803640,%rdx
+  8015da:	00 00 00 
+  8015dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015e2:	48 b8 d7 11 80 00 00 	movabs $0x8011d7,%rax
+  8015e9:	00 00 00 
+  8015ec:	ff d0                	call   *%rax
+	if (r < 0) {
+  8015ee:	85 c0                	test   %eax,%eax
+  8015f0:	78 57                	js     801649 <dupflush+0x88>
+		panic("duppage: child map failed: %e", r);
+		return r;
+	}
+	r = sys_page_batch(0, 0, dup_self, ndup_self);
+  8015f2:	a1 20 30 80 00 00 00 	movabs 0x803020,%eax
+  8015f9:	00 00 
+  8015fb:	48 63 c8             	movslq %eax,%rcx
+  8015fe:	48 ba 40 30 80 00 00 	movabs $0x803040,%rdx
+  801605:	00 00 00 
+  801608:	be 00 00 00 00       	mov    $0x0,%esi
+  80160d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801612:	48 b8 d7 11 80 00 00 	movabs $0x8011d7,%rax
+  801619:	00 00 00 
+  80161c:	ff d0                	call   *%rax
+	if (r < 0) {
+  80161e:	85 c0                	test   %eax,%eax
+  801620:	78 54                	js     801676 <dupflush+0xb5>
+		panic("duppage: parent remap failed: %e", r);
+		return r;
+	}
+	ndup_child = ndup_self = 0;
+  801622:	48 b8 20 30 80 00 00 	movabs $0x803020,%rax
+  801629:	00 00 00 
+  80162c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  801632:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  801639:	00 00 00 
+  80163c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	return 0;
+}
+  801642:	b8 00 00 00 00       	mov    $0x0,%eax
+  801647:	5d                   	pop    %rbp
+  801648:	c3                   	ret
+		panic("duppage: child map failed: %e", r);
+  801649:	89 c1                	mov    %eax,%ecx
+  80164b:	48 ba 92 23 80 00 00 	movabs $0x802392,%rdx
+  801652:	00 00 00 
+  801655:	be 77 00 00 00       	mov    $0x77,%esi
+  80165a:	48 bf 87 23 80 00 00 	movabs $0x802387,%rdi
+  801661:	00 00 00 
+  801664:	b8 00 00 00 00       	mov    $0x0,%eax
+  801669:	49 b8 14 02 80 00 00 	movabs $0x800214,%r8
+  801670:	00 00 00 
+  801673:	41 ff d0             	call   *%r8
+		panic("duppage: parent remap failed: %e", r);
+  801676:	89 c1                	mov    %eax,%ecx
+  801678:	48 ba b8 22 80 00 00 	movabs $0x8022b8,%rdx
+  80167f:	00 00 00 
+  801682:	be 7c 00 00 00       	mov    $0x7c,%esi
+  801687:	48 bf 87 23 80 00 00 	movabs $0x802387,%rdi
+  80168e:	00 00 00 
+  801691:	b8 00 00 00 00       	mov    $0x0,%eax
+  801696:	49 b8 14 02 80 00 00 	movabs $0x800214,%r8
+  80169d:	00 00 00 
+  8016a0:	41 ff d0             	call   *%r8
+
+00000000008016a3 <thread_start>:
+	return envid;
+}
+
+static void
+thread_start(void (*fn)(void *), void *arg)
+{
+  8016a3:	55                   	push   %rbp
+  8016a4:	48 89 e5             	mov    %rsp,%rbp
+  8016a7:	48 89 f8             	mov    %rdi,%rax
+  8016aa:	48 89 f7             	mov    %rsi,%rdi
+	fn(arg);
+  8016ad:	ff d0                	call   *%rax
+	exit();
+  8016af:	48 b8 fd 01 80 00 00 	movabs $0x8001fd,%rax
+  8016b6:	00 00 00 
+  8016b9:	ff d0                	call   *%rax
+}
+  8016bb:	5d                   	pop    %rbp
+  8016bc:	c3                   	ret
+
+00000000008016bd <fork>:
+{
+  8016bd:	55                   	push   %rbp
+  8016be:	48 89 e5             	mov    %rsp,%rbp
+	set_pgfault_handler(pgfault);
+  8016c1:	48 bf 13 14 80 00 00 	movabs $0x801413,%rdi
+  8016c8:	00 00 00 
+  8016cb:	48 b8 f0 1b 80 00 00 	movabs $0x801bf0,%rax
+  8016d2:	00 00 00 
+  8016d5:	ff d0                	call   *%rax
+	return sys_fork();
+  8016d7:	48 b8 8b 11 80 00 00 	movabs $0x80118b,%rax
+  8016de:	00 00 00 
+  8016e1:	ff d0                	call   *%rax
+}
+  8016e3:	5d                   	pop    %rbp
+  8016e4:	c3                   	ret
+
+00000000008016e5 <ufork>:
+{
+  8016e5:	55                   	push   %rbp
+  8016e6:	48 89 e5             	mov    %rsp,%rbp
+  8016e9:	41 57                	push   %r15
+  8016eb:	41 56                	push   %r14
+  8016ed:	41 55                	push   %r13
+  8016ef:	41 54                	push   %r12
+  8016f1:	53                   	push   %rbx
+  8016f2:	48 83 ec 38          	sub    $0x38,%rsp
+	set_pgfault_handler(pgfault);
+  8016f6:	48 bf 13 14 80 00 00 	movabs $0x801413,%rdi
+  8016fd:	00 00 00 
+  801700:	48 b8 f0 1b 80 00 00 	movabs $0x801bf0,%rax
+  801707:	00 00 00 
+  80170a:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80170c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801711:	cd 30                	int    $0x30
+  801713:	89 45 cc             	mov    %eax,-0x34(%rbp)
+	if (envid < 0) {
+  801716:	85 c0                	test   %eax,%eax
+  801718:	78 21                	js     80173b <ufork+0x56>
+	if (envid == 0) {
+  80171a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80171e:	0f 84 e4 03 00 00    	je     801b08 <ufork+0x423>
+  801724:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80172b:	00 
+	op->po_op = PAGEOP_MAP;
+  80172c:	49 bf 40 36 80 00 00 	movabs $0x803640,%r15
+  801733:	00 00 00 
+  801736:	e9 e7 02 00 00       	jmp    801a22 <ufork+0x33d>
+		panic("sys_exofork failed: %e", envid);
+  80173b:	89 c1                	mov    %eax,%ecx
+  80173d:	48 ba b0 23 80 00 00 	movabs $0x8023b0,%rdx
+  801744:	00 00 00 
+  801747:	be e4 00 00 00       	mov    $0xe4,%esi
+  80174c:	48 bf 87 23 80 00 00 	movabs $0x802387,%rdi
+  801753:	00 00 00 
+  801756:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175b:	49 b8 14 02 80 00 00 	movabs $0x800214,%r8
+  801762:	00 00 00 
+  801765:	41 ff d0             	call   *%r8
+  801768:	44 89 e8             	mov    %r13d,%eax
+  80176b:	c1 e0 09             	shl    $0x9,%eax
+  80176e:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  801771:	44 89 e8             	mov    %r13d,%eax
+  801774:	c1 e0 12             	shl    $0x12,%eax
+  801777:	89 45 ac             	mov    %eax,-0x54(%rbp)
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  80177a:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801781:	00 
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  801782:	44 89 6d a8          	mov    %r13d,-0x58(%rbp)
+				int pdeIndex = pdpeIndex * NPTENTRIES + k;
+  801786:	8b 75 c8             	mov    -0x38(%rbp),%esi
+				if (!(uvpd[pdeIndex] & PTE_P)) {
+  801789:	48 63 c6             	movslq %esi,%rax
+  80178c:	48 bf 00 00 00 80 00 	movabs $0x10080000000,%rdi
+  801793:	01 00 00 
+  801796:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80179a:	a8 01                	test   $0x1,%al
+  80179c:	0f 84 52 02 00 00    	je     8019f4 <ufork+0x30f>
+				if (uvpd[pdeIndex] & PTE_PS) {
+  8017a2:	48 63 c6             	movslq %esi,%rax
+  8017a5:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8017a9:	a8 80                	test   $0x80,%al
+  8017ab:	74 52                	je     8017ff <ufork+0x11a>
+					void *va = PGADDR(i, j, k, 0, 0);
+  8017ad:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  8017b1:	48 c1 e3 27          	shl    $0x27,%rbx
+  8017b5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8017b9:	48 09 c3             	or     %rax,%rbx
+  8017bc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8017c0:	48 09 c3             	or     %rax,%rbx
+					if ((uintptr_t)va >= UTOP) {
+  8017c3:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  8017c8:	48 39 d8             	cmp    %rbx,%rax
+  8017cb:	0f 82 ca 02 00 00    	jb     801a9b <ufork+0x3b6>
+					r = sys_page_map(0, va, 0, va, uvpd[pdeIndex] & PTE_SYSCALL);
+  8017d1:	48 63 d6             	movslq %esi,%rdx
+  8017d4:	4c 8b 04 d7          	mov    (%rdi,%rdx,8),%r8
+  8017d8:	41 81 e0 07 0e 00 00 	and    $0xe07,%r8d
+  8017df:	48 89 d9             	mov    %rbx,%rcx
+  8017e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017e7:	48 89 de             	mov    %rbx,%rsi
+  8017ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017ef:	48 b8 e3 10 80 00 00 	movabs $0x8010e3,%rax
+  8017f6:	00 00 00 
+  8017f9:	ff d0                	call   *%rax
+					if (r < 0) {
+  8017fb:	85 c0                	test   %eax,%eax
+  8017fd:	78 18                	js     801817 <ufork+0x132>
+  8017ff:	4c 63 65 ac          	movslq -0x54(%rbp),%r12
+  801803:	4c 89 e3             	mov    %r12,%rbx
+  801806:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80180a:	4d 8d ac 24 00 02 00 	lea    0x200(%r12),%r13
+  801811:	00 
+  801812:	e9 00 01 00 00       	jmp    801917 <ufork+0x232>
+						panic("splitting 2MB page at %p failed: %e", va, r);
+  801817:	41 89 c0             	mov    %eax,%r8d
+  80181a:	48 89 d9             	mov    %rbx,%rcx
+  80181d:	48 ba e0 22 80 00 00 	movabs $0x8022e0,%rdx
+  801824:	00 00 00 
+  801827:	be 0a 01 00 00       	mov    $0x10a,%esi
+  80182c:	48 bf 87 23 80 00 00 	movabs $0x802387,%rdi
+  801833:	00 00 00 
+  801836:	b8 00 00 00 00       	mov    $0x0,%eax
+  80183b:	49 b9 14 02 80 00 00 	movabs $0x800214,%r9
+  801842:	00 00 00 
+  801845:	41 ff d1             	call   *%r9
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  801848:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  80184f:	00 00 00 
+  801852:	8b 0f                	mov    (%rdi),%ecx
+  801854:	8d 71 01             	lea    0x1(%rcx),%esi
+  801857:	89 37                	mov    %esi,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  801859:	48 63 c9             	movslq %ecx,%rcx
+  80185c:	48 8d 34 09          	lea    (%rcx,%rcx,1),%rsi
+  801860:	48 8d 3c 0e          	lea    (%rsi,%rcx,1),%rdi
+  801864:	41 c7 04 ff 01 00 00 	movl   $0x1,(%r15,%rdi,8)
+  80186b:	00 
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  80186c:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  801872:	41 89 54 ff 04       	mov    %edx,0x4(%r15,%rdi,8)
+	op->po_srcva = op->po_dstva = va;
+  801877:	49 89 44 ff 10       	mov    %rax,0x10(%r15,%rdi,8)
+  80187c:	49 89 44 ff 08       	mov    %rax,0x8(%r15,%rdi,8)
+}
+  801881:	eb 76                	jmp    8018f9 <ufork+0x214>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U | PTE_COW);
+  801883:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  80188a:	00 00 00 
+  80188d:	8b 17                	mov    (%rdi),%edx
+  80188f:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  801892:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  801894:	48 63 d2             	movslq %edx,%rdx
+  801897:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  80189b:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  80189f:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  8018a6:	00 
+	op->po_perm = perm;
+  8018a7:	41 c7 44 f7 04 05 08 	movl   $0x805,0x4(%r15,%rsi,8)
+  8018ae:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  8018b0:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  8018b5:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+		dupqueue(&dup_self[ndup_self++], va, PTE_P | PTE_U | PTE_COW);
+  8018ba:	48 b9 20 30 80 00 00 	movabs $0x803020,%rcx
+  8018c1:	00 00 00 
+  8018c4:	8b 11                	mov    (%rcx),%edx
+  8018c6:	8d 72 01             	lea    0x1(%rdx),%esi
+  8018c9:	89 31                	mov    %esi,(%rcx)
+	op->po_op = PAGEOP_MAP;
+  8018cb:	48 be 40 30 80 00 00 	movabs $0x803040,%rsi
+  8018d2:	00 00 00 
+  8018d5:	48 63 d2             	movslq %edx,%rdx
+  8018d8:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  8018dc:	48 8d 3c 11          	lea    (%rcx,%rdx,1),%rdi
+  8018e0:	c7 04 fe 01 00 00 00 	movl   $0x1,(%rsi,%rdi,8)
+	op->po_perm = perm;
+  8018e7:	c7 44 fe 04 05 08 00 	movl   $0x805,0x4(%rsi,%rdi,8)
+  8018ee:	00 
+	op->po_srcva = op->po_dstva = va;
+  8018ef:	48 89 44 fe 10       	mov    %rax,0x10(%rsi,%rdi,8)
+  8018f4:	48 89 44 fe 08       	mov    %rax,0x8(%rsi,%rdi,8)
+	if (ndup_child == DUP_BATCH) {
+  8018f9:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  801900:	00 00 00 
+  801903:	83 38 40             	cmpl   $0x40,(%rax)
+  801906:	0f 84 a4 00 00 00    	je     8019b0 <ufork+0x2cb>
+				for (int l = 0; l < NPTENTRIES; l++) {
+  80190c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801913:	49 83 c4 01          	add    $0x1,%r12
+  801917:	4d 39 ec             	cmp    %r13,%r12
+  80191a:	0f 84 d4 00 00 00    	je     8019f4 <ufork+0x30f>
+					if (va >= UTOP) {
+  801920:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  801925:	48 39 d8             	cmp    %rbx,%rax
+  801928:	0f 82 6d 01 00 00    	jb     801a9b <ufork+0x3b6>
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  80192e:	48 b8 00 10 80 43 ff 	movabs $0xffffffff43801000,%rax
+  801935:	ff ff ff 
+  801938:	48 01 d8             	add    %rbx,%rax
+  80193b:	48 3d ff 0f 00 00    	cmp    $0xfff,%rax
+  801941:	76 c9                	jbe    80190c <ufork+0x227>
+					if (!(uvpt[pn] & PTE_P)) {
+  801943:	4b 8b 04 e6          	mov    (%r14,%r12,8),%rax
+  801947:	a8 01                	test   $0x1,%al
+  801949:	74 c1                	je     80190c <ufork+0x227>
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  80194b:	48 b8 00 f0 ff ff ff 	movabs $0xffffffff000,%rax
+  801952:	0f 00 00 
+  801955:	48 21 d8             	and    %rbx,%rax
+	pte_t pte = uvpt[pn];
+  801958:	44 89 e2             	mov    %r12d,%edx
+  80195b:	49 8b 14 d6          	mov    (%r14,%rdx,8),%rdx
+	if (pte & PTE_SHARE) {
+  80195f:	f6 c6 04             	test   $0x4,%dh
+  801962:	0f 85 e0 fe ff ff    	jne    801848 <ufork+0x163>
+	} else if ((pte & PTE_W) || (pte & PTE_COW)) {
+  801968:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  80196e:	0f 85 0f ff ff ff    	jne    801883 <ufork+0x19e>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U);
+  801974:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  80197b:	00 00 00 
+  80197e:	8b 17                	mov    (%rdi),%edx
+  801980:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  801983:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  801985:	48 63 d2             	movslq %edx,%rdx
+  801988:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  80198c:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  801990:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  801997:	00 
+	op->po_perm = perm;
+  801998:	41 c7 44 f7 04 05 00 	movl   $0x5,0x4(%r15,%rsi,8)
+  80199f:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  8019a1:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  8019a6:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+}
+  8019ab:	e9 49 ff ff ff       	jmp    8018f9 <ufork+0x214>
+		return dupflush(envid);
+  8019b0:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8019b3:	48 b8 c1 15 80 00 00 	movabs $0x8015c1,%rax
+  8019ba:	00 00 00 
+  8019bd:	ff d0                	call   *%rax
+					if (r < 0) {
+  8019bf:	85 c0                	test   %eax,%eax
+  8019c1:	0f 89 45 ff ff ff    	jns    80190c <ufork+0x227>
+						panic("duppage failed:  %e", r);
+  8019c7:	89 c1                	mov    %eax,%ecx
+  8019c9:	48 ba c7 23 80 00 00 	movabs $0x8023c7,%rdx
+  8019d0:	00 00 00 
+  8019d3:	be 20 01 00 00       	mov    $0x120,%esi
+  8019d8:	48 bf 87 23 80 00 00 	movabs $0x802387,%rdi
+  8019df:	00 00 00 
+  8019e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e7:	49 b8 14 02 80 00 00 	movabs $0x800214,%r8
+  8019ee:	00 00 00 
+  8019f1:	41 ff d0             	call   *%r8
+			for (int k = 0; k < NPTENTRIES; k++) {
+  8019f4:	81 45 ac 00 02 00 00 	addl   $0x200,-0x54(%rbp)
+  8019fb:	83 45 c8 01          	addl   $0x1,-0x38(%rbp)
+  8019ff:	48 81 45 b0 00 00 20 	addq   $0x200000,-0x50(%rbp)
+  801a06:	00 
+  801a07:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a0b:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  801a11:	0f 85 6f fd ff ff    	jne    801786 <ufork+0xa1>
+  801a17:	44 8b 6d a8          	mov    -0x58(%rbp),%r13d
+  801a1b:	eb 5d                	jmp    801a7a <ufork+0x395>
+	for (int i = 0; i < NPTENTRIES; i++) {
+  801a1d:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  801a22:	48 81 7d c0 00 02 00 	cmpq   $0x200,-0x40(%rbp)
+  801a29:	00 
+  801a2a:	74 6f                	je     801a9b <ufork+0x3b6>
+		if (!(uvpml4e[i] & PTE_P)) {
+  801a2c:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  801a30:	48 63 c3             	movslq %ebx,%rax
+  801a33:	48 be 00 20 40 80 00 	movabs $0x10080402000,%rsi
+  801a3a:	01 00 00 
+  801a3d:	48 8b 04 c6          	mov    (%rsi,%rax,8),%rax
+  801a41:	a8 01                	test   $0x1,%al
+  801a43:	74 d8                	je     801a1d <ufork+0x338>
+  801a45:	41 89 dc             	mov    %ebx,%r12d
+  801a48:	41 c1 e4 09          	shl    $0x9,%r12d
+  801a4c:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801a53:	00 
+					if (!(uvpt[pn] & PTE_P)) {
+  801a54:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  801a5b:	01 00 00 
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  801a5e:	45 89 e5             	mov    %r12d,%r13d
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  801a61:	49 63 c5             	movslq %r13d,%rax
+  801a64:	48 bb 00 00 40 80 00 	movabs $0x10080400000,%rbx
+  801a6b:	01 00 00 
+  801a6e:	48 8b 04 c3          	mov    (%rbx,%rax,8),%rax
+  801a72:	a8 01                	test   $0x1,%al
+  801a74:	0f 85 ee fc ff ff    	jne    801768 <ufork+0x83>
+		for (int j = 0; j < NPTENTRIES; j++) {
+  801a7a:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  801a81:	40 
+  801a82:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a86:	41 83 c5 01          	add    $0x1,%r13d
+  801a8a:	48 b9 00 00 00 00 80 	movabs $0x8000000000,%rcx
+  801a91:	00 00 00 
+  801a94:	48 39 c8             	cmp    %rcx,%rax
+  801a97:	75 c8                	jne    801a61 <ufork+0x37c>
+  801a99:	eb 82                	jmp    801a1d <ufork+0x338>
+	r = dupflush(envid);
+  801a9b:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801a9e:	48 b8 c1 15 80 00 00 	movabs $0x8015c1,%rax
+  801aa5:	00 00 00 
+  801aa8:	ff d0                	call   *%rax
+	if (r < 0) {
+  801aaa:	85 c0                	test   %eax,%eax
+  801aac:	78 6c                	js     801b1a <ufork+0x435>
+	r = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801aae:	ba 07 00 00 00       	mov    $0x7,%edx
+  801ab3:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801ab8:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801abb:	48 b8 37 10 80 00 00 	movabs $0x801037,%rax
+  801ac2:	00 00 00 
+  801ac5:	ff d0                	call   *%rax
+	if (r < 0) {
+  801ac7:	85 c0                	test   %eax,%eax
+  801ac9:	78 7c                	js     801b47 <ufork+0x462>
+	r = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  801acb:	48 be b7 1c 80 00 00 	movabs $0x801cb7,%rsi
+  801ad2:	00 00 00 
+  801ad5:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801ad8:	48 b8 4f 13 80 00 00 	movabs $0x80134f,%rax
+  801adf:	00 00 00 
+  801ae2:	ff d0                	call   *%rax
+	if (r < 0) {
+  801ae4:	85 c0                	test   %eax,%eax
+  801ae6:	0f 88 88 00 00 00    	js     801b74 <ufork+0x48f>
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  801aec:	be 02 00 00 00       	mov    $0x2,%esi
+  801af1:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801af4:	48 b8 f4 12 80 00 00 	movabs $0x8012f4,%rax
+  801afb:	00 00 00 
+  801afe:	ff d0                	call   *%rax
+	if (r < 0) {
+  801b00:	85 c0                	test   %eax,%eax
+  801b02:	0f 88 99 00 00 00    	js     801ba1 <ufork+0x4bc>
+}
+  801b08:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801b0b:	48 83 c4 38          	add    $0x38,%rsp
+  801b0f:	5b                   	pop    %rbx
+  801b10:	41 5c                	pop    %r12
+  801b12:	41 5d                	pop    %r13
+  801b14:	41 5e                	pop    %r14
+  801b16:	41 5f                	pop    %r15
+  801b18:	5d                   	pop    %rbp
+  801b19:	c3                   	ret
+		panic("duppage failed:  %e", r);
+  801b1a:	89 c1                	mov    %eax,%ecx
+  801b1c:	48 ba c7 23 80 00 00 	movabs $0x8023c7,%rdx
+  801b23:	00 00 00 
+  801b26:	be 29 01 00 00       	mov    $0x129,%esi
+  801b2b:	48 bf 87 23 80 00 00 	movabs $0x802387,%rdi
+  801b32:	00 00 00 
+  801b35:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b3a:	49 b8 14 02 80 00 00 	movabs $0x800214,%r8
+  801b41:	00 00 00 
+  801b44:	41 ff d0             	call   *%r8
+		panic("sys_page_alloc for child exception stack failed: %e", r);
+  801b47:	89 c1                	mov    %eax,%ecx
+  801b49:	48 ba 08 23 80 00 00 	movabs $0x802308,%rdx
+  801b50:	00 00 00 
+  801b53:	be 2e 01 00 00       	mov    $0x12e,%esi
+  801b58:	48 bf 87 23 80 00 00 	movabs $0x802387,%rdi
+  801b5f:	00 00 00 
+  801b62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b67:	49 b8 14 02 80 00 00 	movabs $0x800214,%r8
+  801b6e:	00 00 00 
+  801b71:	41 ff d0             	call   *%r8
+		panic("sys_env_set_pgfault_upcall failed:  %e", r);
+  801b74:	89 c1                	mov    %eax,%ecx
+  801b76:	48 ba 40 23 80 00 00 	movabs $0x802340,%rdx
+  801b7d:	00 00 00 
+  801b80:	be 33 01 00 00       	mov    $0x133,%esi
+  801b85:	48 bf 87 23 80 00 00 	movabs $0x802387,%rdi
+  801b8c:	00 00 00 
+  801b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b94:	49 b8 14 02 80 00 00 	movabs $0x800214,%r8
+  801b9b:	00 00 00 
+  801b9e:	41 ff d0             	call   *%r8
+		panic("sys_env_set_status failed:  %e", r);
+  801ba1:	89 c1                	mov    %eax,%ecx
+  801ba3:	48 ba 68 23 80 00 00 	movabs $0x802368,%rdx
+  801baa:	00 00 00 
+  801bad:	be 38 01 00 00       	mov    $0x138,%esi
+  801bb2:	48 bf 87 23 80 00 00 	movabs $0x802387,%rdi
+  801bb9:	00 00 00 
+  801bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc1:	49 b8 14 02 80 00 00 	movabs $0x800214,%r8
+  801bc8:	00 00 00 
+  801bcb:	41 ff d0             	call   *%r8
+
+0000000000801bce <sfork>:
+// on one stack, since nothing is private to the child.
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801bce:	55                   	push   %rbp
+  801bcf:	48 89 e5             	mov    %rsp,%rbp
+  801bd2:	48 89 f2             	mov    %rsi,%rdx
+	return sys_thread_create(thread_start, (uint64_t) fn, (uint64_t) arg);
+  801bd5:	48 89 fe             	mov    %rdi,%rsi
+  801bd8:	48 bf a3 16 80 00 00 	movabs $0x8016a3,%rdi
+  801bdf:	00 00 00 
+  801be2:	48 b8 c3 11 80 00 00 	movabs $0x8011c3,%rax
+  801be9:	00 00 00 
+  801bec:	ff d0                	call   *%rax
+}
+  801bee:	5d                   	pop    %rbp
+  801bef:	c3                   	ret
+
+0000000000801bf0 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801bf0:	55                   	push   %rbp
+  801bf1:	48 89 e5             	mov    %rsp,%rbp
+  801bf4:	53                   	push   %rbx
+  801bf5:	48 83 ec 08          	sub    $0x8,%rsp
+  801bf9:	48 89 fb             	mov    %rdi,%rbx
+	int r;
+
+	if (_pgfault_handler == 0) {
+  801bfc:	48 ba 40 3c 80 00 00 	movabs $0x803c40,%rdx
+  801c03:	00 00 00 
+  801c06:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801c0a:	74 13                	je     801c1f <set_pgfault_handler+0x2f>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801c0c:	48 89 d8             	mov    %rbx,%rax
+  801c0f:	48 a3 40 3c 80 00 00 	movabs %rax,0x803c40
+  801c16:	00 00 00 
+}
+  801c19:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c1d:	c9                   	leave
+  801c1e:	c3                   	ret
+		r = sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801c1f:	ba 07 00 00 00       	mov    $0x7,%edx
+  801c24:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801c29:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c2e:	48 b8 37 10 80 00 00 	movabs $0x801037,%rax
+  801c35:	00 00 00 
+  801c38:	ff d0                	call   *%rax
+		if (r < 0) {
+  801c3a:	85 c0                	test   %eax,%eax
+  801c3c:	78 4c                	js     801c8a <set_pgfault_handler+0x9a>
+		r = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801c3e:	48 be b7 1c 80 00 00 	movabs $0x801cb7,%rsi
+  801c45:	00 00 00 
+  801c48:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c4d:	48 b8 4f 13 80 00 00 	movabs $0x80134f,%rax
+  801c54:	00 00 00 
+  801c57:	ff d0                	call   *%rax
+		if (r < 0) {
+  801c59:	85 c0                	test   %eax,%eax
+  801c5b:	79 af                	jns    801c0c <set_pgfault_handler+0x1c>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+  801c5d:	89 c1                	mov    %eax,%ecx
+  801c5f:	48 ba 08 24 80 00 00 	movabs $0x802408,%rdx
+  801c66:	00 00 00 
+  801c69:	be 2c 00 00 00       	mov    $0x2c,%esi
+  801c6e:	48 bf f6 23 80 00 00 	movabs $0x8023f6,%rdi
+  801c75:	00 00 00 
+  801c78:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7d:	49 b8 14 02 80 00 00 	movabs $0x800214,%r8
+  801c84:	00 00 00 
+  801c87:	41 ff d0             	call   *%r8
+			panic("sys_page_alloc failed:  %e", r);
+  801c8a:	89 c1                	mov    %eax,%ecx
+  801c8c:	48 ba db 23 80 00 00 	movabs $0x8023db,%rdx
+  801c93:	00 00 00 
+  801c96:	be 28 00 00 00       	mov    $0x28,%esi
+  801c9b:	48 bf f6 23 80 00 00 	movabs $0x8023f6,%rdi
+  801ca2:	00 00 00 
+  801ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801caa:	49 b8 14 02 80 00 00 	movabs $0x800214,%r8
+  801cb1:	00 00 00 
+  801cb4:	41 ff d0             	call   *%r8
+
+0000000000801cb7 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi		// function argument: pointer to UTF
+  801cb7:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  801cba:	48 a1 40 3c 80 00 00 	movabs 0x803c40,%rax
+  801cc1:	00 00 00 
+	call *%rax
+  801cc4:	ff d0                	call   *%rax
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here. (Hint. You need to modify the trap time rsp to make room for the return rip ) */
+
+	movq  152(%rsp), %rax
+  801cc6:	48 8b 84 24 98 00 00 	mov    0x98(%rsp),%rax
+  801ccd:	00 
+	subq $8, %rax
+  801cce:	48 83 e8 08          	sub    $0x8,%rax
+	movq %rax, 152(%rsp)
+  801cd2:	48 89 84 24 98 00 00 	mov    %rax,0x98(%rsp)
+  801cd9:	00 
+
+	movq 136(%rsp), %rbx
+  801cda:	48 8b 9c 24 88 00 00 	mov    0x88(%rsp),%rbx
+  801ce1:	00 
+	movq %rbx, (%rax)
+  801ce2:	48 89 18             	mov    %rbx,(%rax)
+
+	/* Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here. (Hint, the oposite of _alltraps) */
+
+	addq $16, %rsp
+  801ce5:	48 83 c4 10          	add    $0x10,%rsp
+	
+	popq %r15
+  801ce9:	41 5f                	pop    %r15
+	popq %r14
+  801ceb:	41 5e                	pop    %r14
+	popq %r13
+  801ced:	41 5d                	pop    %r13
+	popq %r12
+  801cef:	41 5c                	pop    %r12
+	popq %r11
+  801cf1:	41 5b                	pop    %r11
+	popq %r10
+  801cf3:	41 5a                	pop    %r10
+	popq %r9
+  801cf5:	41 59                	pop    %r9
+	popq %r8
+  801cf7:	41 58                	pop    %r8
+	popq %rsi
+  801cf9:	5e                   	pop    %rsi
+	popq %rdi
+  801cfa:	5f                   	pop    %rdi
+	popq %rbp
+  801cfb:	5d                   	pop    %rbp
+	popq %rdx
+  801cfc:	5a                   	pop    %rdx
+	popq %rcx
+  801cfd:	59                   	pop    %rcx
+	popq %rbx
+  801cfe:	5b                   	pop    %rbx
+	popq %rax
+  801cff:	58                   	pop    %rax
+
+	addq $8, %rsp
+  801d00:	48 83 c4 08          	add    $0x8,%rsp
+	/* Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 4: Your code here. */
+
+	popfq
+  801d04:	9d                   	popf
+
+	/* Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here. */
+
+	popq %rsp
+  801d05:	5c                   	pop    %rsp
+
+	/* Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here. */
+  801d06:	c3                   	ret
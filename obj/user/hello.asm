@@ -0,0 +1,2269 @@
+
+obj/user/hello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 69 00 00 00       	call   80009a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+// hello, world
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	53                   	push   %rbx
+  800038:	48 83 ec 08          	sub    $0x8,%rsp
+	cprintf("hello, world\n");
+  80003c:	48 bf e0 12 80 00 00 	movabs $0x8012e0,%rdi
+  800043:	00 00 00 
+  800046:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004b:	48 bb 8d 01 80 00 00 	movabs $0x80018d,%rbx
+  800052:	00 00 00 
+  800055:	ff d3                	call   *%rbx
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800057:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  80005e:	00 
+	cprintf("i am environment %08x\n", thisenv->env_id);
+  80005f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800064:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800068:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80006c:	48 c1 e2 04          	shl    $0x4,%rdx
+  800070:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800077:	00 00 00 
+  80007a:	48 01 d0             	add    %rdx,%rax
+  80007d:	8b b0 b8 00 00 00    	mov    0xb8(%rax),%esi
+  800083:	48 bf ee 12 80 00 00 	movabs $0x8012ee,%rdi
+  80008a:	00 00 00 
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	ff d3                	call   *%rbx
+}
+  800094:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800098:	c9                   	leave
+  800099:	c3                   	ret
+
+000000000080009a <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  80009a:	55                   	push   %rbp
+  80009b:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80009e:	85 ff                	test   %edi,%edi
+  8000a0:	7e 0d                	jle    8000af <libmain+0x15>
+		binaryname = argv[0];
+  8000a2:	48 8b 06             	mov    (%rsi),%rax
+  8000a5:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  8000ac:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  8000af:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  8000b6:	00 00 00 
+  8000b9:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8000bb:	48 b8 c9 00 80 00 00 	movabs $0x8000c9,%rax
+  8000c2:	00 00 00 
+  8000c5:	ff d0                	call   *%rax
+}
+  8000c7:	5d                   	pop    %rbp
+  8000c8:	c3                   	ret
+
+00000000008000c9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000c9:	55                   	push   %rbp
+  8000ca:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  8000cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000d2:	48 b8 6a 0d 80 00 00 	movabs $0x800d6a,%rax
+  8000d9:	00 00 00 
+  8000dc:	ff d0                	call   *%rax
+}
+  8000de:	5d                   	pop    %rbp
+  8000df:	c3                   	ret
+
+00000000008000e0 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000e0:	55                   	push   %rbp
+  8000e1:	48 89 e5             	mov    %rsp,%rbp
+  8000e4:	53                   	push   %rbx
+  8000e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8000e9:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  8000ec:	8b 06                	mov    (%rsi),%eax
+  8000ee:	8d 50 01             	lea    0x1(%rax),%edx
+  8000f1:	89 16                	mov    %edx,(%rsi)
+  8000f3:	48 98                	cltq
+  8000f5:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  8000fa:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800100:	74 0a                	je     80010c <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800102:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800106:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80010a:	c9                   	leave
+  80010b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80010c:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800110:	be ff 00 00 00       	mov    $0xff,%esi
+  800115:	48 b8 32 0d 80 00 00 	movabs $0x800d32,%rax
+  80011c:	00 00 00 
+  80011f:	ff d0                	call   *%rax
+		b->idx = 0;
+  800121:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800127:	eb d9                	jmp    800102 <putch+0x22>
+
+0000000000800129 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800129:	55                   	push   %rbp
+  80012a:	48 89 e5             	mov    %rsp,%rbp
+  80012d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800134:	48 89 fa             	mov    %rdi,%rdx
+  800137:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  80013a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800141:	00 00 00 
+	b.cnt = 0;
+  800144:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80014b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80014e:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  800155:	48 bf e0 00 80 00 00 	movabs $0x8000e0,%rdi
+  80015c:	00 00 00 
+  80015f:	48 b8 47 03 80 00 00 	movabs $0x800347,%rax
+  800166:	00 00 00 
+  800169:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  80016b:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  800172:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800179:	48 b8 32 0d 80 00 00 	movabs $0x800d32,%rax
+  800180:	00 00 00 
+  800183:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  800185:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  80018b:	c9                   	leave
+  80018c:	c3                   	ret
+
+000000000080018d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80018d:	55                   	push   %rbp
+  80018e:	48 89 e5             	mov    %rsp,%rbp
+  800191:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800198:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80019f:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8001a6:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8001ad:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8001b4:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8001bb:	84 c0                	test   %al,%al
+  8001bd:	74 20                	je     8001df <cprintf+0x52>
+  8001bf:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8001c3:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8001c7:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8001cb:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8001cf:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8001d3:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8001d7:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8001db:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001df:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  8001e6:	00 00 00 
+  8001e9:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8001f0:	00 00 00 
+  8001f3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001f7:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8001fe:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800205:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  80020c:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  800213:	48 b8 29 01 80 00 00 	movabs $0x800129,%rax
+  80021a:	00 00 00 
+  80021d:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  80021f:	c9                   	leave
+  800220:	c3                   	ret
+
+0000000000800221 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800221:	55                   	push   %rbp
+  800222:	48 89 e5             	mov    %rsp,%rbp
+  800225:	41 57                	push   %r15
+  800227:	41 56                	push   %r14
+  800229:	41 55                	push   %r13
+  80022b:	41 54                	push   %r12
+  80022d:	53                   	push   %rbx
+  80022e:	48 83 ec 18          	sub    $0x18,%rsp
+  800232:	49 89 fc             	mov    %rdi,%r12
+  800235:	49 89 f5             	mov    %rsi,%r13
+  800238:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80023c:	44 89 c3             	mov    %r8d,%ebx
+  80023f:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800242:	41 89 cf             	mov    %ecx,%r15d
+  800245:	4c 39 fa             	cmp    %r15,%rdx
+  800248:	72 29                	jb     800273 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80024a:	48 89 d0             	mov    %rdx,%rax
+  80024d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800252:	49 f7 f7             	div    %r15
+  800255:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800259:	48 89 c2             	mov    %rax,%rdx
+  80025c:	48 b8 21 02 80 00 00 	movabs $0x800221,%rax
+  800263:	00 00 00 
+  800266:	ff d0                	call   *%rax
+  800268:	eb 10                	jmp    80027a <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80026a:	4c 89 ee             	mov    %r13,%rsi
+  80026d:	44 89 f7             	mov    %r14d,%edi
+  800270:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  800273:	83 eb 01             	sub    $0x1,%ebx
+  800276:	85 db                	test   %ebx,%ebx
+  800278:	7f f0                	jg     80026a <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80027a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80027e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800283:	49 f7 f7             	div    %r15
+  800286:	48 b8 0f 13 80 00 00 	movabs $0x80130f,%rax
+  80028d:	00 00 00 
+  800290:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  800294:	4c 89 ee             	mov    %r13,%rsi
+  800297:	41 ff d4             	call   *%r12
+}
+  80029a:	48 83 c4 18          	add    $0x18,%rsp
+  80029e:	5b                   	pop    %rbx
+  80029f:	41 5c                	pop    %r12
+  8002a1:	41 5d                	pop    %r13
+  8002a3:	41 5e                	pop    %r14
+  8002a5:	41 5f                	pop    %r15
+  8002a7:	5d                   	pop    %rbp
+  8002a8:	c3                   	ret
+
+00000000008002a9 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  8002a9:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  8002ad:	48 8b 06             	mov    (%rsi),%rax
+  8002b0:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002b4:	73 0a                	jae    8002c0 <sprintputch+0x17>
+		*b->buf++ = ch;
+  8002b6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002ba:	48 89 16             	mov    %rdx,(%rsi)
+  8002bd:	40 88 38             	mov    %dil,(%rax)
+}
+  8002c0:	c3                   	ret
+
+00000000008002c1 <printfmt>:
+{
+  8002c1:	55                   	push   %rbp
+  8002c2:	48 89 e5             	mov    %rsp,%rbp
+  8002c5:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8002cc:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8002d3:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8002da:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8002e1:	84 c0                	test   %al,%al
+  8002e3:	74 20                	je     800305 <printfmt+0x44>
+  8002e5:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8002e9:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8002ed:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8002f1:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8002f5:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8002f9:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8002fd:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800301:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  800305:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  80030c:	00 00 00 
+  80030f:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800316:	00 00 00 
+  800319:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80031d:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800324:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80032b:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800332:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800339:	48 b8 47 03 80 00 00 	movabs $0x800347,%rax
+  800340:	00 00 00 
+  800343:	ff d0                	call   *%rax
+}
+  800345:	c9                   	leave
+  800346:	c3                   	ret
+
+0000000000800347 <vprintfmt>:
+{
+  800347:	55                   	push   %rbp
+  800348:	48 89 e5             	mov    %rsp,%rbp
+  80034b:	41 57                	push   %r15
+  80034d:	41 56                	push   %r14
+  80034f:	41 55                	push   %r13
+  800351:	41 54                	push   %r12
+  800353:	53                   	push   %rbx
+  800354:	48 83 ec 48          	sub    $0x48,%rsp
+  800358:	49 89 fe             	mov    %rdi,%r14
+  80035b:	49 89 f5             	mov    %rsi,%r13
+  80035e:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  800361:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  800365:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  800369:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80036d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  800371:	eb 09                	jmp    80037c <vprintfmt+0x35>
+			putch(ch, putdat);
+  800373:	4c 89 ee             	mov    %r13,%rsi
+  800376:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800379:	4c 89 e3             	mov    %r12,%rbx
+  80037c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800380:	0f b6 3b             	movzbl (%rbx),%edi
+  800383:	83 ff 25             	cmp    $0x25,%edi
+  800386:	74 13                	je     80039b <vprintfmt+0x54>
+			if (ch == '\0')
+  800388:	85 ff                	test   %edi,%edi
+  80038a:	75 e7                	jne    800373 <vprintfmt+0x2c>
+}
+  80038c:	48 83 c4 48          	add    $0x48,%rsp
+  800390:	5b                   	pop    %rbx
+  800391:	41 5c                	pop    %r12
+  800393:	41 5d                	pop    %r13
+  800395:	41 5e                	pop    %r14
+  800397:	41 5f                	pop    %r15
+  800399:	5d                   	pop    %rbp
+  80039a:	c3                   	ret
+		padc = ' ';
+  80039b:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  80039f:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  8003a6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  8003ac:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  8003b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b8:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003bd:	41 0f b6 14 24       	movzbl (%r12),%edx
+  8003c2:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  8003c5:	3c 55                	cmp    $0x55,%al
+  8003c7:	0f 87 4f 05 00 00    	ja     80091c <vprintfmt+0x5d5>
+  8003cd:	0f b6 c0             	movzbl %al,%eax
+  8003d0:	48 be e0 13 80 00 00 	movabs $0x8013e0,%rsi
+  8003d7:	00 00 00 
+  8003da:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  8003dd:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  8003e0:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  8003e4:	eb d2                	jmp    8003b8 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e6:	49 89 dc             	mov    %rbx,%r12
+  8003e9:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  8003ed:	eb c9                	jmp    8003b8 <vprintfmt+0x71>
+  8003ef:	0f b6 d2             	movzbl %dl,%edx
+  8003f2:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  8003f5:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  8003fb:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  8003ff:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  800404:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  800409:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  80040c:	83 f8 09             	cmp    $0x9,%eax
+  80040f:	77 20                	ja     800431 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  800411:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  800415:	eb e4                	jmp    8003fb <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  800417:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80041a:	83 f8 2f             	cmp    $0x2f,%eax
+  80041d:	77 27                	ja     800446 <vprintfmt+0xff>
+  80041f:	89 c2                	mov    %eax,%edx
+  800421:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800425:	83 c0 08             	add    $0x8,%eax
+  800428:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80042b:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  80042e:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  800431:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800435:	79 81                	jns    8003b8 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  800437:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  80043b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800441:	e9 72 ff ff ff       	jmp    8003b8 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  800446:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80044a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80044e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800452:	eb d7                	jmp    80042b <vprintfmt+0xe4>
+			if (width < 0)
+  800454:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  800457:	85 f6                	test   %esi,%esi
+  800459:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045e:	0f 49 c6             	cmovns %esi,%eax
+  800461:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800464:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800467:	e9 4c ff ff ff       	jmp    8003b8 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  80046c:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  80046f:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  800476:	e9 3d ff ff ff       	jmp    8003b8 <vprintfmt+0x71>
+			lflag++;
+  80047b:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80047e:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800481:	e9 32 ff ff ff       	jmp    8003b8 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  800486:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800489:	83 f8 2f             	cmp    $0x2f,%eax
+  80048c:	77 19                	ja     8004a7 <vprintfmt+0x160>
+  80048e:	89 c2                	mov    %eax,%edx
+  800490:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800494:	83 c0 08             	add    $0x8,%eax
+  800497:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80049a:	8b 3a                	mov    (%rdx),%edi
+  80049c:	4c 89 ee             	mov    %r13,%rsi
+  80049f:	41 ff d6             	call   *%r14
+			break;
+  8004a2:	e9 d5 fe ff ff       	jmp    80037c <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  8004a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004b3:	eb e5                	jmp    80049a <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  8004b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8004bb:	77 5a                	ja     800517 <vprintfmt+0x1d0>
+  8004bd:	89 c2                	mov    %eax,%edx
+  8004bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004c3:	83 c0 08             	add    $0x8,%eax
+  8004c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  8004c9:	8b 02                	mov    (%rdx),%eax
+  8004cb:	89 c1                	mov    %eax,%ecx
+  8004cd:	f7 d9                	neg    %ecx
+  8004cf:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004d2:	83 f9 08             	cmp    $0x8,%ecx
+  8004d5:	7f 4e                	jg     800525 <vprintfmt+0x1de>
+  8004d7:	48 63 c1             	movslq %ecx,%rax
+  8004da:	48 ba a0 16 80 00 00 	movabs $0x8016a0,%rdx
+  8004e1:	00 00 00 
+  8004e4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004e8:	48 85 c0             	test   %rax,%rax
+  8004eb:	74 38                	je     800525 <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  8004ed:	48 89 c1             	mov    %rax,%rcx
+  8004f0:	48 ba 30 13 80 00 00 	movabs $0x801330,%rdx
+  8004f7:	00 00 00 
+  8004fa:	4c 89 ee             	mov    %r13,%rsi
+  8004fd:	4c 89 f7             	mov    %r14,%rdi
+  800500:	b8 00 00 00 00       	mov    $0x0,%eax
+  800505:	49 b8 c1 02 80 00 00 	movabs $0x8002c1,%r8
+  80050c:	00 00 00 
+  80050f:	41 ff d0             	call   *%r8
+  800512:	e9 65 fe ff ff       	jmp    80037c <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  800517:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80051b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80051f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800523:	eb a4                	jmp    8004c9 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  800525:	48 ba 27 13 80 00 00 	movabs $0x801327,%rdx
+  80052c:	00 00 00 
+  80052f:	4c 89 ee             	mov    %r13,%rsi
+  800532:	4c 89 f7             	mov    %r14,%rdi
+  800535:	b8 00 00 00 00       	mov    $0x0,%eax
+  80053a:	49 b8 c1 02 80 00 00 	movabs $0x8002c1,%r8
+  800541:	00 00 00 
+  800544:	41 ff d0             	call   *%r8
+  800547:	e9 30 fe ff ff       	jmp    80037c <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  80054c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80054f:	83 f8 2f             	cmp    $0x2f,%eax
+  800552:	77 36                	ja     80058a <vprintfmt+0x243>
+  800554:	89 c2                	mov    %eax,%edx
+  800556:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80055a:	83 c0 08             	add    $0x8,%eax
+  80055d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800560:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800563:	48 85 c9             	test   %rcx,%rcx
+  800566:	48 b8 20 13 80 00 00 	movabs $0x801320,%rax
+  80056d:	00 00 00 
+  800570:	48 0f 45 c1          	cmovne %rcx,%rax
+  800574:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800578:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80057c:	7e 06                	jle    800584 <vprintfmt+0x23d>
+  80057e:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800582:	75 14                	jne    800598 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800584:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800588:	eb 64                	jmp    8005ee <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  80058a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80058e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800592:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800596:	eb c8                	jmp    800560 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800598:	49 63 f7             	movslq %r15d,%rsi
+  80059b:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  80059f:	48 b8 2a 0a 80 00 00 	movabs $0x800a2a,%rax
+  8005a6:	00 00 00 
+  8005a9:	ff d0                	call   *%rax
+  8005ab:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005ae:	29 c1                	sub    %eax,%ecx
+  8005b0:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  8005b3:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  8005b6:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  8005ba:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005bd:	eb 0d                	jmp    8005cc <vprintfmt+0x285>
+					putch(padc, putdat);
+  8005bf:	4c 89 ee             	mov    %r13,%rsi
+  8005c2:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  8005c5:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005c8:	41 83 ec 01          	sub    $0x1,%r12d
+  8005cc:	45 85 e4             	test   %r12d,%r12d
+  8005cf:	7f ee                	jg     8005bf <vprintfmt+0x278>
+  8005d1:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  8005d4:	85 c9                	test   %ecx,%ecx
+  8005d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005db:	0f 49 c1             	cmovns %ecx,%eax
+  8005de:	29 c1                	sub    %eax,%ecx
+  8005e0:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  8005e3:	eb 9f                	jmp    800584 <vprintfmt+0x23d>
+					putch(ch, putdat);
+  8005e5:	4c 89 ee             	mov    %r13,%rsi
+  8005e8:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005eb:	4c 89 e2             	mov    %r12,%rdx
+  8005ee:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8005f2:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8005f8:	0f be f8             	movsbl %al,%edi
+  8005fb:	85 ff                	test   %edi,%edi
+  8005fd:	74 29                	je     800628 <vprintfmt+0x2e1>
+  8005ff:	45 85 ff             	test   %r15d,%r15d
+  800602:	78 06                	js     80060a <vprintfmt+0x2c3>
+  800604:	41 83 ef 01          	sub    $0x1,%r15d
+  800608:	78 1e                	js     800628 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80060a:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  80060e:	74 d5                	je     8005e5 <vprintfmt+0x29e>
+  800610:	0f be c0             	movsbl %al,%eax
+  800613:	83 e8 20             	sub    $0x20,%eax
+  800616:	83 f8 5e             	cmp    $0x5e,%eax
+  800619:	76 ca                	jbe    8005e5 <vprintfmt+0x29e>
+					putch('?', putdat);
+  80061b:	4c 89 ee             	mov    %r13,%rsi
+  80061e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800623:	41 ff d6             	call   *%r14
+  800626:	eb c3                	jmp    8005eb <vprintfmt+0x2a4>
+  800628:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  80062c:	8b 45 98             	mov    -0x68(%rbp),%eax
+  80062f:	41 01 c4             	add    %eax,%r12d
+  800632:	41 29 d4             	sub    %edx,%r12d
+  800635:	eb 0f                	jmp    800646 <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  800637:	4c 89 ee             	mov    %r13,%rsi
+  80063a:	bf 20 00 00 00       	mov    $0x20,%edi
+  80063f:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800642:	41 83 ec 01          	sub    $0x1,%r12d
+  800646:	45 85 e4             	test   %r12d,%r12d
+  800649:	7f ec                	jg     800637 <vprintfmt+0x2f0>
+  80064b:	e9 2c fd ff ff       	jmp    80037c <vprintfmt+0x35>
+	if (lflag >= 2)
+  800650:	83 f9 01             	cmp    $0x1,%ecx
+  800653:	7f 1d                	jg     800672 <vprintfmt+0x32b>
+	else if (lflag)
+  800655:	85 c9                	test   %ecx,%ecx
+  800657:	74 5e                	je     8006b7 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800659:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80065c:	83 f8 2f             	cmp    $0x2f,%eax
+  80065f:	77 48                	ja     8006a9 <vprintfmt+0x362>
+  800661:	89 c2                	mov    %eax,%edx
+  800663:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800667:	83 c0 08             	add    $0x8,%eax
+  80066a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80066d:	4c 8b 22             	mov    (%rdx),%r12
+  800670:	eb 17                	jmp    800689 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800672:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800675:	83 f8 2f             	cmp    $0x2f,%eax
+  800678:	77 21                	ja     80069b <vprintfmt+0x354>
+  80067a:	89 c2                	mov    %eax,%edx
+  80067c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800680:	83 c0 08             	add    $0x8,%eax
+  800683:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800686:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800689:	4d 85 e4             	test   %r12,%r12
+  80068c:	78 50                	js     8006de <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  80068e:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800691:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800696:	e9 b4 01 00 00       	jmp    80084f <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  80069b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80069f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a7:	eb dd                	jmp    800686 <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  8006a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b5:	eb b6                	jmp    80066d <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  8006b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8006bd:	77 11                	ja     8006d0 <vprintfmt+0x389>
+  8006bf:	89 c2                	mov    %eax,%edx
+  8006c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c5:	83 c0 08             	add    $0x8,%eax
+  8006c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006cb:	4c 63 22             	movslq (%rdx),%r12
+  8006ce:	eb b9                	jmp    800689 <vprintfmt+0x342>
+  8006d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006dc:	eb ed                	jmp    8006cb <vprintfmt+0x384>
+				putch('-', putdat);
+  8006de:	4c 89 ee             	mov    %r13,%rsi
+  8006e1:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8006e6:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  8006e9:	4c 89 e2             	mov    %r12,%rdx
+  8006ec:	48 f7 da             	neg    %rdx
+			base = 10;
+  8006ef:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8006f4:	e9 56 01 00 00       	jmp    80084f <vprintfmt+0x508>
+	if (lflag >= 2)
+  8006f9:	83 f9 01             	cmp    $0x1,%ecx
+  8006fc:	7f 25                	jg     800723 <vprintfmt+0x3dc>
+	else if (lflag)
+  8006fe:	85 c9                	test   %ecx,%ecx
+  800700:	74 5e                	je     800760 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800702:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800705:	83 f8 2f             	cmp    $0x2f,%eax
+  800708:	77 48                	ja     800752 <vprintfmt+0x40b>
+  80070a:	89 c2                	mov    %eax,%edx
+  80070c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800710:	83 c0 08             	add    $0x8,%eax
+  800713:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800716:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800719:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  80071e:	e9 2c 01 00 00       	jmp    80084f <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800723:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800726:	83 f8 2f             	cmp    $0x2f,%eax
+  800729:	77 19                	ja     800744 <vprintfmt+0x3fd>
+  80072b:	89 c2                	mov    %eax,%edx
+  80072d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800731:	83 c0 08             	add    $0x8,%eax
+  800734:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800737:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  80073a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  80073f:	e9 0b 01 00 00       	jmp    80084f <vprintfmt+0x508>
+  800744:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800748:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80074c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800750:	eb e5                	jmp    800737 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800752:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800756:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80075a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80075e:	eb b6                	jmp    800716 <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800760:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800763:	83 f8 2f             	cmp    $0x2f,%eax
+  800766:	77 18                	ja     800780 <vprintfmt+0x439>
+  800768:	89 c2                	mov    %eax,%edx
+  80076a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80076e:	83 c0 08             	add    $0x8,%eax
+  800771:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800774:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800776:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  80077b:	e9 cf 00 00 00       	jmp    80084f <vprintfmt+0x508>
+  800780:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800784:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800788:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80078c:	eb e6                	jmp    800774 <vprintfmt+0x42d>
+	if (lflag >= 2)
+  80078e:	83 f9 01             	cmp    $0x1,%ecx
+  800791:	7f 25                	jg     8007b8 <vprintfmt+0x471>
+	else if (lflag)
+  800793:	85 c9                	test   %ecx,%ecx
+  800795:	74 5b                	je     8007f2 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800797:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80079a:	83 f8 2f             	cmp    $0x2f,%eax
+  80079d:	77 45                	ja     8007e4 <vprintfmt+0x49d>
+  80079f:	89 c2                	mov    %eax,%edx
+  8007a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a5:	83 c0 08             	add    $0x8,%eax
+  8007a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ab:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  8007ae:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  8007b3:	e9 97 00 00 00       	jmp    80084f <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8007b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8007be:	77 16                	ja     8007d6 <vprintfmt+0x48f>
+  8007c0:	89 c2                	mov    %eax,%edx
+  8007c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c6:	83 c0 08             	add    $0x8,%eax
+  8007c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007cc:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  8007cf:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  8007d4:	eb 79                	jmp    80084f <vprintfmt+0x508>
+  8007d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e2:	eb e8                	jmp    8007cc <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  8007e4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f0:	eb b9                	jmp    8007ab <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  8007f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f8:	77 15                	ja     80080f <vprintfmt+0x4c8>
+  8007fa:	89 c2                	mov    %eax,%edx
+  8007fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800800:	83 c0 08             	add    $0x8,%eax
+  800803:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800806:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800808:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  80080d:	eb 40                	jmp    80084f <vprintfmt+0x508>
+  80080f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800813:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800817:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081b:	eb e9                	jmp    800806 <vprintfmt+0x4bf>
+			putch('0', putdat);
+  80081d:	4c 89 ee             	mov    %r13,%rsi
+  800820:	bf 30 00 00 00       	mov    $0x30,%edi
+  800825:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800828:	4c 89 ee             	mov    %r13,%rsi
+  80082b:	bf 78 00 00 00       	mov    $0x78,%edi
+  800830:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800833:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800836:	83 f8 2f             	cmp    $0x2f,%eax
+  800839:	77 34                	ja     80086f <vprintfmt+0x528>
+  80083b:	89 c2                	mov    %eax,%edx
+  80083d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800841:	83 c0 08             	add    $0x8,%eax
+  800844:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800847:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  80084a:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  80084f:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800854:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800858:	4c 89 ee             	mov    %r13,%rsi
+  80085b:	4c 89 f7             	mov    %r14,%rdi
+  80085e:	48 b8 21 02 80 00 00 	movabs $0x800221,%rax
+  800865:	00 00 00 
+  800868:	ff d0                	call   *%rax
+			break;
+  80086a:	e9 0d fb ff ff       	jmp    80037c <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  80086f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800873:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800877:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087b:	eb ca                	jmp    800847 <vprintfmt+0x500>
+	if (lflag >= 2)
+  80087d:	83 f9 01             	cmp    $0x1,%ecx
+  800880:	7f 22                	jg     8008a4 <vprintfmt+0x55d>
+	else if (lflag)
+  800882:	85 c9                	test   %ecx,%ecx
+  800884:	74 58                	je     8008de <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800886:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800889:	83 f8 2f             	cmp    $0x2f,%eax
+  80088c:	77 42                	ja     8008d0 <vprintfmt+0x589>
+  80088e:	89 c2                	mov    %eax,%edx
+  800890:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800894:	83 c0 08             	add    $0x8,%eax
+  800897:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089a:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  80089d:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  8008a2:	eb ab                	jmp    80084f <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8008a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008aa:	77 16                	ja     8008c2 <vprintfmt+0x57b>
+  8008ac:	89 c2                	mov    %eax,%edx
+  8008ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b2:	83 c0 08             	add    $0x8,%eax
+  8008b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b8:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  8008bb:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  8008c0:	eb 8d                	jmp    80084f <vprintfmt+0x508>
+  8008c2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ce:	eb e8                	jmp    8008b8 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  8008d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008dc:	eb bc                	jmp    80089a <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  8008de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e4:	77 18                	ja     8008fe <vprintfmt+0x5b7>
+  8008e6:	89 c2                	mov    %eax,%edx
+  8008e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ec:	83 c0 08             	add    $0x8,%eax
+  8008ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f2:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  8008f4:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  8008f9:	e9 51 ff ff ff       	jmp    80084f <vprintfmt+0x508>
+  8008fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800902:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800906:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80090a:	eb e6                	jmp    8008f2 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  80090c:	4c 89 ee             	mov    %r13,%rsi
+  80090f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800914:	41 ff d6             	call   *%r14
+			break;
+  800917:	e9 60 fa ff ff       	jmp    80037c <vprintfmt+0x35>
+			putch('%', putdat);
+  80091c:	4c 89 ee             	mov    %r13,%rsi
+  80091f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800924:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800927:	4c 89 e3             	mov    %r12,%rbx
+  80092a:	eb 04                	jmp    800930 <vprintfmt+0x5e9>
+  80092c:	48 83 eb 01          	sub    $0x1,%rbx
+  800930:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800934:	75 f6                	jne    80092c <vprintfmt+0x5e5>
+  800936:	e9 41 fa ff ff       	jmp    80037c <vprintfmt+0x35>
+
+000000000080093b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80093b:	55                   	push   %rbp
+  80093c:	48 89 e5             	mov    %rsp,%rbp
+  80093f:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800943:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800947:	48 63 c6             	movslq %esi,%rax
+  80094a:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  80094f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800953:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  80095a:	48 85 ff             	test   %rdi,%rdi
+  80095d:	74 2a                	je     800989 <vsnprintf+0x4e>
+  80095f:	85 f6                	test   %esi,%esi
+  800961:	7e 26                	jle    800989 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800963:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800967:	48 bf a9 02 80 00 00 	movabs $0x8002a9,%rdi
+  80096e:	00 00 00 
+  800971:	48 b8 47 03 80 00 00 	movabs $0x800347,%rax
+  800978:	00 00 00 
+  80097b:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80097d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800981:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800984:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800987:	c9                   	leave
+  800988:	c3                   	ret
+		return -E_INVAL;
+  800989:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80098e:	eb f7                	jmp    800987 <vsnprintf+0x4c>
+
+0000000000800990 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800990:	55                   	push   %rbp
+  800991:	48 89 e5             	mov    %rsp,%rbp
+  800994:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80099b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8009a2:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8009a9:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8009b0:	84 c0                	test   %al,%al
+  8009b2:	74 20                	je     8009d4 <snprintf+0x44>
+  8009b4:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8009b8:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8009bc:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8009c0:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8009c4:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8009c8:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8009cc:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8009d0:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009d4:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8009db:	00 00 00 
+  8009de:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8009e5:	00 00 00 
+  8009e8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8009ec:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8009f3:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8009fa:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a01:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800a08:	48 b8 3b 09 80 00 00 	movabs $0x80093b,%rax
+  800a0f:	00 00 00 
+  800a12:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800a14:	c9                   	leave
+  800a15:	c3                   	ret
+
+0000000000800a16 <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a16:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a1b:	48 89 d0             	mov    %rdx,%rax
+  800a1e:	48 83 c2 01          	add    $0x1,%rdx
+  800a22:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800a27:	75 f2                	jne    800a1b <strlen+0x5>
+		n++;
+	return n;
+}
+  800a29:	c3                   	ret
+
+0000000000800a2a <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a2f:	eb 03                	jmp    800a34 <strnlen+0xa>
+  800a31:	48 89 d0             	mov    %rdx,%rax
+  800a34:	48 39 c6             	cmp    %rax,%rsi
+  800a37:	74 0a                	je     800a43 <strnlen+0x19>
+  800a39:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a3d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800a41:	75 ee                	jne    800a31 <strnlen+0x7>
+		n++;
+	return n;
+}
+  800a43:	c3                   	ret
+
+0000000000800a44 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a44:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a47:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a4c:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800a50:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800a53:	48 83 c2 01          	add    $0x1,%rdx
+  800a57:	84 c9                	test   %cl,%cl
+  800a59:	75 f1                	jne    800a4c <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800a5b:	c3                   	ret
+
+0000000000800a5c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a5c:	55                   	push   %rbp
+  800a5d:	48 89 e5             	mov    %rsp,%rbp
+  800a60:	41 54                	push   %r12
+  800a62:	53                   	push   %rbx
+  800a63:	48 89 fb             	mov    %rdi,%rbx
+  800a66:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800a69:	48 b8 16 0a 80 00 00 	movabs $0x800a16,%rax
+  800a70:	00 00 00 
+  800a73:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800a75:	48 63 f8             	movslq %eax,%rdi
+  800a78:	48 01 df             	add    %rbx,%rdi
+  800a7b:	4c 89 e6             	mov    %r12,%rsi
+  800a7e:	48 b8 44 0a 80 00 00 	movabs $0x800a44,%rax
+  800a85:	00 00 00 
+  800a88:	ff d0                	call   *%rax
+	return dst;
+}
+  800a8a:	48 89 d8             	mov    %rbx,%rax
+  800a8d:	5b                   	pop    %rbx
+  800a8e:	41 5c                	pop    %r12
+  800a90:	5d                   	pop    %rbp
+  800a91:	c3                   	ret
+
+0000000000800a92 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a92:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a95:	48 01 fa             	add    %rdi,%rdx
+  800a98:	48 89 f9             	mov    %rdi,%rcx
+  800a9b:	eb 14                	jmp    800ab1 <strncpy+0x1f>
+		*dst++ = *src;
+  800a9d:	48 83 c1 01          	add    $0x1,%rcx
+  800aa1:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800aa5:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800aa9:	41 80 f8 01          	cmp    $0x1,%r8b
+  800aad:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800ab1:	48 39 d1             	cmp    %rdx,%rcx
+  800ab4:	75 e7                	jne    800a9d <strncpy+0xb>
+	}
+	return ret;
+}
+  800ab6:	c3                   	ret
+
+0000000000800ab7 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800ab7:	48 89 f8             	mov    %rdi,%rax
+  800aba:	48 85 d2             	test   %rdx,%rdx
+  800abd:	74 27                	je     800ae6 <strlcpy+0x2f>
+  800abf:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800ac4:	48 89 fa             	mov    %rdi,%rdx
+  800ac7:	eb 0b                	jmp    800ad4 <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800ac9:	48 83 c6 01          	add    $0x1,%rsi
+  800acd:	48 83 c2 01          	add    $0x1,%rdx
+  800ad1:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800ad4:	48 39 c2             	cmp    %rax,%rdx
+  800ad7:	74 0a                	je     800ae3 <strlcpy+0x2c>
+  800ad9:	0f b6 0e             	movzbl (%rsi),%ecx
+  800adc:	84 c9                	test   %cl,%cl
+  800ade:	75 e9                	jne    800ac9 <strlcpy+0x12>
+  800ae0:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800ae3:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800ae6:	48 29 f8             	sub    %rdi,%rax
+}
+  800ae9:	c3                   	ret
+
+0000000000800aea <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800aea:	eb 08                	jmp    800af4 <strcmp+0xa>
+		p++, q++;
+  800aec:	48 83 c7 01          	add    $0x1,%rdi
+  800af0:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800af4:	0f b6 07             	movzbl (%rdi),%eax
+  800af7:	84 c0                	test   %al,%al
+  800af9:	74 04                	je     800aff <strcmp+0x15>
+  800afb:	3a 06                	cmp    (%rsi),%al
+  800afd:	74 ed                	je     800aec <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800aff:	0f b6 c0             	movzbl %al,%eax
+  800b02:	0f b6 16             	movzbl (%rsi),%edx
+  800b05:	29 d0                	sub    %edx,%eax
+}
+  800b07:	c3                   	ret
+
+0000000000800b08 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800b08:	eb 0c                	jmp    800b16 <strncmp+0xe>
+		n--, p++, q++;
+  800b0a:	48 83 ea 01          	sub    $0x1,%rdx
+  800b0e:	48 83 c7 01          	add    $0x1,%rdi
+  800b12:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800b16:	48 85 d2             	test   %rdx,%rdx
+  800b19:	74 14                	je     800b2f <strncmp+0x27>
+  800b1b:	0f b6 07             	movzbl (%rdi),%eax
+  800b1e:	84 c0                	test   %al,%al
+  800b20:	74 04                	je     800b26 <strncmp+0x1e>
+  800b22:	3a 06                	cmp    (%rsi),%al
+  800b24:	74 e4                	je     800b0a <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b26:	0f b6 07             	movzbl (%rdi),%eax
+  800b29:	0f b6 16             	movzbl (%rsi),%edx
+  800b2c:	29 d0                	sub    %edx,%eax
+}
+  800b2e:	c3                   	ret
+		return 0;
+  800b2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b34:	c3                   	ret
+
+0000000000800b35 <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800b35:	eb 04                	jmp    800b3b <strchr+0x6>
+  800b37:	48 83 c7 01          	add    $0x1,%rdi
+  800b3b:	0f b6 07             	movzbl (%rdi),%eax
+  800b3e:	84 c0                	test   %al,%al
+  800b40:	74 09                	je     800b4b <strchr+0x16>
+		if (*s == c)
+  800b42:	40 38 f0             	cmp    %sil,%al
+  800b45:	75 f0                	jne    800b37 <strchr+0x2>
+  800b47:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800b4a:	c3                   	ret
+	return 0;
+  800b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b50:	c3                   	ret
+
+0000000000800b51 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b51:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800b54:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800b57:	40 38 f2             	cmp    %sil,%dl
+  800b5a:	74 0a                	je     800b66 <strfind+0x15>
+  800b5c:	84 d2                	test   %dl,%dl
+  800b5e:	74 06                	je     800b66 <strfind+0x15>
+	for (; *s; s++)
+  800b60:	48 83 c0 01          	add    $0x1,%rax
+  800b64:	eb ee                	jmp    800b54 <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800b66:	c3                   	ret
+
+0000000000800b67 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800b67:	48 85 d2             	test   %rdx,%rdx
+  800b6a:	74 28                	je     800b94 <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800b6c:	48 89 f8             	mov    %rdi,%rax
+  800b6f:	48 09 d0             	or     %rdx,%rax
+  800b72:	a8 03                	test   $0x3,%al
+  800b74:	75 16                	jne    800b8c <memset+0x25>
+		c &= 0xFF;
+  800b76:	40 0f b6 f6          	movzbl %sil,%esi
+  800b7a:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b80:	48 89 d1             	mov    %rdx,%rcx
+  800b83:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800b87:	fc                   	cld
+  800b88:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800b8a:	eb 08                	jmp    800b94 <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b8c:	89 f0                	mov    %esi,%eax
+  800b8e:	48 89 d1             	mov    %rdx,%rcx
+  800b91:	fc                   	cld
+  800b92:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b94:	48 89 f8             	mov    %rdi,%rax
+  800b97:	c3                   	ret
+
+0000000000800b98 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b98:	48 89 f8             	mov    %rdi,%rax
+  800b9b:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b9e:	48 39 fe             	cmp    %rdi,%rsi
+  800ba1:	73 3a                	jae    800bdd <memmove+0x45>
+  800ba3:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ba7:	48 39 d7             	cmp    %rdx,%rdi
+  800baa:	73 31                	jae    800bdd <memmove+0x45>
+		s += n;
+		d += n;
+  800bac:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800bb0:	48 89 d6             	mov    %rdx,%rsi
+  800bb3:	48 09 fe             	or     %rdi,%rsi
+  800bb6:	48 09 ce             	or     %rcx,%rsi
+  800bb9:	40 f6 c6 03          	test   $0x3,%sil
+  800bbd:	75 11                	jne    800bd0 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bbf:	48 83 ef 04          	sub    $0x4,%rdi
+  800bc3:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800bc7:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800bcb:	fd                   	std
+  800bcc:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800bce:	eb 0b                	jmp    800bdb <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bd0:	48 83 ef 01          	sub    $0x1,%rdi
+  800bd4:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800bd8:	fd                   	std
+  800bd9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800bdb:	fc                   	cld
+  800bdc:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800bdd:	48 89 f2             	mov    %rsi,%rdx
+  800be0:	48 09 c2             	or     %rax,%rdx
+  800be3:	48 09 ca             	or     %rcx,%rdx
+  800be6:	f6 c2 03             	test   $0x3,%dl
+  800be9:	75 0b                	jne    800bf6 <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800beb:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800bef:	48 89 c7             	mov    %rax,%rdi
+  800bf2:	fc                   	cld
+  800bf3:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800bf5:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800bf6:	48 89 c7             	mov    %rax,%rdi
+  800bf9:	fc                   	cld
+  800bfa:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800bfc:	c3                   	ret
+
+0000000000800bfd <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bfd:	55                   	push   %rbp
+  800bfe:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800c01:	48 b8 98 0b 80 00 00 	movabs $0x800b98,%rax
+  800c08:	00 00 00 
+  800c0b:	ff d0                	call   *%rax
+}
+  800c0d:	5d                   	pop    %rbp
+  800c0e:	c3                   	ret
+
+0000000000800c0f <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c14:	48 39 c2             	cmp    %rax,%rdx
+  800c17:	74 1e                	je     800c37 <memcmp+0x28>
+		if (*s1 != *s2)
+  800c19:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800c1d:	48 83 c0 01          	add    $0x1,%rax
+  800c21:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800c27:	44 38 c1             	cmp    %r8b,%cl
+  800c2a:	74 e8                	je     800c14 <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800c2c:	0f b6 c1             	movzbl %cl,%eax
+  800c2f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800c33:	44 29 c0             	sub    %r8d,%eax
+  800c36:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800c37:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c3c:	c3                   	ret
+
+0000000000800c3d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c3d:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800c40:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800c43:	eb 04                	jmp    800c49 <memfind+0xc>
+  800c45:	48 83 c0 01          	add    $0x1,%rax
+  800c49:	48 39 d0             	cmp    %rdx,%rax
+  800c4c:	73 05                	jae    800c53 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c4e:	40 38 30             	cmp    %sil,(%rax)
+  800c51:	75 f2                	jne    800c45 <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800c53:	c3                   	ret
+
+0000000000800c54 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c54:	48 89 f9             	mov    %rdi,%rcx
+  800c57:	49 89 f0             	mov    %rsi,%r8
+  800c5a:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c5c:	eb 04                	jmp    800c62 <strtol+0xe>
+		s++;
+  800c5e:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800c62:	0f b6 01             	movzbl (%rcx),%eax
+  800c65:	3c 20                	cmp    $0x20,%al
+  800c67:	74 f5                	je     800c5e <strtol+0xa>
+  800c69:	3c 09                	cmp    $0x9,%al
+  800c6b:	74 f1                	je     800c5e <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c6d:	3c 2b                	cmp    $0x2b,%al
+  800c6f:	74 2b                	je     800c9c <strtol+0x48>
+	int neg = 0;
+  800c71:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800c77:	3c 2d                	cmp    $0x2d,%al
+  800c79:	74 2d                	je     800ca8 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c7b:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800c81:	75 0f                	jne    800c92 <strtol+0x3e>
+  800c83:	80 39 30             	cmpb   $0x30,(%rcx)
+  800c86:	74 2c                	je     800cb4 <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c88:	85 ff                	test   %edi,%edi
+  800c8a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c8f:	0f 44 f8             	cmove  %eax,%edi
+  800c92:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800c97:	4c 63 d7             	movslq %edi,%r10
+  800c9a:	eb 4f                	jmp    800ceb <strtol+0x97>
+		s++;
+  800c9c:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800ca0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800ca6:	eb d3                	jmp    800c7b <strtol+0x27>
+		s++, neg = 1;
+  800ca8:	48 83 c1 01          	add    $0x1,%rcx
+  800cac:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800cb2:	eb c7                	jmp    800c7b <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cb4:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800cb8:	74 0f                	je     800cc9 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800cba:	85 ff                	test   %edi,%edi
+  800cbc:	75 d4                	jne    800c92 <strtol+0x3e>
+		s++, base = 8;
+  800cbe:	48 83 c1 01          	add    $0x1,%rcx
+  800cc2:	bf 08 00 00 00       	mov    $0x8,%edi
+  800cc7:	eb c9                	jmp    800c92 <strtol+0x3e>
+		s += 2, base = 16;
+  800cc9:	48 83 c1 02          	add    $0x2,%rcx
+  800ccd:	bf 10 00 00 00       	mov    $0x10,%edi
+  800cd2:	eb be                	jmp    800c92 <strtol+0x3e>
+			dig = *s - '0';
+  800cd4:	0f be c0             	movsbl %al,%eax
+  800cd7:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800cda:	39 f8                	cmp    %edi,%eax
+  800cdc:	7d 3b                	jge    800d19 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800cde:	48 83 c1 01          	add    $0x1,%rcx
+  800ce2:	49 0f af d2          	imul   %r10,%rdx
+  800ce6:	48 98                	cltq
+  800ce8:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800ceb:	0f b6 01             	movzbl (%rcx),%eax
+  800cee:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800cf1:	40 80 fe 09          	cmp    $0x9,%sil
+  800cf5:	76 dd                	jbe    800cd4 <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800cf7:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800cfa:	40 80 fe 19          	cmp    $0x19,%sil
+  800cfe:	77 08                	ja     800d08 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800d00:	0f be c0             	movsbl %al,%eax
+  800d03:	83 e8 57             	sub    $0x57,%eax
+  800d06:	eb d2                	jmp    800cda <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d08:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800d0b:	40 80 fe 19          	cmp    $0x19,%sil
+  800d0f:	77 08                	ja     800d19 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800d11:	0f be c0             	movsbl %al,%eax
+  800d14:	83 e8 37             	sub    $0x37,%eax
+  800d17:	eb c1                	jmp    800cda <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d19:	4d 85 c0             	test   %r8,%r8
+  800d1c:	74 03                	je     800d21 <strtol+0xcd>
+		*endptr = (char *) s;
+  800d1e:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800d21:	48 89 d0             	mov    %rdx,%rax
+  800d24:	48 f7 d8             	neg    %rax
+  800d27:	45 85 c9             	test   %r9d,%r9d
+  800d2a:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800d2e:	48 89 d0             	mov    %rdx,%rax
+  800d31:	c3                   	ret
+
+0000000000800d32 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800d32:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800d38:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800d3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d43:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d48:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800d4a:	c3                   	ret
+
+0000000000800d4b <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800d4b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800d51:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800d57:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d5c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d61:	48 89 fe             	mov    %rdi,%rsi
+  800d64:	48 89 fa             	mov    %rdi,%rdx
+  800d67:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d69:	c3                   	ret
+
+0000000000800d6a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800d6a:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800d6d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800d73:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800d79:	be 00 00 00 00       	mov    $0x0,%esi
+  800d7e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d83:	48 89 f2             	mov    %rsi,%rdx
+  800d86:	0f 05                	syscall
+	if(check && ret > 0)
+  800d88:	48 85 c0             	test   %rax,%rax
+  800d8b:	7f 01                	jg     800d8e <sys_env_destroy+0x24>
+}
+  800d8d:	c3                   	ret
+{
+  800d8e:	55                   	push   %rbp
+  800d8f:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d92:	49 89 c0             	mov    %rax,%r8
+  800d95:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800d9a:	48 ba e8 16 80 00 00 	movabs $0x8016e8,%rdx
+  800da1:	00 00 00 
+  800da4:	be 28 00 00 00       	mov    $0x28,%esi
+  800da9:	48 bf 05 17 80 00 00 	movabs $0x801705,%rdi
+  800db0:	00 00 00 
+  800db3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db8:	49 b9 ed 11 80 00 00 	movabs $0x8011ed,%r9
+  800dbf:	00 00 00 
+  800dc2:	41 ff d1             	call   *%r9
+
+0000000000800dc5 <sys_getenvid>:
+  800dc5:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800dcc:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800dcd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800dd2:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800dd6:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800dda:	48 c1 e2 04          	shl    $0x4,%rdx
+  800dde:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800de5:	00 00 00 
+  800de8:	48 01 d0             	add    %rdx,%rax
+  800deb:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800df1:	c3                   	ret
+
+0000000000800df2 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800df2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800df8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800dfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e03:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e08:	48 89 fe             	mov    %rdi,%rsi
+  800e0b:	48 89 fa             	mov    %rdi,%rdx
+  800e0e:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e10:	c3                   	ret
+
+0000000000800e11 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  800e11:	48 63 d2             	movslq %edx,%rdx
+  800e14:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800e17:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800e1d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800e23:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e28:	0f 05                	syscall
+	if(check && ret > 0)
+  800e2a:	48 85 c0             	test   %rax,%rax
+  800e2d:	7f 01                	jg     800e30 <sys_page_alloc+0x1f>
+}
+  800e2f:	c3                   	ret
+{
+  800e30:	55                   	push   %rbp
+  800e31:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e34:	49 89 c0             	mov    %rax,%r8
+  800e37:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800e3c:	48 ba e8 16 80 00 00 	movabs $0x8016e8,%rdx
+  800e43:	00 00 00 
+  800e46:	be 28 00 00 00       	mov    $0x28,%esi
+  800e4b:	48 bf 05 17 80 00 00 	movabs $0x801705,%rdi
+  800e52:	00 00 00 
+  800e55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5a:	49 b9 ed 11 80 00 00 	movabs $0x8011ed,%r9
+  800e61:	00 00 00 
+  800e64:	41 ff d1             	call   *%r9
+
+0000000000800e67 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  800e67:	48 63 d2             	movslq %edx,%rdx
+  800e6a:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800e6d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800e73:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800e79:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e7e:	0f 05                	syscall
+	if(check && ret > 0)
+  800e80:	48 85 c0             	test   %rax,%rax
+  800e83:	7f 01                	jg     800e86 <sys_page_alloc_huge+0x1f>
+}
+  800e85:	c3                   	ret
+{
+  800e86:	55                   	push   %rbp
+  800e87:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8a:	49 89 c0             	mov    %rax,%r8
+  800e8d:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800e92:	48 ba e8 16 80 00 00 	movabs $0x8016e8,%rdx
+  800e99:	00 00 00 
+  800e9c:	be 28 00 00 00       	mov    $0x28,%esi
+  800ea1:	48 bf 05 17 80 00 00 	movabs $0x801705,%rdi
+  800ea8:	00 00 00 
+  800eab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb0:	49 b9 ed 11 80 00 00 	movabs $0x8011ed,%r9
+  800eb7:	00 00 00 
+  800eba:	41 ff d1             	call   *%r9
+
+0000000000800ebd <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ebd:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  800ec0:	48 63 d2             	movslq %edx,%rdx
+  800ec3:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800ec6:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  800ec9:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ece:	0f 05                	syscall
+	if(check && ret > 0)
+  800ed0:	48 85 c0             	test   %rax,%rax
+  800ed3:	7f 01                	jg     800ed6 <sys_page_map+0x19>
+}
+  800ed5:	c3                   	ret
+{
+  800ed6:	55                   	push   %rbp
+  800ed7:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eda:	49 89 c0             	mov    %rax,%r8
+  800edd:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800ee2:	48 ba e8 16 80 00 00 	movabs $0x8016e8,%rdx
+  800ee9:	00 00 00 
+  800eec:	be 28 00 00 00       	mov    $0x28,%esi
+  800ef1:	48 bf 05 17 80 00 00 	movabs $0x801705,%rdi
+  800ef8:	00 00 00 
+  800efb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f00:	49 b9 ed 11 80 00 00 	movabs $0x8011ed,%r9
+  800f07:	00 00 00 
+  800f0a:	41 ff d1             	call   *%r9
+
+0000000000800f0d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  800f0d:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800f10:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f16:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f21:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f26:	0f 05                	syscall
+	if(check && ret > 0)
+  800f28:	48 85 c0             	test   %rax,%rax
+  800f2b:	7f 01                	jg     800f2e <sys_page_unmap+0x21>
+}
+  800f2d:	c3                   	ret
+{
+  800f2e:	55                   	push   %rbp
+  800f2f:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f32:	49 89 c0             	mov    %rax,%r8
+  800f35:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800f3a:	48 ba e8 16 80 00 00 	movabs $0x8016e8,%rdx
+  800f41:	00 00 00 
+  800f44:	be 28 00 00 00       	mov    $0x28,%esi
+  800f49:	48 bf 05 17 80 00 00 	movabs $0x801705,%rdi
+  800f50:	00 00 00 
+  800f53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f58:	49 b9 ed 11 80 00 00 	movabs $0x8011ed,%r9
+  800f5f:	00 00 00 
+  800f62:	41 ff d1             	call   *%r9
+
+0000000000800f65 <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  800f65:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f6b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f71:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f76:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f7b:	48 89 fe             	mov    %rdi,%rsi
+  800f7e:	48 89 fa             	mov    %rdi,%rdx
+  800f81:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f83:	c3                   	ret
+
+0000000000800f84 <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  800f84:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f8a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f90:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f95:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f9a:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  800f9c:	c3                   	ret
+
+0000000000800f9d <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  800f9d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fa3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fa9:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fae:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  800fb0:	c3                   	ret
+
+0000000000800fb1 <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  800fb1:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  800fb4:	48 63 f6             	movslq %esi,%rsi
+  800fb7:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800fba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fc0:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fc5:	0f 05                	syscall
+	if(check && ret > 0)
+  800fc7:	48 85 c0             	test   %rax,%rax
+  800fca:	7f 01                	jg     800fcd <sys_page_batch+0x1c>
+}
+  800fcc:	c3                   	ret
+{
+  800fcd:	55                   	push   %rbp
+  800fce:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd1:	49 89 c0             	mov    %rax,%r8
+  800fd4:	b9 12 00 00 00       	mov    $0x12,%ecx
+  800fd9:	48 ba e8 16 80 00 00 	movabs $0x8016e8,%rdx
+  800fe0:	00 00 00 
+  800fe3:	be 28 00 00 00       	mov    $0x28,%esi
+  800fe8:	48 bf 05 17 80 00 00 	movabs $0x801705,%rdi
+  800fef:	00 00 00 
+  800ff2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff7:	49 b9 ed 11 80 00 00 	movabs $0x8011ed,%r9
+  800ffe:	00 00 00 
+  801001:	41 ff d1             	call   *%r9
+
+0000000000801004 <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  801004:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80100a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801010:	be 00 00 00 00       	mov    $0x0,%esi
+  801015:	b8 13 00 00 00       	mov    $0x13,%eax
+  80101a:	48 89 f2             	mov    %rsi,%rdx
+  80101d:	0f 05                	syscall
+	if(check && ret > 0)
+  80101f:	48 85 c0             	test   %rax,%rax
+  801022:	7f 01                	jg     801025 <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  801024:	c3                   	ret
+{
+  801025:	55                   	push   %rbp
+  801026:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801029:	49 89 c0             	mov    %rax,%r8
+  80102c:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801031:	48 ba e8 16 80 00 00 	movabs $0x8016e8,%rdx
+  801038:	00 00 00 
+  80103b:	be 28 00 00 00       	mov    $0x28,%esi
+  801040:	48 bf 05 17 80 00 00 	movabs $0x801705,%rdi
+  801047:	00 00 00 
+  80104a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80104f:	49 b9 ed 11 80 00 00 	movabs $0x8011ed,%r9
+  801056:	00 00 00 
+  801059:	41 ff d1             	call   *%r9
+
+000000000080105c <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  80105c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801062:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801068:	bf 00 00 00 00       	mov    $0x0,%edi
+  80106d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801072:	48 89 fe             	mov    %rdi,%rsi
+  801075:	48 89 fa             	mov    %rdi,%rdx
+  801078:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80107a:	c3                   	ret
+
+000000000080107b <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  80107b:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80107e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801084:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80108a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80108f:	0f 05                	syscall
+	if(check && ret > 0)
+  801091:	48 85 c0             	test   %rax,%rax
+  801094:	7f 01                	jg     801097 <sys_page_unmap_range+0x1c>
+}
+  801096:	c3                   	ret
+{
+  801097:	55                   	push   %rbp
+  801098:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80109b:	49 89 c0             	mov    %rax,%r8
+  80109e:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8010a3:	48 ba e8 16 80 00 00 	movabs $0x8016e8,%rdx
+  8010aa:	00 00 00 
+  8010ad:	be 28 00 00 00       	mov    $0x28,%esi
+  8010b2:	48 bf 05 17 80 00 00 	movabs $0x801705,%rdi
+  8010b9:	00 00 00 
+  8010bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c1:	49 b9 ed 11 80 00 00 	movabs $0x8011ed,%r9
+  8010c8:	00 00 00 
+  8010cb:	41 ff d1             	call   *%r9
+
+00000000008010ce <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8010ce:	48 63 f6             	movslq %esi,%rsi
+  8010d1:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8010d4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010e5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010ea:	0f 05                	syscall
+	if(check && ret > 0)
+  8010ec:	48 85 c0             	test   %rax,%rax
+  8010ef:	7f 01                	jg     8010f2 <sys_env_set_status+0x24>
+}
+  8010f1:	c3                   	ret
+{
+  8010f2:	55                   	push   %rbp
+  8010f3:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010f6:	49 89 c0             	mov    %rax,%r8
+  8010f9:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8010fe:	48 ba e8 16 80 00 00 	movabs $0x8016e8,%rdx
+  801105:	00 00 00 
+  801108:	be 28 00 00 00       	mov    $0x28,%esi
+  80110d:	48 bf 05 17 80 00 00 	movabs $0x801705,%rdi
+  801114:	00 00 00 
+  801117:	b8 00 00 00 00       	mov    $0x0,%eax
+  80111c:	49 b9 ed 11 80 00 00 	movabs $0x8011ed,%r9
+  801123:	00 00 00 
+  801126:	41 ff d1             	call   *%r9
+
+0000000000801129 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  801129:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80112c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801132:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801138:	ba 00 00 00 00       	mov    $0x0,%edx
+  80113d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801142:	0f 05                	syscall
+	if(check && ret > 0)
+  801144:	48 85 c0             	test   %rax,%rax
+  801147:	7f 01                	jg     80114a <sys_env_set_pgfault_upcall+0x21>
+}
+  801149:	c3                   	ret
+{
+  80114a:	55                   	push   %rbp
+  80114b:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80114e:	49 89 c0             	mov    %rax,%r8
+  801151:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801156:	48 ba e8 16 80 00 00 	movabs $0x8016e8,%rdx
+  80115d:	00 00 00 
+  801160:	be 28 00 00 00       	mov    $0x28,%esi
+  801165:	48 bf 05 17 80 00 00 	movabs $0x801705,%rdi
+  80116c:	00 00 00 
+  80116f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801174:	49 b9 ed 11 80 00 00 	movabs $0x8011ed,%r9
+  80117b:	00 00 00 
+  80117e:	41 ff d1             	call   *%r9
+
+0000000000801181 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  801181:	48 63 ff             	movslq %edi,%rdi
+  801184:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  801187:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80118d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801192:	0f 05                	syscall
+}
+  801194:	c3                   	ret
+
+0000000000801195 <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  801195:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80119b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011ab:	48 89 f2             	mov    %rsi,%rdx
+  8011ae:	0f 05                	syscall
+	if(check && ret > 0)
+  8011b0:	48 85 c0             	test   %rax,%rax
+  8011b3:	7f 01                	jg     8011b6 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  8011b5:	c3                   	ret
+{
+  8011b6:	55                   	push   %rbp
+  8011b7:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011ba:	49 89 c0             	mov    %rax,%r8
+  8011bd:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8011c2:	48 ba e8 16 80 00 00 	movabs $0x8016e8,%rdx
+  8011c9:	00 00 00 
+  8011cc:	be 28 00 00 00       	mov    $0x28,%esi
+  8011d1:	48 bf 05 17 80 00 00 	movabs $0x801705,%rdi
+  8011d8:	00 00 00 
+  8011db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e0:	49 b9 ed 11 80 00 00 	movabs $0x8011ed,%r9
+  8011e7:	00 00 00 
+  8011ea:	41 ff d1             	call   *%r9
+
+00000000008011ed <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8011ed:	55                   	push   %rbp
+  8011ee:	48 89 e5             	mov    %rsp,%rbp
+  8011f1:	41 56                	push   %r14
+  8011f3:	41 55                	push   %r13
+  8011f5:	41 54                	push   %r12
+  8011f7:	53                   	push   %rbx
+  8011f8:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8011ff:	49 89 fc             	mov    %rdi,%r12
+  801202:	41 89 f5             	mov    %esi,%r13d
+  801205:	48 89 d3             	mov    %rdx,%rbx
+  801208:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80120f:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  801216:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  80121d:	84 c0                	test   %al,%al
+  80121f:	74 26                	je     801247 <_panic+0x5a>
+  801221:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  801228:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80122f:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  801233:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  801237:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  80123b:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80123f:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  801243:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801247:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  80124e:	00 00 00 
+  801251:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  801258:	00 00 00 
+  80125b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80125f:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  801266:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  80126d:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801274:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  80127b:	00 00 00 
+  80127e:	4c 8b 30             	mov    (%rax),%r14
+  801281:	48 b8 c5 0d 80 00 00 	movabs $0x800dc5,%rax
+  801288:	00 00 00 
+  80128b:	ff d0                	call   *%rax
+  80128d:	89 c6                	mov    %eax,%esi
+  80128f:	45 89 e8             	mov    %r13d,%r8d
+  801292:	4c 89 e1             	mov    %r12,%rcx
+  801295:	4c 89 f2             	mov    %r14,%rdx
+  801298:	48 bf 18 17 80 00 00 	movabs $0x801718,%rdi
+  80129f:	00 00 00 
+  8012a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a7:	49 bc 8d 01 80 00 00 	movabs $0x80018d,%r12
+  8012ae:	00 00 00 
+  8012b1:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8012b4:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  8012bb:	48 89 df             	mov    %rbx,%rdi
+  8012be:	48 b8 29 01 80 00 00 	movabs $0x800129,%rax
+  8012c5:	00 00 00 
+  8012c8:	ff d0                	call   *%rax
+	cprintf("\n");
+  8012ca:	48 bf ec 12 80 00 00 	movabs $0x8012ec,%rdi
+  8012d1:	00 00 00 
+  8012d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d9:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8012dc:	cc                   	int3
+	while (1)
+  8012dd:	eb fd                	jmp    8012dc <_panic+0xef>
@@ -0,0 +1,3429 @@
+
+obj/user/hugepage:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 bd 04 00 00       	call   8004ee <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+
+#define HUGE	((char *) 0x10000000)	// 2MB-aligned
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	41 54                	push   %r12
+  800039:	53                   	push   %rbx
+	envid_t who;
+	int i, r;
+
+	if ((r = sys_page_alloc_huge(0, HUGE, PTE_P|PTE_U|PTE_W)) < 0)
+  80003a:	ba 07 00 00 00       	mov    $0x7,%edx
+  80003f:	be 00 00 00 10       	mov    $0x10000000,%esi
+  800044:	bf 00 00 00 00       	mov    $0x0,%edi
+  800049:	48 b8 ad 13 80 00 00 	movabs $0x8013ad,%rax
+  800050:	00 00 00 
+  800053:	ff d0                	call   *%rax
+  800055:	85 c0                	test   %eax,%eax
+  800057:	78 37                	js     800090 <umain+0x5d>
+		panic("sys_page_alloc_huge: %e", r);
+	if (!(uvpd[PGNUM(HUGE) / NPTENTRIES] & PTE_PS))
+  800059:	48 a1 00 04 00 80 00 	movabs 0x10080000400,%rax
+  800060:	01 00 00 
+  800063:	a8 80                	test   $0x80,%al
+  800065:	74 56                	je     8000bd <umain+0x8a>
+  800067:	b8 00 00 00 10       	mov    $0x10000000,%eax
+  80006c:	8d 88 00 00 00 f0    	lea    -0x10000000(%rax),%ecx
+		panic("%p is not mapped with a 2MB page", HUGE);
+
+	// the whole 2MB starts out zeroed and writable
+	for (i = 0; i < PTSIZE; i += PGSIZE) {
+  800072:	48 3d 00 00 20 10    	cmp    $0x10200000,%rax
+  800078:	0f 84 a4 00 00 00    	je     800122 <umain+0xef>
+		assert(*(int *) (HUGE + i) == 0);
+  80007e:	48 89 c2             	mov    %rax,%rdx
+  800081:	48 05 00 10 00 00    	add    $0x1000,%rax
+  800087:	83 3a 00             	cmpl   $0x0,(%rdx)
+  80008a:	75 61                	jne    8000ed <umain+0xba>
+		*(int *) (HUGE + i) = i;
+  80008c:	89 0a                	mov    %ecx,(%rdx)
+	for (i = 0; i < PTSIZE; i += PGSIZE) {
+  80008e:	eb dc                	jmp    80006c <umain+0x39>
+		panic("sys_page_alloc_huge: %e", r);
+  800090:	89 c1                	mov    %eax,%ecx
+  800092:	48 ba 40 20 80 00 00 	movabs $0x802040,%rdx
+  800099:	00 00 00 
+  80009c:	be 0f 00 00 00       	mov    $0xf,%esi
+  8000a1:	48 bf 58 20 80 00 00 	movabs $0x802058,%rdi
+  8000a8:	00 00 00 
+  8000ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b0:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  8000b7:	00 00 00 
+  8000ba:	41 ff d0             	call   *%r8
+		panic("%p is not mapped with a 2MB page", HUGE);
+  8000bd:	b9 00 00 00 10       	mov    $0x10000000,%ecx
+  8000c2:	48 ba 58 21 80 00 00 	movabs $0x802158,%rdx
+  8000c9:	00 00 00 
+  8000cc:	be 11 00 00 00       	mov    $0x11,%esi
+  8000d1:	48 bf 58 20 80 00 00 	movabs $0x802058,%rdi
+  8000d8:	00 00 00 
+  8000db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e0:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  8000e7:	00 00 00 
+  8000ea:	41 ff d0             	call   *%r8
+		assert(*(int *) (HUGE + i) == 0);
+  8000ed:	48 b9 68 20 80 00 00 	movabs $0x802068,%rcx
+  8000f4:	00 00 00 
+  8000f7:	48 ba 81 20 80 00 00 	movabs $0x802081,%rdx
+  8000fe:	00 00 00 
+  800101:	be 15 00 00 00       	mov    $0x15,%esi
+  800106:	48 bf 58 20 80 00 00 	movabs $0x802058,%rdi
+  80010d:	00 00 00 
+  800110:	b8 00 00 00 00       	mov    $0x0,%eax
+  800115:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  80011c:	00 00 00 
+  80011f:	41 ff d0             	call   *%r8
+	}
+
+	// unmapping one 4KB page leaves the rest alone
+	if ((r = sys_page_unmap(0, HUGE + 7 * PGSIZE)) < 0)
+  800122:	be 00 70 00 10       	mov    $0x10007000,%esi
+  800127:	bf 00 00 00 00       	mov    $0x0,%edi
+  80012c:	48 b8 53 14 80 00 00 	movabs $0x801453,%rax
+  800133:	00 00 00 
+  800136:	ff d0                	call   *%rax
+  800138:	85 c0                	test   %eax,%eax
+  80013a:	78 56                	js     800192 <umain+0x15f>
+		panic("sys_page_unmap: %e", r);
+	assert(!(uvpd[PGNUM(HUGE) / NPTENTRIES] & PTE_PS));
+  80013c:	48 a1 00 04 00 80 00 	movabs 0x10080000400,%rax
+  800143:	01 00 00 
+  800146:	a8 80                	test   $0x80,%al
+  800148:	75 75                	jne    8001bf <umain+0x18c>
+	assert(!(uvpt[PGNUM(HUGE + 7 * PGSIZE)] & PTE_P));
+  80014a:	48 a1 38 00 08 00 00 	movabs 0x10000080038,%rax
+  800151:	01 00 00 
+  800154:	83 e0 01             	and    $0x1,%eax
+  800157:	0f 84 a5 00 00 00    	je     800202 <umain+0x1cf>
+  80015d:	48 b9 b0 21 80 00 00 	movabs $0x8021b0,%rcx
+  800164:	00 00 00 
+  800167:	48 ba 81 20 80 00 00 	movabs $0x802081,%rdx
+  80016e:	00 00 00 
+  800171:	be 1d 00 00 00       	mov    $0x1d,%esi
+  800176:	48 bf 58 20 80 00 00 	movabs $0x802058,%rdi
+  80017d:	00 00 00 
+  800180:	b8 00 00 00 00       	mov    $0x0,%eax
+  800185:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  80018c:	00 00 00 
+  80018f:	41 ff d0             	call   *%r8
+		panic("sys_page_unmap: %e", r);
+  800192:	89 c1                	mov    %eax,%ecx
+  800194:	48 ba 96 20 80 00 00 	movabs $0x802096,%rdx
+  80019b:	00 00 00 
+  80019e:	be 1b 00 00 00       	mov    $0x1b,%esi
+  8001a3:	48 bf 58 20 80 00 00 	movabs $0x802058,%rdi
+  8001aa:	00 00 00 
+  8001ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b2:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  8001b9:	00 00 00 
+  8001bc:	41 ff d0             	call   *%r8
+	assert(!(uvpd[PGNUM(HUGE) / NPTENTRIES] & PTE_PS));
+  8001bf:	48 b9 80 21 80 00 00 	movabs $0x802180,%rcx
+  8001c6:	00 00 00 
+  8001c9:	48 ba 81 20 80 00 00 	movabs $0x802081,%rdx
+  8001d0:	00 00 00 
+  8001d3:	be 1c 00 00 00       	mov    $0x1c,%esi
+  8001d8:	48 bf 58 20 80 00 00 	movabs $0x802058,%rdi
+  8001df:	00 00 00 
+  8001e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e7:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  8001ee:	00 00 00 
+  8001f1:	41 ff d0             	call   *%r8
+	for (i = 0; i < PTSIZE; i += PGSIZE)
+  8001f4:	48 05 00 10 00 00    	add    $0x1000,%rax
+  8001fa:	48 3d 00 00 20 00    	cmp    $0x200000,%rax
+  800200:	74 44                	je     800246 <umain+0x213>
+		if (i != 7 * PGSIZE)
+  800202:	3d 00 70 00 00       	cmp    $0x7000,%eax
+  800207:	74 eb                	je     8001f4 <umain+0x1c1>
+			assert(*(int *) (HUGE + i) == i);
+  800209:	39 80 00 00 00 10    	cmp    %eax,0x10000000(%rax)
+  80020f:	74 e3                	je     8001f4 <umain+0x1c1>
+  800211:	48 b9 a9 20 80 00 00 	movabs $0x8020a9,%rcx
+  800218:	00 00 00 
+  80021b:	48 ba 81 20 80 00 00 	movabs $0x802081,%rdx
+  800222:	00 00 00 
+  800225:	be 20 00 00 00       	mov    $0x20,%esi
+  80022a:	48 bf 58 20 80 00 00 	movabs $0x802058,%rdi
+  800231:	00 00 00 
+  800234:	b8 00 00 00 00       	mov    $0x0,%eax
+  800239:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  800240:	00 00 00 
+  800243:	41 ff d0             	call   *%r8
+	cprintf("hugepage: partial unmap ok\n");
+  800246:	48 bf c2 20 80 00 00 	movabs $0x8020c2,%rdi
+  80024d:	00 00 00 
+  800250:	b8 00 00 00 00       	mov    $0x0,%eax
+  800255:	48 ba d3 06 80 00 00 	movabs $0x8006d3,%rdx
+  80025c:	00 00 00 
+  80025f:	ff d2                	call   *%rdx
+
+	// a second huge page, shared copy-on-write with a child
+	if ((r = sys_page_alloc_huge(0, HUGE + PTSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  800261:	ba 07 00 00 00       	mov    $0x7,%edx
+  800266:	be 00 00 20 10       	mov    $0x10200000,%esi
+  80026b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800270:	48 b8 ad 13 80 00 00 	movabs $0x8013ad,%rax
+  800277:	00 00 00 
+  80027a:	ff d0                	call   *%rax
+  80027c:	85 c0                	test   %eax,%eax
+  80027e:	78 4e                	js     8002ce <umain+0x29b>
+		panic("sys_page_alloc_huge: %e", r);
+	*(int *) (HUGE + PTSIZE) = 1;
+  800280:	c7 04 25 00 00 20 10 	movl   $0x1,0x10200000
+  800287:	01 00 00 00 
+
+	if ((who = fork()) < 0)
+  80028b:	48 b8 dd 19 80 00 00 	movabs $0x8019dd,%rax
+  800292:	00 00 00 
+  800295:	ff d0                	call   *%rax
+  800297:	85 c0                	test   %eax,%eax
+  800299:	78 60                	js     8002fb <umain+0x2c8>
+		panic("fork: %e", who);
+	if (who == 0) {
+  80029b:	0f 84 87 00 00 00    	je     800328 <umain+0x2f5>
+		*(int *) (HUGE + PTSIZE) = 2;
+		assert(*(int *) (HUGE + PTSIZE + PGSIZE) == 0);
+		cprintf("hugepage: child wrote its copy\n");
+		return;
+	}
+	while (envs[ENVX(who)].env_status != ENV_FREE)
+  8002a1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002a6:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8002aa:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8002ae:	48 c1 e0 04          	shl    $0x4,%rax
+  8002b2:	48 bb 00 00 80 bc 00 	movabs $0xbc800000,%rbx
+  8002b9:	00 00 00 
+  8002bc:	48 01 c3             	add    %rax,%rbx
+		sys_yield();
+  8002bf:	49 bc 38 13 80 00 00 	movabs $0x801338,%r12
+  8002c6:	00 00 00 
+  8002c9:	e9 c7 00 00 00       	jmp    800395 <umain+0x362>
+		panic("sys_page_alloc_huge: %e", r);
+  8002ce:	89 c1                	mov    %eax,%ecx
+  8002d0:	48 ba 40 20 80 00 00 	movabs $0x802040,%rdx
+  8002d7:	00 00 00 
+  8002da:	be 25 00 00 00       	mov    $0x25,%esi
+  8002df:	48 bf 58 20 80 00 00 	movabs $0x802058,%rdi
+  8002e6:	00 00 00 
+  8002e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ee:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  8002f5:	00 00 00 
+  8002f8:	41 ff d0             	call   *%r8
+		panic("fork: %e", who);
+  8002fb:	89 c1                	mov    %eax,%ecx
+  8002fd:	48 ba de 20 80 00 00 	movabs $0x8020de,%rdx
+  800304:	00 00 00 
+  800307:	be 29 00 00 00       	mov    $0x29,%esi
+  80030c:	48 bf 58 20 80 00 00 	movabs $0x802058,%rdi
+  800313:	00 00 00 
+  800316:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031b:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  800322:	00 00 00 
+  800325:	41 ff d0             	call   *%r8
+		*(int *) (HUGE + PTSIZE) = 2;
+  800328:	c7 04 25 00 00 20 10 	movl   $0x2,0x10200000
+  80032f:	02 00 00 00 
+		assert(*(int *) (HUGE + PTSIZE + PGSIZE) == 0);
+  800333:	83 3c 25 00 10 20 10 	cmpl   $0x0,0x10201000
+  80033a:	00 
+  80033b:	75 20                	jne    80035d <umain+0x32a>
+		cprintf("hugepage: child wrote its copy\n");
+  80033d:	48 bf 08 22 80 00 00 	movabs $0x802208,%rdi
+  800344:	00 00 00 
+  800347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034c:	48 ba d3 06 80 00 00 	movabs $0x8006d3,%rdx
+  800353:	00 00 00 
+  800356:	ff d2                	call   *%rdx
+	if ((r = sys_page_unmap_range(0, HUGE, 2 * PTSIZE)) < 0)
+		panic("sys_page_unmap_range: %e", r);
+	assert(!(uvpd[PGNUM(HUGE) / NPTENTRIES] & PTE_P));
+	assert(!(uvpd[PGNUM(HUGE + PTSIZE) / NPTENTRIES] & PTE_P));
+	cprintf("hugepage: range unmap ok\n");
+}
+  800358:	5b                   	pop    %rbx
+  800359:	41 5c                	pop    %r12
+  80035b:	5d                   	pop    %rbp
+  80035c:	c3                   	ret
+		assert(*(int *) (HUGE + PTSIZE + PGSIZE) == 0);
+  80035d:	48 b9 e0 21 80 00 00 	movabs $0x8021e0,%rcx
+  800364:	00 00 00 
+  800367:	48 ba 81 20 80 00 00 	movabs $0x802081,%rdx
+  80036e:	00 00 00 
+  800371:	be 2c 00 00 00       	mov    $0x2c,%esi
+  800376:	48 bf 58 20 80 00 00 	movabs $0x802058,%rdi
+  80037d:	00 00 00 
+  800380:	b8 00 00 00 00       	mov    $0x0,%eax
+  800385:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  80038c:	00 00 00 
+  80038f:	41 ff d0             	call   *%r8
+		sys_yield();
+  800392:	41 ff d4             	call   *%r12
+	while (envs[ENVX(who)].env_status != ENV_FREE)
+  800395:	8b 83 c4 00 00 00    	mov    0xc4(%rbx),%eax
+  80039b:	85 c0                	test   %eax,%eax
+  80039d:	75 f3                	jne    800392 <umain+0x35f>
+	assert(*(int *) (HUGE + PTSIZE) == 1);
+  80039f:	83 3c 25 00 00 20 10 	cmpl   $0x1,0x10200000
+  8003a6:	01 
+  8003a7:	75 7e                	jne    800427 <umain+0x3f4>
+	cprintf("hugepage: copy-on-write ok\n");
+  8003a9:	48 bf 05 21 80 00 00 	movabs $0x802105,%rdi
+  8003b0:	00 00 00 
+  8003b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b8:	48 ba d3 06 80 00 00 	movabs $0x8006d3,%rdx
+  8003bf:	00 00 00 
+  8003c2:	ff d2                	call   *%rdx
+	if ((r = sys_page_unmap_range(0, HUGE, 2 * PTSIZE)) < 0)
+  8003c4:	ba 00 00 40 00       	mov    $0x400000,%edx
+  8003c9:	be 00 00 00 10       	mov    $0x10000000,%esi
+  8003ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003d3:	48 b8 c1 15 80 00 00 	movabs $0x8015c1,%rax
+  8003da:	00 00 00 
+  8003dd:	ff d0                	call   *%rax
+  8003df:	85 c0                	test   %eax,%eax
+  8003e1:	78 74                	js     800457 <umain+0x424>
+	assert(!(uvpd[PGNUM(HUGE) / NPTENTRIES] & PTE_P));
+  8003e3:	48 a1 00 04 00 80 00 	movabs 0x10080000400,%rax
+  8003ea:	01 00 00 
+  8003ed:	a8 01                	test   $0x1,%al
+  8003ef:	0f 85 8f 00 00 00    	jne    800484 <umain+0x451>
+	assert(!(uvpd[PGNUM(HUGE + PTSIZE) / NPTENTRIES] & PTE_P));
+  8003f5:	48 a1 08 04 00 80 00 	movabs 0x10080000408,%rax
+  8003fc:	01 00 00 
+  8003ff:	a8 01                	test   $0x1,%al
+  800401:	0f 85 b2 00 00 00    	jne    8004b9 <umain+0x486>
+	cprintf("hugepage: range unmap ok\n");
+  800407:	48 bf 3a 21 80 00 00 	movabs $0x80213a,%rdi
+  80040e:	00 00 00 
+  800411:	b8 00 00 00 00       	mov    $0x0,%eax
+  800416:	48 ba d3 06 80 00 00 	movabs $0x8006d3,%rdx
+  80041d:	00 00 00 
+  800420:	ff d2                	call   *%rdx
+  800422:	e9 31 ff ff ff       	jmp    800358 <umain+0x325>
+	assert(*(int *) (HUGE + PTSIZE) == 1);
+  800427:	48 b9 e7 20 80 00 00 	movabs $0x8020e7,%rcx
+  80042e:	00 00 00 
+  800431:	48 ba 81 20 80 00 00 	movabs $0x802081,%rdx
+  800438:	00 00 00 
+  80043b:	be 32 00 00 00       	mov    $0x32,%esi
+  800440:	48 bf 58 20 80 00 00 	movabs $0x802058,%rdi
+  800447:	00 00 00 
+  80044a:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  800451:	00 00 00 
+  800454:	41 ff d0             	call   *%r8
+		panic("sys_page_unmap_range: %e", r);
+  800457:	89 c1                	mov    %eax,%ecx
+  800459:	48 ba 21 21 80 00 00 	movabs $0x802121,%rdx
+  800460:	00 00 00 
+  800463:	be 37 00 00 00       	mov    $0x37,%esi
+  800468:	48 bf 58 20 80 00 00 	movabs $0x802058,%rdi
+  80046f:	00 00 00 
+  800472:	b8 00 00 00 00       	mov    $0x0,%eax
+  800477:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  80047e:	00 00 00 
+  800481:	41 ff d0             	call   *%r8
+	assert(!(uvpd[PGNUM(HUGE) / NPTENTRIES] & PTE_P));
+  800484:	48 b9 28 22 80 00 00 	movabs $0x802228,%rcx
+  80048b:	00 00 00 
+  80048e:	48 ba 81 20 80 00 00 	movabs $0x802081,%rdx
+  800495:	00 00 00 
+  800498:	be 38 00 00 00       	mov    $0x38,%esi
+  80049d:	48 bf 58 20 80 00 00 	movabs $0x802058,%rdi
+  8004a4:	00 00 00 
+  8004a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ac:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  8004b3:	00 00 00 
+  8004b6:	41 ff d0             	call   *%r8
+	assert(!(uvpd[PGNUM(HUGE + PTSIZE) / NPTENTRIES] & PTE_P));
+  8004b9:	48 b9 58 22 80 00 00 	movabs $0x802258,%rcx
+  8004c0:	00 00 00 
+  8004c3:	48 ba 81 20 80 00 00 	movabs $0x802081,%rdx
+  8004ca:	00 00 00 
+  8004cd:	be 39 00 00 00       	mov    $0x39,%esi
+  8004d2:	48 bf 58 20 80 00 00 	movabs $0x802058,%rdi
+  8004d9:	00 00 00 
+  8004dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e1:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  8004e8:	00 00 00 
+  8004eb:	41 ff d0             	call   *%r8
+
+00000000008004ee <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  8004ee:	55                   	push   %rbp
+  8004ef:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8004f2:	85 ff                	test   %edi,%edi
+  8004f4:	7e 0d                	jle    800503 <libmain+0x15>
+		binaryname = argv[0];
+  8004f6:	48 8b 06             	mov    (%rsi),%rax
+  8004f9:	48 a3 00 30 80 00 00 	movabs %rax,0x803000
+  800500:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  800503:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  80050a:	00 00 00 
+  80050d:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  80050f:	48 b8 1d 05 80 00 00 	movabs $0x80051d,%rax
+  800516:	00 00 00 
+  800519:	ff d0                	call   *%rax
+}
+  80051b:	5d                   	pop    %rbp
+  80051c:	c3                   	ret
+
+000000000080051d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80051d:	55                   	push   %rbp
+  80051e:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  800521:	bf 00 00 00 00       	mov    $0x0,%edi
+  800526:	48 b8 b0 12 80 00 00 	movabs $0x8012b0,%rax
+  80052d:	00 00 00 
+  800530:	ff d0                	call   *%rax
+}
+  800532:	5d                   	pop    %rbp
+  800533:	c3                   	ret
+
+0000000000800534 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800534:	55                   	push   %rbp
+  800535:	48 89 e5             	mov    %rsp,%rbp
+  800538:	41 56                	push   %r14
+  80053a:	41 55                	push   %r13
+  80053c:	41 54                	push   %r12
+  80053e:	53                   	push   %rbx
+  80053f:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800546:	49 89 fc             	mov    %rdi,%r12
+  800549:	41 89 f5             	mov    %esi,%r13d
+  80054c:	48 89 d3             	mov    %rdx,%rbx
+  80054f:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800556:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80055d:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800564:	84 c0                	test   %al,%al
+  800566:	74 26                	je     80058e <_panic+0x5a>
+  800568:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  80056f:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800576:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  80057a:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  80057e:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800582:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800586:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  80058a:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80058e:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800595:	00 00 00 
+  800598:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  80059f:	00 00 00 
+  8005a2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005a6:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8005ad:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8005b4:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005bb:	48 b8 00 30 80 00 00 	movabs $0x803000,%rax
+  8005c2:	00 00 00 
+  8005c5:	4c 8b 30             	mov    (%rax),%r14
+  8005c8:	48 b8 0b 13 80 00 00 	movabs $0x80130b,%rax
+  8005cf:	00 00 00 
+  8005d2:	ff d0                	call   *%rax
+  8005d4:	89 c6                	mov    %eax,%esi
+  8005d6:	45 89 e8             	mov    %r13d,%r8d
+  8005d9:	4c 89 e1             	mov    %r12,%rcx
+  8005dc:	4c 89 f2             	mov    %r14,%rdx
+  8005df:	48 bf 98 22 80 00 00 	movabs $0x802298,%rdi
+  8005e6:	00 00 00 
+  8005e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ee:	49 bc d3 06 80 00 00 	movabs $0x8006d3,%r12
+  8005f5:	00 00 00 
+  8005f8:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8005fb:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  800602:	48 89 df             	mov    %rbx,%rdi
+  800605:	48 b8 6f 06 80 00 00 	movabs $0x80066f,%rax
+  80060c:	00 00 00 
+  80060f:	ff d0                	call   *%rax
+	cprintf("\n");
+  800611:	48 bf 1f 21 80 00 00 	movabs $0x80211f,%rdi
+  800618:	00 00 00 
+  80061b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800620:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800623:	cc                   	int3
+	while (1)
+  800624:	eb fd                	jmp    800623 <_panic+0xef>
+
+0000000000800626 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800626:	55                   	push   %rbp
+  800627:	48 89 e5             	mov    %rsp,%rbp
+  80062a:	53                   	push   %rbx
+  80062b:	48 83 ec 08          	sub    $0x8,%rsp
+  80062f:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  800632:	8b 06                	mov    (%rsi),%eax
+  800634:	8d 50 01             	lea    0x1(%rax),%edx
+  800637:	89 16                	mov    %edx,(%rsi)
+  800639:	48 98                	cltq
+  80063b:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  800640:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800646:	74 0a                	je     800652 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800648:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80064c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800650:	c9                   	leave
+  800651:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800652:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800656:	be ff 00 00 00       	mov    $0xff,%esi
+  80065b:	48 b8 78 12 80 00 00 	movabs $0x801278,%rax
+  800662:	00 00 00 
+  800665:	ff d0                	call   *%rax
+		b->idx = 0;
+  800667:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80066d:	eb d9                	jmp    800648 <putch+0x22>
+
+000000000080066f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80066f:	55                   	push   %rbp
+  800670:	48 89 e5             	mov    %rsp,%rbp
+  800673:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80067a:	48 89 fa             	mov    %rdi,%rdx
+  80067d:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  800680:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800687:	00 00 00 
+	b.cnt = 0;
+  80068a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800691:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800694:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  80069b:	48 bf 26 06 80 00 00 	movabs $0x800626,%rdi
+  8006a2:	00 00 00 
+  8006a5:	48 b8 8d 08 80 00 00 	movabs $0x80088d,%rax
+  8006ac:	00 00 00 
+  8006af:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8006b1:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  8006b8:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8006bf:	48 b8 78 12 80 00 00 	movabs $0x801278,%rax
+  8006c6:	00 00 00 
+  8006c9:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  8006cb:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  8006d1:	c9                   	leave
+  8006d2:	c3                   	ret
+
+00000000008006d3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8006d3:	55                   	push   %rbp
+  8006d4:	48 89 e5             	mov    %rsp,%rbp
+  8006d7:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8006de:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8006e5:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8006ec:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8006f3:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8006fa:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800701:	84 c0                	test   %al,%al
+  800703:	74 20                	je     800725 <cprintf+0x52>
+  800705:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800709:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80070d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800711:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800715:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800719:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80071d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800721:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800725:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  80072c:	00 00 00 
+  80072f:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800736:	00 00 00 
+  800739:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80073d:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800744:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80074b:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  800752:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  800759:	48 b8 6f 06 80 00 00 	movabs $0x80066f,%rax
+  800760:	00 00 00 
+  800763:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  800765:	c9                   	leave
+  800766:	c3                   	ret
+
+0000000000800767 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800767:	55                   	push   %rbp
+  800768:	48 89 e5             	mov    %rsp,%rbp
+  80076b:	41 57                	push   %r15
+  80076d:	41 56                	push   %r14
+  80076f:	41 55                	push   %r13
+  800771:	41 54                	push   %r12
+  800773:	53                   	push   %rbx
+  800774:	48 83 ec 18          	sub    $0x18,%rsp
+  800778:	49 89 fc             	mov    %rdi,%r12
+  80077b:	49 89 f5             	mov    %rsi,%r13
+  80077e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800782:	44 89 c3             	mov    %r8d,%ebx
+  800785:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800788:	41 89 cf             	mov    %ecx,%r15d
+  80078b:	4c 39 fa             	cmp    %r15,%rdx
+  80078e:	72 29                	jb     8007b9 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800790:	48 89 d0             	mov    %rdx,%rax
+  800793:	ba 00 00 00 00       	mov    $0x0,%edx
+  800798:	49 f7 f7             	div    %r15
+  80079b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80079f:	48 89 c2             	mov    %rax,%rdx
+  8007a2:	48 b8 67 07 80 00 00 	movabs $0x800767,%rax
+  8007a9:	00 00 00 
+  8007ac:	ff d0                	call   *%rax
+  8007ae:	eb 10                	jmp    8007c0 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8007b0:	4c 89 ee             	mov    %r13,%rsi
+  8007b3:	44 89 f7             	mov    %r14d,%edi
+  8007b6:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  8007b9:	83 eb 01             	sub    $0x1,%ebx
+  8007bc:	85 db                	test   %ebx,%ebx
+  8007be:	7f f0                	jg     8007b0 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007c9:	49 f7 f7             	div    %r15
+  8007cc:	48 b8 bb 22 80 00 00 	movabs $0x8022bb,%rax
+  8007d3:	00 00 00 
+  8007d6:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  8007da:	4c 89 ee             	mov    %r13,%rsi
+  8007dd:	41 ff d4             	call   *%r12
+}
+  8007e0:	48 83 c4 18          	add    $0x18,%rsp
+  8007e4:	5b                   	pop    %rbx
+  8007e5:	41 5c                	pop    %r12
+  8007e7:	41 5d                	pop    %r13
+  8007e9:	41 5e                	pop    %r14
+  8007eb:	41 5f                	pop    %r15
+  8007ed:	5d                   	pop    %rbp
+  8007ee:	c3                   	ret
+
+00000000008007ef <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  8007ef:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  8007f3:	48 8b 06             	mov    (%rsi),%rax
+  8007f6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8007fa:	73 0a                	jae    800806 <sprintputch+0x17>
+		*b->buf++ = ch;
+  8007fc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800800:	48 89 16             	mov    %rdx,(%rsi)
+  800803:	40 88 38             	mov    %dil,(%rax)
+}
+  800806:	c3                   	ret
+
+0000000000800807 <printfmt>:
+{
+  800807:	55                   	push   %rbp
+  800808:	48 89 e5             	mov    %rsp,%rbp
+  80080b:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800812:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800819:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800820:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800827:	84 c0                	test   %al,%al
+  800829:	74 20                	je     80084b <printfmt+0x44>
+  80082b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80082f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800833:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800837:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80083b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80083f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800843:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800847:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  80084b:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800852:	00 00 00 
+  800855:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80085c:	00 00 00 
+  80085f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800863:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80086a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800871:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800878:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  80087f:	48 b8 8d 08 80 00 00 	movabs $0x80088d,%rax
+  800886:	00 00 00 
+  800889:	ff d0                	call   *%rax
+}
+  80088b:	c9                   	leave
+  80088c:	c3                   	ret
+
+000000000080088d <vprintfmt>:
+{
+  80088d:	55                   	push   %rbp
+  80088e:	48 89 e5             	mov    %rsp,%rbp
+  800891:	41 57                	push   %r15
+  800893:	41 56                	push   %r14
+  800895:	41 55                	push   %r13
+  800897:	41 54                	push   %r12
+  800899:	53                   	push   %rbx
+  80089a:	48 83 ec 48          	sub    $0x48,%rsp
+  80089e:	49 89 fe             	mov    %rdi,%r14
+  8008a1:	49 89 f5             	mov    %rsi,%r13
+  8008a4:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  8008a7:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  8008ab:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  8008af:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8008b3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8008b7:	eb 09                	jmp    8008c2 <vprintfmt+0x35>
+			putch(ch, putdat);
+  8008b9:	4c 89 ee             	mov    %r13,%rsi
+  8008bc:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008bf:	4c 89 e3             	mov    %r12,%rbx
+  8008c2:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8008c6:	0f b6 3b             	movzbl (%rbx),%edi
+  8008c9:	83 ff 25             	cmp    $0x25,%edi
+  8008cc:	74 13                	je     8008e1 <vprintfmt+0x54>
+			if (ch == '\0')
+  8008ce:	85 ff                	test   %edi,%edi
+  8008d0:	75 e7                	jne    8008b9 <vprintfmt+0x2c>
+}
+  8008d2:	48 83 c4 48          	add    $0x48,%rsp
+  8008d6:	5b                   	pop    %rbx
+  8008d7:	41 5c                	pop    %r12
+  8008d9:	41 5d                	pop    %r13
+  8008db:	41 5e                	pop    %r14
+  8008dd:	41 5f                	pop    %r15
+  8008df:	5d                   	pop    %rbp
+  8008e0:	c3                   	ret
+		padc = ' ';
+  8008e1:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  8008e5:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  8008ec:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  8008f2:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  8008f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8008fe:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800903:	41 0f b6 14 24       	movzbl (%r12),%edx
+  800908:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  80090b:	3c 55                	cmp    $0x55,%al
+  80090d:	0f 87 4f 05 00 00    	ja     800e62 <vprintfmt+0x5d5>
+  800913:	0f b6 c0             	movzbl %al,%eax
+  800916:	48 be 80 23 80 00 00 	movabs $0x802380,%rsi
+  80091d:	00 00 00 
+  800920:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  800923:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  800926:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  80092a:	eb d2                	jmp    8008fe <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  80092c:	49 89 dc             	mov    %rbx,%r12
+  80092f:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  800933:	eb c9                	jmp    8008fe <vprintfmt+0x71>
+  800935:	0f b6 d2             	movzbl %dl,%edx
+  800938:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  80093b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  800941:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800945:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  80094a:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  80094f:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  800952:	83 f8 09             	cmp    $0x9,%eax
+  800955:	77 20                	ja     800977 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  800957:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  80095b:	eb e4                	jmp    800941 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  80095d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800960:	83 f8 2f             	cmp    $0x2f,%eax
+  800963:	77 27                	ja     80098c <vprintfmt+0xff>
+  800965:	89 c2                	mov    %eax,%edx
+  800967:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096b:	83 c0 08             	add    $0x8,%eax
+  80096e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800971:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  800974:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  800977:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80097b:	79 81                	jns    8008fe <vprintfmt+0x71>
+				width = precision, precision = -1;
+  80097d:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  800981:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800987:	e9 72 ff ff ff       	jmp    8008fe <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  80098c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800990:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800994:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800998:	eb d7                	jmp    800971 <vprintfmt+0xe4>
+			if (width < 0)
+  80099a:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  80099d:	85 f6                	test   %esi,%esi
+  80099f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a4:	0f 49 c6             	cmovns %esi,%eax
+  8009a7:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8009aa:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8009ad:	e9 4c ff ff ff       	jmp    8008fe <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8009b2:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  8009b5:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  8009bc:	e9 3d ff ff ff       	jmp    8008fe <vprintfmt+0x71>
+			lflag++;
+  8009c1:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8009c4:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8009c7:	e9 32 ff ff ff       	jmp    8008fe <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  8009cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d2:	77 19                	ja     8009ed <vprintfmt+0x160>
+  8009d4:	89 c2                	mov    %eax,%edx
+  8009d6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009da:	83 c0 08             	add    $0x8,%eax
+  8009dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e0:	8b 3a                	mov    (%rdx),%edi
+  8009e2:	4c 89 ee             	mov    %r13,%rsi
+  8009e5:	41 ff d6             	call   *%r14
+			break;
+  8009e8:	e9 d5 fe ff ff       	jmp    8008c2 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  8009ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f9:	eb e5                	jmp    8009e0 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  8009fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800a01:	77 5a                	ja     800a5d <vprintfmt+0x1d0>
+  800a03:	89 c2                	mov    %eax,%edx
+  800a05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a09:	83 c0 08             	add    $0x8,%eax
+  800a0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800a0f:	8b 02                	mov    (%rdx),%eax
+  800a11:	89 c1                	mov    %eax,%ecx
+  800a13:	f7 d9                	neg    %ecx
+  800a15:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a18:	83 f9 08             	cmp    $0x8,%ecx
+  800a1b:	7f 4e                	jg     800a6b <vprintfmt+0x1de>
+  800a1d:	48 63 c1             	movslq %ecx,%rax
+  800a20:	48 ba 40 26 80 00 00 	movabs $0x802640,%rdx
+  800a27:	00 00 00 
+  800a2a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800a2e:	48 85 c0             	test   %rax,%rax
+  800a31:	74 38                	je     800a6b <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800a33:	48 89 c1             	mov    %rax,%rcx
+  800a36:	48 ba 93 20 80 00 00 	movabs $0x802093,%rdx
+  800a3d:	00 00 00 
+  800a40:	4c 89 ee             	mov    %r13,%rsi
+  800a43:	4c 89 f7             	mov    %r14,%rdi
+  800a46:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a4b:	49 b8 07 08 80 00 00 	movabs $0x800807,%r8
+  800a52:	00 00 00 
+  800a55:	41 ff d0             	call   *%r8
+  800a58:	e9 65 fe ff ff       	jmp    8008c2 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  800a5d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a61:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a69:	eb a4                	jmp    800a0f <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  800a6b:	48 ba d3 22 80 00 00 	movabs $0x8022d3,%rdx
+  800a72:	00 00 00 
+  800a75:	4c 89 ee             	mov    %r13,%rsi
+  800a78:	4c 89 f7             	mov    %r14,%rdi
+  800a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a80:	49 b8 07 08 80 00 00 	movabs $0x800807,%r8
+  800a87:	00 00 00 
+  800a8a:	41 ff d0             	call   *%r8
+  800a8d:	e9 30 fe ff ff       	jmp    8008c2 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800a92:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a95:	83 f8 2f             	cmp    $0x2f,%eax
+  800a98:	77 36                	ja     800ad0 <vprintfmt+0x243>
+  800a9a:	89 c2                	mov    %eax,%edx
+  800a9c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa0:	83 c0 08             	add    $0x8,%eax
+  800aa3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa6:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800aa9:	48 85 c9             	test   %rcx,%rcx
+  800aac:	48 b8 cc 22 80 00 00 	movabs $0x8022cc,%rax
+  800ab3:	00 00 00 
+  800ab6:	48 0f 45 c1          	cmovne %rcx,%rax
+  800aba:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800abe:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800ac2:	7e 06                	jle    800aca <vprintfmt+0x23d>
+  800ac4:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800ac8:	75 14                	jne    800ade <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800aca:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ace:	eb 64                	jmp    800b34 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800ad0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800adc:	eb c8                	jmp    800aa6 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ade:	49 63 f7             	movslq %r15d,%rsi
+  800ae1:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800ae5:	48 b8 70 0f 80 00 00 	movabs $0x800f70,%rax
+  800aec:	00 00 00 
+  800aef:	ff d0                	call   *%rax
+  800af1:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800af4:	29 c1                	sub    %eax,%ecx
+  800af6:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800af9:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  800afc:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800b00:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b03:	eb 0d                	jmp    800b12 <vprintfmt+0x285>
+					putch(padc, putdat);
+  800b05:	4c 89 ee             	mov    %r13,%rsi
+  800b08:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  800b0b:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b0e:	41 83 ec 01          	sub    $0x1,%r12d
+  800b12:	45 85 e4             	test   %r12d,%r12d
+  800b15:	7f ee                	jg     800b05 <vprintfmt+0x278>
+  800b17:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  800b1a:	85 c9                	test   %ecx,%ecx
+  800b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b21:	0f 49 c1             	cmovns %ecx,%eax
+  800b24:	29 c1                	sub    %eax,%ecx
+  800b26:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  800b29:	eb 9f                	jmp    800aca <vprintfmt+0x23d>
+					putch(ch, putdat);
+  800b2b:	4c 89 ee             	mov    %r13,%rsi
+  800b2e:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b31:	4c 89 e2             	mov    %r12,%rdx
+  800b34:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800b38:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800b3e:	0f be f8             	movsbl %al,%edi
+  800b41:	85 ff                	test   %edi,%edi
+  800b43:	74 29                	je     800b6e <vprintfmt+0x2e1>
+  800b45:	45 85 ff             	test   %r15d,%r15d
+  800b48:	78 06                	js     800b50 <vprintfmt+0x2c3>
+  800b4a:	41 83 ef 01          	sub    $0x1,%r15d
+  800b4e:	78 1e                	js     800b6e <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b50:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800b54:	74 d5                	je     800b2b <vprintfmt+0x29e>
+  800b56:	0f be c0             	movsbl %al,%eax
+  800b59:	83 e8 20             	sub    $0x20,%eax
+  800b5c:	83 f8 5e             	cmp    $0x5e,%eax
+  800b5f:	76 ca                	jbe    800b2b <vprintfmt+0x29e>
+					putch('?', putdat);
+  800b61:	4c 89 ee             	mov    %r13,%rsi
+  800b64:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b69:	41 ff d6             	call   *%r14
+  800b6c:	eb c3                	jmp    800b31 <vprintfmt+0x2a4>
+  800b6e:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800b72:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800b75:	41 01 c4             	add    %eax,%r12d
+  800b78:	41 29 d4             	sub    %edx,%r12d
+  800b7b:	eb 0f                	jmp    800b8c <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  800b7d:	4c 89 ee             	mov    %r13,%rsi
+  800b80:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b85:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800b88:	41 83 ec 01          	sub    $0x1,%r12d
+  800b8c:	45 85 e4             	test   %r12d,%r12d
+  800b8f:	7f ec                	jg     800b7d <vprintfmt+0x2f0>
+  800b91:	e9 2c fd ff ff       	jmp    8008c2 <vprintfmt+0x35>
+	if (lflag >= 2)
+  800b96:	83 f9 01             	cmp    $0x1,%ecx
+  800b99:	7f 1d                	jg     800bb8 <vprintfmt+0x32b>
+	else if (lflag)
+  800b9b:	85 c9                	test   %ecx,%ecx
+  800b9d:	74 5e                	je     800bfd <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800b9f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba5:	77 48                	ja     800bef <vprintfmt+0x362>
+  800ba7:	89 c2                	mov    %eax,%edx
+  800ba9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bad:	83 c0 08             	add    $0x8,%eax
+  800bb0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb3:	4c 8b 22             	mov    (%rdx),%r12
+  800bb6:	eb 17                	jmp    800bcf <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800bb8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbb:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbe:	77 21                	ja     800be1 <vprintfmt+0x354>
+  800bc0:	89 c2                	mov    %eax,%edx
+  800bc2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc6:	83 c0 08             	add    $0x8,%eax
+  800bc9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bcc:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800bcf:	4d 85 e4             	test   %r12,%r12
+  800bd2:	78 50                	js     800c24 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  800bd4:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800bd7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800bdc:	e9 b4 01 00 00       	jmp    800d95 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800be1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bed:	eb dd                	jmp    800bcc <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800bef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bfb:	eb b6                	jmp    800bb3 <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800bfd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c00:	83 f8 2f             	cmp    $0x2f,%eax
+  800c03:	77 11                	ja     800c16 <vprintfmt+0x389>
+  800c05:	89 c2                	mov    %eax,%edx
+  800c07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0b:	83 c0 08             	add    $0x8,%eax
+  800c0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c11:	4c 63 22             	movslq (%rdx),%r12
+  800c14:	eb b9                	jmp    800bcf <vprintfmt+0x342>
+  800c16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c22:	eb ed                	jmp    800c11 <vprintfmt+0x384>
+				putch('-', putdat);
+  800c24:	4c 89 ee             	mov    %r13,%rsi
+  800c27:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c2c:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800c2f:	4c 89 e2             	mov    %r12,%rdx
+  800c32:	48 f7 da             	neg    %rdx
+			base = 10;
+  800c35:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800c3a:	e9 56 01 00 00       	jmp    800d95 <vprintfmt+0x508>
+	if (lflag >= 2)
+  800c3f:	83 f9 01             	cmp    $0x1,%ecx
+  800c42:	7f 25                	jg     800c69 <vprintfmt+0x3dc>
+	else if (lflag)
+  800c44:	85 c9                	test   %ecx,%ecx
+  800c46:	74 5e                	je     800ca6 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800c48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c4b:	83 f8 2f             	cmp    $0x2f,%eax
+  800c4e:	77 48                	ja     800c98 <vprintfmt+0x40b>
+  800c50:	89 c2                	mov    %eax,%edx
+  800c52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c56:	83 c0 08             	add    $0x8,%eax
+  800c59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c5c:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800c5f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800c64:	e9 2c 01 00 00       	jmp    800d95 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800c69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c6c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c6f:	77 19                	ja     800c8a <vprintfmt+0x3fd>
+  800c71:	89 c2                	mov    %eax,%edx
+  800c73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c77:	83 c0 08             	add    $0x8,%eax
+  800c7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c7d:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800c80:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800c85:	e9 0b 01 00 00       	jmp    800d95 <vprintfmt+0x508>
+  800c8a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c8e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c96:	eb e5                	jmp    800c7d <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800c98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca4:	eb b6                	jmp    800c5c <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800ca6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca9:	83 f8 2f             	cmp    $0x2f,%eax
+  800cac:	77 18                	ja     800cc6 <vprintfmt+0x439>
+  800cae:	89 c2                	mov    %eax,%edx
+  800cb0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb4:	83 c0 08             	add    $0x8,%eax
+  800cb7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cba:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800cbc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800cc1:	e9 cf 00 00 00       	jmp    800d95 <vprintfmt+0x508>
+  800cc6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd2:	eb e6                	jmp    800cba <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800cd4:	83 f9 01             	cmp    $0x1,%ecx
+  800cd7:	7f 25                	jg     800cfe <vprintfmt+0x471>
+	else if (lflag)
+  800cd9:	85 c9                	test   %ecx,%ecx
+  800cdb:	74 5b                	je     800d38 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800cdd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce3:	77 45                	ja     800d2a <vprintfmt+0x49d>
+  800ce5:	89 c2                	mov    %eax,%edx
+  800ce7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ceb:	83 c0 08             	add    $0x8,%eax
+  800cee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf1:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800cf4:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800cf9:	e9 97 00 00 00       	jmp    800d95 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800cfe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d01:	83 f8 2f             	cmp    $0x2f,%eax
+  800d04:	77 16                	ja     800d1c <vprintfmt+0x48f>
+  800d06:	89 c2                	mov    %eax,%edx
+  800d08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d0c:	83 c0 08             	add    $0x8,%eax
+  800d0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d12:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800d15:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800d1a:	eb 79                	jmp    800d95 <vprintfmt+0x508>
+  800d1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d28:	eb e8                	jmp    800d12 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800d2a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d2e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d32:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d36:	eb b9                	jmp    800cf1 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800d38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d3b:	83 f8 2f             	cmp    $0x2f,%eax
+  800d3e:	77 15                	ja     800d55 <vprintfmt+0x4c8>
+  800d40:	89 c2                	mov    %eax,%edx
+  800d42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d46:	83 c0 08             	add    $0x8,%eax
+  800d49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d4c:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800d4e:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800d53:	eb 40                	jmp    800d95 <vprintfmt+0x508>
+  800d55:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d59:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d61:	eb e9                	jmp    800d4c <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800d63:	4c 89 ee             	mov    %r13,%rsi
+  800d66:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d6b:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800d6e:	4c 89 ee             	mov    %r13,%rsi
+  800d71:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d76:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800d79:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d7c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d7f:	77 34                	ja     800db5 <vprintfmt+0x528>
+  800d81:	89 c2                	mov    %eax,%edx
+  800d83:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d87:	83 c0 08             	add    $0x8,%eax
+  800d8a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800d8d:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800d90:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800d95:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800d9a:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800d9e:	4c 89 ee             	mov    %r13,%rsi
+  800da1:	4c 89 f7             	mov    %r14,%rdi
+  800da4:	48 b8 67 07 80 00 00 	movabs $0x800767,%rax
+  800dab:	00 00 00 
+  800dae:	ff d0                	call   *%rax
+			break;
+  800db0:	e9 0d fb ff ff       	jmp    8008c2 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800db5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800db9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dbd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc1:	eb ca                	jmp    800d8d <vprintfmt+0x500>
+	if (lflag >= 2)
+  800dc3:	83 f9 01             	cmp    $0x1,%ecx
+  800dc6:	7f 22                	jg     800dea <vprintfmt+0x55d>
+	else if (lflag)
+  800dc8:	85 c9                	test   %ecx,%ecx
+  800dca:	74 58                	je     800e24 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800dcc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dcf:	83 f8 2f             	cmp    $0x2f,%eax
+  800dd2:	77 42                	ja     800e16 <vprintfmt+0x589>
+  800dd4:	89 c2                	mov    %eax,%edx
+  800dd6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dda:	83 c0 08             	add    $0x8,%eax
+  800ddd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800de0:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800de3:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800de8:	eb ab                	jmp    800d95 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800dea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ded:	83 f8 2f             	cmp    $0x2f,%eax
+  800df0:	77 16                	ja     800e08 <vprintfmt+0x57b>
+  800df2:	89 c2                	mov    %eax,%edx
+  800df4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800df8:	83 c0 08             	add    $0x8,%eax
+  800dfb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dfe:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800e01:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800e06:	eb 8d                	jmp    800d95 <vprintfmt+0x508>
+  800e08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e14:	eb e8                	jmp    800dfe <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800e16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e22:	eb bc                	jmp    800de0 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800e24:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e27:	83 f8 2f             	cmp    $0x2f,%eax
+  800e2a:	77 18                	ja     800e44 <vprintfmt+0x5b7>
+  800e2c:	89 c2                	mov    %eax,%edx
+  800e2e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e32:	83 c0 08             	add    $0x8,%eax
+  800e35:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e38:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800e3a:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800e3f:	e9 51 ff ff ff       	jmp    800d95 <vprintfmt+0x508>
+  800e44:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e48:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e50:	eb e6                	jmp    800e38 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800e52:	4c 89 ee             	mov    %r13,%rsi
+  800e55:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e5a:	41 ff d6             	call   *%r14
+			break;
+  800e5d:	e9 60 fa ff ff       	jmp    8008c2 <vprintfmt+0x35>
+			putch('%', putdat);
+  800e62:	4c 89 ee             	mov    %r13,%rsi
+  800e65:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e6a:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800e6d:	4c 89 e3             	mov    %r12,%rbx
+  800e70:	eb 04                	jmp    800e76 <vprintfmt+0x5e9>
+  800e72:	48 83 eb 01          	sub    $0x1,%rbx
+  800e76:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e7a:	75 f6                	jne    800e72 <vprintfmt+0x5e5>
+  800e7c:	e9 41 fa ff ff       	jmp    8008c2 <vprintfmt+0x35>
+
+0000000000800e81 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800e81:	55                   	push   %rbp
+  800e82:	48 89 e5             	mov    %rsp,%rbp
+  800e85:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800e89:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800e8d:	48 63 c6             	movslq %esi,%rax
+  800e90:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800e95:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800e99:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800ea0:	48 85 ff             	test   %rdi,%rdi
+  800ea3:	74 2a                	je     800ecf <vsnprintf+0x4e>
+  800ea5:	85 f6                	test   %esi,%esi
+  800ea7:	7e 26                	jle    800ecf <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800ea9:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800ead:	48 bf ef 07 80 00 00 	movabs $0x8007ef,%rdi
+  800eb4:	00 00 00 
+  800eb7:	48 b8 8d 08 80 00 00 	movabs $0x80088d,%rax
+  800ebe:	00 00 00 
+  800ec1:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ec3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800ec7:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800eca:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800ecd:	c9                   	leave
+  800ece:	c3                   	ret
+		return -E_INVAL;
+  800ecf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ed4:	eb f7                	jmp    800ecd <vsnprintf+0x4c>
+
+0000000000800ed6 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800ed6:	55                   	push   %rbp
+  800ed7:	48 89 e5             	mov    %rsp,%rbp
+  800eda:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800ee1:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800ee8:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800eef:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800ef6:	84 c0                	test   %al,%al
+  800ef8:	74 20                	je     800f1a <snprintf+0x44>
+  800efa:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800efe:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f02:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f06:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f0a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f0e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f12:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f16:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800f1a:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f21:	00 00 00 
+  800f24:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f2b:	00 00 00 
+  800f2e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f32:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800f39:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f40:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800f47:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800f4e:	48 b8 81 0e 80 00 00 	movabs $0x800e81,%rax
+  800f55:	00 00 00 
+  800f58:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800f5a:	c9                   	leave
+  800f5b:	c3                   	ret
+
+0000000000800f5c <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800f5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f61:	48 89 d0             	mov    %rdx,%rax
+  800f64:	48 83 c2 01          	add    $0x1,%rdx
+  800f68:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800f6d:	75 f2                	jne    800f61 <strlen+0x5>
+		n++;
+	return n;
+}
+  800f6f:	c3                   	ret
+
+0000000000800f70 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f70:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f75:	eb 03                	jmp    800f7a <strnlen+0xa>
+  800f77:	48 89 d0             	mov    %rdx,%rax
+  800f7a:	48 39 c6             	cmp    %rax,%rsi
+  800f7d:	74 0a                	je     800f89 <strnlen+0x19>
+  800f7f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800f83:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800f87:	75 ee                	jne    800f77 <strnlen+0x7>
+		n++;
+	return n;
+}
+  800f89:	c3                   	ret
+
+0000000000800f8a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800f8a:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800f8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f92:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800f96:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800f99:	48 83 c2 01          	add    $0x1,%rdx
+  800f9d:	84 c9                	test   %cl,%cl
+  800f9f:	75 f1                	jne    800f92 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800fa1:	c3                   	ret
+
+0000000000800fa2 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800fa2:	55                   	push   %rbp
+  800fa3:	48 89 e5             	mov    %rsp,%rbp
+  800fa6:	41 54                	push   %r12
+  800fa8:	53                   	push   %rbx
+  800fa9:	48 89 fb             	mov    %rdi,%rbx
+  800fac:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800faf:	48 b8 5c 0f 80 00 00 	movabs $0x800f5c,%rax
+  800fb6:	00 00 00 
+  800fb9:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800fbb:	48 63 f8             	movslq %eax,%rdi
+  800fbe:	48 01 df             	add    %rbx,%rdi
+  800fc1:	4c 89 e6             	mov    %r12,%rsi
+  800fc4:	48 b8 8a 0f 80 00 00 	movabs $0x800f8a,%rax
+  800fcb:	00 00 00 
+  800fce:	ff d0                	call   *%rax
+	return dst;
+}
+  800fd0:	48 89 d8             	mov    %rbx,%rax
+  800fd3:	5b                   	pop    %rbx
+  800fd4:	41 5c                	pop    %r12
+  800fd6:	5d                   	pop    %rbp
+  800fd7:	c3                   	ret
+
+0000000000800fd8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800fd8:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800fdb:	48 01 fa             	add    %rdi,%rdx
+  800fde:	48 89 f9             	mov    %rdi,%rcx
+  800fe1:	eb 14                	jmp    800ff7 <strncpy+0x1f>
+		*dst++ = *src;
+  800fe3:	48 83 c1 01          	add    $0x1,%rcx
+  800fe7:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800feb:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800fef:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ff3:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800ff7:	48 39 d1             	cmp    %rdx,%rcx
+  800ffa:	75 e7                	jne    800fe3 <strncpy+0xb>
+	}
+	return ret;
+}
+  800ffc:	c3                   	ret
+
+0000000000800ffd <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800ffd:	48 89 f8             	mov    %rdi,%rax
+  801000:	48 85 d2             	test   %rdx,%rdx
+  801003:	74 27                	je     80102c <strlcpy+0x2f>
+  801005:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  80100a:	48 89 fa             	mov    %rdi,%rdx
+  80100d:	eb 0b                	jmp    80101a <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80100f:	48 83 c6 01          	add    $0x1,%rsi
+  801013:	48 83 c2 01          	add    $0x1,%rdx
+  801017:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  80101a:	48 39 c2             	cmp    %rax,%rdx
+  80101d:	74 0a                	je     801029 <strlcpy+0x2c>
+  80101f:	0f b6 0e             	movzbl (%rsi),%ecx
+  801022:	84 c9                	test   %cl,%cl
+  801024:	75 e9                	jne    80100f <strlcpy+0x12>
+  801026:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  801029:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  80102c:	48 29 f8             	sub    %rdi,%rax
+}
+  80102f:	c3                   	ret
+
+0000000000801030 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  801030:	eb 08                	jmp    80103a <strcmp+0xa>
+		p++, q++;
+  801032:	48 83 c7 01          	add    $0x1,%rdi
+  801036:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  80103a:	0f b6 07             	movzbl (%rdi),%eax
+  80103d:	84 c0                	test   %al,%al
+  80103f:	74 04                	je     801045 <strcmp+0x15>
+  801041:	3a 06                	cmp    (%rsi),%al
+  801043:	74 ed                	je     801032 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801045:	0f b6 c0             	movzbl %al,%eax
+  801048:	0f b6 16             	movzbl (%rsi),%edx
+  80104b:	29 d0                	sub    %edx,%eax
+}
+  80104d:	c3                   	ret
+
+000000000080104e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  80104e:	eb 0c                	jmp    80105c <strncmp+0xe>
+		n--, p++, q++;
+  801050:	48 83 ea 01          	sub    $0x1,%rdx
+  801054:	48 83 c7 01          	add    $0x1,%rdi
+  801058:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  80105c:	48 85 d2             	test   %rdx,%rdx
+  80105f:	74 14                	je     801075 <strncmp+0x27>
+  801061:	0f b6 07             	movzbl (%rdi),%eax
+  801064:	84 c0                	test   %al,%al
+  801066:	74 04                	je     80106c <strncmp+0x1e>
+  801068:	3a 06                	cmp    (%rsi),%al
+  80106a:	74 e4                	je     801050 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80106c:	0f b6 07             	movzbl (%rdi),%eax
+  80106f:	0f b6 16             	movzbl (%rsi),%edx
+  801072:	29 d0                	sub    %edx,%eax
+}
+  801074:	c3                   	ret
+		return 0;
+  801075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80107a:	c3                   	ret
+
+000000000080107b <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  80107b:	eb 04                	jmp    801081 <strchr+0x6>
+  80107d:	48 83 c7 01          	add    $0x1,%rdi
+  801081:	0f b6 07             	movzbl (%rdi),%eax
+  801084:	84 c0                	test   %al,%al
+  801086:	74 09                	je     801091 <strchr+0x16>
+		if (*s == c)
+  801088:	40 38 f0             	cmp    %sil,%al
+  80108b:	75 f0                	jne    80107d <strchr+0x2>
+  80108d:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  801090:	c3                   	ret
+	return 0;
+  801091:	b8 00 00 00 00       	mov    $0x0,%eax
+  801096:	c3                   	ret
+
+0000000000801097 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801097:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  80109a:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  80109d:	40 38 f2             	cmp    %sil,%dl
+  8010a0:	74 0a                	je     8010ac <strfind+0x15>
+  8010a2:	84 d2                	test   %dl,%dl
+  8010a4:	74 06                	je     8010ac <strfind+0x15>
+	for (; *s; s++)
+  8010a6:	48 83 c0 01          	add    $0x1,%rax
+  8010aa:	eb ee                	jmp    80109a <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  8010ac:	c3                   	ret
+
+00000000008010ad <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  8010ad:	48 85 d2             	test   %rdx,%rdx
+  8010b0:	74 28                	je     8010da <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  8010b2:	48 89 f8             	mov    %rdi,%rax
+  8010b5:	48 09 d0             	or     %rdx,%rax
+  8010b8:	a8 03                	test   $0x3,%al
+  8010ba:	75 16                	jne    8010d2 <memset+0x25>
+		c &= 0xFF;
+  8010bc:	40 0f b6 f6          	movzbl %sil,%esi
+  8010c0:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8010c6:	48 89 d1             	mov    %rdx,%rcx
+  8010c9:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  8010cd:	fc                   	cld
+  8010ce:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8010d0:	eb 08                	jmp    8010da <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8010d2:	89 f0                	mov    %esi,%eax
+  8010d4:	48 89 d1             	mov    %rdx,%rcx
+  8010d7:	fc                   	cld
+  8010d8:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8010da:	48 89 f8             	mov    %rdi,%rax
+  8010dd:	c3                   	ret
+
+00000000008010de <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8010de:	48 89 f8             	mov    %rdi,%rax
+  8010e1:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8010e4:	48 39 fe             	cmp    %rdi,%rsi
+  8010e7:	73 3a                	jae    801123 <memmove+0x45>
+  8010e9:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010ed:	48 39 d7             	cmp    %rdx,%rdi
+  8010f0:	73 31                	jae    801123 <memmove+0x45>
+		s += n;
+		d += n;
+  8010f2:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  8010f6:	48 89 d6             	mov    %rdx,%rsi
+  8010f9:	48 09 fe             	or     %rdi,%rsi
+  8010fc:	48 09 ce             	or     %rcx,%rsi
+  8010ff:	40 f6 c6 03          	test   $0x3,%sil
+  801103:	75 11                	jne    801116 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801105:	48 83 ef 04          	sub    $0x4,%rdi
+  801109:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  80110d:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801111:	fd                   	std
+  801112:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801114:	eb 0b                	jmp    801121 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801116:	48 83 ef 01          	sub    $0x1,%rdi
+  80111a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  80111e:	fd                   	std
+  80111f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801121:	fc                   	cld
+  801122:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  801123:	48 89 f2             	mov    %rsi,%rdx
+  801126:	48 09 c2             	or     %rax,%rdx
+  801129:	48 09 ca             	or     %rcx,%rdx
+  80112c:	f6 c2 03             	test   $0x3,%dl
+  80112f:	75 0b                	jne    80113c <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801131:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  801135:	48 89 c7             	mov    %rax,%rdi
+  801138:	fc                   	cld
+  801139:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80113b:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  80113c:	48 89 c7             	mov    %rax,%rdi
+  80113f:	fc                   	cld
+  801140:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801142:	c3                   	ret
+
+0000000000801143 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801143:	55                   	push   %rbp
+  801144:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  801147:	48 b8 de 10 80 00 00 	movabs $0x8010de,%rax
+  80114e:	00 00 00 
+  801151:	ff d0                	call   *%rax
+}
+  801153:	5d                   	pop    %rbp
+  801154:	c3                   	ret
+
+0000000000801155 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801155:	b8 00 00 00 00       	mov    $0x0,%eax
+  80115a:	48 39 c2             	cmp    %rax,%rdx
+  80115d:	74 1e                	je     80117d <memcmp+0x28>
+		if (*s1 != *s2)
+  80115f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801163:	48 83 c0 01          	add    $0x1,%rax
+  801167:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  80116d:	44 38 c1             	cmp    %r8b,%cl
+  801170:	74 e8                	je     80115a <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  801172:	0f b6 c1             	movzbl %cl,%eax
+  801175:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801179:	44 29 c0             	sub    %r8d,%eax
+  80117c:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  80117d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801182:	c3                   	ret
+
+0000000000801183 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801183:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  801186:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  801189:	eb 04                	jmp    80118f <memfind+0xc>
+  80118b:	48 83 c0 01          	add    $0x1,%rax
+  80118f:	48 39 d0             	cmp    %rdx,%rax
+  801192:	73 05                	jae    801199 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801194:	40 38 30             	cmp    %sil,(%rax)
+  801197:	75 f2                	jne    80118b <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  801199:	c3                   	ret
+
+000000000080119a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80119a:	48 89 f9             	mov    %rdi,%rcx
+  80119d:	49 89 f0             	mov    %rsi,%r8
+  8011a0:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8011a2:	eb 04                	jmp    8011a8 <strtol+0xe>
+		s++;
+  8011a4:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  8011a8:	0f b6 01             	movzbl (%rcx),%eax
+  8011ab:	3c 20                	cmp    $0x20,%al
+  8011ad:	74 f5                	je     8011a4 <strtol+0xa>
+  8011af:	3c 09                	cmp    $0x9,%al
+  8011b1:	74 f1                	je     8011a4 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  8011b3:	3c 2b                	cmp    $0x2b,%al
+  8011b5:	74 2b                	je     8011e2 <strtol+0x48>
+	int neg = 0;
+  8011b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  8011bd:	3c 2d                	cmp    $0x2d,%al
+  8011bf:	74 2d                	je     8011ee <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011c1:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  8011c7:	75 0f                	jne    8011d8 <strtol+0x3e>
+  8011c9:	80 39 30             	cmpb   $0x30,(%rcx)
+  8011cc:	74 2c                	je     8011fa <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8011ce:	85 ff                	test   %edi,%edi
+  8011d0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011d5:	0f 44 f8             	cmove  %eax,%edi
+  8011d8:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  8011dd:	4c 63 d7             	movslq %edi,%r10
+  8011e0:	eb 4f                	jmp    801231 <strtol+0x97>
+		s++;
+  8011e2:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  8011e6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8011ec:	eb d3                	jmp    8011c1 <strtol+0x27>
+		s++, neg = 1;
+  8011ee:	48 83 c1 01          	add    $0x1,%rcx
+  8011f2:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  8011f8:	eb c7                	jmp    8011c1 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011fa:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  8011fe:	74 0f                	je     80120f <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  801200:	85 ff                	test   %edi,%edi
+  801202:	75 d4                	jne    8011d8 <strtol+0x3e>
+		s++, base = 8;
+  801204:	48 83 c1 01          	add    $0x1,%rcx
+  801208:	bf 08 00 00 00       	mov    $0x8,%edi
+  80120d:	eb c9                	jmp    8011d8 <strtol+0x3e>
+		s += 2, base = 16;
+  80120f:	48 83 c1 02          	add    $0x2,%rcx
+  801213:	bf 10 00 00 00       	mov    $0x10,%edi
+  801218:	eb be                	jmp    8011d8 <strtol+0x3e>
+			dig = *s - '0';
+  80121a:	0f be c0             	movsbl %al,%eax
+  80121d:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  801220:	39 f8                	cmp    %edi,%eax
+  801222:	7d 3b                	jge    80125f <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  801224:	48 83 c1 01          	add    $0x1,%rcx
+  801228:	49 0f af d2          	imul   %r10,%rdx
+  80122c:	48 98                	cltq
+  80122e:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  801231:	0f b6 01             	movzbl (%rcx),%eax
+  801234:	8d 70 d0             	lea    -0x30(%rax),%esi
+  801237:	40 80 fe 09          	cmp    $0x9,%sil
+  80123b:	76 dd                	jbe    80121a <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  80123d:	8d 70 9f             	lea    -0x61(%rax),%esi
+  801240:	40 80 fe 19          	cmp    $0x19,%sil
+  801244:	77 08                	ja     80124e <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  801246:	0f be c0             	movsbl %al,%eax
+  801249:	83 e8 57             	sub    $0x57,%eax
+  80124c:	eb d2                	jmp    801220 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  80124e:	8d 70 bf             	lea    -0x41(%rax),%esi
+  801251:	40 80 fe 19          	cmp    $0x19,%sil
+  801255:	77 08                	ja     80125f <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  801257:	0f be c0             	movsbl %al,%eax
+  80125a:	83 e8 37             	sub    $0x37,%eax
+  80125d:	eb c1                	jmp    801220 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80125f:	4d 85 c0             	test   %r8,%r8
+  801262:	74 03                	je     801267 <strtol+0xcd>
+		*endptr = (char *) s;
+  801264:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  801267:	48 89 d0             	mov    %rdx,%rax
+  80126a:	48 f7 d8             	neg    %rax
+  80126d:	45 85 c9             	test   %r9d,%r9d
+  801270:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  801274:	48 89 d0             	mov    %rdx,%rax
+  801277:	c3                   	ret
+
+0000000000801278 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  801278:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80127e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  801284:	ba 00 00 00 00       	mov    $0x0,%edx
+  801289:	b8 00 00 00 00       	mov    $0x0,%eax
+  80128e:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  801290:	c3                   	ret
+
+0000000000801291 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  801291:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801297:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80129d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012a7:	48 89 fe             	mov    %rdi,%rsi
+  8012aa:	48 89 fa             	mov    %rdi,%rdx
+  8012ad:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8012af:	c3                   	ret
+
+00000000008012b0 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8012b0:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8012b3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8012b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8012bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8012c9:	48 89 f2             	mov    %rsi,%rdx
+  8012cc:	0f 05                	syscall
+	if(check && ret > 0)
+  8012ce:	48 85 c0             	test   %rax,%rax
+  8012d1:	7f 01                	jg     8012d4 <sys_env_destroy+0x24>
+}
+  8012d3:	c3                   	ret
+{
+  8012d4:	55                   	push   %rbp
+  8012d5:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012d8:	49 89 c0             	mov    %rax,%r8
+  8012db:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012e0:	48 ba 88 26 80 00 00 	movabs $0x802688,%rdx
+  8012e7:	00 00 00 
+  8012ea:	be 28 00 00 00       	mov    $0x28,%esi
+  8012ef:	48 bf a5 26 80 00 00 	movabs $0x8026a5,%rdi
+  8012f6:	00 00 00 
+  8012f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012fe:	49 b9 34 05 80 00 00 	movabs $0x800534,%r9
+  801305:	00 00 00 
+  801308:	41 ff d1             	call   *%r9
+
+000000000080130b <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  80130b:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  801312:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  801313:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801318:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80131c:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801320:	48 c1 e2 04          	shl    $0x4,%rdx
+  801324:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  80132b:	00 00 00 
+  80132e:	48 01 d0             	add    %rdx,%rax
+  801331:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  801337:	c3                   	ret
+
+0000000000801338 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  801338:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80133e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801344:	bf 00 00 00 00       	mov    $0x0,%edi
+  801349:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80134e:	48 89 fe             	mov    %rdi,%rsi
+  801351:	48 89 fa             	mov    %rdi,%rdx
+  801354:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801356:	c3                   	ret
+
+0000000000801357 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  801357:	48 63 d2             	movslq %edx,%rdx
+  80135a:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80135d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801363:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801369:	b8 04 00 00 00       	mov    $0x4,%eax
+  80136e:	0f 05                	syscall
+	if(check && ret > 0)
+  801370:	48 85 c0             	test   %rax,%rax
+  801373:	7f 01                	jg     801376 <sys_page_alloc+0x1f>
+}
+  801375:	c3                   	ret
+{
+  801376:	55                   	push   %rbp
+  801377:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80137a:	49 89 c0             	mov    %rax,%r8
+  80137d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801382:	48 ba 88 26 80 00 00 	movabs $0x802688,%rdx
+  801389:	00 00 00 
+  80138c:	be 28 00 00 00       	mov    $0x28,%esi
+  801391:	48 bf a5 26 80 00 00 	movabs $0x8026a5,%rdi
+  801398:	00 00 00 
+  80139b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a0:	49 b9 34 05 80 00 00 	movabs $0x800534,%r9
+  8013a7:	00 00 00 
+  8013aa:	41 ff d1             	call   *%r9
+
+00000000008013ad <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8013ad:	48 63 d2             	movslq %edx,%rdx
+  8013b0:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8013b3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8013b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8013bf:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8013c4:	0f 05                	syscall
+	if(check && ret > 0)
+  8013c6:	48 85 c0             	test   %rax,%rax
+  8013c9:	7f 01                	jg     8013cc <sys_page_alloc_huge+0x1f>
+}
+  8013cb:	c3                   	ret
+{
+  8013cc:	55                   	push   %rbp
+  8013cd:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013d0:	49 89 c0             	mov    %rax,%r8
+  8013d3:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8013d8:	48 ba 88 26 80 00 00 	movabs $0x802688,%rdx
+  8013df:	00 00 00 
+  8013e2:	be 28 00 00 00       	mov    $0x28,%esi
+  8013e7:	48 bf a5 26 80 00 00 	movabs $0x8026a5,%rdi
+  8013ee:	00 00 00 
+  8013f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f6:	49 b9 34 05 80 00 00 	movabs $0x800534,%r9
+  8013fd:	00 00 00 
+  801400:	41 ff d1             	call   *%r9
+
+0000000000801403 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801403:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  801406:	48 63 d2             	movslq %edx,%rdx
+  801409:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  80140c:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  80140f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801414:	0f 05                	syscall
+	if(check && ret > 0)
+  801416:	48 85 c0             	test   %rax,%rax
+  801419:	7f 01                	jg     80141c <sys_page_map+0x19>
+}
+  80141b:	c3                   	ret
+{
+  80141c:	55                   	push   %rbp
+  80141d:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801420:	49 89 c0             	mov    %rax,%r8
+  801423:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801428:	48 ba 88 26 80 00 00 	movabs $0x802688,%rdx
+  80142f:	00 00 00 
+  801432:	be 28 00 00 00       	mov    $0x28,%esi
+  801437:	48 bf a5 26 80 00 00 	movabs $0x8026a5,%rdi
+  80143e:	00 00 00 
+  801441:	b8 00 00 00 00       	mov    $0x0,%eax
+  801446:	49 b9 34 05 80 00 00 	movabs $0x800534,%r9
+  80144d:	00 00 00 
+  801450:	41 ff d1             	call   *%r9
+
+0000000000801453 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  801453:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801456:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80145c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801462:	ba 00 00 00 00       	mov    $0x0,%edx
+  801467:	b8 06 00 00 00       	mov    $0x6,%eax
+  80146c:	0f 05                	syscall
+	if(check && ret > 0)
+  80146e:	48 85 c0             	test   %rax,%rax
+  801471:	7f 01                	jg     801474 <sys_page_unmap+0x21>
+}
+  801473:	c3                   	ret
+{
+  801474:	55                   	push   %rbp
+  801475:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801478:	49 89 c0             	mov    %rax,%r8
+  80147b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801480:	48 ba 88 26 80 00 00 	movabs $0x802688,%rdx
+  801487:	00 00 00 
+  80148a:	be 28 00 00 00       	mov    $0x28,%esi
+  80148f:	48 bf a5 26 80 00 00 	movabs $0x8026a5,%rdi
+  801496:	00 00 00 
+  801499:	b8 00 00 00 00       	mov    $0x0,%eax
+  80149e:	49 b9 34 05 80 00 00 	movabs $0x800534,%r9
+  8014a5:	00 00 00 
+  8014a8:	41 ff d1             	call   *%r9
+
+00000000008014ab <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  8014ab:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8014b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8014b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014bc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8014c1:	48 89 fe             	mov    %rdi,%rsi
+  8014c4:	48 89 fa             	mov    %rdi,%rdx
+  8014c7:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8014c9:	c3                   	ret
+
+00000000008014ca <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  8014ca:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8014d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8014d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014db:	b8 10 00 00 00       	mov    $0x10,%eax
+  8014e0:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  8014e2:	c3                   	ret
+
+00000000008014e3 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  8014e3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8014e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8014ef:	b8 11 00 00 00       	mov    $0x11,%eax
+  8014f4:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  8014f6:	c3                   	ret
+
+00000000008014f7 <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  8014f7:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  8014fa:	48 63 f6             	movslq %esi,%rsi
+  8014fd:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  801500:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801506:	b8 12 00 00 00       	mov    $0x12,%eax
+  80150b:	0f 05                	syscall
+	if(check && ret > 0)
+  80150d:	48 85 c0             	test   %rax,%rax
+  801510:	7f 01                	jg     801513 <sys_page_batch+0x1c>
+}
+  801512:	c3                   	ret
+{
+  801513:	55                   	push   %rbp
+  801514:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801517:	49 89 c0             	mov    %rax,%r8
+  80151a:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80151f:	48 ba 88 26 80 00 00 	movabs $0x802688,%rdx
+  801526:	00 00 00 
+  801529:	be 28 00 00 00       	mov    $0x28,%esi
+  80152e:	48 bf a5 26 80 00 00 	movabs $0x8026a5,%rdi
+  801535:	00 00 00 
+  801538:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153d:	49 b9 34 05 80 00 00 	movabs $0x800534,%r9
+  801544:	00 00 00 
+  801547:	41 ff d1             	call   *%r9
+
+000000000080154a <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  80154a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801550:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801556:	be 00 00 00 00       	mov    $0x0,%esi
+  80155b:	b8 13 00 00 00       	mov    $0x13,%eax
+  801560:	48 89 f2             	mov    %rsi,%rdx
+  801563:	0f 05                	syscall
+	if(check && ret > 0)
+  801565:	48 85 c0             	test   %rax,%rax
+  801568:	7f 01                	jg     80156b <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  80156a:	c3                   	ret
+{
+  80156b:	55                   	push   %rbp
+  80156c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80156f:	49 89 c0             	mov    %rax,%r8
+  801572:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801577:	48 ba 88 26 80 00 00 	movabs $0x802688,%rdx
+  80157e:	00 00 00 
+  801581:	be 28 00 00 00       	mov    $0x28,%esi
+  801586:	48 bf a5 26 80 00 00 	movabs $0x8026a5,%rdi
+  80158d:	00 00 00 
+  801590:	b8 00 00 00 00       	mov    $0x0,%eax
+  801595:	49 b9 34 05 80 00 00 	movabs $0x800534,%r9
+  80159c:	00 00 00 
+  80159f:	41 ff d1             	call   *%r9
+
+00000000008015a2 <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  8015a2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8015a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8015ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015b3:	b8 14 00 00 00       	mov    $0x14,%eax
+  8015b8:	48 89 fe             	mov    %rdi,%rsi
+  8015bb:	48 89 fa             	mov    %rdi,%rdx
+  8015be:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8015c0:	c3                   	ret
+
+00000000008015c1 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  8015c1:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8015c4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8015ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8015d0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8015d5:	0f 05                	syscall
+	if(check && ret > 0)
+  8015d7:	48 85 c0             	test   %rax,%rax
+  8015da:	7f 01                	jg     8015dd <sys_page_unmap_range+0x1c>
+}
+  8015dc:	c3                   	ret
+{
+  8015dd:	55                   	push   %rbp
+  8015de:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015e1:	49 89 c0             	mov    %rax,%r8
+  8015e4:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8015e9:	48 ba 88 26 80 00 00 	movabs $0x802688,%rdx
+  8015f0:	00 00 00 
+  8015f3:	be 28 00 00 00       	mov    $0x28,%esi
+  8015f8:	48 bf a5 26 80 00 00 	movabs $0x8026a5,%rdi
+  8015ff:	00 00 00 
+  801602:	b8 00 00 00 00       	mov    $0x0,%eax
+  801607:	49 b9 34 05 80 00 00 	movabs $0x800534,%r9
+  80160e:	00 00 00 
+  801611:	41 ff d1             	call   *%r9
+
+0000000000801614 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801614:	48 63 f6             	movslq %esi,%rsi
+  801617:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80161a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801620:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801626:	ba 00 00 00 00       	mov    $0x0,%edx
+  80162b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801630:	0f 05                	syscall
+	if(check && ret > 0)
+  801632:	48 85 c0             	test   %rax,%rax
+  801635:	7f 01                	jg     801638 <sys_env_set_status+0x24>
+}
+  801637:	c3                   	ret
+{
+  801638:	55                   	push   %rbp
+  801639:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80163c:	49 89 c0             	mov    %rax,%r8
+  80163f:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801644:	48 ba 88 26 80 00 00 	movabs $0x802688,%rdx
+  80164b:	00 00 00 
+  80164e:	be 28 00 00 00       	mov    $0x28,%esi
+  801653:	48 bf a5 26 80 00 00 	movabs $0x8026a5,%rdi
+  80165a:	00 00 00 
+  80165d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801662:	49 b9 34 05 80 00 00 	movabs $0x800534,%r9
+  801669:	00 00 00 
+  80166c:	41 ff d1             	call   *%r9
+
+000000000080166f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80166f:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801672:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801678:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80167e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801683:	b8 09 00 00 00       	mov    $0x9,%eax
+  801688:	0f 05                	syscall
+	if(check && ret > 0)
+  80168a:	48 85 c0             	test   %rax,%rax
+  80168d:	7f 01                	jg     801690 <sys_env_set_pgfault_upcall+0x21>
+}
+  80168f:	c3                   	ret
+{
+  801690:	55                   	push   %rbp
+  801691:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801694:	49 89 c0             	mov    %rax,%r8
+  801697:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80169c:	48 ba 88 26 80 00 00 	movabs $0x802688,%rdx
+  8016a3:	00 00 00 
+  8016a6:	be 28 00 00 00       	mov    $0x28,%esi
+  8016ab:	48 bf a5 26 80 00 00 	movabs $0x8026a5,%rdi
+  8016b2:	00 00 00 
+  8016b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ba:	49 b9 34 05 80 00 00 	movabs $0x800534,%r9
+  8016c1:	00 00 00 
+  8016c4:	41 ff d1             	call   *%r9
+
+00000000008016c7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8016c7:	48 63 ff             	movslq %edi,%rdi
+  8016ca:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  8016cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8016d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8016d8:	0f 05                	syscall
+}
+  8016da:	c3                   	ret
+
+00000000008016db <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  8016db:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8016e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8016e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ec:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8016f1:	48 89 f2             	mov    %rsi,%rdx
+  8016f4:	0f 05                	syscall
+	if(check && ret > 0)
+  8016f6:	48 85 c0             	test   %rax,%rax
+  8016f9:	7f 01                	jg     8016fc <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  8016fb:	c3                   	ret
+{
+  8016fc:	55                   	push   %rbp
+  8016fd:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801700:	49 89 c0             	mov    %rax,%r8
+  801703:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801708:	48 ba 88 26 80 00 00 	movabs $0x802688,%rdx
+  80170f:	00 00 00 
+  801712:	be 28 00 00 00       	mov    $0x28,%esi
+  801717:	48 bf a5 26 80 00 00 	movabs $0x8026a5,%rdi
+  80171e:	00 00 00 
+  801721:	b8 00 00 00 00       	mov    $0x0,%eax
+  801726:	49 b9 34 05 80 00 00 	movabs $0x800534,%r9
+  80172d:	00 00 00 
+  801730:	41 ff d1             	call   *%r9
+
+0000000000801733 <pgfault>:
+- unmap PFTEMP using sys_page_unmap()
+- panic if any step fails
+*/
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801733:	55                   	push   %rbp
+  801734:	48 89 e5             	mov    %rsp,%rbp
+  801737:	53                   	push   %rbx
+  801738:	48 83 ec 08          	sub    $0x8,%rsp
+	void *addr = (void *) utf->utf_fault_va;
+  80173c:	48 8b 1f             	mov    (%rdi),%rbx
+	uint32_t err = utf->utf_err;
+  80173f:	48 8b 47 08          	mov    0x8(%rdi),%rax
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+
+	if (!(err & FEC_WR)) {
+  801743:	a8 02                	test   $0x2,%al
+  801745:	0f 84 b1 00 00 00    	je     8017fc <pgfault+0xc9>
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+	}
+	pte_t pte = uvpt[PGNUM(addr)];
+  80174b:	48 89 da             	mov    %rbx,%rdx
+  80174e:	48 c1 ea 0c          	shr    $0xc,%rdx
+  801752:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801759:	01 00 00 
+  80175c:	48 8b 0c d0          	mov    (%rax,%rdx,8),%rcx
+	if (!(pte & PTE_COW)) {
+  801760:	f6 c5 08             	test   $0x8,%ch
+  801763:	0f 84 c3 00 00 00    	je     80182c <pgfault+0xf9>
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+
+	void *pg_addr = ROUNDDOWN(addr, PGSIZE);
+  801769:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  801770:	ba 07 00 00 00       	mov    $0x7,%edx
+  801775:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  80177a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80177f:	48 b8 57 13 80 00 00 	movabs $0x801357,%rax
+  801786:	00 00 00 
+  801789:	ff d0                	call   *%rax
+	if (r < 0) {
+  80178b:	85 c0                	test   %eax,%eax
+  80178d:	0f 88 c7 00 00 00    	js     80185a <pgfault+0x127>
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+	}
+	memmove(PFTEMP, pg_addr, PGSIZE);
+  801793:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801798:	48 89 de             	mov    %rbx,%rsi
+  80179b:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  8017a0:	48 b8 de 10 80 00 00 	movabs $0x8010de,%rax
+  8017a7:	00 00 00 
+  8017aa:	ff d0                	call   *%rax
+	r = sys_page_map(0, PFTEMP, 0, pg_addr, PTE_P | PTE_U | PTE_W);
+  8017ac:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8017b2:	48 89 d9             	mov    %rbx,%rcx
+  8017b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ba:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8017bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017c4:	48 b8 03 14 80 00 00 	movabs $0x801403,%rax
+  8017cb:	00 00 00 
+  8017ce:	ff d0                	call   *%rax
+	if (r < 0) {
+  8017d0:	85 c0                	test   %eax,%eax
+  8017d2:	0f 88 af 00 00 00    	js     801887 <pgfault+0x154>
+		panic("pgfault: sys_page_map failed:  %e", r);
+	}
+	r = sys_page_unmap(0, PFTEMP);
+  8017d8:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8017dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017e2:	48 b8 53 14 80 00 00 	movabs $0x801453,%rax
+  8017e9:	00 00 00 
+  8017ec:	ff d0                	call   *%rax
+	if (r < 0) {
+  8017ee:	85 c0                	test   %eax,%eax
+  8017f0:	0f 88 be 00 00 00    	js     8018b4 <pgfault+0x181>
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+	}
+}
+  8017f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017fa:	c9                   	leave
+  8017fb:	c3                   	ret
+  8017fc:	89 c1                	mov    %eax,%ecx
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+  8017fe:	49 89 d8             	mov    %rbx,%r8
+  801801:	48 ba b8 26 80 00 00 	movabs $0x8026b8,%rdx
+  801808:	00 00 00 
+  80180b:	be 32 00 00 00       	mov    $0x32,%esi
+  801810:	48 bf 67 28 80 00 00 	movabs $0x802867,%rdi
+  801817:	00 00 00 
+  80181a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181f:	49 b9 34 05 80 00 00 	movabs $0x800534,%r9
+  801826:	00 00 00 
+  801829:	41 ff d1             	call   *%r9
+		panic("pgfault: page is not marked copy-on-write (pte=%p, va=%p)", pte, addr);
+  80182c:	49 89 d8             	mov    %rbx,%r8
+  80182f:	48 ba e0 26 80 00 00 	movabs $0x8026e0,%rdx
+  801836:	00 00 00 
+  801839:	be 36 00 00 00       	mov    $0x36,%esi
+  80183e:	48 bf 67 28 80 00 00 	movabs $0x802867,%rdi
+  801845:	00 00 00 
+  801848:	b8 00 00 00 00       	mov    $0x0,%eax
+  80184d:	49 b9 34 05 80 00 00 	movabs $0x800534,%r9
+  801854:	00 00 00 
+  801857:	41 ff d1             	call   *%r9
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+  80185a:	89 c1                	mov    %eax,%ecx
+  80185c:	48 ba 20 27 80 00 00 	movabs $0x802720,%rdx
+  801863:	00 00 00 
+  801866:	be 44 00 00 00       	mov    $0x44,%esi
+  80186b:	48 bf 67 28 80 00 00 	movabs $0x802867,%rdi
+  801872:	00 00 00 
+  801875:	b8 00 00 00 00       	mov    $0x0,%eax
+  80187a:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  801881:	00 00 00 
+  801884:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_map failed:  %e", r);
+  801887:	89 c1                	mov    %eax,%ecx
+  801889:	48 ba 48 27 80 00 00 	movabs $0x802748,%rdx
+  801890:	00 00 00 
+  801893:	be 49 00 00 00       	mov    $0x49,%esi
+  801898:	48 bf 67 28 80 00 00 	movabs $0x802867,%rdi
+  80189f:	00 00 00 
+  8018a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a7:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  8018ae:	00 00 00 
+  8018b1:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+  8018b4:	89 c1                	mov    %eax,%ecx
+  8018b6:	48 ba 70 27 80 00 00 	movabs $0x802770,%rdx
+  8018bd:	00 00 00 
+  8018c0:	be 4d 00 00 00       	mov    $0x4d,%esi
+  8018c5:	48 bf 67 28 80 00 00 	movabs $0x802867,%rdi
+  8018cc:	00 00 00 
+  8018cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d4:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  8018db:	00 00 00 
+  8018de:	41 ff d0             	call   *%r8
+
+00000000008018e1 <dupflush>:
+static struct PageOp dup_child[DUP_BATCH], dup_self[DUP_BATCH];
+static int ndup_child, ndup_self;
+
+static int
+dupflush(envid_t envid)
+{
+  8018e1:	55                   	push   %rbp
+  8018e2:	48 89 e5             	mov    %rsp,%rbp
+  8018e5:	89 fe                	mov    %edi,%esi
+	int r;
+
+	// Map to child first, then remap parent
+	r = sys_page_batch(0, envid, dup_child, ndup_child);
+  8018e7:	a1 24 30 80 00 00 00 	movabs 0x803024,%eax
+  8018ee:	00 00 
+  8018f0:	48 63 c8             	movslq %eax,%rcx
+  8018f3:	48 ba 40 36 80 00 00 	movabs $0x803640,%rdx
+  8018fa:	00 00 00 
+  8018fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801902:	48 b8 f7 14 80 00 00 	movabs $0x8014f7,%rax
+  801909:	00 00 00 
+  80190c:	ff d0                	call   *%rax
+	if (r < 0) {
+  80190e:	85 c0                	test   %eax,%eax
+  801910:	78 57                	js     801969 <dupflush+0x88>
+		panic("duppage: child map failed: %e", r);
+		return r;
+	}
+	r = sys_page_batch(0, 0, dup_self, ndup_self);
+  801912:	a1 20 30 80 00 00 00 	movabs 0x803020,%eax
+  801919:	00 00 
+  80191b:	48 63 c8             	movslq %eax,%rcx
+  80191e:	48 ba 40 30 80 00 00 	movabs $0x803040,%rdx
+  801925:	00 00 00 
+  801928:	be 00 00 00 00       	mov    $0x0,%esi
+  80192d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801932:	48 b8 f7 14 80 00 00 	movabs $0x8014f7,%rax
+  801939:	00 00 00 
+  80193c:	ff d0                	call   *%rax
+	if (r < 0) {
+  80193e:	85 c0                	test   %eax,%eax
+  801940:	78 54                	js     801996 <dupflush+0xb5>
+		panic("duppage: parent remap failed: %e", r);
+		return r;
+	}
+	ndup_child = ndup_self = 0;
+  801942:	48 b8 20 30 80 00 00 	movabs $0x803020,%rax
+  801949:	00 00 00 
+  80194c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  801952:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  801959:	00 00 00 
+  80195c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	return 0;
+}
+  801962:	b8 00 00 00 00       	mov    $0x0,%eax
+  801967:	5d                   	pop    %rbp
+  801968:	c3                   	ret
+		panic("duppage: child map failed: %e", r);
+  801969:	89 c1                	mov    %eax,%ecx
+  80196b:	48 ba 72 28 80 00 00 	movabs $0x802872,%rdx
+  801972:	00 00 00 
+  801975:	be 77 00 00 00       	mov    $0x77,%esi
+  80197a:	48 bf 67 28 80 00 00 	movabs $0x802867,%rdi
+  801981:	00 00 00 
+  801984:	b8 00 00 00 00       	mov    $0x0,%eax
+  801989:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  801990:	00 00 00 
+  801993:	41 ff d0             	call   *%r8
+		panic("duppage: parent remap failed: %e", r);
+  801996:	89 c1                	mov    %eax,%ecx
+  801998:	48 ba 98 27 80 00 00 	movabs $0x802798,%rdx
+  80199f:	00 00 00 
+  8019a2:	be 7c 00 00 00       	mov    $0x7c,%esi
+  8019a7:	48 bf 67 28 80 00 00 	movabs $0x802867,%rdi
+  8019ae:	00 00 00 
+  8019b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b6:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  8019bd:	00 00 00 
+  8019c0:	41 ff d0             	call   *%r8
+
+00000000008019c3 <thread_start>:
+	return envid;
+}
+
+static void
+thread_start(void (*fn)(void *), void *arg)
+{
+  8019c3:	55                   	push   %rbp
+  8019c4:	48 89 e5             	mov    %rsp,%rbp
+  8019c7:	48 89 f8             	mov    %rdi,%rax
+  8019ca:	48 89 f7             	mov    %rsi,%rdi
+	fn(arg);
+  8019cd:	ff d0                	call   *%rax
+	exit();
+  8019cf:	48 b8 1d 05 80 00 00 	movabs $0x80051d,%rax
+  8019d6:	00 00 00 
+  8019d9:	ff d0                	call   *%rax
+}
+  8019db:	5d                   	pop    %rbp
+  8019dc:	c3                   	ret
+
+00000000008019dd <fork>:
+{
+  8019dd:	55                   	push   %rbp
+  8019de:	48 89 e5             	mov    %rsp,%rbp
+	set_pgfault_handler(pgfault);
+  8019e1:	48 bf 33 17 80 00 00 	movabs $0x801733,%rdi
+  8019e8:	00 00 00 
+  8019eb:	48 b8 10 1f 80 00 00 	movabs $0x801f10,%rax
+  8019f2:	00 00 00 
+  8019f5:	ff d0                	call   *%rax
+	return sys_fork();
+  8019f7:	48 b8 ab 14 80 00 00 	movabs $0x8014ab,%rax
+  8019fe:	00 00 00 
+  801a01:	ff d0                	call   *%rax
+}
+  801a03:	5d                   	pop    %rbp
+  801a04:	c3                   	ret
+
+0000000000801a05 <ufork>:
+{
+  801a05:	55                   	push   %rbp
+  801a06:	48 89 e5             	mov    %rsp,%rbp
+  801a09:	41 57                	push   %r15
+  801a0b:	41 56                	push   %r14
+  801a0d:	41 55                	push   %r13
+  801a0f:	41 54                	push   %r12
+  801a11:	53                   	push   %rbx
+  801a12:	48 83 ec 38          	sub    $0x38,%rsp
+	set_pgfault_handler(pgfault);
+  801a16:	48 bf 33 17 80 00 00 	movabs $0x801733,%rdi
+  801a1d:	00 00 00 
+  801a20:	48 b8 10 1f 80 00 00 	movabs $0x801f10,%rax
+  801a27:	00 00 00 
+  801a2a:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801a2c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a31:	cd 30                	int    $0x30
+  801a33:	89 45 cc             	mov    %eax,-0x34(%rbp)
+	if (envid < 0) {
+  801a36:	85 c0                	test   %eax,%eax
+  801a38:	78 21                	js     801a5b <ufork+0x56>
+	if (envid == 0) {
+  801a3a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a3e:	0f 84 e4 03 00 00    	je     801e28 <ufork+0x423>
+  801a44:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801a4b:	00 
+	op->po_op = PAGEOP_MAP;
+  801a4c:	49 bf 40 36 80 00 00 	movabs $0x803640,%r15
+  801a53:	00 00 00 
+  801a56:	e9 e7 02 00 00       	jmp    801d42 <ufork+0x33d>
+		panic("sys_exofork failed: %e", envid);
+  801a5b:	89 c1                	mov    %eax,%ecx
+  801a5d:	48 ba 90 28 80 00 00 	movabs $0x802890,%rdx
+  801a64:	00 00 00 
+  801a67:	be e4 00 00 00       	mov    $0xe4,%esi
+  801a6c:	48 bf 67 28 80 00 00 	movabs $0x802867,%rdi
+  801a73:	00 00 00 
+  801a76:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a7b:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  801a82:	00 00 00 
+  801a85:	41 ff d0             	call   *%r8
+  801a88:	44 89 e8             	mov    %r13d,%eax
+  801a8b:	c1 e0 09             	shl    $0x9,%eax
+  801a8e:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  801a91:	44 89 e8             	mov    %r13d,%eax
+  801a94:	c1 e0 12             	shl    $0x12,%eax
+  801a97:	89 45 ac             	mov    %eax,-0x54(%rbp)
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  801a9a:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801aa1:	00 
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  801aa2:	44 89 6d a8          	mov    %r13d,-0x58(%rbp)
+				int pdeIndex = pdpeIndex * NPTENTRIES + k;
+  801aa6:	8b 75 c8             	mov    -0x38(%rbp),%esi
+				if (!(uvpd[pdeIndex] & PTE_P)) {
+  801aa9:	48 63 c6             	movslq %esi,%rax
+  801aac:	48 bf 00 00 00 80 00 	movabs $0x10080000000,%rdi
+  801ab3:	01 00 00 
+  801ab6:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  801aba:	a8 01                	test   $0x1,%al
+  801abc:	0f 84 52 02 00 00    	je     801d14 <ufork+0x30f>
+				if (uvpd[pdeIndex] & PTE_PS) {
+  801ac2:	48 63 c6             	movslq %esi,%rax
+  801ac5:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  801ac9:	a8 80                	test   $0x80,%al
+  801acb:	74 52                	je     801b1f <ufork+0x11a>
+					void *va = PGADDR(i, j, k, 0, 0);
+  801acd:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  801ad1:	48 c1 e3 27          	shl    $0x27,%rbx
+  801ad5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801ad9:	48 09 c3             	or     %rax,%rbx
+  801adc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801ae0:	48 09 c3             	or     %rax,%rbx
+					if ((uintptr_t)va >= UTOP) {
+  801ae3:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  801ae8:	48 39 d8             	cmp    %rbx,%rax
+  801aeb:	0f 82 ca 02 00 00    	jb     801dbb <ufork+0x3b6>
+					r = sys_page_map(0, va, 0, va, uvpd[pdeIndex] & PTE_SYSCALL);
+  801af1:	48 63 d6             	movslq %esi,%rdx
+  801af4:	4c 8b 04 d7          	mov    (%rdi,%rdx,8),%r8
+  801af8:	41 81 e0 07 0e 00 00 	and    $0xe07,%r8d
+  801aff:	48 89 d9             	mov    %rbx,%rcx
+  801b02:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b07:	48 89 de             	mov    %rbx,%rsi
+  801b0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b0f:	48 b8 03 14 80 00 00 	movabs $0x801403,%rax
+  801b16:	00 00 00 
+  801b19:	ff d0                	call   *%rax
+					if (r < 0) {
+  801b1b:	85 c0                	test   %eax,%eax
+  801b1d:	78 18                	js     801b37 <ufork+0x132>
+  801b1f:	4c 63 65 ac          	movslq -0x54(%rbp),%r12
+  801b23:	4c 89 e3             	mov    %r12,%rbx
+  801b26:	48 c1 e3 0c          	shl    $0xc,%rbx
+  801b2a:	4d 8d ac 24 00 02 00 	lea    0x200(%r12),%r13
+  801b31:	00 
+  801b32:	e9 00 01 00 00       	jmp    801c37 <ufork+0x232>
+						panic("splitting 2MB page at %p failed: %e", va, r);
+  801b37:	41 89 c0             	mov    %eax,%r8d
+  801b3a:	48 89 d9             	mov    %rbx,%rcx
+  801b3d:	48 ba c0 27 80 00 00 	movabs $0x8027c0,%rdx
+  801b44:	00 00 00 
+  801b47:	be 0a 01 00 00       	mov    $0x10a,%esi
+  801b4c:	48 bf 67 28 80 00 00 	movabs $0x802867,%rdi
+  801b53:	00 00 00 
+  801b56:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5b:	49 b9 34 05 80 00 00 	movabs $0x800534,%r9
+  801b62:	00 00 00 
+  801b65:	41 ff d1             	call   *%r9
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  801b68:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  801b6f:	00 00 00 
+  801b72:	8b 0f                	mov    (%rdi),%ecx
+  801b74:	8d 71 01             	lea    0x1(%rcx),%esi
+  801b77:	89 37                	mov    %esi,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  801b79:	48 63 c9             	movslq %ecx,%rcx
+  801b7c:	48 8d 34 09          	lea    (%rcx,%rcx,1),%rsi
+  801b80:	48 8d 3c 0e          	lea    (%rsi,%rcx,1),%rdi
+  801b84:	41 c7 04 ff 01 00 00 	movl   $0x1,(%r15,%rdi,8)
+  801b8b:	00 
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  801b8c:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  801b92:	41 89 54 ff 04       	mov    %edx,0x4(%r15,%rdi,8)
+	op->po_srcva = op->po_dstva = va;
+  801b97:	49 89 44 ff 10       	mov    %rax,0x10(%r15,%rdi,8)
+  801b9c:	49 89 44 ff 08       	mov    %rax,0x8(%r15,%rdi,8)
+}
+  801ba1:	eb 76                	jmp    801c19 <ufork+0x214>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U | PTE_COW);
+  801ba3:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  801baa:	00 00 00 
+  801bad:	8b 17                	mov    (%rdi),%edx
+  801baf:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  801bb2:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  801bb4:	48 63 d2             	movslq %edx,%rdx
+  801bb7:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  801bbb:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  801bbf:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  801bc6:	00 
+	op->po_perm = perm;
+  801bc7:	41 c7 44 f7 04 05 08 	movl   $0x805,0x4(%r15,%rsi,8)
+  801bce:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  801bd0:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  801bd5:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+		dupqueue(&dup_self[ndup_self++], va, PTE_P | PTE_U | PTE_COW);
+  801bda:	48 b9 20 30 80 00 00 	movabs $0x803020,%rcx
+  801be1:	00 00 00 
+  801be4:	8b 11                	mov    (%rcx),%edx
+  801be6:	8d 72 01             	lea    0x1(%rdx),%esi
+  801be9:	89 31                	mov    %esi,(%rcx)
+	op->po_op = PAGEOP_MAP;
+  801beb:	48 be 40 30 80 00 00 	movabs $0x803040,%rsi
+  801bf2:	00 00 00 
+  801bf5:	48 63 d2             	movslq %edx,%rdx
+  801bf8:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  801bfc:	48 8d 3c 11          	lea    (%rcx,%rdx,1),%rdi
+  801c00:	c7 04 fe 01 00 00 00 	movl   $0x1,(%rsi,%rdi,8)
+	op->po_perm = perm;
+  801c07:	c7 44 fe 04 05 08 00 	movl   $0x805,0x4(%rsi,%rdi,8)
+  801c0e:	00 
+	op->po_srcva = op->po_dstva = va;
+  801c0f:	48 89 44 fe 10       	mov    %rax,0x10(%rsi,%rdi,8)
+  801c14:	48 89 44 fe 08       	mov    %rax,0x8(%rsi,%rdi,8)
+	if (ndup_child == DUP_BATCH) {
+  801c19:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  801c20:	00 00 00 
+  801c23:	83 38 40             	cmpl   $0x40,(%rax)
+  801c26:	0f 84 a4 00 00 00    	je     801cd0 <ufork+0x2cb>
+				for (int l = 0; l < NPTENTRIES; l++) {
+  801c2c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801c33:	49 83 c4 01          	add    $0x1,%r12
+  801c37:	4d 39 ec             	cmp    %r13,%r12
+  801c3a:	0f 84 d4 00 00 00    	je     801d14 <ufork+0x30f>
+					if (va >= UTOP) {
+  801c40:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  801c45:	48 39 d8             	cmp    %rbx,%rax
+  801c48:	0f 82 6d 01 00 00    	jb     801dbb <ufork+0x3b6>
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  801c4e:	48 b8 00 10 80 43 ff 	movabs $0xffffffff43801000,%rax
+  801c55:	ff ff ff 
+  801c58:	48 01 d8             	add    %rbx,%rax
+  801c5b:	48 3d ff 0f 00 00    	cmp    $0xfff,%rax
+  801c61:	76 c9                	jbe    801c2c <ufork+0x227>
+					if (!(uvpt[pn] & PTE_P)) {
+  801c63:	4b 8b 04 e6          	mov    (%r14,%r12,8),%rax
+  801c67:	a8 01                	test   $0x1,%al
+  801c69:	74 c1                	je     801c2c <ufork+0x227>
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  801c6b:	48 b8 00 f0 ff ff ff 	movabs $0xffffffff000,%rax
+  801c72:	0f 00 00 
+  801c75:	48 21 d8             	and    %rbx,%rax
+	pte_t pte = uvpt[pn];
+  801c78:	44 89 e2             	mov    %r12d,%edx
+  801c7b:	49 8b 14 d6          	mov    (%r14,%rdx,8),%rdx
+	if (pte & PTE_SHARE) {
+  801c7f:	f6 c6 04             	test   $0x4,%dh
+  801c82:	0f 85 e0 fe ff ff    	jne    801b68 <ufork+0x163>
+	} else if ((pte & PTE_W) || (pte & PTE_COW)) {
+  801c88:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  801c8e:	0f 85 0f ff ff ff    	jne    801ba3 <ufork+0x19e>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U);
+  801c94:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  801c9b:	00 00 00 
+  801c9e:	8b 17                	mov    (%rdi),%edx
+  801ca0:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  801ca3:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  801ca5:	48 63 d2             	movslq %edx,%rdx
+  801ca8:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  801cac:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  801cb0:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  801cb7:	00 
+	op->po_perm = perm;
+  801cb8:	41 c7 44 f7 04 05 00 	movl   $0x5,0x4(%r15,%rsi,8)
+  801cbf:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  801cc1:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  801cc6:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+}
+  801ccb:	e9 49 ff ff ff       	jmp    801c19 <ufork+0x214>
+		return dupflush(envid);
+  801cd0:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801cd3:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  801cda:	00 00 00 
+  801cdd:	ff d0                	call   *%rax
+					if (r < 0) {
+  801cdf:	85 c0                	test   %eax,%eax
+  801ce1:	0f 89 45 ff ff ff    	jns    801c2c <ufork+0x227>
+						panic("duppage failed:  %e", r);
+  801ce7:	89 c1                	mov    %eax,%ecx
+  801ce9:	48 ba a7 28 80 00 00 	movabs $0x8028a7,%rdx
+  801cf0:	00 00 00 
+  801cf3:	be 20 01 00 00       	mov    $0x120,%esi
+  801cf8:	48 bf 67 28 80 00 00 	movabs $0x802867,%rdi
+  801cff:	00 00 00 
+  801d02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d07:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  801d0e:	00 00 00 
+  801d11:	41 ff d0             	call   *%r8
+			for (int k = 0; k < NPTENTRIES; k++) {
+  801d14:	81 45 ac 00 02 00 00 	addl   $0x200,-0x54(%rbp)
+  801d1b:	83 45 c8 01          	addl   $0x1,-0x38(%rbp)
+  801d1f:	48 81 45 b0 00 00 20 	addq   $0x200000,-0x50(%rbp)
+  801d26:	00 
+  801d27:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801d2b:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  801d31:	0f 85 6f fd ff ff    	jne    801aa6 <ufork+0xa1>
+  801d37:	44 8b 6d a8          	mov    -0x58(%rbp),%r13d
+  801d3b:	eb 5d                	jmp    801d9a <ufork+0x395>
+	for (int i = 0; i < NPTENTRIES; i++) {
+  801d3d:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  801d42:	48 81 7d c0 00 02 00 	cmpq   $0x200,-0x40(%rbp)
+  801d49:	00 
+  801d4a:	74 6f                	je     801dbb <ufork+0x3b6>
+		if (!(uvpml4e[i] & PTE_P)) {
+  801d4c:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  801d50:	48 63 c3             	movslq %ebx,%rax
+  801d53:	48 be 00 20 40 80 00 	movabs $0x10080402000,%rsi
+  801d5a:	01 00 00 
+  801d5d:	48 8b 04 c6          	mov    (%rsi,%rax,8),%rax
+  801d61:	a8 01                	test   $0x1,%al
+  801d63:	74 d8                	je     801d3d <ufork+0x338>
+  801d65:	41 89 dc             	mov    %ebx,%r12d
+  801d68:	41 c1 e4 09          	shl    $0x9,%r12d
+  801d6c:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801d73:	00 
+					if (!(uvpt[pn] & PTE_P)) {
+  801d74:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  801d7b:	01 00 00 
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  801d7e:	45 89 e5             	mov    %r12d,%r13d
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  801d81:	49 63 c5             	movslq %r13d,%rax
+  801d84:	48 bb 00 00 40 80 00 	movabs $0x10080400000,%rbx
+  801d8b:	01 00 00 
+  801d8e:	48 8b 04 c3          	mov    (%rbx,%rax,8),%rax
+  801d92:	a8 01                	test   $0x1,%al
+  801d94:	0f 85 ee fc ff ff    	jne    801a88 <ufork+0x83>
+		for (int j = 0; j < NPTENTRIES; j++) {
+  801d9a:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  801da1:	40 
+  801da2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801da6:	41 83 c5 01          	add    $0x1,%r13d
+  801daa:	48 b9 00 00 00 00 80 	movabs $0x8000000000,%rcx
+  801db1:	00 00 00 
+  801db4:	48 39 c8             	cmp    %rcx,%rax
+  801db7:	75 c8                	jne    801d81 <ufork+0x37c>
+  801db9:	eb 82                	jmp    801d3d <ufork+0x338>
+	r = dupflush(envid);
+  801dbb:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801dbe:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  801dc5:	00 00 00 
+  801dc8:	ff d0                	call   *%rax
+	if (r < 0) {
+  801dca:	85 c0                	test   %eax,%eax
+  801dcc:	78 6c                	js     801e3a <ufork+0x435>
+	r = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801dce:	ba 07 00 00 00       	mov    $0x7,%edx
+  801dd3:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801dd8:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801ddb:	48 b8 57 13 80 00 00 	movabs $0x801357,%rax
+  801de2:	00 00 00 
+  801de5:	ff d0                	call   *%rax
+	if (r < 0) {
+  801de7:	85 c0                	test   %eax,%eax
+  801de9:	78 7c                	js     801e67 <ufork+0x462>
+	r = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  801deb:	48 be d7 1f 80 00 00 	movabs $0x801fd7,%rsi
+  801df2:	00 00 00 
+  801df5:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801df8:	48 b8 6f 16 80 00 00 	movabs $0x80166f,%rax
+  801dff:	00 00 00 
+  801e02:	ff d0                	call   *%rax
+	if (r < 0) {
+  801e04:	85 c0                	test   %eax,%eax
+  801e06:	0f 88 88 00 00 00    	js     801e94 <ufork+0x48f>
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  801e0c:	be 02 00 00 00       	mov    $0x2,%esi
+  801e11:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801e14:	48 b8 14 16 80 00 00 	movabs $0x801614,%rax
+  801e1b:	00 00 00 
+  801e1e:	ff d0                	call   *%rax
+	if (r < 0) {
+  801e20:	85 c0                	test   %eax,%eax
+  801e22:	0f 88 99 00 00 00    	js     801ec1 <ufork+0x4bc>
+}
+  801e28:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801e2b:	48 83 c4 38          	add    $0x38,%rsp
+  801e2f:	5b                   	pop    %rbx
+  801e30:	41 5c                	pop    %r12
+  801e32:	41 5d                	pop    %r13
+  801e34:	41 5e                	pop    %r14
+  801e36:	41 5f                	pop    %r15
+  801e38:	5d                   	pop    %rbp
+  801e39:	c3                   	ret
+		panic("duppage failed:  %e", r);
+  801e3a:	89 c1                	mov    %eax,%ecx
+  801e3c:	48 ba a7 28 80 00 00 	movabs $0x8028a7,%rdx
+  801e43:	00 00 00 
+  801e46:	be 29 01 00 00       	mov    $0x129,%esi
+  801e4b:	48 bf 67 28 80 00 00 	movabs $0x802867,%rdi
+  801e52:	00 00 00 
+  801e55:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e5a:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  801e61:	00 00 00 
+  801e64:	41 ff d0             	call   *%r8
+		panic("sys_page_alloc for child exception stack failed: %e", r);
+  801e67:	89 c1                	mov    %eax,%ecx
+  801e69:	48 ba e8 27 80 00 00 	movabs $0x8027e8,%rdx
+  801e70:	00 00 00 
+  801e73:	be 2e 01 00 00       	mov    $0x12e,%esi
+  801e78:	48 bf 67 28 80 00 00 	movabs $0x802867,%rdi
+  801e7f:	00 00 00 
+  801e82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e87:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  801e8e:	00 00 00 
+  801e91:	41 ff d0             	call   *%r8
+		panic("sys_env_set_pgfault_upcall failed:  %e", r);
+  801e94:	89 c1                	mov    %eax,%ecx
+  801e96:	48 ba 20 28 80 00 00 	movabs $0x802820,%rdx
+  801e9d:	00 00 00 
+  801ea0:	be 33 01 00 00       	mov    $0x133,%esi
+  801ea5:	48 bf 67 28 80 00 00 	movabs $0x802867,%rdi
+  801eac:	00 00 00 
+  801eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb4:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  801ebb:	00 00 00 
+  801ebe:	41 ff d0             	call   *%r8
+		panic("sys_env_set_status failed:  %e", r);
+  801ec1:	89 c1                	mov    %eax,%ecx
+  801ec3:	48 ba 48 28 80 00 00 	movabs $0x802848,%rdx
+  801eca:	00 00 00 
+  801ecd:	be 38 01 00 00       	mov    $0x138,%esi
+  801ed2:	48 bf 67 28 80 00 00 	movabs $0x802867,%rdi
+  801ed9:	00 00 00 
+  801edc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee1:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  801ee8:	00 00 00 
+  801eeb:	41 ff d0             	call   *%r8
+
+0000000000801eee <sfork>:
+// on one stack, since nothing is private to the child.
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801eee:	55                   	push   %rbp
+  801eef:	48 89 e5             	mov    %rsp,%rbp
+  801ef2:	48 89 f2             	mov    %rsi,%rdx
+	return sys_thread_create(thread_start, (uint64_t) fn, (uint64_t) arg);
+  801ef5:	48 89 fe             	mov    %rdi,%rsi
+  801ef8:	48 bf c3 19 80 00 00 	movabs $0x8019c3,%rdi
+  801eff:	00 00 00 
+  801f02:	48 b8 e3 14 80 00 00 	movabs $0x8014e3,%rax
+  801f09:	00 00 00 
+  801f0c:	ff d0                	call   *%rax
+}
+  801f0e:	5d                   	pop    %rbp
+  801f0f:	c3                   	ret
+
+0000000000801f10 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801f10:	55                   	push   %rbp
+  801f11:	48 89 e5             	mov    %rsp,%rbp
+  801f14:	53                   	push   %rbx
+  801f15:	48 83 ec 08          	sub    $0x8,%rsp
+  801f19:	48 89 fb             	mov    %rdi,%rbx
+	int r;
+
+	if (_pgfault_handler == 0) {
+  801f1c:	48 ba 40 3c 80 00 00 	movabs $0x803c40,%rdx
+  801f23:	00 00 00 
+  801f26:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801f2a:	74 13                	je     801f3f <set_pgfault_handler+0x2f>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801f2c:	48 89 d8             	mov    %rbx,%rax
+  801f2f:	48 a3 40 3c 80 00 00 	movabs %rax,0x803c40
+  801f36:	00 00 00 
+}
+  801f39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f3d:	c9                   	leave
+  801f3e:	c3                   	ret
+		r = sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801f3f:	ba 07 00 00 00       	mov    $0x7,%edx
+  801f44:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801f49:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f4e:	48 b8 57 13 80 00 00 	movabs $0x801357,%rax
+  801f55:	00 00 00 
+  801f58:	ff d0                	call   *%rax
+		if (r < 0) {
+  801f5a:	85 c0                	test   %eax,%eax
+  801f5c:	78 4c                	js     801faa <set_pgfault_handler+0x9a>
+		r = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801f5e:	48 be d7 1f 80 00 00 	movabs $0x801fd7,%rsi
+  801f65:	00 00 00 
+  801f68:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f6d:	48 b8 6f 16 80 00 00 	movabs $0x80166f,%rax
+  801f74:	00 00 00 
+  801f77:	ff d0                	call   *%rax
+		if (r < 0) {
+  801f79:	85 c0                	test   %eax,%eax
+  801f7b:	79 af                	jns    801f2c <set_pgfault_handler+0x1c>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+  801f7d:	89 c1                	mov    %eax,%ecx
+  801f7f:	48 ba e8 28 80 00 00 	movabs $0x8028e8,%rdx
+  801f86:	00 00 00 
+  801f89:	be 2c 00 00 00       	mov    $0x2c,%esi
+  801f8e:	48 bf d6 28 80 00 00 	movabs $0x8028d6,%rdi
+  801f95:	00 00 00 
+  801f98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9d:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  801fa4:	00 00 00 
+  801fa7:	41 ff d0             	call   *%r8
+			panic("sys_page_alloc failed:  %e", r);
+  801faa:	89 c1                	mov    %eax,%ecx
+  801fac:	48 ba bb 28 80 00 00 	movabs $0x8028bb,%rdx
+  801fb3:	00 00 00 
+  801fb6:	be 28 00 00 00       	mov    $0x28,%esi
+  801fbb:	48 bf d6 28 80 00 00 	movabs $0x8028d6,%rdi
+  801fc2:	00 00 00 
+  801fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fca:	49 b8 34 05 80 00 00 	movabs $0x800534,%r8
+  801fd1:	00 00 00 
+  801fd4:	41 ff d0             	call   *%r8
+
+0000000000801fd7 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi		// function argument: pointer to UTF
+  801fd7:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  801fda:	48 a1 40 3c 80 00 00 	movabs 0x803c40,%rax
+  801fe1:	00 00 00 
+	call *%rax
+  801fe4:	ff d0                	call   *%rax
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here. (Hint. You need to modify the trap time rsp to make room for the return rip ) */
+
+	movq  152(%rsp), %rax
+  801fe6:	48 8b 84 24 98 00 00 	mov    0x98(%rsp),%rax
+  801fed:	00 
+	subq $8, %rax
+  801fee:	48 83 e8 08          	sub    $0x8,%rax
+	movq %rax, 152(%rsp)
+  801ff2:	48 89 84 24 98 00 00 	mov    %rax,0x98(%rsp)
+  801ff9:	00 
+
+	movq 136(%rsp), %rbx
+  801ffa:	48 8b 9c 24 88 00 00 	mov    0x88(%rsp),%rbx
+  802001:	00 
+	movq %rbx, (%rax)
+  802002:	48 89 18             	mov    %rbx,(%rax)
+
+	/* Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here. (Hint, the oposite of _alltraps) */
+
+	addq $16, %rsp
+  802005:	48 83 c4 10          	add    $0x10,%rsp
+	
+	popq %r15
+  802009:	41 5f                	pop    %r15
+	popq %r14
+  80200b:	41 5e                	pop    %r14
+	popq %r13
+  80200d:	41 5d                	pop    %r13
+	popq %r12
+  80200f:	41 5c                	pop    %r12
+	popq %r11
+  802011:	41 5b                	pop    %r11
+	popq %r10
+  802013:	41 5a                	pop    %r10
+	popq %r9
+  802015:	41 59                	pop    %r9
+	popq %r8
+  802017:	41 58                	pop    %r8
+	popq %rsi
+  802019:	5e                   	pop    %rsi
+	popq %rdi
+  80201a:	5f                   	pop    %rdi
+	popq %rbp
+  80201b:	5d                   	pop    %rbp
+	popq %rdx
+  80201c:	5a                   	pop    %rdx
+	popq %rcx
+  80201d:	59                   	pop    %rcx
+	popq %rbx
+  80201e:	5b                   	pop    %rbx
+	popq %rax
+  80201f:	58                   	pop    %rax
+
+	addq $8, %rsp
+  802020:	48 83 c4 08          	add    $0x8,%rsp
+	/* Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 4: Your code here. */
+
+	popfq
+  802024:	9d                   	popf
+
+	/* Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here. */
+
+	popq %rsp
+  802025:	5c                   	pop    %rsp
+
+	/* Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here. */
+  802026:	c3                   	ret
@@ -0,0 +1,2259 @@
+
+obj/user/idle:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 2d 00 00 00       	call   80005e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+#include <inc/x86.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	53                   	push   %rbx
+  800038:	48 83 ec 08          	sub    $0x8,%rsp
+	binaryname = "idle";
+  80003c:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  800043:	00 00 00 
+  800046:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  80004d:	00 00 00 
+	// Instead of busy-waiting like this,
+	// a better way would be to use the processor's HLT instruction
+	// to cause the processor to stop executing until the next interrupt -
+	// doing so allows the processor to conserve power more effectively.
+	while (1) {
+		sys_yield();
+  800050:	48 bb 64 01 80 00 00 	movabs $0x800164,%rbx
+  800057:	00 00 00 
+  80005a:	ff d3                	call   *%rbx
+	while (1) {
+  80005c:	eb fc                	jmp    80005a <umain+0x27>
+
+000000000080005e <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  80005e:	55                   	push   %rbp
+  80005f:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800062:	85 ff                	test   %edi,%edi
+  800064:	7e 0d                	jle    800073 <libmain+0x15>
+		binaryname = argv[0];
+  800066:	48 8b 06             	mov    (%rsi),%rax
+  800069:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  800070:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  800073:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  80007a:	00 00 00 
+  80007d:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  80007f:	48 b8 8d 00 80 00 00 	movabs $0x80008d,%rax
+  800086:	00 00 00 
+  800089:	ff d0                	call   *%rax
+}
+  80008b:	5d                   	pop    %rbp
+  80008c:	c3                   	ret
+
+000000000080008d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80008d:	55                   	push   %rbp
+  80008e:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  800091:	bf 00 00 00 00       	mov    $0x0,%edi
+  800096:	48 b8 dc 00 80 00 00 	movabs $0x8000dc,%rax
+  80009d:	00 00 00 
+  8000a0:	ff d0                	call   *%rax
+}
+  8000a2:	5d                   	pop    %rbp
+  8000a3:	c3                   	ret
+
+00000000008000a4 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  8000a4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  8000b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ba:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  8000bc:	c3                   	ret
+
+00000000008000bd <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  8000bd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8000c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000d3:	48 89 fe             	mov    %rdi,%rsi
+  8000d6:	48 89 fa             	mov    %rdi,%rdx
+  8000d9:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000db:	c3                   	ret
+
+00000000008000dc <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8000dc:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8000df:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8000eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8000f0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000f5:	48 89 f2             	mov    %rsi,%rdx
+  8000f8:	0f 05                	syscall
+	if(check && ret > 0)
+  8000fa:	48 85 c0             	test   %rax,%rax
+  8000fd:	7f 01                	jg     800100 <sys_env_destroy+0x24>
+}
+  8000ff:	c3                   	ret
+{
+  800100:	55                   	push   %rbp
+  800101:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800104:	49 89 c0             	mov    %rax,%r8
+  800107:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80010c:	48 ba cf 12 80 00 00 	movabs $0x8012cf,%rdx
+  800113:	00 00 00 
+  800116:	be 28 00 00 00       	mov    $0x28,%esi
+  80011b:	48 bf ec 12 80 00 00 	movabs $0x8012ec,%rdi
+  800122:	00 00 00 
+  800125:	b8 00 00 00 00       	mov    $0x0,%eax
+  80012a:	49 b9 5f 05 80 00 00 	movabs $0x80055f,%r9
+  800131:	00 00 00 
+  800134:	41 ff d1             	call   *%r9
+
+0000000000800137 <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800137:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  80013e:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  80013f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800144:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800148:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80014c:	48 c1 e2 04          	shl    $0x4,%rdx
+  800150:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800157:	00 00 00 
+  80015a:	48 01 d0             	add    %rdx,%rax
+  80015d:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800163:	c3                   	ret
+
+0000000000800164 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800164:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80016a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800170:	bf 00 00 00 00       	mov    $0x0,%edi
+  800175:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80017a:	48 89 fe             	mov    %rdi,%rsi
+  80017d:	48 89 fa             	mov    %rdi,%rdx
+  800180:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800182:	c3                   	ret
+
+0000000000800183 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  800183:	48 63 d2             	movslq %edx,%rdx
+  800186:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800189:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80018f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800195:	b8 04 00 00 00       	mov    $0x4,%eax
+  80019a:	0f 05                	syscall
+	if(check && ret > 0)
+  80019c:	48 85 c0             	test   %rax,%rax
+  80019f:	7f 01                	jg     8001a2 <sys_page_alloc+0x1f>
+}
+  8001a1:	c3                   	ret
+{
+  8001a2:	55                   	push   %rbp
+  8001a3:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001a6:	49 89 c0             	mov    %rax,%r8
+  8001a9:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8001ae:	48 ba cf 12 80 00 00 	movabs $0x8012cf,%rdx
+  8001b5:	00 00 00 
+  8001b8:	be 28 00 00 00       	mov    $0x28,%esi
+  8001bd:	48 bf ec 12 80 00 00 	movabs $0x8012ec,%rdi
+  8001c4:	00 00 00 
+  8001c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001cc:	49 b9 5f 05 80 00 00 	movabs $0x80055f,%r9
+  8001d3:	00 00 00 
+  8001d6:	41 ff d1             	call   *%r9
+
+00000000008001d9 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8001d9:	48 63 d2             	movslq %edx,%rdx
+  8001dc:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8001df:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8001e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8001eb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8001f0:	0f 05                	syscall
+	if(check && ret > 0)
+  8001f2:	48 85 c0             	test   %rax,%rax
+  8001f5:	7f 01                	jg     8001f8 <sys_page_alloc_huge+0x1f>
+}
+  8001f7:	c3                   	ret
+{
+  8001f8:	55                   	push   %rbp
+  8001f9:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001fc:	49 89 c0             	mov    %rax,%r8
+  8001ff:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800204:	48 ba cf 12 80 00 00 	movabs $0x8012cf,%rdx
+  80020b:	00 00 00 
+  80020e:	be 28 00 00 00       	mov    $0x28,%esi
+  800213:	48 bf ec 12 80 00 00 	movabs $0x8012ec,%rdi
+  80021a:	00 00 00 
+  80021d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800222:	49 b9 5f 05 80 00 00 	movabs $0x80055f,%r9
+  800229:	00 00 00 
+  80022c:	41 ff d1             	call   *%r9
+
+000000000080022f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80022f:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  800232:	48 63 d2             	movslq %edx,%rdx
+  800235:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800238:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  80023b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800240:	0f 05                	syscall
+	if(check && ret > 0)
+  800242:	48 85 c0             	test   %rax,%rax
+  800245:	7f 01                	jg     800248 <sys_page_map+0x19>
+}
+  800247:	c3                   	ret
+{
+  800248:	55                   	push   %rbp
+  800249:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80024c:	49 89 c0             	mov    %rax,%r8
+  80024f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800254:	48 ba cf 12 80 00 00 	movabs $0x8012cf,%rdx
+  80025b:	00 00 00 
+  80025e:	be 28 00 00 00       	mov    $0x28,%esi
+  800263:	48 bf ec 12 80 00 00 	movabs $0x8012ec,%rdi
+  80026a:	00 00 00 
+  80026d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800272:	49 b9 5f 05 80 00 00 	movabs $0x80055f,%r9
+  800279:	00 00 00 
+  80027c:	41 ff d1             	call   *%r9
+
+000000000080027f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  80027f:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800282:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800288:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80028e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800293:	b8 06 00 00 00       	mov    $0x6,%eax
+  800298:	0f 05                	syscall
+	if(check && ret > 0)
+  80029a:	48 85 c0             	test   %rax,%rax
+  80029d:	7f 01                	jg     8002a0 <sys_page_unmap+0x21>
+}
+  80029f:	c3                   	ret
+{
+  8002a0:	55                   	push   %rbp
+  8002a1:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002a4:	49 89 c0             	mov    %rax,%r8
+  8002a7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8002ac:	48 ba cf 12 80 00 00 	movabs $0x8012cf,%rdx
+  8002b3:	00 00 00 
+  8002b6:	be 28 00 00 00       	mov    $0x28,%esi
+  8002bb:	48 bf ec 12 80 00 00 	movabs $0x8012ec,%rdi
+  8002c2:	00 00 00 
+  8002c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ca:	49 b9 5f 05 80 00 00 	movabs $0x80055f,%r9
+  8002d1:	00 00 00 
+  8002d4:	41 ff d1             	call   *%r9
+
+00000000008002d7 <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  8002d7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002e8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8002ed:	48 89 fe             	mov    %rdi,%rsi
+  8002f0:	48 89 fa             	mov    %rdi,%rdx
+  8002f3:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8002f5:	c3                   	ret
+
+00000000008002f6 <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  8002f6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800302:	ba 00 00 00 00       	mov    $0x0,%edx
+  800307:	b8 10 00 00 00       	mov    $0x10,%eax
+  80030c:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  80030e:	c3                   	ret
+
+000000000080030f <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  80030f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800315:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80031b:	b8 11 00 00 00       	mov    $0x11,%eax
+  800320:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  800322:	c3                   	ret
+
+0000000000800323 <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  800323:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  800326:	48 63 f6             	movslq %esi,%rsi
+  800329:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  80032c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800332:	b8 12 00 00 00       	mov    $0x12,%eax
+  800337:	0f 05                	syscall
+	if(check && ret > 0)
+  800339:	48 85 c0             	test   %rax,%rax
+  80033c:	7f 01                	jg     80033f <sys_page_batch+0x1c>
+}
+  80033e:	c3                   	ret
+{
+  80033f:	55                   	push   %rbp
+  800340:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800343:	49 89 c0             	mov    %rax,%r8
+  800346:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80034b:	48 ba cf 12 80 00 00 	movabs $0x8012cf,%rdx
+  800352:	00 00 00 
+  800355:	be 28 00 00 00       	mov    $0x28,%esi
+  80035a:	48 bf ec 12 80 00 00 	movabs $0x8012ec,%rdi
+  800361:	00 00 00 
+  800364:	b8 00 00 00 00       	mov    $0x0,%eax
+  800369:	49 b9 5f 05 80 00 00 	movabs $0x80055f,%r9
+  800370:	00 00 00 
+  800373:	41 ff d1             	call   *%r9
+
+0000000000800376 <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  800376:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80037c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800382:	be 00 00 00 00       	mov    $0x0,%esi
+  800387:	b8 13 00 00 00       	mov    $0x13,%eax
+  80038c:	48 89 f2             	mov    %rsi,%rdx
+  80038f:	0f 05                	syscall
+	if(check && ret > 0)
+  800391:	48 85 c0             	test   %rax,%rax
+  800394:	7f 01                	jg     800397 <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  800396:	c3                   	ret
+{
+  800397:	55                   	push   %rbp
+  800398:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80039b:	49 89 c0             	mov    %rax,%r8
+  80039e:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8003a3:	48 ba cf 12 80 00 00 	movabs $0x8012cf,%rdx
+  8003aa:	00 00 00 
+  8003ad:	be 28 00 00 00       	mov    $0x28,%esi
+  8003b2:	48 bf ec 12 80 00 00 	movabs $0x8012ec,%rdi
+  8003b9:	00 00 00 
+  8003bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c1:	49 b9 5f 05 80 00 00 	movabs $0x80055f,%r9
+  8003c8:	00 00 00 
+  8003cb:	41 ff d1             	call   *%r9
+
+00000000008003ce <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  8003ce:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8003d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8003da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003df:	b8 14 00 00 00       	mov    $0x14,%eax
+  8003e4:	48 89 fe             	mov    %rdi,%rsi
+  8003e7:	48 89 fa             	mov    %rdi,%rdx
+  8003ea:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8003ec:	c3                   	ret
+
+00000000008003ed <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  8003ed:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8003f0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8003f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8003fc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800401:	0f 05                	syscall
+	if(check && ret > 0)
+  800403:	48 85 c0             	test   %rax,%rax
+  800406:	7f 01                	jg     800409 <sys_page_unmap_range+0x1c>
+}
+  800408:	c3                   	ret
+{
+  800409:	55                   	push   %rbp
+  80040a:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80040d:	49 89 c0             	mov    %rax,%r8
+  800410:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800415:	48 ba cf 12 80 00 00 	movabs $0x8012cf,%rdx
+  80041c:	00 00 00 
+  80041f:	be 28 00 00 00       	mov    $0x28,%esi
+  800424:	48 bf ec 12 80 00 00 	movabs $0x8012ec,%rdi
+  80042b:	00 00 00 
+  80042e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800433:	49 b9 5f 05 80 00 00 	movabs $0x80055f,%r9
+  80043a:	00 00 00 
+  80043d:	41 ff d1             	call   *%r9
+
+0000000000800440 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  800440:	48 63 f6             	movslq %esi,%rsi
+  800443:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800446:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80044c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800452:	ba 00 00 00 00       	mov    $0x0,%edx
+  800457:	b8 08 00 00 00       	mov    $0x8,%eax
+  80045c:	0f 05                	syscall
+	if(check && ret > 0)
+  80045e:	48 85 c0             	test   %rax,%rax
+  800461:	7f 01                	jg     800464 <sys_env_set_status+0x24>
+}
+  800463:	c3                   	ret
+{
+  800464:	55                   	push   %rbp
+  800465:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800468:	49 89 c0             	mov    %rax,%r8
+  80046b:	b9 08 00 00 00       	mov    $0x8,%ecx
+  800470:	48 ba cf 12 80 00 00 	movabs $0x8012cf,%rdx
+  800477:	00 00 00 
+  80047a:	be 28 00 00 00       	mov    $0x28,%esi
+  80047f:	48 bf ec 12 80 00 00 	movabs $0x8012ec,%rdi
+  800486:	00 00 00 
+  800489:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048e:	49 b9 5f 05 80 00 00 	movabs $0x80055f,%r9
+  800495:	00 00 00 
+  800498:	41 ff d1             	call   *%r9
+
+000000000080049b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80049b:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80049e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8004a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8004aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004af:	b8 09 00 00 00       	mov    $0x9,%eax
+  8004b4:	0f 05                	syscall
+	if(check && ret > 0)
+  8004b6:	48 85 c0             	test   %rax,%rax
+  8004b9:	7f 01                	jg     8004bc <sys_env_set_pgfault_upcall+0x21>
+}
+  8004bb:	c3                   	ret
+{
+  8004bc:	55                   	push   %rbp
+  8004bd:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004c0:	49 89 c0             	mov    %rax,%r8
+  8004c3:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004c8:	48 ba cf 12 80 00 00 	movabs $0x8012cf,%rdx
+  8004cf:	00 00 00 
+  8004d2:	be 28 00 00 00       	mov    $0x28,%esi
+  8004d7:	48 bf ec 12 80 00 00 	movabs $0x8012ec,%rdi
+  8004de:	00 00 00 
+  8004e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e6:	49 b9 5f 05 80 00 00 	movabs $0x80055f,%r9
+  8004ed:	00 00 00 
+  8004f0:	41 ff d1             	call   *%r9
+
+00000000008004f3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8004f3:	48 63 ff             	movslq %edi,%rdi
+  8004f6:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  8004f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8004ff:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800504:	0f 05                	syscall
+}
+  800506:	c3                   	ret
+
+0000000000800507 <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  800507:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80050d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800513:	be 00 00 00 00       	mov    $0x0,%esi
+  800518:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80051d:	48 89 f2             	mov    %rsi,%rdx
+  800520:	0f 05                	syscall
+	if(check && ret > 0)
+  800522:	48 85 c0             	test   %rax,%rax
+  800525:	7f 01                	jg     800528 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  800527:	c3                   	ret
+{
+  800528:	55                   	push   %rbp
+  800529:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80052c:	49 89 c0             	mov    %rax,%r8
+  80052f:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  800534:	48 ba cf 12 80 00 00 	movabs $0x8012cf,%rdx
+  80053b:	00 00 00 
+  80053e:	be 28 00 00 00       	mov    $0x28,%esi
+  800543:	48 bf ec 12 80 00 00 	movabs $0x8012ec,%rdi
+  80054a:	00 00 00 
+  80054d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800552:	49 b9 5f 05 80 00 00 	movabs $0x80055f,%r9
+  800559:	00 00 00 
+  80055c:	41 ff d1             	call   *%r9
+
+000000000080055f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80055f:	55                   	push   %rbp
+  800560:	48 89 e5             	mov    %rsp,%rbp
+  800563:	41 56                	push   %r14
+  800565:	41 55                	push   %r13
+  800567:	41 54                	push   %r12
+  800569:	53                   	push   %rbx
+  80056a:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800571:	49 89 fc             	mov    %rdi,%r12
+  800574:	41 89 f5             	mov    %esi,%r13d
+  800577:	48 89 d3             	mov    %rdx,%rbx
+  80057a:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800581:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800588:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  80058f:	84 c0                	test   %al,%al
+  800591:	74 26                	je     8005b9 <_panic+0x5a>
+  800593:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  80059a:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8005a1:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8005a5:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8005a9:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8005ad:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8005b1:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8005b5:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8005b9:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8005c0:	00 00 00 
+  8005c3:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8005ca:	00 00 00 
+  8005cd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005d1:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8005d8:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8005df:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005e6:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  8005ed:	00 00 00 
+  8005f0:	4c 8b 30             	mov    (%rax),%r14
+  8005f3:	48 b8 37 01 80 00 00 	movabs $0x800137,%rax
+  8005fa:	00 00 00 
+  8005fd:	ff d0                	call   *%rax
+  8005ff:	89 c6                	mov    %eax,%esi
+  800601:	45 89 e8             	mov    %r13d,%r8d
+  800604:	4c 89 e1             	mov    %r12,%rcx
+  800607:	4c 89 f2             	mov    %r14,%rdx
+  80060a:	48 bf 00 13 80 00 00 	movabs $0x801300,%rdi
+  800611:	00 00 00 
+  800614:	b8 00 00 00 00       	mov    $0x0,%eax
+  800619:	49 bc fe 06 80 00 00 	movabs $0x8006fe,%r12
+  800620:	00 00 00 
+  800623:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800626:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  80062d:	48 89 df             	mov    %rbx,%rdi
+  800630:	48 b8 9a 06 80 00 00 	movabs $0x80069a,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+	cprintf("\n");
+  80063c:	48 bf 23 13 80 00 00 	movabs $0x801323,%rdi
+  800643:	00 00 00 
+  800646:	b8 00 00 00 00       	mov    $0x0,%eax
+  80064b:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80064e:	cc                   	int3
+	while (1)
+  80064f:	eb fd                	jmp    80064e <_panic+0xef>
+
+0000000000800651 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800651:	55                   	push   %rbp
+  800652:	48 89 e5             	mov    %rsp,%rbp
+  800655:	53                   	push   %rbx
+  800656:	48 83 ec 08          	sub    $0x8,%rsp
+  80065a:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  80065d:	8b 06                	mov    (%rsi),%eax
+  80065f:	8d 50 01             	lea    0x1(%rax),%edx
+  800662:	89 16                	mov    %edx,(%rsi)
+  800664:	48 98                	cltq
+  800666:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  80066b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800671:	74 0a                	je     80067d <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800673:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800677:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80067b:	c9                   	leave
+  80067c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80067d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800681:	be ff 00 00 00       	mov    $0xff,%esi
+  800686:	48 b8 a4 00 80 00 00 	movabs $0x8000a4,%rax
+  80068d:	00 00 00 
+  800690:	ff d0                	call   *%rax
+		b->idx = 0;
+  800692:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800698:	eb d9                	jmp    800673 <putch+0x22>
+
+000000000080069a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80069a:	55                   	push   %rbp
+  80069b:	48 89 e5             	mov    %rsp,%rbp
+  80069e:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8006a5:	48 89 fa             	mov    %rdi,%rdx
+  8006a8:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  8006ab:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8006b2:	00 00 00 
+	b.cnt = 0;
+  8006b5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8006bc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8006bf:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  8006c6:	48 bf 51 06 80 00 00 	movabs $0x800651,%rdi
+  8006cd:	00 00 00 
+  8006d0:	48 b8 b8 08 80 00 00 	movabs $0x8008b8,%rax
+  8006d7:	00 00 00 
+  8006da:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8006dc:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  8006e3:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8006ea:	48 b8 a4 00 80 00 00 	movabs $0x8000a4,%rax
+  8006f1:	00 00 00 
+  8006f4:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  8006f6:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  8006fc:	c9                   	leave
+  8006fd:	c3                   	ret
+
+00000000008006fe <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8006fe:	55                   	push   %rbp
+  8006ff:	48 89 e5             	mov    %rsp,%rbp
+  800702:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800709:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800710:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800717:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80071e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800725:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80072c:	84 c0                	test   %al,%al
+  80072e:	74 20                	je     800750 <cprintf+0x52>
+  800730:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800734:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800738:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80073c:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800740:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800744:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800748:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80074c:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800750:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  800757:	00 00 00 
+  80075a:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800761:	00 00 00 
+  800764:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800768:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80076f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800776:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  80077d:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  800784:	48 b8 9a 06 80 00 00 	movabs $0x80069a,%rax
+  80078b:	00 00 00 
+  80078e:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  800790:	c9                   	leave
+  800791:	c3                   	ret
+
+0000000000800792 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800792:	55                   	push   %rbp
+  800793:	48 89 e5             	mov    %rsp,%rbp
+  800796:	41 57                	push   %r15
+  800798:	41 56                	push   %r14
+  80079a:	41 55                	push   %r13
+  80079c:	41 54                	push   %r12
+  80079e:	53                   	push   %rbx
+  80079f:	48 83 ec 18          	sub    $0x18,%rsp
+  8007a3:	49 89 fc             	mov    %rdi,%r12
+  8007a6:	49 89 f5             	mov    %rsi,%r13
+  8007a9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8007ad:	44 89 c3             	mov    %r8d,%ebx
+  8007b0:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8007b3:	41 89 cf             	mov    %ecx,%r15d
+  8007b6:	4c 39 fa             	cmp    %r15,%rdx
+  8007b9:	72 29                	jb     8007e4 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8007bb:	48 89 d0             	mov    %rdx,%rax
+  8007be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007c3:	49 f7 f7             	div    %r15
+  8007c6:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8007ca:	48 89 c2             	mov    %rax,%rdx
+  8007cd:	48 b8 92 07 80 00 00 	movabs $0x800792,%rax
+  8007d4:	00 00 00 
+  8007d7:	ff d0                	call   *%rax
+  8007d9:	eb 10                	jmp    8007eb <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8007db:	4c 89 ee             	mov    %r13,%rsi
+  8007de:	44 89 f7             	mov    %r14d,%edi
+  8007e1:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  8007e4:	83 eb 01             	sub    $0x1,%ebx
+  8007e7:	85 db                	test   %ebx,%ebx
+  8007e9:	7f f0                	jg     8007db <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007f4:	49 f7 f7             	div    %r15
+  8007f7:	48 b8 25 13 80 00 00 	movabs $0x801325,%rax
+  8007fe:	00 00 00 
+  800801:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  800805:	4c 89 ee             	mov    %r13,%rsi
+  800808:	41 ff d4             	call   *%r12
+}
+  80080b:	48 83 c4 18          	add    $0x18,%rsp
+  80080f:	5b                   	pop    %rbx
+  800810:	41 5c                	pop    %r12
+  800812:	41 5d                	pop    %r13
+  800814:	41 5e                	pop    %r14
+  800816:	41 5f                	pop    %r15
+  800818:	5d                   	pop    %rbp
+  800819:	c3                   	ret
+
+000000000080081a <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  80081a:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  80081e:	48 8b 06             	mov    (%rsi),%rax
+  800821:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800825:	73 0a                	jae    800831 <sprintputch+0x17>
+		*b->buf++ = ch;
+  800827:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80082b:	48 89 16             	mov    %rdx,(%rsi)
+  80082e:	40 88 38             	mov    %dil,(%rax)
+}
+  800831:	c3                   	ret
+
+0000000000800832 <printfmt>:
+{
+  800832:	55                   	push   %rbp
+  800833:	48 89 e5             	mov    %rsp,%rbp
+  800836:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80083d:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800844:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80084b:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800852:	84 c0                	test   %al,%al
+  800854:	74 20                	je     800876 <printfmt+0x44>
+  800856:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80085a:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80085e:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800862:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800866:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80086a:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80086e:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800872:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  800876:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  80087d:	00 00 00 
+  800880:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800887:	00 00 00 
+  80088a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80088e:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800895:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80089c:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8008a3:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8008aa:	48 b8 b8 08 80 00 00 	movabs $0x8008b8,%rax
+  8008b1:	00 00 00 
+  8008b4:	ff d0                	call   *%rax
+}
+  8008b6:	c9                   	leave
+  8008b7:	c3                   	ret
+
+00000000008008b8 <vprintfmt>:
+{
+  8008b8:	55                   	push   %rbp
+  8008b9:	48 89 e5             	mov    %rsp,%rbp
+  8008bc:	41 57                	push   %r15
+  8008be:	41 56                	push   %r14
+  8008c0:	41 55                	push   %r13
+  8008c2:	41 54                	push   %r12
+  8008c4:	53                   	push   %rbx
+  8008c5:	48 83 ec 48          	sub    $0x48,%rsp
+  8008c9:	49 89 fe             	mov    %rdi,%r14
+  8008cc:	49 89 f5             	mov    %rsi,%r13
+  8008cf:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  8008d2:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  8008d6:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  8008da:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8008de:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8008e2:	eb 09                	jmp    8008ed <vprintfmt+0x35>
+			putch(ch, putdat);
+  8008e4:	4c 89 ee             	mov    %r13,%rsi
+  8008e7:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008ea:	4c 89 e3             	mov    %r12,%rbx
+  8008ed:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8008f1:	0f b6 3b             	movzbl (%rbx),%edi
+  8008f4:	83 ff 25             	cmp    $0x25,%edi
+  8008f7:	74 13                	je     80090c <vprintfmt+0x54>
+			if (ch == '\0')
+  8008f9:	85 ff                	test   %edi,%edi
+  8008fb:	75 e7                	jne    8008e4 <vprintfmt+0x2c>
+}
+  8008fd:	48 83 c4 48          	add    $0x48,%rsp
+  800901:	5b                   	pop    %rbx
+  800902:	41 5c                	pop    %r12
+  800904:	41 5d                	pop    %r13
+  800906:	41 5e                	pop    %r14
+  800908:	41 5f                	pop    %r15
+  80090a:	5d                   	pop    %rbp
+  80090b:	c3                   	ret
+		padc = ' ';
+  80090c:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  800910:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  800917:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  80091d:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  800924:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800929:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80092e:	41 0f b6 14 24       	movzbl (%r12),%edx
+  800933:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  800936:	3c 55                	cmp    $0x55,%al
+  800938:	0f 87 4f 05 00 00    	ja     800e8d <vprintfmt+0x5d5>
+  80093e:	0f b6 c0             	movzbl %al,%eax
+  800941:	48 be e0 13 80 00 00 	movabs $0x8013e0,%rsi
+  800948:	00 00 00 
+  80094b:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  80094e:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  800951:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  800955:	eb d2                	jmp    800929 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800957:	49 89 dc             	mov    %rbx,%r12
+  80095a:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  80095e:	eb c9                	jmp    800929 <vprintfmt+0x71>
+  800960:	0f b6 d2             	movzbl %dl,%edx
+  800963:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  800966:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  80096c:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800970:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  800975:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  80097a:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  80097d:	83 f8 09             	cmp    $0x9,%eax
+  800980:	77 20                	ja     8009a2 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  800982:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  800986:	eb e4                	jmp    80096c <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  800988:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098b:	83 f8 2f             	cmp    $0x2f,%eax
+  80098e:	77 27                	ja     8009b7 <vprintfmt+0xff>
+  800990:	89 c2                	mov    %eax,%edx
+  800992:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800996:	83 c0 08             	add    $0x8,%eax
+  800999:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099c:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  80099f:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  8009a2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009a6:	79 81                	jns    800929 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  8009a8:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  8009ac:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8009b2:	e9 72 ff ff ff       	jmp    800929 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  8009b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c3:	eb d7                	jmp    80099c <vprintfmt+0xe4>
+			if (width < 0)
+  8009c5:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  8009c8:	85 f6                	test   %esi,%esi
+  8009ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009cf:	0f 49 c6             	cmovns %esi,%eax
+  8009d2:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8009d5:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8009d8:	e9 4c ff ff ff       	jmp    800929 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8009dd:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  8009e0:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  8009e7:	e9 3d ff ff ff       	jmp    800929 <vprintfmt+0x71>
+			lflag++;
+  8009ec:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8009ef:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8009f2:	e9 32 ff ff ff       	jmp    800929 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  8009f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fd:	77 19                	ja     800a18 <vprintfmt+0x160>
+  8009ff:	89 c2                	mov    %eax,%edx
+  800a01:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a05:	83 c0 08             	add    $0x8,%eax
+  800a08:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0b:	8b 3a                	mov    (%rdx),%edi
+  800a0d:	4c 89 ee             	mov    %r13,%rsi
+  800a10:	41 ff d6             	call   *%r14
+			break;
+  800a13:	e9 d5 fe ff ff       	jmp    8008ed <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  800a18:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a24:	eb e5                	jmp    800a0b <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  800a26:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a29:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2c:	77 5a                	ja     800a88 <vprintfmt+0x1d0>
+  800a2e:	89 c2                	mov    %eax,%edx
+  800a30:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a34:	83 c0 08             	add    $0x8,%eax
+  800a37:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800a3a:	8b 02                	mov    (%rdx),%eax
+  800a3c:	89 c1                	mov    %eax,%ecx
+  800a3e:	f7 d9                	neg    %ecx
+  800a40:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a43:	83 f9 08             	cmp    $0x8,%ecx
+  800a46:	7f 4e                	jg     800a96 <vprintfmt+0x1de>
+  800a48:	48 63 c1             	movslq %ecx,%rax
+  800a4b:	48 ba a0 16 80 00 00 	movabs $0x8016a0,%rdx
+  800a52:	00 00 00 
+  800a55:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800a59:	48 85 c0             	test   %rax,%rax
+  800a5c:	74 38                	je     800a96 <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800a5e:	48 89 c1             	mov    %rax,%rcx
+  800a61:	48 ba 46 13 80 00 00 	movabs $0x801346,%rdx
+  800a68:	00 00 00 
+  800a6b:	4c 89 ee             	mov    %r13,%rsi
+  800a6e:	4c 89 f7             	mov    %r14,%rdi
+  800a71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a76:	49 b8 32 08 80 00 00 	movabs $0x800832,%r8
+  800a7d:	00 00 00 
+  800a80:	41 ff d0             	call   *%r8
+  800a83:	e9 65 fe ff ff       	jmp    8008ed <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  800a88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a94:	eb a4                	jmp    800a3a <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  800a96:	48 ba 3d 13 80 00 00 	movabs $0x80133d,%rdx
+  800a9d:	00 00 00 
+  800aa0:	4c 89 ee             	mov    %r13,%rsi
+  800aa3:	4c 89 f7             	mov    %r14,%rdi
+  800aa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aab:	49 b8 32 08 80 00 00 	movabs $0x800832,%r8
+  800ab2:	00 00 00 
+  800ab5:	41 ff d0             	call   *%r8
+  800ab8:	e9 30 fe ff ff       	jmp    8008ed <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800abd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac3:	77 36                	ja     800afb <vprintfmt+0x243>
+  800ac5:	89 c2                	mov    %eax,%edx
+  800ac7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800acb:	83 c0 08             	add    $0x8,%eax
+  800ace:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad1:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800ad4:	48 85 c9             	test   %rcx,%rcx
+  800ad7:	48 b8 36 13 80 00 00 	movabs $0x801336,%rax
+  800ade:	00 00 00 
+  800ae1:	48 0f 45 c1          	cmovne %rcx,%rax
+  800ae5:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800ae9:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800aed:	7e 06                	jle    800af5 <vprintfmt+0x23d>
+  800aef:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800af3:	75 14                	jne    800b09 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800af5:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800af9:	eb 64                	jmp    800b5f <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800afb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b07:	eb c8                	jmp    800ad1 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b09:	49 63 f7             	movslq %r15d,%rsi
+  800b0c:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800b10:	48 b8 9b 0f 80 00 00 	movabs $0x800f9b,%rax
+  800b17:	00 00 00 
+  800b1a:	ff d0                	call   *%rax
+  800b1c:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800b1f:	29 c1                	sub    %eax,%ecx
+  800b21:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800b24:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  800b27:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800b2b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b2e:	eb 0d                	jmp    800b3d <vprintfmt+0x285>
+					putch(padc, putdat);
+  800b30:	4c 89 ee             	mov    %r13,%rsi
+  800b33:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  800b36:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b39:	41 83 ec 01          	sub    $0x1,%r12d
+  800b3d:	45 85 e4             	test   %r12d,%r12d
+  800b40:	7f ee                	jg     800b30 <vprintfmt+0x278>
+  800b42:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  800b45:	85 c9                	test   %ecx,%ecx
+  800b47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4c:	0f 49 c1             	cmovns %ecx,%eax
+  800b4f:	29 c1                	sub    %eax,%ecx
+  800b51:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  800b54:	eb 9f                	jmp    800af5 <vprintfmt+0x23d>
+					putch(ch, putdat);
+  800b56:	4c 89 ee             	mov    %r13,%rsi
+  800b59:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b5c:	4c 89 e2             	mov    %r12,%rdx
+  800b5f:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800b63:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800b69:	0f be f8             	movsbl %al,%edi
+  800b6c:	85 ff                	test   %edi,%edi
+  800b6e:	74 29                	je     800b99 <vprintfmt+0x2e1>
+  800b70:	45 85 ff             	test   %r15d,%r15d
+  800b73:	78 06                	js     800b7b <vprintfmt+0x2c3>
+  800b75:	41 83 ef 01          	sub    $0x1,%r15d
+  800b79:	78 1e                	js     800b99 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b7b:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800b7f:	74 d5                	je     800b56 <vprintfmt+0x29e>
+  800b81:	0f be c0             	movsbl %al,%eax
+  800b84:	83 e8 20             	sub    $0x20,%eax
+  800b87:	83 f8 5e             	cmp    $0x5e,%eax
+  800b8a:	76 ca                	jbe    800b56 <vprintfmt+0x29e>
+					putch('?', putdat);
+  800b8c:	4c 89 ee             	mov    %r13,%rsi
+  800b8f:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b94:	41 ff d6             	call   *%r14
+  800b97:	eb c3                	jmp    800b5c <vprintfmt+0x2a4>
+  800b99:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800b9d:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800ba0:	41 01 c4             	add    %eax,%r12d
+  800ba3:	41 29 d4             	sub    %edx,%r12d
+  800ba6:	eb 0f                	jmp    800bb7 <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  800ba8:	4c 89 ee             	mov    %r13,%rsi
+  800bab:	bf 20 00 00 00       	mov    $0x20,%edi
+  800bb0:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800bb3:	41 83 ec 01          	sub    $0x1,%r12d
+  800bb7:	45 85 e4             	test   %r12d,%r12d
+  800bba:	7f ec                	jg     800ba8 <vprintfmt+0x2f0>
+  800bbc:	e9 2c fd ff ff       	jmp    8008ed <vprintfmt+0x35>
+	if (lflag >= 2)
+  800bc1:	83 f9 01             	cmp    $0x1,%ecx
+  800bc4:	7f 1d                	jg     800be3 <vprintfmt+0x32b>
+	else if (lflag)
+  800bc6:	85 c9                	test   %ecx,%ecx
+  800bc8:	74 5e                	je     800c28 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800bca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bcd:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd0:	77 48                	ja     800c1a <vprintfmt+0x362>
+  800bd2:	89 c2                	mov    %eax,%edx
+  800bd4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd8:	83 c0 08             	add    $0x8,%eax
+  800bdb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bde:	4c 8b 22             	mov    (%rdx),%r12
+  800be1:	eb 17                	jmp    800bfa <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800be3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be6:	83 f8 2f             	cmp    $0x2f,%eax
+  800be9:	77 21                	ja     800c0c <vprintfmt+0x354>
+  800beb:	89 c2                	mov    %eax,%edx
+  800bed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf1:	83 c0 08             	add    $0x8,%eax
+  800bf4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf7:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800bfa:	4d 85 e4             	test   %r12,%r12
+  800bfd:	78 50                	js     800c4f <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  800bff:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800c02:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800c07:	e9 b4 01 00 00       	jmp    800dc0 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800c0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c18:	eb dd                	jmp    800bf7 <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800c1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c26:	eb b6                	jmp    800bde <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800c28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c2b:	83 f8 2f             	cmp    $0x2f,%eax
+  800c2e:	77 11                	ja     800c41 <vprintfmt+0x389>
+  800c30:	89 c2                	mov    %eax,%edx
+  800c32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c36:	83 c0 08             	add    $0x8,%eax
+  800c39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c3c:	4c 63 22             	movslq (%rdx),%r12
+  800c3f:	eb b9                	jmp    800bfa <vprintfmt+0x342>
+  800c41:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c45:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c4d:	eb ed                	jmp    800c3c <vprintfmt+0x384>
+				putch('-', putdat);
+  800c4f:	4c 89 ee             	mov    %r13,%rsi
+  800c52:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c57:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800c5a:	4c 89 e2             	mov    %r12,%rdx
+  800c5d:	48 f7 da             	neg    %rdx
+			base = 10;
+  800c60:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800c65:	e9 56 01 00 00       	jmp    800dc0 <vprintfmt+0x508>
+	if (lflag >= 2)
+  800c6a:	83 f9 01             	cmp    $0x1,%ecx
+  800c6d:	7f 25                	jg     800c94 <vprintfmt+0x3dc>
+	else if (lflag)
+  800c6f:	85 c9                	test   %ecx,%ecx
+  800c71:	74 5e                	je     800cd1 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800c73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c76:	83 f8 2f             	cmp    $0x2f,%eax
+  800c79:	77 48                	ja     800cc3 <vprintfmt+0x40b>
+  800c7b:	89 c2                	mov    %eax,%edx
+  800c7d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c81:	83 c0 08             	add    $0x8,%eax
+  800c84:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c87:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800c8a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800c8f:	e9 2c 01 00 00       	jmp    800dc0 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800c94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c97:	83 f8 2f             	cmp    $0x2f,%eax
+  800c9a:	77 19                	ja     800cb5 <vprintfmt+0x3fd>
+  800c9c:	89 c2                	mov    %eax,%edx
+  800c9e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ca2:	83 c0 08             	add    $0x8,%eax
+  800ca5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ca8:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800cab:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800cb0:	e9 0b 01 00 00       	jmp    800dc0 <vprintfmt+0x508>
+  800cb5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cb9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cbd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc1:	eb e5                	jmp    800ca8 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800cc3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ccb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ccf:	eb b6                	jmp    800c87 <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800cd1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cd4:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd7:	77 18                	ja     800cf1 <vprintfmt+0x439>
+  800cd9:	89 c2                	mov    %eax,%edx
+  800cdb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cdf:	83 c0 08             	add    $0x8,%eax
+  800ce2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ce5:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800ce7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800cec:	e9 cf 00 00 00       	jmp    800dc0 <vprintfmt+0x508>
+  800cf1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cf5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cf9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cfd:	eb e6                	jmp    800ce5 <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800cff:	83 f9 01             	cmp    $0x1,%ecx
+  800d02:	7f 25                	jg     800d29 <vprintfmt+0x471>
+	else if (lflag)
+  800d04:	85 c9                	test   %ecx,%ecx
+  800d06:	74 5b                	je     800d63 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800d08:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d0b:	83 f8 2f             	cmp    $0x2f,%eax
+  800d0e:	77 45                	ja     800d55 <vprintfmt+0x49d>
+  800d10:	89 c2                	mov    %eax,%edx
+  800d12:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d16:	83 c0 08             	add    $0x8,%eax
+  800d19:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d1c:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800d1f:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800d24:	e9 97 00 00 00       	jmp    800dc0 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800d29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d2c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d2f:	77 16                	ja     800d47 <vprintfmt+0x48f>
+  800d31:	89 c2                	mov    %eax,%edx
+  800d33:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d37:	83 c0 08             	add    $0x8,%eax
+  800d3a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d3d:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800d40:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800d45:	eb 79                	jmp    800dc0 <vprintfmt+0x508>
+  800d47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d53:	eb e8                	jmp    800d3d <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800d55:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d59:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d61:	eb b9                	jmp    800d1c <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800d63:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d66:	83 f8 2f             	cmp    $0x2f,%eax
+  800d69:	77 15                	ja     800d80 <vprintfmt+0x4c8>
+  800d6b:	89 c2                	mov    %eax,%edx
+  800d6d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d71:	83 c0 08             	add    $0x8,%eax
+  800d74:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d77:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800d79:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800d7e:	eb 40                	jmp    800dc0 <vprintfmt+0x508>
+  800d80:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d84:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d88:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d8c:	eb e9                	jmp    800d77 <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800d8e:	4c 89 ee             	mov    %r13,%rsi
+  800d91:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d96:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800d99:	4c 89 ee             	mov    %r13,%rsi
+  800d9c:	bf 78 00 00 00       	mov    $0x78,%edi
+  800da1:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800da4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800da7:	83 f8 2f             	cmp    $0x2f,%eax
+  800daa:	77 34                	ja     800de0 <vprintfmt+0x528>
+  800dac:	89 c2                	mov    %eax,%edx
+  800dae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800db2:	83 c0 08             	add    $0x8,%eax
+  800db5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800db8:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800dbb:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800dc0:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800dc5:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800dc9:	4c 89 ee             	mov    %r13,%rsi
+  800dcc:	4c 89 f7             	mov    %r14,%rdi
+  800dcf:	48 b8 92 07 80 00 00 	movabs $0x800792,%rax
+  800dd6:	00 00 00 
+  800dd9:	ff d0                	call   *%rax
+			break;
+  800ddb:	e9 0d fb ff ff       	jmp    8008ed <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800de0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800de4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800de8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dec:	eb ca                	jmp    800db8 <vprintfmt+0x500>
+	if (lflag >= 2)
+  800dee:	83 f9 01             	cmp    $0x1,%ecx
+  800df1:	7f 22                	jg     800e15 <vprintfmt+0x55d>
+	else if (lflag)
+  800df3:	85 c9                	test   %ecx,%ecx
+  800df5:	74 58                	je     800e4f <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800df7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dfa:	83 f8 2f             	cmp    $0x2f,%eax
+  800dfd:	77 42                	ja     800e41 <vprintfmt+0x589>
+  800dff:	89 c2                	mov    %eax,%edx
+  800e01:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e05:	83 c0 08             	add    $0x8,%eax
+  800e08:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e0b:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800e0e:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800e13:	eb ab                	jmp    800dc0 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800e15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e18:	83 f8 2f             	cmp    $0x2f,%eax
+  800e1b:	77 16                	ja     800e33 <vprintfmt+0x57b>
+  800e1d:	89 c2                	mov    %eax,%edx
+  800e1f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e23:	83 c0 08             	add    $0x8,%eax
+  800e26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e29:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800e2c:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800e31:	eb 8d                	jmp    800dc0 <vprintfmt+0x508>
+  800e33:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e37:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e3f:	eb e8                	jmp    800e29 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800e41:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e45:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e4d:	eb bc                	jmp    800e0b <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800e4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e52:	83 f8 2f             	cmp    $0x2f,%eax
+  800e55:	77 18                	ja     800e6f <vprintfmt+0x5b7>
+  800e57:	89 c2                	mov    %eax,%edx
+  800e59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e5d:	83 c0 08             	add    $0x8,%eax
+  800e60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e63:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800e65:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800e6a:	e9 51 ff ff ff       	jmp    800dc0 <vprintfmt+0x508>
+  800e6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e7b:	eb e6                	jmp    800e63 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800e7d:	4c 89 ee             	mov    %r13,%rsi
+  800e80:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e85:	41 ff d6             	call   *%r14
+			break;
+  800e88:	e9 60 fa ff ff       	jmp    8008ed <vprintfmt+0x35>
+			putch('%', putdat);
+  800e8d:	4c 89 ee             	mov    %r13,%rsi
+  800e90:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e95:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800e98:	4c 89 e3             	mov    %r12,%rbx
+  800e9b:	eb 04                	jmp    800ea1 <vprintfmt+0x5e9>
+  800e9d:	48 83 eb 01          	sub    $0x1,%rbx
+  800ea1:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ea5:	75 f6                	jne    800e9d <vprintfmt+0x5e5>
+  800ea7:	e9 41 fa ff ff       	jmp    8008ed <vprintfmt+0x35>
+
+0000000000800eac <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800eac:	55                   	push   %rbp
+  800ead:	48 89 e5             	mov    %rsp,%rbp
+  800eb0:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800eb4:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800eb8:	48 63 c6             	movslq %esi,%rax
+  800ebb:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800ec0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800ec4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800ecb:	48 85 ff             	test   %rdi,%rdi
+  800ece:	74 2a                	je     800efa <vsnprintf+0x4e>
+  800ed0:	85 f6                	test   %esi,%esi
+  800ed2:	7e 26                	jle    800efa <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800ed4:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800ed8:	48 bf 1a 08 80 00 00 	movabs $0x80081a,%rdi
+  800edf:	00 00 00 
+  800ee2:	48 b8 b8 08 80 00 00 	movabs $0x8008b8,%rax
+  800ee9:	00 00 00 
+  800eec:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800eee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800ef2:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800ef5:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800ef8:	c9                   	leave
+  800ef9:	c3                   	ret
+		return -E_INVAL;
+  800efa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800eff:	eb f7                	jmp    800ef8 <vsnprintf+0x4c>
+
+0000000000800f01 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800f01:	55                   	push   %rbp
+  800f02:	48 89 e5             	mov    %rsp,%rbp
+  800f05:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800f0c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f13:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f1a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f21:	84 c0                	test   %al,%al
+  800f23:	74 20                	je     800f45 <snprintf+0x44>
+  800f25:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f29:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f2d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f31:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f35:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f39:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f3d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f41:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800f45:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f4c:	00 00 00 
+  800f4f:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f56:	00 00 00 
+  800f59:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f5d:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800f64:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f6b:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800f72:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800f79:	48 b8 ac 0e 80 00 00 	movabs $0x800eac,%rax
+  800f80:	00 00 00 
+  800f83:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800f85:	c9                   	leave
+  800f86:	c3                   	ret
+
+0000000000800f87 <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800f87:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f8c:	48 89 d0             	mov    %rdx,%rax
+  800f8f:	48 83 c2 01          	add    $0x1,%rdx
+  800f93:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800f98:	75 f2                	jne    800f8c <strlen+0x5>
+		n++;
+	return n;
+}
+  800f9a:	c3                   	ret
+
+0000000000800f9b <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa0:	eb 03                	jmp    800fa5 <strnlen+0xa>
+  800fa2:	48 89 d0             	mov    %rdx,%rax
+  800fa5:	48 39 c6             	cmp    %rax,%rsi
+  800fa8:	74 0a                	je     800fb4 <strnlen+0x19>
+  800faa:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800fae:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800fb2:	75 ee                	jne    800fa2 <strnlen+0x7>
+		n++;
+	return n;
+}
+  800fb4:	c3                   	ret
+
+0000000000800fb5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800fb5:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800fb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fbd:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800fc1:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800fc4:	48 83 c2 01          	add    $0x1,%rdx
+  800fc8:	84 c9                	test   %cl,%cl
+  800fca:	75 f1                	jne    800fbd <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800fcc:	c3                   	ret
+
+0000000000800fcd <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800fcd:	55                   	push   %rbp
+  800fce:	48 89 e5             	mov    %rsp,%rbp
+  800fd1:	41 54                	push   %r12
+  800fd3:	53                   	push   %rbx
+  800fd4:	48 89 fb             	mov    %rdi,%rbx
+  800fd7:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800fda:	48 b8 87 0f 80 00 00 	movabs $0x800f87,%rax
+  800fe1:	00 00 00 
+  800fe4:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800fe6:	48 63 f8             	movslq %eax,%rdi
+  800fe9:	48 01 df             	add    %rbx,%rdi
+  800fec:	4c 89 e6             	mov    %r12,%rsi
+  800fef:	48 b8 b5 0f 80 00 00 	movabs $0x800fb5,%rax
+  800ff6:	00 00 00 
+  800ff9:	ff d0                	call   *%rax
+	return dst;
+}
+  800ffb:	48 89 d8             	mov    %rbx,%rax
+  800ffe:	5b                   	pop    %rbx
+  800fff:	41 5c                	pop    %r12
+  801001:	5d                   	pop    %rbp
+  801002:	c3                   	ret
+
+0000000000801003 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801003:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801006:	48 01 fa             	add    %rdi,%rdx
+  801009:	48 89 f9             	mov    %rdi,%rcx
+  80100c:	eb 14                	jmp    801022 <strncpy+0x1f>
+		*dst++ = *src;
+  80100e:	48 83 c1 01          	add    $0x1,%rcx
+  801012:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801016:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80101a:	41 80 f8 01          	cmp    $0x1,%r8b
+  80101e:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  801022:	48 39 d1             	cmp    %rdx,%rcx
+  801025:	75 e7                	jne    80100e <strncpy+0xb>
+	}
+	return ret;
+}
+  801027:	c3                   	ret
+
+0000000000801028 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801028:	48 89 f8             	mov    %rdi,%rax
+  80102b:	48 85 d2             	test   %rdx,%rdx
+  80102e:	74 27                	je     801057 <strlcpy+0x2f>
+  801030:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  801035:	48 89 fa             	mov    %rdi,%rdx
+  801038:	eb 0b                	jmp    801045 <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80103a:	48 83 c6 01          	add    $0x1,%rsi
+  80103e:	48 83 c2 01          	add    $0x1,%rdx
+  801042:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  801045:	48 39 c2             	cmp    %rax,%rdx
+  801048:	74 0a                	je     801054 <strlcpy+0x2c>
+  80104a:	0f b6 0e             	movzbl (%rsi),%ecx
+  80104d:	84 c9                	test   %cl,%cl
+  80104f:	75 e9                	jne    80103a <strlcpy+0x12>
+  801051:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  801054:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801057:	48 29 f8             	sub    %rdi,%rax
+}
+  80105a:	c3                   	ret
+
+000000000080105b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  80105b:	eb 08                	jmp    801065 <strcmp+0xa>
+		p++, q++;
+  80105d:	48 83 c7 01          	add    $0x1,%rdi
+  801061:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  801065:	0f b6 07             	movzbl (%rdi),%eax
+  801068:	84 c0                	test   %al,%al
+  80106a:	74 04                	je     801070 <strcmp+0x15>
+  80106c:	3a 06                	cmp    (%rsi),%al
+  80106e:	74 ed                	je     80105d <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801070:	0f b6 c0             	movzbl %al,%eax
+  801073:	0f b6 16             	movzbl (%rsi),%edx
+  801076:	29 d0                	sub    %edx,%eax
+}
+  801078:	c3                   	ret
+
+0000000000801079 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  801079:	eb 0c                	jmp    801087 <strncmp+0xe>
+		n--, p++, q++;
+  80107b:	48 83 ea 01          	sub    $0x1,%rdx
+  80107f:	48 83 c7 01          	add    $0x1,%rdi
+  801083:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  801087:	48 85 d2             	test   %rdx,%rdx
+  80108a:	74 14                	je     8010a0 <strncmp+0x27>
+  80108c:	0f b6 07             	movzbl (%rdi),%eax
+  80108f:	84 c0                	test   %al,%al
+  801091:	74 04                	je     801097 <strncmp+0x1e>
+  801093:	3a 06                	cmp    (%rsi),%al
+  801095:	74 e4                	je     80107b <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801097:	0f b6 07             	movzbl (%rdi),%eax
+  80109a:	0f b6 16             	movzbl (%rsi),%edx
+  80109d:	29 d0                	sub    %edx,%eax
+}
+  80109f:	c3                   	ret
+		return 0;
+  8010a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a5:	c3                   	ret
+
+00000000008010a6 <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  8010a6:	eb 04                	jmp    8010ac <strchr+0x6>
+  8010a8:	48 83 c7 01          	add    $0x1,%rdi
+  8010ac:	0f b6 07             	movzbl (%rdi),%eax
+  8010af:	84 c0                	test   %al,%al
+  8010b1:	74 09                	je     8010bc <strchr+0x16>
+		if (*s == c)
+  8010b3:	40 38 f0             	cmp    %sil,%al
+  8010b6:	75 f0                	jne    8010a8 <strchr+0x2>
+  8010b8:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  8010bb:	c3                   	ret
+	return 0;
+  8010bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c1:	c3                   	ret
+
+00000000008010c2 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8010c2:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  8010c5:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  8010c8:	40 38 f2             	cmp    %sil,%dl
+  8010cb:	74 0a                	je     8010d7 <strfind+0x15>
+  8010cd:	84 d2                	test   %dl,%dl
+  8010cf:	74 06                	je     8010d7 <strfind+0x15>
+	for (; *s; s++)
+  8010d1:	48 83 c0 01          	add    $0x1,%rax
+  8010d5:	eb ee                	jmp    8010c5 <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  8010d7:	c3                   	ret
+
+00000000008010d8 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  8010d8:	48 85 d2             	test   %rdx,%rdx
+  8010db:	74 28                	je     801105 <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  8010dd:	48 89 f8             	mov    %rdi,%rax
+  8010e0:	48 09 d0             	or     %rdx,%rax
+  8010e3:	a8 03                	test   $0x3,%al
+  8010e5:	75 16                	jne    8010fd <memset+0x25>
+		c &= 0xFF;
+  8010e7:	40 0f b6 f6          	movzbl %sil,%esi
+  8010eb:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8010f1:	48 89 d1             	mov    %rdx,%rcx
+  8010f4:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  8010f8:	fc                   	cld
+  8010f9:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8010fb:	eb 08                	jmp    801105 <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8010fd:	89 f0                	mov    %esi,%eax
+  8010ff:	48 89 d1             	mov    %rdx,%rcx
+  801102:	fc                   	cld
+  801103:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801105:	48 89 f8             	mov    %rdi,%rax
+  801108:	c3                   	ret
+
+0000000000801109 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801109:	48 89 f8             	mov    %rdi,%rax
+  80110c:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80110f:	48 39 fe             	cmp    %rdi,%rsi
+  801112:	73 3a                	jae    80114e <memmove+0x45>
+  801114:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801118:	48 39 d7             	cmp    %rdx,%rdi
+  80111b:	73 31                	jae    80114e <memmove+0x45>
+		s += n;
+		d += n;
+  80111d:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  801121:	48 89 d6             	mov    %rdx,%rsi
+  801124:	48 09 fe             	or     %rdi,%rsi
+  801127:	48 09 ce             	or     %rcx,%rsi
+  80112a:	40 f6 c6 03          	test   $0x3,%sil
+  80112e:	75 11                	jne    801141 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801130:	48 83 ef 04          	sub    $0x4,%rdi
+  801134:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  801138:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  80113c:	fd                   	std
+  80113d:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80113f:	eb 0b                	jmp    80114c <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801141:	48 83 ef 01          	sub    $0x1,%rdi
+  801145:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  801149:	fd                   	std
+  80114a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80114c:	fc                   	cld
+  80114d:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  80114e:	48 89 f2             	mov    %rsi,%rdx
+  801151:	48 09 c2             	or     %rax,%rdx
+  801154:	48 09 ca             	or     %rcx,%rdx
+  801157:	f6 c2 03             	test   $0x3,%dl
+  80115a:	75 0b                	jne    801167 <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80115c:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  801160:	48 89 c7             	mov    %rax,%rdi
+  801163:	fc                   	cld
+  801164:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801166:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  801167:	48 89 c7             	mov    %rax,%rdi
+  80116a:	fc                   	cld
+  80116b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80116d:	c3                   	ret
+
+000000000080116e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80116e:	55                   	push   %rbp
+  80116f:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  801172:	48 b8 09 11 80 00 00 	movabs $0x801109,%rax
+  801179:	00 00 00 
+  80117c:	ff d0                	call   *%rax
+}
+  80117e:	5d                   	pop    %rbp
+  80117f:	c3                   	ret
+
+0000000000801180 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801180:	b8 00 00 00 00       	mov    $0x0,%eax
+  801185:	48 39 c2             	cmp    %rax,%rdx
+  801188:	74 1e                	je     8011a8 <memcmp+0x28>
+		if (*s1 != *s2)
+  80118a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80118e:	48 83 c0 01          	add    $0x1,%rax
+  801192:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  801198:	44 38 c1             	cmp    %r8b,%cl
+  80119b:	74 e8                	je     801185 <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  80119d:	0f b6 c1             	movzbl %cl,%eax
+  8011a0:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011a4:	44 29 c0             	sub    %r8d,%eax
+  8011a7:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  8011a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011ad:	c3                   	ret
+
+00000000008011ae <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8011ae:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  8011b1:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  8011b4:	eb 04                	jmp    8011ba <memfind+0xc>
+  8011b6:	48 83 c0 01          	add    $0x1,%rax
+  8011ba:	48 39 d0             	cmp    %rdx,%rax
+  8011bd:	73 05                	jae    8011c4 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8011bf:	40 38 30             	cmp    %sil,(%rax)
+  8011c2:	75 f2                	jne    8011b6 <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  8011c4:	c3                   	ret
+
+00000000008011c5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8011c5:	48 89 f9             	mov    %rdi,%rcx
+  8011c8:	49 89 f0             	mov    %rsi,%r8
+  8011cb:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8011cd:	eb 04                	jmp    8011d3 <strtol+0xe>
+		s++;
+  8011cf:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  8011d3:	0f b6 01             	movzbl (%rcx),%eax
+  8011d6:	3c 20                	cmp    $0x20,%al
+  8011d8:	74 f5                	je     8011cf <strtol+0xa>
+  8011da:	3c 09                	cmp    $0x9,%al
+  8011dc:	74 f1                	je     8011cf <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  8011de:	3c 2b                	cmp    $0x2b,%al
+  8011e0:	74 2b                	je     80120d <strtol+0x48>
+	int neg = 0;
+  8011e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  8011e8:	3c 2d                	cmp    $0x2d,%al
+  8011ea:	74 2d                	je     801219 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011ec:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  8011f2:	75 0f                	jne    801203 <strtol+0x3e>
+  8011f4:	80 39 30             	cmpb   $0x30,(%rcx)
+  8011f7:	74 2c                	je     801225 <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8011f9:	85 ff                	test   %edi,%edi
+  8011fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801200:	0f 44 f8             	cmove  %eax,%edi
+  801203:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  801208:	4c 63 d7             	movslq %edi,%r10
+  80120b:	eb 4f                	jmp    80125c <strtol+0x97>
+		s++;
+  80120d:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  801211:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801217:	eb d3                	jmp    8011ec <strtol+0x27>
+		s++, neg = 1;
+  801219:	48 83 c1 01          	add    $0x1,%rcx
+  80121d:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  801223:	eb c7                	jmp    8011ec <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801225:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  801229:	74 0f                	je     80123a <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  80122b:	85 ff                	test   %edi,%edi
+  80122d:	75 d4                	jne    801203 <strtol+0x3e>
+		s++, base = 8;
+  80122f:	48 83 c1 01          	add    $0x1,%rcx
+  801233:	bf 08 00 00 00       	mov    $0x8,%edi
+  801238:	eb c9                	jmp    801203 <strtol+0x3e>
+		s += 2, base = 16;
+  80123a:	48 83 c1 02          	add    $0x2,%rcx
+  80123e:	bf 10 00 00 00       	mov    $0x10,%edi
+  801243:	eb be                	jmp    801203 <strtol+0x3e>
+			dig = *s - '0';
+  801245:	0f be c0             	movsbl %al,%eax
+  801248:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  80124b:	39 f8                	cmp    %edi,%eax
+  80124d:	7d 3b                	jge    80128a <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  80124f:	48 83 c1 01          	add    $0x1,%rcx
+  801253:	49 0f af d2          	imul   %r10,%rdx
+  801257:	48 98                	cltq
+  801259:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  80125c:	0f b6 01             	movzbl (%rcx),%eax
+  80125f:	8d 70 d0             	lea    -0x30(%rax),%esi
+  801262:	40 80 fe 09          	cmp    $0x9,%sil
+  801266:	76 dd                	jbe    801245 <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  801268:	8d 70 9f             	lea    -0x61(%rax),%esi
+  80126b:	40 80 fe 19          	cmp    $0x19,%sil
+  80126f:	77 08                	ja     801279 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  801271:	0f be c0             	movsbl %al,%eax
+  801274:	83 e8 57             	sub    $0x57,%eax
+  801277:	eb d2                	jmp    80124b <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  801279:	8d 70 bf             	lea    -0x41(%rax),%esi
+  80127c:	40 80 fe 19          	cmp    $0x19,%sil
+  801280:	77 08                	ja     80128a <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  801282:	0f be c0             	movsbl %al,%eax
+  801285:	83 e8 37             	sub    $0x37,%eax
+  801288:	eb c1                	jmp    80124b <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80128a:	4d 85 c0             	test   %r8,%r8
+  80128d:	74 03                	je     801292 <strtol+0xcd>
+		*endptr = (char *) s;
+  80128f:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  801292:	48 89 d0             	mov    %rdx,%rax
+  801295:	48 f7 d8             	neg    %rax
+  801298:	45 85 c9             	test   %r9d,%r9d
+  80129b:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  80129f:	48 89 d0             	mov    %rdx,%rax
+  8012a2:	c3                   	ret
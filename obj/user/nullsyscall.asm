@@ -0,0 +1,2488 @@
+
+obj/user/nullsyscall:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 bc 01 00 00       	call   8001ed <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <getenvid_int>:
+static envid_t
+getenvid_int(void)
+{
+	envid_t ret;
+
+	asm volatile("int %1\n"
+  800033:	b8 02 00 00 00       	mov    $0x2,%eax
+  800038:	cd 30                	int    $0x30
+		     : "=a" (ret)
+		     : "i" (T_SYSCALL), "a" (SYS_getenvid)
+		     : "cc", "memory");
+	return ret;
+}
+  80003a:	c3                   	ret
+
+000000000080003b <getenvid_syscall>:
+getenvid_syscall(void)
+{
+	envid_t ret;
+
+	// see lib/syscall.c for what SYSCALL clobbers
+	asm volatile("syscall\n"
+  80003b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800040:	0f 05                	syscall
+		     : "=a" (ret)
+		     : "a" (SYS_getenvid)
+		     : "rcx", "rdx", "rsi", "rdi", "r8", "r9", "r10", "r11",
+		       "cc", "memory");
+	return ret;
+}
+  800042:	c3                   	ret
+
+0000000000800043 <bench>:
+
+static uint64_t
+bench(const char *name, envid_t (*getid)(void))
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	41 56                	push   %r14
+  80004b:	41 55                	push   %r13
+  80004d:	41 54                	push   %r12
+  80004f:	53                   	push   %rbx
+  800050:	48 83 ec 08          	sub    $0x8,%rsp
+  800054:	49 89 ff             	mov    %rdi,%r15
+  800057:	49 89 f4             	mov    %rsi,%r12
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint32_t lo, hi;
+	asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  80005a:	0f 31                	rdtsc
+	return ((uint64_t) hi << 32) | lo;
+  80005c:	48 c1 e2 20          	shl    $0x20,%rdx
+  800060:	89 c0                	mov    %eax,%eax
+  800062:	48 09 c2             	or     %rax,%rdx
+  800065:	49 89 d6             	mov    %rdx,%r14
+	uint64_t start, cycles;
+	int i;
+
+	start = read_tsc();
+	for (i = 0; i < NCALLS; i++)
+  800068:	bb 11 27 00 00       	mov    $0x2711,%ebx
+		if (getid() != thisenv->env_id)
+  80006d:	49 bd 00 00 80 bc 00 	movabs $0xbc800000,%r13
+  800074:	00 00 00 
+	for (i = 0; i < NCALLS; i++)
+  800077:	83 eb 01             	sub    $0x1,%ebx
+  80007a:	74 58                	je     8000d4 <bench+0x91>
+		if (getid() != thisenv->env_id)
+  80007c:	41 ff d4             	call   *%r12
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  80007f:	65 8b 14 25 b8 00 00 	mov    %gs:0xb8,%edx
+  800086:	00 
+  800087:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80008d:	48 8d 0c d2          	lea    (%rdx,%rdx,8),%rcx
+  800091:	48 8d 14 4a          	lea    (%rdx,%rcx,2),%rdx
+  800095:	48 c1 e2 04          	shl    $0x4,%rdx
+  800099:	4c 01 ea             	add    %r13,%rdx
+  80009c:	8b 92 b8 00 00 00    	mov    0xb8(%rdx),%edx
+  8000a2:	39 d0                	cmp    %edx,%eax
+  8000a4:	74 d1                	je     800077 <bench+0x34>
+			panic("%s: wrong envid", name);
+  8000a6:	4c 89 f9             	mov    %r15,%rcx
+  8000a9:	48 ba c0 14 80 00 00 	movabs $0x8014c0,%rdx
+  8000b0:	00 00 00 
+  8000b3:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8000b8:	48 bf d0 14 80 00 00 	movabs $0x8014d0,%rdi
+  8000bf:	00 00 00 
+  8000c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c7:	49 b8 33 02 80 00 00 	movabs $0x800233,%r8
+  8000ce:	00 00 00 
+  8000d1:	41 ff d0             	call   *%r8
+	asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  8000d4:	0f 31                	rdtsc
+	return ((uint64_t) hi << 32) | lo;
+  8000d6:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000da:	89 c0                	mov    %eax,%eax
+  8000dc:	48 09 c2             	or     %rax,%rdx
+	cycles = (read_tsc() - start) / NCALLS;
+  8000df:	4c 29 f2             	sub    %r14,%rdx
+  8000e2:	48 b9 4b 59 86 38 d6 	movabs $0x346dc5d63886594b,%rcx
+  8000e9:	c5 6d 34 
+  8000ec:	48 89 d0             	mov    %rdx,%rax
+  8000ef:	48 f7 e1             	mul    %rcx
+  8000f2:	48 89 d3             	mov    %rdx,%rbx
+  8000f5:	48 c1 eb 0b          	shr    $0xb,%rbx
+	cprintf("nullsyscall: %s: %ld cycles per call\n", name, cycles);
+  8000f9:	48 89 da             	mov    %rbx,%rdx
+  8000fc:	4c 89 fe             	mov    %r15,%rsi
+  8000ff:	48 bf 00 15 80 00 00 	movabs $0x801500,%rdi
+  800106:	00 00 00 
+  800109:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010e:	48 b9 d2 03 80 00 00 	movabs $0x8003d2,%rcx
+  800115:	00 00 00 
+  800118:	ff d1                	call   *%rcx
+	return cycles;
+}
+  80011a:	48 89 d8             	mov    %rbx,%rax
+  80011d:	48 83 c4 08          	add    $0x8,%rsp
+  800121:	5b                   	pop    %rbx
+  800122:	41 5c                	pop    %r12
+  800124:	41 5d                	pop    %r13
+  800126:	41 5e                	pop    %r14
+  800128:	41 5f                	pop    %r15
+  80012a:	5d                   	pop    %rbp
+  80012b:	c3                   	ret
+
+000000000080012c <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80012c:	55                   	push   %rbp
+  80012d:	48 89 e5             	mov    %rsp,%rbp
+  800130:	41 55                	push   %r13
+  800132:	41 54                	push   %r12
+  800134:	53                   	push   %rbx
+  800135:	48 83 ec 08          	sub    $0x8,%rsp
+	uint64_t s, i;
+
+	i = bench("int", getenvid_int);
+  800139:	48 be 33 00 80 00 00 	movabs $0x800033,%rsi
+  800140:	00 00 00 
+  800143:	48 bf e3 14 80 00 00 	movabs $0x8014e3,%rdi
+  80014a:	00 00 00 
+  80014d:	49 bd 43 00 80 00 00 	movabs $0x800043,%r13
+  800154:	00 00 00 
+  800157:	41 ff d5             	call   *%r13
+  80015a:	48 89 c3             	mov    %rax,%rbx
+	s = bench("syscall", getenvid_syscall);
+  80015d:	48 be 3b 00 80 00 00 	movabs $0x80003b,%rsi
+  800164:	00 00 00 
+  800167:	48 bf e7 14 80 00 00 	movabs $0x8014e7,%rdi
+  80016e:	00 00 00 
+  800171:	41 ff d5             	call   *%r13
+  800174:	49 89 c4             	mov    %rax,%r12
+	bench("sys_getenvid", sys_getenvid);
+  800177:	48 be 0a 10 80 00 00 	movabs $0x80100a,%rsi
+  80017e:	00 00 00 
+  800181:	48 bf ef 14 80 00 00 	movabs $0x8014ef,%rdi
+  800188:	00 00 00 
+  80018b:	41 ff d5             	call   *%r13
+	cprintf("nullsyscall: SYSCALL saves %ld cycles per call\n", i - s);
+  80018e:	4c 29 e3             	sub    %r12,%rbx
+  800191:	48 89 de             	mov    %rbx,%rsi
+  800194:	48 bf 28 15 80 00 00 	movabs $0x801528,%rdi
+  80019b:	00 00 00 
+  80019e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a3:	49 bc d2 03 80 00 00 	movabs $0x8003d2,%r12
+  8001aa:	00 00 00 
+  8001ad:	41 ff d4             	call   *%r12
+	cprintf("nullsyscall: on CPU %d, %ld ns since boot\n", getcpu(), time_nsec());
+  8001b0:	48 b8 5f 14 80 00 00 	movabs $0x80145f,%rax
+  8001b7:	00 00 00 
+  8001ba:	ff d0                	call   *%rax
+  8001bc:	48 89 c3             	mov    %rax,%rbx
+  8001bf:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  8001c6:	00 00 00 
+  8001c9:	ff d0                	call   *%rax
+  8001cb:	89 c6                	mov    %eax,%esi
+  8001cd:	48 89 da             	mov    %rbx,%rdx
+  8001d0:	48 bf 58 15 80 00 00 	movabs $0x801558,%rdi
+  8001d7:	00 00 00 
+  8001da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001df:	41 ff d4             	call   *%r12
+}
+  8001e2:	48 83 c4 08          	add    $0x8,%rsp
+  8001e6:	5b                   	pop    %rbx
+  8001e7:	41 5c                	pop    %r12
+  8001e9:	41 5d                	pop    %r13
+  8001eb:	5d                   	pop    %rbp
+  8001ec:	c3                   	ret
+
+00000000008001ed <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  8001ed:	55                   	push   %rbp
+  8001ee:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001f1:	85 ff                	test   %edi,%edi
+  8001f3:	7e 0d                	jle    800202 <libmain+0x15>
+		binaryname = argv[0];
+  8001f5:	48 8b 06             	mov    (%rsi),%rax
+  8001f8:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  8001ff:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  800202:	48 b8 2c 01 80 00 00 	movabs $0x80012c,%rax
+  800209:	00 00 00 
+  80020c:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  80020e:	48 b8 1c 02 80 00 00 	movabs $0x80021c,%rax
+  800215:	00 00 00 
+  800218:	ff d0                	call   *%rax
+}
+  80021a:	5d                   	pop    %rbp
+  80021b:	c3                   	ret
+
+000000000080021c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80021c:	55                   	push   %rbp
+  80021d:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  800220:	bf 00 00 00 00       	mov    $0x0,%edi
+  800225:	48 b8 af 0f 80 00 00 	movabs $0x800faf,%rax
+  80022c:	00 00 00 
+  80022f:	ff d0                	call   *%rax
+}
+  800231:	5d                   	pop    %rbp
+  800232:	c3                   	ret
+
+0000000000800233 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800233:	55                   	push   %rbp
+  800234:	48 89 e5             	mov    %rsp,%rbp
+  800237:	41 56                	push   %r14
+  800239:	41 55                	push   %r13
+  80023b:	41 54                	push   %r12
+  80023d:	53                   	push   %rbx
+  80023e:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800245:	49 89 fc             	mov    %rdi,%r12
+  800248:	41 89 f5             	mov    %esi,%r13d
+  80024b:	48 89 d3             	mov    %rdx,%rbx
+  80024e:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800255:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80025c:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800263:	84 c0                	test   %al,%al
+  800265:	74 26                	je     80028d <_panic+0x5a>
+  800267:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  80026e:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800275:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800279:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  80027d:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800281:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800285:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800289:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80028d:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800294:	00 00 00 
+  800297:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  80029e:	00 00 00 
+  8002a1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002a5:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8002ac:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8002b3:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002ba:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  8002c1:	00 00 00 
+  8002c4:	4c 8b 30             	mov    (%rax),%r14
+  8002c7:	48 b8 0a 10 80 00 00 	movabs $0x80100a,%rax
+  8002ce:	00 00 00 
+  8002d1:	ff d0                	call   *%rax
+  8002d3:	89 c6                	mov    %eax,%esi
+  8002d5:	45 89 e8             	mov    %r13d,%r8d
+  8002d8:	4c 89 e1             	mov    %r12,%rcx
+  8002db:	4c 89 f2             	mov    %r14,%rdx
+  8002de:	48 bf 90 15 80 00 00 	movabs $0x801590,%rdi
+  8002e5:	00 00 00 
+  8002e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ed:	49 bc d2 03 80 00 00 	movabs $0x8003d2,%r12
+  8002f4:	00 00 00 
+  8002f7:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002fa:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  800301:	48 89 df             	mov    %rbx,%rdi
+  800304:	48 b8 6e 03 80 00 00 	movabs $0x80036e,%rax
+  80030b:	00 00 00 
+  80030e:	ff d0                	call   *%rax
+	cprintf("\n");
+  800310:	48 bf b3 15 80 00 00 	movabs $0x8015b3,%rdi
+  800317:	00 00 00 
+  80031a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031f:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800322:	cc                   	int3
+	while (1)
+  800323:	eb fd                	jmp    800322 <_panic+0xef>
+
+0000000000800325 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800325:	55                   	push   %rbp
+  800326:	48 89 e5             	mov    %rsp,%rbp
+  800329:	53                   	push   %rbx
+  80032a:	48 83 ec 08          	sub    $0x8,%rsp
+  80032e:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  800331:	8b 06                	mov    (%rsi),%eax
+  800333:	8d 50 01             	lea    0x1(%rax),%edx
+  800336:	89 16                	mov    %edx,(%rsi)
+  800338:	48 98                	cltq
+  80033a:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  80033f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800345:	74 0a                	je     800351 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800347:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80034b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80034f:	c9                   	leave
+  800350:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800351:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800355:	be ff 00 00 00       	mov    $0xff,%esi
+  80035a:	48 b8 77 0f 80 00 00 	movabs $0x800f77,%rax
+  800361:	00 00 00 
+  800364:	ff d0                	call   *%rax
+		b->idx = 0;
+  800366:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80036c:	eb d9                	jmp    800347 <putch+0x22>
+
+000000000080036e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80036e:	55                   	push   %rbp
+  80036f:	48 89 e5             	mov    %rsp,%rbp
+  800372:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800379:	48 89 fa             	mov    %rdi,%rdx
+  80037c:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  80037f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800386:	00 00 00 
+	b.cnt = 0;
+  800389:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800390:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800393:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  80039a:	48 bf 25 03 80 00 00 	movabs $0x800325,%rdi
+  8003a1:	00 00 00 
+  8003a4:	48 b8 8c 05 80 00 00 	movabs $0x80058c,%rax
+  8003ab:	00 00 00 
+  8003ae:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8003b0:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  8003b7:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8003be:	48 b8 77 0f 80 00 00 	movabs $0x800f77,%rax
+  8003c5:	00 00 00 
+  8003c8:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  8003ca:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  8003d0:	c9                   	leave
+  8003d1:	c3                   	ret
+
+00000000008003d2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8003d2:	55                   	push   %rbp
+  8003d3:	48 89 e5             	mov    %rsp,%rbp
+  8003d6:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8003dd:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8003e4:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8003eb:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8003f2:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8003f9:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800400:	84 c0                	test   %al,%al
+  800402:	74 20                	je     800424 <cprintf+0x52>
+  800404:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800408:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80040c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800410:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800414:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800418:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80041c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800420:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800424:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  80042b:	00 00 00 
+  80042e:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800435:	00 00 00 
+  800438:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80043c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800443:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80044a:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  800451:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  800458:	48 b8 6e 03 80 00 00 	movabs $0x80036e,%rax
+  80045f:	00 00 00 
+  800462:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  800464:	c9                   	leave
+  800465:	c3                   	ret
+
+0000000000800466 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800466:	55                   	push   %rbp
+  800467:	48 89 e5             	mov    %rsp,%rbp
+  80046a:	41 57                	push   %r15
+  80046c:	41 56                	push   %r14
+  80046e:	41 55                	push   %r13
+  800470:	41 54                	push   %r12
+  800472:	53                   	push   %rbx
+  800473:	48 83 ec 18          	sub    $0x18,%rsp
+  800477:	49 89 fc             	mov    %rdi,%r12
+  80047a:	49 89 f5             	mov    %rsi,%r13
+  80047d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800481:	44 89 c3             	mov    %r8d,%ebx
+  800484:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800487:	41 89 cf             	mov    %ecx,%r15d
+  80048a:	4c 39 fa             	cmp    %r15,%rdx
+  80048d:	72 29                	jb     8004b8 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80048f:	48 89 d0             	mov    %rdx,%rax
+  800492:	ba 00 00 00 00       	mov    $0x0,%edx
+  800497:	49 f7 f7             	div    %r15
+  80049a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80049e:	48 89 c2             	mov    %rax,%rdx
+  8004a1:	48 b8 66 04 80 00 00 	movabs $0x800466,%rax
+  8004a8:	00 00 00 
+  8004ab:	ff d0                	call   *%rax
+  8004ad:	eb 10                	jmp    8004bf <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8004af:	4c 89 ee             	mov    %r13,%rsi
+  8004b2:	44 89 f7             	mov    %r14d,%edi
+  8004b5:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  8004b8:	83 eb 01             	sub    $0x1,%ebx
+  8004bb:	85 db                	test   %ebx,%ebx
+  8004bd:	7f f0                	jg     8004af <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004bf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004c8:	49 f7 f7             	div    %r15
+  8004cb:	48 b8 b5 15 80 00 00 	movabs $0x8015b5,%rax
+  8004d2:	00 00 00 
+  8004d5:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  8004d9:	4c 89 ee             	mov    %r13,%rsi
+  8004dc:	41 ff d4             	call   *%r12
+}
+  8004df:	48 83 c4 18          	add    $0x18,%rsp
+  8004e3:	5b                   	pop    %rbx
+  8004e4:	41 5c                	pop    %r12
+  8004e6:	41 5d                	pop    %r13
+  8004e8:	41 5e                	pop    %r14
+  8004ea:	41 5f                	pop    %r15
+  8004ec:	5d                   	pop    %rbp
+  8004ed:	c3                   	ret
+
+00000000008004ee <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  8004ee:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  8004f2:	48 8b 06             	mov    (%rsi),%rax
+  8004f5:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004f9:	73 0a                	jae    800505 <sprintputch+0x17>
+		*b->buf++ = ch;
+  8004fb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004ff:	48 89 16             	mov    %rdx,(%rsi)
+  800502:	40 88 38             	mov    %dil,(%rax)
+}
+  800505:	c3                   	ret
+
+0000000000800506 <printfmt>:
+{
+  800506:	55                   	push   %rbp
+  800507:	48 89 e5             	mov    %rsp,%rbp
+  80050a:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800511:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800518:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80051f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800526:	84 c0                	test   %al,%al
+  800528:	74 20                	je     80054a <printfmt+0x44>
+  80052a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80052e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800532:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800536:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80053a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80053e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800542:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800546:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  80054a:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800551:	00 00 00 
+  800554:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80055b:	00 00 00 
+  80055e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800562:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800569:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800570:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800577:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  80057e:	48 b8 8c 05 80 00 00 	movabs $0x80058c,%rax
+  800585:	00 00 00 
+  800588:	ff d0                	call   *%rax
+}
+  80058a:	c9                   	leave
+  80058b:	c3                   	ret
+
+000000000080058c <vprintfmt>:
+{
+  80058c:	55                   	push   %rbp
+  80058d:	48 89 e5             	mov    %rsp,%rbp
+  800590:	41 57                	push   %r15
+  800592:	41 56                	push   %r14
+  800594:	41 55                	push   %r13
+  800596:	41 54                	push   %r12
+  800598:	53                   	push   %rbx
+  800599:	48 83 ec 48          	sub    $0x48,%rsp
+  80059d:	49 89 fe             	mov    %rdi,%r14
+  8005a0:	49 89 f5             	mov    %rsi,%r13
+  8005a3:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  8005a6:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  8005aa:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  8005ae:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8005b2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8005b6:	eb 09                	jmp    8005c1 <vprintfmt+0x35>
+			putch(ch, putdat);
+  8005b8:	4c 89 ee             	mov    %r13,%rsi
+  8005bb:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005be:	4c 89 e3             	mov    %r12,%rbx
+  8005c1:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8005c5:	0f b6 3b             	movzbl (%rbx),%edi
+  8005c8:	83 ff 25             	cmp    $0x25,%edi
+  8005cb:	74 13                	je     8005e0 <vprintfmt+0x54>
+			if (ch == '\0')
+  8005cd:	85 ff                	test   %edi,%edi
+  8005cf:	75 e7                	jne    8005b8 <vprintfmt+0x2c>
+}
+  8005d1:	48 83 c4 48          	add    $0x48,%rsp
+  8005d5:	5b                   	pop    %rbx
+  8005d6:	41 5c                	pop    %r12
+  8005d8:	41 5d                	pop    %r13
+  8005da:	41 5e                	pop    %r14
+  8005dc:	41 5f                	pop    %r15
+  8005de:	5d                   	pop    %rbp
+  8005df:	c3                   	ret
+		padc = ' ';
+  8005e0:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  8005e4:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  8005eb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  8005f1:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  8005f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005fd:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800602:	41 0f b6 14 24       	movzbl (%r12),%edx
+  800607:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  80060a:	3c 55                	cmp    $0x55,%al
+  80060c:	0f 87 4f 05 00 00    	ja     800b61 <vprintfmt+0x5d5>
+  800612:	0f b6 c0             	movzbl %al,%eax
+  800615:	48 be 80 16 80 00 00 	movabs $0x801680,%rsi
+  80061c:	00 00 00 
+  80061f:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  800622:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  800625:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  800629:	eb d2                	jmp    8005fd <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  80062b:	49 89 dc             	mov    %rbx,%r12
+  80062e:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  800632:	eb c9                	jmp    8005fd <vprintfmt+0x71>
+  800634:	0f b6 d2             	movzbl %dl,%edx
+  800637:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  80063a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  800640:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800644:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  800649:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  80064e:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  800651:	83 f8 09             	cmp    $0x9,%eax
+  800654:	77 20                	ja     800676 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  800656:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  80065a:	eb e4                	jmp    800640 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  80065c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80065f:	83 f8 2f             	cmp    $0x2f,%eax
+  800662:	77 27                	ja     80068b <vprintfmt+0xff>
+  800664:	89 c2                	mov    %eax,%edx
+  800666:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80066a:	83 c0 08             	add    $0x8,%eax
+  80066d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800670:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  800673:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  800676:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80067a:	79 81                	jns    8005fd <vprintfmt+0x71>
+				width = precision, precision = -1;
+  80067c:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  800680:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800686:	e9 72 ff ff ff       	jmp    8005fd <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  80068b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80068f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800693:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800697:	eb d7                	jmp    800670 <vprintfmt+0xe4>
+			if (width < 0)
+  800699:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  80069c:	85 f6                	test   %esi,%esi
+  80069e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a3:	0f 49 c6             	cmovns %esi,%eax
+  8006a6:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006a9:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8006ac:	e9 4c ff ff ff       	jmp    8005fd <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006b1:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  8006b4:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  8006bb:	e9 3d ff ff ff       	jmp    8005fd <vprintfmt+0x71>
+			lflag++;
+  8006c0:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8006c3:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8006c6:	e9 32 ff ff ff       	jmp    8005fd <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  8006cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d1:	77 19                	ja     8006ec <vprintfmt+0x160>
+  8006d3:	89 c2                	mov    %eax,%edx
+  8006d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006d9:	83 c0 08             	add    $0x8,%eax
+  8006dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006df:	8b 3a                	mov    (%rdx),%edi
+  8006e1:	4c 89 ee             	mov    %r13,%rsi
+  8006e4:	41 ff d6             	call   *%r14
+			break;
+  8006e7:	e9 d5 fe ff ff       	jmp    8005c1 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  8006ec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f8:	eb e5                	jmp    8006df <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  8006fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006fd:	83 f8 2f             	cmp    $0x2f,%eax
+  800700:	77 5a                	ja     80075c <vprintfmt+0x1d0>
+  800702:	89 c2                	mov    %eax,%edx
+  800704:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800708:	83 c0 08             	add    $0x8,%eax
+  80070b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  80070e:	8b 02                	mov    (%rdx),%eax
+  800710:	89 c1                	mov    %eax,%ecx
+  800712:	f7 d9                	neg    %ecx
+  800714:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800717:	83 f9 08             	cmp    $0x8,%ecx
+  80071a:	7f 4e                	jg     80076a <vprintfmt+0x1de>
+  80071c:	48 63 c1             	movslq %ecx,%rax
+  80071f:	48 ba 40 19 80 00 00 	movabs $0x801940,%rdx
+  800726:	00 00 00 
+  800729:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80072d:	48 85 c0             	test   %rax,%rax
+  800730:	74 38                	je     80076a <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800732:	48 89 c1             	mov    %rax,%rcx
+  800735:	48 ba d6 15 80 00 00 	movabs $0x8015d6,%rdx
+  80073c:	00 00 00 
+  80073f:	4c 89 ee             	mov    %r13,%rsi
+  800742:	4c 89 f7             	mov    %r14,%rdi
+  800745:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074a:	49 b8 06 05 80 00 00 	movabs $0x800506,%r8
+  800751:	00 00 00 
+  800754:	41 ff d0             	call   *%r8
+  800757:	e9 65 fe ff ff       	jmp    8005c1 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  80075c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800760:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800764:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800768:	eb a4                	jmp    80070e <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  80076a:	48 ba cd 15 80 00 00 	movabs $0x8015cd,%rdx
+  800771:	00 00 00 
+  800774:	4c 89 ee             	mov    %r13,%rsi
+  800777:	4c 89 f7             	mov    %r14,%rdi
+  80077a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077f:	49 b8 06 05 80 00 00 	movabs $0x800506,%r8
+  800786:	00 00 00 
+  800789:	41 ff d0             	call   *%r8
+  80078c:	e9 30 fe ff ff       	jmp    8005c1 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800791:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800794:	83 f8 2f             	cmp    $0x2f,%eax
+  800797:	77 36                	ja     8007cf <vprintfmt+0x243>
+  800799:	89 c2                	mov    %eax,%edx
+  80079b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80079f:	83 c0 08             	add    $0x8,%eax
+  8007a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a5:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  8007a8:	48 85 c9             	test   %rcx,%rcx
+  8007ab:	48 b8 c6 15 80 00 00 	movabs $0x8015c6,%rax
+  8007b2:	00 00 00 
+  8007b5:	48 0f 45 c1          	cmovne %rcx,%rax
+  8007b9:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  8007bd:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007c1:	7e 06                	jle    8007c9 <vprintfmt+0x23d>
+  8007c3:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  8007c7:	75 14                	jne    8007dd <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007c9:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8007cd:	eb 64                	jmp    800833 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  8007cf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007db:	eb c8                	jmp    8007a5 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007dd:	49 63 f7             	movslq %r15d,%rsi
+  8007e0:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  8007e4:	48 b8 6f 0c 80 00 00 	movabs $0x800c6f,%rax
+  8007eb:	00 00 00 
+  8007ee:	ff d0                	call   *%rax
+  8007f0:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007f3:	29 c1                	sub    %eax,%ecx
+  8007f5:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  8007f8:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  8007fb:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  8007ff:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800802:	eb 0d                	jmp    800811 <vprintfmt+0x285>
+					putch(padc, putdat);
+  800804:	4c 89 ee             	mov    %r13,%rsi
+  800807:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  80080a:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80080d:	41 83 ec 01          	sub    $0x1,%r12d
+  800811:	45 85 e4             	test   %r12d,%r12d
+  800814:	7f ee                	jg     800804 <vprintfmt+0x278>
+  800816:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  800819:	85 c9                	test   %ecx,%ecx
+  80081b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800820:	0f 49 c1             	cmovns %ecx,%eax
+  800823:	29 c1                	sub    %eax,%ecx
+  800825:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  800828:	eb 9f                	jmp    8007c9 <vprintfmt+0x23d>
+					putch(ch, putdat);
+  80082a:	4c 89 ee             	mov    %r13,%rsi
+  80082d:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800830:	4c 89 e2             	mov    %r12,%rdx
+  800833:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800837:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80083d:	0f be f8             	movsbl %al,%edi
+  800840:	85 ff                	test   %edi,%edi
+  800842:	74 29                	je     80086d <vprintfmt+0x2e1>
+  800844:	45 85 ff             	test   %r15d,%r15d
+  800847:	78 06                	js     80084f <vprintfmt+0x2c3>
+  800849:	41 83 ef 01          	sub    $0x1,%r15d
+  80084d:	78 1e                	js     80086d <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80084f:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800853:	74 d5                	je     80082a <vprintfmt+0x29e>
+  800855:	0f be c0             	movsbl %al,%eax
+  800858:	83 e8 20             	sub    $0x20,%eax
+  80085b:	83 f8 5e             	cmp    $0x5e,%eax
+  80085e:	76 ca                	jbe    80082a <vprintfmt+0x29e>
+					putch('?', putdat);
+  800860:	4c 89 ee             	mov    %r13,%rsi
+  800863:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800868:	41 ff d6             	call   *%r14
+  80086b:	eb c3                	jmp    800830 <vprintfmt+0x2a4>
+  80086d:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800871:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800874:	41 01 c4             	add    %eax,%r12d
+  800877:	41 29 d4             	sub    %edx,%r12d
+  80087a:	eb 0f                	jmp    80088b <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  80087c:	4c 89 ee             	mov    %r13,%rsi
+  80087f:	bf 20 00 00 00       	mov    $0x20,%edi
+  800884:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800887:	41 83 ec 01          	sub    $0x1,%r12d
+  80088b:	45 85 e4             	test   %r12d,%r12d
+  80088e:	7f ec                	jg     80087c <vprintfmt+0x2f0>
+  800890:	e9 2c fd ff ff       	jmp    8005c1 <vprintfmt+0x35>
+	if (lflag >= 2)
+  800895:	83 f9 01             	cmp    $0x1,%ecx
+  800898:	7f 1d                	jg     8008b7 <vprintfmt+0x32b>
+	else if (lflag)
+  80089a:	85 c9                	test   %ecx,%ecx
+  80089c:	74 5e                	je     8008fc <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  80089e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a4:	77 48                	ja     8008ee <vprintfmt+0x362>
+  8008a6:	89 c2                	mov    %eax,%edx
+  8008a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ac:	83 c0 08             	add    $0x8,%eax
+  8008af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b2:	4c 8b 22             	mov    (%rdx),%r12
+  8008b5:	eb 17                	jmp    8008ce <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  8008b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8008bd:	77 21                	ja     8008e0 <vprintfmt+0x354>
+  8008bf:	89 c2                	mov    %eax,%edx
+  8008c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c5:	83 c0 08             	add    $0x8,%eax
+  8008c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008cb:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  8008ce:	4d 85 e4             	test   %r12,%r12
+  8008d1:	78 50                	js     800923 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  8008d3:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  8008d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8008db:	e9 b4 01 00 00       	jmp    800a94 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  8008e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ec:	eb dd                	jmp    8008cb <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  8008ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fa:	eb b6                	jmp    8008b2 <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  8008fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ff:	83 f8 2f             	cmp    $0x2f,%eax
+  800902:	77 11                	ja     800915 <vprintfmt+0x389>
+  800904:	89 c2                	mov    %eax,%edx
+  800906:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090a:	83 c0 08             	add    $0x8,%eax
+  80090d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800910:	4c 63 22             	movslq (%rdx),%r12
+  800913:	eb b9                	jmp    8008ce <vprintfmt+0x342>
+  800915:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800919:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800921:	eb ed                	jmp    800910 <vprintfmt+0x384>
+				putch('-', putdat);
+  800923:	4c 89 ee             	mov    %r13,%rsi
+  800926:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80092b:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  80092e:	4c 89 e2             	mov    %r12,%rdx
+  800931:	48 f7 da             	neg    %rdx
+			base = 10;
+  800934:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800939:	e9 56 01 00 00       	jmp    800a94 <vprintfmt+0x508>
+	if (lflag >= 2)
+  80093e:	83 f9 01             	cmp    $0x1,%ecx
+  800941:	7f 25                	jg     800968 <vprintfmt+0x3dc>
+	else if (lflag)
+  800943:	85 c9                	test   %ecx,%ecx
+  800945:	74 5e                	je     8009a5 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800947:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094a:	83 f8 2f             	cmp    $0x2f,%eax
+  80094d:	77 48                	ja     800997 <vprintfmt+0x40b>
+  80094f:	89 c2                	mov    %eax,%edx
+  800951:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800955:	83 c0 08             	add    $0x8,%eax
+  800958:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095b:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  80095e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800963:	e9 2c 01 00 00       	jmp    800a94 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800968:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096b:	83 f8 2f             	cmp    $0x2f,%eax
+  80096e:	77 19                	ja     800989 <vprintfmt+0x3fd>
+  800970:	89 c2                	mov    %eax,%edx
+  800972:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800976:	83 c0 08             	add    $0x8,%eax
+  800979:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097c:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  80097f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800984:	e9 0b 01 00 00       	jmp    800a94 <vprintfmt+0x508>
+  800989:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80098d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800991:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800995:	eb e5                	jmp    80097c <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800997:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a3:	eb b6                	jmp    80095b <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  8009a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ab:	77 18                	ja     8009c5 <vprintfmt+0x439>
+  8009ad:	89 c2                	mov    %eax,%edx
+  8009af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b3:	83 c0 08             	add    $0x8,%eax
+  8009b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b9:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  8009bb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  8009c0:	e9 cf 00 00 00       	jmp    800a94 <vprintfmt+0x508>
+  8009c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d1:	eb e6                	jmp    8009b9 <vprintfmt+0x42d>
+	if (lflag >= 2)
+  8009d3:	83 f9 01             	cmp    $0x1,%ecx
+  8009d6:	7f 25                	jg     8009fd <vprintfmt+0x471>
+	else if (lflag)
+  8009d8:	85 c9                	test   %ecx,%ecx
+  8009da:	74 5b                	je     800a37 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  8009dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009df:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e2:	77 45                	ja     800a29 <vprintfmt+0x49d>
+  8009e4:	89 c2                	mov    %eax,%edx
+  8009e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ea:	83 c0 08             	add    $0x8,%eax
+  8009ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f0:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  8009f3:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  8009f8:	e9 97 00 00 00       	jmp    800a94 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8009fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a00:	83 f8 2f             	cmp    $0x2f,%eax
+  800a03:	77 16                	ja     800a1b <vprintfmt+0x48f>
+  800a05:	89 c2                	mov    %eax,%edx
+  800a07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0b:	83 c0 08             	add    $0x8,%eax
+  800a0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a11:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800a14:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800a19:	eb 79                	jmp    800a94 <vprintfmt+0x508>
+  800a1b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a27:	eb e8                	jmp    800a11 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800a29:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a31:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a35:	eb b9                	jmp    8009f0 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800a37:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a3a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3d:	77 15                	ja     800a54 <vprintfmt+0x4c8>
+  800a3f:	89 c2                	mov    %eax,%edx
+  800a41:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a45:	83 c0 08             	add    $0x8,%eax
+  800a48:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4b:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800a4d:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800a52:	eb 40                	jmp    800a94 <vprintfmt+0x508>
+  800a54:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a58:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a60:	eb e9                	jmp    800a4b <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800a62:	4c 89 ee             	mov    %r13,%rsi
+  800a65:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a6a:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800a6d:	4c 89 ee             	mov    %r13,%rsi
+  800a70:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a75:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800a78:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a7b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7e:	77 34                	ja     800ab4 <vprintfmt+0x528>
+  800a80:	89 c2                	mov    %eax,%edx
+  800a82:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a86:	83 c0 08             	add    $0x8,%eax
+  800a89:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800a8c:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800a8f:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800a94:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800a99:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a9d:	4c 89 ee             	mov    %r13,%rsi
+  800aa0:	4c 89 f7             	mov    %r14,%rdi
+  800aa3:	48 b8 66 04 80 00 00 	movabs $0x800466,%rax
+  800aaa:	00 00 00 
+  800aad:	ff d0                	call   *%rax
+			break;
+  800aaf:	e9 0d fb ff ff       	jmp    8005c1 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800ab4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800abc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac0:	eb ca                	jmp    800a8c <vprintfmt+0x500>
+	if (lflag >= 2)
+  800ac2:	83 f9 01             	cmp    $0x1,%ecx
+  800ac5:	7f 22                	jg     800ae9 <vprintfmt+0x55d>
+	else if (lflag)
+  800ac7:	85 c9                	test   %ecx,%ecx
+  800ac9:	74 58                	je     800b23 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800acb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ace:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad1:	77 42                	ja     800b15 <vprintfmt+0x589>
+  800ad3:	89 c2                	mov    %eax,%edx
+  800ad5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad9:	83 c0 08             	add    $0x8,%eax
+  800adc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800adf:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800ae2:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800ae7:	eb ab                	jmp    800a94 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800ae9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aec:	83 f8 2f             	cmp    $0x2f,%eax
+  800aef:	77 16                	ja     800b07 <vprintfmt+0x57b>
+  800af1:	89 c2                	mov    %eax,%edx
+  800af3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af7:	83 c0 08             	add    $0x8,%eax
+  800afa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800afd:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800b00:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800b05:	eb 8d                	jmp    800a94 <vprintfmt+0x508>
+  800b07:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b0b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b13:	eb e8                	jmp    800afd <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800b15:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b19:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b21:	eb bc                	jmp    800adf <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800b23:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b26:	83 f8 2f             	cmp    $0x2f,%eax
+  800b29:	77 18                	ja     800b43 <vprintfmt+0x5b7>
+  800b2b:	89 c2                	mov    %eax,%edx
+  800b2d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b31:	83 c0 08             	add    $0x8,%eax
+  800b34:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b37:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800b39:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800b3e:	e9 51 ff ff ff       	jmp    800a94 <vprintfmt+0x508>
+  800b43:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b47:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b4b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b4f:	eb e6                	jmp    800b37 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800b51:	4c 89 ee             	mov    %r13,%rsi
+  800b54:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b59:	41 ff d6             	call   *%r14
+			break;
+  800b5c:	e9 60 fa ff ff       	jmp    8005c1 <vprintfmt+0x35>
+			putch('%', putdat);
+  800b61:	4c 89 ee             	mov    %r13,%rsi
+  800b64:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b69:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b6c:	4c 89 e3             	mov    %r12,%rbx
+  800b6f:	eb 04                	jmp    800b75 <vprintfmt+0x5e9>
+  800b71:	48 83 eb 01          	sub    $0x1,%rbx
+  800b75:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b79:	75 f6                	jne    800b71 <vprintfmt+0x5e5>
+  800b7b:	e9 41 fa ff ff       	jmp    8005c1 <vprintfmt+0x35>
+
+0000000000800b80 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b80:	55                   	push   %rbp
+  800b81:	48 89 e5             	mov    %rsp,%rbp
+  800b84:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b88:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800b8c:	48 63 c6             	movslq %esi,%rax
+  800b8f:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800b94:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800b98:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800b9f:	48 85 ff             	test   %rdi,%rdi
+  800ba2:	74 2a                	je     800bce <vsnprintf+0x4e>
+  800ba4:	85 f6                	test   %esi,%esi
+  800ba6:	7e 26                	jle    800bce <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800ba8:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800bac:	48 bf ee 04 80 00 00 	movabs $0x8004ee,%rdi
+  800bb3:	00 00 00 
+  800bb6:	48 b8 8c 05 80 00 00 	movabs $0x80058c,%rax
+  800bbd:	00 00 00 
+  800bc0:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800bc2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800bc6:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800bc9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800bcc:	c9                   	leave
+  800bcd:	c3                   	ret
+		return -E_INVAL;
+  800bce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bd3:	eb f7                	jmp    800bcc <vsnprintf+0x4c>
+
+0000000000800bd5 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800bd5:	55                   	push   %rbp
+  800bd6:	48 89 e5             	mov    %rsp,%rbp
+  800bd9:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800be0:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800be7:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800bee:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800bf5:	84 c0                	test   %al,%al
+  800bf7:	74 20                	je     800c19 <snprintf+0x44>
+  800bf9:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800bfd:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800c01:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800c05:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800c09:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800c0d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800c11:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800c15:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800c19:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800c20:	00 00 00 
+  800c23:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800c2a:	00 00 00 
+  800c2d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c31:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800c38:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800c3f:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800c46:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800c4d:	48 b8 80 0b 80 00 00 	movabs $0x800b80,%rax
+  800c54:	00 00 00 
+  800c57:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800c59:	c9                   	leave
+  800c5a:	c3                   	ret
+
+0000000000800c5b <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800c5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c60:	48 89 d0             	mov    %rdx,%rax
+  800c63:	48 83 c2 01          	add    $0x1,%rdx
+  800c67:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800c6c:	75 f2                	jne    800c60 <strlen+0x5>
+		n++;
+	return n;
+}
+  800c6e:	c3                   	ret
+
+0000000000800c6f <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c74:	eb 03                	jmp    800c79 <strnlen+0xa>
+  800c76:	48 89 d0             	mov    %rdx,%rax
+  800c79:	48 39 c6             	cmp    %rax,%rsi
+  800c7c:	74 0a                	je     800c88 <strnlen+0x19>
+  800c7e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c82:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c86:	75 ee                	jne    800c76 <strnlen+0x7>
+		n++;
+	return n;
+}
+  800c88:	c3                   	ret
+
+0000000000800c89 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800c89:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800c8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c91:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c95:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c98:	48 83 c2 01          	add    $0x1,%rdx
+  800c9c:	84 c9                	test   %cl,%cl
+  800c9e:	75 f1                	jne    800c91 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800ca0:	c3                   	ret
+
+0000000000800ca1 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800ca1:	55                   	push   %rbp
+  800ca2:	48 89 e5             	mov    %rsp,%rbp
+  800ca5:	41 54                	push   %r12
+  800ca7:	53                   	push   %rbx
+  800ca8:	48 89 fb             	mov    %rdi,%rbx
+  800cab:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800cae:	48 b8 5b 0c 80 00 00 	movabs $0x800c5b,%rax
+  800cb5:	00 00 00 
+  800cb8:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800cba:	48 63 f8             	movslq %eax,%rdi
+  800cbd:	48 01 df             	add    %rbx,%rdi
+  800cc0:	4c 89 e6             	mov    %r12,%rsi
+  800cc3:	48 b8 89 0c 80 00 00 	movabs $0x800c89,%rax
+  800cca:	00 00 00 
+  800ccd:	ff d0                	call   *%rax
+	return dst;
+}
+  800ccf:	48 89 d8             	mov    %rbx,%rax
+  800cd2:	5b                   	pop    %rbx
+  800cd3:	41 5c                	pop    %r12
+  800cd5:	5d                   	pop    %rbp
+  800cd6:	c3                   	ret
+
+0000000000800cd7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cd7:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800cda:	48 01 fa             	add    %rdi,%rdx
+  800cdd:	48 89 f9             	mov    %rdi,%rcx
+  800ce0:	eb 14                	jmp    800cf6 <strncpy+0x1f>
+		*dst++ = *src;
+  800ce2:	48 83 c1 01          	add    $0x1,%rcx
+  800ce6:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800cea:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800cee:	41 80 f8 01          	cmp    $0x1,%r8b
+  800cf2:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800cf6:	48 39 d1             	cmp    %rdx,%rcx
+  800cf9:	75 e7                	jne    800ce2 <strncpy+0xb>
+	}
+	return ret;
+}
+  800cfb:	c3                   	ret
+
+0000000000800cfc <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800cfc:	48 89 f8             	mov    %rdi,%rax
+  800cff:	48 85 d2             	test   %rdx,%rdx
+  800d02:	74 27                	je     800d2b <strlcpy+0x2f>
+  800d04:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800d09:	48 89 fa             	mov    %rdi,%rdx
+  800d0c:	eb 0b                	jmp    800d19 <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800d0e:	48 83 c6 01          	add    $0x1,%rsi
+  800d12:	48 83 c2 01          	add    $0x1,%rdx
+  800d16:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800d19:	48 39 c2             	cmp    %rax,%rdx
+  800d1c:	74 0a                	je     800d28 <strlcpy+0x2c>
+  800d1e:	0f b6 0e             	movzbl (%rsi),%ecx
+  800d21:	84 c9                	test   %cl,%cl
+  800d23:	75 e9                	jne    800d0e <strlcpy+0x12>
+  800d25:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800d28:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800d2b:	48 29 f8             	sub    %rdi,%rax
+}
+  800d2e:	c3                   	ret
+
+0000000000800d2f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800d2f:	eb 08                	jmp    800d39 <strcmp+0xa>
+		p++, q++;
+  800d31:	48 83 c7 01          	add    $0x1,%rdi
+  800d35:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800d39:	0f b6 07             	movzbl (%rdi),%eax
+  800d3c:	84 c0                	test   %al,%al
+  800d3e:	74 04                	je     800d44 <strcmp+0x15>
+  800d40:	3a 06                	cmp    (%rsi),%al
+  800d42:	74 ed                	je     800d31 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d44:	0f b6 c0             	movzbl %al,%eax
+  800d47:	0f b6 16             	movzbl (%rsi),%edx
+  800d4a:	29 d0                	sub    %edx,%eax
+}
+  800d4c:	c3                   	ret
+
+0000000000800d4d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800d4d:	eb 0c                	jmp    800d5b <strncmp+0xe>
+		n--, p++, q++;
+  800d4f:	48 83 ea 01          	sub    $0x1,%rdx
+  800d53:	48 83 c7 01          	add    $0x1,%rdi
+  800d57:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800d5b:	48 85 d2             	test   %rdx,%rdx
+  800d5e:	74 14                	je     800d74 <strncmp+0x27>
+  800d60:	0f b6 07             	movzbl (%rdi),%eax
+  800d63:	84 c0                	test   %al,%al
+  800d65:	74 04                	je     800d6b <strncmp+0x1e>
+  800d67:	3a 06                	cmp    (%rsi),%al
+  800d69:	74 e4                	je     800d4f <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d6b:	0f b6 07             	movzbl (%rdi),%eax
+  800d6e:	0f b6 16             	movzbl (%rsi),%edx
+  800d71:	29 d0                	sub    %edx,%eax
+}
+  800d73:	c3                   	ret
+		return 0;
+  800d74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d79:	c3                   	ret
+
+0000000000800d7a <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800d7a:	eb 04                	jmp    800d80 <strchr+0x6>
+  800d7c:	48 83 c7 01          	add    $0x1,%rdi
+  800d80:	0f b6 07             	movzbl (%rdi),%eax
+  800d83:	84 c0                	test   %al,%al
+  800d85:	74 09                	je     800d90 <strchr+0x16>
+		if (*s == c)
+  800d87:	40 38 f0             	cmp    %sil,%al
+  800d8a:	75 f0                	jne    800d7c <strchr+0x2>
+  800d8c:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800d8f:	c3                   	ret
+	return 0;
+  800d90:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d95:	c3                   	ret
+
+0000000000800d96 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d96:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800d99:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800d9c:	40 38 f2             	cmp    %sil,%dl
+  800d9f:	74 0a                	je     800dab <strfind+0x15>
+  800da1:	84 d2                	test   %dl,%dl
+  800da3:	74 06                	je     800dab <strfind+0x15>
+	for (; *s; s++)
+  800da5:	48 83 c0 01          	add    $0x1,%rax
+  800da9:	eb ee                	jmp    800d99 <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800dab:	c3                   	ret
+
+0000000000800dac <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800dac:	48 85 d2             	test   %rdx,%rdx
+  800daf:	74 28                	je     800dd9 <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800db1:	48 89 f8             	mov    %rdi,%rax
+  800db4:	48 09 d0             	or     %rdx,%rax
+  800db7:	a8 03                	test   $0x3,%al
+  800db9:	75 16                	jne    800dd1 <memset+0x25>
+		c &= 0xFF;
+  800dbb:	40 0f b6 f6          	movzbl %sil,%esi
+  800dbf:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800dc5:	48 89 d1             	mov    %rdx,%rcx
+  800dc8:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800dcc:	fc                   	cld
+  800dcd:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800dcf:	eb 08                	jmp    800dd9 <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800dd1:	89 f0                	mov    %esi,%eax
+  800dd3:	48 89 d1             	mov    %rdx,%rcx
+  800dd6:	fc                   	cld
+  800dd7:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800dd9:	48 89 f8             	mov    %rdi,%rax
+  800ddc:	c3                   	ret
+
+0000000000800ddd <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ddd:	48 89 f8             	mov    %rdi,%rax
+  800de0:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800de3:	48 39 fe             	cmp    %rdi,%rsi
+  800de6:	73 3a                	jae    800e22 <memmove+0x45>
+  800de8:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800dec:	48 39 d7             	cmp    %rdx,%rdi
+  800def:	73 31                	jae    800e22 <memmove+0x45>
+		s += n;
+		d += n;
+  800df1:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800df5:	48 89 d6             	mov    %rdx,%rsi
+  800df8:	48 09 fe             	or     %rdi,%rsi
+  800dfb:	48 09 ce             	or     %rcx,%rsi
+  800dfe:	40 f6 c6 03          	test   $0x3,%sil
+  800e02:	75 11                	jne    800e15 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800e04:	48 83 ef 04          	sub    $0x4,%rdi
+  800e08:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800e0c:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800e10:	fd                   	std
+  800e11:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800e13:	eb 0b                	jmp    800e20 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800e15:	48 83 ef 01          	sub    $0x1,%rdi
+  800e19:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800e1d:	fd                   	std
+  800e1e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800e20:	fc                   	cld
+  800e21:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800e22:	48 89 f2             	mov    %rsi,%rdx
+  800e25:	48 09 c2             	or     %rax,%rdx
+  800e28:	48 09 ca             	or     %rcx,%rdx
+  800e2b:	f6 c2 03             	test   $0x3,%dl
+  800e2e:	75 0b                	jne    800e3b <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800e30:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800e34:	48 89 c7             	mov    %rax,%rdi
+  800e37:	fc                   	cld
+  800e38:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800e3a:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800e3b:	48 89 c7             	mov    %rax,%rdi
+  800e3e:	fc                   	cld
+  800e3f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800e41:	c3                   	ret
+
+0000000000800e42 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800e42:	55                   	push   %rbp
+  800e43:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800e46:	48 b8 dd 0d 80 00 00 	movabs $0x800ddd,%rax
+  800e4d:	00 00 00 
+  800e50:	ff d0                	call   *%rax
+}
+  800e52:	5d                   	pop    %rbp
+  800e53:	c3                   	ret
+
+0000000000800e54 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800e54:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e59:	48 39 c2             	cmp    %rax,%rdx
+  800e5c:	74 1e                	je     800e7c <memcmp+0x28>
+		if (*s1 != *s2)
+  800e5e:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e62:	48 83 c0 01          	add    $0x1,%rax
+  800e66:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800e6c:	44 38 c1             	cmp    %r8b,%cl
+  800e6f:	74 e8                	je     800e59 <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800e71:	0f b6 c1             	movzbl %cl,%eax
+  800e74:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e78:	44 29 c0             	sub    %r8d,%eax
+  800e7b:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800e7c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e81:	c3                   	ret
+
+0000000000800e82 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e82:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800e85:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800e88:	eb 04                	jmp    800e8e <memfind+0xc>
+  800e8a:	48 83 c0 01          	add    $0x1,%rax
+  800e8e:	48 39 d0             	cmp    %rdx,%rax
+  800e91:	73 05                	jae    800e98 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e93:	40 38 30             	cmp    %sil,(%rax)
+  800e96:	75 f2                	jne    800e8a <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800e98:	c3                   	ret
+
+0000000000800e99 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e99:	48 89 f9             	mov    %rdi,%rcx
+  800e9c:	49 89 f0             	mov    %rsi,%r8
+  800e9f:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ea1:	eb 04                	jmp    800ea7 <strtol+0xe>
+		s++;
+  800ea3:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800ea7:	0f b6 01             	movzbl (%rcx),%eax
+  800eaa:	3c 20                	cmp    $0x20,%al
+  800eac:	74 f5                	je     800ea3 <strtol+0xa>
+  800eae:	3c 09                	cmp    $0x9,%al
+  800eb0:	74 f1                	je     800ea3 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800eb2:	3c 2b                	cmp    $0x2b,%al
+  800eb4:	74 2b                	je     800ee1 <strtol+0x48>
+	int neg = 0;
+  800eb6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800ebc:	3c 2d                	cmp    $0x2d,%al
+  800ebe:	74 2d                	je     800eed <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ec0:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800ec6:	75 0f                	jne    800ed7 <strtol+0x3e>
+  800ec8:	80 39 30             	cmpb   $0x30,(%rcx)
+  800ecb:	74 2c                	je     800ef9 <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ecd:	85 ff                	test   %edi,%edi
+  800ecf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ed4:	0f 44 f8             	cmove  %eax,%edi
+  800ed7:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800edc:	4c 63 d7             	movslq %edi,%r10
+  800edf:	eb 4f                	jmp    800f30 <strtol+0x97>
+		s++;
+  800ee1:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800ee5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800eeb:	eb d3                	jmp    800ec0 <strtol+0x27>
+		s++, neg = 1;
+  800eed:	48 83 c1 01          	add    $0x1,%rcx
+  800ef1:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800ef7:	eb c7                	jmp    800ec0 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ef9:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800efd:	74 0f                	je     800f0e <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800eff:	85 ff                	test   %edi,%edi
+  800f01:	75 d4                	jne    800ed7 <strtol+0x3e>
+		s++, base = 8;
+  800f03:	48 83 c1 01          	add    $0x1,%rcx
+  800f07:	bf 08 00 00 00       	mov    $0x8,%edi
+  800f0c:	eb c9                	jmp    800ed7 <strtol+0x3e>
+		s += 2, base = 16;
+  800f0e:	48 83 c1 02          	add    $0x2,%rcx
+  800f12:	bf 10 00 00 00       	mov    $0x10,%edi
+  800f17:	eb be                	jmp    800ed7 <strtol+0x3e>
+			dig = *s - '0';
+  800f19:	0f be c0             	movsbl %al,%eax
+  800f1c:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800f1f:	39 f8                	cmp    %edi,%eax
+  800f21:	7d 3b                	jge    800f5e <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800f23:	48 83 c1 01          	add    $0x1,%rcx
+  800f27:	49 0f af d2          	imul   %r10,%rdx
+  800f2b:	48 98                	cltq
+  800f2d:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800f30:	0f b6 01             	movzbl (%rcx),%eax
+  800f33:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800f36:	40 80 fe 09          	cmp    $0x9,%sil
+  800f3a:	76 dd                	jbe    800f19 <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800f3c:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800f3f:	40 80 fe 19          	cmp    $0x19,%sil
+  800f43:	77 08                	ja     800f4d <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800f45:	0f be c0             	movsbl %al,%eax
+  800f48:	83 e8 57             	sub    $0x57,%eax
+  800f4b:	eb d2                	jmp    800f1f <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f4d:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800f50:	40 80 fe 19          	cmp    $0x19,%sil
+  800f54:	77 08                	ja     800f5e <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800f56:	0f be c0             	movsbl %al,%eax
+  800f59:	83 e8 37             	sub    $0x37,%eax
+  800f5c:	eb c1                	jmp    800f1f <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800f5e:	4d 85 c0             	test   %r8,%r8
+  800f61:	74 03                	je     800f66 <strtol+0xcd>
+		*endptr = (char *) s;
+  800f63:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800f66:	48 89 d0             	mov    %rdx,%rax
+  800f69:	48 f7 d8             	neg    %rax
+  800f6c:	45 85 c9             	test   %r9d,%r9d
+  800f6f:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800f73:	48 89 d0             	mov    %rdx,%rax
+  800f76:	c3                   	ret
+
+0000000000800f77 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800f77:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f7d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800f83:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f88:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8d:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800f8f:	c3                   	ret
+
+0000000000800f90 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800f90:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f96:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fa1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fa6:	48 89 fe             	mov    %rdi,%rsi
+  800fa9:	48 89 fa             	mov    %rdi,%rdx
+  800fac:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800fae:	c3                   	ret
+
+0000000000800faf <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800faf:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800fb2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fb8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fbe:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc3:	b8 03 00 00 00       	mov    $0x3,%eax
+  800fc8:	48 89 f2             	mov    %rsi,%rdx
+  800fcb:	0f 05                	syscall
+	if(check && ret > 0)
+  800fcd:	48 85 c0             	test   %rax,%rax
+  800fd0:	7f 01                	jg     800fd3 <sys_env_destroy+0x24>
+}
+  800fd2:	c3                   	ret
+{
+  800fd3:	55                   	push   %rbp
+  800fd4:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd7:	49 89 c0             	mov    %rax,%r8
+  800fda:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fdf:	48 ba 88 19 80 00 00 	movabs $0x801988,%rdx
+  800fe6:	00 00 00 
+  800fe9:	be 28 00 00 00       	mov    $0x28,%esi
+  800fee:	48 bf a5 19 80 00 00 	movabs $0x8019a5,%rdi
+  800ff5:	00 00 00 
+  800ff8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ffd:	49 b9 33 02 80 00 00 	movabs $0x800233,%r9
+  801004:	00 00 00 
+  801007:	41 ff d1             	call   *%r9
+
+000000000080100a <sys_getenvid>:
+  80100a:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  801011:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  801012:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801017:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80101b:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80101f:	48 c1 e2 04          	shl    $0x4,%rdx
+  801023:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  80102a:	00 00 00 
+  80102d:	48 01 d0             	add    %rdx,%rax
+  801030:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  801036:	c3                   	ret
+
+0000000000801037 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  801037:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80103d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801043:	bf 00 00 00 00       	mov    $0x0,%edi
+  801048:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80104d:	48 89 fe             	mov    %rdi,%rsi
+  801050:	48 89 fa             	mov    %rdi,%rdx
+  801053:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801055:	c3                   	ret
+
+0000000000801056 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  801056:	48 63 d2             	movslq %edx,%rdx
+  801059:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80105c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801062:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801068:	b8 04 00 00 00       	mov    $0x4,%eax
+  80106d:	0f 05                	syscall
+	if(check && ret > 0)
+  80106f:	48 85 c0             	test   %rax,%rax
+  801072:	7f 01                	jg     801075 <sys_page_alloc+0x1f>
+}
+  801074:	c3                   	ret
+{
+  801075:	55                   	push   %rbp
+  801076:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801079:	49 89 c0             	mov    %rax,%r8
+  80107c:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801081:	48 ba 88 19 80 00 00 	movabs $0x801988,%rdx
+  801088:	00 00 00 
+  80108b:	be 28 00 00 00       	mov    $0x28,%esi
+  801090:	48 bf a5 19 80 00 00 	movabs $0x8019a5,%rdi
+  801097:	00 00 00 
+  80109a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80109f:	49 b9 33 02 80 00 00 	movabs $0x800233,%r9
+  8010a6:	00 00 00 
+  8010a9:	41 ff d1             	call   *%r9
+
+00000000008010ac <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8010ac:	48 63 d2             	movslq %edx,%rdx
+  8010af:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8010b2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010be:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010c3:	0f 05                	syscall
+	if(check && ret > 0)
+  8010c5:	48 85 c0             	test   %rax,%rax
+  8010c8:	7f 01                	jg     8010cb <sys_page_alloc_huge+0x1f>
+}
+  8010ca:	c3                   	ret
+{
+  8010cb:	55                   	push   %rbp
+  8010cc:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010cf:	49 89 c0             	mov    %rax,%r8
+  8010d2:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8010d7:	48 ba 88 19 80 00 00 	movabs $0x801988,%rdx
+  8010de:	00 00 00 
+  8010e1:	be 28 00 00 00       	mov    $0x28,%esi
+  8010e6:	48 bf a5 19 80 00 00 	movabs $0x8019a5,%rdi
+  8010ed:	00 00 00 
+  8010f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f5:	49 b9 33 02 80 00 00 	movabs $0x800233,%r9
+  8010fc:	00 00 00 
+  8010ff:	41 ff d1             	call   *%r9
+
+0000000000801102 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801102:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  801105:	48 63 d2             	movslq %edx,%rdx
+  801108:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  80110b:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  80110e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801113:	0f 05                	syscall
+	if(check && ret > 0)
+  801115:	48 85 c0             	test   %rax,%rax
+  801118:	7f 01                	jg     80111b <sys_page_map+0x19>
+}
+  80111a:	c3                   	ret
+{
+  80111b:	55                   	push   %rbp
+  80111c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80111f:	49 89 c0             	mov    %rax,%r8
+  801122:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801127:	48 ba 88 19 80 00 00 	movabs $0x801988,%rdx
+  80112e:	00 00 00 
+  801131:	be 28 00 00 00       	mov    $0x28,%esi
+  801136:	48 bf a5 19 80 00 00 	movabs $0x8019a5,%rdi
+  80113d:	00 00 00 
+  801140:	b8 00 00 00 00       	mov    $0x0,%eax
+  801145:	49 b9 33 02 80 00 00 	movabs $0x800233,%r9
+  80114c:	00 00 00 
+  80114f:	41 ff d1             	call   *%r9
+
+0000000000801152 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  801152:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801155:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80115b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801161:	ba 00 00 00 00       	mov    $0x0,%edx
+  801166:	b8 06 00 00 00       	mov    $0x6,%eax
+  80116b:	0f 05                	syscall
+	if(check && ret > 0)
+  80116d:	48 85 c0             	test   %rax,%rax
+  801170:	7f 01                	jg     801173 <sys_page_unmap+0x21>
+}
+  801172:	c3                   	ret
+{
+  801173:	55                   	push   %rbp
+  801174:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801177:	49 89 c0             	mov    %rax,%r8
+  80117a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80117f:	48 ba 88 19 80 00 00 	movabs $0x801988,%rdx
+  801186:	00 00 00 
+  801189:	be 28 00 00 00       	mov    $0x28,%esi
+  80118e:	48 bf a5 19 80 00 00 	movabs $0x8019a5,%rdi
+  801195:	00 00 00 
+  801198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80119d:	49 b9 33 02 80 00 00 	movabs $0x800233,%r9
+  8011a4:	00 00 00 
+  8011a7:	41 ff d1             	call   *%r9
+
+00000000008011aa <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  8011aa:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011bb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011c0:	48 89 fe             	mov    %rdi,%rsi
+  8011c3:	48 89 fa             	mov    %rdi,%rdx
+  8011c6:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8011c8:	c3                   	ret
+
+00000000008011c9 <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  8011c9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011da:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011df:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  8011e1:	c3                   	ret
+
+00000000008011e2 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  8011e2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011ee:	b8 11 00 00 00       	mov    $0x11,%eax
+  8011f3:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  8011f5:	c3                   	ret
+
+00000000008011f6 <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  8011f6:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  8011f9:	48 63 f6             	movslq %esi,%rsi
+  8011fc:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  8011ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801205:	b8 12 00 00 00       	mov    $0x12,%eax
+  80120a:	0f 05                	syscall
+	if(check && ret > 0)
+  80120c:	48 85 c0             	test   %rax,%rax
+  80120f:	7f 01                	jg     801212 <sys_page_batch+0x1c>
+}
+  801211:	c3                   	ret
+{
+  801212:	55                   	push   %rbp
+  801213:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801216:	49 89 c0             	mov    %rax,%r8
+  801219:	b9 12 00 00 00       	mov    $0x12,%ecx
+  80121e:	48 ba 88 19 80 00 00 	movabs $0x801988,%rdx
+  801225:	00 00 00 
+  801228:	be 28 00 00 00       	mov    $0x28,%esi
+  80122d:	48 bf a5 19 80 00 00 	movabs $0x8019a5,%rdi
+  801234:	00 00 00 
+  801237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123c:	49 b9 33 02 80 00 00 	movabs $0x800233,%r9
+  801243:	00 00 00 
+  801246:	41 ff d1             	call   *%r9
+
+0000000000801249 <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  801249:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80124f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801255:	be 00 00 00 00       	mov    $0x0,%esi
+  80125a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80125f:	48 89 f2             	mov    %rsi,%rdx
+  801262:	0f 05                	syscall
+	if(check && ret > 0)
+  801264:	48 85 c0             	test   %rax,%rax
+  801267:	7f 01                	jg     80126a <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  801269:	c3                   	ret
+{
+  80126a:	55                   	push   %rbp
+  80126b:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80126e:	49 89 c0             	mov    %rax,%r8
+  801271:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801276:	48 ba 88 19 80 00 00 	movabs $0x801988,%rdx
+  80127d:	00 00 00 
+  801280:	be 28 00 00 00       	mov    $0x28,%esi
+  801285:	48 bf a5 19 80 00 00 	movabs $0x8019a5,%rdi
+  80128c:	00 00 00 
+  80128f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801294:	49 b9 33 02 80 00 00 	movabs $0x800233,%r9
+  80129b:	00 00 00 
+  80129e:	41 ff d1             	call   *%r9
+
+00000000008012a1 <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  8012a1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8012a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8012ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012b2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012b7:	48 89 fe             	mov    %rdi,%rsi
+  8012ba:	48 89 fa             	mov    %rdi,%rdx
+  8012bd:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8012bf:	c3                   	ret
+
+00000000008012c0 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  8012c0:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8012c3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8012c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8012cf:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012d4:	0f 05                	syscall
+	if(check && ret > 0)
+  8012d6:	48 85 c0             	test   %rax,%rax
+  8012d9:	7f 01                	jg     8012dc <sys_page_unmap_range+0x1c>
+}
+  8012db:	c3                   	ret
+{
+  8012dc:	55                   	push   %rbp
+  8012dd:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012e0:	49 89 c0             	mov    %rax,%r8
+  8012e3:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8012e8:	48 ba 88 19 80 00 00 	movabs $0x801988,%rdx
+  8012ef:	00 00 00 
+  8012f2:	be 28 00 00 00       	mov    $0x28,%esi
+  8012f7:	48 bf a5 19 80 00 00 	movabs $0x8019a5,%rdi
+  8012fe:	00 00 00 
+  801301:	b8 00 00 00 00       	mov    $0x0,%eax
+  801306:	49 b9 33 02 80 00 00 	movabs $0x800233,%r9
+  80130d:	00 00 00 
+  801310:	41 ff d1             	call   *%r9
+
+0000000000801313 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801313:	48 63 f6             	movslq %esi,%rsi
+  801316:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801319:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80131f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801325:	ba 00 00 00 00       	mov    $0x0,%edx
+  80132a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80132f:	0f 05                	syscall
+	if(check && ret > 0)
+  801331:	48 85 c0             	test   %rax,%rax
+  801334:	7f 01                	jg     801337 <sys_env_set_status+0x24>
+}
+  801336:	c3                   	ret
+{
+  801337:	55                   	push   %rbp
+  801338:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80133b:	49 89 c0             	mov    %rax,%r8
+  80133e:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801343:	48 ba 88 19 80 00 00 	movabs $0x801988,%rdx
+  80134a:	00 00 00 
+  80134d:	be 28 00 00 00       	mov    $0x28,%esi
+  801352:	48 bf a5 19 80 00 00 	movabs $0x8019a5,%rdi
+  801359:	00 00 00 
+  80135c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801361:	49 b9 33 02 80 00 00 	movabs $0x800233,%r9
+  801368:	00 00 00 
+  80136b:	41 ff d1             	call   *%r9
+
+000000000080136e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80136e:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801371:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801377:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80137d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801382:	b8 09 00 00 00       	mov    $0x9,%eax
+  801387:	0f 05                	syscall
+	if(check && ret > 0)
+  801389:	48 85 c0             	test   %rax,%rax
+  80138c:	7f 01                	jg     80138f <sys_env_set_pgfault_upcall+0x21>
+}
+  80138e:	c3                   	ret
+{
+  80138f:	55                   	push   %rbp
+  801390:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801393:	49 89 c0             	mov    %rax,%r8
+  801396:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80139b:	48 ba 88 19 80 00 00 	movabs $0x801988,%rdx
+  8013a2:	00 00 00 
+  8013a5:	be 28 00 00 00       	mov    $0x28,%esi
+  8013aa:	48 bf a5 19 80 00 00 	movabs $0x8019a5,%rdi
+  8013b1:	00 00 00 
+  8013b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b9:	49 b9 33 02 80 00 00 	movabs $0x800233,%r9
+  8013c0:	00 00 00 
+  8013c3:	41 ff d1             	call   *%r9
+
+00000000008013c6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8013c6:	48 63 ff             	movslq %edi,%rdi
+  8013c9:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  8013cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8013d2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8013d7:	0f 05                	syscall
+}
+  8013d9:	c3                   	ret
+
+00000000008013da <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  8013da:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8013e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8013e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013f0:	48 89 f2             	mov    %rsi,%rdx
+  8013f3:	0f 05                	syscall
+	if(check && ret > 0)
+  8013f5:	48 85 c0             	test   %rax,%rax
+  8013f8:	7f 01                	jg     8013fb <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  8013fa:	c3                   	ret
+{
+  8013fb:	55                   	push   %rbp
+  8013fc:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013ff:	49 89 c0             	mov    %rax,%r8
+  801402:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801407:	48 ba 88 19 80 00 00 	movabs $0x801988,%rdx
+  80140e:	00 00 00 
+  801411:	be 28 00 00 00       	mov    $0x28,%esi
+  801416:	48 bf a5 19 80 00 00 	movabs $0x8019a5,%rdi
+  80141d:	00 00 00 
+  801420:	b8 00 00 00 00       	mov    $0x0,%eax
+  801425:	49 b9 33 02 80 00 00 	movabs $0x800233,%r9
+  80142c:	00 00 00 
+  80142f:	41 ff d1             	call   *%r9
+
+0000000000801432 <getcpu>:
+  801432:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  801439:	00 
+// The CPU this env is running on.  It may have moved on by the time
+// the caller looks at the answer.
+int
+getcpu(void)
+{
+	return thisenv->env_cpunum;
+  80143a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80143f:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801443:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801447:	48 c1 e2 04          	shl    $0x4,%rdx
+  80144b:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801452:	00 00 00 
+  801455:	48 01 d0             	add    %rdx,%rax
+  801458:	8b 80 cc 00 00 00    	mov    0xcc(%rax),%eax
+}
+  80145e:	c3                   	ret
+
+000000000080145f <time_nsec>:
+// to tick at the same rate on every CPU.  Returns 0 if the kernel
+// couldn't measure the TSC's rate.
+uint64_t
+time_nsec(void)
+{
+	uint64_t hz = uinfo.ui_tsc_hz;
+  80145f:	48 b8 00 f0 9f bc 00 	movabs $0xbc9ff000,%rax
+  801466:	00 00 00 
+  801469:	48 8b 30             	mov    (%rax),%rsi
+	uint64_t t;
+
+	if (hz == 0)
+  80146c:	48 85 f6             	test   %rsi,%rsi
+  80146f:	74 42                	je     8014b3 <time_nsec+0x54>
+	asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  801471:	0f 31                	rdtsc
+  801473:	89 c1                	mov    %eax,%ecx
+		return 0;
+	t = read_tsc() - uinfo.ui_boot_tsc;
+  801475:	48 a1 08 f0 9f bc 00 	movabs 0xbc9ff008,%rax
+  80147c:	00 00 00 
+	return ((uint64_t) hi << 32) | lo;
+  80147f:	48 c1 e2 20          	shl    $0x20,%rdx
+  801483:	89 c9                	mov    %ecx,%ecx
+  801485:	48 09 ca             	or     %rcx,%rdx
+  801488:	48 29 c2             	sub    %rax,%rdx
+	return t / hz * 1000000000 + t % hz * 1000000000 / hz;
+  80148b:	48 89 d0             	mov    %rdx,%rax
+  80148e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801493:	48 f7 f6             	div    %rsi
+  801496:	48 89 c1             	mov    %rax,%rcx
+  801499:	48 69 c2 00 ca 9a 3b 	imul   $0x3b9aca00,%rdx,%rax
+  8014a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a5:	48 f7 f6             	div    %rsi
+  8014a8:	48 69 d1 00 ca 9a 3b 	imul   $0x3b9aca00,%rcx,%rdx
+  8014af:	48 8d 34 10          	lea    (%rax,%rdx,1),%rsi
+}
+  8014b3:	48 89 f0             	mov    %rsi,%rax
+  8014b6:	c3                   	ret
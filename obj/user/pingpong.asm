@@ -0,0 +1,3396 @@
+
+obj/user/pingpong:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 02 01 00 00       	call   800133 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	41 57                	push   %r15
+  800039:	41 56                	push   %r14
+  80003b:	41 55                	push   %r13
+  80003d:	41 54                	push   %r12
+  80003f:	53                   	push   %rbx
+  800040:	48 83 ec 18          	sub    $0x18,%rsp
+	envid_t who;
+
+	if ((who = fork()) != 0) {
+  800044:	48 b8 30 15 80 00 00 	movabs $0x801530,%rax
+  80004b:	00 00 00 
+  80004e:	ff d0                	call   *%rax
+  800050:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800053:	85 c0                	test   %eax,%eax
+  800055:	0f 85 88 00 00 00    	jne    8000e3 <umain+0xb0>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+		ipc_send(who, 0, 0, 0);
+	}
+
+	while (1) {
+		uint32_t i = ipc_recv(&who, 0, 0);
+  80005b:	49 bf 63 1a 80 00 00 	movabs $0x801a63,%r15
+  800062:	00 00 00 
+		cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  800065:	49 be 5e 0e 80 00 00 	movabs $0x800e5e,%r14
+  80006c:	00 00 00 
+  80006f:	49 bd 26 02 80 00 00 	movabs $0x800226,%r13
+  800076:	00 00 00 
+		uint32_t i = ipc_recv(&who, 0, 0);
+  800079:	ba 00 00 00 00       	mov    $0x0,%edx
+  80007e:	be 00 00 00 00       	mov    $0x0,%esi
+  800083:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  800087:	41 ff d7             	call   *%r15
+  80008a:	89 c3                	mov    %eax,%ebx
+		cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  80008c:	44 8b 65 cc          	mov    -0x34(%rbp),%r12d
+  800090:	41 ff d6             	call   *%r14
+  800093:	89 c6                	mov    %eax,%esi
+  800095:	44 89 e1             	mov    %r12d,%ecx
+  800098:	89 da                	mov    %ebx,%edx
+  80009a:	48 bf 56 1e 80 00 00 	movabs $0x801e56,%rdi
+  8000a1:	00 00 00 
+  8000a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a9:	41 ff d5             	call   *%r13
+		if (i == 10)
+  8000ac:	83 fb 0a             	cmp    $0xa,%ebx
+  8000af:	74 23                	je     8000d4 <umain+0xa1>
+			return;
+		i++;
+  8000b1:	83 c3 01             	add    $0x1,%ebx
+		ipc_send(who, i, 0, 0);
+  8000b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000be:	89 de                	mov    %ebx,%esi
+  8000c0:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8000c3:	48 b8 46 1b 80 00 00 	movabs $0x801b46,%rax
+  8000ca:	00 00 00 
+  8000cd:	ff d0                	call   *%rax
+		if (i == 10)
+  8000cf:	83 fb 0a             	cmp    $0xa,%ebx
+  8000d2:	75 a5                	jne    800079 <umain+0x46>
+			return;
+	}
+
+}
+  8000d4:	48 83 c4 18          	add    $0x18,%rsp
+  8000d8:	5b                   	pop    %rbx
+  8000d9:	41 5c                	pop    %r12
+  8000db:	41 5d                	pop    %r13
+  8000dd:	41 5e                	pop    %r14
+  8000df:	41 5f                	pop    %r15
+  8000e1:	5d                   	pop    %rbp
+  8000e2:	c3                   	ret
+  8000e3:	89 c3                	mov    %eax,%ebx
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  8000e5:	48 b8 5e 0e 80 00 00 	movabs $0x800e5e,%rax
+  8000ec:	00 00 00 
+  8000ef:	ff d0                	call   *%rax
+  8000f1:	89 c6                	mov    %eax,%esi
+  8000f3:	89 da                	mov    %ebx,%edx
+  8000f5:	48 bf 40 1e 80 00 00 	movabs $0x801e40,%rdi
+  8000fc:	00 00 00 
+  8000ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800104:	48 b9 26 02 80 00 00 	movabs $0x800226,%rcx
+  80010b:	00 00 00 
+  80010e:	ff d1                	call   *%rcx
+		ipc_send(who, 0, 0, 0);
+  800110:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800115:	ba 00 00 00 00       	mov    $0x0,%edx
+  80011a:	be 00 00 00 00       	mov    $0x0,%esi
+  80011f:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800122:	48 b8 46 1b 80 00 00 	movabs $0x801b46,%rax
+  800129:	00 00 00 
+  80012c:	ff d0                	call   *%rax
+  80012e:	e9 28 ff ff ff       	jmp    80005b <umain+0x28>
+
+0000000000800133 <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  800133:	55                   	push   %rbp
+  800134:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800137:	85 ff                	test   %edi,%edi
+  800139:	7e 0d                	jle    800148 <libmain+0x15>
+		binaryname = argv[0];
+  80013b:	48 8b 06             	mov    (%rsi),%rax
+  80013e:	48 a3 00 30 80 00 00 	movabs %rax,0x803000
+  800145:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  800148:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  80014f:	00 00 00 
+  800152:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800154:	48 b8 62 01 80 00 00 	movabs $0x800162,%rax
+  80015b:	00 00 00 
+  80015e:	ff d0                	call   *%rax
+}
+  800160:	5d                   	pop    %rbp
+  800161:	c3                   	ret
+
+0000000000800162 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800162:	55                   	push   %rbp
+  800163:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  800166:	bf 00 00 00 00       	mov    $0x0,%edi
+  80016b:	48 b8 03 0e 80 00 00 	movabs $0x800e03,%rax
+  800172:	00 00 00 
+  800175:	ff d0                	call   *%rax
+}
+  800177:	5d                   	pop    %rbp
+  800178:	c3                   	ret
+
+0000000000800179 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800179:	55                   	push   %rbp
+  80017a:	48 89 e5             	mov    %rsp,%rbp
+  80017d:	53                   	push   %rbx
+  80017e:	48 83 ec 08          	sub    $0x8,%rsp
+  800182:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  800185:	8b 06                	mov    (%rsi),%eax
+  800187:	8d 50 01             	lea    0x1(%rax),%edx
+  80018a:	89 16                	mov    %edx,(%rsi)
+  80018c:	48 98                	cltq
+  80018e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  800193:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800199:	74 0a                	je     8001a5 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80019b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80019f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001a3:	c9                   	leave
+  8001a4:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001a5:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001a9:	be ff 00 00 00       	mov    $0xff,%esi
+  8001ae:	48 b8 cb 0d 80 00 00 	movabs $0x800dcb,%rax
+  8001b5:	00 00 00 
+  8001b8:	ff d0                	call   *%rax
+		b->idx = 0;
+  8001ba:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001c0:	eb d9                	jmp    80019b <putch+0x22>
+
+00000000008001c2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001c2:	55                   	push   %rbp
+  8001c3:	48 89 e5             	mov    %rsp,%rbp
+  8001c6:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8001cd:	48 89 fa             	mov    %rdi,%rdx
+  8001d0:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  8001d3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8001da:	00 00 00 
+	b.cnt = 0;
+  8001dd:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8001e4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001e7:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  8001ee:	48 bf 79 01 80 00 00 	movabs $0x800179,%rdi
+  8001f5:	00 00 00 
+  8001f8:	48 b8 e0 03 80 00 00 	movabs $0x8003e0,%rax
+  8001ff:	00 00 00 
+  800202:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  800204:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  80020b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800212:	48 b8 cb 0d 80 00 00 	movabs $0x800dcb,%rax
+  800219:	00 00 00 
+  80021c:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  80021e:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  800224:	c9                   	leave
+  800225:	c3                   	ret
+
+0000000000800226 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800226:	55                   	push   %rbp
+  800227:	48 89 e5             	mov    %rsp,%rbp
+  80022a:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800231:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800238:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80023f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800246:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80024d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800254:	84 c0                	test   %al,%al
+  800256:	74 20                	je     800278 <cprintf+0x52>
+  800258:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80025c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800260:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800264:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800268:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80026c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800270:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800274:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800278:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  80027f:	00 00 00 
+  800282:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800289:	00 00 00 
+  80028c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800290:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800297:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80029e:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  8002a5:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  8002ac:	48 b8 c2 01 80 00 00 	movabs $0x8001c2,%rax
+  8002b3:	00 00 00 
+  8002b6:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  8002b8:	c9                   	leave
+  8002b9:	c3                   	ret
+
+00000000008002ba <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002ba:	55                   	push   %rbp
+  8002bb:	48 89 e5             	mov    %rsp,%rbp
+  8002be:	41 57                	push   %r15
+  8002c0:	41 56                	push   %r14
+  8002c2:	41 55                	push   %r13
+  8002c4:	41 54                	push   %r12
+  8002c6:	53                   	push   %rbx
+  8002c7:	48 83 ec 18          	sub    $0x18,%rsp
+  8002cb:	49 89 fc             	mov    %rdi,%r12
+  8002ce:	49 89 f5             	mov    %rsi,%r13
+  8002d1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002d5:	44 89 c3             	mov    %r8d,%ebx
+  8002d8:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002db:	41 89 cf             	mov    %ecx,%r15d
+  8002de:	4c 39 fa             	cmp    %r15,%rdx
+  8002e1:	72 29                	jb     80030c <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002e3:	48 89 d0             	mov    %rdx,%rax
+  8002e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002eb:	49 f7 f7             	div    %r15
+  8002ee:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002f2:	48 89 c2             	mov    %rax,%rdx
+  8002f5:	48 b8 ba 02 80 00 00 	movabs $0x8002ba,%rax
+  8002fc:	00 00 00 
+  8002ff:	ff d0                	call   *%rax
+  800301:	eb 10                	jmp    800313 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800303:	4c 89 ee             	mov    %r13,%rsi
+  800306:	44 89 f7             	mov    %r14d,%edi
+  800309:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  80030c:	83 eb 01             	sub    $0x1,%ebx
+  80030f:	85 db                	test   %ebx,%ebx
+  800311:	7f f0                	jg     800303 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800313:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800317:	ba 00 00 00 00       	mov    $0x0,%edx
+  80031c:	49 f7 f7             	div    %r15
+  80031f:	48 b8 73 1e 80 00 00 	movabs $0x801e73,%rax
+  800326:	00 00 00 
+  800329:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  80032d:	4c 89 ee             	mov    %r13,%rsi
+  800330:	41 ff d4             	call   *%r12
+}
+  800333:	48 83 c4 18          	add    $0x18,%rsp
+  800337:	5b                   	pop    %rbx
+  800338:	41 5c                	pop    %r12
+  80033a:	41 5d                	pop    %r13
+  80033c:	41 5e                	pop    %r14
+  80033e:	41 5f                	pop    %r15
+  800340:	5d                   	pop    %rbp
+  800341:	c3                   	ret
+
+0000000000800342 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  800342:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  800346:	48 8b 06             	mov    (%rsi),%rax
+  800349:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80034d:	73 0a                	jae    800359 <sprintputch+0x17>
+		*b->buf++ = ch;
+  80034f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800353:	48 89 16             	mov    %rdx,(%rsi)
+  800356:	40 88 38             	mov    %dil,(%rax)
+}
+  800359:	c3                   	ret
+
+000000000080035a <printfmt>:
+{
+  80035a:	55                   	push   %rbp
+  80035b:	48 89 e5             	mov    %rsp,%rbp
+  80035e:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800365:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80036c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800373:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80037a:	84 c0                	test   %al,%al
+  80037c:	74 20                	je     80039e <printfmt+0x44>
+  80037e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800382:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800386:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80038a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80038e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800392:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800396:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80039a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  80039e:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8003a5:	00 00 00 
+  8003a8:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8003af:	00 00 00 
+  8003b2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003b6:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8003bd:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8003c4:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8003cb:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8003d2:	48 b8 e0 03 80 00 00 	movabs $0x8003e0,%rax
+  8003d9:	00 00 00 
+  8003dc:	ff d0                	call   *%rax
+}
+  8003de:	c9                   	leave
+  8003df:	c3                   	ret
+
+00000000008003e0 <vprintfmt>:
+{
+  8003e0:	55                   	push   %rbp
+  8003e1:	48 89 e5             	mov    %rsp,%rbp
+  8003e4:	41 57                	push   %r15
+  8003e6:	41 56                	push   %r14
+  8003e8:	41 55                	push   %r13
+  8003ea:	41 54                	push   %r12
+  8003ec:	53                   	push   %rbx
+  8003ed:	48 83 ec 48          	sub    $0x48,%rsp
+  8003f1:	49 89 fe             	mov    %rdi,%r14
+  8003f4:	49 89 f5             	mov    %rsi,%r13
+  8003f7:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  8003fa:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  8003fe:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  800402:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800406:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80040a:	eb 09                	jmp    800415 <vprintfmt+0x35>
+			putch(ch, putdat);
+  80040c:	4c 89 ee             	mov    %r13,%rsi
+  80040f:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800412:	4c 89 e3             	mov    %r12,%rbx
+  800415:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800419:	0f b6 3b             	movzbl (%rbx),%edi
+  80041c:	83 ff 25             	cmp    $0x25,%edi
+  80041f:	74 13                	je     800434 <vprintfmt+0x54>
+			if (ch == '\0')
+  800421:	85 ff                	test   %edi,%edi
+  800423:	75 e7                	jne    80040c <vprintfmt+0x2c>
+}
+  800425:	48 83 c4 48          	add    $0x48,%rsp
+  800429:	5b                   	pop    %rbx
+  80042a:	41 5c                	pop    %r12
+  80042c:	41 5d                	pop    %r13
+  80042e:	41 5e                	pop    %r14
+  800430:	41 5f                	pop    %r15
+  800432:	5d                   	pop    %rbp
+  800433:	c3                   	ret
+		padc = ' ';
+  800434:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  800438:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  80043f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  800445:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  80044c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800451:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800456:	41 0f b6 14 24       	movzbl (%r12),%edx
+  80045b:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  80045e:	3c 55                	cmp    $0x55,%al
+  800460:	0f 87 4f 05 00 00    	ja     8009b5 <vprintfmt+0x5d5>
+  800466:	0f b6 c0             	movzbl %al,%eax
+  800469:	48 be 40 1f 80 00 00 	movabs $0x801f40,%rsi
+  800470:	00 00 00 
+  800473:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  800476:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  800479:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  80047d:	eb d2                	jmp    800451 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  80047f:	49 89 dc             	mov    %rbx,%r12
+  800482:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  800486:	eb c9                	jmp    800451 <vprintfmt+0x71>
+  800488:	0f b6 d2             	movzbl %dl,%edx
+  80048b:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  80048e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  800494:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800498:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  80049d:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  8004a2:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  8004a5:	83 f8 09             	cmp    $0x9,%eax
+  8004a8:	77 20                	ja     8004ca <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  8004aa:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  8004ae:	eb e4                	jmp    800494 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  8004b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8004b6:	77 27                	ja     8004df <vprintfmt+0xff>
+  8004b8:	89 c2                	mov    %eax,%edx
+  8004ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004be:	83 c0 08             	add    $0x8,%eax
+  8004c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004c4:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  8004c7:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  8004ca:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004ce:	79 81                	jns    800451 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  8004d0:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  8004d4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004da:	e9 72 ff ff ff       	jmp    800451 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  8004df:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004e3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004eb:	eb d7                	jmp    8004c4 <vprintfmt+0xe4>
+			if (width < 0)
+  8004ed:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  8004f0:	85 f6                	test   %esi,%esi
+  8004f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f7:	0f 49 c6             	cmovns %esi,%eax
+  8004fa:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004fd:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800500:	e9 4c ff ff ff       	jmp    800451 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800505:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  800508:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  80050f:	e9 3d ff ff ff       	jmp    800451 <vprintfmt+0x71>
+			lflag++;
+  800514:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800517:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  80051a:	e9 32 ff ff ff       	jmp    800451 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  80051f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800522:	83 f8 2f             	cmp    $0x2f,%eax
+  800525:	77 19                	ja     800540 <vprintfmt+0x160>
+  800527:	89 c2                	mov    %eax,%edx
+  800529:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80052d:	83 c0 08             	add    $0x8,%eax
+  800530:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800533:	8b 3a                	mov    (%rdx),%edi
+  800535:	4c 89 ee             	mov    %r13,%rsi
+  800538:	41 ff d6             	call   *%r14
+			break;
+  80053b:	e9 d5 fe ff ff       	jmp    800415 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  800540:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800544:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800548:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80054c:	eb e5                	jmp    800533 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  80054e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800551:	83 f8 2f             	cmp    $0x2f,%eax
+  800554:	77 5a                	ja     8005b0 <vprintfmt+0x1d0>
+  800556:	89 c2                	mov    %eax,%edx
+  800558:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80055c:	83 c0 08             	add    $0x8,%eax
+  80055f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800562:	8b 02                	mov    (%rdx),%eax
+  800564:	89 c1                	mov    %eax,%ecx
+  800566:	f7 d9                	neg    %ecx
+  800568:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80056b:	83 f9 08             	cmp    $0x8,%ecx
+  80056e:	7f 4e                	jg     8005be <vprintfmt+0x1de>
+  800570:	48 63 c1             	movslq %ecx,%rax
+  800573:	48 ba 00 22 80 00 00 	movabs $0x802200,%rdx
+  80057a:	00 00 00 
+  80057d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800581:	48 85 c0             	test   %rax,%rax
+  800584:	74 38                	je     8005be <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800586:	48 89 c1             	mov    %rax,%rcx
+  800589:	48 ba 94 1e 80 00 00 	movabs $0x801e94,%rdx
+  800590:	00 00 00 
+  800593:	4c 89 ee             	mov    %r13,%rsi
+  800596:	4c 89 f7             	mov    %r14,%rdi
+  800599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80059e:	49 b8 5a 03 80 00 00 	movabs $0x80035a,%r8
+  8005a5:	00 00 00 
+  8005a8:	41 ff d0             	call   *%r8
+  8005ab:	e9 65 fe ff ff       	jmp    800415 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  8005b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005bc:	eb a4                	jmp    800562 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  8005be:	48 ba 8b 1e 80 00 00 	movabs $0x801e8b,%rdx
+  8005c5:	00 00 00 
+  8005c8:	4c 89 ee             	mov    %r13,%rsi
+  8005cb:	4c 89 f7             	mov    %r14,%rdi
+  8005ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d3:	49 b8 5a 03 80 00 00 	movabs $0x80035a,%r8
+  8005da:	00 00 00 
+  8005dd:	41 ff d0             	call   *%r8
+  8005e0:	e9 30 fe ff ff       	jmp    800415 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  8005e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8005eb:	77 36                	ja     800623 <vprintfmt+0x243>
+  8005ed:	89 c2                	mov    %eax,%edx
+  8005ef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005f3:	83 c0 08             	add    $0x8,%eax
+  8005f6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005f9:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  8005fc:	48 85 c9             	test   %rcx,%rcx
+  8005ff:	48 b8 84 1e 80 00 00 	movabs $0x801e84,%rax
+  800606:	00 00 00 
+  800609:	48 0f 45 c1          	cmovne %rcx,%rax
+  80060d:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800611:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800615:	7e 06                	jle    80061d <vprintfmt+0x23d>
+  800617:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  80061b:	75 14                	jne    800631 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80061d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800621:	eb 64                	jmp    800687 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800623:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800627:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80062b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80062f:	eb c8                	jmp    8005f9 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800631:	49 63 f7             	movslq %r15d,%rsi
+  800634:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800638:	48 b8 c3 0a 80 00 00 	movabs $0x800ac3,%rax
+  80063f:	00 00 00 
+  800642:	ff d0                	call   *%rax
+  800644:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800647:	29 c1                	sub    %eax,%ecx
+  800649:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  80064c:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  80064f:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800653:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800656:	eb 0d                	jmp    800665 <vprintfmt+0x285>
+					putch(padc, putdat);
+  800658:	4c 89 ee             	mov    %r13,%rsi
+  80065b:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  80065e:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800661:	41 83 ec 01          	sub    $0x1,%r12d
+  800665:	45 85 e4             	test   %r12d,%r12d
+  800668:	7f ee                	jg     800658 <vprintfmt+0x278>
+  80066a:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  80066d:	85 c9                	test   %ecx,%ecx
+  80066f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800674:	0f 49 c1             	cmovns %ecx,%eax
+  800677:	29 c1                	sub    %eax,%ecx
+  800679:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  80067c:	eb 9f                	jmp    80061d <vprintfmt+0x23d>
+					putch(ch, putdat);
+  80067e:	4c 89 ee             	mov    %r13,%rsi
+  800681:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800684:	4c 89 e2             	mov    %r12,%rdx
+  800687:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  80068b:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800691:	0f be f8             	movsbl %al,%edi
+  800694:	85 ff                	test   %edi,%edi
+  800696:	74 29                	je     8006c1 <vprintfmt+0x2e1>
+  800698:	45 85 ff             	test   %r15d,%r15d
+  80069b:	78 06                	js     8006a3 <vprintfmt+0x2c3>
+  80069d:	41 83 ef 01          	sub    $0x1,%r15d
+  8006a1:	78 1e                	js     8006c1 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006a3:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  8006a7:	74 d5                	je     80067e <vprintfmt+0x29e>
+  8006a9:	0f be c0             	movsbl %al,%eax
+  8006ac:	83 e8 20             	sub    $0x20,%eax
+  8006af:	83 f8 5e             	cmp    $0x5e,%eax
+  8006b2:	76 ca                	jbe    80067e <vprintfmt+0x29e>
+					putch('?', putdat);
+  8006b4:	4c 89 ee             	mov    %r13,%rsi
+  8006b7:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006bc:	41 ff d6             	call   *%r14
+  8006bf:	eb c3                	jmp    800684 <vprintfmt+0x2a4>
+  8006c1:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  8006c5:	8b 45 98             	mov    -0x68(%rbp),%eax
+  8006c8:	41 01 c4             	add    %eax,%r12d
+  8006cb:	41 29 d4             	sub    %edx,%r12d
+  8006ce:	eb 0f                	jmp    8006df <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  8006d0:	4c 89 ee             	mov    %r13,%rsi
+  8006d3:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006d8:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  8006db:	41 83 ec 01          	sub    $0x1,%r12d
+  8006df:	45 85 e4             	test   %r12d,%r12d
+  8006e2:	7f ec                	jg     8006d0 <vprintfmt+0x2f0>
+  8006e4:	e9 2c fd ff ff       	jmp    800415 <vprintfmt+0x35>
+	if (lflag >= 2)
+  8006e9:	83 f9 01             	cmp    $0x1,%ecx
+  8006ec:	7f 1d                	jg     80070b <vprintfmt+0x32b>
+	else if (lflag)
+  8006ee:	85 c9                	test   %ecx,%ecx
+  8006f0:	74 5e                	je     800750 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  8006f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8006f8:	77 48                	ja     800742 <vprintfmt+0x362>
+  8006fa:	89 c2                	mov    %eax,%edx
+  8006fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800700:	83 c0 08             	add    $0x8,%eax
+  800703:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800706:	4c 8b 22             	mov    (%rdx),%r12
+  800709:	eb 17                	jmp    800722 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  80070b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80070e:	83 f8 2f             	cmp    $0x2f,%eax
+  800711:	77 21                	ja     800734 <vprintfmt+0x354>
+  800713:	89 c2                	mov    %eax,%edx
+  800715:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800719:	83 c0 08             	add    $0x8,%eax
+  80071c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80071f:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800722:	4d 85 e4             	test   %r12,%r12
+  800725:	78 50                	js     800777 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  800727:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  80072a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80072f:	e9 b4 01 00 00       	jmp    8008e8 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800734:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800738:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80073c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800740:	eb dd                	jmp    80071f <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800742:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800746:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80074a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80074e:	eb b6                	jmp    800706 <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800750:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800753:	83 f8 2f             	cmp    $0x2f,%eax
+  800756:	77 11                	ja     800769 <vprintfmt+0x389>
+  800758:	89 c2                	mov    %eax,%edx
+  80075a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80075e:	83 c0 08             	add    $0x8,%eax
+  800761:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800764:	4c 63 22             	movslq (%rdx),%r12
+  800767:	eb b9                	jmp    800722 <vprintfmt+0x342>
+  800769:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80076d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800771:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800775:	eb ed                	jmp    800764 <vprintfmt+0x384>
+				putch('-', putdat);
+  800777:	4c 89 ee             	mov    %r13,%rsi
+  80077a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80077f:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800782:	4c 89 e2             	mov    %r12,%rdx
+  800785:	48 f7 da             	neg    %rdx
+			base = 10;
+  800788:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80078d:	e9 56 01 00 00       	jmp    8008e8 <vprintfmt+0x508>
+	if (lflag >= 2)
+  800792:	83 f9 01             	cmp    $0x1,%ecx
+  800795:	7f 25                	jg     8007bc <vprintfmt+0x3dc>
+	else if (lflag)
+  800797:	85 c9                	test   %ecx,%ecx
+  800799:	74 5e                	je     8007f9 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  80079b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80079e:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a1:	77 48                	ja     8007eb <vprintfmt+0x40b>
+  8007a3:	89 c2                	mov    %eax,%edx
+  8007a5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a9:	83 c0 08             	add    $0x8,%eax
+  8007ac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007af:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8007b2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  8007b7:	e9 2c 01 00 00       	jmp    8008e8 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8007bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c2:	77 19                	ja     8007dd <vprintfmt+0x3fd>
+  8007c4:	89 c2                	mov    %eax,%edx
+  8007c6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ca:	83 c0 08             	add    $0x8,%eax
+  8007cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d0:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8007d3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  8007d8:	e9 0b 01 00 00       	jmp    8008e8 <vprintfmt+0x508>
+  8007dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e9:	eb e5                	jmp    8007d0 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  8007eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f7:	eb b6                	jmp    8007af <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  8007f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ff:	77 18                	ja     800819 <vprintfmt+0x439>
+  800801:	89 c2                	mov    %eax,%edx
+  800803:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800807:	83 c0 08             	add    $0x8,%eax
+  80080a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080d:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  80080f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800814:	e9 cf 00 00 00       	jmp    8008e8 <vprintfmt+0x508>
+  800819:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80081d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800821:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800825:	eb e6                	jmp    80080d <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800827:	83 f9 01             	cmp    $0x1,%ecx
+  80082a:	7f 25                	jg     800851 <vprintfmt+0x471>
+	else if (lflag)
+  80082c:	85 c9                	test   %ecx,%ecx
+  80082e:	74 5b                	je     80088b <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800830:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800833:	83 f8 2f             	cmp    $0x2f,%eax
+  800836:	77 45                	ja     80087d <vprintfmt+0x49d>
+  800838:	89 c2                	mov    %eax,%edx
+  80083a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083e:	83 c0 08             	add    $0x8,%eax
+  800841:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800844:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800847:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  80084c:	e9 97 00 00 00       	jmp    8008e8 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800851:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800854:	83 f8 2f             	cmp    $0x2f,%eax
+  800857:	77 16                	ja     80086f <vprintfmt+0x48f>
+  800859:	89 c2                	mov    %eax,%edx
+  80085b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085f:	83 c0 08             	add    $0x8,%eax
+  800862:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800865:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800868:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  80086d:	eb 79                	jmp    8008e8 <vprintfmt+0x508>
+  80086f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800873:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800877:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087b:	eb e8                	jmp    800865 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  80087d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800881:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800885:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800889:	eb b9                	jmp    800844 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  80088b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088e:	83 f8 2f             	cmp    $0x2f,%eax
+  800891:	77 15                	ja     8008a8 <vprintfmt+0x4c8>
+  800893:	89 c2                	mov    %eax,%edx
+  800895:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800899:	83 c0 08             	add    $0x8,%eax
+  80089c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089f:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  8008a1:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  8008a6:	eb 40                	jmp    8008e8 <vprintfmt+0x508>
+  8008a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b4:	eb e9                	jmp    80089f <vprintfmt+0x4bf>
+			putch('0', putdat);
+  8008b6:	4c 89 ee             	mov    %r13,%rsi
+  8008b9:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008be:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  8008c1:	4c 89 ee             	mov    %r13,%rsi
+  8008c4:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008c9:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  8008cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d2:	77 34                	ja     800908 <vprintfmt+0x528>
+  8008d4:	89 c2                	mov    %eax,%edx
+  8008d6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008da:	83 c0 08             	add    $0x8,%eax
+  8008dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  8008e0:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  8008e3:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  8008e8:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  8008ed:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008f1:	4c 89 ee             	mov    %r13,%rsi
+  8008f4:	4c 89 f7             	mov    %r14,%rdi
+  8008f7:	48 b8 ba 02 80 00 00 	movabs $0x8002ba,%rax
+  8008fe:	00 00 00 
+  800901:	ff d0                	call   *%rax
+			break;
+  800903:	e9 0d fb ff ff       	jmp    800415 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800908:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80090c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800910:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800914:	eb ca                	jmp    8008e0 <vprintfmt+0x500>
+	if (lflag >= 2)
+  800916:	83 f9 01             	cmp    $0x1,%ecx
+  800919:	7f 22                	jg     80093d <vprintfmt+0x55d>
+	else if (lflag)
+  80091b:	85 c9                	test   %ecx,%ecx
+  80091d:	74 58                	je     800977 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  80091f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800922:	83 f8 2f             	cmp    $0x2f,%eax
+  800925:	77 42                	ja     800969 <vprintfmt+0x589>
+  800927:	89 c2                	mov    %eax,%edx
+  800929:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092d:	83 c0 08             	add    $0x8,%eax
+  800930:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800933:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800936:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  80093b:	eb ab                	jmp    8008e8 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  80093d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800940:	83 f8 2f             	cmp    $0x2f,%eax
+  800943:	77 16                	ja     80095b <vprintfmt+0x57b>
+  800945:	89 c2                	mov    %eax,%edx
+  800947:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80094b:	83 c0 08             	add    $0x8,%eax
+  80094e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800951:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800954:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800959:	eb 8d                	jmp    8008e8 <vprintfmt+0x508>
+  80095b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800963:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800967:	eb e8                	jmp    800951 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800969:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800971:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800975:	eb bc                	jmp    800933 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800977:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097a:	83 f8 2f             	cmp    $0x2f,%eax
+  80097d:	77 18                	ja     800997 <vprintfmt+0x5b7>
+  80097f:	89 c2                	mov    %eax,%edx
+  800981:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800985:	83 c0 08             	add    $0x8,%eax
+  800988:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098b:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  80098d:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800992:	e9 51 ff ff ff       	jmp    8008e8 <vprintfmt+0x508>
+  800997:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a3:	eb e6                	jmp    80098b <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  8009a5:	4c 89 ee             	mov    %r13,%rsi
+  8009a8:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009ad:	41 ff d6             	call   *%r14
+			break;
+  8009b0:	e9 60 fa ff ff       	jmp    800415 <vprintfmt+0x35>
+			putch('%', putdat);
+  8009b5:	4c 89 ee             	mov    %r13,%rsi
+  8009b8:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009bd:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8009c0:	4c 89 e3             	mov    %r12,%rbx
+  8009c3:	eb 04                	jmp    8009c9 <vprintfmt+0x5e9>
+  8009c5:	48 83 eb 01          	sub    $0x1,%rbx
+  8009c9:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8009cd:	75 f6                	jne    8009c5 <vprintfmt+0x5e5>
+  8009cf:	e9 41 fa ff ff       	jmp    800415 <vprintfmt+0x35>
+
+00000000008009d4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009d4:	55                   	push   %rbp
+  8009d5:	48 89 e5             	mov    %rsp,%rbp
+  8009d8:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009dc:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8009e0:	48 63 c6             	movslq %esi,%rax
+  8009e3:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  8009e8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  8009ec:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  8009f3:	48 85 ff             	test   %rdi,%rdi
+  8009f6:	74 2a                	je     800a22 <vsnprintf+0x4e>
+  8009f8:	85 f6                	test   %esi,%esi
+  8009fa:	7e 26                	jle    800a22 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009fc:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800a00:	48 bf 42 03 80 00 00 	movabs $0x800342,%rdi
+  800a07:	00 00 00 
+  800a0a:	48 b8 e0 03 80 00 00 	movabs $0x8003e0,%rax
+  800a11:	00 00 00 
+  800a14:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800a1a:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800a1d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800a20:	c9                   	leave
+  800a21:	c3                   	ret
+		return -E_INVAL;
+  800a22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a27:	eb f7                	jmp    800a20 <vsnprintf+0x4c>
+
+0000000000800a29 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a29:	55                   	push   %rbp
+  800a2a:	48 89 e5             	mov    %rsp,%rbp
+  800a2d:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800a34:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800a3b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800a42:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800a49:	84 c0                	test   %al,%al
+  800a4b:	74 20                	je     800a6d <snprintf+0x44>
+  800a4d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800a51:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800a55:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800a59:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800a5d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800a61:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800a65:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800a69:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a6d:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800a74:	00 00 00 
+  800a77:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800a7e:	00 00 00 
+  800a81:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a85:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800a8c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800a93:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a9a:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800aa1:	48 b8 d4 09 80 00 00 	movabs $0x8009d4,%rax
+  800aa8:	00 00 00 
+  800aab:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800aad:	c9                   	leave
+  800aae:	c3                   	ret
+
+0000000000800aaf <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800aaf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ab4:	48 89 d0             	mov    %rdx,%rax
+  800ab7:	48 83 c2 01          	add    $0x1,%rdx
+  800abb:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800ac0:	75 f2                	jne    800ab4 <strlen+0x5>
+		n++;
+	return n;
+}
+  800ac2:	c3                   	ret
+
+0000000000800ac3 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac8:	eb 03                	jmp    800acd <strnlen+0xa>
+  800aca:	48 89 d0             	mov    %rdx,%rax
+  800acd:	48 39 c6             	cmp    %rax,%rsi
+  800ad0:	74 0a                	je     800adc <strnlen+0x19>
+  800ad2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800ad6:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ada:	75 ee                	jne    800aca <strnlen+0x7>
+		n++;
+	return n;
+}
+  800adc:	c3                   	ret
+
+0000000000800add <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800add:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800ae0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ae5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ae9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800aec:	48 83 c2 01          	add    $0x1,%rdx
+  800af0:	84 c9                	test   %cl,%cl
+  800af2:	75 f1                	jne    800ae5 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800af4:	c3                   	ret
+
+0000000000800af5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800af5:	55                   	push   %rbp
+  800af6:	48 89 e5             	mov    %rsp,%rbp
+  800af9:	41 54                	push   %r12
+  800afb:	53                   	push   %rbx
+  800afc:	48 89 fb             	mov    %rdi,%rbx
+  800aff:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800b02:	48 b8 af 0a 80 00 00 	movabs $0x800aaf,%rax
+  800b09:	00 00 00 
+  800b0c:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800b0e:	48 63 f8             	movslq %eax,%rdi
+  800b11:	48 01 df             	add    %rbx,%rdi
+  800b14:	4c 89 e6             	mov    %r12,%rsi
+  800b17:	48 b8 dd 0a 80 00 00 	movabs $0x800add,%rax
+  800b1e:	00 00 00 
+  800b21:	ff d0                	call   *%rax
+	return dst;
+}
+  800b23:	48 89 d8             	mov    %rbx,%rax
+  800b26:	5b                   	pop    %rbx
+  800b27:	41 5c                	pop    %r12
+  800b29:	5d                   	pop    %rbp
+  800b2a:	c3                   	ret
+
+0000000000800b2b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b2b:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b2e:	48 01 fa             	add    %rdi,%rdx
+  800b31:	48 89 f9             	mov    %rdi,%rcx
+  800b34:	eb 14                	jmp    800b4a <strncpy+0x1f>
+		*dst++ = *src;
+  800b36:	48 83 c1 01          	add    $0x1,%rcx
+  800b3a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b3e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b42:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b46:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800b4a:	48 39 d1             	cmp    %rdx,%rcx
+  800b4d:	75 e7                	jne    800b36 <strncpy+0xb>
+	}
+	return ret;
+}
+  800b4f:	c3                   	ret
+
+0000000000800b50 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b50:	48 89 f8             	mov    %rdi,%rax
+  800b53:	48 85 d2             	test   %rdx,%rdx
+  800b56:	74 27                	je     800b7f <strlcpy+0x2f>
+  800b58:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800b5d:	48 89 fa             	mov    %rdi,%rdx
+  800b60:	eb 0b                	jmp    800b6d <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b62:	48 83 c6 01          	add    $0x1,%rsi
+  800b66:	48 83 c2 01          	add    $0x1,%rdx
+  800b6a:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800b6d:	48 39 c2             	cmp    %rax,%rdx
+  800b70:	74 0a                	je     800b7c <strlcpy+0x2c>
+  800b72:	0f b6 0e             	movzbl (%rsi),%ecx
+  800b75:	84 c9                	test   %cl,%cl
+  800b77:	75 e9                	jne    800b62 <strlcpy+0x12>
+  800b79:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800b7c:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800b7f:	48 29 f8             	sub    %rdi,%rax
+}
+  800b82:	c3                   	ret
+
+0000000000800b83 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800b83:	eb 08                	jmp    800b8d <strcmp+0xa>
+		p++, q++;
+  800b85:	48 83 c7 01          	add    $0x1,%rdi
+  800b89:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800b8d:	0f b6 07             	movzbl (%rdi),%eax
+  800b90:	84 c0                	test   %al,%al
+  800b92:	74 04                	je     800b98 <strcmp+0x15>
+  800b94:	3a 06                	cmp    (%rsi),%al
+  800b96:	74 ed                	je     800b85 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b98:	0f b6 c0             	movzbl %al,%eax
+  800b9b:	0f b6 16             	movzbl (%rsi),%edx
+  800b9e:	29 d0                	sub    %edx,%eax
+}
+  800ba0:	c3                   	ret
+
+0000000000800ba1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800ba1:	eb 0c                	jmp    800baf <strncmp+0xe>
+		n--, p++, q++;
+  800ba3:	48 83 ea 01          	sub    $0x1,%rdx
+  800ba7:	48 83 c7 01          	add    $0x1,%rdi
+  800bab:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800baf:	48 85 d2             	test   %rdx,%rdx
+  800bb2:	74 14                	je     800bc8 <strncmp+0x27>
+  800bb4:	0f b6 07             	movzbl (%rdi),%eax
+  800bb7:	84 c0                	test   %al,%al
+  800bb9:	74 04                	je     800bbf <strncmp+0x1e>
+  800bbb:	3a 06                	cmp    (%rsi),%al
+  800bbd:	74 e4                	je     800ba3 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bbf:	0f b6 07             	movzbl (%rdi),%eax
+  800bc2:	0f b6 16             	movzbl (%rsi),%edx
+  800bc5:	29 d0                	sub    %edx,%eax
+}
+  800bc7:	c3                   	ret
+		return 0;
+  800bc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bcd:	c3                   	ret
+
+0000000000800bce <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800bce:	eb 04                	jmp    800bd4 <strchr+0x6>
+  800bd0:	48 83 c7 01          	add    $0x1,%rdi
+  800bd4:	0f b6 07             	movzbl (%rdi),%eax
+  800bd7:	84 c0                	test   %al,%al
+  800bd9:	74 09                	je     800be4 <strchr+0x16>
+		if (*s == c)
+  800bdb:	40 38 f0             	cmp    %sil,%al
+  800bde:	75 f0                	jne    800bd0 <strchr+0x2>
+  800be0:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800be3:	c3                   	ret
+	return 0;
+  800be4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be9:	c3                   	ret
+
+0000000000800bea <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bea:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800bed:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800bf0:	40 38 f2             	cmp    %sil,%dl
+  800bf3:	74 0a                	je     800bff <strfind+0x15>
+  800bf5:	84 d2                	test   %dl,%dl
+  800bf7:	74 06                	je     800bff <strfind+0x15>
+	for (; *s; s++)
+  800bf9:	48 83 c0 01          	add    $0x1,%rax
+  800bfd:	eb ee                	jmp    800bed <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800bff:	c3                   	ret
+
+0000000000800c00 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800c00:	48 85 d2             	test   %rdx,%rdx
+  800c03:	74 28                	je     800c2d <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800c05:	48 89 f8             	mov    %rdi,%rax
+  800c08:	48 09 d0             	or     %rdx,%rax
+  800c0b:	a8 03                	test   $0x3,%al
+  800c0d:	75 16                	jne    800c25 <memset+0x25>
+		c &= 0xFF;
+  800c0f:	40 0f b6 f6          	movzbl %sil,%esi
+  800c13:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c19:	48 89 d1             	mov    %rdx,%rcx
+  800c1c:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800c20:	fc                   	cld
+  800c21:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800c23:	eb 08                	jmp    800c2d <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c25:	89 f0                	mov    %esi,%eax
+  800c27:	48 89 d1             	mov    %rdx,%rcx
+  800c2a:	fc                   	cld
+  800c2b:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c2d:	48 89 f8             	mov    %rdi,%rax
+  800c30:	c3                   	ret
+
+0000000000800c31 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c31:	48 89 f8             	mov    %rdi,%rax
+  800c34:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c37:	48 39 fe             	cmp    %rdi,%rsi
+  800c3a:	73 3a                	jae    800c76 <memmove+0x45>
+  800c3c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800c40:	48 39 d7             	cmp    %rdx,%rdi
+  800c43:	73 31                	jae    800c76 <memmove+0x45>
+		s += n;
+		d += n;
+  800c45:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800c49:	48 89 d6             	mov    %rdx,%rsi
+  800c4c:	48 09 fe             	or     %rdi,%rsi
+  800c4f:	48 09 ce             	or     %rcx,%rsi
+  800c52:	40 f6 c6 03          	test   $0x3,%sil
+  800c56:	75 11                	jne    800c69 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c58:	48 83 ef 04          	sub    $0x4,%rdi
+  800c5c:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800c60:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800c64:	fd                   	std
+  800c65:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800c67:	eb 0b                	jmp    800c74 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c69:	48 83 ef 01          	sub    $0x1,%rdi
+  800c6d:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800c71:	fd                   	std
+  800c72:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c74:	fc                   	cld
+  800c75:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800c76:	48 89 f2             	mov    %rsi,%rdx
+  800c79:	48 09 c2             	or     %rax,%rdx
+  800c7c:	48 09 ca             	or     %rcx,%rdx
+  800c7f:	f6 c2 03             	test   $0x3,%dl
+  800c82:	75 0b                	jne    800c8f <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c84:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800c88:	48 89 c7             	mov    %rax,%rdi
+  800c8b:	fc                   	cld
+  800c8c:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800c8e:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800c8f:	48 89 c7             	mov    %rax,%rdi
+  800c92:	fc                   	cld
+  800c93:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c95:	c3                   	ret
+
+0000000000800c96 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c96:	55                   	push   %rbp
+  800c97:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800c9a:	48 b8 31 0c 80 00 00 	movabs $0x800c31,%rax
+  800ca1:	00 00 00 
+  800ca4:	ff d0                	call   *%rax
+}
+  800ca6:	5d                   	pop    %rbp
+  800ca7:	c3                   	ret
+
+0000000000800ca8 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ca8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cad:	48 39 c2             	cmp    %rax,%rdx
+  800cb0:	74 1e                	je     800cd0 <memcmp+0x28>
+		if (*s1 != *s2)
+  800cb2:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800cb6:	48 83 c0 01          	add    $0x1,%rax
+  800cba:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800cc0:	44 38 c1             	cmp    %r8b,%cl
+  800cc3:	74 e8                	je     800cad <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800cc5:	0f b6 c1             	movzbl %cl,%eax
+  800cc8:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ccc:	44 29 c0             	sub    %r8d,%eax
+  800ccf:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cd5:	c3                   	ret
+
+0000000000800cd6 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cd6:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800cd9:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800cdc:	eb 04                	jmp    800ce2 <memfind+0xc>
+  800cde:	48 83 c0 01          	add    $0x1,%rax
+  800ce2:	48 39 d0             	cmp    %rdx,%rax
+  800ce5:	73 05                	jae    800cec <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ce7:	40 38 30             	cmp    %sil,(%rax)
+  800cea:	75 f2                	jne    800cde <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800cec:	c3                   	ret
+
+0000000000800ced <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ced:	48 89 f9             	mov    %rdi,%rcx
+  800cf0:	49 89 f0             	mov    %rsi,%r8
+  800cf3:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cf5:	eb 04                	jmp    800cfb <strtol+0xe>
+		s++;
+  800cf7:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800cfb:	0f b6 01             	movzbl (%rcx),%eax
+  800cfe:	3c 20                	cmp    $0x20,%al
+  800d00:	74 f5                	je     800cf7 <strtol+0xa>
+  800d02:	3c 09                	cmp    $0x9,%al
+  800d04:	74 f1                	je     800cf7 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d06:	3c 2b                	cmp    $0x2b,%al
+  800d08:	74 2b                	je     800d35 <strtol+0x48>
+	int neg = 0;
+  800d0a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800d10:	3c 2d                	cmp    $0x2d,%al
+  800d12:	74 2d                	je     800d41 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d14:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800d1a:	75 0f                	jne    800d2b <strtol+0x3e>
+  800d1c:	80 39 30             	cmpb   $0x30,(%rcx)
+  800d1f:	74 2c                	je     800d4d <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d21:	85 ff                	test   %edi,%edi
+  800d23:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d28:	0f 44 f8             	cmove  %eax,%edi
+  800d2b:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800d30:	4c 63 d7             	movslq %edi,%r10
+  800d33:	eb 4f                	jmp    800d84 <strtol+0x97>
+		s++;
+  800d35:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800d39:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800d3f:	eb d3                	jmp    800d14 <strtol+0x27>
+		s++, neg = 1;
+  800d41:	48 83 c1 01          	add    $0x1,%rcx
+  800d45:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800d4b:	eb c7                	jmp    800d14 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d4d:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800d51:	74 0f                	je     800d62 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800d53:	85 ff                	test   %edi,%edi
+  800d55:	75 d4                	jne    800d2b <strtol+0x3e>
+		s++, base = 8;
+  800d57:	48 83 c1 01          	add    $0x1,%rcx
+  800d5b:	bf 08 00 00 00       	mov    $0x8,%edi
+  800d60:	eb c9                	jmp    800d2b <strtol+0x3e>
+		s += 2, base = 16;
+  800d62:	48 83 c1 02          	add    $0x2,%rcx
+  800d66:	bf 10 00 00 00       	mov    $0x10,%edi
+  800d6b:	eb be                	jmp    800d2b <strtol+0x3e>
+			dig = *s - '0';
+  800d6d:	0f be c0             	movsbl %al,%eax
+  800d70:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800d73:	39 f8                	cmp    %edi,%eax
+  800d75:	7d 3b                	jge    800db2 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800d77:	48 83 c1 01          	add    $0x1,%rcx
+  800d7b:	49 0f af d2          	imul   %r10,%rdx
+  800d7f:	48 98                	cltq
+  800d81:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800d84:	0f b6 01             	movzbl (%rcx),%eax
+  800d87:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800d8a:	40 80 fe 09          	cmp    $0x9,%sil
+  800d8e:	76 dd                	jbe    800d6d <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800d90:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800d93:	40 80 fe 19          	cmp    $0x19,%sil
+  800d97:	77 08                	ja     800da1 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800d99:	0f be c0             	movsbl %al,%eax
+  800d9c:	83 e8 57             	sub    $0x57,%eax
+  800d9f:	eb d2                	jmp    800d73 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800da1:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800da4:	40 80 fe 19          	cmp    $0x19,%sil
+  800da8:	77 08                	ja     800db2 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800daa:	0f be c0             	movsbl %al,%eax
+  800dad:	83 e8 37             	sub    $0x37,%eax
+  800db0:	eb c1                	jmp    800d73 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800db2:	4d 85 c0             	test   %r8,%r8
+  800db5:	74 03                	je     800dba <strtol+0xcd>
+		*endptr = (char *) s;
+  800db7:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800dba:	48 89 d0             	mov    %rdx,%rax
+  800dbd:	48 f7 d8             	neg    %rax
+  800dc0:	45 85 c9             	test   %r9d,%r9d
+  800dc3:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800dc7:	48 89 d0             	mov    %rdx,%rax
+  800dca:	c3                   	ret
+
+0000000000800dcb <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800dcb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800dd1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800dd7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de1:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800de3:	c3                   	ret
+
+0000000000800de4 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800de4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800dea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800df0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800df5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dfa:	48 89 fe             	mov    %rdi,%rsi
+  800dfd:	48 89 fa             	mov    %rdi,%rdx
+  800e00:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e02:	c3                   	ret
+
+0000000000800e03 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800e03:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800e06:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800e0c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800e12:	be 00 00 00 00       	mov    $0x0,%esi
+  800e17:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e1c:	48 89 f2             	mov    %rsi,%rdx
+  800e1f:	0f 05                	syscall
+	if(check && ret > 0)
+  800e21:	48 85 c0             	test   %rax,%rax
+  800e24:	7f 01                	jg     800e27 <sys_env_destroy+0x24>
+}
+  800e26:	c3                   	ret
+{
+  800e27:	55                   	push   %rbp
+  800e28:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e2b:	49 89 c0             	mov    %rax,%r8
+  800e2e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800e33:	48 ba 48 22 80 00 00 	movabs $0x802248,%rdx
+  800e3a:	00 00 00 
+  800e3d:	be 28 00 00 00       	mov    $0x28,%esi
+  800e42:	48 bf 65 22 80 00 00 	movabs $0x802265,%rdi
+  800e49:	00 00 00 
+  800e4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e51:	49 b9 37 1c 80 00 00 	movabs $0x801c37,%r9
+  800e58:	00 00 00 
+  800e5b:	41 ff d1             	call   *%r9
+
+0000000000800e5e <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800e5e:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800e65:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800e66:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800e6b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800e6f:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800e73:	48 c1 e2 04          	shl    $0x4,%rdx
+  800e77:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800e7e:	00 00 00 
+  800e81:	48 01 d0             	add    %rdx,%rax
+  800e84:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800e8a:	c3                   	ret
+
+0000000000800e8b <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800e8b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800e91:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800e97:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e9c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ea1:	48 89 fe             	mov    %rdi,%rsi
+  800ea4:	48 89 fa             	mov    %rdi,%rdx
+  800ea7:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ea9:	c3                   	ret
+
+0000000000800eaa <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  800eaa:	48 63 d2             	movslq %edx,%rdx
+  800ead:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800eb0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800eb6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800ebc:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ec1:	0f 05                	syscall
+	if(check && ret > 0)
+  800ec3:	48 85 c0             	test   %rax,%rax
+  800ec6:	7f 01                	jg     800ec9 <sys_page_alloc+0x1f>
+}
+  800ec8:	c3                   	ret
+{
+  800ec9:	55                   	push   %rbp
+  800eca:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ecd:	49 89 c0             	mov    %rax,%r8
+  800ed0:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800ed5:	48 ba 48 22 80 00 00 	movabs $0x802248,%rdx
+  800edc:	00 00 00 
+  800edf:	be 28 00 00 00       	mov    $0x28,%esi
+  800ee4:	48 bf 65 22 80 00 00 	movabs $0x802265,%rdi
+  800eeb:	00 00 00 
+  800eee:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ef3:	49 b9 37 1c 80 00 00 	movabs $0x801c37,%r9
+  800efa:	00 00 00 
+  800efd:	41 ff d1             	call   *%r9
+
+0000000000800f00 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  800f00:	48 63 d2             	movslq %edx,%rdx
+  800f03:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800f06:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f0c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f12:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f17:	0f 05                	syscall
+	if(check && ret > 0)
+  800f19:	48 85 c0             	test   %rax,%rax
+  800f1c:	7f 01                	jg     800f1f <sys_page_alloc_huge+0x1f>
+}
+  800f1e:	c3                   	ret
+{
+  800f1f:	55                   	push   %rbp
+  800f20:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f23:	49 89 c0             	mov    %rax,%r8
+  800f26:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800f2b:	48 ba 48 22 80 00 00 	movabs $0x802248,%rdx
+  800f32:	00 00 00 
+  800f35:	be 28 00 00 00       	mov    $0x28,%esi
+  800f3a:	48 bf 65 22 80 00 00 	movabs $0x802265,%rdi
+  800f41:	00 00 00 
+  800f44:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f49:	49 b9 37 1c 80 00 00 	movabs $0x801c37,%r9
+  800f50:	00 00 00 
+  800f53:	41 ff d1             	call   *%r9
+
+0000000000800f56 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f56:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  800f59:	48 63 d2             	movslq %edx,%rdx
+  800f5c:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800f5f:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  800f62:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f67:	0f 05                	syscall
+	if(check && ret > 0)
+  800f69:	48 85 c0             	test   %rax,%rax
+  800f6c:	7f 01                	jg     800f6f <sys_page_map+0x19>
+}
+  800f6e:	c3                   	ret
+{
+  800f6f:	55                   	push   %rbp
+  800f70:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f73:	49 89 c0             	mov    %rax,%r8
+  800f76:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800f7b:	48 ba 48 22 80 00 00 	movabs $0x802248,%rdx
+  800f82:	00 00 00 
+  800f85:	be 28 00 00 00       	mov    $0x28,%esi
+  800f8a:	48 bf 65 22 80 00 00 	movabs $0x802265,%rdi
+  800f91:	00 00 00 
+  800f94:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f99:	49 b9 37 1c 80 00 00 	movabs $0x801c37,%r9
+  800fa0:	00 00 00 
+  800fa3:	41 ff d1             	call   *%r9
+
+0000000000800fa6 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  800fa6:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800fa9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800faf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fba:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fbf:	0f 05                	syscall
+	if(check && ret > 0)
+  800fc1:	48 85 c0             	test   %rax,%rax
+  800fc4:	7f 01                	jg     800fc7 <sys_page_unmap+0x21>
+}
+  800fc6:	c3                   	ret
+{
+  800fc7:	55                   	push   %rbp
+  800fc8:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fcb:	49 89 c0             	mov    %rax,%r8
+  800fce:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800fd3:	48 ba 48 22 80 00 00 	movabs $0x802248,%rdx
+  800fda:	00 00 00 
+  800fdd:	be 28 00 00 00       	mov    $0x28,%esi
+  800fe2:	48 bf 65 22 80 00 00 	movabs $0x802265,%rdi
+  800fe9:	00 00 00 
+  800fec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff1:	49 b9 37 1c 80 00 00 	movabs $0x801c37,%r9
+  800ff8:	00 00 00 
+  800ffb:	41 ff d1             	call   *%r9
+
+0000000000800ffe <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  800ffe:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801004:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80100a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80100f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801014:	48 89 fe             	mov    %rdi,%rsi
+  801017:	48 89 fa             	mov    %rdi,%rdx
+  80101a:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80101c:	c3                   	ret
+
+000000000080101d <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  80101d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801023:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801029:	ba 00 00 00 00       	mov    $0x0,%edx
+  80102e:	b8 10 00 00 00       	mov    $0x10,%eax
+  801033:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  801035:	c3                   	ret
+
+0000000000801036 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  801036:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80103c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801042:	b8 11 00 00 00       	mov    $0x11,%eax
+  801047:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  801049:	c3                   	ret
+
+000000000080104a <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  80104a:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  80104d:	48 63 f6             	movslq %esi,%rsi
+  801050:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  801053:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801059:	b8 12 00 00 00       	mov    $0x12,%eax
+  80105e:	0f 05                	syscall
+	if(check && ret > 0)
+  801060:	48 85 c0             	test   %rax,%rax
+  801063:	7f 01                	jg     801066 <sys_page_batch+0x1c>
+}
+  801065:	c3                   	ret
+{
+  801066:	55                   	push   %rbp
+  801067:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106a:	49 89 c0             	mov    %rax,%r8
+  80106d:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801072:	48 ba 48 22 80 00 00 	movabs $0x802248,%rdx
+  801079:	00 00 00 
+  80107c:	be 28 00 00 00       	mov    $0x28,%esi
+  801081:	48 bf 65 22 80 00 00 	movabs $0x802265,%rdi
+  801088:	00 00 00 
+  80108b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801090:	49 b9 37 1c 80 00 00 	movabs $0x801c37,%r9
+  801097:	00 00 00 
+  80109a:	41 ff d1             	call   *%r9
+
+000000000080109d <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  80109d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ae:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010b3:	48 89 f2             	mov    %rsi,%rdx
+  8010b6:	0f 05                	syscall
+	if(check && ret > 0)
+  8010b8:	48 85 c0             	test   %rax,%rax
+  8010bb:	7f 01                	jg     8010be <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  8010bd:	c3                   	ret
+{
+  8010be:	55                   	push   %rbp
+  8010bf:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010c2:	49 89 c0             	mov    %rax,%r8
+  8010c5:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8010ca:	48 ba 48 22 80 00 00 	movabs $0x802248,%rdx
+  8010d1:	00 00 00 
+  8010d4:	be 28 00 00 00       	mov    $0x28,%esi
+  8010d9:	48 bf 65 22 80 00 00 	movabs $0x802265,%rdi
+  8010e0:	00 00 00 
+  8010e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e8:	49 b9 37 1c 80 00 00 	movabs $0x801c37,%r9
+  8010ef:	00 00 00 
+  8010f2:	41 ff d1             	call   *%r9
+
+00000000008010f5 <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  8010f5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801101:	bf 00 00 00 00       	mov    $0x0,%edi
+  801106:	b8 14 00 00 00       	mov    $0x14,%eax
+  80110b:	48 89 fe             	mov    %rdi,%rsi
+  80110e:	48 89 fa             	mov    %rdi,%rdx
+  801111:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801113:	c3                   	ret
+
+0000000000801114 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  801114:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801117:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80111d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801123:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801128:	0f 05                	syscall
+	if(check && ret > 0)
+  80112a:	48 85 c0             	test   %rax,%rax
+  80112d:	7f 01                	jg     801130 <sys_page_unmap_range+0x1c>
+}
+  80112f:	c3                   	ret
+{
+  801130:	55                   	push   %rbp
+  801131:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801134:	49 89 c0             	mov    %rax,%r8
+  801137:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80113c:	48 ba 48 22 80 00 00 	movabs $0x802248,%rdx
+  801143:	00 00 00 
+  801146:	be 28 00 00 00       	mov    $0x28,%esi
+  80114b:	48 bf 65 22 80 00 00 	movabs $0x802265,%rdi
+  801152:	00 00 00 
+  801155:	b8 00 00 00 00       	mov    $0x0,%eax
+  80115a:	49 b9 37 1c 80 00 00 	movabs $0x801c37,%r9
+  801161:	00 00 00 
+  801164:	41 ff d1             	call   *%r9
+
+0000000000801167 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801167:	48 63 f6             	movslq %esi,%rsi
+  80116a:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80116d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801173:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801179:	ba 00 00 00 00       	mov    $0x0,%edx
+  80117e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801183:	0f 05                	syscall
+	if(check && ret > 0)
+  801185:	48 85 c0             	test   %rax,%rax
+  801188:	7f 01                	jg     80118b <sys_env_set_status+0x24>
+}
+  80118a:	c3                   	ret
+{
+  80118b:	55                   	push   %rbp
+  80118c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80118f:	49 89 c0             	mov    %rax,%r8
+  801192:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801197:	48 ba 48 22 80 00 00 	movabs $0x802248,%rdx
+  80119e:	00 00 00 
+  8011a1:	be 28 00 00 00       	mov    $0x28,%esi
+  8011a6:	48 bf 65 22 80 00 00 	movabs $0x802265,%rdi
+  8011ad:	00 00 00 
+  8011b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b5:	49 b9 37 1c 80 00 00 	movabs $0x801c37,%r9
+  8011bc:	00 00 00 
+  8011bf:	41 ff d1             	call   *%r9
+
+00000000008011c2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8011c2:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8011c5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011d6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011db:	0f 05                	syscall
+	if(check && ret > 0)
+  8011dd:	48 85 c0             	test   %rax,%rax
+  8011e0:	7f 01                	jg     8011e3 <sys_env_set_pgfault_upcall+0x21>
+}
+  8011e2:	c3                   	ret
+{
+  8011e3:	55                   	push   %rbp
+  8011e4:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e7:	49 89 c0             	mov    %rax,%r8
+  8011ea:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8011ef:	48 ba 48 22 80 00 00 	movabs $0x802248,%rdx
+  8011f6:	00 00 00 
+  8011f9:	be 28 00 00 00       	mov    $0x28,%esi
+  8011fe:	48 bf 65 22 80 00 00 	movabs $0x802265,%rdi
+  801205:	00 00 00 
+  801208:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120d:	49 b9 37 1c 80 00 00 	movabs $0x801c37,%r9
+  801214:	00 00 00 
+  801217:	41 ff d1             	call   *%r9
+
+000000000080121a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80121a:	48 63 ff             	movslq %edi,%rdi
+  80121d:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  801220:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801226:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80122b:	0f 05                	syscall
+}
+  80122d:	c3                   	ret
+
+000000000080122e <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  80122e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801234:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80123a:	be 00 00 00 00       	mov    $0x0,%esi
+  80123f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801244:	48 89 f2             	mov    %rsi,%rdx
+  801247:	0f 05                	syscall
+	if(check && ret > 0)
+  801249:	48 85 c0             	test   %rax,%rax
+  80124c:	7f 01                	jg     80124f <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  80124e:	c3                   	ret
+{
+  80124f:	55                   	push   %rbp
+  801250:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801253:	49 89 c0             	mov    %rax,%r8
+  801256:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80125b:	48 ba 48 22 80 00 00 	movabs $0x802248,%rdx
+  801262:	00 00 00 
+  801265:	be 28 00 00 00       	mov    $0x28,%esi
+  80126a:	48 bf 65 22 80 00 00 	movabs $0x802265,%rdi
+  801271:	00 00 00 
+  801274:	b8 00 00 00 00       	mov    $0x0,%eax
+  801279:	49 b9 37 1c 80 00 00 	movabs $0x801c37,%r9
+  801280:	00 00 00 
+  801283:	41 ff d1             	call   *%r9
+
+0000000000801286 <pgfault>:
+- unmap PFTEMP using sys_page_unmap()
+- panic if any step fails
+*/
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801286:	55                   	push   %rbp
+  801287:	48 89 e5             	mov    %rsp,%rbp
+  80128a:	53                   	push   %rbx
+  80128b:	48 83 ec 08          	sub    $0x8,%rsp
+	void *addr = (void *) utf->utf_fault_va;
+  80128f:	48 8b 1f             	mov    (%rdi),%rbx
+	uint32_t err = utf->utf_err;
+  801292:	48 8b 47 08          	mov    0x8(%rdi),%rax
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+
+	if (!(err & FEC_WR)) {
+  801296:	a8 02                	test   $0x2,%al
+  801298:	0f 84 b1 00 00 00    	je     80134f <pgfault+0xc9>
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+	}
+	pte_t pte = uvpt[PGNUM(addr)];
+  80129e:	48 89 da             	mov    %rbx,%rdx
+  8012a1:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8012a5:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8012ac:	01 00 00 
+  8012af:	48 8b 0c d0          	mov    (%rax,%rdx,8),%rcx
+	if (!(pte & PTE_COW)) {
+  8012b3:	f6 c5 08             	test   $0x8,%ch
+  8012b6:	0f 84 c3 00 00 00    	je     80137f <pgfault+0xf9>
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+
+	void *pg_addr = ROUNDDOWN(addr, PGSIZE);
+  8012bc:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  8012c3:	ba 07 00 00 00       	mov    $0x7,%edx
+  8012c8:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8012cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012d2:	48 b8 aa 0e 80 00 00 	movabs $0x800eaa,%rax
+  8012d9:	00 00 00 
+  8012dc:	ff d0                	call   *%rax
+	if (r < 0) {
+  8012de:	85 c0                	test   %eax,%eax
+  8012e0:	0f 88 c7 00 00 00    	js     8013ad <pgfault+0x127>
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+	}
+	memmove(PFTEMP, pg_addr, PGSIZE);
+  8012e6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012eb:	48 89 de             	mov    %rbx,%rsi
+  8012ee:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  8012f3:	48 b8 31 0c 80 00 00 	movabs $0x800c31,%rax
+  8012fa:	00 00 00 
+  8012fd:	ff d0                	call   *%rax
+	r = sys_page_map(0, PFTEMP, 0, pg_addr, PTE_P | PTE_U | PTE_W);
+  8012ff:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  801305:	48 89 d9             	mov    %rbx,%rcx
+  801308:	ba 00 00 00 00       	mov    $0x0,%edx
+  80130d:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  801312:	bf 00 00 00 00       	mov    $0x0,%edi
+  801317:	48 b8 56 0f 80 00 00 	movabs $0x800f56,%rax
+  80131e:	00 00 00 
+  801321:	ff d0                	call   *%rax
+	if (r < 0) {
+  801323:	85 c0                	test   %eax,%eax
+  801325:	0f 88 af 00 00 00    	js     8013da <pgfault+0x154>
+		panic("pgfault: sys_page_map failed:  %e", r);
+	}
+	r = sys_page_unmap(0, PFTEMP);
+  80132b:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  801330:	bf 00 00 00 00       	mov    $0x0,%edi
+  801335:	48 b8 a6 0f 80 00 00 	movabs $0x800fa6,%rax
+  80133c:	00 00 00 
+  80133f:	ff d0                	call   *%rax
+	if (r < 0) {
+  801341:	85 c0                	test   %eax,%eax
+  801343:	0f 88 be 00 00 00    	js     801407 <pgfault+0x181>
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+	}
+}
+  801349:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80134d:	c9                   	leave
+  80134e:	c3                   	ret
+  80134f:	89 c1                	mov    %eax,%ecx
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+  801351:	49 89 d8             	mov    %rbx,%r8
+  801354:	48 ba 78 22 80 00 00 	movabs $0x802278,%rdx
+  80135b:	00 00 00 
+  80135e:	be 32 00 00 00       	mov    $0x32,%esi
+  801363:	48 bf 27 24 80 00 00 	movabs $0x802427,%rdi
+  80136a:	00 00 00 
+  80136d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801372:	49 b9 37 1c 80 00 00 	movabs $0x801c37,%r9
+  801379:	00 00 00 
+  80137c:	41 ff d1             	call   *%r9
+		panic("pgfault: page is not marked copy-on-write (pte=%p, va=%p)", pte, addr);
+  80137f:	49 89 d8             	mov    %rbx,%r8
+  801382:	48 ba a0 22 80 00 00 	movabs $0x8022a0,%rdx
+  801389:	00 00 00 
+  80138c:	be 36 00 00 00       	mov    $0x36,%esi
+  801391:	48 bf 27 24 80 00 00 	movabs $0x802427,%rdi
+  801398:	00 00 00 
+  80139b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a0:	49 b9 37 1c 80 00 00 	movabs $0x801c37,%r9
+  8013a7:	00 00 00 
+  8013aa:	41 ff d1             	call   *%r9
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+  8013ad:	89 c1                	mov    %eax,%ecx
+  8013af:	48 ba e0 22 80 00 00 	movabs $0x8022e0,%rdx
+  8013b6:	00 00 00 
+  8013b9:	be 44 00 00 00       	mov    $0x44,%esi
+  8013be:	48 bf 27 24 80 00 00 	movabs $0x802427,%rdi
+  8013c5:	00 00 00 
+  8013c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013cd:	49 b8 37 1c 80 00 00 	movabs $0x801c37,%r8
+  8013d4:	00 00 00 
+  8013d7:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_map failed:  %e", r);
+  8013da:	89 c1                	mov    %eax,%ecx
+  8013dc:	48 ba 08 23 80 00 00 	movabs $0x802308,%rdx
+  8013e3:	00 00 00 
+  8013e6:	be 49 00 00 00       	mov    $0x49,%esi
+  8013eb:	48 bf 27 24 80 00 00 	movabs $0x802427,%rdi
+  8013f2:	00 00 00 
+  8013f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013fa:	49 b8 37 1c 80 00 00 	movabs $0x801c37,%r8
+  801401:	00 00 00 
+  801404:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+  801407:	89 c1                	mov    %eax,%ecx
+  801409:	48 ba 30 23 80 00 00 	movabs $0x802330,%rdx
+  801410:	00 00 00 
+  801413:	be 4d 00 00 00       	mov    $0x4d,%esi
+  801418:	48 bf 27 24 80 00 00 	movabs $0x802427,%rdi
+  80141f:	00 00 00 
+  801422:	b8 00 00 00 00       	mov    $0x0,%eax
+  801427:	49 b8 37 1c 80 00 00 	movabs $0x801c37,%r8
+  80142e:	00 00 00 
+  801431:	41 ff d0             	call   *%r8
+
+0000000000801434 <dupflush>:
+static struct PageOp dup_child[DUP_BATCH], dup_self[DUP_BATCH];
+static int ndup_child, ndup_self;
+
+static int
+dupflush(envid_t envid)
+{
+  801434:	55                   	push   %rbp
+  801435:	48 89 e5             	mov    %rsp,%rbp
+  801438:	89 fe                	mov    %edi,%esi
+	int r;
+
+	// Map to child first, then remap parent
+	r = sys_page_batch(0, envid, dup_child, ndup_child);
+  80143a:	a1 24 30 80 00 00 00 	movabs 0x803024,%eax
+  801441:	00 00 
+  801443:	48 63 c8             	movslq %eax,%rcx
+  801446:	48 ba 40 36 80 00 00 	movabs $0x803640,%rdx
+  80144d:	00 00 00 
+  801450:	bf 00 00 00 00       	mov    $0x0,%edi
+  801455:	48 b8 4a 10 80 00 00 	movabs $0x80104a,%rax
+  80145c:	00 00 00 
+  80145f:	ff d0                	call   *%rax
+	if (r < 0) {
+  801461:	85 c0                	test   %eax,%eax
+  801463:	78 57                	js     8014bc <dupflush+0x88>
+		panic("duppage: child map failed: %e", r);
+		return r;
+	}
+	r = sys_page_batch(0, 0, dup_self, ndup_self);
+  801465:	a1 20 30 80 00 00 00 	movabs 0x803020,%eax
+  80146c:	00 00 
+  80146e:	48 63 c8             	movslq %eax,%rcx
+  801471:	48 ba 40 30 80 00 00 	movabs $0x803040,%rdx
+  801478:	00 00 00 
+  80147b:	be 00 00 00 00       	mov    $0x0,%esi
+  801480:	bf 00 00 00 00       	mov    $0x0,%edi
+  801485:	48 b8 4a 10 80 00 00 	movabs $0x80104a,%rax
+  80148c:	00 00 00 
+  80148f:	ff d0                	call   *%rax
+	if (r < 0) {
+  801491:	85 c0                	test   %eax,%eax
+  801493:	78 54                	js     8014e9 <dupflush+0xb5>
+		panic("duppage: parent remap failed: %e", r);
+		return r;
+	}
+	ndup_child = ndup_self = 0;
+  801495:	48 b8 20 30 80 00 00 	movabs $0x803020,%rax
+  80149c:	00 00 00 
+  80149f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  8014a5:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  8014ac:	00 00 00 
+  8014af:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	return 0;
+}
+  8014b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ba:	5d                   	pop    %rbp
+  8014bb:	c3                   	ret
+		panic("duppage: child map failed: %e", r);
+  8014bc:	89 c1                	mov    %eax,%ecx
+  8014be:	48 ba 32 24 80 00 00 	movabs $0x802432,%rdx
+  8014c5:	00 00 00 
+  8014c8:	be 77 00 00 00       	mov    $0x77,%esi
+  8014cd:	48 bf 27 24 80 00 00 	movabs $0x802427,%rdi
+  8014d4:	00 00 00 
+  8014d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014dc:	49 b8 37 1c 80 00 00 	movabs $0x801c37,%r8
+  8014e3:	00 00 00 
+  8014e6:	41 ff d0             	call   *%r8
+		panic("duppage: parent remap failed: %e", r);
+  8014e9:	89 c1                	mov    %eax,%ecx
+  8014eb:	48 ba 58 23 80 00 00 	movabs $0x802358,%rdx
+  8014f2:	00 00 00 
+  8014f5:	be 7c 00 00 00       	mov    $0x7c,%esi
+  8014fa:	48 bf 27 24 80 00 00 	movabs $0x802427,%rdi
+  801501:	00 00 00 
+  801504:	b8 00 00 00 00       	mov    $0x0,%eax
+  801509:	49 b8 37 1c 80 00 00 	movabs $0x801c37,%r8
+  801510:	00 00 00 
+  801513:	41 ff d0             	call   *%r8
+
+0000000000801516 <thread_start>:
+	return envid;
+}
+
+static void
+thread_start(void (*fn)(void *), void *arg)
+{
+  801516:	55                   	push   %rbp
+  801517:	48 89 e5             	mov    %rsp,%rbp
+  80151a:	48 89 f8             	mov    %rdi,%rax
+  80151d:	48 89 f7             	mov    %rsi,%rdi
+	fn(arg);
+  801520:	ff d0                	call   *%rax
+	exit();
+  801522:	48 b8 62 01 80 00 00 	movabs $0x800162,%rax
+  801529:	00 00 00 
+  80152c:	ff d0                	call   *%rax
+}
+  80152e:	5d                   	pop    %rbp
+  80152f:	c3                   	ret
+
+0000000000801530 <fork>:
+{
+  801530:	55                   	push   %rbp
+  801531:	48 89 e5             	mov    %rsp,%rbp
+	set_pgfault_handler(pgfault);
+  801534:	48 bf 86 12 80 00 00 	movabs $0x801286,%rdi
+  80153b:	00 00 00 
+  80153e:	48 b8 29 1d 80 00 00 	movabs $0x801d29,%rax
+  801545:	00 00 00 
+  801548:	ff d0                	call   *%rax
+	return sys_fork();
+  80154a:	48 b8 fe 0f 80 00 00 	movabs $0x800ffe,%rax
+  801551:	00 00 00 
+  801554:	ff d0                	call   *%rax
+}
+  801556:	5d                   	pop    %rbp
+  801557:	c3                   	ret
+
+0000000000801558 <ufork>:
+{
+  801558:	55                   	push   %rbp
+  801559:	48 89 e5             	mov    %rsp,%rbp
+  80155c:	41 57                	push   %r15
+  80155e:	41 56                	push   %r14
+  801560:	41 55                	push   %r13
+  801562:	41 54                	push   %r12
+  801564:	53                   	push   %rbx
+  801565:	48 83 ec 38          	sub    $0x38,%rsp
+	set_pgfault_handler(pgfault);
+  801569:	48 bf 86 12 80 00 00 	movabs $0x801286,%rdi
+  801570:	00 00 00 
+  801573:	48 b8 29 1d 80 00 00 	movabs $0x801d29,%rax
+  80157a:	00 00 00 
+  80157d:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80157f:	b8 07 00 00 00       	mov    $0x7,%eax
+  801584:	cd 30                	int    $0x30
+  801586:	89 45 cc             	mov    %eax,-0x34(%rbp)
+	if (envid < 0) {
+  801589:	85 c0                	test   %eax,%eax
+  80158b:	78 21                	js     8015ae <ufork+0x56>
+	if (envid == 0) {
+  80158d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801591:	0f 84 e4 03 00 00    	je     80197b <ufork+0x423>
+  801597:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80159e:	00 
+	op->po_op = PAGEOP_MAP;
+  80159f:	49 bf 40 36 80 00 00 	movabs $0x803640,%r15
+  8015a6:	00 00 00 
+  8015a9:	e9 e7 02 00 00       	jmp    801895 <ufork+0x33d>
+		panic("sys_exofork failed: %e", envid);
+  8015ae:	89 c1                	mov    %eax,%ecx
+  8015b0:	48 ba 50 24 80 00 00 	movabs $0x802450,%rdx
+  8015b7:	00 00 00 
+  8015ba:	be e4 00 00 00       	mov    $0xe4,%esi
+  8015bf:	48 bf 27 24 80 00 00 	movabs $0x802427,%rdi
+  8015c6:	00 00 00 
+  8015c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ce:	49 b8 37 1c 80 00 00 	movabs $0x801c37,%r8
+  8015d5:	00 00 00 
+  8015d8:	41 ff d0             	call   *%r8
+  8015db:	44 89 e8             	mov    %r13d,%eax
+  8015de:	c1 e0 09             	shl    $0x9,%eax
+  8015e1:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  8015e4:	44 89 e8             	mov    %r13d,%eax
+  8015e7:	c1 e0 12             	shl    $0x12,%eax
+  8015ea:	89 45 ac             	mov    %eax,-0x54(%rbp)
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  8015ed:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8015f4:	00 
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  8015f5:	44 89 6d a8          	mov    %r13d,-0x58(%rbp)
+				int pdeIndex = pdpeIndex * NPTENTRIES + k;
+  8015f9:	8b 75 c8             	mov    -0x38(%rbp),%esi
+				if (!(uvpd[pdeIndex] & PTE_P)) {
+  8015fc:	48 63 c6             	movslq %esi,%rax
+  8015ff:	48 bf 00 00 00 80 00 	movabs $0x10080000000,%rdi
+  801606:	01 00 00 
+  801609:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80160d:	a8 01                	test   $0x1,%al
+  80160f:	0f 84 52 02 00 00    	je     801867 <ufork+0x30f>
+				if (uvpd[pdeIndex] & PTE_PS) {
+  801615:	48 63 c6             	movslq %esi,%rax
+  801618:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80161c:	a8 80                	test   $0x80,%al
+  80161e:	74 52                	je     801672 <ufork+0x11a>
+					void *va = PGADDR(i, j, k, 0, 0);
+  801620:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  801624:	48 c1 e3 27          	shl    $0x27,%rbx
+  801628:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80162c:	48 09 c3             	or     %rax,%rbx
+  80162f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801633:	48 09 c3             	or     %rax,%rbx
+					if ((uintptr_t)va >= UTOP) {
+  801636:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  80163b:	48 39 d8             	cmp    %rbx,%rax
+  80163e:	0f 82 ca 02 00 00    	jb     80190e <ufork+0x3b6>
+					r = sys_page_map(0, va, 0, va, uvpd[pdeIndex] & PTE_SYSCALL);
+  801644:	48 63 d6             	movslq %esi,%rdx
+  801647:	4c 8b 04 d7          	mov    (%rdi,%rdx,8),%r8
+  80164b:	41 81 e0 07 0e 00 00 	and    $0xe07,%r8d
+  801652:	48 89 d9             	mov    %rbx,%rcx
+  801655:	ba 00 00 00 00       	mov    $0x0,%edx
+  80165a:	48 89 de             	mov    %rbx,%rsi
+  80165d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801662:	48 b8 56 0f 80 00 00 	movabs $0x800f56,%rax
+  801669:	00 00 00 
+  80166c:	ff d0                	call   *%rax
+					if (r < 0) {
+  80166e:	85 c0                	test   %eax,%eax
+  801670:	78 18                	js     80168a <ufork+0x132>
+  801672:	4c 63 65 ac          	movslq -0x54(%rbp),%r12
+  801676:	4c 89 e3             	mov    %r12,%rbx
+  801679:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80167d:	4d 8d ac 24 00 02 00 	lea    0x200(%r12),%r13
+  801684:	00 
+  801685:	e9 00 01 00 00       	jmp    80178a <ufork+0x232>
+						panic("splitting 2MB page at %p failed: %e", va, r);
+  80168a:	41 89 c0             	mov    %eax,%r8d
+  80168d:	48 89 d9             	mov    %rbx,%rcx
+  801690:	48 ba 80 23 80 00 00 	movabs $0x802380,%rdx
+  801697:	00 00 00 
+  80169a:	be 0a 01 00 00       	mov    $0x10a,%esi
+  80169f:	48 bf 27 24 80 00 00 	movabs $0x802427,%rdi
+  8016a6:	00 00 00 
+  8016a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ae:	49 b9 37 1c 80 00 00 	movabs $0x801c37,%r9
+  8016b5:	00 00 00 
+  8016b8:	41 ff d1             	call   *%r9
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  8016bb:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  8016c2:	00 00 00 
+  8016c5:	8b 0f                	mov    (%rdi),%ecx
+  8016c7:	8d 71 01             	lea    0x1(%rcx),%esi
+  8016ca:	89 37                	mov    %esi,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  8016cc:	48 63 c9             	movslq %ecx,%rcx
+  8016cf:	48 8d 34 09          	lea    (%rcx,%rcx,1),%rsi
+  8016d3:	48 8d 3c 0e          	lea    (%rsi,%rcx,1),%rdi
+  8016d7:	41 c7 04 ff 01 00 00 	movl   $0x1,(%r15,%rdi,8)
+  8016de:	00 
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  8016df:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  8016e5:	41 89 54 ff 04       	mov    %edx,0x4(%r15,%rdi,8)
+	op->po_srcva = op->po_dstva = va;
+  8016ea:	49 89 44 ff 10       	mov    %rax,0x10(%r15,%rdi,8)
+  8016ef:	49 89 44 ff 08       	mov    %rax,0x8(%r15,%rdi,8)
+}
+  8016f4:	eb 76                	jmp    80176c <ufork+0x214>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U | PTE_COW);
+  8016f6:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  8016fd:	00 00 00 
+  801700:	8b 17                	mov    (%rdi),%edx
+  801702:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  801705:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  801707:	48 63 d2             	movslq %edx,%rdx
+  80170a:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  80170e:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  801712:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  801719:	00 
+	op->po_perm = perm;
+  80171a:	41 c7 44 f7 04 05 08 	movl   $0x805,0x4(%r15,%rsi,8)
+  801721:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  801723:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  801728:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+		dupqueue(&dup_self[ndup_self++], va, PTE_P | PTE_U | PTE_COW);
+  80172d:	48 b9 20 30 80 00 00 	movabs $0x803020,%rcx
+  801734:	00 00 00 
+  801737:	8b 11                	mov    (%rcx),%edx
+  801739:	8d 72 01             	lea    0x1(%rdx),%esi
+  80173c:	89 31                	mov    %esi,(%rcx)
+	op->po_op = PAGEOP_MAP;
+  80173e:	48 be 40 30 80 00 00 	movabs $0x803040,%rsi
+  801745:	00 00 00 
+  801748:	48 63 d2             	movslq %edx,%rdx
+  80174b:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  80174f:	48 8d 3c 11          	lea    (%rcx,%rdx,1),%rdi
+  801753:	c7 04 fe 01 00 00 00 	movl   $0x1,(%rsi,%rdi,8)
+	op->po_perm = perm;
+  80175a:	c7 44 fe 04 05 08 00 	movl   $0x805,0x4(%rsi,%rdi,8)
+  801761:	00 
+	op->po_srcva = op->po_dstva = va;
+  801762:	48 89 44 fe 10       	mov    %rax,0x10(%rsi,%rdi,8)
+  801767:	48 89 44 fe 08       	mov    %rax,0x8(%rsi,%rdi,8)
+	if (ndup_child == DUP_BATCH) {
+  80176c:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  801773:	00 00 00 
+  801776:	83 38 40             	cmpl   $0x40,(%rax)
+  801779:	0f 84 a4 00 00 00    	je     801823 <ufork+0x2cb>
+				for (int l = 0; l < NPTENTRIES; l++) {
+  80177f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801786:	49 83 c4 01          	add    $0x1,%r12
+  80178a:	4d 39 ec             	cmp    %r13,%r12
+  80178d:	0f 84 d4 00 00 00    	je     801867 <ufork+0x30f>
+					if (va >= UTOP) {
+  801793:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  801798:	48 39 d8             	cmp    %rbx,%rax
+  80179b:	0f 82 6d 01 00 00    	jb     80190e <ufork+0x3b6>
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  8017a1:	48 b8 00 10 80 43 ff 	movabs $0xffffffff43801000,%rax
+  8017a8:	ff ff ff 
+  8017ab:	48 01 d8             	add    %rbx,%rax
+  8017ae:	48 3d ff 0f 00 00    	cmp    $0xfff,%rax
+  8017b4:	76 c9                	jbe    80177f <ufork+0x227>
+					if (!(uvpt[pn] & PTE_P)) {
+  8017b6:	4b 8b 04 e6          	mov    (%r14,%r12,8),%rax
+  8017ba:	a8 01                	test   $0x1,%al
+  8017bc:	74 c1                	je     80177f <ufork+0x227>
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  8017be:	48 b8 00 f0 ff ff ff 	movabs $0xffffffff000,%rax
+  8017c5:	0f 00 00 
+  8017c8:	48 21 d8             	and    %rbx,%rax
+	pte_t pte = uvpt[pn];
+  8017cb:	44 89 e2             	mov    %r12d,%edx
+  8017ce:	49 8b 14 d6          	mov    (%r14,%rdx,8),%rdx
+	if (pte & PTE_SHARE) {
+  8017d2:	f6 c6 04             	test   $0x4,%dh
+  8017d5:	0f 85 e0 fe ff ff    	jne    8016bb <ufork+0x163>
+	} else if ((pte & PTE_W) || (pte & PTE_COW)) {
+  8017db:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  8017e1:	0f 85 0f ff ff ff    	jne    8016f6 <ufork+0x19e>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U);
+  8017e7:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  8017ee:	00 00 00 
+  8017f1:	8b 17                	mov    (%rdi),%edx
+  8017f3:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  8017f6:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  8017f8:	48 63 d2             	movslq %edx,%rdx
+  8017fb:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  8017ff:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  801803:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  80180a:	00 
+	op->po_perm = perm;
+  80180b:	41 c7 44 f7 04 05 00 	movl   $0x5,0x4(%r15,%rsi,8)
+  801812:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  801814:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  801819:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+}
+  80181e:	e9 49 ff ff ff       	jmp    80176c <ufork+0x214>
+		return dupflush(envid);
+  801823:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801826:	48 b8 34 14 80 00 00 	movabs $0x801434,%rax
+  80182d:	00 00 00 
+  801830:	ff d0                	call   *%rax
+					if (r < 0) {
+  801832:	85 c0                	test   %eax,%eax
+  801834:	0f 89 45 ff ff ff    	jns    80177f <ufork+0x227>
+						panic("duppage failed:  %e", r);
+  80183a:	89 c1                	mov    %eax,%ecx
+  80183c:	48 ba 67 24 80 00 00 	movabs $0x802467,%rdx
+  801843:	00 00 00 
+  801846:	be 20 01 00 00       	mov    $0x120,%esi
+  80184b:	48 bf 27 24 80 00 00 	movabs $0x802427,%rdi
+  801852:	00 00 00 
+  801855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185a:	49 b8 37 1c 80 00 00 	movabs $0x801c37,%r8
+  801861:	00 00 00 
+  801864:	41 ff d0             	call   *%r8
+			for (int k = 0; k < NPTENTRIES; k++) {
+  801867:	81 45 ac 00 02 00 00 	addl   $0x200,-0x54(%rbp)
+  80186e:	83 45 c8 01          	addl   $0x1,-0x38(%rbp)
+  801872:	48 81 45 b0 00 00 20 	addq   $0x200000,-0x50(%rbp)
+  801879:	00 
+  80187a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80187e:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  801884:	0f 85 6f fd ff ff    	jne    8015f9 <ufork+0xa1>
+  80188a:	44 8b 6d a8          	mov    -0x58(%rbp),%r13d
+  80188e:	eb 5d                	jmp    8018ed <ufork+0x395>
+	for (int i = 0; i < NPTENTRIES; i++) {
+  801890:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  801895:	48 81 7d c0 00 02 00 	cmpq   $0x200,-0x40(%rbp)
+  80189c:	00 
+  80189d:	74 6f                	je     80190e <ufork+0x3b6>
+		if (!(uvpml4e[i] & PTE_P)) {
+  80189f:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  8018a3:	48 63 c3             	movslq %ebx,%rax
+  8018a6:	48 be 00 20 40 80 00 	movabs $0x10080402000,%rsi
+  8018ad:	01 00 00 
+  8018b0:	48 8b 04 c6          	mov    (%rsi,%rax,8),%rax
+  8018b4:	a8 01                	test   $0x1,%al
+  8018b6:	74 d8                	je     801890 <ufork+0x338>
+  8018b8:	41 89 dc             	mov    %ebx,%r12d
+  8018bb:	41 c1 e4 09          	shl    $0x9,%r12d
+  8018bf:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8018c6:	00 
+					if (!(uvpt[pn] & PTE_P)) {
+  8018c7:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8018ce:	01 00 00 
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  8018d1:	45 89 e5             	mov    %r12d,%r13d
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  8018d4:	49 63 c5             	movslq %r13d,%rax
+  8018d7:	48 bb 00 00 40 80 00 	movabs $0x10080400000,%rbx
+  8018de:	01 00 00 
+  8018e1:	48 8b 04 c3          	mov    (%rbx,%rax,8),%rax
+  8018e5:	a8 01                	test   $0x1,%al
+  8018e7:	0f 85 ee fc ff ff    	jne    8015db <ufork+0x83>
+		for (int j = 0; j < NPTENTRIES; j++) {
+  8018ed:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8018f4:	40 
+  8018f5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8018f9:	41 83 c5 01          	add    $0x1,%r13d
+  8018fd:	48 b9 00 00 00 00 80 	movabs $0x8000000000,%rcx
+  801904:	00 00 00 
+  801907:	48 39 c8             	cmp    %rcx,%rax
+  80190a:	75 c8                	jne    8018d4 <ufork+0x37c>
+  80190c:	eb 82                	jmp    801890 <ufork+0x338>
+	r = dupflush(envid);
+  80190e:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801911:	48 b8 34 14 80 00 00 	movabs $0x801434,%rax
+  801918:	00 00 00 
+  80191b:	ff d0                	call   *%rax
+	if (r < 0) {
+  80191d:	85 c0                	test   %eax,%eax
+  80191f:	78 6c                	js     80198d <ufork+0x435>
+	r = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801921:	ba 07 00 00 00       	mov    $0x7,%edx
+  801926:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  80192b:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80192e:	48 b8 aa 0e 80 00 00 	movabs $0x800eaa,%rax
+  801935:	00 00 00 
+  801938:	ff d0                	call   *%rax
+	if (r < 0) {
+  80193a:	85 c0                	test   %eax,%eax
+  80193c:	78 7c                	js     8019ba <ufork+0x462>
+	r = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  80193e:	48 be f0 1d 80 00 00 	movabs $0x801df0,%rsi
+  801945:	00 00 00 
+  801948:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80194b:	48 b8 c2 11 80 00 00 	movabs $0x8011c2,%rax
+  801952:	00 00 00 
+  801955:	ff d0                	call   *%rax
+	if (r < 0) {
+  801957:	85 c0                	test   %eax,%eax
+  801959:	0f 88 88 00 00 00    	js     8019e7 <ufork+0x48f>
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  80195f:	be 02 00 00 00       	mov    $0x2,%esi
+  801964:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801967:	48 b8 67 11 80 00 00 	movabs $0x801167,%rax
+  80196e:	00 00 00 
+  801971:	ff d0                	call   *%rax
+	if (r < 0) {
+  801973:	85 c0                	test   %eax,%eax
+  801975:	0f 88 99 00 00 00    	js     801a14 <ufork+0x4bc>
+}
+  80197b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80197e:	48 83 c4 38          	add    $0x38,%rsp
+  801982:	5b                   	pop    %rbx
+  801983:	41 5c                	pop    %r12
+  801985:	41 5d                	pop    %r13
+  801987:	41 5e                	pop    %r14
+  801989:	41 5f                	pop    %r15
+  80198b:	5d                   	pop    %rbp
+  80198c:	c3                   	ret
+		panic("duppage failed:  %e", r);
+  80198d:	89 c1                	mov    %eax,%ecx
+  80198f:	48 ba 67 24 80 00 00 	movabs $0x802467,%rdx
+  801996:	00 00 00 
+  801999:	be 29 01 00 00       	mov    $0x129,%esi
+  80199e:	48 bf 27 24 80 00 00 	movabs $0x802427,%rdi
+  8019a5:	00 00 00 
+  8019a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ad:	49 b8 37 1c 80 00 00 	movabs $0x801c37,%r8
+  8019b4:	00 00 00 
+  8019b7:	41 ff d0             	call   *%r8
+		panic("sys_page_alloc for child exception stack failed: %e", r);
+  8019ba:	89 c1                	mov    %eax,%ecx
+  8019bc:	48 ba a8 23 80 00 00 	movabs $0x8023a8,%rdx
+  8019c3:	00 00 00 
+  8019c6:	be 2e 01 00 00       	mov    $0x12e,%esi
+  8019cb:	48 bf 27 24 80 00 00 	movabs $0x802427,%rdi
+  8019d2:	00 00 00 
+  8019d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019da:	49 b8 37 1c 80 00 00 	movabs $0x801c37,%r8
+  8019e1:	00 00 00 
+  8019e4:	41 ff d0             	call   *%r8
+		panic("sys_env_set_pgfault_upcall failed:  %e", r);
+  8019e7:	89 c1                	mov    %eax,%ecx
+  8019e9:	48 ba e0 23 80 00 00 	movabs $0x8023e0,%rdx
+  8019f0:	00 00 00 
+  8019f3:	be 33 01 00 00       	mov    $0x133,%esi
+  8019f8:	48 bf 27 24 80 00 00 	movabs $0x802427,%rdi
+  8019ff:	00 00 00 
+  801a02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a07:	49 b8 37 1c 80 00 00 	movabs $0x801c37,%r8
+  801a0e:	00 00 00 
+  801a11:	41 ff d0             	call   *%r8
+		panic("sys_env_set_status failed:  %e", r);
+  801a14:	89 c1                	mov    %eax,%ecx
+  801a16:	48 ba 08 24 80 00 00 	movabs $0x802408,%rdx
+  801a1d:	00 00 00 
+  801a20:	be 38 01 00 00       	mov    $0x138,%esi
+  801a25:	48 bf 27 24 80 00 00 	movabs $0x802427,%rdi
+  801a2c:	00 00 00 
+  801a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a34:	49 b8 37 1c 80 00 00 	movabs $0x801c37,%r8
+  801a3b:	00 00 00 
+  801a3e:	41 ff d0             	call   *%r8
+
+0000000000801a41 <sfork>:
+// on one stack, since nothing is private to the child.
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801a41:	55                   	push   %rbp
+  801a42:	48 89 e5             	mov    %rsp,%rbp
+  801a45:	48 89 f2             	mov    %rsi,%rdx
+	return sys_thread_create(thread_start, (uint64_t) fn, (uint64_t) arg);
+  801a48:	48 89 fe             	mov    %rdi,%rsi
+  801a4b:	48 bf 16 15 80 00 00 	movabs $0x801516,%rdi
+  801a52:	00 00 00 
+  801a55:	48 b8 36 10 80 00 00 	movabs $0x801036,%rax
+  801a5c:	00 00 00 
+  801a5f:	ff d0                	call   *%rax
+}
+  801a61:	5d                   	pop    %rbp
+  801a62:	c3                   	ret
+
+0000000000801a63 <ipc_recv>:
+	- if perm_store non null, contents should be bitwise OR with thisenv->env_ipc_perm
+	- return the value sent by the sender: thisenv->env_ipc_value
+*/
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801a63:	55                   	push   %rbp
+  801a64:	48 89 e5             	mov    %rsp,%rbp
+  801a67:	41 54                	push   %r12
+  801a69:	53                   	push   %rbx
+  801a6a:	48 89 fb             	mov    %rdi,%rbx
+  801a6d:	48 89 f7             	mov    %rsi,%rdi
+  801a70:	49 89 d4             	mov    %rdx,%r12
+	// LAB 4: Your code here.
+	int r;
+	
+	if (pg == NULL) pg = (void *)UTOP;
+  801a73:	48 85 f6             	test   %rsi,%rsi
+  801a76:	b8 00 00 80 bc       	mov    $0xbc800000,%eax
+  801a7b:	48 0f 44 f8          	cmove  %rax,%rdi
+	
+	r = sys_ipc_recv(pg);
+  801a7f:	48 b8 2e 12 80 00 00 	movabs $0x80122e,%rax
+  801a86:	00 00 00 
+  801a89:	ff d0                	call   *%rax
+	
+	if (r < 0) {
+  801a8b:	85 c0                	test   %eax,%eax
+  801a8d:	0f 88 99 00 00 00    	js     801b2c <ipc_recv+0xc9>
+			*perm_store = 0;
+		}
+		return r;
+	}
+	
+	if (from_env_store) {
+  801a93:	48 85 db             	test   %rbx,%rbx
+  801a96:	74 2e                	je     801ac6 <ipc_recv+0x63>
+	asm volatile("movl %%gs:%c1, %0"
+  801a98:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  801a9f:	00 
+		*from_env_store = thisenv->env_ipc_from;
+  801aa0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801aa5:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801aa9:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801aad:	48 c1 e2 04          	shl    $0x4,%rdx
+  801ab1:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801ab8:	00 00 00 
+  801abb:	48 01 d0             	add    %rdx,%rax
+  801abe:	8b 80 1c 01 00 00    	mov    0x11c(%rax),%eax
+  801ac4:	89 03                	mov    %eax,(%rbx)
+	}
+	if (perm_store) {
+  801ac6:	4d 85 e4             	test   %r12,%r12
+  801ac9:	74 30                	je     801afb <ipc_recv+0x98>
+  801acb:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  801ad2:	00 
+		*perm_store = thisenv->env_ipc_perm;
+  801ad3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801ad8:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801adc:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801ae0:	48 c1 e2 04          	shl    $0x4,%rdx
+  801ae4:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801aeb:	00 00 00 
+  801aee:	48 01 d0             	add    %rdx,%rax
+  801af1:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+  801af7:	41 89 04 24          	mov    %eax,(%r12)
+  801afb:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  801b02:	00 
+	}
+	
+	return thisenv->env_ipc_value;
+  801b03:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b08:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801b0c:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801b10:	48 c1 e2 04          	shl    $0x4,%rdx
+  801b14:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801b1b:	00 00 00 
+  801b1e:	48 01 d0             	add    %rdx,%rax
+  801b21:	8b 80 18 01 00 00    	mov    0x118(%rax),%eax
+}
+  801b27:	5b                   	pop    %rbx
+  801b28:	41 5c                	pop    %r12
+  801b2a:	5d                   	pop    %rbp
+  801b2b:	c3                   	ret
+		if (from_env_store) {
+  801b2c:	48 85 db             	test   %rbx,%rbx
+  801b2f:	74 06                	je     801b37 <ipc_recv+0xd4>
+			*from_env_store = 0;
+  801b31:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+		if (perm_store) {
+  801b37:	4d 85 e4             	test   %r12,%r12
+  801b3a:	74 eb                	je     801b27 <ipc_recv+0xc4>
+			*perm_store = 0;
+  801b3c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801b43:	00 
+  801b44:	eb e1                	jmp    801b27 <ipc_recv+0xc4>
+
+0000000000801b46 <ipc_send>:
+	- if a diff negative value, panic
+	- otherwise, body of loop should call sys_yield() to be allow JOS to schedule another env
+*/
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801b46:	55                   	push   %rbp
+  801b47:	48 89 e5             	mov    %rsp,%rbp
+  801b4a:	41 57                	push   %r15
+  801b4c:	41 56                	push   %r14
+  801b4e:	41 55                	push   %r13
+  801b50:	41 54                	push   %r12
+  801b52:	53                   	push   %rbx
+  801b53:	48 83 ec 18          	sub    $0x18,%rsp
+  801b57:	41 89 fd             	mov    %edi,%r13d
+  801b5a:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  801b5d:	48 89 d3             	mov    %rdx,%rbx
+  801b60:	41 89 cc             	mov    %ecx,%r12d
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  801b63:	48 85 d2             	test   %rdx,%rdx
+  801b66:	b8 00 00 80 bc       	mov    $0xbc800000,%eax
+  801b6b:	48 0f 44 d8          	cmove  %rax,%rbx
+	}
+	
+	// keep trying until success
+	while (1) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  801b6f:	49 be 1a 12 80 00 00 	movabs $0x80121a,%r14
+  801b76:	00 00 00 
+		if (r == 0) {
+			return;
+		}
+		
+		if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  801b79:	49 bf 8b 0e 80 00 00 	movabs $0x800e8b,%r15
+  801b80:	00 00 00 
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  801b83:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  801b86:	44 89 e1             	mov    %r12d,%ecx
+  801b89:	48 89 da             	mov    %rbx,%rdx
+  801b8c:	44 89 ef             	mov    %r13d,%edi
+  801b8f:	41 ff d6             	call   *%r14
+		if (r == 0) {
+  801b92:	85 c0                	test   %eax,%eax
+  801b94:	74 37                	je     801bcd <ipc_send+0x87>
+		if (r == -E_IPC_NOT_RECV) {
+  801b96:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801b99:	75 05                	jne    801ba0 <ipc_send+0x5a>
+			sys_yield();
+  801b9b:	41 ff d7             	call   *%r15
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  801b9e:	eb e3                	jmp    801b83 <ipc_send+0x3d>
+		} else {
+			panic("ipc_send - %e", r);
+  801ba0:	89 c1                	mov    %eax,%ecx
+  801ba2:	48 ba 7b 24 80 00 00 	movabs $0x80247b,%rdx
+  801ba9:	00 00 00 
+  801bac:	be 67 00 00 00       	mov    $0x67,%esi
+  801bb1:	48 bf 89 24 80 00 00 	movabs $0x802489,%rdi
+  801bb8:	00 00 00 
+  801bbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc0:	49 b8 37 1c 80 00 00 	movabs $0x801c37,%r8
+  801bc7:	00 00 00 
+  801bca:	41 ff d0             	call   *%r8
+		}
+	}
+}
+  801bcd:	48 83 c4 18          	add    $0x18,%rsp
+  801bd1:	5b                   	pop    %rbx
+  801bd2:	41 5c                	pop    %r12
+  801bd4:	41 5d                	pop    %r13
+  801bd6:	41 5e                	pop    %r14
+  801bd8:	41 5f                	pop    %r15
+  801bda:	5d                   	pop    %rbp
+  801bdb:	c3                   	ret
+
+0000000000801bdc <ipc_find_env>:
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+	int i;
+	for (i = 0; i < NENV; i++)
+  801bdc:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  801be1:	48 be 00 00 80 bc 00 	movabs $0xbc800000,%rsi
+  801be8:	00 00 00 
+  801beb:	48 63 c2             	movslq %edx,%rax
+  801bee:	48 8d 0c c0          	lea    (%rax,%rax,8),%rcx
+  801bf2:	48 8d 04 48          	lea    (%rax,%rcx,2),%rax
+  801bf6:	48 c1 e0 04          	shl    $0x4,%rax
+  801bfa:	48 01 f0             	add    %rsi,%rax
+  801bfd:	8b 80 c0 00 00 00    	mov    0xc0(%rax),%eax
+  801c03:	39 f8                	cmp    %edi,%eax
+  801c05:	74 11                	je     801c18 <ipc_find_env+0x3c>
+	for (i = 0; i < NENV; i++)
+  801c07:	83 c2 01             	add    $0x1,%edx
+  801c0a:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801c10:	75 d9                	jne    801beb <ipc_find_env+0xf>
+			return envs[i].env_id;
+	return 0;
+  801c12:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c17:	c3                   	ret
+			return envs[i].env_id;
+  801c18:	48 63 d2             	movslq %edx,%rdx
+  801c1b:	48 8d 14 4a          	lea    (%rdx,%rcx,2),%rdx
+  801c1f:	48 c1 e2 04          	shl    $0x4,%rdx
+  801c23:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801c2a:	00 00 00 
+  801c2d:	48 01 d0             	add    %rdx,%rax
+  801c30:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+  801c36:	c3                   	ret
+
+0000000000801c37 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801c37:	55                   	push   %rbp
+  801c38:	48 89 e5             	mov    %rsp,%rbp
+  801c3b:	41 56                	push   %r14
+  801c3d:	41 55                	push   %r13
+  801c3f:	41 54                	push   %r12
+  801c41:	53                   	push   %rbx
+  801c42:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  801c49:	49 89 fc             	mov    %rdi,%r12
+  801c4c:	41 89 f5             	mov    %esi,%r13d
+  801c4f:	48 89 d3             	mov    %rdx,%rbx
+  801c52:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  801c59:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  801c60:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  801c67:	84 c0                	test   %al,%al
+  801c69:	74 26                	je     801c91 <_panic+0x5a>
+  801c6b:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  801c72:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  801c79:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  801c7d:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  801c81:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  801c85:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  801c89:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  801c8d:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801c91:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  801c98:	00 00 00 
+  801c9b:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  801ca2:	00 00 00 
+  801ca5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801ca9:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  801cb0:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  801cb7:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801cbe:	48 b8 00 30 80 00 00 	movabs $0x803000,%rax
+  801cc5:	00 00 00 
+  801cc8:	4c 8b 30             	mov    (%rax),%r14
+  801ccb:	48 b8 5e 0e 80 00 00 	movabs $0x800e5e,%rax
+  801cd2:	00 00 00 
+  801cd5:	ff d0                	call   *%rax
+  801cd7:	89 c6                	mov    %eax,%esi
+  801cd9:	45 89 e8             	mov    %r13d,%r8d
+  801cdc:	4c 89 e1             	mov    %r12,%rcx
+  801cdf:	4c 89 f2             	mov    %r14,%rdx
+  801ce2:	48 bf 98 24 80 00 00 	movabs $0x802498,%rdi
+  801ce9:	00 00 00 
+  801cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf1:	49 bc 26 02 80 00 00 	movabs $0x800226,%r12
+  801cf8:	00 00 00 
+  801cfb:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801cfe:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  801d05:	48 89 df             	mov    %rbx,%rdi
+  801d08:	48 b8 c2 01 80 00 00 	movabs $0x8001c2,%rax
+  801d0f:	00 00 00 
+  801d12:	ff d0                	call   *%rax
+	cprintf("\n");
+  801d14:	48 bf 67 1e 80 00 00 	movabs $0x801e67,%rdi
+  801d1b:	00 00 00 
+  801d1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d23:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801d26:	cc                   	int3
+	while (1)
+  801d27:	eb fd                	jmp    801d26 <_panic+0xef>
+
+0000000000801d29 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801d29:	55                   	push   %rbp
+  801d2a:	48 89 e5             	mov    %rsp,%rbp
+  801d2d:	53                   	push   %rbx
+  801d2e:	48 83 ec 08          	sub    $0x8,%rsp
+  801d32:	48 89 fb             	mov    %rdi,%rbx
+	int r;
+
+	if (_pgfault_handler == 0) {
+  801d35:	48 ba 40 3c 80 00 00 	movabs $0x803c40,%rdx
+  801d3c:	00 00 00 
+  801d3f:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801d43:	74 13                	je     801d58 <set_pgfault_handler+0x2f>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801d45:	48 89 d8             	mov    %rbx,%rax
+  801d48:	48 a3 40 3c 80 00 00 	movabs %rax,0x803c40
+  801d4f:	00 00 00 
+}
+  801d52:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d56:	c9                   	leave
+  801d57:	c3                   	ret
+		r = sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801d58:	ba 07 00 00 00       	mov    $0x7,%edx
+  801d5d:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801d62:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d67:	48 b8 aa 0e 80 00 00 	movabs $0x800eaa,%rax
+  801d6e:	00 00 00 
+  801d71:	ff d0                	call   *%rax
+		if (r < 0) {
+  801d73:	85 c0                	test   %eax,%eax
+  801d75:	78 4c                	js     801dc3 <set_pgfault_handler+0x9a>
+		r = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801d77:	48 be f0 1d 80 00 00 	movabs $0x801df0,%rsi
+  801d7e:	00 00 00 
+  801d81:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d86:	48 b8 c2 11 80 00 00 	movabs $0x8011c2,%rax
+  801d8d:	00 00 00 
+  801d90:	ff d0                	call   *%rax
+		if (r < 0) {
+  801d92:	85 c0                	test   %eax,%eax
+  801d94:	79 af                	jns    801d45 <set_pgfault_handler+0x1c>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+  801d96:	89 c1                	mov    %eax,%ecx
+  801d98:	48 ba e8 24 80 00 00 	movabs $0x8024e8,%rdx
+  801d9f:	00 00 00 
+  801da2:	be 2c 00 00 00       	mov    $0x2c,%esi
+  801da7:	48 bf d6 24 80 00 00 	movabs $0x8024d6,%rdi
+  801dae:	00 00 00 
+  801db1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db6:	49 b8 37 1c 80 00 00 	movabs $0x801c37,%r8
+  801dbd:	00 00 00 
+  801dc0:	41 ff d0             	call   *%r8
+			panic("sys_page_alloc failed:  %e", r);
+  801dc3:	89 c1                	mov    %eax,%ecx
+  801dc5:	48 ba bb 24 80 00 00 	movabs $0x8024bb,%rdx
+  801dcc:	00 00 00 
+  801dcf:	be 28 00 00 00       	mov    $0x28,%esi
+  801dd4:	48 bf d6 24 80 00 00 	movabs $0x8024d6,%rdi
+  801ddb:	00 00 00 
+  801dde:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de3:	49 b8 37 1c 80 00 00 	movabs $0x801c37,%r8
+  801dea:	00 00 00 
+  801ded:	41 ff d0             	call   *%r8
+
+0000000000801df0 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi		// function argument: pointer to UTF
+  801df0:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  801df3:	48 a1 40 3c 80 00 00 	movabs 0x803c40,%rax
+  801dfa:	00 00 00 
+	call *%rax
+  801dfd:	ff d0                	call   *%rax
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here. (Hint. You need to modify the trap time rsp to make room for the return rip ) */
+
+	movq  152(%rsp), %rax
+  801dff:	48 8b 84 24 98 00 00 	mov    0x98(%rsp),%rax
+  801e06:	00 
+	subq $8, %rax
+  801e07:	48 83 e8 08          	sub    $0x8,%rax
+	movq %rax, 152(%rsp)
+  801e0b:	48 89 84 24 98 00 00 	mov    %rax,0x98(%rsp)
+  801e12:	00 
+
+	movq 136(%rsp), %rbx
+  801e13:	48 8b 9c 24 88 00 00 	mov    0x88(%rsp),%rbx
+  801e1a:	00 
+	movq %rbx, (%rax)
+  801e1b:	48 89 18             	mov    %rbx,(%rax)
+
+	/* Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here. (Hint, the oposite of _alltraps) */
+
+	addq $16, %rsp
+  801e1e:	48 83 c4 10          	add    $0x10,%rsp
+	
+	popq %r15
+  801e22:	41 5f                	pop    %r15
+	popq %r14
+  801e24:	41 5e                	pop    %r14
+	popq %r13
+  801e26:	41 5d                	pop    %r13
+	popq %r12
+  801e28:	41 5c                	pop    %r12
+	popq %r11
+  801e2a:	41 5b                	pop    %r11
+	popq %r10
+  801e2c:	41 5a                	pop    %r10
+	popq %r9
+  801e2e:	41 59                	pop    %r9
+	popq %r8
+  801e30:	41 58                	pop    %r8
+	popq %rsi
+  801e32:	5e                   	pop    %rsi
+	popq %rdi
+  801e33:	5f                   	pop    %rdi
+	popq %rbp
+  801e34:	5d                   	pop    %rbp
+	popq %rdx
+  801e35:	5a                   	pop    %rdx
+	popq %rcx
+  801e36:	59                   	pop    %rcx
+	popq %rbx
+  801e37:	5b                   	pop    %rbx
+	popq %rax
+  801e38:	58                   	pop    %rax
+
+	addq $8, %rsp
+  801e39:	48 83 c4 08          	add    $0x8,%rsp
+	/* Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 4: Your code here. */
+
+	popfq
+  801e3d:	9d                   	popf
+
+	/* Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here. */
+
+	popq %rsp
+  801e3e:	5c                   	pop    %rsp
+
+	/* Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here. */
+  801e3f:	c3                   	ret
@@ -0,0 +1,3476 @@
+
+obj/user/pingpongs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 10 02 00 00       	call   800241 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <pingpong>:
+
+uint32_t val;
+
+static void
+pingpong(void *arg)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	41 57                	push   %r15
+  800039:	41 56                	push   %r14
+  80003b:	41 55                	push   %r13
+  80003d:	41 54                	push   %r12
+  80003f:	53                   	push   %rbx
+  800040:	48 83 ec 28          	sub    $0x28,%rsp
+	envid_t who;
+
+	while (1) {
+		ipc_recv(&who, 0, 0);
+		cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  800044:	49 bd 00 00 80 bc 00 	movabs $0xbc800000,%r13
+  80004b:	00 00 00 
+  80004e:	49 bc 20 30 80 00 00 	movabs $0x803020,%r12
+  800055:	00 00 00 
+		ipc_recv(&who, 0, 0);
+  800058:	ba 00 00 00 00       	mov    $0x0,%edx
+  80005d:	be 00 00 00 00       	mov    $0x0,%esi
+  800062:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  800066:	48 b8 63 1c 80 00 00 	movabs $0x801c63,%rax
+  80006d:	00 00 00 
+  800070:	ff d0                	call   *%rax
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800072:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800079:	00 
+		cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  80007a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80007f:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800083:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  800087:	48 c1 e0 04          	shl    $0x4,%rax
+  80008b:	4c 01 e8             	add    %r13,%rax
+  80008e:	44 8b b8 b8 00 00 00 	mov    0xb8(%rax),%r15d
+  800095:	65 8b 1c 25 b8 00 00 	mov    %gs:0xb8,%ebx
+  80009c:	00 
+  80009d:	44 8b 75 cc          	mov    -0x34(%rbp),%r14d
+  8000a1:	41 8b 04 24          	mov    (%r12),%eax
+  8000a5:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8000a8:	48 b9 5e 10 80 00 00 	movabs $0x80105e,%rcx
+  8000af:	00 00 00 
+  8000b2:	ff d1                	call   *%rcx
+  8000b4:	89 c6                	mov    %eax,%esi
+		     : "=r" (id) : "i" (offsetof(struct Env, env_id)));
+	return &envs[ENVX(id)];
+  8000b6:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8000bc:	48 8d 04 db          	lea    (%rbx,%rbx,8),%rax
+  8000c0:	48 8d 04 43          	lea    (%rbx,%rax,2),%rax
+  8000c4:	48 c1 e0 04          	shl    $0x4,%rax
+  8000c8:	45 89 f9             	mov    %r15d,%r9d
+  8000cb:	4d 8d 44 05 00       	lea    0x0(%r13,%rax,1),%r8
+  8000d0:	44 89 f1             	mov    %r14d,%ecx
+  8000d3:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  8000d6:	48 bf 60 1f 80 00 00 	movabs $0x801f60,%rdi
+  8000dd:	00 00 00 
+  8000e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e5:	49 ba 26 04 80 00 00 	movabs $0x800426,%r10
+  8000ec:	00 00 00 
+  8000ef:	41 ff d2             	call   *%r10
+		if (val == 10)
+  8000f2:	41 8b 04 24          	mov    (%r12),%eax
+  8000f6:	83 f8 0a             	cmp    $0xa,%eax
+  8000f9:	74 30                	je     80012b <pingpong+0xf8>
+			return;
+		++val;
+  8000fb:	83 c0 01             	add    $0x1,%eax
+  8000fe:	41 89 04 24          	mov    %eax,(%r12)
+		ipc_send(who, 0, 0, 0);
+  800102:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800107:	ba 00 00 00 00       	mov    $0x0,%edx
+  80010c:	be 00 00 00 00       	mov    $0x0,%esi
+  800111:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800114:	48 b8 46 1d 80 00 00 	movabs $0x801d46,%rax
+  80011b:	00 00 00 
+  80011e:	ff d0                	call   *%rax
+		if (val == 10)
+  800120:	41 83 3c 24 0a       	cmpl   $0xa,(%r12)
+  800125:	0f 85 2d ff ff ff    	jne    800058 <pingpong+0x25>
+			return;
+	}
+}
+  80012b:	48 83 c4 28          	add    $0x28,%rsp
+  80012f:	5b                   	pop    %rbx
+  800130:	41 5c                	pop    %r12
+  800132:	41 5d                	pop    %r13
+  800134:	41 5e                	pop    %r14
+  800136:	41 5f                	pop    %r15
+  800138:	5d                   	pop    %rbp
+  800139:	c3                   	ret
+
+000000000080013a <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80013a:	55                   	push   %rbp
+  80013b:	48 89 e5             	mov    %rsp,%rbp
+  80013e:	41 55                	push   %r13
+  800140:	41 54                	push   %r12
+  800142:	53                   	push   %rbx
+  800143:	48 83 ec 08          	sub    $0x8,%rsp
+	envid_t who;
+
+	if ((who = sfork(pingpong, NULL)) < 0)
+  800147:	be 00 00 00 00       	mov    $0x0,%esi
+  80014c:	48 bf 33 00 80 00 00 	movabs $0x800033,%rdi
+  800153:	00 00 00 
+  800156:	48 b8 41 1c 80 00 00 	movabs $0x801c41,%rax
+  80015d:	00 00 00 
+  800160:	ff d0                	call   *%rax
+  800162:	89 c3                	mov    %eax,%ebx
+  800164:	85 c0                	test   %eax,%eax
+  800166:	0f 88 a8 00 00 00    	js     800214 <umain+0xda>
+	asm volatile("movl %%gs:%c1, %0"
+  80016c:	65 44 8b 2c 25 b8 00 	mov    %gs:0xb8,%r13d
+  800173:	00 00 
+		panic("sfork: %e", who);
+	cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  800175:	49 bc 5e 10 80 00 00 	movabs $0x80105e,%r12
+  80017c:	00 00 00 
+  80017f:	41 ff d4             	call   *%r12
+  800182:	89 c6                	mov    %eax,%esi
+	return &envs[ENVX(id)];
+  800184:	44 89 ea             	mov    %r13d,%edx
+  800187:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80018d:	48 8d 04 d2          	lea    (%rdx,%rdx,8),%rax
+  800191:	48 8d 14 42          	lea    (%rdx,%rax,2),%rdx
+  800195:	48 c1 e2 04          	shl    $0x4,%rdx
+  800199:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  8001a0:	00 00 00 
+  8001a3:	48 01 c2             	add    %rax,%rdx
+  8001a6:	48 bf a1 1f 80 00 00 	movabs $0x801fa1,%rdi
+  8001ad:	00 00 00 
+  8001b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b5:	49 bd 26 04 80 00 00 	movabs $0x800426,%r13
+  8001bc:	00 00 00 
+  8001bf:	41 ff d5             	call   *%r13
+	// get the ball rolling
+	cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  8001c2:	41 ff d4             	call   *%r12
+  8001c5:	89 c6                	mov    %eax,%esi
+  8001c7:	89 da                	mov    %ebx,%edx
+  8001c9:	48 bf bb 1f 80 00 00 	movabs $0x801fbb,%rdi
+  8001d0:	00 00 00 
+  8001d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d8:	41 ff d5             	call   *%r13
+	ipc_send(who, 0, 0, 0);
+  8001db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ea:	89 df                	mov    %ebx,%edi
+  8001ec:	48 b8 46 1d 80 00 00 	movabs $0x801d46,%rax
+  8001f3:	00 00 00 
+  8001f6:	ff d0                	call   *%rax
+	pingpong(NULL);
+  8001f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001fd:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  800204:	00 00 00 
+  800207:	ff d0                	call   *%rax
+}
+  800209:	48 83 c4 08          	add    $0x8,%rsp
+  80020d:	5b                   	pop    %rbx
+  80020e:	41 5c                	pop    %r12
+  800210:	41 5d                	pop    %r13
+  800212:	5d                   	pop    %rbp
+  800213:	c3                   	ret
+		panic("sfork: %e", who);
+  800214:	89 c1                	mov    %eax,%ecx
+  800216:	48 ba 86 1f 80 00 00 	movabs $0x801f86,%rdx
+  80021d:	00 00 00 
+  800220:	be 1f 00 00 00       	mov    $0x1f,%esi
+  800225:	48 bf 90 1f 80 00 00 	movabs $0x801f90,%rdi
+  80022c:	00 00 00 
+  80022f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800234:	49 b8 87 02 80 00 00 	movabs $0x800287,%r8
+  80023b:	00 00 00 
+  80023e:	41 ff d0             	call   *%r8
+
+0000000000800241 <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  800241:	55                   	push   %rbp
+  800242:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800245:	85 ff                	test   %edi,%edi
+  800247:	7e 0d                	jle    800256 <libmain+0x15>
+		binaryname = argv[0];
+  800249:	48 8b 06             	mov    (%rsi),%rax
+  80024c:	48 a3 00 30 80 00 00 	movabs %rax,0x803000
+  800253:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  800256:	48 b8 3a 01 80 00 00 	movabs $0x80013a,%rax
+  80025d:	00 00 00 
+  800260:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800262:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  800269:	00 00 00 
+  80026c:	ff d0                	call   *%rax
+}
+  80026e:	5d                   	pop    %rbp
+  80026f:	c3                   	ret
+
+0000000000800270 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800270:	55                   	push   %rbp
+  800271:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  800274:	bf 00 00 00 00       	mov    $0x0,%edi
+  800279:	48 b8 03 10 80 00 00 	movabs $0x801003,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+
+0000000000800287 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800287:	55                   	push   %rbp
+  800288:	48 89 e5             	mov    %rsp,%rbp
+  80028b:	41 56                	push   %r14
+  80028d:	41 55                	push   %r13
+  80028f:	41 54                	push   %r12
+  800291:	53                   	push   %rbx
+  800292:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800299:	49 89 fc             	mov    %rdi,%r12
+  80029c:	41 89 f5             	mov    %esi,%r13d
+  80029f:	48 89 d3             	mov    %rdx,%rbx
+  8002a2:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8002a9:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8002b0:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8002b7:	84 c0                	test   %al,%al
+  8002b9:	74 26                	je     8002e1 <_panic+0x5a>
+  8002bb:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8002c2:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8002c9:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8002cd:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8002d1:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8002d5:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8002d9:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8002dd:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002e1:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8002e8:	00 00 00 
+  8002eb:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8002f2:	00 00 00 
+  8002f5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002f9:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800300:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800307:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80030e:	48 b8 00 30 80 00 00 	movabs $0x803000,%rax
+  800315:	00 00 00 
+  800318:	4c 8b 30             	mov    (%rax),%r14
+  80031b:	48 b8 5e 10 80 00 00 	movabs $0x80105e,%rax
+  800322:	00 00 00 
+  800325:	ff d0                	call   *%rax
+  800327:	89 c6                	mov    %eax,%esi
+  800329:	45 89 e8             	mov    %r13d,%r8d
+  80032c:	4c 89 e1             	mov    %r12,%rcx
+  80032f:	4c 89 f2             	mov    %r14,%rdx
+  800332:	48 bf e0 1f 80 00 00 	movabs $0x801fe0,%rdi
+  800339:	00 00 00 
+  80033c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800341:	49 bc 26 04 80 00 00 	movabs $0x800426,%r12
+  800348:	00 00 00 
+  80034b:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80034e:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  800355:	48 89 df             	mov    %rbx,%rdi
+  800358:	48 b8 c2 03 80 00 00 	movabs $0x8003c2,%rax
+  80035f:	00 00 00 
+  800362:	ff d0                	call   *%rax
+	cprintf("\n");
+  800364:	48 bf b9 1f 80 00 00 	movabs $0x801fb9,%rdi
+  80036b:	00 00 00 
+  80036e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800373:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800376:	cc                   	int3
+	while (1)
+  800377:	eb fd                	jmp    800376 <_panic+0xef>
+
+0000000000800379 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800379:	55                   	push   %rbp
+  80037a:	48 89 e5             	mov    %rsp,%rbp
+  80037d:	53                   	push   %rbx
+  80037e:	48 83 ec 08          	sub    $0x8,%rsp
+  800382:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  800385:	8b 06                	mov    (%rsi),%eax
+  800387:	8d 50 01             	lea    0x1(%rax),%edx
+  80038a:	89 16                	mov    %edx,(%rsi)
+  80038c:	48 98                	cltq
+  80038e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  800393:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800399:	74 0a                	je     8003a5 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80039b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80039f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003a3:	c9                   	leave
+  8003a4:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003a5:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8003a9:	be ff 00 00 00       	mov    $0xff,%esi
+  8003ae:	48 b8 cb 0f 80 00 00 	movabs $0x800fcb,%rax
+  8003b5:	00 00 00 
+  8003b8:	ff d0                	call   *%rax
+		b->idx = 0;
+  8003ba:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003c0:	eb d9                	jmp    80039b <putch+0x22>
+
+00000000008003c2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003c2:	55                   	push   %rbp
+  8003c3:	48 89 e5             	mov    %rsp,%rbp
+  8003c6:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8003cd:	48 89 fa             	mov    %rdi,%rdx
+  8003d0:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  8003d3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8003da:	00 00 00 
+	b.cnt = 0;
+  8003dd:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8003e4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8003e7:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  8003ee:	48 bf 79 03 80 00 00 	movabs $0x800379,%rdi
+  8003f5:	00 00 00 
+  8003f8:	48 b8 e0 05 80 00 00 	movabs $0x8005e0,%rax
+  8003ff:	00 00 00 
+  800402:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  800404:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  80040b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800412:	48 b8 cb 0f 80 00 00 	movabs $0x800fcb,%rax
+  800419:	00 00 00 
+  80041c:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  80041e:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  800424:	c9                   	leave
+  800425:	c3                   	ret
+
+0000000000800426 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800426:	55                   	push   %rbp
+  800427:	48 89 e5             	mov    %rsp,%rbp
+  80042a:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800431:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800438:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80043f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800446:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80044d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800454:	84 c0                	test   %al,%al
+  800456:	74 20                	je     800478 <cprintf+0x52>
+  800458:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80045c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800460:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800464:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800468:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80046c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800470:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800474:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800478:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  80047f:	00 00 00 
+  800482:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800489:	00 00 00 
+  80048c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800490:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800497:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80049e:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  8004a5:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  8004ac:	48 b8 c2 03 80 00 00 	movabs $0x8003c2,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  8004b8:	c9                   	leave
+  8004b9:	c3                   	ret
+
+00000000008004ba <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8004ba:	55                   	push   %rbp
+  8004bb:	48 89 e5             	mov    %rsp,%rbp
+  8004be:	41 57                	push   %r15
+  8004c0:	41 56                	push   %r14
+  8004c2:	41 55                	push   %r13
+  8004c4:	41 54                	push   %r12
+  8004c6:	53                   	push   %rbx
+  8004c7:	48 83 ec 18          	sub    $0x18,%rsp
+  8004cb:	49 89 fc             	mov    %rdi,%r12
+  8004ce:	49 89 f5             	mov    %rsi,%r13
+  8004d1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004d5:	44 89 c3             	mov    %r8d,%ebx
+  8004d8:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8004db:	41 89 cf             	mov    %ecx,%r15d
+  8004de:	4c 39 fa             	cmp    %r15,%rdx
+  8004e1:	72 29                	jb     80050c <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004e3:	48 89 d0             	mov    %rdx,%rax
+  8004e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004eb:	49 f7 f7             	div    %r15
+  8004ee:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004f2:	48 89 c2             	mov    %rax,%rdx
+  8004f5:	48 b8 ba 04 80 00 00 	movabs $0x8004ba,%rax
+  8004fc:	00 00 00 
+  8004ff:	ff d0                	call   *%rax
+  800501:	eb 10                	jmp    800513 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800503:	4c 89 ee             	mov    %r13,%rsi
+  800506:	44 89 f7             	mov    %r14d,%edi
+  800509:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  80050c:	83 eb 01             	sub    $0x1,%ebx
+  80050f:	85 db                	test   %ebx,%ebx
+  800511:	7f f0                	jg     800503 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800513:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800517:	ba 00 00 00 00       	mov    $0x0,%edx
+  80051c:	49 f7 f7             	div    %r15
+  80051f:	48 b8 03 20 80 00 00 	movabs $0x802003,%rax
+  800526:	00 00 00 
+  800529:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  80052d:	4c 89 ee             	mov    %r13,%rsi
+  800530:	41 ff d4             	call   *%r12
+}
+  800533:	48 83 c4 18          	add    $0x18,%rsp
+  800537:	5b                   	pop    %rbx
+  800538:	41 5c                	pop    %r12
+  80053a:	41 5d                	pop    %r13
+  80053c:	41 5e                	pop    %r14
+  80053e:	41 5f                	pop    %r15
+  800540:	5d                   	pop    %rbp
+  800541:	c3                   	ret
+
+0000000000800542 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  800542:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  800546:	48 8b 06             	mov    (%rsi),%rax
+  800549:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80054d:	73 0a                	jae    800559 <sprintputch+0x17>
+		*b->buf++ = ch;
+  80054f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800553:	48 89 16             	mov    %rdx,(%rsi)
+  800556:	40 88 38             	mov    %dil,(%rax)
+}
+  800559:	c3                   	ret
+
+000000000080055a <printfmt>:
+{
+  80055a:	55                   	push   %rbp
+  80055b:	48 89 e5             	mov    %rsp,%rbp
+  80055e:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800565:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80056c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800573:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80057a:	84 c0                	test   %al,%al
+  80057c:	74 20                	je     80059e <printfmt+0x44>
+  80057e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800582:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800586:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80058a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80058e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800592:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800596:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80059a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  80059e:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8005a5:	00 00 00 
+  8005a8:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8005af:	00 00 00 
+  8005b2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005b6:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8005bd:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8005c4:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8005cb:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8005d2:	48 b8 e0 05 80 00 00 	movabs $0x8005e0,%rax
+  8005d9:	00 00 00 
+  8005dc:	ff d0                	call   *%rax
+}
+  8005de:	c9                   	leave
+  8005df:	c3                   	ret
+
+00000000008005e0 <vprintfmt>:
+{
+  8005e0:	55                   	push   %rbp
+  8005e1:	48 89 e5             	mov    %rsp,%rbp
+  8005e4:	41 57                	push   %r15
+  8005e6:	41 56                	push   %r14
+  8005e8:	41 55                	push   %r13
+  8005ea:	41 54                	push   %r12
+  8005ec:	53                   	push   %rbx
+  8005ed:	48 83 ec 48          	sub    $0x48,%rsp
+  8005f1:	49 89 fe             	mov    %rdi,%r14
+  8005f4:	49 89 f5             	mov    %rsi,%r13
+  8005f7:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  8005fa:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  8005fe:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  800602:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800606:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80060a:	eb 09                	jmp    800615 <vprintfmt+0x35>
+			putch(ch, putdat);
+  80060c:	4c 89 ee             	mov    %r13,%rsi
+  80060f:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800612:	4c 89 e3             	mov    %r12,%rbx
+  800615:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800619:	0f b6 3b             	movzbl (%rbx),%edi
+  80061c:	83 ff 25             	cmp    $0x25,%edi
+  80061f:	74 13                	je     800634 <vprintfmt+0x54>
+			if (ch == '\0')
+  800621:	85 ff                	test   %edi,%edi
+  800623:	75 e7                	jne    80060c <vprintfmt+0x2c>
+}
+  800625:	48 83 c4 48          	add    $0x48,%rsp
+  800629:	5b                   	pop    %rbx
+  80062a:	41 5c                	pop    %r12
+  80062c:	41 5d                	pop    %r13
+  80062e:	41 5e                	pop    %r14
+  800630:	41 5f                	pop    %r15
+  800632:	5d                   	pop    %rbp
+  800633:	c3                   	ret
+		padc = ' ';
+  800634:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  800638:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  80063f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  800645:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  80064c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800651:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800656:	41 0f b6 14 24       	movzbl (%r12),%edx
+  80065b:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  80065e:	3c 55                	cmp    $0x55,%al
+  800660:	0f 87 4f 05 00 00    	ja     800bb5 <vprintfmt+0x5d5>
+  800666:	0f b6 c0             	movzbl %al,%eax
+  800669:	48 be c0 20 80 00 00 	movabs $0x8020c0,%rsi
+  800670:	00 00 00 
+  800673:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  800676:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  800679:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  80067d:	eb d2                	jmp    800651 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  80067f:	49 89 dc             	mov    %rbx,%r12
+  800682:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  800686:	eb c9                	jmp    800651 <vprintfmt+0x71>
+  800688:	0f b6 d2             	movzbl %dl,%edx
+  80068b:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  80068e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  800694:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800698:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  80069d:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  8006a2:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  8006a5:	83 f8 09             	cmp    $0x9,%eax
+  8006a8:	77 20                	ja     8006ca <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  8006aa:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  8006ae:	eb e4                	jmp    800694 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  8006b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b6:	77 27                	ja     8006df <vprintfmt+0xff>
+  8006b8:	89 c2                	mov    %eax,%edx
+  8006ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006be:	83 c0 08             	add    $0x8,%eax
+  8006c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c4:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  8006c7:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  8006ca:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006ce:	79 81                	jns    800651 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  8006d0:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  8006d4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006da:	e9 72 ff ff ff       	jmp    800651 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  8006df:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006eb:	eb d7                	jmp    8006c4 <vprintfmt+0xe4>
+			if (width < 0)
+  8006ed:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  8006f0:	85 f6                	test   %esi,%esi
+  8006f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f7:	0f 49 c6             	cmovns %esi,%eax
+  8006fa:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006fd:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800700:	e9 4c ff ff ff       	jmp    800651 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800705:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  800708:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  80070f:	e9 3d ff ff ff       	jmp    800651 <vprintfmt+0x71>
+			lflag++;
+  800714:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800717:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  80071a:	e9 32 ff ff ff       	jmp    800651 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  80071f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800722:	83 f8 2f             	cmp    $0x2f,%eax
+  800725:	77 19                	ja     800740 <vprintfmt+0x160>
+  800727:	89 c2                	mov    %eax,%edx
+  800729:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80072d:	83 c0 08             	add    $0x8,%eax
+  800730:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800733:	8b 3a                	mov    (%rdx),%edi
+  800735:	4c 89 ee             	mov    %r13,%rsi
+  800738:	41 ff d6             	call   *%r14
+			break;
+  80073b:	e9 d5 fe ff ff       	jmp    800615 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  800740:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800744:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800748:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80074c:	eb e5                	jmp    800733 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  80074e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800751:	83 f8 2f             	cmp    $0x2f,%eax
+  800754:	77 5a                	ja     8007b0 <vprintfmt+0x1d0>
+  800756:	89 c2                	mov    %eax,%edx
+  800758:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80075c:	83 c0 08             	add    $0x8,%eax
+  80075f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800762:	8b 02                	mov    (%rdx),%eax
+  800764:	89 c1                	mov    %eax,%ecx
+  800766:	f7 d9                	neg    %ecx
+  800768:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80076b:	83 f9 08             	cmp    $0x8,%ecx
+  80076e:	7f 4e                	jg     8007be <vprintfmt+0x1de>
+  800770:	48 63 c1             	movslq %ecx,%rax
+  800773:	48 ba 80 23 80 00 00 	movabs $0x802380,%rdx
+  80077a:	00 00 00 
+  80077d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800781:	48 85 c0             	test   %rax,%rax
+  800784:	74 38                	je     8007be <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800786:	48 89 c1             	mov    %rax,%rcx
+  800789:	48 ba 24 20 80 00 00 	movabs $0x802024,%rdx
+  800790:	00 00 00 
+  800793:	4c 89 ee             	mov    %r13,%rsi
+  800796:	4c 89 f7             	mov    %r14,%rdi
+  800799:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079e:	49 b8 5a 05 80 00 00 	movabs $0x80055a,%r8
+  8007a5:	00 00 00 
+  8007a8:	41 ff d0             	call   *%r8
+  8007ab:	e9 65 fe ff ff       	jmp    800615 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  8007b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007bc:	eb a4                	jmp    800762 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  8007be:	48 ba 1b 20 80 00 00 	movabs $0x80201b,%rdx
+  8007c5:	00 00 00 
+  8007c8:	4c 89 ee             	mov    %r13,%rsi
+  8007cb:	4c 89 f7             	mov    %r14,%rdi
+  8007ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d3:	49 b8 5a 05 80 00 00 	movabs $0x80055a,%r8
+  8007da:	00 00 00 
+  8007dd:	41 ff d0             	call   *%r8
+  8007e0:	e9 30 fe ff ff       	jmp    800615 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  8007e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007eb:	77 36                	ja     800823 <vprintfmt+0x243>
+  8007ed:	89 c2                	mov    %eax,%edx
+  8007ef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f3:	83 c0 08             	add    $0x8,%eax
+  8007f6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f9:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  8007fc:	48 85 c9             	test   %rcx,%rcx
+  8007ff:	48 b8 14 20 80 00 00 	movabs $0x802014,%rax
+  800806:	00 00 00 
+  800809:	48 0f 45 c1          	cmovne %rcx,%rax
+  80080d:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800811:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800815:	7e 06                	jle    80081d <vprintfmt+0x23d>
+  800817:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  80081b:	75 14                	jne    800831 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80081d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800821:	eb 64                	jmp    800887 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800823:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800827:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80082b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80082f:	eb c8                	jmp    8007f9 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800831:	49 63 f7             	movslq %r15d,%rsi
+  800834:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800838:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  80083f:	00 00 00 
+  800842:	ff d0                	call   *%rax
+  800844:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800847:	29 c1                	sub    %eax,%ecx
+  800849:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  80084c:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  80084f:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800853:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800856:	eb 0d                	jmp    800865 <vprintfmt+0x285>
+					putch(padc, putdat);
+  800858:	4c 89 ee             	mov    %r13,%rsi
+  80085b:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  80085e:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800861:	41 83 ec 01          	sub    $0x1,%r12d
+  800865:	45 85 e4             	test   %r12d,%r12d
+  800868:	7f ee                	jg     800858 <vprintfmt+0x278>
+  80086a:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  80086d:	85 c9                	test   %ecx,%ecx
+  80086f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800874:	0f 49 c1             	cmovns %ecx,%eax
+  800877:	29 c1                	sub    %eax,%ecx
+  800879:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  80087c:	eb 9f                	jmp    80081d <vprintfmt+0x23d>
+					putch(ch, putdat);
+  80087e:	4c 89 ee             	mov    %r13,%rsi
+  800881:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800884:	4c 89 e2             	mov    %r12,%rdx
+  800887:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  80088b:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800891:	0f be f8             	movsbl %al,%edi
+  800894:	85 ff                	test   %edi,%edi
+  800896:	74 29                	je     8008c1 <vprintfmt+0x2e1>
+  800898:	45 85 ff             	test   %r15d,%r15d
+  80089b:	78 06                	js     8008a3 <vprintfmt+0x2c3>
+  80089d:	41 83 ef 01          	sub    $0x1,%r15d
+  8008a1:	78 1e                	js     8008c1 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8008a3:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  8008a7:	74 d5                	je     80087e <vprintfmt+0x29e>
+  8008a9:	0f be c0             	movsbl %al,%eax
+  8008ac:	83 e8 20             	sub    $0x20,%eax
+  8008af:	83 f8 5e             	cmp    $0x5e,%eax
+  8008b2:	76 ca                	jbe    80087e <vprintfmt+0x29e>
+					putch('?', putdat);
+  8008b4:	4c 89 ee             	mov    %r13,%rsi
+  8008b7:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008bc:	41 ff d6             	call   *%r14
+  8008bf:	eb c3                	jmp    800884 <vprintfmt+0x2a4>
+  8008c1:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  8008c5:	8b 45 98             	mov    -0x68(%rbp),%eax
+  8008c8:	41 01 c4             	add    %eax,%r12d
+  8008cb:	41 29 d4             	sub    %edx,%r12d
+  8008ce:	eb 0f                	jmp    8008df <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  8008d0:	4c 89 ee             	mov    %r13,%rsi
+  8008d3:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008d8:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  8008db:	41 83 ec 01          	sub    $0x1,%r12d
+  8008df:	45 85 e4             	test   %r12d,%r12d
+  8008e2:	7f ec                	jg     8008d0 <vprintfmt+0x2f0>
+  8008e4:	e9 2c fd ff ff       	jmp    800615 <vprintfmt+0x35>
+	if (lflag >= 2)
+  8008e9:	83 f9 01             	cmp    $0x1,%ecx
+  8008ec:	7f 1d                	jg     80090b <vprintfmt+0x32b>
+	else if (lflag)
+  8008ee:	85 c9                	test   %ecx,%ecx
+  8008f0:	74 5e                	je     800950 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  8008f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f8:	77 48                	ja     800942 <vprintfmt+0x362>
+  8008fa:	89 c2                	mov    %eax,%edx
+  8008fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800900:	83 c0 08             	add    $0x8,%eax
+  800903:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800906:	4c 8b 22             	mov    (%rdx),%r12
+  800909:	eb 17                	jmp    800922 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  80090b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090e:	83 f8 2f             	cmp    $0x2f,%eax
+  800911:	77 21                	ja     800934 <vprintfmt+0x354>
+  800913:	89 c2                	mov    %eax,%edx
+  800915:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800919:	83 c0 08             	add    $0x8,%eax
+  80091c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091f:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800922:	4d 85 e4             	test   %r12,%r12
+  800925:	78 50                	js     800977 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  800927:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  80092a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80092f:	e9 b4 01 00 00       	jmp    800ae8 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800934:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800938:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800940:	eb dd                	jmp    80091f <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800942:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800946:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094e:	eb b6                	jmp    800906 <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800950:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800953:	83 f8 2f             	cmp    $0x2f,%eax
+  800956:	77 11                	ja     800969 <vprintfmt+0x389>
+  800958:	89 c2                	mov    %eax,%edx
+  80095a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095e:	83 c0 08             	add    $0x8,%eax
+  800961:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800964:	4c 63 22             	movslq (%rdx),%r12
+  800967:	eb b9                	jmp    800922 <vprintfmt+0x342>
+  800969:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800971:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800975:	eb ed                	jmp    800964 <vprintfmt+0x384>
+				putch('-', putdat);
+  800977:	4c 89 ee             	mov    %r13,%rsi
+  80097a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80097f:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800982:	4c 89 e2             	mov    %r12,%rdx
+  800985:	48 f7 da             	neg    %rdx
+			base = 10;
+  800988:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80098d:	e9 56 01 00 00       	jmp    800ae8 <vprintfmt+0x508>
+	if (lflag >= 2)
+  800992:	83 f9 01             	cmp    $0x1,%ecx
+  800995:	7f 25                	jg     8009bc <vprintfmt+0x3dc>
+	else if (lflag)
+  800997:	85 c9                	test   %ecx,%ecx
+  800999:	74 5e                	je     8009f9 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  80099b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099e:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a1:	77 48                	ja     8009eb <vprintfmt+0x40b>
+  8009a3:	89 c2                	mov    %eax,%edx
+  8009a5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a9:	83 c0 08             	add    $0x8,%eax
+  8009ac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009af:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8009b2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  8009b7:	e9 2c 01 00 00       	jmp    800ae8 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8009bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c2:	77 19                	ja     8009dd <vprintfmt+0x3fd>
+  8009c4:	89 c2                	mov    %eax,%edx
+  8009c6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ca:	83 c0 08             	add    $0x8,%eax
+  8009cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d0:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8009d3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  8009d8:	e9 0b 01 00 00       	jmp    800ae8 <vprintfmt+0x508>
+  8009dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e9:	eb e5                	jmp    8009d0 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  8009eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f7:	eb b6                	jmp    8009af <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  8009f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ff:	77 18                	ja     800a19 <vprintfmt+0x439>
+  800a01:	89 c2                	mov    %eax,%edx
+  800a03:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a07:	83 c0 08             	add    $0x8,%eax
+  800a0a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0d:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800a0f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800a14:	e9 cf 00 00 00       	jmp    800ae8 <vprintfmt+0x508>
+  800a19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a25:	eb e6                	jmp    800a0d <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800a27:	83 f9 01             	cmp    $0x1,%ecx
+  800a2a:	7f 25                	jg     800a51 <vprintfmt+0x471>
+	else if (lflag)
+  800a2c:	85 c9                	test   %ecx,%ecx
+  800a2e:	74 5b                	je     800a8b <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800a30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a33:	83 f8 2f             	cmp    $0x2f,%eax
+  800a36:	77 45                	ja     800a7d <vprintfmt+0x49d>
+  800a38:	89 c2                	mov    %eax,%edx
+  800a3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3e:	83 c0 08             	add    $0x8,%eax
+  800a41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a44:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800a47:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800a4c:	e9 97 00 00 00       	jmp    800ae8 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800a51:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a54:	83 f8 2f             	cmp    $0x2f,%eax
+  800a57:	77 16                	ja     800a6f <vprintfmt+0x48f>
+  800a59:	89 c2                	mov    %eax,%edx
+  800a5b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5f:	83 c0 08             	add    $0x8,%eax
+  800a62:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a65:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800a68:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800a6d:	eb 79                	jmp    800ae8 <vprintfmt+0x508>
+  800a6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7b:	eb e8                	jmp    800a65 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800a7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a81:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a89:	eb b9                	jmp    800a44 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800a8b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a91:	77 15                	ja     800aa8 <vprintfmt+0x4c8>
+  800a93:	89 c2                	mov    %eax,%edx
+  800a95:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a99:	83 c0 08             	add    $0x8,%eax
+  800a9c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a9f:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800aa1:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800aa6:	eb 40                	jmp    800ae8 <vprintfmt+0x508>
+  800aa8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab4:	eb e9                	jmp    800a9f <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800ab6:	4c 89 ee             	mov    %r13,%rsi
+  800ab9:	bf 30 00 00 00       	mov    $0x30,%edi
+  800abe:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800ac1:	4c 89 ee             	mov    %r13,%rsi
+  800ac4:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ac9:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800acc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acf:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad2:	77 34                	ja     800b08 <vprintfmt+0x528>
+  800ad4:	89 c2                	mov    %eax,%edx
+  800ad6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ada:	83 c0 08             	add    $0x8,%eax
+  800add:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800ae0:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800ae3:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800ae8:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800aed:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800af1:	4c 89 ee             	mov    %r13,%rsi
+  800af4:	4c 89 f7             	mov    %r14,%rdi
+  800af7:	48 b8 ba 04 80 00 00 	movabs $0x8004ba,%rax
+  800afe:	00 00 00 
+  800b01:	ff d0                	call   *%rax
+			break;
+  800b03:	e9 0d fb ff ff       	jmp    800615 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800b08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b14:	eb ca                	jmp    800ae0 <vprintfmt+0x500>
+	if (lflag >= 2)
+  800b16:	83 f9 01             	cmp    $0x1,%ecx
+  800b19:	7f 22                	jg     800b3d <vprintfmt+0x55d>
+	else if (lflag)
+  800b1b:	85 c9                	test   %ecx,%ecx
+  800b1d:	74 58                	je     800b77 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800b1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b22:	83 f8 2f             	cmp    $0x2f,%eax
+  800b25:	77 42                	ja     800b69 <vprintfmt+0x589>
+  800b27:	89 c2                	mov    %eax,%edx
+  800b29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b2d:	83 c0 08             	add    $0x8,%eax
+  800b30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b33:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800b36:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800b3b:	eb ab                	jmp    800ae8 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800b3d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b40:	83 f8 2f             	cmp    $0x2f,%eax
+  800b43:	77 16                	ja     800b5b <vprintfmt+0x57b>
+  800b45:	89 c2                	mov    %eax,%edx
+  800b47:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b4b:	83 c0 08             	add    $0x8,%eax
+  800b4e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b51:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800b54:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800b59:	eb 8d                	jmp    800ae8 <vprintfmt+0x508>
+  800b5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b67:	eb e8                	jmp    800b51 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800b69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b75:	eb bc                	jmp    800b33 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800b77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b7a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b7d:	77 18                	ja     800b97 <vprintfmt+0x5b7>
+  800b7f:	89 c2                	mov    %eax,%edx
+  800b81:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b85:	83 c0 08             	add    $0x8,%eax
+  800b88:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b8b:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800b8d:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800b92:	e9 51 ff ff ff       	jmp    800ae8 <vprintfmt+0x508>
+  800b97:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b9b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba3:	eb e6                	jmp    800b8b <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800ba5:	4c 89 ee             	mov    %r13,%rsi
+  800ba8:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bad:	41 ff d6             	call   *%r14
+			break;
+  800bb0:	e9 60 fa ff ff       	jmp    800615 <vprintfmt+0x35>
+			putch('%', putdat);
+  800bb5:	4c 89 ee             	mov    %r13,%rsi
+  800bb8:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bbd:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800bc0:	4c 89 e3             	mov    %r12,%rbx
+  800bc3:	eb 04                	jmp    800bc9 <vprintfmt+0x5e9>
+  800bc5:	48 83 eb 01          	sub    $0x1,%rbx
+  800bc9:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bcd:	75 f6                	jne    800bc5 <vprintfmt+0x5e5>
+  800bcf:	e9 41 fa ff ff       	jmp    800615 <vprintfmt+0x35>
+
+0000000000800bd4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800bd4:	55                   	push   %rbp
+  800bd5:	48 89 e5             	mov    %rsp,%rbp
+  800bd8:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800bdc:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800be0:	48 63 c6             	movslq %esi,%rax
+  800be3:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800be8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800bec:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800bf3:	48 85 ff             	test   %rdi,%rdi
+  800bf6:	74 2a                	je     800c22 <vsnprintf+0x4e>
+  800bf8:	85 f6                	test   %esi,%esi
+  800bfa:	7e 26                	jle    800c22 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800bfc:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800c00:	48 bf 42 05 80 00 00 	movabs $0x800542,%rdi
+  800c07:	00 00 00 
+  800c0a:	48 b8 e0 05 80 00 00 	movabs $0x8005e0,%rax
+  800c11:	00 00 00 
+  800c14:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800c16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c1a:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800c1d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800c20:	c9                   	leave
+  800c21:	c3                   	ret
+		return -E_INVAL;
+  800c22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c27:	eb f7                	jmp    800c20 <vsnprintf+0x4c>
+
+0000000000800c29 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800c29:	55                   	push   %rbp
+  800c2a:	48 89 e5             	mov    %rsp,%rbp
+  800c2d:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800c34:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800c3b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800c42:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800c49:	84 c0                	test   %al,%al
+  800c4b:	74 20                	je     800c6d <snprintf+0x44>
+  800c4d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800c51:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800c55:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800c59:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800c5d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800c61:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800c65:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800c69:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800c6d:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800c74:	00 00 00 
+  800c77:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800c7e:	00 00 00 
+  800c81:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c85:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800c8c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800c93:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800c9a:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800ca1:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  800ca8:	00 00 00 
+  800cab:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800cad:	c9                   	leave
+  800cae:	c3                   	ret
+
+0000000000800caf <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800caf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb4:	48 89 d0             	mov    %rdx,%rax
+  800cb7:	48 83 c2 01          	add    $0x1,%rdx
+  800cbb:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800cc0:	75 f2                	jne    800cb4 <strlen+0x5>
+		n++;
+	return n;
+}
+  800cc2:	c3                   	ret
+
+0000000000800cc3 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc8:	eb 03                	jmp    800ccd <strnlen+0xa>
+  800cca:	48 89 d0             	mov    %rdx,%rax
+  800ccd:	48 39 c6             	cmp    %rax,%rsi
+  800cd0:	74 0a                	je     800cdc <strnlen+0x19>
+  800cd2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800cd6:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800cda:	75 ee                	jne    800cca <strnlen+0x7>
+		n++;
+	return n;
+}
+  800cdc:	c3                   	ret
+
+0000000000800cdd <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800cdd:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800ce0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ce9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cec:	48 83 c2 01          	add    $0x1,%rdx
+  800cf0:	84 c9                	test   %cl,%cl
+  800cf2:	75 f1                	jne    800ce5 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800cf4:	c3                   	ret
+
+0000000000800cf5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800cf5:	55                   	push   %rbp
+  800cf6:	48 89 e5             	mov    %rsp,%rbp
+  800cf9:	41 54                	push   %r12
+  800cfb:	53                   	push   %rbx
+  800cfc:	48 89 fb             	mov    %rdi,%rbx
+  800cff:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800d02:	48 b8 af 0c 80 00 00 	movabs $0x800caf,%rax
+  800d09:	00 00 00 
+  800d0c:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800d0e:	48 63 f8             	movslq %eax,%rdi
+  800d11:	48 01 df             	add    %rbx,%rdi
+  800d14:	4c 89 e6             	mov    %r12,%rsi
+  800d17:	48 b8 dd 0c 80 00 00 	movabs $0x800cdd,%rax
+  800d1e:	00 00 00 
+  800d21:	ff d0                	call   *%rax
+	return dst;
+}
+  800d23:	48 89 d8             	mov    %rbx,%rax
+  800d26:	5b                   	pop    %rbx
+  800d27:	41 5c                	pop    %r12
+  800d29:	5d                   	pop    %rbp
+  800d2a:	c3                   	ret
+
+0000000000800d2b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d2b:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800d2e:	48 01 fa             	add    %rdi,%rdx
+  800d31:	48 89 f9             	mov    %rdi,%rcx
+  800d34:	eb 14                	jmp    800d4a <strncpy+0x1f>
+		*dst++ = *src;
+  800d36:	48 83 c1 01          	add    $0x1,%rcx
+  800d3a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d3e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800d42:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d46:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800d4a:	48 39 d1             	cmp    %rdx,%rcx
+  800d4d:	75 e7                	jne    800d36 <strncpy+0xb>
+	}
+	return ret;
+}
+  800d4f:	c3                   	ret
+
+0000000000800d50 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800d50:	48 89 f8             	mov    %rdi,%rax
+  800d53:	48 85 d2             	test   %rdx,%rdx
+  800d56:	74 27                	je     800d7f <strlcpy+0x2f>
+  800d58:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800d5d:	48 89 fa             	mov    %rdi,%rdx
+  800d60:	eb 0b                	jmp    800d6d <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800d62:	48 83 c6 01          	add    $0x1,%rsi
+  800d66:	48 83 c2 01          	add    $0x1,%rdx
+  800d6a:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800d6d:	48 39 c2             	cmp    %rax,%rdx
+  800d70:	74 0a                	je     800d7c <strlcpy+0x2c>
+  800d72:	0f b6 0e             	movzbl (%rsi),%ecx
+  800d75:	84 c9                	test   %cl,%cl
+  800d77:	75 e9                	jne    800d62 <strlcpy+0x12>
+  800d79:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800d7c:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800d7f:	48 29 f8             	sub    %rdi,%rax
+}
+  800d82:	c3                   	ret
+
+0000000000800d83 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800d83:	eb 08                	jmp    800d8d <strcmp+0xa>
+		p++, q++;
+  800d85:	48 83 c7 01          	add    $0x1,%rdi
+  800d89:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800d8d:	0f b6 07             	movzbl (%rdi),%eax
+  800d90:	84 c0                	test   %al,%al
+  800d92:	74 04                	je     800d98 <strcmp+0x15>
+  800d94:	3a 06                	cmp    (%rsi),%al
+  800d96:	74 ed                	je     800d85 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d98:	0f b6 c0             	movzbl %al,%eax
+  800d9b:	0f b6 16             	movzbl (%rsi),%edx
+  800d9e:	29 d0                	sub    %edx,%eax
+}
+  800da0:	c3                   	ret
+
+0000000000800da1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800da1:	eb 0c                	jmp    800daf <strncmp+0xe>
+		n--, p++, q++;
+  800da3:	48 83 ea 01          	sub    $0x1,%rdx
+  800da7:	48 83 c7 01          	add    $0x1,%rdi
+  800dab:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800daf:	48 85 d2             	test   %rdx,%rdx
+  800db2:	74 14                	je     800dc8 <strncmp+0x27>
+  800db4:	0f b6 07             	movzbl (%rdi),%eax
+  800db7:	84 c0                	test   %al,%al
+  800db9:	74 04                	je     800dbf <strncmp+0x1e>
+  800dbb:	3a 06                	cmp    (%rsi),%al
+  800dbd:	74 e4                	je     800da3 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800dbf:	0f b6 07             	movzbl (%rdi),%eax
+  800dc2:	0f b6 16             	movzbl (%rsi),%edx
+  800dc5:	29 d0                	sub    %edx,%eax
+}
+  800dc7:	c3                   	ret
+		return 0;
+  800dc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dcd:	c3                   	ret
+
+0000000000800dce <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800dce:	eb 04                	jmp    800dd4 <strchr+0x6>
+  800dd0:	48 83 c7 01          	add    $0x1,%rdi
+  800dd4:	0f b6 07             	movzbl (%rdi),%eax
+  800dd7:	84 c0                	test   %al,%al
+  800dd9:	74 09                	je     800de4 <strchr+0x16>
+		if (*s == c)
+  800ddb:	40 38 f0             	cmp    %sil,%al
+  800dde:	75 f0                	jne    800dd0 <strchr+0x2>
+  800de0:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800de3:	c3                   	ret
+	return 0;
+  800de4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de9:	c3                   	ret
+
+0000000000800dea <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800dea:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800ded:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800df0:	40 38 f2             	cmp    %sil,%dl
+  800df3:	74 0a                	je     800dff <strfind+0x15>
+  800df5:	84 d2                	test   %dl,%dl
+  800df7:	74 06                	je     800dff <strfind+0x15>
+	for (; *s; s++)
+  800df9:	48 83 c0 01          	add    $0x1,%rax
+  800dfd:	eb ee                	jmp    800ded <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800dff:	c3                   	ret
+
+0000000000800e00 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800e00:	48 85 d2             	test   %rdx,%rdx
+  800e03:	74 28                	je     800e2d <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800e05:	48 89 f8             	mov    %rdi,%rax
+  800e08:	48 09 d0             	or     %rdx,%rax
+  800e0b:	a8 03                	test   $0x3,%al
+  800e0d:	75 16                	jne    800e25 <memset+0x25>
+		c &= 0xFF;
+  800e0f:	40 0f b6 f6          	movzbl %sil,%esi
+  800e13:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800e19:	48 89 d1             	mov    %rdx,%rcx
+  800e1c:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800e20:	fc                   	cld
+  800e21:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800e23:	eb 08                	jmp    800e2d <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800e25:	89 f0                	mov    %esi,%eax
+  800e27:	48 89 d1             	mov    %rdx,%rcx
+  800e2a:	fc                   	cld
+  800e2b:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800e2d:	48 89 f8             	mov    %rdi,%rax
+  800e30:	c3                   	ret
+
+0000000000800e31 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800e31:	48 89 f8             	mov    %rdi,%rax
+  800e34:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800e37:	48 39 fe             	cmp    %rdi,%rsi
+  800e3a:	73 3a                	jae    800e76 <memmove+0x45>
+  800e3c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e40:	48 39 d7             	cmp    %rdx,%rdi
+  800e43:	73 31                	jae    800e76 <memmove+0x45>
+		s += n;
+		d += n;
+  800e45:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800e49:	48 89 d6             	mov    %rdx,%rsi
+  800e4c:	48 09 fe             	or     %rdi,%rsi
+  800e4f:	48 09 ce             	or     %rcx,%rsi
+  800e52:	40 f6 c6 03          	test   $0x3,%sil
+  800e56:	75 11                	jne    800e69 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800e58:	48 83 ef 04          	sub    $0x4,%rdi
+  800e5c:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800e60:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800e64:	fd                   	std
+  800e65:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800e67:	eb 0b                	jmp    800e74 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800e69:	48 83 ef 01          	sub    $0x1,%rdi
+  800e6d:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800e71:	fd                   	std
+  800e72:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800e74:	fc                   	cld
+  800e75:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800e76:	48 89 f2             	mov    %rsi,%rdx
+  800e79:	48 09 c2             	or     %rax,%rdx
+  800e7c:	48 09 ca             	or     %rcx,%rdx
+  800e7f:	f6 c2 03             	test   $0x3,%dl
+  800e82:	75 0b                	jne    800e8f <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800e84:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800e88:	48 89 c7             	mov    %rax,%rdi
+  800e8b:	fc                   	cld
+  800e8c:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800e8e:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800e8f:	48 89 c7             	mov    %rax,%rdi
+  800e92:	fc                   	cld
+  800e93:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800e95:	c3                   	ret
+
+0000000000800e96 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800e96:	55                   	push   %rbp
+  800e97:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800e9a:	48 b8 31 0e 80 00 00 	movabs $0x800e31,%rax
+  800ea1:	00 00 00 
+  800ea4:	ff d0                	call   *%rax
+}
+  800ea6:	5d                   	pop    %rbp
+  800ea7:	c3                   	ret
+
+0000000000800ea8 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ead:	48 39 c2             	cmp    %rax,%rdx
+  800eb0:	74 1e                	je     800ed0 <memcmp+0x28>
+		if (*s1 != *s2)
+  800eb2:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800eb6:	48 83 c0 01          	add    $0x1,%rax
+  800eba:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800ec0:	44 38 c1             	cmp    %r8b,%cl
+  800ec3:	74 e8                	je     800ead <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800ec5:	0f b6 c1             	movzbl %cl,%eax
+  800ec8:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ecc:	44 29 c0             	sub    %r8d,%eax
+  800ecf:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ed5:	c3                   	ret
+
+0000000000800ed6 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ed6:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800ed9:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800edc:	eb 04                	jmp    800ee2 <memfind+0xc>
+  800ede:	48 83 c0 01          	add    $0x1,%rax
+  800ee2:	48 39 d0             	cmp    %rdx,%rax
+  800ee5:	73 05                	jae    800eec <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ee7:	40 38 30             	cmp    %sil,(%rax)
+  800eea:	75 f2                	jne    800ede <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800eec:	c3                   	ret
+
+0000000000800eed <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800eed:	48 89 f9             	mov    %rdi,%rcx
+  800ef0:	49 89 f0             	mov    %rsi,%r8
+  800ef3:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ef5:	eb 04                	jmp    800efb <strtol+0xe>
+		s++;
+  800ef7:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800efb:	0f b6 01             	movzbl (%rcx),%eax
+  800efe:	3c 20                	cmp    $0x20,%al
+  800f00:	74 f5                	je     800ef7 <strtol+0xa>
+  800f02:	3c 09                	cmp    $0x9,%al
+  800f04:	74 f1                	je     800ef7 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800f06:	3c 2b                	cmp    $0x2b,%al
+  800f08:	74 2b                	je     800f35 <strtol+0x48>
+	int neg = 0;
+  800f0a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800f10:	3c 2d                	cmp    $0x2d,%al
+  800f12:	74 2d                	je     800f41 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f14:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800f1a:	75 0f                	jne    800f2b <strtol+0x3e>
+  800f1c:	80 39 30             	cmpb   $0x30,(%rcx)
+  800f1f:	74 2c                	je     800f4d <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800f21:	85 ff                	test   %edi,%edi
+  800f23:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f28:	0f 44 f8             	cmove  %eax,%edi
+  800f2b:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800f30:	4c 63 d7             	movslq %edi,%r10
+  800f33:	eb 4f                	jmp    800f84 <strtol+0x97>
+		s++;
+  800f35:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800f39:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800f3f:	eb d3                	jmp    800f14 <strtol+0x27>
+		s++, neg = 1;
+  800f41:	48 83 c1 01          	add    $0x1,%rcx
+  800f45:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800f4b:	eb c7                	jmp    800f14 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f4d:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800f51:	74 0f                	je     800f62 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800f53:	85 ff                	test   %edi,%edi
+  800f55:	75 d4                	jne    800f2b <strtol+0x3e>
+		s++, base = 8;
+  800f57:	48 83 c1 01          	add    $0x1,%rcx
+  800f5b:	bf 08 00 00 00       	mov    $0x8,%edi
+  800f60:	eb c9                	jmp    800f2b <strtol+0x3e>
+		s += 2, base = 16;
+  800f62:	48 83 c1 02          	add    $0x2,%rcx
+  800f66:	bf 10 00 00 00       	mov    $0x10,%edi
+  800f6b:	eb be                	jmp    800f2b <strtol+0x3e>
+			dig = *s - '0';
+  800f6d:	0f be c0             	movsbl %al,%eax
+  800f70:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800f73:	39 f8                	cmp    %edi,%eax
+  800f75:	7d 3b                	jge    800fb2 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800f77:	48 83 c1 01          	add    $0x1,%rcx
+  800f7b:	49 0f af d2          	imul   %r10,%rdx
+  800f7f:	48 98                	cltq
+  800f81:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800f84:	0f b6 01             	movzbl (%rcx),%eax
+  800f87:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800f8a:	40 80 fe 09          	cmp    $0x9,%sil
+  800f8e:	76 dd                	jbe    800f6d <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800f90:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800f93:	40 80 fe 19          	cmp    $0x19,%sil
+  800f97:	77 08                	ja     800fa1 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800f99:	0f be c0             	movsbl %al,%eax
+  800f9c:	83 e8 57             	sub    $0x57,%eax
+  800f9f:	eb d2                	jmp    800f73 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800fa1:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800fa4:	40 80 fe 19          	cmp    $0x19,%sil
+  800fa8:	77 08                	ja     800fb2 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800faa:	0f be c0             	movsbl %al,%eax
+  800fad:	83 e8 37             	sub    $0x37,%eax
+  800fb0:	eb c1                	jmp    800f73 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800fb2:	4d 85 c0             	test   %r8,%r8
+  800fb5:	74 03                	je     800fba <strtol+0xcd>
+		*endptr = (char *) s;
+  800fb7:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800fba:	48 89 d0             	mov    %rdx,%rax
+  800fbd:	48 f7 d8             	neg    %rax
+  800fc0:	45 85 c9             	test   %r9d,%r9d
+  800fc3:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800fc7:	48 89 d0             	mov    %rdx,%rax
+  800fca:	c3                   	ret
+
+0000000000800fcb <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800fcb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fd1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800fd7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe1:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800fe3:	c3                   	ret
+
+0000000000800fe4 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800fe4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800ff0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ff5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ffa:	48 89 fe             	mov    %rdi,%rsi
+  800ffd:	48 89 fa             	mov    %rdi,%rdx
+  801000:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801002:	c3                   	ret
+
+0000000000801003 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801003:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801006:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80100c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801012:	be 00 00 00 00       	mov    $0x0,%esi
+  801017:	b8 03 00 00 00       	mov    $0x3,%eax
+  80101c:	48 89 f2             	mov    %rsi,%rdx
+  80101f:	0f 05                	syscall
+	if(check && ret > 0)
+  801021:	48 85 c0             	test   %rax,%rax
+  801024:	7f 01                	jg     801027 <sys_env_destroy+0x24>
+}
+  801026:	c3                   	ret
+{
+  801027:	55                   	push   %rbp
+  801028:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80102b:	49 89 c0             	mov    %rax,%r8
+  80102e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801033:	48 ba c8 23 80 00 00 	movabs $0x8023c8,%rdx
+  80103a:	00 00 00 
+  80103d:	be 28 00 00 00       	mov    $0x28,%esi
+  801042:	48 bf e5 23 80 00 00 	movabs $0x8023e5,%rdi
+  801049:	00 00 00 
+  80104c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801051:	49 b9 87 02 80 00 00 	movabs $0x800287,%r9
+  801058:	00 00 00 
+  80105b:	41 ff d1             	call   *%r9
+
+000000000080105e <sys_getenvid>:
+	asm volatile("movl %%gs:%c1, %0"
+  80105e:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  801065:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  801066:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80106b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80106f:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801073:	48 c1 e2 04          	shl    $0x4,%rdx
+  801077:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  80107e:	00 00 00 
+  801081:	48 01 d0             	add    %rdx,%rax
+  801084:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  80108a:	c3                   	ret
+
+000000000080108b <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  80108b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801091:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801097:	bf 00 00 00 00       	mov    $0x0,%edi
+  80109c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010a1:	48 89 fe             	mov    %rdi,%rsi
+  8010a4:	48 89 fa             	mov    %rdi,%rdx
+  8010a7:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8010a9:	c3                   	ret
+
+00000000008010aa <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8010aa:	48 63 d2             	movslq %edx,%rdx
+  8010ad:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8010b0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010bc:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010c1:	0f 05                	syscall
+	if(check && ret > 0)
+  8010c3:	48 85 c0             	test   %rax,%rax
+  8010c6:	7f 01                	jg     8010c9 <sys_page_alloc+0x1f>
+}
+  8010c8:	c3                   	ret
+{
+  8010c9:	55                   	push   %rbp
+  8010ca:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010cd:	49 89 c0             	mov    %rax,%r8
+  8010d0:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8010d5:	48 ba c8 23 80 00 00 	movabs $0x8023c8,%rdx
+  8010dc:	00 00 00 
+  8010df:	be 28 00 00 00       	mov    $0x28,%esi
+  8010e4:	48 bf e5 23 80 00 00 	movabs $0x8023e5,%rdi
+  8010eb:	00 00 00 
+  8010ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f3:	49 b9 87 02 80 00 00 	movabs $0x800287,%r9
+  8010fa:	00 00 00 
+  8010fd:	41 ff d1             	call   *%r9
+
+0000000000801100 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  801100:	48 63 d2             	movslq %edx,%rdx
+  801103:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801106:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80110c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801112:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801117:	0f 05                	syscall
+	if(check && ret > 0)
+  801119:	48 85 c0             	test   %rax,%rax
+  80111c:	7f 01                	jg     80111f <sys_page_alloc_huge+0x1f>
+}
+  80111e:	c3                   	ret
+{
+  80111f:	55                   	push   %rbp
+  801120:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801123:	49 89 c0             	mov    %rax,%r8
+  801126:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80112b:	48 ba c8 23 80 00 00 	movabs $0x8023c8,%rdx
+  801132:	00 00 00 
+  801135:	be 28 00 00 00       	mov    $0x28,%esi
+  80113a:	48 bf e5 23 80 00 00 	movabs $0x8023e5,%rdi
+  801141:	00 00 00 
+  801144:	b8 00 00 00 00       	mov    $0x0,%eax
+  801149:	49 b9 87 02 80 00 00 	movabs $0x800287,%r9
+  801150:	00 00 00 
+  801153:	41 ff d1             	call   *%r9
+
+0000000000801156 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801156:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  801159:	48 63 d2             	movslq %edx,%rdx
+  80115c:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  80115f:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  801162:	b8 05 00 00 00       	mov    $0x5,%eax
+  801167:	0f 05                	syscall
+	if(check && ret > 0)
+  801169:	48 85 c0             	test   %rax,%rax
+  80116c:	7f 01                	jg     80116f <sys_page_map+0x19>
+}
+  80116e:	c3                   	ret
+{
+  80116f:	55                   	push   %rbp
+  801170:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801173:	49 89 c0             	mov    %rax,%r8
+  801176:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80117b:	48 ba c8 23 80 00 00 	movabs $0x8023c8,%rdx
+  801182:	00 00 00 
+  801185:	be 28 00 00 00       	mov    $0x28,%esi
+  80118a:	48 bf e5 23 80 00 00 	movabs $0x8023e5,%rdi
+  801191:	00 00 00 
+  801194:	b8 00 00 00 00       	mov    $0x0,%eax
+  801199:	49 b9 87 02 80 00 00 	movabs $0x800287,%r9
+  8011a0:	00 00 00 
+  8011a3:	41 ff d1             	call   *%r9
+
+00000000008011a6 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8011a6:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8011a9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ba:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011bf:	0f 05                	syscall
+	if(check && ret > 0)
+  8011c1:	48 85 c0             	test   %rax,%rax
+  8011c4:	7f 01                	jg     8011c7 <sys_page_unmap+0x21>
+}
+  8011c6:	c3                   	ret
+{
+  8011c7:	55                   	push   %rbp
+  8011c8:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011cb:	49 89 c0             	mov    %rax,%r8
+  8011ce:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011d3:	48 ba c8 23 80 00 00 	movabs $0x8023c8,%rdx
+  8011da:	00 00 00 
+  8011dd:	be 28 00 00 00       	mov    $0x28,%esi
+  8011e2:	48 bf e5 23 80 00 00 	movabs $0x8023e5,%rdi
+  8011e9:	00 00 00 
+  8011ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f1:	49 b9 87 02 80 00 00 	movabs $0x800287,%r9
+  8011f8:	00 00 00 
+  8011fb:	41 ff d1             	call   *%r9
+
+00000000008011fe <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  8011fe:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801204:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80120a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80120f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801214:	48 89 fe             	mov    %rdi,%rsi
+  801217:	48 89 fa             	mov    %rdi,%rdx
+  80121a:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80121c:	c3                   	ret
+
+000000000080121d <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  80121d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801223:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801229:	ba 00 00 00 00       	mov    $0x0,%edx
+  80122e:	b8 10 00 00 00       	mov    $0x10,%eax
+  801233:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  801235:	c3                   	ret
+
+0000000000801236 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  801236:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80123c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801242:	b8 11 00 00 00       	mov    $0x11,%eax
+  801247:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  801249:	c3                   	ret
+
+000000000080124a <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  80124a:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  80124d:	48 63 f6             	movslq %esi,%rsi
+  801250:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  801253:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801259:	b8 12 00 00 00       	mov    $0x12,%eax
+  80125e:	0f 05                	syscall
+	if(check && ret > 0)
+  801260:	48 85 c0             	test   %rax,%rax
+  801263:	7f 01                	jg     801266 <sys_page_batch+0x1c>
+}
+  801265:	c3                   	ret
+{
+  801266:	55                   	push   %rbp
+  801267:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80126a:	49 89 c0             	mov    %rax,%r8
+  80126d:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801272:	48 ba c8 23 80 00 00 	movabs $0x8023c8,%rdx
+  801279:	00 00 00 
+  80127c:	be 28 00 00 00       	mov    $0x28,%esi
+  801281:	48 bf e5 23 80 00 00 	movabs $0x8023e5,%rdi
+  801288:	00 00 00 
+  80128b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801290:	49 b9 87 02 80 00 00 	movabs $0x800287,%r9
+  801297:	00 00 00 
+  80129a:	41 ff d1             	call   *%r9
+
+000000000080129d <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  80129d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8012a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8012a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ae:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012b3:	48 89 f2             	mov    %rsi,%rdx
+  8012b6:	0f 05                	syscall
+	if(check && ret > 0)
+  8012b8:	48 85 c0             	test   %rax,%rax
+  8012bb:	7f 01                	jg     8012be <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  8012bd:	c3                   	ret
+{
+  8012be:	55                   	push   %rbp
+  8012bf:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012c2:	49 89 c0             	mov    %rax,%r8
+  8012c5:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8012ca:	48 ba c8 23 80 00 00 	movabs $0x8023c8,%rdx
+  8012d1:	00 00 00 
+  8012d4:	be 28 00 00 00       	mov    $0x28,%esi
+  8012d9:	48 bf e5 23 80 00 00 	movabs $0x8023e5,%rdi
+  8012e0:	00 00 00 
+  8012e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e8:	49 b9 87 02 80 00 00 	movabs $0x800287,%r9
+  8012ef:	00 00 00 
+  8012f2:	41 ff d1             	call   *%r9
+
+00000000008012f5 <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  8012f5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8012fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801301:	bf 00 00 00 00       	mov    $0x0,%edi
+  801306:	b8 14 00 00 00       	mov    $0x14,%eax
+  80130b:	48 89 fe             	mov    %rdi,%rsi
+  80130e:	48 89 fa             	mov    %rdi,%rdx
+  801311:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801313:	c3                   	ret
+
+0000000000801314 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  801314:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801317:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80131d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801323:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801328:	0f 05                	syscall
+	if(check && ret > 0)
+  80132a:	48 85 c0             	test   %rax,%rax
+  80132d:	7f 01                	jg     801330 <sys_page_unmap_range+0x1c>
+}
+  80132f:	c3                   	ret
+{
+  801330:	55                   	push   %rbp
+  801331:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801334:	49 89 c0             	mov    %rax,%r8
+  801337:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80133c:	48 ba c8 23 80 00 00 	movabs $0x8023c8,%rdx
+  801343:	00 00 00 
+  801346:	be 28 00 00 00       	mov    $0x28,%esi
+  80134b:	48 bf e5 23 80 00 00 	movabs $0x8023e5,%rdi
+  801352:	00 00 00 
+  801355:	b8 00 00 00 00       	mov    $0x0,%eax
+  80135a:	49 b9 87 02 80 00 00 	movabs $0x800287,%r9
+  801361:	00 00 00 
+  801364:	41 ff d1             	call   *%r9
+
+0000000000801367 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801367:	48 63 f6             	movslq %esi,%rsi
+  80136a:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80136d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801373:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801379:	ba 00 00 00 00       	mov    $0x0,%edx
+  80137e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801383:	0f 05                	syscall
+	if(check && ret > 0)
+  801385:	48 85 c0             	test   %rax,%rax
+  801388:	7f 01                	jg     80138b <sys_env_set_status+0x24>
+}
+  80138a:	c3                   	ret
+{
+  80138b:	55                   	push   %rbp
+  80138c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80138f:	49 89 c0             	mov    %rax,%r8
+  801392:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801397:	48 ba c8 23 80 00 00 	movabs $0x8023c8,%rdx
+  80139e:	00 00 00 
+  8013a1:	be 28 00 00 00       	mov    $0x28,%esi
+  8013a6:	48 bf e5 23 80 00 00 	movabs $0x8023e5,%rdi
+  8013ad:	00 00 00 
+  8013b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b5:	49 b9 87 02 80 00 00 	movabs $0x800287,%r9
+  8013bc:	00 00 00 
+  8013bf:	41 ff d1             	call   *%r9
+
+00000000008013c2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8013c2:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8013c5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8013cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8013d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8013db:	0f 05                	syscall
+	if(check && ret > 0)
+  8013dd:	48 85 c0             	test   %rax,%rax
+  8013e0:	7f 01                	jg     8013e3 <sys_env_set_pgfault_upcall+0x21>
+}
+  8013e2:	c3                   	ret
+{
+  8013e3:	55                   	push   %rbp
+  8013e4:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013e7:	49 89 c0             	mov    %rax,%r8
+  8013ea:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8013ef:	48 ba c8 23 80 00 00 	movabs $0x8023c8,%rdx
+  8013f6:	00 00 00 
+  8013f9:	be 28 00 00 00       	mov    $0x28,%esi
+  8013fe:	48 bf e5 23 80 00 00 	movabs $0x8023e5,%rdi
+  801405:	00 00 00 
+  801408:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140d:	49 b9 87 02 80 00 00 	movabs $0x800287,%r9
+  801414:	00 00 00 
+  801417:	41 ff d1             	call   *%r9
+
+000000000080141a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80141a:	48 63 ff             	movslq %edi,%rdi
+  80141d:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  801420:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801426:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80142b:	0f 05                	syscall
+}
+  80142d:	c3                   	ret
+
+000000000080142e <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  80142e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801434:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80143a:	be 00 00 00 00       	mov    $0x0,%esi
+  80143f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801444:	48 89 f2             	mov    %rsi,%rdx
+  801447:	0f 05                	syscall
+	if(check && ret > 0)
+  801449:	48 85 c0             	test   %rax,%rax
+  80144c:	7f 01                	jg     80144f <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  80144e:	c3                   	ret
+{
+  80144f:	55                   	push   %rbp
+  801450:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801453:	49 89 c0             	mov    %rax,%r8
+  801456:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80145b:	48 ba c8 23 80 00 00 	movabs $0x8023c8,%rdx
+  801462:	00 00 00 
+  801465:	be 28 00 00 00       	mov    $0x28,%esi
+  80146a:	48 bf e5 23 80 00 00 	movabs $0x8023e5,%rdi
+  801471:	00 00 00 
+  801474:	b8 00 00 00 00       	mov    $0x0,%eax
+  801479:	49 b9 87 02 80 00 00 	movabs $0x800287,%r9
+  801480:	00 00 00 
+  801483:	41 ff d1             	call   *%r9
+
+0000000000801486 <pgfault>:
+- unmap PFTEMP using sys_page_unmap()
+- panic if any step fails
+*/
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801486:	55                   	push   %rbp
+  801487:	48 89 e5             	mov    %rsp,%rbp
+  80148a:	53                   	push   %rbx
+  80148b:	48 83 ec 08          	sub    $0x8,%rsp
+	void *addr = (void *) utf->utf_fault_va;
+  80148f:	48 8b 1f             	mov    (%rdi),%rbx
+	uint32_t err = utf->utf_err;
+  801492:	48 8b 47 08          	mov    0x8(%rdi),%rax
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+
+	if (!(err & FEC_WR)) {
+  801496:	a8 02                	test   $0x2,%al
+  801498:	0f 84 b1 00 00 00    	je     80154f <pgfault+0xc9>
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+	}
+	pte_t pte = uvpt[PGNUM(addr)];
+  80149e:	48 89 da             	mov    %rbx,%rdx
+  8014a1:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8014a5:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8014ac:	01 00 00 
+  8014af:	48 8b 0c d0          	mov    (%rax,%rdx,8),%rcx
+	if (!(pte & PTE_COW)) {
+  8014b3:	f6 c5 08             	test   $0x8,%ch
+  8014b6:	0f 84 c3 00 00 00    	je     80157f <pgfault+0xf9>
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+
+	void *pg_addr = ROUNDDOWN(addr, PGSIZE);
+  8014bc:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  8014c3:	ba 07 00 00 00       	mov    $0x7,%edx
+  8014c8:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8014cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014d2:	48 b8 aa 10 80 00 00 	movabs $0x8010aa,%rax
+  8014d9:	00 00 00 
+  8014dc:	ff d0                	call   *%rax
+	if (r < 0) {
+  8014de:	85 c0                	test   %eax,%eax
+  8014e0:	0f 88 c7 00 00 00    	js     8015ad <pgfault+0x127>
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+	}
+	memmove(PFTEMP, pg_addr, PGSIZE);
+  8014e6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8014eb:	48 89 de             	mov    %rbx,%rsi
+  8014ee:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  8014f3:	48 b8 31 0e 80 00 00 	movabs $0x800e31,%rax
+  8014fa:	00 00 00 
+  8014fd:	ff d0                	call   *%rax
+	r = sys_page_map(0, PFTEMP, 0, pg_addr, PTE_P | PTE_U | PTE_W);
+  8014ff:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  801505:	48 89 d9             	mov    %rbx,%rcx
+  801508:	ba 00 00 00 00       	mov    $0x0,%edx
+  80150d:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  801512:	bf 00 00 00 00       	mov    $0x0,%edi
+  801517:	48 b8 56 11 80 00 00 	movabs $0x801156,%rax
+  80151e:	00 00 00 
+  801521:	ff d0                	call   *%rax
+	if (r < 0) {
+  801523:	85 c0                	test   %eax,%eax
+  801525:	0f 88 af 00 00 00    	js     8015da <pgfault+0x154>
+		panic("pgfault: sys_page_map failed:  %e", r);
+	}
+	r = sys_page_unmap(0, PFTEMP);
+  80152b:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  801530:	bf 00 00 00 00       	mov    $0x0,%edi
+  801535:	48 b8 a6 11 80 00 00 	movabs $0x8011a6,%rax
+  80153c:	00 00 00 
+  80153f:	ff d0                	call   *%rax
+	if (r < 0) {
+  801541:	85 c0                	test   %eax,%eax
+  801543:	0f 88 be 00 00 00    	js     801607 <pgfault+0x181>
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+	}
+}
+  801549:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80154d:	c9                   	leave
+  80154e:	c3                   	ret
+  80154f:	89 c1                	mov    %eax,%ecx
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+  801551:	49 89 d8             	mov    %rbx,%r8
+  801554:	48 ba f8 23 80 00 00 	movabs $0x8023f8,%rdx
+  80155b:	00 00 00 
+  80155e:	be 32 00 00 00       	mov    $0x32,%esi
+  801563:	48 bf a7 25 80 00 00 	movabs $0x8025a7,%rdi
+  80156a:	00 00 00 
+  80156d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801572:	49 b9 87 02 80 00 00 	movabs $0x800287,%r9
+  801579:	00 00 00 
+  80157c:	41 ff d1             	call   *%r9
+		panic("pgfault: page is not marked copy-on-write (pte=%p, va=%p)", pte, addr);
+  80157f:	49 89 d8             	mov    %rbx,%r8
+  801582:	48 ba 20 24 80 00 00 	movabs $0x802420,%rdx
+  801589:	00 00 00 
+  80158c:	be 36 00 00 00       	mov    $0x36,%esi
+  801591:	48 bf a7 25 80 00 00 	movabs $0x8025a7,%rdi
+  801598:	00 00 00 
+  80159b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a0:	49 b9 87 02 80 00 00 	movabs $0x800287,%r9
+  8015a7:	00 00 00 
+  8015aa:	41 ff d1             	call   *%r9
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+  8015ad:	89 c1                	mov    %eax,%ecx
+  8015af:	48 ba 60 24 80 00 00 	movabs $0x802460,%rdx
+  8015b6:	00 00 00 
+  8015b9:	be 44 00 00 00       	mov    $0x44,%esi
+  8015be:	48 bf a7 25 80 00 00 	movabs $0x8025a7,%rdi
+  8015c5:	00 00 00 
+  8015c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015cd:	49 b8 87 02 80 00 00 	movabs $0x800287,%r8
+  8015d4:	00 00 00 
+  8015d7:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_map failed:  %e", r);
+  8015da:	89 c1                	mov    %eax,%ecx
+  8015dc:	48 ba 88 24 80 00 00 	movabs $0x802488,%rdx
+  8015e3:	00 00 00 
+  8015e6:	be 49 00 00 00       	mov    $0x49,%esi
+  8015eb:	48 bf a7 25 80 00 00 	movabs $0x8025a7,%rdi
+  8015f2:	00 00 00 
+  8015f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fa:	49 b8 87 02 80 00 00 	movabs $0x800287,%r8
+  801601:	00 00 00 
+  801604:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+  801607:	89 c1                	mov    %eax,%ecx
+  801609:	48 ba b0 24 80 00 00 	movabs $0x8024b0,%rdx
+  801610:	00 00 00 
+  801613:	be 4d 00 00 00       	mov    $0x4d,%esi
+  801618:	48 bf a7 25 80 00 00 	movabs $0x8025a7,%rdi
+  80161f:	00 00 00 
+  801622:	b8 00 00 00 00       	mov    $0x0,%eax
+  801627:	49 b8 87 02 80 00 00 	movabs $0x800287,%r8
+  80162e:	00 00 00 
+  801631:	41 ff d0             	call   *%r8
+
+0000000000801634 <dupflush>:
+static struct PageOp dup_child[DUP_BATCH], dup_self[DUP_BATCH];
+static int ndup_child, ndup_self;
+
+static int
+dupflush(envid_t envid)
+{
+  801634:	55                   	push   %rbp
+  801635:	48 89 e5             	mov    %rsp,%rbp
+  801638:	89 fe                	mov    %edi,%esi
+	int r;
+
+	// Map to child first, then remap parent
+	r = sys_page_batch(0, envid, dup_child, ndup_child);
+  80163a:	a1 44 30 80 00 00 00 	movabs 0x803044,%eax
+  801641:	00 00 
+  801643:	48 63 c8             	movslq %eax,%rcx
+  801646:	48 ba 60 36 80 00 00 	movabs $0x803660,%rdx
+  80164d:	00 00 00 
+  801650:	bf 00 00 00 00       	mov    $0x0,%edi
+  801655:	48 b8 4a 12 80 00 00 	movabs $0x80124a,%rax
+  80165c:	00 00 00 
+  80165f:	ff d0                	call   *%rax
+	if (r < 0) {
+  801661:	85 c0                	test   %eax,%eax
+  801663:	78 57                	js     8016bc <dupflush+0x88>
+		panic("duppage: child map failed: %e", r);
+		return r;
+	}
+	r = sys_page_batch(0, 0, dup_self, ndup_self);
+  801665:	a1 40 30 80 00 00 00 	movabs 0x803040,%eax
+  80166c:	00 00 
+  80166e:	48 63 c8             	movslq %eax,%rcx
+  801671:	48 ba 60 30 80 00 00 	movabs $0x803060,%rdx
+  801678:	00 00 00 
+  80167b:	be 00 00 00 00       	mov    $0x0,%esi
+  801680:	bf 00 00 00 00       	mov    $0x0,%edi
+  801685:	48 b8 4a 12 80 00 00 	movabs $0x80124a,%rax
+  80168c:	00 00 00 
+  80168f:	ff d0                	call   *%rax
+	if (r < 0) {
+  801691:	85 c0                	test   %eax,%eax
+  801693:	78 54                	js     8016e9 <dupflush+0xb5>
+		panic("duppage: parent remap failed: %e", r);
+		return r;
+	}
+	ndup_child = ndup_self = 0;
+  801695:	48 b8 40 30 80 00 00 	movabs $0x803040,%rax
+  80169c:	00 00 00 
+  80169f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  8016a5:	48 b8 44 30 80 00 00 	movabs $0x803044,%rax
+  8016ac:	00 00 00 
+  8016af:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	return 0;
+}
+  8016b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ba:	5d                   	pop    %rbp
+  8016bb:	c3                   	ret
+		panic("duppage: child map failed: %e", r);
+  8016bc:	89 c1                	mov    %eax,%ecx
+  8016be:	48 ba b2 25 80 00 00 	movabs $0x8025b2,%rdx
+  8016c5:	00 00 00 
+  8016c8:	be 77 00 00 00       	mov    $0x77,%esi
+  8016cd:	48 bf a7 25 80 00 00 	movabs $0x8025a7,%rdi
+  8016d4:	00 00 00 
+  8016d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016dc:	49 b8 87 02 80 00 00 	movabs $0x800287,%r8
+  8016e3:	00 00 00 
+  8016e6:	41 ff d0             	call   *%r8
+		panic("duppage: parent remap failed: %e", r);
+  8016e9:	89 c1                	mov    %eax,%ecx
+  8016eb:	48 ba d8 24 80 00 00 	movabs $0x8024d8,%rdx
+  8016f2:	00 00 00 
+  8016f5:	be 7c 00 00 00       	mov    $0x7c,%esi
+  8016fa:	48 bf a7 25 80 00 00 	movabs $0x8025a7,%rdi
+  801701:	00 00 00 
+  801704:	b8 00 00 00 00       	mov    $0x0,%eax
+  801709:	49 b8 87 02 80 00 00 	movabs $0x800287,%r8
+  801710:	00 00 00 
+  801713:	41 ff d0             	call   *%r8
+
+0000000000801716 <thread_start>:
+	return envid;
+}
+
+static void
+thread_start(void (*fn)(void *), void *arg)
+{
+  801716:	55                   	push   %rbp
+  801717:	48 89 e5             	mov    %rsp,%rbp
+  80171a:	48 89 f8             	mov    %rdi,%rax
+  80171d:	48 89 f7             	mov    %rsi,%rdi
+	fn(arg);
+  801720:	ff d0                	call   *%rax
+	exit();
+  801722:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  801729:	00 00 00 
+  80172c:	ff d0                	call   *%rax
+}
+  80172e:	5d                   	pop    %rbp
+  80172f:	c3                   	ret
+
+0000000000801730 <fork>:
+{
+  801730:	55                   	push   %rbp
+  801731:	48 89 e5             	mov    %rsp,%rbp
+	set_pgfault_handler(pgfault);
+  801734:	48 bf 86 14 80 00 00 	movabs $0x801486,%rdi
+  80173b:	00 00 00 
+  80173e:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  801745:	00 00 00 
+  801748:	ff d0                	call   *%rax
+	return sys_fork();
+  80174a:	48 b8 fe 11 80 00 00 	movabs $0x8011fe,%rax
+  801751:	00 00 00 
+  801754:	ff d0                	call   *%rax
+}
+  801756:	5d                   	pop    %rbp
+  801757:	c3                   	ret
+
+0000000000801758 <ufork>:
+{
+  801758:	55                   	push   %rbp
+  801759:	48 89 e5             	mov    %rsp,%rbp
+  80175c:	41 57                	push   %r15
+  80175e:	41 56                	push   %r14
+  801760:	41 55                	push   %r13
+  801762:	41 54                	push   %r12
+  801764:	53                   	push   %rbx
+  801765:	48 83 ec 38          	sub    $0x38,%rsp
+	set_pgfault_handler(pgfault);
+  801769:	48 bf 86 14 80 00 00 	movabs $0x801486,%rdi
+  801770:	00 00 00 
+  801773:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  80177a:	00 00 00 
+  80177d:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80177f:	b8 07 00 00 00       	mov    $0x7,%eax
+  801784:	cd 30                	int    $0x30
+  801786:	89 45 cc             	mov    %eax,-0x34(%rbp)
+	if (envid < 0) {
+  801789:	85 c0                	test   %eax,%eax
+  80178b:	78 21                	js     8017ae <ufork+0x56>
+	if (envid == 0) {
+  80178d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801791:	0f 84 e4 03 00 00    	je     801b7b <ufork+0x423>
+  801797:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80179e:	00 
+	op->po_op = PAGEOP_MAP;
+  80179f:	49 bf 60 36 80 00 00 	movabs $0x803660,%r15
+  8017a6:	00 00 00 
+  8017a9:	e9 e7 02 00 00       	jmp    801a95 <ufork+0x33d>
+		panic("sys_exofork failed: %e", envid);
+  8017ae:	89 c1                	mov    %eax,%ecx
+  8017b0:	48 ba d0 25 80 00 00 	movabs $0x8025d0,%rdx
+  8017b7:	00 00 00 
+  8017ba:	be e4 00 00 00       	mov    $0xe4,%esi
+  8017bf:	48 bf a7 25 80 00 00 	movabs $0x8025a7,%rdi
+  8017c6:	00 00 00 
+  8017c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ce:	49 b8 87 02 80 00 00 	movabs $0x800287,%r8
+  8017d5:	00 00 00 
+  8017d8:	41 ff d0             	call   *%r8
+  8017db:	44 89 e8             	mov    %r13d,%eax
+  8017de:	c1 e0 09             	shl    $0x9,%eax
+  8017e1:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  8017e4:	44 89 e8             	mov    %r13d,%eax
+  8017e7:	c1 e0 12             	shl    $0x12,%eax
+  8017ea:	89 45 ac             	mov    %eax,-0x54(%rbp)
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  8017ed:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8017f4:	00 
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  8017f5:	44 89 6d a8          	mov    %r13d,-0x58(%rbp)
+				int pdeIndex = pdpeIndex * NPTENTRIES + k;
+  8017f9:	8b 75 c8             	mov    -0x38(%rbp),%esi
+				if (!(uvpd[pdeIndex] & PTE_P)) {
+  8017fc:	48 63 c6             	movslq %esi,%rax
+  8017ff:	48 bf 00 00 00 80 00 	movabs $0x10080000000,%rdi
+  801806:	01 00 00 
+  801809:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80180d:	a8 01                	test   $0x1,%al
+  80180f:	0f 84 52 02 00 00    	je     801a67 <ufork+0x30f>
+				if (uvpd[pdeIndex] & PTE_PS) {
+  801815:	48 63 c6             	movslq %esi,%rax
+  801818:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80181c:	a8 80                	test   $0x80,%al
+  80181e:	74 52                	je     801872 <ufork+0x11a>
+					void *va = PGADDR(i, j, k, 0, 0);
+  801820:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  801824:	48 c1 e3 27          	shl    $0x27,%rbx
+  801828:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80182c:	48 09 c3             	or     %rax,%rbx
+  80182f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801833:	48 09 c3             	or     %rax,%rbx
+					if ((uintptr_t)va >= UTOP) {
+  801836:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  80183b:	48 39 d8             	cmp    %rbx,%rax
+  80183e:	0f 82 ca 02 00 00    	jb     801b0e <ufork+0x3b6>
+					r = sys_page_map(0, va, 0, va, uvpd[pdeIndex] & PTE_SYSCALL);
+  801844:	48 63 d6             	movslq %esi,%rdx
+  801847:	4c 8b 04 d7          	mov    (%rdi,%rdx,8),%r8
+  80184b:	41 81 e0 07 0e 00 00 	and    $0xe07,%r8d
+  801852:	48 89 d9             	mov    %rbx,%rcx
+  801855:	ba 00 00 00 00       	mov    $0x0,%edx
+  80185a:	48 89 de             	mov    %rbx,%rsi
+  80185d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801862:	48 b8 56 11 80 00 00 	movabs $0x801156,%rax
+  801869:	00 00 00 
+  80186c:	ff d0                	call   *%rax
+					if (r < 0) {
+  80186e:	85 c0                	test   %eax,%eax
+  801870:	78 18                	js     80188a <ufork+0x132>
+  801872:	4c 63 65 ac          	movslq -0x54(%rbp),%r12
+  801876:	4c 89 e3             	mov    %r12,%rbx
+  801879:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80187d:	4d 8d ac 24 00 02 00 	lea    0x200(%r12),%r13
+  801884:	00 
+  801885:	e9 00 01 00 00       	jmp    80198a <ufork+0x232>
+						panic("splitting 2MB page at %p failed: %e", va, r);
+  80188a:	41 89 c0             	mov    %eax,%r8d
+  80188d:	48 89 d9             	mov    %rbx,%rcx
+  801890:	48 ba 00 25 80 00 00 	movabs $0x802500,%rdx
+  801897:	00 00 00 
+  80189a:	be 0a 01 00 00       	mov    $0x10a,%esi
+  80189f:	48 bf a7 25 80 00 00 	movabs $0x8025a7,%rdi
+  8018a6:	00 00 00 
+  8018a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ae:	49 b9 87 02 80 00 00 	movabs $0x800287,%r9
+  8018b5:	00 00 00 
+  8018b8:	41 ff d1             	call   *%r9
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  8018bb:	48 bf 44 30 80 00 00 	movabs $0x803044,%rdi
+  8018c2:	00 00 00 
+  8018c5:	8b 0f                	mov    (%rdi),%ecx
+  8018c7:	8d 71 01             	lea    0x1(%rcx),%esi
+  8018ca:	89 37                	mov    %esi,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  8018cc:	48 63 c9             	movslq %ecx,%rcx
+  8018cf:	48 8d 34 09          	lea    (%rcx,%rcx,1),%rsi
+  8018d3:	48 8d 3c 0e          	lea    (%rsi,%rcx,1),%rdi
+  8018d7:	41 c7 04 ff 01 00 00 	movl   $0x1,(%r15,%rdi,8)
+  8018de:	00 
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  8018df:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  8018e5:	41 89 54 ff 04       	mov    %edx,0x4(%r15,%rdi,8)
+	op->po_srcva = op->po_dstva = va;
+  8018ea:	49 89 44 ff 10       	mov    %rax,0x10(%r15,%rdi,8)
+  8018ef:	49 89 44 ff 08       	mov    %rax,0x8(%r15,%rdi,8)
+}
+  8018f4:	eb 76                	jmp    80196c <ufork+0x214>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U | PTE_COW);
+  8018f6:	48 bf 44 30 80 00 00 	movabs $0x803044,%rdi
+  8018fd:	00 00 00 
+  801900:	8b 17                	mov    (%rdi),%edx
+  801902:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  801905:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  801907:	48 63 d2             	movslq %edx,%rdx
+  80190a:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  80190e:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  801912:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  801919:	00 
+	op->po_perm = perm;
+  80191a:	41 c7 44 f7 04 05 08 	movl   $0x805,0x4(%r15,%rsi,8)
+  801921:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  801923:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  801928:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+		dupqueue(&dup_self[ndup_self++], va, PTE_P | PTE_U | PTE_COW);
+  80192d:	48 b9 40 30 80 00 00 	movabs $0x803040,%rcx
+  801934:	00 00 00 
+  801937:	8b 11                	mov    (%rcx),%edx
+  801939:	8d 72 01             	lea    0x1(%rdx),%esi
+  80193c:	89 31                	mov    %esi,(%rcx)
+	op->po_op = PAGEOP_MAP;
+  80193e:	48 be 60 30 80 00 00 	movabs $0x803060,%rsi
+  801945:	00 00 00 
+  801948:	48 63 d2             	movslq %edx,%rdx
+  80194b:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  80194f:	48 8d 3c 11          	lea    (%rcx,%rdx,1),%rdi
+  801953:	c7 04 fe 01 00 00 00 	movl   $0x1,(%rsi,%rdi,8)
+	op->po_perm = perm;
+  80195a:	c7 44 fe 04 05 08 00 	movl   $0x805,0x4(%rsi,%rdi,8)
+  801961:	00 
+	op->po_srcva = op->po_dstva = va;
+  801962:	48 89 44 fe 10       	mov    %rax,0x10(%rsi,%rdi,8)
+  801967:	48 89 44 fe 08       	mov    %rax,0x8(%rsi,%rdi,8)
+	if (ndup_child == DUP_BATCH) {
+  80196c:	48 b8 44 30 80 00 00 	movabs $0x803044,%rax
+  801973:	00 00 00 
+  801976:	83 38 40             	cmpl   $0x40,(%rax)
+  801979:	0f 84 a4 00 00 00    	je     801a23 <ufork+0x2cb>
+				for (int l = 0; l < NPTENTRIES; l++) {
+  80197f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801986:	49 83 c4 01          	add    $0x1,%r12
+  80198a:	4d 39 ec             	cmp    %r13,%r12
+  80198d:	0f 84 d4 00 00 00    	je     801a67 <ufork+0x30f>
+					if (va >= UTOP) {
+  801993:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  801998:	48 39 d8             	cmp    %rbx,%rax
+  80199b:	0f 82 6d 01 00 00    	jb     801b0e <ufork+0x3b6>
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  8019a1:	48 b8 00 10 80 43 ff 	movabs $0xffffffff43801000,%rax
+  8019a8:	ff ff ff 
+  8019ab:	48 01 d8             	add    %rbx,%rax
+  8019ae:	48 3d ff 0f 00 00    	cmp    $0xfff,%rax
+  8019b4:	76 c9                	jbe    80197f <ufork+0x227>
+					if (!(uvpt[pn] & PTE_P)) {
+  8019b6:	4b 8b 04 e6          	mov    (%r14,%r12,8),%rax
+  8019ba:	a8 01                	test   $0x1,%al
+  8019bc:	74 c1                	je     80197f <ufork+0x227>
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  8019be:	48 b8 00 f0 ff ff ff 	movabs $0xffffffff000,%rax
+  8019c5:	0f 00 00 
+  8019c8:	48 21 d8             	and    %rbx,%rax
+	pte_t pte = uvpt[pn];
+  8019cb:	44 89 e2             	mov    %r12d,%edx
+  8019ce:	49 8b 14 d6          	mov    (%r14,%rdx,8),%rdx
+	if (pte & PTE_SHARE) {
+  8019d2:	f6 c6 04             	test   $0x4,%dh
+  8019d5:	0f 85 e0 fe ff ff    	jne    8018bb <ufork+0x163>
+	} else if ((pte & PTE_W) || (pte & PTE_COW)) {
+  8019db:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  8019e1:	0f 85 0f ff ff ff    	jne    8018f6 <ufork+0x19e>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U);
+  8019e7:	48 bf 44 30 80 00 00 	movabs $0x803044,%rdi
+  8019ee:	00 00 00 
+  8019f1:	8b 17                	mov    (%rdi),%edx
+  8019f3:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  8019f6:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  8019f8:	48 63 d2             	movslq %edx,%rdx
+  8019fb:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  8019ff:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  801a03:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  801a0a:	00 
+	op->po_perm = perm;
+  801a0b:	41 c7 44 f7 04 05 00 	movl   $0x5,0x4(%r15,%rsi,8)
+  801a12:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  801a14:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  801a19:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+}
+  801a1e:	e9 49 ff ff ff       	jmp    80196c <ufork+0x214>
+		return dupflush(envid);
+  801a23:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801a26:	48 b8 34 16 80 00 00 	movabs $0x801634,%rax
+  801a2d:	00 00 00 
+  801a30:	ff d0                	call   *%rax
+					if (r < 0) {
+  801a32:	85 c0                	test   %eax,%eax
+  801a34:	0f 89 45 ff ff ff    	jns    80197f <ufork+0x227>
+						panic("duppage failed:  %e", r);
+  801a3a:	89 c1                	mov    %eax,%ecx
+  801a3c:	48 ba e7 25 80 00 00 	movabs $0x8025e7,%rdx
+  801a43:	00 00 00 
+  801a46:	be 20 01 00 00       	mov    $0x120,%esi
+  801a4b:	48 bf a7 25 80 00 00 	movabs $0x8025a7,%rdi
+  801a52:	00 00 00 
+  801a55:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a5a:	49 b8 87 02 80 00 00 	movabs $0x800287,%r8
+  801a61:	00 00 00 
+  801a64:	41 ff d0             	call   *%r8
+			for (int k = 0; k < NPTENTRIES; k++) {
+  801a67:	81 45 ac 00 02 00 00 	addl   $0x200,-0x54(%rbp)
+  801a6e:	83 45 c8 01          	addl   $0x1,-0x38(%rbp)
+  801a72:	48 81 45 b0 00 00 20 	addq   $0x200000,-0x50(%rbp)
+  801a79:	00 
+  801a7a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a7e:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  801a84:	0f 85 6f fd ff ff    	jne    8017f9 <ufork+0xa1>
+  801a8a:	44 8b 6d a8          	mov    -0x58(%rbp),%r13d
+  801a8e:	eb 5d                	jmp    801aed <ufork+0x395>
+	for (int i = 0; i < NPTENTRIES; i++) {
+  801a90:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  801a95:	48 81 7d c0 00 02 00 	cmpq   $0x200,-0x40(%rbp)
+  801a9c:	00 
+  801a9d:	74 6f                	je     801b0e <ufork+0x3b6>
+		if (!(uvpml4e[i] & PTE_P)) {
+  801a9f:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  801aa3:	48 63 c3             	movslq %ebx,%rax
+  801aa6:	48 be 00 20 40 80 00 	movabs $0x10080402000,%rsi
+  801aad:	01 00 00 
+  801ab0:	48 8b 04 c6          	mov    (%rsi,%rax,8),%rax
+  801ab4:	a8 01                	test   $0x1,%al
+  801ab6:	74 d8                	je     801a90 <ufork+0x338>
+  801ab8:	41 89 dc             	mov    %ebx,%r12d
+  801abb:	41 c1 e4 09          	shl    $0x9,%r12d
+  801abf:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801ac6:	00 
+					if (!(uvpt[pn] & PTE_P)) {
+  801ac7:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  801ace:	01 00 00 
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  801ad1:	45 89 e5             	mov    %r12d,%r13d
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  801ad4:	49 63 c5             	movslq %r13d,%rax
+  801ad7:	48 bb 00 00 40 80 00 	movabs $0x10080400000,%rbx
+  801ade:	01 00 00 
+  801ae1:	48 8b 04 c3          	mov    (%rbx,%rax,8),%rax
+  801ae5:	a8 01                	test   $0x1,%al
+  801ae7:	0f 85 ee fc ff ff    	jne    8017db <ufork+0x83>
+		for (int j = 0; j < NPTENTRIES; j++) {
+  801aed:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  801af4:	40 
+  801af5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801af9:	41 83 c5 01          	add    $0x1,%r13d
+  801afd:	48 b9 00 00 00 00 80 	movabs $0x8000000000,%rcx
+  801b04:	00 00 00 
+  801b07:	48 39 c8             	cmp    %rcx,%rax
+  801b0a:	75 c8                	jne    801ad4 <ufork+0x37c>
+  801b0c:	eb 82                	jmp    801a90 <ufork+0x338>
+	r = dupflush(envid);
+  801b0e:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801b11:	48 b8 34 16 80 00 00 	movabs $0x801634,%rax
+  801b18:	00 00 00 
+  801b1b:	ff d0                	call   *%rax
+	if (r < 0) {
+  801b1d:	85 c0                	test   %eax,%eax
+  801b1f:	78 6c                	js     801b8d <ufork+0x435>
+	r = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801b21:	ba 07 00 00 00       	mov    $0x7,%edx
+  801b26:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801b2b:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801b2e:	48 b8 aa 10 80 00 00 	movabs $0x8010aa,%rax
+  801b35:	00 00 00 
+  801b38:	ff d0                	call   *%rax
+	if (r < 0) {
+  801b3a:	85 c0                	test   %eax,%eax
+  801b3c:	78 7c                	js     801bba <ufork+0x462>
+	r = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  801b3e:	48 be fe 1e 80 00 00 	movabs $0x801efe,%rsi
+  801b45:	00 00 00 
+  801b48:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801b4b:	48 b8 c2 13 80 00 00 	movabs $0x8013c2,%rax
+  801b52:	00 00 00 
+  801b55:	ff d0                	call   *%rax
+	if (r < 0) {
+  801b57:	85 c0                	test   %eax,%eax
+  801b59:	0f 88 88 00 00 00    	js     801be7 <ufork+0x48f>
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  801b5f:	be 02 00 00 00       	mov    $0x2,%esi
+  801b64:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801b67:	48 b8 67 13 80 00 00 	movabs $0x801367,%rax
+  801b6e:	00 00 00 
+  801b71:	ff d0                	call   *%rax
+	if (r < 0) {
+  801b73:	85 c0                	test   %eax,%eax
+  801b75:	0f 88 99 00 00 00    	js     801c14 <ufork+0x4bc>
+}
+  801b7b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801b7e:	48 83 c4 38          	add    $0x38,%rsp
+  801b82:	5b                   	pop    %rbx
+  801b83:	41 5c                	pop    %r12
+  801b85:	41 5d                	pop    %r13
+  801b87:	41 5e                	pop    %r14
+  801b89:	41 5f                	pop    %r15
+  801b8b:	5d                   	pop    %rbp
+  801b8c:	c3                   	ret
+		panic("duppage failed:  %e", r);
+  801b8d:	89 c1                	mov    %eax,%ecx
+  801b8f:	48 ba e7 25 80 00 00 	movabs $0x8025e7,%rdx
+  801b96:	00 00 00 
+  801b99:	be 29 01 00 00       	mov    $0x129,%esi
+  801b9e:	48 bf a7 25 80 00 00 	movabs $0x8025a7,%rdi
+  801ba5:	00 00 00 
+  801ba8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bad:	49 b8 87 02 80 00 00 	movabs $0x800287,%r8
+  801bb4:	00 00 00 
+  801bb7:	41 ff d0             	call   *%r8
+		panic("sys_page_alloc for child exception stack failed: %e", r);
+  801bba:	89 c1                	mov    %eax,%ecx
+  801bbc:	48 ba 28 25 80 00 00 	movabs $0x802528,%rdx
+  801bc3:	00 00 00 
+  801bc6:	be 2e 01 00 00       	mov    $0x12e,%esi
+  801bcb:	48 bf a7 25 80 00 00 	movabs $0x8025a7,%rdi
+  801bd2:	00 00 00 
+  801bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bda:	49 b8 87 02 80 00 00 	movabs $0x800287,%r8
+  801be1:	00 00 00 
+  801be4:	41 ff d0             	call   *%r8
+		panic("sys_env_set_pgfault_upcall failed:  %e", r);
+  801be7:	89 c1                	mov    %eax,%ecx
+  801be9:	48 ba 60 25 80 00 00 	movabs $0x802560,%rdx
+  801bf0:	00 00 00 
+  801bf3:	be 33 01 00 00       	mov    $0x133,%esi
+  801bf8:	48 bf a7 25 80 00 00 	movabs $0x8025a7,%rdi
+  801bff:	00 00 00 
+  801c02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c07:	49 b8 87 02 80 00 00 	movabs $0x800287,%r8
+  801c0e:	00 00 00 
+  801c11:	41 ff d0             	call   *%r8
+		panic("sys_env_set_status failed:  %e", r);
+  801c14:	89 c1                	mov    %eax,%ecx
+  801c16:	48 ba 88 25 80 00 00 	movabs $0x802588,%rdx
+  801c1d:	00 00 00 
+  801c20:	be 38 01 00 00       	mov    $0x138,%esi
+  801c25:	48 bf a7 25 80 00 00 	movabs $0x8025a7,%rdi
+  801c2c:	00 00 00 
+  801c2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c34:	49 b8 87 02 80 00 00 	movabs $0x800287,%r8
+  801c3b:	00 00 00 
+  801c3e:	41 ff d0             	call   *%r8
+
+0000000000801c41 <sfork>:
+// on one stack, since nothing is private to the child.
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801c41:	55                   	push   %rbp
+  801c42:	48 89 e5             	mov    %rsp,%rbp
+  801c45:	48 89 f2             	mov    %rsi,%rdx
+	return sys_thread_create(thread_start, (uint64_t) fn, (uint64_t) arg);
+  801c48:	48 89 fe             	mov    %rdi,%rsi
+  801c4b:	48 bf 16 17 80 00 00 	movabs $0x801716,%rdi
+  801c52:	00 00 00 
+  801c55:	48 b8 36 12 80 00 00 	movabs $0x801236,%rax
+  801c5c:	00 00 00 
+  801c5f:	ff d0                	call   *%rax
+}
+  801c61:	5d                   	pop    %rbp
+  801c62:	c3                   	ret
+
+0000000000801c63 <ipc_recv>:
+	- if perm_store non null, contents should be bitwise OR with thisenv->env_ipc_perm
+	- return the value sent by the sender: thisenv->env_ipc_value
+*/
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801c63:	55                   	push   %rbp
+  801c64:	48 89 e5             	mov    %rsp,%rbp
+  801c67:	41 54                	push   %r12
+  801c69:	53                   	push   %rbx
+  801c6a:	48 89 fb             	mov    %rdi,%rbx
+  801c6d:	48 89 f7             	mov    %rsi,%rdi
+  801c70:	49 89 d4             	mov    %rdx,%r12
+	// LAB 4: Your code here.
+	int r;
+	
+	if (pg == NULL) pg = (void *)UTOP;
+  801c73:	48 85 f6             	test   %rsi,%rsi
+  801c76:	b8 00 00 80 bc       	mov    $0xbc800000,%eax
+  801c7b:	48 0f 44 f8          	cmove  %rax,%rdi
+	
+	r = sys_ipc_recv(pg);
+  801c7f:	48 b8 2e 14 80 00 00 	movabs $0x80142e,%rax
+  801c86:	00 00 00 
+  801c89:	ff d0                	call   *%rax
+	
+	if (r < 0) {
+  801c8b:	85 c0                	test   %eax,%eax
+  801c8d:	0f 88 99 00 00 00    	js     801d2c <ipc_recv+0xc9>
+			*perm_store = 0;
+		}
+		return r;
+	}
+	
+	if (from_env_store) {
+  801c93:	48 85 db             	test   %rbx,%rbx
+  801c96:	74 2e                	je     801cc6 <ipc_recv+0x63>
+	asm volatile("movl %%gs:%c1, %0"
+  801c98:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  801c9f:	00 
+		*from_env_store = thisenv->env_ipc_from;
+  801ca0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801ca5:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801ca9:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801cad:	48 c1 e2 04          	shl    $0x4,%rdx
+  801cb1:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801cb8:	00 00 00 
+  801cbb:	48 01 d0             	add    %rdx,%rax
+  801cbe:	8b 80 1c 01 00 00    	mov    0x11c(%rax),%eax
+  801cc4:	89 03                	mov    %eax,(%rbx)
+	}
+	if (perm_store) {
+  801cc6:	4d 85 e4             	test   %r12,%r12
+  801cc9:	74 30                	je     801cfb <ipc_recv+0x98>
+  801ccb:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  801cd2:	00 
+		*perm_store = thisenv->env_ipc_perm;
+  801cd3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801cd8:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801cdc:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801ce0:	48 c1 e2 04          	shl    $0x4,%rdx
+  801ce4:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801ceb:	00 00 00 
+  801cee:	48 01 d0             	add    %rdx,%rax
+  801cf1:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+  801cf7:	41 89 04 24          	mov    %eax,(%r12)
+  801cfb:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  801d02:	00 
+	}
+	
+	return thisenv->env_ipc_value;
+  801d03:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d08:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801d0c:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801d10:	48 c1 e2 04          	shl    $0x4,%rdx
+  801d14:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801d1b:	00 00 00 
+  801d1e:	48 01 d0             	add    %rdx,%rax
+  801d21:	8b 80 18 01 00 00    	mov    0x118(%rax),%eax
+}
+  801d27:	5b                   	pop    %rbx
+  801d28:	41 5c                	pop    %r12
+  801d2a:	5d                   	pop    %rbp
+  801d2b:	c3                   	ret
+		if (from_env_store) {
+  801d2c:	48 85 db             	test   %rbx,%rbx
+  801d2f:	74 06                	je     801d37 <ipc_recv+0xd4>
+			*from_env_store = 0;
+  801d31:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+		if (perm_store) {
+  801d37:	4d 85 e4             	test   %r12,%r12
+  801d3a:	74 eb                	je     801d27 <ipc_recv+0xc4>
+			*perm_store = 0;
+  801d3c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801d43:	00 
+  801d44:	eb e1                	jmp    801d27 <ipc_recv+0xc4>
+
+0000000000801d46 <ipc_send>:
+	- if a diff negative value, panic
+	- otherwise, body of loop should call sys_yield() to be allow JOS to schedule another env
+*/
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801d46:	55                   	push   %rbp
+  801d47:	48 89 e5             	mov    %rsp,%rbp
+  801d4a:	41 57                	push   %r15
+  801d4c:	41 56                	push   %r14
+  801d4e:	41 55                	push   %r13
+  801d50:	41 54                	push   %r12
+  801d52:	53                   	push   %rbx
+  801d53:	48 83 ec 18          	sub    $0x18,%rsp
+  801d57:	41 89 fd             	mov    %edi,%r13d
+  801d5a:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  801d5d:	48 89 d3             	mov    %rdx,%rbx
+  801d60:	41 89 cc             	mov    %ecx,%r12d
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  801d63:	48 85 d2             	test   %rdx,%rdx
+  801d66:	b8 00 00 80 bc       	mov    $0xbc800000,%eax
+  801d6b:	48 0f 44 d8          	cmove  %rax,%rbx
+	}
+	
+	// keep trying until success
+	while (1) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  801d6f:	49 be 1a 14 80 00 00 	movabs $0x80141a,%r14
+  801d76:	00 00 00 
+		if (r == 0) {
+			return;
+		}
+		
+		if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  801d79:	49 bf 8b 10 80 00 00 	movabs $0x80108b,%r15
+  801d80:	00 00 00 
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  801d83:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  801d86:	44 89 e1             	mov    %r12d,%ecx
+  801d89:	48 89 da             	mov    %rbx,%rdx
+  801d8c:	44 89 ef             	mov    %r13d,%edi
+  801d8f:	41 ff d6             	call   *%r14
+		if (r == 0) {
+  801d92:	85 c0                	test   %eax,%eax
+  801d94:	74 37                	je     801dcd <ipc_send+0x87>
+		if (r == -E_IPC_NOT_RECV) {
+  801d96:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801d99:	75 05                	jne    801da0 <ipc_send+0x5a>
+			sys_yield();
+  801d9b:	41 ff d7             	call   *%r15
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  801d9e:	eb e3                	jmp    801d83 <ipc_send+0x3d>
+		} else {
+			panic("ipc_send - %e", r);
+  801da0:	89 c1                	mov    %eax,%ecx
+  801da2:	48 ba fb 25 80 00 00 	movabs $0x8025fb,%rdx
+  801da9:	00 00 00 
+  801dac:	be 67 00 00 00       	mov    $0x67,%esi
+  801db1:	48 bf 09 26 80 00 00 	movabs $0x802609,%rdi
+  801db8:	00 00 00 
+  801dbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc0:	49 b8 87 02 80 00 00 	movabs $0x800287,%r8
+  801dc7:	00 00 00 
+  801dca:	41 ff d0             	call   *%r8
+		}
+	}
+}
+  801dcd:	48 83 c4 18          	add    $0x18,%rsp
+  801dd1:	5b                   	pop    %rbx
+  801dd2:	41 5c                	pop    %r12
+  801dd4:	41 5d                	pop    %r13
+  801dd6:	41 5e                	pop    %r14
+  801dd8:	41 5f                	pop    %r15
+  801dda:	5d                   	pop    %rbp
+  801ddb:	c3                   	ret
+
+0000000000801ddc <ipc_find_env>:
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+	int i;
+	for (i = 0; i < NENV; i++)
+  801ddc:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  801de1:	48 be 00 00 80 bc 00 	movabs $0xbc800000,%rsi
+  801de8:	00 00 00 
+  801deb:	48 63 c2             	movslq %edx,%rax
+  801dee:	48 8d 0c c0          	lea    (%rax,%rax,8),%rcx
+  801df2:	48 8d 04 48          	lea    (%rax,%rcx,2),%rax
+  801df6:	48 c1 e0 04          	shl    $0x4,%rax
+  801dfa:	48 01 f0             	add    %rsi,%rax
+  801dfd:	8b 80 c0 00 00 00    	mov    0xc0(%rax),%eax
+  801e03:	39 f8                	cmp    %edi,%eax
+  801e05:	74 11                	je     801e18 <ipc_find_env+0x3c>
+	for (i = 0; i < NENV; i++)
+  801e07:	83 c2 01             	add    $0x1,%edx
+  801e0a:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801e10:	75 d9                	jne    801deb <ipc_find_env+0xf>
+			return envs[i].env_id;
+	return 0;
+  801e12:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e17:	c3                   	ret
+			return envs[i].env_id;
+  801e18:	48 63 d2             	movslq %edx,%rdx
+  801e1b:	48 8d 14 4a          	lea    (%rdx,%rcx,2),%rdx
+  801e1f:	48 c1 e2 04          	shl    $0x4,%rdx
+  801e23:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801e2a:	00 00 00 
+  801e2d:	48 01 d0             	add    %rdx,%rax
+  801e30:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+  801e36:	c3                   	ret
+
+0000000000801e37 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801e37:	55                   	push   %rbp
+  801e38:	48 89 e5             	mov    %rsp,%rbp
+  801e3b:	53                   	push   %rbx
+  801e3c:	48 83 ec 08          	sub    $0x8,%rsp
+  801e40:	48 89 fb             	mov    %rdi,%rbx
+	int r;
+
+	if (_pgfault_handler == 0) {
+  801e43:	48 ba 60 3c 80 00 00 	movabs $0x803c60,%rdx
+  801e4a:	00 00 00 
+  801e4d:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801e51:	74 13                	je     801e66 <set_pgfault_handler+0x2f>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801e53:	48 89 d8             	mov    %rbx,%rax
+  801e56:	48 a3 60 3c 80 00 00 	movabs %rax,0x803c60
+  801e5d:	00 00 00 
+}
+  801e60:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e64:	c9                   	leave
+  801e65:	c3                   	ret
+		r = sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801e66:	ba 07 00 00 00       	mov    $0x7,%edx
+  801e6b:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801e70:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e75:	48 b8 aa 10 80 00 00 	movabs $0x8010aa,%rax
+  801e7c:	00 00 00 
+  801e7f:	ff d0                	call   *%rax
+		if (r < 0) {
+  801e81:	85 c0                	test   %eax,%eax
+  801e83:	78 4c                	js     801ed1 <set_pgfault_handler+0x9a>
+		r = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801e85:	48 be fe 1e 80 00 00 	movabs $0x801efe,%rsi
+  801e8c:	00 00 00 
+  801e8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e94:	48 b8 c2 13 80 00 00 	movabs $0x8013c2,%rax
+  801e9b:	00 00 00 
+  801e9e:	ff d0                	call   *%rax
+		if (r < 0) {
+  801ea0:	85 c0                	test   %eax,%eax
+  801ea2:	79 af                	jns    801e53 <set_pgfault_handler+0x1c>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+  801ea4:	89 c1                	mov    %eax,%ecx
+  801ea6:	48 ba 40 26 80 00 00 	movabs $0x802640,%rdx
+  801ead:	00 00 00 
+  801eb0:	be 2c 00 00 00       	mov    $0x2c,%esi
+  801eb5:	48 bf 2e 26 80 00 00 	movabs $0x80262e,%rdi
+  801ebc:	00 00 00 
+  801ebf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ec4:	49 b8 87 02 80 00 00 	movabs $0x800287,%r8
+  801ecb:	00 00 00 
+  801ece:	41 ff d0             	call   *%r8
+			panic("sys_page_alloc failed:  %e", r);
+  801ed1:	89 c1                	mov    %eax,%ecx
+  801ed3:	48 ba 13 26 80 00 00 	movabs $0x802613,%rdx
+  801eda:	00 00 00 
+  801edd:	be 28 00 00 00       	mov    $0x28,%esi
+  801ee2:	48 bf 2e 26 80 00 00 	movabs $0x80262e,%rdi
+  801ee9:	00 00 00 
+  801eec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef1:	49 b8 87 02 80 00 00 	movabs $0x800287,%r8
+  801ef8:	00 00 00 
+  801efb:	41 ff d0             	call   *%r8
+
+0000000000801efe <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi		// function argument: pointer to UTF
+  801efe:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  801f01:	48 a1 60 3c 80 00 00 	movabs 0x803c60,%rax
+  801f08:	00 00 00 
+	call *%rax
+  801f0b:	ff d0                	call   *%rax
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here. (Hint. You need to modify the trap time rsp to make room for the return rip ) */
+
+	movq  152(%rsp), %rax
+  801f0d:	48 8b 84 24 98 00 00 	mov    0x98(%rsp),%rax
+  801f14:	00 
+	subq $8, %rax
+  801f15:	48 83 e8 08          	sub    $0x8,%rax
+	movq %rax, 152(%rsp)
+  801f19:	48 89 84 24 98 00 00 	mov    %rax,0x98(%rsp)
+  801f20:	00 
+
+	movq 136(%rsp), %rbx
+  801f21:	48 8b 9c 24 88 00 00 	mov    0x88(%rsp),%rbx
+  801f28:	00 
+	movq %rbx, (%rax)
+  801f29:	48 89 18             	mov    %rbx,(%rax)
+
+	/* Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here. (Hint, the oposite of _alltraps) */
+
+	addq $16, %rsp
+  801f2c:	48 83 c4 10          	add    $0x10,%rsp
+	
+	popq %r15
+  801f30:	41 5f                	pop    %r15
+	popq %r14
+  801f32:	41 5e                	pop    %r14
+	popq %r13
+  801f34:	41 5d                	pop    %r13
+	popq %r12
+  801f36:	41 5c                	pop    %r12
+	popq %r11
+  801f38:	41 5b                	pop    %r11
+	popq %r10
+  801f3a:	41 5a                	pop    %r10
+	popq %r9
+  801f3c:	41 59                	pop    %r9
+	popq %r8
+  801f3e:	41 58                	pop    %r8
+	popq %rsi
+  801f40:	5e                   	pop    %rsi
+	popq %rdi
+  801f41:	5f                   	pop    %rdi
+	popq %rbp
+  801f42:	5d                   	pop    %rbp
+	popq %rdx
+  801f43:	5a                   	pop    %rdx
+	popq %rcx
+  801f44:	59                   	pop    %rcx
+	popq %rbx
+  801f45:	5b                   	pop    %rbx
+	popq %rax
+  801f46:	58                   	pop    %rax
+
+	addq $8, %rsp
+  801f47:	48 83 c4 08          	add    $0x8,%rsp
+	/* Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 4: Your code here. */
+
+	popfq
+  801f4b:	9d                   	popf
+
+	/* Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here. */
+
+	popq %rsp
+  801f4c:	5c                   	pop    %rsp
+
+	/* Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here. */
+  801f4d:	c3                   	ret
@@ -0,0 +1,3451 @@
+
+obj/user/primes:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 7d 01 00 00       	call   8001ae <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	41 57                	push   %r15
+  800039:	41 56                	push   %r14
+  80003b:	41 55                	push   %r13
+  80003d:	41 54                	push   %r12
+  80003f:	53                   	push   %rbx
+  800040:	48 83 ec 18          	sub    $0x18,%rsp
+	int i, id, p;
+	envid_t envid;
+
+	// fetch a prime from our left neighbor
+top:
+	p = ipc_recv(&envid, 0, 0);
+  800044:	49 bf d0 1b 80 00 00 	movabs $0x801bd0,%r15
+  80004b:	00 00 00 
+	cprintf("CPU %d: %d ", thisenv->env_cpunum, p);
+  80004e:	49 be 00 00 80 bc 00 	movabs $0xbc800000,%r14
+  800055:	00 00 00 
+  800058:	49 bd 93 03 80 00 00 	movabs $0x800393,%r13
+  80005f:	00 00 00 
+	p = ipc_recv(&envid, 0, 0);
+  800062:	ba 00 00 00 00       	mov    $0x0,%edx
+  800067:	be 00 00 00 00       	mov    $0x0,%esi
+  80006c:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  800070:	41 ff d7             	call   *%r15
+  800073:	89 c3                	mov    %eax,%ebx
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800075:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  80007c:	00 
+	cprintf("CPU %d: %d ", thisenv->env_cpunum, p);
+  80007d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800082:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800086:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  80008a:	48 c1 e0 04          	shl    $0x4,%rax
+  80008e:	4c 01 f0             	add    %r14,%rax
+  800091:	8b b0 cc 00 00 00    	mov    0xcc(%rax),%esi
+  800097:	89 da                	mov    %ebx,%edx
+  800099:	48 bf c0 1e 80 00 00 	movabs $0x801ec0,%rdi
+  8000a0:	00 00 00 
+  8000a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a8:	41 ff d5             	call   *%r13
+
+	// fork a right neighbor to continue the chain
+	if ((id = fork()) < 0)
+  8000ab:	48 b8 9d 16 80 00 00 	movabs $0x80169d,%rax
+  8000b2:	00 00 00 
+  8000b5:	ff d0                	call   *%rax
+  8000b7:	41 89 c4             	mov    %eax,%r12d
+  8000ba:	85 c0                	test   %eax,%eax
+  8000bc:	78 42                	js     800100 <primeproc+0xcd>
+		panic("fork: %e", id);
+	if (id == 0)
+  8000be:	74 a2                	je     800062 <primeproc+0x2f>
+		goto top;
+
+	// filter out multiples of our prime
+	while (1) {
+		i = ipc_recv(&envid, 0, 0);
+  8000c0:	49 bd d0 1b 80 00 00 	movabs $0x801bd0,%r13
+  8000c7:	00 00 00 
+		if (i % p)
+			ipc_send(id, i, 0, 0);
+  8000ca:	49 be b3 1c 80 00 00 	movabs $0x801cb3,%r14
+  8000d1:	00 00 00 
+		i = ipc_recv(&envid, 0, 0);
+  8000d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8000de:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  8000e2:	41 ff d5             	call   *%r13
+  8000e5:	89 c6                	mov    %eax,%esi
+		if (i % p)
+  8000e7:	99                   	cltd
+  8000e8:	f7 fb                	idiv   %ebx
+  8000ea:	85 d2                	test   %edx,%edx
+  8000ec:	74 e6                	je     8000d4 <primeproc+0xa1>
+			ipc_send(id, i, 0, 0);
+  8000ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000f8:	44 89 e7             	mov    %r12d,%edi
+  8000fb:	41 ff d6             	call   *%r14
+  8000fe:	eb d4                	jmp    8000d4 <primeproc+0xa1>
+		panic("fork: %e", id);
+  800100:	89 c1                	mov    %eax,%ecx
+  800102:	48 ba cc 1e 80 00 00 	movabs $0x801ecc,%rdx
+  800109:	00 00 00 
+  80010c:	be 1a 00 00 00       	mov    $0x1a,%esi
+  800111:	48 bf d5 1e 80 00 00 	movabs $0x801ed5,%rdi
+  800118:	00 00 00 
+  80011b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800120:	49 b8 f4 01 80 00 00 	movabs $0x8001f4,%r8
+  800127:	00 00 00 
+  80012a:	41 ff d0             	call   *%r8
+
+000000000080012d <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  80012d:	55                   	push   %rbp
+  80012e:	48 89 e5             	mov    %rsp,%rbp
+  800131:	41 55                	push   %r13
+  800133:	41 54                	push   %r12
+  800135:	53                   	push   %rbx
+  800136:	48 83 ec 08          	sub    $0x8,%rsp
+	int i, id;
+
+	// fork the first prime process in the chain
+	if ((id = fork()) < 0)
+  80013a:	48 b8 9d 16 80 00 00 	movabs $0x80169d,%rax
+  800141:	00 00 00 
+  800144:	ff d0                	call   *%rax
+  800146:	41 89 c4             	mov    %eax,%r12d
+  800149:	85 c0                	test   %eax,%eax
+  80014b:	78 28                	js     800175 <umain+0x48>
+		panic("fork: %e", id);
+	if (id == 0)
+		primeproc();
+
+	// feed all the integers through
+	for (i = 2; ; i++)
+  80014d:	bb 02 00 00 00       	mov    $0x2,%ebx
+		ipc_send(id, i, 0, 0);
+  800152:	49 bd b3 1c 80 00 00 	movabs $0x801cb3,%r13
+  800159:	00 00 00 
+	if (id == 0)
+  80015c:	74 44                	je     8001a2 <umain+0x75>
+		ipc_send(id, i, 0, 0);
+  80015e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800163:	ba 00 00 00 00       	mov    $0x0,%edx
+  800168:	89 de                	mov    %ebx,%esi
+  80016a:	44 89 e7             	mov    %r12d,%edi
+  80016d:	41 ff d5             	call   *%r13
+	for (i = 2; ; i++)
+  800170:	83 c3 01             	add    $0x1,%ebx
+  800173:	eb e9                	jmp    80015e <umain+0x31>
+		panic("fork: %e", id);
+  800175:	89 c1                	mov    %eax,%ecx
+  800177:	48 ba cc 1e 80 00 00 	movabs $0x801ecc,%rdx
+  80017e:	00 00 00 
+  800181:	be 2d 00 00 00       	mov    $0x2d,%esi
+  800186:	48 bf d5 1e 80 00 00 	movabs $0x801ed5,%rdi
+  80018d:	00 00 00 
+  800190:	b8 00 00 00 00       	mov    $0x0,%eax
+  800195:	49 b8 f4 01 80 00 00 	movabs $0x8001f4,%r8
+  80019c:	00 00 00 
+  80019f:	41 ff d0             	call   *%r8
+		primeproc();
+  8001a2:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  8001a9:	00 00 00 
+  8001ac:	ff d0                	call   *%rax
+
+00000000008001ae <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  8001ae:	55                   	push   %rbp
+  8001af:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001b2:	85 ff                	test   %edi,%edi
+  8001b4:	7e 0d                	jle    8001c3 <libmain+0x15>
+		binaryname = argv[0];
+  8001b6:	48 8b 06             	mov    (%rsi),%rax
+  8001b9:	48 a3 00 30 80 00 00 	movabs %rax,0x803000
+  8001c0:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  8001c3:	48 b8 2d 01 80 00 00 	movabs $0x80012d,%rax
+  8001ca:	00 00 00 
+  8001cd:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8001cf:	48 b8 dd 01 80 00 00 	movabs $0x8001dd,%rax
+  8001d6:	00 00 00 
+  8001d9:	ff d0                	call   *%rax
+}
+  8001db:	5d                   	pop    %rbp
+  8001dc:	c3                   	ret
+
+00000000008001dd <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001dd:	55                   	push   %rbp
+  8001de:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  8001e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001e6:	48 b8 70 0f 80 00 00 	movabs $0x800f70,%rax
+  8001ed:	00 00 00 
+  8001f0:	ff d0                	call   *%rax
+}
+  8001f2:	5d                   	pop    %rbp
+  8001f3:	c3                   	ret
+
+00000000008001f4 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001f4:	55                   	push   %rbp
+  8001f5:	48 89 e5             	mov    %rsp,%rbp
+  8001f8:	41 56                	push   %r14
+  8001fa:	41 55                	push   %r13
+  8001fc:	41 54                	push   %r12
+  8001fe:	53                   	push   %rbx
+  8001ff:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800206:	49 89 fc             	mov    %rdi,%r12
+  800209:	41 89 f5             	mov    %esi,%r13d
+  80020c:	48 89 d3             	mov    %rdx,%rbx
+  80020f:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800216:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80021d:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800224:	84 c0                	test   %al,%al
+  800226:	74 26                	je     80024e <_panic+0x5a>
+  800228:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  80022f:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800236:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  80023a:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  80023e:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800242:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800246:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  80024a:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80024e:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800255:	00 00 00 
+  800258:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  80025f:	00 00 00 
+  800262:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800266:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  80026d:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800274:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80027b:	48 b8 00 30 80 00 00 	movabs $0x803000,%rax
+  800282:	00 00 00 
+  800285:	4c 8b 30             	mov    (%rax),%r14
+  800288:	48 b8 cb 0f 80 00 00 	movabs $0x800fcb,%rax
+  80028f:	00 00 00 
+  800292:	ff d0                	call   *%rax
+  800294:	89 c6                	mov    %eax,%esi
+  800296:	45 89 e8             	mov    %r13d,%r8d
+  800299:	4c 89 e1             	mov    %r12,%rcx
+  80029c:	4c 89 f2             	mov    %r14,%rdx
+  80029f:	48 bf f0 1e 80 00 00 	movabs $0x801ef0,%rdi
+  8002a6:	00 00 00 
+  8002a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ae:	49 bc 93 03 80 00 00 	movabs $0x800393,%r12
+  8002b5:	00 00 00 
+  8002b8:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002bb:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  8002c2:	48 89 df             	mov    %rbx,%rdi
+  8002c5:	48 b8 2f 03 80 00 00 	movabs $0x80032f,%rax
+  8002cc:	00 00 00 
+  8002cf:	ff d0                	call   *%rax
+	cprintf("\n");
+  8002d1:	48 bf 13 1f 80 00 00 	movabs $0x801f13,%rdi
+  8002d8:	00 00 00 
+  8002db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e0:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002e3:	cc                   	int3
+	while (1)
+  8002e4:	eb fd                	jmp    8002e3 <_panic+0xef>
+
+00000000008002e6 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002e6:	55                   	push   %rbp
+  8002e7:	48 89 e5             	mov    %rsp,%rbp
+  8002ea:	53                   	push   %rbx
+  8002eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ef:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  8002f2:	8b 06                	mov    (%rsi),%eax
+  8002f4:	8d 50 01             	lea    0x1(%rax),%edx
+  8002f7:	89 16                	mov    %edx,(%rsi)
+  8002f9:	48 98                	cltq
+  8002fb:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  800300:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800306:	74 0a                	je     800312 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800308:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80030c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800310:	c9                   	leave
+  800311:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800312:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800316:	be ff 00 00 00       	mov    $0xff,%esi
+  80031b:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  800322:	00 00 00 
+  800325:	ff d0                	call   *%rax
+		b->idx = 0;
+  800327:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80032d:	eb d9                	jmp    800308 <putch+0x22>
+
+000000000080032f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80032f:	55                   	push   %rbp
+  800330:	48 89 e5             	mov    %rsp,%rbp
+  800333:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80033a:	48 89 fa             	mov    %rdi,%rdx
+  80033d:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  800340:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800347:	00 00 00 
+	b.cnt = 0;
+  80034a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800351:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800354:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  80035b:	48 bf e6 02 80 00 00 	movabs $0x8002e6,%rdi
+  800362:	00 00 00 
+  800365:	48 b8 4d 05 80 00 00 	movabs $0x80054d,%rax
+  80036c:	00 00 00 
+  80036f:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  800371:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  800378:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80037f:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  800386:	00 00 00 
+  800389:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  80038b:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  800391:	c9                   	leave
+  800392:	c3                   	ret
+
+0000000000800393 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800393:	55                   	push   %rbp
+  800394:	48 89 e5             	mov    %rsp,%rbp
+  800397:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80039e:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8003a5:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8003ac:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8003b3:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8003ba:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8003c1:	84 c0                	test   %al,%al
+  8003c3:	74 20                	je     8003e5 <cprintf+0x52>
+  8003c5:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8003c9:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8003cd:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8003d1:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8003d5:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8003d9:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8003dd:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8003e1:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8003e5:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  8003ec:	00 00 00 
+  8003ef:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8003f6:	00 00 00 
+  8003f9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003fd:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800404:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80040b:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  800412:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  800419:	48 b8 2f 03 80 00 00 	movabs $0x80032f,%rax
+  800420:	00 00 00 
+  800423:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  800425:	c9                   	leave
+  800426:	c3                   	ret
+
+0000000000800427 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800427:	55                   	push   %rbp
+  800428:	48 89 e5             	mov    %rsp,%rbp
+  80042b:	41 57                	push   %r15
+  80042d:	41 56                	push   %r14
+  80042f:	41 55                	push   %r13
+  800431:	41 54                	push   %r12
+  800433:	53                   	push   %rbx
+  800434:	48 83 ec 18          	sub    $0x18,%rsp
+  800438:	49 89 fc             	mov    %rdi,%r12
+  80043b:	49 89 f5             	mov    %rsi,%r13
+  80043e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800442:	44 89 c3             	mov    %r8d,%ebx
+  800445:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800448:	41 89 cf             	mov    %ecx,%r15d
+  80044b:	4c 39 fa             	cmp    %r15,%rdx
+  80044e:	72 29                	jb     800479 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800450:	48 89 d0             	mov    %rdx,%rax
+  800453:	ba 00 00 00 00       	mov    $0x0,%edx
+  800458:	49 f7 f7             	div    %r15
+  80045b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80045f:	48 89 c2             	mov    %rax,%rdx
+  800462:	48 b8 27 04 80 00 00 	movabs $0x800427,%rax
+  800469:	00 00 00 
+  80046c:	ff d0                	call   *%rax
+  80046e:	eb 10                	jmp    800480 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800470:	4c 89 ee             	mov    %r13,%rsi
+  800473:	44 89 f7             	mov    %r14d,%edi
+  800476:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  800479:	83 eb 01             	sub    $0x1,%ebx
+  80047c:	85 db                	test   %ebx,%ebx
+  80047e:	7f f0                	jg     800470 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800480:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800484:	ba 00 00 00 00       	mov    $0x0,%edx
+  800489:	49 f7 f7             	div    %r15
+  80048c:	48 b8 15 1f 80 00 00 	movabs $0x801f15,%rax
+  800493:	00 00 00 
+  800496:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  80049a:	4c 89 ee             	mov    %r13,%rsi
+  80049d:	41 ff d4             	call   *%r12
+}
+  8004a0:	48 83 c4 18          	add    $0x18,%rsp
+  8004a4:	5b                   	pop    %rbx
+  8004a5:	41 5c                	pop    %r12
+  8004a7:	41 5d                	pop    %r13
+  8004a9:	41 5e                	pop    %r14
+  8004ab:	41 5f                	pop    %r15
+  8004ad:	5d                   	pop    %rbp
+  8004ae:	c3                   	ret
+
+00000000008004af <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  8004af:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  8004b3:	48 8b 06             	mov    (%rsi),%rax
+  8004b6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004ba:	73 0a                	jae    8004c6 <sprintputch+0x17>
+		*b->buf++ = ch;
+  8004bc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004c0:	48 89 16             	mov    %rdx,(%rsi)
+  8004c3:	40 88 38             	mov    %dil,(%rax)
+}
+  8004c6:	c3                   	ret
+
+00000000008004c7 <printfmt>:
+{
+  8004c7:	55                   	push   %rbp
+  8004c8:	48 89 e5             	mov    %rsp,%rbp
+  8004cb:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8004d2:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8004d9:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8004e0:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8004e7:	84 c0                	test   %al,%al
+  8004e9:	74 20                	je     80050b <printfmt+0x44>
+  8004eb:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8004ef:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8004f3:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8004f7:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8004fb:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8004ff:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800503:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800507:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  80050b:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800512:	00 00 00 
+  800515:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80051c:	00 00 00 
+  80051f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800523:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80052a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800531:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800538:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  80053f:	48 b8 4d 05 80 00 00 	movabs $0x80054d,%rax
+  800546:	00 00 00 
+  800549:	ff d0                	call   *%rax
+}
+  80054b:	c9                   	leave
+  80054c:	c3                   	ret
+
+000000000080054d <vprintfmt>:
+{
+  80054d:	55                   	push   %rbp
+  80054e:	48 89 e5             	mov    %rsp,%rbp
+  800551:	41 57                	push   %r15
+  800553:	41 56                	push   %r14
+  800555:	41 55                	push   %r13
+  800557:	41 54                	push   %r12
+  800559:	53                   	push   %rbx
+  80055a:	48 83 ec 48          	sub    $0x48,%rsp
+  80055e:	49 89 fe             	mov    %rdi,%r14
+  800561:	49 89 f5             	mov    %rsi,%r13
+  800564:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  800567:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  80056b:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  80056f:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800573:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  800577:	eb 09                	jmp    800582 <vprintfmt+0x35>
+			putch(ch, putdat);
+  800579:	4c 89 ee             	mov    %r13,%rsi
+  80057c:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80057f:	4c 89 e3             	mov    %r12,%rbx
+  800582:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800586:	0f b6 3b             	movzbl (%rbx),%edi
+  800589:	83 ff 25             	cmp    $0x25,%edi
+  80058c:	74 13                	je     8005a1 <vprintfmt+0x54>
+			if (ch == '\0')
+  80058e:	85 ff                	test   %edi,%edi
+  800590:	75 e7                	jne    800579 <vprintfmt+0x2c>
+}
+  800592:	48 83 c4 48          	add    $0x48,%rsp
+  800596:	5b                   	pop    %rbx
+  800597:	41 5c                	pop    %r12
+  800599:	41 5d                	pop    %r13
+  80059b:	41 5e                	pop    %r14
+  80059d:	41 5f                	pop    %r15
+  80059f:	5d                   	pop    %rbp
+  8005a0:	c3                   	ret
+		padc = ' ';
+  8005a1:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  8005a5:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  8005ac:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  8005b2:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  8005b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005be:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005c3:	41 0f b6 14 24       	movzbl (%r12),%edx
+  8005c8:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  8005cb:	3c 55                	cmp    $0x55,%al
+  8005cd:	0f 87 4f 05 00 00    	ja     800b22 <vprintfmt+0x5d5>
+  8005d3:	0f b6 c0             	movzbl %al,%eax
+  8005d6:	48 be e0 1f 80 00 00 	movabs $0x801fe0,%rsi
+  8005dd:	00 00 00 
+  8005e0:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  8005e3:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  8005e6:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  8005ea:	eb d2                	jmp    8005be <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005ec:	49 89 dc             	mov    %rbx,%r12
+  8005ef:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  8005f3:	eb c9                	jmp    8005be <vprintfmt+0x71>
+  8005f5:	0f b6 d2             	movzbl %dl,%edx
+  8005f8:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  8005fb:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  800601:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800605:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  80060a:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  80060f:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  800612:	83 f8 09             	cmp    $0x9,%eax
+  800615:	77 20                	ja     800637 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  800617:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  80061b:	eb e4                	jmp    800601 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  80061d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800620:	83 f8 2f             	cmp    $0x2f,%eax
+  800623:	77 27                	ja     80064c <vprintfmt+0xff>
+  800625:	89 c2                	mov    %eax,%edx
+  800627:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80062b:	83 c0 08             	add    $0x8,%eax
+  80062e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800631:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  800634:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  800637:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80063b:	79 81                	jns    8005be <vprintfmt+0x71>
+				width = precision, precision = -1;
+  80063d:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  800641:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800647:	e9 72 ff ff ff       	jmp    8005be <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  80064c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800650:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800654:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800658:	eb d7                	jmp    800631 <vprintfmt+0xe4>
+			if (width < 0)
+  80065a:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  80065d:	85 f6                	test   %esi,%esi
+  80065f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800664:	0f 49 c6             	cmovns %esi,%eax
+  800667:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80066a:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  80066d:	e9 4c ff ff ff       	jmp    8005be <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800672:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  800675:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  80067c:	e9 3d ff ff ff       	jmp    8005be <vprintfmt+0x71>
+			lflag++;
+  800681:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800684:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800687:	e9 32 ff ff ff       	jmp    8005be <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  80068c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80068f:	83 f8 2f             	cmp    $0x2f,%eax
+  800692:	77 19                	ja     8006ad <vprintfmt+0x160>
+  800694:	89 c2                	mov    %eax,%edx
+  800696:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80069a:	83 c0 08             	add    $0x8,%eax
+  80069d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006a0:	8b 3a                	mov    (%rdx),%edi
+  8006a2:	4c 89 ee             	mov    %r13,%rsi
+  8006a5:	41 ff d6             	call   *%r14
+			break;
+  8006a8:	e9 d5 fe ff ff       	jmp    800582 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  8006ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b9:	eb e5                	jmp    8006a0 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  8006bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006be:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c1:	77 5a                	ja     80071d <vprintfmt+0x1d0>
+  8006c3:	89 c2                	mov    %eax,%edx
+  8006c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c9:	83 c0 08             	add    $0x8,%eax
+  8006cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  8006cf:	8b 02                	mov    (%rdx),%eax
+  8006d1:	89 c1                	mov    %eax,%ecx
+  8006d3:	f7 d9                	neg    %ecx
+  8006d5:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006d8:	83 f9 08             	cmp    $0x8,%ecx
+  8006db:	7f 4e                	jg     80072b <vprintfmt+0x1de>
+  8006dd:	48 63 c1             	movslq %ecx,%rax
+  8006e0:	48 ba a0 22 80 00 00 	movabs $0x8022a0,%rdx
+  8006e7:	00 00 00 
+  8006ea:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006ee:	48 85 c0             	test   %rax,%rax
+  8006f1:	74 38                	je     80072b <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  8006f3:	48 89 c1             	mov    %rax,%rcx
+  8006f6:	48 ba 36 1f 80 00 00 	movabs $0x801f36,%rdx
+  8006fd:	00 00 00 
+  800700:	4c 89 ee             	mov    %r13,%rsi
+  800703:	4c 89 f7             	mov    %r14,%rdi
+  800706:	b8 00 00 00 00       	mov    $0x0,%eax
+  80070b:	49 b8 c7 04 80 00 00 	movabs $0x8004c7,%r8
+  800712:	00 00 00 
+  800715:	41 ff d0             	call   *%r8
+  800718:	e9 65 fe ff ff       	jmp    800582 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  80071d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800721:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800725:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800729:	eb a4                	jmp    8006cf <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  80072b:	48 ba 2d 1f 80 00 00 	movabs $0x801f2d,%rdx
+  800732:	00 00 00 
+  800735:	4c 89 ee             	mov    %r13,%rsi
+  800738:	4c 89 f7             	mov    %r14,%rdi
+  80073b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800740:	49 b8 c7 04 80 00 00 	movabs $0x8004c7,%r8
+  800747:	00 00 00 
+  80074a:	41 ff d0             	call   *%r8
+  80074d:	e9 30 fe ff ff       	jmp    800582 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800752:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800755:	83 f8 2f             	cmp    $0x2f,%eax
+  800758:	77 36                	ja     800790 <vprintfmt+0x243>
+  80075a:	89 c2                	mov    %eax,%edx
+  80075c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800760:	83 c0 08             	add    $0x8,%eax
+  800763:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800766:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800769:	48 85 c9             	test   %rcx,%rcx
+  80076c:	48 b8 26 1f 80 00 00 	movabs $0x801f26,%rax
+  800773:	00 00 00 
+  800776:	48 0f 45 c1          	cmovne %rcx,%rax
+  80077a:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  80077e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800782:	7e 06                	jle    80078a <vprintfmt+0x23d>
+  800784:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800788:	75 14                	jne    80079e <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80078a:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80078e:	eb 64                	jmp    8007f4 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800790:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800794:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800798:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80079c:	eb c8                	jmp    800766 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80079e:	49 63 f7             	movslq %r15d,%rsi
+  8007a1:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  8007a5:	48 b8 30 0c 80 00 00 	movabs $0x800c30,%rax
+  8007ac:	00 00 00 
+  8007af:	ff d0                	call   *%rax
+  8007b1:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007b4:	29 c1                	sub    %eax,%ecx
+  8007b6:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  8007b9:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  8007bc:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  8007c0:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007c3:	eb 0d                	jmp    8007d2 <vprintfmt+0x285>
+					putch(padc, putdat);
+  8007c5:	4c 89 ee             	mov    %r13,%rsi
+  8007c8:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  8007cb:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007ce:	41 83 ec 01          	sub    $0x1,%r12d
+  8007d2:	45 85 e4             	test   %r12d,%r12d
+  8007d5:	7f ee                	jg     8007c5 <vprintfmt+0x278>
+  8007d7:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  8007da:	85 c9                	test   %ecx,%ecx
+  8007dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e1:	0f 49 c1             	cmovns %ecx,%eax
+  8007e4:	29 c1                	sub    %eax,%ecx
+  8007e6:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  8007e9:	eb 9f                	jmp    80078a <vprintfmt+0x23d>
+					putch(ch, putdat);
+  8007eb:	4c 89 ee             	mov    %r13,%rsi
+  8007ee:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007f1:	4c 89 e2             	mov    %r12,%rdx
+  8007f4:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8007f8:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007fe:	0f be f8             	movsbl %al,%edi
+  800801:	85 ff                	test   %edi,%edi
+  800803:	74 29                	je     80082e <vprintfmt+0x2e1>
+  800805:	45 85 ff             	test   %r15d,%r15d
+  800808:	78 06                	js     800810 <vprintfmt+0x2c3>
+  80080a:	41 83 ef 01          	sub    $0x1,%r15d
+  80080e:	78 1e                	js     80082e <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800810:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800814:	74 d5                	je     8007eb <vprintfmt+0x29e>
+  800816:	0f be c0             	movsbl %al,%eax
+  800819:	83 e8 20             	sub    $0x20,%eax
+  80081c:	83 f8 5e             	cmp    $0x5e,%eax
+  80081f:	76 ca                	jbe    8007eb <vprintfmt+0x29e>
+					putch('?', putdat);
+  800821:	4c 89 ee             	mov    %r13,%rsi
+  800824:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800829:	41 ff d6             	call   *%r14
+  80082c:	eb c3                	jmp    8007f1 <vprintfmt+0x2a4>
+  80082e:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800832:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800835:	41 01 c4             	add    %eax,%r12d
+  800838:	41 29 d4             	sub    %edx,%r12d
+  80083b:	eb 0f                	jmp    80084c <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  80083d:	4c 89 ee             	mov    %r13,%rsi
+  800840:	bf 20 00 00 00       	mov    $0x20,%edi
+  800845:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800848:	41 83 ec 01          	sub    $0x1,%r12d
+  80084c:	45 85 e4             	test   %r12d,%r12d
+  80084f:	7f ec                	jg     80083d <vprintfmt+0x2f0>
+  800851:	e9 2c fd ff ff       	jmp    800582 <vprintfmt+0x35>
+	if (lflag >= 2)
+  800856:	83 f9 01             	cmp    $0x1,%ecx
+  800859:	7f 1d                	jg     800878 <vprintfmt+0x32b>
+	else if (lflag)
+  80085b:	85 c9                	test   %ecx,%ecx
+  80085d:	74 5e                	je     8008bd <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  80085f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800862:	83 f8 2f             	cmp    $0x2f,%eax
+  800865:	77 48                	ja     8008af <vprintfmt+0x362>
+  800867:	89 c2                	mov    %eax,%edx
+  800869:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086d:	83 c0 08             	add    $0x8,%eax
+  800870:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800873:	4c 8b 22             	mov    (%rdx),%r12
+  800876:	eb 17                	jmp    80088f <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800878:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087b:	83 f8 2f             	cmp    $0x2f,%eax
+  80087e:	77 21                	ja     8008a1 <vprintfmt+0x354>
+  800880:	89 c2                	mov    %eax,%edx
+  800882:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800886:	83 c0 08             	add    $0x8,%eax
+  800889:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088c:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  80088f:	4d 85 e4             	test   %r12,%r12
+  800892:	78 50                	js     8008e4 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  800894:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800897:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80089c:	e9 b4 01 00 00       	jmp    800a55 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  8008a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ad:	eb dd                	jmp    80088c <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  8008af:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008bb:	eb b6                	jmp    800873 <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  8008bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c3:	77 11                	ja     8008d6 <vprintfmt+0x389>
+  8008c5:	89 c2                	mov    %eax,%edx
+  8008c7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008cb:	83 c0 08             	add    $0x8,%eax
+  8008ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d1:	4c 63 22             	movslq (%rdx),%r12
+  8008d4:	eb b9                	jmp    80088f <vprintfmt+0x342>
+  8008d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e2:	eb ed                	jmp    8008d1 <vprintfmt+0x384>
+				putch('-', putdat);
+  8008e4:	4c 89 ee             	mov    %r13,%rsi
+  8008e7:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008ec:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  8008ef:	4c 89 e2             	mov    %r12,%rdx
+  8008f2:	48 f7 da             	neg    %rdx
+			base = 10;
+  8008f5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8008fa:	e9 56 01 00 00       	jmp    800a55 <vprintfmt+0x508>
+	if (lflag >= 2)
+  8008ff:	83 f9 01             	cmp    $0x1,%ecx
+  800902:	7f 25                	jg     800929 <vprintfmt+0x3dc>
+	else if (lflag)
+  800904:	85 c9                	test   %ecx,%ecx
+  800906:	74 5e                	je     800966 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800908:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090b:	83 f8 2f             	cmp    $0x2f,%eax
+  80090e:	77 48                	ja     800958 <vprintfmt+0x40b>
+  800910:	89 c2                	mov    %eax,%edx
+  800912:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800916:	83 c0 08             	add    $0x8,%eax
+  800919:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091c:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  80091f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800924:	e9 2c 01 00 00       	jmp    800a55 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800929:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092c:	83 f8 2f             	cmp    $0x2f,%eax
+  80092f:	77 19                	ja     80094a <vprintfmt+0x3fd>
+  800931:	89 c2                	mov    %eax,%edx
+  800933:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800937:	83 c0 08             	add    $0x8,%eax
+  80093a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093d:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800940:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800945:	e9 0b 01 00 00       	jmp    800a55 <vprintfmt+0x508>
+  80094a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80094e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800952:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800956:	eb e5                	jmp    80093d <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800958:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800960:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800964:	eb b6                	jmp    80091c <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800966:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800969:	83 f8 2f             	cmp    $0x2f,%eax
+  80096c:	77 18                	ja     800986 <vprintfmt+0x439>
+  80096e:	89 c2                	mov    %eax,%edx
+  800970:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800974:	83 c0 08             	add    $0x8,%eax
+  800977:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097a:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  80097c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800981:	e9 cf 00 00 00       	jmp    800a55 <vprintfmt+0x508>
+  800986:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80098a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800992:	eb e6                	jmp    80097a <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800994:	83 f9 01             	cmp    $0x1,%ecx
+  800997:	7f 25                	jg     8009be <vprintfmt+0x471>
+	else if (lflag)
+  800999:	85 c9                	test   %ecx,%ecx
+  80099b:	74 5b                	je     8009f8 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  80099d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a3:	77 45                	ja     8009ea <vprintfmt+0x49d>
+  8009a5:	89 c2                	mov    %eax,%edx
+  8009a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ab:	83 c0 08             	add    $0x8,%eax
+  8009ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b1:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  8009b4:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  8009b9:	e9 97 00 00 00       	jmp    800a55 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8009be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c4:	77 16                	ja     8009dc <vprintfmt+0x48f>
+  8009c6:	89 c2                	mov    %eax,%edx
+  8009c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cc:	83 c0 08             	add    $0x8,%eax
+  8009cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d2:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  8009d5:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  8009da:	eb 79                	jmp    800a55 <vprintfmt+0x508>
+  8009dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e8:	eb e8                	jmp    8009d2 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  8009ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f6:	eb b9                	jmp    8009b1 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  8009f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fe:	77 15                	ja     800a15 <vprintfmt+0x4c8>
+  800a00:	89 c2                	mov    %eax,%edx
+  800a02:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a06:	83 c0 08             	add    $0x8,%eax
+  800a09:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0c:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800a0e:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800a13:	eb 40                	jmp    800a55 <vprintfmt+0x508>
+  800a15:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a19:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a21:	eb e9                	jmp    800a0c <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800a23:	4c 89 ee             	mov    %r13,%rsi
+  800a26:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a2b:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800a2e:	4c 89 ee             	mov    %r13,%rsi
+  800a31:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a36:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800a39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a3c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3f:	77 34                	ja     800a75 <vprintfmt+0x528>
+  800a41:	89 c2                	mov    %eax,%edx
+  800a43:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a47:	83 c0 08             	add    $0x8,%eax
+  800a4a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800a4d:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800a50:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800a55:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800a5a:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a5e:	4c 89 ee             	mov    %r13,%rsi
+  800a61:	4c 89 f7             	mov    %r14,%rdi
+  800a64:	48 b8 27 04 80 00 00 	movabs $0x800427,%rax
+  800a6b:	00 00 00 
+  800a6e:	ff d0                	call   *%rax
+			break;
+  800a70:	e9 0d fb ff ff       	jmp    800582 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800a75:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a79:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a81:	eb ca                	jmp    800a4d <vprintfmt+0x500>
+	if (lflag >= 2)
+  800a83:	83 f9 01             	cmp    $0x1,%ecx
+  800a86:	7f 22                	jg     800aaa <vprintfmt+0x55d>
+	else if (lflag)
+  800a88:	85 c9                	test   %ecx,%ecx
+  800a8a:	74 58                	je     800ae4 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800a8c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a92:	77 42                	ja     800ad6 <vprintfmt+0x589>
+  800a94:	89 c2                	mov    %eax,%edx
+  800a96:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9a:	83 c0 08             	add    $0x8,%eax
+  800a9d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa0:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800aa3:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800aa8:	eb ab                	jmp    800a55 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800aaa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aad:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab0:	77 16                	ja     800ac8 <vprintfmt+0x57b>
+  800ab2:	89 c2                	mov    %eax,%edx
+  800ab4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab8:	83 c0 08             	add    $0x8,%eax
+  800abb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abe:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800ac1:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800ac6:	eb 8d                	jmp    800a55 <vprintfmt+0x508>
+  800ac8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800acc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad4:	eb e8                	jmp    800abe <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800ad6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ada:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ade:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae2:	eb bc                	jmp    800aa0 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800ae4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae7:	83 f8 2f             	cmp    $0x2f,%eax
+  800aea:	77 18                	ja     800b04 <vprintfmt+0x5b7>
+  800aec:	89 c2                	mov    %eax,%edx
+  800aee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af2:	83 c0 08             	add    $0x8,%eax
+  800af5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af8:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800afa:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800aff:	e9 51 ff ff ff       	jmp    800a55 <vprintfmt+0x508>
+  800b04:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b08:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b0c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b10:	eb e6                	jmp    800af8 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800b12:	4c 89 ee             	mov    %r13,%rsi
+  800b15:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b1a:	41 ff d6             	call   *%r14
+			break;
+  800b1d:	e9 60 fa ff ff       	jmp    800582 <vprintfmt+0x35>
+			putch('%', putdat);
+  800b22:	4c 89 ee             	mov    %r13,%rsi
+  800b25:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b2a:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b2d:	4c 89 e3             	mov    %r12,%rbx
+  800b30:	eb 04                	jmp    800b36 <vprintfmt+0x5e9>
+  800b32:	48 83 eb 01          	sub    $0x1,%rbx
+  800b36:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b3a:	75 f6                	jne    800b32 <vprintfmt+0x5e5>
+  800b3c:	e9 41 fa ff ff       	jmp    800582 <vprintfmt+0x35>
+
+0000000000800b41 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b41:	55                   	push   %rbp
+  800b42:	48 89 e5             	mov    %rsp,%rbp
+  800b45:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b49:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800b4d:	48 63 c6             	movslq %esi,%rax
+  800b50:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800b55:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800b59:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800b60:	48 85 ff             	test   %rdi,%rdi
+  800b63:	74 2a                	je     800b8f <vsnprintf+0x4e>
+  800b65:	85 f6                	test   %esi,%esi
+  800b67:	7e 26                	jle    800b8f <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b69:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800b6d:	48 bf af 04 80 00 00 	movabs $0x8004af,%rdi
+  800b74:	00 00 00 
+  800b77:	48 b8 4d 05 80 00 00 	movabs $0x80054d,%rax
+  800b7e:	00 00 00 
+  800b81:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b83:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800b87:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800b8a:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800b8d:	c9                   	leave
+  800b8e:	c3                   	ret
+		return -E_INVAL;
+  800b8f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b94:	eb f7                	jmp    800b8d <vsnprintf+0x4c>
+
+0000000000800b96 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b96:	55                   	push   %rbp
+  800b97:	48 89 e5             	mov    %rsp,%rbp
+  800b9a:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800ba1:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800ba8:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800baf:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800bb6:	84 c0                	test   %al,%al
+  800bb8:	74 20                	je     800bda <snprintf+0x44>
+  800bba:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800bbe:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800bc2:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800bc6:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800bca:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800bce:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800bd2:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800bd6:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800bda:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800be1:	00 00 00 
+  800be4:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800beb:	00 00 00 
+  800bee:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bf2:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800bf9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800c00:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800c07:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800c0e:	48 b8 41 0b 80 00 00 	movabs $0x800b41,%rax
+  800c15:	00 00 00 
+  800c18:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800c1a:	c9                   	leave
+  800c1b:	c3                   	ret
+
+0000000000800c1c <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800c1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c21:	48 89 d0             	mov    %rdx,%rax
+  800c24:	48 83 c2 01          	add    $0x1,%rdx
+  800c28:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800c2d:	75 f2                	jne    800c21 <strlen+0x5>
+		n++;
+	return n;
+}
+  800c2f:	c3                   	ret
+
+0000000000800c30 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c30:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c35:	eb 03                	jmp    800c3a <strnlen+0xa>
+  800c37:	48 89 d0             	mov    %rdx,%rax
+  800c3a:	48 39 c6             	cmp    %rax,%rsi
+  800c3d:	74 0a                	je     800c49 <strnlen+0x19>
+  800c3f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c43:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c47:	75 ee                	jne    800c37 <strnlen+0x7>
+		n++;
+	return n;
+}
+  800c49:	c3                   	ret
+
+0000000000800c4a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800c4a:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800c4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c52:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c56:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c59:	48 83 c2 01          	add    $0x1,%rdx
+  800c5d:	84 c9                	test   %cl,%cl
+  800c5f:	75 f1                	jne    800c52 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800c61:	c3                   	ret
+
+0000000000800c62 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c62:	55                   	push   %rbp
+  800c63:	48 89 e5             	mov    %rsp,%rbp
+  800c66:	41 54                	push   %r12
+  800c68:	53                   	push   %rbx
+  800c69:	48 89 fb             	mov    %rdi,%rbx
+  800c6c:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800c6f:	48 b8 1c 0c 80 00 00 	movabs $0x800c1c,%rax
+  800c76:	00 00 00 
+  800c79:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800c7b:	48 63 f8             	movslq %eax,%rdi
+  800c7e:	48 01 df             	add    %rbx,%rdi
+  800c81:	4c 89 e6             	mov    %r12,%rsi
+  800c84:	48 b8 4a 0c 80 00 00 	movabs $0x800c4a,%rax
+  800c8b:	00 00 00 
+  800c8e:	ff d0                	call   *%rax
+	return dst;
+}
+  800c90:	48 89 d8             	mov    %rbx,%rax
+  800c93:	5b                   	pop    %rbx
+  800c94:	41 5c                	pop    %r12
+  800c96:	5d                   	pop    %rbp
+  800c97:	c3                   	ret
+
+0000000000800c98 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c98:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c9b:	48 01 fa             	add    %rdi,%rdx
+  800c9e:	48 89 f9             	mov    %rdi,%rcx
+  800ca1:	eb 14                	jmp    800cb7 <strncpy+0x1f>
+		*dst++ = *src;
+  800ca3:	48 83 c1 01          	add    $0x1,%rcx
+  800ca7:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800cab:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800caf:	41 80 f8 01          	cmp    $0x1,%r8b
+  800cb3:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800cb7:	48 39 d1             	cmp    %rdx,%rcx
+  800cba:	75 e7                	jne    800ca3 <strncpy+0xb>
+	}
+	return ret;
+}
+  800cbc:	c3                   	ret
+
+0000000000800cbd <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800cbd:	48 89 f8             	mov    %rdi,%rax
+  800cc0:	48 85 d2             	test   %rdx,%rdx
+  800cc3:	74 27                	je     800cec <strlcpy+0x2f>
+  800cc5:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800cca:	48 89 fa             	mov    %rdi,%rdx
+  800ccd:	eb 0b                	jmp    800cda <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800ccf:	48 83 c6 01          	add    $0x1,%rsi
+  800cd3:	48 83 c2 01          	add    $0x1,%rdx
+  800cd7:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800cda:	48 39 c2             	cmp    %rax,%rdx
+  800cdd:	74 0a                	je     800ce9 <strlcpy+0x2c>
+  800cdf:	0f b6 0e             	movzbl (%rsi),%ecx
+  800ce2:	84 c9                	test   %cl,%cl
+  800ce4:	75 e9                	jne    800ccf <strlcpy+0x12>
+  800ce6:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800ce9:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800cec:	48 29 f8             	sub    %rdi,%rax
+}
+  800cef:	c3                   	ret
+
+0000000000800cf0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800cf0:	eb 08                	jmp    800cfa <strcmp+0xa>
+		p++, q++;
+  800cf2:	48 83 c7 01          	add    $0x1,%rdi
+  800cf6:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800cfa:	0f b6 07             	movzbl (%rdi),%eax
+  800cfd:	84 c0                	test   %al,%al
+  800cff:	74 04                	je     800d05 <strcmp+0x15>
+  800d01:	3a 06                	cmp    (%rsi),%al
+  800d03:	74 ed                	je     800cf2 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d05:	0f b6 c0             	movzbl %al,%eax
+  800d08:	0f b6 16             	movzbl (%rsi),%edx
+  800d0b:	29 d0                	sub    %edx,%eax
+}
+  800d0d:	c3                   	ret
+
+0000000000800d0e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800d0e:	eb 0c                	jmp    800d1c <strncmp+0xe>
+		n--, p++, q++;
+  800d10:	48 83 ea 01          	sub    $0x1,%rdx
+  800d14:	48 83 c7 01          	add    $0x1,%rdi
+  800d18:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800d1c:	48 85 d2             	test   %rdx,%rdx
+  800d1f:	74 14                	je     800d35 <strncmp+0x27>
+  800d21:	0f b6 07             	movzbl (%rdi),%eax
+  800d24:	84 c0                	test   %al,%al
+  800d26:	74 04                	je     800d2c <strncmp+0x1e>
+  800d28:	3a 06                	cmp    (%rsi),%al
+  800d2a:	74 e4                	je     800d10 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d2c:	0f b6 07             	movzbl (%rdi),%eax
+  800d2f:	0f b6 16             	movzbl (%rsi),%edx
+  800d32:	29 d0                	sub    %edx,%eax
+}
+  800d34:	c3                   	ret
+		return 0;
+  800d35:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d3a:	c3                   	ret
+
+0000000000800d3b <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800d3b:	eb 04                	jmp    800d41 <strchr+0x6>
+  800d3d:	48 83 c7 01          	add    $0x1,%rdi
+  800d41:	0f b6 07             	movzbl (%rdi),%eax
+  800d44:	84 c0                	test   %al,%al
+  800d46:	74 09                	je     800d51 <strchr+0x16>
+		if (*s == c)
+  800d48:	40 38 f0             	cmp    %sil,%al
+  800d4b:	75 f0                	jne    800d3d <strchr+0x2>
+  800d4d:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800d50:	c3                   	ret
+	return 0;
+  800d51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d56:	c3                   	ret
+
+0000000000800d57 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d57:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800d5a:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800d5d:	40 38 f2             	cmp    %sil,%dl
+  800d60:	74 0a                	je     800d6c <strfind+0x15>
+  800d62:	84 d2                	test   %dl,%dl
+  800d64:	74 06                	je     800d6c <strfind+0x15>
+	for (; *s; s++)
+  800d66:	48 83 c0 01          	add    $0x1,%rax
+  800d6a:	eb ee                	jmp    800d5a <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800d6c:	c3                   	ret
+
+0000000000800d6d <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800d6d:	48 85 d2             	test   %rdx,%rdx
+  800d70:	74 28                	je     800d9a <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800d72:	48 89 f8             	mov    %rdi,%rax
+  800d75:	48 09 d0             	or     %rdx,%rax
+  800d78:	a8 03                	test   $0x3,%al
+  800d7a:	75 16                	jne    800d92 <memset+0x25>
+		c &= 0xFF;
+  800d7c:	40 0f b6 f6          	movzbl %sil,%esi
+  800d80:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d86:	48 89 d1             	mov    %rdx,%rcx
+  800d89:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800d8d:	fc                   	cld
+  800d8e:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800d90:	eb 08                	jmp    800d9a <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d92:	89 f0                	mov    %esi,%eax
+  800d94:	48 89 d1             	mov    %rdx,%rcx
+  800d97:	fc                   	cld
+  800d98:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d9a:	48 89 f8             	mov    %rdi,%rax
+  800d9d:	c3                   	ret
+
+0000000000800d9e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d9e:	48 89 f8             	mov    %rdi,%rax
+  800da1:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800da4:	48 39 fe             	cmp    %rdi,%rsi
+  800da7:	73 3a                	jae    800de3 <memmove+0x45>
+  800da9:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800dad:	48 39 d7             	cmp    %rdx,%rdi
+  800db0:	73 31                	jae    800de3 <memmove+0x45>
+		s += n;
+		d += n;
+  800db2:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800db6:	48 89 d6             	mov    %rdx,%rsi
+  800db9:	48 09 fe             	or     %rdi,%rsi
+  800dbc:	48 09 ce             	or     %rcx,%rsi
+  800dbf:	40 f6 c6 03          	test   $0x3,%sil
+  800dc3:	75 11                	jne    800dd6 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800dc5:	48 83 ef 04          	sub    $0x4,%rdi
+  800dc9:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800dcd:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800dd1:	fd                   	std
+  800dd2:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800dd4:	eb 0b                	jmp    800de1 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800dd6:	48 83 ef 01          	sub    $0x1,%rdi
+  800dda:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800dde:	fd                   	std
+  800ddf:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800de1:	fc                   	cld
+  800de2:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800de3:	48 89 f2             	mov    %rsi,%rdx
+  800de6:	48 09 c2             	or     %rax,%rdx
+  800de9:	48 09 ca             	or     %rcx,%rdx
+  800dec:	f6 c2 03             	test   $0x3,%dl
+  800def:	75 0b                	jne    800dfc <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800df1:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800df5:	48 89 c7             	mov    %rax,%rdi
+  800df8:	fc                   	cld
+  800df9:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800dfb:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800dfc:	48 89 c7             	mov    %rax,%rdi
+  800dff:	fc                   	cld
+  800e00:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800e02:	c3                   	ret
+
+0000000000800e03 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800e03:	55                   	push   %rbp
+  800e04:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800e07:	48 b8 9e 0d 80 00 00 	movabs $0x800d9e,%rax
+  800e0e:	00 00 00 
+  800e11:	ff d0                	call   *%rax
+}
+  800e13:	5d                   	pop    %rbp
+  800e14:	c3                   	ret
+
+0000000000800e15 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800e15:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1a:	48 39 c2             	cmp    %rax,%rdx
+  800e1d:	74 1e                	je     800e3d <memcmp+0x28>
+		if (*s1 != *s2)
+  800e1f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e23:	48 83 c0 01          	add    $0x1,%rax
+  800e27:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800e2d:	44 38 c1             	cmp    %r8b,%cl
+  800e30:	74 e8                	je     800e1a <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800e32:	0f b6 c1             	movzbl %cl,%eax
+  800e35:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e39:	44 29 c0             	sub    %r8d,%eax
+  800e3c:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800e3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e42:	c3                   	ret
+
+0000000000800e43 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e43:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800e46:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800e49:	eb 04                	jmp    800e4f <memfind+0xc>
+  800e4b:	48 83 c0 01          	add    $0x1,%rax
+  800e4f:	48 39 d0             	cmp    %rdx,%rax
+  800e52:	73 05                	jae    800e59 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e54:	40 38 30             	cmp    %sil,(%rax)
+  800e57:	75 f2                	jne    800e4b <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800e59:	c3                   	ret
+
+0000000000800e5a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e5a:	48 89 f9             	mov    %rdi,%rcx
+  800e5d:	49 89 f0             	mov    %rsi,%r8
+  800e60:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e62:	eb 04                	jmp    800e68 <strtol+0xe>
+		s++;
+  800e64:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800e68:	0f b6 01             	movzbl (%rcx),%eax
+  800e6b:	3c 20                	cmp    $0x20,%al
+  800e6d:	74 f5                	je     800e64 <strtol+0xa>
+  800e6f:	3c 09                	cmp    $0x9,%al
+  800e71:	74 f1                	je     800e64 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e73:	3c 2b                	cmp    $0x2b,%al
+  800e75:	74 2b                	je     800ea2 <strtol+0x48>
+	int neg = 0;
+  800e77:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800e7d:	3c 2d                	cmp    $0x2d,%al
+  800e7f:	74 2d                	je     800eae <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e81:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800e87:	75 0f                	jne    800e98 <strtol+0x3e>
+  800e89:	80 39 30             	cmpb   $0x30,(%rcx)
+  800e8c:	74 2c                	je     800eba <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e8e:	85 ff                	test   %edi,%edi
+  800e90:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e95:	0f 44 f8             	cmove  %eax,%edi
+  800e98:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800e9d:	4c 63 d7             	movslq %edi,%r10
+  800ea0:	eb 4f                	jmp    800ef1 <strtol+0x97>
+		s++;
+  800ea2:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800ea6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800eac:	eb d3                	jmp    800e81 <strtol+0x27>
+		s++, neg = 1;
+  800eae:	48 83 c1 01          	add    $0x1,%rcx
+  800eb2:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800eb8:	eb c7                	jmp    800e81 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800eba:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800ebe:	74 0f                	je     800ecf <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800ec0:	85 ff                	test   %edi,%edi
+  800ec2:	75 d4                	jne    800e98 <strtol+0x3e>
+		s++, base = 8;
+  800ec4:	48 83 c1 01          	add    $0x1,%rcx
+  800ec8:	bf 08 00 00 00       	mov    $0x8,%edi
+  800ecd:	eb c9                	jmp    800e98 <strtol+0x3e>
+		s += 2, base = 16;
+  800ecf:	48 83 c1 02          	add    $0x2,%rcx
+  800ed3:	bf 10 00 00 00       	mov    $0x10,%edi
+  800ed8:	eb be                	jmp    800e98 <strtol+0x3e>
+			dig = *s - '0';
+  800eda:	0f be c0             	movsbl %al,%eax
+  800edd:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800ee0:	39 f8                	cmp    %edi,%eax
+  800ee2:	7d 3b                	jge    800f1f <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800ee4:	48 83 c1 01          	add    $0x1,%rcx
+  800ee8:	49 0f af d2          	imul   %r10,%rdx
+  800eec:	48 98                	cltq
+  800eee:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800ef1:	0f b6 01             	movzbl (%rcx),%eax
+  800ef4:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800ef7:	40 80 fe 09          	cmp    $0x9,%sil
+  800efb:	76 dd                	jbe    800eda <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800efd:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800f00:	40 80 fe 19          	cmp    $0x19,%sil
+  800f04:	77 08                	ja     800f0e <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800f06:	0f be c0             	movsbl %al,%eax
+  800f09:	83 e8 57             	sub    $0x57,%eax
+  800f0c:	eb d2                	jmp    800ee0 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f0e:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800f11:	40 80 fe 19          	cmp    $0x19,%sil
+  800f15:	77 08                	ja     800f1f <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800f17:	0f be c0             	movsbl %al,%eax
+  800f1a:	83 e8 37             	sub    $0x37,%eax
+  800f1d:	eb c1                	jmp    800ee0 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800f1f:	4d 85 c0             	test   %r8,%r8
+  800f22:	74 03                	je     800f27 <strtol+0xcd>
+		*endptr = (char *) s;
+  800f24:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800f27:	48 89 d0             	mov    %rdx,%rax
+  800f2a:	48 f7 d8             	neg    %rax
+  800f2d:	45 85 c9             	test   %r9d,%r9d
+  800f30:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800f34:	48 89 d0             	mov    %rdx,%rax
+  800f37:	c3                   	ret
+
+0000000000800f38 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800f38:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f3e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800f44:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f4e:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800f50:	c3                   	ret
+
+0000000000800f51 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800f51:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f57:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f62:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f67:	48 89 fe             	mov    %rdi,%rsi
+  800f6a:	48 89 fa             	mov    %rdi,%rdx
+  800f6d:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f6f:	c3                   	ret
+
+0000000000800f70 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800f70:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800f73:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f79:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f7f:	be 00 00 00 00       	mov    $0x0,%esi
+  800f84:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f89:	48 89 f2             	mov    %rsi,%rdx
+  800f8c:	0f 05                	syscall
+	if(check && ret > 0)
+  800f8e:	48 85 c0             	test   %rax,%rax
+  800f91:	7f 01                	jg     800f94 <sys_env_destroy+0x24>
+}
+  800f93:	c3                   	ret
+{
+  800f94:	55                   	push   %rbp
+  800f95:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f98:	49 89 c0             	mov    %rax,%r8
+  800f9b:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fa0:	48 ba e8 22 80 00 00 	movabs $0x8022e8,%rdx
+  800fa7:	00 00 00 
+  800faa:	be 28 00 00 00       	mov    $0x28,%esi
+  800faf:	48 bf 05 23 80 00 00 	movabs $0x802305,%rdi
+  800fb6:	00 00 00 
+  800fb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fbe:	49 b9 f4 01 80 00 00 	movabs $0x8001f4,%r9
+  800fc5:	00 00 00 
+  800fc8:	41 ff d1             	call   *%r9
+
+0000000000800fcb <sys_getenvid>:
+  800fcb:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800fd2:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800fd3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800fd8:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800fdc:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800fe0:	48 c1 e2 04          	shl    $0x4,%rdx
+  800fe4:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800feb:	00 00 00 
+  800fee:	48 01 d0             	add    %rdx,%rax
+  800ff1:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800ff7:	c3                   	ret
+
+0000000000800ff8 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800ff8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800ffe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801004:	bf 00 00 00 00       	mov    $0x0,%edi
+  801009:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80100e:	48 89 fe             	mov    %rdi,%rsi
+  801011:	48 89 fa             	mov    %rdi,%rdx
+  801014:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801016:	c3                   	ret
+
+0000000000801017 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  801017:	48 63 d2             	movslq %edx,%rdx
+  80101a:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80101d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801023:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801029:	b8 04 00 00 00       	mov    $0x4,%eax
+  80102e:	0f 05                	syscall
+	if(check && ret > 0)
+  801030:	48 85 c0             	test   %rax,%rax
+  801033:	7f 01                	jg     801036 <sys_page_alloc+0x1f>
+}
+  801035:	c3                   	ret
+{
+  801036:	55                   	push   %rbp
+  801037:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80103a:	49 89 c0             	mov    %rax,%r8
+  80103d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801042:	48 ba e8 22 80 00 00 	movabs $0x8022e8,%rdx
+  801049:	00 00 00 
+  80104c:	be 28 00 00 00       	mov    $0x28,%esi
+  801051:	48 bf 05 23 80 00 00 	movabs $0x802305,%rdi
+  801058:	00 00 00 
+  80105b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801060:	49 b9 f4 01 80 00 00 	movabs $0x8001f4,%r9
+  801067:	00 00 00 
+  80106a:	41 ff d1             	call   *%r9
+
+000000000080106d <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  80106d:	48 63 d2             	movslq %edx,%rdx
+  801070:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801073:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801079:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80107f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801084:	0f 05                	syscall
+	if(check && ret > 0)
+  801086:	48 85 c0             	test   %rax,%rax
+  801089:	7f 01                	jg     80108c <sys_page_alloc_huge+0x1f>
+}
+  80108b:	c3                   	ret
+{
+  80108c:	55                   	push   %rbp
+  80108d:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801090:	49 89 c0             	mov    %rax,%r8
+  801093:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801098:	48 ba e8 22 80 00 00 	movabs $0x8022e8,%rdx
+  80109f:	00 00 00 
+  8010a2:	be 28 00 00 00       	mov    $0x28,%esi
+  8010a7:	48 bf 05 23 80 00 00 	movabs $0x802305,%rdi
+  8010ae:	00 00 00 
+  8010b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b6:	49 b9 f4 01 80 00 00 	movabs $0x8001f4,%r9
+  8010bd:	00 00 00 
+  8010c0:	41 ff d1             	call   *%r9
+
+00000000008010c3 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8010c3:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  8010c6:	48 63 d2             	movslq %edx,%rdx
+  8010c9:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  8010cc:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  8010cf:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010d4:	0f 05                	syscall
+	if(check && ret > 0)
+  8010d6:	48 85 c0             	test   %rax,%rax
+  8010d9:	7f 01                	jg     8010dc <sys_page_map+0x19>
+}
+  8010db:	c3                   	ret
+{
+  8010dc:	55                   	push   %rbp
+  8010dd:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e0:	49 89 c0             	mov    %rax,%r8
+  8010e3:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8010e8:	48 ba e8 22 80 00 00 	movabs $0x8022e8,%rdx
+  8010ef:	00 00 00 
+  8010f2:	be 28 00 00 00       	mov    $0x28,%esi
+  8010f7:	48 bf 05 23 80 00 00 	movabs $0x802305,%rdi
+  8010fe:	00 00 00 
+  801101:	b8 00 00 00 00       	mov    $0x0,%eax
+  801106:	49 b9 f4 01 80 00 00 	movabs $0x8001f4,%r9
+  80110d:	00 00 00 
+  801110:	41 ff d1             	call   *%r9
+
+0000000000801113 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  801113:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801116:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80111c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801122:	ba 00 00 00 00       	mov    $0x0,%edx
+  801127:	b8 06 00 00 00       	mov    $0x6,%eax
+  80112c:	0f 05                	syscall
+	if(check && ret > 0)
+  80112e:	48 85 c0             	test   %rax,%rax
+  801131:	7f 01                	jg     801134 <sys_page_unmap+0x21>
+}
+  801133:	c3                   	ret
+{
+  801134:	55                   	push   %rbp
+  801135:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801138:	49 89 c0             	mov    %rax,%r8
+  80113b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801140:	48 ba e8 22 80 00 00 	movabs $0x8022e8,%rdx
+  801147:	00 00 00 
+  80114a:	be 28 00 00 00       	mov    $0x28,%esi
+  80114f:	48 bf 05 23 80 00 00 	movabs $0x802305,%rdi
+  801156:	00 00 00 
+  801159:	b8 00 00 00 00       	mov    $0x0,%eax
+  80115e:	49 b9 f4 01 80 00 00 	movabs $0x8001f4,%r9
+  801165:	00 00 00 
+  801168:	41 ff d1             	call   *%r9
+
+000000000080116b <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  80116b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801171:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801177:	bf 00 00 00 00       	mov    $0x0,%edi
+  80117c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801181:	48 89 fe             	mov    %rdi,%rsi
+  801184:	48 89 fa             	mov    %rdi,%rdx
+  801187:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801189:	c3                   	ret
+
+000000000080118a <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  80118a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801190:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801196:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119b:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011a0:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  8011a2:	c3                   	ret
+
+00000000008011a3 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  8011a3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011af:	b8 11 00 00 00       	mov    $0x11,%eax
+  8011b4:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  8011b6:	c3                   	ret
+
+00000000008011b7 <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  8011b7:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  8011ba:	48 63 f6             	movslq %esi,%rsi
+  8011bd:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  8011c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011c6:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011cb:	0f 05                	syscall
+	if(check && ret > 0)
+  8011cd:	48 85 c0             	test   %rax,%rax
+  8011d0:	7f 01                	jg     8011d3 <sys_page_batch+0x1c>
+}
+  8011d2:	c3                   	ret
+{
+  8011d3:	55                   	push   %rbp
+  8011d4:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011d7:	49 89 c0             	mov    %rax,%r8
+  8011da:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8011df:	48 ba e8 22 80 00 00 	movabs $0x8022e8,%rdx
+  8011e6:	00 00 00 
+  8011e9:	be 28 00 00 00       	mov    $0x28,%esi
+  8011ee:	48 bf 05 23 80 00 00 	movabs $0x802305,%rdi
+  8011f5:	00 00 00 
+  8011f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011fd:	49 b9 f4 01 80 00 00 	movabs $0x8001f4,%r9
+  801204:	00 00 00 
+  801207:	41 ff d1             	call   *%r9
+
+000000000080120a <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  80120a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801210:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801216:	be 00 00 00 00       	mov    $0x0,%esi
+  80121b:	b8 13 00 00 00       	mov    $0x13,%eax
+  801220:	48 89 f2             	mov    %rsi,%rdx
+  801223:	0f 05                	syscall
+	if(check && ret > 0)
+  801225:	48 85 c0             	test   %rax,%rax
+  801228:	7f 01                	jg     80122b <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  80122a:	c3                   	ret
+{
+  80122b:	55                   	push   %rbp
+  80122c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80122f:	49 89 c0             	mov    %rax,%r8
+  801232:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801237:	48 ba e8 22 80 00 00 	movabs $0x8022e8,%rdx
+  80123e:	00 00 00 
+  801241:	be 28 00 00 00       	mov    $0x28,%esi
+  801246:	48 bf 05 23 80 00 00 	movabs $0x802305,%rdi
+  80124d:	00 00 00 
+  801250:	b8 00 00 00 00       	mov    $0x0,%eax
+  801255:	49 b9 f4 01 80 00 00 	movabs $0x8001f4,%r9
+  80125c:	00 00 00 
+  80125f:	41 ff d1             	call   *%r9
+
+0000000000801262 <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  801262:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801268:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80126e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801273:	b8 14 00 00 00       	mov    $0x14,%eax
+  801278:	48 89 fe             	mov    %rdi,%rsi
+  80127b:	48 89 fa             	mov    %rdi,%rdx
+  80127e:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801280:	c3                   	ret
+
+0000000000801281 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  801281:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801284:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80128a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801290:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801295:	0f 05                	syscall
+	if(check && ret > 0)
+  801297:	48 85 c0             	test   %rax,%rax
+  80129a:	7f 01                	jg     80129d <sys_page_unmap_range+0x1c>
+}
+  80129c:	c3                   	ret
+{
+  80129d:	55                   	push   %rbp
+  80129e:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012a1:	49 89 c0             	mov    %rax,%r8
+  8012a4:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8012a9:	48 ba e8 22 80 00 00 	movabs $0x8022e8,%rdx
+  8012b0:	00 00 00 
+  8012b3:	be 28 00 00 00       	mov    $0x28,%esi
+  8012b8:	48 bf 05 23 80 00 00 	movabs $0x802305,%rdi
+  8012bf:	00 00 00 
+  8012c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c7:	49 b9 f4 01 80 00 00 	movabs $0x8001f4,%r9
+  8012ce:	00 00 00 
+  8012d1:	41 ff d1             	call   *%r9
+
+00000000008012d4 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8012d4:	48 63 f6             	movslq %esi,%rsi
+  8012d7:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8012da:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8012e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8012e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012eb:	b8 08 00 00 00       	mov    $0x8,%eax
+  8012f0:	0f 05                	syscall
+	if(check && ret > 0)
+  8012f2:	48 85 c0             	test   %rax,%rax
+  8012f5:	7f 01                	jg     8012f8 <sys_env_set_status+0x24>
+}
+  8012f7:	c3                   	ret
+{
+  8012f8:	55                   	push   %rbp
+  8012f9:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012fc:	49 89 c0             	mov    %rax,%r8
+  8012ff:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801304:	48 ba e8 22 80 00 00 	movabs $0x8022e8,%rdx
+  80130b:	00 00 00 
+  80130e:	be 28 00 00 00       	mov    $0x28,%esi
+  801313:	48 bf 05 23 80 00 00 	movabs $0x802305,%rdi
+  80131a:	00 00 00 
+  80131d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801322:	49 b9 f4 01 80 00 00 	movabs $0x8001f4,%r9
+  801329:	00 00 00 
+  80132c:	41 ff d1             	call   *%r9
+
+000000000080132f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80132f:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801332:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801338:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80133e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801343:	b8 09 00 00 00       	mov    $0x9,%eax
+  801348:	0f 05                	syscall
+	if(check && ret > 0)
+  80134a:	48 85 c0             	test   %rax,%rax
+  80134d:	7f 01                	jg     801350 <sys_env_set_pgfault_upcall+0x21>
+}
+  80134f:	c3                   	ret
+{
+  801350:	55                   	push   %rbp
+  801351:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801354:	49 89 c0             	mov    %rax,%r8
+  801357:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80135c:	48 ba e8 22 80 00 00 	movabs $0x8022e8,%rdx
+  801363:	00 00 00 
+  801366:	be 28 00 00 00       	mov    $0x28,%esi
+  80136b:	48 bf 05 23 80 00 00 	movabs $0x802305,%rdi
+  801372:	00 00 00 
+  801375:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137a:	49 b9 f4 01 80 00 00 	movabs $0x8001f4,%r9
+  801381:	00 00 00 
+  801384:	41 ff d1             	call   *%r9
+
+0000000000801387 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  801387:	48 63 ff             	movslq %edi,%rdi
+  80138a:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  80138d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801393:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801398:	0f 05                	syscall
+}
+  80139a:	c3                   	ret
+
+000000000080139b <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  80139b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8013a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8013a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ac:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013b1:	48 89 f2             	mov    %rsi,%rdx
+  8013b4:	0f 05                	syscall
+	if(check && ret > 0)
+  8013b6:	48 85 c0             	test   %rax,%rax
+  8013b9:	7f 01                	jg     8013bc <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  8013bb:	c3                   	ret
+{
+  8013bc:	55                   	push   %rbp
+  8013bd:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013c0:	49 89 c0             	mov    %rax,%r8
+  8013c3:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8013c8:	48 ba e8 22 80 00 00 	movabs $0x8022e8,%rdx
+  8013cf:	00 00 00 
+  8013d2:	be 28 00 00 00       	mov    $0x28,%esi
+  8013d7:	48 bf 05 23 80 00 00 	movabs $0x802305,%rdi
+  8013de:	00 00 00 
+  8013e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e6:	49 b9 f4 01 80 00 00 	movabs $0x8001f4,%r9
+  8013ed:	00 00 00 
+  8013f0:	41 ff d1             	call   *%r9
+
+00000000008013f3 <pgfault>:
+- unmap PFTEMP using sys_page_unmap()
+- panic if any step fails
+*/
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8013f3:	55                   	push   %rbp
+  8013f4:	48 89 e5             	mov    %rsp,%rbp
+  8013f7:	53                   	push   %rbx
+  8013f8:	48 83 ec 08          	sub    $0x8,%rsp
+	void *addr = (void *) utf->utf_fault_va;
+  8013fc:	48 8b 1f             	mov    (%rdi),%rbx
+	uint32_t err = utf->utf_err;
+  8013ff:	48 8b 47 08          	mov    0x8(%rdi),%rax
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+
+	if (!(err & FEC_WR)) {
+  801403:	a8 02                	test   $0x2,%al
+  801405:	0f 84 b1 00 00 00    	je     8014bc <pgfault+0xc9>
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+	}
+	pte_t pte = uvpt[PGNUM(addr)];
+  80140b:	48 89 da             	mov    %rbx,%rdx
+  80140e:	48 c1 ea 0c          	shr    $0xc,%rdx
+  801412:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801419:	01 00 00 
+  80141c:	48 8b 0c d0          	mov    (%rax,%rdx,8),%rcx
+	if (!(pte & PTE_COW)) {
+  801420:	f6 c5 08             	test   $0x8,%ch
+  801423:	0f 84 c3 00 00 00    	je     8014ec <pgfault+0xf9>
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+
+	void *pg_addr = ROUNDDOWN(addr, PGSIZE);
+  801429:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  801430:	ba 07 00 00 00       	mov    $0x7,%edx
+  801435:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  80143a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80143f:	48 b8 17 10 80 00 00 	movabs $0x801017,%rax
+  801446:	00 00 00 
+  801449:	ff d0                	call   *%rax
+	if (r < 0) {
+  80144b:	85 c0                	test   %eax,%eax
+  80144d:	0f 88 c7 00 00 00    	js     80151a <pgfault+0x127>
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+	}
+	memmove(PFTEMP, pg_addr, PGSIZE);
+  801453:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801458:	48 89 de             	mov    %rbx,%rsi
+  80145b:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  801460:	48 b8 9e 0d 80 00 00 	movabs $0x800d9e,%rax
+  801467:	00 00 00 
+  80146a:	ff d0                	call   *%rax
+	r = sys_page_map(0, PFTEMP, 0, pg_addr, PTE_P | PTE_U | PTE_W);
+  80146c:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  801472:	48 89 d9             	mov    %rbx,%rcx
+  801475:	ba 00 00 00 00       	mov    $0x0,%edx
+  80147a:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  80147f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801484:	48 b8 c3 10 80 00 00 	movabs $0x8010c3,%rax
+  80148b:	00 00 00 
+  80148e:	ff d0                	call   *%rax
+	if (r < 0) {
+  801490:	85 c0                	test   %eax,%eax
+  801492:	0f 88 af 00 00 00    	js     801547 <pgfault+0x154>
+		panic("pgfault: sys_page_map failed:  %e", r);
+	}
+	r = sys_page_unmap(0, PFTEMP);
+  801498:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  80149d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014a2:	48 b8 13 11 80 00 00 	movabs $0x801113,%rax
+  8014a9:	00 00 00 
+  8014ac:	ff d0                	call   *%rax
+	if (r < 0) {
+  8014ae:	85 c0                	test   %eax,%eax
+  8014b0:	0f 88 be 00 00 00    	js     801574 <pgfault+0x181>
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+	}
+}
+  8014b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ba:	c9                   	leave
+  8014bb:	c3                   	ret
+  8014bc:	89 c1                	mov    %eax,%ecx
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+  8014be:	49 89 d8             	mov    %rbx,%r8
+  8014c1:	48 ba 18 23 80 00 00 	movabs $0x802318,%rdx
+  8014c8:	00 00 00 
+  8014cb:	be 32 00 00 00       	mov    $0x32,%esi
+  8014d0:	48 bf c7 24 80 00 00 	movabs $0x8024c7,%rdi
+  8014d7:	00 00 00 
+  8014da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014df:	49 b9 f4 01 80 00 00 	movabs $0x8001f4,%r9
+  8014e6:	00 00 00 
+  8014e9:	41 ff d1             	call   *%r9
+		panic("pgfault: page is not marked copy-on-write (pte=%p, va=%p)", pte, addr);
+  8014ec:	49 89 d8             	mov    %rbx,%r8
+  8014ef:	48 ba 40 23 80 00 00 	movabs $0x802340,%rdx
+  8014f6:	00 00 00 
+  8014f9:	be 36 00 00 00       	mov    $0x36,%esi
+  8014fe:	48 bf c7 24 80 00 00 	movabs $0x8024c7,%rdi
+  801505:	00 00 00 
+  801508:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150d:	49 b9 f4 01 80 00 00 	movabs $0x8001f4,%r9
+  801514:	00 00 00 
+  801517:	41 ff d1             	call   *%r9
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+  80151a:	89 c1                	mov    %eax,%ecx
+  80151c:	48 ba 80 23 80 00 00 	movabs $0x802380,%rdx
+  801523:	00 00 00 
+  801526:	be 44 00 00 00       	mov    $0x44,%esi
+  80152b:	48 bf c7 24 80 00 00 	movabs $0x8024c7,%rdi
+  801532:	00 00 00 
+  801535:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153a:	49 b8 f4 01 80 00 00 	movabs $0x8001f4,%r8
+  801541:	00 00 00 
+  801544:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_map failed:  %e", r);
+  801547:	89 c1                	mov    %eax,%ecx
+  801549:	48 ba a8 23 80 00 00 	movabs $0x8023a8,%rdx
+  801550:	00 00 00 
+  801553:	be 49 00 00 00       	mov    $0x49,%esi
+  801558:	48 bf c7 24 80 00 00 	movabs $0x8024c7,%rdi
+  80155f:	00 00 00 
+  801562:	b8 00 00 00 00       	mov    $0x0,%eax
+  801567:	49 b8 f4 01 80 00 00 	movabs $0x8001f4,%r8
+  80156e:	00 00 00 
+  801571:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+  801574:	89 c1                	mov    %eax,%ecx
+  801576:	48 ba d0 23 80 00 00 	movabs $0x8023d0,%rdx
+  80157d:	00 00 00 
+  801580:	be 4d 00 00 00       	mov    $0x4d,%esi
+  801585:	48 bf c7 24 80 00 00 	movabs $0x8024c7,%rdi
+  80158c:	00 00 00 
+  80158f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801594:	49 b8 f4 01 80 00 00 	movabs $0x8001f4,%r8
+  80159b:	00 00 00 
+  80159e:	41 ff d0             	call   *%r8
+
+00000000008015a1 <dupflush>:
+static struct PageOp dup_child[DUP_BATCH], dup_self[DUP_BATCH];
+static int ndup_child, ndup_self;
+
+static int
+dupflush(envid_t envid)
+{
+  8015a1:	55                   	push   %rbp
+  8015a2:	48 89 e5             	mov    %rsp,%rbp
+  8015a5:	89 fe                	mov    %edi,%esi
+	int r;
+
+	// Map to child first, then remap parent
+	r = sys_page_batch(0, envid, dup_child, ndup_child);
+  8015a7:	a1 24 30 80 00 00 00 	movabs 0x803024,%eax
+  8015ae:	00 00 
+  8015b0:	48 63 c8             	movslq %eax,%rcx
+  8015b3:	48 ba 40 36 80 00 00 	movabs $0x803640,%rdx
+  8015ba:	00 00 00 
+  8015bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c2:	48 b8 b7 11 80 00 00 	movabs $0x8011b7,%rax
+  8015c9:	00 00 00 
+  8015cc:	ff d0                	call   *%rax
+	if (r < 0) {
+  8015ce:	85 c0                	test   %eax,%eax
+  8015d0:	78 57                	js     801629 <dupflush+0x88>
+		panic("duppage: child map failed: %e", r);
+		return r;
+	}
+	r = sys_page_batch(0, 0, dup_self, ndup_self);
+  8015d2:	a1 20 30 80 00 00 00 	movabs 0x803020,%eax
+  8015d9:	00 00 
+  8015db:	48 63 c8             	movslq %eax,%rcx
+  8015de:	48 ba 40 30 80 00 00 	movabs $0x803040,%rdx
+  8015e5:	00 00 00 
+  8015e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015f2:	48 b8 b7 11 80 00 00 	movabs $0x8011b7,%rax
+  8015f9:	00 00 00 
+  8015fc:	ff d0                	call   *%rax
+	if (r < 0) {
+  8015fe:	85 c0                	test   %eax,%eax
+  801600:	78 54                	js     801656 <dupflush+0xb5>
+		panic("duppage: parent remap failed: %e", r);
+		return r;
+	}
+	ndup_child = ndup_self = 0;
+  801602:	48 b8 20 30 80 00 00 	movabs $0x803020,%rax
+  801609:	00 00 00 
+  80160c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  801612:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  801619:	00 00 00 
+  80161c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	return 0;
+}
+  801622:	b8 00 00 00 00       	mov    $0x0,%eax
+  801627:	5d                   	pop    %rbp
+  801628:	c3                   	ret
+		panic("duppage: child map failed: %e", r);
+  801629:	89 c1                	mov    %eax,%ecx
+  80162b:	48 ba d2 24 80 00 00 	movabs $0x8024d2,%rdx
+  801632:	00 00 00 
+  801635:	be 77 00 00 00       	mov    $0x77,%esi
+  80163a:	48 bf c7 24 80 00 00 	movabs $0x8024c7,%rdi
+  801641:	00 00 00 
+  801644:	b8 00 00 00 00       	mov    $0x0,%eax
+  801649:	49 b8 f4 01 80 00 00 	movabs $0x8001f4,%r8
+  801650:	00 00 00 
+  801653:	41 ff d0             	call   *%r8
+		panic("duppage: parent remap failed: %e", r);
+  801656:	89 c1                	mov    %eax,%ecx
+  801658:	48 ba f8 23 80 00 00 	movabs $0x8023f8,%rdx
+  80165f:	00 00 00 
+  801662:	be 7c 00 00 00       	mov    $0x7c,%esi
+  801667:	48 bf c7 24 80 00 00 	movabs $0x8024c7,%rdi
+  80166e:	00 00 00 
+  801671:	b8 00 00 00 00       	mov    $0x0,%eax
+  801676:	49 b8 f4 01 80 00 00 	movabs $0x8001f4,%r8
+  80167d:	00 00 00 
+  801680:	41 ff d0             	call   *%r8
+
+0000000000801683 <thread_start>:
+	return envid;
+}
+
+static void
+thread_start(void (*fn)(void *), void *arg)
+{
+  801683:	55                   	push   %rbp
+  801684:	48 89 e5             	mov    %rsp,%rbp
+  801687:	48 89 f8             	mov    %rdi,%rax
+  80168a:	48 89 f7             	mov    %rsi,%rdi
+	fn(arg);
+  80168d:	ff d0                	call   *%rax
+	exit();
+  80168f:	48 b8 dd 01 80 00 00 	movabs $0x8001dd,%rax
+  801696:	00 00 00 
+  801699:	ff d0                	call   *%rax
+}
+  80169b:	5d                   	pop    %rbp
+  80169c:	c3                   	ret
+
+000000000080169d <fork>:
+{
+  80169d:	55                   	push   %rbp
+  80169e:	48 89 e5             	mov    %rsp,%rbp
+	set_pgfault_handler(pgfault);
+  8016a1:	48 bf f3 13 80 00 00 	movabs $0x8013f3,%rdi
+  8016a8:	00 00 00 
+  8016ab:	48 b8 a4 1d 80 00 00 	movabs $0x801da4,%rax
+  8016b2:	00 00 00 
+  8016b5:	ff d0                	call   *%rax
+	return sys_fork();
+  8016b7:	48 b8 6b 11 80 00 00 	movabs $0x80116b,%rax
+  8016be:	00 00 00 
+  8016c1:	ff d0                	call   *%rax
+}
+  8016c3:	5d                   	pop    %rbp
+  8016c4:	c3                   	ret
+
+00000000008016c5 <ufork>:
+{
+  8016c5:	55                   	push   %rbp
+  8016c6:	48 89 e5             	mov    %rsp,%rbp
+  8016c9:	41 57                	push   %r15
+  8016cb:	41 56                	push   %r14
+  8016cd:	41 55                	push   %r13
+  8016cf:	41 54                	push   %r12
+  8016d1:	53                   	push   %rbx
+  8016d2:	48 83 ec 38          	sub    $0x38,%rsp
+	set_pgfault_handler(pgfault);
+  8016d6:	48 bf f3 13 80 00 00 	movabs $0x8013f3,%rdi
+  8016dd:	00 00 00 
+  8016e0:	48 b8 a4 1d 80 00 00 	movabs $0x801da4,%rax
+  8016e7:	00 00 00 
+  8016ea:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8016ec:	b8 07 00 00 00       	mov    $0x7,%eax
+  8016f1:	cd 30                	int    $0x30
+  8016f3:	89 45 cc             	mov    %eax,-0x34(%rbp)
+	if (envid < 0) {
+  8016f6:	85 c0                	test   %eax,%eax
+  8016f8:	78 21                	js     80171b <ufork+0x56>
+	if (envid == 0) {
+  8016fa:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8016fe:	0f 84 e4 03 00 00    	je     801ae8 <ufork+0x423>
+  801704:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80170b:	00 
+	op->po_op = PAGEOP_MAP;
+  80170c:	49 bf 40 36 80 00 00 	movabs $0x803640,%r15
+  801713:	00 00 00 
+  801716:	e9 e7 02 00 00       	jmp    801a02 <ufork+0x33d>
+		panic("sys_exofork failed: %e", envid);
+  80171b:	89 c1                	mov    %eax,%ecx
+  80171d:	48 ba f0 24 80 00 00 	movabs $0x8024f0,%rdx
+  801724:	00 00 00 
+  801727:	be e4 00 00 00       	mov    $0xe4,%esi
+  80172c:	48 bf c7 24 80 00 00 	movabs $0x8024c7,%rdi
+  801733:	00 00 00 
+  801736:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173b:	49 b8 f4 01 80 00 00 	movabs $0x8001f4,%r8
+  801742:	00 00 00 
+  801745:	41 ff d0             	call   *%r8
+  801748:	44 89 e8             	mov    %r13d,%eax
+  80174b:	c1 e0 09             	shl    $0x9,%eax
+  80174e:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  801751:	44 89 e8             	mov    %r13d,%eax
+  801754:	c1 e0 12             	shl    $0x12,%eax
+  801757:	89 45 ac             	mov    %eax,-0x54(%rbp)
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  80175a:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801761:	00 
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  801762:	44 89 6d a8          	mov    %r13d,-0x58(%rbp)
+				int pdeIndex = pdpeIndex * NPTENTRIES + k;
+  801766:	8b 75 c8             	mov    -0x38(%rbp),%esi
+				if (!(uvpd[pdeIndex] & PTE_P)) {
+  801769:	48 63 c6             	movslq %esi,%rax
+  80176c:	48 bf 00 00 00 80 00 	movabs $0x10080000000,%rdi
+  801773:	01 00 00 
+  801776:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80177a:	a8 01                	test   $0x1,%al
+  80177c:	0f 84 52 02 00 00    	je     8019d4 <ufork+0x30f>
+				if (uvpd[pdeIndex] & PTE_PS) {
+  801782:	48 63 c6             	movslq %esi,%rax
+  801785:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  801789:	a8 80                	test   $0x80,%al
+  80178b:	74 52                	je     8017df <ufork+0x11a>
+					void *va = PGADDR(i, j, k, 0, 0);
+  80178d:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  801791:	48 c1 e3 27          	shl    $0x27,%rbx
+  801795:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801799:	48 09 c3             	or     %rax,%rbx
+  80179c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8017a0:	48 09 c3             	or     %rax,%rbx
+					if ((uintptr_t)va >= UTOP) {
+  8017a3:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  8017a8:	48 39 d8             	cmp    %rbx,%rax
+  8017ab:	0f 82 ca 02 00 00    	jb     801a7b <ufork+0x3b6>
+					r = sys_page_map(0, va, 0, va, uvpd[pdeIndex] & PTE_SYSCALL);
+  8017b1:	48 63 d6             	movslq %esi,%rdx
+  8017b4:	4c 8b 04 d7          	mov    (%rdi,%rdx,8),%r8
+  8017b8:	41 81 e0 07 0e 00 00 	and    $0xe07,%r8d
+  8017bf:	48 89 d9             	mov    %rbx,%rcx
+  8017c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017c7:	48 89 de             	mov    %rbx,%rsi
+  8017ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017cf:	48 b8 c3 10 80 00 00 	movabs $0x8010c3,%rax
+  8017d6:	00 00 00 
+  8017d9:	ff d0                	call   *%rax
+					if (r < 0) {
+  8017db:	85 c0                	test   %eax,%eax
+  8017dd:	78 18                	js     8017f7 <ufork+0x132>
+  8017df:	4c 63 65 ac          	movslq -0x54(%rbp),%r12
+  8017e3:	4c 89 e3             	mov    %r12,%rbx
+  8017e6:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8017ea:	4d 8d ac 24 00 02 00 	lea    0x200(%r12),%r13
+  8017f1:	00 
+  8017f2:	e9 00 01 00 00       	jmp    8018f7 <ufork+0x232>
+						panic("splitting 2MB page at %p failed: %e", va, r);
+  8017f7:	41 89 c0             	mov    %eax,%r8d
+  8017fa:	48 89 d9             	mov    %rbx,%rcx
+  8017fd:	48 ba 20 24 80 00 00 	movabs $0x802420,%rdx
+  801804:	00 00 00 
+  801807:	be 0a 01 00 00       	mov    $0x10a,%esi
+  80180c:	48 bf c7 24 80 00 00 	movabs $0x8024c7,%rdi
+  801813:	00 00 00 
+  801816:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181b:	49 b9 f4 01 80 00 00 	movabs $0x8001f4,%r9
+  801822:	00 00 00 
+  801825:	41 ff d1             	call   *%r9
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  801828:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  80182f:	00 00 00 
+  801832:	8b 0f                	mov    (%rdi),%ecx
+  801834:	8d 71 01             	lea    0x1(%rcx),%esi
+  801837:	89 37                	mov    %esi,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  801839:	48 63 c9             	movslq %ecx,%rcx
+  80183c:	48 8d 34 09          	lea    (%rcx,%rcx,1),%rsi
+  801840:	48 8d 3c 0e          	lea    (%rsi,%rcx,1),%rdi
+  801844:	41 c7 04 ff 01 00 00 	movl   $0x1,(%r15,%rdi,8)
+  80184b:	00 
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  80184c:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  801852:	41 89 54 ff 04       	mov    %edx,0x4(%r15,%rdi,8)
+	op->po_srcva = op->po_dstva = va;
+  801857:	49 89 44 ff 10       	mov    %rax,0x10(%r15,%rdi,8)
+  80185c:	49 89 44 ff 08       	mov    %rax,0x8(%r15,%rdi,8)
+}
+  801861:	eb 76                	jmp    8018d9 <ufork+0x214>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U | PTE_COW);
+  801863:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  80186a:	00 00 00 
+  80186d:	8b 17                	mov    (%rdi),%edx
+  80186f:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  801872:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  801874:	48 63 d2             	movslq %edx,%rdx
+  801877:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  80187b:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  80187f:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  801886:	00 
+	op->po_perm = perm;
+  801887:	41 c7 44 f7 04 05 08 	movl   $0x805,0x4(%r15,%rsi,8)
+  80188e:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  801890:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  801895:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+		dupqueue(&dup_self[ndup_self++], va, PTE_P | PTE_U | PTE_COW);
+  80189a:	48 b9 20 30 80 00 00 	movabs $0x803020,%rcx
+  8018a1:	00 00 00 
+  8018a4:	8b 11                	mov    (%rcx),%edx
+  8018a6:	8d 72 01             	lea    0x1(%rdx),%esi
+  8018a9:	89 31                	mov    %esi,(%rcx)
+	op->po_op = PAGEOP_MAP;
+  8018ab:	48 be 40 30 80 00 00 	movabs $0x803040,%rsi
+  8018b2:	00 00 00 
+  8018b5:	48 63 d2             	movslq %edx,%rdx
+  8018b8:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  8018bc:	48 8d 3c 11          	lea    (%rcx,%rdx,1),%rdi
+  8018c0:	c7 04 fe 01 00 00 00 	movl   $0x1,(%rsi,%rdi,8)
+	op->po_perm = perm;
+  8018c7:	c7 44 fe 04 05 08 00 	movl   $0x805,0x4(%rsi,%rdi,8)
+  8018ce:	00 
+	op->po_srcva = op->po_dstva = va;
+  8018cf:	48 89 44 fe 10       	mov    %rax,0x10(%rsi,%rdi,8)
+  8018d4:	48 89 44 fe 08       	mov    %rax,0x8(%rsi,%rdi,8)
+	if (ndup_child == DUP_BATCH) {
+  8018d9:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  8018e0:	00 00 00 
+  8018e3:	83 38 40             	cmpl   $0x40,(%rax)
+  8018e6:	0f 84 a4 00 00 00    	je     801990 <ufork+0x2cb>
+				for (int l = 0; l < NPTENTRIES; l++) {
+  8018ec:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018f3:	49 83 c4 01          	add    $0x1,%r12
+  8018f7:	4d 39 ec             	cmp    %r13,%r12
+  8018fa:	0f 84 d4 00 00 00    	je     8019d4 <ufork+0x30f>
+					if (va >= UTOP) {
+  801900:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  801905:	48 39 d8             	cmp    %rbx,%rax
+  801908:	0f 82 6d 01 00 00    	jb     801a7b <ufork+0x3b6>
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  80190e:	48 b8 00 10 80 43 ff 	movabs $0xffffffff43801000,%rax
+  801915:	ff ff ff 
+  801918:	48 01 d8             	add    %rbx,%rax
+  80191b:	48 3d ff 0f 00 00    	cmp    $0xfff,%rax
+  801921:	76 c9                	jbe    8018ec <ufork+0x227>
+					if (!(uvpt[pn] & PTE_P)) {
+  801923:	4b 8b 04 e6          	mov    (%r14,%r12,8),%rax
+  801927:	a8 01                	test   $0x1,%al
+  801929:	74 c1                	je     8018ec <ufork+0x227>
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  80192b:	48 b8 00 f0 ff ff ff 	movabs $0xffffffff000,%rax
+  801932:	0f 00 00 
+  801935:	48 21 d8             	and    %rbx,%rax
+	pte_t pte = uvpt[pn];
+  801938:	44 89 e2             	mov    %r12d,%edx
+  80193b:	49 8b 14 d6          	mov    (%r14,%rdx,8),%rdx
+	if (pte & PTE_SHARE) {
+  80193f:	f6 c6 04             	test   $0x4,%dh
+  801942:	0f 85 e0 fe ff ff    	jne    801828 <ufork+0x163>
+	} else if ((pte & PTE_W) || (pte & PTE_COW)) {
+  801948:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  80194e:	0f 85 0f ff ff ff    	jne    801863 <ufork+0x19e>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U);
+  801954:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  80195b:	00 00 00 
+  80195e:	8b 17                	mov    (%rdi),%edx
+  801960:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  801963:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  801965:	48 63 d2             	movslq %edx,%rdx
+  801968:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  80196c:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  801970:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  801977:	00 
+	op->po_perm = perm;
+  801978:	41 c7 44 f7 04 05 00 	movl   $0x5,0x4(%r15,%rsi,8)
+  80197f:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  801981:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  801986:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+}
+  80198b:	e9 49 ff ff ff       	jmp    8018d9 <ufork+0x214>
+		return dupflush(envid);
+  801990:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801993:	48 b8 a1 15 80 00 00 	movabs $0x8015a1,%rax
+  80199a:	00 00 00 
+  80199d:	ff d0                	call   *%rax
+					if (r < 0) {
+  80199f:	85 c0                	test   %eax,%eax
+  8019a1:	0f 89 45 ff ff ff    	jns    8018ec <ufork+0x227>
+						panic("duppage failed:  %e", r);
+  8019a7:	89 c1                	mov    %eax,%ecx
+  8019a9:	48 ba 07 25 80 00 00 	movabs $0x802507,%rdx
+  8019b0:	00 00 00 
+  8019b3:	be 20 01 00 00       	mov    $0x120,%esi
+  8019b8:	48 bf c7 24 80 00 00 	movabs $0x8024c7,%rdi
+  8019bf:	00 00 00 
+  8019c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c7:	49 b8 f4 01 80 00 00 	movabs $0x8001f4,%r8
+  8019ce:	00 00 00 
+  8019d1:	41 ff d0             	call   *%r8
+			for (int k = 0; k < NPTENTRIES; k++) {
+  8019d4:	81 45 ac 00 02 00 00 	addl   $0x200,-0x54(%rbp)
+  8019db:	83 45 c8 01          	addl   $0x1,-0x38(%rbp)
+  8019df:	48 81 45 b0 00 00 20 	addq   $0x200000,-0x50(%rbp)
+  8019e6:	00 
+  8019e7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8019eb:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  8019f1:	0f 85 6f fd ff ff    	jne    801766 <ufork+0xa1>
+  8019f7:	44 8b 6d a8          	mov    -0x58(%rbp),%r13d
+  8019fb:	eb 5d                	jmp    801a5a <ufork+0x395>
+	for (int i = 0; i < NPTENTRIES; i++) {
+  8019fd:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  801a02:	48 81 7d c0 00 02 00 	cmpq   $0x200,-0x40(%rbp)
+  801a09:	00 
+  801a0a:	74 6f                	je     801a7b <ufork+0x3b6>
+		if (!(uvpml4e[i] & PTE_P)) {
+  801a0c:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  801a10:	48 63 c3             	movslq %ebx,%rax
+  801a13:	48 be 00 20 40 80 00 	movabs $0x10080402000,%rsi
+  801a1a:	01 00 00 
+  801a1d:	48 8b 04 c6          	mov    (%rsi,%rax,8),%rax
+  801a21:	a8 01                	test   $0x1,%al
+  801a23:	74 d8                	je     8019fd <ufork+0x338>
+  801a25:	41 89 dc             	mov    %ebx,%r12d
+  801a28:	41 c1 e4 09          	shl    $0x9,%r12d
+  801a2c:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801a33:	00 
+					if (!(uvpt[pn] & PTE_P)) {
+  801a34:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  801a3b:	01 00 00 
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  801a3e:	45 89 e5             	mov    %r12d,%r13d
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  801a41:	49 63 c5             	movslq %r13d,%rax
+  801a44:	48 bb 00 00 40 80 00 	movabs $0x10080400000,%rbx
+  801a4b:	01 00 00 
+  801a4e:	48 8b 04 c3          	mov    (%rbx,%rax,8),%rax
+  801a52:	a8 01                	test   $0x1,%al
+  801a54:	0f 85 ee fc ff ff    	jne    801748 <ufork+0x83>
+		for (int j = 0; j < NPTENTRIES; j++) {
+  801a5a:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  801a61:	40 
+  801a62:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a66:	41 83 c5 01          	add    $0x1,%r13d
+  801a6a:	48 b9 00 00 00 00 80 	movabs $0x8000000000,%rcx
+  801a71:	00 00 00 
+  801a74:	48 39 c8             	cmp    %rcx,%rax
+  801a77:	75 c8                	jne    801a41 <ufork+0x37c>
+  801a79:	eb 82                	jmp    8019fd <ufork+0x338>
+	r = dupflush(envid);
+  801a7b:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801a7e:	48 b8 a1 15 80 00 00 	movabs $0x8015a1,%rax
+  801a85:	00 00 00 
+  801a88:	ff d0                	call   *%rax
+	if (r < 0) {
+  801a8a:	85 c0                	test   %eax,%eax
+  801a8c:	78 6c                	js     801afa <ufork+0x435>
+	r = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801a8e:	ba 07 00 00 00       	mov    $0x7,%edx
+  801a93:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801a98:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801a9b:	48 b8 17 10 80 00 00 	movabs $0x801017,%rax
+  801aa2:	00 00 00 
+  801aa5:	ff d0                	call   *%rax
+	if (r < 0) {
+  801aa7:	85 c0                	test   %eax,%eax
+  801aa9:	78 7c                	js     801b27 <ufork+0x462>
+	r = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  801aab:	48 be 6b 1e 80 00 00 	movabs $0x801e6b,%rsi
+  801ab2:	00 00 00 
+  801ab5:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801ab8:	48 b8 2f 13 80 00 00 	movabs $0x80132f,%rax
+  801abf:	00 00 00 
+  801ac2:	ff d0                	call   *%rax
+	if (r < 0) {
+  801ac4:	85 c0                	test   %eax,%eax
+  801ac6:	0f 88 88 00 00 00    	js     801b54 <ufork+0x48f>
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  801acc:	be 02 00 00 00       	mov    $0x2,%esi
+  801ad1:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801ad4:	48 b8 d4 12 80 00 00 	movabs $0x8012d4,%rax
+  801adb:	00 00 00 
+  801ade:	ff d0                	call   *%rax
+	if (r < 0) {
+  801ae0:	85 c0                	test   %eax,%eax
+  801ae2:	0f 88 99 00 00 00    	js     801b81 <ufork+0x4bc>
+}
+  801ae8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801aeb:	48 83 c4 38          	add    $0x38,%rsp
+  801aef:	5b                   	pop    %rbx
+  801af0:	41 5c                	pop    %r12
+  801af2:	41 5d                	pop    %r13
+  801af4:	41 5e                	pop    %r14
+  801af6:	41 5f                	pop    %r15
+  801af8:	5d                   	pop    %rbp
+  801af9:	c3                   	ret
+		panic("duppage failed:  %e", r);
+  801afa:	89 c1                	mov    %eax,%ecx
+  801afc:	48 ba 07 25 80 00 00 	movabs $0x802507,%rdx
+  801b03:	00 00 00 
+  801b06:	be 29 01 00 00       	mov    $0x129,%esi
+  801b0b:	48 bf c7 24 80 00 00 	movabs $0x8024c7,%rdi
+  801b12:	00 00 00 
+  801b15:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1a:	49 b8 f4 01 80 00 00 	movabs $0x8001f4,%r8
+  801b21:	00 00 00 
+  801b24:	41 ff d0             	call   *%r8
+		panic("sys_page_alloc for child exception stack failed: %e", r);
+  801b27:	89 c1                	mov    %eax,%ecx
+  801b29:	48 ba 48 24 80 00 00 	movabs $0x802448,%rdx
+  801b30:	00 00 00 
+  801b33:	be 2e 01 00 00       	mov    $0x12e,%esi
+  801b38:	48 bf c7 24 80 00 00 	movabs $0x8024c7,%rdi
+  801b3f:	00 00 00 
+  801b42:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b47:	49 b8 f4 01 80 00 00 	movabs $0x8001f4,%r8
+  801b4e:	00 00 00 
+  801b51:	41 ff d0             	call   *%r8
+		panic("sys_env_set_pgfault_upcall failed:  %e", r);
+  801b54:	89 c1                	mov    %eax,%ecx
+  801b56:	48 ba 80 24 80 00 00 	movabs $0x802480,%rdx
+  801b5d:	00 00 00 
+  801b60:	be 33 01 00 00       	mov    $0x133,%esi
+  801b65:	48 bf c7 24 80 00 00 	movabs $0x8024c7,%rdi
+  801b6c:	00 00 00 
+  801b6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b74:	49 b8 f4 01 80 00 00 	movabs $0x8001f4,%r8
+  801b7b:	00 00 00 
+  801b7e:	41 ff d0             	call   *%r8
+		panic("sys_env_set_status failed:  %e", r);
+  801b81:	89 c1                	mov    %eax,%ecx
+  801b83:	48 ba a8 24 80 00 00 	movabs $0x8024a8,%rdx
+  801b8a:	00 00 00 
+  801b8d:	be 38 01 00 00       	mov    $0x138,%esi
+  801b92:	48 bf c7 24 80 00 00 	movabs $0x8024c7,%rdi
+  801b99:	00 00 00 
+  801b9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba1:	49 b8 f4 01 80 00 00 	movabs $0x8001f4,%r8
+  801ba8:	00 00 00 
+  801bab:	41 ff d0             	call   *%r8
+
+0000000000801bae <sfork>:
+// on one stack, since nothing is private to the child.
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801bae:	55                   	push   %rbp
+  801baf:	48 89 e5             	mov    %rsp,%rbp
+  801bb2:	48 89 f2             	mov    %rsi,%rdx
+	return sys_thread_create(thread_start, (uint64_t) fn, (uint64_t) arg);
+  801bb5:	48 89 fe             	mov    %rdi,%rsi
+  801bb8:	48 bf 83 16 80 00 00 	movabs $0x801683,%rdi
+  801bbf:	00 00 00 
+  801bc2:	48 b8 a3 11 80 00 00 	movabs $0x8011a3,%rax
+  801bc9:	00 00 00 
+  801bcc:	ff d0                	call   *%rax
+}
+  801bce:	5d                   	pop    %rbp
+  801bcf:	c3                   	ret
+
+0000000000801bd0 <ipc_recv>:
+	- if perm_store non null, contents should be bitwise OR with thisenv->env_ipc_perm
+	- return the value sent by the sender: thisenv->env_ipc_value
+*/
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801bd0:	55                   	push   %rbp
+  801bd1:	48 89 e5             	mov    %rsp,%rbp
+  801bd4:	41 54                	push   %r12
+  801bd6:	53                   	push   %rbx
+  801bd7:	48 89 fb             	mov    %rdi,%rbx
+  801bda:	48 89 f7             	mov    %rsi,%rdi
+  801bdd:	49 89 d4             	mov    %rdx,%r12
+	// LAB 4: Your code here.
+	int r;
+	
+	if (pg == NULL) pg = (void *)UTOP;
+  801be0:	48 85 f6             	test   %rsi,%rsi
+  801be3:	b8 00 00 80 bc       	mov    $0xbc800000,%eax
+  801be8:	48 0f 44 f8          	cmove  %rax,%rdi
+	
+	r = sys_ipc_recv(pg);
+  801bec:	48 b8 9b 13 80 00 00 	movabs $0x80139b,%rax
+  801bf3:	00 00 00 
+  801bf6:	ff d0                	call   *%rax
+	
+	if (r < 0) {
+  801bf8:	85 c0                	test   %eax,%eax
+  801bfa:	0f 88 99 00 00 00    	js     801c99 <ipc_recv+0xc9>
+			*perm_store = 0;
+		}
+		return r;
+	}
+	
+	if (from_env_store) {
+  801c00:	48 85 db             	test   %rbx,%rbx
+  801c03:	74 2e                	je     801c33 <ipc_recv+0x63>
+	asm volatile("movl %%gs:%c1, %0"
+  801c05:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  801c0c:	00 
+		*from_env_store = thisenv->env_ipc_from;
+  801c0d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801c12:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801c16:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801c1a:	48 c1 e2 04          	shl    $0x4,%rdx
+  801c1e:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801c25:	00 00 00 
+  801c28:	48 01 d0             	add    %rdx,%rax
+  801c2b:	8b 80 1c 01 00 00    	mov    0x11c(%rax),%eax
+  801c31:	89 03                	mov    %eax,(%rbx)
+	}
+	if (perm_store) {
+  801c33:	4d 85 e4             	test   %r12,%r12
+  801c36:	74 30                	je     801c68 <ipc_recv+0x98>
+  801c38:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  801c3f:	00 
+		*perm_store = thisenv->env_ipc_perm;
+  801c40:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801c45:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801c49:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801c4d:	48 c1 e2 04          	shl    $0x4,%rdx
+  801c51:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801c58:	00 00 00 
+  801c5b:	48 01 d0             	add    %rdx,%rax
+  801c5e:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+  801c64:	41 89 04 24          	mov    %eax,(%r12)
+  801c68:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  801c6f:	00 
+	}
+	
+	return thisenv->env_ipc_value;
+  801c70:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801c75:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801c79:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801c7d:	48 c1 e2 04          	shl    $0x4,%rdx
+  801c81:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801c88:	00 00 00 
+  801c8b:	48 01 d0             	add    %rdx,%rax
+  801c8e:	8b 80 18 01 00 00    	mov    0x118(%rax),%eax
+}
+  801c94:	5b                   	pop    %rbx
+  801c95:	41 5c                	pop    %r12
+  801c97:	5d                   	pop    %rbp
+  801c98:	c3                   	ret
+		if (from_env_store) {
+  801c99:	48 85 db             	test   %rbx,%rbx
+  801c9c:	74 06                	je     801ca4 <ipc_recv+0xd4>
+			*from_env_store = 0;
+  801c9e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+		if (perm_store) {
+  801ca4:	4d 85 e4             	test   %r12,%r12
+  801ca7:	74 eb                	je     801c94 <ipc_recv+0xc4>
+			*perm_store = 0;
+  801ca9:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801cb0:	00 
+  801cb1:	eb e1                	jmp    801c94 <ipc_recv+0xc4>
+
+0000000000801cb3 <ipc_send>:
+	- if a diff negative value, panic
+	- otherwise, body of loop should call sys_yield() to be allow JOS to schedule another env
+*/
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801cb3:	55                   	push   %rbp
+  801cb4:	48 89 e5             	mov    %rsp,%rbp
+  801cb7:	41 57                	push   %r15
+  801cb9:	41 56                	push   %r14
+  801cbb:	41 55                	push   %r13
+  801cbd:	41 54                	push   %r12
+  801cbf:	53                   	push   %rbx
+  801cc0:	48 83 ec 18          	sub    $0x18,%rsp
+  801cc4:	41 89 fd             	mov    %edi,%r13d
+  801cc7:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  801cca:	48 89 d3             	mov    %rdx,%rbx
+  801ccd:	41 89 cc             	mov    %ecx,%r12d
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  801cd0:	48 85 d2             	test   %rdx,%rdx
+  801cd3:	b8 00 00 80 bc       	mov    $0xbc800000,%eax
+  801cd8:	48 0f 44 d8          	cmove  %rax,%rbx
+	}
+	
+	// keep trying until success
+	while (1) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  801cdc:	49 be 87 13 80 00 00 	movabs $0x801387,%r14
+  801ce3:	00 00 00 
+		if (r == 0) {
+			return;
+		}
+		
+		if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  801ce6:	49 bf f8 0f 80 00 00 	movabs $0x800ff8,%r15
+  801ced:	00 00 00 
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  801cf0:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  801cf3:	44 89 e1             	mov    %r12d,%ecx
+  801cf6:	48 89 da             	mov    %rbx,%rdx
+  801cf9:	44 89 ef             	mov    %r13d,%edi
+  801cfc:	41 ff d6             	call   *%r14
+		if (r == 0) {
+  801cff:	85 c0                	test   %eax,%eax
+  801d01:	74 37                	je     801d3a <ipc_send+0x87>
+		if (r == -E_IPC_NOT_RECV) {
+  801d03:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801d06:	75 05                	jne    801d0d <ipc_send+0x5a>
+			sys_yield();
+  801d08:	41 ff d7             	call   *%r15
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  801d0b:	eb e3                	jmp    801cf0 <ipc_send+0x3d>
+		} else {
+			panic("ipc_send - %e", r);
+  801d0d:	89 c1                	mov    %eax,%ecx
+  801d0f:	48 ba 1b 25 80 00 00 	movabs $0x80251b,%rdx
+  801d16:	00 00 00 
+  801d19:	be 67 00 00 00       	mov    $0x67,%esi
+  801d1e:	48 bf 29 25 80 00 00 	movabs $0x802529,%rdi
+  801d25:	00 00 00 
+  801d28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d2d:	49 b8 f4 01 80 00 00 	movabs $0x8001f4,%r8
+  801d34:	00 00 00 
+  801d37:	41 ff d0             	call   *%r8
+		}
+	}
+}
+  801d3a:	48 83 c4 18          	add    $0x18,%rsp
+  801d3e:	5b                   	pop    %rbx
+  801d3f:	41 5c                	pop    %r12
+  801d41:	41 5d                	pop    %r13
+  801d43:	41 5e                	pop    %r14
+  801d45:	41 5f                	pop    %r15
+  801d47:	5d                   	pop    %rbp
+  801d48:	c3                   	ret
+
+0000000000801d49 <ipc_find_env>:
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+	int i;
+	for (i = 0; i < NENV; i++)
+  801d49:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  801d4e:	48 be 00 00 80 bc 00 	movabs $0xbc800000,%rsi
+  801d55:	00 00 00 
+  801d58:	48 63 c2             	movslq %edx,%rax
+  801d5b:	48 8d 0c c0          	lea    (%rax,%rax,8),%rcx
+  801d5f:	48 8d 04 48          	lea    (%rax,%rcx,2),%rax
+  801d63:	48 c1 e0 04          	shl    $0x4,%rax
+  801d67:	48 01 f0             	add    %rsi,%rax
+  801d6a:	8b 80 c0 00 00 00    	mov    0xc0(%rax),%eax
+  801d70:	39 f8                	cmp    %edi,%eax
+  801d72:	74 11                	je     801d85 <ipc_find_env+0x3c>
+	for (i = 0; i < NENV; i++)
+  801d74:	83 c2 01             	add    $0x1,%edx
+  801d77:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801d7d:	75 d9                	jne    801d58 <ipc_find_env+0xf>
+			return envs[i].env_id;
+	return 0;
+  801d7f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d84:	c3                   	ret
+			return envs[i].env_id;
+  801d85:	48 63 d2             	movslq %edx,%rdx
+  801d88:	48 8d 14 4a          	lea    (%rdx,%rcx,2),%rdx
+  801d8c:	48 c1 e2 04          	shl    $0x4,%rdx
+  801d90:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801d97:	00 00 00 
+  801d9a:	48 01 d0             	add    %rdx,%rax
+  801d9d:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+  801da3:	c3                   	ret
+
+0000000000801da4 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801da4:	55                   	push   %rbp
+  801da5:	48 89 e5             	mov    %rsp,%rbp
+  801da8:	53                   	push   %rbx
+  801da9:	48 83 ec 08          	sub    $0x8,%rsp
+  801dad:	48 89 fb             	mov    %rdi,%rbx
+	int r;
+
+	if (_pgfault_handler == 0) {
+  801db0:	48 ba 40 3c 80 00 00 	movabs $0x803c40,%rdx
+  801db7:	00 00 00 
+  801dba:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801dbe:	74 13                	je     801dd3 <set_pgfault_handler+0x2f>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801dc0:	48 89 d8             	mov    %rbx,%rax
+  801dc3:	48 a3 40 3c 80 00 00 	movabs %rax,0x803c40
+  801dca:	00 00 00 
+}
+  801dcd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dd1:	c9                   	leave
+  801dd2:	c3                   	ret
+		r = sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801dd3:	ba 07 00 00 00       	mov    $0x7,%edx
+  801dd8:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801ddd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801de2:	48 b8 17 10 80 00 00 	movabs $0x801017,%rax
+  801de9:	00 00 00 
+  801dec:	ff d0                	call   *%rax
+		if (r < 0) {
+  801dee:	85 c0                	test   %eax,%eax
+  801df0:	78 4c                	js     801e3e <set_pgfault_handler+0x9a>
+		r = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801df2:	48 be 6b 1e 80 00 00 	movabs $0x801e6b,%rsi
+  801df9:	00 00 00 
+  801dfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e01:	48 b8 2f 13 80 00 00 	movabs $0x80132f,%rax
+  801e08:	00 00 00 
+  801e0b:	ff d0                	call   *%rax
+		if (r < 0) {
+  801e0d:	85 c0                	test   %eax,%eax
+  801e0f:	79 af                	jns    801dc0 <set_pgfault_handler+0x1c>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+  801e11:	89 c1                	mov    %eax,%ecx
+  801e13:	48 ba 60 25 80 00 00 	movabs $0x802560,%rdx
+  801e1a:	00 00 00 
+  801e1d:	be 2c 00 00 00       	mov    $0x2c,%esi
+  801e22:	48 bf 4e 25 80 00 00 	movabs $0x80254e,%rdi
+  801e29:	00 00 00 
+  801e2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e31:	49 b8 f4 01 80 00 00 	movabs $0x8001f4,%r8
+  801e38:	00 00 00 
+  801e3b:	41 ff d0             	call   *%r8
+			panic("sys_page_alloc failed:  %e", r);
+  801e3e:	89 c1                	mov    %eax,%ecx
+  801e40:	48 ba 33 25 80 00 00 	movabs $0x802533,%rdx
+  801e47:	00 00 00 
+  801e4a:	be 28 00 00 00       	mov    $0x28,%esi
+  801e4f:	48 bf 4e 25 80 00 00 	movabs $0x80254e,%rdi
+  801e56:	00 00 00 
+  801e59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e5e:	49 b8 f4 01 80 00 00 	movabs $0x8001f4,%r8
+  801e65:	00 00 00 
+  801e68:	41 ff d0             	call   *%r8
+
+0000000000801e6b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi		// function argument: pointer to UTF
+  801e6b:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  801e6e:	48 a1 40 3c 80 00 00 	movabs 0x803c40,%rax
+  801e75:	00 00 00 
+	call *%rax
+  801e78:	ff d0                	call   *%rax
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here. (Hint. You need to modify the trap time rsp to make room for the return rip ) */
+
+	movq  152(%rsp), %rax
+  801e7a:	48 8b 84 24 98 00 00 	mov    0x98(%rsp),%rax
+  801e81:	00 
+	subq $8, %rax
+  801e82:	48 83 e8 08          	sub    $0x8,%rax
+	movq %rax, 152(%rsp)
+  801e86:	48 89 84 24 98 00 00 	mov    %rax,0x98(%rsp)
+  801e8d:	00 
+
+	movq 136(%rsp), %rbx
+  801e8e:	48 8b 9c 24 88 00 00 	mov    0x88(%rsp),%rbx
+  801e95:	00 
+	movq %rbx, (%rax)
+  801e96:	48 89 18             	mov    %rbx,(%rax)
+
+	/* Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here. (Hint, the oposite of _alltraps) */
+
+	addq $16, %rsp
+  801e99:	48 83 c4 10          	add    $0x10,%rsp
+	
+	popq %r15
+  801e9d:	41 5f                	pop    %r15
+	popq %r14
+  801e9f:	41 5e                	pop    %r14
+	popq %r13
+  801ea1:	41 5d                	pop    %r13
+	popq %r12
+  801ea3:	41 5c                	pop    %r12
+	popq %r11
+  801ea5:	41 5b                	pop    %r11
+	popq %r10
+  801ea7:	41 5a                	pop    %r10
+	popq %r9
+  801ea9:	41 59                	pop    %r9
+	popq %r8
+  801eab:	41 58                	pop    %r8
+	popq %rsi
+  801ead:	5e                   	pop    %rsi
+	popq %rdi
+  801eae:	5f                   	pop    %rdi
+	popq %rbp
+  801eaf:	5d                   	pop    %rbp
+	popq %rdx
+  801eb0:	5a                   	pop    %rdx
+	popq %rcx
+  801eb1:	59                   	pop    %rcx
+	popq %rbx
+  801eb2:	5b                   	pop    %rbx
+	popq %rax
+  801eb3:	58                   	pop    %rax
+
+	addq $8, %rsp
+  801eb4:	48 83 c4 08          	add    $0x8,%rsp
+	/* Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 4: Your code here. */
+
+	popfq
+  801eb8:	9d                   	popf
+
+	/* Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here. */
+
+	popq %rsp
+  801eb9:	5c                   	pop    %rsp
+
+	/* Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here. */
+  801eba:	c3                   	ret
@@ -0,0 +1,2909 @@
+
+obj/user/ringtest:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 63 05 00 00       	call   800594 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <submit>:
+static int64_t results[8];
+
+static void
+submit(uint32_t num, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4,
+       uint64_t a5, uint64_t data)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+	int r;
+
+	if ((r = ring_submit(num, a1, a2, a3, a4, a5, data)) < 0)
+  800037:	48 83 ec 08          	sub    $0x8,%rsp
+  80003b:	ff 75 10             	push   0x10(%rbp)
+  80003e:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  800045:	00 00 00 
+  800048:	ff d0                	call   *%rax
+  80004a:	48 83 c4 10          	add    $0x10,%rsp
+  80004e:	85 c0                	test   %eax,%eax
+  800050:	78 02                	js     800054 <submit+0x21>
+		panic("ring_submit: %e", r);
+}
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+		panic("ring_submit: %e", r);
+  800054:	89 c1                	mov    %eax,%ecx
+  800056:	48 ba 80 1a 80 00 00 	movabs $0x801a80,%rdx
+  80005d:	00 00 00 
+  800060:	be 13 00 00 00       	mov    $0x13,%esi
+  800065:	48 bf 90 1a 80 00 00 	movabs $0x801a90,%rdi
+  80006c:	00 00 00 
+  80006f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800074:	49 b8 da 05 80 00 00 	movabs $0x8005da,%r8
+  80007b:	00 00 00 
+  80007e:	41 ff d0             	call   *%r8
+
+0000000000800081 <reap>:
+
+// Wait for 'n' completions, storing results by their data.
+static void
+reap(int n)
+{
+  800081:	55                   	push   %rbp
+  800082:	48 89 e5             	mov    %rsp,%rbp
+  800085:	41 56                	push   %r14
+  800087:	41 55                	push   %r13
+  800089:	41 54                	push   %r12
+  80008b:	53                   	push   %rbx
+  80008c:	48 83 ec 10          	sub    $0x10,%rsp
+  800090:	89 fb                	mov    %edi,%ebx
+	struct RingCqe cqe;
+
+	while (n > 0) {
+		if (!ring_reap(&cqe)) {
+  800092:	49 bc f3 19 80 00 00 	movabs $0x8019f3,%r12
+  800099:	00 00 00 
+			sys_ring_enter();
+			continue;
+		}
+		if (cqe.cqe_data < 8)
+			results[cqe.cqe_data] = cqe.cqe_result;
+  80009c:	49 bd 00 40 80 00 00 	movabs $0x804000,%r13
+  8000a3:	00 00 00 
+			sys_ring_enter();
+  8000a6:	49 be 48 16 80 00 00 	movabs $0x801648,%r14
+  8000ad:	00 00 00 
+	while (n > 0) {
+  8000b0:	eb 11                	jmp    8000c3 <reap+0x42>
+			sys_ring_enter();
+  8000b2:	41 ff d6             	call   *%r14
+			continue;
+  8000b5:	eb 0c                	jmp    8000c3 <reap+0x42>
+		else if (cqe.cqe_result < 0)
+  8000b7:	4c 8b 45 d8          	mov    -0x28(%rbp),%r8
+  8000bb:	4d 85 c0             	test   %r8,%r8
+  8000be:	78 27                	js     8000e7 <reap+0x66>
+			panic("request %ld: %e", cqe.cqe_data, (int) cqe.cqe_result);
+		n--;
+  8000c0:	83 eb 01             	sub    $0x1,%ebx
+	while (n > 0) {
+  8000c3:	85 db                	test   %ebx,%ebx
+  8000c5:	7e 4b                	jle    800112 <reap+0x91>
+		if (!ring_reap(&cqe)) {
+  8000c7:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8000cb:	41 ff d4             	call   *%r12
+  8000ce:	85 c0                	test   %eax,%eax
+  8000d0:	74 e0                	je     8000b2 <reap+0x31>
+		if (cqe.cqe_data < 8)
+  8000d2:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8000d6:	48 83 f9 07          	cmp    $0x7,%rcx
+  8000da:	77 db                	ja     8000b7 <reap+0x36>
+			results[cqe.cqe_data] = cqe.cqe_result;
+  8000dc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8000e0:	49 89 44 cd 00       	mov    %rax,0x0(%r13,%rcx,8)
+  8000e5:	eb d9                	jmp    8000c0 <reap+0x3f>
+			panic("request %ld: %e", cqe.cqe_data, (int) cqe.cqe_result);
+  8000e7:	48 ba a0 1a 80 00 00 	movabs $0x801aa0,%rdx
+  8000ee:	00 00 00 
+  8000f1:	be 24 00 00 00       	mov    $0x24,%esi
+  8000f6:	48 bf 90 1a 80 00 00 	movabs $0x801a90,%rdi
+  8000fd:	00 00 00 
+  800100:	b8 00 00 00 00       	mov    $0x0,%eax
+  800105:	49 b9 da 05 80 00 00 	movabs $0x8005da,%r9
+  80010c:	00 00 00 
+  80010f:	41 ff d1             	call   *%r9
+	}
+}
+  800112:	48 83 c4 10          	add    $0x10,%rsp
+  800116:	5b                   	pop    %rbx
+  800117:	41 5c                	pop    %r12
+  800119:	41 5d                	pop    %r13
+  80011b:	41 5e                	pop    %r14
+  80011d:	5d                   	pop    %rbp
+  80011e:	c3                   	ret
+
+000000000080011f <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80011f:	55                   	push   %rbp
+  800120:	48 89 e5             	mov    %rsp,%rbp
+  800123:	41 57                	push   %r15
+  800125:	41 56                	push   %r14
+  800127:	41 55                	push   %r13
+  800129:	41 54                	push   %r12
+  80012b:	53                   	push   %rbx
+  80012c:	48 83 ec 10          	sub    $0x10,%rsp
+	static const char msg[] = "ringtest: hello from the ring\n";
+	uint64_t start, direct, ringed;
+	int i, r;
+
+	submit(SYS_cputs, (uint64_t) msg, sizeof(msg) - 1, 0, 0, 0, 0);
+  800130:	6a 00                	push   $0x0
+  800132:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800138:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80013e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800143:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800148:	48 be 00 1c 80 00 00 	movabs $0x801c00,%rsi
+  80014f:	00 00 00 
+  800152:	bf 00 00 00 00       	mov    $0x0,%edi
+  800157:	48 bb 33 00 80 00 00 	movabs $0x800033,%rbx
+  80015e:	00 00 00 
+  800161:	ff d3                	call   *%rbx
+	submit(SYS_page_alloc, 0, (uint64_t) UTEMP, PTE_P|PTE_U|PTE_W, 0, 0, 1);
+  800163:	48 c7 04 24 01 00 00 	movq   $0x1,(%rsp)
+  80016a:	00 
+  80016b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800171:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800177:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80017c:	ba 00 00 40 00       	mov    $0x400000,%edx
+  800181:	be 00 00 00 00       	mov    $0x0,%esi
+  800186:	bf 04 00 00 00       	mov    $0x4,%edi
+  80018b:	ff d3                	call   *%rbx
+	submit(SYS_page_map, 0, (uint64_t) UTEMP, 0, (uint64_t) UTEMP + PGSIZE,
+  80018d:	48 c7 04 24 02 00 00 	movq   $0x2,(%rsp)
+  800194:	00 
+  800195:	41 b9 05 00 00 00    	mov    $0x5,%r9d
+  80019b:	41 b8 00 10 40 00    	mov    $0x401000,%r8d
+  8001a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001a6:	ba 00 00 40 00       	mov    $0x400000,%edx
+  8001ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8001b0:	bf 05 00 00 00       	mov    $0x5,%edi
+  8001b5:	ff d3                	call   *%rbx
+	       PTE_P|PTE_U, 2);
+	submit(SYS_getenvid, 0, 0, 0, 0, 0, 3);
+  8001b7:	48 c7 04 24 03 00 00 	movq   $0x3,(%rsp)
+  8001be:	00 
+  8001bf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8001da:	bf 02 00 00 00       	mov    $0x2,%edi
+  8001df:	ff d3                	call   *%rbx
+	submit(SYS_yield, 0, 0, 0, 0, 0, 4);
+  8001e1:	48 c7 04 24 04 00 00 	movq   $0x4,(%rsp)
+  8001e8:	00 
+  8001e9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001ff:	be 00 00 00 00       	mov    $0x0,%esi
+  800204:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800209:	ff d3                	call   *%rbx
+	submit(SYS_cputs, ULIM, 10, 0, 0, 0, 5);
+  80020b:	48 c7 04 24 05 00 00 	movq   $0x5,(%rsp)
+  800212:	00 
+  800213:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800219:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80021f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800224:	ba 0a 00 00 00       	mov    $0xa,%edx
+  800229:	be 00 00 c0 bf       	mov    $0xbfc00000,%esi
+  80022e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800233:	ff d3                	call   *%rbx
+	if ((r = sys_ring_enter()) != 6)
+  800235:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  80023c:	00 00 00 
+  80023f:	ff d0                	call   *%rax
+  800241:	48 83 c4 10          	add    $0x10,%rsp
+  800245:	83 f8 06             	cmp    $0x6,%eax
+  800248:	0f 85 e3 01 00 00    	jne    800431 <umain+0x312>
+		panic("sys_ring_enter: %d completions, not 6", r);
+	reap(6);
+  80024e:	bf 06 00 00 00       	mov    $0x6,%edi
+  800253:	48 b8 81 00 80 00 00 	movabs $0x800081,%rax
+  80025a:	00 00 00 
+  80025d:	ff d0                	call   *%rax
+	assert(results[0] == 0 && results[1] == 0 && results[2] == 0);
+  80025f:	48 ba 00 40 80 00 00 	movabs $0x804000,%rdx
+  800266:	00 00 00 
+  800269:	48 8b 02             	mov    (%rdx),%rax
+  80026c:	48 0b 42 08          	or     0x8(%rdx),%rax
+  800270:	48 0b 42 10          	or     0x10(%rdx),%rax
+  800274:	0f 85 e4 01 00 00    	jne    80045e <umain+0x33f>
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  80027a:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800281:	00 
+	assert(results[3] == thisenv->env_id);
+  800282:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800287:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80028b:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80028f:	48 c1 e2 04          	shl    $0x4,%rdx
+  800293:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  80029a:	00 00 00 
+  80029d:	48 01 d0             	add    %rdx,%rax
+  8002a0:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+  8002a6:	48 98                	cltq
+  8002a8:	48 ba 00 40 80 00 00 	movabs $0x804000,%rdx
+  8002af:	00 00 00 
+  8002b2:	48 39 42 18          	cmp    %rax,0x18(%rdx)
+  8002b6:	0f 85 d7 01 00 00    	jne    800493 <umain+0x374>
+	assert(results[4] == -E_INVAL);
+  8002bc:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8002c3:	00 00 00 
+  8002c6:	48 83 78 20 fd       	cmpq   $0xfffffffffffffffd,0x20(%rax)
+  8002cb:	0f 85 f7 01 00 00    	jne    8004c8 <umain+0x3a9>
+	assert(results[5] == -E_FAULT);
+  8002d1:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8002d8:	00 00 00 
+  8002db:	48 83 78 28 fa       	cmpq   $0xfffffffffffffffa,0x28(%rax)
+  8002e0:	0f 85 17 02 00 00    	jne    8004fd <umain+0x3de>
+	*(int *) UTEMP = 0x1234;
+  8002e6:	c7 04 25 00 00 40 00 	movl   $0x1234,0x400000
+  8002ed:	34 12 00 00 
+	assert(*(int *) (UTEMP + PGSIZE) == 0x1234);
+  8002f1:	81 3c 25 00 10 40 00 	cmpl   $0x1234,0x401000
+  8002f8:	34 12 00 00 
+  8002fc:	0f 85 30 02 00 00    	jne    800532 <umain+0x413>
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint32_t lo, hi;
+	asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  800302:	0f 31                	rdtsc
+	return ((uint64_t) hi << 32) | lo;
+  800304:	48 c1 e2 20          	shl    $0x20,%rdx
+  800308:	89 c0                	mov    %eax,%eax
+  80030a:	48 09 c2             	or     %rax,%rdx
+  80030d:	49 89 d5             	mov    %rdx,%r13
+  800310:	bb 00 20 40 00       	mov    $0x402000,%ebx
+
+	start = read_tsc();
+	for (i = 0; i < NPAGES; i++)
+		if ((r = sys_page_map(0, UTEMP, 0, UTEMP + (i + 2) * PGSIZE, PTE_P|PTE_U)) < 0)
+  800315:	49 bc a9 14 80 00 00 	movabs $0x8014a9,%r12
+  80031c:	00 00 00 
+  80031f:	41 b8 05 00 00 00    	mov    $0x5,%r8d
+  800325:	48 89 d9             	mov    %rbx,%rcx
+  800328:	ba 00 00 00 00       	mov    $0x0,%edx
+  80032d:	be 00 00 40 00       	mov    $0x400000,%esi
+  800332:	bf 00 00 00 00       	mov    $0x0,%edi
+  800337:	41 ff d4             	call   *%r12
+  80033a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800341:	85 c0                	test   %eax,%eax
+  800343:	0f 88 1e 02 00 00    	js     800567 <umain+0x448>
+	for (i = 0; i < NPAGES; i++)
+  800349:	48 81 fb 00 20 42 00 	cmp    $0x422000,%rbx
+  800350:	75 cd                	jne    80031f <umain+0x200>
+	asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  800352:	0f 31                	rdtsc
+	return ((uint64_t) hi << 32) | lo;
+  800354:	48 c1 e2 20          	shl    $0x20,%rdx
+  800358:	89 c0                	mov    %eax,%eax
+  80035a:	48 09 c2             	or     %rax,%rdx
+			panic("sys_page_map: %e", r);
+	direct = read_tsc() - start;
+  80035d:	4c 29 ea             	sub    %r13,%rdx
+  800360:	49 89 d6             	mov    %rdx,%r14
+	asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  800363:	0f 31                	rdtsc
+	return ((uint64_t) hi << 32) | lo;
+  800365:	48 c1 e2 20          	shl    $0x20,%rdx
+  800369:	89 c0                	mov    %eax,%eax
+  80036b:	48 09 c2             	or     %rax,%rdx
+  80036e:	49 89 d7             	mov    %rdx,%r15
+  800371:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800376:	41 bc 00 20 40 00    	mov    $0x402000,%r12d
+
+	start = read_tsc();
+	for (i = 0; i < NPAGES; i++)
+		submit(SYS_page_map, 0, (uint64_t) UTEMP, 0,
+  80037c:	49 bd 33 00 80 00 00 	movabs $0x800033,%r13
+  800383:	00 00 00 
+  800386:	48 83 ec 08          	sub    $0x8,%rsp
+  80038a:	53                   	push   %rbx
+  80038b:	41 b9 05 00 00 00    	mov    $0x5,%r9d
+  800391:	4d 89 e0             	mov    %r12,%r8
+  800394:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800399:	ba 00 00 40 00       	mov    $0x400000,%edx
+  80039e:	be 00 00 00 00       	mov    $0x0,%esi
+  8003a3:	bf 05 00 00 00       	mov    $0x5,%edi
+  8003a8:	41 ff d5             	call   *%r13
+	for (i = 0; i < NPAGES; i++)
+  8003ab:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  8003b2:	48 83 c3 01          	add    $0x1,%rbx
+  8003b6:	48 83 c4 10          	add    $0x10,%rsp
+  8003ba:	48 83 fb 28          	cmp    $0x28,%rbx
+  8003be:	75 c6                	jne    800386 <umain+0x267>
+		       (uint64_t) UTEMP + (i + 2) * PGSIZE, PTE_P|PTE_U, 8 + i);
+	sys_ring_enter();
+  8003c0:	48 b8 48 16 80 00 00 	movabs $0x801648,%rax
+  8003c7:	00 00 00 
+  8003ca:	ff d0                	call   *%rax
+	reap(NPAGES);
+  8003cc:	bf 20 00 00 00       	mov    $0x20,%edi
+  8003d1:	48 b8 81 00 80 00 00 	movabs $0x800081,%rax
+  8003d8:	00 00 00 
+  8003db:	ff d0                	call   *%rax
+	asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  8003dd:	0f 31                	rdtsc
+	return ((uint64_t) hi << 32) | lo;
+  8003df:	48 c1 e2 20          	shl    $0x20,%rdx
+  8003e3:	89 c0                	mov    %eax,%eax
+  8003e5:	48 09 c2             	or     %rax,%rdx
+	ringed = read_tsc() - start;
+  8003e8:	48 89 d1             	mov    %rdx,%rcx
+  8003eb:	4c 29 f9             	sub    %r15,%rcx
+
+	cprintf("ringtest: %d page maps: %ld cycles direct, %ld cycles on the ring\n",
+  8003ee:	4c 89 f2             	mov    %r14,%rdx
+  8003f1:	be 20 00 00 00       	mov    $0x20,%esi
+  8003f6:	48 bf b8 1b 80 00 00 	movabs $0x801bb8,%rdi
+  8003fd:	00 00 00 
+  800400:	b8 00 00 00 00       	mov    $0x0,%eax
+  800405:	48 bb 79 07 80 00 00 	movabs $0x800779,%rbx
+  80040c:	00 00 00 
+  80040f:	ff d3                	call   *%rbx
+		NPAGES, direct, ringed);
+	cprintf("ringtest: OK\n");
+  800411:	48 bf 22 1b 80 00 00 	movabs $0x801b22,%rdi
+  800418:	00 00 00 
+  80041b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800420:	ff d3                	call   *%rbx
+}
+  800422:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800426:	5b                   	pop    %rbx
+  800427:	41 5c                	pop    %r12
+  800429:	41 5d                	pop    %r13
+  80042b:	41 5e                	pop    %r14
+  80042d:	41 5f                	pop    %r15
+  80042f:	5d                   	pop    %rbp
+  800430:	c3                   	ret
+		panic("sys_ring_enter: %d completions, not 6", r);
+  800431:	89 c1                	mov    %eax,%ecx
+  800433:	48 ba 30 1b 80 00 00 	movabs $0x801b30,%rdx
+  80043a:	00 00 00 
+  80043d:	be 38 00 00 00       	mov    $0x38,%esi
+  800442:	48 bf 90 1a 80 00 00 	movabs $0x801a90,%rdi
+  800449:	00 00 00 
+  80044c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800451:	49 b8 da 05 80 00 00 	movabs $0x8005da,%r8
+  800458:	00 00 00 
+  80045b:	41 ff d0             	call   *%r8
+	assert(results[0] == 0 && results[1] == 0 && results[2] == 0);
+  80045e:	48 b9 58 1b 80 00 00 	movabs $0x801b58,%rcx
+  800465:	00 00 00 
+  800468:	48 ba b0 1a 80 00 00 	movabs $0x801ab0,%rdx
+  80046f:	00 00 00 
+  800472:	be 3a 00 00 00       	mov    $0x3a,%esi
+  800477:	48 bf 90 1a 80 00 00 	movabs $0x801a90,%rdi
+  80047e:	00 00 00 
+  800481:	b8 00 00 00 00       	mov    $0x0,%eax
+  800486:	49 b8 da 05 80 00 00 	movabs $0x8005da,%r8
+  80048d:	00 00 00 
+  800490:	41 ff d0             	call   *%r8
+	assert(results[3] == thisenv->env_id);
+  800493:	48 b9 c5 1a 80 00 00 	movabs $0x801ac5,%rcx
+  80049a:	00 00 00 
+  80049d:	48 ba b0 1a 80 00 00 	movabs $0x801ab0,%rdx
+  8004a4:	00 00 00 
+  8004a7:	be 3b 00 00 00       	mov    $0x3b,%esi
+  8004ac:	48 bf 90 1a 80 00 00 	movabs $0x801a90,%rdi
+  8004b3:	00 00 00 
+  8004b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004bb:	49 b8 da 05 80 00 00 	movabs $0x8005da,%r8
+  8004c2:	00 00 00 
+  8004c5:	41 ff d0             	call   *%r8
+	assert(results[4] == -E_INVAL);
+  8004c8:	48 b9 e3 1a 80 00 00 	movabs $0x801ae3,%rcx
+  8004cf:	00 00 00 
+  8004d2:	48 ba b0 1a 80 00 00 	movabs $0x801ab0,%rdx
+  8004d9:	00 00 00 
+  8004dc:	be 3c 00 00 00       	mov    $0x3c,%esi
+  8004e1:	48 bf 90 1a 80 00 00 	movabs $0x801a90,%rdi
+  8004e8:	00 00 00 
+  8004eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f0:	49 b8 da 05 80 00 00 	movabs $0x8005da,%r8
+  8004f7:	00 00 00 
+  8004fa:	41 ff d0             	call   *%r8
+	assert(results[5] == -E_FAULT);
+  8004fd:	48 b9 fa 1a 80 00 00 	movabs $0x801afa,%rcx
+  800504:	00 00 00 
+  800507:	48 ba b0 1a 80 00 00 	movabs $0x801ab0,%rdx
+  80050e:	00 00 00 
+  800511:	be 3d 00 00 00       	mov    $0x3d,%esi
+  800516:	48 bf 90 1a 80 00 00 	movabs $0x801a90,%rdi
+  80051d:	00 00 00 
+  800520:	b8 00 00 00 00       	mov    $0x0,%eax
+  800525:	49 b8 da 05 80 00 00 	movabs $0x8005da,%r8
+  80052c:	00 00 00 
+  80052f:	41 ff d0             	call   *%r8
+	assert(*(int *) (UTEMP + PGSIZE) == 0x1234);
+  800532:	48 b9 90 1b 80 00 00 	movabs $0x801b90,%rcx
+  800539:	00 00 00 
+  80053c:	48 ba b0 1a 80 00 00 	movabs $0x801ab0,%rdx
+  800543:	00 00 00 
+  800546:	be 3f 00 00 00       	mov    $0x3f,%esi
+  80054b:	48 bf 90 1a 80 00 00 	movabs $0x801a90,%rdi
+  800552:	00 00 00 
+  800555:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055a:	49 b8 da 05 80 00 00 	movabs $0x8005da,%r8
+  800561:	00 00 00 
+  800564:	41 ff d0             	call   *%r8
+			panic("sys_page_map: %e", r);
+  800567:	89 c1                	mov    %eax,%ecx
+  800569:	48 ba 11 1b 80 00 00 	movabs $0x801b11,%rdx
+  800570:	00 00 00 
+  800573:	be 44 00 00 00       	mov    $0x44,%esi
+  800578:	48 bf 90 1a 80 00 00 	movabs $0x801a90,%rdi
+  80057f:	00 00 00 
+  800582:	b8 00 00 00 00       	mov    $0x0,%eax
+  800587:	49 b8 da 05 80 00 00 	movabs $0x8005da,%r8
+  80058e:	00 00 00 
+  800591:	41 ff d0             	call   *%r8
+
+0000000000800594 <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  800594:	55                   	push   %rbp
+  800595:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800598:	85 ff                	test   %edi,%edi
+  80059a:	7e 0d                	jle    8005a9 <libmain+0x15>
+		binaryname = argv[0];
+  80059c:	48 8b 06             	mov    (%rsi),%rax
+  80059f:	48 a3 00 30 80 00 00 	movabs %rax,0x803000
+  8005a6:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  8005a9:	48 b8 1f 01 80 00 00 	movabs $0x80011f,%rax
+  8005b0:	00 00 00 
+  8005b3:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8005b5:	48 b8 c3 05 80 00 00 	movabs $0x8005c3,%rax
+  8005bc:	00 00 00 
+  8005bf:	ff d0                	call   *%rax
+}
+  8005c1:	5d                   	pop    %rbp
+  8005c2:	c3                   	ret
+
+00000000008005c3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8005c3:	55                   	push   %rbp
+  8005c4:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  8005c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005cc:	48 b8 56 13 80 00 00 	movabs $0x801356,%rax
+  8005d3:	00 00 00 
+  8005d6:	ff d0                	call   *%rax
+}
+  8005d8:	5d                   	pop    %rbp
+  8005d9:	c3                   	ret
+
+00000000008005da <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8005da:	55                   	push   %rbp
+  8005db:	48 89 e5             	mov    %rsp,%rbp
+  8005de:	41 56                	push   %r14
+  8005e0:	41 55                	push   %r13
+  8005e2:	41 54                	push   %r12
+  8005e4:	53                   	push   %rbx
+  8005e5:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8005ec:	49 89 fc             	mov    %rdi,%r12
+  8005ef:	41 89 f5             	mov    %esi,%r13d
+  8005f2:	48 89 d3             	mov    %rdx,%rbx
+  8005f5:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8005fc:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800603:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  80060a:	84 c0                	test   %al,%al
+  80060c:	74 26                	je     800634 <_panic+0x5a>
+  80060e:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800615:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80061c:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800620:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800624:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800628:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80062c:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800630:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800634:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  80063b:	00 00 00 
+  80063e:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800645:	00 00 00 
+  800648:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80064c:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800653:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  80065a:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800661:	48 b8 00 30 80 00 00 	movabs $0x803000,%rax
+  800668:	00 00 00 
+  80066b:	4c 8b 30             	mov    (%rax),%r14
+  80066e:	48 b8 b1 13 80 00 00 	movabs $0x8013b1,%rax
+  800675:	00 00 00 
+  800678:	ff d0                	call   *%rax
+  80067a:	89 c6                	mov    %eax,%esi
+  80067c:	45 89 e8             	mov    %r13d,%r8d
+  80067f:	4c 89 e1             	mov    %r12,%rcx
+  800682:	4c 89 f2             	mov    %r14,%rdx
+  800685:	48 bf 30 1c 80 00 00 	movabs $0x801c30,%rdi
+  80068c:	00 00 00 
+  80068f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800694:	49 bc 79 07 80 00 00 	movabs $0x800779,%r12
+  80069b:	00 00 00 
+  80069e:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8006a1:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  8006a8:	48 89 df             	mov    %rbx,%rdi
+  8006ab:	48 b8 15 07 80 00 00 	movabs $0x800715,%rax
+  8006b2:	00 00 00 
+  8006b5:	ff d0                	call   *%rax
+	cprintf("\n");
+  8006b7:	48 bf 2e 1b 80 00 00 	movabs $0x801b2e,%rdi
+  8006be:	00 00 00 
+  8006c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c6:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8006c9:	cc                   	int3
+	while (1)
+  8006ca:	eb fd                	jmp    8006c9 <_panic+0xef>
+
+00000000008006cc <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8006cc:	55                   	push   %rbp
+  8006cd:	48 89 e5             	mov    %rsp,%rbp
+  8006d0:	53                   	push   %rbx
+  8006d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8006d5:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  8006d8:	8b 06                	mov    (%rsi),%eax
+  8006da:	8d 50 01             	lea    0x1(%rax),%edx
+  8006dd:	89 16                	mov    %edx,(%rsi)
+  8006df:	48 98                	cltq
+  8006e1:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  8006e6:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8006ec:	74 0a                	je     8006f8 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8006ee:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8006f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006f6:	c9                   	leave
+  8006f7:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8006f8:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8006fc:	be ff 00 00 00       	mov    $0xff,%esi
+  800701:	48 b8 1e 13 80 00 00 	movabs $0x80131e,%rax
+  800708:	00 00 00 
+  80070b:	ff d0                	call   *%rax
+		b->idx = 0;
+  80070d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800713:	eb d9                	jmp    8006ee <putch+0x22>
+
+0000000000800715 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800715:	55                   	push   %rbp
+  800716:	48 89 e5             	mov    %rsp,%rbp
+  800719:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800720:	48 89 fa             	mov    %rdi,%rdx
+  800723:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  800726:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  80072d:	00 00 00 
+	b.cnt = 0;
+  800730:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800737:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80073a:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  800741:	48 bf cc 06 80 00 00 	movabs $0x8006cc,%rdi
+  800748:	00 00 00 
+  80074b:	48 b8 33 09 80 00 00 	movabs $0x800933,%rax
+  800752:	00 00 00 
+  800755:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  800757:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  80075e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800765:	48 b8 1e 13 80 00 00 	movabs $0x80131e,%rax
+  80076c:	00 00 00 
+  80076f:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  800771:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  800777:	c9                   	leave
+  800778:	c3                   	ret
+
+0000000000800779 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800779:	55                   	push   %rbp
+  80077a:	48 89 e5             	mov    %rsp,%rbp
+  80077d:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800784:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80078b:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800792:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800799:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8007a0:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8007a7:	84 c0                	test   %al,%al
+  8007a9:	74 20                	je     8007cb <cprintf+0x52>
+  8007ab:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8007af:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8007b3:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8007b7:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8007bb:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8007bf:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8007c3:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8007c7:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8007cb:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  8007d2:	00 00 00 
+  8007d5:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8007dc:	00 00 00 
+  8007df:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007e3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8007ea:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8007f1:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  8007f8:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  8007ff:	48 b8 15 07 80 00 00 	movabs $0x800715,%rax
+  800806:	00 00 00 
+  800809:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  80080b:	c9                   	leave
+  80080c:	c3                   	ret
+
+000000000080080d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80080d:	55                   	push   %rbp
+  80080e:	48 89 e5             	mov    %rsp,%rbp
+  800811:	41 57                	push   %r15
+  800813:	41 56                	push   %r14
+  800815:	41 55                	push   %r13
+  800817:	41 54                	push   %r12
+  800819:	53                   	push   %rbx
+  80081a:	48 83 ec 18          	sub    $0x18,%rsp
+  80081e:	49 89 fc             	mov    %rdi,%r12
+  800821:	49 89 f5             	mov    %rsi,%r13
+  800824:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800828:	44 89 c3             	mov    %r8d,%ebx
+  80082b:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80082e:	41 89 cf             	mov    %ecx,%r15d
+  800831:	4c 39 fa             	cmp    %r15,%rdx
+  800834:	72 29                	jb     80085f <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800836:	48 89 d0             	mov    %rdx,%rax
+  800839:	ba 00 00 00 00       	mov    $0x0,%edx
+  80083e:	49 f7 f7             	div    %r15
+  800841:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800845:	48 89 c2             	mov    %rax,%rdx
+  800848:	48 b8 0d 08 80 00 00 	movabs $0x80080d,%rax
+  80084f:	00 00 00 
+  800852:	ff d0                	call   *%rax
+  800854:	eb 10                	jmp    800866 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800856:	4c 89 ee             	mov    %r13,%rsi
+  800859:	44 89 f7             	mov    %r14d,%edi
+  80085c:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  80085f:	83 eb 01             	sub    $0x1,%ebx
+  800862:	85 db                	test   %ebx,%ebx
+  800864:	7f f0                	jg     800856 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800866:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80086a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80086f:	49 f7 f7             	div    %r15
+  800872:	48 b8 53 1c 80 00 00 	movabs $0x801c53,%rax
+  800879:	00 00 00 
+  80087c:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  800880:	4c 89 ee             	mov    %r13,%rsi
+  800883:	41 ff d4             	call   *%r12
+}
+  800886:	48 83 c4 18          	add    $0x18,%rsp
+  80088a:	5b                   	pop    %rbx
+  80088b:	41 5c                	pop    %r12
+  80088d:	41 5d                	pop    %r13
+  80088f:	41 5e                	pop    %r14
+  800891:	41 5f                	pop    %r15
+  800893:	5d                   	pop    %rbp
+  800894:	c3                   	ret
+
+0000000000800895 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  800895:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  800899:	48 8b 06             	mov    (%rsi),%rax
+  80089c:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8008a0:	73 0a                	jae    8008ac <sprintputch+0x17>
+		*b->buf++ = ch;
+  8008a2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008a6:	48 89 16             	mov    %rdx,(%rsi)
+  8008a9:	40 88 38             	mov    %dil,(%rax)
+}
+  8008ac:	c3                   	ret
+
+00000000008008ad <printfmt>:
+{
+  8008ad:	55                   	push   %rbp
+  8008ae:	48 89 e5             	mov    %rsp,%rbp
+  8008b1:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8008b8:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8008bf:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8008c6:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8008cd:	84 c0                	test   %al,%al
+  8008cf:	74 20                	je     8008f1 <printfmt+0x44>
+  8008d1:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8008d5:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8008d9:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8008dd:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8008e1:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8008e5:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8008e9:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8008ed:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  8008f1:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8008f8:	00 00 00 
+  8008fb:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800902:	00 00 00 
+  800905:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800909:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800910:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800917:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80091e:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800925:	48 b8 33 09 80 00 00 	movabs $0x800933,%rax
+  80092c:	00 00 00 
+  80092f:	ff d0                	call   *%rax
+}
+  800931:	c9                   	leave
+  800932:	c3                   	ret
+
+0000000000800933 <vprintfmt>:
+{
+  800933:	55                   	push   %rbp
+  800934:	48 89 e5             	mov    %rsp,%rbp
+  800937:	41 57                	push   %r15
+  800939:	41 56                	push   %r14
+  80093b:	41 55                	push   %r13
+  80093d:	41 54                	push   %r12
+  80093f:	53                   	push   %rbx
+  800940:	48 83 ec 48          	sub    $0x48,%rsp
+  800944:	49 89 fe             	mov    %rdi,%r14
+  800947:	49 89 f5             	mov    %rsi,%r13
+  80094a:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  80094d:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  800951:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  800955:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800959:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80095d:	eb 09                	jmp    800968 <vprintfmt+0x35>
+			putch(ch, putdat);
+  80095f:	4c 89 ee             	mov    %r13,%rsi
+  800962:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800965:	4c 89 e3             	mov    %r12,%rbx
+  800968:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80096c:	0f b6 3b             	movzbl (%rbx),%edi
+  80096f:	83 ff 25             	cmp    $0x25,%edi
+  800972:	74 13                	je     800987 <vprintfmt+0x54>
+			if (ch == '\0')
+  800974:	85 ff                	test   %edi,%edi
+  800976:	75 e7                	jne    80095f <vprintfmt+0x2c>
+}
+  800978:	48 83 c4 48          	add    $0x48,%rsp
+  80097c:	5b                   	pop    %rbx
+  80097d:	41 5c                	pop    %r12
+  80097f:	41 5d                	pop    %r13
+  800981:	41 5e                	pop    %r14
+  800983:	41 5f                	pop    %r15
+  800985:	5d                   	pop    %rbp
+  800986:	c3                   	ret
+		padc = ' ';
+  800987:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  80098b:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  800992:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  800998:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  80099f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8009a4:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8009a9:	41 0f b6 14 24       	movzbl (%r12),%edx
+  8009ae:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  8009b1:	3c 55                	cmp    $0x55,%al
+  8009b3:	0f 87 4f 05 00 00    	ja     800f08 <vprintfmt+0x5d5>
+  8009b9:	0f b6 c0             	movzbl %al,%eax
+  8009bc:	48 be 20 1d 80 00 00 	movabs $0x801d20,%rsi
+  8009c3:	00 00 00 
+  8009c6:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  8009c9:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  8009cc:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  8009d0:	eb d2                	jmp    8009a4 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8009d2:	49 89 dc             	mov    %rbx,%r12
+  8009d5:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  8009d9:	eb c9                	jmp    8009a4 <vprintfmt+0x71>
+  8009db:	0f b6 d2             	movzbl %dl,%edx
+  8009de:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  8009e1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  8009e7:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  8009eb:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  8009f0:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  8009f5:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  8009f8:	83 f8 09             	cmp    $0x9,%eax
+  8009fb:	77 20                	ja     800a1d <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  8009fd:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  800a01:	eb e4                	jmp    8009e7 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  800a03:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a06:	83 f8 2f             	cmp    $0x2f,%eax
+  800a09:	77 27                	ja     800a32 <vprintfmt+0xff>
+  800a0b:	89 c2                	mov    %eax,%edx
+  800a0d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a11:	83 c0 08             	add    $0x8,%eax
+  800a14:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a17:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  800a1a:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  800a1d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800a21:	79 81                	jns    8009a4 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  800a23:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  800a27:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800a2d:	e9 72 ff ff ff       	jmp    8009a4 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  800a32:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a36:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3e:	eb d7                	jmp    800a17 <vprintfmt+0xe4>
+			if (width < 0)
+  800a40:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  800a43:	85 f6                	test   %esi,%esi
+  800a45:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a4a:	0f 49 c6             	cmovns %esi,%eax
+  800a4d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800a50:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800a53:	e9 4c ff ff ff       	jmp    8009a4 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800a58:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  800a5b:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  800a62:	e9 3d ff ff ff       	jmp    8009a4 <vprintfmt+0x71>
+			lflag++;
+  800a67:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800a6a:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800a6d:	e9 32 ff ff ff       	jmp    8009a4 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  800a72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a75:	83 f8 2f             	cmp    $0x2f,%eax
+  800a78:	77 19                	ja     800a93 <vprintfmt+0x160>
+  800a7a:	89 c2                	mov    %eax,%edx
+  800a7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a80:	83 c0 08             	add    $0x8,%eax
+  800a83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a86:	8b 3a                	mov    (%rdx),%edi
+  800a88:	4c 89 ee             	mov    %r13,%rsi
+  800a8b:	41 ff d6             	call   *%r14
+			break;
+  800a8e:	e9 d5 fe ff ff       	jmp    800968 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  800a93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9f:	eb e5                	jmp    800a86 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  800aa1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa4:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa7:	77 5a                	ja     800b03 <vprintfmt+0x1d0>
+  800aa9:	89 c2                	mov    %eax,%edx
+  800aab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aaf:	83 c0 08             	add    $0x8,%eax
+  800ab2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800ab5:	8b 02                	mov    (%rdx),%eax
+  800ab7:	89 c1                	mov    %eax,%ecx
+  800ab9:	f7 d9                	neg    %ecx
+  800abb:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800abe:	83 f9 08             	cmp    $0x8,%ecx
+  800ac1:	7f 4e                	jg     800b11 <vprintfmt+0x1de>
+  800ac3:	48 63 c1             	movslq %ecx,%rax
+  800ac6:	48 ba e0 1f 80 00 00 	movabs $0x801fe0,%rdx
+  800acd:	00 00 00 
+  800ad0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800ad4:	48 85 c0             	test   %rax,%rax
+  800ad7:	74 38                	je     800b11 <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800ad9:	48 89 c1             	mov    %rax,%rcx
+  800adc:	48 ba c2 1a 80 00 00 	movabs $0x801ac2,%rdx
+  800ae3:	00 00 00 
+  800ae6:	4c 89 ee             	mov    %r13,%rsi
+  800ae9:	4c 89 f7             	mov    %r14,%rdi
+  800aec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af1:	49 b8 ad 08 80 00 00 	movabs $0x8008ad,%r8
+  800af8:	00 00 00 
+  800afb:	41 ff d0             	call   *%r8
+  800afe:	e9 65 fe ff ff       	jmp    800968 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  800b03:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b07:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b0b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0f:	eb a4                	jmp    800ab5 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  800b11:	48 ba 6b 1c 80 00 00 	movabs $0x801c6b,%rdx
+  800b18:	00 00 00 
+  800b1b:	4c 89 ee             	mov    %r13,%rsi
+  800b1e:	4c 89 f7             	mov    %r14,%rdi
+  800b21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b26:	49 b8 ad 08 80 00 00 	movabs $0x8008ad,%r8
+  800b2d:	00 00 00 
+  800b30:	41 ff d0             	call   *%r8
+  800b33:	e9 30 fe ff ff       	jmp    800968 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800b38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3e:	77 36                	ja     800b76 <vprintfmt+0x243>
+  800b40:	89 c2                	mov    %eax,%edx
+  800b42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b46:	83 c0 08             	add    $0x8,%eax
+  800b49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b4c:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800b4f:	48 85 c9             	test   %rcx,%rcx
+  800b52:	48 b8 64 1c 80 00 00 	movabs $0x801c64,%rax
+  800b59:	00 00 00 
+  800b5c:	48 0f 45 c1          	cmovne %rcx,%rax
+  800b60:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800b64:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b68:	7e 06                	jle    800b70 <vprintfmt+0x23d>
+  800b6a:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800b6e:	75 14                	jne    800b84 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b70:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800b74:	eb 64                	jmp    800bda <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800b76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b82:	eb c8                	jmp    800b4c <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b84:	49 63 f7             	movslq %r15d,%rsi
+  800b87:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800b8b:	48 b8 16 10 80 00 00 	movabs $0x801016,%rax
+  800b92:	00 00 00 
+  800b95:	ff d0                	call   *%rax
+  800b97:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800b9a:	29 c1                	sub    %eax,%ecx
+  800b9c:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800b9f:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  800ba2:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800ba6:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ba9:	eb 0d                	jmp    800bb8 <vprintfmt+0x285>
+					putch(padc, putdat);
+  800bab:	4c 89 ee             	mov    %r13,%rsi
+  800bae:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  800bb1:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800bb4:	41 83 ec 01          	sub    $0x1,%r12d
+  800bb8:	45 85 e4             	test   %r12d,%r12d
+  800bbb:	7f ee                	jg     800bab <vprintfmt+0x278>
+  800bbd:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  800bc0:	85 c9                	test   %ecx,%ecx
+  800bc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc7:	0f 49 c1             	cmovns %ecx,%eax
+  800bca:	29 c1                	sub    %eax,%ecx
+  800bcc:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  800bcf:	eb 9f                	jmp    800b70 <vprintfmt+0x23d>
+					putch(ch, putdat);
+  800bd1:	4c 89 ee             	mov    %r13,%rsi
+  800bd4:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800bd7:	4c 89 e2             	mov    %r12,%rdx
+  800bda:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800bde:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800be4:	0f be f8             	movsbl %al,%edi
+  800be7:	85 ff                	test   %edi,%edi
+  800be9:	74 29                	je     800c14 <vprintfmt+0x2e1>
+  800beb:	45 85 ff             	test   %r15d,%r15d
+  800bee:	78 06                	js     800bf6 <vprintfmt+0x2c3>
+  800bf0:	41 83 ef 01          	sub    $0x1,%r15d
+  800bf4:	78 1e                	js     800c14 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800bf6:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800bfa:	74 d5                	je     800bd1 <vprintfmt+0x29e>
+  800bfc:	0f be c0             	movsbl %al,%eax
+  800bff:	83 e8 20             	sub    $0x20,%eax
+  800c02:	83 f8 5e             	cmp    $0x5e,%eax
+  800c05:	76 ca                	jbe    800bd1 <vprintfmt+0x29e>
+					putch('?', putdat);
+  800c07:	4c 89 ee             	mov    %r13,%rsi
+  800c0a:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800c0f:	41 ff d6             	call   *%r14
+  800c12:	eb c3                	jmp    800bd7 <vprintfmt+0x2a4>
+  800c14:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800c18:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800c1b:	41 01 c4             	add    %eax,%r12d
+  800c1e:	41 29 d4             	sub    %edx,%r12d
+  800c21:	eb 0f                	jmp    800c32 <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  800c23:	4c 89 ee             	mov    %r13,%rsi
+  800c26:	bf 20 00 00 00       	mov    $0x20,%edi
+  800c2b:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800c2e:	41 83 ec 01          	sub    $0x1,%r12d
+  800c32:	45 85 e4             	test   %r12d,%r12d
+  800c35:	7f ec                	jg     800c23 <vprintfmt+0x2f0>
+  800c37:	e9 2c fd ff ff       	jmp    800968 <vprintfmt+0x35>
+	if (lflag >= 2)
+  800c3c:	83 f9 01             	cmp    $0x1,%ecx
+  800c3f:	7f 1d                	jg     800c5e <vprintfmt+0x32b>
+	else if (lflag)
+  800c41:	85 c9                	test   %ecx,%ecx
+  800c43:	74 5e                	je     800ca3 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800c45:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c48:	83 f8 2f             	cmp    $0x2f,%eax
+  800c4b:	77 48                	ja     800c95 <vprintfmt+0x362>
+  800c4d:	89 c2                	mov    %eax,%edx
+  800c4f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c53:	83 c0 08             	add    $0x8,%eax
+  800c56:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c59:	4c 8b 22             	mov    (%rdx),%r12
+  800c5c:	eb 17                	jmp    800c75 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800c5e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c61:	83 f8 2f             	cmp    $0x2f,%eax
+  800c64:	77 21                	ja     800c87 <vprintfmt+0x354>
+  800c66:	89 c2                	mov    %eax,%edx
+  800c68:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c6c:	83 c0 08             	add    $0x8,%eax
+  800c6f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c72:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800c75:	4d 85 e4             	test   %r12,%r12
+  800c78:	78 50                	js     800cca <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  800c7a:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800c7d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800c82:	e9 b4 01 00 00       	jmp    800e3b <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800c87:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c8b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c93:	eb dd                	jmp    800c72 <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800c95:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c99:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca1:	eb b6                	jmp    800c59 <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800ca3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca9:	77 11                	ja     800cbc <vprintfmt+0x389>
+  800cab:	89 c2                	mov    %eax,%edx
+  800cad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb1:	83 c0 08             	add    $0x8,%eax
+  800cb4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb7:	4c 63 22             	movslq (%rdx),%r12
+  800cba:	eb b9                	jmp    800c75 <vprintfmt+0x342>
+  800cbc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc8:	eb ed                	jmp    800cb7 <vprintfmt+0x384>
+				putch('-', putdat);
+  800cca:	4c 89 ee             	mov    %r13,%rsi
+  800ccd:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800cd2:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800cd5:	4c 89 e2             	mov    %r12,%rdx
+  800cd8:	48 f7 da             	neg    %rdx
+			base = 10;
+  800cdb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800ce0:	e9 56 01 00 00       	jmp    800e3b <vprintfmt+0x508>
+	if (lflag >= 2)
+  800ce5:	83 f9 01             	cmp    $0x1,%ecx
+  800ce8:	7f 25                	jg     800d0f <vprintfmt+0x3dc>
+	else if (lflag)
+  800cea:	85 c9                	test   %ecx,%ecx
+  800cec:	74 5e                	je     800d4c <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800cee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf1:	83 f8 2f             	cmp    $0x2f,%eax
+  800cf4:	77 48                	ja     800d3e <vprintfmt+0x40b>
+  800cf6:	89 c2                	mov    %eax,%edx
+  800cf8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cfc:	83 c0 08             	add    $0x8,%eax
+  800cff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d02:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800d05:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800d0a:	e9 2c 01 00 00       	jmp    800e3b <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800d0f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d12:	83 f8 2f             	cmp    $0x2f,%eax
+  800d15:	77 19                	ja     800d30 <vprintfmt+0x3fd>
+  800d17:	89 c2                	mov    %eax,%edx
+  800d19:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d1d:	83 c0 08             	add    $0x8,%eax
+  800d20:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d23:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800d26:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800d2b:	e9 0b 01 00 00       	jmp    800e3b <vprintfmt+0x508>
+  800d30:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d34:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d38:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d3c:	eb e5                	jmp    800d23 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800d3e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d42:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d46:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d4a:	eb b6                	jmp    800d02 <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800d4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d4f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d52:	77 18                	ja     800d6c <vprintfmt+0x439>
+  800d54:	89 c2                	mov    %eax,%edx
+  800d56:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d5a:	83 c0 08             	add    $0x8,%eax
+  800d5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d60:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800d62:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800d67:	e9 cf 00 00 00       	jmp    800e3b <vprintfmt+0x508>
+  800d6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d70:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d78:	eb e6                	jmp    800d60 <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800d7a:	83 f9 01             	cmp    $0x1,%ecx
+  800d7d:	7f 25                	jg     800da4 <vprintfmt+0x471>
+	else if (lflag)
+  800d7f:	85 c9                	test   %ecx,%ecx
+  800d81:	74 5b                	je     800dde <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800d83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d86:	83 f8 2f             	cmp    $0x2f,%eax
+  800d89:	77 45                	ja     800dd0 <vprintfmt+0x49d>
+  800d8b:	89 c2                	mov    %eax,%edx
+  800d8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d91:	83 c0 08             	add    $0x8,%eax
+  800d94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d97:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800d9a:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800d9f:	e9 97 00 00 00       	jmp    800e3b <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800da4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800da7:	83 f8 2f             	cmp    $0x2f,%eax
+  800daa:	77 16                	ja     800dc2 <vprintfmt+0x48f>
+  800dac:	89 c2                	mov    %eax,%edx
+  800dae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800db2:	83 c0 08             	add    $0x8,%eax
+  800db5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800db8:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800dbb:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800dc0:	eb 79                	jmp    800e3b <vprintfmt+0x508>
+  800dc2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dc6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dce:	eb e8                	jmp    800db8 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800dd0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dd4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dd8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ddc:	eb b9                	jmp    800d97 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800dde:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800de1:	83 f8 2f             	cmp    $0x2f,%eax
+  800de4:	77 15                	ja     800dfb <vprintfmt+0x4c8>
+  800de6:	89 c2                	mov    %eax,%edx
+  800de8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dec:	83 c0 08             	add    $0x8,%eax
+  800def:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800df2:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800df4:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800df9:	eb 40                	jmp    800e3b <vprintfmt+0x508>
+  800dfb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e07:	eb e9                	jmp    800df2 <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800e09:	4c 89 ee             	mov    %r13,%rsi
+  800e0c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800e11:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800e14:	4c 89 ee             	mov    %r13,%rsi
+  800e17:	bf 78 00 00 00       	mov    $0x78,%edi
+  800e1c:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800e1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e22:	83 f8 2f             	cmp    $0x2f,%eax
+  800e25:	77 34                	ja     800e5b <vprintfmt+0x528>
+  800e27:	89 c2                	mov    %eax,%edx
+  800e29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e2d:	83 c0 08             	add    $0x8,%eax
+  800e30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800e33:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800e36:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800e3b:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800e40:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800e44:	4c 89 ee             	mov    %r13,%rsi
+  800e47:	4c 89 f7             	mov    %r14,%rdi
+  800e4a:	48 b8 0d 08 80 00 00 	movabs $0x80080d,%rax
+  800e51:	00 00 00 
+  800e54:	ff d0                	call   *%rax
+			break;
+  800e56:	e9 0d fb ff ff       	jmp    800968 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800e5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e67:	eb ca                	jmp    800e33 <vprintfmt+0x500>
+	if (lflag >= 2)
+  800e69:	83 f9 01             	cmp    $0x1,%ecx
+  800e6c:	7f 22                	jg     800e90 <vprintfmt+0x55d>
+	else if (lflag)
+  800e6e:	85 c9                	test   %ecx,%ecx
+  800e70:	74 58                	je     800eca <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800e72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e75:	83 f8 2f             	cmp    $0x2f,%eax
+  800e78:	77 42                	ja     800ebc <vprintfmt+0x589>
+  800e7a:	89 c2                	mov    %eax,%edx
+  800e7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e80:	83 c0 08             	add    $0x8,%eax
+  800e83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e86:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800e89:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800e8e:	eb ab                	jmp    800e3b <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800e90:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e93:	83 f8 2f             	cmp    $0x2f,%eax
+  800e96:	77 16                	ja     800eae <vprintfmt+0x57b>
+  800e98:	89 c2                	mov    %eax,%edx
+  800e9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e9e:	83 c0 08             	add    $0x8,%eax
+  800ea1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ea4:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800ea7:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800eac:	eb 8d                	jmp    800e3b <vprintfmt+0x508>
+  800eae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eb2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800eb6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800eba:	eb e8                	jmp    800ea4 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800ebc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ec0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ec4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ec8:	eb bc                	jmp    800e86 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800eca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ecd:	83 f8 2f             	cmp    $0x2f,%eax
+  800ed0:	77 18                	ja     800eea <vprintfmt+0x5b7>
+  800ed2:	89 c2                	mov    %eax,%edx
+  800ed4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ed8:	83 c0 08             	add    $0x8,%eax
+  800edb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ede:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800ee0:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800ee5:	e9 51 ff ff ff       	jmp    800e3b <vprintfmt+0x508>
+  800eea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ef2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ef6:	eb e6                	jmp    800ede <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800ef8:	4c 89 ee             	mov    %r13,%rsi
+  800efb:	bf 25 00 00 00       	mov    $0x25,%edi
+  800f00:	41 ff d6             	call   *%r14
+			break;
+  800f03:	e9 60 fa ff ff       	jmp    800968 <vprintfmt+0x35>
+			putch('%', putdat);
+  800f08:	4c 89 ee             	mov    %r13,%rsi
+  800f0b:	bf 25 00 00 00       	mov    $0x25,%edi
+  800f10:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800f13:	4c 89 e3             	mov    %r12,%rbx
+  800f16:	eb 04                	jmp    800f1c <vprintfmt+0x5e9>
+  800f18:	48 83 eb 01          	sub    $0x1,%rbx
+  800f1c:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800f20:	75 f6                	jne    800f18 <vprintfmt+0x5e5>
+  800f22:	e9 41 fa ff ff       	jmp    800968 <vprintfmt+0x35>
+
+0000000000800f27 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800f27:	55                   	push   %rbp
+  800f28:	48 89 e5             	mov    %rsp,%rbp
+  800f2b:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800f2f:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800f33:	48 63 c6             	movslq %esi,%rax
+  800f36:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800f3b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800f3f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800f46:	48 85 ff             	test   %rdi,%rdi
+  800f49:	74 2a                	je     800f75 <vsnprintf+0x4e>
+  800f4b:	85 f6                	test   %esi,%esi
+  800f4d:	7e 26                	jle    800f75 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800f4f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800f53:	48 bf 95 08 80 00 00 	movabs $0x800895,%rdi
+  800f5a:	00 00 00 
+  800f5d:	48 b8 33 09 80 00 00 	movabs $0x800933,%rax
+  800f64:	00 00 00 
+  800f67:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800f69:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800f6d:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800f70:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800f73:	c9                   	leave
+  800f74:	c3                   	ret
+		return -E_INVAL;
+  800f75:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f7a:	eb f7                	jmp    800f73 <vsnprintf+0x4c>
+
+0000000000800f7c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800f7c:	55                   	push   %rbp
+  800f7d:	48 89 e5             	mov    %rsp,%rbp
+  800f80:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800f87:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f8e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f95:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f9c:	84 c0                	test   %al,%al
+  800f9e:	74 20                	je     800fc0 <snprintf+0x44>
+  800fa0:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800fa4:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800fa8:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800fac:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800fb0:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800fb4:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800fb8:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800fbc:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800fc0:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800fc7:	00 00 00 
+  800fca:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800fd1:	00 00 00 
+  800fd4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800fd8:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800fdf:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800fe6:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800fed:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800ff4:	48 b8 27 0f 80 00 00 	movabs $0x800f27,%rax
+  800ffb:	00 00 00 
+  800ffe:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  801000:	c9                   	leave
+  801001:	c3                   	ret
+
+0000000000801002 <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801002:	ba 00 00 00 00       	mov    $0x0,%edx
+  801007:	48 89 d0             	mov    %rdx,%rax
+  80100a:	48 83 c2 01          	add    $0x1,%rdx
+  80100e:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  801013:	75 f2                	jne    801007 <strlen+0x5>
+		n++;
+	return n;
+}
+  801015:	c3                   	ret
+
+0000000000801016 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801016:	b8 00 00 00 00       	mov    $0x0,%eax
+  80101b:	eb 03                	jmp    801020 <strnlen+0xa>
+  80101d:	48 89 d0             	mov    %rdx,%rax
+  801020:	48 39 c6             	cmp    %rax,%rsi
+  801023:	74 0a                	je     80102f <strnlen+0x19>
+  801025:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801029:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80102d:	75 ee                	jne    80101d <strnlen+0x7>
+		n++;
+	return n;
+}
+  80102f:	c3                   	ret
+
+0000000000801030 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801030:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801033:	ba 00 00 00 00       	mov    $0x0,%edx
+  801038:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80103c:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80103f:	48 83 c2 01          	add    $0x1,%rdx
+  801043:	84 c9                	test   %cl,%cl
+  801045:	75 f1                	jne    801038 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  801047:	c3                   	ret
+
+0000000000801048 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801048:	55                   	push   %rbp
+  801049:	48 89 e5             	mov    %rsp,%rbp
+  80104c:	41 54                	push   %r12
+  80104e:	53                   	push   %rbx
+  80104f:	48 89 fb             	mov    %rdi,%rbx
+  801052:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  801055:	48 b8 02 10 80 00 00 	movabs $0x801002,%rax
+  80105c:	00 00 00 
+  80105f:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  801061:	48 63 f8             	movslq %eax,%rdi
+  801064:	48 01 df             	add    %rbx,%rdi
+  801067:	4c 89 e6             	mov    %r12,%rsi
+  80106a:	48 b8 30 10 80 00 00 	movabs $0x801030,%rax
+  801071:	00 00 00 
+  801074:	ff d0                	call   *%rax
+	return dst;
+}
+  801076:	48 89 d8             	mov    %rbx,%rax
+  801079:	5b                   	pop    %rbx
+  80107a:	41 5c                	pop    %r12
+  80107c:	5d                   	pop    %rbp
+  80107d:	c3                   	ret
+
+000000000080107e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80107e:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801081:	48 01 fa             	add    %rdi,%rdx
+  801084:	48 89 f9             	mov    %rdi,%rcx
+  801087:	eb 14                	jmp    80109d <strncpy+0x1f>
+		*dst++ = *src;
+  801089:	48 83 c1 01          	add    $0x1,%rcx
+  80108d:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801091:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801095:	41 80 f8 01          	cmp    $0x1,%r8b
+  801099:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  80109d:	48 39 d1             	cmp    %rdx,%rcx
+  8010a0:	75 e7                	jne    801089 <strncpy+0xb>
+	}
+	return ret;
+}
+  8010a2:	c3                   	ret
+
+00000000008010a3 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8010a3:	48 89 f8             	mov    %rdi,%rax
+  8010a6:	48 85 d2             	test   %rdx,%rdx
+  8010a9:	74 27                	je     8010d2 <strlcpy+0x2f>
+  8010ab:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  8010b0:	48 89 fa             	mov    %rdi,%rdx
+  8010b3:	eb 0b                	jmp    8010c0 <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8010b5:	48 83 c6 01          	add    $0x1,%rsi
+  8010b9:	48 83 c2 01          	add    $0x1,%rdx
+  8010bd:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  8010c0:	48 39 c2             	cmp    %rax,%rdx
+  8010c3:	74 0a                	je     8010cf <strlcpy+0x2c>
+  8010c5:	0f b6 0e             	movzbl (%rsi),%ecx
+  8010c8:	84 c9                	test   %cl,%cl
+  8010ca:	75 e9                	jne    8010b5 <strlcpy+0x12>
+  8010cc:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  8010cf:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8010d2:	48 29 f8             	sub    %rdi,%rax
+}
+  8010d5:	c3                   	ret
+
+00000000008010d6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  8010d6:	eb 08                	jmp    8010e0 <strcmp+0xa>
+		p++, q++;
+  8010d8:	48 83 c7 01          	add    $0x1,%rdi
+  8010dc:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  8010e0:	0f b6 07             	movzbl (%rdi),%eax
+  8010e3:	84 c0                	test   %al,%al
+  8010e5:	74 04                	je     8010eb <strcmp+0x15>
+  8010e7:	3a 06                	cmp    (%rsi),%al
+  8010e9:	74 ed                	je     8010d8 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8010eb:	0f b6 c0             	movzbl %al,%eax
+  8010ee:	0f b6 16             	movzbl (%rsi),%edx
+  8010f1:	29 d0                	sub    %edx,%eax
+}
+  8010f3:	c3                   	ret
+
+00000000008010f4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  8010f4:	eb 0c                	jmp    801102 <strncmp+0xe>
+		n--, p++, q++;
+  8010f6:	48 83 ea 01          	sub    $0x1,%rdx
+  8010fa:	48 83 c7 01          	add    $0x1,%rdi
+  8010fe:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  801102:	48 85 d2             	test   %rdx,%rdx
+  801105:	74 14                	je     80111b <strncmp+0x27>
+  801107:	0f b6 07             	movzbl (%rdi),%eax
+  80110a:	84 c0                	test   %al,%al
+  80110c:	74 04                	je     801112 <strncmp+0x1e>
+  80110e:	3a 06                	cmp    (%rsi),%al
+  801110:	74 e4                	je     8010f6 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801112:	0f b6 07             	movzbl (%rdi),%eax
+  801115:	0f b6 16             	movzbl (%rsi),%edx
+  801118:	29 d0                	sub    %edx,%eax
+}
+  80111a:	c3                   	ret
+		return 0;
+  80111b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801120:	c3                   	ret
+
+0000000000801121 <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  801121:	eb 04                	jmp    801127 <strchr+0x6>
+  801123:	48 83 c7 01          	add    $0x1,%rdi
+  801127:	0f b6 07             	movzbl (%rdi),%eax
+  80112a:	84 c0                	test   %al,%al
+  80112c:	74 09                	je     801137 <strchr+0x16>
+		if (*s == c)
+  80112e:	40 38 f0             	cmp    %sil,%al
+  801131:	75 f0                	jne    801123 <strchr+0x2>
+  801133:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  801136:	c3                   	ret
+	return 0;
+  801137:	b8 00 00 00 00       	mov    $0x0,%eax
+  80113c:	c3                   	ret
+
+000000000080113d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80113d:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  801140:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  801143:	40 38 f2             	cmp    %sil,%dl
+  801146:	74 0a                	je     801152 <strfind+0x15>
+  801148:	84 d2                	test   %dl,%dl
+  80114a:	74 06                	je     801152 <strfind+0x15>
+	for (; *s; s++)
+  80114c:	48 83 c0 01          	add    $0x1,%rax
+  801150:	eb ee                	jmp    801140 <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  801152:	c3                   	ret
+
+0000000000801153 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  801153:	48 85 d2             	test   %rdx,%rdx
+  801156:	74 28                	je     801180 <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  801158:	48 89 f8             	mov    %rdi,%rax
+  80115b:	48 09 d0             	or     %rdx,%rax
+  80115e:	a8 03                	test   $0x3,%al
+  801160:	75 16                	jne    801178 <memset+0x25>
+		c &= 0xFF;
+  801162:	40 0f b6 f6          	movzbl %sil,%esi
+  801166:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80116c:	48 89 d1             	mov    %rdx,%rcx
+  80116f:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  801173:	fc                   	cld
+  801174:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801176:	eb 08                	jmp    801180 <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801178:	89 f0                	mov    %esi,%eax
+  80117a:	48 89 d1             	mov    %rdx,%rcx
+  80117d:	fc                   	cld
+  80117e:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801180:	48 89 f8             	mov    %rdi,%rax
+  801183:	c3                   	ret
+
+0000000000801184 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801184:	48 89 f8             	mov    %rdi,%rax
+  801187:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80118a:	48 39 fe             	cmp    %rdi,%rsi
+  80118d:	73 3a                	jae    8011c9 <memmove+0x45>
+  80118f:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801193:	48 39 d7             	cmp    %rdx,%rdi
+  801196:	73 31                	jae    8011c9 <memmove+0x45>
+		s += n;
+		d += n;
+  801198:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  80119c:	48 89 d6             	mov    %rdx,%rsi
+  80119f:	48 09 fe             	or     %rdi,%rsi
+  8011a2:	48 09 ce             	or     %rcx,%rsi
+  8011a5:	40 f6 c6 03          	test   $0x3,%sil
+  8011a9:	75 11                	jne    8011bc <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8011ab:	48 83 ef 04          	sub    $0x4,%rdi
+  8011af:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  8011b3:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  8011b7:	fd                   	std
+  8011b8:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8011ba:	eb 0b                	jmp    8011c7 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8011bc:	48 83 ef 01          	sub    $0x1,%rdi
+  8011c0:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  8011c4:	fd                   	std
+  8011c5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8011c7:	fc                   	cld
+  8011c8:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  8011c9:	48 89 f2             	mov    %rsi,%rdx
+  8011cc:	48 09 c2             	or     %rax,%rdx
+  8011cf:	48 09 ca             	or     %rcx,%rdx
+  8011d2:	f6 c2 03             	test   $0x3,%dl
+  8011d5:	75 0b                	jne    8011e2 <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8011d7:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  8011db:	48 89 c7             	mov    %rax,%rdi
+  8011de:	fc                   	cld
+  8011df:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8011e1:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  8011e2:	48 89 c7             	mov    %rax,%rdi
+  8011e5:	fc                   	cld
+  8011e6:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8011e8:	c3                   	ret
+
+00000000008011e9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8011e9:	55                   	push   %rbp
+  8011ea:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  8011ed:	48 b8 84 11 80 00 00 	movabs $0x801184,%rax
+  8011f4:	00 00 00 
+  8011f7:	ff d0                	call   *%rax
+}
+  8011f9:	5d                   	pop    %rbp
+  8011fa:	c3                   	ret
+
+00000000008011fb <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8011fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801200:	48 39 c2             	cmp    %rax,%rdx
+  801203:	74 1e                	je     801223 <memcmp+0x28>
+		if (*s1 != *s2)
+  801205:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801209:	48 83 c0 01          	add    $0x1,%rax
+  80120d:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  801213:	44 38 c1             	cmp    %r8b,%cl
+  801216:	74 e8                	je     801200 <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  801218:	0f b6 c1             	movzbl %cl,%eax
+  80121b:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80121f:	44 29 c0             	sub    %r8d,%eax
+  801222:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  801223:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801228:	c3                   	ret
+
+0000000000801229 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801229:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  80122c:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  80122f:	eb 04                	jmp    801235 <memfind+0xc>
+  801231:	48 83 c0 01          	add    $0x1,%rax
+  801235:	48 39 d0             	cmp    %rdx,%rax
+  801238:	73 05                	jae    80123f <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80123a:	40 38 30             	cmp    %sil,(%rax)
+  80123d:	75 f2                	jne    801231 <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  80123f:	c3                   	ret
+
+0000000000801240 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801240:	48 89 f9             	mov    %rdi,%rcx
+  801243:	49 89 f0             	mov    %rsi,%r8
+  801246:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801248:	eb 04                	jmp    80124e <strtol+0xe>
+		s++;
+  80124a:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  80124e:	0f b6 01             	movzbl (%rcx),%eax
+  801251:	3c 20                	cmp    $0x20,%al
+  801253:	74 f5                	je     80124a <strtol+0xa>
+  801255:	3c 09                	cmp    $0x9,%al
+  801257:	74 f1                	je     80124a <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  801259:	3c 2b                	cmp    $0x2b,%al
+  80125b:	74 2b                	je     801288 <strtol+0x48>
+	int neg = 0;
+  80125d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  801263:	3c 2d                	cmp    $0x2d,%al
+  801265:	74 2d                	je     801294 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801267:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  80126d:	75 0f                	jne    80127e <strtol+0x3e>
+  80126f:	80 39 30             	cmpb   $0x30,(%rcx)
+  801272:	74 2c                	je     8012a0 <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801274:	85 ff                	test   %edi,%edi
+  801276:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80127b:	0f 44 f8             	cmove  %eax,%edi
+  80127e:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  801283:	4c 63 d7             	movslq %edi,%r10
+  801286:	eb 4f                	jmp    8012d7 <strtol+0x97>
+		s++;
+  801288:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  80128c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801292:	eb d3                	jmp    801267 <strtol+0x27>
+		s++, neg = 1;
+  801294:	48 83 c1 01          	add    $0x1,%rcx
+  801298:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  80129e:	eb c7                	jmp    801267 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8012a0:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  8012a4:	74 0f                	je     8012b5 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  8012a6:	85 ff                	test   %edi,%edi
+  8012a8:	75 d4                	jne    80127e <strtol+0x3e>
+		s++, base = 8;
+  8012aa:	48 83 c1 01          	add    $0x1,%rcx
+  8012ae:	bf 08 00 00 00       	mov    $0x8,%edi
+  8012b3:	eb c9                	jmp    80127e <strtol+0x3e>
+		s += 2, base = 16;
+  8012b5:	48 83 c1 02          	add    $0x2,%rcx
+  8012b9:	bf 10 00 00 00       	mov    $0x10,%edi
+  8012be:	eb be                	jmp    80127e <strtol+0x3e>
+			dig = *s - '0';
+  8012c0:	0f be c0             	movsbl %al,%eax
+  8012c3:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  8012c6:	39 f8                	cmp    %edi,%eax
+  8012c8:	7d 3b                	jge    801305 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  8012ca:	48 83 c1 01          	add    $0x1,%rcx
+  8012ce:	49 0f af d2          	imul   %r10,%rdx
+  8012d2:	48 98                	cltq
+  8012d4:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  8012d7:	0f b6 01             	movzbl (%rcx),%eax
+  8012da:	8d 70 d0             	lea    -0x30(%rax),%esi
+  8012dd:	40 80 fe 09          	cmp    $0x9,%sil
+  8012e1:	76 dd                	jbe    8012c0 <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  8012e3:	8d 70 9f             	lea    -0x61(%rax),%esi
+  8012e6:	40 80 fe 19          	cmp    $0x19,%sil
+  8012ea:	77 08                	ja     8012f4 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  8012ec:	0f be c0             	movsbl %al,%eax
+  8012ef:	83 e8 57             	sub    $0x57,%eax
+  8012f2:	eb d2                	jmp    8012c6 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  8012f4:	8d 70 bf             	lea    -0x41(%rax),%esi
+  8012f7:	40 80 fe 19          	cmp    $0x19,%sil
+  8012fb:	77 08                	ja     801305 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  8012fd:	0f be c0             	movsbl %al,%eax
+  801300:	83 e8 37             	sub    $0x37,%eax
+  801303:	eb c1                	jmp    8012c6 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801305:	4d 85 c0             	test   %r8,%r8
+  801308:	74 03                	je     80130d <strtol+0xcd>
+		*endptr = (char *) s;
+  80130a:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  80130d:	48 89 d0             	mov    %rdx,%rax
+  801310:	48 f7 d8             	neg    %rax
+  801313:	45 85 c9             	test   %r9d,%r9d
+  801316:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  80131a:	48 89 d0             	mov    %rdx,%rax
+  80131d:	c3                   	ret
+
+000000000080131e <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  80131e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801324:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  80132a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80132f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801334:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  801336:	c3                   	ret
+
+0000000000801337 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  801337:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80133d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801343:	bf 00 00 00 00       	mov    $0x0,%edi
+  801348:	b8 01 00 00 00       	mov    $0x1,%eax
+  80134d:	48 89 fe             	mov    %rdi,%rsi
+  801350:	48 89 fa             	mov    %rdi,%rdx
+  801353:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801355:	c3                   	ret
+
+0000000000801356 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801356:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801359:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80135f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801365:	be 00 00 00 00       	mov    $0x0,%esi
+  80136a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80136f:	48 89 f2             	mov    %rsi,%rdx
+  801372:	0f 05                	syscall
+	if(check && ret > 0)
+  801374:	48 85 c0             	test   %rax,%rax
+  801377:	7f 01                	jg     80137a <sys_env_destroy+0x24>
+}
+  801379:	c3                   	ret
+{
+  80137a:	55                   	push   %rbp
+  80137b:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80137e:	49 89 c0             	mov    %rax,%r8
+  801381:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801386:	48 ba 28 20 80 00 00 	movabs $0x802028,%rdx
+  80138d:	00 00 00 
+  801390:	be 28 00 00 00       	mov    $0x28,%esi
+  801395:	48 bf 45 20 80 00 00 	movabs $0x802045,%rdi
+  80139c:	00 00 00 
+  80139f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a4:	49 b9 da 05 80 00 00 	movabs $0x8005da,%r9
+  8013ab:	00 00 00 
+  8013ae:	41 ff d1             	call   *%r9
+
+00000000008013b1 <sys_getenvid>:
+  8013b1:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  8013b8:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  8013b9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8013be:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8013c2:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8013c6:	48 c1 e2 04          	shl    $0x4,%rdx
+  8013ca:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  8013d1:	00 00 00 
+  8013d4:	48 01 d0             	add    %rdx,%rax
+  8013d7:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  8013dd:	c3                   	ret
+
+00000000008013de <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  8013de:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8013e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8013ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013ef:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013f4:	48 89 fe             	mov    %rdi,%rsi
+  8013f7:	48 89 fa             	mov    %rdi,%rdx
+  8013fa:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8013fc:	c3                   	ret
+
+00000000008013fd <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8013fd:	48 63 d2             	movslq %edx,%rdx
+  801400:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801403:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801409:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80140f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801414:	0f 05                	syscall
+	if(check && ret > 0)
+  801416:	48 85 c0             	test   %rax,%rax
+  801419:	7f 01                	jg     80141c <sys_page_alloc+0x1f>
+}
+  80141b:	c3                   	ret
+{
+  80141c:	55                   	push   %rbp
+  80141d:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801420:	49 89 c0             	mov    %rax,%r8
+  801423:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801428:	48 ba 28 20 80 00 00 	movabs $0x802028,%rdx
+  80142f:	00 00 00 
+  801432:	be 28 00 00 00       	mov    $0x28,%esi
+  801437:	48 bf 45 20 80 00 00 	movabs $0x802045,%rdi
+  80143e:	00 00 00 
+  801441:	b8 00 00 00 00       	mov    $0x0,%eax
+  801446:	49 b9 da 05 80 00 00 	movabs $0x8005da,%r9
+  80144d:	00 00 00 
+  801450:	41 ff d1             	call   *%r9
+
+0000000000801453 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  801453:	48 63 d2             	movslq %edx,%rdx
+  801456:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801459:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80145f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801465:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80146a:	0f 05                	syscall
+	if(check && ret > 0)
+  80146c:	48 85 c0             	test   %rax,%rax
+  80146f:	7f 01                	jg     801472 <sys_page_alloc_huge+0x1f>
+}
+  801471:	c3                   	ret
+{
+  801472:	55                   	push   %rbp
+  801473:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801476:	49 89 c0             	mov    %rax,%r8
+  801479:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80147e:	48 ba 28 20 80 00 00 	movabs $0x802028,%rdx
+  801485:	00 00 00 
+  801488:	be 28 00 00 00       	mov    $0x28,%esi
+  80148d:	48 bf 45 20 80 00 00 	movabs $0x802045,%rdi
+  801494:	00 00 00 
+  801497:	b8 00 00 00 00       	mov    $0x0,%eax
+  80149c:	49 b9 da 05 80 00 00 	movabs $0x8005da,%r9
+  8014a3:	00 00 00 
+  8014a6:	41 ff d1             	call   *%r9
+
+00000000008014a9 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8014a9:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  8014ac:	48 63 d2             	movslq %edx,%rdx
+  8014af:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  8014b2:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  8014b5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8014ba:	0f 05                	syscall
+	if(check && ret > 0)
+  8014bc:	48 85 c0             	test   %rax,%rax
+  8014bf:	7f 01                	jg     8014c2 <sys_page_map+0x19>
+}
+  8014c1:	c3                   	ret
+{
+  8014c2:	55                   	push   %rbp
+  8014c3:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014c6:	49 89 c0             	mov    %rax,%r8
+  8014c9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014ce:	48 ba 28 20 80 00 00 	movabs $0x802028,%rdx
+  8014d5:	00 00 00 
+  8014d8:	be 28 00 00 00       	mov    $0x28,%esi
+  8014dd:	48 bf 45 20 80 00 00 	movabs $0x802045,%rdi
+  8014e4:	00 00 00 
+  8014e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ec:	49 b9 da 05 80 00 00 	movabs $0x8005da,%r9
+  8014f3:	00 00 00 
+  8014f6:	41 ff d1             	call   *%r9
+
+00000000008014f9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8014f9:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8014fc:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801502:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801508:	ba 00 00 00 00       	mov    $0x0,%edx
+  80150d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801512:	0f 05                	syscall
+	if(check && ret > 0)
+  801514:	48 85 c0             	test   %rax,%rax
+  801517:	7f 01                	jg     80151a <sys_page_unmap+0x21>
+}
+  801519:	c3                   	ret
+{
+  80151a:	55                   	push   %rbp
+  80151b:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80151e:	49 89 c0             	mov    %rax,%r8
+  801521:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801526:	48 ba 28 20 80 00 00 	movabs $0x802028,%rdx
+  80152d:	00 00 00 
+  801530:	be 28 00 00 00       	mov    $0x28,%esi
+  801535:	48 bf 45 20 80 00 00 	movabs $0x802045,%rdi
+  80153c:	00 00 00 
+  80153f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801544:	49 b9 da 05 80 00 00 	movabs $0x8005da,%r9
+  80154b:	00 00 00 
+  80154e:	41 ff d1             	call   *%r9
+
+0000000000801551 <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  801551:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801557:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80155d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801562:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801567:	48 89 fe             	mov    %rdi,%rsi
+  80156a:	48 89 fa             	mov    %rdi,%rdx
+  80156d:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80156f:	c3                   	ret
+
+0000000000801570 <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  801570:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801576:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80157c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801581:	b8 10 00 00 00       	mov    $0x10,%eax
+  801586:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  801588:	c3                   	ret
+
+0000000000801589 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  801589:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80158f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801595:	b8 11 00 00 00       	mov    $0x11,%eax
+  80159a:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  80159c:	c3                   	ret
+
+000000000080159d <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  80159d:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  8015a0:	48 63 f6             	movslq %esi,%rsi
+  8015a3:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  8015a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8015ac:	b8 12 00 00 00       	mov    $0x12,%eax
+  8015b1:	0f 05                	syscall
+	if(check && ret > 0)
+  8015b3:	48 85 c0             	test   %rax,%rax
+  8015b6:	7f 01                	jg     8015b9 <sys_page_batch+0x1c>
+}
+  8015b8:	c3                   	ret
+{
+  8015b9:	55                   	push   %rbp
+  8015ba:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015bd:	49 89 c0             	mov    %rax,%r8
+  8015c0:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8015c5:	48 ba 28 20 80 00 00 	movabs $0x802028,%rdx
+  8015cc:	00 00 00 
+  8015cf:	be 28 00 00 00       	mov    $0x28,%esi
+  8015d4:	48 bf 45 20 80 00 00 	movabs $0x802045,%rdi
+  8015db:	00 00 00 
+  8015de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e3:	49 b9 da 05 80 00 00 	movabs $0x8005da,%r9
+  8015ea:	00 00 00 
+  8015ed:	41 ff d1             	call   *%r9
+
+00000000008015f0 <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  8015f0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8015f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8015fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801601:	b8 13 00 00 00       	mov    $0x13,%eax
+  801606:	48 89 f2             	mov    %rsi,%rdx
+  801609:	0f 05                	syscall
+	if(check && ret > 0)
+  80160b:	48 85 c0             	test   %rax,%rax
+  80160e:	7f 01                	jg     801611 <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  801610:	c3                   	ret
+{
+  801611:	55                   	push   %rbp
+  801612:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801615:	49 89 c0             	mov    %rax,%r8
+  801618:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80161d:	48 ba 28 20 80 00 00 	movabs $0x802028,%rdx
+  801624:	00 00 00 
+  801627:	be 28 00 00 00       	mov    $0x28,%esi
+  80162c:	48 bf 45 20 80 00 00 	movabs $0x802045,%rdi
+  801633:	00 00 00 
+  801636:	b8 00 00 00 00       	mov    $0x0,%eax
+  80163b:	49 b9 da 05 80 00 00 	movabs $0x8005da,%r9
+  801642:	00 00 00 
+  801645:	41 ff d1             	call   *%r9
+
+0000000000801648 <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  801648:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80164e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801654:	bf 00 00 00 00       	mov    $0x0,%edi
+  801659:	b8 14 00 00 00       	mov    $0x14,%eax
+  80165e:	48 89 fe             	mov    %rdi,%rsi
+  801661:	48 89 fa             	mov    %rdi,%rdx
+  801664:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801666:	c3                   	ret
+
+0000000000801667 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  801667:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80166a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801670:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801676:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80167b:	0f 05                	syscall
+	if(check && ret > 0)
+  80167d:	48 85 c0             	test   %rax,%rax
+  801680:	7f 01                	jg     801683 <sys_page_unmap_range+0x1c>
+}
+  801682:	c3                   	ret
+{
+  801683:	55                   	push   %rbp
+  801684:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801687:	49 89 c0             	mov    %rax,%r8
+  80168a:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80168f:	48 ba 28 20 80 00 00 	movabs $0x802028,%rdx
+  801696:	00 00 00 
+  801699:	be 28 00 00 00       	mov    $0x28,%esi
+  80169e:	48 bf 45 20 80 00 00 	movabs $0x802045,%rdi
+  8016a5:	00 00 00 
+  8016a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ad:	49 b9 da 05 80 00 00 	movabs $0x8005da,%r9
+  8016b4:	00 00 00 
+  8016b7:	41 ff d1             	call   *%r9
+
+00000000008016ba <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8016ba:	48 63 f6             	movslq %esi,%rsi
+  8016bd:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8016c0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8016c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8016cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016d1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016d6:	0f 05                	syscall
+	if(check && ret > 0)
+  8016d8:	48 85 c0             	test   %rax,%rax
+  8016db:	7f 01                	jg     8016de <sys_env_set_status+0x24>
+}
+  8016dd:	c3                   	ret
+{
+  8016de:	55                   	push   %rbp
+  8016df:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016e2:	49 89 c0             	mov    %rax,%r8
+  8016e5:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8016ea:	48 ba 28 20 80 00 00 	movabs $0x802028,%rdx
+  8016f1:	00 00 00 
+  8016f4:	be 28 00 00 00       	mov    $0x28,%esi
+  8016f9:	48 bf 45 20 80 00 00 	movabs $0x802045,%rdi
+  801700:	00 00 00 
+  801703:	b8 00 00 00 00       	mov    $0x0,%eax
+  801708:	49 b9 da 05 80 00 00 	movabs $0x8005da,%r9
+  80170f:	00 00 00 
+  801712:	41 ff d1             	call   *%r9
+
+0000000000801715 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  801715:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801718:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80171e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801724:	ba 00 00 00 00       	mov    $0x0,%edx
+  801729:	b8 09 00 00 00       	mov    $0x9,%eax
+  80172e:	0f 05                	syscall
+	if(check && ret > 0)
+  801730:	48 85 c0             	test   %rax,%rax
+  801733:	7f 01                	jg     801736 <sys_env_set_pgfault_upcall+0x21>
+}
+  801735:	c3                   	ret
+{
+  801736:	55                   	push   %rbp
+  801737:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80173a:	49 89 c0             	mov    %rax,%r8
+  80173d:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801742:	48 ba 28 20 80 00 00 	movabs $0x802028,%rdx
+  801749:	00 00 00 
+  80174c:	be 28 00 00 00       	mov    $0x28,%esi
+  801751:	48 bf 45 20 80 00 00 	movabs $0x802045,%rdi
+  801758:	00 00 00 
+  80175b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801760:	49 b9 da 05 80 00 00 	movabs $0x8005da,%r9
+  801767:	00 00 00 
+  80176a:	41 ff d1             	call   *%r9
+
+000000000080176d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80176d:	48 63 ff             	movslq %edi,%rdi
+  801770:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  801773:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801779:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80177e:	0f 05                	syscall
+}
+  801780:	c3                   	ret
+
+0000000000801781 <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  801781:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801787:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80178d:	be 00 00 00 00       	mov    $0x0,%esi
+  801792:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801797:	48 89 f2             	mov    %rsi,%rdx
+  80179a:	0f 05                	syscall
+	if(check && ret > 0)
+  80179c:	48 85 c0             	test   %rax,%rax
+  80179f:	7f 01                	jg     8017a2 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  8017a1:	c3                   	ret
+{
+  8017a2:	55                   	push   %rbp
+  8017a3:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017a6:	49 89 c0             	mov    %rax,%r8
+  8017a9:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8017ae:	48 ba 28 20 80 00 00 	movabs $0x802028,%rdx
+  8017b5:	00 00 00 
+  8017b8:	be 28 00 00 00       	mov    $0x28,%esi
+  8017bd:	48 bf 45 20 80 00 00 	movabs $0x802045,%rdi
+  8017c4:	00 00 00 
+  8017c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017cc:	49 b9 da 05 80 00 00 	movabs $0x8005da,%r9
+  8017d3:	00 00 00 
+  8017d6:	41 ff d1             	call   *%r9
+
+00000000008017d9 <ring_submit>:
+// Returns 0 on success, -E_NO_MEM if the ring is full, or another
+// error from setting up the ring.
+int
+ring_submit(uint32_t num, uint64_t a1, uint64_t a2, uint64_t a3,
+	    uint64_t a4, uint64_t a5, uint64_t data)
+{
+  8017d9:	55                   	push   %rbp
+  8017da:	48 89 e5             	mov    %rsp,%rbp
+  8017dd:	41 57                	push   %r15
+  8017df:	41 56                	push   %r14
+  8017e1:	41 55                	push   %r13
+  8017e3:	41 54                	push   %r12
+  8017e5:	53                   	push   %rbx
+  8017e6:	48 83 ec 18          	sub    $0x18,%rsp
+  8017ea:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8017ed:	48 89 f3             	mov    %rsi,%rbx
+  8017f0:	49 89 d4             	mov    %rdx,%r12
+  8017f3:	49 89 cd             	mov    %rcx,%r13
+  8017f6:	4d 89 c6             	mov    %r8,%r14
+  8017f9:	4d 89 cf             	mov    %r9,%r15
+	const volatile struct Env *owner = &envs[ENVX(ring_env)];
+  8017fc:	a1 00 50 80 00 00 00 	movabs 0x805000,%eax
+  801803:	00 00 
+  801805:	65 8b 14 25 b8 00 00 	mov    %gs:0xb8,%edx
+  80180c:	00 
+	if (ring_env == thisenv->env_id)
+  80180d:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  801813:	48 8d 0c d2          	lea    (%rdx,%rdx,8),%rcx
+  801817:	48 8d 0c 4a          	lea    (%rdx,%rcx,2),%rcx
+  80181b:	48 c1 e1 04          	shl    $0x4,%rcx
+  80181f:	48 ba 00 00 80 bc 00 	movabs $0xbc800000,%rdx
+  801826:	00 00 00 
+  801829:	48 01 ca             	add    %rcx,%rdx
+  80182c:	8b 92 b8 00 00 00    	mov    0xb8(%rdx),%edx
+  801832:	39 d0                	cmp    %edx,%eax
+  801834:	0f 84 b6 00 00 00    	je     8018f0 <ring_submit+0x117>
+	if (ring_env && owner->env_id == ring_env && owner->env_status != ENV_FREE
+  80183a:	85 c0                	test   %eax,%eax
+  80183c:	74 37                	je     801875 <ring_submit+0x9c>
+	const volatile struct Env *owner = &envs[ENVX(ring_env)];
+  80183e:	89 c6                	mov    %eax,%esi
+  801840:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	if (ring_env && owner->env_id == ring_env && owner->env_status != ENV_FREE
+  801846:	89 c2                	mov    %eax,%edx
+  801848:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80184e:	48 8d 0c d2          	lea    (%rdx,%rdx,8),%rcx
+  801852:	48 8d 0c 4a          	lea    (%rdx,%rcx,2),%rcx
+  801856:	48 c1 e1 04          	shl    $0x4,%rcx
+  80185a:	48 ba 00 00 80 bc 00 	movabs $0xbc800000,%rdx
+  801861:	00 00 00 
+  801864:	48 01 ca             	add    %rcx,%rdx
+  801867:	8b 92 b8 00 00 00    	mov    0xb8(%rdx),%edx
+  80186d:	39 d0                	cmp    %edx,%eax
+  80186f:	0f 84 f1 00 00 00    	je     801966 <ring_submit+0x18d>
+	if ((r = sys_page_alloc(0, ring_page, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801875:	ba 07 04 00 00       	mov    $0x407,%edx
+  80187a:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801881:	00 00 00 
+  801884:	bf 00 00 00 00       	mov    $0x0,%edi
+  801889:	48 b8 fd 13 80 00 00 	movabs $0x8013fd,%rax
+  801890:	00 00 00 
+  801893:	ff d0                	call   *%rax
+  801895:	85 c0                	test   %eax,%eax
+  801897:	0f 88 ba 00 00 00    	js     801957 <ring_submit+0x17e>
+	if ((r = sys_ring_setup(ring_page)) < 0)
+  80189d:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8018a4:	00 00 00 
+  8018a7:	48 b8 f0 15 80 00 00 	movabs $0x8015f0,%rax
+  8018ae:	00 00 00 
+  8018b1:	ff d0                	call   *%rax
+  8018b3:	85 c0                	test   %eax,%eax
+  8018b5:	0f 88 9c 00 00 00    	js     801957 <ring_submit+0x17e>
+  8018bb:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  8018c2:	00 
+	ring_env = thisenv->env_id;
+  8018c3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018c8:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8018cc:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  8018d0:	48 c1 e2 04          	shl    $0x4,%rdx
+  8018d4:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  8018db:	00 00 00 
+  8018de:	48 01 d0             	add    %rdx,%rax
+  8018e1:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+  8018e7:	a3 00 50 80 00 00 00 	movabs %eax,0x805000
+  8018ee:	00 00 
+	uint32_t tail;
+	int r;
+
+	if ((r = ring_init()) < 0)
+		return r;
+	tail = ring->r_sq_tail;
+  8018f0:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8018f7:	00 00 00 
+  8018fa:	8b 50 04             	mov    0x4(%rax),%edx
+	if (tail - ring->r_sq_head >= RING_SQ_SIZE)
+  8018fd:	8b 08                	mov    (%rax),%ecx
+  8018ff:	89 d0                	mov    %edx,%eax
+  801901:	29 c8                	sub    %ecx,%eax
+  801903:	83 f8 1f             	cmp    $0x1f,%eax
+  801906:	0f 87 dd 00 00 00    	ja     8019e9 <ring_submit+0x210>
+		return -E_NO_MEM;
+	sqe = &ring->r_sq[tail % RING_SQ_SIZE];
+  80190c:	89 d1                	mov    %edx,%ecx
+  80190e:	83 e1 1f             	and    $0x1f,%ecx
+  801911:	48 8d 04 cd 00 00 00 	lea    0x0(,%rcx,8),%rax
+  801918:	00 
+  801919:	48 29 c8             	sub    %rcx,%rax
+  80191c:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  801923:	00 00 00 
+  801926:	48 8d 44 c1 10       	lea    0x10(%rcx,%rax,8),%rax
+	sqe->sqe_num = num;
+  80192b:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80192e:	89 38                	mov    %edi,(%rax)
+	sqe->sqe_args[0] = a1;
+  801930:	48 89 58 08          	mov    %rbx,0x8(%rax)
+	sqe->sqe_args[1] = a2;
+  801934:	4c 89 60 10          	mov    %r12,0x10(%rax)
+	sqe->sqe_args[2] = a3;
+  801938:	4c 89 68 18          	mov    %r13,0x18(%rax)
+	sqe->sqe_args[3] = a4;
+  80193c:	4c 89 70 20          	mov    %r14,0x20(%rax)
+	sqe->sqe_args[4] = a5;
+  801940:	4c 89 78 28          	mov    %r15,0x28(%rax)
+	sqe->sqe_data = data;
+  801944:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801948:	48 89 70 30          	mov    %rsi,0x30(%rax)
+	asm volatile("" ::: "memory");
+	ring->r_sq_tail = tail + 1;
+  80194c:	83 c2 01             	add    $0x1,%edx
+  80194f:	89 51 04             	mov    %edx,0x4(%rcx)
+	return 0;
+  801952:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801957:	48 83 c4 18          	add    $0x18,%rsp
+  80195b:	5b                   	pop    %rbx
+  80195c:	41 5c                	pop    %r12
+  80195e:	41 5d                	pop    %r13
+  801960:	41 5e                	pop    %r14
+  801962:	41 5f                	pop    %r15
+  801964:	5d                   	pop    %rbp
+  801965:	c3                   	ret
+	if (ring_env && owner->env_id == ring_env && owner->env_status != ENV_FREE
+  801966:	48 63 c6             	movslq %esi,%rax
+  801969:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80196d:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801971:	48 c1 e2 04          	shl    $0x4,%rdx
+  801975:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  80197c:	00 00 00 
+  80197f:	48 01 d0             	add    %rdx,%rax
+  801982:	8b 80 c4 00 00 00    	mov    0xc4(%rax),%eax
+  801988:	85 c0                	test   %eax,%eax
+  80198a:	0f 84 e5 fe ff ff    	je     801875 <ring_submit+0x9c>
+	    && owner->env_pml4e == thisenv->env_pml4e)
+  801990:	48 ba 00 00 80 bc 00 	movabs $0xbc800000,%rdx
+  801997:	00 00 00 
+  80199a:	48 63 f6             	movslq %esi,%rsi
+  80199d:	48 8d 04 f6          	lea    (%rsi,%rsi,8),%rax
+  8019a1:	48 8d 04 46          	lea    (%rsi,%rax,2),%rax
+  8019a5:	48 c1 e0 04          	shl    $0x4,%rax
+  8019a9:	48 01 d0             	add    %rdx,%rax
+  8019ac:	48 8b 88 d0 00 00 00 	mov    0xd0(%rax),%rcx
+  8019b3:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  8019ba:	00 
+  8019bb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8019c0:	48 8d 34 c0          	lea    (%rax,%rax,8),%rsi
+  8019c4:	48 8d 04 70          	lea    (%rax,%rsi,2),%rax
+  8019c8:	48 c1 e0 04          	shl    $0x4,%rax
+  8019cc:	48 01 c2             	add    %rax,%rdx
+  8019cf:	48 8b 82 d0 00 00 00 	mov    0xd0(%rdx),%rax
+  8019d6:	48 39 c1             	cmp    %rax,%rcx
+  8019d9:	0f 85 96 fe ff ff    	jne    801875 <ring_submit+0x9c>
+		return -E_BAD_ENV;
+  8019df:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  8019e4:	e9 6e ff ff ff       	jmp    801957 <ring_submit+0x17e>
+		return -E_NO_MEM;
+  8019e9:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8019ee:	e9 64 ff ff ff       	jmp    801957 <ring_submit+0x17e>
+
+00000000008019f3 <ring_reap>:
+  8019f3:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  8019fa:	00 
+int
+ring_reap(struct RingCqe *cqe)
+{
+	uint32_t head;
+
+	if (ring_env != thisenv->env_id)
+  8019fb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801a00:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801a04:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801a08:	48 c1 e2 04          	shl    $0x4,%rdx
+  801a0c:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801a13:	00 00 00 
+  801a16:	48 01 d0             	add    %rdx,%rax
+  801a19:	8b 88 b8 00 00 00    	mov    0xb8(%rax),%ecx
+		return 0;
+  801a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ring_env != thisenv->env_id)
+  801a24:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  801a2b:	00 00 00 
+  801a2e:	3b 0a                	cmp    (%rdx),%ecx
+  801a30:	75 43                	jne    801a75 <ring_reap+0x82>
+	head = ring->r_cq_head;
+  801a32:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801a39:	00 00 00 
+  801a3c:	8b 50 08             	mov    0x8(%rax),%edx
+	if (head == ring->r_cq_tail)
+  801a3f:	8b 48 0c             	mov    0xc(%rax),%ecx
+		return 0;
+  801a42:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (head == ring->r_cq_tail)
+  801a47:	39 d1                	cmp    %edx,%ecx
+  801a49:	74 2a                	je     801a75 <ring_reap+0x82>
+	asm volatile("" ::: "memory");
+	*cqe = ring->r_cq[head % RING_CQ_SIZE];
+  801a4b:	48 b9 00 60 80 00 00 	movabs $0x806000,%rcx
+  801a52:	00 00 00 
+  801a55:	89 d0                	mov    %edx,%eax
+  801a57:	83 e0 3f             	and    $0x3f,%eax
+  801a5a:	48 c1 e0 04          	shl    $0x4,%rax
+  801a5e:	66 0f 6f 84 08 10 07 	movdqa 0x710(%rax,%rcx,1),%xmm0
+  801a65:	00 00 
+  801a67:	0f 11 07             	movups %xmm0,(%rdi)
+	ring->r_cq_head = head + 1;
+  801a6a:	83 c2 01             	add    $0x1,%edx
+  801a6d:	89 51 08             	mov    %edx,0x8(%rcx)
+	return 1;
+  801a70:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801a75:	c3                   	ret
@@ -0,0 +1,3463 @@
+
+obj/user/sendpage:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 27 02 00 00       	call   800258 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+#define TEMP_ADDR	((char*)0xa00000)
+#define TEMP_ADDR_CHILD	((char*)0xb00000)
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	41 54                	push   %r12
+  800039:	53                   	push   %rbx
+  80003a:	48 83 ec 10          	sub    $0x10,%rsp
+	envid_t who;
+
+	if ((who = fork()) == 0) {
+  80003e:	48 b8 55 16 80 00 00 	movabs $0x801655,%rax
+  800045:	00 00 00 
+  800048:	ff d0                	call   *%rax
+  80004a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	0f 84 09 01 00 00    	je     80015e <umain+0x12b>
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800055:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  80005c:	00 
+		ipc_send(who, 0, TEMP_ADDR_CHILD, PTE_P | PTE_W | PTE_U);
+		return;
+	}
+
+	// Parent
+	sys_page_alloc(thisenv->env_id, TEMP_ADDR, PTE_P | PTE_W | PTE_U);
+  80005d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800062:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800066:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  80006a:	48 c1 e2 04          	shl    $0x4,%rdx
+  80006e:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800075:	00 00 00 
+  800078:	48 01 d0             	add    %rdx,%rax
+  80007b:	8b b8 b8 00 00 00    	mov    0xb8(%rax),%edi
+  800081:	ba 07 00 00 00       	mov    $0x7,%edx
+  800086:	be 00 00 a0 00       	mov    $0xa00000,%esi
+  80008b:	48 b8 cf 0f 80 00 00 	movabs $0x800fcf,%rax
+  800092:	00 00 00 
+  800095:	ff d0                	call   *%rax
+	memcpy(TEMP_ADDR, str1, strlen(str1) + 1);
+  800097:	48 bb 08 30 80 00 00 	movabs $0x803008,%rbx
+  80009e:	00 00 00 
+  8000a1:	48 8b 3b             	mov    (%rbx),%rdi
+  8000a4:	49 bc d4 0b 80 00 00 	movabs $0x800bd4,%r12
+  8000ab:	00 00 00 
+  8000ae:	41 ff d4             	call   *%r12
+  8000b1:	8d 50 01             	lea    0x1(%rax),%edx
+  8000b4:	48 63 d2             	movslq %edx,%rdx
+  8000b7:	48 8b 33             	mov    (%rbx),%rsi
+  8000ba:	bf 00 00 a0 00       	mov    $0xa00000,%edi
+  8000bf:	48 b8 bb 0d 80 00 00 	movabs $0x800dbb,%rax
+  8000c6:	00 00 00 
+  8000c9:	ff d0                	call   *%rax
+	ipc_send(who, 0, TEMP_ADDR, PTE_P | PTE_W | PTE_U);
+  8000cb:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8000d0:	ba 00 00 a0 00       	mov    $0xa00000,%edx
+  8000d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8000da:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  8000dd:	48 b8 6b 1c 80 00 00 	movabs $0x801c6b,%rax
+  8000e4:	00 00 00 
+  8000e7:	ff d0                	call   *%rax
+
+	ipc_recv(&who, TEMP_ADDR, 0);
+  8000e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ee:	be 00 00 a0 00       	mov    $0xa00000,%esi
+  8000f3:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8000f7:	48 b8 88 1b 80 00 00 	movabs $0x801b88,%rax
+  8000fe:	00 00 00 
+  800101:	ff d0                	call   *%rax
+	cprintf("%x got message: %s\n", who, TEMP_ADDR);
+  800103:	ba 00 00 a0 00       	mov    $0xa00000,%edx
+  800108:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80010b:	48 bf 80 1f 80 00 00 	movabs $0x801f80,%rdi
+  800112:	00 00 00 
+  800115:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011a:	48 b9 4b 03 80 00 00 	movabs $0x80034b,%rcx
+  800121:	00 00 00 
+  800124:	ff d1                	call   *%rcx
+	if (strncmp(TEMP_ADDR, str2, strlen(str2)) == 0)
+  800126:	48 bb 00 30 80 00 00 	movabs $0x803000,%rbx
+  80012d:	00 00 00 
+  800130:	48 8b 3b             	mov    (%rbx),%rdi
+  800133:	41 ff d4             	call   *%r12
+  800136:	48 63 d0             	movslq %eax,%rdx
+  800139:	48 8b 33             	mov    (%rbx),%rsi
+  80013c:	bf 00 00 a0 00       	mov    $0xa00000,%edi
+  800141:	48 b8 c6 0c 80 00 00 	movabs $0x800cc6,%rax
+  800148:	00 00 00 
+  80014b:	ff d0                	call   *%rax
+  80014d:	85 c0                	test   %eax,%eax
+  80014f:	0f 84 e8 00 00 00    	je     80023d <umain+0x20a>
+		cprintf("parent received correct message\n");
+	return;
+}
+  800155:	48 83 c4 10          	add    $0x10,%rsp
+  800159:	5b                   	pop    %rbx
+  80015a:	41 5c                	pop    %r12
+  80015c:	5d                   	pop    %rbp
+  80015d:	c3                   	ret
+		ipc_recv(&who, TEMP_ADDR_CHILD, 0);
+  80015e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800163:	be 00 00 b0 00       	mov    $0xb00000,%esi
+  800168:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  80016c:	48 b8 88 1b 80 00 00 	movabs $0x801b88,%rax
+  800173:	00 00 00 
+  800176:	ff d0                	call   *%rax
+		cprintf("%x got message: %s\n", who, TEMP_ADDR_CHILD);
+  800178:	ba 00 00 b0 00       	mov    $0xb00000,%edx
+  80017d:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  800180:	48 bf 80 1f 80 00 00 	movabs $0x801f80,%rdi
+  800187:	00 00 00 
+  80018a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018f:	48 b9 4b 03 80 00 00 	movabs $0x80034b,%rcx
+  800196:	00 00 00 
+  800199:	ff d1                	call   *%rcx
+		if (strncmp(TEMP_ADDR_CHILD, str1, strlen(str1)) == 0)
+  80019b:	48 bb 08 30 80 00 00 	movabs $0x803008,%rbx
+  8001a2:	00 00 00 
+  8001a5:	48 8b 3b             	mov    (%rbx),%rdi
+  8001a8:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  8001af:	00 00 00 
+  8001b2:	ff d0                	call   *%rax
+  8001b4:	48 63 d0             	movslq %eax,%rdx
+  8001b7:	48 8b 33             	mov    (%rbx),%rsi
+  8001ba:	bf 00 00 b0 00       	mov    $0xb00000,%edi
+  8001bf:	48 b8 c6 0c 80 00 00 	movabs $0x800cc6,%rax
+  8001c6:	00 00 00 
+  8001c9:	ff d0                	call   *%rax
+  8001cb:	85 c0                	test   %eax,%eax
+  8001cd:	74 56                	je     800225 <umain+0x1f2>
+		memcpy(TEMP_ADDR_CHILD, str2, strlen(str2) + 1);
+  8001cf:	48 bb 00 30 80 00 00 	movabs $0x803000,%rbx
+  8001d6:	00 00 00 
+  8001d9:	48 8b 3b             	mov    (%rbx),%rdi
+  8001dc:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  8001e3:	00 00 00 
+  8001e6:	ff d0                	call   *%rax
+  8001e8:	8d 50 01             	lea    0x1(%rax),%edx
+  8001eb:	48 63 d2             	movslq %edx,%rdx
+  8001ee:	48 8b 33             	mov    (%rbx),%rsi
+  8001f1:	bf 00 00 b0 00       	mov    $0xb00000,%edi
+  8001f6:	48 b8 bb 0d 80 00 00 	movabs $0x800dbb,%rax
+  8001fd:	00 00 00 
+  800200:	ff d0                	call   *%rax
+		ipc_send(who, 0, TEMP_ADDR_CHILD, PTE_P | PTE_W | PTE_U);
+  800202:	b9 07 00 00 00       	mov    $0x7,%ecx
+  800207:	ba 00 00 b0 00       	mov    $0xb00000,%edx
+  80020c:	be 00 00 00 00       	mov    $0x0,%esi
+  800211:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  800214:	48 b8 6b 1c 80 00 00 	movabs $0x801c6b,%rax
+  80021b:	00 00 00 
+  80021e:	ff d0                	call   *%rax
+		return;
+  800220:	e9 30 ff ff ff       	jmp    800155 <umain+0x122>
+			cprintf("child received correct message\n");
+  800225:	48 bf 98 1f 80 00 00 	movabs $0x801f98,%rdi
+  80022c:	00 00 00 
+  80022f:	48 ba 4b 03 80 00 00 	movabs $0x80034b,%rdx
+  800236:	00 00 00 
+  800239:	ff d2                	call   *%rdx
+  80023b:	eb 92                	jmp    8001cf <umain+0x19c>
+		cprintf("parent received correct message\n");
+  80023d:	48 bf b8 1f 80 00 00 	movabs $0x801fb8,%rdi
+  800244:	00 00 00 
+  800247:	48 ba 4b 03 80 00 00 	movabs $0x80034b,%rdx
+  80024e:	00 00 00 
+  800251:	ff d2                	call   *%rdx
+  800253:	e9 fd fe ff ff       	jmp    800155 <umain+0x122>
+
+0000000000800258 <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  800258:	55                   	push   %rbp
+  800259:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80025c:	85 ff                	test   %edi,%edi
+  80025e:	7e 0d                	jle    80026d <libmain+0x15>
+		binaryname = argv[0];
+  800260:	48 8b 06             	mov    (%rsi),%rax
+  800263:	48 a3 10 30 80 00 00 	movabs %rax,0x803010
+  80026a:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  80026d:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  800274:	00 00 00 
+  800277:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800279:	48 b8 87 02 80 00 00 	movabs $0x800287,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+
+0000000000800287 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800287:	55                   	push   %rbp
+  800288:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  80028b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800290:	48 b8 28 0f 80 00 00 	movabs $0x800f28,%rax
+  800297:	00 00 00 
+  80029a:	ff d0                	call   *%rax
+}
+  80029c:	5d                   	pop    %rbp
+  80029d:	c3                   	ret
+
+000000000080029e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80029e:	55                   	push   %rbp
+  80029f:	48 89 e5             	mov    %rsp,%rbp
+  8002a2:	53                   	push   %rbx
+  8002a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a7:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  8002aa:	8b 06                	mov    (%rsi),%eax
+  8002ac:	8d 50 01             	lea    0x1(%rax),%edx
+  8002af:	89 16                	mov    %edx,(%rsi)
+  8002b1:	48 98                	cltq
+  8002b3:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  8002b8:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002be:	74 0a                	je     8002ca <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002c0:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002c8:	c9                   	leave
+  8002c9:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002ca:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002ce:	be ff 00 00 00       	mov    $0xff,%esi
+  8002d3:	48 b8 f0 0e 80 00 00 	movabs $0x800ef0,%rax
+  8002da:	00 00 00 
+  8002dd:	ff d0                	call   *%rax
+		b->idx = 0;
+  8002df:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002e5:	eb d9                	jmp    8002c0 <putch+0x22>
+
+00000000008002e7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002e7:	55                   	push   %rbp
+  8002e8:	48 89 e5             	mov    %rsp,%rbp
+  8002eb:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002f2:	48 89 fa             	mov    %rdi,%rdx
+  8002f5:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  8002f8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8002ff:	00 00 00 
+	b.cnt = 0;
+  800302:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800309:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80030c:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  800313:	48 bf 9e 02 80 00 00 	movabs $0x80029e,%rdi
+  80031a:	00 00 00 
+  80031d:	48 b8 05 05 80 00 00 	movabs $0x800505,%rax
+  800324:	00 00 00 
+  800327:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  800329:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  800330:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800337:	48 b8 f0 0e 80 00 00 	movabs $0x800ef0,%rax
+  80033e:	00 00 00 
+  800341:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  800343:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  800349:	c9                   	leave
+  80034a:	c3                   	ret
+
+000000000080034b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80034b:	55                   	push   %rbp
+  80034c:	48 89 e5             	mov    %rsp,%rbp
+  80034f:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800356:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80035d:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800364:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80036b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800372:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800379:	84 c0                	test   %al,%al
+  80037b:	74 20                	je     80039d <cprintf+0x52>
+  80037d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800381:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800385:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800389:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80038d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800391:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800395:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800399:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80039d:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  8003a4:	00 00 00 
+  8003a7:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8003ae:	00 00 00 
+  8003b1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003b5:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8003bc:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8003c3:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  8003ca:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  8003d1:	48 b8 e7 02 80 00 00 	movabs $0x8002e7,%rax
+  8003d8:	00 00 00 
+  8003db:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  8003dd:	c9                   	leave
+  8003de:	c3                   	ret
+
+00000000008003df <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8003df:	55                   	push   %rbp
+  8003e0:	48 89 e5             	mov    %rsp,%rbp
+  8003e3:	41 57                	push   %r15
+  8003e5:	41 56                	push   %r14
+  8003e7:	41 55                	push   %r13
+  8003e9:	41 54                	push   %r12
+  8003eb:	53                   	push   %rbx
+  8003ec:	48 83 ec 18          	sub    $0x18,%rsp
+  8003f0:	49 89 fc             	mov    %rdi,%r12
+  8003f3:	49 89 f5             	mov    %rsi,%r13
+  8003f6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003fa:	44 89 c3             	mov    %r8d,%ebx
+  8003fd:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800400:	41 89 cf             	mov    %ecx,%r15d
+  800403:	4c 39 fa             	cmp    %r15,%rdx
+  800406:	72 29                	jb     800431 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800408:	48 89 d0             	mov    %rdx,%rax
+  80040b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800410:	49 f7 f7             	div    %r15
+  800413:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800417:	48 89 c2             	mov    %rax,%rdx
+  80041a:	48 b8 df 03 80 00 00 	movabs $0x8003df,%rax
+  800421:	00 00 00 
+  800424:	ff d0                	call   *%rax
+  800426:	eb 10                	jmp    800438 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800428:	4c 89 ee             	mov    %r13,%rsi
+  80042b:	44 89 f7             	mov    %r14d,%edi
+  80042e:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  800431:	83 eb 01             	sub    $0x1,%ebx
+  800434:	85 db                	test   %ebx,%ebx
+  800436:	7f f0                	jg     800428 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800438:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80043c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800441:	49 f7 f7             	div    %r15
+  800444:	48 b8 38 20 80 00 00 	movabs $0x802038,%rax
+  80044b:	00 00 00 
+  80044e:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  800452:	4c 89 ee             	mov    %r13,%rsi
+  800455:	41 ff d4             	call   *%r12
+}
+  800458:	48 83 c4 18          	add    $0x18,%rsp
+  80045c:	5b                   	pop    %rbx
+  80045d:	41 5c                	pop    %r12
+  80045f:	41 5d                	pop    %r13
+  800461:	41 5e                	pop    %r14
+  800463:	41 5f                	pop    %r15
+  800465:	5d                   	pop    %rbp
+  800466:	c3                   	ret
+
+0000000000800467 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  800467:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  80046b:	48 8b 06             	mov    (%rsi),%rax
+  80046e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800472:	73 0a                	jae    80047e <sprintputch+0x17>
+		*b->buf++ = ch;
+  800474:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800478:	48 89 16             	mov    %rdx,(%rsi)
+  80047b:	40 88 38             	mov    %dil,(%rax)
+}
+  80047e:	c3                   	ret
+
+000000000080047f <printfmt>:
+{
+  80047f:	55                   	push   %rbp
+  800480:	48 89 e5             	mov    %rsp,%rbp
+  800483:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80048a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800491:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800498:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80049f:	84 c0                	test   %al,%al
+  8004a1:	74 20                	je     8004c3 <printfmt+0x44>
+  8004a3:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8004a7:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8004ab:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8004af:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8004b3:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8004b7:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8004bb:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8004bf:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  8004c3:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8004ca:	00 00 00 
+  8004cd:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8004d4:	00 00 00 
+  8004d7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004db:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8004e2:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8004e9:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8004f0:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8004f7:	48 b8 05 05 80 00 00 	movabs $0x800505,%rax
+  8004fe:	00 00 00 
+  800501:	ff d0                	call   *%rax
+}
+  800503:	c9                   	leave
+  800504:	c3                   	ret
+
+0000000000800505 <vprintfmt>:
+{
+  800505:	55                   	push   %rbp
+  800506:	48 89 e5             	mov    %rsp,%rbp
+  800509:	41 57                	push   %r15
+  80050b:	41 56                	push   %r14
+  80050d:	41 55                	push   %r13
+  80050f:	41 54                	push   %r12
+  800511:	53                   	push   %rbx
+  800512:	48 83 ec 48          	sub    $0x48,%rsp
+  800516:	49 89 fe             	mov    %rdi,%r14
+  800519:	49 89 f5             	mov    %rsi,%r13
+  80051c:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  80051f:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  800523:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  800527:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80052b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80052f:	eb 09                	jmp    80053a <vprintfmt+0x35>
+			putch(ch, putdat);
+  800531:	4c 89 ee             	mov    %r13,%rsi
+  800534:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800537:	4c 89 e3             	mov    %r12,%rbx
+  80053a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80053e:	0f b6 3b             	movzbl (%rbx),%edi
+  800541:	83 ff 25             	cmp    $0x25,%edi
+  800544:	74 13                	je     800559 <vprintfmt+0x54>
+			if (ch == '\0')
+  800546:	85 ff                	test   %edi,%edi
+  800548:	75 e7                	jne    800531 <vprintfmt+0x2c>
+}
+  80054a:	48 83 c4 48          	add    $0x48,%rsp
+  80054e:	5b                   	pop    %rbx
+  80054f:	41 5c                	pop    %r12
+  800551:	41 5d                	pop    %r13
+  800553:	41 5e                	pop    %r14
+  800555:	41 5f                	pop    %r15
+  800557:	5d                   	pop    %rbp
+  800558:	c3                   	ret
+		padc = ' ';
+  800559:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  80055d:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  800564:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  80056a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  800571:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800576:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80057b:	41 0f b6 14 24       	movzbl (%r12),%edx
+  800580:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  800583:	3c 55                	cmp    $0x55,%al
+  800585:	0f 87 4f 05 00 00    	ja     800ada <vprintfmt+0x5d5>
+  80058b:	0f b6 c0             	movzbl %al,%eax
+  80058e:	48 be 00 21 80 00 00 	movabs $0x802100,%rsi
+  800595:	00 00 00 
+  800598:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  80059b:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  80059e:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  8005a2:	eb d2                	jmp    800576 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005a4:	49 89 dc             	mov    %rbx,%r12
+  8005a7:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  8005ab:	eb c9                	jmp    800576 <vprintfmt+0x71>
+  8005ad:	0f b6 d2             	movzbl %dl,%edx
+  8005b0:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  8005b3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  8005b9:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  8005bd:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  8005c2:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  8005c7:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  8005ca:	83 f8 09             	cmp    $0x9,%eax
+  8005cd:	77 20                	ja     8005ef <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  8005cf:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  8005d3:	eb e4                	jmp    8005b9 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  8005d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8005db:	77 27                	ja     800604 <vprintfmt+0xff>
+  8005dd:	89 c2                	mov    %eax,%edx
+  8005df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005e3:	83 c0 08             	add    $0x8,%eax
+  8005e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005e9:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  8005ec:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  8005ef:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005f3:	79 81                	jns    800576 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  8005f5:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  8005f9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005ff:	e9 72 ff ff ff       	jmp    800576 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  800604:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800608:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80060c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800610:	eb d7                	jmp    8005e9 <vprintfmt+0xe4>
+			if (width < 0)
+  800612:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  800615:	85 f6                	test   %esi,%esi
+  800617:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061c:	0f 49 c6             	cmovns %esi,%eax
+  80061f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800622:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800625:	e9 4c ff ff ff       	jmp    800576 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  80062a:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  80062d:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  800634:	e9 3d ff ff ff       	jmp    800576 <vprintfmt+0x71>
+			lflag++;
+  800639:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80063c:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  80063f:	e9 32 ff ff ff       	jmp    800576 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  800644:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800647:	83 f8 2f             	cmp    $0x2f,%eax
+  80064a:	77 19                	ja     800665 <vprintfmt+0x160>
+  80064c:	89 c2                	mov    %eax,%edx
+  80064e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800652:	83 c0 08             	add    $0x8,%eax
+  800655:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800658:	8b 3a                	mov    (%rdx),%edi
+  80065a:	4c 89 ee             	mov    %r13,%rsi
+  80065d:	41 ff d6             	call   *%r14
+			break;
+  800660:	e9 d5 fe ff ff       	jmp    80053a <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  800665:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800669:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80066d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800671:	eb e5                	jmp    800658 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  800673:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800676:	83 f8 2f             	cmp    $0x2f,%eax
+  800679:	77 5a                	ja     8006d5 <vprintfmt+0x1d0>
+  80067b:	89 c2                	mov    %eax,%edx
+  80067d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800681:	83 c0 08             	add    $0x8,%eax
+  800684:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800687:	8b 02                	mov    (%rdx),%eax
+  800689:	89 c1                	mov    %eax,%ecx
+  80068b:	f7 d9                	neg    %ecx
+  80068d:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800690:	83 f9 08             	cmp    $0x8,%ecx
+  800693:	7f 4e                	jg     8006e3 <vprintfmt+0x1de>
+  800695:	48 63 c1             	movslq %ecx,%rax
+  800698:	48 ba c0 23 80 00 00 	movabs $0x8023c0,%rdx
+  80069f:	00 00 00 
+  8006a2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006a6:	48 85 c0             	test   %rax,%rax
+  8006a9:	74 38                	je     8006e3 <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  8006ab:	48 89 c1             	mov    %rax,%rcx
+  8006ae:	48 ba 59 20 80 00 00 	movabs $0x802059,%rdx
+  8006b5:	00 00 00 
+  8006b8:	4c 89 ee             	mov    %r13,%rsi
+  8006bb:	4c 89 f7             	mov    %r14,%rdi
+  8006be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c3:	49 b8 7f 04 80 00 00 	movabs $0x80047f,%r8
+  8006ca:	00 00 00 
+  8006cd:	41 ff d0             	call   *%r8
+  8006d0:	e9 65 fe ff ff       	jmp    80053a <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  8006d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e1:	eb a4                	jmp    800687 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  8006e3:	48 ba 50 20 80 00 00 	movabs $0x802050,%rdx
+  8006ea:	00 00 00 
+  8006ed:	4c 89 ee             	mov    %r13,%rsi
+  8006f0:	4c 89 f7             	mov    %r14,%rdi
+  8006f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f8:	49 b8 7f 04 80 00 00 	movabs $0x80047f,%r8
+  8006ff:	00 00 00 
+  800702:	41 ff d0             	call   *%r8
+  800705:	e9 30 fe ff ff       	jmp    80053a <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  80070a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80070d:	83 f8 2f             	cmp    $0x2f,%eax
+  800710:	77 36                	ja     800748 <vprintfmt+0x243>
+  800712:	89 c2                	mov    %eax,%edx
+  800714:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800718:	83 c0 08             	add    $0x8,%eax
+  80071b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80071e:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800721:	48 85 c9             	test   %rcx,%rcx
+  800724:	48 b8 49 20 80 00 00 	movabs $0x802049,%rax
+  80072b:	00 00 00 
+  80072e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800732:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800736:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80073a:	7e 06                	jle    800742 <vprintfmt+0x23d>
+  80073c:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800740:	75 14                	jne    800756 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800742:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800746:	eb 64                	jmp    8007ac <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800748:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80074c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800750:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800754:	eb c8                	jmp    80071e <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800756:	49 63 f7             	movslq %r15d,%rsi
+  800759:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  80075d:	48 b8 e8 0b 80 00 00 	movabs $0x800be8,%rax
+  800764:	00 00 00 
+  800767:	ff d0                	call   *%rax
+  800769:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80076c:	29 c1                	sub    %eax,%ecx
+  80076e:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800771:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  800774:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800778:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80077b:	eb 0d                	jmp    80078a <vprintfmt+0x285>
+					putch(padc, putdat);
+  80077d:	4c 89 ee             	mov    %r13,%rsi
+  800780:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  800783:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800786:	41 83 ec 01          	sub    $0x1,%r12d
+  80078a:	45 85 e4             	test   %r12d,%r12d
+  80078d:	7f ee                	jg     80077d <vprintfmt+0x278>
+  80078f:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  800792:	85 c9                	test   %ecx,%ecx
+  800794:	b8 00 00 00 00       	mov    $0x0,%eax
+  800799:	0f 49 c1             	cmovns %ecx,%eax
+  80079c:	29 c1                	sub    %eax,%ecx
+  80079e:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  8007a1:	eb 9f                	jmp    800742 <vprintfmt+0x23d>
+					putch(ch, putdat);
+  8007a3:	4c 89 ee             	mov    %r13,%rsi
+  8007a6:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007a9:	4c 89 e2             	mov    %r12,%rdx
+  8007ac:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8007b0:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007b6:	0f be f8             	movsbl %al,%edi
+  8007b9:	85 ff                	test   %edi,%edi
+  8007bb:	74 29                	je     8007e6 <vprintfmt+0x2e1>
+  8007bd:	45 85 ff             	test   %r15d,%r15d
+  8007c0:	78 06                	js     8007c8 <vprintfmt+0x2c3>
+  8007c2:	41 83 ef 01          	sub    $0x1,%r15d
+  8007c6:	78 1e                	js     8007e6 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007c8:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  8007cc:	74 d5                	je     8007a3 <vprintfmt+0x29e>
+  8007ce:	0f be c0             	movsbl %al,%eax
+  8007d1:	83 e8 20             	sub    $0x20,%eax
+  8007d4:	83 f8 5e             	cmp    $0x5e,%eax
+  8007d7:	76 ca                	jbe    8007a3 <vprintfmt+0x29e>
+					putch('?', putdat);
+  8007d9:	4c 89 ee             	mov    %r13,%rsi
+  8007dc:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007e1:	41 ff d6             	call   *%r14
+  8007e4:	eb c3                	jmp    8007a9 <vprintfmt+0x2a4>
+  8007e6:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  8007ea:	8b 45 98             	mov    -0x68(%rbp),%eax
+  8007ed:	41 01 c4             	add    %eax,%r12d
+  8007f0:	41 29 d4             	sub    %edx,%r12d
+  8007f3:	eb 0f                	jmp    800804 <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  8007f5:	4c 89 ee             	mov    %r13,%rsi
+  8007f8:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007fd:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800800:	41 83 ec 01          	sub    $0x1,%r12d
+  800804:	45 85 e4             	test   %r12d,%r12d
+  800807:	7f ec                	jg     8007f5 <vprintfmt+0x2f0>
+  800809:	e9 2c fd ff ff       	jmp    80053a <vprintfmt+0x35>
+	if (lflag >= 2)
+  80080e:	83 f9 01             	cmp    $0x1,%ecx
+  800811:	7f 1d                	jg     800830 <vprintfmt+0x32b>
+	else if (lflag)
+  800813:	85 c9                	test   %ecx,%ecx
+  800815:	74 5e                	je     800875 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800817:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081a:	83 f8 2f             	cmp    $0x2f,%eax
+  80081d:	77 48                	ja     800867 <vprintfmt+0x362>
+  80081f:	89 c2                	mov    %eax,%edx
+  800821:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800825:	83 c0 08             	add    $0x8,%eax
+  800828:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80082b:	4c 8b 22             	mov    (%rdx),%r12
+  80082e:	eb 17                	jmp    800847 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800830:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800833:	83 f8 2f             	cmp    $0x2f,%eax
+  800836:	77 21                	ja     800859 <vprintfmt+0x354>
+  800838:	89 c2                	mov    %eax,%edx
+  80083a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083e:	83 c0 08             	add    $0x8,%eax
+  800841:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800844:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800847:	4d 85 e4             	test   %r12,%r12
+  80084a:	78 50                	js     80089c <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  80084c:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  80084f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800854:	e9 b4 01 00 00       	jmp    800a0d <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800859:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800861:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800865:	eb dd                	jmp    800844 <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800867:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800873:	eb b6                	jmp    80082b <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800875:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800878:	83 f8 2f             	cmp    $0x2f,%eax
+  80087b:	77 11                	ja     80088e <vprintfmt+0x389>
+  80087d:	89 c2                	mov    %eax,%edx
+  80087f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800883:	83 c0 08             	add    $0x8,%eax
+  800886:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800889:	4c 63 22             	movslq (%rdx),%r12
+  80088c:	eb b9                	jmp    800847 <vprintfmt+0x342>
+  80088e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800892:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800896:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089a:	eb ed                	jmp    800889 <vprintfmt+0x384>
+				putch('-', putdat);
+  80089c:	4c 89 ee             	mov    %r13,%rsi
+  80089f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008a4:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  8008a7:	4c 89 e2             	mov    %r12,%rdx
+  8008aa:	48 f7 da             	neg    %rdx
+			base = 10;
+  8008ad:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8008b2:	e9 56 01 00 00       	jmp    800a0d <vprintfmt+0x508>
+	if (lflag >= 2)
+  8008b7:	83 f9 01             	cmp    $0x1,%ecx
+  8008ba:	7f 25                	jg     8008e1 <vprintfmt+0x3dc>
+	else if (lflag)
+  8008bc:	85 c9                	test   %ecx,%ecx
+  8008be:	74 5e                	je     80091e <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  8008c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c6:	77 48                	ja     800910 <vprintfmt+0x40b>
+  8008c8:	89 c2                	mov    %eax,%edx
+  8008ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ce:	83 c0 08             	add    $0x8,%eax
+  8008d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d4:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8008d7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  8008dc:	e9 2c 01 00 00       	jmp    800a0d <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8008e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e7:	77 19                	ja     800902 <vprintfmt+0x3fd>
+  8008e9:	89 c2                	mov    %eax,%edx
+  8008eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ef:	83 c0 08             	add    $0x8,%eax
+  8008f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f5:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8008f8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  8008fd:	e9 0b 01 00 00       	jmp    800a0d <vprintfmt+0x508>
+  800902:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800906:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80090a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80090e:	eb e5                	jmp    8008f5 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800910:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800914:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800918:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091c:	eb b6                	jmp    8008d4 <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  80091e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800921:	83 f8 2f             	cmp    $0x2f,%eax
+  800924:	77 18                	ja     80093e <vprintfmt+0x439>
+  800926:	89 c2                	mov    %eax,%edx
+  800928:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092c:	83 c0 08             	add    $0x8,%eax
+  80092f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800932:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800934:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800939:	e9 cf 00 00 00       	jmp    800a0d <vprintfmt+0x508>
+  80093e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800942:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800946:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094a:	eb e6                	jmp    800932 <vprintfmt+0x42d>
+	if (lflag >= 2)
+  80094c:	83 f9 01             	cmp    $0x1,%ecx
+  80094f:	7f 25                	jg     800976 <vprintfmt+0x471>
+	else if (lflag)
+  800951:	85 c9                	test   %ecx,%ecx
+  800953:	74 5b                	je     8009b0 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800955:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800958:	83 f8 2f             	cmp    $0x2f,%eax
+  80095b:	77 45                	ja     8009a2 <vprintfmt+0x49d>
+  80095d:	89 c2                	mov    %eax,%edx
+  80095f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800963:	83 c0 08             	add    $0x8,%eax
+  800966:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800969:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  80096c:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800971:	e9 97 00 00 00       	jmp    800a0d <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800976:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800979:	83 f8 2f             	cmp    $0x2f,%eax
+  80097c:	77 16                	ja     800994 <vprintfmt+0x48f>
+  80097e:	89 c2                	mov    %eax,%edx
+  800980:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800984:	83 c0 08             	add    $0x8,%eax
+  800987:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098a:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  80098d:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800992:	eb 79                	jmp    800a0d <vprintfmt+0x508>
+  800994:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800998:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a0:	eb e8                	jmp    80098a <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  8009a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ae:	eb b9                	jmp    800969 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  8009b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b6:	77 15                	ja     8009cd <vprintfmt+0x4c8>
+  8009b8:	89 c2                	mov    %eax,%edx
+  8009ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009be:	83 c0 08             	add    $0x8,%eax
+  8009c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c4:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  8009c6:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  8009cb:	eb 40                	jmp    800a0d <vprintfmt+0x508>
+  8009cd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d9:	eb e9                	jmp    8009c4 <vprintfmt+0x4bf>
+			putch('0', putdat);
+  8009db:	4c 89 ee             	mov    %r13,%rsi
+  8009de:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009e3:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  8009e6:	4c 89 ee             	mov    %r13,%rsi
+  8009e9:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009ee:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  8009f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f7:	77 34                	ja     800a2d <vprintfmt+0x528>
+  8009f9:	89 c2                	mov    %eax,%edx
+  8009fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ff:	83 c0 08             	add    $0x8,%eax
+  800a02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800a05:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800a08:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800a0d:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800a12:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a16:	4c 89 ee             	mov    %r13,%rsi
+  800a19:	4c 89 f7             	mov    %r14,%rdi
+  800a1c:	48 b8 df 03 80 00 00 	movabs $0x8003df,%rax
+  800a23:	00 00 00 
+  800a26:	ff d0                	call   *%rax
+			break;
+  800a28:	e9 0d fb ff ff       	jmp    80053a <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800a2d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a31:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a35:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a39:	eb ca                	jmp    800a05 <vprintfmt+0x500>
+	if (lflag >= 2)
+  800a3b:	83 f9 01             	cmp    $0x1,%ecx
+  800a3e:	7f 22                	jg     800a62 <vprintfmt+0x55d>
+	else if (lflag)
+  800a40:	85 c9                	test   %ecx,%ecx
+  800a42:	74 58                	je     800a9c <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800a44:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a47:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4a:	77 42                	ja     800a8e <vprintfmt+0x589>
+  800a4c:	89 c2                	mov    %eax,%edx
+  800a4e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a52:	83 c0 08             	add    $0x8,%eax
+  800a55:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a58:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800a5b:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800a60:	eb ab                	jmp    800a0d <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800a62:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a65:	83 f8 2f             	cmp    $0x2f,%eax
+  800a68:	77 16                	ja     800a80 <vprintfmt+0x57b>
+  800a6a:	89 c2                	mov    %eax,%edx
+  800a6c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a70:	83 c0 08             	add    $0x8,%eax
+  800a73:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a76:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800a79:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800a7e:	eb 8d                	jmp    800a0d <vprintfmt+0x508>
+  800a80:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a84:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a88:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8c:	eb e8                	jmp    800a76 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800a8e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a92:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9a:	eb bc                	jmp    800a58 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800a9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a9f:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa2:	77 18                	ja     800abc <vprintfmt+0x5b7>
+  800aa4:	89 c2                	mov    %eax,%edx
+  800aa6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aaa:	83 c0 08             	add    $0x8,%eax
+  800aad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab0:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800ab2:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800ab7:	e9 51 ff ff ff       	jmp    800a0d <vprintfmt+0x508>
+  800abc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac8:	eb e6                	jmp    800ab0 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800aca:	4c 89 ee             	mov    %r13,%rsi
+  800acd:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ad2:	41 ff d6             	call   *%r14
+			break;
+  800ad5:	e9 60 fa ff ff       	jmp    80053a <vprintfmt+0x35>
+			putch('%', putdat);
+  800ada:	4c 89 ee             	mov    %r13,%rsi
+  800add:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ae2:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800ae5:	4c 89 e3             	mov    %r12,%rbx
+  800ae8:	eb 04                	jmp    800aee <vprintfmt+0x5e9>
+  800aea:	48 83 eb 01          	sub    $0x1,%rbx
+  800aee:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800af2:	75 f6                	jne    800aea <vprintfmt+0x5e5>
+  800af4:	e9 41 fa ff ff       	jmp    80053a <vprintfmt+0x35>
+
+0000000000800af9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800af9:	55                   	push   %rbp
+  800afa:	48 89 e5             	mov    %rsp,%rbp
+  800afd:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b01:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800b05:	48 63 c6             	movslq %esi,%rax
+  800b08:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800b0d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800b11:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800b18:	48 85 ff             	test   %rdi,%rdi
+  800b1b:	74 2a                	je     800b47 <vsnprintf+0x4e>
+  800b1d:	85 f6                	test   %esi,%esi
+  800b1f:	7e 26                	jle    800b47 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b21:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800b25:	48 bf 67 04 80 00 00 	movabs $0x800467,%rdi
+  800b2c:	00 00 00 
+  800b2f:	48 b8 05 05 80 00 00 	movabs $0x800505,%rax
+  800b36:	00 00 00 
+  800b39:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b3b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800b3f:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800b42:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800b45:	c9                   	leave
+  800b46:	c3                   	ret
+		return -E_INVAL;
+  800b47:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b4c:	eb f7                	jmp    800b45 <vsnprintf+0x4c>
+
+0000000000800b4e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b4e:	55                   	push   %rbp
+  800b4f:	48 89 e5             	mov    %rsp,%rbp
+  800b52:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800b59:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800b60:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800b67:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800b6e:	84 c0                	test   %al,%al
+  800b70:	74 20                	je     800b92 <snprintf+0x44>
+  800b72:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800b76:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800b7a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800b7e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800b82:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800b86:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800b8a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800b8e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b92:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800b99:	00 00 00 
+  800b9c:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800ba3:	00 00 00 
+  800ba6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800baa:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800bb1:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800bb8:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800bbf:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800bc6:	48 b8 f9 0a 80 00 00 	movabs $0x800af9,%rax
+  800bcd:	00 00 00 
+  800bd0:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800bd2:	c9                   	leave
+  800bd3:	c3                   	ret
+
+0000000000800bd4 <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800bd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bd9:	48 89 d0             	mov    %rdx,%rax
+  800bdc:	48 83 c2 01          	add    $0x1,%rdx
+  800be0:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800be5:	75 f2                	jne    800bd9 <strlen+0x5>
+		n++;
+	return n;
+}
+  800be7:	c3                   	ret
+
+0000000000800be8 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800be8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bed:	eb 03                	jmp    800bf2 <strnlen+0xa>
+  800bef:	48 89 d0             	mov    %rdx,%rax
+  800bf2:	48 39 c6             	cmp    %rax,%rsi
+  800bf5:	74 0a                	je     800c01 <strnlen+0x19>
+  800bf7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800bfb:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800bff:	75 ee                	jne    800bef <strnlen+0x7>
+		n++;
+	return n;
+}
+  800c01:	c3                   	ret
+
+0000000000800c02 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800c02:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800c05:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c0e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c11:	48 83 c2 01          	add    $0x1,%rdx
+  800c15:	84 c9                	test   %cl,%cl
+  800c17:	75 f1                	jne    800c0a <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800c19:	c3                   	ret
+
+0000000000800c1a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c1a:	55                   	push   %rbp
+  800c1b:	48 89 e5             	mov    %rsp,%rbp
+  800c1e:	41 54                	push   %r12
+  800c20:	53                   	push   %rbx
+  800c21:	48 89 fb             	mov    %rdi,%rbx
+  800c24:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800c27:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  800c2e:	00 00 00 
+  800c31:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800c33:	48 63 f8             	movslq %eax,%rdi
+  800c36:	48 01 df             	add    %rbx,%rdi
+  800c39:	4c 89 e6             	mov    %r12,%rsi
+  800c3c:	48 b8 02 0c 80 00 00 	movabs $0x800c02,%rax
+  800c43:	00 00 00 
+  800c46:	ff d0                	call   *%rax
+	return dst;
+}
+  800c48:	48 89 d8             	mov    %rbx,%rax
+  800c4b:	5b                   	pop    %rbx
+  800c4c:	41 5c                	pop    %r12
+  800c4e:	5d                   	pop    %rbp
+  800c4f:	c3                   	ret
+
+0000000000800c50 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c50:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c53:	48 01 fa             	add    %rdi,%rdx
+  800c56:	48 89 f9             	mov    %rdi,%rcx
+  800c59:	eb 14                	jmp    800c6f <strncpy+0x1f>
+		*dst++ = *src;
+  800c5b:	48 83 c1 01          	add    $0x1,%rcx
+  800c5f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c63:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c67:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c6b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800c6f:	48 39 d1             	cmp    %rdx,%rcx
+  800c72:	75 e7                	jne    800c5b <strncpy+0xb>
+	}
+	return ret;
+}
+  800c74:	c3                   	ret
+
+0000000000800c75 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c75:	48 89 f8             	mov    %rdi,%rax
+  800c78:	48 85 d2             	test   %rdx,%rdx
+  800c7b:	74 27                	je     800ca4 <strlcpy+0x2f>
+  800c7d:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800c82:	48 89 fa             	mov    %rdi,%rdx
+  800c85:	eb 0b                	jmp    800c92 <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c87:	48 83 c6 01          	add    $0x1,%rsi
+  800c8b:	48 83 c2 01          	add    $0x1,%rdx
+  800c8f:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800c92:	48 39 c2             	cmp    %rax,%rdx
+  800c95:	74 0a                	je     800ca1 <strlcpy+0x2c>
+  800c97:	0f b6 0e             	movzbl (%rsi),%ecx
+  800c9a:	84 c9                	test   %cl,%cl
+  800c9c:	75 e9                	jne    800c87 <strlcpy+0x12>
+  800c9e:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800ca1:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800ca4:	48 29 f8             	sub    %rdi,%rax
+}
+  800ca7:	c3                   	ret
+
+0000000000800ca8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800ca8:	eb 08                	jmp    800cb2 <strcmp+0xa>
+		p++, q++;
+  800caa:	48 83 c7 01          	add    $0x1,%rdi
+  800cae:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800cb2:	0f b6 07             	movzbl (%rdi),%eax
+  800cb5:	84 c0                	test   %al,%al
+  800cb7:	74 04                	je     800cbd <strcmp+0x15>
+  800cb9:	3a 06                	cmp    (%rsi),%al
+  800cbb:	74 ed                	je     800caa <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cbd:	0f b6 c0             	movzbl %al,%eax
+  800cc0:	0f b6 16             	movzbl (%rsi),%edx
+  800cc3:	29 d0                	sub    %edx,%eax
+}
+  800cc5:	c3                   	ret
+
+0000000000800cc6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800cc6:	eb 0c                	jmp    800cd4 <strncmp+0xe>
+		n--, p++, q++;
+  800cc8:	48 83 ea 01          	sub    $0x1,%rdx
+  800ccc:	48 83 c7 01          	add    $0x1,%rdi
+  800cd0:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800cd4:	48 85 d2             	test   %rdx,%rdx
+  800cd7:	74 14                	je     800ced <strncmp+0x27>
+  800cd9:	0f b6 07             	movzbl (%rdi),%eax
+  800cdc:	84 c0                	test   %al,%al
+  800cde:	74 04                	je     800ce4 <strncmp+0x1e>
+  800ce0:	3a 06                	cmp    (%rsi),%al
+  800ce2:	74 e4                	je     800cc8 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ce4:	0f b6 07             	movzbl (%rdi),%eax
+  800ce7:	0f b6 16             	movzbl (%rsi),%edx
+  800cea:	29 d0                	sub    %edx,%eax
+}
+  800cec:	c3                   	ret
+		return 0;
+  800ced:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf2:	c3                   	ret
+
+0000000000800cf3 <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800cf3:	eb 04                	jmp    800cf9 <strchr+0x6>
+  800cf5:	48 83 c7 01          	add    $0x1,%rdi
+  800cf9:	0f b6 07             	movzbl (%rdi),%eax
+  800cfc:	84 c0                	test   %al,%al
+  800cfe:	74 09                	je     800d09 <strchr+0x16>
+		if (*s == c)
+  800d00:	40 38 f0             	cmp    %sil,%al
+  800d03:	75 f0                	jne    800cf5 <strchr+0x2>
+  800d05:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800d08:	c3                   	ret
+	return 0;
+  800d09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d0e:	c3                   	ret
+
+0000000000800d0f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d0f:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800d12:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800d15:	40 38 f2             	cmp    %sil,%dl
+  800d18:	74 0a                	je     800d24 <strfind+0x15>
+  800d1a:	84 d2                	test   %dl,%dl
+  800d1c:	74 06                	je     800d24 <strfind+0x15>
+	for (; *s; s++)
+  800d1e:	48 83 c0 01          	add    $0x1,%rax
+  800d22:	eb ee                	jmp    800d12 <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800d24:	c3                   	ret
+
+0000000000800d25 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800d25:	48 85 d2             	test   %rdx,%rdx
+  800d28:	74 28                	je     800d52 <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800d2a:	48 89 f8             	mov    %rdi,%rax
+  800d2d:	48 09 d0             	or     %rdx,%rax
+  800d30:	a8 03                	test   $0x3,%al
+  800d32:	75 16                	jne    800d4a <memset+0x25>
+		c &= 0xFF;
+  800d34:	40 0f b6 f6          	movzbl %sil,%esi
+  800d38:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d3e:	48 89 d1             	mov    %rdx,%rcx
+  800d41:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800d45:	fc                   	cld
+  800d46:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800d48:	eb 08                	jmp    800d52 <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d4a:	89 f0                	mov    %esi,%eax
+  800d4c:	48 89 d1             	mov    %rdx,%rcx
+  800d4f:	fc                   	cld
+  800d50:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d52:	48 89 f8             	mov    %rdi,%rax
+  800d55:	c3                   	ret
+
+0000000000800d56 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d56:	48 89 f8             	mov    %rdi,%rax
+  800d59:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d5c:	48 39 fe             	cmp    %rdi,%rsi
+  800d5f:	73 3a                	jae    800d9b <memmove+0x45>
+  800d61:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d65:	48 39 d7             	cmp    %rdx,%rdi
+  800d68:	73 31                	jae    800d9b <memmove+0x45>
+		s += n;
+		d += n;
+  800d6a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800d6e:	48 89 d6             	mov    %rdx,%rsi
+  800d71:	48 09 fe             	or     %rdi,%rsi
+  800d74:	48 09 ce             	or     %rcx,%rsi
+  800d77:	40 f6 c6 03          	test   $0x3,%sil
+  800d7b:	75 11                	jne    800d8e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d7d:	48 83 ef 04          	sub    $0x4,%rdi
+  800d81:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800d85:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800d89:	fd                   	std
+  800d8a:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800d8c:	eb 0b                	jmp    800d99 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d8e:	48 83 ef 01          	sub    $0x1,%rdi
+  800d92:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800d96:	fd                   	std
+  800d97:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d99:	fc                   	cld
+  800d9a:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800d9b:	48 89 f2             	mov    %rsi,%rdx
+  800d9e:	48 09 c2             	or     %rax,%rdx
+  800da1:	48 09 ca             	or     %rcx,%rdx
+  800da4:	f6 c2 03             	test   $0x3,%dl
+  800da7:	75 0b                	jne    800db4 <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800da9:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800dad:	48 89 c7             	mov    %rax,%rdi
+  800db0:	fc                   	cld
+  800db1:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800db3:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800db4:	48 89 c7             	mov    %rax,%rdi
+  800db7:	fc                   	cld
+  800db8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800dba:	c3                   	ret
+
+0000000000800dbb <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800dbb:	55                   	push   %rbp
+  800dbc:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800dbf:	48 b8 56 0d 80 00 00 	movabs $0x800d56,%rax
+  800dc6:	00 00 00 
+  800dc9:	ff d0                	call   *%rax
+}
+  800dcb:	5d                   	pop    %rbp
+  800dcc:	c3                   	ret
+
+0000000000800dcd <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800dcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd2:	48 39 c2             	cmp    %rax,%rdx
+  800dd5:	74 1e                	je     800df5 <memcmp+0x28>
+		if (*s1 != *s2)
+  800dd7:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ddb:	48 83 c0 01          	add    $0x1,%rax
+  800ddf:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800de5:	44 38 c1             	cmp    %r8b,%cl
+  800de8:	74 e8                	je     800dd2 <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800dea:	0f b6 c1             	movzbl %cl,%eax
+  800ded:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800df1:	44 29 c0             	sub    %r8d,%eax
+  800df4:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800df5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dfa:	c3                   	ret
+
+0000000000800dfb <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800dfb:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800dfe:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800e01:	eb 04                	jmp    800e07 <memfind+0xc>
+  800e03:	48 83 c0 01          	add    $0x1,%rax
+  800e07:	48 39 d0             	cmp    %rdx,%rax
+  800e0a:	73 05                	jae    800e11 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e0c:	40 38 30             	cmp    %sil,(%rax)
+  800e0f:	75 f2                	jne    800e03 <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800e11:	c3                   	ret
+
+0000000000800e12 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e12:	48 89 f9             	mov    %rdi,%rcx
+  800e15:	49 89 f0             	mov    %rsi,%r8
+  800e18:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e1a:	eb 04                	jmp    800e20 <strtol+0xe>
+		s++;
+  800e1c:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800e20:	0f b6 01             	movzbl (%rcx),%eax
+  800e23:	3c 20                	cmp    $0x20,%al
+  800e25:	74 f5                	je     800e1c <strtol+0xa>
+  800e27:	3c 09                	cmp    $0x9,%al
+  800e29:	74 f1                	je     800e1c <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e2b:	3c 2b                	cmp    $0x2b,%al
+  800e2d:	74 2b                	je     800e5a <strtol+0x48>
+	int neg = 0;
+  800e2f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800e35:	3c 2d                	cmp    $0x2d,%al
+  800e37:	74 2d                	je     800e66 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e39:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800e3f:	75 0f                	jne    800e50 <strtol+0x3e>
+  800e41:	80 39 30             	cmpb   $0x30,(%rcx)
+  800e44:	74 2c                	je     800e72 <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e46:	85 ff                	test   %edi,%edi
+  800e48:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e4d:	0f 44 f8             	cmove  %eax,%edi
+  800e50:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800e55:	4c 63 d7             	movslq %edi,%r10
+  800e58:	eb 4f                	jmp    800ea9 <strtol+0x97>
+		s++;
+  800e5a:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800e5e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800e64:	eb d3                	jmp    800e39 <strtol+0x27>
+		s++, neg = 1;
+  800e66:	48 83 c1 01          	add    $0x1,%rcx
+  800e6a:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800e70:	eb c7                	jmp    800e39 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e72:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800e76:	74 0f                	je     800e87 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800e78:	85 ff                	test   %edi,%edi
+  800e7a:	75 d4                	jne    800e50 <strtol+0x3e>
+		s++, base = 8;
+  800e7c:	48 83 c1 01          	add    $0x1,%rcx
+  800e80:	bf 08 00 00 00       	mov    $0x8,%edi
+  800e85:	eb c9                	jmp    800e50 <strtol+0x3e>
+		s += 2, base = 16;
+  800e87:	48 83 c1 02          	add    $0x2,%rcx
+  800e8b:	bf 10 00 00 00       	mov    $0x10,%edi
+  800e90:	eb be                	jmp    800e50 <strtol+0x3e>
+			dig = *s - '0';
+  800e92:	0f be c0             	movsbl %al,%eax
+  800e95:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800e98:	39 f8                	cmp    %edi,%eax
+  800e9a:	7d 3b                	jge    800ed7 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800e9c:	48 83 c1 01          	add    $0x1,%rcx
+  800ea0:	49 0f af d2          	imul   %r10,%rdx
+  800ea4:	48 98                	cltq
+  800ea6:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800ea9:	0f b6 01             	movzbl (%rcx),%eax
+  800eac:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800eaf:	40 80 fe 09          	cmp    $0x9,%sil
+  800eb3:	76 dd                	jbe    800e92 <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800eb5:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800eb8:	40 80 fe 19          	cmp    $0x19,%sil
+  800ebc:	77 08                	ja     800ec6 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800ebe:	0f be c0             	movsbl %al,%eax
+  800ec1:	83 e8 57             	sub    $0x57,%eax
+  800ec4:	eb d2                	jmp    800e98 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ec6:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800ec9:	40 80 fe 19          	cmp    $0x19,%sil
+  800ecd:	77 08                	ja     800ed7 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800ecf:	0f be c0             	movsbl %al,%eax
+  800ed2:	83 e8 37             	sub    $0x37,%eax
+  800ed5:	eb c1                	jmp    800e98 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ed7:	4d 85 c0             	test   %r8,%r8
+  800eda:	74 03                	je     800edf <strtol+0xcd>
+		*endptr = (char *) s;
+  800edc:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800edf:	48 89 d0             	mov    %rdx,%rax
+  800ee2:	48 f7 d8             	neg    %rax
+  800ee5:	45 85 c9             	test   %r9d,%r9d
+  800ee8:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800eec:	48 89 d0             	mov    %rdx,%rax
+  800eef:	c3                   	ret
+
+0000000000800ef0 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800ef0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800ef6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800efc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f06:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800f08:	c3                   	ret
+
+0000000000800f09 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800f09:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f0f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f15:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f1a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f1f:	48 89 fe             	mov    %rdi,%rsi
+  800f22:	48 89 fa             	mov    %rdi,%rdx
+  800f25:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f27:	c3                   	ret
+
+0000000000800f28 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800f28:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800f2b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f37:	be 00 00 00 00       	mov    $0x0,%esi
+  800f3c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f41:	48 89 f2             	mov    %rsi,%rdx
+  800f44:	0f 05                	syscall
+	if(check && ret > 0)
+  800f46:	48 85 c0             	test   %rax,%rax
+  800f49:	7f 01                	jg     800f4c <sys_env_destroy+0x24>
+}
+  800f4b:	c3                   	ret
+{
+  800f4c:	55                   	push   %rbp
+  800f4d:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f50:	49 89 c0             	mov    %rax,%r8
+  800f53:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800f58:	48 ba 08 24 80 00 00 	movabs $0x802408,%rdx
+  800f5f:	00 00 00 
+  800f62:	be 28 00 00 00       	mov    $0x28,%esi
+  800f67:	48 bf 25 24 80 00 00 	movabs $0x802425,%rdi
+  800f6e:	00 00 00 
+  800f71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f76:	49 b9 5c 1d 80 00 00 	movabs $0x801d5c,%r9
+  800f7d:	00 00 00 
+  800f80:	41 ff d1             	call   *%r9
+
+0000000000800f83 <sys_getenvid>:
+  800f83:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800f8a:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800f8b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800f90:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800f94:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800f98:	48 c1 e2 04          	shl    $0x4,%rdx
+  800f9c:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800fa3:	00 00 00 
+  800fa6:	48 01 d0             	add    %rdx,%rax
+  800fa9:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800faf:	c3                   	ret
+
+0000000000800fb0 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800fb0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fb6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fc1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fc6:	48 89 fe             	mov    %rdi,%rsi
+  800fc9:	48 89 fa             	mov    %rdi,%rdx
+  800fcc:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800fce:	c3                   	ret
+
+0000000000800fcf <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  800fcf:	48 63 d2             	movslq %edx,%rdx
+  800fd2:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800fd5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fdb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fe1:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fe6:	0f 05                	syscall
+	if(check && ret > 0)
+  800fe8:	48 85 c0             	test   %rax,%rax
+  800feb:	7f 01                	jg     800fee <sys_page_alloc+0x1f>
+}
+  800fed:	c3                   	ret
+{
+  800fee:	55                   	push   %rbp
+  800fef:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff2:	49 89 c0             	mov    %rax,%r8
+  800ff5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800ffa:	48 ba 08 24 80 00 00 	movabs $0x802408,%rdx
+  801001:	00 00 00 
+  801004:	be 28 00 00 00       	mov    $0x28,%esi
+  801009:	48 bf 25 24 80 00 00 	movabs $0x802425,%rdi
+  801010:	00 00 00 
+  801013:	b8 00 00 00 00       	mov    $0x0,%eax
+  801018:	49 b9 5c 1d 80 00 00 	movabs $0x801d5c,%r9
+  80101f:	00 00 00 
+  801022:	41 ff d1             	call   *%r9
+
+0000000000801025 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  801025:	48 63 d2             	movslq %edx,%rdx
+  801028:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80102b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801031:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801037:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80103c:	0f 05                	syscall
+	if(check && ret > 0)
+  80103e:	48 85 c0             	test   %rax,%rax
+  801041:	7f 01                	jg     801044 <sys_page_alloc_huge+0x1f>
+}
+  801043:	c3                   	ret
+{
+  801044:	55                   	push   %rbp
+  801045:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801048:	49 89 c0             	mov    %rax,%r8
+  80104b:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801050:	48 ba 08 24 80 00 00 	movabs $0x802408,%rdx
+  801057:	00 00 00 
+  80105a:	be 28 00 00 00       	mov    $0x28,%esi
+  80105f:	48 bf 25 24 80 00 00 	movabs $0x802425,%rdi
+  801066:	00 00 00 
+  801069:	b8 00 00 00 00       	mov    $0x0,%eax
+  80106e:	49 b9 5c 1d 80 00 00 	movabs $0x801d5c,%r9
+  801075:	00 00 00 
+  801078:	41 ff d1             	call   *%r9
+
+000000000080107b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80107b:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  80107e:	48 63 d2             	movslq %edx,%rdx
+  801081:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  801084:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  801087:	b8 05 00 00 00       	mov    $0x5,%eax
+  80108c:	0f 05                	syscall
+	if(check && ret > 0)
+  80108e:	48 85 c0             	test   %rax,%rax
+  801091:	7f 01                	jg     801094 <sys_page_map+0x19>
+}
+  801093:	c3                   	ret
+{
+  801094:	55                   	push   %rbp
+  801095:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801098:	49 89 c0             	mov    %rax,%r8
+  80109b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8010a0:	48 ba 08 24 80 00 00 	movabs $0x802408,%rdx
+  8010a7:	00 00 00 
+  8010aa:	be 28 00 00 00       	mov    $0x28,%esi
+  8010af:	48 bf 25 24 80 00 00 	movabs $0x802425,%rdi
+  8010b6:	00 00 00 
+  8010b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010be:	49 b9 5c 1d 80 00 00 	movabs $0x801d5c,%r9
+  8010c5:	00 00 00 
+  8010c8:	41 ff d1             	call   *%r9
+
+00000000008010cb <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8010cb:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8010ce:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010df:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010e4:	0f 05                	syscall
+	if(check && ret > 0)
+  8010e6:	48 85 c0             	test   %rax,%rax
+  8010e9:	7f 01                	jg     8010ec <sys_page_unmap+0x21>
+}
+  8010eb:	c3                   	ret
+{
+  8010ec:	55                   	push   %rbp
+  8010ed:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010f0:	49 89 c0             	mov    %rax,%r8
+  8010f3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8010f8:	48 ba 08 24 80 00 00 	movabs $0x802408,%rdx
+  8010ff:	00 00 00 
+  801102:	be 28 00 00 00       	mov    $0x28,%esi
+  801107:	48 bf 25 24 80 00 00 	movabs $0x802425,%rdi
+  80110e:	00 00 00 
+  801111:	b8 00 00 00 00       	mov    $0x0,%eax
+  801116:	49 b9 5c 1d 80 00 00 	movabs $0x801d5c,%r9
+  80111d:	00 00 00 
+  801120:	41 ff d1             	call   *%r9
+
+0000000000801123 <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  801123:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801129:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80112f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801134:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801139:	48 89 fe             	mov    %rdi,%rsi
+  80113c:	48 89 fa             	mov    %rdi,%rdx
+  80113f:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801141:	c3                   	ret
+
+0000000000801142 <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  801142:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801148:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80114e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801153:	b8 10 00 00 00       	mov    $0x10,%eax
+  801158:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  80115a:	c3                   	ret
+
+000000000080115b <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  80115b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801161:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801167:	b8 11 00 00 00       	mov    $0x11,%eax
+  80116c:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  80116e:	c3                   	ret
+
+000000000080116f <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  80116f:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  801172:	48 63 f6             	movslq %esi,%rsi
+  801175:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  801178:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80117e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801183:	0f 05                	syscall
+	if(check && ret > 0)
+  801185:	48 85 c0             	test   %rax,%rax
+  801188:	7f 01                	jg     80118b <sys_page_batch+0x1c>
+}
+  80118a:	c3                   	ret
+{
+  80118b:	55                   	push   %rbp
+  80118c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80118f:	49 89 c0             	mov    %rax,%r8
+  801192:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801197:	48 ba 08 24 80 00 00 	movabs $0x802408,%rdx
+  80119e:	00 00 00 
+  8011a1:	be 28 00 00 00       	mov    $0x28,%esi
+  8011a6:	48 bf 25 24 80 00 00 	movabs $0x802425,%rdi
+  8011ad:	00 00 00 
+  8011b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b5:	49 b9 5c 1d 80 00 00 	movabs $0x801d5c,%r9
+  8011bc:	00 00 00 
+  8011bf:	41 ff d1             	call   *%r9
+
+00000000008011c2 <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  8011c2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d3:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011d8:	48 89 f2             	mov    %rsi,%rdx
+  8011db:	0f 05                	syscall
+	if(check && ret > 0)
+  8011dd:	48 85 c0             	test   %rax,%rax
+  8011e0:	7f 01                	jg     8011e3 <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  8011e2:	c3                   	ret
+{
+  8011e3:	55                   	push   %rbp
+  8011e4:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e7:	49 89 c0             	mov    %rax,%r8
+  8011ea:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8011ef:	48 ba 08 24 80 00 00 	movabs $0x802408,%rdx
+  8011f6:	00 00 00 
+  8011f9:	be 28 00 00 00       	mov    $0x28,%esi
+  8011fe:	48 bf 25 24 80 00 00 	movabs $0x802425,%rdi
+  801205:	00 00 00 
+  801208:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120d:	49 b9 5c 1d 80 00 00 	movabs $0x801d5c,%r9
+  801214:	00 00 00 
+  801217:	41 ff d1             	call   *%r9
+
+000000000080121a <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  80121a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801220:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801226:	bf 00 00 00 00       	mov    $0x0,%edi
+  80122b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801230:	48 89 fe             	mov    %rdi,%rsi
+  801233:	48 89 fa             	mov    %rdi,%rdx
+  801236:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801238:	c3                   	ret
+
+0000000000801239 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  801239:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80123c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801242:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801248:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80124d:	0f 05                	syscall
+	if(check && ret > 0)
+  80124f:	48 85 c0             	test   %rax,%rax
+  801252:	7f 01                	jg     801255 <sys_page_unmap_range+0x1c>
+}
+  801254:	c3                   	ret
+{
+  801255:	55                   	push   %rbp
+  801256:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801259:	49 89 c0             	mov    %rax,%r8
+  80125c:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801261:	48 ba 08 24 80 00 00 	movabs $0x802408,%rdx
+  801268:	00 00 00 
+  80126b:	be 28 00 00 00       	mov    $0x28,%esi
+  801270:	48 bf 25 24 80 00 00 	movabs $0x802425,%rdi
+  801277:	00 00 00 
+  80127a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80127f:	49 b9 5c 1d 80 00 00 	movabs $0x801d5c,%r9
+  801286:	00 00 00 
+  801289:	41 ff d1             	call   *%r9
+
+000000000080128c <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80128c:	48 63 f6             	movslq %esi,%rsi
+  80128f:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801292:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801298:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80129e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8012a8:	0f 05                	syscall
+	if(check && ret > 0)
+  8012aa:	48 85 c0             	test   %rax,%rax
+  8012ad:	7f 01                	jg     8012b0 <sys_env_set_status+0x24>
+}
+  8012af:	c3                   	ret
+{
+  8012b0:	55                   	push   %rbp
+  8012b1:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012b4:	49 89 c0             	mov    %rax,%r8
+  8012b7:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8012bc:	48 ba 08 24 80 00 00 	movabs $0x802408,%rdx
+  8012c3:	00 00 00 
+  8012c6:	be 28 00 00 00       	mov    $0x28,%esi
+  8012cb:	48 bf 25 24 80 00 00 	movabs $0x802425,%rdi
+  8012d2:	00 00 00 
+  8012d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012da:	49 b9 5c 1d 80 00 00 	movabs $0x801d5c,%r9
+  8012e1:	00 00 00 
+  8012e4:	41 ff d1             	call   *%r9
+
+00000000008012e7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8012e7:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8012ea:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8012f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8012f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012fb:	b8 09 00 00 00       	mov    $0x9,%eax
+  801300:	0f 05                	syscall
+	if(check && ret > 0)
+  801302:	48 85 c0             	test   %rax,%rax
+  801305:	7f 01                	jg     801308 <sys_env_set_pgfault_upcall+0x21>
+}
+  801307:	c3                   	ret
+{
+  801308:	55                   	push   %rbp
+  801309:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80130c:	49 89 c0             	mov    %rax,%r8
+  80130f:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801314:	48 ba 08 24 80 00 00 	movabs $0x802408,%rdx
+  80131b:	00 00 00 
+  80131e:	be 28 00 00 00       	mov    $0x28,%esi
+  801323:	48 bf 25 24 80 00 00 	movabs $0x802425,%rdi
+  80132a:	00 00 00 
+  80132d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801332:	49 b9 5c 1d 80 00 00 	movabs $0x801d5c,%r9
+  801339:	00 00 00 
+  80133c:	41 ff d1             	call   *%r9
+
+000000000080133f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80133f:	48 63 ff             	movslq %edi,%rdi
+  801342:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  801345:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80134b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801350:	0f 05                	syscall
+}
+  801352:	c3                   	ret
+
+0000000000801353 <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  801353:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801359:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80135f:	be 00 00 00 00       	mov    $0x0,%esi
+  801364:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801369:	48 89 f2             	mov    %rsi,%rdx
+  80136c:	0f 05                	syscall
+	if(check && ret > 0)
+  80136e:	48 85 c0             	test   %rax,%rax
+  801371:	7f 01                	jg     801374 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  801373:	c3                   	ret
+{
+  801374:	55                   	push   %rbp
+  801375:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801378:	49 89 c0             	mov    %rax,%r8
+  80137b:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801380:	48 ba 08 24 80 00 00 	movabs $0x802408,%rdx
+  801387:	00 00 00 
+  80138a:	be 28 00 00 00       	mov    $0x28,%esi
+  80138f:	48 bf 25 24 80 00 00 	movabs $0x802425,%rdi
+  801396:	00 00 00 
+  801399:	b8 00 00 00 00       	mov    $0x0,%eax
+  80139e:	49 b9 5c 1d 80 00 00 	movabs $0x801d5c,%r9
+  8013a5:	00 00 00 
+  8013a8:	41 ff d1             	call   *%r9
+
+00000000008013ab <pgfault>:
+- unmap PFTEMP using sys_page_unmap()
+- panic if any step fails
+*/
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8013ab:	55                   	push   %rbp
+  8013ac:	48 89 e5             	mov    %rsp,%rbp
+  8013af:	53                   	push   %rbx
+  8013b0:	48 83 ec 08          	sub    $0x8,%rsp
+	void *addr = (void *) utf->utf_fault_va;
+  8013b4:	48 8b 1f             	mov    (%rdi),%rbx
+	uint32_t err = utf->utf_err;
+  8013b7:	48 8b 47 08          	mov    0x8(%rdi),%rax
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+
+	if (!(err & FEC_WR)) {
+  8013bb:	a8 02                	test   $0x2,%al
+  8013bd:	0f 84 b1 00 00 00    	je     801474 <pgfault+0xc9>
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+	}
+	pte_t pte = uvpt[PGNUM(addr)];
+  8013c3:	48 89 da             	mov    %rbx,%rdx
+  8013c6:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8013ca:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8013d1:	01 00 00 
+  8013d4:	48 8b 0c d0          	mov    (%rax,%rdx,8),%rcx
+	if (!(pte & PTE_COW)) {
+  8013d8:	f6 c5 08             	test   $0x8,%ch
+  8013db:	0f 84 c3 00 00 00    	je     8014a4 <pgfault+0xf9>
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+
+	void *pg_addr = ROUNDDOWN(addr, PGSIZE);
+  8013e1:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  8013e8:	ba 07 00 00 00       	mov    $0x7,%edx
+  8013ed:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8013f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013f7:	48 b8 cf 0f 80 00 00 	movabs $0x800fcf,%rax
+  8013fe:	00 00 00 
+  801401:	ff d0                	call   *%rax
+	if (r < 0) {
+  801403:	85 c0                	test   %eax,%eax
+  801405:	0f 88 c7 00 00 00    	js     8014d2 <pgfault+0x127>
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+	}
+	memmove(PFTEMP, pg_addr, PGSIZE);
+  80140b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801410:	48 89 de             	mov    %rbx,%rsi
+  801413:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  801418:	48 b8 56 0d 80 00 00 	movabs $0x800d56,%rax
+  80141f:	00 00 00 
+  801422:	ff d0                	call   *%rax
+	r = sys_page_map(0, PFTEMP, 0, pg_addr, PTE_P | PTE_U | PTE_W);
+  801424:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  80142a:	48 89 d9             	mov    %rbx,%rcx
+  80142d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801432:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  801437:	bf 00 00 00 00       	mov    $0x0,%edi
+  80143c:	48 b8 7b 10 80 00 00 	movabs $0x80107b,%rax
+  801443:	00 00 00 
+  801446:	ff d0                	call   *%rax
+	if (r < 0) {
+  801448:	85 c0                	test   %eax,%eax
+  80144a:	0f 88 af 00 00 00    	js     8014ff <pgfault+0x154>
+		panic("pgfault: sys_page_map failed:  %e", r);
+	}
+	r = sys_page_unmap(0, PFTEMP);
+  801450:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  801455:	bf 00 00 00 00       	mov    $0x0,%edi
+  80145a:	48 b8 cb 10 80 00 00 	movabs $0x8010cb,%rax
+  801461:	00 00 00 
+  801464:	ff d0                	call   *%rax
+	if (r < 0) {
+  801466:	85 c0                	test   %eax,%eax
+  801468:	0f 88 be 00 00 00    	js     80152c <pgfault+0x181>
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+	}
+}
+  80146e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801472:	c9                   	leave
+  801473:	c3                   	ret
+  801474:	89 c1                	mov    %eax,%ecx
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+  801476:	49 89 d8             	mov    %rbx,%r8
+  801479:	48 ba 38 24 80 00 00 	movabs $0x802438,%rdx
+  801480:	00 00 00 
+  801483:	be 32 00 00 00       	mov    $0x32,%esi
+  801488:	48 bf e7 25 80 00 00 	movabs $0x8025e7,%rdi
+  80148f:	00 00 00 
+  801492:	b8 00 00 00 00       	mov    $0x0,%eax
+  801497:	49 b9 5c 1d 80 00 00 	movabs $0x801d5c,%r9
+  80149e:	00 00 00 
+  8014a1:	41 ff d1             	call   *%r9
+		panic("pgfault: page is not marked copy-on-write (pte=%p, va=%p)", pte, addr);
+  8014a4:	49 89 d8             	mov    %rbx,%r8
+  8014a7:	48 ba 60 24 80 00 00 	movabs $0x802460,%rdx
+  8014ae:	00 00 00 
+  8014b1:	be 36 00 00 00       	mov    $0x36,%esi
+  8014b6:	48 bf e7 25 80 00 00 	movabs $0x8025e7,%rdi
+  8014bd:	00 00 00 
+  8014c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c5:	49 b9 5c 1d 80 00 00 	movabs $0x801d5c,%r9
+  8014cc:	00 00 00 
+  8014cf:	41 ff d1             	call   *%r9
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+  8014d2:	89 c1                	mov    %eax,%ecx
+  8014d4:	48 ba a0 24 80 00 00 	movabs $0x8024a0,%rdx
+  8014db:	00 00 00 
+  8014de:	be 44 00 00 00       	mov    $0x44,%esi
+  8014e3:	48 bf e7 25 80 00 00 	movabs $0x8025e7,%rdi
+  8014ea:	00 00 00 
+  8014ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f2:	49 b8 5c 1d 80 00 00 	movabs $0x801d5c,%r8
+  8014f9:	00 00 00 
+  8014fc:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_map failed:  %e", r);
+  8014ff:	89 c1                	mov    %eax,%ecx
+  801501:	48 ba c8 24 80 00 00 	movabs $0x8024c8,%rdx
+  801508:	00 00 00 
+  80150b:	be 49 00 00 00       	mov    $0x49,%esi
+  801510:	48 bf e7 25 80 00 00 	movabs $0x8025e7,%rdi
+  801517:	00 00 00 
+  80151a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151f:	49 b8 5c 1d 80 00 00 	movabs $0x801d5c,%r8
+  801526:	00 00 00 
+  801529:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+  80152c:	89 c1                	mov    %eax,%ecx
+  80152e:	48 ba f0 24 80 00 00 	movabs $0x8024f0,%rdx
+  801535:	00 00 00 
+  801538:	be 4d 00 00 00       	mov    $0x4d,%esi
+  80153d:	48 bf e7 25 80 00 00 	movabs $0x8025e7,%rdi
+  801544:	00 00 00 
+  801547:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154c:	49 b8 5c 1d 80 00 00 	movabs $0x801d5c,%r8
+  801553:	00 00 00 
+  801556:	41 ff d0             	call   *%r8
+
+0000000000801559 <dupflush>:
+static struct PageOp dup_child[DUP_BATCH], dup_self[DUP_BATCH];
+static int ndup_child, ndup_self;
+
+static int
+dupflush(envid_t envid)
+{
+  801559:	55                   	push   %rbp
+  80155a:	48 89 e5             	mov    %rsp,%rbp
+  80155d:	89 fe                	mov    %edi,%esi
+	int r;
+
+	// Map to child first, then remap parent
+	r = sys_page_batch(0, envid, dup_child, ndup_child);
+  80155f:	a1 24 30 80 00 00 00 	movabs 0x803024,%eax
+  801566:	00 00 
+  801568:	48 63 c8             	movslq %eax,%rcx
+  80156b:	48 ba 40 36 80 00 00 	movabs $0x803640,%rdx
+  801572:	00 00 00 
+  801575:	bf 00 00 00 00       	mov    $0x0,%edi
+  80157a:	48 b8 6f 11 80 00 00 	movabs $0x80116f,%rax
+  801581:	00 00 00 
+  801584:	ff d0                	call   *%rax
+	if (r < 0) {
+  801586:	85 c0                	test   %eax,%eax
+  801588:	78 57                	js     8015e1 <dupflush+0x88>
+		panic("duppage: child map failed: %e", r);
+		return r;
+	}
+	r = sys_page_batch(0, 0, dup_self, ndup_self);
+  80158a:	a1 20 30 80 00 00 00 	movabs 0x803020,%eax
+  801591:	00 00 
+  801593:	48 63 c8             	movslq %eax,%rcx
+  801596:	48 ba 40 30 80 00 00 	movabs $0x803040,%rdx
+  80159d:	00 00 00 
+  8015a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015aa:	48 b8 6f 11 80 00 00 	movabs $0x80116f,%rax
+  8015b1:	00 00 00 
+  8015b4:	ff d0                	call   *%rax
+	if (r < 0) {
+  8015b6:	85 c0                	test   %eax,%eax
+  8015b8:	78 54                	js     80160e <dupflush+0xb5>
+		panic("duppage: parent remap failed: %e", r);
+		return r;
+	}
+	ndup_child = ndup_self = 0;
+  8015ba:	48 b8 20 30 80 00 00 	movabs $0x803020,%rax
+  8015c1:	00 00 00 
+  8015c4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  8015ca:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  8015d1:	00 00 00 
+  8015d4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	return 0;
+}
+  8015da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015df:	5d                   	pop    %rbp
+  8015e0:	c3                   	ret
+		panic("duppage: child map failed: %e", r);
+  8015e1:	89 c1                	mov    %eax,%ecx
+  8015e3:	48 ba f2 25 80 00 00 	movabs $0x8025f2,%rdx
+  8015ea:	00 00 00 
+  8015ed:	be 77 00 00 00       	mov    $0x77,%esi
+  8015f2:	48 bf e7 25 80 00 00 	movabs $0x8025e7,%rdi
+  8015f9:	00 00 00 
+  8015fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801601:	49 b8 5c 1d 80 00 00 	movabs $0x801d5c,%r8
+  801608:	00 00 00 
+  80160b:	41 ff d0             	call   *%r8
+		panic("duppage: parent remap failed: %e", r);
+  80160e:	89 c1                	mov    %eax,%ecx
+  801610:	48 ba 18 25 80 00 00 	movabs $0x802518,%rdx
+  801617:	00 00 00 
+  80161a:	be 7c 00 00 00       	mov    $0x7c,%esi
+  80161f:	48 bf e7 25 80 00 00 	movabs $0x8025e7,%rdi
+  801626:	00 00 00 
+  801629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162e:	49 b8 5c 1d 80 00 00 	movabs $0x801d5c,%r8
+  801635:	00 00 00 
+  801638:	41 ff d0             	call   *%r8
+
+000000000080163b <thread_start>:
+	return envid;
+}
+
+static void
+thread_start(void (*fn)(void *), void *arg)
+{
+  80163b:	55                   	push   %rbp
+  80163c:	48 89 e5             	mov    %rsp,%rbp
+  80163f:	48 89 f8             	mov    %rdi,%rax
+  801642:	48 89 f7             	mov    %rsi,%rdi
+	fn(arg);
+  801645:	ff d0                	call   *%rax
+	exit();
+  801647:	48 b8 87 02 80 00 00 	movabs $0x800287,%rax
+  80164e:	00 00 00 
+  801651:	ff d0                	call   *%rax
+}
+  801653:	5d                   	pop    %rbp
+  801654:	c3                   	ret
+
+0000000000801655 <fork>:
+{
+  801655:	55                   	push   %rbp
+  801656:	48 89 e5             	mov    %rsp,%rbp
+	set_pgfault_handler(pgfault);
+  801659:	48 bf ab 13 80 00 00 	movabs $0x8013ab,%rdi
+  801660:	00 00 00 
+  801663:	48 b8 4e 1e 80 00 00 	movabs $0x801e4e,%rax
+  80166a:	00 00 00 
+  80166d:	ff d0                	call   *%rax
+	return sys_fork();
+  80166f:	48 b8 23 11 80 00 00 	movabs $0x801123,%rax
+  801676:	00 00 00 
+  801679:	ff d0                	call   *%rax
+}
+  80167b:	5d                   	pop    %rbp
+  80167c:	c3                   	ret
+
+000000000080167d <ufork>:
+{
+  80167d:	55                   	push   %rbp
+  80167e:	48 89 e5             	mov    %rsp,%rbp
+  801681:	41 57                	push   %r15
+  801683:	41 56                	push   %r14
+  801685:	41 55                	push   %r13
+  801687:	41 54                	push   %r12
+  801689:	53                   	push   %rbx
+  80168a:	48 83 ec 38          	sub    $0x38,%rsp
+	set_pgfault_handler(pgfault);
+  80168e:	48 bf ab 13 80 00 00 	movabs $0x8013ab,%rdi
+  801695:	00 00 00 
+  801698:	48 b8 4e 1e 80 00 00 	movabs $0x801e4e,%rax
+  80169f:	00 00 00 
+  8016a2:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8016a4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8016a9:	cd 30                	int    $0x30
+  8016ab:	89 45 cc             	mov    %eax,-0x34(%rbp)
+	if (envid < 0) {
+  8016ae:	85 c0                	test   %eax,%eax
+  8016b0:	78 21                	js     8016d3 <ufork+0x56>
+	if (envid == 0) {
+  8016b2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8016b6:	0f 84 e4 03 00 00    	je     801aa0 <ufork+0x423>
+  8016bc:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8016c3:	00 
+	op->po_op = PAGEOP_MAP;
+  8016c4:	49 bf 40 36 80 00 00 	movabs $0x803640,%r15
+  8016cb:	00 00 00 
+  8016ce:	e9 e7 02 00 00       	jmp    8019ba <ufork+0x33d>
+		panic("sys_exofork failed: %e", envid);
+  8016d3:	89 c1                	mov    %eax,%ecx
+  8016d5:	48 ba 10 26 80 00 00 	movabs $0x802610,%rdx
+  8016dc:	00 00 00 
+  8016df:	be e4 00 00 00       	mov    $0xe4,%esi
+  8016e4:	48 bf e7 25 80 00 00 	movabs $0x8025e7,%rdi
+  8016eb:	00 00 00 
+  8016ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f3:	49 b8 5c 1d 80 00 00 	movabs $0x801d5c,%r8
+  8016fa:	00 00 00 
+  8016fd:	41 ff d0             	call   *%r8
+  801700:	44 89 e8             	mov    %r13d,%eax
+  801703:	c1 e0 09             	shl    $0x9,%eax
+  801706:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  801709:	44 89 e8             	mov    %r13d,%eax
+  80170c:	c1 e0 12             	shl    $0x12,%eax
+  80170f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  801712:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801719:	00 
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  80171a:	44 89 6d a8          	mov    %r13d,-0x58(%rbp)
+				int pdeIndex = pdpeIndex * NPTENTRIES + k;
+  80171e:	8b 75 c8             	mov    -0x38(%rbp),%esi
+				if (!(uvpd[pdeIndex] & PTE_P)) {
+  801721:	48 63 c6             	movslq %esi,%rax
+  801724:	48 bf 00 00 00 80 00 	movabs $0x10080000000,%rdi
+  80172b:	01 00 00 
+  80172e:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  801732:	a8 01                	test   $0x1,%al
+  801734:	0f 84 52 02 00 00    	je     80198c <ufork+0x30f>
+				if (uvpd[pdeIndex] & PTE_PS) {
+  80173a:	48 63 c6             	movslq %esi,%rax
+  80173d:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  801741:	a8 80                	test   $0x80,%al
+  801743:	74 52                	je     801797 <ufork+0x11a>
+					void *va = PGADDR(i, j, k, 0, 0);
+  801745:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  801749:	48 c1 e3 27          	shl    $0x27,%rbx
+  80174d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801751:	48 09 c3             	or     %rax,%rbx
+  801754:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801758:	48 09 c3             	or     %rax,%rbx
+					if ((uintptr_t)va >= UTOP) {
+  80175b:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  801760:	48 39 d8             	cmp    %rbx,%rax
+  801763:	0f 82 ca 02 00 00    	jb     801a33 <ufork+0x3b6>
+					r = sys_page_map(0, va, 0, va, uvpd[pdeIndex] & PTE_SYSCALL);
+  801769:	48 63 d6             	movslq %esi,%rdx
+  80176c:	4c 8b 04 d7          	mov    (%rdi,%rdx,8),%r8
+  801770:	41 81 e0 07 0e 00 00 	and    $0xe07,%r8d
+  801777:	48 89 d9             	mov    %rbx,%rcx
+  80177a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80177f:	48 89 de             	mov    %rbx,%rsi
+  801782:	bf 00 00 00 00       	mov    $0x0,%edi
+  801787:	48 b8 7b 10 80 00 00 	movabs $0x80107b,%rax
+  80178e:	00 00 00 
+  801791:	ff d0                	call   *%rax
+					if (r < 0) {
+  801793:	85 c0                	test   %eax,%eax
+  801795:	78 18                	js     8017af <ufork+0x132>
+  801797:	4c 63 65 ac          	movslq -0x54(%rbp),%r12
+  80179b:	4c 89 e3             	mov    %r12,%rbx
+  80179e:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8017a2:	4d 8d ac 24 00 02 00 	lea    0x200(%r12),%r13
+  8017a9:	00 
+  8017aa:	e9 00 01 00 00       	jmp    8018af <ufork+0x232>
+						panic("splitting 2MB page at %p failed: %e", va, r);
+  8017af:	41 89 c0             	mov    %eax,%r8d
+  8017b2:	48 89 d9             	mov    %rbx,%rcx
+  8017b5:	48 ba 40 25 80 00 00 	movabs $0x802540,%rdx
+  8017bc:	00 00 00 
+  8017bf:	be 0a 01 00 00       	mov    $0x10a,%esi
+  8017c4:	48 bf e7 25 80 00 00 	movabs $0x8025e7,%rdi
+  8017cb:	00 00 00 
+  8017ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d3:	49 b9 5c 1d 80 00 00 	movabs $0x801d5c,%r9
+  8017da:	00 00 00 
+  8017dd:	41 ff d1             	call   *%r9
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  8017e0:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  8017e7:	00 00 00 
+  8017ea:	8b 0f                	mov    (%rdi),%ecx
+  8017ec:	8d 71 01             	lea    0x1(%rcx),%esi
+  8017ef:	89 37                	mov    %esi,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  8017f1:	48 63 c9             	movslq %ecx,%rcx
+  8017f4:	48 8d 34 09          	lea    (%rcx,%rcx,1),%rsi
+  8017f8:	48 8d 3c 0e          	lea    (%rsi,%rcx,1),%rdi
+  8017fc:	41 c7 04 ff 01 00 00 	movl   $0x1,(%r15,%rdi,8)
+  801803:	00 
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  801804:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  80180a:	41 89 54 ff 04       	mov    %edx,0x4(%r15,%rdi,8)
+	op->po_srcva = op->po_dstva = va;
+  80180f:	49 89 44 ff 10       	mov    %rax,0x10(%r15,%rdi,8)
+  801814:	49 89 44 ff 08       	mov    %rax,0x8(%r15,%rdi,8)
+}
+  801819:	eb 76                	jmp    801891 <ufork+0x214>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U | PTE_COW);
+  80181b:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  801822:	00 00 00 
+  801825:	8b 17                	mov    (%rdi),%edx
+  801827:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  80182a:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  80182c:	48 63 d2             	movslq %edx,%rdx
+  80182f:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  801833:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  801837:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  80183e:	00 
+	op->po_perm = perm;
+  80183f:	41 c7 44 f7 04 05 08 	movl   $0x805,0x4(%r15,%rsi,8)
+  801846:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  801848:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  80184d:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+		dupqueue(&dup_self[ndup_self++], va, PTE_P | PTE_U | PTE_COW);
+  801852:	48 b9 20 30 80 00 00 	movabs $0x803020,%rcx
+  801859:	00 00 00 
+  80185c:	8b 11                	mov    (%rcx),%edx
+  80185e:	8d 72 01             	lea    0x1(%rdx),%esi
+  801861:	89 31                	mov    %esi,(%rcx)
+	op->po_op = PAGEOP_MAP;
+  801863:	48 be 40 30 80 00 00 	movabs $0x803040,%rsi
+  80186a:	00 00 00 
+  80186d:	48 63 d2             	movslq %edx,%rdx
+  801870:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  801874:	48 8d 3c 11          	lea    (%rcx,%rdx,1),%rdi
+  801878:	c7 04 fe 01 00 00 00 	movl   $0x1,(%rsi,%rdi,8)
+	op->po_perm = perm;
+  80187f:	c7 44 fe 04 05 08 00 	movl   $0x805,0x4(%rsi,%rdi,8)
+  801886:	00 
+	op->po_srcva = op->po_dstva = va;
+  801887:	48 89 44 fe 10       	mov    %rax,0x10(%rsi,%rdi,8)
+  80188c:	48 89 44 fe 08       	mov    %rax,0x8(%rsi,%rdi,8)
+	if (ndup_child == DUP_BATCH) {
+  801891:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  801898:	00 00 00 
+  80189b:	83 38 40             	cmpl   $0x40,(%rax)
+  80189e:	0f 84 a4 00 00 00    	je     801948 <ufork+0x2cb>
+				for (int l = 0; l < NPTENTRIES; l++) {
+  8018a4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018ab:	49 83 c4 01          	add    $0x1,%r12
+  8018af:	4d 39 ec             	cmp    %r13,%r12
+  8018b2:	0f 84 d4 00 00 00    	je     80198c <ufork+0x30f>
+					if (va >= UTOP) {
+  8018b8:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  8018bd:	48 39 d8             	cmp    %rbx,%rax
+  8018c0:	0f 82 6d 01 00 00    	jb     801a33 <ufork+0x3b6>
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  8018c6:	48 b8 00 10 80 43 ff 	movabs $0xffffffff43801000,%rax
+  8018cd:	ff ff ff 
+  8018d0:	48 01 d8             	add    %rbx,%rax
+  8018d3:	48 3d ff 0f 00 00    	cmp    $0xfff,%rax
+  8018d9:	76 c9                	jbe    8018a4 <ufork+0x227>
+					if (!(uvpt[pn] & PTE_P)) {
+  8018db:	4b 8b 04 e6          	mov    (%r14,%r12,8),%rax
+  8018df:	a8 01                	test   $0x1,%al
+  8018e1:	74 c1                	je     8018a4 <ufork+0x227>
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  8018e3:	48 b8 00 f0 ff ff ff 	movabs $0xffffffff000,%rax
+  8018ea:	0f 00 00 
+  8018ed:	48 21 d8             	and    %rbx,%rax
+	pte_t pte = uvpt[pn];
+  8018f0:	44 89 e2             	mov    %r12d,%edx
+  8018f3:	49 8b 14 d6          	mov    (%r14,%rdx,8),%rdx
+	if (pte & PTE_SHARE) {
+  8018f7:	f6 c6 04             	test   $0x4,%dh
+  8018fa:	0f 85 e0 fe ff ff    	jne    8017e0 <ufork+0x163>
+	} else if ((pte & PTE_W) || (pte & PTE_COW)) {
+  801900:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  801906:	0f 85 0f ff ff ff    	jne    80181b <ufork+0x19e>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U);
+  80190c:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  801913:	00 00 00 
+  801916:	8b 17                	mov    (%rdi),%edx
+  801918:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  80191b:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  80191d:	48 63 d2             	movslq %edx,%rdx
+  801920:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  801924:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  801928:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  80192f:	00 
+	op->po_perm = perm;
+  801930:	41 c7 44 f7 04 05 00 	movl   $0x5,0x4(%r15,%rsi,8)
+  801937:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  801939:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  80193e:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+}
+  801943:	e9 49 ff ff ff       	jmp    801891 <ufork+0x214>
+		return dupflush(envid);
+  801948:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80194b:	48 b8 59 15 80 00 00 	movabs $0x801559,%rax
+  801952:	00 00 00 
+  801955:	ff d0                	call   *%rax
+					if (r < 0) {
+  801957:	85 c0                	test   %eax,%eax
+  801959:	0f 89 45 ff ff ff    	jns    8018a4 <ufork+0x227>
+						panic("duppage failed:  %e", r);
+  80195f:	89 c1                	mov    %eax,%ecx
+  801961:	48 ba 27 26 80 00 00 	movabs $0x802627,%rdx
+  801968:	00 00 00 
+  80196b:	be 20 01 00 00       	mov    $0x120,%esi
+  801970:	48 bf e7 25 80 00 00 	movabs $0x8025e7,%rdi
+  801977:	00 00 00 
+  80197a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197f:	49 b8 5c 1d 80 00 00 	movabs $0x801d5c,%r8
+  801986:	00 00 00 
+  801989:	41 ff d0             	call   *%r8
+			for (int k = 0; k < NPTENTRIES; k++) {
+  80198c:	81 45 ac 00 02 00 00 	addl   $0x200,-0x54(%rbp)
+  801993:	83 45 c8 01          	addl   $0x1,-0x38(%rbp)
+  801997:	48 81 45 b0 00 00 20 	addq   $0x200000,-0x50(%rbp)
+  80199e:	00 
+  80199f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8019a3:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  8019a9:	0f 85 6f fd ff ff    	jne    80171e <ufork+0xa1>
+  8019af:	44 8b 6d a8          	mov    -0x58(%rbp),%r13d
+  8019b3:	eb 5d                	jmp    801a12 <ufork+0x395>
+	for (int i = 0; i < NPTENTRIES; i++) {
+  8019b5:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  8019ba:	48 81 7d c0 00 02 00 	cmpq   $0x200,-0x40(%rbp)
+  8019c1:	00 
+  8019c2:	74 6f                	je     801a33 <ufork+0x3b6>
+		if (!(uvpml4e[i] & PTE_P)) {
+  8019c4:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  8019c8:	48 63 c3             	movslq %ebx,%rax
+  8019cb:	48 be 00 20 40 80 00 	movabs $0x10080402000,%rsi
+  8019d2:	01 00 00 
+  8019d5:	48 8b 04 c6          	mov    (%rsi,%rax,8),%rax
+  8019d9:	a8 01                	test   $0x1,%al
+  8019db:	74 d8                	je     8019b5 <ufork+0x338>
+  8019dd:	41 89 dc             	mov    %ebx,%r12d
+  8019e0:	41 c1 e4 09          	shl    $0x9,%r12d
+  8019e4:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8019eb:	00 
+					if (!(uvpt[pn] & PTE_P)) {
+  8019ec:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8019f3:	01 00 00 
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  8019f6:	45 89 e5             	mov    %r12d,%r13d
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  8019f9:	49 63 c5             	movslq %r13d,%rax
+  8019fc:	48 bb 00 00 40 80 00 	movabs $0x10080400000,%rbx
+  801a03:	01 00 00 
+  801a06:	48 8b 04 c3          	mov    (%rbx,%rax,8),%rax
+  801a0a:	a8 01                	test   $0x1,%al
+  801a0c:	0f 85 ee fc ff ff    	jne    801700 <ufork+0x83>
+		for (int j = 0; j < NPTENTRIES; j++) {
+  801a12:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  801a19:	40 
+  801a1a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a1e:	41 83 c5 01          	add    $0x1,%r13d
+  801a22:	48 b9 00 00 00 00 80 	movabs $0x8000000000,%rcx
+  801a29:	00 00 00 
+  801a2c:	48 39 c8             	cmp    %rcx,%rax
+  801a2f:	75 c8                	jne    8019f9 <ufork+0x37c>
+  801a31:	eb 82                	jmp    8019b5 <ufork+0x338>
+	r = dupflush(envid);
+  801a33:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801a36:	48 b8 59 15 80 00 00 	movabs $0x801559,%rax
+  801a3d:	00 00 00 
+  801a40:	ff d0                	call   *%rax
+	if (r < 0) {
+  801a42:	85 c0                	test   %eax,%eax
+  801a44:	78 6c                	js     801ab2 <ufork+0x435>
+	r = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801a46:	ba 07 00 00 00       	mov    $0x7,%edx
+  801a4b:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801a50:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801a53:	48 b8 cf 0f 80 00 00 	movabs $0x800fcf,%rax
+  801a5a:	00 00 00 
+  801a5d:	ff d0                	call   *%rax
+	if (r < 0) {
+  801a5f:	85 c0                	test   %eax,%eax
+  801a61:	78 7c                	js     801adf <ufork+0x462>
+	r = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  801a63:	48 be 15 1f 80 00 00 	movabs $0x801f15,%rsi
+  801a6a:	00 00 00 
+  801a6d:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801a70:	48 b8 e7 12 80 00 00 	movabs $0x8012e7,%rax
+  801a77:	00 00 00 
+  801a7a:	ff d0                	call   *%rax
+	if (r < 0) {
+  801a7c:	85 c0                	test   %eax,%eax
+  801a7e:	0f 88 88 00 00 00    	js     801b0c <ufork+0x48f>
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  801a84:	be 02 00 00 00       	mov    $0x2,%esi
+  801a89:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801a8c:	48 b8 8c 12 80 00 00 	movabs $0x80128c,%rax
+  801a93:	00 00 00 
+  801a96:	ff d0                	call   *%rax
+	if (r < 0) {
+  801a98:	85 c0                	test   %eax,%eax
+  801a9a:	0f 88 99 00 00 00    	js     801b39 <ufork+0x4bc>
+}
+  801aa0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801aa3:	48 83 c4 38          	add    $0x38,%rsp
+  801aa7:	5b                   	pop    %rbx
+  801aa8:	41 5c                	pop    %r12
+  801aaa:	41 5d                	pop    %r13
+  801aac:	41 5e                	pop    %r14
+  801aae:	41 5f                	pop    %r15
+  801ab0:	5d                   	pop    %rbp
+  801ab1:	c3                   	ret
+		panic("duppage failed:  %e", r);
+  801ab2:	89 c1                	mov    %eax,%ecx
+  801ab4:	48 ba 27 26 80 00 00 	movabs $0x802627,%rdx
+  801abb:	00 00 00 
+  801abe:	be 29 01 00 00       	mov    $0x129,%esi
+  801ac3:	48 bf e7 25 80 00 00 	movabs $0x8025e7,%rdi
+  801aca:	00 00 00 
+  801acd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad2:	49 b8 5c 1d 80 00 00 	movabs $0x801d5c,%r8
+  801ad9:	00 00 00 
+  801adc:	41 ff d0             	call   *%r8
+		panic("sys_page_alloc for child exception stack failed: %e", r);
+  801adf:	89 c1                	mov    %eax,%ecx
+  801ae1:	48 ba 68 25 80 00 00 	movabs $0x802568,%rdx
+  801ae8:	00 00 00 
+  801aeb:	be 2e 01 00 00       	mov    $0x12e,%esi
+  801af0:	48 bf e7 25 80 00 00 	movabs $0x8025e7,%rdi
+  801af7:	00 00 00 
+  801afa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aff:	49 b8 5c 1d 80 00 00 	movabs $0x801d5c,%r8
+  801b06:	00 00 00 
+  801b09:	41 ff d0             	call   *%r8
+		panic("sys_env_set_pgfault_upcall failed:  %e", r);
+  801b0c:	89 c1                	mov    %eax,%ecx
+  801b0e:	48 ba a0 25 80 00 00 	movabs $0x8025a0,%rdx
+  801b15:	00 00 00 
+  801b18:	be 33 01 00 00       	mov    $0x133,%esi
+  801b1d:	48 bf e7 25 80 00 00 	movabs $0x8025e7,%rdi
+  801b24:	00 00 00 
+  801b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2c:	49 b8 5c 1d 80 00 00 	movabs $0x801d5c,%r8
+  801b33:	00 00 00 
+  801b36:	41 ff d0             	call   *%r8
+		panic("sys_env_set_status failed:  %e", r);
+  801b39:	89 c1                	mov    %eax,%ecx
+  801b3b:	48 ba c8 25 80 00 00 	movabs $0x8025c8,%rdx
+  801b42:	00 00 00 
+  801b45:	be 38 01 00 00       	mov    $0x138,%esi
+  801b4a:	48 bf e7 25 80 00 00 	movabs $0x8025e7,%rdi
+  801b51:	00 00 00 
+  801b54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b59:	49 b8 5c 1d 80 00 00 	movabs $0x801d5c,%r8
+  801b60:	00 00 00 
+  801b63:	41 ff d0             	call   *%r8
+
+0000000000801b66 <sfork>:
+// on one stack, since nothing is private to the child.
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801b66:	55                   	push   %rbp
+  801b67:	48 89 e5             	mov    %rsp,%rbp
+  801b6a:	48 89 f2             	mov    %rsi,%rdx
+	return sys_thread_create(thread_start, (uint64_t) fn, (uint64_t) arg);
+  801b6d:	48 89 fe             	mov    %rdi,%rsi
+  801b70:	48 bf 3b 16 80 00 00 	movabs $0x80163b,%rdi
+  801b77:	00 00 00 
+  801b7a:	48 b8 5b 11 80 00 00 	movabs $0x80115b,%rax
+  801b81:	00 00 00 
+  801b84:	ff d0                	call   *%rax
+}
+  801b86:	5d                   	pop    %rbp
+  801b87:	c3                   	ret
+
+0000000000801b88 <ipc_recv>:
+	- if perm_store non null, contents should be bitwise OR with thisenv->env_ipc_perm
+	- return the value sent by the sender: thisenv->env_ipc_value
+*/
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801b88:	55                   	push   %rbp
+  801b89:	48 89 e5             	mov    %rsp,%rbp
+  801b8c:	41 54                	push   %r12
+  801b8e:	53                   	push   %rbx
+  801b8f:	48 89 fb             	mov    %rdi,%rbx
+  801b92:	48 89 f7             	mov    %rsi,%rdi
+  801b95:	49 89 d4             	mov    %rdx,%r12
+	// LAB 4: Your code here.
+	int r;
+	
+	if (pg == NULL) pg = (void *)UTOP;
+  801b98:	48 85 f6             	test   %rsi,%rsi
+  801b9b:	b8 00 00 80 bc       	mov    $0xbc800000,%eax
+  801ba0:	48 0f 44 f8          	cmove  %rax,%rdi
+	
+	r = sys_ipc_recv(pg);
+  801ba4:	48 b8 53 13 80 00 00 	movabs $0x801353,%rax
+  801bab:	00 00 00 
+  801bae:	ff d0                	call   *%rax
+	
+	if (r < 0) {
+  801bb0:	85 c0                	test   %eax,%eax
+  801bb2:	0f 88 99 00 00 00    	js     801c51 <ipc_recv+0xc9>
+			*perm_store = 0;
+		}
+		return r;
+	}
+	
+	if (from_env_store) {
+  801bb8:	48 85 db             	test   %rbx,%rbx
+  801bbb:	74 2e                	je     801beb <ipc_recv+0x63>
+	asm volatile("movl %%gs:%c1, %0"
+  801bbd:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  801bc4:	00 
+		*from_env_store = thisenv->env_ipc_from;
+  801bc5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801bca:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801bce:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801bd2:	48 c1 e2 04          	shl    $0x4,%rdx
+  801bd6:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801bdd:	00 00 00 
+  801be0:	48 01 d0             	add    %rdx,%rax
+  801be3:	8b 80 1c 01 00 00    	mov    0x11c(%rax),%eax
+  801be9:	89 03                	mov    %eax,(%rbx)
+	}
+	if (perm_store) {
+  801beb:	4d 85 e4             	test   %r12,%r12
+  801bee:	74 30                	je     801c20 <ipc_recv+0x98>
+  801bf0:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  801bf7:	00 
+		*perm_store = thisenv->env_ipc_perm;
+  801bf8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801bfd:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801c01:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801c05:	48 c1 e2 04          	shl    $0x4,%rdx
+  801c09:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801c10:	00 00 00 
+  801c13:	48 01 d0             	add    %rdx,%rax
+  801c16:	8b 80 20 01 00 00    	mov    0x120(%rax),%eax
+  801c1c:	41 89 04 24          	mov    %eax,(%r12)
+  801c20:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  801c27:	00 
+	}
+	
+	return thisenv->env_ipc_value;
+  801c28:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801c2d:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  801c31:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  801c35:	48 c1 e2 04          	shl    $0x4,%rdx
+  801c39:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801c40:	00 00 00 
+  801c43:	48 01 d0             	add    %rdx,%rax
+  801c46:	8b 80 18 01 00 00    	mov    0x118(%rax),%eax
+}
+  801c4c:	5b                   	pop    %rbx
+  801c4d:	41 5c                	pop    %r12
+  801c4f:	5d                   	pop    %rbp
+  801c50:	c3                   	ret
+		if (from_env_store) {
+  801c51:	48 85 db             	test   %rbx,%rbx
+  801c54:	74 06                	je     801c5c <ipc_recv+0xd4>
+			*from_env_store = 0;
+  801c56:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+		if (perm_store) {
+  801c5c:	4d 85 e4             	test   %r12,%r12
+  801c5f:	74 eb                	je     801c4c <ipc_recv+0xc4>
+			*perm_store = 0;
+  801c61:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801c68:	00 
+  801c69:	eb e1                	jmp    801c4c <ipc_recv+0xc4>
+
+0000000000801c6b <ipc_send>:
+	- if a diff negative value, panic
+	- otherwise, body of loop should call sys_yield() to be allow JOS to schedule another env
+*/
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801c6b:	55                   	push   %rbp
+  801c6c:	48 89 e5             	mov    %rsp,%rbp
+  801c6f:	41 57                	push   %r15
+  801c71:	41 56                	push   %r14
+  801c73:	41 55                	push   %r13
+  801c75:	41 54                	push   %r12
+  801c77:	53                   	push   %rbx
+  801c78:	48 83 ec 18          	sub    $0x18,%rsp
+  801c7c:	41 89 fd             	mov    %edi,%r13d
+  801c7f:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  801c82:	48 89 d3             	mov    %rdx,%rbx
+  801c85:	41 89 cc             	mov    %ecx,%r12d
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  801c88:	48 85 d2             	test   %rdx,%rdx
+  801c8b:	b8 00 00 80 bc       	mov    $0xbc800000,%eax
+  801c90:	48 0f 44 d8          	cmove  %rax,%rbx
+	}
+	
+	// keep trying until success
+	while (1) {
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  801c94:	49 be 3f 13 80 00 00 	movabs $0x80133f,%r14
+  801c9b:	00 00 00 
+		if (r == 0) {
+			return;
+		}
+		
+		if (r == -E_IPC_NOT_RECV) {
+			sys_yield();
+  801c9e:	49 bf b0 0f 80 00 00 	movabs $0x800fb0,%r15
+  801ca5:	00 00 00 
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  801ca8:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  801cab:	44 89 e1             	mov    %r12d,%ecx
+  801cae:	48 89 da             	mov    %rbx,%rdx
+  801cb1:	44 89 ef             	mov    %r13d,%edi
+  801cb4:	41 ff d6             	call   *%r14
+		if (r == 0) {
+  801cb7:	85 c0                	test   %eax,%eax
+  801cb9:	74 37                	je     801cf2 <ipc_send+0x87>
+		if (r == -E_IPC_NOT_RECV) {
+  801cbb:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801cbe:	75 05                	jne    801cc5 <ipc_send+0x5a>
+			sys_yield();
+  801cc0:	41 ff d7             	call   *%r15
+		r = sys_ipc_try_send(to_env, val, pg, perm);
+  801cc3:	eb e3                	jmp    801ca8 <ipc_send+0x3d>
+		} else {
+			panic("ipc_send - %e", r);
+  801cc5:	89 c1                	mov    %eax,%ecx
+  801cc7:	48 ba 3b 26 80 00 00 	movabs $0x80263b,%rdx
+  801cce:	00 00 00 
+  801cd1:	be 67 00 00 00       	mov    $0x67,%esi
+  801cd6:	48 bf 49 26 80 00 00 	movabs $0x802649,%rdi
+  801cdd:	00 00 00 
+  801ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce5:	49 b8 5c 1d 80 00 00 	movabs $0x801d5c,%r8
+  801cec:	00 00 00 
+  801cef:	41 ff d0             	call   *%r8
+		}
+	}
+}
+  801cf2:	48 83 c4 18          	add    $0x18,%rsp
+  801cf6:	5b                   	pop    %rbx
+  801cf7:	41 5c                	pop    %r12
+  801cf9:	41 5d                	pop    %r13
+  801cfb:	41 5e                	pop    %r14
+  801cfd:	41 5f                	pop    %r15
+  801cff:	5d                   	pop    %rbp
+  801d00:	c3                   	ret
+
+0000000000801d01 <ipc_find_env>:
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+	int i;
+	for (i = 0; i < NENV; i++)
+  801d01:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  801d06:	48 be 00 00 80 bc 00 	movabs $0xbc800000,%rsi
+  801d0d:	00 00 00 
+  801d10:	48 63 c2             	movslq %edx,%rax
+  801d13:	48 8d 0c c0          	lea    (%rax,%rax,8),%rcx
+  801d17:	48 8d 04 48          	lea    (%rax,%rcx,2),%rax
+  801d1b:	48 c1 e0 04          	shl    $0x4,%rax
+  801d1f:	48 01 f0             	add    %rsi,%rax
+  801d22:	8b 80 c0 00 00 00    	mov    0xc0(%rax),%eax
+  801d28:	39 f8                	cmp    %edi,%eax
+  801d2a:	74 11                	je     801d3d <ipc_find_env+0x3c>
+	for (i = 0; i < NENV; i++)
+  801d2c:	83 c2 01             	add    $0x1,%edx
+  801d2f:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801d35:	75 d9                	jne    801d10 <ipc_find_env+0xf>
+			return envs[i].env_id;
+	return 0;
+  801d37:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d3c:	c3                   	ret
+			return envs[i].env_id;
+  801d3d:	48 63 d2             	movslq %edx,%rdx
+  801d40:	48 8d 14 4a          	lea    (%rdx,%rcx,2),%rdx
+  801d44:	48 c1 e2 04          	shl    $0x4,%rdx
+  801d48:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  801d4f:	00 00 00 
+  801d52:	48 01 d0             	add    %rdx,%rax
+  801d55:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+  801d5b:	c3                   	ret
+
+0000000000801d5c <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801d5c:	55                   	push   %rbp
+  801d5d:	48 89 e5             	mov    %rsp,%rbp
+  801d60:	41 56                	push   %r14
+  801d62:	41 55                	push   %r13
+  801d64:	41 54                	push   %r12
+  801d66:	53                   	push   %rbx
+  801d67:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  801d6e:	49 89 fc             	mov    %rdi,%r12
+  801d71:	41 89 f5             	mov    %esi,%r13d
+  801d74:	48 89 d3             	mov    %rdx,%rbx
+  801d77:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  801d7e:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  801d85:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  801d8c:	84 c0                	test   %al,%al
+  801d8e:	74 26                	je     801db6 <_panic+0x5a>
+  801d90:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  801d97:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  801d9e:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  801da2:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  801da6:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  801daa:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  801dae:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  801db2:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801db6:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  801dbd:	00 00 00 
+  801dc0:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  801dc7:	00 00 00 
+  801dca:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801dce:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  801dd5:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  801ddc:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801de3:	48 b8 10 30 80 00 00 	movabs $0x803010,%rax
+  801dea:	00 00 00 
+  801ded:	4c 8b 30             	mov    (%rax),%r14
+  801df0:	48 b8 83 0f 80 00 00 	movabs $0x800f83,%rax
+  801df7:	00 00 00 
+  801dfa:	ff d0                	call   *%rax
+  801dfc:	89 c6                	mov    %eax,%esi
+  801dfe:	45 89 e8             	mov    %r13d,%r8d
+  801e01:	4c 89 e1             	mov    %r12,%rcx
+  801e04:	4c 89 f2             	mov    %r14,%rdx
+  801e07:	48 bf 58 26 80 00 00 	movabs $0x802658,%rdi
+  801e0e:	00 00 00 
+  801e11:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e16:	49 bc 4b 03 80 00 00 	movabs $0x80034b,%r12
+  801e1d:	00 00 00 
+  801e20:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801e23:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  801e2a:	48 89 df             	mov    %rbx,%rdi
+  801e2d:	48 b8 e7 02 80 00 00 	movabs $0x8002e7,%rax
+  801e34:	00 00 00 
+  801e37:	ff d0                	call   *%rax
+	cprintf("\n");
+  801e39:	48 bf 92 1f 80 00 00 	movabs $0x801f92,%rdi
+  801e40:	00 00 00 
+  801e43:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e48:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801e4b:	cc                   	int3
+	while (1)
+  801e4c:	eb fd                	jmp    801e4b <_panic+0xef>
+
+0000000000801e4e <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801e4e:	55                   	push   %rbp
+  801e4f:	48 89 e5             	mov    %rsp,%rbp
+  801e52:	53                   	push   %rbx
+  801e53:	48 83 ec 08          	sub    $0x8,%rsp
+  801e57:	48 89 fb             	mov    %rdi,%rbx
+	int r;
+
+	if (_pgfault_handler == 0) {
+  801e5a:	48 ba 40 3c 80 00 00 	movabs $0x803c40,%rdx
+  801e61:	00 00 00 
+  801e64:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801e68:	74 13                	je     801e7d <set_pgfault_handler+0x2f>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801e6a:	48 89 d8             	mov    %rbx,%rax
+  801e6d:	48 a3 40 3c 80 00 00 	movabs %rax,0x803c40
+  801e74:	00 00 00 
+}
+  801e77:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e7b:	c9                   	leave
+  801e7c:	c3                   	ret
+		r = sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801e7d:	ba 07 00 00 00       	mov    $0x7,%edx
+  801e82:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801e87:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e8c:	48 b8 cf 0f 80 00 00 	movabs $0x800fcf,%rax
+  801e93:	00 00 00 
+  801e96:	ff d0                	call   *%rax
+		if (r < 0) {
+  801e98:	85 c0                	test   %eax,%eax
+  801e9a:	78 4c                	js     801ee8 <set_pgfault_handler+0x9a>
+		r = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801e9c:	48 be 15 1f 80 00 00 	movabs $0x801f15,%rsi
+  801ea3:	00 00 00 
+  801ea6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eab:	48 b8 e7 12 80 00 00 	movabs $0x8012e7,%rax
+  801eb2:	00 00 00 
+  801eb5:	ff d0                	call   *%rax
+		if (r < 0) {
+  801eb7:	85 c0                	test   %eax,%eax
+  801eb9:	79 af                	jns    801e6a <set_pgfault_handler+0x1c>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+  801ebb:	89 c1                	mov    %eax,%ecx
+  801ebd:	48 ba a8 26 80 00 00 	movabs $0x8026a8,%rdx
+  801ec4:	00 00 00 
+  801ec7:	be 2c 00 00 00       	mov    $0x2c,%esi
+  801ecc:	48 bf 96 26 80 00 00 	movabs $0x802696,%rdi
+  801ed3:	00 00 00 
+  801ed6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801edb:	49 b8 5c 1d 80 00 00 	movabs $0x801d5c,%r8
+  801ee2:	00 00 00 
+  801ee5:	41 ff d0             	call   *%r8
+			panic("sys_page_alloc failed:  %e", r);
+  801ee8:	89 c1                	mov    %eax,%ecx
+  801eea:	48 ba 7b 26 80 00 00 	movabs $0x80267b,%rdx
+  801ef1:	00 00 00 
+  801ef4:	be 28 00 00 00       	mov    $0x28,%esi
+  801ef9:	48 bf 96 26 80 00 00 	movabs $0x802696,%rdi
+  801f00:	00 00 00 
+  801f03:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f08:	49 b8 5c 1d 80 00 00 	movabs $0x801d5c,%r8
+  801f0f:	00 00 00 
+  801f12:	41 ff d0             	call   *%r8
+
+0000000000801f15 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi		// function argument: pointer to UTF
+  801f15:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  801f18:	48 a1 40 3c 80 00 00 	movabs 0x803c40,%rax
+  801f1f:	00 00 00 
+	call *%rax
+  801f22:	ff d0                	call   *%rax
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here. (Hint. You need to modify the trap time rsp to make room for the return rip ) */
+
+	movq  152(%rsp), %rax
+  801f24:	48 8b 84 24 98 00 00 	mov    0x98(%rsp),%rax
+  801f2b:	00 
+	subq $8, %rax
+  801f2c:	48 83 e8 08          	sub    $0x8,%rax
+	movq %rax, 152(%rsp)
+  801f30:	48 89 84 24 98 00 00 	mov    %rax,0x98(%rsp)
+  801f37:	00 
+
+	movq 136(%rsp), %rbx
+  801f38:	48 8b 9c 24 88 00 00 	mov    0x88(%rsp),%rbx
+  801f3f:	00 
+	movq %rbx, (%rax)
+  801f40:	48 89 18             	mov    %rbx,(%rax)
+
+	/* Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here. (Hint, the oposite of _alltraps) */
+
+	addq $16, %rsp
+  801f43:	48 83 c4 10          	add    $0x10,%rsp
+	
+	popq %r15
+  801f47:	41 5f                	pop    %r15
+	popq %r14
+  801f49:	41 5e                	pop    %r14
+	popq %r13
+  801f4b:	41 5d                	pop    %r13
+	popq %r12
+  801f4d:	41 5c                	pop    %r12
+	popq %r11
+  801f4f:	41 5b                	pop    %r11
+	popq %r10
+  801f51:	41 5a                	pop    %r10
+	popq %r9
+  801f53:	41 59                	pop    %r9
+	popq %r8
+  801f55:	41 58                	pop    %r8
+	popq %rsi
+  801f57:	5e                   	pop    %rsi
+	popq %rdi
+  801f58:	5f                   	pop    %rdi
+	popq %rbp
+  801f59:	5d                   	pop    %rbp
+	popq %rdx
+  801f5a:	5a                   	pop    %rdx
+	popq %rcx
+  801f5b:	59                   	pop    %rcx
+	popq %rbx
+  801f5c:	5b                   	pop    %rbx
+	popq %rax
+  801f5d:	58                   	pop    %rax
+
+	addq $8, %rsp
+  801f5e:	48 83 c4 08          	add    $0x8,%rsp
+	/* Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 4: Your code here. */
+
+	popfq
+  801f62:	9d                   	popf
+
+	/* Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here. */
+
+	popq %rsp
+  801f63:	5c                   	pop    %rsp
+
+	/* Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here. */
+  801f64:	c3                   	ret
@@ -0,0 +1,2242 @@
+
+obj/user/softint:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 05 00 00 00       	call   800036 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	asm volatile("int $14");	// page fault
+  800033:	cd 0e                	int    $0xe
+}
+  800035:	c3                   	ret
+
+0000000000800036 <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  800036:	55                   	push   %rbp
+  800037:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80003a:	85 ff                	test   %edi,%edi
+  80003c:	7e 0d                	jle    80004b <libmain+0x15>
+		binaryname = argv[0];
+  80003e:	48 8b 06             	mov    (%rsi),%rax
+  800041:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  800048:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  80004b:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  800052:	00 00 00 
+  800055:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800057:	48 b8 65 00 80 00 00 	movabs $0x800065,%rax
+  80005e:	00 00 00 
+  800061:	ff d0                	call   *%rax
+}
+  800063:	5d                   	pop    %rbp
+  800064:	c3                   	ret
+
+0000000000800065 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800065:	55                   	push   %rbp
+  800066:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  800069:	bf 00 00 00 00       	mov    $0x0,%edi
+  80006e:	48 b8 b4 00 80 00 00 	movabs $0x8000b4,%rax
+  800075:	00 00 00 
+  800078:	ff d0                	call   *%rax
+}
+  80007a:	5d                   	pop    %rbp
+  80007b:	c3                   	ret
+
+000000000080007c <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  80007c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800082:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800088:	ba 00 00 00 00       	mov    $0x0,%edx
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800094:	c3                   	ret
+
+0000000000800095 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800095:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80009b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8000a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000a6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000ab:	48 89 fe             	mov    %rdi,%rsi
+  8000ae:	48 89 fa             	mov    %rdi,%rdx
+  8000b1:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000b3:	c3                   	ret
+
+00000000008000b4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8000b4:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8000b7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8000bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8000c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8000c8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000cd:	48 89 f2             	mov    %rsi,%rdx
+  8000d0:	0f 05                	syscall
+	if(check && ret > 0)
+  8000d2:	48 85 c0             	test   %rax,%rax
+  8000d5:	7f 01                	jg     8000d8 <sys_env_destroy+0x24>
+}
+  8000d7:	c3                   	ret
+{
+  8000d8:	55                   	push   %rbp
+  8000d9:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8000dc:	49 89 c0             	mov    %rax,%r8
+  8000df:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8000e4:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  8000eb:	00 00 00 
+  8000ee:	be 28 00 00 00       	mov    $0x28,%esi
+  8000f3:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  8000fa:	00 00 00 
+  8000fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800102:	49 b9 37 05 80 00 00 	movabs $0x800537,%r9
+  800109:	00 00 00 
+  80010c:	41 ff d1             	call   *%r9
+
+000000000080010f <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  80010f:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800116:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800117:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80011c:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800120:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800124:	48 c1 e2 04          	shl    $0x4,%rdx
+  800128:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  80012f:	00 00 00 
+  800132:	48 01 d0             	add    %rdx,%rax
+  800135:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  80013b:	c3                   	ret
+
+000000000080013c <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  80013c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800142:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800148:	bf 00 00 00 00       	mov    $0x0,%edi
+  80014d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800152:	48 89 fe             	mov    %rdi,%rsi
+  800155:	48 89 fa             	mov    %rdi,%rdx
+  800158:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80015a:	c3                   	ret
+
+000000000080015b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  80015b:	48 63 d2             	movslq %edx,%rdx
+  80015e:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800161:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800167:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80016d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800172:	0f 05                	syscall
+	if(check && ret > 0)
+  800174:	48 85 c0             	test   %rax,%rax
+  800177:	7f 01                	jg     80017a <sys_page_alloc+0x1f>
+}
+  800179:	c3                   	ret
+{
+  80017a:	55                   	push   %rbp
+  80017b:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80017e:	49 89 c0             	mov    %rax,%r8
+  800181:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800186:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  80018d:	00 00 00 
+  800190:	be 28 00 00 00       	mov    $0x28,%esi
+  800195:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  80019c:	00 00 00 
+  80019f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a4:	49 b9 37 05 80 00 00 	movabs $0x800537,%r9
+  8001ab:	00 00 00 
+  8001ae:	41 ff d1             	call   *%r9
+
+00000000008001b1 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8001b1:	48 63 d2             	movslq %edx,%rdx
+  8001b4:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8001b7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8001bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8001c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8001c8:	0f 05                	syscall
+	if(check && ret > 0)
+  8001ca:	48 85 c0             	test   %rax,%rax
+  8001cd:	7f 01                	jg     8001d0 <sys_page_alloc_huge+0x1f>
+}
+  8001cf:	c3                   	ret
+{
+  8001d0:	55                   	push   %rbp
+  8001d1:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001d4:	49 89 c0             	mov    %rax,%r8
+  8001d7:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8001dc:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  8001e3:	00 00 00 
+  8001e6:	be 28 00 00 00       	mov    $0x28,%esi
+  8001eb:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  8001f2:	00 00 00 
+  8001f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fa:	49 b9 37 05 80 00 00 	movabs $0x800537,%r9
+  800201:	00 00 00 
+  800204:	41 ff d1             	call   *%r9
+
+0000000000800207 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800207:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  80020a:	48 63 d2             	movslq %edx,%rdx
+  80020d:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800210:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  800213:	b8 05 00 00 00       	mov    $0x5,%eax
+  800218:	0f 05                	syscall
+	if(check && ret > 0)
+  80021a:	48 85 c0             	test   %rax,%rax
+  80021d:	7f 01                	jg     800220 <sys_page_map+0x19>
+}
+  80021f:	c3                   	ret
+{
+  800220:	55                   	push   %rbp
+  800221:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800224:	49 89 c0             	mov    %rax,%r8
+  800227:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80022c:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  800233:	00 00 00 
+  800236:	be 28 00 00 00       	mov    $0x28,%esi
+  80023b:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  800242:	00 00 00 
+  800245:	b8 00 00 00 00       	mov    $0x0,%eax
+  80024a:	49 b9 37 05 80 00 00 	movabs $0x800537,%r9
+  800251:	00 00 00 
+  800254:	41 ff d1             	call   *%r9
+
+0000000000800257 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  800257:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80025a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800260:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800266:	ba 00 00 00 00       	mov    $0x0,%edx
+  80026b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800270:	0f 05                	syscall
+	if(check && ret > 0)
+  800272:	48 85 c0             	test   %rax,%rax
+  800275:	7f 01                	jg     800278 <sys_page_unmap+0x21>
+}
+  800277:	c3                   	ret
+{
+  800278:	55                   	push   %rbp
+  800279:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80027c:	49 89 c0             	mov    %rax,%r8
+  80027f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800284:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  80028b:	00 00 00 
+  80028e:	be 28 00 00 00       	mov    $0x28,%esi
+  800293:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  80029a:	00 00 00 
+  80029d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a2:	49 b9 37 05 80 00 00 	movabs $0x800537,%r9
+  8002a9:	00 00 00 
+  8002ac:	41 ff d1             	call   *%r9
+
+00000000008002af <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  8002af:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002c0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8002c5:	48 89 fe             	mov    %rdi,%rsi
+  8002c8:	48 89 fa             	mov    %rdi,%rdx
+  8002cb:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8002cd:	c3                   	ret
+
+00000000008002ce <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  8002ce:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002df:	b8 10 00 00 00       	mov    $0x10,%eax
+  8002e4:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  8002e6:	c3                   	ret
+
+00000000008002e7 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  8002e7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8002ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8002f3:	b8 11 00 00 00       	mov    $0x11,%eax
+  8002f8:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  8002fa:	c3                   	ret
+
+00000000008002fb <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  8002fb:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  8002fe:	48 63 f6             	movslq %esi,%rsi
+  800301:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800304:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80030a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80030f:	0f 05                	syscall
+	if(check && ret > 0)
+  800311:	48 85 c0             	test   %rax,%rax
+  800314:	7f 01                	jg     800317 <sys_page_batch+0x1c>
+}
+  800316:	c3                   	ret
+{
+  800317:	55                   	push   %rbp
+  800318:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80031b:	49 89 c0             	mov    %rax,%r8
+  80031e:	b9 12 00 00 00       	mov    $0x12,%ecx
+  800323:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  80032a:	00 00 00 
+  80032d:	be 28 00 00 00       	mov    $0x28,%esi
+  800332:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  800339:	00 00 00 
+  80033c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800341:	49 b9 37 05 80 00 00 	movabs $0x800537,%r9
+  800348:	00 00 00 
+  80034b:	41 ff d1             	call   *%r9
+
+000000000080034e <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  80034e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800354:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80035a:	be 00 00 00 00       	mov    $0x0,%esi
+  80035f:	b8 13 00 00 00       	mov    $0x13,%eax
+  800364:	48 89 f2             	mov    %rsi,%rdx
+  800367:	0f 05                	syscall
+	if(check && ret > 0)
+  800369:	48 85 c0             	test   %rax,%rax
+  80036c:	7f 01                	jg     80036f <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  80036e:	c3                   	ret
+{
+  80036f:	55                   	push   %rbp
+  800370:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800373:	49 89 c0             	mov    %rax,%r8
+  800376:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80037b:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  800382:	00 00 00 
+  800385:	be 28 00 00 00       	mov    $0x28,%esi
+  80038a:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  800391:	00 00 00 
+  800394:	b8 00 00 00 00       	mov    $0x0,%eax
+  800399:	49 b9 37 05 80 00 00 	movabs $0x800537,%r9
+  8003a0:	00 00 00 
+  8003a3:	41 ff d1             	call   *%r9
+
+00000000008003a6 <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  8003a6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8003ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8003b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003b7:	b8 14 00 00 00       	mov    $0x14,%eax
+  8003bc:	48 89 fe             	mov    %rdi,%rsi
+  8003bf:	48 89 fa             	mov    %rdi,%rdx
+  8003c2:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8003c4:	c3                   	ret
+
+00000000008003c5 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  8003c5:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8003c8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8003ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8003d4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8003d9:	0f 05                	syscall
+	if(check && ret > 0)
+  8003db:	48 85 c0             	test   %rax,%rax
+  8003de:	7f 01                	jg     8003e1 <sys_page_unmap_range+0x1c>
+}
+  8003e0:	c3                   	ret
+{
+  8003e1:	55                   	push   %rbp
+  8003e2:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003e5:	49 89 c0             	mov    %rax,%r8
+  8003e8:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8003ed:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  8003f4:	00 00 00 
+  8003f7:	be 28 00 00 00       	mov    $0x28,%esi
+  8003fc:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  800403:	00 00 00 
+  800406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040b:	49 b9 37 05 80 00 00 	movabs $0x800537,%r9
+  800412:	00 00 00 
+  800415:	41 ff d1             	call   *%r9
+
+0000000000800418 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  800418:	48 63 f6             	movslq %esi,%rsi
+  80041b:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80041e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800424:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80042a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80042f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800434:	0f 05                	syscall
+	if(check && ret > 0)
+  800436:	48 85 c0             	test   %rax,%rax
+  800439:	7f 01                	jg     80043c <sys_env_set_status+0x24>
+}
+  80043b:	c3                   	ret
+{
+  80043c:	55                   	push   %rbp
+  80043d:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800440:	49 89 c0             	mov    %rax,%r8
+  800443:	b9 08 00 00 00       	mov    $0x8,%ecx
+  800448:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  80044f:	00 00 00 
+  800452:	be 28 00 00 00       	mov    $0x28,%esi
+  800457:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  80045e:	00 00 00 
+  800461:	b8 00 00 00 00       	mov    $0x0,%eax
+  800466:	49 b9 37 05 80 00 00 	movabs $0x800537,%r9
+  80046d:	00 00 00 
+  800470:	41 ff d1             	call   *%r9
+
+0000000000800473 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  800473:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800476:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80047c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800482:	ba 00 00 00 00       	mov    $0x0,%edx
+  800487:	b8 09 00 00 00       	mov    $0x9,%eax
+  80048c:	0f 05                	syscall
+	if(check && ret > 0)
+  80048e:	48 85 c0             	test   %rax,%rax
+  800491:	7f 01                	jg     800494 <sys_env_set_pgfault_upcall+0x21>
+}
+  800493:	c3                   	ret
+{
+  800494:	55                   	push   %rbp
+  800495:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800498:	49 89 c0             	mov    %rax,%r8
+  80049b:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004a0:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  8004a7:	00 00 00 
+  8004aa:	be 28 00 00 00       	mov    $0x28,%esi
+  8004af:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  8004b6:	00 00 00 
+  8004b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004be:	49 b9 37 05 80 00 00 	movabs $0x800537,%r9
+  8004c5:	00 00 00 
+  8004c8:	41 ff d1             	call   *%r9
+
+00000000008004cb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8004cb:	48 63 ff             	movslq %edi,%rdi
+  8004ce:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  8004d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8004d7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8004dc:	0f 05                	syscall
+}
+  8004de:	c3                   	ret
+
+00000000008004df <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  8004df:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8004e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8004eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8004f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8004f5:	48 89 f2             	mov    %rsi,%rdx
+  8004f8:	0f 05                	syscall
+	if(check && ret > 0)
+  8004fa:	48 85 c0             	test   %rax,%rax
+  8004fd:	7f 01                	jg     800500 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  8004ff:	c3                   	ret
+{
+  800500:	55                   	push   %rbp
+  800501:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800504:	49 89 c0             	mov    %rax,%r8
+  800507:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80050c:	48 ba 8a 12 80 00 00 	movabs $0x80128a,%rdx
+  800513:	00 00 00 
+  800516:	be 28 00 00 00       	mov    $0x28,%esi
+  80051b:	48 bf a7 12 80 00 00 	movabs $0x8012a7,%rdi
+  800522:	00 00 00 
+  800525:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052a:	49 b9 37 05 80 00 00 	movabs $0x800537,%r9
+  800531:	00 00 00 
+  800534:	41 ff d1             	call   *%r9
+
+0000000000800537 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800537:	55                   	push   %rbp
+  800538:	48 89 e5             	mov    %rsp,%rbp
+  80053b:	41 56                	push   %r14
+  80053d:	41 55                	push   %r13
+  80053f:	41 54                	push   %r12
+  800541:	53                   	push   %rbx
+  800542:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800549:	49 89 fc             	mov    %rdi,%r12
+  80054c:	41 89 f5             	mov    %esi,%r13d
+  80054f:	48 89 d3             	mov    %rdx,%rbx
+  800552:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800559:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800560:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800567:	84 c0                	test   %al,%al
+  800569:	74 26                	je     800591 <_panic+0x5a>
+  80056b:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800572:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800579:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  80057d:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800581:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800585:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800589:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  80058d:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800591:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800598:	00 00 00 
+  80059b:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8005a2:	00 00 00 
+  8005a5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005a9:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8005b0:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8005b7:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005be:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  8005c5:	00 00 00 
+  8005c8:	4c 8b 30             	mov    (%rax),%r14
+  8005cb:	48 b8 0f 01 80 00 00 	movabs $0x80010f,%rax
+  8005d2:	00 00 00 
+  8005d5:	ff d0                	call   *%rax
+  8005d7:	89 c6                	mov    %eax,%esi
+  8005d9:	45 89 e8             	mov    %r13d,%r8d
+  8005dc:	4c 89 e1             	mov    %r12,%rcx
+  8005df:	4c 89 f2             	mov    %r14,%rdx
+  8005e2:	48 bf b8 12 80 00 00 	movabs $0x8012b8,%rdi
+  8005e9:	00 00 00 
+  8005ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f1:	49 bc d6 06 80 00 00 	movabs $0x8006d6,%r12
+  8005f8:	00 00 00 
+  8005fb:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8005fe:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  800605:	48 89 df             	mov    %rbx,%rdi
+  800608:	48 b8 72 06 80 00 00 	movabs $0x800672,%rax
+  80060f:	00 00 00 
+  800612:	ff d0                	call   *%rax
+	cprintf("\n");
+  800614:	48 bf db 12 80 00 00 	movabs $0x8012db,%rdi
+  80061b:	00 00 00 
+  80061e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800623:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800626:	cc                   	int3
+	while (1)
+  800627:	eb fd                	jmp    800626 <_panic+0xef>
+
+0000000000800629 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800629:	55                   	push   %rbp
+  80062a:	48 89 e5             	mov    %rsp,%rbp
+  80062d:	53                   	push   %rbx
+  80062e:	48 83 ec 08          	sub    $0x8,%rsp
+  800632:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  800635:	8b 06                	mov    (%rsi),%eax
+  800637:	8d 50 01             	lea    0x1(%rax),%edx
+  80063a:	89 16                	mov    %edx,(%rsi)
+  80063c:	48 98                	cltq
+  80063e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  800643:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800649:	74 0a                	je     800655 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80064b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80064f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800653:	c9                   	leave
+  800654:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800655:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800659:	be ff 00 00 00       	mov    $0xff,%esi
+  80065e:	48 b8 7c 00 80 00 00 	movabs $0x80007c,%rax
+  800665:	00 00 00 
+  800668:	ff d0                	call   *%rax
+		b->idx = 0;
+  80066a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800670:	eb d9                	jmp    80064b <putch+0x22>
+
+0000000000800672 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800672:	55                   	push   %rbp
+  800673:	48 89 e5             	mov    %rsp,%rbp
+  800676:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80067d:	48 89 fa             	mov    %rdi,%rdx
+  800680:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  800683:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  80068a:	00 00 00 
+	b.cnt = 0;
+  80068d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800694:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800697:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  80069e:	48 bf 29 06 80 00 00 	movabs $0x800629,%rdi
+  8006a5:	00 00 00 
+  8006a8:	48 b8 90 08 80 00 00 	movabs $0x800890,%rax
+  8006af:	00 00 00 
+  8006b2:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8006b4:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  8006bb:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8006c2:	48 b8 7c 00 80 00 00 	movabs $0x80007c,%rax
+  8006c9:	00 00 00 
+  8006cc:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  8006ce:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  8006d4:	c9                   	leave
+  8006d5:	c3                   	ret
+
+00000000008006d6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8006d6:	55                   	push   %rbp
+  8006d7:	48 89 e5             	mov    %rsp,%rbp
+  8006da:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8006e1:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8006e8:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8006ef:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8006f6:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8006fd:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800704:	84 c0                	test   %al,%al
+  800706:	74 20                	je     800728 <cprintf+0x52>
+  800708:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80070c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800710:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800714:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800718:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80071c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800720:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800724:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800728:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  80072f:	00 00 00 
+  800732:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800739:	00 00 00 
+  80073c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800740:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800747:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80074e:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  800755:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  80075c:	48 b8 72 06 80 00 00 	movabs $0x800672,%rax
+  800763:	00 00 00 
+  800766:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  800768:	c9                   	leave
+  800769:	c3                   	ret
+
+000000000080076a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80076a:	55                   	push   %rbp
+  80076b:	48 89 e5             	mov    %rsp,%rbp
+  80076e:	41 57                	push   %r15
+  800770:	41 56                	push   %r14
+  800772:	41 55                	push   %r13
+  800774:	41 54                	push   %r12
+  800776:	53                   	push   %rbx
+  800777:	48 83 ec 18          	sub    $0x18,%rsp
+  80077b:	49 89 fc             	mov    %rdi,%r12
+  80077e:	49 89 f5             	mov    %rsi,%r13
+  800781:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800785:	44 89 c3             	mov    %r8d,%ebx
+  800788:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80078b:	41 89 cf             	mov    %ecx,%r15d
+  80078e:	4c 39 fa             	cmp    %r15,%rdx
+  800791:	72 29                	jb     8007bc <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800793:	48 89 d0             	mov    %rdx,%rax
+  800796:	ba 00 00 00 00       	mov    $0x0,%edx
+  80079b:	49 f7 f7             	div    %r15
+  80079e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8007a2:	48 89 c2             	mov    %rax,%rdx
+  8007a5:	48 b8 6a 07 80 00 00 	movabs $0x80076a,%rax
+  8007ac:	00 00 00 
+  8007af:	ff d0                	call   *%rax
+  8007b1:	eb 10                	jmp    8007c3 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8007b3:	4c 89 ee             	mov    %r13,%rsi
+  8007b6:	44 89 f7             	mov    %r14d,%edi
+  8007b9:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  8007bc:	83 eb 01             	sub    $0x1,%ebx
+  8007bf:	85 db                	test   %ebx,%ebx
+  8007c1:	7f f0                	jg     8007b3 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007c3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007cc:	49 f7 f7             	div    %r15
+  8007cf:	48 b8 dd 12 80 00 00 	movabs $0x8012dd,%rax
+  8007d6:	00 00 00 
+  8007d9:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  8007dd:	4c 89 ee             	mov    %r13,%rsi
+  8007e0:	41 ff d4             	call   *%r12
+}
+  8007e3:	48 83 c4 18          	add    $0x18,%rsp
+  8007e7:	5b                   	pop    %rbx
+  8007e8:	41 5c                	pop    %r12
+  8007ea:	41 5d                	pop    %r13
+  8007ec:	41 5e                	pop    %r14
+  8007ee:	41 5f                	pop    %r15
+  8007f0:	5d                   	pop    %rbp
+  8007f1:	c3                   	ret
+
+00000000008007f2 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  8007f2:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  8007f6:	48 8b 06             	mov    (%rsi),%rax
+  8007f9:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8007fd:	73 0a                	jae    800809 <sprintputch+0x17>
+		*b->buf++ = ch;
+  8007ff:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800803:	48 89 16             	mov    %rdx,(%rsi)
+  800806:	40 88 38             	mov    %dil,(%rax)
+}
+  800809:	c3                   	ret
+
+000000000080080a <printfmt>:
+{
+  80080a:	55                   	push   %rbp
+  80080b:	48 89 e5             	mov    %rsp,%rbp
+  80080e:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800815:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80081c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800823:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80082a:	84 c0                	test   %al,%al
+  80082c:	74 20                	je     80084e <printfmt+0x44>
+  80082e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800832:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800836:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80083a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80083e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800842:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800846:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80084a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  80084e:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800855:	00 00 00 
+  800858:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80085f:	00 00 00 
+  800862:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800866:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80086d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800874:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80087b:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800882:	48 b8 90 08 80 00 00 	movabs $0x800890,%rax
+  800889:	00 00 00 
+  80088c:	ff d0                	call   *%rax
+}
+  80088e:	c9                   	leave
+  80088f:	c3                   	ret
+
+0000000000800890 <vprintfmt>:
+{
+  800890:	55                   	push   %rbp
+  800891:	48 89 e5             	mov    %rsp,%rbp
+  800894:	41 57                	push   %r15
+  800896:	41 56                	push   %r14
+  800898:	41 55                	push   %r13
+  80089a:	41 54                	push   %r12
+  80089c:	53                   	push   %rbx
+  80089d:	48 83 ec 48          	sub    $0x48,%rsp
+  8008a1:	49 89 fe             	mov    %rdi,%r14
+  8008a4:	49 89 f5             	mov    %rsi,%r13
+  8008a7:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  8008aa:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  8008ae:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  8008b2:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8008b6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8008ba:	eb 09                	jmp    8008c5 <vprintfmt+0x35>
+			putch(ch, putdat);
+  8008bc:	4c 89 ee             	mov    %r13,%rsi
+  8008bf:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008c2:	4c 89 e3             	mov    %r12,%rbx
+  8008c5:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8008c9:	0f b6 3b             	movzbl (%rbx),%edi
+  8008cc:	83 ff 25             	cmp    $0x25,%edi
+  8008cf:	74 13                	je     8008e4 <vprintfmt+0x54>
+			if (ch == '\0')
+  8008d1:	85 ff                	test   %edi,%edi
+  8008d3:	75 e7                	jne    8008bc <vprintfmt+0x2c>
+}
+  8008d5:	48 83 c4 48          	add    $0x48,%rsp
+  8008d9:	5b                   	pop    %rbx
+  8008da:	41 5c                	pop    %r12
+  8008dc:	41 5d                	pop    %r13
+  8008de:	41 5e                	pop    %r14
+  8008e0:	41 5f                	pop    %r15
+  8008e2:	5d                   	pop    %rbp
+  8008e3:	c3                   	ret
+		padc = ' ';
+  8008e4:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  8008e8:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  8008ef:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  8008f5:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  8008fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800901:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800906:	41 0f b6 14 24       	movzbl (%r12),%edx
+  80090b:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  80090e:	3c 55                	cmp    $0x55,%al
+  800910:	0f 87 4f 05 00 00    	ja     800e65 <vprintfmt+0x5d5>
+  800916:	0f b6 c0             	movzbl %al,%eax
+  800919:	48 be a0 13 80 00 00 	movabs $0x8013a0,%rsi
+  800920:	00 00 00 
+  800923:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  800926:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  800929:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  80092d:	eb d2                	jmp    800901 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  80092f:	49 89 dc             	mov    %rbx,%r12
+  800932:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  800936:	eb c9                	jmp    800901 <vprintfmt+0x71>
+  800938:	0f b6 d2             	movzbl %dl,%edx
+  80093b:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  80093e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  800944:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800948:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  80094d:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  800952:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  800955:	83 f8 09             	cmp    $0x9,%eax
+  800958:	77 20                	ja     80097a <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  80095a:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  80095e:	eb e4                	jmp    800944 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  800960:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800963:	83 f8 2f             	cmp    $0x2f,%eax
+  800966:	77 27                	ja     80098f <vprintfmt+0xff>
+  800968:	89 c2                	mov    %eax,%edx
+  80096a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096e:	83 c0 08             	add    $0x8,%eax
+  800971:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800974:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  800977:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  80097a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80097e:	79 81                	jns    800901 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  800980:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  800984:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80098a:	e9 72 ff ff ff       	jmp    800901 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  80098f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800993:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800997:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099b:	eb d7                	jmp    800974 <vprintfmt+0xe4>
+			if (width < 0)
+  80099d:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  8009a0:	85 f6                	test   %esi,%esi
+  8009a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a7:	0f 49 c6             	cmovns %esi,%eax
+  8009aa:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8009ad:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8009b0:	e9 4c ff ff ff       	jmp    800901 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8009b5:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  8009b8:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  8009bf:	e9 3d ff ff ff       	jmp    800901 <vprintfmt+0x71>
+			lflag++;
+  8009c4:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8009c7:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8009ca:	e9 32 ff ff ff       	jmp    800901 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  8009cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d5:	77 19                	ja     8009f0 <vprintfmt+0x160>
+  8009d7:	89 c2                	mov    %eax,%edx
+  8009d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009dd:	83 c0 08             	add    $0x8,%eax
+  8009e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e3:	8b 3a                	mov    (%rdx),%edi
+  8009e5:	4c 89 ee             	mov    %r13,%rsi
+  8009e8:	41 ff d6             	call   *%r14
+			break;
+  8009eb:	e9 d5 fe ff ff       	jmp    8008c5 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  8009f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fc:	eb e5                	jmp    8009e3 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  8009fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a01:	83 f8 2f             	cmp    $0x2f,%eax
+  800a04:	77 5a                	ja     800a60 <vprintfmt+0x1d0>
+  800a06:	89 c2                	mov    %eax,%edx
+  800a08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0c:	83 c0 08             	add    $0x8,%eax
+  800a0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800a12:	8b 02                	mov    (%rdx),%eax
+  800a14:	89 c1                	mov    %eax,%ecx
+  800a16:	f7 d9                	neg    %ecx
+  800a18:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a1b:	83 f9 08             	cmp    $0x8,%ecx
+  800a1e:	7f 4e                	jg     800a6e <vprintfmt+0x1de>
+  800a20:	48 63 c1             	movslq %ecx,%rax
+  800a23:	48 ba 60 16 80 00 00 	movabs $0x801660,%rdx
+  800a2a:	00 00 00 
+  800a2d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800a31:	48 85 c0             	test   %rax,%rax
+  800a34:	74 38                	je     800a6e <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800a36:	48 89 c1             	mov    %rax,%rcx
+  800a39:	48 ba fe 12 80 00 00 	movabs $0x8012fe,%rdx
+  800a40:	00 00 00 
+  800a43:	4c 89 ee             	mov    %r13,%rsi
+  800a46:	4c 89 f7             	mov    %r14,%rdi
+  800a49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a4e:	49 b8 0a 08 80 00 00 	movabs $0x80080a,%r8
+  800a55:	00 00 00 
+  800a58:	41 ff d0             	call   *%r8
+  800a5b:	e9 65 fe ff ff       	jmp    8008c5 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  800a60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6c:	eb a4                	jmp    800a12 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  800a6e:	48 ba f5 12 80 00 00 	movabs $0x8012f5,%rdx
+  800a75:	00 00 00 
+  800a78:	4c 89 ee             	mov    %r13,%rsi
+  800a7b:	4c 89 f7             	mov    %r14,%rdi
+  800a7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a83:	49 b8 0a 08 80 00 00 	movabs $0x80080a,%r8
+  800a8a:	00 00 00 
+  800a8d:	41 ff d0             	call   *%r8
+  800a90:	e9 30 fe ff ff       	jmp    8008c5 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800a95:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a98:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9b:	77 36                	ja     800ad3 <vprintfmt+0x243>
+  800a9d:	89 c2                	mov    %eax,%edx
+  800a9f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa3:	83 c0 08             	add    $0x8,%eax
+  800aa6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa9:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800aac:	48 85 c9             	test   %rcx,%rcx
+  800aaf:	48 b8 ee 12 80 00 00 	movabs $0x8012ee,%rax
+  800ab6:	00 00 00 
+  800ab9:	48 0f 45 c1          	cmovne %rcx,%rax
+  800abd:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800ac1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800ac5:	7e 06                	jle    800acd <vprintfmt+0x23d>
+  800ac7:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800acb:	75 14                	jne    800ae1 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800acd:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ad1:	eb 64                	jmp    800b37 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800ad3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800adb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800adf:	eb c8                	jmp    800aa9 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ae1:	49 63 f7             	movslq %r15d,%rsi
+  800ae4:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800ae8:	48 b8 73 0f 80 00 00 	movabs $0x800f73,%rax
+  800aef:	00 00 00 
+  800af2:	ff d0                	call   *%rax
+  800af4:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800af7:	29 c1                	sub    %eax,%ecx
+  800af9:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800afc:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  800aff:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800b03:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b06:	eb 0d                	jmp    800b15 <vprintfmt+0x285>
+					putch(padc, putdat);
+  800b08:	4c 89 ee             	mov    %r13,%rsi
+  800b0b:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  800b0e:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b11:	41 83 ec 01          	sub    $0x1,%r12d
+  800b15:	45 85 e4             	test   %r12d,%r12d
+  800b18:	7f ee                	jg     800b08 <vprintfmt+0x278>
+  800b1a:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  800b1d:	85 c9                	test   %ecx,%ecx
+  800b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b24:	0f 49 c1             	cmovns %ecx,%eax
+  800b27:	29 c1                	sub    %eax,%ecx
+  800b29:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  800b2c:	eb 9f                	jmp    800acd <vprintfmt+0x23d>
+					putch(ch, putdat);
+  800b2e:	4c 89 ee             	mov    %r13,%rsi
+  800b31:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b34:	4c 89 e2             	mov    %r12,%rdx
+  800b37:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800b3b:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800b41:	0f be f8             	movsbl %al,%edi
+  800b44:	85 ff                	test   %edi,%edi
+  800b46:	74 29                	je     800b71 <vprintfmt+0x2e1>
+  800b48:	45 85 ff             	test   %r15d,%r15d
+  800b4b:	78 06                	js     800b53 <vprintfmt+0x2c3>
+  800b4d:	41 83 ef 01          	sub    $0x1,%r15d
+  800b51:	78 1e                	js     800b71 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b53:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800b57:	74 d5                	je     800b2e <vprintfmt+0x29e>
+  800b59:	0f be c0             	movsbl %al,%eax
+  800b5c:	83 e8 20             	sub    $0x20,%eax
+  800b5f:	83 f8 5e             	cmp    $0x5e,%eax
+  800b62:	76 ca                	jbe    800b2e <vprintfmt+0x29e>
+					putch('?', putdat);
+  800b64:	4c 89 ee             	mov    %r13,%rsi
+  800b67:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b6c:	41 ff d6             	call   *%r14
+  800b6f:	eb c3                	jmp    800b34 <vprintfmt+0x2a4>
+  800b71:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800b75:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800b78:	41 01 c4             	add    %eax,%r12d
+  800b7b:	41 29 d4             	sub    %edx,%r12d
+  800b7e:	eb 0f                	jmp    800b8f <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  800b80:	4c 89 ee             	mov    %r13,%rsi
+  800b83:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b88:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800b8b:	41 83 ec 01          	sub    $0x1,%r12d
+  800b8f:	45 85 e4             	test   %r12d,%r12d
+  800b92:	7f ec                	jg     800b80 <vprintfmt+0x2f0>
+  800b94:	e9 2c fd ff ff       	jmp    8008c5 <vprintfmt+0x35>
+	if (lflag >= 2)
+  800b99:	83 f9 01             	cmp    $0x1,%ecx
+  800b9c:	7f 1d                	jg     800bbb <vprintfmt+0x32b>
+	else if (lflag)
+  800b9e:	85 c9                	test   %ecx,%ecx
+  800ba0:	74 5e                	je     800c00 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800ba2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba8:	77 48                	ja     800bf2 <vprintfmt+0x362>
+  800baa:	89 c2                	mov    %eax,%edx
+  800bac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb0:	83 c0 08             	add    $0x8,%eax
+  800bb3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb6:	4c 8b 22             	mov    (%rdx),%r12
+  800bb9:	eb 17                	jmp    800bd2 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800bbb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbe:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc1:	77 21                	ja     800be4 <vprintfmt+0x354>
+  800bc3:	89 c2                	mov    %eax,%edx
+  800bc5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc9:	83 c0 08             	add    $0x8,%eax
+  800bcc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bcf:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800bd2:	4d 85 e4             	test   %r12,%r12
+  800bd5:	78 50                	js     800c27 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  800bd7:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800bda:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800bdf:	e9 b4 01 00 00       	jmp    800d98 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800be4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf0:	eb dd                	jmp    800bcf <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800bf2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bfa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bfe:	eb b6                	jmp    800bb6 <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800c00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c03:	83 f8 2f             	cmp    $0x2f,%eax
+  800c06:	77 11                	ja     800c19 <vprintfmt+0x389>
+  800c08:	89 c2                	mov    %eax,%edx
+  800c0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0e:	83 c0 08             	add    $0x8,%eax
+  800c11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c14:	4c 63 22             	movslq (%rdx),%r12
+  800c17:	eb b9                	jmp    800bd2 <vprintfmt+0x342>
+  800c19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c25:	eb ed                	jmp    800c14 <vprintfmt+0x384>
+				putch('-', putdat);
+  800c27:	4c 89 ee             	mov    %r13,%rsi
+  800c2a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c2f:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800c32:	4c 89 e2             	mov    %r12,%rdx
+  800c35:	48 f7 da             	neg    %rdx
+			base = 10;
+  800c38:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800c3d:	e9 56 01 00 00       	jmp    800d98 <vprintfmt+0x508>
+	if (lflag >= 2)
+  800c42:	83 f9 01             	cmp    $0x1,%ecx
+  800c45:	7f 25                	jg     800c6c <vprintfmt+0x3dc>
+	else if (lflag)
+  800c47:	85 c9                	test   %ecx,%ecx
+  800c49:	74 5e                	je     800ca9 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  800c4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c51:	77 48                	ja     800c9b <vprintfmt+0x40b>
+  800c53:	89 c2                	mov    %eax,%edx
+  800c55:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c59:	83 c0 08             	add    $0x8,%eax
+  800c5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c5f:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800c62:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800c67:	e9 2c 01 00 00       	jmp    800d98 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800c6c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c6f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c72:	77 19                	ja     800c8d <vprintfmt+0x3fd>
+  800c74:	89 c2                	mov    %eax,%edx
+  800c76:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c7a:	83 c0 08             	add    $0x8,%eax
+  800c7d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c80:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800c83:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800c88:	e9 0b 01 00 00       	jmp    800d98 <vprintfmt+0x508>
+  800c8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c99:	eb e5                	jmp    800c80 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800c9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca7:	eb b6                	jmp    800c5f <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800ca9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cac:	83 f8 2f             	cmp    $0x2f,%eax
+  800caf:	77 18                	ja     800cc9 <vprintfmt+0x439>
+  800cb1:	89 c2                	mov    %eax,%edx
+  800cb3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb7:	83 c0 08             	add    $0x8,%eax
+  800cba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cbd:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800cbf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800cc4:	e9 cf 00 00 00       	jmp    800d98 <vprintfmt+0x508>
+  800cc9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ccd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cd1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd5:	eb e6                	jmp    800cbd <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800cd7:	83 f9 01             	cmp    $0x1,%ecx
+  800cda:	7f 25                	jg     800d01 <vprintfmt+0x471>
+	else if (lflag)
+  800cdc:	85 c9                	test   %ecx,%ecx
+  800cde:	74 5b                	je     800d3b <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800ce0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce3:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce6:	77 45                	ja     800d2d <vprintfmt+0x49d>
+  800ce8:	89 c2                	mov    %eax,%edx
+  800cea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cee:	83 c0 08             	add    $0x8,%eax
+  800cf1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf4:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800cf7:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800cfc:	e9 97 00 00 00       	jmp    800d98 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800d01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d04:	83 f8 2f             	cmp    $0x2f,%eax
+  800d07:	77 16                	ja     800d1f <vprintfmt+0x48f>
+  800d09:	89 c2                	mov    %eax,%edx
+  800d0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d0f:	83 c0 08             	add    $0x8,%eax
+  800d12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d15:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800d18:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800d1d:	eb 79                	jmp    800d98 <vprintfmt+0x508>
+  800d1f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d23:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d27:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d2b:	eb e8                	jmp    800d15 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800d2d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d31:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d35:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d39:	eb b9                	jmp    800cf4 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  800d3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d3e:	83 f8 2f             	cmp    $0x2f,%eax
+  800d41:	77 15                	ja     800d58 <vprintfmt+0x4c8>
+  800d43:	89 c2                	mov    %eax,%edx
+  800d45:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d49:	83 c0 08             	add    $0x8,%eax
+  800d4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d4f:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800d51:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800d56:	eb 40                	jmp    800d98 <vprintfmt+0x508>
+  800d58:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d5c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d64:	eb e9                	jmp    800d4f <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800d66:	4c 89 ee             	mov    %r13,%rsi
+  800d69:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d6e:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800d71:	4c 89 ee             	mov    %r13,%rsi
+  800d74:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d79:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800d7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d82:	77 34                	ja     800db8 <vprintfmt+0x528>
+  800d84:	89 c2                	mov    %eax,%edx
+  800d86:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d8a:	83 c0 08             	add    $0x8,%eax
+  800d8d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800d90:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800d93:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800d98:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800d9d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800da1:	4c 89 ee             	mov    %r13,%rsi
+  800da4:	4c 89 f7             	mov    %r14,%rdi
+  800da7:	48 b8 6a 07 80 00 00 	movabs $0x80076a,%rax
+  800dae:	00 00 00 
+  800db1:	ff d0                	call   *%rax
+			break;
+  800db3:	e9 0d fb ff ff       	jmp    8008c5 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800db8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dbc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dc0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc4:	eb ca                	jmp    800d90 <vprintfmt+0x500>
+	if (lflag >= 2)
+  800dc6:	83 f9 01             	cmp    $0x1,%ecx
+  800dc9:	7f 22                	jg     800ded <vprintfmt+0x55d>
+	else if (lflag)
+  800dcb:	85 c9                	test   %ecx,%ecx
+  800dcd:	74 58                	je     800e27 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800dcf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dd2:	83 f8 2f             	cmp    $0x2f,%eax
+  800dd5:	77 42                	ja     800e19 <vprintfmt+0x589>
+  800dd7:	89 c2                	mov    %eax,%edx
+  800dd9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ddd:	83 c0 08             	add    $0x8,%eax
+  800de0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800de3:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800de6:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800deb:	eb ab                	jmp    800d98 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800ded:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800df0:	83 f8 2f             	cmp    $0x2f,%eax
+  800df3:	77 16                	ja     800e0b <vprintfmt+0x57b>
+  800df5:	89 c2                	mov    %eax,%edx
+  800df7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dfb:	83 c0 08             	add    $0x8,%eax
+  800dfe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e01:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800e04:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800e09:	eb 8d                	jmp    800d98 <vprintfmt+0x508>
+  800e0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e17:	eb e8                	jmp    800e01 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800e19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e25:	eb bc                	jmp    800de3 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800e27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800e2d:	77 18                	ja     800e47 <vprintfmt+0x5b7>
+  800e2f:	89 c2                	mov    %eax,%edx
+  800e31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e35:	83 c0 08             	add    $0x8,%eax
+  800e38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e3b:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800e3d:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800e42:	e9 51 ff ff ff       	jmp    800d98 <vprintfmt+0x508>
+  800e47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e53:	eb e6                	jmp    800e3b <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800e55:	4c 89 ee             	mov    %r13,%rsi
+  800e58:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e5d:	41 ff d6             	call   *%r14
+			break;
+  800e60:	e9 60 fa ff ff       	jmp    8008c5 <vprintfmt+0x35>
+			putch('%', putdat);
+  800e65:	4c 89 ee             	mov    %r13,%rsi
+  800e68:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e6d:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800e70:	4c 89 e3             	mov    %r12,%rbx
+  800e73:	eb 04                	jmp    800e79 <vprintfmt+0x5e9>
+  800e75:	48 83 eb 01          	sub    $0x1,%rbx
+  800e79:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e7d:	75 f6                	jne    800e75 <vprintfmt+0x5e5>
+  800e7f:	e9 41 fa ff ff       	jmp    8008c5 <vprintfmt+0x35>
+
+0000000000800e84 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800e84:	55                   	push   %rbp
+  800e85:	48 89 e5             	mov    %rsp,%rbp
+  800e88:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800e8c:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800e90:	48 63 c6             	movslq %esi,%rax
+  800e93:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800e98:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800e9c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800ea3:	48 85 ff             	test   %rdi,%rdi
+  800ea6:	74 2a                	je     800ed2 <vsnprintf+0x4e>
+  800ea8:	85 f6                	test   %esi,%esi
+  800eaa:	7e 26                	jle    800ed2 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800eac:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800eb0:	48 bf f2 07 80 00 00 	movabs $0x8007f2,%rdi
+  800eb7:	00 00 00 
+  800eba:	48 b8 90 08 80 00 00 	movabs $0x800890,%rax
+  800ec1:	00 00 00 
+  800ec4:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ec6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800eca:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800ecd:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800ed0:	c9                   	leave
+  800ed1:	c3                   	ret
+		return -E_INVAL;
+  800ed2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ed7:	eb f7                	jmp    800ed0 <vsnprintf+0x4c>
+
+0000000000800ed9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800ed9:	55                   	push   %rbp
+  800eda:	48 89 e5             	mov    %rsp,%rbp
+  800edd:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800ee4:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800eeb:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800ef2:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800ef9:	84 c0                	test   %al,%al
+  800efb:	74 20                	je     800f1d <snprintf+0x44>
+  800efd:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f01:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f05:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f09:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f0d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f11:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f15:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f19:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800f1d:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f24:	00 00 00 
+  800f27:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f2e:	00 00 00 
+  800f31:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f35:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800f3c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f43:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800f4a:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800f51:	48 b8 84 0e 80 00 00 	movabs $0x800e84,%rax
+  800f58:	00 00 00 
+  800f5b:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800f5d:	c9                   	leave
+  800f5e:	c3                   	ret
+
+0000000000800f5f <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800f5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f64:	48 89 d0             	mov    %rdx,%rax
+  800f67:	48 83 c2 01          	add    $0x1,%rdx
+  800f6b:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800f70:	75 f2                	jne    800f64 <strlen+0x5>
+		n++;
+	return n;
+}
+  800f72:	c3                   	ret
+
+0000000000800f73 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f78:	eb 03                	jmp    800f7d <strnlen+0xa>
+  800f7a:	48 89 d0             	mov    %rdx,%rax
+  800f7d:	48 39 c6             	cmp    %rax,%rsi
+  800f80:	74 0a                	je     800f8c <strnlen+0x19>
+  800f82:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800f86:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800f8a:	75 ee                	jne    800f7a <strnlen+0x7>
+		n++;
+	return n;
+}
+  800f8c:	c3                   	ret
+
+0000000000800f8d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800f8d:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800f90:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f95:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800f99:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800f9c:	48 83 c2 01          	add    $0x1,%rdx
+  800fa0:	84 c9                	test   %cl,%cl
+  800fa2:	75 f1                	jne    800f95 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800fa4:	c3                   	ret
+
+0000000000800fa5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800fa5:	55                   	push   %rbp
+  800fa6:	48 89 e5             	mov    %rsp,%rbp
+  800fa9:	41 54                	push   %r12
+  800fab:	53                   	push   %rbx
+  800fac:	48 89 fb             	mov    %rdi,%rbx
+  800faf:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800fb2:	48 b8 5f 0f 80 00 00 	movabs $0x800f5f,%rax
+  800fb9:	00 00 00 
+  800fbc:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800fbe:	48 63 f8             	movslq %eax,%rdi
+  800fc1:	48 01 df             	add    %rbx,%rdi
+  800fc4:	4c 89 e6             	mov    %r12,%rsi
+  800fc7:	48 b8 8d 0f 80 00 00 	movabs $0x800f8d,%rax
+  800fce:	00 00 00 
+  800fd1:	ff d0                	call   *%rax
+	return dst;
+}
+  800fd3:	48 89 d8             	mov    %rbx,%rax
+  800fd6:	5b                   	pop    %rbx
+  800fd7:	41 5c                	pop    %r12
+  800fd9:	5d                   	pop    %rbp
+  800fda:	c3                   	ret
+
+0000000000800fdb <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800fdb:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800fde:	48 01 fa             	add    %rdi,%rdx
+  800fe1:	48 89 f9             	mov    %rdi,%rcx
+  800fe4:	eb 14                	jmp    800ffa <strncpy+0x1f>
+		*dst++ = *src;
+  800fe6:	48 83 c1 01          	add    $0x1,%rcx
+  800fea:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800fee:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ff2:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ff6:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800ffa:	48 39 d1             	cmp    %rdx,%rcx
+  800ffd:	75 e7                	jne    800fe6 <strncpy+0xb>
+	}
+	return ret;
+}
+  800fff:	c3                   	ret
+
+0000000000801000 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801000:	48 89 f8             	mov    %rdi,%rax
+  801003:	48 85 d2             	test   %rdx,%rdx
+  801006:	74 27                	je     80102f <strlcpy+0x2f>
+  801008:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  80100d:	48 89 fa             	mov    %rdi,%rdx
+  801010:	eb 0b                	jmp    80101d <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801012:	48 83 c6 01          	add    $0x1,%rsi
+  801016:	48 83 c2 01          	add    $0x1,%rdx
+  80101a:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  80101d:	48 39 c2             	cmp    %rax,%rdx
+  801020:	74 0a                	je     80102c <strlcpy+0x2c>
+  801022:	0f b6 0e             	movzbl (%rsi),%ecx
+  801025:	84 c9                	test   %cl,%cl
+  801027:	75 e9                	jne    801012 <strlcpy+0x12>
+  801029:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  80102c:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  80102f:	48 29 f8             	sub    %rdi,%rax
+}
+  801032:	c3                   	ret
+
+0000000000801033 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  801033:	eb 08                	jmp    80103d <strcmp+0xa>
+		p++, q++;
+  801035:	48 83 c7 01          	add    $0x1,%rdi
+  801039:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  80103d:	0f b6 07             	movzbl (%rdi),%eax
+  801040:	84 c0                	test   %al,%al
+  801042:	74 04                	je     801048 <strcmp+0x15>
+  801044:	3a 06                	cmp    (%rsi),%al
+  801046:	74 ed                	je     801035 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801048:	0f b6 c0             	movzbl %al,%eax
+  80104b:	0f b6 16             	movzbl (%rsi),%edx
+  80104e:	29 d0                	sub    %edx,%eax
+}
+  801050:	c3                   	ret
+
+0000000000801051 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  801051:	eb 0c                	jmp    80105f <strncmp+0xe>
+		n--, p++, q++;
+  801053:	48 83 ea 01          	sub    $0x1,%rdx
+  801057:	48 83 c7 01          	add    $0x1,%rdi
+  80105b:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  80105f:	48 85 d2             	test   %rdx,%rdx
+  801062:	74 14                	je     801078 <strncmp+0x27>
+  801064:	0f b6 07             	movzbl (%rdi),%eax
+  801067:	84 c0                	test   %al,%al
+  801069:	74 04                	je     80106f <strncmp+0x1e>
+  80106b:	3a 06                	cmp    (%rsi),%al
+  80106d:	74 e4                	je     801053 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80106f:	0f b6 07             	movzbl (%rdi),%eax
+  801072:	0f b6 16             	movzbl (%rsi),%edx
+  801075:	29 d0                	sub    %edx,%eax
+}
+  801077:	c3                   	ret
+		return 0;
+  801078:	b8 00 00 00 00       	mov    $0x0,%eax
+  80107d:	c3                   	ret
+
+000000000080107e <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  80107e:	eb 04                	jmp    801084 <strchr+0x6>
+  801080:	48 83 c7 01          	add    $0x1,%rdi
+  801084:	0f b6 07             	movzbl (%rdi),%eax
+  801087:	84 c0                	test   %al,%al
+  801089:	74 09                	je     801094 <strchr+0x16>
+		if (*s == c)
+  80108b:	40 38 f0             	cmp    %sil,%al
+  80108e:	75 f0                	jne    801080 <strchr+0x2>
+  801090:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  801093:	c3                   	ret
+	return 0;
+  801094:	b8 00 00 00 00       	mov    $0x0,%eax
+  801099:	c3                   	ret
+
+000000000080109a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80109a:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  80109d:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  8010a0:	40 38 f2             	cmp    %sil,%dl
+  8010a3:	74 0a                	je     8010af <strfind+0x15>
+  8010a5:	84 d2                	test   %dl,%dl
+  8010a7:	74 06                	je     8010af <strfind+0x15>
+	for (; *s; s++)
+  8010a9:	48 83 c0 01          	add    $0x1,%rax
+  8010ad:	eb ee                	jmp    80109d <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  8010af:	c3                   	ret
+
+00000000008010b0 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  8010b0:	48 85 d2             	test   %rdx,%rdx
+  8010b3:	74 28                	je     8010dd <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  8010b5:	48 89 f8             	mov    %rdi,%rax
+  8010b8:	48 09 d0             	or     %rdx,%rax
+  8010bb:	a8 03                	test   $0x3,%al
+  8010bd:	75 16                	jne    8010d5 <memset+0x25>
+		c &= 0xFF;
+  8010bf:	40 0f b6 f6          	movzbl %sil,%esi
+  8010c3:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8010c9:	48 89 d1             	mov    %rdx,%rcx
+  8010cc:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  8010d0:	fc                   	cld
+  8010d1:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8010d3:	eb 08                	jmp    8010dd <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8010d5:	89 f0                	mov    %esi,%eax
+  8010d7:	48 89 d1             	mov    %rdx,%rcx
+  8010da:	fc                   	cld
+  8010db:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8010dd:	48 89 f8             	mov    %rdi,%rax
+  8010e0:	c3                   	ret
+
+00000000008010e1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8010e1:	48 89 f8             	mov    %rdi,%rax
+  8010e4:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8010e7:	48 39 fe             	cmp    %rdi,%rsi
+  8010ea:	73 3a                	jae    801126 <memmove+0x45>
+  8010ec:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010f0:	48 39 d7             	cmp    %rdx,%rdi
+  8010f3:	73 31                	jae    801126 <memmove+0x45>
+		s += n;
+		d += n;
+  8010f5:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  8010f9:	48 89 d6             	mov    %rdx,%rsi
+  8010fc:	48 09 fe             	or     %rdi,%rsi
+  8010ff:	48 09 ce             	or     %rcx,%rsi
+  801102:	40 f6 c6 03          	test   $0x3,%sil
+  801106:	75 11                	jne    801119 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801108:	48 83 ef 04          	sub    $0x4,%rdi
+  80110c:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  801110:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801114:	fd                   	std
+  801115:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801117:	eb 0b                	jmp    801124 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801119:	48 83 ef 01          	sub    $0x1,%rdi
+  80111d:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  801121:	fd                   	std
+  801122:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801124:	fc                   	cld
+  801125:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  801126:	48 89 f2             	mov    %rsi,%rdx
+  801129:	48 09 c2             	or     %rax,%rdx
+  80112c:	48 09 ca             	or     %rcx,%rdx
+  80112f:	f6 c2 03             	test   $0x3,%dl
+  801132:	75 0b                	jne    80113f <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801134:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  801138:	48 89 c7             	mov    %rax,%rdi
+  80113b:	fc                   	cld
+  80113c:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80113e:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  80113f:	48 89 c7             	mov    %rax,%rdi
+  801142:	fc                   	cld
+  801143:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801145:	c3                   	ret
+
+0000000000801146 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801146:	55                   	push   %rbp
+  801147:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  80114a:	48 b8 e1 10 80 00 00 	movabs $0x8010e1,%rax
+  801151:	00 00 00 
+  801154:	ff d0                	call   *%rax
+}
+  801156:	5d                   	pop    %rbp
+  801157:	c3                   	ret
+
+0000000000801158 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801158:	b8 00 00 00 00       	mov    $0x0,%eax
+  80115d:	48 39 c2             	cmp    %rax,%rdx
+  801160:	74 1e                	je     801180 <memcmp+0x28>
+		if (*s1 != *s2)
+  801162:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801166:	48 83 c0 01          	add    $0x1,%rax
+  80116a:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  801170:	44 38 c1             	cmp    %r8b,%cl
+  801173:	74 e8                	je     80115d <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  801175:	0f b6 c1             	movzbl %cl,%eax
+  801178:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80117c:	44 29 c0             	sub    %r8d,%eax
+  80117f:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  801180:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801185:	c3                   	ret
+
+0000000000801186 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801186:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  801189:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  80118c:	eb 04                	jmp    801192 <memfind+0xc>
+  80118e:	48 83 c0 01          	add    $0x1,%rax
+  801192:	48 39 d0             	cmp    %rdx,%rax
+  801195:	73 05                	jae    80119c <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801197:	40 38 30             	cmp    %sil,(%rax)
+  80119a:	75 f2                	jne    80118e <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  80119c:	c3                   	ret
+
+000000000080119d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80119d:	48 89 f9             	mov    %rdi,%rcx
+  8011a0:	49 89 f0             	mov    %rsi,%r8
+  8011a3:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8011a5:	eb 04                	jmp    8011ab <strtol+0xe>
+		s++;
+  8011a7:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  8011ab:	0f b6 01             	movzbl (%rcx),%eax
+  8011ae:	3c 20                	cmp    $0x20,%al
+  8011b0:	74 f5                	je     8011a7 <strtol+0xa>
+  8011b2:	3c 09                	cmp    $0x9,%al
+  8011b4:	74 f1                	je     8011a7 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  8011b6:	3c 2b                	cmp    $0x2b,%al
+  8011b8:	74 2b                	je     8011e5 <strtol+0x48>
+	int neg = 0;
+  8011ba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  8011c0:	3c 2d                	cmp    $0x2d,%al
+  8011c2:	74 2d                	je     8011f1 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011c4:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  8011ca:	75 0f                	jne    8011db <strtol+0x3e>
+  8011cc:	80 39 30             	cmpb   $0x30,(%rcx)
+  8011cf:	74 2c                	je     8011fd <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8011d1:	85 ff                	test   %edi,%edi
+  8011d3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011d8:	0f 44 f8             	cmove  %eax,%edi
+  8011db:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  8011e0:	4c 63 d7             	movslq %edi,%r10
+  8011e3:	eb 4f                	jmp    801234 <strtol+0x97>
+		s++;
+  8011e5:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  8011e9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8011ef:	eb d3                	jmp    8011c4 <strtol+0x27>
+		s++, neg = 1;
+  8011f1:	48 83 c1 01          	add    $0x1,%rcx
+  8011f5:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  8011fb:	eb c7                	jmp    8011c4 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011fd:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  801201:	74 0f                	je     801212 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  801203:	85 ff                	test   %edi,%edi
+  801205:	75 d4                	jne    8011db <strtol+0x3e>
+		s++, base = 8;
+  801207:	48 83 c1 01          	add    $0x1,%rcx
+  80120b:	bf 08 00 00 00       	mov    $0x8,%edi
+  801210:	eb c9                	jmp    8011db <strtol+0x3e>
+		s += 2, base = 16;
+  801212:	48 83 c1 02          	add    $0x2,%rcx
+  801216:	bf 10 00 00 00       	mov    $0x10,%edi
+  80121b:	eb be                	jmp    8011db <strtol+0x3e>
+			dig = *s - '0';
+  80121d:	0f be c0             	movsbl %al,%eax
+  801220:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  801223:	39 f8                	cmp    %edi,%eax
+  801225:	7d 3b                	jge    801262 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  801227:	48 83 c1 01          	add    $0x1,%rcx
+  80122b:	49 0f af d2          	imul   %r10,%rdx
+  80122f:	48 98                	cltq
+  801231:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  801234:	0f b6 01             	movzbl (%rcx),%eax
+  801237:	8d 70 d0             	lea    -0x30(%rax),%esi
+  80123a:	40 80 fe 09          	cmp    $0x9,%sil
+  80123e:	76 dd                	jbe    80121d <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  801240:	8d 70 9f             	lea    -0x61(%rax),%esi
+  801243:	40 80 fe 19          	cmp    $0x19,%sil
+  801247:	77 08                	ja     801251 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  801249:	0f be c0             	movsbl %al,%eax
+  80124c:	83 e8 57             	sub    $0x57,%eax
+  80124f:	eb d2                	jmp    801223 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  801251:	8d 70 bf             	lea    -0x41(%rax),%esi
+  801254:	40 80 fe 19          	cmp    $0x19,%sil
+  801258:	77 08                	ja     801262 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  80125a:	0f be c0             	movsbl %al,%eax
+  80125d:	83 e8 37             	sub    $0x37,%eax
+  801260:	eb c1                	jmp    801223 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801262:	4d 85 c0             	test   %r8,%r8
+  801265:	74 03                	je     80126a <strtol+0xcd>
+		*endptr = (char *) s;
+  801267:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  80126a:	48 89 d0             	mov    %rdx,%rax
+  80126d:	48 f7 d8             	neg    %rax
+  801270:	45 85 c9             	test   %r9d,%r9d
+  801273:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  801277:	48 89 d0             	mov    %rdx,%rax
+  80127a:	c3                   	ret
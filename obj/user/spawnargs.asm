@@ -0,0 +1,2349 @@
+
+obj/user/spawnargs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 57 01 00 00       	call   800188 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	41 57                	push   %r15
+  800039:	41 56                	push   %r14
+  80003b:	41 55                	push   %r13
+  80003d:	41 54                	push   %r12
+  80003f:	53                   	push   %rbx
+  800040:	48 83 ec 38          	sub    $0x38,%rsp
+	const char *args[] = { "spawnargs", "one", "two", "three", NULL };
+  800044:	48 b8 e0 13 80 00 00 	movabs $0x8013e0,%rax
+  80004b:	00 00 00 
+  80004e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800052:	48 b8 ea 13 80 00 00 	movabs $0x8013ea,%rax
+  800059:	00 00 00 
+  80005c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  800060:	48 b8 ee 13 80 00 00 	movabs $0x8013ee,%rax
+  800067:	00 00 00 
+  80006a:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80006e:	48 b8 f2 13 80 00 00 	movabs $0x8013f2,%rax
+  800075:	00 00 00 
+  800078:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80007c:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800083:	00 
+	envid_t who;
+	int i;
+
+	if (argc > 1) {
+  800084:	83 ff 01             	cmp    $0x1,%edi
+  800087:	7e 4b                	jle    8000d4 <umain+0xa1>
+  800089:	49 89 f5             	mov    %rsi,%r13
+  80008c:	41 89 fc             	mov    %edi,%r12d
+  80008f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		for (i = 0; i < argc; i++)
+			cprintf("spawnargs: argv[%d] = %s\n", i, argv[i]);
+  800094:	49 bf f8 13 80 00 00 	movabs $0x8013f8,%r15
+  80009b:	00 00 00 
+  80009e:	49 be 6d 03 80 00 00 	movabs $0x80036d,%r14
+  8000a5:	00 00 00 
+  8000a8:	eb 14                	jmp    8000be <umain+0x8b>
+  8000aa:	49 8b 54 dd 00       	mov    0x0(%r13,%rbx,8),%rdx
+  8000af:	4c 89 ff             	mov    %r15,%rdi
+  8000b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b7:	41 ff d6             	call   *%r14
+		for (i = 0; i < argc; i++)
+  8000ba:	48 83 c3 01          	add    $0x1,%rbx
+  8000be:	89 de                	mov    %ebx,%esi
+  8000c0:	4c 39 e3             	cmp    %r12,%rbx
+  8000c3:	75 e5                	jne    8000aa <umain+0x77>
+	if ((who = sys_spawn("spawnargs", args)) < 0)
+		panic("sys_spawn: %e", who);
+	cprintf("spawnargs: spawned %08x\n", who);
+	if ((who = sys_spawn("nosuchprogram", args)) != -E_INVAL)
+		panic("sys_spawn of a missing program: %e", who);
+}
+  8000c5:	48 83 c4 38          	add    $0x38,%rsp
+  8000c9:	5b                   	pop    %rbx
+  8000ca:	41 5c                	pop    %r12
+  8000cc:	41 5d                	pop    %r13
+  8000ce:	41 5e                	pop    %r14
+  8000d0:	41 5f                	pop    %r15
+  8000d2:	5d                   	pop    %rbp
+  8000d3:	c3                   	ret
+	if ((who = sys_spawn("spawnargs", args)) < 0)
+  8000d4:	48 8d 75 a0          	lea    -0x60(%rbp),%rsi
+  8000d8:	48 bf e0 13 80 00 00 	movabs $0x8013e0,%rdi
+  8000df:	00 00 00 
+  8000e2:	48 b8 64 11 80 00 00 	movabs $0x801164,%rax
+  8000e9:	00 00 00 
+  8000ec:	ff d0                	call   *%rax
+  8000ee:	89 c6                	mov    %eax,%esi
+  8000f0:	85 c0                	test   %eax,%eax
+  8000f2:	78 67                	js     80015b <umain+0x128>
+	cprintf("spawnargs: spawned %08x\n", who);
+  8000f4:	48 bf 31 14 80 00 00 	movabs $0x801431,%rdi
+  8000fb:	00 00 00 
+  8000fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800103:	48 ba 6d 03 80 00 00 	movabs $0x80036d,%rdx
+  80010a:	00 00 00 
+  80010d:	ff d2                	call   *%rdx
+	if ((who = sys_spawn("nosuchprogram", args)) != -E_INVAL)
+  80010f:	48 8d 75 a0          	lea    -0x60(%rbp),%rsi
+  800113:	48 bf 4a 14 80 00 00 	movabs $0x80144a,%rdi
+  80011a:	00 00 00 
+  80011d:	48 b8 64 11 80 00 00 	movabs $0x801164,%rax
+  800124:	00 00 00 
+  800127:	ff d0                	call   *%rax
+  800129:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  80012c:	74 97                	je     8000c5 <umain+0x92>
+		panic("sys_spawn of a missing program: %e", who);
+  80012e:	89 c1                	mov    %eax,%ecx
+  800130:	48 ba 58 14 80 00 00 	movabs $0x801458,%rdx
+  800137:	00 00 00 
+  80013a:	be 17 00 00 00       	mov    $0x17,%esi
+  80013f:	48 bf 20 14 80 00 00 	movabs $0x801420,%rdi
+  800146:	00 00 00 
+  800149:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014e:	49 b8 ce 01 80 00 00 	movabs $0x8001ce,%r8
+  800155:	00 00 00 
+  800158:	41 ff d0             	call   *%r8
+		panic("sys_spawn: %e", who);
+  80015b:	89 c1                	mov    %eax,%ecx
+  80015d:	48 ba 12 14 80 00 00 	movabs $0x801412,%rdx
+  800164:	00 00 00 
+  800167:	be 14 00 00 00       	mov    $0x14,%esi
+  80016c:	48 bf 20 14 80 00 00 	movabs $0x801420,%rdi
+  800173:	00 00 00 
+  800176:	b8 00 00 00 00       	mov    $0x0,%eax
+  80017b:	49 b8 ce 01 80 00 00 	movabs $0x8001ce,%r8
+  800182:	00 00 00 
+  800185:	41 ff d0             	call   *%r8
+
+0000000000800188 <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  800188:	55                   	push   %rbp
+  800189:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80018c:	85 ff                	test   %edi,%edi
+  80018e:	7e 0d                	jle    80019d <libmain+0x15>
+		binaryname = argv[0];
+  800190:	48 8b 06             	mov    (%rsi),%rax
+  800193:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  80019a:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  80019d:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  8001a4:	00 00 00 
+  8001a7:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8001a9:	48 b8 b7 01 80 00 00 	movabs $0x8001b7,%rax
+  8001b0:	00 00 00 
+  8001b3:	ff d0                	call   *%rax
+}
+  8001b5:	5d                   	pop    %rbp
+  8001b6:	c3                   	ret
+
+00000000008001b7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001b7:	55                   	push   %rbp
+  8001b8:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  8001bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001c0:	48 b8 4a 0f 80 00 00 	movabs $0x800f4a,%rax
+  8001c7:	00 00 00 
+  8001ca:	ff d0                	call   *%rax
+}
+  8001cc:	5d                   	pop    %rbp
+  8001cd:	c3                   	ret
+
+00000000008001ce <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001ce:	55                   	push   %rbp
+  8001cf:	48 89 e5             	mov    %rsp,%rbp
+  8001d2:	41 56                	push   %r14
+  8001d4:	41 55                	push   %r13
+  8001d6:	41 54                	push   %r12
+  8001d8:	53                   	push   %rbx
+  8001d9:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8001e0:	49 89 fc             	mov    %rdi,%r12
+  8001e3:	41 89 f5             	mov    %esi,%r13d
+  8001e6:	48 89 d3             	mov    %rdx,%rbx
+  8001e9:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8001f0:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8001f7:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8001fe:	84 c0                	test   %al,%al
+  800200:	74 26                	je     800228 <_panic+0x5a>
+  800202:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800209:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800210:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800214:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800218:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  80021c:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800220:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800224:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800228:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  80022f:	00 00 00 
+  800232:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800239:	00 00 00 
+  80023c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800240:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800247:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  80024e:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800255:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  80025c:	00 00 00 
+  80025f:	4c 8b 30             	mov    (%rax),%r14
+  800262:	48 b8 a5 0f 80 00 00 	movabs $0x800fa5,%rax
+  800269:	00 00 00 
+  80026c:	ff d0                	call   *%rax
+  80026e:	89 c6                	mov    %eax,%esi
+  800270:	45 89 e8             	mov    %r13d,%r8d
+  800273:	4c 89 e1             	mov    %r12,%rcx
+  800276:	4c 89 f2             	mov    %r14,%rdx
+  800279:	48 bf 88 14 80 00 00 	movabs $0x801488,%rdi
+  800280:	00 00 00 
+  800283:	b8 00 00 00 00       	mov    $0x0,%eax
+  800288:	49 bc 6d 03 80 00 00 	movabs $0x80036d,%r12
+  80028f:	00 00 00 
+  800292:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800295:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  80029c:	48 89 df             	mov    %rbx,%rdi
+  80029f:	48 b8 09 03 80 00 00 	movabs $0x800309,%rax
+  8002a6:	00 00 00 
+  8002a9:	ff d0                	call   *%rax
+	cprintf("\n");
+  8002ab:	48 bf 10 14 80 00 00 	movabs $0x801410,%rdi
+  8002b2:	00 00 00 
+  8002b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ba:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002bd:	cc                   	int3
+	while (1)
+  8002be:	eb fd                	jmp    8002bd <_panic+0xef>
+
+00000000008002c0 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002c0:	55                   	push   %rbp
+  8002c1:	48 89 e5             	mov    %rsp,%rbp
+  8002c4:	53                   	push   %rbx
+  8002c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8002c9:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  8002cc:	8b 06                	mov    (%rsi),%eax
+  8002ce:	8d 50 01             	lea    0x1(%rax),%edx
+  8002d1:	89 16                	mov    %edx,(%rsi)
+  8002d3:	48 98                	cltq
+  8002d5:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  8002da:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002e0:	74 0a                	je     8002ec <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002e2:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002ea:	c9                   	leave
+  8002eb:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002ec:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002f0:	be ff 00 00 00       	mov    $0xff,%esi
+  8002f5:	48 b8 12 0f 80 00 00 	movabs $0x800f12,%rax
+  8002fc:	00 00 00 
+  8002ff:	ff d0                	call   *%rax
+		b->idx = 0;
+  800301:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800307:	eb d9                	jmp    8002e2 <putch+0x22>
+
+0000000000800309 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800309:	55                   	push   %rbp
+  80030a:	48 89 e5             	mov    %rsp,%rbp
+  80030d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800314:	48 89 fa             	mov    %rdi,%rdx
+  800317:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  80031a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800321:	00 00 00 
+	b.cnt = 0;
+  800324:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80032b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80032e:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  800335:	48 bf c0 02 80 00 00 	movabs $0x8002c0,%rdi
+  80033c:	00 00 00 
+  80033f:	48 b8 27 05 80 00 00 	movabs $0x800527,%rax
+  800346:	00 00 00 
+  800349:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  80034b:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  800352:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800359:	48 b8 12 0f 80 00 00 	movabs $0x800f12,%rax
+  800360:	00 00 00 
+  800363:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  800365:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  80036b:	c9                   	leave
+  80036c:	c3                   	ret
+
+000000000080036d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80036d:	55                   	push   %rbp
+  80036e:	48 89 e5             	mov    %rsp,%rbp
+  800371:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800378:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80037f:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800386:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80038d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800394:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80039b:	84 c0                	test   %al,%al
+  80039d:	74 20                	je     8003bf <cprintf+0x52>
+  80039f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8003a3:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8003a7:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8003ab:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8003af:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8003b3:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8003b7:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8003bb:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8003bf:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  8003c6:	00 00 00 
+  8003c9:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8003d0:	00 00 00 
+  8003d3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003d7:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8003de:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8003e5:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  8003ec:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  8003f3:	48 b8 09 03 80 00 00 	movabs $0x800309,%rax
+  8003fa:	00 00 00 
+  8003fd:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  8003ff:	c9                   	leave
+  800400:	c3                   	ret
+
+0000000000800401 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800401:	55                   	push   %rbp
+  800402:	48 89 e5             	mov    %rsp,%rbp
+  800405:	41 57                	push   %r15
+  800407:	41 56                	push   %r14
+  800409:	41 55                	push   %r13
+  80040b:	41 54                	push   %r12
+  80040d:	53                   	push   %rbx
+  80040e:	48 83 ec 18          	sub    $0x18,%rsp
+  800412:	49 89 fc             	mov    %rdi,%r12
+  800415:	49 89 f5             	mov    %rsi,%r13
+  800418:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80041c:	44 89 c3             	mov    %r8d,%ebx
+  80041f:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800422:	41 89 cf             	mov    %ecx,%r15d
+  800425:	4c 39 fa             	cmp    %r15,%rdx
+  800428:	72 29                	jb     800453 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80042a:	48 89 d0             	mov    %rdx,%rax
+  80042d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800432:	49 f7 f7             	div    %r15
+  800435:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800439:	48 89 c2             	mov    %rax,%rdx
+  80043c:	48 b8 01 04 80 00 00 	movabs $0x800401,%rax
+  800443:	00 00 00 
+  800446:	ff d0                	call   *%rax
+  800448:	eb 10                	jmp    80045a <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80044a:	4c 89 ee             	mov    %r13,%rsi
+  80044d:	44 89 f7             	mov    %r14d,%edi
+  800450:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  800453:	83 eb 01             	sub    $0x1,%ebx
+  800456:	85 db                	test   %ebx,%ebx
+  800458:	7f f0                	jg     80044a <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80045a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80045e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800463:	49 f7 f7             	div    %r15
+  800466:	48 b8 ab 14 80 00 00 	movabs $0x8014ab,%rax
+  80046d:	00 00 00 
+  800470:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  800474:	4c 89 ee             	mov    %r13,%rsi
+  800477:	41 ff d4             	call   *%r12
+}
+  80047a:	48 83 c4 18          	add    $0x18,%rsp
+  80047e:	5b                   	pop    %rbx
+  80047f:	41 5c                	pop    %r12
+  800481:	41 5d                	pop    %r13
+  800483:	41 5e                	pop    %r14
+  800485:	41 5f                	pop    %r15
+  800487:	5d                   	pop    %rbp
+  800488:	c3                   	ret
+
+0000000000800489 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  800489:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  80048d:	48 8b 06             	mov    (%rsi),%rax
+  800490:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800494:	73 0a                	jae    8004a0 <sprintputch+0x17>
+		*b->buf++ = ch;
+  800496:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80049a:	48 89 16             	mov    %rdx,(%rsi)
+  80049d:	40 88 38             	mov    %dil,(%rax)
+}
+  8004a0:	c3                   	ret
+
+00000000008004a1 <printfmt>:
+{
+  8004a1:	55                   	push   %rbp
+  8004a2:	48 89 e5             	mov    %rsp,%rbp
+  8004a5:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8004ac:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8004b3:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8004ba:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8004c1:	84 c0                	test   %al,%al
+  8004c3:	74 20                	je     8004e5 <printfmt+0x44>
+  8004c5:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8004c9:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8004cd:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8004d1:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8004d5:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8004d9:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8004dd:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8004e1:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  8004e5:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8004ec:	00 00 00 
+  8004ef:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8004f6:	00 00 00 
+  8004f9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004fd:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800504:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80050b:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800512:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800519:	48 b8 27 05 80 00 00 	movabs $0x800527,%rax
+  800520:	00 00 00 
+  800523:	ff d0                	call   *%rax
+}
+  800525:	c9                   	leave
+  800526:	c3                   	ret
+
+0000000000800527 <vprintfmt>:
+{
+  800527:	55                   	push   %rbp
+  800528:	48 89 e5             	mov    %rsp,%rbp
+  80052b:	41 57                	push   %r15
+  80052d:	41 56                	push   %r14
+  80052f:	41 55                	push   %r13
+  800531:	41 54                	push   %r12
+  800533:	53                   	push   %rbx
+  800534:	48 83 ec 48          	sub    $0x48,%rsp
+  800538:	49 89 fe             	mov    %rdi,%r14
+  80053b:	49 89 f5             	mov    %rsi,%r13
+  80053e:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  800541:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  800545:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  800549:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80054d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  800551:	eb 09                	jmp    80055c <vprintfmt+0x35>
+			putch(ch, putdat);
+  800553:	4c 89 ee             	mov    %r13,%rsi
+  800556:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800559:	4c 89 e3             	mov    %r12,%rbx
+  80055c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800560:	0f b6 3b             	movzbl (%rbx),%edi
+  800563:	83 ff 25             	cmp    $0x25,%edi
+  800566:	74 13                	je     80057b <vprintfmt+0x54>
+			if (ch == '\0')
+  800568:	85 ff                	test   %edi,%edi
+  80056a:	75 e7                	jne    800553 <vprintfmt+0x2c>
+}
+  80056c:	48 83 c4 48          	add    $0x48,%rsp
+  800570:	5b                   	pop    %rbx
+  800571:	41 5c                	pop    %r12
+  800573:	41 5d                	pop    %r13
+  800575:	41 5e                	pop    %r14
+  800577:	41 5f                	pop    %r15
+  800579:	5d                   	pop    %rbp
+  80057a:	c3                   	ret
+		padc = ' ';
+  80057b:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  80057f:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  800586:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  80058c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  800593:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800598:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80059d:	41 0f b6 14 24       	movzbl (%r12),%edx
+  8005a2:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  8005a5:	3c 55                	cmp    $0x55,%al
+  8005a7:	0f 87 4f 05 00 00    	ja     800afc <vprintfmt+0x5d5>
+  8005ad:	0f b6 c0             	movzbl %al,%eax
+  8005b0:	48 be 80 15 80 00 00 	movabs $0x801580,%rsi
+  8005b7:	00 00 00 
+  8005ba:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  8005bd:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  8005c0:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  8005c4:	eb d2                	jmp    800598 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005c6:	49 89 dc             	mov    %rbx,%r12
+  8005c9:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  8005cd:	eb c9                	jmp    800598 <vprintfmt+0x71>
+  8005cf:	0f b6 d2             	movzbl %dl,%edx
+  8005d2:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  8005d5:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  8005db:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  8005df:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  8005e4:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  8005e9:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  8005ec:	83 f8 09             	cmp    $0x9,%eax
+  8005ef:	77 20                	ja     800611 <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  8005f1:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  8005f5:	eb e4                	jmp    8005db <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  8005f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8005fd:	77 27                	ja     800626 <vprintfmt+0xff>
+  8005ff:	89 c2                	mov    %eax,%edx
+  800601:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800605:	83 c0 08             	add    $0x8,%eax
+  800608:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80060b:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  80060e:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  800611:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800615:	79 81                	jns    800598 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  800617:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  80061b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800621:	e9 72 ff ff ff       	jmp    800598 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  800626:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80062a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80062e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800632:	eb d7                	jmp    80060b <vprintfmt+0xe4>
+			if (width < 0)
+  800634:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  800637:	85 f6                	test   %esi,%esi
+  800639:	b8 00 00 00 00       	mov    $0x0,%eax
+  80063e:	0f 49 c6             	cmovns %esi,%eax
+  800641:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800644:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800647:	e9 4c ff ff ff       	jmp    800598 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  80064c:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  80064f:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  800656:	e9 3d ff ff ff       	jmp    800598 <vprintfmt+0x71>
+			lflag++;
+  80065b:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80065e:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800661:	e9 32 ff ff ff       	jmp    800598 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  800666:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800669:	83 f8 2f             	cmp    $0x2f,%eax
+  80066c:	77 19                	ja     800687 <vprintfmt+0x160>
+  80066e:	89 c2                	mov    %eax,%edx
+  800670:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800674:	83 c0 08             	add    $0x8,%eax
+  800677:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80067a:	8b 3a                	mov    (%rdx),%edi
+  80067c:	4c 89 ee             	mov    %r13,%rsi
+  80067f:	41 ff d6             	call   *%r14
+			break;
+  800682:	e9 d5 fe ff ff       	jmp    80055c <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  800687:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80068b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80068f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800693:	eb e5                	jmp    80067a <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  800695:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800698:	83 f8 2f             	cmp    $0x2f,%eax
+  80069b:	77 5a                	ja     8006f7 <vprintfmt+0x1d0>
+  80069d:	89 c2                	mov    %eax,%edx
+  80069f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006a3:	83 c0 08             	add    $0x8,%eax
+  8006a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  8006a9:	8b 02                	mov    (%rdx),%eax
+  8006ab:	89 c1                	mov    %eax,%ecx
+  8006ad:	f7 d9                	neg    %ecx
+  8006af:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006b2:	83 f9 08             	cmp    $0x8,%ecx
+  8006b5:	7f 4e                	jg     800705 <vprintfmt+0x1de>
+  8006b7:	48 63 c1             	movslq %ecx,%rax
+  8006ba:	48 ba 40 18 80 00 00 	movabs $0x801840,%rdx
+  8006c1:	00 00 00 
+  8006c4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006c8:	48 85 c0             	test   %rax,%rax
+  8006cb:	74 38                	je     800705 <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  8006cd:	48 89 c1             	mov    %rax,%rcx
+  8006d0:	48 ba cc 14 80 00 00 	movabs $0x8014cc,%rdx
+  8006d7:	00 00 00 
+  8006da:	4c 89 ee             	mov    %r13,%rsi
+  8006dd:	4c 89 f7             	mov    %r14,%rdi
+  8006e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e5:	49 b8 a1 04 80 00 00 	movabs $0x8004a1,%r8
+  8006ec:	00 00 00 
+  8006ef:	41 ff d0             	call   *%r8
+  8006f2:	e9 65 fe ff ff       	jmp    80055c <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  8006f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800703:	eb a4                	jmp    8006a9 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  800705:	48 ba c3 14 80 00 00 	movabs $0x8014c3,%rdx
+  80070c:	00 00 00 
+  80070f:	4c 89 ee             	mov    %r13,%rsi
+  800712:	4c 89 f7             	mov    %r14,%rdi
+  800715:	b8 00 00 00 00       	mov    $0x0,%eax
+  80071a:	49 b8 a1 04 80 00 00 	movabs $0x8004a1,%r8
+  800721:	00 00 00 
+  800724:	41 ff d0             	call   *%r8
+  800727:	e9 30 fe ff ff       	jmp    80055c <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  80072c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80072f:	83 f8 2f             	cmp    $0x2f,%eax
+  800732:	77 36                	ja     80076a <vprintfmt+0x243>
+  800734:	89 c2                	mov    %eax,%edx
+  800736:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073a:	83 c0 08             	add    $0x8,%eax
+  80073d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800740:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800743:	48 85 c9             	test   %rcx,%rcx
+  800746:	48 b8 bc 14 80 00 00 	movabs $0x8014bc,%rax
+  80074d:	00 00 00 
+  800750:	48 0f 45 c1          	cmovne %rcx,%rax
+  800754:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800758:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80075c:	7e 06                	jle    800764 <vprintfmt+0x23d>
+  80075e:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800762:	75 14                	jne    800778 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800764:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800768:	eb 64                	jmp    8007ce <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  80076a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80076e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800772:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800776:	eb c8                	jmp    800740 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800778:	49 63 f7             	movslq %r15d,%rsi
+  80077b:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  80077f:	48 b8 0a 0c 80 00 00 	movabs $0x800c0a,%rax
+  800786:	00 00 00 
+  800789:	ff d0                	call   *%rax
+  80078b:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80078e:	29 c1                	sub    %eax,%ecx
+  800790:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800793:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  800796:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  80079a:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80079d:	eb 0d                	jmp    8007ac <vprintfmt+0x285>
+					putch(padc, putdat);
+  80079f:	4c 89 ee             	mov    %r13,%rsi
+  8007a2:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  8007a5:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007a8:	41 83 ec 01          	sub    $0x1,%r12d
+  8007ac:	45 85 e4             	test   %r12d,%r12d
+  8007af:	7f ee                	jg     80079f <vprintfmt+0x278>
+  8007b1:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  8007b4:	85 c9                	test   %ecx,%ecx
+  8007b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007bb:	0f 49 c1             	cmovns %ecx,%eax
+  8007be:	29 c1                	sub    %eax,%ecx
+  8007c0:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  8007c3:	eb 9f                	jmp    800764 <vprintfmt+0x23d>
+					putch(ch, putdat);
+  8007c5:	4c 89 ee             	mov    %r13,%rsi
+  8007c8:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007cb:	4c 89 e2             	mov    %r12,%rdx
+  8007ce:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8007d2:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007d8:	0f be f8             	movsbl %al,%edi
+  8007db:	85 ff                	test   %edi,%edi
+  8007dd:	74 29                	je     800808 <vprintfmt+0x2e1>
+  8007df:	45 85 ff             	test   %r15d,%r15d
+  8007e2:	78 06                	js     8007ea <vprintfmt+0x2c3>
+  8007e4:	41 83 ef 01          	sub    $0x1,%r15d
+  8007e8:	78 1e                	js     800808 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007ea:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  8007ee:	74 d5                	je     8007c5 <vprintfmt+0x29e>
+  8007f0:	0f be c0             	movsbl %al,%eax
+  8007f3:	83 e8 20             	sub    $0x20,%eax
+  8007f6:	83 f8 5e             	cmp    $0x5e,%eax
+  8007f9:	76 ca                	jbe    8007c5 <vprintfmt+0x29e>
+					putch('?', putdat);
+  8007fb:	4c 89 ee             	mov    %r13,%rsi
+  8007fe:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800803:	41 ff d6             	call   *%r14
+  800806:	eb c3                	jmp    8007cb <vprintfmt+0x2a4>
+  800808:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  80080c:	8b 45 98             	mov    -0x68(%rbp),%eax
+  80080f:	41 01 c4             	add    %eax,%r12d
+  800812:	41 29 d4             	sub    %edx,%r12d
+  800815:	eb 0f                	jmp    800826 <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  800817:	4c 89 ee             	mov    %r13,%rsi
+  80081a:	bf 20 00 00 00       	mov    $0x20,%edi
+  80081f:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  800822:	41 83 ec 01          	sub    $0x1,%r12d
+  800826:	45 85 e4             	test   %r12d,%r12d
+  800829:	7f ec                	jg     800817 <vprintfmt+0x2f0>
+  80082b:	e9 2c fd ff ff       	jmp    80055c <vprintfmt+0x35>
+	if (lflag >= 2)
+  800830:	83 f9 01             	cmp    $0x1,%ecx
+  800833:	7f 1d                	jg     800852 <vprintfmt+0x32b>
+	else if (lflag)
+  800835:	85 c9                	test   %ecx,%ecx
+  800837:	74 5e                	je     800897 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800839:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083c:	83 f8 2f             	cmp    $0x2f,%eax
+  80083f:	77 48                	ja     800889 <vprintfmt+0x362>
+  800841:	89 c2                	mov    %eax,%edx
+  800843:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800847:	83 c0 08             	add    $0x8,%eax
+  80084a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084d:	4c 8b 22             	mov    (%rdx),%r12
+  800850:	eb 17                	jmp    800869 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800852:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800855:	83 f8 2f             	cmp    $0x2f,%eax
+  800858:	77 21                	ja     80087b <vprintfmt+0x354>
+  80085a:	89 c2                	mov    %eax,%edx
+  80085c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800860:	83 c0 08             	add    $0x8,%eax
+  800863:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800866:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800869:	4d 85 e4             	test   %r12,%r12
+  80086c:	78 50                	js     8008be <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  80086e:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  800871:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800876:	e9 b4 01 00 00       	jmp    800a2f <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  80087b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800883:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800887:	eb dd                	jmp    800866 <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800889:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80088d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800891:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800895:	eb b6                	jmp    80084d <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800897:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089a:	83 f8 2f             	cmp    $0x2f,%eax
+  80089d:	77 11                	ja     8008b0 <vprintfmt+0x389>
+  80089f:	89 c2                	mov    %eax,%edx
+  8008a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a5:	83 c0 08             	add    $0x8,%eax
+  8008a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ab:	4c 63 22             	movslq (%rdx),%r12
+  8008ae:	eb b9                	jmp    800869 <vprintfmt+0x342>
+  8008b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008bc:	eb ed                	jmp    8008ab <vprintfmt+0x384>
+				putch('-', putdat);
+  8008be:	4c 89 ee             	mov    %r13,%rsi
+  8008c1:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008c6:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  8008c9:	4c 89 e2             	mov    %r12,%rdx
+  8008cc:	48 f7 da             	neg    %rdx
+			base = 10;
+  8008cf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8008d4:	e9 56 01 00 00       	jmp    800a2f <vprintfmt+0x508>
+	if (lflag >= 2)
+  8008d9:	83 f9 01             	cmp    $0x1,%ecx
+  8008dc:	7f 25                	jg     800903 <vprintfmt+0x3dc>
+	else if (lflag)
+  8008de:	85 c9                	test   %ecx,%ecx
+  8008e0:	74 5e                	je     800940 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  8008e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e8:	77 48                	ja     800932 <vprintfmt+0x40b>
+  8008ea:	89 c2                	mov    %eax,%edx
+  8008ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f0:	83 c0 08             	add    $0x8,%eax
+  8008f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f6:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8008f9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  8008fe:	e9 2c 01 00 00       	jmp    800a2f <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800903:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800906:	83 f8 2f             	cmp    $0x2f,%eax
+  800909:	77 19                	ja     800924 <vprintfmt+0x3fd>
+  80090b:	89 c2                	mov    %eax,%edx
+  80090d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800911:	83 c0 08             	add    $0x8,%eax
+  800914:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800917:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  80091a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  80091f:	e9 0b 01 00 00       	jmp    800a2f <vprintfmt+0x508>
+  800924:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800928:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800930:	eb e5                	jmp    800917 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800932:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800936:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80093e:	eb b6                	jmp    8008f6 <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  800940:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800943:	83 f8 2f             	cmp    $0x2f,%eax
+  800946:	77 18                	ja     800960 <vprintfmt+0x439>
+  800948:	89 c2                	mov    %eax,%edx
+  80094a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80094e:	83 c0 08             	add    $0x8,%eax
+  800951:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800954:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800956:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  80095b:	e9 cf 00 00 00       	jmp    800a2f <vprintfmt+0x508>
+  800960:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800964:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800968:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80096c:	eb e6                	jmp    800954 <vprintfmt+0x42d>
+	if (lflag >= 2)
+  80096e:	83 f9 01             	cmp    $0x1,%ecx
+  800971:	7f 25                	jg     800998 <vprintfmt+0x471>
+	else if (lflag)
+  800973:	85 c9                	test   %ecx,%ecx
+  800975:	74 5b                	je     8009d2 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800977:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097a:	83 f8 2f             	cmp    $0x2f,%eax
+  80097d:	77 45                	ja     8009c4 <vprintfmt+0x49d>
+  80097f:	89 c2                	mov    %eax,%edx
+  800981:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800985:	83 c0 08             	add    $0x8,%eax
+  800988:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098b:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  80098e:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800993:	e9 97 00 00 00       	jmp    800a2f <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800998:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099b:	83 f8 2f             	cmp    $0x2f,%eax
+  80099e:	77 16                	ja     8009b6 <vprintfmt+0x48f>
+  8009a0:	89 c2                	mov    %eax,%edx
+  8009a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a6:	83 c0 08             	add    $0x8,%eax
+  8009a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ac:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  8009af:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  8009b4:	eb 79                	jmp    800a2f <vprintfmt+0x508>
+  8009b6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c2:	eb e8                	jmp    8009ac <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  8009c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d0:	eb b9                	jmp    80098b <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  8009d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d8:	77 15                	ja     8009ef <vprintfmt+0x4c8>
+  8009da:	89 c2                	mov    %eax,%edx
+  8009dc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e0:	83 c0 08             	add    $0x8,%eax
+  8009e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e6:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  8009e8:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  8009ed:	eb 40                	jmp    800a2f <vprintfmt+0x508>
+  8009ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fb:	eb e9                	jmp    8009e6 <vprintfmt+0x4bf>
+			putch('0', putdat);
+  8009fd:	4c 89 ee             	mov    %r13,%rsi
+  800a00:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a05:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800a08:	4c 89 ee             	mov    %r13,%rsi
+  800a0b:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a10:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800a13:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a16:	83 f8 2f             	cmp    $0x2f,%eax
+  800a19:	77 34                	ja     800a4f <vprintfmt+0x528>
+  800a1b:	89 c2                	mov    %eax,%edx
+  800a1d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a21:	83 c0 08             	add    $0x8,%eax
+  800a24:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800a27:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800a2a:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800a2f:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800a34:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a38:	4c 89 ee             	mov    %r13,%rsi
+  800a3b:	4c 89 f7             	mov    %r14,%rdi
+  800a3e:	48 b8 01 04 80 00 00 	movabs $0x800401,%rax
+  800a45:	00 00 00 
+  800a48:	ff d0                	call   *%rax
+			break;
+  800a4a:	e9 0d fb ff ff       	jmp    80055c <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800a4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5b:	eb ca                	jmp    800a27 <vprintfmt+0x500>
+	if (lflag >= 2)
+  800a5d:	83 f9 01             	cmp    $0x1,%ecx
+  800a60:	7f 22                	jg     800a84 <vprintfmt+0x55d>
+	else if (lflag)
+  800a62:	85 c9                	test   %ecx,%ecx
+  800a64:	74 58                	je     800abe <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800a66:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a69:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6c:	77 42                	ja     800ab0 <vprintfmt+0x589>
+  800a6e:	89 c2                	mov    %eax,%edx
+  800a70:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a74:	83 c0 08             	add    $0x8,%eax
+  800a77:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a7a:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800a7d:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800a82:	eb ab                	jmp    800a2f <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800a84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a87:	83 f8 2f             	cmp    $0x2f,%eax
+  800a8a:	77 16                	ja     800aa2 <vprintfmt+0x57b>
+  800a8c:	89 c2                	mov    %eax,%edx
+  800a8e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a92:	83 c0 08             	add    $0x8,%eax
+  800a95:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a98:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800a9b:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800aa0:	eb 8d                	jmp    800a2f <vprintfmt+0x508>
+  800aa2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aaa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aae:	eb e8                	jmp    800a98 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800ab0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800abc:	eb bc                	jmp    800a7a <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800abe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac4:	77 18                	ja     800ade <vprintfmt+0x5b7>
+  800ac6:	89 c2                	mov    %eax,%edx
+  800ac8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800acc:	83 c0 08             	add    $0x8,%eax
+  800acf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad2:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800ad4:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800ad9:	e9 51 ff ff ff       	jmp    800a2f <vprintfmt+0x508>
+  800ade:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aea:	eb e6                	jmp    800ad2 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800aec:	4c 89 ee             	mov    %r13,%rsi
+  800aef:	bf 25 00 00 00       	mov    $0x25,%edi
+  800af4:	41 ff d6             	call   *%r14
+			break;
+  800af7:	e9 60 fa ff ff       	jmp    80055c <vprintfmt+0x35>
+			putch('%', putdat);
+  800afc:	4c 89 ee             	mov    %r13,%rsi
+  800aff:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b04:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b07:	4c 89 e3             	mov    %r12,%rbx
+  800b0a:	eb 04                	jmp    800b10 <vprintfmt+0x5e9>
+  800b0c:	48 83 eb 01          	sub    $0x1,%rbx
+  800b10:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b14:	75 f6                	jne    800b0c <vprintfmt+0x5e5>
+  800b16:	e9 41 fa ff ff       	jmp    80055c <vprintfmt+0x35>
+
+0000000000800b1b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b1b:	55                   	push   %rbp
+  800b1c:	48 89 e5             	mov    %rsp,%rbp
+  800b1f:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b23:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800b27:	48 63 c6             	movslq %esi,%rax
+  800b2a:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800b2f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800b33:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800b3a:	48 85 ff             	test   %rdi,%rdi
+  800b3d:	74 2a                	je     800b69 <vsnprintf+0x4e>
+  800b3f:	85 f6                	test   %esi,%esi
+  800b41:	7e 26                	jle    800b69 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b43:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800b47:	48 bf 89 04 80 00 00 	movabs $0x800489,%rdi
+  800b4e:	00 00 00 
+  800b51:	48 b8 27 05 80 00 00 	movabs $0x800527,%rax
+  800b58:	00 00 00 
+  800b5b:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b5d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800b61:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800b64:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800b67:	c9                   	leave
+  800b68:	c3                   	ret
+		return -E_INVAL;
+  800b69:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b6e:	eb f7                	jmp    800b67 <vsnprintf+0x4c>
+
+0000000000800b70 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b70:	55                   	push   %rbp
+  800b71:	48 89 e5             	mov    %rsp,%rbp
+  800b74:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800b7b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800b82:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800b89:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800b90:	84 c0                	test   %al,%al
+  800b92:	74 20                	je     800bb4 <snprintf+0x44>
+  800b94:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800b98:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800b9c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800ba0:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800ba4:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800ba8:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800bac:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800bb0:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800bb4:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800bbb:	00 00 00 
+  800bbe:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800bc5:	00 00 00 
+  800bc8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bcc:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800bd3:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800bda:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800be1:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800be8:	48 b8 1b 0b 80 00 00 	movabs $0x800b1b,%rax
+  800bef:	00 00 00 
+  800bf2:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800bf4:	c9                   	leave
+  800bf5:	c3                   	ret
+
+0000000000800bf6 <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800bf6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bfb:	48 89 d0             	mov    %rdx,%rax
+  800bfe:	48 83 c2 01          	add    $0x1,%rdx
+  800c02:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800c07:	75 f2                	jne    800bfb <strlen+0x5>
+		n++;
+	return n;
+}
+  800c09:	c3                   	ret
+
+0000000000800c0a <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c0f:	eb 03                	jmp    800c14 <strnlen+0xa>
+  800c11:	48 89 d0             	mov    %rdx,%rax
+  800c14:	48 39 c6             	cmp    %rax,%rsi
+  800c17:	74 0a                	je     800c23 <strnlen+0x19>
+  800c19:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c1d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c21:	75 ee                	jne    800c11 <strnlen+0x7>
+		n++;
+	return n;
+}
+  800c23:	c3                   	ret
+
+0000000000800c24 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800c24:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800c27:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c2c:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c30:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c33:	48 83 c2 01          	add    $0x1,%rdx
+  800c37:	84 c9                	test   %cl,%cl
+  800c39:	75 f1                	jne    800c2c <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800c3b:	c3                   	ret
+
+0000000000800c3c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c3c:	55                   	push   %rbp
+  800c3d:	48 89 e5             	mov    %rsp,%rbp
+  800c40:	41 54                	push   %r12
+  800c42:	53                   	push   %rbx
+  800c43:	48 89 fb             	mov    %rdi,%rbx
+  800c46:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800c49:	48 b8 f6 0b 80 00 00 	movabs $0x800bf6,%rax
+  800c50:	00 00 00 
+  800c53:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800c55:	48 63 f8             	movslq %eax,%rdi
+  800c58:	48 01 df             	add    %rbx,%rdi
+  800c5b:	4c 89 e6             	mov    %r12,%rsi
+  800c5e:	48 b8 24 0c 80 00 00 	movabs $0x800c24,%rax
+  800c65:	00 00 00 
+  800c68:	ff d0                	call   *%rax
+	return dst;
+}
+  800c6a:	48 89 d8             	mov    %rbx,%rax
+  800c6d:	5b                   	pop    %rbx
+  800c6e:	41 5c                	pop    %r12
+  800c70:	5d                   	pop    %rbp
+  800c71:	c3                   	ret
+
+0000000000800c72 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c72:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c75:	48 01 fa             	add    %rdi,%rdx
+  800c78:	48 89 f9             	mov    %rdi,%rcx
+  800c7b:	eb 14                	jmp    800c91 <strncpy+0x1f>
+		*dst++ = *src;
+  800c7d:	48 83 c1 01          	add    $0x1,%rcx
+  800c81:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c85:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c89:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c8d:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800c91:	48 39 d1             	cmp    %rdx,%rcx
+  800c94:	75 e7                	jne    800c7d <strncpy+0xb>
+	}
+	return ret;
+}
+  800c96:	c3                   	ret
+
+0000000000800c97 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c97:	48 89 f8             	mov    %rdi,%rax
+  800c9a:	48 85 d2             	test   %rdx,%rdx
+  800c9d:	74 27                	je     800cc6 <strlcpy+0x2f>
+  800c9f:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800ca4:	48 89 fa             	mov    %rdi,%rdx
+  800ca7:	eb 0b                	jmp    800cb4 <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800ca9:	48 83 c6 01          	add    $0x1,%rsi
+  800cad:	48 83 c2 01          	add    $0x1,%rdx
+  800cb1:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800cb4:	48 39 c2             	cmp    %rax,%rdx
+  800cb7:	74 0a                	je     800cc3 <strlcpy+0x2c>
+  800cb9:	0f b6 0e             	movzbl (%rsi),%ecx
+  800cbc:	84 c9                	test   %cl,%cl
+  800cbe:	75 e9                	jne    800ca9 <strlcpy+0x12>
+  800cc0:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800cc3:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800cc6:	48 29 f8             	sub    %rdi,%rax
+}
+  800cc9:	c3                   	ret
+
+0000000000800cca <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800cca:	eb 08                	jmp    800cd4 <strcmp+0xa>
+		p++, q++;
+  800ccc:	48 83 c7 01          	add    $0x1,%rdi
+  800cd0:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800cd4:	0f b6 07             	movzbl (%rdi),%eax
+  800cd7:	84 c0                	test   %al,%al
+  800cd9:	74 04                	je     800cdf <strcmp+0x15>
+  800cdb:	3a 06                	cmp    (%rsi),%al
+  800cdd:	74 ed                	je     800ccc <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cdf:	0f b6 c0             	movzbl %al,%eax
+  800ce2:	0f b6 16             	movzbl (%rsi),%edx
+  800ce5:	29 d0                	sub    %edx,%eax
+}
+  800ce7:	c3                   	ret
+
+0000000000800ce8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800ce8:	eb 0c                	jmp    800cf6 <strncmp+0xe>
+		n--, p++, q++;
+  800cea:	48 83 ea 01          	sub    $0x1,%rdx
+  800cee:	48 83 c7 01          	add    $0x1,%rdi
+  800cf2:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800cf6:	48 85 d2             	test   %rdx,%rdx
+  800cf9:	74 14                	je     800d0f <strncmp+0x27>
+  800cfb:	0f b6 07             	movzbl (%rdi),%eax
+  800cfe:	84 c0                	test   %al,%al
+  800d00:	74 04                	je     800d06 <strncmp+0x1e>
+  800d02:	3a 06                	cmp    (%rsi),%al
+  800d04:	74 e4                	je     800cea <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d06:	0f b6 07             	movzbl (%rdi),%eax
+  800d09:	0f b6 16             	movzbl (%rsi),%edx
+  800d0c:	29 d0                	sub    %edx,%eax
+}
+  800d0e:	c3                   	ret
+		return 0;
+  800d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d14:	c3                   	ret
+
+0000000000800d15 <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800d15:	eb 04                	jmp    800d1b <strchr+0x6>
+  800d17:	48 83 c7 01          	add    $0x1,%rdi
+  800d1b:	0f b6 07             	movzbl (%rdi),%eax
+  800d1e:	84 c0                	test   %al,%al
+  800d20:	74 09                	je     800d2b <strchr+0x16>
+		if (*s == c)
+  800d22:	40 38 f0             	cmp    %sil,%al
+  800d25:	75 f0                	jne    800d17 <strchr+0x2>
+  800d27:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800d2a:	c3                   	ret
+	return 0;
+  800d2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d30:	c3                   	ret
+
+0000000000800d31 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d31:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800d34:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800d37:	40 38 f2             	cmp    %sil,%dl
+  800d3a:	74 0a                	je     800d46 <strfind+0x15>
+  800d3c:	84 d2                	test   %dl,%dl
+  800d3e:	74 06                	je     800d46 <strfind+0x15>
+	for (; *s; s++)
+  800d40:	48 83 c0 01          	add    $0x1,%rax
+  800d44:	eb ee                	jmp    800d34 <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800d46:	c3                   	ret
+
+0000000000800d47 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800d47:	48 85 d2             	test   %rdx,%rdx
+  800d4a:	74 28                	je     800d74 <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800d4c:	48 89 f8             	mov    %rdi,%rax
+  800d4f:	48 09 d0             	or     %rdx,%rax
+  800d52:	a8 03                	test   $0x3,%al
+  800d54:	75 16                	jne    800d6c <memset+0x25>
+		c &= 0xFF;
+  800d56:	40 0f b6 f6          	movzbl %sil,%esi
+  800d5a:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d60:	48 89 d1             	mov    %rdx,%rcx
+  800d63:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800d67:	fc                   	cld
+  800d68:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800d6a:	eb 08                	jmp    800d74 <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d6c:	89 f0                	mov    %esi,%eax
+  800d6e:	48 89 d1             	mov    %rdx,%rcx
+  800d71:	fc                   	cld
+  800d72:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d74:	48 89 f8             	mov    %rdi,%rax
+  800d77:	c3                   	ret
+
+0000000000800d78 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d78:	48 89 f8             	mov    %rdi,%rax
+  800d7b:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d7e:	48 39 fe             	cmp    %rdi,%rsi
+  800d81:	73 3a                	jae    800dbd <memmove+0x45>
+  800d83:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d87:	48 39 d7             	cmp    %rdx,%rdi
+  800d8a:	73 31                	jae    800dbd <memmove+0x45>
+		s += n;
+		d += n;
+  800d8c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800d90:	48 89 d6             	mov    %rdx,%rsi
+  800d93:	48 09 fe             	or     %rdi,%rsi
+  800d96:	48 09 ce             	or     %rcx,%rsi
+  800d99:	40 f6 c6 03          	test   $0x3,%sil
+  800d9d:	75 11                	jne    800db0 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d9f:	48 83 ef 04          	sub    $0x4,%rdi
+  800da3:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800da7:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800dab:	fd                   	std
+  800dac:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800dae:	eb 0b                	jmp    800dbb <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800db0:	48 83 ef 01          	sub    $0x1,%rdi
+  800db4:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800db8:	fd                   	std
+  800db9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800dbb:	fc                   	cld
+  800dbc:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800dbd:	48 89 f2             	mov    %rsi,%rdx
+  800dc0:	48 09 c2             	or     %rax,%rdx
+  800dc3:	48 09 ca             	or     %rcx,%rdx
+  800dc6:	f6 c2 03             	test   $0x3,%dl
+  800dc9:	75 0b                	jne    800dd6 <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800dcb:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800dcf:	48 89 c7             	mov    %rax,%rdi
+  800dd2:	fc                   	cld
+  800dd3:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800dd5:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800dd6:	48 89 c7             	mov    %rax,%rdi
+  800dd9:	fc                   	cld
+  800dda:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ddc:	c3                   	ret
+
+0000000000800ddd <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ddd:	55                   	push   %rbp
+  800dde:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800de1:	48 b8 78 0d 80 00 00 	movabs $0x800d78,%rax
+  800de8:	00 00 00 
+  800deb:	ff d0                	call   *%rax
+}
+  800ded:	5d                   	pop    %rbp
+  800dee:	c3                   	ret
+
+0000000000800def <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800def:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df4:	48 39 c2             	cmp    %rax,%rdx
+  800df7:	74 1e                	je     800e17 <memcmp+0x28>
+		if (*s1 != *s2)
+  800df9:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800dfd:	48 83 c0 01          	add    $0x1,%rax
+  800e01:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800e07:	44 38 c1             	cmp    %r8b,%cl
+  800e0a:	74 e8                	je     800df4 <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800e0c:	0f b6 c1             	movzbl %cl,%eax
+  800e0f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e13:	44 29 c0             	sub    %r8d,%eax
+  800e16:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800e17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e1c:	c3                   	ret
+
+0000000000800e1d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e1d:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800e20:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800e23:	eb 04                	jmp    800e29 <memfind+0xc>
+  800e25:	48 83 c0 01          	add    $0x1,%rax
+  800e29:	48 39 d0             	cmp    %rdx,%rax
+  800e2c:	73 05                	jae    800e33 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e2e:	40 38 30             	cmp    %sil,(%rax)
+  800e31:	75 f2                	jne    800e25 <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800e33:	c3                   	ret
+
+0000000000800e34 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e34:	48 89 f9             	mov    %rdi,%rcx
+  800e37:	49 89 f0             	mov    %rsi,%r8
+  800e3a:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e3c:	eb 04                	jmp    800e42 <strtol+0xe>
+		s++;
+  800e3e:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800e42:	0f b6 01             	movzbl (%rcx),%eax
+  800e45:	3c 20                	cmp    $0x20,%al
+  800e47:	74 f5                	je     800e3e <strtol+0xa>
+  800e49:	3c 09                	cmp    $0x9,%al
+  800e4b:	74 f1                	je     800e3e <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e4d:	3c 2b                	cmp    $0x2b,%al
+  800e4f:	74 2b                	je     800e7c <strtol+0x48>
+	int neg = 0;
+  800e51:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800e57:	3c 2d                	cmp    $0x2d,%al
+  800e59:	74 2d                	je     800e88 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e5b:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800e61:	75 0f                	jne    800e72 <strtol+0x3e>
+  800e63:	80 39 30             	cmpb   $0x30,(%rcx)
+  800e66:	74 2c                	je     800e94 <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e68:	85 ff                	test   %edi,%edi
+  800e6a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e6f:	0f 44 f8             	cmove  %eax,%edi
+  800e72:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800e77:	4c 63 d7             	movslq %edi,%r10
+  800e7a:	eb 4f                	jmp    800ecb <strtol+0x97>
+		s++;
+  800e7c:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800e80:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800e86:	eb d3                	jmp    800e5b <strtol+0x27>
+		s++, neg = 1;
+  800e88:	48 83 c1 01          	add    $0x1,%rcx
+  800e8c:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800e92:	eb c7                	jmp    800e5b <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e94:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800e98:	74 0f                	je     800ea9 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800e9a:	85 ff                	test   %edi,%edi
+  800e9c:	75 d4                	jne    800e72 <strtol+0x3e>
+		s++, base = 8;
+  800e9e:	48 83 c1 01          	add    $0x1,%rcx
+  800ea2:	bf 08 00 00 00       	mov    $0x8,%edi
+  800ea7:	eb c9                	jmp    800e72 <strtol+0x3e>
+		s += 2, base = 16;
+  800ea9:	48 83 c1 02          	add    $0x2,%rcx
+  800ead:	bf 10 00 00 00       	mov    $0x10,%edi
+  800eb2:	eb be                	jmp    800e72 <strtol+0x3e>
+			dig = *s - '0';
+  800eb4:	0f be c0             	movsbl %al,%eax
+  800eb7:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800eba:	39 f8                	cmp    %edi,%eax
+  800ebc:	7d 3b                	jge    800ef9 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800ebe:	48 83 c1 01          	add    $0x1,%rcx
+  800ec2:	49 0f af d2          	imul   %r10,%rdx
+  800ec6:	48 98                	cltq
+  800ec8:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800ecb:	0f b6 01             	movzbl (%rcx),%eax
+  800ece:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800ed1:	40 80 fe 09          	cmp    $0x9,%sil
+  800ed5:	76 dd                	jbe    800eb4 <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800ed7:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800eda:	40 80 fe 19          	cmp    $0x19,%sil
+  800ede:	77 08                	ja     800ee8 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800ee0:	0f be c0             	movsbl %al,%eax
+  800ee3:	83 e8 57             	sub    $0x57,%eax
+  800ee6:	eb d2                	jmp    800eba <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ee8:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800eeb:	40 80 fe 19          	cmp    $0x19,%sil
+  800eef:	77 08                	ja     800ef9 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800ef1:	0f be c0             	movsbl %al,%eax
+  800ef4:	83 e8 37             	sub    $0x37,%eax
+  800ef7:	eb c1                	jmp    800eba <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ef9:	4d 85 c0             	test   %r8,%r8
+  800efc:	74 03                	je     800f01 <strtol+0xcd>
+		*endptr = (char *) s;
+  800efe:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800f01:	48 89 d0             	mov    %rdx,%rax
+  800f04:	48 f7 d8             	neg    %rax
+  800f07:	45 85 c9             	test   %r9d,%r9d
+  800f0a:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800f0e:	48 89 d0             	mov    %rdx,%rax
+  800f11:	c3                   	ret
+
+0000000000800f12 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800f12:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f18:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800f1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f28:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800f2a:	c3                   	ret
+
+0000000000800f2b <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800f2b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f37:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f3c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f41:	48 89 fe             	mov    %rdi,%rsi
+  800f44:	48 89 fa             	mov    %rdi,%rdx
+  800f47:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f49:	c3                   	ret
+
+0000000000800f4a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800f4a:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800f4d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f53:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f59:	be 00 00 00 00       	mov    $0x0,%esi
+  800f5e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f63:	48 89 f2             	mov    %rsi,%rdx
+  800f66:	0f 05                	syscall
+	if(check && ret > 0)
+  800f68:	48 85 c0             	test   %rax,%rax
+  800f6b:	7f 01                	jg     800f6e <sys_env_destroy+0x24>
+}
+  800f6d:	c3                   	ret
+{
+  800f6e:	55                   	push   %rbp
+  800f6f:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f72:	49 89 c0             	mov    %rax,%r8
+  800f75:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800f7a:	48 ba 88 18 80 00 00 	movabs $0x801888,%rdx
+  800f81:	00 00 00 
+  800f84:	be 28 00 00 00       	mov    $0x28,%esi
+  800f89:	48 bf a5 18 80 00 00 	movabs $0x8018a5,%rdi
+  800f90:	00 00 00 
+  800f93:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f98:	49 b9 ce 01 80 00 00 	movabs $0x8001ce,%r9
+  800f9f:	00 00 00 
+  800fa2:	41 ff d1             	call   *%r9
+
+0000000000800fa5 <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800fa5:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800fac:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800fad:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800fb2:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800fb6:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800fba:	48 c1 e2 04          	shl    $0x4,%rdx
+  800fbe:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800fc5:	00 00 00 
+  800fc8:	48 01 d0             	add    %rdx,%rax
+  800fcb:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800fd1:	c3                   	ret
+
+0000000000800fd2 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800fd2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fd8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fde:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fe3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fe8:	48 89 fe             	mov    %rdi,%rsi
+  800feb:	48 89 fa             	mov    %rdi,%rdx
+  800fee:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ff0:	c3                   	ret
+
+0000000000800ff1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  800ff1:	48 63 d2             	movslq %edx,%rdx
+  800ff4:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800ff7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800ffd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801003:	b8 04 00 00 00       	mov    $0x4,%eax
+  801008:	0f 05                	syscall
+	if(check && ret > 0)
+  80100a:	48 85 c0             	test   %rax,%rax
+  80100d:	7f 01                	jg     801010 <sys_page_alloc+0x1f>
+}
+  80100f:	c3                   	ret
+{
+  801010:	55                   	push   %rbp
+  801011:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801014:	49 89 c0             	mov    %rax,%r8
+  801017:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80101c:	48 ba 88 18 80 00 00 	movabs $0x801888,%rdx
+  801023:	00 00 00 
+  801026:	be 28 00 00 00       	mov    $0x28,%esi
+  80102b:	48 bf a5 18 80 00 00 	movabs $0x8018a5,%rdi
+  801032:	00 00 00 
+  801035:	b8 00 00 00 00       	mov    $0x0,%eax
+  80103a:	49 b9 ce 01 80 00 00 	movabs $0x8001ce,%r9
+  801041:	00 00 00 
+  801044:	41 ff d1             	call   *%r9
+
+0000000000801047 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  801047:	48 63 d2             	movslq %edx,%rdx
+  80104a:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80104d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801053:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801059:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80105e:	0f 05                	syscall
+	if(check && ret > 0)
+  801060:	48 85 c0             	test   %rax,%rax
+  801063:	7f 01                	jg     801066 <sys_page_alloc_huge+0x1f>
+}
+  801065:	c3                   	ret
+{
+  801066:	55                   	push   %rbp
+  801067:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106a:	49 89 c0             	mov    %rax,%r8
+  80106d:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801072:	48 ba 88 18 80 00 00 	movabs $0x801888,%rdx
+  801079:	00 00 00 
+  80107c:	be 28 00 00 00       	mov    $0x28,%esi
+  801081:	48 bf a5 18 80 00 00 	movabs $0x8018a5,%rdi
+  801088:	00 00 00 
+  80108b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801090:	49 b9 ce 01 80 00 00 	movabs $0x8001ce,%r9
+  801097:	00 00 00 
+  80109a:	41 ff d1             	call   *%r9
+
+000000000080109d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80109d:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  8010a0:	48 63 d2             	movslq %edx,%rdx
+  8010a3:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  8010a6:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  8010a9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010ae:	0f 05                	syscall
+	if(check && ret > 0)
+  8010b0:	48 85 c0             	test   %rax,%rax
+  8010b3:	7f 01                	jg     8010b6 <sys_page_map+0x19>
+}
+  8010b5:	c3                   	ret
+{
+  8010b6:	55                   	push   %rbp
+  8010b7:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ba:	49 89 c0             	mov    %rax,%r8
+  8010bd:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8010c2:	48 ba 88 18 80 00 00 	movabs $0x801888,%rdx
+  8010c9:	00 00 00 
+  8010cc:	be 28 00 00 00       	mov    $0x28,%esi
+  8010d1:	48 bf a5 18 80 00 00 	movabs $0x8018a5,%rdi
+  8010d8:	00 00 00 
+  8010db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e0:	49 b9 ce 01 80 00 00 	movabs $0x8001ce,%r9
+  8010e7:	00 00 00 
+  8010ea:	41 ff d1             	call   *%r9
+
+00000000008010ed <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8010ed:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8010f0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801101:	b8 06 00 00 00       	mov    $0x6,%eax
+  801106:	0f 05                	syscall
+	if(check && ret > 0)
+  801108:	48 85 c0             	test   %rax,%rax
+  80110b:	7f 01                	jg     80110e <sys_page_unmap+0x21>
+}
+  80110d:	c3                   	ret
+{
+  80110e:	55                   	push   %rbp
+  80110f:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801112:	49 89 c0             	mov    %rax,%r8
+  801115:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80111a:	48 ba 88 18 80 00 00 	movabs $0x801888,%rdx
+  801121:	00 00 00 
+  801124:	be 28 00 00 00       	mov    $0x28,%esi
+  801129:	48 bf a5 18 80 00 00 	movabs $0x8018a5,%rdi
+  801130:	00 00 00 
+  801133:	b8 00 00 00 00       	mov    $0x0,%eax
+  801138:	49 b9 ce 01 80 00 00 	movabs $0x8001ce,%r9
+  80113f:	00 00 00 
+  801142:	41 ff d1             	call   *%r9
+
+0000000000801145 <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  801145:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80114b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801151:	bf 00 00 00 00       	mov    $0x0,%edi
+  801156:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80115b:	48 89 fe             	mov    %rdi,%rsi
+  80115e:	48 89 fa             	mov    %rdi,%rdx
+  801161:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801163:	c3                   	ret
+
+0000000000801164 <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  801164:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80116a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801170:	ba 00 00 00 00       	mov    $0x0,%edx
+  801175:	b8 10 00 00 00       	mov    $0x10,%eax
+  80117a:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  80117c:	c3                   	ret
+
+000000000080117d <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  80117d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801183:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801189:	b8 11 00 00 00       	mov    $0x11,%eax
+  80118e:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  801190:	c3                   	ret
+
+0000000000801191 <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  801191:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  801194:	48 63 f6             	movslq %esi,%rsi
+  801197:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  80119a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011a0:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011a5:	0f 05                	syscall
+	if(check && ret > 0)
+  8011a7:	48 85 c0             	test   %rax,%rax
+  8011aa:	7f 01                	jg     8011ad <sys_page_batch+0x1c>
+}
+  8011ac:	c3                   	ret
+{
+  8011ad:	55                   	push   %rbp
+  8011ae:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b1:	49 89 c0             	mov    %rax,%r8
+  8011b4:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8011b9:	48 ba 88 18 80 00 00 	movabs $0x801888,%rdx
+  8011c0:	00 00 00 
+  8011c3:	be 28 00 00 00       	mov    $0x28,%esi
+  8011c8:	48 bf a5 18 80 00 00 	movabs $0x8018a5,%rdi
+  8011cf:	00 00 00 
+  8011d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d7:	49 b9 ce 01 80 00 00 	movabs $0x8001ce,%r9
+  8011de:	00 00 00 
+  8011e1:	41 ff d1             	call   *%r9
+
+00000000008011e4 <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  8011e4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f5:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011fa:	48 89 f2             	mov    %rsi,%rdx
+  8011fd:	0f 05                	syscall
+	if(check && ret > 0)
+  8011ff:	48 85 c0             	test   %rax,%rax
+  801202:	7f 01                	jg     801205 <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  801204:	c3                   	ret
+{
+  801205:	55                   	push   %rbp
+  801206:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801209:	49 89 c0             	mov    %rax,%r8
+  80120c:	b9 13 00 00 00       	mov    $0x13,%ecx
+  801211:	48 ba 88 18 80 00 00 	movabs $0x801888,%rdx
+  801218:	00 00 00 
+  80121b:	be 28 00 00 00       	mov    $0x28,%esi
+  801220:	48 bf a5 18 80 00 00 	movabs $0x8018a5,%rdi
+  801227:	00 00 00 
+  80122a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122f:	49 b9 ce 01 80 00 00 	movabs $0x8001ce,%r9
+  801236:	00 00 00 
+  801239:	41 ff d1             	call   *%r9
+
+000000000080123c <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  80123c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801242:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801248:	bf 00 00 00 00       	mov    $0x0,%edi
+  80124d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801252:	48 89 fe             	mov    %rdi,%rsi
+  801255:	48 89 fa             	mov    %rdi,%rdx
+  801258:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  80125a:	c3                   	ret
+
+000000000080125b <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  80125b:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80125e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801264:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80126a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80126f:	0f 05                	syscall
+	if(check && ret > 0)
+  801271:	48 85 c0             	test   %rax,%rax
+  801274:	7f 01                	jg     801277 <sys_page_unmap_range+0x1c>
+}
+  801276:	c3                   	ret
+{
+  801277:	55                   	push   %rbp
+  801278:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80127b:	49 89 c0             	mov    %rax,%r8
+  80127e:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801283:	48 ba 88 18 80 00 00 	movabs $0x801888,%rdx
+  80128a:	00 00 00 
+  80128d:	be 28 00 00 00       	mov    $0x28,%esi
+  801292:	48 bf a5 18 80 00 00 	movabs $0x8018a5,%rdi
+  801299:	00 00 00 
+  80129c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a1:	49 b9 ce 01 80 00 00 	movabs $0x8001ce,%r9
+  8012a8:	00 00 00 
+  8012ab:	41 ff d1             	call   *%r9
+
+00000000008012ae <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8012ae:	48 63 f6             	movslq %esi,%rsi
+  8012b1:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8012b4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8012ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8012c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8012ca:	0f 05                	syscall
+	if(check && ret > 0)
+  8012cc:	48 85 c0             	test   %rax,%rax
+  8012cf:	7f 01                	jg     8012d2 <sys_env_set_status+0x24>
+}
+  8012d1:	c3                   	ret
+{
+  8012d2:	55                   	push   %rbp
+  8012d3:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012d6:	49 89 c0             	mov    %rax,%r8
+  8012d9:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8012de:	48 ba 88 18 80 00 00 	movabs $0x801888,%rdx
+  8012e5:	00 00 00 
+  8012e8:	be 28 00 00 00       	mov    $0x28,%esi
+  8012ed:	48 bf a5 18 80 00 00 	movabs $0x8018a5,%rdi
+  8012f4:	00 00 00 
+  8012f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012fc:	49 b9 ce 01 80 00 00 	movabs $0x8001ce,%r9
+  801303:	00 00 00 
+  801306:	41 ff d1             	call   *%r9
+
+0000000000801309 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  801309:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80130c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801312:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801318:	ba 00 00 00 00       	mov    $0x0,%edx
+  80131d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801322:	0f 05                	syscall
+	if(check && ret > 0)
+  801324:	48 85 c0             	test   %rax,%rax
+  801327:	7f 01                	jg     80132a <sys_env_set_pgfault_upcall+0x21>
+}
+  801329:	c3                   	ret
+{
+  80132a:	55                   	push   %rbp
+  80132b:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80132e:	49 89 c0             	mov    %rax,%r8
+  801331:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801336:	48 ba 88 18 80 00 00 	movabs $0x801888,%rdx
+  80133d:	00 00 00 
+  801340:	be 28 00 00 00       	mov    $0x28,%esi
+  801345:	48 bf a5 18 80 00 00 	movabs $0x8018a5,%rdi
+  80134c:	00 00 00 
+  80134f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801354:	49 b9 ce 01 80 00 00 	movabs $0x8001ce,%r9
+  80135b:	00 00 00 
+  80135e:	41 ff d1             	call   *%r9
+
+0000000000801361 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  801361:	48 63 ff             	movslq %edi,%rdi
+  801364:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  801367:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80136d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801372:	0f 05                	syscall
+}
+  801374:	c3                   	ret
+
+0000000000801375 <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  801375:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80137b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801381:	be 00 00 00 00       	mov    $0x0,%esi
+  801386:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80138b:	48 89 f2             	mov    %rsi,%rdx
+  80138e:	0f 05                	syscall
+	if(check && ret > 0)
+  801390:	48 85 c0             	test   %rax,%rax
+  801393:	7f 01                	jg     801396 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  801395:	c3                   	ret
+{
+  801396:	55                   	push   %rbp
+  801397:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80139a:	49 89 c0             	mov    %rax,%r8
+  80139d:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8013a2:	48 ba 88 18 80 00 00 	movabs $0x801888,%rdx
+  8013a9:	00 00 00 
+  8013ac:	be 28 00 00 00       	mov    $0x28,%esi
+  8013b1:	48 bf a5 18 80 00 00 	movabs $0x8018a5,%rdi
+  8013b8:	00 00 00 
+  8013bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c0:	49 b9 ce 01 80 00 00 	movabs $0x8001ce,%r9
+  8013c7:	00 00 00 
+  8013ca:	41 ff d1             	call   *%r9
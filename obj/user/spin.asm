@@ -0,0 +1,3159 @@
+
+obj/user/spin:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c2 00 00 00       	call   8000f3 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	41 55                	push   %r13
+  800039:	41 54                	push   %r12
+  80003b:	53                   	push   %rbx
+  80003c:	48 83 ec 08          	sub    $0x8,%rsp
+	envid_t env;
+
+	cprintf("I am the parent.  Forking the child...\n");
+  800040:	48 bf 40 1c 80 00 00 	movabs $0x801c40,%rdi
+  800047:	00 00 00 
+  80004a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004f:	48 ba e6 01 80 00 00 	movabs $0x8001e6,%rdx
+  800056:	00 00 00 
+  800059:	ff d2                	call   *%rdx
+	if ((env = fork()) == 0) {
+  80005b:	48 b8 f0 14 80 00 00 	movabs $0x8014f0,%rax
+  800062:	00 00 00 
+  800065:	ff d0                	call   *%rax
+  800067:	85 c0                	test   %eax,%eax
+  800069:	75 1d                	jne    800088 <umain+0x55>
+		cprintf("I am the child.  Spinning...\n");
+  80006b:	48 bf b8 1c 80 00 00 	movabs $0x801cb8,%rdi
+  800072:	00 00 00 
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007a:	48 ba e6 01 80 00 00 	movabs $0x8001e6,%rdx
+  800081:	00 00 00 
+  800084:	ff d2                	call   *%rdx
+		while (1)
+  800086:	eb fe                	jmp    800086 <umain+0x53>
+  800088:	89 c3                	mov    %eax,%ebx
+			/* do nothing */;
+	}
+
+	cprintf("I am the parent.  Running the child...\n");
+  80008a:	48 bf 68 1c 80 00 00 	movabs $0x801c68,%rdi
+  800091:	00 00 00 
+  800094:	b8 00 00 00 00       	mov    $0x0,%eax
+  800099:	49 bd e6 01 80 00 00 	movabs $0x8001e6,%r13
+  8000a0:	00 00 00 
+  8000a3:	41 ff d5             	call   *%r13
+	sys_yield();
+  8000a6:	49 bc 4b 0e 80 00 00 	movabs $0x800e4b,%r12
+  8000ad:	00 00 00 
+  8000b0:	41 ff d4             	call   *%r12
+	sys_yield();
+  8000b3:	41 ff d4             	call   *%r12
+	sys_yield();
+  8000b6:	41 ff d4             	call   *%r12
+	sys_yield();
+  8000b9:	41 ff d4             	call   *%r12
+	sys_yield();
+  8000bc:	41 ff d4             	call   *%r12
+	sys_yield();
+  8000bf:	41 ff d4             	call   *%r12
+	sys_yield();
+  8000c2:	41 ff d4             	call   *%r12
+	sys_yield();
+  8000c5:	41 ff d4             	call   *%r12
+
+	cprintf("I am the parent.  Killing the child...\n");
+  8000c8:	48 bf 90 1c 80 00 00 	movabs $0x801c90,%rdi
+  8000cf:	00 00 00 
+  8000d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d7:	41 ff d5             	call   *%r13
+	sys_env_destroy(env);
+  8000da:	89 df                	mov    %ebx,%edi
+  8000dc:	48 b8 c3 0d 80 00 00 	movabs $0x800dc3,%rax
+  8000e3:	00 00 00 
+  8000e6:	ff d0                	call   *%rax
+}
+  8000e8:	48 83 c4 08          	add    $0x8,%rsp
+  8000ec:	5b                   	pop    %rbx
+  8000ed:	41 5c                	pop    %r12
+  8000ef:	41 5d                	pop    %r13
+  8000f1:	5d                   	pop    %rbp
+  8000f2:	c3                   	ret
+
+00000000008000f3 <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  8000f3:	55                   	push   %rbp
+  8000f4:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000f7:	85 ff                	test   %edi,%edi
+  8000f9:	7e 0d                	jle    800108 <libmain+0x15>
+		binaryname = argv[0];
+  8000fb:	48 8b 06             	mov    (%rsi),%rax
+  8000fe:	48 a3 00 30 80 00 00 	movabs %rax,0x803000
+  800105:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  800108:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  80010f:	00 00 00 
+  800112:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800114:	48 b8 22 01 80 00 00 	movabs $0x800122,%rax
+  80011b:	00 00 00 
+  80011e:	ff d0                	call   *%rax
+}
+  800120:	5d                   	pop    %rbp
+  800121:	c3                   	ret
+
+0000000000800122 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800122:	55                   	push   %rbp
+  800123:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  800126:	bf 00 00 00 00       	mov    $0x0,%edi
+  80012b:	48 b8 c3 0d 80 00 00 	movabs $0x800dc3,%rax
+  800132:	00 00 00 
+  800135:	ff d0                	call   *%rax
+}
+  800137:	5d                   	pop    %rbp
+  800138:	c3                   	ret
+
+0000000000800139 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800139:	55                   	push   %rbp
+  80013a:	48 89 e5             	mov    %rsp,%rbp
+  80013d:	53                   	push   %rbx
+  80013e:	48 83 ec 08          	sub    $0x8,%rsp
+  800142:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  800145:	8b 06                	mov    (%rsi),%eax
+  800147:	8d 50 01             	lea    0x1(%rax),%edx
+  80014a:	89 16                	mov    %edx,(%rsi)
+  80014c:	48 98                	cltq
+  80014e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  800153:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800159:	74 0a                	je     800165 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80015b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80015f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800163:	c9                   	leave
+  800164:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800165:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800169:	be ff 00 00 00       	mov    $0xff,%esi
+  80016e:	48 b8 8b 0d 80 00 00 	movabs $0x800d8b,%rax
+  800175:	00 00 00 
+  800178:	ff d0                	call   *%rax
+		b->idx = 0;
+  80017a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800180:	eb d9                	jmp    80015b <putch+0x22>
+
+0000000000800182 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800182:	55                   	push   %rbp
+  800183:	48 89 e5             	mov    %rsp,%rbp
+  800186:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80018d:	48 89 fa             	mov    %rdi,%rdx
+  800190:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  800193:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  80019a:	00 00 00 
+	b.cnt = 0;
+  80019d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8001a4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001a7:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  8001ae:	48 bf 39 01 80 00 00 	movabs $0x800139,%rdi
+  8001b5:	00 00 00 
+  8001b8:	48 b8 a0 03 80 00 00 	movabs $0x8003a0,%rax
+  8001bf:	00 00 00 
+  8001c2:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  8001c4:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  8001cb:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8001d2:	48 b8 8b 0d 80 00 00 	movabs $0x800d8b,%rax
+  8001d9:	00 00 00 
+  8001dc:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  8001de:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  8001e4:	c9                   	leave
+  8001e5:	c3                   	ret
+
+00000000008001e6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001e6:	55                   	push   %rbp
+  8001e7:	48 89 e5             	mov    %rsp,%rbp
+  8001ea:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8001f1:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8001f8:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8001ff:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800206:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80020d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800214:	84 c0                	test   %al,%al
+  800216:	74 20                	je     800238 <cprintf+0x52>
+  800218:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80021c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800220:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800224:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800228:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80022c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800230:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800234:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800238:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  80023f:	00 00 00 
+  800242:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800249:	00 00 00 
+  80024c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800250:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800257:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80025e:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  800265:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  80026c:	48 b8 82 01 80 00 00 	movabs $0x800182,%rax
+  800273:	00 00 00 
+  800276:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  800278:	c9                   	leave
+  800279:	c3                   	ret
+
+000000000080027a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80027a:	55                   	push   %rbp
+  80027b:	48 89 e5             	mov    %rsp,%rbp
+  80027e:	41 57                	push   %r15
+  800280:	41 56                	push   %r14
+  800282:	41 55                	push   %r13
+  800284:	41 54                	push   %r12
+  800286:	53                   	push   %rbx
+  800287:	48 83 ec 18          	sub    $0x18,%rsp
+  80028b:	49 89 fc             	mov    %rdi,%r12
+  80028e:	49 89 f5             	mov    %rsi,%r13
+  800291:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800295:	44 89 c3             	mov    %r8d,%ebx
+  800298:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80029b:	41 89 cf             	mov    %ecx,%r15d
+  80029e:	4c 39 fa             	cmp    %r15,%rdx
+  8002a1:	72 29                	jb     8002cc <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002a3:	48 89 d0             	mov    %rdx,%rax
+  8002a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002ab:	49 f7 f7             	div    %r15
+  8002ae:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002b2:	48 89 c2             	mov    %rax,%rdx
+  8002b5:	48 b8 7a 02 80 00 00 	movabs $0x80027a,%rax
+  8002bc:	00 00 00 
+  8002bf:	ff d0                	call   *%rax
+  8002c1:	eb 10                	jmp    8002d3 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002c3:	4c 89 ee             	mov    %r13,%rsi
+  8002c6:	44 89 f7             	mov    %r14d,%edi
+  8002c9:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  8002cc:	83 eb 01             	sub    $0x1,%ebx
+  8002cf:	85 db                	test   %ebx,%ebx
+  8002d1:	7f f0                	jg     8002c3 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002d3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002dc:	49 f7 f7             	div    %r15
+  8002df:	48 b8 e0 1c 80 00 00 	movabs $0x801ce0,%rax
+  8002e6:	00 00 00 
+  8002e9:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  8002ed:	4c 89 ee             	mov    %r13,%rsi
+  8002f0:	41 ff d4             	call   *%r12
+}
+  8002f3:	48 83 c4 18          	add    $0x18,%rsp
+  8002f7:	5b                   	pop    %rbx
+  8002f8:	41 5c                	pop    %r12
+  8002fa:	41 5d                	pop    %r13
+  8002fc:	41 5e                	pop    %r14
+  8002fe:	41 5f                	pop    %r15
+  800300:	5d                   	pop    %rbp
+  800301:	c3                   	ret
+
+0000000000800302 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  800302:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  800306:	48 8b 06             	mov    (%rsi),%rax
+  800309:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80030d:	73 0a                	jae    800319 <sprintputch+0x17>
+		*b->buf++ = ch;
+  80030f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800313:	48 89 16             	mov    %rdx,(%rsi)
+  800316:	40 88 38             	mov    %dil,(%rax)
+}
+  800319:	c3                   	ret
+
+000000000080031a <printfmt>:
+{
+  80031a:	55                   	push   %rbp
+  80031b:	48 89 e5             	mov    %rsp,%rbp
+  80031e:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800325:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80032c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800333:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80033a:	84 c0                	test   %al,%al
+  80033c:	74 20                	je     80035e <printfmt+0x44>
+  80033e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800342:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800346:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80034a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80034e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800352:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800356:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80035a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  80035e:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800365:	00 00 00 
+  800368:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80036f:	00 00 00 
+  800372:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800376:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80037d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800384:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80038b:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800392:	48 b8 a0 03 80 00 00 	movabs $0x8003a0,%rax
+  800399:	00 00 00 
+  80039c:	ff d0                	call   *%rax
+}
+  80039e:	c9                   	leave
+  80039f:	c3                   	ret
+
+00000000008003a0 <vprintfmt>:
+{
+  8003a0:	55                   	push   %rbp
+  8003a1:	48 89 e5             	mov    %rsp,%rbp
+  8003a4:	41 57                	push   %r15
+  8003a6:	41 56                	push   %r14
+  8003a8:	41 55                	push   %r13
+  8003aa:	41 54                	push   %r12
+  8003ac:	53                   	push   %rbx
+  8003ad:	48 83 ec 48          	sub    $0x48,%rsp
+  8003b1:	49 89 fe             	mov    %rdi,%r14
+  8003b4:	49 89 f5             	mov    %rsi,%r13
+  8003b7:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  8003ba:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  8003be:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  8003c2:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8003ca:	eb 09                	jmp    8003d5 <vprintfmt+0x35>
+			putch(ch, putdat);
+  8003cc:	4c 89 ee             	mov    %r13,%rsi
+  8003cf:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003d2:	4c 89 e3             	mov    %r12,%rbx
+  8003d5:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003d9:	0f b6 3b             	movzbl (%rbx),%edi
+  8003dc:	83 ff 25             	cmp    $0x25,%edi
+  8003df:	74 13                	je     8003f4 <vprintfmt+0x54>
+			if (ch == '\0')
+  8003e1:	85 ff                	test   %edi,%edi
+  8003e3:	75 e7                	jne    8003cc <vprintfmt+0x2c>
+}
+  8003e5:	48 83 c4 48          	add    $0x48,%rsp
+  8003e9:	5b                   	pop    %rbx
+  8003ea:	41 5c                	pop    %r12
+  8003ec:	41 5d                	pop    %r13
+  8003ee:	41 5e                	pop    %r14
+  8003f0:	41 5f                	pop    %r15
+  8003f2:	5d                   	pop    %rbp
+  8003f3:	c3                   	ret
+		padc = ' ';
+  8003f4:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  8003f8:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  8003ff:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  800405:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  80040c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800411:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800416:	41 0f b6 14 24       	movzbl (%r12),%edx
+  80041b:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  80041e:	3c 55                	cmp    $0x55,%al
+  800420:	0f 87 4f 05 00 00    	ja     800975 <vprintfmt+0x5d5>
+  800426:	0f b6 c0             	movzbl %al,%eax
+  800429:	48 be a0 1d 80 00 00 	movabs $0x801da0,%rsi
+  800430:	00 00 00 
+  800433:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  800436:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  800439:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  80043d:	eb d2                	jmp    800411 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  80043f:	49 89 dc             	mov    %rbx,%r12
+  800442:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  800446:	eb c9                	jmp    800411 <vprintfmt+0x71>
+  800448:	0f b6 d2             	movzbl %dl,%edx
+  80044b:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  80044e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  800454:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  800458:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  80045d:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  800462:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  800465:	83 f8 09             	cmp    $0x9,%eax
+  800468:	77 20                	ja     80048a <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  80046a:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  80046e:	eb e4                	jmp    800454 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  800470:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800473:	83 f8 2f             	cmp    $0x2f,%eax
+  800476:	77 27                	ja     80049f <vprintfmt+0xff>
+  800478:	89 c2                	mov    %eax,%edx
+  80047a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80047e:	83 c0 08             	add    $0x8,%eax
+  800481:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800484:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  800487:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  80048a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80048e:	79 81                	jns    800411 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  800490:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  800494:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80049a:	e9 72 ff ff ff       	jmp    800411 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  80049f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004ab:	eb d7                	jmp    800484 <vprintfmt+0xe4>
+			if (width < 0)
+  8004ad:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  8004b0:	85 f6                	test   %esi,%esi
+  8004b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b7:	0f 49 c6             	cmovns %esi,%eax
+  8004ba:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004bd:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8004c0:	e9 4c ff ff ff       	jmp    800411 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004c5:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  8004c8:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  8004cf:	e9 3d ff ff ff       	jmp    800411 <vprintfmt+0x71>
+			lflag++;
+  8004d4:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004d7:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  8004da:	e9 32 ff ff ff       	jmp    800411 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  8004df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8004e5:	77 19                	ja     800500 <vprintfmt+0x160>
+  8004e7:	89 c2                	mov    %eax,%edx
+  8004e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004ed:	83 c0 08             	add    $0x8,%eax
+  8004f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004f3:	8b 3a                	mov    (%rdx),%edi
+  8004f5:	4c 89 ee             	mov    %r13,%rsi
+  8004f8:	41 ff d6             	call   *%r14
+			break;
+  8004fb:	e9 d5 fe ff ff       	jmp    8003d5 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  800500:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800504:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800508:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80050c:	eb e5                	jmp    8004f3 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  80050e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800511:	83 f8 2f             	cmp    $0x2f,%eax
+  800514:	77 5a                	ja     800570 <vprintfmt+0x1d0>
+  800516:	89 c2                	mov    %eax,%edx
+  800518:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80051c:	83 c0 08             	add    $0x8,%eax
+  80051f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800522:	8b 02                	mov    (%rdx),%eax
+  800524:	89 c1                	mov    %eax,%ecx
+  800526:	f7 d9                	neg    %ecx
+  800528:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80052b:	83 f9 08             	cmp    $0x8,%ecx
+  80052e:	7f 4e                	jg     80057e <vprintfmt+0x1de>
+  800530:	48 63 c1             	movslq %ecx,%rax
+  800533:	48 ba 60 20 80 00 00 	movabs $0x802060,%rdx
+  80053a:	00 00 00 
+  80053d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800541:	48 85 c0             	test   %rax,%rax
+  800544:	74 38                	je     80057e <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  800546:	48 89 c1             	mov    %rax,%rcx
+  800549:	48 ba 01 1d 80 00 00 	movabs $0x801d01,%rdx
+  800550:	00 00 00 
+  800553:	4c 89 ee             	mov    %r13,%rsi
+  800556:	4c 89 f7             	mov    %r14,%rdi
+  800559:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055e:	49 b8 1a 03 80 00 00 	movabs $0x80031a,%r8
+  800565:	00 00 00 
+  800568:	41 ff d0             	call   *%r8
+  80056b:	e9 65 fe ff ff       	jmp    8003d5 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  800570:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800574:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800578:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80057c:	eb a4                	jmp    800522 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  80057e:	48 ba f8 1c 80 00 00 	movabs $0x801cf8,%rdx
+  800585:	00 00 00 
+  800588:	4c 89 ee             	mov    %r13,%rsi
+  80058b:	4c 89 f7             	mov    %r14,%rdi
+  80058e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800593:	49 b8 1a 03 80 00 00 	movabs $0x80031a,%r8
+  80059a:	00 00 00 
+  80059d:	41 ff d0             	call   *%r8
+  8005a0:	e9 30 fe ff ff       	jmp    8003d5 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  8005a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ab:	77 36                	ja     8005e3 <vprintfmt+0x243>
+  8005ad:	89 c2                	mov    %eax,%edx
+  8005af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005b3:	83 c0 08             	add    $0x8,%eax
+  8005b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005b9:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  8005bc:	48 85 c9             	test   %rcx,%rcx
+  8005bf:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  8005c6:	00 00 00 
+  8005c9:	48 0f 45 c1          	cmovne %rcx,%rax
+  8005cd:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  8005d1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005d5:	7e 06                	jle    8005dd <vprintfmt+0x23d>
+  8005d7:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  8005db:	75 14                	jne    8005f1 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005dd:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8005e1:	eb 64                	jmp    800647 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  8005e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005ef:	eb c8                	jmp    8005b9 <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005f1:	49 63 f7             	movslq %r15d,%rsi
+  8005f4:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  8005f8:	48 b8 83 0a 80 00 00 	movabs $0x800a83,%rax
+  8005ff:	00 00 00 
+  800602:	ff d0                	call   *%rax
+  800604:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800607:	29 c1                	sub    %eax,%ecx
+  800609:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  80060c:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  80060f:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800613:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800616:	eb 0d                	jmp    800625 <vprintfmt+0x285>
+					putch(padc, putdat);
+  800618:	4c 89 ee             	mov    %r13,%rsi
+  80061b:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  80061e:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800621:	41 83 ec 01          	sub    $0x1,%r12d
+  800625:	45 85 e4             	test   %r12d,%r12d
+  800628:	7f ee                	jg     800618 <vprintfmt+0x278>
+  80062a:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  80062d:	85 c9                	test   %ecx,%ecx
+  80062f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800634:	0f 49 c1             	cmovns %ecx,%eax
+  800637:	29 c1                	sub    %eax,%ecx
+  800639:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  80063c:	eb 9f                	jmp    8005dd <vprintfmt+0x23d>
+					putch(ch, putdat);
+  80063e:	4c 89 ee             	mov    %r13,%rsi
+  800641:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800644:	4c 89 e2             	mov    %r12,%rdx
+  800647:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  80064b:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800651:	0f be f8             	movsbl %al,%edi
+  800654:	85 ff                	test   %edi,%edi
+  800656:	74 29                	je     800681 <vprintfmt+0x2e1>
+  800658:	45 85 ff             	test   %r15d,%r15d
+  80065b:	78 06                	js     800663 <vprintfmt+0x2c3>
+  80065d:	41 83 ef 01          	sub    $0x1,%r15d
+  800661:	78 1e                	js     800681 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800663:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800667:	74 d5                	je     80063e <vprintfmt+0x29e>
+  800669:	0f be c0             	movsbl %al,%eax
+  80066c:	83 e8 20             	sub    $0x20,%eax
+  80066f:	83 f8 5e             	cmp    $0x5e,%eax
+  800672:	76 ca                	jbe    80063e <vprintfmt+0x29e>
+					putch('?', putdat);
+  800674:	4c 89 ee             	mov    %r13,%rsi
+  800677:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80067c:	41 ff d6             	call   *%r14
+  80067f:	eb c3                	jmp    800644 <vprintfmt+0x2a4>
+  800681:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800685:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800688:	41 01 c4             	add    %eax,%r12d
+  80068b:	41 29 d4             	sub    %edx,%r12d
+  80068e:	eb 0f                	jmp    80069f <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  800690:	4c 89 ee             	mov    %r13,%rsi
+  800693:	bf 20 00 00 00       	mov    $0x20,%edi
+  800698:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  80069b:	41 83 ec 01          	sub    $0x1,%r12d
+  80069f:	45 85 e4             	test   %r12d,%r12d
+  8006a2:	7f ec                	jg     800690 <vprintfmt+0x2f0>
+  8006a4:	e9 2c fd ff ff       	jmp    8003d5 <vprintfmt+0x35>
+	if (lflag >= 2)
+  8006a9:	83 f9 01             	cmp    $0x1,%ecx
+  8006ac:	7f 1d                	jg     8006cb <vprintfmt+0x32b>
+	else if (lflag)
+  8006ae:	85 c9                	test   %ecx,%ecx
+  8006b0:	74 5e                	je     800710 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  8006b2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006b5:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b8:	77 48                	ja     800702 <vprintfmt+0x362>
+  8006ba:	89 c2                	mov    %eax,%edx
+  8006bc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c0:	83 c0 08             	add    $0x8,%eax
+  8006c3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c6:	4c 8b 22             	mov    (%rdx),%r12
+  8006c9:	eb 17                	jmp    8006e2 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  8006cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d1:	77 21                	ja     8006f4 <vprintfmt+0x354>
+  8006d3:	89 c2                	mov    %eax,%edx
+  8006d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006d9:	83 c0 08             	add    $0x8,%eax
+  8006dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006df:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  8006e2:	4d 85 e4             	test   %r12,%r12
+  8006e5:	78 50                	js     800737 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  8006e7:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  8006ea:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8006ef:	e9 b4 01 00 00       	jmp    8008a8 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  8006f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800700:	eb dd                	jmp    8006df <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800702:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800706:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80070a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070e:	eb b6                	jmp    8006c6 <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800710:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800713:	83 f8 2f             	cmp    $0x2f,%eax
+  800716:	77 11                	ja     800729 <vprintfmt+0x389>
+  800718:	89 c2                	mov    %eax,%edx
+  80071a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80071e:	83 c0 08             	add    $0x8,%eax
+  800721:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800724:	4c 63 22             	movslq (%rdx),%r12
+  800727:	eb b9                	jmp    8006e2 <vprintfmt+0x342>
+  800729:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80072d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800731:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800735:	eb ed                	jmp    800724 <vprintfmt+0x384>
+				putch('-', putdat);
+  800737:	4c 89 ee             	mov    %r13,%rsi
+  80073a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80073f:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800742:	4c 89 e2             	mov    %r12,%rdx
+  800745:	48 f7 da             	neg    %rdx
+			base = 10;
+  800748:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80074d:	e9 56 01 00 00       	jmp    8008a8 <vprintfmt+0x508>
+	if (lflag >= 2)
+  800752:	83 f9 01             	cmp    $0x1,%ecx
+  800755:	7f 25                	jg     80077c <vprintfmt+0x3dc>
+	else if (lflag)
+  800757:	85 c9                	test   %ecx,%ecx
+  800759:	74 5e                	je     8007b9 <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  80075b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80075e:	83 f8 2f             	cmp    $0x2f,%eax
+  800761:	77 48                	ja     8007ab <vprintfmt+0x40b>
+  800763:	89 c2                	mov    %eax,%edx
+  800765:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800769:	83 c0 08             	add    $0x8,%eax
+  80076c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80076f:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800772:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800777:	e9 2c 01 00 00       	jmp    8008a8 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  80077c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80077f:	83 f8 2f             	cmp    $0x2f,%eax
+  800782:	77 19                	ja     80079d <vprintfmt+0x3fd>
+  800784:	89 c2                	mov    %eax,%edx
+  800786:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80078a:	83 c0 08             	add    $0x8,%eax
+  80078d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800790:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800793:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800798:	e9 0b 01 00 00       	jmp    8008a8 <vprintfmt+0x508>
+  80079d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a9:	eb e5                	jmp    800790 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  8007ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b7:	eb b6                	jmp    80076f <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  8007b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007bf:	77 18                	ja     8007d9 <vprintfmt+0x439>
+  8007c1:	89 c2                	mov    %eax,%edx
+  8007c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c7:	83 c0 08             	add    $0x8,%eax
+  8007ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007cd:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  8007cf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  8007d4:	e9 cf 00 00 00       	jmp    8008a8 <vprintfmt+0x508>
+  8007d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007dd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e5:	eb e6                	jmp    8007cd <vprintfmt+0x42d>
+	if (lflag >= 2)
+  8007e7:	83 f9 01             	cmp    $0x1,%ecx
+  8007ea:	7f 25                	jg     800811 <vprintfmt+0x471>
+	else if (lflag)
+  8007ec:	85 c9                	test   %ecx,%ecx
+  8007ee:	74 5b                	je     80084b <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  8007f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f6:	77 45                	ja     80083d <vprintfmt+0x49d>
+  8007f8:	89 c2                	mov    %eax,%edx
+  8007fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007fe:	83 c0 08             	add    $0x8,%eax
+  800801:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800804:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800807:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  80080c:	e9 97 00 00 00       	jmp    8008a8 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800811:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800814:	83 f8 2f             	cmp    $0x2f,%eax
+  800817:	77 16                	ja     80082f <vprintfmt+0x48f>
+  800819:	89 c2                	mov    %eax,%edx
+  80081b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081f:	83 c0 08             	add    $0x8,%eax
+  800822:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800825:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  800828:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  80082d:	eb 79                	jmp    8008a8 <vprintfmt+0x508>
+  80082f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800833:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800837:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083b:	eb e8                	jmp    800825 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  80083d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800841:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800845:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800849:	eb b9                	jmp    800804 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  80084b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084e:	83 f8 2f             	cmp    $0x2f,%eax
+  800851:	77 15                	ja     800868 <vprintfmt+0x4c8>
+  800853:	89 c2                	mov    %eax,%edx
+  800855:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800859:	83 c0 08             	add    $0x8,%eax
+  80085c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085f:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800861:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800866:	eb 40                	jmp    8008a8 <vprintfmt+0x508>
+  800868:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800870:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800874:	eb e9                	jmp    80085f <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800876:	4c 89 ee             	mov    %r13,%rsi
+  800879:	bf 30 00 00 00       	mov    $0x30,%edi
+  80087e:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800881:	4c 89 ee             	mov    %r13,%rsi
+  800884:	bf 78 00 00 00       	mov    $0x78,%edi
+  800889:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  80088c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088f:	83 f8 2f             	cmp    $0x2f,%eax
+  800892:	77 34                	ja     8008c8 <vprintfmt+0x528>
+  800894:	89 c2                	mov    %eax,%edx
+  800896:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80089a:	83 c0 08             	add    $0x8,%eax
+  80089d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  8008a0:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  8008a3:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  8008a8:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  8008ad:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008b1:	4c 89 ee             	mov    %r13,%rsi
+  8008b4:	4c 89 f7             	mov    %r14,%rdi
+  8008b7:	48 b8 7a 02 80 00 00 	movabs $0x80027a,%rax
+  8008be:	00 00 00 
+  8008c1:	ff d0                	call   *%rax
+			break;
+  8008c3:	e9 0d fb ff ff       	jmp    8003d5 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  8008c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d4:	eb ca                	jmp    8008a0 <vprintfmt+0x500>
+	if (lflag >= 2)
+  8008d6:	83 f9 01             	cmp    $0x1,%ecx
+  8008d9:	7f 22                	jg     8008fd <vprintfmt+0x55d>
+	else if (lflag)
+  8008db:	85 c9                	test   %ecx,%ecx
+  8008dd:	74 58                	je     800937 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  8008df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e5:	77 42                	ja     800929 <vprintfmt+0x589>
+  8008e7:	89 c2                	mov    %eax,%edx
+  8008e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ed:	83 c0 08             	add    $0x8,%eax
+  8008f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f3:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  8008f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  8008fb:	eb ab                	jmp    8008a8 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8008fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800900:	83 f8 2f             	cmp    $0x2f,%eax
+  800903:	77 16                	ja     80091b <vprintfmt+0x57b>
+  800905:	89 c2                	mov    %eax,%edx
+  800907:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090b:	83 c0 08             	add    $0x8,%eax
+  80090e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800911:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800914:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800919:	eb 8d                	jmp    8008a8 <vprintfmt+0x508>
+  80091b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800923:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800927:	eb e8                	jmp    800911 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800929:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800931:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800935:	eb bc                	jmp    8008f3 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800937:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80093a:	83 f8 2f             	cmp    $0x2f,%eax
+  80093d:	77 18                	ja     800957 <vprintfmt+0x5b7>
+  80093f:	89 c2                	mov    %eax,%edx
+  800941:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800945:	83 c0 08             	add    $0x8,%eax
+  800948:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094b:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  80094d:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800952:	e9 51 ff ff ff       	jmp    8008a8 <vprintfmt+0x508>
+  800957:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800963:	eb e6                	jmp    80094b <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800965:	4c 89 ee             	mov    %r13,%rsi
+  800968:	bf 25 00 00 00       	mov    $0x25,%edi
+  80096d:	41 ff d6             	call   *%r14
+			break;
+  800970:	e9 60 fa ff ff       	jmp    8003d5 <vprintfmt+0x35>
+			putch('%', putdat);
+  800975:	4c 89 ee             	mov    %r13,%rsi
+  800978:	bf 25 00 00 00       	mov    $0x25,%edi
+  80097d:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800980:	4c 89 e3             	mov    %r12,%rbx
+  800983:	eb 04                	jmp    800989 <vprintfmt+0x5e9>
+  800985:	48 83 eb 01          	sub    $0x1,%rbx
+  800989:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80098d:	75 f6                	jne    800985 <vprintfmt+0x5e5>
+  80098f:	e9 41 fa ff ff       	jmp    8003d5 <vprintfmt+0x35>
+
+0000000000800994 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800994:	55                   	push   %rbp
+  800995:	48 89 e5             	mov    %rsp,%rbp
+  800998:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80099c:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8009a0:	48 63 c6             	movslq %esi,%rax
+  8009a3:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  8009a8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  8009ac:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  8009b3:	48 85 ff             	test   %rdi,%rdi
+  8009b6:	74 2a                	je     8009e2 <vsnprintf+0x4e>
+  8009b8:	85 f6                	test   %esi,%esi
+  8009ba:	7e 26                	jle    8009e2 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009bc:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8009c0:	48 bf 02 03 80 00 00 	movabs $0x800302,%rdi
+  8009c7:	00 00 00 
+  8009ca:	48 b8 a0 03 80 00 00 	movabs $0x8003a0,%rax
+  8009d1:	00 00 00 
+  8009d4:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009d6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8009da:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  8009dd:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  8009e0:	c9                   	leave
+  8009e1:	c3                   	ret
+		return -E_INVAL;
+  8009e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009e7:	eb f7                	jmp    8009e0 <vsnprintf+0x4c>
+
+00000000008009e9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009e9:	55                   	push   %rbp
+  8009ea:	48 89 e5             	mov    %rsp,%rbp
+  8009ed:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8009f4:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8009fb:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800a02:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800a09:	84 c0                	test   %al,%al
+  800a0b:	74 20                	je     800a2d <snprintf+0x44>
+  800a0d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800a11:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800a15:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800a19:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800a1d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800a21:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800a25:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800a29:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a2d:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800a34:	00 00 00 
+  800a37:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800a3e:	00 00 00 
+  800a41:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a45:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800a4c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800a53:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a5a:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800a61:	48 b8 94 09 80 00 00 	movabs $0x800994,%rax
+  800a68:	00 00 00 
+  800a6b:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800a6d:	c9                   	leave
+  800a6e:	c3                   	ret
+
+0000000000800a6f <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a74:	48 89 d0             	mov    %rdx,%rax
+  800a77:	48 83 c2 01          	add    $0x1,%rdx
+  800a7b:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800a80:	75 f2                	jne    800a74 <strlen+0x5>
+		n++;
+	return n;
+}
+  800a82:	c3                   	ret
+
+0000000000800a83 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a88:	eb 03                	jmp    800a8d <strnlen+0xa>
+  800a8a:	48 89 d0             	mov    %rdx,%rax
+  800a8d:	48 39 c6             	cmp    %rax,%rsi
+  800a90:	74 0a                	je     800a9c <strnlen+0x19>
+  800a92:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a96:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800a9a:	75 ee                	jne    800a8a <strnlen+0x7>
+		n++;
+	return n;
+}
+  800a9c:	c3                   	ret
+
+0000000000800a9d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a9d:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800aa0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800aa5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800aa9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800aac:	48 83 c2 01          	add    $0x1,%rdx
+  800ab0:	84 c9                	test   %cl,%cl
+  800ab2:	75 f1                	jne    800aa5 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800ab4:	c3                   	ret
+
+0000000000800ab5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800ab5:	55                   	push   %rbp
+  800ab6:	48 89 e5             	mov    %rsp,%rbp
+  800ab9:	41 54                	push   %r12
+  800abb:	53                   	push   %rbx
+  800abc:	48 89 fb             	mov    %rdi,%rbx
+  800abf:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800ac2:	48 b8 6f 0a 80 00 00 	movabs $0x800a6f,%rax
+  800ac9:	00 00 00 
+  800acc:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800ace:	48 63 f8             	movslq %eax,%rdi
+  800ad1:	48 01 df             	add    %rbx,%rdi
+  800ad4:	4c 89 e6             	mov    %r12,%rsi
+  800ad7:	48 b8 9d 0a 80 00 00 	movabs $0x800a9d,%rax
+  800ade:	00 00 00 
+  800ae1:	ff d0                	call   *%rax
+	return dst;
+}
+  800ae3:	48 89 d8             	mov    %rbx,%rax
+  800ae6:	5b                   	pop    %rbx
+  800ae7:	41 5c                	pop    %r12
+  800ae9:	5d                   	pop    %rbp
+  800aea:	c3                   	ret
+
+0000000000800aeb <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800aeb:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800aee:	48 01 fa             	add    %rdi,%rdx
+  800af1:	48 89 f9             	mov    %rdi,%rcx
+  800af4:	eb 14                	jmp    800b0a <strncpy+0x1f>
+		*dst++ = *src;
+  800af6:	48 83 c1 01          	add    $0x1,%rcx
+  800afa:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800afe:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b02:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b06:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800b0a:	48 39 d1             	cmp    %rdx,%rcx
+  800b0d:	75 e7                	jne    800af6 <strncpy+0xb>
+	}
+	return ret;
+}
+  800b0f:	c3                   	ret
+
+0000000000800b10 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b10:	48 89 f8             	mov    %rdi,%rax
+  800b13:	48 85 d2             	test   %rdx,%rdx
+  800b16:	74 27                	je     800b3f <strlcpy+0x2f>
+  800b18:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800b1d:	48 89 fa             	mov    %rdi,%rdx
+  800b20:	eb 0b                	jmp    800b2d <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b22:	48 83 c6 01          	add    $0x1,%rsi
+  800b26:	48 83 c2 01          	add    $0x1,%rdx
+  800b2a:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800b2d:	48 39 c2             	cmp    %rax,%rdx
+  800b30:	74 0a                	je     800b3c <strlcpy+0x2c>
+  800b32:	0f b6 0e             	movzbl (%rsi),%ecx
+  800b35:	84 c9                	test   %cl,%cl
+  800b37:	75 e9                	jne    800b22 <strlcpy+0x12>
+  800b39:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800b3c:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800b3f:	48 29 f8             	sub    %rdi,%rax
+}
+  800b42:	c3                   	ret
+
+0000000000800b43 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800b43:	eb 08                	jmp    800b4d <strcmp+0xa>
+		p++, q++;
+  800b45:	48 83 c7 01          	add    $0x1,%rdi
+  800b49:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800b4d:	0f b6 07             	movzbl (%rdi),%eax
+  800b50:	84 c0                	test   %al,%al
+  800b52:	74 04                	je     800b58 <strcmp+0x15>
+  800b54:	3a 06                	cmp    (%rsi),%al
+  800b56:	74 ed                	je     800b45 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b58:	0f b6 c0             	movzbl %al,%eax
+  800b5b:	0f b6 16             	movzbl (%rsi),%edx
+  800b5e:	29 d0                	sub    %edx,%eax
+}
+  800b60:	c3                   	ret
+
+0000000000800b61 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800b61:	eb 0c                	jmp    800b6f <strncmp+0xe>
+		n--, p++, q++;
+  800b63:	48 83 ea 01          	sub    $0x1,%rdx
+  800b67:	48 83 c7 01          	add    $0x1,%rdi
+  800b6b:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800b6f:	48 85 d2             	test   %rdx,%rdx
+  800b72:	74 14                	je     800b88 <strncmp+0x27>
+  800b74:	0f b6 07             	movzbl (%rdi),%eax
+  800b77:	84 c0                	test   %al,%al
+  800b79:	74 04                	je     800b7f <strncmp+0x1e>
+  800b7b:	3a 06                	cmp    (%rsi),%al
+  800b7d:	74 e4                	je     800b63 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b7f:	0f b6 07             	movzbl (%rdi),%eax
+  800b82:	0f b6 16             	movzbl (%rsi),%edx
+  800b85:	29 d0                	sub    %edx,%eax
+}
+  800b87:	c3                   	ret
+		return 0;
+  800b88:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b8d:	c3                   	ret
+
+0000000000800b8e <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800b8e:	eb 04                	jmp    800b94 <strchr+0x6>
+  800b90:	48 83 c7 01          	add    $0x1,%rdi
+  800b94:	0f b6 07             	movzbl (%rdi),%eax
+  800b97:	84 c0                	test   %al,%al
+  800b99:	74 09                	je     800ba4 <strchr+0x16>
+		if (*s == c)
+  800b9b:	40 38 f0             	cmp    %sil,%al
+  800b9e:	75 f0                	jne    800b90 <strchr+0x2>
+  800ba0:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800ba3:	c3                   	ret
+	return 0;
+  800ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba9:	c3                   	ret
+
+0000000000800baa <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800baa:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800bad:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800bb0:	40 38 f2             	cmp    %sil,%dl
+  800bb3:	74 0a                	je     800bbf <strfind+0x15>
+  800bb5:	84 d2                	test   %dl,%dl
+  800bb7:	74 06                	je     800bbf <strfind+0x15>
+	for (; *s; s++)
+  800bb9:	48 83 c0 01          	add    $0x1,%rax
+  800bbd:	eb ee                	jmp    800bad <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800bbf:	c3                   	ret
+
+0000000000800bc0 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800bc0:	48 85 d2             	test   %rdx,%rdx
+  800bc3:	74 28                	je     800bed <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800bc5:	48 89 f8             	mov    %rdi,%rax
+  800bc8:	48 09 d0             	or     %rdx,%rax
+  800bcb:	a8 03                	test   $0x3,%al
+  800bcd:	75 16                	jne    800be5 <memset+0x25>
+		c &= 0xFF;
+  800bcf:	40 0f b6 f6          	movzbl %sil,%esi
+  800bd3:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800bd9:	48 89 d1             	mov    %rdx,%rcx
+  800bdc:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800be0:	fc                   	cld
+  800be1:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800be3:	eb 08                	jmp    800bed <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800be5:	89 f0                	mov    %esi,%eax
+  800be7:	48 89 d1             	mov    %rdx,%rcx
+  800bea:	fc                   	cld
+  800beb:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800bed:	48 89 f8             	mov    %rdi,%rax
+  800bf0:	c3                   	ret
+
+0000000000800bf1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bf1:	48 89 f8             	mov    %rdi,%rax
+  800bf4:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800bf7:	48 39 fe             	cmp    %rdi,%rsi
+  800bfa:	73 3a                	jae    800c36 <memmove+0x45>
+  800bfc:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800c00:	48 39 d7             	cmp    %rdx,%rdi
+  800c03:	73 31                	jae    800c36 <memmove+0x45>
+		s += n;
+		d += n;
+  800c05:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800c09:	48 89 d6             	mov    %rdx,%rsi
+  800c0c:	48 09 fe             	or     %rdi,%rsi
+  800c0f:	48 09 ce             	or     %rcx,%rsi
+  800c12:	40 f6 c6 03          	test   $0x3,%sil
+  800c16:	75 11                	jne    800c29 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c18:	48 83 ef 04          	sub    $0x4,%rdi
+  800c1c:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800c20:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800c24:	fd                   	std
+  800c25:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800c27:	eb 0b                	jmp    800c34 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c29:	48 83 ef 01          	sub    $0x1,%rdi
+  800c2d:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800c31:	fd                   	std
+  800c32:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c34:	fc                   	cld
+  800c35:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800c36:	48 89 f2             	mov    %rsi,%rdx
+  800c39:	48 09 c2             	or     %rax,%rdx
+  800c3c:	48 09 ca             	or     %rcx,%rdx
+  800c3f:	f6 c2 03             	test   $0x3,%dl
+  800c42:	75 0b                	jne    800c4f <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c44:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800c48:	48 89 c7             	mov    %rax,%rdi
+  800c4b:	fc                   	cld
+  800c4c:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800c4e:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800c4f:	48 89 c7             	mov    %rax,%rdi
+  800c52:	fc                   	cld
+  800c53:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c55:	c3                   	ret
+
+0000000000800c56 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c56:	55                   	push   %rbp
+  800c57:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800c5a:	48 b8 f1 0b 80 00 00 	movabs $0x800bf1,%rax
+  800c61:	00 00 00 
+  800c64:	ff d0                	call   *%rax
+}
+  800c66:	5d                   	pop    %rbp
+  800c67:	c3                   	ret
+
+0000000000800c68 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c68:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6d:	48 39 c2             	cmp    %rax,%rdx
+  800c70:	74 1e                	je     800c90 <memcmp+0x28>
+		if (*s1 != *s2)
+  800c72:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800c76:	48 83 c0 01          	add    $0x1,%rax
+  800c7a:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800c80:	44 38 c1             	cmp    %r8b,%cl
+  800c83:	74 e8                	je     800c6d <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800c85:	0f b6 c1             	movzbl %cl,%eax
+  800c88:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800c8c:	44 29 c0             	sub    %r8d,%eax
+  800c8f:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800c90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c95:	c3                   	ret
+
+0000000000800c96 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c96:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800c99:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800c9c:	eb 04                	jmp    800ca2 <memfind+0xc>
+  800c9e:	48 83 c0 01          	add    $0x1,%rax
+  800ca2:	48 39 d0             	cmp    %rdx,%rax
+  800ca5:	73 05                	jae    800cac <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ca7:	40 38 30             	cmp    %sil,(%rax)
+  800caa:	75 f2                	jne    800c9e <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800cac:	c3                   	ret
+
+0000000000800cad <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800cad:	48 89 f9             	mov    %rdi,%rcx
+  800cb0:	49 89 f0             	mov    %rsi,%r8
+  800cb3:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cb5:	eb 04                	jmp    800cbb <strtol+0xe>
+		s++;
+  800cb7:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800cbb:	0f b6 01             	movzbl (%rcx),%eax
+  800cbe:	3c 20                	cmp    $0x20,%al
+  800cc0:	74 f5                	je     800cb7 <strtol+0xa>
+  800cc2:	3c 09                	cmp    $0x9,%al
+  800cc4:	74 f1                	je     800cb7 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800cc6:	3c 2b                	cmp    $0x2b,%al
+  800cc8:	74 2b                	je     800cf5 <strtol+0x48>
+	int neg = 0;
+  800cca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800cd0:	3c 2d                	cmp    $0x2d,%al
+  800cd2:	74 2d                	je     800d01 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cd4:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800cda:	75 0f                	jne    800ceb <strtol+0x3e>
+  800cdc:	80 39 30             	cmpb   $0x30,(%rcx)
+  800cdf:	74 2c                	je     800d0d <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ce1:	85 ff                	test   %edi,%edi
+  800ce3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ce8:	0f 44 f8             	cmove  %eax,%edi
+  800ceb:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800cf0:	4c 63 d7             	movslq %edi,%r10
+  800cf3:	eb 4f                	jmp    800d44 <strtol+0x97>
+		s++;
+  800cf5:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800cf9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800cff:	eb d3                	jmp    800cd4 <strtol+0x27>
+		s++, neg = 1;
+  800d01:	48 83 c1 01          	add    $0x1,%rcx
+  800d05:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800d0b:	eb c7                	jmp    800cd4 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d0d:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800d11:	74 0f                	je     800d22 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800d13:	85 ff                	test   %edi,%edi
+  800d15:	75 d4                	jne    800ceb <strtol+0x3e>
+		s++, base = 8;
+  800d17:	48 83 c1 01          	add    $0x1,%rcx
+  800d1b:	bf 08 00 00 00       	mov    $0x8,%edi
+  800d20:	eb c9                	jmp    800ceb <strtol+0x3e>
+		s += 2, base = 16;
+  800d22:	48 83 c1 02          	add    $0x2,%rcx
+  800d26:	bf 10 00 00 00       	mov    $0x10,%edi
+  800d2b:	eb be                	jmp    800ceb <strtol+0x3e>
+			dig = *s - '0';
+  800d2d:	0f be c0             	movsbl %al,%eax
+  800d30:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800d33:	39 f8                	cmp    %edi,%eax
+  800d35:	7d 3b                	jge    800d72 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800d37:	48 83 c1 01          	add    $0x1,%rcx
+  800d3b:	49 0f af d2          	imul   %r10,%rdx
+  800d3f:	48 98                	cltq
+  800d41:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800d44:	0f b6 01             	movzbl (%rcx),%eax
+  800d47:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800d4a:	40 80 fe 09          	cmp    $0x9,%sil
+  800d4e:	76 dd                	jbe    800d2d <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800d50:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800d53:	40 80 fe 19          	cmp    $0x19,%sil
+  800d57:	77 08                	ja     800d61 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800d59:	0f be c0             	movsbl %al,%eax
+  800d5c:	83 e8 57             	sub    $0x57,%eax
+  800d5f:	eb d2                	jmp    800d33 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d61:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800d64:	40 80 fe 19          	cmp    $0x19,%sil
+  800d68:	77 08                	ja     800d72 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800d6a:	0f be c0             	movsbl %al,%eax
+  800d6d:	83 e8 37             	sub    $0x37,%eax
+  800d70:	eb c1                	jmp    800d33 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d72:	4d 85 c0             	test   %r8,%r8
+  800d75:	74 03                	je     800d7a <strtol+0xcd>
+		*endptr = (char *) s;
+  800d77:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800d7a:	48 89 d0             	mov    %rdx,%rax
+  800d7d:	48 f7 d8             	neg    %rax
+  800d80:	45 85 c9             	test   %r9d,%r9d
+  800d83:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800d87:	48 89 d0             	mov    %rdx,%rax
+  800d8a:	c3                   	ret
+
+0000000000800d8b <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800d8b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800d91:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800d97:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da1:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800da3:	c3                   	ret
+
+0000000000800da4 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800da4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800daa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800db0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800db5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dba:	48 89 fe             	mov    %rdi,%rsi
+  800dbd:	48 89 fa             	mov    %rdi,%rdx
+  800dc0:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dc2:	c3                   	ret
+
+0000000000800dc3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800dc3:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800dc6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800dcc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800dd2:	be 00 00 00 00       	mov    $0x0,%esi
+  800dd7:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ddc:	48 89 f2             	mov    %rsi,%rdx
+  800ddf:	0f 05                	syscall
+	if(check && ret > 0)
+  800de1:	48 85 c0             	test   %rax,%rax
+  800de4:	7f 01                	jg     800de7 <sys_env_destroy+0x24>
+}
+  800de6:	c3                   	ret
+{
+  800de7:	55                   	push   %rbp
+  800de8:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800deb:	49 89 c0             	mov    %rax,%r8
+  800dee:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800df3:	48 ba a8 20 80 00 00 	movabs $0x8020a8,%rdx
+  800dfa:	00 00 00 
+  800dfd:	be 28 00 00 00       	mov    $0x28,%esi
+  800e02:	48 bf c5 20 80 00 00 	movabs $0x8020c5,%rdi
+  800e09:	00 00 00 
+  800e0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e11:	49 b9 23 1a 80 00 00 	movabs $0x801a23,%r9
+  800e18:	00 00 00 
+  800e1b:	41 ff d1             	call   *%r9
+
+0000000000800e1e <sys_getenvid>:
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800e1e:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800e25:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800e26:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800e2b:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800e2f:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800e33:	48 c1 e2 04          	shl    $0x4,%rdx
+  800e37:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800e3e:	00 00 00 
+  800e41:	48 01 d0             	add    %rdx,%rax
+  800e44:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800e4a:	c3                   	ret
+
+0000000000800e4b <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800e4b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800e51:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800e57:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e5c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e61:	48 89 fe             	mov    %rdi,%rsi
+  800e64:	48 89 fa             	mov    %rdi,%rdx
+  800e67:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e69:	c3                   	ret
+
+0000000000800e6a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  800e6a:	48 63 d2             	movslq %edx,%rdx
+  800e6d:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800e70:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800e76:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800e7c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e81:	0f 05                	syscall
+	if(check && ret > 0)
+  800e83:	48 85 c0             	test   %rax,%rax
+  800e86:	7f 01                	jg     800e89 <sys_page_alloc+0x1f>
+}
+  800e88:	c3                   	ret
+{
+  800e89:	55                   	push   %rbp
+  800e8a:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8d:	49 89 c0             	mov    %rax,%r8
+  800e90:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800e95:	48 ba a8 20 80 00 00 	movabs $0x8020a8,%rdx
+  800e9c:	00 00 00 
+  800e9f:	be 28 00 00 00       	mov    $0x28,%esi
+  800ea4:	48 bf c5 20 80 00 00 	movabs $0x8020c5,%rdi
+  800eab:	00 00 00 
+  800eae:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb3:	49 b9 23 1a 80 00 00 	movabs $0x801a23,%r9
+  800eba:	00 00 00 
+  800ebd:	41 ff d1             	call   *%r9
+
+0000000000800ec0 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  800ec0:	48 63 d2             	movslq %edx,%rdx
+  800ec3:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800ec6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800ecc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800ed2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ed7:	0f 05                	syscall
+	if(check && ret > 0)
+  800ed9:	48 85 c0             	test   %rax,%rax
+  800edc:	7f 01                	jg     800edf <sys_page_alloc_huge+0x1f>
+}
+  800ede:	c3                   	ret
+{
+  800edf:	55                   	push   %rbp
+  800ee0:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ee3:	49 89 c0             	mov    %rax,%r8
+  800ee6:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800eeb:	48 ba a8 20 80 00 00 	movabs $0x8020a8,%rdx
+  800ef2:	00 00 00 
+  800ef5:	be 28 00 00 00       	mov    $0x28,%esi
+  800efa:	48 bf c5 20 80 00 00 	movabs $0x8020c5,%rdi
+  800f01:	00 00 00 
+  800f04:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f09:	49 b9 23 1a 80 00 00 	movabs $0x801a23,%r9
+  800f10:	00 00 00 
+  800f13:	41 ff d1             	call   *%r9
+
+0000000000800f16 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f16:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  800f19:	48 63 d2             	movslq %edx,%rdx
+  800f1c:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800f1f:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  800f22:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f27:	0f 05                	syscall
+	if(check && ret > 0)
+  800f29:	48 85 c0             	test   %rax,%rax
+  800f2c:	7f 01                	jg     800f2f <sys_page_map+0x19>
+}
+  800f2e:	c3                   	ret
+{
+  800f2f:	55                   	push   %rbp
+  800f30:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f33:	49 89 c0             	mov    %rax,%r8
+  800f36:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800f3b:	48 ba a8 20 80 00 00 	movabs $0x8020a8,%rdx
+  800f42:	00 00 00 
+  800f45:	be 28 00 00 00       	mov    $0x28,%esi
+  800f4a:	48 bf c5 20 80 00 00 	movabs $0x8020c5,%rdi
+  800f51:	00 00 00 
+  800f54:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f59:	49 b9 23 1a 80 00 00 	movabs $0x801a23,%r9
+  800f60:	00 00 00 
+  800f63:	41 ff d1             	call   *%r9
+
+0000000000800f66 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  800f66:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800f69:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f6f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f75:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f7a:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f7f:	0f 05                	syscall
+	if(check && ret > 0)
+  800f81:	48 85 c0             	test   %rax,%rax
+  800f84:	7f 01                	jg     800f87 <sys_page_unmap+0x21>
+}
+  800f86:	c3                   	ret
+{
+  800f87:	55                   	push   %rbp
+  800f88:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f8b:	49 89 c0             	mov    %rax,%r8
+  800f8e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800f93:	48 ba a8 20 80 00 00 	movabs $0x8020a8,%rdx
+  800f9a:	00 00 00 
+  800f9d:	be 28 00 00 00       	mov    $0x28,%esi
+  800fa2:	48 bf c5 20 80 00 00 	movabs $0x8020c5,%rdi
+  800fa9:	00 00 00 
+  800fac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb1:	49 b9 23 1a 80 00 00 	movabs $0x801a23,%r9
+  800fb8:	00 00 00 
+  800fbb:	41 ff d1             	call   *%r9
+
+0000000000800fbe <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  800fbe:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fc4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fca:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fcf:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fd4:	48 89 fe             	mov    %rdi,%rsi
+  800fd7:	48 89 fa             	mov    %rdi,%rdx
+  800fda:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800fdc:	c3                   	ret
+
+0000000000800fdd <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  800fdd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fe3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fe9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fee:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ff3:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  800ff5:	c3                   	ret
+
+0000000000800ff6 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  800ff6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800ffc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801002:	b8 11 00 00 00       	mov    $0x11,%eax
+  801007:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  801009:	c3                   	ret
+
+000000000080100a <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  80100a:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  80100d:	48 63 f6             	movslq %esi,%rsi
+  801010:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  801013:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801019:	b8 12 00 00 00       	mov    $0x12,%eax
+  80101e:	0f 05                	syscall
+	if(check && ret > 0)
+  801020:	48 85 c0             	test   %rax,%rax
+  801023:	7f 01                	jg     801026 <sys_page_batch+0x1c>
+}
+  801025:	c3                   	ret
+{
+  801026:	55                   	push   %rbp
+  801027:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80102a:	49 89 c0             	mov    %rax,%r8
+  80102d:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801032:	48 ba a8 20 80 00 00 	movabs $0x8020a8,%rdx
+  801039:	00 00 00 
+  80103c:	be 28 00 00 00       	mov    $0x28,%esi
+  801041:	48 bf c5 20 80 00 00 	movabs $0x8020c5,%rdi
+  801048:	00 00 00 
+  80104b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801050:	49 b9 23 1a 80 00 00 	movabs $0x801a23,%r9
+  801057:	00 00 00 
+  80105a:	41 ff d1             	call   *%r9
+
+000000000080105d <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  80105d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801063:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801069:	be 00 00 00 00       	mov    $0x0,%esi
+  80106e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801073:	48 89 f2             	mov    %rsi,%rdx
+  801076:	0f 05                	syscall
+	if(check && ret > 0)
+  801078:	48 85 c0             	test   %rax,%rax
+  80107b:	7f 01                	jg     80107e <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  80107d:	c3                   	ret
+{
+  80107e:	55                   	push   %rbp
+  80107f:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801082:	49 89 c0             	mov    %rax,%r8
+  801085:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80108a:	48 ba a8 20 80 00 00 	movabs $0x8020a8,%rdx
+  801091:	00 00 00 
+  801094:	be 28 00 00 00       	mov    $0x28,%esi
+  801099:	48 bf c5 20 80 00 00 	movabs $0x8020c5,%rdi
+  8010a0:	00 00 00 
+  8010a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a8:	49 b9 23 1a 80 00 00 	movabs $0x801a23,%r9
+  8010af:	00 00 00 
+  8010b2:	41 ff d1             	call   *%r9
+
+00000000008010b5 <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  8010b5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010c6:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010cb:	48 89 fe             	mov    %rdi,%rsi
+  8010ce:	48 89 fa             	mov    %rdi,%rdx
+  8010d1:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  8010d3:	c3                   	ret
+
+00000000008010d4 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  8010d4:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8010d7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010e3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010e8:	0f 05                	syscall
+	if(check && ret > 0)
+  8010ea:	48 85 c0             	test   %rax,%rax
+  8010ed:	7f 01                	jg     8010f0 <sys_page_unmap_range+0x1c>
+}
+  8010ef:	c3                   	ret
+{
+  8010f0:	55                   	push   %rbp
+  8010f1:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010f4:	49 89 c0             	mov    %rax,%r8
+  8010f7:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8010fc:	48 ba a8 20 80 00 00 	movabs $0x8020a8,%rdx
+  801103:	00 00 00 
+  801106:	be 28 00 00 00       	mov    $0x28,%esi
+  80110b:	48 bf c5 20 80 00 00 	movabs $0x8020c5,%rdi
+  801112:	00 00 00 
+  801115:	b8 00 00 00 00       	mov    $0x0,%eax
+  80111a:	49 b9 23 1a 80 00 00 	movabs $0x801a23,%r9
+  801121:	00 00 00 
+  801124:	41 ff d1             	call   *%r9
+
+0000000000801127 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801127:	48 63 f6             	movslq %esi,%rsi
+  80112a:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80112d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801133:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801139:	ba 00 00 00 00       	mov    $0x0,%edx
+  80113e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801143:	0f 05                	syscall
+	if(check && ret > 0)
+  801145:	48 85 c0             	test   %rax,%rax
+  801148:	7f 01                	jg     80114b <sys_env_set_status+0x24>
+}
+  80114a:	c3                   	ret
+{
+  80114b:	55                   	push   %rbp
+  80114c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80114f:	49 89 c0             	mov    %rax,%r8
+  801152:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801157:	48 ba a8 20 80 00 00 	movabs $0x8020a8,%rdx
+  80115e:	00 00 00 
+  801161:	be 28 00 00 00       	mov    $0x28,%esi
+  801166:	48 bf c5 20 80 00 00 	movabs $0x8020c5,%rdi
+  80116d:	00 00 00 
+  801170:	b8 00 00 00 00       	mov    $0x0,%eax
+  801175:	49 b9 23 1a 80 00 00 	movabs $0x801a23,%r9
+  80117c:	00 00 00 
+  80117f:	41 ff d1             	call   *%r9
+
+0000000000801182 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  801182:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801185:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80118b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801191:	ba 00 00 00 00       	mov    $0x0,%edx
+  801196:	b8 09 00 00 00       	mov    $0x9,%eax
+  80119b:	0f 05                	syscall
+	if(check && ret > 0)
+  80119d:	48 85 c0             	test   %rax,%rax
+  8011a0:	7f 01                	jg     8011a3 <sys_env_set_pgfault_upcall+0x21>
+}
+  8011a2:	c3                   	ret
+{
+  8011a3:	55                   	push   %rbp
+  8011a4:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a7:	49 89 c0             	mov    %rax,%r8
+  8011aa:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8011af:	48 ba a8 20 80 00 00 	movabs $0x8020a8,%rdx
+  8011b6:	00 00 00 
+  8011b9:	be 28 00 00 00       	mov    $0x28,%esi
+  8011be:	48 bf c5 20 80 00 00 	movabs $0x8020c5,%rdi
+  8011c5:	00 00 00 
+  8011c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011cd:	49 b9 23 1a 80 00 00 	movabs $0x801a23,%r9
+  8011d4:	00 00 00 
+  8011d7:	41 ff d1             	call   *%r9
+
+00000000008011da <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8011da:	48 63 ff             	movslq %edi,%rdi
+  8011dd:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  8011e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011e6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8011eb:	0f 05                	syscall
+}
+  8011ed:	c3                   	ret
+
+00000000008011ee <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  8011ee:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ff:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801204:	48 89 f2             	mov    %rsi,%rdx
+  801207:	0f 05                	syscall
+	if(check && ret > 0)
+  801209:	48 85 c0             	test   %rax,%rax
+  80120c:	7f 01                	jg     80120f <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  80120e:	c3                   	ret
+{
+  80120f:	55                   	push   %rbp
+  801210:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801213:	49 89 c0             	mov    %rax,%r8
+  801216:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80121b:	48 ba a8 20 80 00 00 	movabs $0x8020a8,%rdx
+  801222:	00 00 00 
+  801225:	be 28 00 00 00       	mov    $0x28,%esi
+  80122a:	48 bf c5 20 80 00 00 	movabs $0x8020c5,%rdi
+  801231:	00 00 00 
+  801234:	b8 00 00 00 00       	mov    $0x0,%eax
+  801239:	49 b9 23 1a 80 00 00 	movabs $0x801a23,%r9
+  801240:	00 00 00 
+  801243:	41 ff d1             	call   *%r9
+
+0000000000801246 <pgfault>:
+- unmap PFTEMP using sys_page_unmap()
+- panic if any step fails
+*/
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801246:	55                   	push   %rbp
+  801247:	48 89 e5             	mov    %rsp,%rbp
+  80124a:	53                   	push   %rbx
+  80124b:	48 83 ec 08          	sub    $0x8,%rsp
+	void *addr = (void *) utf->utf_fault_va;
+  80124f:	48 8b 1f             	mov    (%rdi),%rbx
+	uint32_t err = utf->utf_err;
+  801252:	48 8b 47 08          	mov    0x8(%rdi),%rax
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+
+	if (!(err & FEC_WR)) {
+  801256:	a8 02                	test   $0x2,%al
+  801258:	0f 84 b1 00 00 00    	je     80130f <pgfault+0xc9>
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+	}
+	pte_t pte = uvpt[PGNUM(addr)];
+  80125e:	48 89 da             	mov    %rbx,%rdx
+  801261:	48 c1 ea 0c          	shr    $0xc,%rdx
+  801265:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80126c:	01 00 00 
+  80126f:	48 8b 0c d0          	mov    (%rax,%rdx,8),%rcx
+	if (!(pte & PTE_COW)) {
+  801273:	f6 c5 08             	test   $0x8,%ch
+  801276:	0f 84 c3 00 00 00    	je     80133f <pgfault+0xf9>
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+
+	void *pg_addr = ROUNDDOWN(addr, PGSIZE);
+  80127c:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  801283:	ba 07 00 00 00       	mov    $0x7,%edx
+  801288:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  80128d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801292:	48 b8 6a 0e 80 00 00 	movabs $0x800e6a,%rax
+  801299:	00 00 00 
+  80129c:	ff d0                	call   *%rax
+	if (r < 0) {
+  80129e:	85 c0                	test   %eax,%eax
+  8012a0:	0f 88 c7 00 00 00    	js     80136d <pgfault+0x127>
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+	}
+	memmove(PFTEMP, pg_addr, PGSIZE);
+  8012a6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012ab:	48 89 de             	mov    %rbx,%rsi
+  8012ae:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  8012b3:	48 b8 f1 0b 80 00 00 	movabs $0x800bf1,%rax
+  8012ba:	00 00 00 
+  8012bd:	ff d0                	call   *%rax
+	r = sys_page_map(0, PFTEMP, 0, pg_addr, PTE_P | PTE_U | PTE_W);
+  8012bf:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8012c5:	48 89 d9             	mov    %rbx,%rcx
+  8012c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012cd:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8012d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012d7:	48 b8 16 0f 80 00 00 	movabs $0x800f16,%rax
+  8012de:	00 00 00 
+  8012e1:	ff d0                	call   *%rax
+	if (r < 0) {
+  8012e3:	85 c0                	test   %eax,%eax
+  8012e5:	0f 88 af 00 00 00    	js     80139a <pgfault+0x154>
+		panic("pgfault: sys_page_map failed:  %e", r);
+	}
+	r = sys_page_unmap(0, PFTEMP);
+  8012eb:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8012f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012f5:	48 b8 66 0f 80 00 00 	movabs $0x800f66,%rax
+  8012fc:	00 00 00 
+  8012ff:	ff d0                	call   *%rax
+	if (r < 0) {
+  801301:	85 c0                	test   %eax,%eax
+  801303:	0f 88 be 00 00 00    	js     8013c7 <pgfault+0x181>
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+	}
+}
+  801309:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80130d:	c9                   	leave
+  80130e:	c3                   	ret
+  80130f:	89 c1                	mov    %eax,%ecx
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+  801311:	49 89 d8             	mov    %rbx,%r8
+  801314:	48 ba d8 20 80 00 00 	movabs $0x8020d8,%rdx
+  80131b:	00 00 00 
+  80131e:	be 32 00 00 00       	mov    $0x32,%esi
+  801323:	48 bf 87 22 80 00 00 	movabs $0x802287,%rdi
+  80132a:	00 00 00 
+  80132d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801332:	49 b9 23 1a 80 00 00 	movabs $0x801a23,%r9
+  801339:	00 00 00 
+  80133c:	41 ff d1             	call   *%r9
+		panic("pgfault: page is not marked copy-on-write (pte=%p, va=%p)", pte, addr);
+  80133f:	49 89 d8             	mov    %rbx,%r8
+  801342:	48 ba 00 21 80 00 00 	movabs $0x802100,%rdx
+  801349:	00 00 00 
+  80134c:	be 36 00 00 00       	mov    $0x36,%esi
+  801351:	48 bf 87 22 80 00 00 	movabs $0x802287,%rdi
+  801358:	00 00 00 
+  80135b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801360:	49 b9 23 1a 80 00 00 	movabs $0x801a23,%r9
+  801367:	00 00 00 
+  80136a:	41 ff d1             	call   *%r9
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+  80136d:	89 c1                	mov    %eax,%ecx
+  80136f:	48 ba 40 21 80 00 00 	movabs $0x802140,%rdx
+  801376:	00 00 00 
+  801379:	be 44 00 00 00       	mov    $0x44,%esi
+  80137e:	48 bf 87 22 80 00 00 	movabs $0x802287,%rdi
+  801385:	00 00 00 
+  801388:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138d:	49 b8 23 1a 80 00 00 	movabs $0x801a23,%r8
+  801394:	00 00 00 
+  801397:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_map failed:  %e", r);
+  80139a:	89 c1                	mov    %eax,%ecx
+  80139c:	48 ba 68 21 80 00 00 	movabs $0x802168,%rdx
+  8013a3:	00 00 00 
+  8013a6:	be 49 00 00 00       	mov    $0x49,%esi
+  8013ab:	48 bf 87 22 80 00 00 	movabs $0x802287,%rdi
+  8013b2:	00 00 00 
+  8013b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ba:	49 b8 23 1a 80 00 00 	movabs $0x801a23,%r8
+  8013c1:	00 00 00 
+  8013c4:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+  8013c7:	89 c1                	mov    %eax,%ecx
+  8013c9:	48 ba 90 21 80 00 00 	movabs $0x802190,%rdx
+  8013d0:	00 00 00 
+  8013d3:	be 4d 00 00 00       	mov    $0x4d,%esi
+  8013d8:	48 bf 87 22 80 00 00 	movabs $0x802287,%rdi
+  8013df:	00 00 00 
+  8013e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e7:	49 b8 23 1a 80 00 00 	movabs $0x801a23,%r8
+  8013ee:	00 00 00 
+  8013f1:	41 ff d0             	call   *%r8
+
+00000000008013f4 <dupflush>:
+static struct PageOp dup_child[DUP_BATCH], dup_self[DUP_BATCH];
+static int ndup_child, ndup_self;
+
+static int
+dupflush(envid_t envid)
+{
+  8013f4:	55                   	push   %rbp
+  8013f5:	48 89 e5             	mov    %rsp,%rbp
+  8013f8:	89 fe                	mov    %edi,%esi
+	int r;
+
+	// Map to child first, then remap parent
+	r = sys_page_batch(0, envid, dup_child, ndup_child);
+  8013fa:	a1 24 30 80 00 00 00 	movabs 0x803024,%eax
+  801401:	00 00 
+  801403:	48 63 c8             	movslq %eax,%rcx
+  801406:	48 ba 40 36 80 00 00 	movabs $0x803640,%rdx
+  80140d:	00 00 00 
+  801410:	bf 00 00 00 00       	mov    $0x0,%edi
+  801415:	48 b8 0a 10 80 00 00 	movabs $0x80100a,%rax
+  80141c:	00 00 00 
+  80141f:	ff d0                	call   *%rax
+	if (r < 0) {
+  801421:	85 c0                	test   %eax,%eax
+  801423:	78 57                	js     80147c <dupflush+0x88>
+		panic("duppage: child map failed: %e", r);
+		return r;
+	}
+	r = sys_page_batch(0, 0, dup_self, ndup_self);
+  801425:	a1 20 30 80 00 00 00 	movabs 0x803020,%eax
+  80142c:	00 00 
+  80142e:	48 63 c8             	movslq %eax,%rcx
+  801431:	48 ba 40 30 80 00 00 	movabs $0x803040,%rdx
+  801438:	00 00 00 
+  80143b:	be 00 00 00 00       	mov    $0x0,%esi
+  801440:	bf 00 00 00 00       	mov    $0x0,%edi
+  801445:	48 b8 0a 10 80 00 00 	movabs $0x80100a,%rax
+  80144c:	00 00 00 
+  80144f:	ff d0                	call   *%rax
+	if (r < 0) {
+  801451:	85 c0                	test   %eax,%eax
+  801453:	78 54                	js     8014a9 <dupflush+0xb5>
+		panic("duppage: parent remap failed: %e", r);
+		return r;
+	}
+	ndup_child = ndup_self = 0;
+  801455:	48 b8 20 30 80 00 00 	movabs $0x803020,%rax
+  80145c:	00 00 00 
+  80145f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  801465:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  80146c:	00 00 00 
+  80146f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	return 0;
+}
+  801475:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147a:	5d                   	pop    %rbp
+  80147b:	c3                   	ret
+		panic("duppage: child map failed: %e", r);
+  80147c:	89 c1                	mov    %eax,%ecx
+  80147e:	48 ba 92 22 80 00 00 	movabs $0x802292,%rdx
+  801485:	00 00 00 
+  801488:	be 77 00 00 00       	mov    $0x77,%esi
+  80148d:	48 bf 87 22 80 00 00 	movabs $0x802287,%rdi
+  801494:	00 00 00 
+  801497:	b8 00 00 00 00       	mov    $0x0,%eax
+  80149c:	49 b8 23 1a 80 00 00 	movabs $0x801a23,%r8
+  8014a3:	00 00 00 
+  8014a6:	41 ff d0             	call   *%r8
+		panic("duppage: parent remap failed: %e", r);
+  8014a9:	89 c1                	mov    %eax,%ecx
+  8014ab:	48 ba b8 21 80 00 00 	movabs $0x8021b8,%rdx
+  8014b2:	00 00 00 
+  8014b5:	be 7c 00 00 00       	mov    $0x7c,%esi
+  8014ba:	48 bf 87 22 80 00 00 	movabs $0x802287,%rdi
+  8014c1:	00 00 00 
+  8014c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c9:	49 b8 23 1a 80 00 00 	movabs $0x801a23,%r8
+  8014d0:	00 00 00 
+  8014d3:	41 ff d0             	call   *%r8
+
+00000000008014d6 <thread_start>:
+	return envid;
+}
+
+static void
+thread_start(void (*fn)(void *), void *arg)
+{
+  8014d6:	55                   	push   %rbp
+  8014d7:	48 89 e5             	mov    %rsp,%rbp
+  8014da:	48 89 f8             	mov    %rdi,%rax
+  8014dd:	48 89 f7             	mov    %rsi,%rdi
+	fn(arg);
+  8014e0:	ff d0                	call   *%rax
+	exit();
+  8014e2:	48 b8 22 01 80 00 00 	movabs $0x800122,%rax
+  8014e9:	00 00 00 
+  8014ec:	ff d0                	call   *%rax
+}
+  8014ee:	5d                   	pop    %rbp
+  8014ef:	c3                   	ret
+
+00000000008014f0 <fork>:
+{
+  8014f0:	55                   	push   %rbp
+  8014f1:	48 89 e5             	mov    %rsp,%rbp
+	set_pgfault_handler(pgfault);
+  8014f4:	48 bf 46 12 80 00 00 	movabs $0x801246,%rdi
+  8014fb:	00 00 00 
+  8014fe:	48 b8 15 1b 80 00 00 	movabs $0x801b15,%rax
+  801505:	00 00 00 
+  801508:	ff d0                	call   *%rax
+	return sys_fork();
+  80150a:	48 b8 be 0f 80 00 00 	movabs $0x800fbe,%rax
+  801511:	00 00 00 
+  801514:	ff d0                	call   *%rax
+}
+  801516:	5d                   	pop    %rbp
+  801517:	c3                   	ret
+
+0000000000801518 <ufork>:
+{
+  801518:	55                   	push   %rbp
+  801519:	48 89 e5             	mov    %rsp,%rbp
+  80151c:	41 57                	push   %r15
+  80151e:	41 56                	push   %r14
+  801520:	41 55                	push   %r13
+  801522:	41 54                	push   %r12
+  801524:	53                   	push   %rbx
+  801525:	48 83 ec 38          	sub    $0x38,%rsp
+	set_pgfault_handler(pgfault);
+  801529:	48 bf 46 12 80 00 00 	movabs $0x801246,%rdi
+  801530:	00 00 00 
+  801533:	48 b8 15 1b 80 00 00 	movabs $0x801b15,%rax
+  80153a:	00 00 00 
+  80153d:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80153f:	b8 07 00 00 00       	mov    $0x7,%eax
+  801544:	cd 30                	int    $0x30
+  801546:	89 45 cc             	mov    %eax,-0x34(%rbp)
+	if (envid < 0) {
+  801549:	85 c0                	test   %eax,%eax
+  80154b:	78 21                	js     80156e <ufork+0x56>
+	if (envid == 0) {
+  80154d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801551:	0f 84 e4 03 00 00    	je     80193b <ufork+0x423>
+  801557:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80155e:	00 
+	op->po_op = PAGEOP_MAP;
+  80155f:	49 bf 40 36 80 00 00 	movabs $0x803640,%r15
+  801566:	00 00 00 
+  801569:	e9 e7 02 00 00       	jmp    801855 <ufork+0x33d>
+		panic("sys_exofork failed: %e", envid);
+  80156e:	89 c1                	mov    %eax,%ecx
+  801570:	48 ba b0 22 80 00 00 	movabs $0x8022b0,%rdx
+  801577:	00 00 00 
+  80157a:	be e4 00 00 00       	mov    $0xe4,%esi
+  80157f:	48 bf 87 22 80 00 00 	movabs $0x802287,%rdi
+  801586:	00 00 00 
+  801589:	b8 00 00 00 00       	mov    $0x0,%eax
+  80158e:	49 b8 23 1a 80 00 00 	movabs $0x801a23,%r8
+  801595:	00 00 00 
+  801598:	41 ff d0             	call   *%r8
+  80159b:	44 89 e8             	mov    %r13d,%eax
+  80159e:	c1 e0 09             	shl    $0x9,%eax
+  8015a1:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  8015a4:	44 89 e8             	mov    %r13d,%eax
+  8015a7:	c1 e0 12             	shl    $0x12,%eax
+  8015aa:	89 45 ac             	mov    %eax,-0x54(%rbp)
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  8015ad:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8015b4:	00 
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  8015b5:	44 89 6d a8          	mov    %r13d,-0x58(%rbp)
+				int pdeIndex = pdpeIndex * NPTENTRIES + k;
+  8015b9:	8b 75 c8             	mov    -0x38(%rbp),%esi
+				if (!(uvpd[pdeIndex] & PTE_P)) {
+  8015bc:	48 63 c6             	movslq %esi,%rax
+  8015bf:	48 bf 00 00 00 80 00 	movabs $0x10080000000,%rdi
+  8015c6:	01 00 00 
+  8015c9:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8015cd:	a8 01                	test   $0x1,%al
+  8015cf:	0f 84 52 02 00 00    	je     801827 <ufork+0x30f>
+				if (uvpd[pdeIndex] & PTE_PS) {
+  8015d5:	48 63 c6             	movslq %esi,%rax
+  8015d8:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  8015dc:	a8 80                	test   $0x80,%al
+  8015de:	74 52                	je     801632 <ufork+0x11a>
+					void *va = PGADDR(i, j, k, 0, 0);
+  8015e0:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  8015e4:	48 c1 e3 27          	shl    $0x27,%rbx
+  8015e8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8015ec:	48 09 c3             	or     %rax,%rbx
+  8015ef:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8015f3:	48 09 c3             	or     %rax,%rbx
+					if ((uintptr_t)va >= UTOP) {
+  8015f6:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  8015fb:	48 39 d8             	cmp    %rbx,%rax
+  8015fe:	0f 82 ca 02 00 00    	jb     8018ce <ufork+0x3b6>
+					r = sys_page_map(0, va, 0, va, uvpd[pdeIndex] & PTE_SYSCALL);
+  801604:	48 63 d6             	movslq %esi,%rdx
+  801607:	4c 8b 04 d7          	mov    (%rdi,%rdx,8),%r8
+  80160b:	41 81 e0 07 0e 00 00 	and    $0xe07,%r8d
+  801612:	48 89 d9             	mov    %rbx,%rcx
+  801615:	ba 00 00 00 00       	mov    $0x0,%edx
+  80161a:	48 89 de             	mov    %rbx,%rsi
+  80161d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801622:	48 b8 16 0f 80 00 00 	movabs $0x800f16,%rax
+  801629:	00 00 00 
+  80162c:	ff d0                	call   *%rax
+					if (r < 0) {
+  80162e:	85 c0                	test   %eax,%eax
+  801630:	78 18                	js     80164a <ufork+0x132>
+  801632:	4c 63 65 ac          	movslq -0x54(%rbp),%r12
+  801636:	4c 89 e3             	mov    %r12,%rbx
+  801639:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80163d:	4d 8d ac 24 00 02 00 	lea    0x200(%r12),%r13
+  801644:	00 
+  801645:	e9 00 01 00 00       	jmp    80174a <ufork+0x232>
+						panic("splitting 2MB page at %p failed: %e", va, r);
+  80164a:	41 89 c0             	mov    %eax,%r8d
+  80164d:	48 89 d9             	mov    %rbx,%rcx
+  801650:	48 ba e0 21 80 00 00 	movabs $0x8021e0,%rdx
+  801657:	00 00 00 
+  80165a:	be 0a 01 00 00       	mov    $0x10a,%esi
+  80165f:	48 bf 87 22 80 00 00 	movabs $0x802287,%rdi
+  801666:	00 00 00 
+  801669:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166e:	49 b9 23 1a 80 00 00 	movabs $0x801a23,%r9
+  801675:	00 00 00 
+  801678:	41 ff d1             	call   *%r9
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  80167b:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  801682:	00 00 00 
+  801685:	8b 0f                	mov    (%rdi),%ecx
+  801687:	8d 71 01             	lea    0x1(%rcx),%esi
+  80168a:	89 37                	mov    %esi,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  80168c:	48 63 c9             	movslq %ecx,%rcx
+  80168f:	48 8d 34 09          	lea    (%rcx,%rcx,1),%rsi
+  801693:	48 8d 3c 0e          	lea    (%rsi,%rcx,1),%rdi
+  801697:	41 c7 04 ff 01 00 00 	movl   $0x1,(%r15,%rdi,8)
+  80169e:	00 
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  80169f:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  8016a5:	41 89 54 ff 04       	mov    %edx,0x4(%r15,%rdi,8)
+	op->po_srcva = op->po_dstva = va;
+  8016aa:	49 89 44 ff 10       	mov    %rax,0x10(%r15,%rdi,8)
+  8016af:	49 89 44 ff 08       	mov    %rax,0x8(%r15,%rdi,8)
+}
+  8016b4:	eb 76                	jmp    80172c <ufork+0x214>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U | PTE_COW);
+  8016b6:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  8016bd:	00 00 00 
+  8016c0:	8b 17                	mov    (%rdi),%edx
+  8016c2:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  8016c5:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  8016c7:	48 63 d2             	movslq %edx,%rdx
+  8016ca:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  8016ce:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8016d2:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  8016d9:	00 
+	op->po_perm = perm;
+  8016da:	41 c7 44 f7 04 05 08 	movl   $0x805,0x4(%r15,%rsi,8)
+  8016e1:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  8016e3:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  8016e8:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+		dupqueue(&dup_self[ndup_self++], va, PTE_P | PTE_U | PTE_COW);
+  8016ed:	48 b9 20 30 80 00 00 	movabs $0x803020,%rcx
+  8016f4:	00 00 00 
+  8016f7:	8b 11                	mov    (%rcx),%edx
+  8016f9:	8d 72 01             	lea    0x1(%rdx),%esi
+  8016fc:	89 31                	mov    %esi,(%rcx)
+	op->po_op = PAGEOP_MAP;
+  8016fe:	48 be 40 30 80 00 00 	movabs $0x803040,%rsi
+  801705:	00 00 00 
+  801708:	48 63 d2             	movslq %edx,%rdx
+  80170b:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  80170f:	48 8d 3c 11          	lea    (%rcx,%rdx,1),%rdi
+  801713:	c7 04 fe 01 00 00 00 	movl   $0x1,(%rsi,%rdi,8)
+	op->po_perm = perm;
+  80171a:	c7 44 fe 04 05 08 00 	movl   $0x805,0x4(%rsi,%rdi,8)
+  801721:	00 
+	op->po_srcva = op->po_dstva = va;
+  801722:	48 89 44 fe 10       	mov    %rax,0x10(%rsi,%rdi,8)
+  801727:	48 89 44 fe 08       	mov    %rax,0x8(%rsi,%rdi,8)
+	if (ndup_child == DUP_BATCH) {
+  80172c:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  801733:	00 00 00 
+  801736:	83 38 40             	cmpl   $0x40,(%rax)
+  801739:	0f 84 a4 00 00 00    	je     8017e3 <ufork+0x2cb>
+				for (int l = 0; l < NPTENTRIES; l++) {
+  80173f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801746:	49 83 c4 01          	add    $0x1,%r12
+  80174a:	4d 39 ec             	cmp    %r13,%r12
+  80174d:	0f 84 d4 00 00 00    	je     801827 <ufork+0x30f>
+					if (va >= UTOP) {
+  801753:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  801758:	48 39 d8             	cmp    %rbx,%rax
+  80175b:	0f 82 6d 01 00 00    	jb     8018ce <ufork+0x3b6>
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  801761:	48 b8 00 10 80 43 ff 	movabs $0xffffffff43801000,%rax
+  801768:	ff ff ff 
+  80176b:	48 01 d8             	add    %rbx,%rax
+  80176e:	48 3d ff 0f 00 00    	cmp    $0xfff,%rax
+  801774:	76 c9                	jbe    80173f <ufork+0x227>
+					if (!(uvpt[pn] & PTE_P)) {
+  801776:	4b 8b 04 e6          	mov    (%r14,%r12,8),%rax
+  80177a:	a8 01                	test   $0x1,%al
+  80177c:	74 c1                	je     80173f <ufork+0x227>
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  80177e:	48 b8 00 f0 ff ff ff 	movabs $0xffffffff000,%rax
+  801785:	0f 00 00 
+  801788:	48 21 d8             	and    %rbx,%rax
+	pte_t pte = uvpt[pn];
+  80178b:	44 89 e2             	mov    %r12d,%edx
+  80178e:	49 8b 14 d6          	mov    (%r14,%rdx,8),%rdx
+	if (pte & PTE_SHARE) {
+  801792:	f6 c6 04             	test   $0x4,%dh
+  801795:	0f 85 e0 fe ff ff    	jne    80167b <ufork+0x163>
+	} else if ((pte & PTE_W) || (pte & PTE_COW)) {
+  80179b:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  8017a1:	0f 85 0f ff ff ff    	jne    8016b6 <ufork+0x19e>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U);
+  8017a7:	48 bf 24 30 80 00 00 	movabs $0x803024,%rdi
+  8017ae:	00 00 00 
+  8017b1:	8b 17                	mov    (%rdi),%edx
+  8017b3:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  8017b6:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  8017b8:	48 63 d2             	movslq %edx,%rdx
+  8017bb:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  8017bf:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8017c3:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  8017ca:	00 
+	op->po_perm = perm;
+  8017cb:	41 c7 44 f7 04 05 00 	movl   $0x5,0x4(%r15,%rsi,8)
+  8017d2:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  8017d4:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  8017d9:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+}
+  8017de:	e9 49 ff ff ff       	jmp    80172c <ufork+0x214>
+		return dupflush(envid);
+  8017e3:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8017e6:	48 b8 f4 13 80 00 00 	movabs $0x8013f4,%rax
+  8017ed:	00 00 00 
+  8017f0:	ff d0                	call   *%rax
+					if (r < 0) {
+  8017f2:	85 c0                	test   %eax,%eax
+  8017f4:	0f 89 45 ff ff ff    	jns    80173f <ufork+0x227>
+						panic("duppage failed:  %e", r);
+  8017fa:	89 c1                	mov    %eax,%ecx
+  8017fc:	48 ba c7 22 80 00 00 	movabs $0x8022c7,%rdx
+  801803:	00 00 00 
+  801806:	be 20 01 00 00       	mov    $0x120,%esi
+  80180b:	48 bf 87 22 80 00 00 	movabs $0x802287,%rdi
+  801812:	00 00 00 
+  801815:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181a:	49 b8 23 1a 80 00 00 	movabs $0x801a23,%r8
+  801821:	00 00 00 
+  801824:	41 ff d0             	call   *%r8
+			for (int k = 0; k < NPTENTRIES; k++) {
+  801827:	81 45 ac 00 02 00 00 	addl   $0x200,-0x54(%rbp)
+  80182e:	83 45 c8 01          	addl   $0x1,-0x38(%rbp)
+  801832:	48 81 45 b0 00 00 20 	addq   $0x200000,-0x50(%rbp)
+  801839:	00 
+  80183a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80183e:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  801844:	0f 85 6f fd ff ff    	jne    8015b9 <ufork+0xa1>
+  80184a:	44 8b 6d a8          	mov    -0x58(%rbp),%r13d
+  80184e:	eb 5d                	jmp    8018ad <ufork+0x395>
+	for (int i = 0; i < NPTENTRIES; i++) {
+  801850:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  801855:	48 81 7d c0 00 02 00 	cmpq   $0x200,-0x40(%rbp)
+  80185c:	00 
+  80185d:	74 6f                	je     8018ce <ufork+0x3b6>
+		if (!(uvpml4e[i] & PTE_P)) {
+  80185f:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  801863:	48 63 c3             	movslq %ebx,%rax
+  801866:	48 be 00 20 40 80 00 	movabs $0x10080402000,%rsi
+  80186d:	01 00 00 
+  801870:	48 8b 04 c6          	mov    (%rsi,%rax,8),%rax
+  801874:	a8 01                	test   $0x1,%al
+  801876:	74 d8                	je     801850 <ufork+0x338>
+  801878:	41 89 dc             	mov    %ebx,%r12d
+  80187b:	41 c1 e4 09          	shl    $0x9,%r12d
+  80187f:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801886:	00 
+					if (!(uvpt[pn] & PTE_P)) {
+  801887:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  80188e:	01 00 00 
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  801891:	45 89 e5             	mov    %r12d,%r13d
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  801894:	49 63 c5             	movslq %r13d,%rax
+  801897:	48 bb 00 00 40 80 00 	movabs $0x10080400000,%rbx
+  80189e:	01 00 00 
+  8018a1:	48 8b 04 c3          	mov    (%rbx,%rax,8),%rax
+  8018a5:	a8 01                	test   $0x1,%al
+  8018a7:	0f 85 ee fc ff ff    	jne    80159b <ufork+0x83>
+		for (int j = 0; j < NPTENTRIES; j++) {
+  8018ad:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8018b4:	40 
+  8018b5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8018b9:	41 83 c5 01          	add    $0x1,%r13d
+  8018bd:	48 b9 00 00 00 00 80 	movabs $0x8000000000,%rcx
+  8018c4:	00 00 00 
+  8018c7:	48 39 c8             	cmp    %rcx,%rax
+  8018ca:	75 c8                	jne    801894 <ufork+0x37c>
+  8018cc:	eb 82                	jmp    801850 <ufork+0x338>
+	r = dupflush(envid);
+  8018ce:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8018d1:	48 b8 f4 13 80 00 00 	movabs $0x8013f4,%rax
+  8018d8:	00 00 00 
+  8018db:	ff d0                	call   *%rax
+	if (r < 0) {
+  8018dd:	85 c0                	test   %eax,%eax
+  8018df:	78 6c                	js     80194d <ufork+0x435>
+	r = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  8018e1:	ba 07 00 00 00       	mov    $0x7,%edx
+  8018e6:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  8018eb:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8018ee:	48 b8 6a 0e 80 00 00 	movabs $0x800e6a,%rax
+  8018f5:	00 00 00 
+  8018f8:	ff d0                	call   *%rax
+	if (r < 0) {
+  8018fa:	85 c0                	test   %eax,%eax
+  8018fc:	78 7c                	js     80197a <ufork+0x462>
+	r = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  8018fe:	48 be dc 1b 80 00 00 	movabs $0x801bdc,%rsi
+  801905:	00 00 00 
+  801908:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80190b:	48 b8 82 11 80 00 00 	movabs $0x801182,%rax
+  801912:	00 00 00 
+  801915:	ff d0                	call   *%rax
+	if (r < 0) {
+  801917:	85 c0                	test   %eax,%eax
+  801919:	0f 88 88 00 00 00    	js     8019a7 <ufork+0x48f>
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  80191f:	be 02 00 00 00       	mov    $0x2,%esi
+  801924:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801927:	48 b8 27 11 80 00 00 	movabs $0x801127,%rax
+  80192e:	00 00 00 
+  801931:	ff d0                	call   *%rax
+	if (r < 0) {
+  801933:	85 c0                	test   %eax,%eax
+  801935:	0f 88 99 00 00 00    	js     8019d4 <ufork+0x4bc>
+}
+  80193b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80193e:	48 83 c4 38          	add    $0x38,%rsp
+  801942:	5b                   	pop    %rbx
+  801943:	41 5c                	pop    %r12
+  801945:	41 5d                	pop    %r13
+  801947:	41 5e                	pop    %r14
+  801949:	41 5f                	pop    %r15
+  80194b:	5d                   	pop    %rbp
+  80194c:	c3                   	ret
+		panic("duppage failed:  %e", r);
+  80194d:	89 c1                	mov    %eax,%ecx
+  80194f:	48 ba c7 22 80 00 00 	movabs $0x8022c7,%rdx
+  801956:	00 00 00 
+  801959:	be 29 01 00 00       	mov    $0x129,%esi
+  80195e:	48 bf 87 22 80 00 00 	movabs $0x802287,%rdi
+  801965:	00 00 00 
+  801968:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196d:	49 b8 23 1a 80 00 00 	movabs $0x801a23,%r8
+  801974:	00 00 00 
+  801977:	41 ff d0             	call   *%r8
+		panic("sys_page_alloc for child exception stack failed: %e", r);
+  80197a:	89 c1                	mov    %eax,%ecx
+  80197c:	48 ba 08 22 80 00 00 	movabs $0x802208,%rdx
+  801983:	00 00 00 
+  801986:	be 2e 01 00 00       	mov    $0x12e,%esi
+  80198b:	48 bf 87 22 80 00 00 	movabs $0x802287,%rdi
+  801992:	00 00 00 
+  801995:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199a:	49 b8 23 1a 80 00 00 	movabs $0x801a23,%r8
+  8019a1:	00 00 00 
+  8019a4:	41 ff d0             	call   *%r8
+		panic("sys_env_set_pgfault_upcall failed:  %e", r);
+  8019a7:	89 c1                	mov    %eax,%ecx
+  8019a9:	48 ba 40 22 80 00 00 	movabs $0x802240,%rdx
+  8019b0:	00 00 00 
+  8019b3:	be 33 01 00 00       	mov    $0x133,%esi
+  8019b8:	48 bf 87 22 80 00 00 	movabs $0x802287,%rdi
+  8019bf:	00 00 00 
+  8019c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c7:	49 b8 23 1a 80 00 00 	movabs $0x801a23,%r8
+  8019ce:	00 00 00 
+  8019d1:	41 ff d0             	call   *%r8
+		panic("sys_env_set_status failed:  %e", r);
+  8019d4:	89 c1                	mov    %eax,%ecx
+  8019d6:	48 ba 68 22 80 00 00 	movabs $0x802268,%rdx
+  8019dd:	00 00 00 
+  8019e0:	be 38 01 00 00       	mov    $0x138,%esi
+  8019e5:	48 bf 87 22 80 00 00 	movabs $0x802287,%rdi
+  8019ec:	00 00 00 
+  8019ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f4:	49 b8 23 1a 80 00 00 	movabs $0x801a23,%r8
+  8019fb:	00 00 00 
+  8019fe:	41 ff d0             	call   *%r8
+
+0000000000801a01 <sfork>:
+// on one stack, since nothing is private to the child.
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801a01:	55                   	push   %rbp
+  801a02:	48 89 e5             	mov    %rsp,%rbp
+  801a05:	48 89 f2             	mov    %rsi,%rdx
+	return sys_thread_create(thread_start, (uint64_t) fn, (uint64_t) arg);
+  801a08:	48 89 fe             	mov    %rdi,%rsi
+  801a0b:	48 bf d6 14 80 00 00 	movabs $0x8014d6,%rdi
+  801a12:	00 00 00 
+  801a15:	48 b8 f6 0f 80 00 00 	movabs $0x800ff6,%rax
+  801a1c:	00 00 00 
+  801a1f:	ff d0                	call   *%rax
+}
+  801a21:	5d                   	pop    %rbp
+  801a22:	c3                   	ret
+
+0000000000801a23 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801a23:	55                   	push   %rbp
+  801a24:	48 89 e5             	mov    %rsp,%rbp
+  801a27:	41 56                	push   %r14
+  801a29:	41 55                	push   %r13
+  801a2b:	41 54                	push   %r12
+  801a2d:	53                   	push   %rbx
+  801a2e:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  801a35:	49 89 fc             	mov    %rdi,%r12
+  801a38:	41 89 f5             	mov    %esi,%r13d
+  801a3b:	48 89 d3             	mov    %rdx,%rbx
+  801a3e:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  801a45:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  801a4c:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  801a53:	84 c0                	test   %al,%al
+  801a55:	74 26                	je     801a7d <_panic+0x5a>
+  801a57:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  801a5e:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  801a65:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  801a69:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  801a6d:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  801a71:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  801a75:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  801a79:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801a7d:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  801a84:	00 00 00 
+  801a87:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  801a8e:	00 00 00 
+  801a91:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801a95:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  801a9c:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  801aa3:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801aaa:	48 b8 00 30 80 00 00 	movabs $0x803000,%rax
+  801ab1:	00 00 00 
+  801ab4:	4c 8b 30             	mov    (%rax),%r14
+  801ab7:	48 b8 1e 0e 80 00 00 	movabs $0x800e1e,%rax
+  801abe:	00 00 00 
+  801ac1:	ff d0                	call   *%rax
+  801ac3:	89 c6                	mov    %eax,%esi
+  801ac5:	45 89 e8             	mov    %r13d,%r8d
+  801ac8:	4c 89 e1             	mov    %r12,%rcx
+  801acb:	4c 89 f2             	mov    %r14,%rdx
+  801ace:	48 bf e0 22 80 00 00 	movabs $0x8022e0,%rdi
+  801ad5:	00 00 00 
+  801ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801add:	49 bc e6 01 80 00 00 	movabs $0x8001e6,%r12
+  801ae4:	00 00 00 
+  801ae7:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801aea:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  801af1:	48 89 df             	mov    %rbx,%rdi
+  801af4:	48 b8 82 01 80 00 00 	movabs $0x800182,%rax
+  801afb:	00 00 00 
+  801afe:	ff d0                	call   *%rax
+	cprintf("\n");
+  801b00:	48 bf d4 1c 80 00 00 	movabs $0x801cd4,%rdi
+  801b07:	00 00 00 
+  801b0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b0f:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801b12:	cc                   	int3
+	while (1)
+  801b13:	eb fd                	jmp    801b12 <_panic+0xef>
+
+0000000000801b15 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801b15:	55                   	push   %rbp
+  801b16:	48 89 e5             	mov    %rsp,%rbp
+  801b19:	53                   	push   %rbx
+  801b1a:	48 83 ec 08          	sub    $0x8,%rsp
+  801b1e:	48 89 fb             	mov    %rdi,%rbx
+	int r;
+
+	if (_pgfault_handler == 0) {
+  801b21:	48 ba 40 3c 80 00 00 	movabs $0x803c40,%rdx
+  801b28:	00 00 00 
+  801b2b:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801b2f:	74 13                	je     801b44 <set_pgfault_handler+0x2f>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801b31:	48 89 d8             	mov    %rbx,%rax
+  801b34:	48 a3 40 3c 80 00 00 	movabs %rax,0x803c40
+  801b3b:	00 00 00 
+}
+  801b3e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b42:	c9                   	leave
+  801b43:	c3                   	ret
+		r = sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801b44:	ba 07 00 00 00       	mov    $0x7,%edx
+  801b49:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801b4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b53:	48 b8 6a 0e 80 00 00 	movabs $0x800e6a,%rax
+  801b5a:	00 00 00 
+  801b5d:	ff d0                	call   *%rax
+		if (r < 0) {
+  801b5f:	85 c0                	test   %eax,%eax
+  801b61:	78 4c                	js     801baf <set_pgfault_handler+0x9a>
+		r = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801b63:	48 be dc 1b 80 00 00 	movabs $0x801bdc,%rsi
+  801b6a:	00 00 00 
+  801b6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b72:	48 b8 82 11 80 00 00 	movabs $0x801182,%rax
+  801b79:	00 00 00 
+  801b7c:	ff d0                	call   *%rax
+		if (r < 0) {
+  801b7e:	85 c0                	test   %eax,%eax
+  801b80:	79 af                	jns    801b31 <set_pgfault_handler+0x1c>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+  801b82:	89 c1                	mov    %eax,%ecx
+  801b84:	48 ba 30 23 80 00 00 	movabs $0x802330,%rdx
+  801b8b:	00 00 00 
+  801b8e:	be 2c 00 00 00       	mov    $0x2c,%esi
+  801b93:	48 bf 1e 23 80 00 00 	movabs $0x80231e,%rdi
+  801b9a:	00 00 00 
+  801b9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba2:	49 b8 23 1a 80 00 00 	movabs $0x801a23,%r8
+  801ba9:	00 00 00 
+  801bac:	41 ff d0             	call   *%r8
+			panic("sys_page_alloc failed:  %e", r);
+  801baf:	89 c1                	mov    %eax,%ecx
+  801bb1:	48 ba 03 23 80 00 00 	movabs $0x802303,%rdx
+  801bb8:	00 00 00 
+  801bbb:	be 28 00 00 00       	mov    $0x28,%esi
+  801bc0:	48 bf 1e 23 80 00 00 	movabs $0x80231e,%rdi
+  801bc7:	00 00 00 
+  801bca:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bcf:	49 b8 23 1a 80 00 00 	movabs $0x801a23,%r8
+  801bd6:	00 00 00 
+  801bd9:	41 ff d0             	call   *%r8
+
+0000000000801bdc <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi		// function argument: pointer to UTF
+  801bdc:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  801bdf:	48 a1 40 3c 80 00 00 	movabs 0x803c40,%rax
+  801be6:	00 00 00 
+	call *%rax
+  801be9:	ff d0                	call   *%rax
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here. (Hint. You need to modify the trap time rsp to make room for the return rip ) */
+
+	movq  152(%rsp), %rax
+  801beb:	48 8b 84 24 98 00 00 	mov    0x98(%rsp),%rax
+  801bf2:	00 
+	subq $8, %rax
+  801bf3:	48 83 e8 08          	sub    $0x8,%rax
+	movq %rax, 152(%rsp)
+  801bf7:	48 89 84 24 98 00 00 	mov    %rax,0x98(%rsp)
+  801bfe:	00 
+
+	movq 136(%rsp), %rbx
+  801bff:	48 8b 9c 24 88 00 00 	mov    0x88(%rsp),%rbx
+  801c06:	00 
+	movq %rbx, (%rax)
+  801c07:	48 89 18             	mov    %rbx,(%rax)
+
+	/* Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here. (Hint, the oposite of _alltraps) */
+
+	addq $16, %rsp
+  801c0a:	48 83 c4 10          	add    $0x10,%rsp
+	
+	popq %r15
+  801c0e:	41 5f                	pop    %r15
+	popq %r14
+  801c10:	41 5e                	pop    %r14
+	popq %r13
+  801c12:	41 5d                	pop    %r13
+	popq %r12
+  801c14:	41 5c                	pop    %r12
+	popq %r11
+  801c16:	41 5b                	pop    %r11
+	popq %r10
+  801c18:	41 5a                	pop    %r10
+	popq %r9
+  801c1a:	41 59                	pop    %r9
+	popq %r8
+  801c1c:	41 58                	pop    %r8
+	popq %rsi
+  801c1e:	5e                   	pop    %rsi
+	popq %rdi
+  801c1f:	5f                   	pop    %rdi
+	popq %rbp
+  801c20:	5d                   	pop    %rbp
+	popq %rdx
+  801c21:	5a                   	pop    %rdx
+	popq %rcx
+  801c22:	59                   	pop    %rcx
+	popq %rbx
+  801c23:	5b                   	pop    %rbx
+	popq %rax
+  801c24:	58                   	pop    %rax
+
+	addq $8, %rsp
+  801c25:	48 83 c4 08          	add    $0x8,%rsp
+	/* Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 4: Your code here. */
+
+	popfq
+  801c29:	9d                   	popf
+
+	/* Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here. */
+
+	popq %rsp
+  801c2a:	5c                   	pop    %rsp
+
+	/* Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here. */
+  801c2b:	c3                   	ret
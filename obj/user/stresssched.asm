@@ -0,0 +1,3219 @@
+
+obj/user/stresssched:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 71 01 00 00       	call   8001a2 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+
+volatile int counter;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	41 55                	push   %r13
+  800039:	41 54                	push   %r12
+  80003b:	53                   	push   %rbx
+  80003c:	48 83 ec 08          	sub    $0x8,%rsp
+	int i, j;
+	int seen;
+	envid_t parent = sys_getenvid();
+  800040:	48 b8 bf 0f 80 00 00 	movabs $0x800fbf,%rax
+  800047:	00 00 00 
+  80004a:	ff d0                	call   *%rax
+  80004c:	41 89 c5             	mov    %eax,%r13d
+
+	// Fork several environments
+	for (i = 0; i < 20; i++)
+  80004f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (fork() == 0)
+  800054:	49 bc 91 16 80 00 00 	movabs $0x801691,%r12
+  80005b:	00 00 00 
+  80005e:	41 ff d4             	call   *%r12
+  800061:	85 c0                	test   %eax,%eax
+  800063:	74 19                	je     80007e <umain+0x4b>
+	for (i = 0; i < 20; i++)
+  800065:	83 c3 01             	add    $0x1,%ebx
+  800068:	83 fb 14             	cmp    $0x14,%ebx
+  80006b:	75 f1                	jne    80005e <umain+0x2b>
+			break;
+	if (i == 20) {
+		sys_yield();
+  80006d:	48 b8 ec 0f 80 00 00 	movabs $0x800fec,%rax
+  800074:	00 00 00 
+  800077:	ff d0                	call   *%rax
+		return;
+  800079:	e9 e2 00 00 00       	jmp    800160 <umain+0x12d>
+	}
+
+	// Wait for the parent to finish forking
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  80007e:	44 89 e8             	mov    %r13d,%eax
+  800081:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800086:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  80008a:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  80008e:	48 c1 e0 04          	shl    $0x4,%rax
+  800092:	48 ba 00 00 80 bc 00 	movabs $0xbc800000,%rdx
+  800099:	00 00 00 
+  80009c:	48 01 c2             	add    %rax,%rdx
+  80009f:	eb 02                	jmp    8000a3 <umain+0x70>
+		asm volatile("pause");
+  8000a1:	f3 90                	pause
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  8000a3:	8b 82 c4 00 00 00    	mov    0xc4(%rdx),%eax
+  8000a9:	85 c0                	test   %eax,%eax
+  8000ab:	75 f4                	jne    8000a1 <umain+0x6e>
+  8000ad:	41 bc 0b 00 00 00    	mov    $0xb,%r12d
+
+	// Check that one environment doesn't run on two CPUs at once
+	for (i = 0; i < 10; i++) {
+		sys_yield();
+  8000b3:	49 bd ec 0f 80 00 00 	movabs $0x800fec,%r13
+  8000ba:	00 00 00 
+		for (j = 0; j < 10000; j++)
+			counter++;
+  8000bd:	48 bb 20 30 80 00 00 	movabs $0x803020,%rbx
+  8000c4:	00 00 00 
+  8000c7:	eb 0c                	jmp    8000d5 <umain+0xa2>
+  8000c9:	8b 03                	mov    (%rbx),%eax
+  8000cb:	83 c0 01             	add    $0x1,%eax
+  8000ce:	89 03                	mov    %eax,(%rbx)
+		for (j = 0; j < 10000; j++)
+  8000d0:	83 ea 01             	sub    $0x1,%edx
+  8000d3:	75 f4                	jne    8000c9 <umain+0x96>
+	for (i = 0; i < 10; i++) {
+  8000d5:	41 83 ec 01          	sub    $0x1,%r12d
+  8000d9:	74 0a                	je     8000e5 <umain+0xb2>
+		sys_yield();
+  8000db:	41 ff d5             	call   *%r13
+		for (j = 0; j < 10000; j++)
+  8000de:	ba 11 27 00 00       	mov    $0x2711,%edx
+  8000e3:	eb eb                	jmp    8000d0 <umain+0x9d>
+	}
+
+	if (counter != 10*10000)
+  8000e5:	a1 20 30 80 00 00 00 	movabs 0x803020,%eax
+  8000ec:	00 00 
+  8000ee:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  8000f3:	75 76                	jne    80016b <umain+0x138>
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  8000f5:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  8000fc:	00 
+		panic("ran on two CPUs at once (counter is %d)", counter);
+
+	// Check that we see environments running on different CPUs
+	cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+  8000fd:	48 ba 00 00 80 bc 00 	movabs $0xbc800000,%rdx
+  800104:	00 00 00 
+  800107:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80010c:	48 8d 0c c0          	lea    (%rax,%rax,8),%rcx
+  800110:	48 8d 04 48          	lea    (%rax,%rcx,2),%rax
+  800114:	48 c1 e0 04          	shl    $0x4,%rax
+  800118:	48 01 d0             	add    %rdx,%rax
+  80011b:	8b 88 cc 00 00 00    	mov    0xcc(%rax),%ecx
+  800121:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800128:	00 
+  800129:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80012e:	48 8d 34 c0          	lea    (%rax,%rax,8),%rsi
+  800132:	48 8d 04 70          	lea    (%rax,%rsi,2),%rax
+  800136:	48 c1 e0 04          	shl    $0x4,%rax
+  80013a:	48 01 c2             	add    %rax,%rdx
+  80013d:	8b b2 b8 00 00 00    	mov    0xb8(%rdx),%esi
+  800143:	89 ca                	mov    %ecx,%edx
+  800145:	48 bf 1b 1d 80 00 00 	movabs $0x801d1b,%rdi
+  80014c:	00 00 00 
+  80014f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800154:	48 b9 87 03 80 00 00 	movabs $0x800387,%rcx
+  80015b:	00 00 00 
+  80015e:	ff d1                	call   *%rcx
+
+}
+  800160:	48 83 c4 08          	add    $0x8,%rsp
+  800164:	5b                   	pop    %rbx
+  800165:	41 5c                	pop    %r12
+  800167:	41 5d                	pop    %r13
+  800169:	5d                   	pop    %rbp
+  80016a:	c3                   	ret
+		panic("ran on two CPUs at once (counter is %d)", counter);
+  80016b:	48 b8 20 30 80 00 00 	movabs $0x803020,%rax
+  800172:	00 00 00 
+  800175:	8b 08                	mov    (%rax),%ecx
+  800177:	48 ba e0 1c 80 00 00 	movabs $0x801ce0,%rdx
+  80017e:	00 00 00 
+  800181:	be 21 00 00 00       	mov    $0x21,%esi
+  800186:	48 bf 08 1d 80 00 00 	movabs $0x801d08,%rdi
+  80018d:	00 00 00 
+  800190:	b8 00 00 00 00       	mov    $0x0,%eax
+  800195:	49 b8 e8 01 80 00 00 	movabs $0x8001e8,%r8
+  80019c:	00 00 00 
+  80019f:	41 ff d0             	call   *%r8
+
+00000000008001a2 <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  8001a2:	55                   	push   %rbp
+  8001a3:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001a6:	85 ff                	test   %edi,%edi
+  8001a8:	7e 0d                	jle    8001b7 <libmain+0x15>
+		binaryname = argv[0];
+  8001aa:	48 8b 06             	mov    (%rsi),%rax
+  8001ad:	48 a3 00 30 80 00 00 	movabs %rax,0x803000
+  8001b4:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  8001b7:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  8001be:	00 00 00 
+  8001c1:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8001c3:	48 b8 d1 01 80 00 00 	movabs $0x8001d1,%rax
+  8001ca:	00 00 00 
+  8001cd:	ff d0                	call   *%rax
+}
+  8001cf:	5d                   	pop    %rbp
+  8001d0:	c3                   	ret
+
+00000000008001d1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001d1:	55                   	push   %rbp
+  8001d2:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  8001d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001da:	48 b8 64 0f 80 00 00 	movabs $0x800f64,%rax
+  8001e1:	00 00 00 
+  8001e4:	ff d0                	call   *%rax
+}
+  8001e6:	5d                   	pop    %rbp
+  8001e7:	c3                   	ret
+
+00000000008001e8 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001e8:	55                   	push   %rbp
+  8001e9:	48 89 e5             	mov    %rsp,%rbp
+  8001ec:	41 56                	push   %r14
+  8001ee:	41 55                	push   %r13
+  8001f0:	41 54                	push   %r12
+  8001f2:	53                   	push   %rbx
+  8001f3:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8001fa:	49 89 fc             	mov    %rdi,%r12
+  8001fd:	41 89 f5             	mov    %esi,%r13d
+  800200:	48 89 d3             	mov    %rdx,%rbx
+  800203:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80020a:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800211:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800218:	84 c0                	test   %al,%al
+  80021a:	74 26                	je     800242 <_panic+0x5a>
+  80021c:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800223:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80022a:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  80022e:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800232:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800236:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80023a:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  80023e:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800242:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800249:	00 00 00 
+  80024c:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800253:	00 00 00 
+  800256:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80025a:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800261:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800268:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80026f:	48 b8 00 30 80 00 00 	movabs $0x803000,%rax
+  800276:	00 00 00 
+  800279:	4c 8b 30             	mov    (%rax),%r14
+  80027c:	48 b8 bf 0f 80 00 00 	movabs $0x800fbf,%rax
+  800283:	00 00 00 
+  800286:	ff d0                	call   *%rax
+  800288:	89 c6                	mov    %eax,%esi
+  80028a:	45 89 e8             	mov    %r13d,%r8d
+  80028d:	4c 89 e1             	mov    %r12,%rcx
+  800290:	4c 89 f2             	mov    %r14,%rdx
+  800293:	48 bf 48 1d 80 00 00 	movabs $0x801d48,%rdi
+  80029a:	00 00 00 
+  80029d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a2:	49 bc 87 03 80 00 00 	movabs $0x800387,%r12
+  8002a9:	00 00 00 
+  8002ac:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002af:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  8002b6:	48 89 df             	mov    %rbx,%rdi
+  8002b9:	48 b8 23 03 80 00 00 	movabs $0x800323,%rax
+  8002c0:	00 00 00 
+  8002c3:	ff d0                	call   *%rax
+	cprintf("\n");
+  8002c5:	48 bf 37 1d 80 00 00 	movabs $0x801d37,%rdi
+  8002cc:	00 00 00 
+  8002cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d4:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002d7:	cc                   	int3
+	while (1)
+  8002d8:	eb fd                	jmp    8002d7 <_panic+0xef>
+
+00000000008002da <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002da:	55                   	push   %rbp
+  8002db:	48 89 e5             	mov    %rsp,%rbp
+  8002de:	53                   	push   %rbx
+  8002df:	48 83 ec 08          	sub    $0x8,%rsp
+  8002e3:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  8002e6:	8b 06                	mov    (%rsi),%eax
+  8002e8:	8d 50 01             	lea    0x1(%rax),%edx
+  8002eb:	89 16                	mov    %edx,(%rsi)
+  8002ed:	48 98                	cltq
+  8002ef:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  8002f4:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002fa:	74 0a                	je     800306 <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002fc:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800300:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800304:	c9                   	leave
+  800305:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800306:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80030a:	be ff 00 00 00       	mov    $0xff,%esi
+  80030f:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  800316:	00 00 00 
+  800319:	ff d0                	call   *%rax
+		b->idx = 0;
+  80031b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800321:	eb d9                	jmp    8002fc <putch+0x22>
+
+0000000000800323 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800323:	55                   	push   %rbp
+  800324:	48 89 e5             	mov    %rsp,%rbp
+  800327:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80032e:	48 89 fa             	mov    %rdi,%rdx
+  800331:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  800334:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  80033b:	00 00 00 
+	b.cnt = 0;
+  80033e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800345:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800348:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  80034f:	48 bf da 02 80 00 00 	movabs $0x8002da,%rdi
+  800356:	00 00 00 
+  800359:	48 b8 41 05 80 00 00 	movabs $0x800541,%rax
+  800360:	00 00 00 
+  800363:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  800365:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  80036c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800373:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  80037a:	00 00 00 
+  80037d:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  80037f:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  800385:	c9                   	leave
+  800386:	c3                   	ret
+
+0000000000800387 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800387:	55                   	push   %rbp
+  800388:	48 89 e5             	mov    %rsp,%rbp
+  80038b:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800392:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800399:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8003a0:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8003a7:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8003ae:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8003b5:	84 c0                	test   %al,%al
+  8003b7:	74 20                	je     8003d9 <cprintf+0x52>
+  8003b9:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8003bd:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8003c1:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8003c5:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8003c9:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8003cd:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8003d1:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8003d5:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8003d9:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  8003e0:	00 00 00 
+  8003e3:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8003ea:	00 00 00 
+  8003ed:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003f1:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8003f8:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8003ff:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  800406:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  80040d:	48 b8 23 03 80 00 00 	movabs $0x800323,%rax
+  800414:	00 00 00 
+  800417:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  800419:	c9                   	leave
+  80041a:	c3                   	ret
+
+000000000080041b <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80041b:	55                   	push   %rbp
+  80041c:	48 89 e5             	mov    %rsp,%rbp
+  80041f:	41 57                	push   %r15
+  800421:	41 56                	push   %r14
+  800423:	41 55                	push   %r13
+  800425:	41 54                	push   %r12
+  800427:	53                   	push   %rbx
+  800428:	48 83 ec 18          	sub    $0x18,%rsp
+  80042c:	49 89 fc             	mov    %rdi,%r12
+  80042f:	49 89 f5             	mov    %rsi,%r13
+  800432:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800436:	44 89 c3             	mov    %r8d,%ebx
+  800439:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80043c:	41 89 cf             	mov    %ecx,%r15d
+  80043f:	4c 39 fa             	cmp    %r15,%rdx
+  800442:	72 29                	jb     80046d <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800444:	48 89 d0             	mov    %rdx,%rax
+  800447:	ba 00 00 00 00       	mov    $0x0,%edx
+  80044c:	49 f7 f7             	div    %r15
+  80044f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800453:	48 89 c2             	mov    %rax,%rdx
+  800456:	48 b8 1b 04 80 00 00 	movabs $0x80041b,%rax
+  80045d:	00 00 00 
+  800460:	ff d0                	call   *%rax
+  800462:	eb 10                	jmp    800474 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800464:	4c 89 ee             	mov    %r13,%rsi
+  800467:	44 89 f7             	mov    %r14d,%edi
+  80046a:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  80046d:	83 eb 01             	sub    $0x1,%ebx
+  800470:	85 db                	test   %ebx,%ebx
+  800472:	7f f0                	jg     800464 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800474:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800478:	ba 00 00 00 00       	mov    $0x0,%edx
+  80047d:	49 f7 f7             	div    %r15
+  800480:	48 b8 6b 1d 80 00 00 	movabs $0x801d6b,%rax
+  800487:	00 00 00 
+  80048a:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  80048e:	4c 89 ee             	mov    %r13,%rsi
+  800491:	41 ff d4             	call   *%r12
+}
+  800494:	48 83 c4 18          	add    $0x18,%rsp
+  800498:	5b                   	pop    %rbx
+  800499:	41 5c                	pop    %r12
+  80049b:	41 5d                	pop    %r13
+  80049d:	41 5e                	pop    %r14
+  80049f:	41 5f                	pop    %r15
+  8004a1:	5d                   	pop    %rbp
+  8004a2:	c3                   	ret
+
+00000000008004a3 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  8004a3:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  8004a7:	48 8b 06             	mov    (%rsi),%rax
+  8004aa:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004ae:	73 0a                	jae    8004ba <sprintputch+0x17>
+		*b->buf++ = ch;
+  8004b0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004b4:	48 89 16             	mov    %rdx,(%rsi)
+  8004b7:	40 88 38             	mov    %dil,(%rax)
+}
+  8004ba:	c3                   	ret
+
+00000000008004bb <printfmt>:
+{
+  8004bb:	55                   	push   %rbp
+  8004bc:	48 89 e5             	mov    %rsp,%rbp
+  8004bf:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8004c6:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8004cd:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8004d4:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8004db:	84 c0                	test   %al,%al
+  8004dd:	74 20                	je     8004ff <printfmt+0x44>
+  8004df:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8004e3:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8004e7:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8004eb:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8004ef:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8004f3:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8004f7:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8004fb:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  8004ff:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800506:	00 00 00 
+  800509:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800510:	00 00 00 
+  800513:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800517:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80051e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800525:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80052c:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800533:	48 b8 41 05 80 00 00 	movabs $0x800541,%rax
+  80053a:	00 00 00 
+  80053d:	ff d0                	call   *%rax
+}
+  80053f:	c9                   	leave
+  800540:	c3                   	ret
+
+0000000000800541 <vprintfmt>:
+{
+  800541:	55                   	push   %rbp
+  800542:	48 89 e5             	mov    %rsp,%rbp
+  800545:	41 57                	push   %r15
+  800547:	41 56                	push   %r14
+  800549:	41 55                	push   %r13
+  80054b:	41 54                	push   %r12
+  80054d:	53                   	push   %rbx
+  80054e:	48 83 ec 48          	sub    $0x48,%rsp
+  800552:	49 89 fe             	mov    %rdi,%r14
+  800555:	49 89 f5             	mov    %rsi,%r13
+  800558:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  80055b:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  80055f:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  800563:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800567:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80056b:	eb 09                	jmp    800576 <vprintfmt+0x35>
+			putch(ch, putdat);
+  80056d:	4c 89 ee             	mov    %r13,%rsi
+  800570:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800573:	4c 89 e3             	mov    %r12,%rbx
+  800576:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80057a:	0f b6 3b             	movzbl (%rbx),%edi
+  80057d:	83 ff 25             	cmp    $0x25,%edi
+  800580:	74 13                	je     800595 <vprintfmt+0x54>
+			if (ch == '\0')
+  800582:	85 ff                	test   %edi,%edi
+  800584:	75 e7                	jne    80056d <vprintfmt+0x2c>
+}
+  800586:	48 83 c4 48          	add    $0x48,%rsp
+  80058a:	5b                   	pop    %rbx
+  80058b:	41 5c                	pop    %r12
+  80058d:	41 5d                	pop    %r13
+  80058f:	41 5e                	pop    %r14
+  800591:	41 5f                	pop    %r15
+  800593:	5d                   	pop    %rbp
+  800594:	c3                   	ret
+		padc = ' ';
+  800595:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  800599:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  8005a0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  8005a6:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  8005ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005b2:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005b7:	41 0f b6 14 24       	movzbl (%r12),%edx
+  8005bc:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  8005bf:	3c 55                	cmp    $0x55,%al
+  8005c1:	0f 87 4f 05 00 00    	ja     800b16 <vprintfmt+0x5d5>
+  8005c7:	0f b6 c0             	movzbl %al,%eax
+  8005ca:	48 be 40 1e 80 00 00 	movabs $0x801e40,%rsi
+  8005d1:	00 00 00 
+  8005d4:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  8005d7:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  8005da:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  8005de:	eb d2                	jmp    8005b2 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005e0:	49 89 dc             	mov    %rbx,%r12
+  8005e3:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  8005e7:	eb c9                	jmp    8005b2 <vprintfmt+0x71>
+  8005e9:	0f b6 d2             	movzbl %dl,%edx
+  8005ec:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  8005ef:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  8005f5:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  8005f9:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  8005fe:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  800603:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  800606:	83 f8 09             	cmp    $0x9,%eax
+  800609:	77 20                	ja     80062b <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  80060b:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  80060f:	eb e4                	jmp    8005f5 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  800611:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800614:	83 f8 2f             	cmp    $0x2f,%eax
+  800617:	77 27                	ja     800640 <vprintfmt+0xff>
+  800619:	89 c2                	mov    %eax,%edx
+  80061b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80061f:	83 c0 08             	add    $0x8,%eax
+  800622:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800625:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  800628:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  80062b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80062f:	79 81                	jns    8005b2 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  800631:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  800635:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80063b:	e9 72 ff ff ff       	jmp    8005b2 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  800640:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800644:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800648:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80064c:	eb d7                	jmp    800625 <vprintfmt+0xe4>
+			if (width < 0)
+  80064e:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  800651:	85 f6                	test   %esi,%esi
+  800653:	b8 00 00 00 00       	mov    $0x0,%eax
+  800658:	0f 49 c6             	cmovns %esi,%eax
+  80065b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80065e:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800661:	e9 4c ff ff ff       	jmp    8005b2 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800666:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  800669:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  800670:	e9 3d ff ff ff       	jmp    8005b2 <vprintfmt+0x71>
+			lflag++;
+  800675:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800678:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  80067b:	e9 32 ff ff ff       	jmp    8005b2 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  800680:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800683:	83 f8 2f             	cmp    $0x2f,%eax
+  800686:	77 19                	ja     8006a1 <vprintfmt+0x160>
+  800688:	89 c2                	mov    %eax,%edx
+  80068a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80068e:	83 c0 08             	add    $0x8,%eax
+  800691:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800694:	8b 3a                	mov    (%rdx),%edi
+  800696:	4c 89 ee             	mov    %r13,%rsi
+  800699:	41 ff d6             	call   *%r14
+			break;
+  80069c:	e9 d5 fe ff ff       	jmp    800576 <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  8006a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ad:	eb e5                	jmp    800694 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  8006af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b5:	77 5a                	ja     800711 <vprintfmt+0x1d0>
+  8006b7:	89 c2                	mov    %eax,%edx
+  8006b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006bd:	83 c0 08             	add    $0x8,%eax
+  8006c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  8006c3:	8b 02                	mov    (%rdx),%eax
+  8006c5:	89 c1                	mov    %eax,%ecx
+  8006c7:	f7 d9                	neg    %ecx
+  8006c9:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006cc:	83 f9 08             	cmp    $0x8,%ecx
+  8006cf:	7f 4e                	jg     80071f <vprintfmt+0x1de>
+  8006d1:	48 63 c1             	movslq %ecx,%rax
+  8006d4:	48 ba 00 21 80 00 00 	movabs $0x802100,%rdx
+  8006db:	00 00 00 
+  8006de:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006e2:	48 85 c0             	test   %rax,%rax
+  8006e5:	74 38                	je     80071f <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  8006e7:	48 89 c1             	mov    %rax,%rcx
+  8006ea:	48 ba 8c 1d 80 00 00 	movabs $0x801d8c,%rdx
+  8006f1:	00 00 00 
+  8006f4:	4c 89 ee             	mov    %r13,%rsi
+  8006f7:	4c 89 f7             	mov    %r14,%rdi
+  8006fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ff:	49 b8 bb 04 80 00 00 	movabs $0x8004bb,%r8
+  800706:	00 00 00 
+  800709:	41 ff d0             	call   *%r8
+  80070c:	e9 65 fe ff ff       	jmp    800576 <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  800711:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800715:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800719:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80071d:	eb a4                	jmp    8006c3 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  80071f:	48 ba 83 1d 80 00 00 	movabs $0x801d83,%rdx
+  800726:	00 00 00 
+  800729:	4c 89 ee             	mov    %r13,%rsi
+  80072c:	4c 89 f7             	mov    %r14,%rdi
+  80072f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800734:	49 b8 bb 04 80 00 00 	movabs $0x8004bb,%r8
+  80073b:	00 00 00 
+  80073e:	41 ff d0             	call   *%r8
+  800741:	e9 30 fe ff ff       	jmp    800576 <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800746:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800749:	83 f8 2f             	cmp    $0x2f,%eax
+  80074c:	77 36                	ja     800784 <vprintfmt+0x243>
+  80074e:	89 c2                	mov    %eax,%edx
+  800750:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800754:	83 c0 08             	add    $0x8,%eax
+  800757:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80075a:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  80075d:	48 85 c9             	test   %rcx,%rcx
+  800760:	48 b8 7c 1d 80 00 00 	movabs $0x801d7c,%rax
+  800767:	00 00 00 
+  80076a:	48 0f 45 c1          	cmovne %rcx,%rax
+  80076e:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800772:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800776:	7e 06                	jle    80077e <vprintfmt+0x23d>
+  800778:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  80077c:	75 14                	jne    800792 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80077e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800782:	eb 64                	jmp    8007e8 <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800784:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800788:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800790:	eb c8                	jmp    80075a <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800792:	49 63 f7             	movslq %r15d,%rsi
+  800795:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800799:	48 b8 24 0c 80 00 00 	movabs $0x800c24,%rax
+  8007a0:	00 00 00 
+  8007a3:	ff d0                	call   *%rax
+  8007a5:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007a8:	29 c1                	sub    %eax,%ecx
+  8007aa:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  8007ad:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  8007b0:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  8007b4:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007b7:	eb 0d                	jmp    8007c6 <vprintfmt+0x285>
+					putch(padc, putdat);
+  8007b9:	4c 89 ee             	mov    %r13,%rsi
+  8007bc:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  8007bf:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007c2:	41 83 ec 01          	sub    $0x1,%r12d
+  8007c6:	45 85 e4             	test   %r12d,%r12d
+  8007c9:	7f ee                	jg     8007b9 <vprintfmt+0x278>
+  8007cb:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  8007ce:	85 c9                	test   %ecx,%ecx
+  8007d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d5:	0f 49 c1             	cmovns %ecx,%eax
+  8007d8:	29 c1                	sub    %eax,%ecx
+  8007da:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  8007dd:	eb 9f                	jmp    80077e <vprintfmt+0x23d>
+					putch(ch, putdat);
+  8007df:	4c 89 ee             	mov    %r13,%rsi
+  8007e2:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007e5:	4c 89 e2             	mov    %r12,%rdx
+  8007e8:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8007ec:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007f2:	0f be f8             	movsbl %al,%edi
+  8007f5:	85 ff                	test   %edi,%edi
+  8007f7:	74 29                	je     800822 <vprintfmt+0x2e1>
+  8007f9:	45 85 ff             	test   %r15d,%r15d
+  8007fc:	78 06                	js     800804 <vprintfmt+0x2c3>
+  8007fe:	41 83 ef 01          	sub    $0x1,%r15d
+  800802:	78 1e                	js     800822 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800804:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  800808:	74 d5                	je     8007df <vprintfmt+0x29e>
+  80080a:	0f be c0             	movsbl %al,%eax
+  80080d:	83 e8 20             	sub    $0x20,%eax
+  800810:	83 f8 5e             	cmp    $0x5e,%eax
+  800813:	76 ca                	jbe    8007df <vprintfmt+0x29e>
+					putch('?', putdat);
+  800815:	4c 89 ee             	mov    %r13,%rsi
+  800818:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80081d:	41 ff d6             	call   *%r14
+  800820:	eb c3                	jmp    8007e5 <vprintfmt+0x2a4>
+  800822:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  800826:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800829:	41 01 c4             	add    %eax,%r12d
+  80082c:	41 29 d4             	sub    %edx,%r12d
+  80082f:	eb 0f                	jmp    800840 <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  800831:	4c 89 ee             	mov    %r13,%rsi
+  800834:	bf 20 00 00 00       	mov    $0x20,%edi
+  800839:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  80083c:	41 83 ec 01          	sub    $0x1,%r12d
+  800840:	45 85 e4             	test   %r12d,%r12d
+  800843:	7f ec                	jg     800831 <vprintfmt+0x2f0>
+  800845:	e9 2c fd ff ff       	jmp    800576 <vprintfmt+0x35>
+	if (lflag >= 2)
+  80084a:	83 f9 01             	cmp    $0x1,%ecx
+  80084d:	7f 1d                	jg     80086c <vprintfmt+0x32b>
+	else if (lflag)
+  80084f:	85 c9                	test   %ecx,%ecx
+  800851:	74 5e                	je     8008b1 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800853:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800856:	83 f8 2f             	cmp    $0x2f,%eax
+  800859:	77 48                	ja     8008a3 <vprintfmt+0x362>
+  80085b:	89 c2                	mov    %eax,%edx
+  80085d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800861:	83 c0 08             	add    $0x8,%eax
+  800864:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800867:	4c 8b 22             	mov    (%rdx),%r12
+  80086a:	eb 17                	jmp    800883 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  80086c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086f:	83 f8 2f             	cmp    $0x2f,%eax
+  800872:	77 21                	ja     800895 <vprintfmt+0x354>
+  800874:	89 c2                	mov    %eax,%edx
+  800876:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087a:	83 c0 08             	add    $0x8,%eax
+  80087d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800880:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800883:	4d 85 e4             	test   %r12,%r12
+  800886:	78 50                	js     8008d8 <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  800888:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  80088b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800890:	e9 b4 01 00 00       	jmp    800a49 <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800895:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800899:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a1:	eb dd                	jmp    800880 <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  8008a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008af:	eb b6                	jmp    800867 <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  8008b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b7:	77 11                	ja     8008ca <vprintfmt+0x389>
+  8008b9:	89 c2                	mov    %eax,%edx
+  8008bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008bf:	83 c0 08             	add    $0x8,%eax
+  8008c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c5:	4c 63 22             	movslq (%rdx),%r12
+  8008c8:	eb b9                	jmp    800883 <vprintfmt+0x342>
+  8008ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d6:	eb ed                	jmp    8008c5 <vprintfmt+0x384>
+				putch('-', putdat);
+  8008d8:	4c 89 ee             	mov    %r13,%rsi
+  8008db:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008e0:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  8008e3:	4c 89 e2             	mov    %r12,%rdx
+  8008e6:	48 f7 da             	neg    %rdx
+			base = 10;
+  8008e9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8008ee:	e9 56 01 00 00       	jmp    800a49 <vprintfmt+0x508>
+	if (lflag >= 2)
+  8008f3:	83 f9 01             	cmp    $0x1,%ecx
+  8008f6:	7f 25                	jg     80091d <vprintfmt+0x3dc>
+	else if (lflag)
+  8008f8:	85 c9                	test   %ecx,%ecx
+  8008fa:	74 5e                	je     80095a <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  8008fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ff:	83 f8 2f             	cmp    $0x2f,%eax
+  800902:	77 48                	ja     80094c <vprintfmt+0x40b>
+  800904:	89 c2                	mov    %eax,%edx
+  800906:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090a:	83 c0 08             	add    $0x8,%eax
+  80090d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800910:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800913:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  800918:	e9 2c 01 00 00       	jmp    800a49 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  80091d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800920:	83 f8 2f             	cmp    $0x2f,%eax
+  800923:	77 19                	ja     80093e <vprintfmt+0x3fd>
+  800925:	89 c2                	mov    %eax,%edx
+  800927:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092b:	83 c0 08             	add    $0x8,%eax
+  80092e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800931:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  800934:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  800939:	e9 0b 01 00 00       	jmp    800a49 <vprintfmt+0x508>
+  80093e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800942:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800946:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094a:	eb e5                	jmp    800931 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  80094c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800950:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800954:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800958:	eb b6                	jmp    800910 <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  80095a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095d:	83 f8 2f             	cmp    $0x2f,%eax
+  800960:	77 18                	ja     80097a <vprintfmt+0x439>
+  800962:	89 c2                	mov    %eax,%edx
+  800964:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800968:	83 c0 08             	add    $0x8,%eax
+  80096b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096e:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800970:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800975:	e9 cf 00 00 00       	jmp    800a49 <vprintfmt+0x508>
+  80097a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800982:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800986:	eb e6                	jmp    80096e <vprintfmt+0x42d>
+	if (lflag >= 2)
+  800988:	83 f9 01             	cmp    $0x1,%ecx
+  80098b:	7f 25                	jg     8009b2 <vprintfmt+0x471>
+	else if (lflag)
+  80098d:	85 c9                	test   %ecx,%ecx
+  80098f:	74 5b                	je     8009ec <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800991:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800994:	83 f8 2f             	cmp    $0x2f,%eax
+  800997:	77 45                	ja     8009de <vprintfmt+0x49d>
+  800999:	89 c2                	mov    %eax,%edx
+  80099b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099f:	83 c0 08             	add    $0x8,%eax
+  8009a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a5:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  8009a8:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  8009ad:	e9 97 00 00 00       	jmp    800a49 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8009b2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b8:	77 16                	ja     8009d0 <vprintfmt+0x48f>
+  8009ba:	89 c2                	mov    %eax,%edx
+  8009bc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c0:	83 c0 08             	add    $0x8,%eax
+  8009c3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c6:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  8009c9:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  8009ce:	eb 79                	jmp    800a49 <vprintfmt+0x508>
+  8009d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009dc:	eb e8                	jmp    8009c6 <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  8009de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ea:	eb b9                	jmp    8009a5 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  8009ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f2:	77 15                	ja     800a09 <vprintfmt+0x4c8>
+  8009f4:	89 c2                	mov    %eax,%edx
+  8009f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fa:	83 c0 08             	add    $0x8,%eax
+  8009fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a00:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  800a02:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  800a07:	eb 40                	jmp    800a49 <vprintfmt+0x508>
+  800a09:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a15:	eb e9                	jmp    800a00 <vprintfmt+0x4bf>
+			putch('0', putdat);
+  800a17:	4c 89 ee             	mov    %r13,%rsi
+  800a1a:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a1f:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  800a22:	4c 89 ee             	mov    %r13,%rsi
+  800a25:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a2a:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  800a2d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a30:	83 f8 2f             	cmp    $0x2f,%eax
+  800a33:	77 34                	ja     800a69 <vprintfmt+0x528>
+  800a35:	89 c2                	mov    %eax,%edx
+  800a37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3b:	83 c0 08             	add    $0x8,%eax
+  800a3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  800a41:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800a44:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  800a49:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800a4e:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a52:	4c 89 ee             	mov    %r13,%rsi
+  800a55:	4c 89 f7             	mov    %r14,%rdi
+  800a58:	48 b8 1b 04 80 00 00 	movabs $0x80041b,%rax
+  800a5f:	00 00 00 
+  800a62:	ff d0                	call   *%rax
+			break;
+  800a64:	e9 0d fb ff ff       	jmp    800576 <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  800a69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a75:	eb ca                	jmp    800a41 <vprintfmt+0x500>
+	if (lflag >= 2)
+  800a77:	83 f9 01             	cmp    $0x1,%ecx
+  800a7a:	7f 22                	jg     800a9e <vprintfmt+0x55d>
+	else if (lflag)
+  800a7c:	85 c9                	test   %ecx,%ecx
+  800a7e:	74 58                	je     800ad8 <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800a80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a83:	83 f8 2f             	cmp    $0x2f,%eax
+  800a86:	77 42                	ja     800aca <vprintfmt+0x589>
+  800a88:	89 c2                	mov    %eax,%edx
+  800a8a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8e:	83 c0 08             	add    $0x8,%eax
+  800a91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a94:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800a97:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800a9c:	eb ab                	jmp    800a49 <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800a9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa1:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa4:	77 16                	ja     800abc <vprintfmt+0x57b>
+  800aa6:	89 c2                	mov    %eax,%edx
+  800aa8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aac:	83 c0 08             	add    $0x8,%eax
+  800aaf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab2:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800ab5:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  800aba:	eb 8d                	jmp    800a49 <vprintfmt+0x508>
+  800abc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac8:	eb e8                	jmp    800ab2 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  800aca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ace:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad6:	eb bc                	jmp    800a94 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  800ad8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800adb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ade:	77 18                	ja     800af8 <vprintfmt+0x5b7>
+  800ae0:	89 c2                	mov    %eax,%edx
+  800ae2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae6:	83 c0 08             	add    $0x8,%eax
+  800ae9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aec:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  800aee:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  800af3:	e9 51 ff ff ff       	jmp    800a49 <vprintfmt+0x508>
+  800af8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800afc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b04:	eb e6                	jmp    800aec <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  800b06:	4c 89 ee             	mov    %r13,%rsi
+  800b09:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b0e:	41 ff d6             	call   *%r14
+			break;
+  800b11:	e9 60 fa ff ff       	jmp    800576 <vprintfmt+0x35>
+			putch('%', putdat);
+  800b16:	4c 89 ee             	mov    %r13,%rsi
+  800b19:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b1e:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b21:	4c 89 e3             	mov    %r12,%rbx
+  800b24:	eb 04                	jmp    800b2a <vprintfmt+0x5e9>
+  800b26:	48 83 eb 01          	sub    $0x1,%rbx
+  800b2a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b2e:	75 f6                	jne    800b26 <vprintfmt+0x5e5>
+  800b30:	e9 41 fa ff ff       	jmp    800576 <vprintfmt+0x35>
+
+0000000000800b35 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b35:	55                   	push   %rbp
+  800b36:	48 89 e5             	mov    %rsp,%rbp
+  800b39:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b3d:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  800b41:	48 63 c6             	movslq %esi,%rax
+  800b44:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  800b49:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800b4d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800b54:	48 85 ff             	test   %rdi,%rdi
+  800b57:	74 2a                	je     800b83 <vsnprintf+0x4e>
+  800b59:	85 f6                	test   %esi,%esi
+  800b5b:	7e 26                	jle    800b83 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b5d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800b61:	48 bf a3 04 80 00 00 	movabs $0x8004a3,%rdi
+  800b68:	00 00 00 
+  800b6b:	48 b8 41 05 80 00 00 	movabs $0x800541,%rax
+  800b72:	00 00 00 
+  800b75:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b77:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800b7b:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800b7e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800b81:	c9                   	leave
+  800b82:	c3                   	ret
+		return -E_INVAL;
+  800b83:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b88:	eb f7                	jmp    800b81 <vsnprintf+0x4c>
+
+0000000000800b8a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b8a:	55                   	push   %rbp
+  800b8b:	48 89 e5             	mov    %rsp,%rbp
+  800b8e:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800b95:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800b9c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800ba3:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800baa:	84 c0                	test   %al,%al
+  800bac:	74 20                	je     800bce <snprintf+0x44>
+  800bae:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800bb2:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800bb6:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800bba:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800bbe:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800bc2:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800bc6:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800bca:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800bce:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800bd5:	00 00 00 
+  800bd8:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800bdf:	00 00 00 
+  800be2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800be6:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800bed:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800bf4:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800bfb:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800c02:	48 b8 35 0b 80 00 00 	movabs $0x800b35,%rax
+  800c09:	00 00 00 
+  800c0c:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800c0e:	c9                   	leave
+  800c0f:	c3                   	ret
+
+0000000000800c10 <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800c10:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c15:	48 89 d0             	mov    %rdx,%rax
+  800c18:	48 83 c2 01          	add    $0x1,%rdx
+  800c1c:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800c21:	75 f2                	jne    800c15 <strlen+0x5>
+		n++;
+	return n;
+}
+  800c23:	c3                   	ret
+
+0000000000800c24 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c29:	eb 03                	jmp    800c2e <strnlen+0xa>
+  800c2b:	48 89 d0             	mov    %rdx,%rax
+  800c2e:	48 39 c6             	cmp    %rax,%rsi
+  800c31:	74 0a                	je     800c3d <strnlen+0x19>
+  800c33:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c37:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c3b:	75 ee                	jne    800c2b <strnlen+0x7>
+		n++;
+	return n;
+}
+  800c3d:	c3                   	ret
+
+0000000000800c3e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800c3e:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800c41:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c46:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c4a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c4d:	48 83 c2 01          	add    $0x1,%rdx
+  800c51:	84 c9                	test   %cl,%cl
+  800c53:	75 f1                	jne    800c46 <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800c55:	c3                   	ret
+
+0000000000800c56 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c56:	55                   	push   %rbp
+  800c57:	48 89 e5             	mov    %rsp,%rbp
+  800c5a:	41 54                	push   %r12
+  800c5c:	53                   	push   %rbx
+  800c5d:	48 89 fb             	mov    %rdi,%rbx
+  800c60:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800c63:	48 b8 10 0c 80 00 00 	movabs $0x800c10,%rax
+  800c6a:	00 00 00 
+  800c6d:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800c6f:	48 63 f8             	movslq %eax,%rdi
+  800c72:	48 01 df             	add    %rbx,%rdi
+  800c75:	4c 89 e6             	mov    %r12,%rsi
+  800c78:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  800c7f:	00 00 00 
+  800c82:	ff d0                	call   *%rax
+	return dst;
+}
+  800c84:	48 89 d8             	mov    %rbx,%rax
+  800c87:	5b                   	pop    %rbx
+  800c88:	41 5c                	pop    %r12
+  800c8a:	5d                   	pop    %rbp
+  800c8b:	c3                   	ret
+
+0000000000800c8c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c8c:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c8f:	48 01 fa             	add    %rdi,%rdx
+  800c92:	48 89 f9             	mov    %rdi,%rcx
+  800c95:	eb 14                	jmp    800cab <strncpy+0x1f>
+		*dst++ = *src;
+  800c97:	48 83 c1 01          	add    $0x1,%rcx
+  800c9b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c9f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ca3:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ca7:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800cab:	48 39 d1             	cmp    %rdx,%rcx
+  800cae:	75 e7                	jne    800c97 <strncpy+0xb>
+	}
+	return ret;
+}
+  800cb0:	c3                   	ret
+
+0000000000800cb1 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800cb1:	48 89 f8             	mov    %rdi,%rax
+  800cb4:	48 85 d2             	test   %rdx,%rdx
+  800cb7:	74 27                	je     800ce0 <strlcpy+0x2f>
+  800cb9:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800cbe:	48 89 fa             	mov    %rdi,%rdx
+  800cc1:	eb 0b                	jmp    800cce <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800cc3:	48 83 c6 01          	add    $0x1,%rsi
+  800cc7:	48 83 c2 01          	add    $0x1,%rdx
+  800ccb:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800cce:	48 39 c2             	cmp    %rax,%rdx
+  800cd1:	74 0a                	je     800cdd <strlcpy+0x2c>
+  800cd3:	0f b6 0e             	movzbl (%rsi),%ecx
+  800cd6:	84 c9                	test   %cl,%cl
+  800cd8:	75 e9                	jne    800cc3 <strlcpy+0x12>
+  800cda:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800cdd:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800ce0:	48 29 f8             	sub    %rdi,%rax
+}
+  800ce3:	c3                   	ret
+
+0000000000800ce4 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800ce4:	eb 08                	jmp    800cee <strcmp+0xa>
+		p++, q++;
+  800ce6:	48 83 c7 01          	add    $0x1,%rdi
+  800cea:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800cee:	0f b6 07             	movzbl (%rdi),%eax
+  800cf1:	84 c0                	test   %al,%al
+  800cf3:	74 04                	je     800cf9 <strcmp+0x15>
+  800cf5:	3a 06                	cmp    (%rsi),%al
+  800cf7:	74 ed                	je     800ce6 <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cf9:	0f b6 c0             	movzbl %al,%eax
+  800cfc:	0f b6 16             	movzbl (%rsi),%edx
+  800cff:	29 d0                	sub    %edx,%eax
+}
+  800d01:	c3                   	ret
+
+0000000000800d02 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800d02:	eb 0c                	jmp    800d10 <strncmp+0xe>
+		n--, p++, q++;
+  800d04:	48 83 ea 01          	sub    $0x1,%rdx
+  800d08:	48 83 c7 01          	add    $0x1,%rdi
+  800d0c:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800d10:	48 85 d2             	test   %rdx,%rdx
+  800d13:	74 14                	je     800d29 <strncmp+0x27>
+  800d15:	0f b6 07             	movzbl (%rdi),%eax
+  800d18:	84 c0                	test   %al,%al
+  800d1a:	74 04                	je     800d20 <strncmp+0x1e>
+  800d1c:	3a 06                	cmp    (%rsi),%al
+  800d1e:	74 e4                	je     800d04 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d20:	0f b6 07             	movzbl (%rdi),%eax
+  800d23:	0f b6 16             	movzbl (%rsi),%edx
+  800d26:	29 d0                	sub    %edx,%eax
+}
+  800d28:	c3                   	ret
+		return 0;
+  800d29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d2e:	c3                   	ret
+
+0000000000800d2f <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800d2f:	eb 04                	jmp    800d35 <strchr+0x6>
+  800d31:	48 83 c7 01          	add    $0x1,%rdi
+  800d35:	0f b6 07             	movzbl (%rdi),%eax
+  800d38:	84 c0                	test   %al,%al
+  800d3a:	74 09                	je     800d45 <strchr+0x16>
+		if (*s == c)
+  800d3c:	40 38 f0             	cmp    %sil,%al
+  800d3f:	75 f0                	jne    800d31 <strchr+0x2>
+  800d41:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800d44:	c3                   	ret
+	return 0;
+  800d45:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d4a:	c3                   	ret
+
+0000000000800d4b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d4b:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800d4e:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800d51:	40 38 f2             	cmp    %sil,%dl
+  800d54:	74 0a                	je     800d60 <strfind+0x15>
+  800d56:	84 d2                	test   %dl,%dl
+  800d58:	74 06                	je     800d60 <strfind+0x15>
+	for (; *s; s++)
+  800d5a:	48 83 c0 01          	add    $0x1,%rax
+  800d5e:	eb ee                	jmp    800d4e <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800d60:	c3                   	ret
+
+0000000000800d61 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800d61:	48 85 d2             	test   %rdx,%rdx
+  800d64:	74 28                	je     800d8e <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800d66:	48 89 f8             	mov    %rdi,%rax
+  800d69:	48 09 d0             	or     %rdx,%rax
+  800d6c:	a8 03                	test   $0x3,%al
+  800d6e:	75 16                	jne    800d86 <memset+0x25>
+		c &= 0xFF;
+  800d70:	40 0f b6 f6          	movzbl %sil,%esi
+  800d74:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d7a:	48 89 d1             	mov    %rdx,%rcx
+  800d7d:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800d81:	fc                   	cld
+  800d82:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800d84:	eb 08                	jmp    800d8e <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d86:	89 f0                	mov    %esi,%eax
+  800d88:	48 89 d1             	mov    %rdx,%rcx
+  800d8b:	fc                   	cld
+  800d8c:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d8e:	48 89 f8             	mov    %rdi,%rax
+  800d91:	c3                   	ret
+
+0000000000800d92 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d92:	48 89 f8             	mov    %rdi,%rax
+  800d95:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d98:	48 39 fe             	cmp    %rdi,%rsi
+  800d9b:	73 3a                	jae    800dd7 <memmove+0x45>
+  800d9d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800da1:	48 39 d7             	cmp    %rdx,%rdi
+  800da4:	73 31                	jae    800dd7 <memmove+0x45>
+		s += n;
+		d += n;
+  800da6:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800daa:	48 89 d6             	mov    %rdx,%rsi
+  800dad:	48 09 fe             	or     %rdi,%rsi
+  800db0:	48 09 ce             	or     %rcx,%rsi
+  800db3:	40 f6 c6 03          	test   $0x3,%sil
+  800db7:	75 11                	jne    800dca <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800db9:	48 83 ef 04          	sub    $0x4,%rdi
+  800dbd:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800dc1:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800dc5:	fd                   	std
+  800dc6:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800dc8:	eb 0b                	jmp    800dd5 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800dca:	48 83 ef 01          	sub    $0x1,%rdi
+  800dce:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800dd2:	fd                   	std
+  800dd3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800dd5:	fc                   	cld
+  800dd6:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800dd7:	48 89 f2             	mov    %rsi,%rdx
+  800dda:	48 09 c2             	or     %rax,%rdx
+  800ddd:	48 09 ca             	or     %rcx,%rdx
+  800de0:	f6 c2 03             	test   $0x3,%dl
+  800de3:	75 0b                	jne    800df0 <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800de5:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800de9:	48 89 c7             	mov    %rax,%rdi
+  800dec:	fc                   	cld
+  800ded:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800def:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800df0:	48 89 c7             	mov    %rax,%rdi
+  800df3:	fc                   	cld
+  800df4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800df6:	c3                   	ret
+
+0000000000800df7 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800df7:	55                   	push   %rbp
+  800df8:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800dfb:	48 b8 92 0d 80 00 00 	movabs $0x800d92,%rax
+  800e02:	00 00 00 
+  800e05:	ff d0                	call   *%rax
+}
+  800e07:	5d                   	pop    %rbp
+  800e08:	c3                   	ret
+
+0000000000800e09 <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800e09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0e:	48 39 c2             	cmp    %rax,%rdx
+  800e11:	74 1e                	je     800e31 <memcmp+0x28>
+		if (*s1 != *s2)
+  800e13:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e17:	48 83 c0 01          	add    $0x1,%rax
+  800e1b:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800e21:	44 38 c1             	cmp    %r8b,%cl
+  800e24:	74 e8                	je     800e0e <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800e26:	0f b6 c1             	movzbl %cl,%eax
+  800e29:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e2d:	44 29 c0             	sub    %r8d,%eax
+  800e30:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800e31:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e36:	c3                   	ret
+
+0000000000800e37 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e37:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800e3a:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800e3d:	eb 04                	jmp    800e43 <memfind+0xc>
+  800e3f:	48 83 c0 01          	add    $0x1,%rax
+  800e43:	48 39 d0             	cmp    %rdx,%rax
+  800e46:	73 05                	jae    800e4d <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e48:	40 38 30             	cmp    %sil,(%rax)
+  800e4b:	75 f2                	jne    800e3f <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800e4d:	c3                   	ret
+
+0000000000800e4e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e4e:	48 89 f9             	mov    %rdi,%rcx
+  800e51:	49 89 f0             	mov    %rsi,%r8
+  800e54:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e56:	eb 04                	jmp    800e5c <strtol+0xe>
+		s++;
+  800e58:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800e5c:	0f b6 01             	movzbl (%rcx),%eax
+  800e5f:	3c 20                	cmp    $0x20,%al
+  800e61:	74 f5                	je     800e58 <strtol+0xa>
+  800e63:	3c 09                	cmp    $0x9,%al
+  800e65:	74 f1                	je     800e58 <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e67:	3c 2b                	cmp    $0x2b,%al
+  800e69:	74 2b                	je     800e96 <strtol+0x48>
+	int neg = 0;
+  800e6b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800e71:	3c 2d                	cmp    $0x2d,%al
+  800e73:	74 2d                	je     800ea2 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e75:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800e7b:	75 0f                	jne    800e8c <strtol+0x3e>
+  800e7d:	80 39 30             	cmpb   $0x30,(%rcx)
+  800e80:	74 2c                	je     800eae <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e82:	85 ff                	test   %edi,%edi
+  800e84:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e89:	0f 44 f8             	cmove  %eax,%edi
+  800e8c:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800e91:	4c 63 d7             	movslq %edi,%r10
+  800e94:	eb 4f                	jmp    800ee5 <strtol+0x97>
+		s++;
+  800e96:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800e9a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800ea0:	eb d3                	jmp    800e75 <strtol+0x27>
+		s++, neg = 1;
+  800ea2:	48 83 c1 01          	add    $0x1,%rcx
+  800ea6:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800eac:	eb c7                	jmp    800e75 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800eae:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800eb2:	74 0f                	je     800ec3 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800eb4:	85 ff                	test   %edi,%edi
+  800eb6:	75 d4                	jne    800e8c <strtol+0x3e>
+		s++, base = 8;
+  800eb8:	48 83 c1 01          	add    $0x1,%rcx
+  800ebc:	bf 08 00 00 00       	mov    $0x8,%edi
+  800ec1:	eb c9                	jmp    800e8c <strtol+0x3e>
+		s += 2, base = 16;
+  800ec3:	48 83 c1 02          	add    $0x2,%rcx
+  800ec7:	bf 10 00 00 00       	mov    $0x10,%edi
+  800ecc:	eb be                	jmp    800e8c <strtol+0x3e>
+			dig = *s - '0';
+  800ece:	0f be c0             	movsbl %al,%eax
+  800ed1:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800ed4:	39 f8                	cmp    %edi,%eax
+  800ed6:	7d 3b                	jge    800f13 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800ed8:	48 83 c1 01          	add    $0x1,%rcx
+  800edc:	49 0f af d2          	imul   %r10,%rdx
+  800ee0:	48 98                	cltq
+  800ee2:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800ee5:	0f b6 01             	movzbl (%rcx),%eax
+  800ee8:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800eeb:	40 80 fe 09          	cmp    $0x9,%sil
+  800eef:	76 dd                	jbe    800ece <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800ef1:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800ef4:	40 80 fe 19          	cmp    $0x19,%sil
+  800ef8:	77 08                	ja     800f02 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800efa:	0f be c0             	movsbl %al,%eax
+  800efd:	83 e8 57             	sub    $0x57,%eax
+  800f00:	eb d2                	jmp    800ed4 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f02:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800f05:	40 80 fe 19          	cmp    $0x19,%sil
+  800f09:	77 08                	ja     800f13 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800f0b:	0f be c0             	movsbl %al,%eax
+  800f0e:	83 e8 37             	sub    $0x37,%eax
+  800f11:	eb c1                	jmp    800ed4 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800f13:	4d 85 c0             	test   %r8,%r8
+  800f16:	74 03                	je     800f1b <strtol+0xcd>
+		*endptr = (char *) s;
+  800f18:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800f1b:	48 89 d0             	mov    %rdx,%rax
+  800f1e:	48 f7 d8             	neg    %rax
+  800f21:	45 85 c9             	test   %r9d,%r9d
+  800f24:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800f28:	48 89 d0             	mov    %rdx,%rax
+  800f2b:	c3                   	ret
+
+0000000000800f2c <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800f2c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f32:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800f38:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f42:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800f44:	c3                   	ret
+
+0000000000800f45 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800f45:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f4b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f51:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f56:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f5b:	48 89 fe             	mov    %rdi,%rsi
+  800f5e:	48 89 fa             	mov    %rdi,%rdx
+  800f61:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f63:	c3                   	ret
+
+0000000000800f64 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800f64:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800f67:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f6d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f73:	be 00 00 00 00       	mov    $0x0,%esi
+  800f78:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f7d:	48 89 f2             	mov    %rsi,%rdx
+  800f80:	0f 05                	syscall
+	if(check && ret > 0)
+  800f82:	48 85 c0             	test   %rax,%rax
+  800f85:	7f 01                	jg     800f88 <sys_env_destroy+0x24>
+}
+  800f87:	c3                   	ret
+{
+  800f88:	55                   	push   %rbp
+  800f89:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f8c:	49 89 c0             	mov    %rax,%r8
+  800f8f:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800f94:	48 ba 48 21 80 00 00 	movabs $0x802148,%rdx
+  800f9b:	00 00 00 
+  800f9e:	be 28 00 00 00       	mov    $0x28,%esi
+  800fa3:	48 bf 65 21 80 00 00 	movabs $0x802165,%rdi
+  800faa:	00 00 00 
+  800fad:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb2:	49 b9 e8 01 80 00 00 	movabs $0x8001e8,%r9
+  800fb9:	00 00 00 
+  800fbc:	41 ff d1             	call   *%r9
+
+0000000000800fbf <sys_getenvid>:
+  800fbf:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800fc6:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800fc7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800fcc:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800fd0:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800fd4:	48 c1 e2 04          	shl    $0x4,%rdx
+  800fd8:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800fdf:	00 00 00 
+  800fe2:	48 01 d0             	add    %rdx,%rax
+  800fe5:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800feb:	c3                   	ret
+
+0000000000800fec <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800fec:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800ff2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800ff8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ffd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801002:	48 89 fe             	mov    %rdi,%rsi
+  801005:	48 89 fa             	mov    %rdi,%rdx
+  801008:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80100a:	c3                   	ret
+
+000000000080100b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  80100b:	48 63 d2             	movslq %edx,%rdx
+  80100e:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801011:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801017:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80101d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801022:	0f 05                	syscall
+	if(check && ret > 0)
+  801024:	48 85 c0             	test   %rax,%rax
+  801027:	7f 01                	jg     80102a <sys_page_alloc+0x1f>
+}
+  801029:	c3                   	ret
+{
+  80102a:	55                   	push   %rbp
+  80102b:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80102e:	49 89 c0             	mov    %rax,%r8
+  801031:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801036:	48 ba 48 21 80 00 00 	movabs $0x802148,%rdx
+  80103d:	00 00 00 
+  801040:	be 28 00 00 00       	mov    $0x28,%esi
+  801045:	48 bf 65 21 80 00 00 	movabs $0x802165,%rdi
+  80104c:	00 00 00 
+  80104f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801054:	49 b9 e8 01 80 00 00 	movabs $0x8001e8,%r9
+  80105b:	00 00 00 
+  80105e:	41 ff d1             	call   *%r9
+
+0000000000801061 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  801061:	48 63 d2             	movslq %edx,%rdx
+  801064:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801067:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80106d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801073:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801078:	0f 05                	syscall
+	if(check && ret > 0)
+  80107a:	48 85 c0             	test   %rax,%rax
+  80107d:	7f 01                	jg     801080 <sys_page_alloc_huge+0x1f>
+}
+  80107f:	c3                   	ret
+{
+  801080:	55                   	push   %rbp
+  801081:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801084:	49 89 c0             	mov    %rax,%r8
+  801087:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80108c:	48 ba 48 21 80 00 00 	movabs $0x802148,%rdx
+  801093:	00 00 00 
+  801096:	be 28 00 00 00       	mov    $0x28,%esi
+  80109b:	48 bf 65 21 80 00 00 	movabs $0x802165,%rdi
+  8010a2:	00 00 00 
+  8010a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010aa:	49 b9 e8 01 80 00 00 	movabs $0x8001e8,%r9
+  8010b1:	00 00 00 
+  8010b4:	41 ff d1             	call   *%r9
+
+00000000008010b7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8010b7:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  8010ba:	48 63 d2             	movslq %edx,%rdx
+  8010bd:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  8010c0:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  8010c3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010c8:	0f 05                	syscall
+	if(check && ret > 0)
+  8010ca:	48 85 c0             	test   %rax,%rax
+  8010cd:	7f 01                	jg     8010d0 <sys_page_map+0x19>
+}
+  8010cf:	c3                   	ret
+{
+  8010d0:	55                   	push   %rbp
+  8010d1:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d4:	49 89 c0             	mov    %rax,%r8
+  8010d7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8010dc:	48 ba 48 21 80 00 00 	movabs $0x802148,%rdx
+  8010e3:	00 00 00 
+  8010e6:	be 28 00 00 00       	mov    $0x28,%esi
+  8010eb:	48 bf 65 21 80 00 00 	movabs $0x802165,%rdi
+  8010f2:	00 00 00 
+  8010f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010fa:	49 b9 e8 01 80 00 00 	movabs $0x8001e8,%r9
+  801101:	00 00 00 
+  801104:	41 ff d1             	call   *%r9
+
+0000000000801107 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  801107:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80110a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801110:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801116:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801120:	0f 05                	syscall
+	if(check && ret > 0)
+  801122:	48 85 c0             	test   %rax,%rax
+  801125:	7f 01                	jg     801128 <sys_page_unmap+0x21>
+}
+  801127:	c3                   	ret
+{
+  801128:	55                   	push   %rbp
+  801129:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80112c:	49 89 c0             	mov    %rax,%r8
+  80112f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801134:	48 ba 48 21 80 00 00 	movabs $0x802148,%rdx
+  80113b:	00 00 00 
+  80113e:	be 28 00 00 00       	mov    $0x28,%esi
+  801143:	48 bf 65 21 80 00 00 	movabs $0x802165,%rdi
+  80114a:	00 00 00 
+  80114d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801152:	49 b9 e8 01 80 00 00 	movabs $0x8001e8,%r9
+  801159:	00 00 00 
+  80115c:	41 ff d1             	call   *%r9
+
+000000000080115f <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  80115f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801165:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80116b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801170:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801175:	48 89 fe             	mov    %rdi,%rsi
+  801178:	48 89 fa             	mov    %rdi,%rdx
+  80117b:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80117d:	c3                   	ret
+
+000000000080117e <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  80117e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801184:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80118a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80118f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801194:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  801196:	c3                   	ret
+
+0000000000801197 <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  801197:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80119d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011a3:	b8 11 00 00 00       	mov    $0x11,%eax
+  8011a8:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  8011aa:	c3                   	ret
+
+00000000008011ab <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  8011ab:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  8011ae:	48 63 f6             	movslq %esi,%rsi
+  8011b1:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  8011b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011ba:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011bf:	0f 05                	syscall
+	if(check && ret > 0)
+  8011c1:	48 85 c0             	test   %rax,%rax
+  8011c4:	7f 01                	jg     8011c7 <sys_page_batch+0x1c>
+}
+  8011c6:	c3                   	ret
+{
+  8011c7:	55                   	push   %rbp
+  8011c8:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011cb:	49 89 c0             	mov    %rax,%r8
+  8011ce:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8011d3:	48 ba 48 21 80 00 00 	movabs $0x802148,%rdx
+  8011da:	00 00 00 
+  8011dd:	be 28 00 00 00       	mov    $0x28,%esi
+  8011e2:	48 bf 65 21 80 00 00 	movabs $0x802165,%rdi
+  8011e9:	00 00 00 
+  8011ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f1:	49 b9 e8 01 80 00 00 	movabs $0x8001e8,%r9
+  8011f8:	00 00 00 
+  8011fb:	41 ff d1             	call   *%r9
+
+00000000008011fe <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  8011fe:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801204:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80120a:	be 00 00 00 00       	mov    $0x0,%esi
+  80120f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801214:	48 89 f2             	mov    %rsi,%rdx
+  801217:	0f 05                	syscall
+	if(check && ret > 0)
+  801219:	48 85 c0             	test   %rax,%rax
+  80121c:	7f 01                	jg     80121f <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  80121e:	c3                   	ret
+{
+  80121f:	55                   	push   %rbp
+  801220:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801223:	49 89 c0             	mov    %rax,%r8
+  801226:	b9 13 00 00 00       	mov    $0x13,%ecx
+  80122b:	48 ba 48 21 80 00 00 	movabs $0x802148,%rdx
+  801232:	00 00 00 
+  801235:	be 28 00 00 00       	mov    $0x28,%esi
+  80123a:	48 bf 65 21 80 00 00 	movabs $0x802165,%rdi
+  801241:	00 00 00 
+  801244:	b8 00 00 00 00       	mov    $0x0,%eax
+  801249:	49 b9 e8 01 80 00 00 	movabs $0x8001e8,%r9
+  801250:	00 00 00 
+  801253:	41 ff d1             	call   *%r9
+
+0000000000801256 <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  801256:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80125c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801262:	bf 00 00 00 00       	mov    $0x0,%edi
+  801267:	b8 14 00 00 00       	mov    $0x14,%eax
+  80126c:	48 89 fe             	mov    %rdi,%rsi
+  80126f:	48 89 fa             	mov    %rdi,%rdx
+  801272:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801274:	c3                   	ret
+
+0000000000801275 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  801275:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801278:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80127e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801284:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801289:	0f 05                	syscall
+	if(check && ret > 0)
+  80128b:	48 85 c0             	test   %rax,%rax
+  80128e:	7f 01                	jg     801291 <sys_page_unmap_range+0x1c>
+}
+  801290:	c3                   	ret
+{
+  801291:	55                   	push   %rbp
+  801292:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801295:	49 89 c0             	mov    %rax,%r8
+  801298:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80129d:	48 ba 48 21 80 00 00 	movabs $0x802148,%rdx
+  8012a4:	00 00 00 
+  8012a7:	be 28 00 00 00       	mov    $0x28,%esi
+  8012ac:	48 bf 65 21 80 00 00 	movabs $0x802165,%rdi
+  8012b3:	00 00 00 
+  8012b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012bb:	49 b9 e8 01 80 00 00 	movabs $0x8001e8,%r9
+  8012c2:	00 00 00 
+  8012c5:	41 ff d1             	call   *%r9
+
+00000000008012c8 <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8012c8:	48 63 f6             	movslq %esi,%rsi
+  8012cb:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8012ce:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8012d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8012da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012df:	b8 08 00 00 00       	mov    $0x8,%eax
+  8012e4:	0f 05                	syscall
+	if(check && ret > 0)
+  8012e6:	48 85 c0             	test   %rax,%rax
+  8012e9:	7f 01                	jg     8012ec <sys_env_set_status+0x24>
+}
+  8012eb:	c3                   	ret
+{
+  8012ec:	55                   	push   %rbp
+  8012ed:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012f0:	49 89 c0             	mov    %rax,%r8
+  8012f3:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8012f8:	48 ba 48 21 80 00 00 	movabs $0x802148,%rdx
+  8012ff:	00 00 00 
+  801302:	be 28 00 00 00       	mov    $0x28,%esi
+  801307:	48 bf 65 21 80 00 00 	movabs $0x802165,%rdi
+  80130e:	00 00 00 
+  801311:	b8 00 00 00 00       	mov    $0x0,%eax
+  801316:	49 b9 e8 01 80 00 00 	movabs $0x8001e8,%r9
+  80131d:	00 00 00 
+  801320:	41 ff d1             	call   *%r9
+
+0000000000801323 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  801323:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801326:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  80132c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801332:	ba 00 00 00 00       	mov    $0x0,%edx
+  801337:	b8 09 00 00 00       	mov    $0x9,%eax
+  80133c:	0f 05                	syscall
+	if(check && ret > 0)
+  80133e:	48 85 c0             	test   %rax,%rax
+  801341:	7f 01                	jg     801344 <sys_env_set_pgfault_upcall+0x21>
+}
+  801343:	c3                   	ret
+{
+  801344:	55                   	push   %rbp
+  801345:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801348:	49 89 c0             	mov    %rax,%r8
+  80134b:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801350:	48 ba 48 21 80 00 00 	movabs $0x802148,%rdx
+  801357:	00 00 00 
+  80135a:	be 28 00 00 00       	mov    $0x28,%esi
+  80135f:	48 bf 65 21 80 00 00 	movabs $0x802165,%rdi
+  801366:	00 00 00 
+  801369:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136e:	49 b9 e8 01 80 00 00 	movabs $0x8001e8,%r9
+  801375:	00 00 00 
+  801378:	41 ff d1             	call   *%r9
+
+000000000080137b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80137b:	48 63 ff             	movslq %edi,%rdi
+  80137e:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  801381:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801387:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80138c:	0f 05                	syscall
+}
+  80138e:	c3                   	ret
+
+000000000080138f <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  80138f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801395:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80139b:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013a5:	48 89 f2             	mov    %rsi,%rdx
+  8013a8:	0f 05                	syscall
+	if(check && ret > 0)
+  8013aa:	48 85 c0             	test   %rax,%rax
+  8013ad:	7f 01                	jg     8013b0 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  8013af:	c3                   	ret
+{
+  8013b0:	55                   	push   %rbp
+  8013b1:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013b4:	49 89 c0             	mov    %rax,%r8
+  8013b7:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8013bc:	48 ba 48 21 80 00 00 	movabs $0x802148,%rdx
+  8013c3:	00 00 00 
+  8013c6:	be 28 00 00 00       	mov    $0x28,%esi
+  8013cb:	48 bf 65 21 80 00 00 	movabs $0x802165,%rdi
+  8013d2:	00 00 00 
+  8013d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013da:	49 b9 e8 01 80 00 00 	movabs $0x8001e8,%r9
+  8013e1:	00 00 00 
+  8013e4:	41 ff d1             	call   *%r9
+
+00000000008013e7 <pgfault>:
+- unmap PFTEMP using sys_page_unmap()
+- panic if any step fails
+*/
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8013e7:	55                   	push   %rbp
+  8013e8:	48 89 e5             	mov    %rsp,%rbp
+  8013eb:	53                   	push   %rbx
+  8013ec:	48 83 ec 08          	sub    $0x8,%rsp
+	void *addr = (void *) utf->utf_fault_va;
+  8013f0:	48 8b 1f             	mov    (%rdi),%rbx
+	uint32_t err = utf->utf_err;
+  8013f3:	48 8b 47 08          	mov    0x8(%rdi),%rax
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+
+	if (!(err & FEC_WR)) {
+  8013f7:	a8 02                	test   $0x2,%al
+  8013f9:	0f 84 b1 00 00 00    	je     8014b0 <pgfault+0xc9>
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+	}
+	pte_t pte = uvpt[PGNUM(addr)];
+  8013ff:	48 89 da             	mov    %rbx,%rdx
+  801402:	48 c1 ea 0c          	shr    $0xc,%rdx
+  801406:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80140d:	01 00 00 
+  801410:	48 8b 0c d0          	mov    (%rax,%rdx,8),%rcx
+	if (!(pte & PTE_COW)) {
+  801414:	f6 c5 08             	test   $0x8,%ch
+  801417:	0f 84 c3 00 00 00    	je     8014e0 <pgfault+0xf9>
+	// Hint:
+	//   You should make three system calls.
+
+	// LAB 4: Your code here.
+
+	void *pg_addr = ROUNDDOWN(addr, PGSIZE);
+  80141d:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+	r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W);
+  801424:	ba 07 00 00 00       	mov    $0x7,%edx
+  801429:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  80142e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801433:	48 b8 0b 10 80 00 00 	movabs $0x80100b,%rax
+  80143a:	00 00 00 
+  80143d:	ff d0                	call   *%rax
+	if (r < 0) {
+  80143f:	85 c0                	test   %eax,%eax
+  801441:	0f 88 c7 00 00 00    	js     80150e <pgfault+0x127>
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+	}
+	memmove(PFTEMP, pg_addr, PGSIZE);
+  801447:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80144c:	48 89 de             	mov    %rbx,%rsi
+  80144f:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  801454:	48 b8 92 0d 80 00 00 	movabs $0x800d92,%rax
+  80145b:	00 00 00 
+  80145e:	ff d0                	call   *%rax
+	r = sys_page_map(0, PFTEMP, 0, pg_addr, PTE_P | PTE_U | PTE_W);
+  801460:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  801466:	48 89 d9             	mov    %rbx,%rcx
+  801469:	ba 00 00 00 00       	mov    $0x0,%edx
+  80146e:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  801473:	bf 00 00 00 00       	mov    $0x0,%edi
+  801478:	48 b8 b7 10 80 00 00 	movabs $0x8010b7,%rax
+  80147f:	00 00 00 
+  801482:	ff d0                	call   *%rax
+	if (r < 0) {
+  801484:	85 c0                	test   %eax,%eax
+  801486:	0f 88 af 00 00 00    	js     80153b <pgfault+0x154>
+		panic("pgfault: sys_page_map failed:  %e", r);
+	}
+	r = sys_page_unmap(0, PFTEMP);
+  80148c:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  801491:	bf 00 00 00 00       	mov    $0x0,%edi
+  801496:	48 b8 07 11 80 00 00 	movabs $0x801107,%rax
+  80149d:	00 00 00 
+  8014a0:	ff d0                	call   *%rax
+	if (r < 0) {
+  8014a2:	85 c0                	test   %eax,%eax
+  8014a4:	0f 88 be 00 00 00    	js     801568 <pgfault+0x181>
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+	}
+}
+  8014aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ae:	c9                   	leave
+  8014af:	c3                   	ret
+  8014b0:	89 c1                	mov    %eax,%ecx
+		panic("fault was not a write (err=%x, va=%p)", err, addr);
+  8014b2:	49 89 d8             	mov    %rbx,%r8
+  8014b5:	48 ba 78 21 80 00 00 	movabs $0x802178,%rdx
+  8014bc:	00 00 00 
+  8014bf:	be 32 00 00 00       	mov    $0x32,%esi
+  8014c4:	48 bf 27 23 80 00 00 	movabs $0x802327,%rdi
+  8014cb:	00 00 00 
+  8014ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d3:	49 b9 e8 01 80 00 00 	movabs $0x8001e8,%r9
+  8014da:	00 00 00 
+  8014dd:	41 ff d1             	call   *%r9
+		panic("pgfault: page is not marked copy-on-write (pte=%p, va=%p)", pte, addr);
+  8014e0:	49 89 d8             	mov    %rbx,%r8
+  8014e3:	48 ba a0 21 80 00 00 	movabs $0x8021a0,%rdx
+  8014ea:	00 00 00 
+  8014ed:	be 36 00 00 00       	mov    $0x36,%esi
+  8014f2:	48 bf 27 23 80 00 00 	movabs $0x802327,%rdi
+  8014f9:	00 00 00 
+  8014fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801501:	49 b9 e8 01 80 00 00 	movabs $0x8001e8,%r9
+  801508:	00 00 00 
+  80150b:	41 ff d1             	call   *%r9
+		panic("pgfault: sys_page_alloc failed:  %e", r);
+  80150e:	89 c1                	mov    %eax,%ecx
+  801510:	48 ba e0 21 80 00 00 	movabs $0x8021e0,%rdx
+  801517:	00 00 00 
+  80151a:	be 44 00 00 00       	mov    $0x44,%esi
+  80151f:	48 bf 27 23 80 00 00 	movabs $0x802327,%rdi
+  801526:	00 00 00 
+  801529:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152e:	49 b8 e8 01 80 00 00 	movabs $0x8001e8,%r8
+  801535:	00 00 00 
+  801538:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_map failed:  %e", r);
+  80153b:	89 c1                	mov    %eax,%ecx
+  80153d:	48 ba 08 22 80 00 00 	movabs $0x802208,%rdx
+  801544:	00 00 00 
+  801547:	be 49 00 00 00       	mov    $0x49,%esi
+  80154c:	48 bf 27 23 80 00 00 	movabs $0x802327,%rdi
+  801553:	00 00 00 
+  801556:	b8 00 00 00 00       	mov    $0x0,%eax
+  80155b:	49 b8 e8 01 80 00 00 	movabs $0x8001e8,%r8
+  801562:	00 00 00 
+  801565:	41 ff d0             	call   *%r8
+		panic("pgfault: sys_page_unmap failed:  %e", r);
+  801568:	89 c1                	mov    %eax,%ecx
+  80156a:	48 ba 30 22 80 00 00 	movabs $0x802230,%rdx
+  801571:	00 00 00 
+  801574:	be 4d 00 00 00       	mov    $0x4d,%esi
+  801579:	48 bf 27 23 80 00 00 	movabs $0x802327,%rdi
+  801580:	00 00 00 
+  801583:	b8 00 00 00 00       	mov    $0x0,%eax
+  801588:	49 b8 e8 01 80 00 00 	movabs $0x8001e8,%r8
+  80158f:	00 00 00 
+  801592:	41 ff d0             	call   *%r8
+
+0000000000801595 <dupflush>:
+static struct PageOp dup_child[DUP_BATCH], dup_self[DUP_BATCH];
+static int ndup_child, ndup_self;
+
+static int
+dupflush(envid_t envid)
+{
+  801595:	55                   	push   %rbp
+  801596:	48 89 e5             	mov    %rsp,%rbp
+  801599:	89 fe                	mov    %edi,%esi
+	int r;
+
+	// Map to child first, then remap parent
+	r = sys_page_batch(0, envid, dup_child, ndup_child);
+  80159b:	a1 44 30 80 00 00 00 	movabs 0x803044,%eax
+  8015a2:	00 00 
+  8015a4:	48 63 c8             	movslq %eax,%rcx
+  8015a7:	48 ba 60 36 80 00 00 	movabs $0x803660,%rdx
+  8015ae:	00 00 00 
+  8015b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015b6:	48 b8 ab 11 80 00 00 	movabs $0x8011ab,%rax
+  8015bd:	00 00 00 
+  8015c0:	ff d0                	call   *%rax
+	if (r < 0) {
+  8015c2:	85 c0                	test   %eax,%eax
+  8015c4:	78 57                	js     80161d <dupflush+0x88>
+		panic("duppage: child map failed: %e", r);
+		return r;
+	}
+	r = sys_page_batch(0, 0, dup_self, ndup_self);
+  8015c6:	a1 40 30 80 00 00 00 	movabs 0x803040,%eax
+  8015cd:	00 00 
+  8015cf:	48 63 c8             	movslq %eax,%rcx
+  8015d2:	48 ba 60 30 80 00 00 	movabs $0x803060,%rdx
+  8015d9:	00 00 00 
+  8015dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015e6:	48 b8 ab 11 80 00 00 	movabs $0x8011ab,%rax
+  8015ed:	00 00 00 
+  8015f0:	ff d0                	call   *%rax
+	if (r < 0) {
+  8015f2:	85 c0                	test   %eax,%eax
+  8015f4:	78 54                	js     80164a <dupflush+0xb5>
+		panic("duppage: parent remap failed: %e", r);
+		return r;
+	}
+	ndup_child = ndup_self = 0;
+  8015f6:	48 b8 40 30 80 00 00 	movabs $0x803040,%rax
+  8015fd:	00 00 00 
+  801600:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  801606:	48 b8 44 30 80 00 00 	movabs $0x803044,%rax
+  80160d:	00 00 00 
+  801610:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	return 0;
+}
+  801616:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161b:	5d                   	pop    %rbp
+  80161c:	c3                   	ret
+		panic("duppage: child map failed: %e", r);
+  80161d:	89 c1                	mov    %eax,%ecx
+  80161f:	48 ba 32 23 80 00 00 	movabs $0x802332,%rdx
+  801626:	00 00 00 
+  801629:	be 77 00 00 00       	mov    $0x77,%esi
+  80162e:	48 bf 27 23 80 00 00 	movabs $0x802327,%rdi
+  801635:	00 00 00 
+  801638:	b8 00 00 00 00       	mov    $0x0,%eax
+  80163d:	49 b8 e8 01 80 00 00 	movabs $0x8001e8,%r8
+  801644:	00 00 00 
+  801647:	41 ff d0             	call   *%r8
+		panic("duppage: parent remap failed: %e", r);
+  80164a:	89 c1                	mov    %eax,%ecx
+  80164c:	48 ba 58 22 80 00 00 	movabs $0x802258,%rdx
+  801653:	00 00 00 
+  801656:	be 7c 00 00 00       	mov    $0x7c,%esi
+  80165b:	48 bf 27 23 80 00 00 	movabs $0x802327,%rdi
+  801662:	00 00 00 
+  801665:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166a:	49 b8 e8 01 80 00 00 	movabs $0x8001e8,%r8
+  801671:	00 00 00 
+  801674:	41 ff d0             	call   *%r8
+
+0000000000801677 <thread_start>:
+	return envid;
+}
+
+static void
+thread_start(void (*fn)(void *), void *arg)
+{
+  801677:	55                   	push   %rbp
+  801678:	48 89 e5             	mov    %rsp,%rbp
+  80167b:	48 89 f8             	mov    %rdi,%rax
+  80167e:	48 89 f7             	mov    %rsi,%rdi
+	fn(arg);
+  801681:	ff d0                	call   *%rax
+	exit();
+  801683:	48 b8 d1 01 80 00 00 	movabs $0x8001d1,%rax
+  80168a:	00 00 00 
+  80168d:	ff d0                	call   *%rax
+}
+  80168f:	5d                   	pop    %rbp
+  801690:	c3                   	ret
+
+0000000000801691 <fork>:
+{
+  801691:	55                   	push   %rbp
+  801692:	48 89 e5             	mov    %rsp,%rbp
+	set_pgfault_handler(pgfault);
+  801695:	48 bf e7 13 80 00 00 	movabs $0x8013e7,%rdi
+  80169c:	00 00 00 
+  80169f:	48 b8 c4 1b 80 00 00 	movabs $0x801bc4,%rax
+  8016a6:	00 00 00 
+  8016a9:	ff d0                	call   *%rax
+	return sys_fork();
+  8016ab:	48 b8 5f 11 80 00 00 	movabs $0x80115f,%rax
+  8016b2:	00 00 00 
+  8016b5:	ff d0                	call   *%rax
+}
+  8016b7:	5d                   	pop    %rbp
+  8016b8:	c3                   	ret
+
+00000000008016b9 <ufork>:
+{
+  8016b9:	55                   	push   %rbp
+  8016ba:	48 89 e5             	mov    %rsp,%rbp
+  8016bd:	41 57                	push   %r15
+  8016bf:	41 56                	push   %r14
+  8016c1:	41 55                	push   %r13
+  8016c3:	41 54                	push   %r12
+  8016c5:	53                   	push   %rbx
+  8016c6:	48 83 ec 38          	sub    $0x38,%rsp
+	set_pgfault_handler(pgfault);
+  8016ca:	48 bf e7 13 80 00 00 	movabs $0x8013e7,%rdi
+  8016d1:	00 00 00 
+  8016d4:	48 b8 c4 1b 80 00 00 	movabs $0x801bc4,%rax
+  8016db:	00 00 00 
+  8016de:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8016e0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8016e5:	cd 30                	int    $0x30
+  8016e7:	89 45 cc             	mov    %eax,-0x34(%rbp)
+	if (envid < 0) {
+  8016ea:	85 c0                	test   %eax,%eax
+  8016ec:	78 21                	js     80170f <ufork+0x56>
+	if (envid == 0) {
+  8016ee:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8016f2:	0f 84 e4 03 00 00    	je     801adc <ufork+0x423>
+  8016f8:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8016ff:	00 
+	op->po_op = PAGEOP_MAP;
+  801700:	49 bf 60 36 80 00 00 	movabs $0x803660,%r15
+  801707:	00 00 00 
+  80170a:	e9 e7 02 00 00       	jmp    8019f6 <ufork+0x33d>
+		panic("sys_exofork failed: %e", envid);
+  80170f:	89 c1                	mov    %eax,%ecx
+  801711:	48 ba 50 23 80 00 00 	movabs $0x802350,%rdx
+  801718:	00 00 00 
+  80171b:	be e4 00 00 00       	mov    $0xe4,%esi
+  801720:	48 bf 27 23 80 00 00 	movabs $0x802327,%rdi
+  801727:	00 00 00 
+  80172a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172f:	49 b8 e8 01 80 00 00 	movabs $0x8001e8,%r8
+  801736:	00 00 00 
+  801739:	41 ff d0             	call   *%r8
+  80173c:	44 89 e8             	mov    %r13d,%eax
+  80173f:	c1 e0 09             	shl    $0x9,%eax
+  801742:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  801745:	44 89 e8             	mov    %r13d,%eax
+  801748:	c1 e0 12             	shl    $0x12,%eax
+  80174b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  80174e:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801755:	00 
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  801756:	44 89 6d a8          	mov    %r13d,-0x58(%rbp)
+				int pdeIndex = pdpeIndex * NPTENTRIES + k;
+  80175a:	8b 75 c8             	mov    -0x38(%rbp),%esi
+				if (!(uvpd[pdeIndex] & PTE_P)) {
+  80175d:	48 63 c6             	movslq %esi,%rax
+  801760:	48 bf 00 00 00 80 00 	movabs $0x10080000000,%rdi
+  801767:	01 00 00 
+  80176a:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80176e:	a8 01                	test   $0x1,%al
+  801770:	0f 84 52 02 00 00    	je     8019c8 <ufork+0x30f>
+				if (uvpd[pdeIndex] & PTE_PS) {
+  801776:	48 63 c6             	movslq %esi,%rax
+  801779:	48 8b 04 c7          	mov    (%rdi,%rax,8),%rax
+  80177d:	a8 80                	test   $0x80,%al
+  80177f:	74 52                	je     8017d3 <ufork+0x11a>
+					void *va = PGADDR(i, j, k, 0, 0);
+  801781:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  801785:	48 c1 e3 27          	shl    $0x27,%rbx
+  801789:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80178d:	48 09 c3             	or     %rax,%rbx
+  801790:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801794:	48 09 c3             	or     %rax,%rbx
+					if ((uintptr_t)va >= UTOP) {
+  801797:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  80179c:	48 39 d8             	cmp    %rbx,%rax
+  80179f:	0f 82 ca 02 00 00    	jb     801a6f <ufork+0x3b6>
+					r = sys_page_map(0, va, 0, va, uvpd[pdeIndex] & PTE_SYSCALL);
+  8017a5:	48 63 d6             	movslq %esi,%rdx
+  8017a8:	4c 8b 04 d7          	mov    (%rdi,%rdx,8),%r8
+  8017ac:	41 81 e0 07 0e 00 00 	and    $0xe07,%r8d
+  8017b3:	48 89 d9             	mov    %rbx,%rcx
+  8017b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017bb:	48 89 de             	mov    %rbx,%rsi
+  8017be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017c3:	48 b8 b7 10 80 00 00 	movabs $0x8010b7,%rax
+  8017ca:	00 00 00 
+  8017cd:	ff d0                	call   *%rax
+					if (r < 0) {
+  8017cf:	85 c0                	test   %eax,%eax
+  8017d1:	78 18                	js     8017eb <ufork+0x132>
+  8017d3:	4c 63 65 ac          	movslq -0x54(%rbp),%r12
+  8017d7:	4c 89 e3             	mov    %r12,%rbx
+  8017da:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8017de:	4d 8d ac 24 00 02 00 	lea    0x200(%r12),%r13
+  8017e5:	00 
+  8017e6:	e9 00 01 00 00       	jmp    8018eb <ufork+0x232>
+						panic("splitting 2MB page at %p failed: %e", va, r);
+  8017eb:	41 89 c0             	mov    %eax,%r8d
+  8017ee:	48 89 d9             	mov    %rbx,%rcx
+  8017f1:	48 ba 80 22 80 00 00 	movabs $0x802280,%rdx
+  8017f8:	00 00 00 
+  8017fb:	be 0a 01 00 00       	mov    $0x10a,%esi
+  801800:	48 bf 27 23 80 00 00 	movabs $0x802327,%rdi
+  801807:	00 00 00 
+  80180a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180f:	49 b9 e8 01 80 00 00 	movabs $0x8001e8,%r9
+  801816:	00 00 00 
+  801819:	41 ff d1             	call   *%r9
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  80181c:	48 bf 44 30 80 00 00 	movabs $0x803044,%rdi
+  801823:	00 00 00 
+  801826:	8b 0f                	mov    (%rdi),%ecx
+  801828:	8d 71 01             	lea    0x1(%rcx),%esi
+  80182b:	89 37                	mov    %esi,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  80182d:	48 63 c9             	movslq %ecx,%rcx
+  801830:	48 8d 34 09          	lea    (%rcx,%rcx,1),%rsi
+  801834:	48 8d 3c 0e          	lea    (%rsi,%rcx,1),%rdi
+  801838:	41 c7 04 ff 01 00 00 	movl   $0x1,(%r15,%rdi,8)
+  80183f:	00 
+		dupqueue(&dup_child[ndup_child++], va, pte & PTE_SYSCALL);
+  801840:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  801846:	41 89 54 ff 04       	mov    %edx,0x4(%r15,%rdi,8)
+	op->po_srcva = op->po_dstva = va;
+  80184b:	49 89 44 ff 10       	mov    %rax,0x10(%r15,%rdi,8)
+  801850:	49 89 44 ff 08       	mov    %rax,0x8(%r15,%rdi,8)
+}
+  801855:	eb 76                	jmp    8018cd <ufork+0x214>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U | PTE_COW);
+  801857:	48 bf 44 30 80 00 00 	movabs $0x803044,%rdi
+  80185e:	00 00 00 
+  801861:	8b 17                	mov    (%rdi),%edx
+  801863:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  801866:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  801868:	48 63 d2             	movslq %edx,%rdx
+  80186b:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  80186f:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  801873:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  80187a:	00 
+	op->po_perm = perm;
+  80187b:	41 c7 44 f7 04 05 08 	movl   $0x805,0x4(%r15,%rsi,8)
+  801882:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  801884:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  801889:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+		dupqueue(&dup_self[ndup_self++], va, PTE_P | PTE_U | PTE_COW);
+  80188e:	48 b9 40 30 80 00 00 	movabs $0x803040,%rcx
+  801895:	00 00 00 
+  801898:	8b 11                	mov    (%rcx),%edx
+  80189a:	8d 72 01             	lea    0x1(%rdx),%esi
+  80189d:	89 31                	mov    %esi,(%rcx)
+	op->po_op = PAGEOP_MAP;
+  80189f:	48 be 60 30 80 00 00 	movabs $0x803060,%rsi
+  8018a6:	00 00 00 
+  8018a9:	48 63 d2             	movslq %edx,%rdx
+  8018ac:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  8018b0:	48 8d 3c 11          	lea    (%rcx,%rdx,1),%rdi
+  8018b4:	c7 04 fe 01 00 00 00 	movl   $0x1,(%rsi,%rdi,8)
+	op->po_perm = perm;
+  8018bb:	c7 44 fe 04 05 08 00 	movl   $0x805,0x4(%rsi,%rdi,8)
+  8018c2:	00 
+	op->po_srcva = op->po_dstva = va;
+  8018c3:	48 89 44 fe 10       	mov    %rax,0x10(%rsi,%rdi,8)
+  8018c8:	48 89 44 fe 08       	mov    %rax,0x8(%rsi,%rdi,8)
+	if (ndup_child == DUP_BATCH) {
+  8018cd:	48 b8 44 30 80 00 00 	movabs $0x803044,%rax
+  8018d4:	00 00 00 
+  8018d7:	83 38 40             	cmpl   $0x40,(%rax)
+  8018da:	0f 84 a4 00 00 00    	je     801984 <ufork+0x2cb>
+				for (int l = 0; l < NPTENTRIES; l++) {
+  8018e0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018e7:	49 83 c4 01          	add    $0x1,%r12
+  8018eb:	4d 39 ec             	cmp    %r13,%r12
+  8018ee:	0f 84 d4 00 00 00    	je     8019c8 <ufork+0x30f>
+					if (va >= UTOP) {
+  8018f4:	b8 ff ff 7f bc       	mov    $0xbc7fffff,%eax
+  8018f9:	48 39 d8             	cmp    %rbx,%rax
+  8018fc:	0f 82 6d 01 00 00    	jb     801a6f <ufork+0x3b6>
+					if (va >= (UXSTACKTOP - PGSIZE) && va < UXSTACKTOP) {
+  801902:	48 b8 00 10 80 43 ff 	movabs $0xffffffff43801000,%rax
+  801909:	ff ff ff 
+  80190c:	48 01 d8             	add    %rbx,%rax
+  80190f:	48 3d ff 0f 00 00    	cmp    $0xfff,%rax
+  801915:	76 c9                	jbe    8018e0 <ufork+0x227>
+					if (!(uvpt[pn] & PTE_P)) {
+  801917:	4b 8b 04 e6          	mov    (%r14,%r12,8),%rax
+  80191b:	a8 01                	test   $0x1,%al
+  80191d:	74 c1                	je     8018e0 <ufork+0x227>
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  80191f:	48 b8 00 f0 ff ff ff 	movabs $0xffffffff000,%rax
+  801926:	0f 00 00 
+  801929:	48 21 d8             	and    %rbx,%rax
+	pte_t pte = uvpt[pn];
+  80192c:	44 89 e2             	mov    %r12d,%edx
+  80192f:	49 8b 14 d6          	mov    (%r14,%rdx,8),%rdx
+	if (pte & PTE_SHARE) {
+  801933:	f6 c6 04             	test   $0x4,%dh
+  801936:	0f 85 e0 fe ff ff    	jne    80181c <ufork+0x163>
+	} else if ((pte & PTE_W) || (pte & PTE_COW)) {
+  80193c:	f7 c2 02 08 00 00    	test   $0x802,%edx
+  801942:	0f 85 0f ff ff ff    	jne    801857 <ufork+0x19e>
+		dupqueue(&dup_child[ndup_child++], va, PTE_P | PTE_U);
+  801948:	48 bf 44 30 80 00 00 	movabs $0x803044,%rdi
+  80194f:	00 00 00 
+  801952:	8b 17                	mov    (%rdi),%edx
+  801954:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  801957:	89 0f                	mov    %ecx,(%rdi)
+	op->po_op = PAGEOP_MAP;
+  801959:	48 63 d2             	movslq %edx,%rdx
+  80195c:	48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+  801960:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  801964:	41 c7 04 f7 01 00 00 	movl   $0x1,(%r15,%rsi,8)
+  80196b:	00 
+	op->po_perm = perm;
+  80196c:	41 c7 44 f7 04 05 00 	movl   $0x5,0x4(%r15,%rsi,8)
+  801973:	00 00 
+	op->po_srcva = op->po_dstva = va;
+  801975:	49 89 44 f7 10       	mov    %rax,0x10(%r15,%rsi,8)
+  80197a:	49 89 44 f7 08       	mov    %rax,0x8(%r15,%rsi,8)
+}
+  80197f:	e9 49 ff ff ff       	jmp    8018cd <ufork+0x214>
+		return dupflush(envid);
+  801984:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801987:	48 b8 95 15 80 00 00 	movabs $0x801595,%rax
+  80198e:	00 00 00 
+  801991:	ff d0                	call   *%rax
+					if (r < 0) {
+  801993:	85 c0                	test   %eax,%eax
+  801995:	0f 89 45 ff ff ff    	jns    8018e0 <ufork+0x227>
+						panic("duppage failed:  %e", r);
+  80199b:	89 c1                	mov    %eax,%ecx
+  80199d:	48 ba 67 23 80 00 00 	movabs $0x802367,%rdx
+  8019a4:	00 00 00 
+  8019a7:	be 20 01 00 00       	mov    $0x120,%esi
+  8019ac:	48 bf 27 23 80 00 00 	movabs $0x802327,%rdi
+  8019b3:	00 00 00 
+  8019b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019bb:	49 b8 e8 01 80 00 00 	movabs $0x8001e8,%r8
+  8019c2:	00 00 00 
+  8019c5:	41 ff d0             	call   *%r8
+			for (int k = 0; k < NPTENTRIES; k++) {
+  8019c8:	81 45 ac 00 02 00 00 	addl   $0x200,-0x54(%rbp)
+  8019cf:	83 45 c8 01          	addl   $0x1,-0x38(%rbp)
+  8019d3:	48 81 45 b0 00 00 20 	addq   $0x200000,-0x50(%rbp)
+  8019da:	00 
+  8019db:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8019df:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  8019e5:	0f 85 6f fd ff ff    	jne    80175a <ufork+0xa1>
+  8019eb:	44 8b 6d a8          	mov    -0x58(%rbp),%r13d
+  8019ef:	eb 5d                	jmp    801a4e <ufork+0x395>
+	for (int i = 0; i < NPTENTRIES; i++) {
+  8019f1:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+  8019f6:	48 81 7d c0 00 02 00 	cmpq   $0x200,-0x40(%rbp)
+  8019fd:	00 
+  8019fe:	74 6f                	je     801a6f <ufork+0x3b6>
+		if (!(uvpml4e[i] & PTE_P)) {
+  801a00:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  801a04:	48 63 c3             	movslq %ebx,%rax
+  801a07:	48 be 00 20 40 80 00 	movabs $0x10080402000,%rsi
+  801a0e:	01 00 00 
+  801a11:	48 8b 04 c6          	mov    (%rsi,%rax,8),%rax
+  801a15:	a8 01                	test   $0x1,%al
+  801a17:	74 d8                	je     8019f1 <ufork+0x338>
+  801a19:	41 89 dc             	mov    %ebx,%r12d
+  801a1c:	41 c1 e4 09          	shl    $0x9,%r12d
+  801a20:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801a27:	00 
+					if (!(uvpt[pn] & PTE_P)) {
+  801a28:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  801a2f:	01 00 00 
+	void *va = (void *)((uintptr_t)pn << PGSHIFT);
+  801a32:	45 89 e5             	mov    %r12d,%r13d
+			if (!(uvpde[pdpeIndex] & PTE_P)) {
+  801a35:	49 63 c5             	movslq %r13d,%rax
+  801a38:	48 bb 00 00 40 80 00 	movabs $0x10080400000,%rbx
+  801a3f:	01 00 00 
+  801a42:	48 8b 04 c3          	mov    (%rbx,%rax,8),%rax
+  801a46:	a8 01                	test   $0x1,%al
+  801a48:	0f 85 ee fc ff ff    	jne    80173c <ufork+0x83>
+		for (int j = 0; j < NPTENTRIES; j++) {
+  801a4e:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  801a55:	40 
+  801a56:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a5a:	41 83 c5 01          	add    $0x1,%r13d
+  801a5e:	48 b9 00 00 00 00 80 	movabs $0x8000000000,%rcx
+  801a65:	00 00 00 
+  801a68:	48 39 c8             	cmp    %rcx,%rax
+  801a6b:	75 c8                	jne    801a35 <ufork+0x37c>
+  801a6d:	eb 82                	jmp    8019f1 <ufork+0x338>
+	r = dupflush(envid);
+  801a6f:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801a72:	48 b8 95 15 80 00 00 	movabs $0x801595,%rax
+  801a79:	00 00 00 
+  801a7c:	ff d0                	call   *%rax
+	if (r < 0) {
+  801a7e:	85 c0                	test   %eax,%eax
+  801a80:	78 6c                	js     801aee <ufork+0x435>
+	r = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801a82:	ba 07 00 00 00       	mov    $0x7,%edx
+  801a87:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801a8c:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801a8f:	48 b8 0b 10 80 00 00 	movabs $0x80100b,%rax
+  801a96:	00 00 00 
+  801a99:	ff d0                	call   *%rax
+	if (r < 0) {
+  801a9b:	85 c0                	test   %eax,%eax
+  801a9d:	78 7c                	js     801b1b <ufork+0x462>
+	r = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  801a9f:	48 be 8b 1c 80 00 00 	movabs $0x801c8b,%rsi
+  801aa6:	00 00 00 
+  801aa9:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801aac:	48 b8 23 13 80 00 00 	movabs $0x801323,%rax
+  801ab3:	00 00 00 
+  801ab6:	ff d0                	call   *%rax
+	if (r < 0) {
+  801ab8:	85 c0                	test   %eax,%eax
+  801aba:	0f 88 88 00 00 00    	js     801b48 <ufork+0x48f>
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  801ac0:	be 02 00 00 00       	mov    $0x2,%esi
+  801ac5:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801ac8:	48 b8 c8 12 80 00 00 	movabs $0x8012c8,%rax
+  801acf:	00 00 00 
+  801ad2:	ff d0                	call   *%rax
+	if (r < 0) {
+  801ad4:	85 c0                	test   %eax,%eax
+  801ad6:	0f 88 99 00 00 00    	js     801b75 <ufork+0x4bc>
+}
+  801adc:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801adf:	48 83 c4 38          	add    $0x38,%rsp
+  801ae3:	5b                   	pop    %rbx
+  801ae4:	41 5c                	pop    %r12
+  801ae6:	41 5d                	pop    %r13
+  801ae8:	41 5e                	pop    %r14
+  801aea:	41 5f                	pop    %r15
+  801aec:	5d                   	pop    %rbp
+  801aed:	c3                   	ret
+		panic("duppage failed:  %e", r);
+  801aee:	89 c1                	mov    %eax,%ecx
+  801af0:	48 ba 67 23 80 00 00 	movabs $0x802367,%rdx
+  801af7:	00 00 00 
+  801afa:	be 29 01 00 00       	mov    $0x129,%esi
+  801aff:	48 bf 27 23 80 00 00 	movabs $0x802327,%rdi
+  801b06:	00 00 00 
+  801b09:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b0e:	49 b8 e8 01 80 00 00 	movabs $0x8001e8,%r8
+  801b15:	00 00 00 
+  801b18:	41 ff d0             	call   *%r8
+		panic("sys_page_alloc for child exception stack failed: %e", r);
+  801b1b:	89 c1                	mov    %eax,%ecx
+  801b1d:	48 ba a8 22 80 00 00 	movabs $0x8022a8,%rdx
+  801b24:	00 00 00 
+  801b27:	be 2e 01 00 00       	mov    $0x12e,%esi
+  801b2c:	48 bf 27 23 80 00 00 	movabs $0x802327,%rdi
+  801b33:	00 00 00 
+  801b36:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b3b:	49 b8 e8 01 80 00 00 	movabs $0x8001e8,%r8
+  801b42:	00 00 00 
+  801b45:	41 ff d0             	call   *%r8
+		panic("sys_env_set_pgfault_upcall failed:  %e", r);
+  801b48:	89 c1                	mov    %eax,%ecx
+  801b4a:	48 ba e0 22 80 00 00 	movabs $0x8022e0,%rdx
+  801b51:	00 00 00 
+  801b54:	be 33 01 00 00       	mov    $0x133,%esi
+  801b59:	48 bf 27 23 80 00 00 	movabs $0x802327,%rdi
+  801b60:	00 00 00 
+  801b63:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b68:	49 b8 e8 01 80 00 00 	movabs $0x8001e8,%r8
+  801b6f:	00 00 00 
+  801b72:	41 ff d0             	call   *%r8
+		panic("sys_env_set_status failed:  %e", r);
+  801b75:	89 c1                	mov    %eax,%ecx
+  801b77:	48 ba 08 23 80 00 00 	movabs $0x802308,%rdx
+  801b7e:	00 00 00 
+  801b81:	be 38 01 00 00       	mov    $0x138,%esi
+  801b86:	48 bf 27 23 80 00 00 	movabs $0x802327,%rdi
+  801b8d:	00 00 00 
+  801b90:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b95:	49 b8 e8 01 80 00 00 	movabs $0x8001e8,%r8
+  801b9c:	00 00 00 
+  801b9f:	41 ff d0             	call   *%r8
+
+0000000000801ba2 <sfork>:
+// on one stack, since nothing is private to the child.
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801ba2:	55                   	push   %rbp
+  801ba3:	48 89 e5             	mov    %rsp,%rbp
+  801ba6:	48 89 f2             	mov    %rsi,%rdx
+	return sys_thread_create(thread_start, (uint64_t) fn, (uint64_t) arg);
+  801ba9:	48 89 fe             	mov    %rdi,%rsi
+  801bac:	48 bf 77 16 80 00 00 	movabs $0x801677,%rdi
+  801bb3:	00 00 00 
+  801bb6:	48 b8 97 11 80 00 00 	movabs $0x801197,%rax
+  801bbd:	00 00 00 
+  801bc0:	ff d0                	call   *%rax
+}
+  801bc2:	5d                   	pop    %rbp
+  801bc3:	c3                   	ret
+
+0000000000801bc4 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801bc4:	55                   	push   %rbp
+  801bc5:	48 89 e5             	mov    %rsp,%rbp
+  801bc8:	53                   	push   %rbx
+  801bc9:	48 83 ec 08          	sub    $0x8,%rsp
+  801bcd:	48 89 fb             	mov    %rdi,%rbx
+	int r;
+
+	if (_pgfault_handler == 0) {
+  801bd0:	48 ba 60 3c 80 00 00 	movabs $0x803c60,%rdx
+  801bd7:	00 00 00 
+  801bda:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  801bde:	74 13                	je     801bf3 <set_pgfault_handler+0x2f>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801be0:	48 89 d8             	mov    %rbx,%rax
+  801be3:	48 a3 60 3c 80 00 00 	movabs %rax,0x803c60
+  801bea:	00 00 00 
+}
+  801bed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bf1:	c9                   	leave
+  801bf2:	c3                   	ret
+		r = sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  801bf3:	ba 07 00 00 00       	mov    $0x7,%edx
+  801bf8:	be 00 f0 7f bc       	mov    $0xbc7ff000,%esi
+  801bfd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c02:	48 b8 0b 10 80 00 00 	movabs $0x80100b,%rax
+  801c09:	00 00 00 
+  801c0c:	ff d0                	call   *%rax
+		if (r < 0) {
+  801c0e:	85 c0                	test   %eax,%eax
+  801c10:	78 4c                	js     801c5e <set_pgfault_handler+0x9a>
+		r = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801c12:	48 be 8b 1c 80 00 00 	movabs $0x801c8b,%rsi
+  801c19:	00 00 00 
+  801c1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c21:	48 b8 23 13 80 00 00 	movabs $0x801323,%rax
+  801c28:	00 00 00 
+  801c2b:	ff d0                	call   *%rax
+		if (r < 0) {
+  801c2d:	85 c0                	test   %eax,%eax
+  801c2f:	79 af                	jns    801be0 <set_pgfault_handler+0x1c>
+			panic("sys_env_set_pgfault_upcall failed: %e", r);
+  801c31:	89 c1                	mov    %eax,%ecx
+  801c33:	48 ba a8 23 80 00 00 	movabs $0x8023a8,%rdx
+  801c3a:	00 00 00 
+  801c3d:	be 2c 00 00 00       	mov    $0x2c,%esi
+  801c42:	48 bf 96 23 80 00 00 	movabs $0x802396,%rdi
+  801c49:	00 00 00 
+  801c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c51:	49 b8 e8 01 80 00 00 	movabs $0x8001e8,%r8
+  801c58:	00 00 00 
+  801c5b:	41 ff d0             	call   *%r8
+			panic("sys_page_alloc failed:  %e", r);
+  801c5e:	89 c1                	mov    %eax,%ecx
+  801c60:	48 ba 7b 23 80 00 00 	movabs $0x80237b,%rdx
+  801c67:	00 00 00 
+  801c6a:	be 28 00 00 00       	mov    $0x28,%esi
+  801c6f:	48 bf 96 23 80 00 00 	movabs $0x802396,%rdi
+  801c76:	00 00 00 
+  801c79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7e:	49 b8 e8 01 80 00 00 	movabs $0x8001e8,%r8
+  801c85:	00 00 00 
+  801c88:	41 ff d0             	call   *%r8
+
+0000000000801c8b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi		// function argument: pointer to UTF
+  801c8b:	48 89 e7             	mov    %rsp,%rdi
+	movabs _pgfault_handler, %rax
+  801c8e:	48 a1 60 3c 80 00 00 	movabs 0x803c60,%rax
+  801c95:	00 00 00 
+	call *%rax
+  801c98:	ff d0                	call   *%rax
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here. (Hint. You need to modify the trap time rsp to make room for the return rip ) */
+
+	movq  152(%rsp), %rax
+  801c9a:	48 8b 84 24 98 00 00 	mov    0x98(%rsp),%rax
+  801ca1:	00 
+	subq $8, %rax
+  801ca2:	48 83 e8 08          	sub    $0x8,%rax
+	movq %rax, 152(%rsp)
+  801ca6:	48 89 84 24 98 00 00 	mov    %rax,0x98(%rsp)
+  801cad:	00 
+
+	movq 136(%rsp), %rbx
+  801cae:	48 8b 9c 24 88 00 00 	mov    0x88(%rsp),%rbx
+  801cb5:	00 
+	movq %rbx, (%rax)
+  801cb6:	48 89 18             	mov    %rbx,(%rax)
+
+	/* Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here. (Hint, the oposite of _alltraps) */
+
+	addq $16, %rsp
+  801cb9:	48 83 c4 10          	add    $0x10,%rsp
+	
+	popq %r15
+  801cbd:	41 5f                	pop    %r15
+	popq %r14
+  801cbf:	41 5e                	pop    %r14
+	popq %r13
+  801cc1:	41 5d                	pop    %r13
+	popq %r12
+  801cc3:	41 5c                	pop    %r12
+	popq %r11
+  801cc5:	41 5b                	pop    %r11
+	popq %r10
+  801cc7:	41 5a                	pop    %r10
+	popq %r9
+  801cc9:	41 59                	pop    %r9
+	popq %r8
+  801ccb:	41 58                	pop    %r8
+	popq %rsi
+  801ccd:	5e                   	pop    %rsi
+	popq %rdi
+  801cce:	5f                   	pop    %rdi
+	popq %rbp
+  801ccf:	5d                   	pop    %rbp
+	popq %rdx
+  801cd0:	5a                   	pop    %rdx
+	popq %rcx
+  801cd1:	59                   	pop    %rcx
+	popq %rbx
+  801cd2:	5b                   	pop    %rbx
+	popq %rax
+  801cd3:	58                   	pop    %rax
+
+	addq $8, %rsp
+  801cd4:	48 83 c4 08          	add    $0x8,%rsp
+	/* Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 4: Your code here. */
+
+	popfq
+  801cd8:	9d                   	popf
+
+	/* Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here. */
+
+	popq %rsp
+  801cd9:	5c                   	pop    %rsp
+
+	/* Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here. */
+  801cda:	c3                   	ret
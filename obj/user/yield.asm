@@ -0,0 +1,2327 @@
+
+obj/user/yield:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 7f bc    	cmp    $0xbc7fe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  800028:	6a 00                	push   $0x0
+	pushq $0
+  80002a:	6a 00                	push   $0x0
+
+000000000080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 17 01 00 00       	call   800148 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+0000000000800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %rbp
+  800034:	48 89 e5             	mov    %rsp,%rbp
+  800037:	41 57                	push   %r15
+  800039:	41 56                	push   %r14
+  80003b:	41 55                	push   %r13
+  80003d:	41 54                	push   %r12
+  80003f:	53                   	push   %rbx
+  800040:	48 83 ec 08          	sub    $0x8,%rsp
+static inline const volatile struct Env *
+thisenv_get(void)
+{
+	envid_t id;
+
+	asm volatile("movl %%gs:%c1, %0"
+  800044:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  80004b:	00 
+	int i;
+
+	cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  80004c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800051:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800055:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800059:	48 c1 e2 04          	shl    $0x4,%rdx
+  80005d:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800064:	00 00 00 
+  800067:	48 01 d0             	add    %rdx,%rax
+  80006a:	8b b0 b8 00 00 00    	mov    0xb8(%rax),%esi
+  800070:	48 bf a0 13 80 00 00 	movabs $0x8013a0,%rdi
+  800077:	00 00 00 
+  80007a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007f:	48 ba 3b 02 80 00 00 	movabs $0x80023b,%rdx
+  800086:	00 00 00 
+  800089:	ff d2                	call   *%rdx
+	for (i = 0; i < 5; i++) {
+  80008b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		sys_yield();
+  800090:	49 bf a0 0e 80 00 00 	movabs $0x800ea0,%r15
+  800097:	00 00 00 
+		cprintf("Back in environment %08x, iteration %d.\n",
+			thisenv->env_id, i);
+  80009a:	49 be 00 00 80 bc 00 	movabs $0xbc800000,%r14
+  8000a1:	00 00 00 
+		cprintf("Back in environment %08x, iteration %d.\n",
+  8000a4:	49 bd c0 13 80 00 00 	movabs $0x8013c0,%r13
+  8000ab:	00 00 00 
+  8000ae:	49 bc 3b 02 80 00 00 	movabs $0x80023b,%r12
+  8000b5:	00 00 00 
+		sys_yield();
+  8000b8:	41 ff d7             	call   *%r15
+  8000bb:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  8000c2:	00 
+			thisenv->env_id, i);
+  8000c3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000c8:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  8000cc:	48 8d 04 50          	lea    (%rax,%rdx,2),%rax
+  8000d0:	48 c1 e0 04          	shl    $0x4,%rax
+  8000d4:	4c 01 f0             	add    %r14,%rax
+  8000d7:	8b b0 b8 00 00 00    	mov    0xb8(%rax),%esi
+		cprintf("Back in environment %08x, iteration %d.\n",
+  8000dd:	89 da                	mov    %ebx,%edx
+  8000df:	4c 89 ef             	mov    %r13,%rdi
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e7:	41 ff d4             	call   *%r12
+	for (i = 0; i < 5; i++) {
+  8000ea:	83 c3 01             	add    $0x1,%ebx
+  8000ed:	83 fb 05             	cmp    $0x5,%ebx
+  8000f0:	75 c6                	jne    8000b8 <umain+0x85>
+  8000f2:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  8000f9:	00 
+	}
+	cprintf("All done in environment %08x.\n", thisenv->env_id);
+  8000fa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ff:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800103:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800107:	48 c1 e2 04          	shl    $0x4,%rdx
+  80010b:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800112:	00 00 00 
+  800115:	48 01 d0             	add    %rdx,%rax
+  800118:	8b b0 b8 00 00 00    	mov    0xb8(%rax),%esi
+  80011e:	48 bf f0 13 80 00 00 	movabs $0x8013f0,%rdi
+  800125:	00 00 00 
+  800128:	b8 00 00 00 00       	mov    $0x0,%eax
+  80012d:	48 ba 3b 02 80 00 00 	movabs $0x80023b,%rdx
+  800134:	00 00 00 
+  800137:	ff d2                	call   *%rdx
+}
+  800139:	48 83 c4 08          	add    $0x8,%rsp
+  80013d:	5b                   	pop    %rbx
+  80013e:	41 5c                	pop    %r12
+  800140:	41 5d                	pop    %r13
+  800142:	41 5e                	pop    %r14
+  800144:	41 5f                	pop    %r15
+  800146:	5d                   	pop    %rbp
+  800147:	c3                   	ret
+
+0000000000800148 <libmain>:
+- convert id into an index for envs array with help of ENVX macro in env.h
+- Address of this indexed element should be assigned to thisenv
+*/
+void
+libmain(int argc, char **argv)
+{
+  800148:	55                   	push   %rbp
+  800149:	48 89 e5             	mov    %rsp,%rbp
+	// thisenv needs no setting up: it is found through the GS base,
+	// which the kernel points at our Env structure in envs[].
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80014c:	85 ff                	test   %edi,%edi
+  80014e:	7e 0d                	jle    80015d <libmain+0x15>
+		binaryname = argv[0];
+  800150:	48 8b 06             	mov    (%rsi),%rax
+  800153:	48 a3 00 20 80 00 00 	movabs %rax,0x802000
+  80015a:	00 00 00 
+
+	// call user main routine
+	umain(argc, argv);
+  80015d:	48 b8 33 00 80 00 00 	movabs $0x800033,%rax
+  800164:	00 00 00 
+  800167:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800169:	48 b8 77 01 80 00 00 	movabs $0x800177,%rax
+  800170:	00 00 00 
+  800173:	ff d0                	call   *%rax
+}
+  800175:	5d                   	pop    %rbp
+  800176:	c3                   	ret
+
+0000000000800177 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800177:	55                   	push   %rbp
+  800178:	48 89 e5             	mov    %rsp,%rbp
+	sys_env_destroy(0);
+  80017b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800180:	48 b8 18 0e 80 00 00 	movabs $0x800e18,%rax
+  800187:	00 00 00 
+  80018a:	ff d0                	call   *%rax
+}
+  80018c:	5d                   	pop    %rbp
+  80018d:	c3                   	ret
+
+000000000080018e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80018e:	55                   	push   %rbp
+  80018f:	48 89 e5             	mov    %rsp,%rbp
+  800192:	53                   	push   %rbx
+  800193:	48 83 ec 08          	sub    $0x8,%rsp
+  800197:	48 89 f3             	mov    %rsi,%rbx
+	b->buf[b->idx++] = ch;
+  80019a:	8b 06                	mov    (%rsi),%eax
+  80019c:	8d 50 01             	lea    0x1(%rax),%edx
+  80019f:	89 16                	mov    %edx,(%rsi)
+  8001a1:	48 98                	cltq
+  8001a3:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+	if (b->idx == 256-1) {
+  8001a8:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001ae:	74 0a                	je     8001ba <putch+0x2c>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001b0:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001b8:	c9                   	leave
+  8001b9:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001ba:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001be:	be ff 00 00 00       	mov    $0xff,%esi
+  8001c3:	48 b8 e0 0d 80 00 00 	movabs $0x800de0,%rax
+  8001ca:	00 00 00 
+  8001cd:	ff d0                	call   *%rax
+		b->idx = 0;
+  8001cf:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001d5:	eb d9                	jmp    8001b0 <putch+0x22>
+
+00000000008001d7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001d7:	55                   	push   %rbp
+  8001d8:	48 89 e5             	mov    %rsp,%rbp
+  8001db:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8001e2:	48 89 fa             	mov    %rdi,%rdx
+  8001e5:	48 89 f1             	mov    %rsi,%rcx
+	struct printbuf b;
+
+	b.idx = 0;
+  8001e8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8001ef:	00 00 00 
+	b.cnt = 0;
+  8001f2:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8001f9:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001fc:	48 8d b5 f0 fe ff ff 	lea    -0x110(%rbp),%rsi
+  800203:	48 bf 8e 01 80 00 00 	movabs $0x80018e,%rdi
+  80020a:	00 00 00 
+  80020d:	48 b8 f5 03 80 00 00 	movabs $0x8003f5,%rax
+  800214:	00 00 00 
+  800217:	ff d0                	call   *%rax
+	sys_cputs(b.buf, b.idx);
+  800219:	48 63 b5 f0 fe ff ff 	movslq -0x110(%rbp),%rsi
+  800220:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800227:	48 b8 e0 0d 80 00 00 	movabs $0x800de0,%rax
+  80022e:	00 00 00 
+  800231:	ff d0                	call   *%rax
+
+	return b.cnt;
+}
+  800233:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+  800239:	c9                   	leave
+  80023a:	c3                   	ret
+
+000000000080023b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80023b:	55                   	push   %rbp
+  80023c:	48 89 e5             	mov    %rsp,%rbp
+  80023f:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800246:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80024d:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800254:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80025b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800262:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800269:	84 c0                	test   %al,%al
+  80026b:	74 20                	je     80028d <cprintf+0x52>
+  80026d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800271:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800275:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800279:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80027d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800281:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800285:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800289:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80028d:	c7 85 38 ff ff ff 08 	movl   $0x8,-0xc8(%rbp)
+  800294:	00 00 00 
+  800297:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80029e:	00 00 00 
+  8002a1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002a5:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8002ac:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8002b3:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	cnt = vcprintf(fmt, ap);
+  8002ba:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  8002c1:	48 b8 d7 01 80 00 00 	movabs $0x8001d7,%rax
+  8002c8:	00 00 00 
+  8002cb:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return cnt;
+}
+  8002cd:	c9                   	leave
+  8002ce:	c3                   	ret
+
+00000000008002cf <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002cf:	55                   	push   %rbp
+  8002d0:	48 89 e5             	mov    %rsp,%rbp
+  8002d3:	41 57                	push   %r15
+  8002d5:	41 56                	push   %r14
+  8002d7:	41 55                	push   %r13
+  8002d9:	41 54                	push   %r12
+  8002db:	53                   	push   %rbx
+  8002dc:	48 83 ec 18          	sub    $0x18,%rsp
+  8002e0:	49 89 fc             	mov    %rdi,%r12
+  8002e3:	49 89 f5             	mov    %rsi,%r13
+  8002e6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002ea:	44 89 c3             	mov    %r8d,%ebx
+  8002ed:	45 89 ce             	mov    %r9d,%r14d
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002f0:	41 89 cf             	mov    %ecx,%r15d
+  8002f3:	4c 39 fa             	cmp    %r15,%rdx
+  8002f6:	72 29                	jb     800321 <printnum+0x52>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002f8:	48 89 d0             	mov    %rdx,%rax
+  8002fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800300:	49 f7 f7             	div    %r15
+  800303:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800307:	48 89 c2             	mov    %rax,%rdx
+  80030a:	48 b8 cf 02 80 00 00 	movabs $0x8002cf,%rax
+  800311:	00 00 00 
+  800314:	ff d0                	call   *%rax
+  800316:	eb 10                	jmp    800328 <printnum+0x59>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800318:	4c 89 ee             	mov    %r13,%rsi
+  80031b:	44 89 f7             	mov    %r14d,%edi
+  80031e:	41 ff d4             	call   *%r12
+		while (--width > 0)
+  800321:	83 eb 01             	sub    $0x1,%ebx
+  800324:	85 db                	test   %ebx,%ebx
+  800326:	7f f0                	jg     800318 <printnum+0x49>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800328:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80032c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800331:	49 f7 f7             	div    %r15
+  800334:	48 b8 19 14 80 00 00 	movabs $0x801419,%rax
+  80033b:	00 00 00 
+  80033e:	0f be 3c 10          	movsbl (%rax,%rdx,1),%edi
+  800342:	4c 89 ee             	mov    %r13,%rsi
+  800345:	41 ff d4             	call   *%r12
+}
+  800348:	48 83 c4 18          	add    $0x18,%rsp
+  80034c:	5b                   	pop    %rbx
+  80034d:	41 5c                	pop    %r12
+  80034f:	41 5d                	pop    %r13
+  800351:	41 5e                	pop    %r14
+  800353:	41 5f                	pop    %r15
+  800355:	5d                   	pop    %rbp
+  800356:	c3                   	ret
+
+0000000000800357 <sprintputch>:
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+	b->cnt++;
+  800357:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+	if (b->buf < b->ebuf)
+  80035b:	48 8b 06             	mov    (%rsi),%rax
+  80035e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800362:	73 0a                	jae    80036e <sprintputch+0x17>
+		*b->buf++ = ch;
+  800364:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800368:	48 89 16             	mov    %rdx,(%rsi)
+  80036b:	40 88 38             	mov    %dil,(%rax)
+}
+  80036e:	c3                   	ret
+
+000000000080036f <printfmt>:
+{
+  80036f:	55                   	push   %rbp
+  800370:	48 89 e5             	mov    %rsp,%rbp
+  800373:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80037a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800381:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800388:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80038f:	84 c0                	test   %al,%al
+  800391:	74 20                	je     8003b3 <printfmt+0x44>
+  800393:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800397:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80039b:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80039f:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8003a3:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8003a7:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8003ab:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8003af:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_start(ap, fmt);
+  8003b3:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8003ba:	00 00 00 
+  8003bd:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8003c4:	00 00 00 
+  8003c7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003cb:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8003d2:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8003d9:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8003e0:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8003e7:	48 b8 f5 03 80 00 00 	movabs $0x8003f5,%rax
+  8003ee:	00 00 00 
+  8003f1:	ff d0                	call   *%rax
+}
+  8003f3:	c9                   	leave
+  8003f4:	c3                   	ret
+
+00000000008003f5 <vprintfmt>:
+{
+  8003f5:	55                   	push   %rbp
+  8003f6:	48 89 e5             	mov    %rsp,%rbp
+  8003f9:	41 57                	push   %r15
+  8003fb:	41 56                	push   %r14
+  8003fd:	41 55                	push   %r13
+  8003ff:	41 54                	push   %r12
+  800401:	53                   	push   %rbx
+  800402:	48 83 ec 48          	sub    $0x48,%rsp
+  800406:	49 89 fe             	mov    %rdi,%r14
+  800409:	49 89 f5             	mov    %rsi,%r13
+  80040c:	48 89 d3             	mov    %rdx,%rbx
+	va_copy(aq,ap);
+  80040f:	f3 0f 6f 01          	movdqu (%rcx),%xmm0
+  800413:	0f 11 45 b8          	movups %xmm0,-0x48(%rbp)
+  800417:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80041b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80041f:	eb 09                	jmp    80042a <vprintfmt+0x35>
+			putch(ch, putdat);
+  800421:	4c 89 ee             	mov    %r13,%rsi
+  800424:	41 ff d6             	call   *%r14
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800427:	4c 89 e3             	mov    %r12,%rbx
+  80042a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80042e:	0f b6 3b             	movzbl (%rbx),%edi
+  800431:	83 ff 25             	cmp    $0x25,%edi
+  800434:	74 13                	je     800449 <vprintfmt+0x54>
+			if (ch == '\0')
+  800436:	85 ff                	test   %edi,%edi
+  800438:	75 e7                	jne    800421 <vprintfmt+0x2c>
+}
+  80043a:	48 83 c4 48          	add    $0x48,%rsp
+  80043e:	5b                   	pop    %rbx
+  80043f:	41 5c                	pop    %r12
+  800441:	41 5d                	pop    %r13
+  800443:	41 5e                	pop    %r14
+  800445:	41 5f                	pop    %r15
+  800447:	5d                   	pop    %rbp
+  800448:	c3                   	ret
+		padc = ' ';
+  800449:	c6 45 a7 20          	movb   $0x20,-0x59(%rbp)
+		altflag = 0;
+  80044d:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+		precision = -1;
+  800454:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+		width = -1;
+  80045a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+		lflag = 0;
+  800461:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800466:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80046b:	41 0f b6 14 24       	movzbl (%r12),%edx
+  800470:	8d 42 dd             	lea    -0x23(%rdx),%eax
+  800473:	3c 55                	cmp    $0x55,%al
+  800475:	0f 87 4f 05 00 00    	ja     8009ca <vprintfmt+0x5d5>
+  80047b:	0f b6 c0             	movzbl %al,%eax
+  80047e:	48 be e0 14 80 00 00 	movabs $0x8014e0,%rsi
+  800485:	00 00 00 
+  800488:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+  80048b:	49 89 dc             	mov    %rbx,%r12
+			padc = '-';
+  80048e:	c6 45 a7 2d          	movb   $0x2d,-0x59(%rbp)
+  800492:	eb d2                	jmp    800466 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  800494:	49 89 dc             	mov    %rbx,%r12
+  800497:	c6 45 a7 30          	movb   $0x30,-0x59(%rbp)
+  80049b:	eb c9                	jmp    800466 <vprintfmt+0x71>
+  80049d:	0f b6 d2             	movzbl %dl,%edx
+  8004a0:	49 89 dc             	mov    %rbx,%r12
+			for (precision = 0; ; ++fmt) {
+  8004a3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+				precision = precision * 10 + ch - '0';
+  8004a9:	43 8d 04 bf          	lea    (%r15,%r15,4),%eax
+  8004ad:	44 8d 7c 42 d0       	lea    -0x30(%rdx,%rax,2),%r15d
+				ch = *fmt;
+  8004b2:	41 0f be 14 24       	movsbl (%r12),%edx
+				if (ch < '0' || ch > '9')
+  8004b7:	8d 42 d0             	lea    -0x30(%rdx),%eax
+  8004ba:	83 f8 09             	cmp    $0x9,%eax
+  8004bd:	77 20                	ja     8004df <vprintfmt+0xea>
+			for (precision = 0; ; ++fmt) {
+  8004bf:	49 83 c4 01          	add    $0x1,%r12
+				precision = precision * 10 + ch - '0';
+  8004c3:	eb e4                	jmp    8004a9 <vprintfmt+0xb4>
+			precision = va_arg(aq, int);
+  8004c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8004cb:	77 27                	ja     8004f4 <vprintfmt+0xff>
+  8004cd:	89 c2                	mov    %eax,%edx
+  8004cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004d3:	83 c0 08             	add    $0x8,%eax
+  8004d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004d9:	44 8b 3a             	mov    (%rdx),%r15d
+		switch (ch = *(unsigned char *) fmt++) {
+  8004dc:	49 89 dc             	mov    %rbx,%r12
+			if (width < 0)
+  8004df:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004e3:	79 81                	jns    800466 <vprintfmt+0x71>
+				width = precision, precision = -1;
+  8004e5:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+  8004e9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004ef:	e9 72 ff ff ff       	jmp    800466 <vprintfmt+0x71>
+			precision = va_arg(aq, int);
+  8004f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800500:	eb d7                	jmp    8004d9 <vprintfmt+0xe4>
+			if (width < 0)
+  800502:	8b 75 ac             	mov    -0x54(%rbp),%esi
+  800505:	85 f6                	test   %esi,%esi
+  800507:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050c:	0f 49 c6             	cmovns %esi,%eax
+  80050f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800512:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  800515:	e9 4c ff ff ff       	jmp    800466 <vprintfmt+0x71>
+		switch (ch = *(unsigned char *) fmt++) {
+  80051a:	49 89 dc             	mov    %rbx,%r12
+			altflag = 1;
+  80051d:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+			goto reswitch;
+  800524:	e9 3d ff ff ff       	jmp    800466 <vprintfmt+0x71>
+			lflag++;
+  800529:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80052c:	49 89 dc             	mov    %rbx,%r12
+			goto reswitch;
+  80052f:	e9 32 ff ff ff       	jmp    800466 <vprintfmt+0x71>
+			putch(va_arg(aq, int), putdat);
+  800534:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800537:	83 f8 2f             	cmp    $0x2f,%eax
+  80053a:	77 19                	ja     800555 <vprintfmt+0x160>
+  80053c:	89 c2                	mov    %eax,%edx
+  80053e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800542:	83 c0 08             	add    $0x8,%eax
+  800545:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800548:	8b 3a                	mov    (%rdx),%edi
+  80054a:	4c 89 ee             	mov    %r13,%rsi
+  80054d:	41 ff d6             	call   *%r14
+			break;
+  800550:	e9 d5 fe ff ff       	jmp    80042a <vprintfmt+0x35>
+			putch(va_arg(aq, int), putdat);
+  800555:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800559:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80055d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800561:	eb e5                	jmp    800548 <vprintfmt+0x153>
+			err = va_arg(aq, int);
+  800563:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800566:	83 f8 2f             	cmp    $0x2f,%eax
+  800569:	77 5a                	ja     8005c5 <vprintfmt+0x1d0>
+  80056b:	89 c2                	mov    %eax,%edx
+  80056d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800571:	83 c0 08             	add    $0x8,%eax
+  800574:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			if (err < 0)
+  800577:	8b 02                	mov    (%rdx),%eax
+  800579:	89 c1                	mov    %eax,%ecx
+  80057b:	f7 d9                	neg    %ecx
+  80057d:	0f 48 c8             	cmovs  %eax,%ecx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800580:	83 f9 08             	cmp    $0x8,%ecx
+  800583:	7f 4e                	jg     8005d3 <vprintfmt+0x1de>
+  800585:	48 63 c1             	movslq %ecx,%rax
+  800588:	48 ba a0 17 80 00 00 	movabs $0x8017a0,%rdx
+  80058f:	00 00 00 
+  800592:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800596:	48 85 c0             	test   %rax,%rax
+  800599:	74 38                	je     8005d3 <vprintfmt+0x1de>
+				printfmt(putch, putdat, "%s", p);
+  80059b:	48 89 c1             	mov    %rax,%rcx
+  80059e:	48 ba 3a 14 80 00 00 	movabs $0x80143a,%rdx
+  8005a5:	00 00 00 
+  8005a8:	4c 89 ee             	mov    %r13,%rsi
+  8005ab:	4c 89 f7             	mov    %r14,%rdi
+  8005ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b3:	49 b8 6f 03 80 00 00 	movabs $0x80036f,%r8
+  8005ba:	00 00 00 
+  8005bd:	41 ff d0             	call   *%r8
+  8005c0:	e9 65 fe ff ff       	jmp    80042a <vprintfmt+0x35>
+			err = va_arg(aq, int);
+  8005c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d1:	eb a4                	jmp    800577 <vprintfmt+0x182>
+				printfmt(putch, putdat, "error %d", err);
+  8005d3:	48 ba 31 14 80 00 00 	movabs $0x801431,%rdx
+  8005da:	00 00 00 
+  8005dd:	4c 89 ee             	mov    %r13,%rsi
+  8005e0:	4c 89 f7             	mov    %r14,%rdi
+  8005e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e8:	49 b8 6f 03 80 00 00 	movabs $0x80036f,%r8
+  8005ef:	00 00 00 
+  8005f2:	41 ff d0             	call   *%r8
+  8005f5:	e9 30 fe ff ff       	jmp    80042a <vprintfmt+0x35>
+			if ((p = va_arg(aq, char *)) == NULL)
+  8005fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005fd:	83 f8 2f             	cmp    $0x2f,%eax
+  800600:	77 36                	ja     800638 <vprintfmt+0x243>
+  800602:	89 c2                	mov    %eax,%edx
+  800604:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800608:	83 c0 08             	add    $0x8,%eax
+  80060b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80060e:	48 8b 0a             	mov    (%rdx),%rcx
+				p = "(null)";
+  800611:	48 85 c9             	test   %rcx,%rcx
+  800614:	48 b8 2a 14 80 00 00 	movabs $0x80142a,%rax
+  80061b:	00 00 00 
+  80061e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800622:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+			if (width > 0 && padc != '-')
+  800626:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80062a:	7e 06                	jle    800632 <vprintfmt+0x23d>
+  80062c:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%rbp)
+  800630:	75 14                	jne    800646 <vprintfmt+0x251>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800632:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800636:	eb 64                	jmp    80069c <vprintfmt+0x2a7>
+			if ((p = va_arg(aq, char *)) == NULL)
+  800638:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80063c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800640:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800644:	eb c8                	jmp    80060e <vprintfmt+0x219>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800646:	49 63 f7             	movslq %r15d,%rsi
+  800649:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  80064d:	48 b8 d8 0a 80 00 00 	movabs $0x800ad8,%rax
+  800654:	00 00 00 
+  800657:	ff d0                	call   *%rax
+  800659:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80065c:	29 c1                	sub    %eax,%ecx
+  80065e:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+  800661:	41 89 cc             	mov    %ecx,%r12d
+					putch(padc, putdat);
+  800664:	0f be 45 a7          	movsbl -0x59(%rbp),%eax
+  800668:	89 45 ac             	mov    %eax,-0x54(%rbp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80066b:	eb 0d                	jmp    80067a <vprintfmt+0x285>
+					putch(padc, putdat);
+  80066d:	4c 89 ee             	mov    %r13,%rsi
+  800670:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  800673:	41 ff d6             	call   *%r14
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800676:	41 83 ec 01          	sub    $0x1,%r12d
+  80067a:	45 85 e4             	test   %r12d,%r12d
+  80067d:	7f ee                	jg     80066d <vprintfmt+0x278>
+  80067f:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  800682:	85 c9                	test   %ecx,%ecx
+  800684:	b8 00 00 00 00       	mov    $0x0,%eax
+  800689:	0f 49 c1             	cmovns %ecx,%eax
+  80068c:	29 c1                	sub    %eax,%ecx
+  80068e:	89 4d ac             	mov    %ecx,-0x54(%rbp)
+  800691:	eb 9f                	jmp    800632 <vprintfmt+0x23d>
+					putch(ch, putdat);
+  800693:	4c 89 ee             	mov    %r13,%rsi
+  800696:	41 ff d6             	call   *%r14
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800699:	4c 89 e2             	mov    %r12,%rdx
+  80069c:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8006a0:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006a6:	0f be f8             	movsbl %al,%edi
+  8006a9:	85 ff                	test   %edi,%edi
+  8006ab:	74 29                	je     8006d6 <vprintfmt+0x2e1>
+  8006ad:	45 85 ff             	test   %r15d,%r15d
+  8006b0:	78 06                	js     8006b8 <vprintfmt+0x2c3>
+  8006b2:	41 83 ef 01          	sub    $0x1,%r15d
+  8006b6:	78 1e                	js     8006d6 <vprintfmt+0x2e1>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006b8:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  8006bc:	74 d5                	je     800693 <vprintfmt+0x29e>
+  8006be:	0f be c0             	movsbl %al,%eax
+  8006c1:	83 e8 20             	sub    $0x20,%eax
+  8006c4:	83 f8 5e             	cmp    $0x5e,%eax
+  8006c7:	76 ca                	jbe    800693 <vprintfmt+0x29e>
+					putch('?', putdat);
+  8006c9:	4c 89 ee             	mov    %r13,%rsi
+  8006cc:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006d1:	41 ff d6             	call   *%r14
+  8006d4:	eb c3                	jmp    800699 <vprintfmt+0x2a4>
+  8006d6:	44 8b 65 ac          	mov    -0x54(%rbp),%r12d
+  8006da:	8b 45 98             	mov    -0x68(%rbp),%eax
+  8006dd:	41 01 c4             	add    %eax,%r12d
+  8006e0:	41 29 d4             	sub    %edx,%r12d
+  8006e3:	eb 0f                	jmp    8006f4 <vprintfmt+0x2ff>
+				putch(' ', putdat);
+  8006e5:	4c 89 ee             	mov    %r13,%rsi
+  8006e8:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006ed:	41 ff d6             	call   *%r14
+			for (; width > 0; width--)
+  8006f0:	41 83 ec 01          	sub    $0x1,%r12d
+  8006f4:	45 85 e4             	test   %r12d,%r12d
+  8006f7:	7f ec                	jg     8006e5 <vprintfmt+0x2f0>
+  8006f9:	e9 2c fd ff ff       	jmp    80042a <vprintfmt+0x35>
+	if (lflag >= 2)
+  8006fe:	83 f9 01             	cmp    $0x1,%ecx
+  800701:	7f 1d                	jg     800720 <vprintfmt+0x32b>
+	else if (lflag)
+  800703:	85 c9                	test   %ecx,%ecx
+  800705:	74 5e                	je     800765 <vprintfmt+0x370>
+		return va_arg(*ap, long);
+  800707:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80070a:	83 f8 2f             	cmp    $0x2f,%eax
+  80070d:	77 48                	ja     800757 <vprintfmt+0x362>
+  80070f:	89 c2                	mov    %eax,%edx
+  800711:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800715:	83 c0 08             	add    $0x8,%eax
+  800718:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80071b:	4c 8b 22             	mov    (%rdx),%r12
+  80071e:	eb 17                	jmp    800737 <vprintfmt+0x342>
+		return va_arg(*ap, long long);
+  800720:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800723:	83 f8 2f             	cmp    $0x2f,%eax
+  800726:	77 21                	ja     800749 <vprintfmt+0x354>
+  800728:	89 c2                	mov    %eax,%edx
+  80072a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80072e:	83 c0 08             	add    $0x8,%eax
+  800731:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800734:	4c 8b 22             	mov    (%rdx),%r12
+			if ((long long) num < 0) {
+  800737:	4d 85 e4             	test   %r12,%r12
+  80073a:	78 50                	js     80078c <vprintfmt+0x397>
+			num = getint(&aq, lflag);
+  80073c:	4c 89 e2             	mov    %r12,%rdx
+			base = 10;
+  80073f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800744:	e9 b4 01 00 00       	jmp    8008fd <vprintfmt+0x508>
+		return va_arg(*ap, long long);
+  800749:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80074d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800751:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800755:	eb dd                	jmp    800734 <vprintfmt+0x33f>
+		return va_arg(*ap, long);
+  800757:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80075b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80075f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800763:	eb b6                	jmp    80071b <vprintfmt+0x326>
+		return va_arg(*ap, int);
+  800765:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800768:	83 f8 2f             	cmp    $0x2f,%eax
+  80076b:	77 11                	ja     80077e <vprintfmt+0x389>
+  80076d:	89 c2                	mov    %eax,%edx
+  80076f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800773:	83 c0 08             	add    $0x8,%eax
+  800776:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800779:	4c 63 22             	movslq (%rdx),%r12
+  80077c:	eb b9                	jmp    800737 <vprintfmt+0x342>
+  80077e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800782:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800786:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80078a:	eb ed                	jmp    800779 <vprintfmt+0x384>
+				putch('-', putdat);
+  80078c:	4c 89 ee             	mov    %r13,%rsi
+  80078f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800794:	41 ff d6             	call   *%r14
+				num = -(long long) num;
+  800797:	4c 89 e2             	mov    %r12,%rdx
+  80079a:	48 f7 da             	neg    %rdx
+			base = 10;
+  80079d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8007a2:	e9 56 01 00 00       	jmp    8008fd <vprintfmt+0x508>
+	if (lflag >= 2)
+  8007a7:	83 f9 01             	cmp    $0x1,%ecx
+  8007aa:	7f 25                	jg     8007d1 <vprintfmt+0x3dc>
+	else if (lflag)
+  8007ac:	85 c9                	test   %ecx,%ecx
+  8007ae:	74 5e                	je     80080e <vprintfmt+0x419>
+		return va_arg(*ap, unsigned long);
+  8007b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b6:	77 48                	ja     800800 <vprintfmt+0x40b>
+  8007b8:	89 c2                	mov    %eax,%edx
+  8007ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007be:	83 c0 08             	add    $0x8,%eax
+  8007c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c4:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8007c7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long);
+  8007cc:	e9 2c 01 00 00       	jmp    8008fd <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  8007d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d7:	77 19                	ja     8007f2 <vprintfmt+0x3fd>
+  8007d9:	89 c2                	mov    %eax,%edx
+  8007db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007df:	83 c0 08             	add    $0x8,%eax
+  8007e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007e5:	48 8b 12             	mov    (%rdx),%rdx
+			base = 10;
+  8007e8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned long long);
+  8007ed:	e9 0b 01 00 00       	jmp    8008fd <vprintfmt+0x508>
+  8007f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007fe:	eb e5                	jmp    8007e5 <vprintfmt+0x3f0>
+		return va_arg(*ap, unsigned long);
+  800800:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800804:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800808:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80080c:	eb b6                	jmp    8007c4 <vprintfmt+0x3cf>
+		return va_arg(*ap, unsigned int);
+  80080e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800811:	83 f8 2f             	cmp    $0x2f,%eax
+  800814:	77 18                	ja     80082e <vprintfmt+0x439>
+  800816:	89 c2                	mov    %eax,%edx
+  800818:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081c:	83 c0 08             	add    $0x8,%eax
+  80081f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800822:	8b 12                	mov    (%rdx),%edx
+			base = 10;
+  800824:	b9 0a 00 00 00       	mov    $0xa,%ecx
+		return va_arg(*ap, unsigned int);
+  800829:	e9 cf 00 00 00       	jmp    8008fd <vprintfmt+0x508>
+  80082e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800832:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800836:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083a:	eb e6                	jmp    800822 <vprintfmt+0x42d>
+	if (lflag >= 2)
+  80083c:	83 f9 01             	cmp    $0x1,%ecx
+  80083f:	7f 25                	jg     800866 <vprintfmt+0x471>
+	else if (lflag)
+  800841:	85 c9                	test   %ecx,%ecx
+  800843:	74 5b                	je     8008a0 <vprintfmt+0x4ab>
+		return va_arg(*ap, unsigned long);
+  800845:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800848:	83 f8 2f             	cmp    $0x2f,%eax
+  80084b:	77 45                	ja     800892 <vprintfmt+0x49d>
+  80084d:	89 c2                	mov    %eax,%edx
+  80084f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800853:	83 c0 08             	add    $0x8,%eax
+  800856:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800859:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  80085c:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long);
+  800861:	e9 97 00 00 00       	jmp    8008fd <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800866:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800869:	83 f8 2f             	cmp    $0x2f,%eax
+  80086c:	77 16                	ja     800884 <vprintfmt+0x48f>
+  80086e:	89 c2                	mov    %eax,%edx
+  800870:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800874:	83 c0 08             	add    $0x8,%eax
+  800877:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087a:	48 8b 12             	mov    (%rdx),%rdx
+			base = 8;
+  80087d:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned long long);
+  800882:	eb 79                	jmp    8008fd <vprintfmt+0x508>
+  800884:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800888:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80088c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800890:	eb e8                	jmp    80087a <vprintfmt+0x485>
+		return va_arg(*ap, unsigned long);
+  800892:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800896:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089e:	eb b9                	jmp    800859 <vprintfmt+0x464>
+		return va_arg(*ap, unsigned int);
+  8008a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a6:	77 15                	ja     8008bd <vprintfmt+0x4c8>
+  8008a8:	89 c2                	mov    %eax,%edx
+  8008aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ae:	83 c0 08             	add    $0x8,%eax
+  8008b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b4:	8b 12                	mov    (%rdx),%edx
+			base = 8;
+  8008b6:	b9 08 00 00 00       	mov    $0x8,%ecx
+		return va_arg(*ap, unsigned int);
+  8008bb:	eb 40                	jmp    8008fd <vprintfmt+0x508>
+  8008bd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c9:	eb e9                	jmp    8008b4 <vprintfmt+0x4bf>
+			putch('0', putdat);
+  8008cb:	4c 89 ee             	mov    %r13,%rsi
+  8008ce:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008d3:	41 ff d6             	call   *%r14
+			putch('x', putdat);
+  8008d6:	4c 89 ee             	mov    %r13,%rsi
+  8008d9:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008de:	41 ff d6             	call   *%r14
+				(uintptr_t) va_arg(aq, void *);
+  8008e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e7:	77 34                	ja     80091d <vprintfmt+0x528>
+  8008e9:	89 c2                	mov    %eax,%edx
+  8008eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ef:	83 c0 08             	add    $0x8,%eax
+  8008f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+			num = (unsigned long long)
+  8008f5:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  8008f8:	b9 10 00 00 00       	mov    $0x10,%ecx
+			printnum(putch, putdat, num, base, width, padc);
+  8008fd:	44 0f be 4d a7       	movsbl -0x59(%rbp),%r9d
+  800902:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800906:	4c 89 ee             	mov    %r13,%rsi
+  800909:	4c 89 f7             	mov    %r14,%rdi
+  80090c:	48 b8 cf 02 80 00 00 	movabs $0x8002cf,%rax
+  800913:	00 00 00 
+  800916:	ff d0                	call   *%rax
+			break;
+  800918:	e9 0d fb ff ff       	jmp    80042a <vprintfmt+0x35>
+				(uintptr_t) va_arg(aq, void *);
+  80091d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800921:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800925:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800929:	eb ca                	jmp    8008f5 <vprintfmt+0x500>
+	if (lflag >= 2)
+  80092b:	83 f9 01             	cmp    $0x1,%ecx
+  80092e:	7f 22                	jg     800952 <vprintfmt+0x55d>
+	else if (lflag)
+  800930:	85 c9                	test   %ecx,%ecx
+  800932:	74 58                	je     80098c <vprintfmt+0x597>
+		return va_arg(*ap, unsigned long);
+  800934:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800937:	83 f8 2f             	cmp    $0x2f,%eax
+  80093a:	77 42                	ja     80097e <vprintfmt+0x589>
+  80093c:	89 c2                	mov    %eax,%edx
+  80093e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800942:	83 c0 08             	add    $0x8,%eax
+  800945:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800948:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  80094b:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long);
+  800950:	eb ab                	jmp    8008fd <vprintfmt+0x508>
+		return va_arg(*ap, unsigned long long);
+  800952:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800955:	83 f8 2f             	cmp    $0x2f,%eax
+  800958:	77 16                	ja     800970 <vprintfmt+0x57b>
+  80095a:	89 c2                	mov    %eax,%edx
+  80095c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800960:	83 c0 08             	add    $0x8,%eax
+  800963:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800966:	48 8b 12             	mov    (%rdx),%rdx
+			base = 16;
+  800969:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned long long);
+  80096e:	eb 8d                	jmp    8008fd <vprintfmt+0x508>
+  800970:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800974:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800978:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097c:	eb e8                	jmp    800966 <vprintfmt+0x571>
+		return va_arg(*ap, unsigned long);
+  80097e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800982:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800986:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098a:	eb bc                	jmp    800948 <vprintfmt+0x553>
+		return va_arg(*ap, unsigned int);
+  80098c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098f:	83 f8 2f             	cmp    $0x2f,%eax
+  800992:	77 18                	ja     8009ac <vprintfmt+0x5b7>
+  800994:	89 c2                	mov    %eax,%edx
+  800996:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099a:	83 c0 08             	add    $0x8,%eax
+  80099d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a0:	8b 12                	mov    (%rdx),%edx
+			base = 16;
+  8009a2:	b9 10 00 00 00       	mov    $0x10,%ecx
+		return va_arg(*ap, unsigned int);
+  8009a7:	e9 51 ff ff ff       	jmp    8008fd <vprintfmt+0x508>
+  8009ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b8:	eb e6                	jmp    8009a0 <vprintfmt+0x5ab>
+			putch(ch, putdat);
+  8009ba:	4c 89 ee             	mov    %r13,%rsi
+  8009bd:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009c2:	41 ff d6             	call   *%r14
+			break;
+  8009c5:	e9 60 fa ff ff       	jmp    80042a <vprintfmt+0x35>
+			putch('%', putdat);
+  8009ca:	4c 89 ee             	mov    %r13,%rsi
+  8009cd:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009d2:	41 ff d6             	call   *%r14
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8009d5:	4c 89 e3             	mov    %r12,%rbx
+  8009d8:	eb 04                	jmp    8009de <vprintfmt+0x5e9>
+  8009da:	48 83 eb 01          	sub    $0x1,%rbx
+  8009de:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8009e2:	75 f6                	jne    8009da <vprintfmt+0x5e5>
+  8009e4:	e9 41 fa ff ff       	jmp    80042a <vprintfmt+0x35>
+
+00000000008009e9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009e9:	55                   	push   %rbp
+  8009ea:	48 89 e5             	mov    %rsp,%rbp
+  8009ed:	48 83 ec 20          	sub    $0x20,%rsp
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009f1:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8009f5:	48 63 c6             	movslq %esi,%rax
+  8009f8:	48 8d 44 07 ff       	lea    -0x1(%rdi,%rax,1),%rax
+  8009fd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800a01:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+	if (buf == NULL || n < 1)
+  800a08:	48 85 ff             	test   %rdi,%rdi
+  800a0b:	74 2a                	je     800a37 <vsnprintf+0x4e>
+  800a0d:	85 f6                	test   %esi,%esi
+  800a0f:	7e 26                	jle    800a37 <vsnprintf+0x4e>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a11:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800a15:	48 bf 57 03 80 00 00 	movabs $0x800357,%rdi
+  800a1c:	00 00 00 
+  800a1f:	48 b8 f5 03 80 00 00 	movabs $0x8003f5,%rax
+  800a26:	00 00 00 
+  800a29:	ff d0                	call   *%rax
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a2b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800a2f:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800a32:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800a35:	c9                   	leave
+  800a36:	c3                   	ret
+		return -E_INVAL;
+  800a37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a3c:	eb f7                	jmp    800a35 <vsnprintf+0x4c>
+
+0000000000800a3e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a3e:	55                   	push   %rbp
+  800a3f:	48 89 e5             	mov    %rsp,%rbp
+  800a42:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  800a49:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800a50:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800a57:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800a5e:	84 c0                	test   %al,%al
+  800a60:	74 20                	je     800a82 <snprintf+0x44>
+  800a62:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800a66:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800a6a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800a6e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800a72:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800a76:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800a7a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800a7e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a82:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800a89:	00 00 00 
+  800a8c:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800a93:	00 00 00 
+  800a96:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a9a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800aa1:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800aa8:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	rc = vsnprintf(buf, n, fmt, ap);
+  800aaf:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800ab6:	48 b8 e9 09 80 00 00 	movabs $0x8009e9,%rax
+  800abd:	00 00 00 
+  800ac0:	ff d0                	call   *%rax
+	va_end(ap);
+
+	return rc;
+}
+  800ac2:	c9                   	leave
+  800ac3:	c3                   	ret
+
+0000000000800ac4 <strlen>:
+int
+strlen(const char *s)
+{
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800ac4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ac9:	48 89 d0             	mov    %rdx,%rax
+  800acc:	48 83 c2 01          	add    $0x1,%rdx
+  800ad0:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  800ad5:	75 f2                	jne    800ac9 <strlen+0x5>
+		n++;
+	return n;
+}
+  800ad7:	c3                   	ret
+
+0000000000800ad8 <strnlen>:
+int
+strnlen(const char *s, size_t size)
+{
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800add:	eb 03                	jmp    800ae2 <strnlen+0xa>
+  800adf:	48 89 d0             	mov    %rdx,%rax
+  800ae2:	48 39 c6             	cmp    %rax,%rsi
+  800ae5:	74 0a                	je     800af1 <strnlen+0x19>
+  800ae7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800aeb:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800aef:	75 ee                	jne    800adf <strnlen+0x7>
+		n++;
+	return n;
+}
+  800af1:	c3                   	ret
+
+0000000000800af2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800af2:	48 89 f8             	mov    %rdi,%rax
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800af5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800afa:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800afe:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b01:	48 83 c2 01          	add    $0x1,%rdx
+  800b05:	84 c9                	test   %cl,%cl
+  800b07:	75 f1                	jne    800afa <strcpy+0x8>
+		/* do nothing */;
+	return ret;
+}
+  800b09:	c3                   	ret
+
+0000000000800b0a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b0a:	55                   	push   %rbp
+  800b0b:	48 89 e5             	mov    %rsp,%rbp
+  800b0e:	41 54                	push   %r12
+  800b10:	53                   	push   %rbx
+  800b11:	48 89 fb             	mov    %rdi,%rbx
+  800b14:	49 89 f4             	mov    %rsi,%r12
+	int len = strlen(dst);
+  800b17:	48 b8 c4 0a 80 00 00 	movabs $0x800ac4,%rax
+  800b1e:	00 00 00 
+  800b21:	ff d0                	call   *%rax
+	strcpy(dst + len, src);
+  800b23:	48 63 f8             	movslq %eax,%rdi
+  800b26:	48 01 df             	add    %rbx,%rdi
+  800b29:	4c 89 e6             	mov    %r12,%rsi
+  800b2c:	48 b8 f2 0a 80 00 00 	movabs $0x800af2,%rax
+  800b33:	00 00 00 
+  800b36:	ff d0                	call   *%rax
+	return dst;
+}
+  800b38:	48 89 d8             	mov    %rbx,%rax
+  800b3b:	5b                   	pop    %rbx
+  800b3c:	41 5c                	pop    %r12
+  800b3e:	5d                   	pop    %rbp
+  800b3f:	c3                   	ret
+
+0000000000800b40 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b40:	48 89 f8             	mov    %rdi,%rax
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b43:	48 01 fa             	add    %rdi,%rdx
+  800b46:	48 89 f9             	mov    %rdi,%rcx
+  800b49:	eb 14                	jmp    800b5f <strncpy+0x1f>
+		*dst++ = *src;
+  800b4b:	48 83 c1 01          	add    $0x1,%rcx
+  800b4f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b53:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b57:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b5b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+	for (i = 0; i < size; i++) {
+  800b5f:	48 39 d1             	cmp    %rdx,%rcx
+  800b62:	75 e7                	jne    800b4b <strncpy+0xb>
+	}
+	return ret;
+}
+  800b64:	c3                   	ret
+
+0000000000800b65 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size)
+{
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b65:	48 89 f8             	mov    %rdi,%rax
+  800b68:	48 85 d2             	test   %rdx,%rdx
+  800b6b:	74 27                	je     800b94 <strlcpy+0x2f>
+  800b6d:	48 8d 44 17 ff       	lea    -0x1(%rdi,%rdx,1),%rax
+  800b72:	48 89 fa             	mov    %rdi,%rdx
+  800b75:	eb 0b                	jmp    800b82 <strlcpy+0x1d>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b77:	48 83 c6 01          	add    $0x1,%rsi
+  800b7b:	48 83 c2 01          	add    $0x1,%rdx
+  800b7f:	88 4a ff             	mov    %cl,-0x1(%rdx)
+		while (--size > 0 && *src != '\0')
+  800b82:	48 39 c2             	cmp    %rax,%rdx
+  800b85:	74 0a                	je     800b91 <strlcpy+0x2c>
+  800b87:	0f b6 0e             	movzbl (%rsi),%ecx
+  800b8a:	84 c9                	test   %cl,%cl
+  800b8c:	75 e9                	jne    800b77 <strlcpy+0x12>
+  800b8e:	48 89 d0             	mov    %rdx,%rax
+		*dst = '\0';
+  800b91:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  800b94:	48 29 f8             	sub    %rdi,%rax
+}
+  800b97:	c3                   	ret
+
+0000000000800b98 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+	while (*p && *p == *q)
+  800b98:	eb 08                	jmp    800ba2 <strcmp+0xa>
+		p++, q++;
+  800b9a:	48 83 c7 01          	add    $0x1,%rdi
+  800b9e:	48 83 c6 01          	add    $0x1,%rsi
+	while (*p && *p == *q)
+  800ba2:	0f b6 07             	movzbl (%rdi),%eax
+  800ba5:	84 c0                	test   %al,%al
+  800ba7:	74 04                	je     800bad <strcmp+0x15>
+  800ba9:	3a 06                	cmp    (%rsi),%al
+  800bab:	74 ed                	je     800b9a <strcmp+0x2>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bad:	0f b6 c0             	movzbl %al,%eax
+  800bb0:	0f b6 16             	movzbl (%rsi),%edx
+  800bb3:	29 d0                	sub    %edx,%eax
+}
+  800bb5:	c3                   	ret
+
+0000000000800bb6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+	while (n > 0 && *p && *p == *q)
+  800bb6:	eb 0c                	jmp    800bc4 <strncmp+0xe>
+		n--, p++, q++;
+  800bb8:	48 83 ea 01          	sub    $0x1,%rdx
+  800bbc:	48 83 c7 01          	add    $0x1,%rdi
+  800bc0:	48 83 c6 01          	add    $0x1,%rsi
+	while (n > 0 && *p && *p == *q)
+  800bc4:	48 85 d2             	test   %rdx,%rdx
+  800bc7:	74 14                	je     800bdd <strncmp+0x27>
+  800bc9:	0f b6 07             	movzbl (%rdi),%eax
+  800bcc:	84 c0                	test   %al,%al
+  800bce:	74 04                	je     800bd4 <strncmp+0x1e>
+  800bd0:	3a 06                	cmp    (%rsi),%al
+  800bd2:	74 e4                	je     800bb8 <strncmp+0x2>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bd4:	0f b6 07             	movzbl (%rdi),%eax
+  800bd7:	0f b6 16             	movzbl (%rsi),%edx
+  800bda:	29 d0                	sub    %edx,%eax
+}
+  800bdc:	c3                   	ret
+		return 0;
+  800bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be2:	c3                   	ret
+
+0000000000800be3 <strchr>:
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+	for (; *s; s++)
+  800be3:	eb 04                	jmp    800be9 <strchr+0x6>
+  800be5:	48 83 c7 01          	add    $0x1,%rdi
+  800be9:	0f b6 07             	movzbl (%rdi),%eax
+  800bec:	84 c0                	test   %al,%al
+  800bee:	74 09                	je     800bf9 <strchr+0x16>
+		if (*s == c)
+  800bf0:	40 38 f0             	cmp    %sil,%al
+  800bf3:	75 f0                	jne    800be5 <strchr+0x2>
+  800bf5:	48 89 f8             	mov    %rdi,%rax
+			return (char *) s;
+	return 0;
+}
+  800bf8:	c3                   	ret
+	return 0;
+  800bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfe:	c3                   	ret
+
+0000000000800bff <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bff:	48 89 f8             	mov    %rdi,%rax
+	for (; *s; s++)
+  800c02:	0f b6 10             	movzbl (%rax),%edx
+		if (*s == c)
+  800c05:	40 38 f2             	cmp    %sil,%dl
+  800c08:	74 0a                	je     800c14 <strfind+0x15>
+  800c0a:	84 d2                	test   %dl,%dl
+  800c0c:	74 06                	je     800c14 <strfind+0x15>
+	for (; *s; s++)
+  800c0e:	48 83 c0 01          	add    $0x1,%rax
+  800c12:	eb ee                	jmp    800c02 <strfind+0x3>
+			break;
+	return (char *) s;
+}
+  800c14:	c3                   	ret
+
+0000000000800c15 <memset>:
+void *
+memset(void *v, int c, size_t n)
+{
+	char *p;
+
+	if (n == 0)
+  800c15:	48 85 d2             	test   %rdx,%rdx
+  800c18:	74 28                	je     800c42 <memset+0x2d>
+		return v;
+	if ((size_t)v%4 == 0 && n%4 == 0) {
+  800c1a:	48 89 f8             	mov    %rdi,%rax
+  800c1d:	48 09 d0             	or     %rdx,%rax
+  800c20:	a8 03                	test   $0x3,%al
+  800c22:	75 16                	jne    800c3a <memset+0x25>
+		c &= 0xFF;
+  800c24:	40 0f b6 f6          	movzbl %sil,%esi
+  800c28:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c2e:	48 89 d1             	mov    %rdx,%rcx
+  800c31:	48 c1 e9 02          	shr    $0x2,%rcx
+		asm volatile("cld; rep stosl\n"
+  800c35:	fc                   	cld
+  800c36:	f3 ab                	rep stos %eax,%es:(%rdi)
+  800c38:	eb 08                	jmp    800c42 <memset+0x2d>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c3a:	89 f0                	mov    %esi,%eax
+  800c3c:	48 89 d1             	mov    %rdx,%rcx
+  800c3f:	fc                   	cld
+  800c40:	f3 aa                	rep stos %al,%es:(%rdi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c42:	48 89 f8             	mov    %rdi,%rax
+  800c45:	c3                   	ret
+
+0000000000800c46 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c46:	48 89 f8             	mov    %rdi,%rax
+  800c49:	48 89 d1             	mov    %rdx,%rcx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c4c:	48 39 fe             	cmp    %rdi,%rsi
+  800c4f:	73 3a                	jae    800c8b <memmove+0x45>
+  800c51:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800c55:	48 39 d7             	cmp    %rdx,%rdi
+  800c58:	73 31                	jae    800c8b <memmove+0x45>
+		s += n;
+		d += n;
+  800c5a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800c5e:	48 89 d6             	mov    %rdx,%rsi
+  800c61:	48 09 fe             	or     %rdi,%rsi
+  800c64:	48 09 ce             	or     %rcx,%rsi
+  800c67:	40 f6 c6 03          	test   $0x3,%sil
+  800c6b:	75 11                	jne    800c7e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c6d:	48 83 ef 04          	sub    $0x4,%rdi
+  800c71:	48 8d 72 fc          	lea    -0x4(%rdx),%rsi
+  800c75:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  800c79:	fd                   	std
+  800c7a:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800c7c:	eb 0b                	jmp    800c89 <memmove+0x43>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c7e:	48 83 ef 01          	sub    $0x1,%rdi
+  800c82:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+			asm volatile("std; rep movsb\n"
+  800c86:	fd                   	std
+  800c87:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c89:	fc                   	cld
+  800c8a:	c3                   	ret
+	} else {
+		if ((size_t)s%4 == 0 && (size_t)d%4 == 0 && n%4 == 0)
+  800c8b:	48 89 f2             	mov    %rsi,%rdx
+  800c8e:	48 09 c2             	or     %rax,%rdx
+  800c91:	48 09 ca             	or     %rcx,%rdx
+  800c94:	f6 c2 03             	test   $0x3,%dl
+  800c97:	75 0b                	jne    800ca4 <memmove+0x5e>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c99:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("cld; rep movsl\n"
+  800c9d:	48 89 c7             	mov    %rax,%rdi
+  800ca0:	fc                   	cld
+  800ca1:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800ca3:	c3                   	ret
+		else
+			asm volatile("cld; rep movsb\n"
+  800ca4:	48 89 c7             	mov    %rax,%rdi
+  800ca7:	fc                   	cld
+  800ca8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800caa:	c3                   	ret
+
+0000000000800cab <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800cab:	55                   	push   %rbp
+  800cac:	48 89 e5             	mov    %rsp,%rbp
+	return memmove(dst, src, n);
+  800caf:	48 b8 46 0c 80 00 00 	movabs $0x800c46,%rax
+  800cb6:	00 00 00 
+  800cb9:	ff d0                	call   *%rax
+}
+  800cbb:	5d                   	pop    %rbp
+  800cbc:	c3                   	ret
+
+0000000000800cbd <memcmp>:
+memcmp(const void *v1, const void *v2, size_t n)
+{
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc2:	48 39 c2             	cmp    %rax,%rdx
+  800cc5:	74 1e                	je     800ce5 <memcmp+0x28>
+		if (*s1 != *s2)
+  800cc7:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ccb:	48 83 c0 01          	add    $0x1,%rax
+  800ccf:	44 0f b6 44 06 ff    	movzbl -0x1(%rsi,%rax,1),%r8d
+  800cd5:	44 38 c1             	cmp    %r8b,%cl
+  800cd8:	74 e8                	je     800cc2 <memcmp+0x5>
+			return (int) *s1 - (int) *s2;
+  800cda:	0f b6 c1             	movzbl %cl,%eax
+  800cdd:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ce1:	44 29 c0             	sub    %r8d,%eax
+  800ce4:	c3                   	ret
+		s1++, s2++;
+	}
+
+	return 0;
+  800ce5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cea:	c3                   	ret
+
+0000000000800ceb <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ceb:	48 89 f8             	mov    %rdi,%rax
+	const void *ends = (const char *) s + n;
+  800cee:	48 01 fa             	add    %rdi,%rdx
+	for (; s < ends; s++)
+  800cf1:	eb 04                	jmp    800cf7 <memfind+0xc>
+  800cf3:	48 83 c0 01          	add    $0x1,%rax
+  800cf7:	48 39 d0             	cmp    %rdx,%rax
+  800cfa:	73 05                	jae    800d01 <memfind+0x16>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800cfc:	40 38 30             	cmp    %sil,(%rax)
+  800cff:	75 f2                	jne    800cf3 <memfind+0x8>
+			break;
+	return (void *) s;
+}
+  800d01:	c3                   	ret
+
+0000000000800d02 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d02:	48 89 f9             	mov    %rdi,%rcx
+  800d05:	49 89 f0             	mov    %rsi,%r8
+  800d08:	89 d7                	mov    %edx,%edi
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d0a:	eb 04                	jmp    800d10 <strtol+0xe>
+		s++;
+  800d0c:	48 83 c1 01          	add    $0x1,%rcx
+	while (*s == ' ' || *s == '\t')
+  800d10:	0f b6 01             	movzbl (%rcx),%eax
+  800d13:	3c 20                	cmp    $0x20,%al
+  800d15:	74 f5                	je     800d0c <strtol+0xa>
+  800d17:	3c 09                	cmp    $0x9,%al
+  800d19:	74 f1                	je     800d0c <strtol+0xa>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d1b:	3c 2b                	cmp    $0x2b,%al
+  800d1d:	74 2b                	je     800d4a <strtol+0x48>
+	int neg = 0;
+  800d1f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+		s++;
+	else if (*s == '-')
+  800d25:	3c 2d                	cmp    $0x2d,%al
+  800d27:	74 2d                	je     800d56 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d29:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800d2f:	75 0f                	jne    800d40 <strtol+0x3e>
+  800d31:	80 39 30             	cmpb   $0x30,(%rcx)
+  800d34:	74 2c                	je     800d62 <strtol+0x60>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d36:	85 ff                	test   %edi,%edi
+  800d38:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d3d:	0f 44 f8             	cmove  %eax,%edi
+  800d40:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800d45:	4c 63 d7             	movslq %edi,%r10
+  800d48:	eb 4f                	jmp    800d99 <strtol+0x97>
+		s++;
+  800d4a:	48 83 c1 01          	add    $0x1,%rcx
+	int neg = 0;
+  800d4e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800d54:	eb d3                	jmp    800d29 <strtol+0x27>
+		s++, neg = 1;
+  800d56:	48 83 c1 01          	add    $0x1,%rcx
+  800d5a:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  800d60:	eb c7                	jmp    800d29 <strtol+0x27>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d62:	80 79 01 78          	cmpb   $0x78,0x1(%rcx)
+  800d66:	74 0f                	je     800d77 <strtol+0x75>
+	else if (base == 0 && s[0] == '0')
+  800d68:	85 ff                	test   %edi,%edi
+  800d6a:	75 d4                	jne    800d40 <strtol+0x3e>
+		s++, base = 8;
+  800d6c:	48 83 c1 01          	add    $0x1,%rcx
+  800d70:	bf 08 00 00 00       	mov    $0x8,%edi
+  800d75:	eb c9                	jmp    800d40 <strtol+0x3e>
+		s += 2, base = 16;
+  800d77:	48 83 c1 02          	add    $0x2,%rcx
+  800d7b:	bf 10 00 00 00       	mov    $0x10,%edi
+  800d80:	eb be                	jmp    800d40 <strtol+0x3e>
+			dig = *s - '0';
+  800d82:	0f be c0             	movsbl %al,%eax
+  800d85:	83 e8 30             	sub    $0x30,%eax
+		if (dig >= base)
+  800d88:	39 f8                	cmp    %edi,%eax
+  800d8a:	7d 3b                	jge    800dc7 <strtol+0xc5>
+		s++, val = (val * base) + dig;
+  800d8c:	48 83 c1 01          	add    $0x1,%rcx
+  800d90:	49 0f af d2          	imul   %r10,%rdx
+  800d94:	48 98                	cltq
+  800d96:	48 01 c2             	add    %rax,%rdx
+		if (*s >= '0' && *s <= '9')
+  800d99:	0f b6 01             	movzbl (%rcx),%eax
+  800d9c:	8d 70 d0             	lea    -0x30(%rax),%esi
+  800d9f:	40 80 fe 09          	cmp    $0x9,%sil
+  800da3:	76 dd                	jbe    800d82 <strtol+0x80>
+		else if (*s >= 'a' && *s <= 'z')
+  800da5:	8d 70 9f             	lea    -0x61(%rax),%esi
+  800da8:	40 80 fe 19          	cmp    $0x19,%sil
+  800dac:	77 08                	ja     800db6 <strtol+0xb4>
+			dig = *s - 'a' + 10;
+  800dae:	0f be c0             	movsbl %al,%eax
+  800db1:	83 e8 57             	sub    $0x57,%eax
+  800db4:	eb d2                	jmp    800d88 <strtol+0x86>
+		else if (*s >= 'A' && *s <= 'Z')
+  800db6:	8d 70 bf             	lea    -0x41(%rax),%esi
+  800db9:	40 80 fe 19          	cmp    $0x19,%sil
+  800dbd:	77 08                	ja     800dc7 <strtol+0xc5>
+			dig = *s - 'A' + 10;
+  800dbf:	0f be c0             	movsbl %al,%eax
+  800dc2:	83 e8 37             	sub    $0x37,%eax
+  800dc5:	eb c1                	jmp    800d88 <strtol+0x86>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800dc7:	4d 85 c0             	test   %r8,%r8
+  800dca:	74 03                	je     800dcf <strtol+0xcd>
+		*endptr = (char *) s;
+  800dcc:	49 89 08             	mov    %rcx,(%r8)
+	return (neg ? -val : val);
+  800dcf:	48 89 d0             	mov    %rdx,%rax
+  800dd2:	48 f7 d8             	neg    %rax
+  800dd5:	45 85 c9             	test   %r9d,%r9d
+  800dd8:	48 0f 45 d0          	cmovne %rax,%rdx
+}
+  800ddc:	48 89 d0             	mov    %rdx,%rax
+  800ddf:	c3                   	ret
+
+0000000000800de0 <sys_cputs>:
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+	int64_t ret;
+	register uint64_t r10 asm("r10") = a4;
+  800de0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800de6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	// doesn't save the other caller-saved registers either, so
+	// they are all outputs or clobbers.  The last clause also
+	// tells the assembler that this can potentially change the
+	// condition codes and arbitrary memory locations.
+
+	asm volatile("syscall\n"
+  800dec:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df6:	0f 05                	syscall
+
+void
+sys_cputs(const char *s, size_t len)
+{
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+}
+  800df8:	c3                   	ret
+
+0000000000800df9 <sys_cgetc>:
+	register uint64_t r10 asm("r10") = a4;
+  800df9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800dff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800e05:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e0a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e0f:	48 89 fe             	mov    %rdi,%rsi
+  800e12:	48 89 fa             	mov    %rdi,%rdx
+  800e15:	0f 05                	syscall
+
+int
+sys_cgetc(void)
+{
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e17:	c3                   	ret
+
+0000000000800e18 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800e18:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800e1b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800e21:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800e27:	be 00 00 00 00       	mov    $0x0,%esi
+  800e2c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e31:	48 89 f2             	mov    %rsi,%rdx
+  800e34:	0f 05                	syscall
+	if(check && ret > 0)
+  800e36:	48 85 c0             	test   %rax,%rax
+  800e39:	7f 01                	jg     800e3c <sys_env_destroy+0x24>
+}
+  800e3b:	c3                   	ret
+{
+  800e3c:	55                   	push   %rbp
+  800e3d:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e40:	49 89 c0             	mov    %rax,%r8
+  800e43:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800e48:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  800e4f:	00 00 00 
+  800e52:	be 28 00 00 00       	mov    $0x28,%esi
+  800e57:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  800e5e:	00 00 00 
+  800e61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e66:	49 b9 9b 12 80 00 00 	movabs $0x80129b,%r9
+  800e6d:	00 00 00 
+  800e70:	41 ff d1             	call   *%r9
+
+0000000000800e73 <sys_getenvid>:
+  800e73:	65 8b 04 25 b8 00 00 	mov    %gs:0xb8,%eax
+  800e7a:	00 
+
+// Answered from envs[] without entering the kernel (see thisenv)
+envid_t
+sys_getenvid(void)
+{
+	return thisenv->env_id;
+  800e7b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800e80:	48 8d 14 c0          	lea    (%rax,%rax,8),%rdx
+  800e84:	48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+  800e88:	48 c1 e2 04          	shl    $0x4,%rdx
+  800e8c:	48 b8 00 00 80 bc 00 	movabs $0xbc800000,%rax
+  800e93:	00 00 00 
+  800e96:	48 01 d0             	add    %rdx,%rax
+  800e99:	8b 80 b8 00 00 00    	mov    0xb8(%rax),%eax
+}
+  800e9f:	c3                   	ret
+
+0000000000800ea0 <sys_yield>:
+	register uint64_t r10 asm("r10") = a4;
+  800ea0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800ea6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800eac:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eb1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eb6:	48 89 fe             	mov    %rdi,%rsi
+  800eb9:	48 89 fa             	mov    %rdi,%rdx
+  800ebc:	0f 05                	syscall
+
+void
+sys_yield(void)
+{
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ebe:	c3                   	ret
+
+0000000000800ebf <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  800ebf:	48 63 d2             	movslq %edx,%rdx
+  800ec2:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800ec5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800ecb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800ed1:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ed6:	0f 05                	syscall
+	if(check && ret > 0)
+  800ed8:	48 85 c0             	test   %rax,%rax
+  800edb:	7f 01                	jg     800ede <sys_page_alloc+0x1f>
+}
+  800edd:	c3                   	ret
+{
+  800ede:	55                   	push   %rbp
+  800edf:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ee2:	49 89 c0             	mov    %rax,%r8
+  800ee5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800eea:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  800ef1:	00 00 00 
+  800ef4:	be 28 00 00 00       	mov    $0x28,%esi
+  800ef9:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  800f00:	00 00 00 
+  800f03:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f08:	49 b9 9b 12 80 00 00 	movabs $0x80129b,%r9
+  800f0f:	00 00 00 
+  800f12:	41 ff d1             	call   *%r9
+
+0000000000800f15 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  800f15:	48 63 d2             	movslq %edx,%rdx
+  800f18:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800f1b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800f21:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800f27:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f2c:	0f 05                	syscall
+	if(check && ret > 0)
+  800f2e:	48 85 c0             	test   %rax,%rax
+  800f31:	7f 01                	jg     800f34 <sys_page_alloc_huge+0x1f>
+}
+  800f33:	c3                   	ret
+{
+  800f34:	55                   	push   %rbp
+  800f35:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f38:	49 89 c0             	mov    %rax,%r8
+  800f3b:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800f40:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  800f47:	00 00 00 
+  800f4a:	be 28 00 00 00       	mov    $0x28,%esi
+  800f4f:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  800f56:	00 00 00 
+  800f59:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f5e:	49 b9 9b 12 80 00 00 	movabs $0x80129b,%r9
+  800f65:	00 00 00 
+  800f68:	41 ff d1             	call   *%r9
+
+0000000000800f6b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f6b:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  800f6e:	48 63 d2             	movslq %edx,%rdx
+  800f71:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  800f74:	4d 63 c0             	movslq %r8d,%r8
+	asm volatile("syscall\n"
+  800f77:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f7c:	0f 05                	syscall
+	if(check && ret > 0)
+  800f7e:	48 85 c0             	test   %rax,%rax
+  800f81:	7f 01                	jg     800f84 <sys_page_map+0x19>
+}
+  800f83:	c3                   	ret
+{
+  800f84:	55                   	push   %rbp
+  800f85:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f88:	49 89 c0             	mov    %rax,%r8
+  800f8b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800f90:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  800f97:	00 00 00 
+  800f9a:	be 28 00 00 00       	mov    $0x28,%esi
+  800f9f:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  800fa6:	00 00 00 
+  800fa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fae:	49 b9 9b 12 80 00 00 	movabs $0x80129b,%r9
+  800fb5:	00 00 00 
+  800fb8:	41 ff d1             	call   *%r9
+
+0000000000800fbb <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  800fbb:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  800fbe:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  800fc4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  800fca:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fcf:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fd4:	0f 05                	syscall
+	if(check && ret > 0)
+  800fd6:	48 85 c0             	test   %rax,%rax
+  800fd9:	7f 01                	jg     800fdc <sys_page_unmap+0x21>
+}
+  800fdb:	c3                   	ret
+{
+  800fdc:	55                   	push   %rbp
+  800fdd:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe0:	49 89 c0             	mov    %rax,%r8
+  800fe3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800fe8:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  800fef:	00 00 00 
+  800ff2:	be 28 00 00 00       	mov    $0x28,%esi
+  800ff7:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  800ffe:	00 00 00 
+  801001:	b8 00 00 00 00       	mov    $0x0,%eax
+  801006:	49 b9 9b 12 80 00 00 	movabs $0x80129b,%r9
+  80100d:	00 00 00 
+  801010:	41 ff d1             	call   *%r9
+
+0000000000801013 <sys_fork>:
+	register uint64_t r10 asm("r10") = a4;
+  801013:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801019:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80101f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801024:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801029:	48 89 fe             	mov    %rdi,%rsi
+  80102c:	48 89 fa             	mov    %rdi,%rdx
+  80102f:	0f 05                	syscall
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801031:	c3                   	ret
+
+0000000000801032 <sys_spawn>:
+	register uint64_t r10 asm("r10") = a4;
+  801032:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801038:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80103e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801043:	b8 10 00 00 00       	mov    $0x10,%eax
+  801048:	0f 05                	syscall
+
+envid_t
+sys_spawn(const char *prog, const char **argv)
+{
+	return syscall(SYS_spawn, 0, (uint64_t) prog, (uint64_t) argv, 0, 0, 0);
+}
+  80104a:	c3                   	ret
+
+000000000080104b <sys_thread_create>:
+	register uint64_t r10 asm("r10") = a4;
+  80104b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801051:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801057:	b8 11 00 00 00       	mov    $0x11,%eax
+  80105c:	0f 05                	syscall
+
+envid_t
+sys_thread_create(void *entry, uint64_t a1, uint64_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint64_t) entry, a1, a2, 0, 0);
+}
+  80105e:	c3                   	ret
+
+000000000080105f <sys_page_batch>:
+
+int
+sys_page_batch(envid_t srcenv, envid_t dstenv, const struct PageOp *ops, size_t nops)
+{
+  80105f:	49 89 ca             	mov    %rcx,%r10
+	return syscall(SYS_page_batch, 1, srcenv, dstenv, (uint64_t) ops, nops, 0);
+  801062:	48 63 f6             	movslq %esi,%rsi
+  801065:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r8 asm("r8") = a5;
+  801068:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80106e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801073:	0f 05                	syscall
+	if(check && ret > 0)
+  801075:	48 85 c0             	test   %rax,%rax
+  801078:	7f 01                	jg     80107b <sys_page_batch+0x1c>
+}
+  80107a:	c3                   	ret
+{
+  80107b:	55                   	push   %rbp
+  80107c:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80107f:	49 89 c0             	mov    %rax,%r8
+  801082:	b9 12 00 00 00       	mov    $0x12,%ecx
+  801087:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  80108e:	00 00 00 
+  801091:	be 28 00 00 00       	mov    $0x28,%esi
+  801096:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  80109d:	00 00 00 
+  8010a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a5:	49 b9 9b 12 80 00 00 	movabs $0x80129b,%r9
+  8010ac:	00 00 00 
+  8010af:	41 ff d1             	call   *%r9
+
+00000000008010b2 <sys_ring_setup>:
+	register uint64_t r10 asm("r10") = a4;
+  8010b2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8010b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8010be:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c3:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010c8:	48 89 f2             	mov    %rsi,%rdx
+  8010cb:	0f 05                	syscall
+	if(check && ret > 0)
+  8010cd:	48 85 c0             	test   %rax,%rax
+  8010d0:	7f 01                	jg     8010d3 <sys_ring_setup+0x21>
+
+int
+sys_ring_setup(void *va)
+{
+	return syscall(SYS_ring_setup, 1, (uint64_t) va, 0, 0, 0, 0);
+}
+  8010d2:	c3                   	ret
+{
+  8010d3:	55                   	push   %rbp
+  8010d4:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d7:	49 89 c0             	mov    %rax,%r8
+  8010da:	b9 13 00 00 00       	mov    $0x13,%ecx
+  8010df:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  8010e6:	00 00 00 
+  8010e9:	be 28 00 00 00       	mov    $0x28,%esi
+  8010ee:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  8010f5:	00 00 00 
+  8010f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010fd:	49 b9 9b 12 80 00 00 	movabs $0x80129b,%r9
+  801104:	00 00 00 
+  801107:	41 ff d1             	call   *%r9
+
+000000000080110a <sys_ring_enter>:
+	register uint64_t r10 asm("r10") = a4;
+  80110a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801110:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801116:	bf 00 00 00 00       	mov    $0x0,%edi
+  80111b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801120:	48 89 fe             	mov    %rdi,%rsi
+  801123:	48 89 fa             	mov    %rdi,%rdx
+  801126:	0f 05                	syscall
+
+int
+sys_ring_enter(void)
+{
+	return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0);
+}
+  801128:	c3                   	ret
+
+0000000000801129 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint64_t) va, len, 0, 0);
+  801129:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  80112c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801132:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  801138:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80113d:	0f 05                	syscall
+	if(check && ret > 0)
+  80113f:	48 85 c0             	test   %rax,%rax
+  801142:	7f 01                	jg     801145 <sys_page_unmap_range+0x1c>
+}
+  801144:	c3                   	ret
+{
+  801145:	55                   	push   %rbp
+  801146:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801149:	49 89 c0             	mov    %rax,%r8
+  80114c:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801151:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  801158:	00 00 00 
+  80115b:	be 28 00 00 00       	mov    $0x28,%esi
+  801160:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  801167:	00 00 00 
+  80116a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80116f:	49 b9 9b 12 80 00 00 	movabs $0x80129b,%r9
+  801176:	00 00 00 
+  801179:	41 ff d1             	call   *%r9
+
+000000000080117c <sys_env_set_status>:
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80117c:	48 63 f6             	movslq %esi,%rsi
+  80117f:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  801182:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801188:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80118e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801193:	b8 08 00 00 00       	mov    $0x8,%eax
+  801198:	0f 05                	syscall
+	if(check && ret > 0)
+  80119a:	48 85 c0             	test   %rax,%rax
+  80119d:	7f 01                	jg     8011a0 <sys_env_set_status+0x24>
+}
+  80119f:	c3                   	ret
+{
+  8011a0:	55                   	push   %rbp
+  8011a1:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a4:	49 89 c0             	mov    %rax,%r8
+  8011a7:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8011ac:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  8011b3:	00 00 00 
+  8011b6:	be 28 00 00 00       	mov    $0x28,%esi
+  8011bb:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  8011c2:	00 00 00 
+  8011c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ca:	49 b9 9b 12 80 00 00 	movabs $0x80129b,%r9
+  8011d1:	00 00 00 
+  8011d4:	41 ff d1             	call   *%r9
+
+00000000008011d7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8011d7:	48 63 ff             	movslq %edi,%rdi
+	register uint64_t r10 asm("r10") = a4;
+  8011da:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  8011e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  8011e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011eb:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011f0:	0f 05                	syscall
+	if(check && ret > 0)
+  8011f2:	48 85 c0             	test   %rax,%rax
+  8011f5:	7f 01                	jg     8011f8 <sys_env_set_pgfault_upcall+0x21>
+}
+  8011f7:	c3                   	ret
+{
+  8011f8:	55                   	push   %rbp
+  8011f9:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011fc:	49 89 c0             	mov    %rax,%r8
+  8011ff:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801204:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  80120b:	00 00 00 
+  80120e:	be 28 00 00 00       	mov    $0x28,%esi
+  801213:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  80121a:	00 00 00 
+  80121d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801222:	49 b9 9b 12 80 00 00 	movabs $0x80129b,%r9
+  801229:	00 00 00 
+  80122c:	41 ff d1             	call   *%r9
+
+000000000080122f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80122f:	48 63 ff             	movslq %edi,%rdi
+  801232:	4c 63 d1             	movslq %ecx,%r10
+	register uint64_t r8 asm("r8") = a5;
+  801235:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80123b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801240:	0f 05                	syscall
+}
+  801242:	c3                   	ret
+
+0000000000801243 <sys_ipc_recv>:
+	register uint64_t r10 asm("r10") = a4;
+  801243:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+	register uint64_t r8 asm("r8") = a5;
+  801249:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+	asm volatile("syscall\n"
+  80124f:	be 00 00 00 00       	mov    $0x0,%esi
+  801254:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801259:	48 89 f2             	mov    %rsi,%rdx
+  80125c:	0f 05                	syscall
+	if(check && ret > 0)
+  80125e:	48 85 c0             	test   %rax,%rax
+  801261:	7f 01                	jg     801264 <sys_ipc_recv+0x21>
+
+int
+sys_ipc_recv(void *dstva)
+{
+	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+}
+  801263:	c3                   	ret
+{
+  801264:	55                   	push   %rbp
+  801265:	48 89 e5             	mov    %rsp,%rbp
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801268:	49 89 c0             	mov    %rax,%r8
+  80126b:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801270:	48 ba e8 17 80 00 00 	movabs $0x8017e8,%rdx
+  801277:	00 00 00 
+  80127a:	be 28 00 00 00       	mov    $0x28,%esi
+  80127f:	48 bf 05 18 80 00 00 	movabs $0x801805,%rdi
+  801286:	00 00 00 
+  801289:	b8 00 00 00 00       	mov    $0x0,%eax
+  80128e:	49 b9 9b 12 80 00 00 	movabs $0x80129b,%r9
+  801295:	00 00 00 
+  801298:	41 ff d1             	call   *%r9
+
+000000000080129b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80129b:	55                   	push   %rbp
+  80129c:	48 89 e5             	mov    %rsp,%rbp
+  80129f:	41 56                	push   %r14
+  8012a1:	41 55                	push   %r13
+  8012a3:	41 54                	push   %r12
+  8012a5:	53                   	push   %rbx
+  8012a6:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8012ad:	49 89 fc             	mov    %rdi,%r12
+  8012b0:	41 89 f5             	mov    %esi,%r13d
+  8012b3:	48 89 d3             	mov    %rdx,%rbx
+  8012b6:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8012bd:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8012c4:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8012cb:	84 c0                	test   %al,%al
+  8012cd:	74 26                	je     8012f5 <_panic+0x5a>
+  8012cf:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8012d6:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8012dd:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8012e1:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8012e5:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8012e9:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8012ed:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8012f1:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8012f5:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8012fc:	00 00 00 
+  8012ff:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  801306:	00 00 00 
+  801309:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80130d:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  801314:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  80131b:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801322:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  801329:	00 00 00 
+  80132c:	4c 8b 30             	mov    (%rax),%r14
+  80132f:	48 b8 73 0e 80 00 00 	movabs $0x800e73,%rax
+  801336:	00 00 00 
+  801339:	ff d0                	call   *%rax
+  80133b:	89 c6                	mov    %eax,%esi
+  80133d:	45 89 e8             	mov    %r13d,%r8d
+  801340:	4c 89 e1             	mov    %r12,%rcx
+  801343:	4c 89 f2             	mov    %r14,%rdx
+  801346:	48 bf 18 18 80 00 00 	movabs $0x801818,%rdi
+  80134d:	00 00 00 
+  801350:	b8 00 00 00 00       	mov    $0x0,%eax
+  801355:	49 bc 3b 02 80 00 00 	movabs $0x80023b,%r12
+  80135c:	00 00 00 
+  80135f:	41 ff d4             	call   *%r12
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801362:	48 8d b5 18 ff ff ff 	lea    -0xe8(%rbp),%rsi
+  801369:	48 89 df             	mov    %rbx,%rdi
+  80136c:	48 b8 d7 01 80 00 00 	movabs $0x8001d7,%rax
+  801373:	00 00 00 
+  801376:	ff d0                	call   *%rax
+	cprintf("\n");
+  801378:	48 bf 3b 18 80 00 00 	movabs $0x80183b,%rdi
+  80137f:	00 00 00 
+  801382:	b8 00 00 00 00       	mov    $0x0,%eax
+  801387:	41 ff d4             	call   *%r12
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80138a:	cc                   	int3
+	while (1)
+  80138b:	eb fd                	jmp    80138a <_panic+0xef>
@@ -0,0 +1,47 @@
+// Compare the latency of fork (sys_fork) with the user-level ufork,
+// for a process with a few hundred pages mapped.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NPAGES	256
+#define NFORKS	10
+
+static char buf[NPAGES * PGSIZE] __attribute__((aligned(PGSIZE)));
+
+static uint64_t
+bench(const char *name, envid_t (*forkfn)(void))
+{
+	uint64_t start, total = 0;
+	envid_t who;
+	int i;
+
+	for (i = 0; i < NFORKS; i++) {
+		start = read_tsc();
+		if ((who = forkfn()) < 0)
+			panic("%s: %e", name, who);
+		if (who == 0)
+			exit();
+		total += read_tsc() - start;
+		while (envs[ENVX(who)].env_status != ENV_FREE)
+			sys_yield();
+	}
+	cprintf("forkbench: %s: %ld cycles per fork\n", name, total / NFORKS);
+	return total / NFORKS;
+}
+
+void
+umain(int argc, char **argv)
+{
+	uint64_t k, u;
+	int i;
+
+	// touch every page so there is something to copy
+	for (i = 0; i < NPAGES; i++)
+		buf[i * PGSIZE] = i;
+
+	u = bench("ufork", ufork);
+	k = bench("fork", fork);
+	cprintf("forkbench: fork is %ld.%02ldx as fast as ufork\n",
+		u / k, (u * 100 / k) % 100);
+}
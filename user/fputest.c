@@ -0,0 +1,54 @@
+// Check that each env keeps its own FPU/SSE state: two envs keep
+// values in xmm0 across yields to each other, and do floating point
+// arithmetic that is interrupted by the timer.
+
+#include <inc/lib.h>
+
+#define NROUNDS	100
+
+// Put 'v' in xmm0, yield with int $T_SYSCALL (which saves every
+// general-purpose register), and return what xmm0 holds afterwards.
+static uint64_t
+xmm0_across_yield(uint64_t v)
+{
+	uint64_t out, num = SYS_yield;
+
+	asm volatile("movq %2, %%xmm0\n"
+		     "int %3\n"
+		     "movq %%xmm0, %1\n"
+		     : "+a" (num), "=r" (out)
+		     : "r" (v), "i" (T_SYSCALL)
+		     : "xmm0", "cc", "memory");
+	return out;
+}
+
+static double
+sum(int n, double step)
+{
+	volatile double x = 0;
+	int i;
+
+	for (i = 0; i < n; i++)
+		x += step;
+	return x;
+}
+
+void
+umain(int argc, char **argv)
+{
+	uint64_t v, tag;
+	envid_t who;
+	int i;
+
+	who = fork();
+	if (who < 0)
+		panic("fork: %e", who);
+	tag = (uint64_t) (who == 0 ? 2 : 1) << 32;
+
+	for (i = 0; i < NROUNDS; i++)
+		if ((v = xmm0_across_yield(tag | i)) != (tag | i))
+			panic("xmm0 is %lx, not %lx", v, tag | i);
+	if (sum(1 << 20, who == 0 ? 0.5 : 0.25) != (who == 0 ? 524288.0 : 262144.0))
+		panic("wrong floating point sum");
+	cprintf("fputest: %s OK\n", who == 0 ? "child" : "parent");
+}
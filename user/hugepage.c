@@ -0,0 +1,59 @@
+// Test 2MB huge pages: allocation, partial unmap, copy-on-write
+// after fork, and range unmap.
+
+#include <inc/lib.h>
+
+#define HUGE	((char *) 0x10000000)	// 2MB-aligned
+
+void
+umain(int argc, char **argv)
+{
+	envid_t who;
+	int i, r;
+
+	if ((r = sys_page_alloc_huge(0, HUGE, PTE_P|PTE_U|PTE_W)) < 0)
+		panic("sys_page_alloc_huge: %e", r);
+	if (!(uvpd[PGNUM(HUGE) / NPTENTRIES] & PTE_PS))
+		panic("%p is not mapped with a 2MB page", HUGE);
+
+	// the whole 2MB starts out zeroed and writable
+	for (i = 0; i < PTSIZE; i += PGSIZE) {
+		assert(*(int *) (HUGE + i) == 0);
+		*(int *) (HUGE + i) = i;
+	}
+
+	// unmapping one 4KB page leaves the rest alone
+	if ((r = sys_page_unmap(0, HUGE + 7 * PGSIZE)) < 0)
+		panic("sys_page_unmap: %e", r);
+	assert(!(uvpd[PGNUM(HUGE) / NPTENTRIES] & PTE_PS));
+	assert(!(uvpt[PGNUM(HUGE + 7 * PGSIZE)] & PTE_P));
+	for (i = 0; i < PTSIZE; i += PGSIZE)
+		if (i != 7 * PGSIZE)
+			assert(*(int *) (HUGE + i) == i);
+	cprintf("hugepage: partial unmap ok\n");
+
+	// a second huge page, shared copy-on-write with a child
+	if ((r = sys_page_alloc_huge(0, HUGE + PTSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+		panic("sys_page_alloc_huge: %e", r);
+	*(int *) (HUGE + PTSIZE) = 1;
+
+	if ((who = fork()) < 0)
+		panic("fork: %e", who);
+	if (who == 0) {
+		*(int *) (HUGE + PTSIZE) = 2;
+		assert(*(int *) (HUGE + PTSIZE + PGSIZE) == 0);
+		cprintf("hugepage: child wrote its copy\n");
+		return;
+	}
+	while (envs[ENVX(who)].env_status != ENV_FREE)
+		sys_yield();
+	assert(*(int *) (HUGE + PTSIZE) == 1);
+	cprintf("hugepage: copy-on-write ok\n");
+
+	// one call takes down both, page tables included
+	if ((r = sys_page_unmap_range(0, HUGE, 2 * PTSIZE)) < 0)
+		panic("sys_page_unmap_range: %e", r);
+	assert(!(uvpd[PGNUM(HUGE) / NPTENTRIES] & PTE_P));
+	assert(!(uvpd[PGNUM(HUGE + PTSIZE) / NPTENTRIES] & PTE_P));
+	cprintf("hugepage: range unmap ok\n");
+}
@@ -0,0 +1,61 @@
+// Compare the cost of a null system call (getenvid) entered with
+// SYSCALL and with int $T_SYSCALL, and of sys_getenvid, which reads
+// the answer from envs[] without entering the kernel.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NCALLS	10000
+
+static envid_t
+getenvid_int(void)
+{
+	envid_t ret;
+
+	asm volatile("int %1\n"
+		     : "=a" (ret)
+		     : "i" (T_SYSCALL), "a" (SYS_getenvid)
+		     : "cc", "memory");
+	return ret;
+}
+
+static envid_t
+getenvid_syscall(void)
+{
+	envid_t ret;
+
+	// see lib/syscall.c for what SYSCALL clobbers
+	asm volatile("syscall\n"
+		     : "=a" (ret)
+		     : "a" (SYS_getenvid)
+		     : "rcx", "rdx", "rsi", "rdi", "r8", "r9", "r10", "r11",
+		       "cc", "memory");
+	return ret;
+}
+
+static uint64_t
+bench(const char *name, envid_t (*getid)(void))
+{
+	uint64_t start, cycles;
+	int i;
+
+	start = read_tsc();
+	for (i = 0; i < NCALLS; i++)
+		if (getid() != thisenv->env_id)
+			panic("%s: wrong envid", name);
+	cycles = (read_tsc() - start) / NCALLS;
+	cprintf("nullsyscall: %s: %ld cycles per call\n", name, cycles);
+	return cycles;
+}
+
+void
+umain(int argc, char **argv)
+{
+	uint64_t s, i;
+
+	i = bench("int", getenvid_int);
+	s = bench("syscall", getenvid_syscall);
+	bench("sys_getenvid", sys_getenvid);
+	cprintf("nullsyscall: SYSCALL saves %ld cycles per call\n", i - s);
+	cprintf("nullsyscall: on CPU %d, %ld ns since boot\n", getcpu(), time_nsec());
+}
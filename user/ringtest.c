@@ -0,0 +1,82 @@
+// Queue system calls on the system call ring, check their completions,
+// and compare mapping pages one system call at a time with mapping them
+// through the ring.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NPAGES	RING_SQ_SIZE
+
+static int64_t results[8];
+
+static void
+submit(uint32_t num, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4,
+       uint64_t a5, uint64_t data)
+{
+	int r;
+
+	if ((r = ring_submit(num, a1, a2, a3, a4, a5, data)) < 0)
+		panic("ring_submit: %e", r);
+}
+
+// Wait for 'n' completions, storing results by their data.
+static void
+reap(int n)
+{
+	struct RingCqe cqe;
+
+	while (n > 0) {
+		if (!ring_reap(&cqe)) {
+			sys_ring_enter();
+			continue;
+		}
+		if (cqe.cqe_data < 8)
+			results[cqe.cqe_data] = cqe.cqe_result;
+		else if (cqe.cqe_result < 0)
+			panic("request %ld: %e", cqe.cqe_data, (int) cqe.cqe_result);
+		n--;
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+	static const char msg[] = "ringtest: hello from the ring\n";
+	uint64_t start, direct, ringed;
+	int i, r;
+
+	submit(SYS_cputs, (uint64_t) msg, sizeof(msg) - 1, 0, 0, 0, 0);
+	submit(SYS_page_alloc, 0, (uint64_t) UTEMP, PTE_P|PTE_U|PTE_W, 0, 0, 1);
+	submit(SYS_page_map, 0, (uint64_t) UTEMP, 0, (uint64_t) UTEMP + PGSIZE,
+	       PTE_P|PTE_U, 2);
+	submit(SYS_getenvid, 0, 0, 0, 0, 0, 3);
+	submit(SYS_yield, 0, 0, 0, 0, 0, 4);
+	submit(SYS_cputs, ULIM, 10, 0, 0, 0, 5);
+	if ((r = sys_ring_enter()) != 6)
+		panic("sys_ring_enter: %d completions, not 6", r);
+	reap(6);
+	assert(results[0] == 0 && results[1] == 0 && results[2] == 0);
+	assert(results[3] == thisenv->env_id);
+	assert(results[4] == -E_INVAL);
+	assert(results[5] == -E_FAULT);
+	*(int *) UTEMP = 0x1234;
+	assert(*(int *) (UTEMP + PGSIZE) == 0x1234);
+
+	start = read_tsc();
+	for (i = 0; i < NPAGES; i++)
+		if ((r = sys_page_map(0, UTEMP, 0, UTEMP + (i + 2) * PGSIZE, PTE_P|PTE_U)) < 0)
+			panic("sys_page_map: %e", r);
+	direct = read_tsc() - start;
+
+	start = read_tsc();
+	for (i = 0; i < NPAGES; i++)
+		submit(SYS_page_map, 0, (uint64_t) UTEMP, 0,
+		       (uint64_t) UTEMP + (i + 2) * PGSIZE, PTE_P|PTE_U, 8 + i);
+	sys_ring_enter();
+	reap(NPAGES);
+	ringed = read_tsc() - start;
+
+	cprintf("ringtest: %d page maps: %ld cycles direct, %ld cycles on the ring\n",
+		NPAGES, direct, ringed);
+	cprintf("ringtest: OK\n");
+}
@@ -0,0 +1,24 @@
+// Spawn a copy of this program with some arguments, and have the
+// copy print them.
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	const char *args[] = { "spawnargs", "one", "two", "three", NULL };
+	envid_t who;
+	int i;
+
+	if (argc > 1) {
+		for (i = 0; i < argc; i++)
+			cprintf("spawnargs: argv[%d] = %s\n", i, argv[i]);
+		return;
+	}
+
+	if ((who = sys_spawn("spawnargs", args)) < 0)
+		panic("sys_spawn: %e", who);
+	cprintf("spawnargs: spawned %08x\n", who);
+	if ((who = sys_spawn("nosuchprogram", args)) != -E_INVAL)
+		panic("sys_spawn of a missing program: %e", who);
+}